@@ -8,138 +8,137 @@
 
 #include <inttypes.h>
 #include "AVLTree.h"
-#include "Clock.h"
+#include "Benchmarks.h"
 #include "Utility.h"
 
-void
-avl_bench_IO(unsigned_t elements, unsigned_t iterations)
+struct avl_bench
+{
+    unsigned_t elements;
+    Interface_t *interface;
+};
+
+// Inserts the same random keys in every sample
+static AVLTree_t *
+avl_bench_fill(Benchmark_t *bench, struct avl_bench *b, bool timed)
 {
     srand(5113);
 
-    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
-                                           display_int64_t, free, NULL, NULL);
+    AVLTree_t *tree = avl_new(b->interface);
 
-    if (!interface)
-        return;
+    if (!tree)
+    {
+        bch_fail(bench, "avl_new");
+        return NULL;
+    }
+
+    int64_t max = (int64_t)b->elements;
 
-    Clock_t *stopwatch = clk_new(iterations);
+    if (timed)
+        bch_start(bench);
 
-    if (!stopwatch)
+    for (unsigned_t j = 0; j < b->elements; j++)
     {
-        interface_free(interface);
-        return;
+        void *element = new_int64_t(random_int64_t(-max, max));
+
+        if (!avl_insert(tree, element))
+            free(element);
     }
 
-    AVLTree_t *tree = avl_new(interface);
+    if (timed)
+        bch_stop(bench);
+
+    return tree;
+}
+
+static void
+avl_bench_insert(Benchmark_t *bench, void *argument)
+{
+    AVLTree_t *tree = avl_bench_fill(bench, argument, true);
+
+    if (tree)
+        avl_free(tree);
+}
+
+// Searches every key in the range of the inserted ones, about half of which
+// are present
+static void
+avl_bench_search(Benchmark_t *bench, void *argument)
+{
+    struct avl_bench *b = argument;
+
+    AVLTree_t *tree = avl_bench_fill(bench, b, false);
 
     if (!tree)
-    {
-        interface_free(interface);
-        clk_free(stopwatch);
         return;
-    }
 
-    double *insertion_timings = malloc(sizeof(double) * iterations);
-    double *removal_timings = malloc(sizeof(double) * iterations);
-    double *search_timings = malloc(sizeof(double) * iterations);
+    int64_t max = (int64_t)b->elements;
 
-    unsigned_t insertion_total = 0, removal_total = 0, search_total = 0;
+    integer_t found = 0;
 
-    if (!insertion_timings || !removal_timings || !search_timings)
-    {
-        avl_free(tree);
-        clk_free(stopwatch);
-        interface_free(interface);
+    bch_start(bench);
+
+    for (int64_t j = -max; j <= max; j++)
+        found += avl_contains(tree, &j);
+
+    bch_stop(bench);
+
+    if (found != avl_size(tree))
+        bch_fail(bench, "avl_contains");
+
+    avl_free(tree);
+}
+
+static void
+avl_bench_remove(Benchmark_t *bench, void *argument)
+{
+    struct avl_bench *b = argument;
+
+    AVLTree_t *tree = avl_bench_fill(bench, b, false);
+
+    if (!tree)
         return;
-    }
 
-    int64_t min = elements * (-1);
-    int64_t max = elements;
-    void *element = NULL;
-    bool success;
-    for (unsigned_t i = 0; i < iterations; i++)
-    {
-        // Insertion
-        clk_start(stopwatch);
-        for (unsigned_t j = 0; j < elements; j++)
-        {
-            element = new_int64_t(random_int64_t(min, max));
-            success = avl_insert(tree, element);
-            if (!success)
-                free(element);
-        }
-        clk_stop(stopwatch);
-        insertion_timings[insertion_total++] = stopwatch->time;
-
-        clk_reset(stopwatch);
-
-        // Search
-        clk_start(stopwatch);
-        for (int64_t j = min; j <= max; j++)
-        {
-            success = avl_contains(tree, &j);
-        }
-        clk_stop(stopwatch);
-        search_timings[search_total++] = stopwatch->time;
-
-        clk_reset(stopwatch);
-
-        // Removal
-        int64_t *search = new_int64_t(min);
-        clk_start(stopwatch);
-        for (int64_t j = min; j <= max; j++)
-        {
-            *search = j;
-            success = avl_remove(tree, search);
-        }
-        clk_stop(stopwatch);
-        removal_timings[removal_total++] = stopwatch->time;
-        free(search);
-
-        if (avl_size(tree) != 0)
-            printf("ERROR\n");
-
-        clk_reset(stopwatch);
-        avl_erase(tree);
-    }
+    int64_t max = (int64_t)b->elements;
 
-    // The result will be sum / iterations
-    double insertion_sum = 0.0, search_sum = 0.0, removal_sum = 0.0;
+    bch_start(bench);
 
-    for (unsigned_t i = 0; i < iterations; i++)
-    {
-        insertion_sum += insertion_timings[i];
-        search_sum += search_timings[i];
-        removal_sum += removal_timings[i];
-    }
+    for (int64_t j = -max; j <= max; j++)
+        avl_remove(tree, &j);
+
+    bch_stop(bench);
+
+    if (avl_size(tree) != 0)
+        bch_fail(bench, "avl_remove");
 
     avl_free(tree);
-    clk_free(stopwatch);
-    interface_free(interface);
-    free(insertion_timings);
-    free(search_timings);
-    free(removal_timings);
-
-    printf("+--------------------------------------------------+\n");
-    printf("  Total elements added   : %" PRIuMAX "\n", elements);
-    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
-    printf("+--------------------------------------------------+\n");
-    printf("  Average insertion time : %lf seconds\n", insertion_sum / (double)iterations);
-    printf("  Average removal time   : %lf seconds\n", removal_sum / (double)iterations);
-    printf("  Average search time    : %lf seconds\n", search_sum / (double)iterations);
-    printf("+--------------------------------------------------+\n");
 }
 
 // Runs all AVLTree benchmarks
-void AVLTreeBench(void)
+void AVLTreeBench(Benchmark_t *bench)
 {
-    printf("+------------------------------------------------------------+\n");
-    printf("|                     AVLTree Benchmark                      |\n");
-    printf("+------------------------------------------------------------+\n");
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    unsigned_t sizes[3] = {10000, 100000, 1000000};
+
+    char name[64];
 
-    avl_bench_IO(100000, 100);
-    avl_bench_IO(1000000, 10);
-    avl_bench_IO(10000000, 1);
+    for (int i = 0; i < 3; i++)
+    {
+        struct avl_bench b = { sizes[i], interface };
+
+        snprintf(name, sizeof(name), "AVLTree/insert/%" PRIuMAX, sizes[i]);
+        bch_run(bench, name, avl_bench_insert, &b, sizes[i]);
 
-    printf("\n");
-}
\ No newline at end of file
+        snprintf(name, sizeof(name), "AVLTree/search/%" PRIuMAX, sizes[i]);
+        bch_run(bench, name, avl_bench_search, &b, sizes[i] * 2 + 1);
+
+        snprintf(name, sizeof(name), "AVLTree/remove/%" PRIuMAX, sizes[i]);
+        bch_run(bench, name, avl_bench_remove, &b, sizes[i] * 2 + 1);
+    }
+
+    interface_free(interface);
+}
@@ -8,152 +8,168 @@
 
 #include <inttypes.h>
 #include "AssociativeList.h"
-#include "Clock.h"
+#include "Benchmarks.h"
 #include "Utility.h"
 
-void
-ali_bench_IO(unsigned_t elements, unsigned_t iterations, bool duplicate_keys)
+struct ali_bench
 {
-    srand(5113);
+    unsigned_t elements;
+    bool duplicate_keys;
+    Interface_t *key_interface;
+    Interface_t *value_interface;
+    /// Copies of the keys used for searching and removing, so a removal
+    /// never frees a key that is still used.
+    char **probes;
+};
+
+// Inserts the keys, which the list takes ownership of
+static AssociativeList_t *
+ali_bench_fill(Benchmark_t *bench, struct ali_bench *b, bool timed)
+{
+    AssociativeList_t *list = ali_new(b->key_interface, b->value_interface,
+                                      b->duplicate_keys);
 
-    Interface_t *key_interface = interface_new(compare_string, copy_string,
-            display_string, free, hash_string, NULL);
-    Interface_t *value_interface = interface_new(compare_int32_t, copy_int32_t,
-            display_int32_t, free, hash_int32_t, NULL);
+    if (!list)
+    {
+        bch_fail(bench, "ali_new");
+        return NULL;
+    }
 
-    char **keys = malloc(sizeof(char*) * (size_t)elements);
+    const int64_t V = 9999999999;
 
-    if (!key_interface || ! value_interface || !keys)
-        return;
+    if (timed)
+        bch_start(bench);
+
+    for (unsigned_t j = 0; j < b->elements; j++)
+    {
+        void *key = copy_string(b->probes[j]);
+        void *value = new_int64_t(random_int64_t(-V, V));
 
-    Clock_t *stopwatch = clk_new(iterations);
+        if (!ali_insert(list, key, value))
+        {
+            free(key);
+            free(value);
+        }
+    }
+
+    if (timed)
+        bch_stop(bench);
+
+    return list;
+}
 
-    if (!stopwatch)
+static void
+ali_bench_insert(Benchmark_t *bench, void *argument)
+{
+    AssociativeList_t *list = ali_bench_fill(bench, argument, true);
+
+    if (list)
+        ali_free(list);
+}
+
+static void
+ali_bench_search(Benchmark_t *bench, void *argument)
+{
+    struct ali_bench *b = argument;
+
+    AssociativeList_t *list = ali_bench_fill(bench, b, false);
+
+    if (!list)
         return;
 
-    AssociativeList_t *list = ali_new(key_interface, value_interface, duplicate_keys);
+    unsigned_t found = 0;
+
+    bch_start(bench);
+
+    for (unsigned_t j = 0; j < b->elements; j++)
+        found += ali_get(list, b->probes[j]) != NULL;
+
+    bch_stop(bench);
+
+    if (found != b->elements)
+        bch_fail(bench, "ali_get");
+
+    ali_free(list);
+}
+
+static void
+ali_bench_remove(Benchmark_t *bench, void *argument)
+{
+    struct ali_bench *b = argument;
+
+    AssociativeList_t *list = ali_bench_fill(bench, b, false);
 
     if (!list)
         return;
 
-    double *insertion_timings = malloc(sizeof(double) * (size_t)iterations);
-    double *removal_timings = malloc(sizeof(double) * (size_t)iterations);
-    double *search_timings = malloc(sizeof(double) * (size_t)iterations);
+    void *result = NULL;
 
-    unsigned_t insertion_total = 0, removal_total = 0, search_total = 0;
+    bch_start(bench);
 
-    if (!insertion_timings || !removal_timings || !search_timings)
+    for (unsigned_t j = 0; j < b->elements; j++)
     {
-        ali_free(list);
-        clk_free(stopwatch);
-        interface_free(key_interface);
-        interface_free(value_interface);
-        return;
+        if (ali_remove(list, b->probes[j], &result))
+            free(result);
     }
 
-    const integer_t V = 9999999999;
-    void *value = NULL, *result = NULL;
-    bool success;
-    for (unsigned_t i = 0; i < iterations; i++)
-    {
-        // Fill keys array
-        for (unsigned_t k = 0; k < elements; k++)
-        {
-            keys[k] = random_string(5, 1000, false);
-        }
+    bch_stop(bench);
 
-        clk_reset(stopwatch);
+    if (ali_length(list) != 0)
+        bch_fail(bench, "ali_remove");
 
-        // Insertion
-        clk_start(stopwatch);
-        for (unsigned_t j = 0; j < elements; j++)
-        {
-            value = new_int64_t(random_int64_t(V * -1, V));
+    ali_free(list);
+}
 
-            success = ali_insert(list, keys[j], value);
+// Runs all AssociativeList benchmarks
+void AssociativeListBench(Benchmark_t *bench)
+{
+    Interface_t *key_interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+    Interface_t *value_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, hash_int32_t, NULL);
 
-            if (!success)
-                free(value);
-        }
-        clk_stop(stopwatch);
-        insertion_timings[insertion_total++] = stopwatch->time;
+    unsigned_t sizes[3] = {1000, 10000, 50000};
 
-        clk_reset(stopwatch);
+    char **probes = malloc(sizeof(char *) * sizes[2]);
 
-        // Search
-        clk_start(stopwatch);
-        for (int64_t j = 0; j < elements; j++)
-        {
-            result = ali_get(list, keys[j]);
-        }
-        clk_stop(stopwatch);
-        search_timings[search_total++] = stopwatch->time;
+    if (!key_interface || !value_interface || !probes)
+        goto end;
 
-        clk_reset(stopwatch);
+    srand(5113);
 
-        // Removal
-        clk_start(stopwatch);
-        for (int64_t j = 0; j < elements; j++)
-        {
-            success = ali_remove(list, keys[j], &result);
+    for (unsigned_t k = 0; k < sizes[2]; k++)
+        probes[k] = random_string(5, 1000, false);
 
-            free(result);
+    char name[64];
 
-            if (!success)
-                free(keys[j]);
-        }
-        clk_stop(stopwatch);
-        removal_timings[removal_total++] = stopwatch->time;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int duplicate = 1; duplicate >= 0; duplicate--)
+        {
+            struct ali_bench b = { sizes[i], duplicate, key_interface,
+                                   value_interface, probes };
 
-        if (ali_length(list) != 0)
-            printf("ERROR\n");
+            const char *keys = duplicate ? "duplicate" : "unique";
 
-        ali_erase(list);
-    }
+            snprintf(name, sizeof(name), "AssociativeList/insert/%" PRIuMAX
+                     "/%s", sizes[i], keys);
+            bch_run(bench, name, ali_bench_insert, &b, sizes[i]);
 
-    // The result will be sum / iterations
-    double insertion_sum = 0.0, search_sum = 0.0, removal_sum = 0.0;
+            snprintf(name, sizeof(name), "AssociativeList/search/%" PRIuMAX
+                     "/%s", sizes[i], keys);
+            bch_run(bench, name, ali_bench_search, &b, sizes[i]);
 
-    for (unsigned_t i = 0; i < iterations; i++)
-    {
-        insertion_sum += insertion_timings[i];
-        search_sum += search_timings[i];
-        removal_sum += removal_timings[i];
+            snprintf(name, sizeof(name), "AssociativeList/remove/%" PRIuMAX
+                     "/%s", sizes[i], keys);
+            bch_run(bench, name, ali_bench_remove, &b, sizes[i]);
+        }
     }
 
-    ali_free(list);
-    clk_free(stopwatch);
+    for (unsigned_t k = 0; k < sizes[2]; k++)
+        free(probes[k]);
+
+    end:
+    free(probes);
     interface_free(key_interface);
     interface_free(value_interface);
-    free(insertion_timings);
-    free(search_timings);
-    free(removal_timings);
-    free(keys);
-
-    printf("+--------------------------------------------------+\n");
-    printf("  Total elements added   : %" PRIuMAX "\n", elements);
-    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
-    printf("  Duplicate Keys         : %s\n", duplicate_keys ? "YES" : "NO");
-    printf("+--------------------------------------------------+\n");
-    printf("  Average insertion time : %lf seconds\n", insertion_sum / (double)iterations);
-    printf("  Average removal time   : %lf seconds\n", removal_sum / (double)iterations);
-    printf("  Average search time    : %lf seconds\n", search_sum / (double)iterations);
-    printf("+--------------------------------------------------+\n");
-}
-
-// Runs all AssociativeList benchmarks
-void AssociativeListBench(void)
-{
-    printf("+------------------------------------------------------------+\n");
-    printf("|                 AssociativeList Benchmark                  |\n");
-    printf("+------------------------------------------------------------+\n");
-
-    ali_bench_IO( 10000, 10, true);
-    ali_bench_IO( 10000, 10, false);
-    ali_bench_IO( 50000,  2, true);
-    ali_bench_IO( 50000,  2, false);
-    ali_bench_IO(100000,  1, true);
-    ali_bench_IO(100000,  1, false);
-
-    printf("\n");
 }
@@ -0,0 +1,887 @@
+/**
+ * @file Benchmark.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include <inttypes.h>
+#include "Benchmark.h"
+#include "Clock.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+// Amount of counters a benchmark can report
+#define BCH_COUNTERS 4
+
+struct Benchmark_s
+{
+    /// \brief Benchmarks whose name contains none of these are skipped.
+    char **filters;
+
+    /// \brief Amount of filters. With no filters every benchmark runs.
+    int filter_count;
+
+    /// \brief Prints the names of the benchmarks instead of running them.
+    bool list;
+
+    /// \brief Samples taken and discarded before measuring.
+    unsigned_t warmup;
+
+    /// \brief Minimum and maximum amount of samples.
+    unsigned_t min_samples, max_samples;
+
+    /// \brief Target half-width of the confidence interval, as a fraction of
+    /// the mean.
+    double interval;
+
+    /// \brief Milliseconds after which a benchmark stops taking samples.
+    uint64_t time_limit;
+
+    /// \brief Measures each sample.
+    Clock_t *clock;
+
+    /// \brief Samples of the current benchmark in nanoseconds, and a copy
+    /// that gets sorted.
+    uint64_t *samples, *sorted;
+
+    /// \brief Amount of samples of the current benchmark.
+    unsigned_t count;
+
+    /// \brief If the current benchmark called bch_fail().
+    bool failed;
+
+    /// \brief Largest amount of bytes given to bch_memory() by the current
+    /// benchmark.
+    uint64_t memory;
+
+    /// \brief Largest input size benchmarks should use.
+    unsigned_t max_size;
+
+    /// \brief Most threads multithreaded benchmarks should use.
+    unsigned_t threads;
+
+    /// \brief Path of the workload to replay, or NULL.
+    const char *workload;
+
+    /// \brief Counters given to bch_counter() by the current benchmark.
+    struct bch_counter
+    {
+        const char *name;
+        double total;
+    } counters[BCH_COUNTERS];
+
+    /// \brief Amount of counters of the current benchmark.
+    unsigned_t counter_count;
+
+    /// \brief Benchmarks that were run and failed.
+    unsigned_t run, failures;
+
+    /// \brief Machine readable outputs, or NULL.
+    FILE *json, *csv;
+
+    /// \brief Results written to the outputs.
+    unsigned_t recorded;
+
+    /// \brief Results of a previous run to compare with.
+    struct bch_baseline *baseline;
+
+    /// \brief Amount of results in the baseline.
+    unsigned_t baseline_count;
+
+    /// \brief How much slower than the baseline a median can be, as a
+    /// fraction of it.
+    double threshold;
+
+    /// \brief Benchmarks that are slower than their baseline.
+    unsigned_t regressions;
+};
+
+/// \brief The result of a benchmark in a baseline file.
+struct bch_baseline
+{
+    char *name;
+    double median, mean, half;
+};
+
+/// \brief Statistics of the samples of a benchmark.
+struct bch_summary
+{
+    /// Samples that are not outliers.
+    unsigned_t kept;
+    /// Mean of the kept samples and the half-width of its 95% confidence
+    /// interval.
+    double mean, half;
+    /// Percentiles of every sample, outliers included.
+    double median, p99, p999;
+    /// Peak memory in bytes, or 0 if it was not measured.
+    uint64_t memory;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+bch_usage(const char *program);
+
+static bool
+bch_selected(Benchmark_t *bench, const char *name);
+
+static void
+bch_sample(Benchmark_t *bench, bench_f function, void *argument);
+
+static void
+bch_summarize(Benchmark_t *bench, struct bch_summary *summary);
+
+static void
+bch_record(Benchmark_t *bench, const char *name, struct bch_summary *summary,
+           unsigned_t operations);
+
+static void
+bch_print_counters(Benchmark_t *bench, unsigned_t operations);
+
+static void
+bch_compare_baseline(Benchmark_t *bench, const char *name,
+                     struct bch_summary *summary);
+
+static bool
+bch_load(Benchmark_t *bench, const char *path);
+
+static double
+bch_percentile(const uint64_t *sorted, unsigned_t count, double p);
+
+static int
+bch_compare(const void *a, const void *b);
+
+static void
+bch_time(char *buffer, size_t size, double nanoseconds);
+
+static void
+bch_rate(char *buffer, size_t size, double per_second);
+
+static void
+bch_bytes(char *buffer, size_t size, double bytes);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+Benchmark_t *
+bch_new(int argc, char **argv)
+{
+    Benchmark_t *bench = calloc(1, sizeof(Benchmark_t));
+
+    if (!bench)
+        return NULL;
+
+    bench->filters = calloc((size_t)argc + 1, sizeof(char *));
+
+    if (!bench->filters)
+    {
+        free(bench);
+        return NULL;
+    }
+
+    bench->warmup = 2;
+    bench->min_samples = 5;
+    bench->max_samples = 1000;
+    bench->interval = 0.02;
+    bench->time_limit = 10000;
+    bench->threshold = 0.05;
+    bench->max_size = 1000000;
+    bench->threads = 1;
+
+#ifdef __unix__
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cores > 1)
+        bench->threads = (unsigned_t)cores;
+#endif
+
+    ClockSource source = ClockMonotonic;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *option = argv[i];
+
+        if (strncmp(option, "--", 2) != 0)
+        {
+            bench->filters[bench->filter_count++] = argv[i];
+            continue;
+        }
+
+        if (strcmp(option, "--list") == 0)
+        {
+            bench->list = true;
+            continue;
+        }
+
+        // Every other option takes a value
+        if (i + 1 == argc)
+            goto invalid;
+
+        const char *value = argv[++i];
+        char *end = NULL;
+
+        if (strcmp(option, "--json") == 0 || strcmp(option, "--csv") == 0)
+        {
+            FILE *file = fopen(value, "w");
+
+            if (!file)
+            {
+                printf("Could not open %s\n", value);
+                goto invalid;
+            }
+
+            if (option[2] == 'j')
+            {
+                if (bench->json)
+                    fclose(bench->json);
+
+                bench->json = file;
+
+                fprintf(file, "{\n  \"benchmarks\": [");
+            }
+            else
+            {
+                if (bench->csv)
+                    fclose(bench->csv);
+
+                bench->csv = file;
+
+                fprintf(file, "name,samples,kept,median_ns,p99_ns,p999_ns,"
+                              "mean_ns,ci_ns,ops_per_sec,memory_bytes\n");
+            }
+
+            continue;
+        }
+
+        if (strcmp(option, "--compare") == 0)
+        {
+            if (!bch_load(bench, value))
+            {
+                printf("Could not read the baseline %s\n", value);
+                goto invalid;
+            }
+
+            continue;
+        }
+
+        if (strcmp(option, "--workload") == 0)
+        {
+            bench->workload = value;
+            continue;
+        }
+
+        if (strcmp(option, "--clock") == 0)
+        {
+            if (strcmp(value, "monotonic") == 0)
+                source = ClockMonotonic;
+            else if (strcmp(value, "cycles") == 0)
+                source = ClockCycles;
+            else if (strcmp(value, "thread") == 0)
+                source = ClockThread;
+            else
+                goto invalid;
+
+            continue;
+        }
+
+        double number = strtod(value, &end);
+
+        if (*end != '\0' || number < 0.0)
+            goto invalid;
+
+        if (strcmp(option, "--warmup") == 0)
+            bench->warmup = (unsigned_t)number;
+        else if (strcmp(option, "--min") == 0)
+            bench->min_samples = (unsigned_t)number;
+        else if (strcmp(option, "--max") == 0)
+            bench->max_samples = (unsigned_t)number;
+        else if (strcmp(option, "--ci") == 0)
+            bench->interval = number / 100.0;
+        else if (strcmp(option, "--time") == 0)
+            bench->time_limit = (uint64_t)(number * 1000.0);
+        else if (strcmp(option, "--threshold") == 0)
+            bench->threshold = number / 100.0;
+        else if (strcmp(option, "--max-size") == 0)
+            bench->max_size = (unsigned_t)number;
+        else if (strcmp(option, "--threads") == 0 && number >= 1.0)
+            bench->threads = (unsigned_t)number;
+        else
+            goto invalid;
+    }
+
+    if (bench->min_samples == 0)
+        bench->min_samples = 1;
+
+    if (bench->max_samples < bench->min_samples)
+        bench->max_samples = bench->min_samples;
+
+    bench->clock = clk_create(0, source);
+    bench->samples = malloc(sizeof(uint64_t) * bench->max_samples);
+    bench->sorted = malloc(sizeof(uint64_t) * bench->max_samples);
+
+    if (!bench->clock || !bench->samples || !bench->sorted)
+    {
+        bch_free(bench);
+        return NULL;
+    }
+
+    return bench;
+
+    invalid:
+    bch_usage(argv[0]);
+    bch_free(bench);
+    return NULL;
+}
+
+int
+bch_free(Benchmark_t *bench)
+{
+    int status = bench->failures > 0 || bench->regressions > 0 ? 1 : 0;
+
+    if (!bench->list && bench->clock)
+    {
+        printf("\n  Benchmarks run    : %" PRIuMAX "\n", bench->run);
+        printf("  Benchmarks failed : %" PRIuMAX "\n", bench->failures);
+
+        if (bench->baseline_count > 0)
+            printf("  Regressions       : %" PRIuMAX "\n", bench->regressions);
+    }
+
+    if (bench->json)
+    {
+        fprintf(bench->json, "\n  ]\n}\n");
+        fclose(bench->json);
+    }
+
+    if (bench->csv)
+        fclose(bench->csv);
+
+    for (unsigned_t i = 0; i < bench->baseline_count; i++)
+        free(bench->baseline[i].name);
+
+    free(bench->baseline);
+
+    if (bench->clock)
+        clk_free(bench->clock);
+
+    free(bench->samples);
+    free(bench->sorted);
+    free(bench->filters);
+    free(bench);
+
+    return status;
+}
+
+void
+bch_run(Benchmark_t *bench, const char *name, bench_f function,
+        void *argument, unsigned_t operations)
+{
+    if (!bch_selected(bench, name))
+        return;
+
+    if (bench->list)
+    {
+        printf("%s\n", name);
+        return;
+    }
+
+    if (bench->run == 0)
+        printf("  %-56s %7s %10s %10s %10s %21s %10s %10s%s\n", "Benchmark",
+               "Samples", "Median", "p99", "p99.9", "Mean +- CI", "Ops/s",
+               "Memory", bench->baseline_count > 0 ? "   Change" : "");
+
+    bench->run++;
+    bench->failed = false;
+    bench->count = 0;
+    bench->memory = 0;
+    bench->counter_count = 0;
+
+    for (unsigned_t i = 0; i < bench->warmup && !bench->failed; i++)
+        bch_sample(bench, function, argument);
+
+    bench->count = 0;
+    bench->counter_count = 0;
+
+    uint64_t start = clk_now();
+
+    struct bch_summary summary;
+
+    while (!bench->failed)
+    {
+        bch_sample(bench, function, argument);
+
+        if (bench->count < bench->min_samples)
+            continue;
+
+        bch_summarize(bench, &summary);
+
+        if (summary.half <= summary.mean * bench->interval)
+            break;
+
+        if (bench->count == bench->max_samples ||
+            clk_now() - start >= bench->time_limit)
+            break;
+    }
+
+    if (bench->failed)
+    {
+        bench->failures++;
+        printf("  %-56s FAILED\n", name);
+        return;
+    }
+
+    char median[16], p99[16], p999[16], mean[16], half[16], rate[16];
+    char memory[16] = "-";
+
+    bch_time(median, sizeof(median), summary.median);
+    bch_time(p99, sizeof(p99), summary.p99);
+    bch_time(p999, sizeof(p999), summary.p999);
+    bch_time(mean, sizeof(mean), summary.mean);
+    bch_time(half, sizeof(half), summary.half);
+    bch_rate(rate, sizeof(rate), summary.median > 0.0 ?
+             (double)operations * 1e9 / summary.median : 0.0);
+
+    if (summary.memory > 0)
+        bch_bytes(memory, sizeof(memory), (double)summary.memory);
+
+    printf("  %-56s %3" PRIuMAX "/%-3" PRIuMAX " %10s %10s %10s %10s +- %7s"
+           " %10s %10s", name, summary.kept, bench->count, median, p99, p999,
+           mean, half, rate, memory);
+
+    bch_compare_baseline(bench, name, &summary);
+
+    printf("\n");
+
+    bch_print_counters(bench, operations);
+
+    bch_record(bench, name, &summary, operations);
+}
+
+void
+bch_start(Benchmark_t *bench)
+{
+    clk_start(bench->clock);
+}
+
+void
+bch_stop(Benchmark_t *bench)
+{
+    clk_stop(bench->clock);
+}
+
+void
+bch_memory(Benchmark_t *bench, uint64_t bytes)
+{
+    if (bytes > bench->memory)
+        bench->memory = bytes;
+}
+
+void
+bch_counter(Benchmark_t *bench, const char *name, double value)
+{
+    unsigned_t i = 0;
+
+    while (i < bench->counter_count && strcmp(bench->counters[i].name, name))
+        i++;
+
+    if (i == BCH_COUNTERS)
+        return;
+
+    if (i == bench->counter_count)
+    {
+        bench->counters[i].name = name;
+        bench->counters[i].total = 0.0;
+        bench->counter_count++;
+    }
+
+    bench->counters[i].total += value;
+}
+
+void
+bch_fail(Benchmark_t *bench, const char *reason)
+{
+    if (!bench->failed)
+        printf("  Error: %s\n", reason);
+
+    bench->failed = true;
+}
+
+unsigned_t
+bch_max_size(Benchmark_t *bench)
+{
+    return bench->max_size;
+}
+
+unsigned_t
+bch_threads(Benchmark_t *bench)
+{
+    return bench->threads;
+}
+
+const char *
+bch_workload(Benchmark_t *bench)
+{
+    return bench->workload;
+}
+
+uint64_t
+bch_heap_size(void)
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+
+    return (uint64_t)info.uordblks + (uint64_t)info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+bch_usage(const char *program)
+{
+    printf("Usage: %s [options] [filters...]\n", program);
+    printf("  --list          Print the names of the benchmarks\n");
+    printf("  --warmup N      Samples discarded before measuring\n");
+    printf("  --min N         Minimum amount of samples\n");
+    printf("  --max N         Maximum amount of samples\n");
+    printf("  --ci P          Target confidence interval, in percent\n");
+    printf("  --time S        Seconds spent at most on each benchmark\n");
+    printf("  --clock C       monotonic, cycles or thread\n");
+    printf("  --json FILE     Write the results as JSON\n");
+    printf("  --csv FILE      Write the results as CSV, usable as a baseline\n");
+    printf("  --compare FILE  Compare with a baseline CSV file\n");
+    printf("  --threshold P   Slowdown in percent that is a regression\n");
+    printf("  --max-size N    Largest input size to benchmark\n");
+    printf("  --threads N     Most threads of multithreaded benchmarks\n");
+    printf("  --workload FILE Workload to replay\n");
+}
+
+static bool
+bch_selected(Benchmark_t *bench, const char *name)
+{
+    if (bench->filter_count == 0)
+        return true;
+
+    for (int i = 0; i < bench->filter_count; i++)
+        if (strstr(name, bench->filters[i]))
+            return true;
+
+    return false;
+}
+
+static void
+bch_sample(Benchmark_t *bench, bench_f function, void *argument)
+{
+    clk_reset(bench->clock);
+
+    function(bench, argument);
+
+    // A benchmark that forgot to stop the clock
+    clk_stop(bench->clock);
+
+    bench->samples[bench->count++] = clk_elapsed(bench->clock);
+}
+
+// Samples outside Tukey's fences (1.5 times the interquartile range beyond
+// the quartiles) are left out of the mean, but not of the percentiles
+static void
+bch_summarize(Benchmark_t *bench, struct bch_summary *summary)
+{
+    // Two-sided 95% quantiles of Student's t distribution
+    static const double t95[30] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+
+    unsigned_t count = bench->count;
+
+    memcpy(bench->sorted, bench->samples, sizeof(uint64_t) * count);
+
+    qsort(bench->sorted, count, sizeof(uint64_t), bch_compare);
+
+    double q1 = bch_percentile(bench->sorted, count, 0.25);
+    double q3 = bch_percentile(bench->sorted, count, 0.75);
+
+    double low = q1 - 1.5 * (q3 - q1), high = q3 + 1.5 * (q3 - q1);
+
+    double sum = 0.0, squares = 0.0;
+
+    unsigned_t kept = 0;
+
+    for (unsigned_t i = 0; i < count; i++)
+    {
+        double x = (double)bench->sorted[i];
+
+        if (x < low || x > high)
+            continue;
+
+        sum += x;
+        squares += x * x;
+        kept++;
+    }
+
+    summary->kept = kept;
+    summary->mean = sum / (double)kept;
+    summary->half = 0.0;
+
+    if (kept > 1)
+    {
+        double variance = (squares - sum * summary->mean) / (double)(kept - 1);
+
+        double t = kept - 1 <= 30 ? t95[kept - 2] : 1.960;
+
+        summary->half = t * sqrt(variance > 0.0 ? variance : 0.0)
+                        / sqrt((double)kept);
+    }
+    else
+    {
+        // A single sample says nothing about the spread
+        summary->half = summary->mean;
+    }
+
+    summary->median = bch_percentile(bench->sorted, count, 0.5);
+    summary->p99 = bch_percentile(bench->sorted, count, 0.99);
+    summary->p999 = bch_percentile(bench->sorted, count, 0.999);
+    summary->memory = bench->memory;
+}
+
+// Appends a result to the JSON and CSV outputs
+static void
+bch_record(Benchmark_t *bench, const char *name, struct bch_summary *summary,
+           unsigned_t operations)
+{
+    double rate = summary->median > 0.0 ?
+                  (double)operations * 1e9 / summary->median : 0.0;
+
+    if (bench->json)
+    {
+        fprintf(bench->json, "%s\n    {\"name\": \"%s\", \"samples\": %" PRIuMAX
+                ", \"kept\": %" PRIuMAX ", \"median_ns\": %.1f, \"p99_ns\": %.1f"
+                ", \"p999_ns\": %.1f, \"mean_ns\": %.1f, \"ci_ns\": %.1f"
+                ", \"ops_per_sec\": %.1f, \"memory_bytes\": %" PRIu64,
+                bench->recorded > 0 ? "," : "", name, bench->count,
+                summary->kept, summary->median, summary->p99, summary->p999,
+                summary->mean, summary->half, rate, summary->memory);
+
+        if (bench->counter_count > 0)
+        {
+            fprintf(bench->json, ", \"counters_per_op\": {");
+
+            for (unsigned_t i = 0; i < bench->counter_count; i++)
+                fprintf(bench->json, "%s\"%s\": %.6g", i > 0 ? ", " : "",
+                        bench->counters[i].name, bench->counters[i].total
+                        / ((double)bench->count * (double)operations));
+
+            fprintf(bench->json, "}");
+        }
+
+        fprintf(bench->json, "}");
+        fflush(bench->json);
+    }
+
+    if (bench->csv)
+    {
+        fprintf(bench->csv, "%s,%" PRIuMAX ",%" PRIuMAX ",%.1f,%.1f,%.1f,%.1f,"
+                "%.1f,%.1f,%" PRIu64 "\n", name, bench->count, summary->kept,
+                summary->median, summary->p99, summary->p999, summary->mean,
+                summary->half, rate, summary->memory);
+        fflush(bench->csv);
+    }
+
+    bench->recorded++;
+}
+
+// Prints the counters under the result, as an average per operation
+static void
+bch_print_counters(Benchmark_t *bench, unsigned_t operations)
+{
+    if (bench->counter_count == 0 || operations == 0)
+        return;
+
+    printf("  %56s", "");
+
+    for (unsigned_t i = 0; i < bench->counter_count; i++)
+        printf(" %s %.4g/op", bench->counters[i].name, bench->counters[i].total
+               / ((double)bench->count * (double)operations));
+
+    printf("\n");
+}
+
+// A benchmark regressed when its median is slower than the baseline's by more
+// than the threshold and the confidence intervals of both means don't overlap,
+// so that noise alone is not reported
+static void
+bch_compare_baseline(Benchmark_t *bench, const char *name,
+                     struct bch_summary *summary)
+{
+    if (bench->baseline_count == 0)
+        return;
+
+    for (unsigned_t i = 0; i < bench->baseline_count; i++)
+    {
+        struct bch_baseline *base = &bench->baseline[i];
+
+        if (strcmp(base->name, name) != 0)
+            continue;
+
+        if (base->median <= 0.0)
+            return;
+
+        double change = summary->median / base->median - 1.0;
+
+        printf(" %+7.1f%%", change * 100.0);
+
+        if (change > bench->threshold &&
+            summary->mean - summary->half > base->mean + base->half)
+        {
+            bench->regressions++;
+            printf(" REGRESSION");
+        }
+        else if (change < -bench->threshold &&
+                 summary->mean + summary->half < base->mean - base->half)
+        {
+            printf(" faster");
+        }
+
+        return;
+    }
+
+    printf("      new");
+}
+
+// Reads a CSV file written with --csv
+static bool
+bch_load(Benchmark_t *bench, const char *path)
+{
+    FILE *file = fopen(path, "r");
+
+    if (!file)
+        return false;
+
+    char line[512];
+
+    // Header
+    if (!fgets(line, sizeof(line), file))
+    {
+        fclose(file);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), file))
+    {
+        char *name = strtok(line, ",");
+        char *fields[9];
+
+        int count = 0;
+
+        while (count < 9 && (fields[count] = strtok(NULL, ",\n")) != NULL)
+            count++;
+
+        // Files written before memory_bytes was added have one field less
+        if (!name || count < 8)
+            continue;
+
+        struct bch_baseline *baseline = realloc(bench->baseline,
+                sizeof(struct bch_baseline) * (bench->baseline_count + 1));
+
+        if (!baseline)
+            break;
+
+        bench->baseline = baseline;
+
+        struct bch_baseline *base = &baseline[bench->baseline_count];
+
+        base->name = malloc(strlen(name) + 1);
+
+        if (!base->name)
+            break;
+
+        strcpy(base->name, name);
+
+        base->median = strtod(fields[2], NULL);
+        base->mean = strtod(fields[5], NULL);
+        base->half = strtod(fields[6], NULL);
+
+        bench->baseline_count++;
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+// Linear interpolation between the closest ranks
+static double
+bch_percentile(const uint64_t *sorted, unsigned_t count, double p)
+{
+    double rank = p * (double)(count - 1);
+
+    unsigned_t below = (unsigned_t)rank;
+
+    if (below + 1 >= count)
+        return (double)sorted[count - 1];
+
+    double fraction = rank - (double)below;
+
+    return (double)sorted[below] * (1.0 - fraction)
+           + (double)sorted[below + 1] * fraction;
+}
+
+static int
+bch_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void
+bch_time(char *buffer, size_t size, double nanoseconds)
+{
+    if (nanoseconds < 1e3)
+        snprintf(buffer, size, "%.1f ns", nanoseconds);
+    else if (nanoseconds < 1e6)
+        snprintf(buffer, size, "%.2f us", nanoseconds / 1e3);
+    else if (nanoseconds < 1e9)
+        snprintf(buffer, size, "%.2f ms", nanoseconds / 1e6);
+    else
+        snprintf(buffer, size, "%.3f s", nanoseconds / 1e9);
+}
+
+static void
+bch_rate(char *buffer, size_t size, double per_second)
+{
+    if (per_second < 1e3)
+        snprintf(buffer, size, "%.1f", per_second);
+    else if (per_second < 1e6)
+        snprintf(buffer, size, "%.2fK", per_second / 1e3);
+    else if (per_second < 1e9)
+        snprintf(buffer, size, "%.2fM", per_second / 1e6);
+    else
+        snprintf(buffer, size, "%.2fG", per_second / 1e9);
+}
+
+static void
+bch_bytes(char *buffer, size_t size, double bytes)
+{
+    if (bytes < 1024.0)
+        snprintf(buffer, size, "%.0f B", bytes);
+    else if (bytes < 1024.0 * 1024.0)
+        snprintf(buffer, size, "%.1f KB", bytes / 1024.0);
+    else if (bytes < 1024.0 * 1024.0 * 1024.0)
+        snprintf(buffer, size, "%.1f MB", bytes / (1024.0 * 1024.0));
+    else
+        snprintf(buffer, size, "%.2f GB", bytes / (1024.0 * 1024.0 * 1024.0));
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,145 @@
+/**
+ * @file Benchmark.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BENCHMARK_H
+#define C_DATASTRUCTURES_LIBRARY_BENCHMARK_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct Benchmark_s
+/// \brief A harness that runs, measures and reports benchmarks.
+///
+/// Every benchmark is a function that is called once per sample. It prepares
+/// whatever it needs, calls bch_start() and bch_stop() around the work that
+/// is measured and cleans up. The harness runs a few warmup samples, then
+/// keeps taking samples until the 95% confidence interval of the mean is
+/// within a given percentage of it, discarding outliers, and prints the
+/// median, tail percentiles and operations per second.
+struct Benchmark_s;
+
+/// \ref Benchmark_t
+/// \brief A type for a benchmark harness.
+typedef struct Benchmark_s Benchmark_t;
+
+/// \ref bench_f
+/// \brief A benchmark that takes one sample.
+typedef void (*bench_f)(Benchmark_t *bench, void *argument);
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref bch_new
+/// \brief Creates a harness configured from the program's arguments.
+///
+/// Arguments that don't start with "--" are filters: only benchmarks whose
+/// name contains one of them are run. The options are:
+/// - --list          Prints the names of the benchmarks instead of running
+///                   them;
+/// - --warmup N      Samples taken and discarded before measuring (2);
+/// - --min N         Minimum amount of samples (5);
+/// - --max N         Maximum amount of samples (1000);
+/// - --ci P          Target half-width of the confidence interval, in
+///                   percent of the mean (2);
+/// - --time S        Seconds after which a benchmark stops taking samples
+///                   even if the interval is wider (10);
+/// - --clock C       The Clock_t source: monotonic, cycles or thread;
+/// - --json FILE     Also writes the results to a JSON file;
+/// - --csv FILE      Also writes the results to a CSV file, which can be used
+///                   as a baseline;
+/// - --compare FILE  Compares the results with a baseline CSV file;
+/// - --threshold P   Percentage by which the median of a benchmark can be
+///                   slower than its baseline before it is a regression (5);
+/// - --max-size N    Largest input size benchmarks should use, see
+///                   bch_max_size() (1000000);
+/// - --threads N     Most threads multithreaded benchmarks should use, see
+///                   bch_threads() (the amount of online processors);
+/// - --workload FILE A workload recorded with wkl_save() for benchmarks that
+///                   replay one, see bch_workload().
+///
+/// Returns NULL if the arguments are invalid, after printing the usage.
+Benchmark_t *
+bch_new(int argc, char **argv);
+
+/// \ref bch_free
+/// \brief Prints a summary and frees the harness, returning the exit status
+/// of the program: 1 if a benchmark failed or regressed, otherwise 0.
+int
+bch_free(Benchmark_t *bench);
+
+////////////////////////////////////////////////////////////////// RUNNING ///
+
+/// \ref bch_run
+/// \brief Runs a benchmark if its name passes the filters. Each sample does
+/// a given amount of operations, used to report the throughput.
+void
+bch_run(Benchmark_t *bench, const char *name, bench_f function,
+        void *argument, unsigned_t operations);
+
+/// \ref bch_start
+/// \brief Starts or resumes measuring the current sample.
+void
+bch_start(Benchmark_t *bench);
+
+/// \ref bch_stop
+/// \brief Pauses measuring the current sample.
+void
+bch_stop(Benchmark_t *bench);
+
+/// \ref bch_memory
+/// \brief Reports the bytes used by the current sample. The largest amount
+/// reported by any sample is printed as the peak memory of the benchmark.
+void
+bch_memory(Benchmark_t *bench, uint64_t bytes);
+
+/// \ref bch_counter
+/// \brief Adds to a named counter of the current benchmark, such as the
+/// compare-and-swap retries of a sample. Counters are printed and recorded
+/// as an average per operation. The name must outlive the benchmark and a
+/// benchmark can have at most four counters.
+void
+bch_counter(Benchmark_t *bench, const char *name, double value);
+
+/// \ref bch_fail
+/// \brief Marks the current benchmark as failed, for example when a result
+/// is wrong.
+void
+bch_fail(Benchmark_t *bench, const char *reason);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref bch_max_size
+/// \brief Returns the largest input size benchmarks should use, so that the
+/// biggest ones only run when asked for.
+unsigned_t
+bch_max_size(Benchmark_t *bench);
+
+/// \ref bch_heap_size
+/// \brief Returns the bytes currently allocated with malloc() by the whole
+/// program, or 0 if the C library can't tell.
+uint64_t
+bch_heap_size(void);
+
+/// \ref bch_threads
+/// \brief Returns the most threads multithreaded benchmarks should use.
+unsigned_t
+bch_threads(Benchmark_t *bench);
+
+/// \ref bch_workload
+/// \brief Returns the path of the workload benchmarks should replay, or NULL
+/// if none was given.
+const char *
+bch_workload(Benchmark_t *bench);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BENCHMARK_H
@@ -0,0 +1,691 @@
+/**
+ * @file ComparisonBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include <inttypes.h>
+#include "AVLTree.h"
+#include "BinarySearchTree.h"
+#include "BPlusTree.h"
+#include "Benchmarks.h"
+#include "DequeArray.h"
+#include "DequeList.h"
+#include "QueueArray.h"
+#include "QueueList.h"
+#include "RedBlackTree.h"
+#include "SkipList.h"
+#include "SortedList.h"
+#include "StackArray.h"
+#include "StackList.h"
+#include "Utility.h"
+
+// Runs the same workloads over containers that can replace each other. Every
+// container stores pointers to keys owned by the benchmark, so only the
+// container itself is allocated and measured.
+
+/// Sorted containers, seen as sets of keys.
+struct cmp_set
+{
+    const char *name;
+    /// Largest size the container is run at, 0 for no limit. Containers with
+    /// O(n) operations would take hours at the biggest sizes.
+    unsigned_t limit;
+    /// The same, for the sequential and adversarial distributions only.
+    unsigned_t ordered_limit;
+    void *(*new)(Interface_t *interface);
+    bool (*insert)(void *set, void *element);
+    bool (*contains)(void *set, void *element);
+    bool (*remove)(void *set, void *element);
+    void (*free)(void *set);
+};
+
+/// First in, first out or last in, first out containers.
+struct cmp_queue
+{
+    const char *name;
+    void *(*new)(Interface_t *interface);
+    bool (*push)(void *queue, void *element);
+    bool (*pop)(void *queue, void **result);
+    void (*free)(void *queue);
+};
+
+enum cmp_distribution
+{
+    /// Keys spread over the whole 64-bit range.
+    CMP_UNIFORM,
+    /// Keys 0, 1, 2, ... in ascending order.
+    CMP_SEQUENTIAL,
+    /// A few keys are much more frequent than the others (s = 0.99), so
+    /// inserts mostly find duplicates and searches hit the same paths.
+    CMP_ZIPFIAN,
+    /// The smallest and the biggest keys left, alternately. Unbalanced trees
+    /// degenerate into a zigzag path and lists are walked to the middle.
+    CMP_ADVERSARIAL
+};
+
+static const char *cmp_distributions[4] = {
+    "uniform", "sequential", "zipfian", "adversarial"
+};
+
+/// The keys of one size and distribution, generated on first use.
+struct cmp_keys
+{
+    unsigned_t size;
+    enum cmp_distribution distribution;
+    /// Keys in insertion order.
+    int64_t *keys;
+    /// Keys searched for, in search order.
+    int64_t *probes;
+};
+
+struct cmp_bench
+{
+    struct cmp_keys *keys;
+    const struct cmp_set *set;
+    const struct cmp_queue *queue;
+    Interface_t *interface;
+};
+
+#define CMP_SET(P, T)                                                          \
+    static void *cmp_##P##_new(Interface_t *interface)                         \
+    {                                                                          \
+        return P##_new(interface);                                             \
+    }                                                                          \
+    static bool cmp_##P##_insert(void *set, void *element)                     \
+    {                                                                          \
+        return P##_insert((T *)set, element);                                  \
+    }                                                                          \
+    static bool cmp_##P##_contains(void *set, void *element)                   \
+    {                                                                          \
+        return P##_contains((T *)set, element);                                \
+    }                                                                          \
+    static bool cmp_##P##_remove(void *set, void *element)                     \
+    {                                                                          \
+        return P##_remove((T *)set, element);                                  \
+    }                                                                          \
+    static void cmp_##P##_free(void *set)                                      \
+    {                                                                          \
+        P##_free_shallow((T *)set);                                            \
+    }
+
+#define CMP_QUEUE(P, T, PUSH, POP)                                             \
+    static void *cmp_##P##_new(Interface_t *interface)                         \
+    {                                                                          \
+        return P##_new(interface);                                             \
+    }                                                                          \
+    static bool cmp_##P##_push(void *queue, void *element)                     \
+    {                                                                          \
+        return PUSH((T *)queue, element);                                      \
+    }                                                                          \
+    static bool cmp_##P##_pop(void *queue, void **result)                      \
+    {                                                                          \
+        return POP((T *)queue, result);                                        \
+    }                                                                          \
+    static void cmp_##P##_free(void *queue)                                    \
+    {                                                                          \
+        P##_free_shallow((T *)queue);                                          \
+    }
+
+CMP_SET(avl, AVLTree_t)
+CMP_SET(bpt, BPlusTree_t)
+CMP_SET(bst, BinarySearchTree_t)
+CMP_SET(rbt, RedBlackTree_t)
+CMP_SET(skl, SkipList_t)
+
+CMP_QUEUE(qar, QueueArray_t, qar_enqueue, qar_dequeue)
+CMP_QUEUE(qli, QueueList_t, qli_enqueue, qli_dequeue)
+CMP_QUEUE(dqa, DequeArray_t, dqa_enqueue_rear, dqa_dequeue_front)
+CMP_QUEUE(dql, DequeList_t, dql_enqueue_rear, dql_dequeue_front)
+CMP_QUEUE(sta, StackArray_t, sta_push, sta_pop)
+CMP_QUEUE(stl, StackList_t, stl_push, stl_pop)
+
+// The SortedList predates Interface_t and takes its own comparator type
+static int
+cmp_sli_compare(void *element1, void *element2)
+{
+    return compare_int64_t(element1, element2);
+}
+
+// A SortedList keeps duplicates, so it is only inserted into when the key is
+// not there yet, like every other set
+static void *
+cmp_sli_create(Interface_t *interface, bool indexed)
+{
+    (void)interface;
+
+    SortedList list;
+
+    if (sli_create(&list, ASCENDING, cmp_sli_compare, NULL, NULL, NULL)
+        != DS_OK)
+        return NULL;
+
+    if (indexed)
+        sli_set_indexed(list, true);
+
+    return list;
+}
+
+static void *
+cmp_sli_new(Interface_t *interface)
+{
+    return cmp_sli_create(interface, false);
+}
+
+static void *
+cmp_sli_new_indexed(Interface_t *interface)
+{
+    return cmp_sli_create(interface, true);
+}
+
+static bool
+cmp_sli_insert(void *set, void *element)
+{
+    if (sli_contains(set, element))
+        return false;
+
+    return sli_insert(set, element) == DS_OK;
+}
+
+static bool
+cmp_sli_contains(void *set, void *element)
+{
+    return sli_contains(set, element);
+}
+
+static bool
+cmp_sli_remove(void *set, void *element)
+{
+    integer_t index = sli_index_first(set, element);
+
+    void *result;
+
+    return index >= 0 && sli_remove(set, &result, index) == DS_OK;
+}
+
+static void
+cmp_sli_free(void *set)
+{
+    SortedList list = set;
+
+    sli_free_shallow(&list);
+}
+
+static const struct cmp_set cmp_sets[] = {
+    { "AVLTree", 0, 0, cmp_avl_new, cmp_avl_insert, cmp_avl_contains,
+      cmp_avl_remove, cmp_avl_free },
+    { "BPlusTree", 0, 0, cmp_bpt_new, cmp_bpt_insert, cmp_bpt_contains,
+      cmp_bpt_remove, cmp_bpt_free },
+    { "BinarySearchTree", 0, 10000, cmp_bst_new, cmp_bst_insert,
+      cmp_bst_contains, cmp_bst_remove, cmp_bst_free },
+    { "RedBlackTree", 0, 0, cmp_rbt_new, cmp_rbt_insert, cmp_rbt_contains,
+      cmp_rbt_remove, cmp_rbt_free },
+    { "SkipList", 0, 0, cmp_skl_new, cmp_skl_insert, cmp_skl_contains,
+      cmp_skl_remove, cmp_skl_free },
+    { "SortedList", 10000, 10000, cmp_sli_new, cmp_sli_insert, cmp_sli_contains,
+      cmp_sli_remove, cmp_sli_free },
+    { "SortedList+index", 0, 0, cmp_sli_new_indexed, cmp_sli_insert,
+      cmp_sli_contains, cmp_sli_remove, cmp_sli_free }
+};
+
+static const struct cmp_queue cmp_queues[] = {
+    { "QueueArray", cmp_qar_new, cmp_qar_push, cmp_qar_pop, cmp_qar_free },
+    { "QueueList", cmp_qli_new, cmp_qli_push, cmp_qli_pop, cmp_qli_free },
+    { "DequeArray", cmp_dqa_new, cmp_dqa_push, cmp_dqa_pop, cmp_dqa_free },
+    { "DequeList", cmp_dql_new, cmp_dql_push, cmp_dql_pop, cmp_dql_free }
+};
+
+static const struct cmp_queue cmp_stacks[] = {
+    { "StackArray", cmp_sta_new, cmp_sta_push, cmp_sta_pop, cmp_sta_free },
+    { "StackList", cmp_stl_new, cmp_stl_push, cmp_stl_pop, cmp_stl_free }
+};
+
+#define CMP_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+///////////////////////////////////////////////////////////// KEY GENERATION ///
+
+// splitmix64, much faster than rand() for hundreds of millions of keys
+static uint64_t
+cmp_random(uint64_t *state)
+{
+    uint64_t z = (*state += UINT64_C(0x9e3779b97f4a7c15));
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+// Zipfian ranks in [0, n) as generated by Gray et al., "Quickly Generating
+// Billion-Record Synthetic Databases"
+struct cmp_zipf
+{
+    double n, theta, alpha, zetan, eta;
+};
+
+static void
+cmp_zipf_init(struct cmp_zipf *zipf, unsigned_t n, double theta)
+{
+    double zeta2 = 1.0 + pow(0.5, theta);
+
+    zipf->zetan = 0.0;
+
+    for (unsigned_t i = 1; i <= n; i++)
+        zipf->zetan += 1.0 / pow((double)i, theta);
+
+    zipf->n = (double)n;
+    zipf->theta = theta;
+    zipf->alpha = 1.0 / (1.0 - theta);
+    zipf->eta = (1.0 - pow(2.0 / (double)n, 1.0 - theta))
+                / (1.0 - zeta2 / zipf->zetan);
+}
+
+static uint64_t
+cmp_zipf_next(struct cmp_zipf *zipf, uint64_t *state)
+{
+    double u = (double)(cmp_random(state) >> 11) / 9007199254740992.0;
+    double uz = u * zipf->zetan;
+
+    if (uz < 1.0)
+        return 0;
+
+    if (uz < 1.0 + pow(0.5, zipf->theta))
+        return 1;
+
+    uint64_t rank = (uint64_t)(zipf->n * pow(zipf->eta * u - zipf->eta + 1.0,
+                                             zipf->alpha));
+
+    return rank < (uint64_t)zipf->n ? rank : (uint64_t)zipf->n - 1;
+}
+
+// Fills an array with keys of a distribution. Zipfian ranks are scrambled by
+// a bijection so the popular keys are not next to each other.
+static void
+cmp_fill(int64_t *keys, unsigned_t size, enum cmp_distribution distribution,
+         uint64_t seed, struct cmp_zipf *zipf)
+{
+    uint64_t state = seed;
+
+    for (unsigned_t i = 0; i < size; i++)
+    {
+        uint64_t key;
+
+        switch (distribution)
+        {
+            case CMP_UNIFORM:
+                key = cmp_random(&state);
+                break;
+            case CMP_SEQUENTIAL:
+                key = i;
+                break;
+            case CMP_ZIPFIAN:
+            {
+                uint64_t rank = cmp_zipf_next(zipf, &state);
+
+                key = cmp_random(&rank);
+                break;
+            }
+            default:
+                key = i % 2 == 0 ? i / 2 : size - 1 - i / 2;
+                break;
+        }
+
+        // Random keys are kept positive
+        if (distribution == CMP_UNIFORM || distribution == CMP_ZIPFIAN)
+            key >>= 1;
+
+        keys[i] = (int64_t)key;
+    }
+}
+
+static bool
+cmp_keys_generate(struct cmp_keys *k)
+{
+    if (k->keys)
+        return true;
+
+    k->keys = malloc(sizeof(int64_t) * k->size);
+    k->probes = malloc(sizeof(int64_t) * k->size);
+
+    if (!k->keys || !k->probes)
+    {
+        free(k->keys);
+        free(k->probes);
+        k->keys = k->probes = NULL;
+        return false;
+    }
+
+    struct cmp_zipf zipf;
+
+    if (k->distribution == CMP_ZIPFIAN)
+        cmp_zipf_init(&zipf, k->size, 0.99);
+
+    cmp_fill(k->keys, k->size, k->distribution, 5113, &zipf);
+
+    if (k->distribution == CMP_UNIFORM)
+    {
+        // Random keys that are in the set
+        uint64_t state = 3511;
+
+        for (unsigned_t i = 0; i < k->size; i++)
+            k->probes[i] = k->keys[cmp_random(&state) % k->size];
+    }
+    else
+    {
+        cmp_fill(k->probes, k->size, k->distribution, 3511, &zipf);
+    }
+
+    return true;
+}
+
+static void
+cmp_keys_free(struct cmp_keys *k)
+{
+    free(k->keys);
+    free(k->probes);
+
+    k->keys = k->probes = NULL;
+}
+
+/////////////////////////////////////////////////////////////// SET WORKLOADS ///
+
+static void *
+cmp_set_fill(Benchmark_t *bench, struct cmp_bench *b, bool timed)
+{
+    if (!cmp_keys_generate(b->keys))
+    {
+        bch_fail(bench, "not enough memory for the keys");
+        return NULL;
+    }
+
+    uint64_t heap = bch_heap_size();
+
+    void *set = b->set->new(b->interface);
+
+    if (!set)
+    {
+        bch_fail(bench, "could not create the container");
+        return NULL;
+    }
+
+    int64_t *keys = b->keys->keys;
+
+    if (timed)
+        bch_start(bench);
+
+    for (unsigned_t i = 0; i < b->keys->size; i++)
+        b->set->insert(set, &keys[i]);
+
+    if (timed)
+        bch_stop(bench);
+
+    uint64_t used = bch_heap_size();
+
+    bch_memory(bench, used > heap ? used - heap : 0);
+
+    return set;
+}
+
+static void
+cmp_set_insert(Benchmark_t *bench, void *argument)
+{
+    struct cmp_bench *b = argument;
+
+    void *set = cmp_set_fill(bench, b, true);
+
+    if (set)
+        b->set->free(set);
+}
+
+static void
+cmp_set_search(Benchmark_t *bench, void *argument)
+{
+    struct cmp_bench *b = argument;
+
+    void *set = cmp_set_fill(bench, b, false);
+
+    if (!set)
+        return;
+
+    int64_t *probes = b->keys->probes;
+
+    unsigned_t found = 0;
+
+    bch_start(bench);
+
+    for (unsigned_t i = 0; i < b->keys->size; i++)
+        found += b->set->contains(set, &probes[i]);
+
+    bch_stop(bench);
+
+    // Every probe of these distributions is one of the keys
+    if (b->keys->distribution != CMP_ZIPFIAN && found != b->keys->size)
+        bch_fail(bench, "a key was not found");
+
+    b->set->free(set);
+}
+
+static void
+cmp_set_remove(Benchmark_t *bench, void *argument)
+{
+    struct cmp_bench *b = argument;
+
+    void *set = cmp_set_fill(bench, b, false);
+
+    if (!set)
+        return;
+
+    int64_t *keys = b->keys->keys;
+
+    bch_start(bench);
+
+    for (unsigned_t i = 0; i < b->keys->size; i++)
+        b->set->remove(set, &keys[i]);
+
+    bch_stop(bench);
+
+    b->set->free(set);
+}
+
+///////////////////////////////////////////////////////////// QUEUE WORKLOADS ///
+
+static bool
+cmp_queue_keys(Benchmark_t *bench, struct cmp_bench *b)
+{
+    if (cmp_keys_generate(b->keys))
+        return true;
+
+    bch_fail(bench, "not enough memory for the keys");
+
+    return false;
+}
+
+// Pushes every key and then pops them all
+static void
+cmp_queue_fill(Benchmark_t *bench, void *argument)
+{
+    struct cmp_bench *b = argument;
+
+    if (!cmp_queue_keys(bench, b))
+        return;
+
+    uint64_t heap = bch_heap_size();
+
+    void *queue = b->queue->new(b->interface);
+
+    if (!queue)
+    {
+        bch_fail(bench, "could not create the container");
+        return;
+    }
+
+    int64_t *keys = b->keys->keys;
+    unsigned_t size = b->keys->size;
+    unsigned_t popped = 0;
+
+    void *result;
+
+    bch_start(bench);
+
+    for (unsigned_t i = 0; i < size; i++)
+        b->queue->push(queue, &keys[i]);
+
+    bch_stop(bench);
+
+    uint64_t used = bch_heap_size();
+
+    bch_memory(bench, used > heap ? used - heap : 0);
+
+    bch_start(bench);
+
+    while (b->queue->pop(queue, &result))
+        popped++;
+
+    bch_stop(bench);
+
+    if (popped != size)
+        bch_fail(bench, "lost elements");
+
+    b->queue->free(queue);
+}
+
+// With the container holding every key, pops one and pushes it back
+static void
+cmp_queue_steady(Benchmark_t *bench, void *argument)
+{
+    struct cmp_bench *b = argument;
+
+    if (!cmp_queue_keys(bench, b))
+        return;
+
+    void *queue = b->queue->new(b->interface);
+
+    if (!queue)
+    {
+        bch_fail(bench, "could not create the container");
+        return;
+    }
+
+    int64_t *keys = b->keys->keys;
+    unsigned_t size = b->keys->size;
+
+    for (unsigned_t i = 0; i < size; i++)
+        b->queue->push(queue, &keys[i]);
+
+    void *result = NULL;
+
+    bool success = true;
+
+    bch_start(bench);
+
+    for (unsigned_t i = 0; i < size; i++)
+        success = b->queue->pop(queue, &result)
+                  && b->queue->push(queue, result) && success;
+
+    bch_stop(bench);
+
+    if (!success)
+        bch_fail(bench, "push or pop failed");
+
+    b->queue->free(queue);
+}
+
+/////////////////////////////////////////////////////////////////// RUNNERS ///
+
+static void
+cmp_run_sets(Benchmark_t *bench, Interface_t *interface, unsigned_t size)
+{
+    const char *operations[3] = { "insert", "search", "remove" };
+    bench_f functions[3] = { cmp_set_insert, cmp_set_search, cmp_set_remove };
+
+    char name[96];
+
+    for (int d = 0; d < 4; d++)
+    {
+        struct cmp_keys keys = { size, (enum cmp_distribution)d, NULL, NULL };
+
+        for (int o = 0; o < 3; o++)
+        {
+            for (size_t s = 0; s < CMP_COUNT(cmp_sets); s++)
+            {
+                const struct cmp_set *set = &cmp_sets[s];
+
+                bool ordered = d == CMP_SEQUENTIAL || d == CMP_ADVERSARIAL;
+
+                if ((set->limit > 0 && size > set->limit) ||
+                    (ordered && set->ordered_limit > 0 &&
+                     size > set->ordered_limit))
+                    continue;
+
+                struct cmp_bench b = { &keys, set, NULL, interface };
+
+                snprintf(name, sizeof(name), "Compare/set/%s/%s/%" PRIuMAX
+                         "/%s", cmp_distributions[d], operations[o], size,
+                         set->name);
+
+                bch_run(bench, name, functions[o], &b, size);
+            }
+        }
+
+        cmp_keys_free(&keys);
+    }
+}
+
+static void
+cmp_run_queues(Benchmark_t *bench, Interface_t *interface, unsigned_t size,
+               const char *kind, const struct cmp_queue *queues, size_t count)
+{
+    const char *operations[2] = { "fill", "steady" };
+    bench_f functions[2] = { cmp_queue_fill, cmp_queue_steady };
+
+    struct cmp_keys keys = { size, CMP_SEQUENTIAL, NULL, NULL };
+
+    char name[96];
+
+    for (int o = 0; o < 2; o++)
+    {
+        for (size_t q = 0; q < count; q++)
+        {
+            struct cmp_bench b = { &keys, NULL, &queues[q], interface };
+
+            snprintf(name, sizeof(name), "Compare/%s/%s/%" PRIuMAX "/%s", kind,
+                     operations[o], size, queues[q].name);
+
+            // A fill pushes and pops every element
+            bch_run(bench, name, functions[o], &b, size * 2);
+        }
+    }
+
+    cmp_keys_free(&keys);
+}
+
+// The keys belong to the benchmark, not to the containers that remove them
+static void
+cmp_keep(void *element)
+{
+    (void)element;
+}
+
+// Runs all comparison benchmarks
+void ComparisonBench(Benchmark_t *bench)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, cmp_keep, NULL,
+                                           NULL);
+
+    if (!interface)
+        return;
+
+    for (unsigned_t size = 1000; size <= bch_max_size(bench); size *= 10)
+    {
+        cmp_run_sets(bench, interface, size);
+        cmp_run_queues(bench, interface, size, "queue", cmp_queues,
+                       CMP_COUNT(cmp_queues));
+        cmp_run_queues(bench, interface, size, "stack", cmp_stacks,
+                       CMP_COUNT(cmp_stacks));
+    }
+
+    interface_free(interface);
+}
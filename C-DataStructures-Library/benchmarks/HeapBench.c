@@ -7,168 +7,180 @@
  */
 
 #include <inttypes.h>
+#include "Benchmarks.h"
 #include "Heap.h"
-#include "Clock.h"
 #include "Utility.h"
 
-void
-hep_bench_IO(unsigned_t elements, unsigned_t iterations)
+struct hep_bench
+{
+    unsigned_t elements;
+    integer_t arity;
+    Interface_t *interface;
+};
+
+// Inserts the same random keys in every sample
+static Heap_t *
+hep_bench_fill(Benchmark_t *bench, struct hep_bench *b, bool timed)
 {
     srand(5113);
 
-    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
-                                           display_int64_t, free, NULL, NULL);
+    Heap_t *heap = hep_new(b->interface, MaxHeap);
 
-    if (!interface)
-        return;
+    if (!heap || !hep_set_arity(heap, b->arity))
+    {
+        if (heap)
+            hep_free(heap);
+
+        bch_fail(bench, "hep_new");
+        return NULL;
+    }
 
-    Clock_t *stopwatch = clk_new(iterations);
+    int64_t max = (int64_t)b->elements;
 
-    if (!stopwatch)
+    if (timed)
+        bch_start(bench);
+
+    for (unsigned_t j = 0; j < b->elements; j++)
     {
-        interface_free(interface);
-        return;
+        void *element = new_int64_t(random_int64_t(-max, max));
+
+        if (!hep_insert(heap, element))
+            free(element);
     }
 
-    Heap_t *heap = hep_new(interface, MaxHeap);
+    if (timed)
+        bch_stop(bench);
+
+    return heap;
+}
+
+static void
+hep_bench_insert(Benchmark_t *bench, void *argument)
+{
+    Heap_t *heap = hep_bench_fill(bench, argument, true);
+
+    if (heap)
+        hep_free(heap);
+}
+
+// Decreases the key at the top and sifts it down
+static void
+hep_bench_decrease(Benchmark_t *bench, void *argument)
+{
+    struct hep_bench *b = argument;
+
+    Heap_t *heap = hep_bench_fill(bench, b, false);
 
     if (!heap)
-    {
-        interface_free(interface);
-        clk_free(stopwatch);
         return;
-    }
 
-    double *insertion_timings = malloc(sizeof(double) * iterations);
-    double *removal_timings = malloc(sizeof(double) * iterations);
-    double *search_timings = malloc(sizeof(double) * iterations);
+    bool success = true;
 
-    unsigned_t insertion_total = 0, removal_total = 0, search_total = 0;
+    bch_start(bench);
 
-    if (!insertion_timings || !removal_timings || !search_timings)
+    for (unsigned_t j = 0; j < b->elements; j++)
     {
-        hep_free(heap);
-        clk_free(stopwatch);
-        interface_free(interface);
-        return;
+        *(int64_t *)hep_peek(heap) -= random_int64_t(20, 200);
+
+        success = hep_heapify(heap) && success;
     }
 
-    int64_t min = elements * (-1);
-    int64_t max = elements;
-    void *element = NULL;
-    bool success;
-    int64_t **buffer = malloc(sizeof(int64_t*) * elements);
-    for (unsigned_t i = 0; i < iterations; i++)
-    {
-        // Insertion
-        clk_start(stopwatch);
-        for (unsigned_t j = 0; j < elements; j++)
-        {
-            element = new_int64_t(random_int64_t(min, max));
-            if (!hep_insert(heap, element))
-            {
-                free(element);
-                printf("ERROR!0\n");
-            }
-        }
-        clk_stop(stopwatch);
-        insertion_timings[insertion_total++] = stopwatch->time;
+    bch_stop(bench);
 
-        clk_reset(stopwatch);
+    if (!success)
+        bch_fail(bench, "hep_heapify");
 
-        // Decrease keys
-        clk_start(stopwatch);
-        for (unsigned_t j = 0; j < elements; j++)
-        {
-            element = hep_peek(heap);
-            *(int64_t *)element -= random_int64_t(20, 200);
-            if (!hep_heapify(heap))
-                printf("ERROR!1\n");
-        }
-        clk_stop(stopwatch);
-        search_timings[search_total++] = stopwatch->time;
+    hep_free(heap);
+}
 
-        clk_reset(stopwatch);
+// Removes every element, which must come out in order
+static void
+hep_bench_remove(Benchmark_t *bench, void *argument)
+{
+    struct hep_bench *b = argument;
 
-        // Removal
-        int64_t t = 0;
-        clk_start(stopwatch);
-        while (!hep_empty(heap))
-        {
-            success = hep_remove(heap, &element);
-            if (!success)
-                printf("ERROR!2\n");
-            buffer[t++] = (int64_t*)element;
-        }
-        clk_stop(stopwatch);
-        removal_timings[removal_total++] = stopwatch->time;
+    Heap_t *heap = hep_bench_fill(bench, b, false);
 
-        if (hep_count(heap) != 0)
-            printf("ERROR!3\n");
+    int64_t **buffer = malloc(sizeof(int64_t *) * b->elements);
 
-        bool is_sorted = true;
+    if (!heap || !buffer)
+    {
+        if (heap)
+            hep_free(heap);
 
-        for (unsigned_t j = 0; j < elements - 1; j++)
-        {
-            if (*buffer[j] < *buffer[j + 1])
-            {
-                is_sorted = false;
-                break;
-            }
-        }
+        free(buffer);
+        bch_fail(bench, "malloc");
+        return;
+    }
 
-        if (!is_sorted)
-            printf("ERROR!4\n");
+    unsigned_t t = 0;
 
-        for (unsigned_t j = 0; j < elements; j++)
-        {
-            free(buffer[i]);
-            buffer[i] = NULL;
-        }
+    void *element;
 
-        clk_reset(stopwatch);
-        hep_erase(heap);
-    }
+    bch_start(bench);
 
-    free(buffer);
+    while (!hep_empty(heap) && hep_remove(heap, &element))
+        buffer[t++] = element;
+
+    bch_stop(bench);
 
-    // The result will be sum / iterations
-    double insertion_sum = 0.0, search_sum = 0.0, removal_sum = 0.0;
+    if (t != b->elements)
+        bch_fail(bench, "hep_remove");
 
-    for (unsigned_t i = 0; i < iterations; i++)
+    for (unsigned_t j = 0; j + 1 < t; j++)
     {
-        insertion_sum += insertion_timings[i];
-        search_sum += search_timings[i];
-        removal_sum += removal_timings[i];
+        if (*buffer[j] < *buffer[j + 1])
+        {
+            bch_fail(bench, "hep_remove order");
+            break;
+        }
     }
 
+    for (unsigned_t j = 0; j < t; j++)
+        free(buffer[j]);
+
+    free(buffer);
     hep_free(heap);
-    clk_free(stopwatch);
-    interface_free(interface);
-    free(insertion_timings);
-    free(search_timings);
-    free(removal_timings);
-
-    printf("+--------------------------------------------------+\n");
-    printf("  Total elements added   : %" PRIuMAX "\n", elements);
-    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
-    printf("+--------------------------------------------------+\n");
-    printf("  Average insertion time : %lf seconds\n", insertion_sum / (double)iterations);
-    printf("  Average removal time   : %lf seconds\n", removal_sum / (double)iterations);
-    printf("  Average decr-key time  : %lf seconds\n", search_sum / (double)iterations);
-    printf("+--------------------------------------------------+\n");
 }
 
 // Runs all Heap benchmarks
-void HeapBench(void)
+void HeapBench(Benchmark_t *bench)
 {
-    printf("+------------------------------------------------------------+\n");
-    printf("|                       Heap Benchmark                       |\n");
-    printf("+------------------------------------------------------------+\n");
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
 
-    hep_bench_IO(100000, 100);
-    hep_bench_IO(1000000, 10);
-    hep_bench_IO(10000000, 1);
+    // Compares binary, 4-ary and 8-ary heaps at sizes that fit in the cache and
+    // at sizes that don't
+    integer_t arities[3] = {2, 4, 8};
+    unsigned_t sizes[2] = {100000, 1000000};
 
-    printf("\n");
-}
\ No newline at end of file
+    char name[64];
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            struct hep_bench b = { sizes[i], arities[j], interface };
+
+            snprintf(name, sizeof(name),
+                     "Heap/insert/%" PRIuMAX "/%" DS_PRI_INTEGER,
+                     sizes[i], arities[j]);
+            bch_run(bench, name, hep_bench_insert, &b, sizes[i]);
+
+            snprintf(name, sizeof(name),
+                     "Heap/decrease/%" PRIuMAX "/%" DS_PRI_INTEGER,
+                     sizes[i], arities[j]);
+            bch_run(bench, name, hep_bench_decrease, &b, sizes[i]);
+
+            snprintf(name, sizeof(name),
+                     "Heap/remove/%" PRIuMAX "/%" DS_PRI_INTEGER,
+                     sizes[i], arities[j]);
+            bch_run(bench, name, hep_bench_remove, &b, sizes[i]);
+        }
+    }
+
+    interface_free(interface);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file ReplayBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include <inttypes.h>
+#include "AVLTree.h"
+#include "BPlusTree.h"
+#include "Benchmarks.h"
+#include "HashMap.h"
+#include "RedBlackTree.h"
+#include "SkipList.h"
+#include "Utility.h"
+#include "Workload.h"
+
+// Replays a workload recorded with wkl_record() and given with --workload
+// over every container that can hold a set of keys, so they are compared on
+// the operations and keys of a real program instead of generated ones.
+
+/// Containers that hold a set of keys.
+struct rpl_set
+{
+    const char *name;
+    void *(*new)(Interface_t *interface);
+    bool (*insert)(void *set, void *element);
+    bool (*contains)(void *set, void *element);
+    bool (*remove)(void *set, void *element);
+    void (*free)(void *set);
+};
+
+struct rpl_bench
+{
+    Workload_t *workload;
+    const struct rpl_set *set;
+    Interface_t *interface;
+    /// Operations that succeeded in the first container, which every other
+    /// container must match.
+    unsigned_t expected;
+};
+
+#define RPL_SET(P, T)                                                          \
+    static void *rpl_##P##_new(Interface_t *interface)                         \
+    {                                                                          \
+        return P##_new(interface);                                             \
+    }                                                                          \
+    static bool rpl_##P##_insert(void *set, void *element)                     \
+    {                                                                          \
+        return P##_insert((T *)set, element);                                  \
+    }                                                                          \
+    static bool rpl_##P##_contains(void *set, void *element)                   \
+    {                                                                          \
+        return P##_contains((T *)set, element);                                \
+    }                                                                          \
+    static bool rpl_##P##_remove(void *set, void *element)                     \
+    {                                                                          \
+        return P##_remove((T *)set, element);                                  \
+    }                                                                          \
+    static void rpl_##P##_free(void *set)                                      \
+    {                                                                          \
+        P##_free_shallow((T *)set);                                            \
+    }
+
+RPL_SET(avl, AVLTree_t)
+RPL_SET(bpt, BPlusTree_t)
+RPL_SET(rbt, RedBlackTree_t)
+RPL_SET(skl, SkipList_t)
+
+// A HashMap_s with every key mapped to itself
+static void *
+rpl_hmp_new(Interface_t *interface)
+{
+    return hmp_new(interface, interface);
+}
+
+static bool
+rpl_hmp_insert(void *set, void *element)
+{
+    return hmp_insert(set, element, element);
+}
+
+static bool
+rpl_hmp_contains(void *set, void *element)
+{
+    return hmp_contains_key(set, element);
+}
+
+static bool
+rpl_hmp_remove(void *set, void *element)
+{
+    void *value;
+
+    return hmp_remove(set, element, &value);
+}
+
+static void
+rpl_hmp_free(void *set)
+{
+    hmp_free_shallow(set);
+}
+
+static const struct rpl_set rpl_sets[] = {
+    { "AVLTree", rpl_avl_new, rpl_avl_insert, rpl_avl_contains,
+      rpl_avl_remove, rpl_avl_free },
+    { "BPlusTree", rpl_bpt_new, rpl_bpt_insert, rpl_bpt_contains,
+      rpl_bpt_remove, rpl_bpt_free },
+    { "HashMap", rpl_hmp_new, rpl_hmp_insert, rpl_hmp_contains,
+      rpl_hmp_remove, rpl_hmp_free },
+    { "RedBlackTree", rpl_rbt_new, rpl_rbt_insert, rpl_rbt_contains,
+      rpl_rbt_remove, rpl_rbt_free },
+    { "SkipList", rpl_skl_new, rpl_skl_insert, rpl_skl_contains,
+      rpl_skl_remove, rpl_skl_free }
+};
+
+#define RPL_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+// Replays every operation of the workload over an empty container
+static void
+rpl_replay(Benchmark_t *bench, void *argument)
+{
+    struct rpl_bench *b = argument;
+
+    const struct rpl_set *set = b->set;
+
+    uint64_t heap = bch_heap_size();
+
+    void *container = set->new(b->interface);
+
+    if (!container)
+    {
+        bch_fail(bench, "could not create the container");
+        return;
+    }
+
+    int64_t *keys = wkl_keys(b->workload);
+    integer_t size = wkl_size(b->workload);
+    unsigned_t hits = 0;
+
+    bch_start(bench);
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        switch (wkl_operation(b->workload, i))
+        {
+            case WorkloadInsert:
+                hits += set->insert(container, &keys[i]);
+                break;
+            case WorkloadSearch:
+                hits += set->contains(container, &keys[i]);
+                break;
+            default:
+                hits += set->remove(container, &keys[i]);
+                break;
+        }
+    }
+
+    bch_stop(bench);
+
+    uint64_t used = bch_heap_size();
+
+    bch_memory(bench, used > heap ? used - heap : 0);
+    bch_counter(bench, "hits", (double)hits);
+
+    if (b->expected == (unsigned_t)-1)
+        b->expected = hits;
+    else if (hits != b->expected)
+        bch_fail(bench, "the results differ from the first container");
+
+    set->free(container);
+}
+
+// The keys belong to the workload, not to the containers that remove them
+static void
+rpl_keep(void *element)
+{
+    (void)element;
+}
+
+// Runs all replay benchmarks
+void ReplayBench(Benchmark_t *bench)
+{
+    const char *path = bch_workload(bench);
+
+    if (!path)
+        return;
+
+    Workload_t *workload = wkl_load(path);
+
+    if (!workload)
+    {
+        printf("Could not read the workload %s\n", path);
+        return;
+    }
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, rpl_keep,
+                                           hash_int64_t, NULL);
+
+    if (!interface)
+    {
+        wkl_free(workload);
+        return;
+    }
+
+    printf("Workload %s: %" DS_PRI_INTEGER " inserts, %" DS_PRI_INTEGER
+           " searches, %" DS_PRI_INTEGER " removes\n\n", path,
+           wkl_count(workload, WorkloadInsert),
+           wkl_count(workload, WorkloadSearch),
+           wkl_count(workload, WorkloadRemove));
+
+    struct rpl_bench b = { workload, NULL, interface, (unsigned_t)-1 };
+
+    char name[96];
+
+    for (size_t s = 0; s < RPL_COUNT(rpl_sets); s++)
+    {
+        b.set = &rpl_sets[s];
+
+        snprintf(name, sizeof(name), "Replay/%s", rpl_sets[s].name);
+
+        bch_run(bench, name, rpl_replay, &b,
+                (unsigned_t)wkl_size(workload));
+    }
+
+    interface_free(interface);
+    wkl_free(workload);
+}
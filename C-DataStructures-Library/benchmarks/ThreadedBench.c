@@ -0,0 +1,516 @@
+/**
+ * @file ThreadedBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+// For pthread_setaffinity_np()
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "Benchmarks.h"
+#include "DequeStealing.h"
+#include "QueueArray.h"
+#include "QueueMPMC.h"
+#include "RedBlackTree.h"
+#include "SkipList.h"
+#include "Synchronized.h"
+#include "Utility.h"
+
+// Measures how the concurrent containers scale with the amount of threads
+// sharing them, next to a sequential container behind a Synchronized_s lock.
+// Every thread does the same amount of operations, so a container that
+// scales perfectly keeps the same latency and multiplies its throughput.
+// Threads are created before the clock starts and wait for each other, so
+// only the operations are measured.
+
+/// Operations of each thread in a sample.
+#define THR_OPERATIONS 50000
+
+/// Keys of the map benchmarks, about half of them present at any time.
+#define THR_KEYS 65536
+
+/// Elements already in the queues, so consumers rarely find them empty.
+#define THR_PREFILL 512
+
+struct thr_bench;
+
+/// \brief The operations of one thread in a sample.
+typedef void (*thr_work_f)(struct thr_bench *b, unsigned_t id);
+
+/// \brief Reads the contention counter of the shared container.
+typedef unsigned_t (*thr_contention_f)(struct thr_bench *b);
+
+struct thr_bench
+{
+    /// What each thread does and how many threads do it.
+    thr_work_f work;
+    unsigned_t threads;
+
+    /// Percentage of operations of the map benchmarks that only read.
+    unsigned_t reads;
+
+    /// The shared container, only one of them is used.
+    QueueMPMC_t *mpmc;
+    DequeStealing_t *deque;
+    SkipList_t *list;
+    Synchronized_t *sync;
+
+    /// Counts retries or lock waits, reported as the counter named below.
+    thr_contention_f contention;
+    const char *counter;
+
+    /// Keys of the maps and elements of the queues.
+    int64_t *keys;
+
+    /// Threads waiting for the start signal.
+    _Atomic(unsigned_t) ready;
+    atomic_bool go;
+
+    /// Set by the owner of the work stealing benchmark once its deque is
+    /// empty for good, and the amount of tasks every thread ran.
+    atomic_bool done;
+    _Atomic(unsigned_t) completed;
+
+    /// Operations that returned something impossible.
+    _Atomic(unsigned_t) errors;
+};
+
+struct thr_worker
+{
+    struct thr_bench *b;
+    unsigned_t id;
+    pthread_t thread;
+};
+
+// Keeps tasks of the work stealing benchmark from being optimized away
+static _Atomic(uint64_t) thr_sink;
+
+// splitmix64, each thread has its own state
+static uint64_t
+thr_random(uint64_t *state)
+{
+    uint64_t z = (*state += UINT64_C(0x9e3779b97f4a7c15));
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+// Keys are owned by the benchmark
+static void
+thr_keep(void *element)
+{
+    (void)element;
+}
+
+// Spreads the threads over the processors. Without it the scheduler might
+// move them around and the results would depend on where they ended up.
+static void
+thr_pin(unsigned_t id)
+{
+#ifdef __linux__
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cores < 1)
+        return;
+
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET((int)(id % (unsigned_t)cores), &set);
+
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)id;
+#endif
+}
+
+static void *
+thr_worker(void *argument)
+{
+    struct thr_worker *worker = argument;
+    struct thr_bench *b = worker->b;
+
+    thr_pin(worker->id);
+
+    atomic_fetch_add(&b->ready, 1);
+
+    while (!atomic_load_explicit(&b->go, memory_order_acquire))
+        sched_yield();
+
+    b->work(b, worker->id);
+
+    return NULL;
+}
+
+// Runs one sample with every thread doing its share of the work
+static void
+thr_sample(Benchmark_t *bench, void *argument)
+{
+    struct thr_bench *b = argument;
+
+    struct thr_worker *workers = malloc(sizeof(struct thr_worker)
+                                        * b->threads);
+
+    if (!workers)
+    {
+        bch_fail(bench, "malloc");
+        return;
+    }
+
+    atomic_store(&b->ready, 0);
+    atomic_store(&b->go, false);
+    atomic_store(&b->done, false);
+    atomic_store(&b->completed, 0);
+
+    unsigned_t created = 0;
+
+    for (; created < b->threads; created++)
+    {
+        workers[created].b = b;
+        workers[created].id = created;
+
+        if (pthread_create(&workers[created].thread, NULL, thr_worker,
+                           &workers[created]) != 0)
+            break;
+    }
+
+    if (created < b->threads)
+        bch_fail(bench, "pthread_create");
+
+    while (atomic_load(&b->ready) < created)
+        sched_yield();
+
+    unsigned_t before = b->contention ? b->contention(b) : 0;
+
+    bch_start(bench);
+
+    atomic_store_explicit(&b->go, true, memory_order_release);
+
+    for (unsigned_t i = 0; i < created; i++)
+        pthread_join(workers[i].thread, NULL);
+
+    bch_stop(bench);
+
+    if (b->contention)
+        bch_counter(bench, b->counter, (double)(b->contention(b) - before));
+
+    if (atomic_load(&b->errors) > 0)
+        bch_fail(bench, "an operation failed");
+
+    // Every task must have been run exactly once
+    if (b->deque && atomic_load(&b->completed) != created * THR_OPERATIONS)
+        bch_fail(bench, "dqs_dequeue_front");
+
+    if (b->list)
+        skl_reclaim(b->list);
+
+    free(workers);
+}
+
+/////////////////////////////////////////////////////////////////// QUEUES ///
+
+static unsigned_t
+thr_mpmc_retries(struct thr_bench *b)
+{
+    return qmp_retries(b->mpmc);
+}
+
+static unsigned_t
+thr_sync_waits(struct thr_bench *b)
+{
+    return syn_stats(b->sync).waits;
+}
+
+// Every thread enqueues and then dequeues an element, retrying while the
+// queue only looks empty because a producer has not finished writing
+static void
+thr_mpmc_work(struct thr_bench *b, unsigned_t id)
+{
+    void *element = &b->keys[id % THR_KEYS], *result;
+
+    for (unsigned_t i = 0; i < THR_OPERATIONS; i++)
+    {
+        while (!qmp_try_enqueue(b->mpmc, element))
+            sched_yield();
+
+        while (!qmp_try_dequeue(b->mpmc, &result))
+            sched_yield();
+    }
+}
+
+static void
+thr_sync_queue_work(struct thr_bench *b, unsigned_t id)
+{
+    void *element = &b->keys[id % THR_KEYS], *result;
+
+    bool dequeued;
+
+    for (unsigned_t i = 0; i < THR_OPERATIONS; i++)
+    {
+        SYN_WRITE(b->sync, qar_enqueue(syn_target(b->sync), element));
+        SYN_WRITE(b->sync, dequeued = qar_dequeue(syn_target(b->sync),
+                                                  &result));
+
+        if (!dequeued)
+            atomic_fetch_add(&b->errors, 1);
+    }
+}
+
+///////////////////////////////////////////////////////////// WORK STEALING ///
+
+static unsigned_t
+thr_deque_retries(struct thr_bench *b)
+{
+    return dqs_retries(b->deque);
+}
+
+// A tiny amount of work so stealing is worth something
+static uint64_t
+thr_task(void *task)
+{
+    uint64_t state = (uint64_t)(uintptr_t)task;
+
+    return thr_random(&state);
+}
+
+// The owner pushes tasks in bursts and runs them from the rear while the
+// other threads steal from the front. Once the owner finds its deque empty
+// after the last burst no task is left.
+static void
+thr_deque_work(struct thr_bench *b, unsigned_t id)
+{
+    void *task;
+
+    uint64_t sum = 0;
+
+    unsigned_t ran = 0;
+
+    if (id != 0)
+    {
+        while (!atomic_load_explicit(&b->done, memory_order_acquire))
+        {
+            if (dqs_dequeue_front(b->deque, &task))
+            {
+                sum += thr_task(task);
+                ran++;
+            }
+            else
+                sched_yield();
+        }
+    }
+    else
+    {
+        unsigned_t total = b->threads * THR_OPERATIONS;
+
+        for (unsigned_t pushed = 0; pushed < total; )
+        {
+            for (unsigned_t j = 0; j < 64 && pushed < total; j++, pushed++)
+            {
+                if (!dqs_enqueue_rear(b->deque,
+                                      (void*)(uintptr_t)(pushed + 1)))
+                    atomic_fetch_add(&b->errors, 1);
+            }
+
+            // Keeps a few tasks for the thieves
+            while (dqs_count(b->deque) > 8 &&
+                   dqs_dequeue_rear(b->deque, &task))
+            {
+                sum += thr_task(task);
+                ran++;
+            }
+        }
+
+        while (dqs_dequeue_rear(b->deque, &task))
+        {
+            sum += thr_task(task);
+            ran++;
+        }
+
+        atomic_store_explicit(&b->done, true, memory_order_release);
+    }
+
+    atomic_fetch_add(&thr_sink, sum);
+    atomic_fetch_add(&b->completed, ran);
+}
+
+///////////////////////////////////////////////////////////////////// MAPS ///
+
+// Reads check if a key is present, writes insert it if it is not and remove
+// it otherwise, so the size stays around half of the keys
+static void
+thr_list_work(struct thr_bench *b, unsigned_t id)
+{
+    uint64_t state = id + 1;
+
+    for (unsigned_t i = 0; i < THR_OPERATIONS; i++)
+    {
+        uint64_t r = thr_random(&state);
+
+        void *key = &b->keys[(r >> 8) % THR_KEYS];
+
+        if (r % 100 < b->reads)
+            skl_contains(b->list, key);
+        else if (!skl_insert(b->list, key))
+            skl_remove(b->list, key);
+    }
+}
+
+static void
+thr_sync_tree_work(struct thr_bench *b, unsigned_t id)
+{
+    uint64_t state = id + 1;
+
+    for (unsigned_t i = 0; i < THR_OPERATIONS; i++)
+    {
+        uint64_t r = thr_random(&state);
+
+        void *key = &b->keys[(r >> 8) % THR_KEYS];
+
+        if (r % 100 < b->reads)
+            SYN_READ(b->sync, rbt_contains(syn_target(b->sync), key));
+        else
+            SYN_WRITE(b->sync, {
+                if (!rbt_insert(syn_target(b->sync), key))
+                    rbt_remove(syn_target(b->sync), key);
+            });
+    }
+}
+
+////////////////////////////////////////////////////////////////// RUNNING ///
+
+// Runs a scenario with 1, 2, 4, ... threads and the maximum
+static void
+thr_scale(Benchmark_t *bench, struct thr_bench *b, const char *prefix)
+{
+    unsigned_t max = bch_threads(bench);
+
+    char name[96];
+
+    for (unsigned_t threads = 1; ; threads *= 2)
+    {
+        // The maximum might not be a power of two
+        if (threads > max)
+            threads = max;
+
+        b->threads = threads;
+
+        snprintf(name, sizeof(name), "%s/%" PRIuMAX, prefix, threads);
+        bch_run(bench, name, thr_sample, b, threads * THR_OPERATIONS);
+
+        if (threads == max)
+            break;
+    }
+}
+
+// Runs all multithreaded benchmarks
+void ThreadedBench(Benchmark_t *bench)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, thr_keep, NULL,
+                                           NULL);
+
+    int64_t *keys = malloc(sizeof(int64_t) * THR_KEYS);
+
+    QueueMPMC_t *mpmc = qmp_new(THR_PREFILL * 2);
+    DequeStealing_t *deque = dqs_new(1024);
+    SkipList_t *list = interface ? skl_new(interface) : NULL;
+    QueueArray_t *queue = interface ? qar_new(interface) : NULL;
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    Synchronized_t *sync_queue = queue ? syn_new(queue) : NULL;
+    Synchronized_t *sync_tree = tree ? syn_new(tree) : NULL;
+
+    if (!keys || !mpmc || !deque || !list || !sync_queue || !sync_tree)
+        goto end;
+
+    // Lock hold times are not needed and would slow every section down
+    syn_set_timing(sync_queue, false);
+    syn_set_timing(sync_tree, false);
+
+    for (int64_t i = 0; i < THR_KEYS; i++)
+        keys[i] = i;
+
+    for (int64_t i = 0; i < THR_PREFILL; i++)
+    {
+        qmp_try_enqueue(mpmc, &keys[i]);
+        qar_enqueue(queue, &keys[i]);
+    }
+
+    for (int64_t i = 0; i < THR_KEYS; i += 2)
+    {
+        skl_insert(list, &keys[i]);
+        rbt_insert(tree, &keys[i]);
+    }
+
+    struct thr_bench b = { 0 };
+
+    b.keys = keys;
+
+    b.work = thr_mpmc_work;
+    b.mpmc = mpmc;
+    b.contention = thr_mpmc_retries;
+    b.counter = "cas-retries";
+    thr_scale(bench, &b, "Threaded/queue/QueueMPMC");
+
+    b.work = thr_sync_queue_work;
+    b.sync = sync_queue;
+    b.contention = thr_sync_waits;
+    b.counter = "lock-waits";
+    thr_scale(bench, &b, "Threaded/queue/Synchronized-QueueArray");
+
+    b.work = thr_deque_work;
+    b.deque = deque;
+    b.contention = thr_deque_retries;
+    b.counter = "cas-retries";
+    thr_scale(bench, &b, "Threaded/steal/DequeStealing");
+
+    b.deque = NULL;
+
+    unsigned_t mixes[3] = {50, 90, 99};
+
+    char prefix[64];
+
+    for (int i = 0; i < 3; i++)
+    {
+        b.reads = mixes[i];
+
+        b.work = thr_list_work;
+        b.list = list;
+        b.contention = NULL;
+        snprintf(prefix, sizeof(prefix), "Threaded/map/SkipList/read%" PRIuMAX,
+                 mixes[i]);
+        thr_scale(bench, &b, prefix);
+
+        b.list = NULL;
+
+        b.work = thr_sync_tree_work;
+        b.sync = sync_tree;
+        b.contention = thr_sync_waits;
+        b.counter = "lock-waits";
+        snprintf(prefix, sizeof(prefix), "Threaded/map/Synchronized-"
+                 "RedBlackTree/read%" PRIuMAX, mixes[i]);
+        thr_scale(bench, &b, prefix);
+    }
+
+    end:
+    if (sync_queue) syn_free(sync_queue);
+    if (sync_tree) syn_free(sync_tree);
+    if (queue) qar_free(queue);
+    if (tree) rbt_free(tree);
+    if (list) skl_free(list);
+    if (deque) dqs_free(deque);
+    if (mpmc) qmp_free(mpmc);
+    if (interface) interface_free(interface);
+    free(keys);
+}
@@ -1,13 +1,23 @@
 #include "Benchmarks.h"
 
-int main(void)
+int main(int argc, char **argv)
 {
+    Benchmark_t *bench = bch_new(argc, argv);
+
+    if (!bench)
+        return 2;
+
     printf("+--------------------------------------------------+\n");
     printf("|                    Benchmarks                    |\n");
     printf("+--------------------------------------------------+\n\n");
 
-    AssociativeListBench();
-    AVLTreeBench();
-    HeapBench();
-    RedBlackTreeBench();
+    AssociativeListBench(bench);
+    AVLTreeBench(bench);
+    ComparisonBench(bench);
+    HeapBench(bench);
+    RedBlackTreeBench(bench);
+    ReplayBench(bench);
+    ThreadedBench(bench);
+
+    return bch_free(bench);
 }
@@ -10,7 +10,9 @@
 #define C_DATASTRUCTURES_LIBRARY_AVLTREE_H
 
 #include "Core.h"
+#include "CoreStats.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +44,12 @@ typedef struct AVLTree_s *AVLTree;
 AVLTree_t *
 avl_new(Interface_t *interface);
 
+/// \ref avl_from_sorted_array
+/// \brief Builds a balanced AVL tree from a buffer of sorted elements.
+AVLTree_t *
+avl_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size);
+
 /// \ref avl_free
 /// \brief Frees from memory an AVLTree_s and its elements.
 void
@@ -81,6 +89,21 @@ avl_size(AVLTree_t *tree);
 integer_t
 avl_limit(AVLTree_t *tree);
 
+/// \ref avl_ranked
+/// \brief Returns true if the tree keeps the size of every subtree.
+bool
+avl_ranked(AVLTree_t *tree);
+
+/// \ref avl_stats
+/// \brief Copies the operation counters of the tree, if they are kept.
+bool
+avl_stats(AVLTree_t *tree, ContainerStats_t *stats);
+
+/// \ref avl_get
+/// \brief Returns the element in the tree equal to the given element.
+void *
+avl_get(AVLTree_t *tree, void *element);
+
 /////////////////////////////////////////////////////////////////// SETTERS ///
 
 /// \ref avl_set_limit
@@ -88,6 +111,16 @@ avl_limit(AVLTree_t *tree);
 bool
 avl_set_limit(AVLTree_t *tree, integer_t limit);
 
+/// \ref avl_set_pool
+/// \brief Sets a node pool from where the tree's nodes are allocated.
+bool
+avl_set_pool(AVLTree_t *tree, NodePool_t *pool);
+
+/// \ref avl_set_ranked
+/// \brief Enables or disables the order statistics of the tree.
+void
+avl_set_ranked(AVLTree_t *tree, bool ranked);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref avl_insert
@@ -95,6 +128,21 @@ avl_set_limit(AVLTree_t *tree, integer_t limit);
 bool
 avl_insert(AVLTree_t *tree, void *element);
 
+/// \ref avl_find_or_insert
+/// \brief Returns the element equal to the given one, adding it if missing.
+bool
+avl_find_or_insert(AVLTree_t *tree, void *element, void **existing);
+
+/// \ref avl_upsert
+/// \brief Adds an element or merges it into the equal element in the tree.
+bool
+avl_upsert(AVLTree_t *tree, void *element, reduce_f merge);
+
+/// \ref avl_insert_all
+/// \brief Adds every element of a buffer to the AVL tree.
+integer_t
+avl_insert_all(AVLTree_t *tree, void **elements, integer_t size);
+
 /// \ref avl_remove
 /// \brief Removes an element from the tree that matches the given element.
 bool
@@ -139,6 +187,65 @@ avl_max(AVLTree_t *tree);
 void *
 avl_min(AVLTree_t *tree);
 
+/// \ref avl_range
+/// \brief Visits in order every element between two elements.
+integer_t
+avl_range(AVLTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument);
+
+/// \ref avl_visit
+/// \brief Calls a function with each element given a traversal order.
+bool
+avl_visit(AVLTree_t *tree, int traversal_mode, visit_f visit, void *argument);
+
+/// \ref avl_select
+/// \brief Returns the element at a given position in ascending order.
+void *
+avl_select(AVLTree_t *tree, integer_t index);
+
+/// \ref avl_rank
+/// \brief Returns the amount of elements smaller than a given element.
+integer_t
+avl_rank(AVLTree_t *tree, void *element);
+
+/// \ref avl_save
+/// \brief Writes the tree to a stream.
+bool
+avl_save(AVLTree_t *tree, FILE *stream);
+
+/// \ref avl_restore
+/// \brief Reads back a tree written by avl_save().
+AVLTree_t *
+avl_restore(Interface_t *interface, FILE *stream);
+
+//////////////////////////////////////////////////////////// SET OPERATIONS ///
+
+/// \ref avl_union
+/// \brief Moves every element of tree2 to tree1.
+bool
+avl_union(AVLTree_t *tree1, AVLTree_t *tree2);
+
+/// \ref avl_intersection
+/// \brief Removes from tree1 every element that is not in tree2.
+void
+avl_intersection(AVLTree_t *tree1, AVLTree_t *tree2);
+
+/// \ref avl_difference
+/// \brief Removes from tree1 every element that is also in tree2.
+void
+avl_difference(AVLTree_t *tree1, AVLTree_t *tree2);
+
+/// \ref avl_split
+/// \brief Moves the elements greater than or equal to an element to a new
+/// tree.
+AVLTree_t *
+avl_split(AVLTree_t *tree, void *element);
+
+/// \ref avl_join
+/// \brief Moves every element of tree2 to the end of tree1.
+bool
+avl_join(AVLTree_t *tree1, AVLTree_t *tree2);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref avl_display
@@ -155,7 +262,87 @@ avl_traversal(AVLTree_t *tree, int traversal_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo AVLTreeIterator
+/// \struct AVLTreeIterator_s
+/// \brief A AVLTree_s iterator.
+struct AVLTreeIterator_s;
+
+/// \brief A type for an AVL tree iterator.
+///
+/// A type for a <code> struct AVLTreeIterator_s </code>.
+typedef struct AVLTreeIterator_s AVLTreeIterator_t;
+
+/// \brief A pointer type for an AVL tree iterator.
+///
+/// A pointer type for a <code> struct AVLTreeIterator_s </code>.
+typedef struct AVLTreeIterator_s *AVLTreeIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref avl_iter_new
+/// \brief Creates a new iterator at the minimum element of a tree.
+AVLTreeIterator_t *
+avl_iter_new(AVLTree_t *target);
+
+/// \ref avl_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+avl_iter_retarget(AVLTreeIterator_t *iter, AVLTree_t *target);
+
+/// \ref avl_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+avl_iter_free(AVLTreeIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref avl_iter_next
+/// \brief Iterates to the next element in order if available.
+bool
+avl_iter_next(AVLTreeIterator_t *iter);
+
+/// \ref avl_iter_prev
+/// \brief Iterates to the previous element in order if available.
+bool
+avl_iter_prev(AVLTreeIterator_t *iter);
+
+/// \ref avl_iter_to_start
+/// \brief Moves the cursor to the minimum element.
+bool
+avl_iter_to_start(AVLTreeIterator_t *iter);
+
+/// \ref avl_iter_to_end
+/// \brief Moves the cursor to the maximum element.
+bool
+avl_iter_to_end(AVLTreeIterator_t *iter);
+
+/// \ref avl_iter_lower_bound
+/// \brief Moves the cursor to the first element not smaller than a given one.
+bool
+avl_iter_lower_bound(AVLTreeIterator_t *iter, void *element);
+
+/// \ref avl_iter_upper_bound
+/// \brief Moves the cursor to the first element bigger than a given one.
+bool
+avl_iter_upper_bound(AVLTreeIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref avl_iter_has_next
+/// \brief Returns true if there is an element after the cursor.
+bool
+avl_iter_has_next(AVLTreeIterator_t *iter);
+
+/// \ref avl_iter_has_prev
+/// \brief Returns true if there is an element before the cursor.
+bool
+avl_iter_has_prev(AVLTreeIterator_t *iter);
+
+//////////////////////////////////////////////////////////////////// ACCESS ///
+
+/// \ref avl_iter_peek
+/// \brief Returns the element at the cursor.
+void *
+avl_iter_peek(AVLTreeIterator_t *iter);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -0,0 +1,191 @@
+/**
+ * @file AdaptiveRadixTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_ADAPTIVERADIXTREE_H
+#define C_DATASTRUCTURES_LIBRARY_ADAPTIVERADIXTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "CString.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct AdaptiveRadixTree_s
+/// \brief An ordered map from strings to values with prefix queries.
+struct AdaptiveRadixTree_s;
+
+/// \ref AdaptiveRadixTree_t
+/// \brief A type for an adaptive radix tree.
+///
+/// A type for a <code> struct AdaptiveRadixTree_s </code> so you don't have
+/// to always write the full name of it.
+typedef struct AdaptiveRadixTree_s AdaptiveRadixTree_t;
+
+/// \ref AdaptiveRadixTree
+/// \brief A pointer type for an adaptive radix tree.
+///
+/// Defines a pointer type to <code> struct AdaptiveRadixTree_s </code>. This
+/// typedef is used to avoid having to declare every adaptive radix tree as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct AdaptiveRadixTree_s *AdaptiveRadixTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref art_new
+/// \brief Initializes a new AdaptiveRadixTree_s.
+AdaptiveRadixTree_t *
+art_new(Interface_t *value_interface);
+
+/// \ref art_free
+/// \brief Frees from memory an AdaptiveRadixTree_s and its values.
+void
+art_free(AdaptiveRadixTree_t *tree);
+
+/// \ref art_free_shallow
+/// \brief Frees from memory an AdaptiveRadixTree_s leaving its values intact.
+void
+art_free_shallow(AdaptiveRadixTree_t *tree);
+
+/// \ref art_erase
+/// \brief Frees from memory every key and value of an AdaptiveRadixTree_s.
+void
+art_erase(AdaptiveRadixTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref art_count
+/// \brief Returns the amount of keys in the tree.
+integer_t
+art_count(AdaptiveRadixTree_t *tree);
+
+/// \ref art_get
+/// \brief Returns the value associated with a key, or NULL if not found.
+void *
+art_get(AdaptiveRadixTree_t *tree, const char *key);
+
+/// \ref art_get_string
+/// \brief Returns the value associated with a String key, or NULL if not
+/// found.
+void *
+art_get_string(AdaptiveRadixTree_t *tree, String key);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref art_insert
+/// \brief Inserts a copy of a key mapped to a value.
+bool
+art_insert(AdaptiveRadixTree_t *tree, const char *key, void *value);
+
+/// \ref art_insert_string
+/// \brief Inserts a copy of a String key mapped to a value.
+bool
+art_insert_string(AdaptiveRadixTree_t *tree, String key, void *value);
+
+/// \ref art_remove
+/// \brief Removes a key from the tree and retrieves its value.
+bool
+art_remove(AdaptiveRadixTree_t *tree, const char *key, void **value);
+
+/// \ref art_remove_string
+/// \brief Removes a String key from the tree and retrieves its value.
+bool
+art_remove_string(AdaptiveRadixTree_t *tree, String key, void **value);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref art_empty
+/// \brief Returns true if the tree has no keys.
+bool
+art_empty(AdaptiveRadixTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref art_contains
+/// \brief Returns true if a key is in the tree.
+bool
+art_contains(AdaptiveRadixTree_t *tree, const char *key);
+
+/// \ref art_prefix
+/// \brief Visits in key order the value of every key starting with a prefix.
+integer_t
+art_prefix(AdaptiveRadixTree_t *tree, const char *prefix, visit_f visit,
+           void *argument);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+// An adaptive radix tree iterator. See the source file for the full
+// documentation.
+struct AdaptiveRadixTreeIterator_s;
+
+/// \brief A type for an adaptive radix tree iterator.
+///
+/// A type for a <code> struct AdaptiveRadixTreeIterator_s </code>.
+typedef struct AdaptiveRadixTreeIterator_s AdaptiveRadixTreeIterator_t;
+
+/// \brief A pointer type for an adaptive radix tree iterator.
+///
+/// A pointer type for a <code> struct AdaptiveRadixTreeIterator_s </code>.
+typedef struct AdaptiveRadixTreeIterator_s *AdaptiveRadixTreeIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref art_iter_new
+/// \brief Creates an iterator over the keys starting with a prefix, in order.
+AdaptiveRadixTreeIterator_t *
+art_iter_new(AdaptiveRadixTree_t *target, const char *prefix);
+
+/// \ref art_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+art_iter_free(AdaptiveRadixTreeIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref art_iter_next
+/// \brief Iterates to the next key-value pair if available.
+bool
+art_iter_next(AdaptiveRadixTreeIterator_t *iter);
+
+/// \ref art_iter_to_start
+/// \brief Iterates to the first key-value pair.
+bool
+art_iter_to_start(AdaptiveRadixTreeIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref art_iter_has_next
+/// \brief Returns true if there is another key-value pair in the iteration.
+bool
+art_iter_has_next(AdaptiveRadixTreeIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref art_iter_get_key
+/// \brief Gets the key pointed by the iterator.
+bool
+art_iter_get_key(AdaptiveRadixTreeIterator_t *iter, const char **key);
+
+/// \ref art_iter_get_value
+/// \brief Gets the value pointed by the iterator.
+bool
+art_iter_get_value(AdaptiveRadixTreeIterator_t *iter, void **value);
+
+/// \ref art_iter_set_value
+/// \brief Sets the value pointed by the iterator to a new value.
+bool
+art_iter_set_value(AdaptiveRadixTreeIterator_t *iter, void *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_ADAPTIVERADIXTREE_H
@@ -0,0 +1,83 @@
+/**
+ * @file Arena.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_ARENA_H
+#define C_DATASTRUCTURES_LIBRARY_ARENA_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct Arena_s
+/// \brief A bump allocator that releases all of its memory at once.
+struct Arena_s;
+
+/// \ref Arena_t
+/// \brief A type for an arena.
+///
+/// A type for a <code> struct Arena_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Arena_s Arena_t;
+
+/// \ref Arena
+/// \brief A pointer type for an arena.
+///
+/// Defines a pointer type to <code> struct Arena_s </code>. This typedef is
+/// used to avoid having to declare every arena as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct Arena_s *Arena;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref arn_new
+/// \brief Initializes a new arena that allocates blocks of a given size.
+Arena_t *
+arn_new(size_t block_size);
+
+/// \ref arn_free
+/// \brief Frees from memory an arena and everything allocated from it.
+void
+arn_free(Arena_t *arena);
+
+/// \ref arn_reset
+/// \brief Releases everything allocated from the arena, keeping one block.
+void
+arn_reset(Arena_t *arena);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref arn_used
+/// \brief Returns the amount of bytes handed out by the arena.
+size_t
+arn_used(Arena_t *arena);
+
+/// \ref arn_reserved
+/// \brief Returns the amount of bytes the arena got from malloc().
+size_t
+arn_reserved(Arena_t *arena);
+
+/// \ref arn_allocator
+/// \brief Returns an allocator that allocates from the arena.
+Allocator_t *
+arn_allocator(Arena_t *arena);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref arn_alloc
+/// \brief Allocates a block of memory from the arena.
+void *
+arn_alloc(Arena_t *arena, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_ARENA_H
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "ThreadPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -212,16 +213,52 @@ arr_sort(Array_t *array);
 void
 arr_sortby(Array_t *array, compare_f comparator);
 
+/// \ref arr_sort_parallel
+/// \brief Sorts the specified array using multiple threads.
+bool
+arr_sort_parallel(Array_t *array, integer_t threads);
+
 /// \ref arr_to_array
 /// \brief Makes a copy to a C array.
 void **
 arr_to_array(Array_t *array, integer_t *length, bool shallow);
 
+/// \ref arr_span
+/// \brief Gives direct access to contiguous elements of the array.
+integer_t
+arr_span(Array_t *array, integer_t position, void ***span);
+
 /// \ref arr_from_array
 /// \brief Makes a new Array_s from an existing C array.
 Array_t *
 arr_from_array(Interface_t *interface, void **buffer, integer_t length);
 
+/////////////////////////////////////////////////////////// BULK OPERATIONS ///
+
+/// \ref arr_for_each
+/// \brief Visits every element of the array.
+void
+arr_for_each(Array_t *array, visit_f visit, void *argument, ThreadPool_t *pool);
+
+/// \ref arr_map
+/// \brief Makes a new array out of the elements of another one.
+Array_t *
+arr_map(Array_t *array, Interface_t *interface, map_f map, void *argument,
+        ThreadPool_t *pool);
+
+/// \ref arr_filter_in_place
+/// \brief Removes every element that doesn't match a predicate.
+integer_t
+arr_filter_in_place(Array_t *array, predicate_f keep, void *argument,
+                    ThreadPool_t *pool);
+
+/// \ref arr_reduce
+/// \brief Folds every element of the array into an accumulator.
+void
+arr_reduce(Array_t *array, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref arr_display
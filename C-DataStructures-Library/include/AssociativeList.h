@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -87,6 +88,16 @@ ali_limit(AssociativeList_t *list);
 bool
 ali_multiple_keys(AssociativeList_t *list);
 
+/// \ref ali_move_to_front
+/// \brief Returns true if keys found by ali_get() are moved to the front.
+bool
+ali_move_to_front(AssociativeList_t *list);
+
+/// \ref ali_hashed
+/// \brief Returns true if the nodes of the list cache the hash of their keys.
+bool
+ali_hashed(AssociativeList_t *list);
+
 /// \ref ali_get
 /// \brief Returns the value associated with a key, or NULL if not found.
 void *
@@ -99,6 +110,21 @@ ali_get(AssociativeList_t *list, void *key);
 bool
 ali_set_limit(AssociativeList_t *list, integer_t limit);
 
+/// \ref ali_set_pool
+/// \brief Sets a node pool from where the list's nodes are allocated.
+bool
+ali_set_pool(AssociativeList_t *list, NodePool_t *pool);
+
+/// \ref ali_set_move_to_front
+/// \brief Sets if keys found by ali_get() are moved to the front.
+void
+ali_set_move_to_front(AssociativeList_t *list, bool move_to_front);
+
+/// \ref ali_set_hashed
+/// \brief Sets if the nodes of the list cache the hash of their keys.
+bool
+ali_set_hashed(AssociativeList_t *list, bool hashed);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref ali_insert
@@ -106,6 +132,12 @@ ali_set_limit(AssociativeList_t *list, integer_t limit);
 bool
 ali_insert(AssociativeList_t *list, void *key, void *value);
 
+/// \ref ali_get_or_insert
+/// \brief Returns the value of a key, inserting it if it is not present.
+bool
+ali_get_or_insert(AssociativeList_t *list, void *key, void *value,
+                  void **result);
+
 /// \ref ali_remove
 /// \brief Removes a given key from the list and retrieves its value.
 bool
@@ -0,0 +1,148 @@
+/**
+ * @file BPlusTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BPLUSTREE_H
+#define C_DATASTRUCTURES_LIBRARY_BPLUSTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct BPlusTree_s
+/// \brief A generic B+ tree.
+struct BPlusTree_s;
+
+/// \ref BPlusTree_t
+/// \brief A type for a B+ tree.
+///
+/// A type for a <code> struct BPlusTree_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct BPlusTree_s BPlusTree_t;
+
+/// \ref BPlusTree
+/// \brief A pointer type for a B+ tree.
+///
+/// Defines a pointer type to <code> struct BPlusTree_s </code>. This typedef
+/// is used to avoid having to declare every B+ tree as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct BPlusTree_s *BPlusTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref bpt_new
+/// \brief Creates a new empty B+ tree.
+BPlusTree_t *
+bpt_new(Interface_t *interface);
+
+/// \ref bpt_create
+/// \brief Creates a new empty B+ tree that keeps integer keys inline.
+BPlusTree_t *
+bpt_create(Interface_t *interface, key_f key);
+
+/// \ref bpt_from_sorted_array
+/// \brief Builds a B+ tree from a buffer of sorted and unique elements.
+BPlusTree_t *
+bpt_from_sorted_array(Interface_t *interface, key_f key, void **elements,
+                      integer_t size);
+
+/// \ref bpt_free
+/// \brief Frees from memory a BPlusTree_s and all its elements.
+void
+bpt_free(BPlusTree_t *tree);
+
+/// \ref bpt_free_shallow
+/// \brief Frees from memory a BPlusTree_s leaving its elements intact.
+void
+bpt_free_shallow(BPlusTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref bpt_size
+/// \brief Returns the amount of elements in the B+ tree.
+integer_t
+bpt_size(BPlusTree_t *tree);
+
+/// \ref bpt_height
+/// \brief Returns the amount of levels in the B+ tree.
+integer_t
+bpt_height(BPlusTree_t *tree);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref bpt_insert
+/// \brief Adds a new element to the B+ tree.
+bool
+bpt_insert(BPlusTree_t *tree, void *element);
+
+/// \ref bpt_remove
+/// \brief Removes an element from the tree that matches the given element.
+bool
+bpt_remove(BPlusTree_t *tree, void *element);
+
+/// \ref bpt_pop
+/// \brief Removes the minimum element and frees it from memory.
+bool
+bpt_pop(BPlusTree_t *tree);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref bpt_empty
+/// \brief Checks if the specified B+ tree is empty.
+bool
+bpt_empty(BPlusTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref bpt_contains
+/// \brief Checks if a given element is in the B+ tree.
+bool
+bpt_contains(BPlusTree_t *tree, void *element);
+
+/// \ref bpt_peek
+/// \brief Returns the minimum element if present.
+void *
+bpt_peek(BPlusTree_t *tree);
+
+/// \ref bpt_max
+/// \brief Returns the maximum element if present.
+void *
+bpt_max(BPlusTree_t *tree);
+
+/// \ref bpt_min
+/// \brief Returns the minimum element if present.
+void *
+bpt_min(BPlusTree_t *tree);
+
+///////////////////////////////////////////////////////// SEARCH OPERATIONS ///
+
+/// \ref bpt_range
+/// \brief Visits in order every element between two keys, both inclusive.
+integer_t
+bpt_range(BPlusTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument);
+
+/// \ref bpt_traversal
+/// \brief Visits every element in order.
+void
+bpt_traversal(BPlusTree_t *tree, visit_f visit, void *argument);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref bpt_display
+/// \brief Displays every element of the B+ tree in order.
+void
+bpt_display(BPlusTree_t *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BPLUSTREE_H
@@ -11,11 +11,34 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/// \brief How a BinarySearchTree_s keeps itself balanced.
+enum BinarySearchTreeEngine_e
+{
+    /// Elements are added where the search ends and the tree is never
+    /// restructured. Sorted insertions make it degenerate into a list.
+    BST_PLAIN = 0,
+
+    /// A splay tree. Every node that is inserted, found or removed is rotated
+    /// up to the root, so operations take amortized O(log n) and recently
+    /// used elements are the fastest to reach. Lookups change the tree.
+    BST_SPLAY = 1,
+
+    /// A treap. Every node has a random priority and the tree is also a heap
+    /// of priorities, so its shape is that of a random insertion order and
+    /// operations take expected O(log n) whatever the order of the elements.
+    BST_TREAP = 2
+};
+
+/// \ref BinarySearchTreeEngine
+/// \brief A type for a binary search tree engine.
+typedef enum BinarySearchTreeEngine_e BinarySearchTreeEngine;
+
 /// \struct BinarySearchTree_s
 /// \brief A generic, multi-purpose binary search tree.
 struct BinarySearchTree_s;
@@ -42,6 +65,17 @@ typedef struct BinarySearchTree_s *BinarySearchTree;
 BinarySearchTree_t *
 bst_new(Interface_t *interface);
 
+/// \ref bst_create
+/// \brief Initializes a new binary search tree with a given engine.
+BinarySearchTree_t *
+bst_create(Interface_t *interface, BinarySearchTreeEngine engine);
+
+/// \ref bst_from_sorted_array
+/// \brief Builds a balanced tree from a buffer of sorted elements.
+BinarySearchTree_t *
+bst_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size);
+
 /// \ref bst_free
 /// \brief Frees from memory a BinarySearchTree_s and its elements.
 void
@@ -81,6 +115,16 @@ bst_count(BinarySearchTree_t *tree);
 integer_t
 bst_limit(BinarySearchTree_t *tree);
 
+/// \ref bst_engine
+/// \brief Returns the engine of the binary search tree.
+BinarySearchTreeEngine
+bst_engine(BinarySearchTree_t *tree);
+
+/// \ref bst_get
+/// \brief Returns the element in the tree equal to the given element.
+void *
+bst_get(BinarySearchTree_t *tree, void *element);
+
 /////////////////////////////////////////////////////////////////// SETTERS ///
 
 /// \ref bst_set_limit
@@ -88,6 +132,11 @@ bst_limit(BinarySearchTree_t *tree);
 bool
 bst_set_limit(BinarySearchTree_t *tree, integer_t limit);
 
+/// \ref bst_set_pool
+/// \brief Sets a node pool from where the tree's nodes are allocated.
+bool
+bst_set_pool(BinarySearchTree_t *tree, NodePool_t *pool);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref bst_insert
@@ -95,6 +144,21 @@ bst_set_limit(BinarySearchTree_t *tree, integer_t limit);
 bool
 bst_insert(BinarySearchTree_t *tree, void *element);
 
+/// \ref bst_find_or_insert
+/// \brief Returns the element equal to the given one, adding it if missing.
+bool
+bst_find_or_insert(BinarySearchTree_t *tree, void *element, void **existing);
+
+/// \ref bst_upsert
+/// \brief Adds an element or merges it into the equal element in the tree.
+bool
+bst_upsert(BinarySearchTree_t *tree, void *element, reduce_f merge);
+
+/// \ref bst_insert_all
+/// \brief Adds every element of a buffer to the binary search tree.
+integer_t
+bst_insert_all(BinarySearchTree_t *tree, void **elements, integer_t size);
+
 /// \ref bst_remove
 /// \brief Removes an element from the tree that matches the given element.
 bool
@@ -139,6 +203,18 @@ bst_max(BinarySearchTree_t *tree);
 void *
 bst_min(BinarySearchTree_t *tree);
 
+/// \ref bst_range
+/// \brief Visits in order every element between two elements.
+integer_t
+bst_range(BinarySearchTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument);
+
+/// \ref bst_visit
+/// \brief Calls a function with each element given a traversal order.
+bool
+bst_visit(BinarySearchTree_t *tree, int traversal_mode, visit_f visit,
+          void *argument);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref bst_display
@@ -155,7 +231,87 @@ bst_traversal(BinarySearchTree_t *tree, int traversal_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo BinarySearchTreeIterator
+/// \struct BinarySearchTreeIterator_s
+/// \brief A BinarySearchTree_s iterator.
+struct BinarySearchTreeIterator_s;
+
+/// \brief A type for a binary search tree iterator.
+///
+/// A type for a <code> struct BinarySearchTreeIterator_s </code>.
+typedef struct BinarySearchTreeIterator_s BinarySearchTreeIterator_t;
+
+/// \brief A pointer type for a binary search tree iterator.
+///
+/// A pointer type for a <code> struct BinarySearchTreeIterator_s </code>.
+typedef struct BinarySearchTreeIterator_s *BinarySearchTreeIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref bst_iter_new
+/// \brief Creates a new iterator at the minimum element of a tree.
+BinarySearchTreeIterator_t *
+bst_iter_new(BinarySearchTree_t *target);
+
+/// \ref bst_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+bst_iter_retarget(BinarySearchTreeIterator_t *iter, BinarySearchTree_t *target);
+
+/// \ref bst_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+bst_iter_free(BinarySearchTreeIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref bst_iter_next
+/// \brief Iterates to the next element in order if available.
+bool
+bst_iter_next(BinarySearchTreeIterator_t *iter);
+
+/// \ref bst_iter_prev
+/// \brief Iterates to the previous element in order if available.
+bool
+bst_iter_prev(BinarySearchTreeIterator_t *iter);
+
+/// \ref bst_iter_to_start
+/// \brief Moves the cursor to the minimum element.
+bool
+bst_iter_to_start(BinarySearchTreeIterator_t *iter);
+
+/// \ref bst_iter_to_end
+/// \brief Moves the cursor to the maximum element.
+bool
+bst_iter_to_end(BinarySearchTreeIterator_t *iter);
+
+/// \ref bst_iter_lower_bound
+/// \brief Moves the cursor to the first element not smaller than a given one.
+bool
+bst_iter_lower_bound(BinarySearchTreeIterator_t *iter, void *element);
+
+/// \ref bst_iter_upper_bound
+/// \brief Moves the cursor to the first element bigger than a given one.
+bool
+bst_iter_upper_bound(BinarySearchTreeIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref bst_iter_has_next
+/// \brief Returns true if there is an element after the cursor.
+bool
+bst_iter_has_next(BinarySearchTreeIterator_t *iter);
+
+/// \ref bst_iter_has_prev
+/// \brief Returns true if there is an element before the cursor.
+bool
+bst_iter_has_prev(BinarySearchTreeIterator_t *iter);
+
+//////////////////////////////////////////////////////////////////// ACCESS ///
+
+/// \ref bst_iter_peek
+/// \brief Returns the element at the cursor.
+void *
+bst_iter_peek(BinarySearchTreeIterator_t *iter);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -40,11 +40,21 @@ bit_new(void);
 BitArray_t *
 bit_create(unsigned_t required_bits);
 
+/// \ref bit_map
+/// \brief Opens a bit array kept in a file mapped in memory.
+BitArray_t *
+bit_map(const char *path, unsigned_t required_bits);
+
 /// \ref bit_free
 /// \brief Frees from memory the specified bit array.
 void
 bit_free(BitArray_t *bits);
 
+/// \ref bit_sync
+/// \brief Writes a bit array kept in a file to the file.
+bool
+bit_sync(BitArray_t *bits);
+
 /////////////////////////////////////////////////////////////////// GETTERS ///
 
 /// \ref bit_nwords
@@ -175,6 +185,26 @@ bit_prev_set(BitArray_t *bits, unsigned_t bit_index);
 unsigned_t
 bit_prev_clear(BitArray_t *bits, unsigned_t bit_index);
 
+/// \ref bit_rank
+/// \brief Returns how many bits are set before a given index.
+unsigned_t
+bit_rank(BitArray_t *bits, unsigned_t bit_index);
+
+/// \ref bit_select
+/// \brief Returns the index of the n-th set bit.
+unsigned_t
+bit_select(BitArray_t *bits, unsigned_t rank);
+
+/// \ref bit_build_index
+/// \brief Builds a directory that speeds up bit_rank() and bit_select().
+bool
+bit_build_index(BitArray_t *bits);
+
+/// \ref bit_drop_index
+/// \brief Frees the directory built by bit_build_index().
+void
+bit_drop_index(BitArray_t *bits);
+
 /// \ref bit_all_set
 /// \brief Returns true if all bits are set in the bit array.
 bool
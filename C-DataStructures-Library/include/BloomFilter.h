@@ -0,0 +1,136 @@
+/**
+ * @file BloomFilter.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BLOOMFILTER_H
+#define C_DATASTRUCTURES_LIBRARY_BLOOMFILTER_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "BitArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct BloomFilter_s
+/// \brief A probabilistic set backed by a BitArray_s.
+struct BloomFilter_s;
+
+/// \ref BloomFilter_t
+/// \brief A type for a bloom filter.
+///
+/// A type for a <code> struct BloomFilter_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct BloomFilter_s BloomFilter_t;
+
+/// \ref BloomFilter
+/// \brief A pointer type for a bloom filter.
+///
+/// Defines a pointer type to <code> struct BloomFilter_s </code>. This
+/// typedef is used to avoid having to declare every bloom filter as a pointer
+/// type since they all must be dynamically allocated.
+typedef struct BloomFilter_s *BloomFilter;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref blf_new
+/// \brief Creates a bloom filter sized for a target false positive rate.
+BloomFilter_t *
+blf_new(hash_f hash, unsigned_t expected, double false_positive_rate);
+
+/// \ref blf_new_blocked
+/// \brief Creates a blocked bloom filter sized for a target false positive
+/// rate.
+BloomFilter_t *
+blf_new_blocked(hash_f hash, unsigned_t expected, double false_positive_rate);
+
+/// \ref blf_create
+/// \brief Creates a bloom filter with a given amount of bits and hashes.
+BloomFilter_t *
+blf_create(hash_f hash, unsigned_t nbits, integer_t hashes, bool blocked);
+
+/// \ref blf_free
+/// \brief Frees from memory the specified bloom filter.
+void
+blf_free(BloomFilter_t *filter);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref blf_nbits
+/// \brief Returns the amount of bits in the bloom filter.
+unsigned_t
+blf_nbits(BloomFilter_t *filter);
+
+/// \ref blf_hashes
+/// \brief Returns the amount of bits set by each element.
+integer_t
+blf_hashes(BloomFilter_t *filter);
+
+/// \ref blf_count
+/// \brief Returns the amount of elements inserted in the bloom filter.
+unsigned_t
+blf_count(BloomFilter_t *filter);
+
+/// \ref blf_blocked
+/// \brief Returns true if every element is kept in a single cache line.
+bool
+blf_blocked(BloomFilter_t *filter);
+
+/// \ref blf_false_positive_rate
+/// \brief Estimates the current false positive rate from the set bits.
+double
+blf_false_positive_rate(BloomFilter_t *filter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref blf_insert
+/// \brief Adds an element to the bloom filter.
+bool
+blf_insert(BloomFilter_t *filter, void *element);
+
+/// \ref blf_contains
+/// \brief Returns false if the element was certainly never inserted.
+bool
+blf_contains(BloomFilter_t *filter, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref blf_empty
+/// \brief Removes every element from the bloom filter.
+bool
+blf_empty(BloomFilter_t *filter);
+
+/// \ref blf_copy
+/// \brief Creates a copy of a BloomFilter_s.
+BloomFilter_t *
+blf_copy(BloomFilter_t *filter);
+
+///////////////////////////////////////////////////////// BINARY OPERATIONS ///
+
+/// \ref blf_union
+/// \brief Adds to a bloom filter every element of another one.
+bool
+blf_union(BloomFilter_t *filter1, BloomFilter_t *filter2);
+
+/// \ref blf_intersection
+/// \brief Keeps in a bloom filter only the elements also in another one.
+bool
+blf_intersection(BloomFilter_t *filter1, BloomFilter_t *filter2);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref blf_display
+/// \brief Displays the parameters of the bloom filter in the console.
+void
+blf_display(BloomFilter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BLOOMFILTER_H
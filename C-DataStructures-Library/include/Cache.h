@@ -0,0 +1,162 @@
+/**
+ * @file Cache.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CACHE_H
+#define C_DATASTRUCTURES_LIBRARY_CACHE_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Which entry a Cache_s evicts when it is full.
+enum CachePolicy_e
+{
+    /// Evicts the least recently used entry.
+    CACHE_LRU = 0,
+
+    /// Evicts the least frequently used entry. Ties are broken by recency.
+    CACHE_LFU = 1
+};
+
+/// \ref CachePolicy
+/// \brief A type for a cache eviction policy.
+typedef enum CachePolicy_e CachePolicy;
+
+/// \brief A function that returns the weight of a key-value pair.
+///
+/// The weight is counted against the capacity of a Cache_s, usually the size
+/// in bytes of the pair. It must be positive and it must not change while the
+/// pair is in the cache.
+typedef integer_t(*weigh_f)(const void *, const void *);
+
+/// \struct Cache_s
+/// \brief A bounded key-value cache with constant time get, put and evict.
+struct Cache_s;
+
+/// \ref Cache_t
+/// \brief A type for a cache.
+///
+/// A type for a <code> struct Cache_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Cache_s Cache_t;
+
+/// \ref Cache
+/// \brief A pointer type for a cache.
+///
+/// Defines a pointer type to <code> struct Cache_s </code>. This typedef is
+/// used to avoid having to declare every cache as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct Cache_s *Cache;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref cch_new
+/// \brief Initializes a new cache bounded by its amount of entries.
+Cache_t *
+cch_new(Interface_t *key_interface, Interface_t *value_interface,
+        CachePolicy policy, integer_t capacity);
+
+/// \ref cch_create
+/// \brief Initializes a new cache bounded by the weight of its entries.
+Cache_t *
+cch_create(Interface_t *key_interface, Interface_t *value_interface,
+           CachePolicy policy, integer_t capacity, weigh_f weigh);
+
+/// \ref cch_free
+/// \brief Frees from memory a Cache_s and its key-value pairs.
+void
+cch_free(Cache_t *cache);
+
+/// \ref cch_erase
+/// \brief Frees from memory all key-value pairs of a Cache_s.
+void
+cch_erase(Cache_t *cache);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref cch_on_evict
+/// \brief Sets a function that receives the values of evicted entries.
+void
+cch_on_evict(Cache_t *cache, free_f function);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref cch_count
+/// \brief Returns the amount of entries in the cache.
+integer_t
+cch_count(Cache_t *cache);
+
+/// \ref cch_weight
+/// \brief Returns the total weight of the entries in the cache.
+integer_t
+cch_weight(Cache_t *cache);
+
+/// \ref cch_capacity
+/// \brief Returns the maximum weight of the cache.
+integer_t
+cch_capacity(Cache_t *cache);
+
+/// \ref cch_hits
+/// \brief Returns how many times cch_get() found its key.
+integer_t
+cch_hits(Cache_t *cache);
+
+/// \ref cch_misses
+/// \brief Returns how many times cch_get() did not find its key.
+integer_t
+cch_misses(Cache_t *cache);
+
+/// \ref cch_evictions
+/// \brief Returns how many entries were evicted to make room for others.
+integer_t
+cch_evictions(Cache_t *cache);
+
+/// \ref cch_get
+/// \brief Returns the value associated with a key and marks it as used.
+void *
+cch_get(Cache_t *cache, void *key);
+
+/// \ref cch_peek
+/// \brief Returns the value associated with a key without marking it as used.
+void *
+cch_peek(Cache_t *cache, void *key);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref cch_put
+/// \brief Inserts or replaces a key-value pair, evicting entries if needed.
+bool
+cch_put(Cache_t *cache, void *key, void *value);
+
+/// \ref cch_remove
+/// \brief Removes a key from the cache and frees its key-value pair.
+bool
+cch_remove(Cache_t *cache, void *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref cch_empty
+/// \brief Returns true if the cache is empty, otherwise false.
+bool
+cch_empty(Cache_t *cache);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref cch_contains
+/// \brief Returns true if the cache contains a given key.
+bool
+cch_contains(Cache_t *cache, void *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_CACHE_H
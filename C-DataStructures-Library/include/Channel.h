@@ -0,0 +1,126 @@
+/**
+ * @file Channel.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CHANNEL_H
+#define C_DATASTRUCTURES_LIBRARY_CHANNEL_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \enum ChannelResult_e
+/// \brief The outcome of a blocking channel operation.
+enum ChannelResult_e
+{
+    /// The element was sent or received.
+    CHN_OK = 0,
+
+    /// The timeout expired before the operation could be done.
+    CHN_TIMEOUT = 1,
+
+    /// The channel was closed. Nothing can be sent and there is nothing left
+    /// to be received.
+    CHN_CLOSED = 2
+};
+
+/// \ref ChannelResult
+/// \brief A type for the outcome of a blocking channel operation.
+typedef enum ChannelResult_e ChannelResult;
+
+/// \struct Channel_s
+/// \brief A bounded queue where threads block until they can send or receive.
+struct Channel_s;
+
+/// \ref Channel_t
+/// \brief A type for a channel.
+///
+/// A type for a <code> struct Channel_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Channel_s Channel_t;
+
+/// \ref Channel
+/// \brief A pointer type for a channel.
+///
+/// Defines a pointer type to <code> struct Channel_s </code>. This typedef is
+/// used to avoid having to declare every channel as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct Channel_s *Channel;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref chn_new
+/// \brief Initializes a new channel that holds up to a given amount.
+Channel_t *
+chn_new(Interface_t *interface, integer_t capacity);
+
+/// \ref chn_free
+/// \brief Frees from memory the channel and the elements left in it.
+void
+chn_free(Channel_t *channel);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref chn_capacity
+/// \brief Returns the maximum amount of elements in the channel.
+integer_t
+chn_capacity(Channel_t *channel);
+
+/// \ref chn_count
+/// \brief Returns the amount of elements waiting to be received.
+integer_t
+chn_count(Channel_t *channel);
+
+/// \ref chn_closed
+/// \brief Returns true if the channel was closed.
+bool
+chn_closed(Channel_t *channel);
+
+/// \ref chn_fd
+/// \brief Returns a file descriptor that is readable while there is work.
+int
+chn_fd(Channel_t *channel);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref chn_send
+/// \brief Sends an element, waiting while the channel is full.
+ChannelResult
+chn_send(Channel_t *channel, void *element, integer_t timeout);
+
+/// \ref chn_receive
+/// \brief Receives an element, waiting while the channel is empty.
+ChannelResult
+chn_receive(Channel_t *channel, void **result, integer_t timeout);
+
+/// \ref chn_send_n
+/// \brief Sends a buffer of elements, waiting while the channel is full.
+integer_t
+chn_send_n(Channel_t *channel, void **elements, integer_t size,
+           integer_t timeout);
+
+/// \ref chn_receive_n
+/// \brief Receives up to a given amount of elements.
+integer_t
+chn_receive_n(Channel_t *channel, void **result, integer_t max,
+              integer_t timeout);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref chn_close
+/// \brief Closes the channel and wakes up every waiting thread.
+void
+chn_close(Channel_t *channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_CHANNEL_H
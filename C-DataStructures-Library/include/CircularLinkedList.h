@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_CIRCULARLINKEDLIST_H
 
 #include "Core.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -82,6 +83,8 @@ Status cll_set_v_free(CircularLinkedList list, cll_free_f function);
 
 Status cll_set_limit(CircularLinkedList list, integer_t limit);
 
+Status cll_set_pool(CircularLinkedList list, NodePool_t *pool);
+
 /////////////////////////////////////////////////////////////////// GETTERS ///
 
 integer_t cll_length(CircularLinkedList list);
@@ -120,6 +123,8 @@ void *cll_peek(CircularLinkedList cll);
 
 void *cll_peek_prev(CircularLinkedList cll);
 
+Status cll_sort(CircularLinkedList cll);
+
 Status cll_copy(CircularLinkedList cll, CircularLinkedList *result);
 
 ///////////////////////////////////////////////////////////////// ITERATION ///
@@ -0,0 +1,147 @@
+/**
+ * @file CompactRedBlackTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_COMPACTREDBLACKTREE_H
+#define C_DATASTRUCTURES_LIBRARY_COMPACTREDBLACKTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "NodePool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct CompactRedBlackTree_s
+/// \brief A red-black tree with small nodes and single-pass updates.
+struct CompactRedBlackTree_s;
+
+/// \ref CompactRedBlackTree_t
+/// \brief A type for a compact red-black tree.
+///
+/// A type for a <code> struct CompactRedBlackTree_s </code> so you don't have
+/// to always write the full name of it.
+typedef struct CompactRedBlackTree_s CompactRedBlackTree_t;
+
+/// \ref CompactRedBlackTree
+/// \brief A pointer type for a compact red-black tree.
+///
+/// Defines a pointer type to <code> struct CompactRedBlackTree_s </code>. This
+/// typedef is used to avoid having to declare every compact red-black tree as
+/// a pointer type since they all must be dynamically allocated.
+typedef struct CompactRedBlackTree_s *CompactRedBlackTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref crb_new
+/// \brief Initializes a new CompactRedBlackTree_s.
+CompactRedBlackTree_t *
+crb_new(Interface_t *interface);
+
+/// \ref crb_free
+/// \brief Frees from memory a CompactRedBlackTree_s and all its elements.
+void
+crb_free(CompactRedBlackTree_t *tree);
+
+/// \ref crb_free_shallow
+/// \brief Frees from memory a CompactRedBlackTree_s leaving its elements
+/// intact.
+void
+crb_free_shallow(CompactRedBlackTree_t *tree);
+
+/// \ref crb_erase
+/// \brief Frees from memory all elements of a CompactRedBlackTree_s.
+void
+crb_erase(CompactRedBlackTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref crb_size
+/// \brief Returns the amount of elements in the tree.
+integer_t
+crb_size(CompactRedBlackTree_t *tree);
+
+/// \ref crb_limit
+/// \brief Returns the tree's size limit.
+integer_t
+crb_limit(CompactRedBlackTree_t *tree);
+
+/// \ref crb_height
+/// \brief Returns the amount of nodes in the longest path from the root.
+integer_t
+crb_height(CompactRedBlackTree_t *tree);
+
+/// \ref crb_get
+/// \brief Returns the element in the tree that is equal to a given one.
+void *
+crb_get(CompactRedBlackTree_t *tree, void *element);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref crb_set_limit
+/// \brief Sets a limit to the amount of elements in the tree.
+bool
+crb_set_limit(CompactRedBlackTree_t *tree, integer_t limit);
+
+/// \ref crb_set_pool
+/// \brief Sets a node pool from where the tree's nodes are allocated.
+bool
+crb_set_pool(CompactRedBlackTree_t *tree, NodePool_t *pool);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref crb_insert
+/// \brief Inserts an element into the tree.
+bool
+crb_insert(CompactRedBlackTree_t *tree, void *element);
+
+/// \ref crb_remove
+/// \brief Removes an element from the tree and frees it.
+bool
+crb_remove(CompactRedBlackTree_t *tree, void *element);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref crb_empty
+/// \brief Checks if the tree is empty.
+bool
+crb_empty(CompactRedBlackTree_t *tree);
+
+/// \ref crb_full
+/// \brief Checks if the tree is full.
+bool
+crb_full(CompactRedBlackTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref crb_contains
+/// \brief Checks if the tree contains a given element.
+bool
+crb_contains(CompactRedBlackTree_t *tree, void *element);
+
+/// \ref crb_max
+/// \brief Returns the maximum element in the tree.
+void *
+crb_max(CompactRedBlackTree_t *tree);
+
+/// \ref crb_min
+/// \brief Returns the minimum element in the tree.
+void *
+crb_min(CompactRedBlackTree_t *tree);
+
+/// \ref crb_range
+/// \brief Visits in order the elements within a closed range.
+integer_t
+crb_range(CompactRedBlackTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_COMPACTREDBLACKTREE_H
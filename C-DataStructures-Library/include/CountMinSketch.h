@@ -0,0 +1,112 @@
+/**
+ * @file CountMinSketch.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_COUNTMINSKETCH_H
+#define C_DATASTRUCTURES_LIBRARY_COUNTMINSKETCH_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct CountMinSketch_s
+/// \brief Estimates how many times each element of a stream was seen.
+struct CountMinSketch_s;
+
+/// \ref CountMinSketch_t
+/// \brief A type for a count-min sketch.
+///
+/// A type for a <code> struct CountMinSketch_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct CountMinSketch_s CountMinSketch_t;
+
+/// \ref CountMinSketch
+/// \brief A pointer type for a count-min sketch.
+///
+/// Defines a pointer type to <code> struct CountMinSketch_s </code>. This
+/// typedef is used to avoid having to declare every count-min sketch as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct CountMinSketch_s *CountMinSketch;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref cms_new
+/// \brief Creates a count-min sketch sized for a target error.
+CountMinSketch_t *
+cms_new(hash_f hash, double epsilon, double delta);
+
+/// \ref cms_create
+/// \brief Creates a count-min sketch with a given width and depth.
+CountMinSketch_t *
+cms_create(hash_f hash, integer_t width, integer_t depth);
+
+/// \ref cms_free
+/// \brief Frees from memory the specified count-min sketch.
+void
+cms_free(CountMinSketch_t *sketch);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref cms_width
+/// \brief Returns the amount of counters in each row.
+integer_t
+cms_width(CountMinSketch_t *sketch);
+
+/// \ref cms_depth
+/// \brief Returns the amount of rows.
+integer_t
+cms_depth(CountMinSketch_t *sketch);
+
+/// \ref cms_total
+/// \brief Returns the sum of all the amounts added.
+unsigned_t
+cms_total(CountMinSketch_t *sketch);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref cms_insert
+/// \brief Adds an amount to the count of an element.
+bool
+cms_insert(CountMinSketch_t *sketch, void *element, unsigned_t amount);
+
+/// \ref cms_estimate
+/// \brief Returns an upper bound of the count of an element.
+unsigned_t
+cms_estimate(CountMinSketch_t *sketch, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref cms_erase
+/// \brief Sets every count back to zero.
+void
+cms_erase(CountMinSketch_t *sketch);
+
+/// \ref cms_copy
+/// \brief Creates a copy of a CountMinSketch_s.
+CountMinSketch_t *
+cms_copy(CountMinSketch_t *sketch);
+
+/// \ref cms_merge
+/// \brief Adds to a count-min sketch the counts of another one.
+bool
+cms_merge(CountMinSketch_t *sketch1, CountMinSketch_t *sketch2);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref cms_display
+/// \brief Displays the parameters of the count-min sketch in the console.
+void
+cms_display(CountMinSketch_t *sketch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_COUNTMINSKETCH_H
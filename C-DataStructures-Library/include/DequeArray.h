@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "ThreadPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -102,6 +103,11 @@ dqa_capacity(DequeArray_t *deque);
 integer_t
 dqa_growth(DequeArray_t *deque);
 
+/// \ref dqa_policy
+/// \brief Returns how the buffer grows.
+GrowthPolicy
+dqa_policy(DequeArray_t *deque);
+
 /// \ref dqa_locked
 /// \brief Returns true if the deque's buffer is locked, false otherwise.
 bool
@@ -124,6 +130,26 @@ dqa_capacity_lock(DequeArray_t *deque);
 void
 dqa_capacity_unlock(DequeArray_t *deque);
 
+/// \ref dqa_set_shrink
+/// \brief Makes the buffer shrink automatically when it is mostly empty.
+void
+dqa_set_shrink(DequeArray_t *deque, bool shrink);
+
+/// \ref dqa_set_policy
+/// \brief Sets how the buffer grows.
+bool
+dqa_set_policy(DequeArray_t *deque, GrowthPolicy policy, integer_t step);
+
+/// \ref dqa_reserve
+/// \brief Grows the buffer to hold a given amount of elements.
+bool
+dqa_reserve(DequeArray_t *deque, integer_t capacity);
+
+/// \ref dqa_shrink_to_fit
+/// \brief Shrinks the buffer to the amount of elements in the deque.
+bool
+dqa_shrink_to_fit(DequeArray_t *deque);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref dqa_enqueue_front
@@ -146,6 +172,26 @@ dqa_dequeue_front(DequeArray_t *deque, void **result);
 bool
 dqa_dequeue_rear(DequeArray_t *deque, void **result);
 
+/// \ref dqa_enqueue_front_n
+/// \brief Inserts a buffer of elements at the front of the specified deque.
+bool
+dqa_enqueue_front_n(DequeArray_t *deque, void **elements, integer_t size);
+
+/// \ref dqa_enqueue_rear_n
+/// \brief Inserts a buffer of elements at the rear of the specified deque.
+bool
+dqa_enqueue_rear_n(DequeArray_t *deque, void **elements, integer_t size);
+
+/// \ref dqa_dequeue_front_n
+/// \brief Removes up to a given amount of elements from the front.
+integer_t
+dqa_dequeue_front_n(DequeArray_t *deque, void **result, integer_t max);
+
+/// \ref dqa_dequeue_rear_n
+/// \brief Removes up to a given amount of elements from the rear.
+integer_t
+dqa_dequeue_rear_n(DequeArray_t *deque, void **result, integer_t max);
+
 /// \ref dqa_peek_front
 /// \brief Returns the front element in the specified deque.
 void *
@@ -208,12 +254,51 @@ dqa_prepend(DequeArray_t *deque1, DequeArray_t *deque2);
 void **
 dqa_to_array(DequeArray_t *deque, integer_t *length);
 
+/// \ref dqa_to_array_move
+/// \brief Moves the elements of the deque to a C array.
+void **
+dqa_to_array_move(DequeArray_t *deque, integer_t *length);
+
+/// \ref dqa_span
+/// \brief Gives direct access to contiguous elements of the deque.
+integer_t
+dqa_span(DequeArray_t *deque, integer_t position, void ***span);
+
+/////////////////////////////////////////////////////////// BULK OPERATIONS ///
+
+/// \ref dqa_for_each
+/// \brief Visits every element of the deque.
+void
+dqa_for_each(DequeArray_t *deque, visit_f visit, void *argument,
+             ThreadPool_t *pool);
+
+/// \ref dqa_map
+/// \brief Makes a new deque out of the elements of another one.
+DequeArray_t *
+dqa_map(DequeArray_t *deque, Interface_t *interface, map_f map, void *argument,
+        ThreadPool_t *pool);
+
+/// \ref dqa_filter_in_place
+/// \brief Removes every element that doesn't match a predicate.
+integer_t
+dqa_filter_in_place(DequeArray_t *deque, predicate_f keep, void *argument,
+                    ThreadPool_t *pool);
+
+/// \ref dqa_reduce
+/// \brief Folds every element of the deque into an accumulator.
+void
+dqa_reduce(DequeArray_t *deque, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref dqa_display
 /// \brief Displays a DequeArray_s in the console.
 void
 dqa_display(DequeArray_t *deque, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
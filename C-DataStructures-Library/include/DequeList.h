@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -85,6 +86,11 @@ dql_config(DequeList_t *deque, Interface_t *new_interface);
 integer_t
 dql_count(DequeList_t *deque);
 
+/// \ref dql_chunk
+/// \brief Returns how many elements each node of the deque holds.
+integer_t
+dql_chunk(DequeList_t *deque);
+
 /// \ref dql_limit
 /// \brief Returns the current deque limit.
 integer_t
@@ -97,6 +103,16 @@ dql_limit(DequeList_t *deque);
 bool
 dql_set_limit(DequeList_t *deque, integer_t limit);
 
+/// \ref dql_set_pool
+/// \brief Sets a node pool from where the deque's nodes are allocated.
+bool
+dql_set_pool(DequeList_t *deque, NodePool_t *pool);
+
+/// \ref dql_set_chunk
+/// \brief Sets how many elements each node of the deque holds.
+bool
+dql_set_chunk(DequeList_t *deque, integer_t chunk);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref dql_enqueue_front
@@ -186,10 +202,12 @@ dql_to_array(DequeList_t *deque, integer_t *length);
 
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref dql_display
 /// \brief Displays a DequeList_s in the console.
 void
 dql_display(DequeList_t *deque, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
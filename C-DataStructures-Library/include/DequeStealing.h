@@ -0,0 +1,94 @@
+/**
+ * @file DequeStealing.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_DEQUESTEALING_H
+#define C_DATASTRUCTURES_LIBRARY_DEQUESTEALING_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct DequeStealing_s
+/// \brief A lock-free work-stealing deque.
+struct DequeStealing_s;
+
+/// \ref DequeStealing_t
+/// \brief A type for a work-stealing deque.
+///
+/// A type for a <code> struct DequeStealing_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct DequeStealing_s DequeStealing_t;
+
+/// \ref DequeStealing
+/// \brief A pointer type for a work-stealing deque.
+///
+/// A pointer type to <code> struct DequeStealing_s </code>. This typedef is
+/// used to avoid having to declare every deque as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct DequeStealing_s *DequeStealing;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref dqs_new
+/// \brief Initializes a new DequeStealing_s.
+DequeStealing_t *
+dqs_new(integer_t initial_capacity);
+
+/// \ref dqs_free
+/// \brief Frees from memory a DequeStealing_s leaving its elements intact.
+void
+dqs_free(DequeStealing_t *deque);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref dqs_count
+/// \brief Returns an approximation of the amount of elements in the deque.
+integer_t
+dqs_count(DequeStealing_t *deque);
+
+/// \ref dqs_retries
+/// \brief Returns how many times a thread lost the race for an element.
+unsigned_t
+dqs_retries(DequeStealing_t *deque);
+
+/// \ref dqs_capacity
+/// \brief Returns the current buffer capacity of the deque.
+integer_t
+dqs_capacity(DequeStealing_t *deque);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref dqs_enqueue_rear
+/// \brief Inserts an element at the rear of the deque. Owner thread only.
+bool
+dqs_enqueue_rear(DequeStealing_t *deque, void *element);
+
+/// \ref dqs_dequeue_rear
+/// \brief Removes the element at the rear of the deque. Owner thread only.
+bool
+dqs_dequeue_rear(DequeStealing_t *deque, void **result);
+
+/// \ref dqs_dequeue_front
+/// \brief Steals the element at the front of the deque. Any thread.
+bool
+dqs_dequeue_front(DequeStealing_t *deque, void **result);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref dqs_empty
+/// \brief Returns true if the deque appears to be empty.
+bool
+dqs_empty(DequeStealing_t *deque);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_DEQUESTEALING_H
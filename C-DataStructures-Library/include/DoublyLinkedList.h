@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_DOUBLYLINKEDLIST_H
 
 #include "Core.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -82,6 +83,8 @@ Status dll_set_v_free(DoublyLinkedList list, dll_free_f function);
 
 Status dll_set_limit(DoublyLinkedList list, integer_t limit);
 
+Status dll_set_pool(DoublyLinkedList list, NodePool_t *pool);
+
 Status dll_set(DoublyLinkedList list, void *element, integer_t position);
 
 /////////////////////////////////////////////////////////////////// GETTERS ///
@@ -126,6 +129,8 @@ bool dll_contains(DoublyLinkedList list, void *key);
 
 Status dll_reverse(DoublyLinkedList list);
 
+Status dll_sort(DoublyLinkedList list);
+
 Status dll_copy(DoublyLinkedList list, DoublyLinkedList *result);
 
 Status dll_to_array(DoublyLinkedList list, void ***result, integer_t *length);
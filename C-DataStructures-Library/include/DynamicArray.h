@@ -10,7 +10,9 @@
 #define C_DATASTRUCTURES_LIBRARY_DYNAMICARRAY_H
 
 #include "Core.h"
+#include "CoreStats.h"
 #include "Interface.h"
+#include "ThreadPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,6 +48,12 @@ DynamicArray_t *
 dar_create(Interface_t *interface, integer_t initial_capacity,
            integer_t growth_rate);
 
+/// \ref dar_adopt
+/// \brief Creates a dynamic array that takes ownership of a buffer.
+DynamicArray_t *
+dar_adopt(Interface_t *interface, void **buffer, integer_t size,
+          integer_t capacity, integer_t growth_rate);
+
 /// \ref dar_free
 /// \brief Frees from memory a dynamic array and its elements.
 void
@@ -85,6 +93,26 @@ dar_capacity_lock(DynamicArray_t *array);
 void
 dar_capacity_unlock(DynamicArray_t *array);
 
+/// \ref dar_reserve
+/// \brief Grows the buffer to hold at least a given amount of elements.
+bool
+dar_reserve(DynamicArray_t *array, integer_t capacity);
+
+/// \ref dar_set_policy
+/// \brief Sets how the buffer grows.
+bool
+dar_set_policy(DynamicArray_t *array, GrowthPolicy policy, integer_t step);
+
+/// \ref dar_set_shrink
+/// \brief Makes the buffer shrink automatically when it is mostly empty.
+void
+dar_set_shrink(DynamicArray_t *array, bool shrink);
+
+/// \ref dar_set_tombstones
+/// \brief Makes removals mark slots as dead instead of shifting elements.
+bool
+dar_set_tombstones(DynamicArray_t *array, integer_t threshold);
+
 /////////////////////////////////////////////////////////////////// GETTERS ///
 
 /// \ref dar_capacity
@@ -102,11 +130,26 @@ dar_size(DynamicArray_t *array);
 integer_t
 dar_growth_rate(DynamicArray_t *array);
 
+/// \ref dar_policy
+/// \brief Returns how the buffer grows.
+GrowthPolicy
+dar_policy(DynamicArray_t *array);
+
+/// \ref dar_tombstones
+/// \brief Returns the amount of dead slots that were not compacted yet.
+integer_t
+dar_tombstones(DynamicArray_t *array);
+
 /// \ref dar_is_locked
 /// \brief Returns true if the dynamic array's growth is locked.
 bool
 dar_is_locked(DynamicArray_t *array);
 
+/// \ref dar_stats
+/// \brief Copies the operation counters of the array, if they are kept.
+bool
+dar_stats(DynamicArray_t *array, ContainerStats_t *stats);
+
 /// \ref dar_get
 /// \brief Returns an element at the specified position of the array.
 void *
@@ -135,6 +178,11 @@ dar_insert_at(DynamicArray_t *array, void *element, integer_t index);
 bool
 dar_insert_back(DynamicArray_t *array, void *element);
 
+/// \ref dar_emplace_back
+/// \brief Adds an empty slot at the end of the array and returns it.
+void **
+dar_emplace_back(DynamicArray_t *array);
+
 /// \ref dar_remove
 /// \brief Extracts a sub-array from a given range.
 bool
@@ -161,6 +209,11 @@ dar_remove_back(DynamicArray_t *array, void **result);
 bool
 dar_delete(DynamicArray_t *array, integer_t from, integer_t to);
 
+/// \ref dar_compact
+/// \brief Removes the dead slots left by removals in tombstone mode.
+integer_t
+dar_compact(DynamicArray_t *array);
+
 /// \ref dar_prepend
 /// \brief Prepends the second array into the first, emptying it.
 bool
@@ -250,21 +303,85 @@ dar_copy_shallow(DynamicArray_t *array);
 void **
 dar_to_array(DynamicArray_t *array, integer_t *length);
 
+/// \ref dar_span
+/// \brief Gives direct access to contiguous elements of the dynamic array.
+integer_t
+dar_span(DynamicArray_t *array, integer_t position, void ***span);
+
 /// \ref dar_from_array
 /// \brief Makes a new DynamicArray_s from an existing C array.
 DynamicArray_t *
 dar_from_array(Interface_t *interface, void **buffer, integer_t length,
                integer_t growth_rate);
 
+/// \ref dar_release_buffer
+/// \brief Hands the buffer over to the caller, leaving the array empty.
+void **
+dar_release_buffer(DynamicArray_t *array, integer_t *size);
+
+/// \ref dar_save
+/// \brief Writes the array to a stream.
+bool
+dar_save(DynamicArray_t *array, FILE *stream);
+
+/// \ref dar_restore
+/// \brief Reads back an array written by dar_save().
+DynamicArray_t *
+dar_restore(Interface_t *interface, FILE *stream);
+
 void
 dar_sort(DynamicArray_t *array);
 
+/// \ref dar_sort_radix
+/// \brief Sorts the DynamicArray_s using radix sort.
+bool
+dar_sort_radix(DynamicArray_t *array, key_f key);
+
+/// \ref dar_sort_parallel
+/// \brief Sorts the DynamicArray_s using multiple threads.
+bool
+dar_sort_parallel(DynamicArray_t *array, integer_t threads);
+
+/////////////////////////////////////////////////////////// BULK OPERATIONS ///
+
+/// \ref dar_for_each
+/// \brief Visits every element of the array.
+void
+dar_for_each(DynamicArray_t *array, visit_f visit, void *argument,
+             ThreadPool_t *pool);
+
+/// \ref dar_map
+/// \brief Makes a new array out of the elements of another one.
+DynamicArray_t *
+dar_map(DynamicArray_t *array, Interface_t *interface, map_f map,
+        void *argument, ThreadPool_t *pool);
+
+/// \ref dar_filter_in_place
+/// \brief Removes every element that doesn't match a predicate.
+integer_t
+dar_filter_in_place(DynamicArray_t *array, predicate_f keep, void *argument,
+                    ThreadPool_t *pool);
+
+/// \ref dar_remove_if
+/// \brief Removes every element that matches a predicate in a single pass.
+integer_t
+dar_remove_if(DynamicArray_t *array, predicate_f remove, void *argument);
+
+/// \ref dar_reduce
+/// \brief Folds every element of the array into an accumulator.
+void
+dar_reduce(DynamicArray_t *array, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref dar_display
 /// \brief Displays a DynamicArray_s in the console.
 void
 dar_display(DynamicArray_t *array, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
@@ -0,0 +1,129 @@
+/**
+ * @file EpochReclaimer.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_EPOCHRECLAIMER_H
+#define C_DATASTRUCTURES_LIBRARY_EPOCHRECLAIMER_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct EpochReclaimer_s
+/// \brief Defers freeing memory that other threads might still be reading.
+struct EpochReclaimer_s;
+
+/// \ref EpochReclaimer_t
+/// \brief A type for an epoch reclaimer.
+///
+/// A type for a <code> struct EpochReclaimer_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct EpochReclaimer_s EpochReclaimer_t;
+
+/// \ref EpochReclaimer
+/// \brief A pointer type for an epoch reclaimer.
+///
+/// Defines a pointer type to <code> struct EpochReclaimer_s </code>. This
+/// typedef is used to avoid having to declare every epoch reclaimer as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct EpochReclaimer_s *EpochReclaimer;
+
+/// \struct EpochThread_s
+/// \brief A thread registered in an EpochReclaimer_s.
+struct EpochThread_s;
+
+/// \ref EpochThread_t
+/// \brief A type for a thread registered in an epoch reclaimer.
+typedef struct EpochThread_s EpochThread_t;
+
+/// \ref EpochThread
+/// \brief A pointer type for a thread registered in an epoch reclaimer.
+typedef struct EpochThread_s *EpochThread;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref ebr_new
+/// \brief Initializes a new EpochReclaimer_s.
+EpochReclaimer_t *
+ebr_new(void);
+
+/// \ref ebr_free
+/// \brief Frees the reclaimer, every registered thread and pending memory.
+void
+ebr_free(EpochReclaimer_t *reclaimer);
+
+/// \ref ebr_register
+/// \brief Registers the calling thread.
+EpochThread_t *
+ebr_register(EpochReclaimer_t *reclaimer);
+
+/// \ref ebr_unregister
+/// \brief Unregisters a thread, handing its pending memory to the reclaimer.
+void
+ebr_unregister(EpochThread_t *thread);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref ebr_epoch
+/// \brief Returns the global epoch.
+integer_t
+ebr_epoch(EpochReclaimer_t *reclaimer);
+
+/// \ref ebr_limit
+/// \brief Returns the amount of pending pointers a thread may have.
+integer_t
+ebr_limit(EpochReclaimer_t *reclaimer);
+
+/// \ref ebr_pending
+/// \brief Returns the amount of pointers retired by a thread not yet freed.
+integer_t
+ebr_pending(EpochThread_t *thread);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref ebr_set_limit
+/// \brief Sets the amount of pending pointers a thread may have.
+void
+ebr_set_limit(EpochReclaimer_t *reclaimer, integer_t limit);
+
+////////////////////////////////////////////////////////// CRITICAL SECTIONS ///
+
+/// \ref ebr_enter
+/// \brief Starts a critical section where shared memory can be read.
+void
+ebr_enter(EpochThread_t *thread);
+
+/// \ref ebr_exit
+/// \brief Ends a critical section.
+void
+ebr_exit(EpochThread_t *thread);
+
+//////////////////////////////////////////////////////////////// RECLAIMING ///
+
+/// \ref ebr_retire
+/// \brief Frees a pointer once no thread can be reading it.
+bool
+ebr_retire(EpochThread_t *thread, void *pointer, free_f function);
+
+/// \ref ebr_reclaim
+/// \brief Advances the epoch if possible and frees what became safe.
+integer_t
+ebr_reclaim(EpochThread_t *thread);
+
+/// \ref ebr_drain
+/// \brief Waits until every pointer retired by a thread is freed.
+void
+ebr_drain(EpochThread_t *thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_EPOCHRECLAIMER_H
@@ -0,0 +1,105 @@
+/**
+ * @file FenwickTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_FENWICKTREE_H
+#define C_DATASTRUCTURES_LIBRARY_FENWICKTREE_H
+
+#include "Core.h"
+#include "DynamicArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct FenwickTree_s
+/// \brief An array of integers with logarithmic prefix sums.
+struct FenwickTree_s;
+
+/// \ref FenwickTree_t
+/// \brief A type for a Fenwick tree.
+///
+/// A type for a <code> struct FenwickTree_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct FenwickTree_s FenwickTree_t;
+
+/// \ref FenwickTree
+/// \brief A pointer type for a Fenwick tree.
+///
+/// Defines a pointer type to <code> struct FenwickTree_s </code>. This
+/// typedef is used to avoid having to declare every Fenwick tree as a pointer
+/// type since they all must be dynamically allocated.
+typedef struct FenwickTree_s *FenwickTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref fwt_new
+/// \brief Initializes a new Fenwick tree with every value set to zero.
+FenwickTree_t *
+fwt_new(integer_t size);
+
+/// \ref fwt_from_buffer
+/// \brief Builds a Fenwick tree from a buffer of values in linear time.
+FenwickTree_t *
+fwt_from_buffer(const int64_t *values, integer_t size);
+
+/// \ref fwt_from_array
+/// \brief Builds a Fenwick tree from a dynamic array of int64_t elements.
+FenwickTree_t *
+fwt_from_array(DynamicArray_t *array);
+
+/// \ref fwt_free
+/// \brief Frees from memory a FenwickTree_s.
+void
+fwt_free(FenwickTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref fwt_size
+/// \brief Returns the amount of values in the tree.
+integer_t
+fwt_size(FenwickTree_t *tree);
+
+/// \ref fwt_get
+/// \brief Returns the value at a given index.
+bool
+fwt_get(FenwickTree_t *tree, integer_t index, int64_t *result);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref fwt_add
+/// \brief Adds an amount to the value at a given index.
+bool
+fwt_add(FenwickTree_t *tree, integer_t index, int64_t delta);
+
+/// \ref fwt_set
+/// \brief Replaces the value at a given index.
+bool
+fwt_set(FenwickTree_t *tree, integer_t index, int64_t value);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref fwt_prefix
+/// \brief Returns the sum of the first values of the tree.
+int64_t
+fwt_prefix(FenwickTree_t *tree, integer_t count);
+
+/// \ref fwt_sum
+/// \brief Returns the sum of the values between two indexes.
+bool
+fwt_sum(FenwickTree_t *tree, integer_t from, integer_t to, int64_t *result);
+
+/// \ref fwt_lower_bound
+/// \brief Returns the first index where the prefix sum reaches a target.
+integer_t
+fwt_lower_bound(FenwickTree_t *tree, int64_t target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_FENWICKTREE_H
@@ -0,0 +1,118 @@
+/**
+ * @file Graph.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_GRAPH_H
+#define C_DATASTRUCTURES_LIBRARY_GRAPH_H
+
+#include "Core.h"
+#include "ThreadPool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct Graph_s
+/// \brief An immutable graph stored in compressed sparse row format.
+struct Graph_s;
+
+/// \ref Graph_t
+/// \brief A type for a graph.
+///
+/// A type for a <code> struct Graph_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Graph_s Graph_t;
+
+/// \ref Graph
+/// \brief A pointer type for a graph.
+///
+/// Defines a pointer type to <code> struct Graph_s </code>. This typedef is
+/// used to avoid having to declare every graph as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct Graph_s *Graph;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref gph_new
+/// \brief Builds a graph from a list of edges.
+Graph_t *
+gph_new(integer_t vertices, integer_t edges, const integer_t *sources,
+        const integer_t *targets, const int64_t *weights, bool directed);
+
+/// \ref gph_free
+/// \brief Frees from memory a graph.
+void
+gph_free(Graph_t *graph);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref gph_vertices
+/// \brief Returns the amount of vertices.
+integer_t
+gph_vertices(Graph_t *graph);
+
+/// \ref gph_edges
+/// \brief Returns the amount of edges the graph was built with.
+integer_t
+gph_edges(Graph_t *graph);
+
+/// \ref gph_directed
+/// \brief Returns true if the graph is directed.
+bool
+gph_directed(Graph_t *graph);
+
+/// \ref gph_degree
+/// \brief Returns the amount of edges that leave a vertex.
+integer_t
+gph_degree(Graph_t *graph, integer_t vertex);
+
+/// \ref gph_neighbours
+/// \brief Returns the vertices adjacent to a vertex.
+const integer_t *
+gph_neighbours(Graph_t *graph, integer_t vertex, integer_t *degree);
+
+/// \ref gph_weights
+/// \brief Returns the weights of the edges that leave a vertex.
+const int64_t *
+gph_weights(Graph_t *graph, integer_t vertex);
+
+///////////////////////////////////////////////////////////////// TRAVERSAL ///
+
+/// \ref gph_bfs
+/// \brief Finds the amount of edges from a vertex to every other.
+bool
+gph_bfs(Graph_t *graph, integer_t source, integer_t *distances,
+        integer_t *parents);
+
+/// \ref gph_bfs_parallel
+/// \brief Same as gph_bfs() but each level is explored by many threads.
+bool
+gph_bfs_parallel(Graph_t *graph, integer_t source, integer_t *distances,
+                 integer_t *parents, ThreadPool_t *pool);
+
+/// \ref gph_dfs
+/// \brief Lists the vertices reachable from a vertex in depth-first order.
+integer_t
+gph_dfs(Graph_t *graph, integer_t source, integer_t *order,
+        integer_t *parents);
+
+/// \ref gph_dijkstra
+/// \brief Finds the shortest weighted paths from a vertex to every other.
+bool
+gph_dijkstra(Graph_t *graph, integer_t source, int64_t *distances,
+             integer_t *parents);
+
+/// \ref gph_components
+/// \brief Labels every vertex with its connected component.
+integer_t
+gph_components(Graph_t *graph, integer_t *labels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_GRAPH_H
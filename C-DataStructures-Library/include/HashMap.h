@@ -0,0 +1,271 @@
+/**
+ * @file HashMap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_HASHMAP_H
+#define C_DATASTRUCTURES_LIBRARY_HASHMAP_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct HashMap_s
+/// \brief A generic open-addressing hash map of key-value pairs.
+struct HashMap_s;
+
+/// \ref HashMap_t
+/// \brief A type for a hash map.
+///
+/// A type for a <code> struct HashMap_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct HashMap_s HashMap_t;
+
+/// \ref HashMap
+/// \brief A pointer type for a hash map.
+///
+/// Defines a pointer type to <code> struct HashMap_s </code>. This typedef is
+/// used to avoid having to declare every hash map as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct HashMap_s *HashMap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref hmp_new
+/// \brief Initializes a new hash map with default parameters.
+HashMap_t *
+hmp_new(Interface_t *key_interface, Interface_t *value_interface);
+
+/// \ref hmp_create
+/// \brief Initializes a new hash map with custom parameters.
+HashMap_t *
+hmp_create(Interface_t *key_interface, Interface_t *value_interface,
+           integer_t min_capacity, integer_t max_load);
+
+/// \ref hmp_free
+/// \brief Frees from memory a HashMap_s and its key-value pairs.
+void
+hmp_free(HashMap_t *map);
+
+/// \ref hmp_free_shallow
+/// \brief Frees from memory a HashMap_s leaving its key-value pairs intact.
+void
+hmp_free_shallow(HashMap_t *map);
+
+/// \ref hmp_erase
+/// \brief Frees from memory all key-value pairs of a HashMap_s.
+void
+hmp_erase(HashMap_t *map);
+
+/// \ref hmp_erase_shallow
+/// \brief Removes all references to the key-value pairs in the HashMap_s.
+void
+hmp_erase_shallow(HashMap_t *map);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref hmp_config
+/// \brief Sets new interfaces for the target hash map.
+void
+hmp_config(HashMap_t *map, Interface_t *key_interface,
+           Interface_t *value_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref hmp_count
+/// \brief Returns the amount of key-value pairs in the hash map.
+integer_t
+hmp_count(HashMap_t *map);
+
+/// \ref hmp_capacity
+/// \brief Returns the amount of buckets in the hash map.
+integer_t
+hmp_capacity(HashMap_t *map);
+
+/// \ref hmp_max_load
+/// \brief Returns the maximum load factor, in percent, before the map grows.
+integer_t
+hmp_max_load(HashMap_t *map);
+
+/// \ref hmp_load
+/// \brief Returns the current load factor of the hash map.
+double
+hmp_load(HashMap_t *map);
+
+/// \ref hmp_get
+/// \brief Returns the value associated with a key, or NULL if not found.
+void *
+hmp_get(HashMap_t *map, void *key);
+
+/// \ref hmp_get_all
+/// \brief Gives every value associated with a key as a span.
+integer_t
+hmp_get_all(HashMap_t *map, void *key, void ***values);
+
+/// \ref hmp_key_count
+/// \brief Returns the amount of values associated with a key.
+integer_t
+hmp_key_count(HashMap_t *map, void *key);
+
+/// \ref hmp_multiple_keys
+/// \brief Returns true if a key can be associated with more than one value.
+bool
+hmp_multiple_keys(HashMap_t *map);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref hmp_set_max_load
+/// \brief Sets a new maximum load factor, in percent.
+bool
+hmp_set_max_load(HashMap_t *map, integer_t max_load);
+
+/// \ref hmp_set_multiple_keys
+/// \brief Lets the keys of an empty map be associated with many values.
+bool
+hmp_set_multiple_keys(HashMap_t *map, bool multiple);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref hmp_insert
+/// \brief Inserts a new key mapped to a value in the hash map.
+bool
+hmp_insert(HashMap_t *map, void *key, void *value);
+
+/// \ref hmp_remove
+/// \brief Removes a given key from the map and retrieves its value.
+bool
+hmp_remove(HashMap_t *map, void *key, void **value);
+
+/// \ref hmp_pop
+/// \brief Removes a given key from the map and frees its key-value pair.
+bool
+hmp_pop(HashMap_t *map, void *key);
+
+/// \ref hmp_remove_all
+/// \brief Removes a key and frees every value associated with it.
+integer_t
+hmp_remove_all(HashMap_t *map, void *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref hmp_empty
+/// \brief Returns true if the hash map is empty, otherwise false.
+bool
+hmp_empty(HashMap_t *map);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref hmp_contains_key
+/// \brief Returns true if the hash map contains a given key.
+bool
+hmp_contains_key(HashMap_t *map, void *key);
+
+/// \ref hmp_contains_value
+/// \brief Returns true if the hash map contains a given value.
+bool
+hmp_contains_value(HashMap_t *map, void *value);
+
+/// \ref hmp_reserve
+/// \brief Grows the hash map so that it can hold a given amount of pairs.
+bool
+hmp_reserve(HashMap_t *map, integer_t count);
+
+/// \ref hmp_save
+/// \brief Writes the hash map to a stream.
+bool
+hmp_save(HashMap_t *map, FILE *stream);
+
+/// \ref hmp_restore
+/// \brief Reads back a hash map written by hmp_save().
+HashMap_t *
+hmp_restore(Interface_t *key_interface, Interface_t *value_interface,
+            FILE *stream);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref hmp_display
+/// \brief Displays in the console a hash map.
+void
+hmp_display(HashMap_t *map);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+// A hash map iterator. See the source file for the full documentation.
+struct HashMapIterator_s;
+
+/// \brief A type for a hash map iterator.
+///
+/// A type for a <code> struct HashMapIterator_s </code>.
+typedef struct HashMapIterator_s HashMapIterator_t;
+
+/// \brief A pointer type for a hash map iterator.
+///
+/// A pointer type for a <code> struct HashMapIterator_s </code>.
+typedef struct HashMapIterator_s *HashMapIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref hmp_iter_new
+/// \brief Creates a new hash map iterator given a target.
+HashMapIterator_t *
+hmp_iter_new(HashMap_t *target);
+
+/// \ref hmp_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+hmp_iter_retarget(HashMapIterator_t *iter, HashMap_t *target);
+
+/// \ref hmp_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+hmp_iter_free(HashMapIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref hmp_iter_next
+/// \brief Iterates to the next key-value pair if available.
+bool
+hmp_iter_next(HashMapIterator_t *iter);
+
+/// \ref hmp_iter_to_start
+/// \brief Iterates to the first key-value pair in the hash map.
+bool
+hmp_iter_to_start(HashMapIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref hmp_iter_has_next
+/// \brief Returns true if there is another key-value pair in the iteration.
+bool
+hmp_iter_has_next(HashMapIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref hmp_iter_get_key
+/// \brief Gets the key pointed by the iterator.
+bool
+hmp_iter_get_key(HashMapIterator_t *iter, void **key);
+
+/// \ref hmp_iter_get_value
+/// \brief Gets the value pointed by the iterator.
+bool
+hmp_iter_get_value(HashMapIterator_t *iter, void **value);
+
+/// \ref hmp_iter_set_value
+/// \brief Sets the value pointed by the iterator to a new value.
+bool
+hmp_iter_set_value(HashMapIterator_t *iter, void *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_HASHMAP_H
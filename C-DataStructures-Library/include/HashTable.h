@@ -0,0 +1,173 @@
+/**
+ * @file HashTable.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_HASHTABLE_H
+#define C_DATASTRUCTURES_LIBRARY_HASHTABLE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "NodePool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct HashTable_s
+/// \brief A generic separate-chaining hash table with incremental rehashing.
+struct HashTable_s;
+
+/// \ref HashTable_t
+/// \brief A type for a hash table.
+///
+/// A type for a <code> struct HashTable_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct HashTable_s HashTable_t;
+
+/// \ref HashTable
+/// \brief A pointer type for a hash table.
+///
+/// Defines a pointer type to <code> struct HashTable_s </code>. This typedef
+/// is used to avoid having to declare every hash table as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct HashTable_s *HashTable;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref htb_new
+/// \brief Initializes a new hash table with default parameters.
+HashTable_t *
+htb_new(Interface_t *key_interface, Interface_t *value_interface);
+
+/// \ref htb_create
+/// \brief Initializes a new hash table with custom parameters.
+HashTable_t *
+htb_create(Interface_t *key_interface, Interface_t *value_interface,
+           integer_t min_capacity, integer_t max_load, integer_t rehash_step);
+
+/// \ref htb_free
+/// \brief Frees from memory a HashTable_s and its key-value pairs.
+void
+htb_free(HashTable_t *table);
+
+/// \ref htb_free_shallow
+/// \brief Frees from memory a HashTable_s leaving its key-value pairs intact.
+void
+htb_free_shallow(HashTable_t *table);
+
+/// \ref htb_erase
+/// \brief Frees from memory all key-value pairs of a HashTable_s.
+void
+htb_erase(HashTable_t *table);
+
+/// \ref htb_erase_shallow
+/// \brief Frees from memory all nodes of a HashTable_s.
+void
+htb_erase_shallow(HashTable_t *table);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref htb_config
+/// \brief Sets new interfaces for the target hash table.
+void
+htb_config(HashTable_t *table, Interface_t *key_interface,
+           Interface_t *value_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref htb_count
+/// \brief Returns the amount of key-value pairs in the hash table.
+integer_t
+htb_count(HashTable_t *table);
+
+/// \ref htb_capacity
+/// \brief Returns the amount of buckets the hash table is rehashing into.
+integer_t
+htb_capacity(HashTable_t *table);
+
+/// \ref htb_max_load
+/// \brief Returns the maximum load factor, in percent, before rehashing.
+integer_t
+htb_max_load(HashTable_t *table);
+
+/// \ref htb_get
+/// \brief Returns the value associated with a key, or NULL if not found.
+void *
+htb_get(HashTable_t *table, void *key);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref htb_set_pool
+/// \brief Sets a node pool from where the hash table's nodes are allocated.
+bool
+htb_set_pool(HashTable_t *table, NodePool_t *pool);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref htb_insert
+/// \brief Inserts a new key mapped to a value in the hash table.
+bool
+htb_insert(HashTable_t *table, void *key, void *value);
+
+/// \ref htb_remove
+/// \brief Removes a given key from the table and retrieves its value.
+bool
+htb_remove(HashTable_t *table, void *key, void **value);
+
+/// \ref htb_pop
+/// \brief Removes a given key from the table and frees its key-value pair.
+bool
+htb_pop(HashTable_t *table, void *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref htb_empty
+/// \brief Returns true if the hash table is empty, otherwise false.
+bool
+htb_empty(HashTable_t *table);
+
+/// \ref htb_rehashing
+/// \brief Returns true if the hash table is in the middle of a rehash.
+bool
+htb_rehashing(HashTable_t *table);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref htb_contains_key
+/// \brief Returns true if the hash table contains a given key.
+bool
+htb_contains_key(HashTable_t *table, void *key);
+
+/// \ref htb_rehash_step
+/// \brief Moves up to a given amount of buckets to the new buffer.
+bool
+htb_rehash_step(HashTable_t *table, integer_t buckets);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref htb_display
+/// \brief Displays in the console a hash table.
+void
+htb_display(HashTable_t *table);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo HashTableIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo HashTableWrapper
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_HASHTABLE_H
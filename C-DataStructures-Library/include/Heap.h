@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_HEAP_H
 
 #include "Core.h"
+#include "CoreStats.h"
 #include "Interface.h"
 
 #ifdef __cplusplus
@@ -36,7 +37,7 @@ typedef struct Heap_s Heap_t;
 typedef struct Heap_s *Heap;
 
 /// \enum HeapKind_e
-/// \brief Defines an enum for the two kinds of a heap.
+/// \brief Defines an enum for the kinds of a heap.
 enum HeapKind_e
 {
     /// A max-heap. The parent element is greater than its children and root is
@@ -45,13 +46,25 @@ enum HeapKind_e
 
     /// A min-heap. The parent element is lesser than its children and root is
     /// the lowest element.
-    MinHeap = -1
+    MinHeap = -1,
+
+    /// A min-max heap. Nodes at even depths are lesser than everything below
+    /// them and nodes at odd depths are greater, so the root is the lowest
+    /// element and one of its children is the highest. Always binary.
+    MinMaxHeap = 2
 };
 
 /// \ref HeapKind
 /// \brief A type for <code> enum HeapKind_e </code>.
 typedef enum HeapKind_e HeapKind;
 
+/// \ref HeapHandle
+/// \brief Identifies an element inside a heap while it moves around.
+///
+/// A handle is valid from the moment it is returned by hep_insert_handle()
+/// until its element leaves the heap. Handles of removed elements are reused.
+typedef integer_t HeapHandle;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref hep_new
@@ -65,6 +78,12 @@ Heap_t *
 hep_create(Interface_t *interface, integer_t size, integer_t growth_rate,
            HeapKind kind);
 
+/// \ref hep_from_array
+/// \brief Builds a heap from a buffer of elements in linear time.
+Heap_t *
+hep_from_array(Interface_t *interface, void **buffer, integer_t length,
+               HeapKind kind);
+
 /// \ref hep_free
 /// \brief Frees from memory a Heap_s and its elements.
 void
@@ -109,16 +128,31 @@ hep_capacity(Heap_t *heap);
 integer_t
 hep_growth(Heap_t *heap);
 
+/// \ref hep_policy
+/// \brief Returns how the buffer grows.
+GrowthPolicy
+hep_policy(Heap_t *heap);
+
 /// \ref hep_locked
 /// \brief Returns true if the heap's buffer is locked, false otherwise.
 bool
 hep_locked(Heap_t *heap);
 
 /// \ref hep_kind
-/// \brief Returns if the heap is a MaxHeap or a MinHeap.
+/// \brief Returns if the heap is a MaxHeap, a MinHeap or a MinMaxHeap.
 HeapKind
 hep_kind(Heap_t *heap);
 
+/// \ref hep_arity
+/// \brief Returns the amount of children of each node.
+integer_t
+hep_arity(Heap_t *heap);
+
+/// \ref hep_stats
+/// \brief Copies the operation counters of the heap, if they are kept.
+bool
+hep_stats(Heap_t *heap, ContainerStats_t *stats);
+
 /////////////////////////////////////////////////////////////////// SETTERS ///
 
 /// \ref hep_set_growth
@@ -126,6 +160,11 @@ hep_kind(Heap_t *heap);
 bool
 hep_set_growth(Heap_t *heap, integer_t growth_rate);
 
+/// \ref hep_set_arity
+/// \brief Sets the amount of children of each node.
+bool
+hep_set_arity(Heap_t *heap, integer_t arity);
+
 /// \ref hep_capacity_lock
 /// \brief Locks the buffer's growth for the specified heap.
 void
@@ -136,6 +175,16 @@ hep_capacity_lock(Heap_t *heap);
 void
 hep_capacity_unlock(Heap_t *heap);
 
+/// \ref hep_set_policy
+/// \brief Sets how the buffer grows.
+bool
+hep_set_policy(Heap_t *heap, GrowthPolicy policy, integer_t step);
+
+/// \ref hep_set_shrink
+/// \brief Makes the buffer shrink automatically when it is mostly empty.
+void
+hep_set_shrink(Heap_t *heap, bool shrink);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref hep_insert
@@ -148,11 +197,51 @@ hep_insert(Heap_t *heap, void *element);
 bool
 hep_remove(Heap_t *heap, void **result);
 
+/// \ref hep_insert_all
+/// \brief Inserts a buffer of elements in the heap.
+bool
+hep_insert_all(Heap_t *heap, void **elements, integer_t size);
+
+/// \ref hep_remove_n
+/// \brief Removes up to a given amount of top elements from the heap.
+integer_t
+hep_remove_n(Heap_t *heap, integer_t amount, void **result);
+
+/// \ref hep_remove_min
+/// \brief Removes the lowest element from a MinHeap or a MinMaxHeap.
+bool
+hep_remove_min(Heap_t *heap, void **result);
+
+/// \ref hep_remove_max
+/// \brief Removes the highest element from a MaxHeap or a MinMaxHeap.
+bool
+hep_remove_max(Heap_t *heap, void **result);
+
+/// \ref hep_insert_handle
+/// \brief Inserts an element in the heap and returns a handle to it.
+bool
+hep_insert_handle(Heap_t *heap, void *element, HeapHandle *handle);
+
+/// \ref hep_remove_handle
+/// \brief Removes the element of a handle from the heap.
+bool
+hep_remove_handle(Heap_t *heap, HeapHandle handle, void **result);
+
 /// \ref hep_peek
 /// \brief Return the root element of the heap.
 void *
 hep_peek(Heap_t *heap);
 
+/// \ref hep_peek_min
+/// \brief Returns the lowest element of a MinHeap or a MinMaxHeap.
+void *
+hep_peek_min(Heap_t *heap);
+
+/// \ref hep_peek_max
+/// \brief Returns the highest element of a MaxHeap or a MinMaxHeap.
+void *
+hep_peek_max(Heap_t *heap);
+
 /////////////////////////////////////////////////////////// STRUCTURE STATE ///
 
 /// \ref hep_empty
@@ -172,6 +261,21 @@ hep_full(Heap_t *heap);
 bool
 hep_heapify(Heap_t *heap);
 
+/// \ref hep_update
+/// \brief Fixes the tree after the element of a handle is changed.
+bool
+hep_update(Heap_t *heap, HeapHandle handle);
+
+/// \ref hep_merge
+/// \brief Moves every element of a heap into another.
+bool
+hep_merge(Heap_t *heap1, Heap_t *heap2);
+
+/// \ref hep_handle_get
+/// \brief Returns the element of a handle.
+void *
+hep_handle_get(Heap_t *heap, HeapHandle handle);
+
 /// \ref hep_copy
 /// \brief Makes a copy of an existing heap.
 Heap_t *
@@ -182,12 +286,29 @@ hep_copy(Heap_t *heap);
 Heap_t *
 hep_copy_shallow(Heap_t *heap);
 
+/// \ref hep_to_array_move
+/// \brief Moves the elements of the heap to a C array.
+void **
+hep_to_array_move(Heap_t *heap, integer_t *length);
+
+/// \ref hep_save
+/// \brief Writes the heap to a stream.
+bool
+hep_save(Heap_t *heap, FILE *stream);
+
+/// \ref hep_restore
+/// \brief Reads back a heap written by hep_save().
+Heap_t *
+hep_restore(Interface_t *interface, FILE *stream);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref hep_display
 /// \brief Displays a Heap_s in the console.
 void
 hep_display(Heap_t *heap, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
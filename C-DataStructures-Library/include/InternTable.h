@@ -0,0 +1,90 @@
+/**
+ * @file InternTable.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_INTERNTABLE_H
+#define C_DATASTRUCTURES_LIBRARY_INTERNTABLE_H
+
+#include "Core.h"
+#include "Arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct InternTable_s
+/// \brief A set of strings that hands out one canonical copy of each.
+struct InternTable_s;
+
+/// \ref InternTable_t
+/// \brief A type for an intern table.
+///
+/// A type for a <code> struct InternTable_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct InternTable_s InternTable_t;
+
+/// \ref InternTable
+/// \brief A pointer type for an intern table.
+///
+/// Defines a pointer type to <code> struct InternTable_s </code>. This
+/// typedef is used to avoid having to declare every intern table as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct InternTable_s *InternTable;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref itn_new
+/// \brief Initializes a new intern table that keeps its strings in an arena.
+InternTable_t *
+itn_new(Arena_t *arena);
+
+/// \ref itn_free
+/// \brief Frees from memory an InternTable_s.
+void
+itn_free(InternTable_t *table);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref itn_count
+/// \brief Returns the amount of strings interned.
+integer_t
+itn_count(InternTable_t *table);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref itn_intern
+/// \brief Returns the canonical copy of a string, adding it if needed.
+const char *
+itn_intern(InternTable_t *table, const char *string);
+
+/// \ref itn_lookup
+/// \brief Returns the canonical copy of a string, or NULL if there is none.
+const char *
+itn_lookup(InternTable_t *table, const char *string);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref itn_length
+/// \brief Returns the length of an interned string in constant time.
+integer_t
+itn_length(const char *interned);
+
+/// \ref itn_hash
+/// \brief Returns the hash of an interned string, computed when interned.
+unsigned_t
+itn_hash(const void *interned);
+
+/// \ref itn_compare
+/// \brief Compares two interned strings, equal ones in constant time.
+int
+itn_compare(const void *interned1, const void *interned2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_INTERNTABLE_H
@@ -0,0 +1,152 @@
+/**
+ * @file IntrusiveAVLTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_INTRUSIVEAVLTREE_H
+#define C_DATASTRUCTURES_LIBRARY_INTRUSIVEAVLTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A link embedded in the elements of an IntrusiveAVLTree_s.
+///
+/// Every element that can be in the tree has one of these as a member. Its
+/// fields must not be changed by the user.
+struct AVLHook_s
+{
+    /// \brief Parent hook or NULL if it is the root.
+    struct AVLHook_s *parent;
+
+    /// \brief Left child hook.
+    struct AVLHook_s *left;
+
+    /// \brief Right child hook.
+    struct AVLHook_s *right;
+
+    /// \brief Height of the subtree rooted at this hook.
+    int8_t height;
+};
+
+/// \ref AVLHook_t
+/// \brief A type for an AVL tree hook.
+typedef struct AVLHook_s AVLHook_t;
+
+/// \brief An AVL tree that links the elements through an AVLHook_s inside
+/// of them.
+///
+/// The tree never allocates memory and never frees its elements. It can be
+/// declared as a global, on the stack or inside another structure, and has to
+/// be initialized with iav_init(). Duplicates are rejected. Its fields must
+/// not be changed by the user.
+struct IntrusiveAVLTree_s
+{
+    /// \brief Root hook.
+    struct AVLHook_s *root;
+
+    /// \brief Amount of elements in the tree.
+    integer_t count;
+
+    /// \brief Offset of the hook inside the elements.
+    size_t offset;
+
+    /// \brief Compares two elements.
+    compare_f compare;
+};
+
+/// \ref IntrusiveAVLTree_t
+/// \brief A type for an intrusive AVL tree.
+typedef struct IntrusiveAVLTree_s IntrusiveAVLTree_t;
+
+/// \ref IntrusiveAVLTree
+/// \brief A pointer type for an intrusive AVL tree.
+typedef struct IntrusiveAVLTree_s *IntrusiveAVLTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref iav_init
+/// \brief Initializes an empty intrusive AVL tree.
+void
+iav_init(IntrusiveAVLTree_t *tree, size_t offset, compare_f compare);
+
+/// \ref iav_clear
+/// \brief Unlinks every element from the tree.
+void
+iav_clear(IntrusiveAVLTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref iav_count
+/// \brief Returns the amount of elements in the tree.
+integer_t
+iav_count(IntrusiveAVLTree_t *tree);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref iav_insert
+/// \brief Links an element to the tree.
+bool
+iav_insert(IntrusiveAVLTree_t *tree, void *element);
+
+/// \ref iav_remove
+/// \brief Unlinks an element from the tree.
+void
+iav_remove(IntrusiveAVLTree_t *tree, void *element);
+
+/// \ref iav_remove_min
+/// \brief Unlinks and returns the smallest element of the tree.
+void *
+iav_remove_min(IntrusiveAVLTree_t *tree);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref iav_empty
+/// \brief Checks if the tree is empty.
+bool
+iav_empty(IntrusiveAVLTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref iav_search
+/// \brief Returns the element equal to a key.
+void *
+iav_search(IntrusiveAVLTree_t *tree, const void *key);
+
+/// \ref iav_lower_bound
+/// \brief Returns the first element greater than or equal to a key.
+void *
+iav_lower_bound(IntrusiveAVLTree_t *tree, const void *key);
+
+/// \ref iav_min
+/// \brief Returns the smallest element of the tree.
+void *
+iav_min(IntrusiveAVLTree_t *tree);
+
+/// \ref iav_max
+/// \brief Returns the greatest element of the tree.
+void *
+iav_max(IntrusiveAVLTree_t *tree);
+
+/// \ref iav_next
+/// \brief Returns the element after another one.
+void *
+iav_next(IntrusiveAVLTree_t *tree, void *element);
+
+/// \ref iav_prev
+/// \brief Returns the element before another one.
+void *
+iav_prev(IntrusiveAVLTree_t *tree, void *element);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_INTRUSIVEAVLTREE_H
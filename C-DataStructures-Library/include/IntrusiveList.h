@@ -0,0 +1,177 @@
+/**
+ * @file IntrusiveList.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_INTRUSIVELIST_H
+#define C_DATASTRUCTURES_LIBRARY_INTRUSIVELIST_H
+
+#include "Core.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A link embedded in the elements of an IntrusiveList_s.
+///
+/// Every element that can be in the list has one of these as a member. Its
+/// fields must not be changed by the user. Zero initialize it before the
+/// element is inserted for the first time so ilt_linked() works.
+struct ListHook_s
+{
+    /// \brief Next hook or the list's head.
+    struct ListHook_s *next;
+
+    /// \brief Previous hook or the list's head.
+    struct ListHook_s *prev;
+};
+
+/// \ref ListHook_t
+/// \brief A type for a list hook.
+typedef struct ListHook_s ListHook_t;
+
+/// \brief A doubly-linked list that links the elements through a ListHook_s
+/// inside of them.
+///
+/// The list never allocates memory and never frees its elements. It can be
+/// declared as a global, on the stack or inside another structure, and has to
+/// be initialized with ilt_init(). Its fields must not be changed by the user.
+struct IntrusiveList_s
+{
+    /// \brief Sentinel hook.
+    ///
+    /// The list is circular: head.next is the first hook and head.prev is
+    /// the last one. Both point to the head itself if the list is empty.
+    struct ListHook_s head;
+
+    /// \brief Amount of elements in the list.
+    integer_t count;
+
+    /// \brief Offset of the hook inside the elements.
+    size_t offset;
+};
+
+/// \ref IntrusiveList_t
+/// \brief A type for an intrusive list.
+typedef struct IntrusiveList_s IntrusiveList_t;
+
+/// \ref IntrusiveList
+/// \brief A pointer type for an intrusive list.
+typedef struct IntrusiveList_s *IntrusiveList;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref ilt_init
+/// \brief Initializes an empty intrusive list.
+void
+ilt_init(IntrusiveList_t *list, size_t offset);
+
+/// \ref ilt_clear
+/// \brief Unlinks every element from the list.
+void
+ilt_clear(IntrusiveList_t *list);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref ilt_count
+/// \brief Returns the amount of elements in the list.
+integer_t
+ilt_count(IntrusiveList_t *list);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref ilt_insert_head
+/// \brief Links an element at the start of the list.
+void
+ilt_insert_head(IntrusiveList_t *list, void *element);
+
+/// \ref ilt_insert_tail
+/// \brief Links an element at the end of the list.
+void
+ilt_insert_tail(IntrusiveList_t *list, void *element);
+
+/// \ref ilt_insert_before
+/// \brief Links an element before another element of the list.
+void
+ilt_insert_before(IntrusiveList_t *list, void *position, void *element);
+
+/// \ref ilt_insert_after
+/// \brief Links an element after another element of the list.
+void
+ilt_insert_after(IntrusiveList_t *list, void *position, void *element);
+
+/// \ref ilt_remove
+/// \brief Unlinks an element from the list.
+void
+ilt_remove(IntrusiveList_t *list, void *element);
+
+/// \ref ilt_remove_head
+/// \brief Unlinks and returns the first element of the list.
+void *
+ilt_remove_head(IntrusiveList_t *list);
+
+/// \ref ilt_remove_tail
+/// \brief Unlinks and returns the last element of the list.
+void *
+ilt_remove_tail(IntrusiveList_t *list);
+
+/// \ref ilt_move_head
+/// \brief Moves an element of the list to its start.
+void
+ilt_move_head(IntrusiveList_t *list, void *element);
+
+/// \ref ilt_move_tail
+/// \brief Moves an element of the list to its end.
+void
+ilt_move_tail(IntrusiveList_t *list, void *element);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref ilt_empty
+/// \brief Checks if the list is empty.
+bool
+ilt_empty(IntrusiveList_t *list);
+
+/// \ref ilt_linked
+/// \brief Checks if an element is in a list.
+bool
+ilt_linked(IntrusiveList_t *list, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref ilt_head
+/// \brief Returns the first element of the list.
+void *
+ilt_head(IntrusiveList_t *list);
+
+/// \ref ilt_tail
+/// \brief Returns the last element of the list.
+void *
+ilt_tail(IntrusiveList_t *list);
+
+/// \ref ilt_next
+/// \brief Returns the element after another one.
+void *
+ilt_next(IntrusiveList_t *list, void *element);
+
+/// \ref ilt_prev
+/// \brief Returns the element before another one.
+void *
+ilt_prev(IntrusiveList_t *list, void *element);
+
+/////////////////////////////////////////////////////////////////// LINKING ///
+
+/// \ref ilt_append
+/// \brief Moves every element of list2 to the end of list1.
+void
+ilt_append(IntrusiveList_t *list1, IntrusiveList_t *list2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_INTRUSIVELIST_H
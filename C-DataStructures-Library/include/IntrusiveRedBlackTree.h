@@ -0,0 +1,152 @@
+/**
+ * @file IntrusiveRedBlackTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_INTRUSIVEREDBLACKTREE_H
+#define C_DATASTRUCTURES_LIBRARY_INTRUSIVEREDBLACKTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A link embedded in the elements of an IntrusiveRedBlackTree_s.
+///
+/// Every element that can be in the tree has one of these as a member. Its
+/// fields must not be changed by the user.
+struct RBHook_s
+{
+    /// \brief Parent hook or NULL if it is the root.
+    struct RBHook_s *parent;
+
+    /// \brief Left child hook.
+    struct RBHook_s *left;
+
+    /// \brief Right child hook.
+    struct RBHook_s *right;
+
+    /// \brief Hook color. True if red.
+    bool red;
+};
+
+/// \ref RBHook_t
+/// \brief A type for a red-black tree hook.
+typedef struct RBHook_s RBHook_t;
+
+/// \brief A red-black tree that links the elements through a RBHook_s inside
+/// of them.
+///
+/// The tree never allocates memory and never frees its elements. It can be
+/// declared as a global, on the stack or inside another structure, and has to
+/// be initialized with irb_init(). Duplicates are rejected. Its fields must
+/// not be changed by the user.
+struct IntrusiveRedBlackTree_s
+{
+    /// \brief Root hook.
+    struct RBHook_s *root;
+
+    /// \brief Amount of elements in the tree.
+    integer_t count;
+
+    /// \brief Offset of the hook inside the elements.
+    size_t offset;
+
+    /// \brief Compares two elements.
+    compare_f compare;
+};
+
+/// \ref IntrusiveRedBlackTree_t
+/// \brief A type for an intrusive red-black tree.
+typedef struct IntrusiveRedBlackTree_s IntrusiveRedBlackTree_t;
+
+/// \ref IntrusiveRedBlackTree
+/// \brief A pointer type for an intrusive red-black tree.
+typedef struct IntrusiveRedBlackTree_s *IntrusiveRedBlackTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref irb_init
+/// \brief Initializes an empty intrusive red-black tree.
+void
+irb_init(IntrusiveRedBlackTree_t *tree, size_t offset, compare_f compare);
+
+/// \ref irb_clear
+/// \brief Unlinks every element from the tree.
+void
+irb_clear(IntrusiveRedBlackTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref irb_count
+/// \brief Returns the amount of elements in the tree.
+integer_t
+irb_count(IntrusiveRedBlackTree_t *tree);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref irb_insert
+/// \brief Links an element to the tree.
+bool
+irb_insert(IntrusiveRedBlackTree_t *tree, void *element);
+
+/// \ref irb_remove
+/// \brief Unlinks an element from the tree.
+void
+irb_remove(IntrusiveRedBlackTree_t *tree, void *element);
+
+/// \ref irb_remove_min
+/// \brief Unlinks and returns the smallest element of the tree.
+void *
+irb_remove_min(IntrusiveRedBlackTree_t *tree);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref irb_empty
+/// \brief Checks if the tree is empty.
+bool
+irb_empty(IntrusiveRedBlackTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref irb_search
+/// \brief Returns the element equal to a key.
+void *
+irb_search(IntrusiveRedBlackTree_t *tree, const void *key);
+
+/// \ref irb_lower_bound
+/// \brief Returns the first element greater than or equal to a key.
+void *
+irb_lower_bound(IntrusiveRedBlackTree_t *tree, const void *key);
+
+/// \ref irb_min
+/// \brief Returns the smallest element of the tree.
+void *
+irb_min(IntrusiveRedBlackTree_t *tree);
+
+/// \ref irb_max
+/// \brief Returns the greatest element of the tree.
+void *
+irb_max(IntrusiveRedBlackTree_t *tree);
+
+/// \ref irb_next
+/// \brief Returns the element after another one.
+void *
+irb_next(IntrusiveRedBlackTree_t *tree, void *element);
+
+/// \ref irb_prev
+/// \brief Returns the element before another one.
+void *
+irb_prev(IntrusiveRedBlackTree_t *tree, void *element);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_INTRUSIVEREDBLACKTREE_H
@@ -0,0 +1,109 @@
+/**
+ * @file NodePool.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
+#define C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct NodePool_s
+/// \brief A slab allocator of fixed-size nodes.
+struct NodePool_s;
+
+/// \ref NodePool_t
+/// \brief A type for a node pool.
+///
+/// A type for a <code> struct NodePool_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct NodePool_s NodePool_t;
+
+/// \ref NodePool
+/// \brief A pointer type for a node pool.
+///
+/// Defines a pointer type to <code> struct NodePool_s </code>. This typedef
+/// is used to avoid having to declare every node pool as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct NodePool_s *NodePool;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref npl_new
+/// \brief Initializes a new node pool for nodes of a given size.
+NodePool_t *
+npl_new(size_t node_size, integer_t slab_nodes);
+
+/// \ref npl_free
+/// \brief Frees from memory a node pool and all of its slabs.
+void
+npl_free(NodePool_t *pool);
+
+/// \ref npl_reset
+/// \brief Returns every node to the pool at once, keeping its slabs.
+void
+npl_reset(NodePool_t *pool);
+
+/// \ref npl_shrink
+/// \brief Frees all slabs of a pool that has no nodes in use.
+bool
+npl_shrink(NodePool_t *pool);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref npl_node_size
+/// \brief Returns the size of each node handed out by the pool.
+size_t
+npl_node_size(NodePool_t *pool);
+
+/// \ref npl_in_use
+/// \brief Returns the amount of nodes currently handed out by the pool.
+integer_t
+npl_in_use(NodePool_t *pool);
+
+/// \ref npl_capacity
+/// \brief Returns the total amount of nodes in all slabs of the pool.
+integer_t
+npl_capacity(NodePool_t *pool);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref npl_alloc
+/// \brief Takes a node from the pool.
+void *
+npl_alloc(NodePool_t *pool);
+
+/// \ref npl_release
+/// \brief Gives a node back to the pool.
+void
+npl_release(NodePool_t *pool, void *node);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref npl_node_alloc
+/// \brief Takes a node from a pool or from malloc() if there is no pool.
+void *
+npl_node_alloc(NodePool_t *pool, size_t size);
+
+/// \ref npl_node_free
+/// \brief Gives a node back to a pool or to free() if there is no pool.
+void
+npl_node_free(NodePool_t *pool, void *node);
+
+/// \ref npl_fits
+/// \brief Returns true if a pool can hand out nodes of a given size.
+bool
+npl_fits(NodePool_t *pool, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
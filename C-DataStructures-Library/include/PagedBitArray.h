@@ -0,0 +1,146 @@
+/**
+ * @file PagedBitArray.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_PAGEDBITARRAY_H
+#define C_DATASTRUCTURES_LIBRARY_PAGEDBITARRAY_H
+
+#include "Core.h"
+#include "BitArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct PagedBitArray_s
+/// \brief A huge bit array whose pages are only allocated when written.
+struct PagedBitArray_s;
+
+/// \ref PagedBitArray_t
+/// \brief A type for a paged bit array.
+///
+/// A type for a <code> struct PagedBitArray_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct PagedBitArray_s PagedBitArray_t;
+
+/// \ref PagedBitArray
+/// \brief A pointer type for a paged bit array.
+///
+/// Defines a pointer type to <code> struct PagedBitArray_s </code>. This
+/// typedef is used to avoid having to declare every paged bit array as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct PagedBitArray_s *PagedBitArray;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref pba_create
+/// \brief Creates a paged bit array that addresses a given amount of bits.
+PagedBitArray_t *
+pba_create(unsigned_t required_bits);
+
+/// \ref pba_free
+/// \brief Frees from memory the specified paged bit array.
+void
+pba_free(PagedBitArray_t *bits);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref pba_nbits
+/// \brief Returns the amount of addressable bits.
+unsigned_t
+pba_nbits(PagedBitArray_t *bits);
+
+/// \ref pba_pages
+/// \brief Returns the amount of allocated pages.
+unsigned_t
+pba_pages(PagedBitArray_t *bits);
+
+/// \ref pba_bytes
+/// \brief Returns the amount of memory used by the paged bit array.
+unsigned_t
+pba_bytes(PagedBitArray_t *bits);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref pba_set
+/// \brief Sets to true a bit at a given bit index.
+bool
+pba_set(PagedBitArray_t *bits, unsigned_t bit_index);
+
+/// \ref pba_set_range
+/// \brief Sets to true a given range of bits.
+bool
+pba_set_range(PagedBitArray_t *bits, unsigned_t from_index,
+              unsigned_t to_index);
+
+/// \ref pba_clear
+/// \brief Sets to false a bit at a given bit index.
+bool
+pba_clear(PagedBitArray_t *bits, unsigned_t bit_index);
+
+/// \ref pba_clear_range
+/// \brief Sets to false a given range of bits.
+bool
+pba_clear_range(PagedBitArray_t *bits, unsigned_t from_index,
+                unsigned_t to_index);
+
+/// \ref pba_flip
+/// \brief Flips the state of a bit at a given bit index.
+bool
+pba_flip(PagedBitArray_t *bits, unsigned_t bit_index);
+
+/// \ref pba_put
+/// \brief Sets a bit at a given bit index to a given state.
+bool
+pba_put(PagedBitArray_t *bits, unsigned_t bit_index, bool state);
+
+/// \ref pba_empty
+/// \brief Sets to false every bit, freeing every page.
+void
+pba_empty(PagedBitArray_t *bits);
+
+/// \ref pba_get
+/// \brief Retrieves the state of a bit at a given bit index.
+bool
+pba_get(PagedBitArray_t *bits, unsigned_t bit_index);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref pba_cardinality
+/// \brief Returns the amount of set bits.
+unsigned_t
+pba_cardinality(PagedBitArray_t *bits);
+
+/// \ref pba_read_bitarray
+/// \brief Makes a BitArray_s with the bits of a given range.
+BitArray_t *
+pba_read_bitarray(PagedBitArray_t *bits, unsigned_t from_index,
+                  unsigned_t to_index);
+
+/// \ref pba_write_bitarray
+/// \brief Replaces a range of bits with the bits of a BitArray_s.
+bool
+pba_write_bitarray(PagedBitArray_t *bits, BitArray_t *source,
+                   unsigned_t offset);
+
+///////////////////////////////////////////////////////// SEARCH OPERATIONS ///
+
+/// \ref pba_next_set
+/// \brief Returns the index of the nearest set bit on or after an index.
+unsigned_t
+pba_next_set(PagedBitArray_t *bits, unsigned_t bit_index);
+
+/// \ref pba_next_clear
+/// \brief Returns the index of the nearest clear bit on or after an index.
+unsigned_t
+pba_next_clear(PagedBitArray_t *bits, unsigned_t bit_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_PAGEDBITARRAY_H
@@ -11,11 +11,34 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/// \brief How a PriorityList_s stores its elements.
+enum PriorityListEngine_e
+{
+    /// A sorted linked list. Insertions take O(n) and removals take O(1).
+    /// Elements with the same priority are removed in insertion order.
+    PLI_SORTED = 0,
+
+    /// A pairing heap. Insertions and merges take O(1) and removals take
+    /// amortized O(log n).
+    PLI_PAIRING = 1,
+
+    /// A radix heap for monotone integer priorities given by a \ref key_f.
+    /// The element with the smallest key is removed first and no element can
+    /// have a key smaller than the last key removed. Insertions take O(1) and
+    /// removals take amortized O(log C), where C is the largest key.
+    PLI_RADIX = 2
+};
+
+/// \ref PriorityListEngine
+/// \brief A type for a priority list engine.
+typedef enum PriorityListEngine_e PriorityListEngine;
+
 /// \struct PriorityList_s
 /// \brief A generic, linked list based priority queue.
 struct PriorityList_s;
@@ -42,6 +65,11 @@ typedef struct PriorityList_s *PriorityList;
 PriorityList_t *
 pli_new(Interface_t *interface);
 
+/// \ref pli_create
+/// \brief Initializes a new priority list with a given engine.
+PriorityList_t *
+pli_create(Interface_t *interface, PriorityListEngine engine, key_f key);
+
 /// \ref pli_free
 /// \brief Frees from memory a PriorityList_s and its elements.
 void
@@ -81,6 +109,11 @@ pli_count(PriorityList_t *plist);
 integer_t
 pli_limit(PriorityList_t *plist);
 
+/// \ref pli_engine
+/// \brief Returns the engine of the priority list.
+PriorityListEngine
+pli_engine(PriorityList_t *plist);
+
 /////////////////////////////////////////////////////////////////// SETTERS ///
 
 /// \ref pli_set_limit
@@ -88,6 +121,11 @@ pli_limit(PriorityList_t *plist);
 bool
 pli_set_limit(PriorityList_t *plist, integer_t limit);
 
+/// \ref pli_set_pool
+/// \brief Sets a node pool from where the priority list's nodes are allocated.
+bool
+pli_set_pool(PriorityList_t *plist, NodePool_t *pool);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref pli_insert
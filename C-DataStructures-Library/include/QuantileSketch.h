@@ -0,0 +1,113 @@
+/**
+ * @file QuantileSketch.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_QUANTILESKETCH_H
+#define C_DATASTRUCTURES_LIBRARY_QUANTILESKETCH_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct QuantileSketch_s
+/// \brief Estimates the quantiles of a stream of numbers in bounded memory.
+struct QuantileSketch_s;
+
+/// \ref QuantileSketch_t
+/// \brief A type for a quantile sketch.
+///
+/// A type for a <code> struct QuantileSketch_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct QuantileSketch_s QuantileSketch_t;
+
+/// \ref QuantileSketch
+/// \brief A pointer type for a quantile sketch.
+///
+/// Defines a pointer type to <code> struct QuantileSketch_s </code>. This
+/// typedef is used to avoid having to declare every quantile sketch as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct QuantileSketch_s *QuantileSketch;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref qsk_new
+/// \brief Creates a quantile sketch with a given accuracy parameter.
+QuantileSketch_t *
+qsk_new(integer_t k);
+
+/// \ref qsk_free
+/// \brief Frees from memory the specified quantile sketch.
+void
+qsk_free(QuantileSketch_t *sketch);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref qsk_k
+/// \brief Returns the accuracy parameter of the quantile sketch.
+integer_t
+qsk_k(QuantileSketch_t *sketch);
+
+/// \ref qsk_count
+/// \brief Returns the amount of values inserted.
+unsigned_t
+qsk_count(QuantileSketch_t *sketch);
+
+/// \ref qsk_retained
+/// \brief Returns the amount of values kept by the quantile sketch.
+integer_t
+qsk_retained(QuantileSketch_t *sketch);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref qsk_insert
+/// \brief Adds a value to the quantile sketch.
+bool
+qsk_insert(QuantileSketch_t *sketch, double value);
+
+/// \ref qsk_quantile
+/// \brief Estimates the value at a given quantile.
+bool
+qsk_quantile(QuantileSketch_t *sketch, double quantile, double *result);
+
+/// \ref qsk_rank
+/// \brief Estimates the fraction of values lower or equal to a given one.
+double
+qsk_rank(QuantileSketch_t *sketch, double value);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref qsk_empty
+/// \brief Returns true if no values were inserted.
+bool
+qsk_empty(QuantileSketch_t *sketch);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref qsk_erase
+/// \brief Removes every value from the quantile sketch.
+void
+qsk_erase(QuantileSketch_t *sketch);
+
+/// \ref qsk_merge
+/// \brief Adds to a quantile sketch the values of another one.
+bool
+qsk_merge(QuantileSketch_t *sketch1, QuantileSketch_t *sketch2);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref qsk_display
+/// \brief Displays the parameters of the quantile sketch in the console.
+void
+qsk_display(QuantileSketch_t *sketch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_QUANTILESKETCH_H
@@ -102,6 +102,11 @@ qar_capacity(QueueArray_t *queue);
 integer_t
 qar_growth(QueueArray_t *queue);
 
+/// \ref qar_policy
+/// \brief Returns how the buffer grows.
+GrowthPolicy
+qar_policy(QueueArray_t *queue);
+
 /// \ref qar_locked
 /// \brief Returns true if the queue's buffer is locked, false otherwise.
 bool
@@ -124,6 +129,31 @@ qar_capacity_lock(QueueArray_t *queue);
 void
 qar_capacity_unlock(QueueArray_t *queue);
 
+/// \ref qar_set_segmented
+/// \brief Makes the buffer grow by linking segments instead of reallocating.
+void
+qar_set_segmented(QueueArray_t *queue, bool segmented);
+
+/// \ref qar_set_shrink
+/// \brief Makes the buffer shrink automatically when it is mostly empty.
+void
+qar_set_shrink(QueueArray_t *queue, bool shrink);
+
+/// \ref qar_set_policy
+/// \brief Sets how the buffer grows.
+bool
+qar_set_policy(QueueArray_t *queue, GrowthPolicy policy, integer_t step);
+
+/// \ref qar_reserve
+/// \brief Grows the buffer to hold a given amount of elements.
+bool
+qar_reserve(QueueArray_t *queue, integer_t capacity);
+
+/// \ref qar_shrink_to_fit
+/// \brief Shrinks the buffer to the amount of elements in the queue.
+bool
+qar_shrink_to_fit(QueueArray_t *queue);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref qar_enqueue
@@ -136,6 +166,16 @@ qar_enqueue(QueueArray_t *queue, void *element);
 bool
 qar_dequeue(QueueArray_t *queue, void **result);
 
+/// \ref qar_enqueue_n
+/// \brief Adds a buffer of elements to the specified queue.
+bool
+qar_enqueue_n(QueueArray_t *queue, void **elements, integer_t size);
+
+/// \ref qar_dequeue_n
+/// \brief Removes up to a given amount of elements from the specified queue.
+integer_t
+qar_dequeue_n(QueueArray_t *queue, void **result, integer_t max);
+
 /// \ref qar_peek_front
 /// \brief Returns the oldest element in the specified queue.
 void *
@@ -196,12 +236,24 @@ qar_append(QueueArray_t *queue1, QueueArray_t *queue2);
 void **
 qar_to_array(QueueArray_t *queue, integer_t *length);
 
+/// \ref qar_to_array_move
+/// \brief Moves the elements of the queue to a C array.
+void **
+qar_to_array_move(QueueArray_t *queue, integer_t *length);
+
+/// \ref qar_span
+/// \brief Gives direct access to contiguous elements of the queue.
+integer_t
+qar_span(QueueArray_t *queue, integer_t position, void ***span);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref qar_display
 /// \brief Displays a QueueArray_s in the console.
 void
 qar_display(QueueArray_t *queue, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
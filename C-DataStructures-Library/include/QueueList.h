@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -85,6 +86,11 @@ qli_config(QueueList_t *queue, Interface_t *new_interface);
 integer_t
 qli_count(QueueList_t *queue);
 
+/// \ref qli_chunk
+/// \brief Returns how many elements each node of the queue holds.
+integer_t
+qli_chunk(QueueList_t *queue);
+
 /// \ref qli_limit
 /// \brief Returns the current queue limit.
 integer_t
@@ -97,6 +103,16 @@ qli_limit(QueueList_t *queue);
 bool
 qli_set_limit(QueueList_t *queue, integer_t limit);
 
+/// \ref qli_set_pool
+/// \brief Sets a node pool from where the queue's nodes are allocated.
+bool
+qli_set_pool(QueueList_t *queue, NodePool_t *pool);
+
+/// \ref qli_set_chunk
+/// \brief Sets how many elements each node of the queue holds.
+bool
+qli_set_chunk(QueueList_t *queue, integer_t chunk);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref qli_enqueue
@@ -169,12 +185,19 @@ qli_append(QueueList_t *queue1, QueueList_t *queue2);
 void **
 qli_to_array(QueueList_t *queue, integer_t *length);
 
+/// \ref qli_to_array_move
+/// \brief Moves the elements of the queue to a C array.
+void **
+qli_to_array_move(QueueList_t *queue, integer_t *length);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref qli_display
 /// \brief Displays a QueueList_s in the console.
 void
 qli_display(QueueList_t *queue, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
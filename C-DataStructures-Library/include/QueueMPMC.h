@@ -0,0 +1,104 @@
+/**
+ * @file QueueMPMC.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_QUEUEMPMC_H
+#define C_DATASTRUCTURES_LIBRARY_QUEUEMPMC_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct QueueMPMC_s
+/// \brief A lock-free bounded multi-producer multi-consumer queue.
+struct QueueMPMC_s;
+
+/// \ref QueueMPMC_t
+/// \brief A type for a bounded multi-producer multi-consumer queue.
+///
+/// A type for a <code> struct QueueMPMC_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct QueueMPMC_s QueueMPMC_t;
+
+/// \ref QueueMPMC
+/// \brief A pointer type for a bounded multi-producer multi-consumer queue.
+///
+/// A pointer type to <code> struct QueueMPMC_s </code>. This typedef is used
+/// to avoid having to declare every queue as a pointer type since they all
+/// must be dynamically allocated.
+typedef struct QueueMPMC_s *QueueMPMC;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref qmp_new
+/// \brief Initializes a new QueueMPMC_s with a fixed capacity.
+QueueMPMC_t *
+qmp_new(integer_t capacity);
+
+/// \ref qmp_free
+/// \brief Frees from memory a QueueMPMC_s leaving its elements intact.
+void
+qmp_free(QueueMPMC_t *queue);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref qmp_capacity
+/// \brief Returns the maximum amount of elements in the queue.
+integer_t
+qmp_capacity(QueueMPMC_t *queue);
+
+/// \ref qmp_count
+/// \brief Returns an approximation of the amount of elements in the queue.
+integer_t
+qmp_count(QueueMPMC_t *queue);
+
+/// \ref qmp_retries
+/// \brief Returns how many times a thread had to retry claiming a position.
+unsigned_t
+qmp_retries(QueueMPMC_t *queue);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref qmp_try_enqueue
+/// \brief Inserts an element at the back of the queue if it is not full.
+bool
+qmp_try_enqueue(QueueMPMC_t *queue, void *element);
+
+/// \ref qmp_try_dequeue
+/// \brief Removes an element from the front of the queue if it is not empty.
+bool
+qmp_try_dequeue(QueueMPMC_t *queue, void **result);
+
+/// \ref qmp_enqueue_batch
+/// \brief Inserts as many elements of a buffer as there is space for.
+integer_t
+qmp_enqueue_batch(QueueMPMC_t *queue, void **elements, integer_t count);
+
+/// \ref qmp_dequeue_batch
+/// \brief Removes up to a given amount of elements into a buffer.
+integer_t
+qmp_dequeue_batch(QueueMPMC_t *queue, void **results, integer_t count);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref qmp_empty
+/// \brief Returns true if the queue appears to be empty.
+bool
+qmp_empty(QueueMPMC_t *queue);
+
+/// \ref qmp_full
+/// \brief Returns true if the queue appears to be full.
+bool
+qmp_full(QueueMPMC_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_QUEUEMPMC_H
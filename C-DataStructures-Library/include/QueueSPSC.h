@@ -0,0 +1,100 @@
+/**
+ * @file QueueSPSC.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_QUEUESPSC_H
+#define C_DATASTRUCTURES_LIBRARY_QUEUESPSC_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct QueueSPSC_s
+/// \brief A wait-free single-producer single-consumer ring buffer.
+struct QueueSPSC_s;
+
+/// \ref QueueSPSC_t
+/// \brief A type for a fixed-capacity single-producer single-consumer queue.
+///
+/// A type for a <code> struct QueueSPSC_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct QueueSPSC_s QueueSPSC_t;
+
+/// \ref QueueSPSC
+/// \brief A pointer type for a fixed-capacity single-producer single-consumer
+/// queue.
+///
+/// A pointer type to <code> struct QueueSPSC_s </code>. This typedef is used
+/// to avoid having to declare every queue as a pointer type since they all
+/// must be dynamically allocated.
+typedef struct QueueSPSC_s *QueueSPSC;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref qsp_new
+/// \brief Initializes a new QueueSPSC_s with a fixed capacity.
+QueueSPSC_t *
+qsp_new(integer_t capacity);
+
+/// \ref qsp_free
+/// \brief Frees from memory a QueueSPSC_s leaving its elements intact.
+void
+qsp_free(QueueSPSC_t *queue);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref qsp_capacity
+/// \brief Returns the maximum amount of elements in the queue.
+integer_t
+qsp_capacity(QueueSPSC_t *queue);
+
+/// \ref qsp_count
+/// \brief Returns an approximation of the amount of elements in the queue.
+integer_t
+qsp_count(QueueSPSC_t *queue);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref qsp_try_enqueue
+/// \brief Inserts an element at the back of the queue if it is not full.
+bool
+qsp_try_enqueue(QueueSPSC_t *queue, void *element);
+
+/// \ref qsp_try_dequeue
+/// \brief Removes an element from the front of the queue if it is not empty.
+bool
+qsp_try_dequeue(QueueSPSC_t *queue, void **result);
+
+/// \ref qsp_enqueue_batch
+/// \brief Inserts as many elements of a buffer as there is space for.
+integer_t
+qsp_enqueue_batch(QueueSPSC_t *queue, void **elements, integer_t count);
+
+/// \ref qsp_dequeue_batch
+/// \brief Removes up to a given amount of elements into a buffer.
+integer_t
+qsp_dequeue_batch(QueueSPSC_t *queue, void **results, integer_t count);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref qsp_empty
+/// \brief Returns true if the queue appears to be empty.
+bool
+qsp_empty(QueueSPSC_t *queue);
+
+/// \ref qsp_full
+/// \brief Returns true if the queue appears to be full.
+bool
+qsp_full(QueueSPSC_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_QUEUESPSC_H
@@ -10,7 +10,9 @@
 #define C_DATASTRUCTURES_LIBRARY_REDBLACKTREE_H
 
 #include "Core.h"
+#include "CoreStats.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +44,12 @@ typedef struct RedBlackTree_s *RedBlackTree;
 RedBlackTree_t *
 rbt_new(Interface_t *interface);
 
+/// \ref rbt_from_sorted_array
+/// \brief Builds a balanced red-black tree from a buffer of sorted elements.
+RedBlackTree_t *
+rbt_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size);
+
 /// \ref rbt_free
 /// \brief Frees from memory a RedBlackTree_s and its elements.
 void
@@ -81,6 +89,31 @@ rbt_size(RedBlackTree_t *tree);
 integer_t
 rbt_limit(RedBlackTree_t *tree);
 
+/// \ref rbt_ranked
+/// \brief Returns true if the tree keeps the size of every subtree.
+bool
+rbt_ranked(RedBlackTree_t *tree);
+
+/// \ref rbt_persistent
+/// \brief Returns true if snapshots can be taken from the tree.
+bool
+rbt_persistent(RedBlackTree_t *tree);
+
+/// \ref rbt_multiple_keys
+/// \brief Returns true if the tree accepts equal elements.
+bool
+rbt_multiple_keys(RedBlackTree_t *tree);
+
+/// \ref rbt_stats
+/// \brief Copies the operation counters of the tree, if they are kept.
+bool
+rbt_stats(RedBlackTree_t *tree, ContainerStats_t *stats);
+
+/// \ref rbt_get
+/// \brief Returns the element in the tree equal to the given element.
+void *
+rbt_get(RedBlackTree_t *tree, void *element);
+
 /////////////////////////////////////////////////////////////////// SETTERS ///
 
 /// \ref rbt_set_limit
@@ -88,6 +121,26 @@ rbt_limit(RedBlackTree_t *tree);
 bool
 rbt_set_limit(RedBlackTree_t *tree, integer_t limit);
 
+/// \ref rbt_set_pool
+/// \brief Sets a node pool from where the tree's nodes are allocated.
+bool
+rbt_set_pool(RedBlackTree_t *tree, NodePool_t *pool);
+
+/// \ref rbt_set_ranked
+/// \brief Enables or disables the order statistics of the tree.
+void
+rbt_set_ranked(RedBlackTree_t *tree, bool ranked);
+
+/// \ref rbt_set_persistent
+/// \brief Enables or disables snapshots of the tree.
+bool
+rbt_set_persistent(RedBlackTree_t *tree, bool persistent);
+
+/// \ref rbt_set_multiple_keys
+/// \brief Makes an empty tree accept or refuse equal elements.
+bool
+rbt_set_multiple_keys(RedBlackTree_t *tree, bool multiple);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref rbt_insert
@@ -95,11 +148,31 @@ rbt_set_limit(RedBlackTree_t *tree, integer_t limit);
 bool
 rbt_insert(RedBlackTree_t *tree, void *element);
 
+/// \ref rbt_find_or_insert
+/// \brief Returns the element equal to the given one, adding it if missing.
+bool
+rbt_find_or_insert(RedBlackTree_t *tree, void *element, void **existing);
+
+/// \ref rbt_upsert
+/// \brief Adds an element or merges it into the equal element in the tree.
+bool
+rbt_upsert(RedBlackTree_t *tree, void *element, reduce_f merge);
+
+/// \ref rbt_insert_all
+/// \brief Adds every element of a buffer to the red-black tree.
+integer_t
+rbt_insert_all(RedBlackTree_t *tree, void **elements, integer_t size);
+
 /// \ref rbt_remove
 /// \brief Removes an element from the tree that matches the given element.
 bool
 rbt_remove(RedBlackTree_t *tree, void *element);
 
+/// \ref rbt_remove_all
+/// \brief Removes every element that matches the given element.
+integer_t
+rbt_remove_all(RedBlackTree_t *tree, void *element);
+
 /// \ref rbt_pop
 /// \brief Removes the root element and frees it from memory.
 bool
@@ -139,6 +212,76 @@ rbt_max(RedBlackTree_t *tree);
 void *
 rbt_min(RedBlackTree_t *tree);
 
+/// \ref rbt_range
+/// \brief Visits in order every element between two elements.
+integer_t
+rbt_range(RedBlackTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument);
+
+/// \ref rbt_visit
+/// \brief Calls a function with each element given a traversal order.
+bool
+rbt_visit(RedBlackTree_t *tree, int traversal_mode, visit_f visit,
+          void *argument);
+
+/// \ref rbt_select
+/// \brief Returns the element at a given position in ascending order.
+void *
+rbt_select(RedBlackTree_t *tree, integer_t index);
+
+/// \ref rbt_rank
+/// \brief Returns the amount of elements smaller than a given element.
+integer_t
+rbt_rank(RedBlackTree_t *tree, void *element);
+
+/// \ref rbt_get_all
+/// \brief Gives every element that matches the given element as a span.
+integer_t
+rbt_get_all(RedBlackTree_t *tree, void *element, void ***elements);
+
+/// \ref rbt_key_count
+/// \brief Returns the amount of elements that match the given element.
+integer_t
+rbt_key_count(RedBlackTree_t *tree, void *element);
+
+/// \ref rbt_save
+/// \brief Writes the tree to a stream.
+bool
+rbt_save(RedBlackTree_t *tree, FILE *stream);
+
+/// \ref rbt_restore
+/// \brief Reads back a tree written by rbt_save().
+RedBlackTree_t *
+rbt_restore(Interface_t *interface, FILE *stream);
+
+//////////////////////////////////////////////////////////// SET OPERATIONS ///
+
+/// \ref rbt_union
+/// \brief Moves every element of tree2 to tree1.
+bool
+rbt_union(RedBlackTree_t *tree1, RedBlackTree_t *tree2);
+
+/// \ref rbt_intersection
+/// \brief Removes from tree1 every element that is not in tree2.
+void
+rbt_intersection(RedBlackTree_t *tree1, RedBlackTree_t *tree2);
+
+/// \ref rbt_difference
+/// \brief Removes from tree1 every element that is also in tree2.
+void
+rbt_difference(RedBlackTree_t *tree1, RedBlackTree_t *tree2);
+
+/// \ref rbt_split
+/// \brief Moves the elements greater than or equal to an element to a new
+/// tree.
+RedBlackTree_t *
+rbt_split(RedBlackTree_t *tree, void *element);
+
+/// \ref rbt_join
+/// \brief Moves every element of tree2 to the end of tree1.
+bool
+rbt_join(RedBlackTree_t *tree1, RedBlackTree_t *tree2);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref rbt_display
@@ -155,7 +298,143 @@ rbt_traversal(RedBlackTree_t *tree, int traversal_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo RedBlackTreeIterator
+/// \struct RedBlackTreeIterator_s
+/// \brief A RedBlackTree_s iterator.
+struct RedBlackTreeIterator_s;
+
+/// \brief A type for a red-black tree iterator.
+///
+/// A type for a <code> struct RedBlackTreeIterator_s </code>.
+typedef struct RedBlackTreeIterator_s RedBlackTreeIterator_t;
+
+/// \brief A pointer type for a red-black tree iterator.
+///
+/// A pointer type for a <code> struct RedBlackTreeIterator_s </code>.
+typedef struct RedBlackTreeIterator_s *RedBlackTreeIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref rbt_iter_new
+/// \brief Creates a new iterator at the minimum element of a tree.
+RedBlackTreeIterator_t *
+rbt_iter_new(RedBlackTree_t *target);
+
+/// \ref rbt_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+rbt_iter_retarget(RedBlackTreeIterator_t *iter, RedBlackTree_t *target);
+
+/// \ref rbt_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+rbt_iter_free(RedBlackTreeIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref rbt_iter_next
+/// \brief Iterates to the next element in order if available.
+bool
+rbt_iter_next(RedBlackTreeIterator_t *iter);
+
+/// \ref rbt_iter_prev
+/// \brief Iterates to the previous element in order if available.
+bool
+rbt_iter_prev(RedBlackTreeIterator_t *iter);
+
+/// \ref rbt_iter_to_start
+/// \brief Moves the cursor to the minimum element.
+bool
+rbt_iter_to_start(RedBlackTreeIterator_t *iter);
+
+/// \ref rbt_iter_to_end
+/// \brief Moves the cursor to the maximum element.
+bool
+rbt_iter_to_end(RedBlackTreeIterator_t *iter);
+
+/// \ref rbt_iter_lower_bound
+/// \brief Moves the cursor to the first element not smaller than a given one.
+bool
+rbt_iter_lower_bound(RedBlackTreeIterator_t *iter, void *element);
+
+/// \ref rbt_iter_upper_bound
+/// \brief Moves the cursor to the first element bigger than a given one.
+bool
+rbt_iter_upper_bound(RedBlackTreeIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref rbt_iter_has_next
+/// \brief Returns true if there is an element after the cursor.
+bool
+rbt_iter_has_next(RedBlackTreeIterator_t *iter);
+
+/// \ref rbt_iter_has_prev
+/// \brief Returns true if there is an element before the cursor.
+bool
+rbt_iter_has_prev(RedBlackTreeIterator_t *iter);
+
+//////////////////////////////////////////////////////////////////// ACCESS ///
+
+/// \ref rbt_iter_peek
+/// \brief Returns the element at the cursor.
+void *
+rbt_iter_peek(RedBlackTreeIterator_t *iter);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Snapshot ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \struct RedBlackTreeSnapshot_s
+/// \brief An immutable version of a persistent RedBlackTree_s.
+struct RedBlackTreeSnapshot_s;
+
+/// \brief A type for a red-black tree snapshot.
+///
+/// A type for a <code> struct RedBlackTreeSnapshot_s </code>.
+typedef struct RedBlackTreeSnapshot_s RedBlackTreeSnapshot_t;
+
+/// \brief A pointer type for a red-black tree snapshot.
+///
+/// A pointer type for a <code> struct RedBlackTreeSnapshot_s </code>.
+typedef struct RedBlackTreeSnapshot_s *RedBlackTreeSnapshot;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref rbt_snapshot
+/// \brief Takes an immutable version of a persistent tree.
+RedBlackTreeSnapshot_t *
+rbt_snapshot(RedBlackTree_t *tree);
+
+/// \ref rbt_snapshot_release
+/// \brief Releases a snapshot so its nodes can be reclaimed.
+void
+rbt_snapshot_release(RedBlackTreeSnapshot_t *snapshot);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref rbt_snapshot_size
+/// \brief Returns the amount of elements in the snapshot.
+integer_t
+rbt_snapshot_size(RedBlackTreeSnapshot_t *snapshot);
+
+/// \ref rbt_snapshot_version
+/// \brief Returns the version of the tree the snapshot was taken from.
+integer_t
+rbt_snapshot_version(RedBlackTreeSnapshot_t *snapshot);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref rbt_snapshot_contains
+/// \brief Checks if a given element is in the snapshot.
+bool
+rbt_snapshot_contains(RedBlackTreeSnapshot_t *snapshot, void *element);
+
+/// \ref rbt_snapshot_range
+/// \brief Visits in order every element of the snapshot between two
+/// elements.
+integer_t
+rbt_snapshot_range(RedBlackTreeSnapshot_t *snapshot, void *low, void *high,
+                   visit_f visit, void *argument);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -0,0 +1,151 @@
+/**
+ * @file RoaringBitmap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_ROARINGBITMAP_H
+#define C_DATASTRUCTURES_LIBRARY_ROARINGBITMAP_H
+
+#include "Core.h"
+#include "BitArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct RoaringBitmap_s
+/// \brief A compressed bitmap of 32-bit integers.
+struct RoaringBitmap_s;
+
+/// \ref RoaringBitmap_t
+/// \brief A type for a roaring bitmap.
+///
+/// A type for a <code> struct RoaringBitmap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct RoaringBitmap_s RoaringBitmap_t;
+
+/// \ref RoaringBitmap
+/// \brief A pointer type for a roaring bitmap.
+///
+/// Defines a pointer type to <code> struct RoaringBitmap_s </code>. This
+/// typedef is used to avoid having to declare every roaring bitmap as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct RoaringBitmap_s *RoaringBitmap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref rbm_new
+/// \brief Creates a new empty roaring bitmap.
+RoaringBitmap_t *
+rbm_new(void);
+
+/// \ref rbm_free
+/// \brief Frees from memory the specified roaring bitmap.
+void
+rbm_free(RoaringBitmap_t *bitmap);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref rbm_cardinality
+/// \brief Returns the amount of set bits in the roaring bitmap.
+unsigned_t
+rbm_cardinality(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_containers
+/// \brief Returns the amount of non-empty 65536 bit chunks.
+integer_t
+rbm_containers(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_bytes
+/// \brief Returns the amount of memory used by the roaring bitmap.
+unsigned_t
+rbm_bytes(RoaringBitmap_t *bitmap);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref rbm_set
+/// \brief Sets to true a bit at a given index.
+bool
+rbm_set(RoaringBitmap_t *bitmap, uint32_t bit_index);
+
+/// \ref rbm_clear
+/// \brief Sets to false a bit at a given index.
+bool
+rbm_clear(RoaringBitmap_t *bitmap, uint32_t bit_index);
+
+/// \ref rbm_get
+/// \brief Retrieves the state of a bit at a given index.
+bool
+rbm_get(RoaringBitmap_t *bitmap, uint32_t bit_index);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref rbm_empty
+/// \brief Returns true if no bits are set.
+bool
+rbm_empty(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_copy
+/// \brief Creates a copy of a RoaringBitmap_s.
+RoaringBitmap_t *
+rbm_copy(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_optimize
+/// \brief Converts chunks to run-length encoding where it saves memory.
+bool
+rbm_optimize(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_to_bitarray
+/// \brief Makes a BitArray_s with the same set bits.
+BitArray_t *
+rbm_to_bitarray(RoaringBitmap_t *bitmap);
+
+/// \ref rbm_from_bitarray
+/// \brief Makes a RoaringBitmap_s with the same set bits as a BitArray_s.
+RoaringBitmap_t *
+rbm_from_bitarray(BitArray_t *bits);
+
+///////////////////////////////////////////////////////// SEARCH OPERATIONS ///
+
+/// \ref rbm_next_set
+/// \brief Returns the index of the nearest set bit on or after an index.
+unsigned_t
+rbm_next_set(RoaringBitmap_t *bitmap, uint32_t bit_index);
+
+///////////////////////////////////////////////////////// BINARY OPERATIONS ///
+
+/// \ref rbm_AND
+/// \brief Performs an \c AND operation between two roaring bitmaps.
+bool
+rbm_AND(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2);
+
+/// \ref rbm_OR
+/// \brief Performs an \c OR operation between two roaring bitmaps.
+bool
+rbm_OR(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2);
+
+/// \ref rbm_XOR
+/// \brief Performs an \c XOR operation between two roaring bitmaps.
+bool
+rbm_XOR(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2);
+
+/// \ref rbm_DIFF
+/// \brief Performs a difference between two roaring bitmaps.
+bool
+rbm_DIFF(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref rbm_display
+/// \brief Displays every set bit index in the console.
+void
+rbm_display(RoaringBitmap_t *bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_ROARINGBITMAP_H
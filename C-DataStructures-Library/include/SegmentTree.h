@@ -0,0 +1,118 @@
+/**
+ * @file SegmentTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SEGMENTTREE_H
+#define C_DATASTRUCTURES_LIBRARY_SEGMENTTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "DynamicArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct SegmentTree_s
+/// \brief An array of values with logarithmic range aggregates and updates.
+struct SegmentTree_s;
+
+/// \ref SegmentTree_t
+/// \brief A type for a segment tree.
+///
+/// A type for a <code> struct SegmentTree_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct SegmentTree_s SegmentTree_t;
+
+/// \ref SegmentTree
+/// \brief A pointer type for a segment tree.
+///
+/// Defines a pointer type to <code> struct SegmentTree_s </code>. This
+/// typedef is used to avoid having to declare every segment tree as a pointer
+/// type since they all must be dynamically allocated.
+typedef struct SegmentTree_s *SegmentTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref sgt_new
+/// \brief Initializes a new segment tree with every value set to identity.
+SegmentTree_t *
+sgt_new(size_t element_size, reduce_f combine, const void *identity,
+        integer_t size);
+
+/// \ref sgt_from_buffer
+/// \brief Builds a segment tree from a buffer of values in linear time.
+SegmentTree_t *
+sgt_from_buffer(size_t element_size, reduce_f combine, const void *identity,
+                const void *values, integer_t size);
+
+/// \ref sgt_from_array
+/// \brief Builds a segment tree from the elements of a dynamic array.
+SegmentTree_t *
+sgt_from_array(size_t element_size, reduce_f combine, const void *identity,
+               DynamicArray_t *array);
+
+/// \ref sgt_free
+/// \brief Frees from memory a SegmentTree_s.
+void
+sgt_free(SegmentTree_t *tree);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref sgt_set_lazy
+/// \brief Enables range updates.
+bool
+sgt_set_lazy(SegmentTree_t *tree, size_t update_size, apply_f apply,
+             reduce_f compose);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref sgt_size
+/// \brief Returns the amount of values in the tree.
+integer_t
+sgt_size(SegmentTree_t *tree);
+
+/// \ref sgt_element_size
+/// \brief Returns the size in bytes of each value.
+size_t
+sgt_element_size(SegmentTree_t *tree);
+
+/// \ref sgt_lazy
+/// \brief Returns true if range updates are enabled.
+bool
+sgt_lazy(SegmentTree_t *tree);
+
+/// \ref sgt_get
+/// \brief Copies the value at a given index.
+bool
+sgt_get(SegmentTree_t *tree, integer_t index, void *result);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref sgt_set
+/// \brief Replaces the value at a given index.
+bool
+sgt_set(SegmentTree_t *tree, integer_t index, const void *element);
+
+/// \ref sgt_update
+/// \brief Applies an update to every value between two indexes.
+bool
+sgt_update(SegmentTree_t *tree, integer_t from, integer_t to,
+           const void *update);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref sgt_query
+/// \brief Combines every value between two indexes.
+bool
+sgt_query(SegmentTree_t *tree, integer_t from, integer_t to, void *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SEGMENTTREE_H
@@ -0,0 +1,134 @@
+/**
+ * @file Sharded.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SHARDED_H
+#define C_DATASTRUCTURES_LIBRARY_SHARDED_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Synchronized.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief The functions a Sharded_s uses to manage its containers.
+///
+/// Every function receives a container created by \c create. Only \c create
+/// and \c destroy are required.
+struct ShardFunctions_s
+{
+    /// \brief Returns a new empty container or NULL if allocation failed.
+    ///
+    /// Receives the \c context given to shd_new().
+    void *(*create)(void *context);
+
+    /// \brief Frees a container and its elements.
+    void (*destroy)(void *container);
+
+    /// \brief Returns the amount of elements in a container.
+    integer_t (*count)(void *container);
+
+    /// \brief Calls a function with every element of a container.
+    ///
+    /// Containers that keep their elements sorted must visit them in order
+    /// for shd_visit_sorted() to work.
+    void (*visit)(void *container, visit_f visit, void *argument);
+};
+
+/// \ref ShardFunctions_t
+/// \brief A type for the functions of a Sharded_s.
+typedef struct ShardFunctions_s ShardFunctions_t;
+
+/// \struct Sharded_s
+/// \brief A container split in independently locked shards.
+struct Sharded_s;
+
+/// \ref Sharded_t
+/// \brief A type for a sharded container.
+///
+/// A type for a <code> struct Sharded_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Sharded_s Sharded_t;
+
+/// \ref Sharded
+/// \brief A pointer type for a sharded container.
+///
+/// Defines a pointer type to <code> struct Sharded_s </code>. This typedef is
+/// used to avoid having to declare every sharded container as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct Sharded_s *Sharded;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref shd_new
+/// \brief Creates a given amount of shards, each with its own container.
+Sharded_t *
+shd_new(integer_t shards, hash_f hash, const ShardFunctions_t *functions,
+        void *context);
+
+/// \ref shd_free
+/// \brief Frees from memory every shard and its container.
+void
+shd_free(Sharded_t *sharded);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref shd_shards
+/// \brief Returns the amount of shards.
+integer_t
+shd_shards(Sharded_t *sharded);
+
+/// \ref shd_index
+/// \brief Returns the index of the shard that holds a given key.
+integer_t
+shd_index(Sharded_t *sharded, const void *key);
+
+/// \ref shd_shard
+/// \brief Returns the lock of the shard at a given index.
+Synchronized_t *
+shd_shard(Sharded_t *sharded, integer_t index);
+
+/// \ref shd_find
+/// \brief Returns the lock of the shard that holds a given key.
+Synchronized_t *
+shd_find(Sharded_t *sharded, const void *key);
+
+/// \ref shd_stats
+/// \brief Returns the lock statistics of all shards added together.
+SyncStats_t
+shd_stats(Sharded_t *sharded);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref shd_count
+/// \brief Returns the amount of elements in all shards.
+integer_t
+shd_count(Sharded_t *sharded);
+
+/// \ref shd_for_each
+/// \brief Calls a function with the container of each shard.
+void
+shd_for_each(Sharded_t *sharded, visit_f visit, void *argument);
+
+/// \ref shd_visit
+/// \brief Calls a function with every element of every shard.
+void
+shd_visit(Sharded_t *sharded, visit_f visit, void *argument);
+
+/// \ref shd_visit_sorted
+/// \brief Calls a function with every element of every shard in order.
+bool
+shd_visit_sorted(Sharded_t *sharded, compare_f compare, visit_f visit,
+                 void *argument);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SHARDED_H
@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_SINGLYLINKEDLIST_H
 
 #include "Core.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -82,6 +83,8 @@ Status sll_set_v_free(SinglyLinkedList list, sll_free_f function);
 
 Status sll_set_limit(SinglyLinkedList list, integer_t limit);
 
+Status sll_set_pool(SinglyLinkedList list, NodePool_t *pool);
+
 Status sll_set(SinglyLinkedList list, void *element, integer_t position);
 
 /////////////////////////////////////////////////////////////////// GETTERS ///
@@ -126,6 +129,8 @@ bool sll_contains(SinglyLinkedList list, void *key);
 
 Status sll_reverse(SinglyLinkedList list);
 
+Status sll_sort(SinglyLinkedList list);
+
 Status sll_copy(SinglyLinkedList list, SinglyLinkedList *result);
 
 Status sll_to_array(SinglyLinkedList list, void ***result, integer_t *length);
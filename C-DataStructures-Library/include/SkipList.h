@@ -0,0 +1,171 @@
+/**
+ * @file SkipList.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SKIPLIST_H
+#define C_DATASTRUCTURES_LIBRARY_SKIPLIST_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct SkipList_s
+/// \brief A concurrent ordered set of unique elements.
+struct SkipList_s;
+
+/// \ref SkipList_t
+/// \brief A type for a concurrent skip list.
+///
+/// A type for a <code> struct SkipList_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct SkipList_s SkipList_t;
+
+/// \ref SkipList
+/// \brief A pointer type for a concurrent skip list.
+///
+/// Defines a pointer type to <code> struct SkipList_s </code>. This typedef is
+/// used to avoid having to declare every skip list as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct SkipList_s *SkipList;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref skl_new
+/// \brief Initializes a new SkipList_s.
+SkipList_t *
+skl_new(Interface_t *interface);
+
+/// \ref skl_free
+/// \brief Frees from memory a SkipList_s and all its elements.
+void
+skl_free(SkipList_t *list);
+
+/// \ref skl_free_shallow
+/// \brief Frees from memory a SkipList_s leaving its elements intact.
+void
+skl_free_shallow(SkipList_t *list);
+
+/// \ref skl_reclaim
+/// \brief Frees removed elements once no other thread uses the SkipList_s.
+integer_t
+skl_reclaim(SkipList_t *list);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref skl_size
+/// \brief Returns the amount of elements in the skip list.
+integer_t
+skl_size(SkipList_t *list);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref skl_insert
+/// \brief Adds an element if it is not already in the skip list.
+bool
+skl_insert(SkipList_t *list, void *element);
+
+/// \ref skl_remove
+/// \brief Removes an element matching a given key.
+bool
+skl_remove(SkipList_t *list, void *element);
+
+/// \ref skl_pop
+/// \brief Removes the smallest element.
+bool
+skl_pop(SkipList_t *list);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref skl_empty
+/// \brief Returns true if the skip list has no elements.
+bool
+skl_empty(SkipList_t *list);
+
+/// \ref skl_contains
+/// \brief Returns true if an element matching a given key is present.
+bool
+skl_contains(SkipList_t *list, void *element);
+
+/// \ref skl_max
+/// \brief Returns the greatest element in the skip list.
+void *
+skl_max(SkipList_t *list);
+
+/// \ref skl_min
+/// \brief Returns the smallest element in the skip list.
+void *
+skl_min(SkipList_t *list);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref skl_display
+/// \brief Displays a SkipList_s in the console.
+void
+skl_display(SkipList_t *list);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \struct SkipListIterator_s
+/// \brief A SkipList_s iterator.
+struct SkipListIterator_s;
+
+/// \brief A type for a skip list iterator.
+///
+/// A type for a <code> struct SkipListIterator_s </code>.
+typedef struct SkipListIterator_s SkipListIterator_t;
+
+/// \brief A pointer type for a skip list iterator.
+///
+/// A pointer type for a <code> struct SkipListIterator_s </code>.
+typedef struct SkipListIterator_s *SkipListIterator;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref skl_iter_new
+/// \brief Creates a new iterator at the smallest element of a skip list.
+SkipListIterator_t *
+skl_iter_new(SkipList_t *target);
+
+/// \ref skl_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+skl_iter_free(SkipListIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref skl_iter_next
+/// \brief Iterates to the next greater element if available.
+bool
+skl_iter_next(SkipListIterator_t *iter);
+
+/// \ref skl_iter_to_front
+/// \brief Iterates to the smallest element in the skip list.
+bool
+skl_iter_to_front(SkipListIterator_t *iter);
+
+/// \ref skl_iter_seek
+/// \brief Iterates to the smallest element not less than a given key.
+bool
+skl_iter_seek(SkipListIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref skl_iter_peek
+/// \brief Returns the current element in the iteration if available.
+void *
+skl_iter_peek(SkipListIterator_t *iter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SKIPLIST_H
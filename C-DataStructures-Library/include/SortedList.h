@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_SORTEDLIST_H
 
 #include "Core.h"
+#include "NodePool.h"
 #include "CoreSort.h"
 
 #ifdef __cplusplus
@@ -83,8 +84,12 @@ Status sli_set_v_free(SortedList list, sli_free_f function);
 
 Status sli_set_limit(SortedList list, integer_t limit);
 
+Status sli_set_pool(SortedList list, NodePool_t *pool);
+
 Status sli_set_order(SortedList list, SortOrder order);
 
+Status sli_set_indexed(SortedList list, bool indexed);
+
 // No setter because the user might break the sorted property of the list.
 
 /////////////////////////////////////////////////////////////////// GETTERS ///
@@ -95,6 +100,8 @@ integer_t sli_limit(SortedList list);
 
 SortOrder sli_order(SortedList list);
 
+bool sli_indexed(SortedList list);
+
 Status sli_get(SortedList list, void **result, integer_t index);
 
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
@@ -102,6 +102,11 @@ sta_capacity(StackArray_t *stack);
 integer_t
 sta_growth(StackArray_t *stack);
 
+/// \ref sta_policy
+/// \brief Returns how the buffer grows.
+GrowthPolicy
+sta_policy(StackArray_t *stack);
+
 /// \ref sta_locked
 /// \brief Returns true if the stack's buffer is locked, false otherwise.
 bool
@@ -124,6 +129,16 @@ sta_capacity_lock(StackArray_t *stack);
 void
 sta_capacity_unlock(StackArray_t *stack);
 
+/// \ref sta_set_policy
+/// \brief Sets how the buffer grows.
+bool
+sta_set_policy(StackArray_t *stack, GrowthPolicy policy, integer_t step);
+
+/// \ref sta_set_shrink
+/// \brief Makes the buffer shrink automatically when it is mostly empty.
+void
+sta_set_shrink(StackArray_t *stack, bool shrink);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref sta_push
@@ -136,6 +151,16 @@ sta_push(StackArray_t *stack, void *element);
 bool
 sta_pop(StackArray_t *stack, void **result);
 
+/// \ref sta_push_n
+/// \brief Inserts a buffer of elements in the specified stack.
+bool
+sta_push_n(StackArray_t *stack, void **elements, integer_t size);
+
+/// \ref sta_pop_n
+/// \brief Removes up to a given amount of elements from the specified stack.
+integer_t
+sta_pop_n(StackArray_t *stack, void **result, integer_t max);
+
 /// \ref sta_peek
 /// \brief Returns the top element in the specified stack.
 void *
@@ -191,12 +216,24 @@ sta_stack(StackArray_t *stack1, StackArray_t *stack2);
 void **
 sta_to_array(StackArray_t *stack, integer_t *length);
 
+/// \ref sta_to_array_move
+/// \brief Moves the elements of the stack to a C array.
+void **
+sta_to_array_move(StackArray_t *stack, integer_t *length);
+
+/// \ref sta_span
+/// \brief Gives direct access to contiguous elements of the stack.
+integer_t
+sta_span(StackArray_t *stack, integer_t position, void ***span);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref sta_display
 /// \brief Displays a StackArray_s in the console.
 void
 sta_display(StackArray_t *stack, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "NodePool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -85,6 +86,11 @@ stl_config(StackList_t *stack, Interface_t *new_interface);
 integer_t
 stl_count(StackList_t *stack);
 
+/// \ref stl_chunk
+/// \brief Returns how many elements each node of the stack holds.
+integer_t
+stl_chunk(StackList_t *stack);
+
 /// \ref stl_limit
 /// \brief Returns the current stack limit.
 integer_t
@@ -97,6 +103,16 @@ stl_limit(StackList_t *stack);
 bool
 stl_set_limit(StackList_t *stack, integer_t limit);
 
+/// \ref stl_set_pool
+/// \brief Sets a node pool from where the stack's nodes are allocated.
+bool
+stl_set_pool(StackList_t *stack, NodePool_t *pool);
+
+/// \ref stl_set_chunk
+/// \brief Sets how many elements each node of the stack holds.
+bool
+stl_set_chunk(StackList_t *stack, integer_t chunk);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref stl_push
@@ -166,10 +182,12 @@ stl_to_array(StackList_t *stack, integer_t *length);
 
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
+#ifndef DS_NO_DISPLAY
 /// \ref stl_display
 /// \brief Displays a StackList_s in the console.
 void
 stl_display(StackList_t *stack, int display_mode);
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
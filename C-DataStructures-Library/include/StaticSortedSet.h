@@ -0,0 +1,140 @@
+/**
+ * @file StaticSortedSet.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_STATICSORTEDSET_H
+#define C_DATASTRUCTURES_LIBRARY_STATICSORTEDSET_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "AVLTree.h"
+#include "DynamicArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief How the elements of a static sorted set are laid out.
+enum SortedSetLayout
+{
+    /// Breadth-first order of a complete binary search tree, searched without
+    /// branches.
+    SortedSetEytzinger = 0,
+
+    /// Plain ascending order, searched by interpolating the integer keys of
+    /// the elements. Requires a \ref key_f.
+    SortedSetInterpolation = 1
+};
+
+/// \ref SortedSetLayout
+/// \brief A type for the layouts of a static sorted set.
+typedef enum SortedSetLayout SortedSetLayout;
+
+/// \struct StaticSortedSet_s
+/// \brief An immutable sorted set stored in a single buffer.
+struct StaticSortedSet_s;
+
+/// \ref StaticSortedSet_t
+/// \brief A type for a static sorted set.
+///
+/// A type for a <code> struct StaticSortedSet_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct StaticSortedSet_s StaticSortedSet_t;
+
+/// \ref StaticSortedSet
+/// \brief A pointer type for a static sorted set.
+///
+/// Defines a pointer type to <code> struct StaticSortedSet_s </code>. This
+/// typedef is used to avoid having to declare every static sorted set as a
+/// pointer type since they all must be dynamically allocated.
+typedef struct StaticSortedSet_s *StaticSortedSet;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref sss_from_sorted_array
+/// \brief Builds a set from a buffer of sorted and unique elements.
+StaticSortedSet_t *
+sss_from_sorted_array(Interface_t *interface, key_f key,
+                      SortedSetLayout layout, void **elements,
+                      integer_t size);
+
+/// \ref sss_from_array
+/// \brief Moves every element of a dynamic array to a new set.
+StaticSortedSet_t *
+sss_from_array(Interface_t *interface, key_f key, SortedSetLayout layout,
+               DynamicArray_t *array);
+
+/// \ref sss_from_tree
+/// \brief Moves every element of an AVL tree to a new set.
+StaticSortedSet_t *
+sss_from_tree(Interface_t *interface, key_f key, SortedSetLayout layout,
+              AVLTree_t *tree);
+
+/// \ref sss_free
+/// \brief Frees from memory a StaticSortedSet_s and all its elements.
+void
+sss_free(StaticSortedSet_t *set);
+
+/// \ref sss_free_shallow
+/// \brief Frees from memory a StaticSortedSet_s leaving its elements intact.
+void
+sss_free_shallow(StaticSortedSet_t *set);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref sss_size
+/// \brief Returns the amount of elements in the set.
+integer_t
+sss_size(StaticSortedSet_t *set);
+
+/// \ref sss_layout
+/// \brief Returns how the elements of the set are laid out.
+SortedSetLayout
+sss_layout(StaticSortedSet_t *set);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref sss_empty
+/// \brief Checks if the set is empty.
+bool
+sss_empty(StaticSortedSet_t *set);
+
+///////////////////////////////////////////////////////// SEARCH OPERATIONS ///
+
+/// \ref sss_contains
+/// \brief Checks if a given element is in the set.
+bool
+sss_contains(StaticSortedSet_t *set, void *element);
+
+/// \ref sss_lower_bound
+/// \brief Returns the first element not smaller than a given one.
+void *
+sss_lower_bound(StaticSortedSet_t *set, void *element);
+
+/// \ref sss_range
+/// \brief Visits in order every element between two keys, both inclusive.
+integer_t
+sss_range(StaticSortedSet_t *set, void *low, void *high, visit_f visit,
+          void *argument);
+
+/// \ref sss_traversal
+/// \brief Visits every element in order.
+void
+sss_traversal(StaticSortedSet_t *set, visit_f visit, void *argument);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref sss_display
+/// \brief Displays every element of the set in order.
+void
+sss_display(StaticSortedSet_t *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_STATICSORTEDSET_H
@@ -0,0 +1,176 @@
+/**
+ * @file Synchronized.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SYNCHRONIZED_H
+#define C_DATASTRUCTURES_LIBRARY_SYNCHRONIZED_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct Synchronized_s
+/// \brief A reader-writer lock and sequence lock that protect a container.
+struct Synchronized_s;
+
+/// \ref Synchronized_t
+/// \brief A type for a synchronized container.
+///
+/// A type for a <code> struct Synchronized_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct Synchronized_s Synchronized_t;
+
+/// \ref Synchronized
+/// \brief A pointer type for a synchronized container.
+///
+/// Defines a pointer type to <code> struct Synchronized_s </code>. This
+/// typedef is used to avoid having to declare every synchronized container as
+/// a pointer type since they all must be dynamically allocated.
+typedef struct Synchronized_s *Synchronized;
+
+/// \brief Lock statistics of a Synchronized_s.
+///
+/// Times are in nanoseconds and are only measured while timing is enabled
+/// with syn_set_timing().
+struct SyncStats_s
+{
+    /// \brief Amount of read sections.
+    unsigned_t reads;
+
+    /// \brief Total time the read lock was held.
+    unsigned_t read_time;
+
+    /// \brief Longest time the read lock was held at once.
+    unsigned_t read_max;
+
+    /// \brief Amount of write sections.
+    unsigned_t writes;
+
+    /// \brief Total time the write lock was held.
+    unsigned_t write_time;
+
+    /// \brief Longest time the write lock was held at once.
+    unsigned_t write_max;
+
+    /// \brief Amount of optimistic reads that were validated.
+    unsigned_t optimistic;
+
+    /// \brief Amount of optimistic reads invalidated by a writer.
+    unsigned_t retries;
+
+    /// \brief Amount of sections that had to wait for the lock.
+    unsigned_t waits;
+
+    /// \brief Total time spent waiting for the lock.
+    unsigned_t wait_time;
+};
+
+/// \ref SyncStats_t
+/// \brief A type for the statistics of a Synchronized_s.
+typedef struct SyncStats_s SyncStats_t;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref syn_new
+/// \brief Creates a new lock that protects a given container.
+Synchronized_t *
+syn_new(void *target);
+
+/// \ref syn_free
+/// \brief Frees from memory the lock leaving the container intact.
+void
+syn_free(Synchronized_t *sync);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref syn_target
+/// \brief Returns the protected container.
+void *
+syn_target(Synchronized_t *sync);
+
+/// \ref syn_stats
+/// \brief Returns the lock statistics so far.
+SyncStats_t
+syn_stats(Synchronized_t *sync);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref syn_set_timing
+/// \brief Enables or disables measuring how long locks are held.
+void
+syn_set_timing(Synchronized_t *sync, bool timing);
+
+/// \ref syn_reset_stats
+/// \brief Sets all statistics back to zero.
+void
+syn_reset_stats(Synchronized_t *sync);
+
+/////////////////////////////////////////////////////////// LOCKED SECTIONS ///
+
+/// \ref syn_read_begin
+/// \brief Starts a section that can only read the container.
+unsigned_t
+syn_read_begin(Synchronized_t *sync);
+
+/// \ref syn_read_end
+/// \brief Ends a section started by syn_read_begin().
+void
+syn_read_end(Synchronized_t *sync, unsigned_t ticket);
+
+/// \ref syn_write_begin
+/// \brief Starts a section with exclusive access to the container.
+void
+syn_write_begin(Synchronized_t *sync);
+
+/// \ref syn_write_end
+/// \brief Ends a section started by syn_write_begin().
+void
+syn_write_end(Synchronized_t *sync);
+
+/// \ref syn_optimistic_begin
+/// \brief Starts a read without locking that must be validated at the end.
+unsigned_t
+syn_optimistic_begin(Synchronized_t *sync);
+
+/// \ref syn_optimistic_validate
+/// \brief Returns true if no writer changed the container during the read.
+bool
+syn_optimistic_validate(Synchronized_t *sync, unsigned_t sequence);
+
+/// Runs \c body while holding the read lock of \c sync.
+#define SYN_READ(sync, body)                                                   \
+    do {                                                                       \
+        unsigned_t syn_ticket_ = syn_read_begin(sync);                         \
+        body;                                                                  \
+        syn_read_end(sync, syn_ticket_);                                       \
+    } while (0)
+
+/// Runs \c body while holding the write lock of \c sync.
+#define SYN_WRITE(sync, body)                                                  \
+    do {                                                                       \
+        syn_write_begin(sync);                                                 \
+        body;                                                                  \
+        syn_write_end(sync);                                                   \
+    } while (0)
+
+/// Runs \c body without locking until no writer interfered with it.
+#define SYN_OPTIMISTIC(sync, body)                                             \
+    do {                                                                       \
+        unsigned_t syn_sequence_;                                              \
+        do {                                                                   \
+            syn_sequence_ = syn_optimistic_begin(sync);                        \
+            body;                                                              \
+        } while (!syn_optimistic_validate(sync, syn_sequence_));               \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SYNCHRONIZED_H
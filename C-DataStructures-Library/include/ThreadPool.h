@@ -0,0 +1,81 @@
+/**
+ * @file ThreadPool.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
+#define C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ThreadPool_s
+/// \brief A fixed-size pool of worker threads.
+struct ThreadPool_s;
+
+/// \ref ThreadPool_t
+/// \brief A type for a thread pool.
+///
+/// A type for a <code> struct ThreadPool_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct ThreadPool_s ThreadPool_t;
+
+/// \ref ThreadPool
+/// \brief A pointer type for a thread pool.
+///
+/// Defines a pointer type to <code> struct ThreadPool_s </code>. This typedef
+/// is used to avoid having to declare every thread pool as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct ThreadPool_s *ThreadPool;
+
+/// \ref task_f
+/// \brief A type for a function executed by a thread pool.
+typedef void(*task_f)(void *);
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref tpl_new
+/// \brief Initializes a new thread pool and starts its threads.
+ThreadPool_t *
+tpl_new(integer_t threads);
+
+/// \ref tpl_free
+/// \brief Waits for all tasks, stops all threads and frees the pool.
+void
+tpl_free(ThreadPool_t *pool);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref tpl_threads
+/// \brief Returns the amount of threads in the pool.
+integer_t
+tpl_threads(ThreadPool_t *pool);
+
+/// \ref tpl_pending
+/// \brief Returns the amount of tasks queued or running.
+integer_t
+tpl_pending(ThreadPool_t *pool);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref tpl_submit
+/// \brief Queues a task to be executed by one of the threads.
+bool
+tpl_submit(ThreadPool_t *pool, task_f task, void *argument);
+
+/// \ref tpl_wait
+/// \brief Blocks until every submitted task has finished.
+void
+tpl_wait(ThreadPool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
@@ -0,0 +1,121 @@
+/**
+ * @file TimerWheel.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
+#define C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
+
+#include "Core.h"
+#include "IntrusiveList.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A timer embedded in the elements of a TimerWheel_s.
+///
+/// Every element that can be scheduled has one of these as a member. Its
+/// fields must not be changed by the user. Zero initialize it before the
+/// element is scheduled for the first time so twl_scheduled() works.
+struct TimerHook_s
+{
+    /// \brief Link to the slot of the wheel or to the expired list.
+    ///
+    /// Always the first member, so an IntrusiveList_s of expired timers uses
+    /// the same offset as the TimerHook_s.
+    struct ListHook_s link;
+
+    /// \brief Tick at which the timer expires.
+    uint64_t deadline;
+};
+
+/// \ref TimerHook_t
+/// \brief A type for a timer hook.
+typedef struct TimerHook_s TimerHook_t;
+
+/// \struct TimerWheel_s
+/// \brief A hierarchical timing wheel with constant time schedule and cancel.
+struct TimerWheel_s;
+
+/// \ref TimerWheel_t
+/// \brief A type for a timer wheel.
+///
+/// A type for a <code> struct TimerWheel_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct TimerWheel_s TimerWheel_t;
+
+/// \ref TimerWheel
+/// \brief A pointer type for a timer wheel.
+///
+/// Defines a pointer type to <code> struct TimerWheel_s </code>. This typedef
+/// is used to avoid having to declare every timer wheel as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct TimerWheel_s *TimerWheel;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref twl_new
+/// \brief Initializes a new timer wheel starting at a given tick.
+TimerWheel_t *
+twl_new(size_t offset, uint64_t now);
+
+/// \ref twl_free
+/// \brief Frees from memory a TimerWheel_s, leaving its timers intact.
+void
+twl_free(TimerWheel_t *wheel);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref twl_count
+/// \brief Returns the amount of timers scheduled in the wheel.
+integer_t
+twl_count(TimerWheel_t *wheel);
+
+/// \ref twl_now
+/// \brief Returns the current tick of the wheel.
+uint64_t
+twl_now(TimerWheel_t *wheel);
+
+/// \ref twl_deadline
+/// \brief Returns the tick at which a timer expires.
+uint64_t
+twl_deadline(TimerWheel_t *wheel, void *element);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref twl_schedule
+/// \brief Schedules or reschedules a timer to expire at a given tick.
+void
+twl_schedule(TimerWheel_t *wheel, void *element, uint64_t deadline);
+
+/// \ref twl_cancel
+/// \brief Cancels a scheduled timer.
+bool
+twl_cancel(TimerWheel_t *wheel, void *element);
+
+/// \ref twl_advance
+/// \brief Moves the wheel forward, collecting every timer that expired.
+integer_t
+twl_advance(TimerWheel_t *wheel, uint64_t now, IntrusiveList_t *expired);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref twl_empty
+/// \brief Returns true if no timers are scheduled, otherwise false.
+bool
+twl_empty(TimerWheel_t *wheel);
+
+/// \ref twl_scheduled
+/// \brief Returns true if a timer is scheduled or waiting in an expired list.
+bool
+twl_scheduled(TimerWheel_t *wheel, void *element);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
@@ -0,0 +1,125 @@
+/**
+ * @file TopK.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TOPK_H
+#define C_DATASTRUCTURES_LIBRARY_TOPK_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Heap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct TopK_s
+/// \brief Keeps the k highest elements of a stream in bounded memory.
+struct TopK_s;
+
+/// \ref TopK_t
+/// \brief A type for a top-k container.
+///
+/// A type for a <code> struct TopK_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct TopK_s TopK_t;
+
+/// \ref TopK
+/// \brief A pointer type for a top-k container.
+///
+/// Defines a pointer type to <code> struct TopK_s </code>. This typedef is
+/// used to avoid having to declare every top-k container as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct TopK_s *TopK;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref tpk_new
+/// \brief Initializes a new TopK_s that keeps up to k elements.
+TopK_t *
+tpk_new(Interface_t *interface, integer_t k);
+
+/// \ref tpk_free
+/// \brief Frees from memory a TopK_s and its elements.
+void
+tpk_free(TopK_t *topk);
+
+/// \ref tpk_erase
+/// \brief Frees from memory all elements of a TopK_s.
+void
+tpk_erase(TopK_t *topk);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref tpk_k
+/// \brief Returns the maximum amount of elements kept.
+integer_t
+tpk_k(TopK_t *topk);
+
+/// \ref tpk_count
+/// \brief Returns the amount of elements currently kept.
+integer_t
+tpk_count(TopK_t *topk);
+
+/// \ref tpk_seen
+/// \brief Returns the amount of elements offered so far.
+unsigned_t
+tpk_seen(TopK_t *topk);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref tpk_admits
+/// \brief Returns true if an element would be kept if inserted now.
+bool
+tpk_admits(TopK_t *topk, void *element);
+
+/// \ref tpk_insert
+/// \brief Offers an element to the TopK_s.
+bool
+tpk_insert(TopK_t *topk, void *element);
+
+/// \ref tpk_peek
+/// \brief Returns the lowest element kept, the one an element must beat.
+void *
+tpk_peek(TopK_t *topk);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref tpk_empty
+/// \brief Returns true if the TopK_s keeps no elements.
+bool
+tpk_empty(TopK_t *topk);
+
+/// \ref tpk_full
+/// \brief Returns true if the TopK_s keeps k elements.
+bool
+tpk_full(TopK_t *topk);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref tpk_merge
+/// \brief Offers every element of a TopK_s to another one.
+bool
+tpk_merge(TopK_t *topk1, TopK_t *topk2);
+
+/// \ref tpk_to_array
+/// \brief Makes a copy of the elements kept, from the highest to the lowest.
+void **
+tpk_to_array(TopK_t *topk, integer_t *length);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref tpk_display
+/// \brief Displays a TopK_s in the console.
+void
+tpk_display(TopK_t *topk);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TOPK_H
@@ -0,0 +1,301 @@
+/**
+ * @file TypedDynamicArray.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TYPEDDYNAMICARRAY_H
+#define C_DATASTRUCTURES_LIBRARY_TYPEDDYNAMICARRAY_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Defines a dynamic array specialized for a type.
+///
+/// This macro generates a dynamic array that stores elements of type \c T by
+/// value, together with all of its functions. Unlike a DynamicArray_s it has
+/// no interface: elements are compared with \c CMP, which can be a function
+/// or a function-like macro that takes two values of type \c T and returns an
+/// int following the rules of \ref compare_f. Since the comparator is known
+/// at compile time the compiler is free to inline it.
+///
+/// All functions are <code> static inline </code>, so the macro is meant to
+/// be used once per type in a source file or in a private header. The
+/// generated names are:
+/// - \c name_t The array type;
+/// - \c name_new and \c name_create;
+/// - \c name_free and \c name_erase;
+/// - \c name_size, \c name_capacity, \c name_get and \c name_data;
+/// - \c name_set;
+/// - \c name_insert_back, \c name_insert_at, \c name_remove_at and
+/// \c name_remove_back;
+/// - \c name_empty and \c name_full;
+/// - \c name_index_first, \c name_contains and \c name_sort.
+///
+/// \par Example
+/// \code
+/// DS_DEFINE_DYNAMICARRAY(i64_array, int64_t, DS_COMPARE_NUMBER)
+///
+/// i64_array_t *array = i64_array_new();
+/// i64_array_insert_back(array, 10);
+/// \endcode
+///
+/// \param name Prefix of every generated name.
+/// \param T The element type.
+/// \param CMP The comparator.
+#define DS_DEFINE_DYNAMICARRAY(name, T, CMP)                                   \
+                                                                               \
+typedef struct name##_s                                                        \
+{                                                                              \
+    T *buffer;                                                                 \
+    integer_t size;                                                            \
+    integer_t capacity;                                                        \
+    integer_t growth_rate;                                                     \
+    bool locked;                                                               \
+} name##_t;                                                                    \
+                                                                               \
+static inline name##_t *                                                       \
+name##_create(integer_t initial_capacity, integer_t growth_rate)               \
+{                                                                              \
+    if (initial_capacity < 1 || growth_rate <= 100)                            \
+        return NULL;                                                           \
+                                                                               \
+    name##_t *array = malloc(sizeof(name##_t));                                \
+                                                                               \
+    if (!array)                                                                \
+        return NULL;                                                           \
+                                                                               \
+    array->buffer = malloc(sizeof(T) * (size_t)initial_capacity);              \
+                                                                               \
+    if (!array->buffer)                                                        \
+    {                                                                          \
+        free(array);                                                           \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    array->size = 0;                                                           \
+    array->capacity = initial_capacity;                                        \
+    array->growth_rate = growth_rate;                                          \
+    array->locked = false;                                                     \
+                                                                               \
+    return array;                                                              \
+}                                                                              \
+                                                                               \
+static inline name##_t *                                                       \
+name##_new(void)                                                               \
+{                                                                              \
+    return name##_create(32, 200);                                             \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free(name##_t *array)                                                   \
+{                                                                              \
+    free(array->buffer);                                                       \
+    free(array);                                                               \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_erase(name##_t *array)                                                  \
+{                                                                              \
+    array->size = 0;                                                           \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_size(name##_t *array)                                                   \
+{                                                                              \
+    return array->size;                                                        \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_capacity(name##_t *array)                                               \
+{                                                                              \
+    return array->capacity;                                                    \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_get(name##_t *array, integer_t index, T *result)                        \
+{                                                                              \
+    if (index < 0 || index >= array->size)                                     \
+        return false;                                                          \
+                                                                               \
+    *result = array->buffer[index];                                            \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline T *                                                              \
+name##_data(name##_t *array)                                                   \
+{                                                                              \
+    return array->buffer;                                                      \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_set(name##_t *array, integer_t index, T element)                        \
+{                                                                              \
+    if (index < 0 || index >= array->size)                                     \
+        return false;                                                          \
+                                                                               \
+    array->buffer[index] = element;                                            \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_empty(name##_t *array)                                                  \
+{                                                                              \
+    return array->size == 0;                                                   \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_full(name##_t *array)                                                   \
+{                                                                              \
+    return array->size >= array->capacity;                                     \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_grow(name##_t *array)                                                   \
+{                                                                              \
+    if (array->locked)                                                         \
+        return false;                                                          \
+                                                                               \
+    integer_t new_capacity = (integer_t) ((double) (array->capacity)           \
+            * ((double) (array->growth_rate) / 100.0));                        \
+                                                                               \
+    /* 4 is the minimum growth */                                              \
+    if (new_capacity - array->capacity < 4)                                    \
+        new_capacity = array->capacity + 4;                                    \
+                                                                               \
+    T *new_buffer = realloc(array->buffer, sizeof(T) * (size_t)new_capacity);  \
+                                                                               \
+    if (!new_buffer)                                                           \
+        return false;                                                          \
+                                                                               \
+    array->buffer = new_buffer;                                                \
+    array->capacity = new_capacity;                                            \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_insert_back(name##_t *array, T element)                                 \
+{                                                                              \
+    if (name##_full(array) && !name##_grow(array))                             \
+        return false;                                                          \
+                                                                               \
+    array->buffer[array->size++] = element;                                    \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_insert_at(name##_t *array, T element, integer_t index)                  \
+{                                                                              \
+    if (index < 0 || index > array->size)                                      \
+        return false;                                                          \
+                                                                               \
+    if (name##_full(array) && !name##_grow(array))                             \
+        return false;                                                          \
+                                                                               \
+    memmove(array->buffer + index + 1, array->buffer + index,                  \
+            sizeof(T) * (size_t)(array->size - index));                        \
+                                                                               \
+    array->buffer[index] = element;                                            \
+    array->size++;                                                             \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_remove_at(name##_t *array, integer_t index, T *result)                  \
+{                                                                              \
+    if (index < 0 || index >= array->size)                                     \
+        return false;                                                          \
+                                                                               \
+    if (result)                                                                \
+        *result = array->buffer[index];                                        \
+                                                                               \
+    memmove(array->buffer + index, array->buffer + index + 1,                  \
+            sizeof(T) * (size_t)(array->size - index - 1));                    \
+                                                                               \
+    array->size--;                                                             \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_remove_back(name##_t *array, T *result)                                 \
+{                                                                              \
+    if (name##_empty(array))                                                   \
+        return false;                                                          \
+                                                                               \
+    array->size--;                                                             \
+                                                                               \
+    if (result)                                                                \
+        *result = array->buffer[array->size];                                  \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_index_first(name##_t *array, T key)                                     \
+{                                                                              \
+    for (integer_t i = 0; i < array->size; i++)                                \
+    {                                                                          \
+        if (CMP(array->buffer[i], key) == 0)                                   \
+            return i;                                                          \
+    }                                                                          \
+                                                                               \
+    return -1;                                                                 \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_contains(name##_t *array, T key)                                        \
+{                                                                              \
+    return name##_index_first(array, key) >= 0;                                \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_quicksort(T *buffer, integer_t size)                                    \
+{                                                                              \
+    if (size < 2)                                                              \
+        return;                                                                \
+                                                                               \
+    T pivot = buffer[size / 2];                                                \
+                                                                               \
+    integer_t i, j;                                                            \
+    for (i = 0, j = size - 1; ; i++, j--)                                      \
+    {                                                                          \
+        while (CMP(buffer[i], pivot) < 0)                                      \
+            i++;                                                               \
+                                                                               \
+        while (CMP(buffer[j], pivot) > 0)                                      \
+            j--;                                                               \
+                                                                               \
+        if (i >= j)                                                            \
+            break;                                                             \
+                                                                               \
+        T temp = buffer[i];                                                    \
+        buffer[i] = buffer[j];                                                 \
+        buffer[j] = temp;                                                      \
+    }                                                                          \
+                                                                               \
+    name##_quicksort(buffer, i);                                               \
+    name##_quicksort(buffer + i, size - i);                                    \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_sort(name##_t *array)                                                   \
+{                                                                              \
+    name##_quicksort(array->buffer, array->size);                              \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TYPEDDYNAMICARRAY_H
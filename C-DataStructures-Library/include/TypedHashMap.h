@@ -0,0 +1,336 @@
+/**
+ * @file TypedHashMap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TYPEDHASHMAP_H
+#define C_DATASTRUCTURES_LIBRARY_TYPEDHASHMAP_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Defines a hash map specialized for a key and a value type.
+///
+/// This macro generates a hash map that stores keys of type \c K and values
+/// of type \c V by value, together with all of its functions. It works just
+/// like a HashMap_s: open addressing with robin hood hashing, backward shift
+/// deletion and capacities taken from \c ds_hash_primes. Keys are hashed with
+/// \c HASH, which takes a \c K and returns an \ref unsigned_t, and compared
+/// with \c CMP, which takes two values of type \c K and returns an int
+/// following the rules of \ref compare_f. Both can be functions or
+/// function-like macros and, since they are known at compile time, the
+/// compiler is free to inline them in the probe loops.
+///
+/// All functions are <code> static inline </code>, so the macro is meant to
+/// be used once per type in a source file or in a private header. The
+/// generated names are:
+/// - \c name_t The map type and \c name_entry_t its bucket type;
+/// - \c name_new and \c name_create;
+/// - \c name_free and \c name_erase;
+/// - \c name_count and \c name_capacity;
+/// - \c name_get, \c name_insert and \c name_remove;
+/// - \c name_empty, \c name_contains and \c name_reserve.
+///
+/// \par Example
+/// \code
+/// #define HASH_I64(x) ((unsigned_t)(x))
+///
+/// DS_DEFINE_HASHMAP(i64_map, int64_t, double, HASH_I64, DS_COMPARE_NUMBER)
+///
+/// i64_map_t *map = i64_map_new();
+/// i64_map_insert(map, 10, 0.5);
+/// \endcode
+///
+/// \param name Prefix of every generated name.
+/// \param K The key type.
+/// \param V The value type.
+/// \param HASH The hash function.
+/// \param CMP The key comparator.
+#define DS_DEFINE_HASHMAP(name, K, V, HASH, CMP)                               \
+                                                                               \
+typedef struct name##_entry_s                                                  \
+{                                                                              \
+    K key;                                                                     \
+    V value;                                                                   \
+    unsigned_t hash;                                                           \
+    integer_t psl;                                                             \
+} name##_entry_t;                                                              \
+                                                                               \
+typedef struct name##_s                                                        \
+{                                                                              \
+    name##_entry_t *buffer;                                                    \
+    integer_t count;                                                           \
+    integer_t capacity;                                                        \
+    unsigned prime_index;                                                      \
+    integer_t max_load;                                                        \
+} name##_t;                                                                    \
+                                                                               \
+static inline name##_entry_t *                                                 \
+name##_new_buffer(integer_t capacity)                                          \
+{                                                                              \
+    name##_entry_t *buffer = malloc(sizeof(name##_entry_t) * (size_t)capacity);\
+                                                                               \
+    if (!buffer)                                                               \
+        return NULL;                                                           \
+                                                                               \
+    for (integer_t i = 0; i < capacity; i++)                                   \
+        buffer[i].psl = -1;                                                    \
+                                                                               \
+    return buffer;                                                             \
+}                                                                              \
+                                                                               \
+static inline name##_t *                                                       \
+name##_create(integer_t min_capacity, integer_t max_load)                      \
+{                                                                              \
+    if (max_load < 10 || max_load > 95)                                        \
+        return NULL;                                                           \
+                                                                               \
+    unsigned prime_index = 0;                                                  \
+                                                                               \
+    while (prime_index < ds_hash_primes_size &&                                \
+           ds_hash_primes[prime_index] < min_capacity)                         \
+        prime_index++;                                                         \
+                                                                               \
+    if (prime_index == ds_hash_primes_size)                                    \
+        return NULL;                                                           \
+                                                                               \
+    name##_t *map = malloc(sizeof(name##_t));                                  \
+                                                                               \
+    if (!map)                                                                  \
+        return NULL;                                                           \
+                                                                               \
+    map->buffer = name##_new_buffer(ds_hash_primes[prime_index]);              \
+                                                                               \
+    if (!map->buffer)                                                          \
+    {                                                                          \
+        free(map);                                                             \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    map->count = 0;                                                            \
+    map->capacity = ds_hash_primes[prime_index];                               \
+    map->prime_index = prime_index;                                            \
+    map->max_load = max_load;                                                  \
+                                                                               \
+    return map;                                                                \
+}                                                                              \
+                                                                               \
+static inline name##_t *                                                       \
+name##_new(void)                                                               \
+{                                                                              \
+    return name##_create(ds_hash_primes[0], 85);                               \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free(name##_t *map)                                                     \
+{                                                                              \
+    free(map->buffer);                                                         \
+    free(map);                                                                 \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_erase(name##_t *map)                                                    \
+{                                                                              \
+    for (integer_t i = 0; i < map->capacity; i++)                              \
+        map->buffer[i].psl = -1;                                               \
+                                                                               \
+    map->count = 0;                                                            \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_count(name##_t *map)                                                    \
+{                                                                              \
+    return map->count;                                                         \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_capacity(name##_t *map)                                                 \
+{                                                                              \
+    return map->capacity;                                                      \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_empty(name##_t *map)                                                    \
+{                                                                              \
+    return map->count == 0;                                                    \
+}                                                                              \
+                                                                               \
+/* Returns the bucket index of key or -1 if it is not present */               \
+static inline integer_t                                                        \
+name##_find(name##_t *map, K key, unsigned_t hash)                             \
+{                                                                              \
+    integer_t position = (integer_t)(hash % (unsigned_t)map->capacity);        \
+                                                                               \
+    for (integer_t psl = 0; ; psl++)                                           \
+    {                                                                          \
+        name##_entry_t *entry = &(map->buffer[position]);                      \
+                                                                               \
+        if (entry->psl < psl)                                                  \
+            return -1;                                                         \
+                                                                               \
+        if (entry->hash == hash && CMP(entry->key, key) == 0)                  \
+            return position;                                                   \
+                                                                               \
+        if (++position == map->capacity)                                       \
+            position = 0;                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+/* Places a new entry in a buffer that has at least one empty bucket */        \
+static inline void                                                             \
+name##_place(name##_entry_t *buffer, integer_t capacity, name##_entry_t entry) \
+{                                                                              \
+    integer_t position = (integer_t)(entry.hash % (unsigned_t)capacity);       \
+                                                                               \
+    entry.psl = 0;                                                             \
+                                                                               \
+    while (buffer[position].psl >= 0)                                          \
+    {                                                                          \
+        if (buffer[position].psl < entry.psl)                                  \
+        {                                                                      \
+            name##_entry_t temp = buffer[position];                            \
+            buffer[position] = entry;                                          \
+            entry = temp;                                                      \
+        }                                                                      \
+                                                                               \
+        entry.psl++;                                                           \
+                                                                               \
+        if (++position == capacity)                                            \
+            position = 0;                                                      \
+    }                                                                          \
+                                                                               \
+    buffer[position] = entry;                                                  \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_rehash(name##_t *map, unsigned prime_index)                             \
+{                                                                              \
+    if (prime_index >= ds_hash_primes_size)                                    \
+        return false;                                                          \
+                                                                               \
+    integer_t new_capacity = ds_hash_primes[prime_index];                      \
+                                                                               \
+    name##_entry_t *new_buffer = name##_new_buffer(new_capacity);              \
+                                                                               \
+    if (!new_buffer)                                                           \
+        return false;                                                          \
+                                                                               \
+    for (integer_t i = 0; i < map->capacity; i++)                              \
+    {                                                                          \
+        if (map->buffer[i].psl >= 0)                                           \
+            name##_place(new_buffer, new_capacity, map->buffer[i]);            \
+    }                                                                          \
+                                                                               \
+    free(map->buffer);                                                         \
+                                                                               \
+    map->buffer = new_buffer;                                                  \
+    map->capacity = new_capacity;                                              \
+    map->prime_index = prime_index;                                            \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_reserve(name##_t *map, integer_t count)                                 \
+{                                                                              \
+    if (count * 100 <= map->capacity * map->max_load)                          \
+        return true;                                                           \
+                                                                               \
+    unsigned prime_index = map->prime_index;                                   \
+                                                                               \
+    while (prime_index < ds_hash_primes_size &&                                \
+           ds_hash_primes[prime_index] * map->max_load < count * 100)          \
+        prime_index++;                                                         \
+                                                                               \
+    return name##_rehash(map, prime_index);                                    \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_get(name##_t *map, K key, V *value)                                     \
+{                                                                              \
+    integer_t position = name##_find(map, key, HASH(key));                     \
+                                                                               \
+    if (position < 0)                                                          \
+        return false;                                                          \
+                                                                               \
+    *value = map->buffer[position].value;                                      \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_contains(name##_t *map, K key)                                          \
+{                                                                              \
+    return name##_find(map, key, HASH(key)) >= 0;                              \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_insert(name##_t *map, K key, V value)                                   \
+{                                                                              \
+    unsigned_t hash = HASH(key);                                               \
+                                                                               \
+    if (name##_find(map, key, hash) >= 0)                                      \
+        return false;                                                          \
+                                                                               \
+    if ((map->count + 1) * 100 > map->capacity * map->max_load)                \
+    {                                                                          \
+        if (!name##_rehash(map, map->prime_index + 1))                         \
+            return false;                                                      \
+    }                                                                          \
+                                                                               \
+    name##_entry_t entry;                                                      \
+                                                                               \
+    entry.key = key;                                                           \
+    entry.value = value;                                                       \
+    entry.hash = hash;                                                         \
+    entry.psl = 0;                                                             \
+                                                                               \
+    name##_place(map->buffer, map->capacity, entry);                           \
+                                                                               \
+    map->count++;                                                              \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_remove(name##_t *map, K key, V *value)                                  \
+{                                                                              \
+    integer_t position = name##_find(map, key, HASH(key));                     \
+                                                                               \
+    if (position < 0)                                                          \
+        return false;                                                          \
+                                                                               \
+    if (value)                                                                 \
+        *value = map->buffer[position].value;                                  \
+                                                                               \
+    /* Backward shift deletion */                                              \
+    integer_t next = position + 1 == map->capacity ? 0 : position + 1;         \
+                                                                               \
+    while (map->buffer[next].psl > 0)                                          \
+    {                                                                          \
+        map->buffer[position] = map->buffer[next];                             \
+        map->buffer[position].psl--;                                           \
+                                                                               \
+        position = next;                                                       \
+                                                                               \
+        if (++next == map->capacity)                                           \
+            next = 0;                                                          \
+    }                                                                          \
+                                                                               \
+    map->buffer[position].psl = -1;                                            \
+    map->count--;                                                              \
+                                                                               \
+    return true;                                                               \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TYPEDHASHMAP_H
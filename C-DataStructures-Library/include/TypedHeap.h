@@ -0,0 +1,256 @@
+/**
+ * @file TypedHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TYPEDHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_TYPEDHEAP_H
+
+#include "Core.h"
+#include "Heap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Defines a binary heap specialized for a type.
+///
+/// This macro generates a binary heap that stores elements of type \c T by
+/// value, together with all of its functions. Elements are compared with
+/// \c CMP, which can be a function or a function-like macro that takes two
+/// values of type \c T and returns an int following the rules of
+/// \ref compare_f. Since the comparator is known at compile time the compiler
+/// is free to inline it in the sift loops. Like a Heap_s, the \ref HeapKind
+/// given at creation decides if it is a max-heap or a min-heap.
+///
+/// All functions are <code> static inline </code>, so the macro is meant to
+/// be used once per type in a source file or in a private header. The
+/// generated names are:
+/// - \c name_t The heap type;
+/// - \c name_new and \c name_create;
+/// - \c name_free and \c name_erase;
+/// - \c name_count, \c name_capacity and \c name_kind;
+/// - \c name_insert, \c name_remove and \c name_peek;
+/// - \c name_empty and \c name_full.
+///
+/// \par Example
+/// \code
+/// DS_DEFINE_HEAP(i64_heap, int64_t, DS_COMPARE_NUMBER)
+///
+/// i64_heap_t *heap = i64_heap_new(MinHeap);
+/// i64_heap_insert(heap, 10);
+/// \endcode
+///
+/// \param name Prefix of every generated name.
+/// \param T The element type.
+/// \param CMP The comparator.
+#define DS_DEFINE_HEAP(name, T, CMP)                                           \
+                                                                               \
+typedef struct name##_s                                                        \
+{                                                                              \
+    T *buffer;                                                                 \
+    integer_t count;                                                           \
+    integer_t capacity;                                                        \
+    integer_t growth_rate;                                                     \
+    bool locked;                                                               \
+    HeapKind kind;                                                             \
+} name##_t;                                                                    \
+                                                                               \
+static inline name##_t *                                                       \
+name##_create(integer_t size, integer_t growth_rate, HeapKind kind)            \
+{                                                                              \
+    if (size < 1 || growth_rate <= 100)                                        \
+        return NULL;                                                           \
+                                                                               \
+    if (kind != MaxHeap && kind != MinHeap)                                    \
+        return NULL;                                                           \
+                                                                               \
+    name##_t *heap = malloc(sizeof(name##_t));                                 \
+                                                                               \
+    if (!heap)                                                                 \
+        return NULL;                                                           \
+                                                                               \
+    heap->buffer = malloc(sizeof(T) * (size_t)size);                           \
+                                                                               \
+    if (!heap->buffer)                                                         \
+    {                                                                          \
+        free(heap);                                                            \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    heap->count = 0;                                                           \
+    heap->capacity = size;                                                     \
+    heap->growth_rate = growth_rate;                                           \
+    heap->locked = false;                                                      \
+    heap->kind = kind;                                                         \
+                                                                               \
+    return heap;                                                               \
+}                                                                              \
+                                                                               \
+static inline name##_t *                                                       \
+name##_new(HeapKind kind)                                                      \
+{                                                                              \
+    return name##_create(32, 200, kind);                                       \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free(name##_t *heap)                                                    \
+{                                                                              \
+    free(heap->buffer);                                                        \
+    free(heap);                                                                \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_erase(name##_t *heap)                                                   \
+{                                                                              \
+    heap->count = 0;                                                           \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_count(name##_t *heap)                                                   \
+{                                                                              \
+    return heap->count;                                                        \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_capacity(name##_t *heap)                                                \
+{                                                                              \
+    return heap->capacity;                                                     \
+}                                                                              \
+                                                                               \
+static inline HeapKind                                                         \
+name##_kind(name##_t *heap)                                                    \
+{                                                                              \
+    return heap->kind;                                                         \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_empty(name##_t *heap)                                                   \
+{                                                                              \
+    return heap->count == 0;                                                   \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_full(name##_t *heap)                                                    \
+{                                                                              \
+    return heap->count >= heap->capacity;                                      \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_grow(name##_t *heap)                                                    \
+{                                                                              \
+    if (heap->locked)                                                          \
+        return false;                                                          \
+                                                                               \
+    integer_t new_capacity = (integer_t) ((double) (heap->capacity)            \
+            * ((double) (heap->growth_rate) / 100.0));                         \
+                                                                               \
+    /* 4 is the minimum growth */                                              \
+    if (new_capacity - heap->capacity < 4)                                     \
+        new_capacity = heap->capacity + 4;                                     \
+                                                                               \
+    T *new_buffer = realloc(heap->buffer, sizeof(T) * (size_t)new_capacity);   \
+                                                                               \
+    if (!new_buffer)                                                           \
+        return false;                                                          \
+                                                                               \
+    heap->buffer = new_buffer;                                                 \
+    heap->capacity = new_capacity;                                             \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_insert(name##_t *heap, T element)                                       \
+{                                                                              \
+    if (name##_full(heap) && !name##_grow(heap))                               \
+        return false;                                                          \
+                                                                               \
+    /* mod inverts the comparator's result for min-heaps */                    \
+    const int mod = heap->kind;                                                \
+                                                                               \
+    integer_t C = heap->count++;                                               \
+                                                                               \
+    /* Move the hole up until element can be placed in it */                   \
+    while (C > 0)                                                              \
+    {                                                                          \
+        integer_t P = (C - 1) / 2;                                             \
+                                                                               \
+        if (CMP(element, heap->buffer[P]) * mod <= 0)                          \
+            break;                                                             \
+                                                                               \
+        heap->buffer[C] = heap->buffer[P];                                     \
+        C = P;                                                                 \
+    }                                                                          \
+                                                                               \
+    heap->buffer[C] = element;                                                 \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_remove(name##_t *heap, T *result)                                       \
+{                                                                              \
+    if (name##_empty(heap))                                                    \
+        return false;                                                          \
+                                                                               \
+    if (result)                                                                \
+        *result = heap->buffer[0];                                             \
+                                                                               \
+    heap->count--;                                                             \
+                                                                               \
+    if (heap->count == 0)                                                      \
+        return true;                                                           \
+                                                                               \
+    const int mod = heap->kind;                                                \
+                                                                               \
+    T element = heap->buffer[heap->count];                                     \
+                                                                               \
+    integer_t index = 0;                                                       \
+                                                                               \
+    /* Move the hole down until element can be placed in it */                 \
+    while (true)                                                               \
+    {                                                                          \
+        integer_t L = 2 * index + 1;                                           \
+        integer_t R = 2 * index + 2;                                           \
+                                                                               \
+        if (L >= heap->count)                                                  \
+            break;                                                             \
+                                                                               \
+        integer_t C = L;                                                       \
+                                                                               \
+        if (R < heap->count &&                                                 \
+            CMP(heap->buffer[R], heap->buffer[L]) * mod > 0)                   \
+            C = R;                                                             \
+                                                                               \
+        if (CMP(heap->buffer[C], element) * mod <= 0)                          \
+            break;                                                             \
+                                                                               \
+        heap->buffer[index] = heap->buffer[C];                                 \
+        index = C;                                                             \
+    }                                                                          \
+                                                                               \
+    heap->buffer[index] = element;                                             \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_peek(name##_t *heap, T *result)                                         \
+{                                                                              \
+    if (name##_empty(heap))                                                    \
+        return false;                                                          \
+                                                                               \
+    *result = heap->buffer[0];                                                 \
+                                                                               \
+    return true;                                                               \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TYPEDHEAP_H
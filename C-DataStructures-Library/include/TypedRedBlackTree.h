@@ -0,0 +1,493 @@
+/**
+ * @file TypedRedBlackTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TYPEDREDBLACKTREE_H
+#define C_DATASTRUCTURES_LIBRARY_TYPEDREDBLACKTREE_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Defines a red-black tree specialized for a type.
+///
+/// This macro generates a red-black tree whose nodes store a key of type
+/// \c T by value, together with all of its functions. Keys are compared with
+/// \c CMP, which can be a function or a function-like macro that takes two
+/// values of type \c T and returns an int following the rules of
+/// \ref compare_f. Since the comparator is known at compile time the compiler
+/// is free to inline it in the search loops. Like a RedBlackTree_s, no
+/// duplicate keys are allowed.
+///
+/// All functions are <code> static inline </code>, so the macro is meant to
+/// be used once per type in a source file or in a private header. The
+/// generated names are:
+/// - \c name_t The tree type and \c name_node_t its node type;
+/// - \c name_new, \c name_free and \c name_erase;
+/// - \c name_size and \c name_empty;
+/// - \c name_insert, \c name_remove and \c name_contains;
+/// - \c name_min and \c name_max.
+///
+/// \par Example
+/// \code
+/// DS_DEFINE_REDBLACKTREE(i64_tree, int64_t, DS_COMPARE_NUMBER)
+///
+/// i64_tree_t *tree = i64_tree_new();
+/// i64_tree_insert(tree, 10);
+/// \endcode
+///
+/// \param name Prefix of every generated name.
+/// \param T The key type.
+/// \param CMP The comparator.
+#define DS_DEFINE_REDBLACKTREE(name, T, CMP)                                   \
+                                                                               \
+typedef struct name##_node_s                                                   \
+{                                                                              \
+    T key;                                                                     \
+    struct name##_node_s *parent;                                              \
+    struct name##_node_s *left;                                                \
+    struct name##_node_s *right;                                               \
+    bool red;                                                                  \
+} name##_node_t;                                                               \
+                                                                               \
+typedef struct name##_s                                                        \
+{                                                                              \
+    name##_node_t *root;                                                       \
+    integer_t size;                                                            \
+} name##_t;                                                                    \
+                                                                               \
+static inline name##_t *                                                       \
+name##_new(void)                                                               \
+{                                                                              \
+    name##_t *tree = malloc(sizeof(name##_t));                                 \
+                                                                               \
+    if (!tree)                                                                 \
+        return NULL;                                                           \
+                                                                               \
+    tree->root = NULL;                                                         \
+    tree->size = 0;                                                            \
+                                                                               \
+    return tree;                                                               \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free_tree(name##_node_t *root)                                          \
+{                                                                              \
+    if (root == NULL)                                                          \
+        return;                                                                \
+                                                                               \
+    name##_free_tree(root->left);                                              \
+    name##_free_tree(root->right);                                             \
+                                                                               \
+    free(root);                                                                \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_erase(name##_t *tree)                                                   \
+{                                                                              \
+    name##_free_tree(tree->root);                                              \
+                                                                               \
+    tree->root = NULL;                                                         \
+    tree->size = 0;                                                            \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free(name##_t *tree)                                                    \
+{                                                                              \
+    name##_free_tree(tree->root);                                              \
+    free(tree);                                                                \
+}                                                                              \
+                                                                               \
+static inline integer_t                                                        \
+name##_size(name##_t *tree)                                                    \
+{                                                                              \
+    return tree->size;                                                         \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_empty(name##_t *tree)                                                   \
+{                                                                              \
+    return tree->size == 0;                                                    \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_is_red(name##_node_t *node)                                             \
+{                                                                              \
+    /* Leaves (NULL) are black */                                              \
+    return node != NULL && node->red;                                          \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_rotate_left(name##_t *tree, name##_node_t *X)                           \
+{                                                                              \
+    name##_node_t *Y = X->right;                                               \
+                                                                               \
+    X->right = Y->left;                                                        \
+                                                                               \
+    if (Y->left != NULL)                                                       \
+        Y->left->parent = X;                                                   \
+                                                                               \
+    Y->parent = X->parent;                                                     \
+                                                                               \
+    if (X->parent == NULL)                                                     \
+        tree->root = Y;                                                        \
+    else if (X == X->parent->left)                                             \
+        X->parent->left = Y;                                                   \
+    else                                                                       \
+        X->parent->right = Y;                                                  \
+                                                                               \
+    Y->left = X;                                                               \
+    X->parent = Y;                                                             \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_rotate_right(name##_t *tree, name##_node_t *X)                          \
+{                                                                              \
+    name##_node_t *Y = X->left;                                                \
+                                                                               \
+    X->left = Y->right;                                                        \
+                                                                               \
+    if (Y->right != NULL)                                                      \
+        Y->right->parent = X;                                                  \
+                                                                               \
+    Y->parent = X->parent;                                                     \
+                                                                               \
+    if (X->parent == NULL)                                                     \
+        tree->root = Y;                                                        \
+    else if (X == X->parent->left)                                             \
+        X->parent->left = Y;                                                   \
+    else                                                                       \
+        X->parent->right = Y;                                                  \
+                                                                               \
+    Y->right = X;                                                              \
+    X->parent = Y;                                                             \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_insert_fixup(name##_t *tree, name##_node_t *Z)                          \
+{                                                                              \
+    while (name##_is_red(Z->parent))                                           \
+    {                                                                          \
+        name##_node_t *G = Z->parent->parent;                                  \
+                                                                               \
+        if (Z->parent == G->left)                                              \
+        {                                                                      \
+            name##_node_t *Y = G->right;                                       \
+                                                                               \
+            if (name##_is_red(Y))                                              \
+            {                                                                  \
+                Z->parent->red = false;                                        \
+                Y->red = false;                                                \
+                G->red = true;                                                 \
+                Z = G;                                                         \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                if (Z == Z->parent->right)                                     \
+                {                                                              \
+                    Z = Z->parent;                                             \
+                    name##_rotate_left(tree, Z);                               \
+                }                                                              \
+                                                                               \
+                Z->parent->red = false;                                        \
+                Z->parent->parent->red = true;                                 \
+                name##_rotate_right(tree, Z->parent->parent);                  \
+            }                                                                  \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            name##_node_t *Y = G->left;                                        \
+                                                                               \
+            if (name##_is_red(Y))                                              \
+            {                                                                  \
+                Z->parent->red = false;                                        \
+                Y->red = false;                                                \
+                G->red = true;                                                 \
+                Z = G;                                                         \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                if (Z == Z->parent->left)                                      \
+                {                                                              \
+                    Z = Z->parent;                                             \
+                    name##_rotate_right(tree, Z);                              \
+                }                                                              \
+                                                                               \
+                Z->parent->red = false;                                        \
+                Z->parent->parent->red = true;                                 \
+                name##_rotate_left(tree, Z->parent->parent);                   \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    tree->root->red = false;                                                   \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_insert(name##_t *tree, T key)                                           \
+{                                                                              \
+    name##_node_t *parent = NULL;                                              \
+    name##_node_t *scan = tree->root;                                          \
+                                                                               \
+    int comparison = 0;                                                        \
+                                                                               \
+    while (scan != NULL)                                                       \
+    {                                                                          \
+        comparison = CMP(key, scan->key);                                      \
+                                                                               \
+        if (comparison == 0)                                                   \
+            return false; /* No duplicates are allowed */                      \
+                                                                               \
+        parent = scan;                                                         \
+        scan = comparison < 0 ? scan->left : scan->right;                      \
+    }                                                                          \
+                                                                               \
+    name##_node_t *node = malloc(sizeof(name##_node_t));                       \
+                                                                               \
+    if (!node)                                                                 \
+        return false;                                                          \
+                                                                               \
+    node->key = key;                                                           \
+    node->parent = parent;                                                     \
+    node->left = NULL;                                                         \
+    node->right = NULL;                                                        \
+    node->red = true;                                                          \
+                                                                               \
+    if (parent == NULL)                                                        \
+        tree->root = node;                                                     \
+    else if (comparison < 0)                                                   \
+        parent->left = node;                                                   \
+    else                                                                       \
+        parent->right = node;                                                  \
+                                                                               \
+    name##_insert_fixup(tree, node);                                           \
+                                                                               \
+    tree->size++;                                                              \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline name##_node_t *                                                  \
+name##_find(name##_t *tree, T key)                                             \
+{                                                                              \
+    name##_node_t *scan = tree->root;                                          \
+                                                                               \
+    while (scan != NULL)                                                       \
+    {                                                                          \
+        int comparison = CMP(key, scan->key);                                  \
+                                                                               \
+        if (comparison == 0)                                                   \
+            return scan;                                                       \
+                                                                               \
+        scan = comparison < 0 ? scan->left : scan->right;                      \
+    }                                                                          \
+                                                                               \
+    return NULL;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_contains(name##_t *tree, T key)                                         \
+{                                                                              \
+    return name##_find(tree, key) != NULL;                                     \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_transplant(name##_t *tree, name##_node_t *U, name##_node_t *V)          \
+{                                                                              \
+    if (U->parent == NULL)                                                     \
+        tree->root = V;                                                        \
+    else if (U == U->parent->left)                                             \
+        U->parent->left = V;                                                   \
+    else                                                                       \
+        U->parent->right = V;                                                  \
+                                                                               \
+    if (V != NULL)                                                             \
+        V->parent = U->parent;                                                 \
+}                                                                              \
+                                                                               \
+/* X might be a leaf (NULL) so its parent is given separately */               \
+static inline void                                                             \
+name##_remove_fixup(name##_t *tree, name##_node_t *X, name##_node_t *P)        \
+{                                                                              \
+    while (X != tree->root && !name##_is_red(X))                               \
+    {                                                                          \
+        if (X == P->left)                                                      \
+        {                                                                      \
+            name##_node_t *W = P->right;                                       \
+                                                                               \
+            if (name##_is_red(W))                                              \
+            {                                                                  \
+                W->red = false;                                                \
+                P->red = true;                                                 \
+                name##_rotate_left(tree, P);                                   \
+                W = P->right;                                                  \
+            }                                                                  \
+                                                                               \
+            if (!name##_is_red(W->left) && !name##_is_red(W->right))           \
+            {                                                                  \
+                W->red = true;                                                 \
+                X = P;                                                         \
+                P = X->parent;                                                 \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                if (!name##_is_red(W->right))                                  \
+                {                                                              \
+                    W->left->red = false;                                      \
+                    W->red = true;                                             \
+                    name##_rotate_right(tree, W);                              \
+                    W = P->right;                                              \
+                }                                                              \
+                                                                               \
+                W->red = P->red;                                               \
+                P->red = false;                                                \
+                W->right->red = false;                                         \
+                name##_rotate_left(tree, P);                                   \
+                X = tree->root;                                                \
+            }                                                                  \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            name##_node_t *W = P->left;                                        \
+                                                                               \
+            if (name##_is_red(W))                                              \
+            {                                                                  \
+                W->red = false;                                                \
+                P->red = true;                                                 \
+                name##_rotate_right(tree, P);                                  \
+                W = P->left;                                                   \
+            }                                                                  \
+                                                                               \
+            if (!name##_is_red(W->left) && !name##_is_red(W->right))           \
+            {                                                                  \
+                W->red = true;                                                 \
+                X = P;                                                         \
+                P = X->parent;                                                 \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                if (!name##_is_red(W->left))                                   \
+                {                                                              \
+                    W->right->red = false;                                     \
+                    W->red = true;                                             \
+                    name##_rotate_left(tree, W);                               \
+                    W = P->left;                                               \
+                }                                                              \
+                                                                               \
+                W->red = P->red;                                               \
+                P->red = false;                                                \
+                W->left->red = false;                                          \
+                name##_rotate_right(tree, P);                                  \
+                X = tree->root;                                                \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    if (X != NULL)                                                             \
+        X->red = false;                                                        \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_remove(name##_t *tree, T key)                                           \
+{                                                                              \
+    name##_node_t *Z = name##_find(tree, key);                                 \
+                                                                               \
+    if (Z == NULL)                                                             \
+        return false;                                                          \
+                                                                               \
+    name##_node_t *X, *P;                                                      \
+                                                                               \
+    bool removed_red = Z->red;                                                 \
+                                                                               \
+    if (Z->left == NULL)                                                       \
+    {                                                                          \
+        X = Z->right;                                                          \
+        P = Z->parent;                                                         \
+        name##_transplant(tree, Z, Z->right);                                  \
+    }                                                                          \
+    else if (Z->right == NULL)                                                 \
+    {                                                                          \
+        X = Z->left;                                                           \
+        P = Z->parent;                                                         \
+        name##_transplant(tree, Z, Z->left);                                   \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        /* Z's successor takes its place */                                    \
+        name##_node_t *Y = Z->right;                                           \
+                                                                               \
+        while (Y->left != NULL)                                                \
+            Y = Y->left;                                                       \
+                                                                               \
+        removed_red = Y->red;                                                  \
+        X = Y->right;                                                          \
+                                                                               \
+        if (Y->parent == Z)                                                    \
+            P = Y;                                                             \
+        else                                                                   \
+        {                                                                      \
+            P = Y->parent;                                                     \
+            name##_transplant(tree, Y, Y->right);                              \
+            Y->right = Z->right;                                               \
+            Y->right->parent = Y;                                              \
+        }                                                                      \
+                                                                               \
+        name##_transplant(tree, Z, Y);                                         \
+        Y->left = Z->left;                                                     \
+        Y->left->parent = Y;                                                   \
+        Y->red = Z->red;                                                       \
+    }                                                                          \
+                                                                               \
+    free(Z);                                                                   \
+                                                                               \
+    if (!removed_red)                                                          \
+        name##_remove_fixup(tree, X, P);                                       \
+                                                                               \
+    tree->size--;                                                              \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_min(name##_t *tree, T *result)                                          \
+{                                                                              \
+    name##_node_t *scan = tree->root;                                          \
+                                                                               \
+    if (scan == NULL)                                                          \
+        return false;                                                          \
+                                                                               \
+    while (scan->left != NULL)                                                 \
+        scan = scan->left;                                                     \
+                                                                               \
+    *result = scan->key;                                                       \
+                                                                               \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline bool                                                             \
+name##_max(name##_t *tree, T *result)                                          \
+{                                                                              \
+    name##_node_t *scan = tree->root;                                          \
+                                                                               \
+    if (scan == NULL)                                                          \
+        return false;                                                          \
+                                                                               \
+    while (scan->right != NULL)                                                \
+        scan = scan->right;                                                    \
+                                                                               \
+    *result = scan->key;                                                       \
+                                                                               \
+    return true;                                                               \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TYPEDREDBLACKTREE_H
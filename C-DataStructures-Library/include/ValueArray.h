@@ -0,0 +1,242 @@
+/**
+ * @file ValueArray.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_VALUEARRAY_H
+#define C_DATASTRUCTURES_LIBRARY_VALUEARRAY_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ValueArray_s
+/// \brief A dynamic array that stores its elements by value.
+struct ValueArray_s;
+
+/// \ref ValueArray_t
+/// \brief A type for a value array.
+///
+/// A type for a <code> struct ValueArray_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct ValueArray_s ValueArray_t;
+
+/// \ref ValueArray
+/// \brief A pointer type for a value array.
+///
+/// Defines a pointer type to <code> struct ValueArray_s </code>. This typedef
+/// is used to avoid having to declare every value array as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct ValueArray_s *ValueArray;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref var_new
+/// \brief Initializes a new value array with default parameters.
+ValueArray_t *
+var_new(Interface_t *interface, size_t element_size);
+
+/// \ref var_create
+/// \brief Initializes a new value array with custom parameters.
+ValueArray_t *
+var_create(Interface_t *interface, size_t element_size,
+           integer_t initial_capacity, integer_t growth_rate);
+
+/// \ref var_map
+/// \brief Opens a value array kept in a file mapped in memory.
+ValueArray_t *
+var_map(Interface_t *interface, const char *path, size_t element_size);
+
+/// \ref var_free
+/// \brief Frees from memory a ValueArray_s and its buffer.
+void
+var_free(ValueArray_t *array);
+
+/// \ref var_sync
+/// \brief Writes a value array kept in a file to the file.
+bool
+var_sync(ValueArray_t *array);
+
+/// \ref var_erase
+/// \brief Removes all elements from a ValueArray_s.
+void
+var_erase(ValueArray_t *array);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref var_config
+/// \brief Sets a new interface for the target value array.
+void
+var_config(ValueArray_t *array, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref var_size
+/// \brief Returns the amount of elements in the value array.
+integer_t
+var_size(ValueArray_t *array);
+
+/// \ref var_capacity
+/// \brief Returns the buffer's capacity.
+integer_t
+var_capacity(ValueArray_t *array);
+
+/// \ref var_element_size
+/// \brief Returns the size in bytes of each element.
+size_t
+var_element_size(ValueArray_t *array);
+
+/// \ref var_growth
+/// \brief Returns the buffer's growth rate.
+integer_t
+var_growth(ValueArray_t *array);
+
+/// \ref var_locked
+/// \brief Returns true if the buffer's growth is locked, false otherwise.
+bool
+var_locked(ValueArray_t *array);
+
+/// \ref var_get
+/// \brief Returns a pointer to the element at a given index.
+void *
+var_get(ValueArray_t *array, integer_t index);
+
+/// \ref var_data
+/// \brief Returns a pointer to the first element of the buffer.
+void *
+var_data(ValueArray_t *array);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref var_set_growth
+/// \brief Sets a new growth rate to the buffer.
+bool
+var_set_growth(ValueArray_t *array, integer_t growth_rate);
+
+/// \ref var_capacity_lock
+/// \brief Locks the buffer's growth.
+void
+var_capacity_lock(ValueArray_t *array);
+
+/// \ref var_capacity_unlock
+/// \brief Unlocks the buffer's growth.
+void
+var_capacity_unlock(ValueArray_t *array);
+
+/// \ref var_set
+/// \brief Overwrites the element at a given index.
+bool
+var_set(ValueArray_t *array, integer_t index, const void *element);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref var_insert
+/// \brief Inserts many elements at a given index.
+bool
+var_insert(ValueArray_t *array, const void *elements, integer_t count,
+           integer_t index);
+
+/// \ref var_insert_at
+/// \brief Inserts an element at a given index.
+bool
+var_insert_at(ValueArray_t *array, const void *element, integer_t index);
+
+/// \ref var_insert_back
+/// \brief Inserts an element at the end of the array.
+bool
+var_insert_back(ValueArray_t *array, const void *element);
+
+/// \ref var_remove_at
+/// \brief Removes the element at a given index.
+bool
+var_remove_at(ValueArray_t *array, integer_t index, void *result);
+
+/// \ref var_remove_back
+/// \brief Removes the element at the end of the array.
+bool
+var_remove_back(ValueArray_t *array, void *result);
+
+/// \ref var_peek_back
+/// \brief Returns a pointer to the element at the end of the array.
+void *
+var_peek_back(ValueArray_t *array);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref var_empty
+/// \brief Returns true if the array is empty, otherwise false.
+bool
+var_empty(ValueArray_t *array);
+
+/// \ref var_full
+/// \brief Returns true if the array is full, otherwise false.
+bool
+var_full(ValueArray_t *array);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref var_reserve
+/// \brief Makes sure the buffer can hold a given amount of elements.
+bool
+var_reserve(ValueArray_t *array, integer_t capacity);
+
+/// \ref var_index_first
+/// \brief Returns the index of the first element that matches a key.
+integer_t
+var_index_first(ValueArray_t *array, const void *key);
+
+/// \ref var_contains
+/// \brief Returns true if an element is present in the array.
+bool
+var_contains(ValueArray_t *array, const void *key);
+
+/// \ref var_max
+/// \brief Returns the index of the greatest element.
+integer_t
+var_max(ValueArray_t *array);
+
+/// \ref var_min
+/// \brief Returns the index of the smallest element.
+integer_t
+var_min(ValueArray_t *array);
+
+/// \ref var_sort
+/// \brief Sorts the array using the interface's compare function.
+void
+var_sort(ValueArray_t *array);
+
+/// \ref var_copy
+/// \brief Makes a copy of the array and all of its elements.
+ValueArray_t *
+var_copy(ValueArray_t *array);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref var_display
+/// \brief Displays a ValueArray_s in the console.
+void
+var_display(ValueArray_t *array, int display_mode);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueArrayIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueArrayWrapper
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_VALUEARRAY_H
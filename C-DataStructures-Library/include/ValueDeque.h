@@ -0,0 +1,196 @@
+/**
+ * @file ValueDeque.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_VALUEDEQUE_H
+#define C_DATASTRUCTURES_LIBRARY_VALUEDEQUE_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ValueDeque_s
+/// \brief An array-based double-ended queue that stores its elements by value.
+struct ValueDeque_s;
+
+/// \ref ValueDeque_t
+/// \brief A type for a value deque.
+///
+/// A type for a <code> struct ValueDeque_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct ValueDeque_s ValueDeque_t;
+
+/// \ref ValueDeque
+/// \brief A pointer type for a value deque.
+///
+/// Defines a pointer type to <code> struct ValueDeque_s </code>. This typedef
+/// is used to avoid having to declare every value deque as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct ValueDeque_s *ValueDeque;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref vdq_new
+/// \brief Initializes a new value deque with default parameters.
+ValueDeque_t *
+vdq_new(Interface_t *interface, size_t element_size);
+
+/// \ref vdq_create
+/// \brief Initializes a new value deque with custom parameters.
+ValueDeque_t *
+vdq_create(Interface_t *interface, size_t element_size,
+           integer_t initial_capacity, integer_t growth_rate);
+
+/// \ref vdq_free
+/// \brief Frees from memory a ValueDeque_s and its buffer.
+void
+vdq_free(ValueDeque_t *deque);
+
+/// \ref vdq_erase
+/// \brief Removes all elements from a ValueDeque_s.
+void
+vdq_erase(ValueDeque_t *deque);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref vdq_config
+/// \brief Sets a new interface for the target value deque.
+void
+vdq_config(ValueDeque_t *deque, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref vdq_count
+/// \brief Returns the amount of elements in the value deque.
+integer_t
+vdq_count(ValueDeque_t *deque);
+
+/// \ref vdq_capacity
+/// \brief Returns the buffer's capacity.
+integer_t
+vdq_capacity(ValueDeque_t *deque);
+
+/// \ref vdq_element_size
+/// \brief Returns the size in bytes of each element.
+size_t
+vdq_element_size(ValueDeque_t *deque);
+
+/// \ref vdq_growth
+/// \brief Returns the buffer's growth rate.
+integer_t
+vdq_growth(ValueDeque_t *deque);
+
+/// \ref vdq_locked
+/// \brief Returns true if the buffer's growth is locked, false otherwise.
+bool
+vdq_locked(ValueDeque_t *deque);
+
+/// \ref vdq_get
+/// \brief Returns a pointer to the element at a given position from the front.
+void *
+vdq_get(ValueDeque_t *deque, integer_t index);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref vdq_set_growth
+/// \brief Sets a new growth rate to the buffer.
+bool
+vdq_set_growth(ValueDeque_t *deque, integer_t growth_rate);
+
+/// \ref vdq_capacity_lock
+/// \brief Locks the buffer's growth.
+void
+vdq_capacity_lock(ValueDeque_t *deque);
+
+/// \ref vdq_capacity_unlock
+/// \brief Unlocks the buffer's growth.
+void
+vdq_capacity_unlock(ValueDeque_t *deque);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref vdq_enqueue_front
+/// \brief Inserts an element at the front of the deque.
+bool
+vdq_enqueue_front(ValueDeque_t *deque, const void *element);
+
+/// \ref vdq_enqueue_rear
+/// \brief Inserts an element at the rear of the deque.
+bool
+vdq_enqueue_rear(ValueDeque_t *deque, const void *element);
+
+/// \ref vdq_dequeue_front
+/// \brief Removes an element from the front of the deque.
+bool
+vdq_dequeue_front(ValueDeque_t *deque, void *result);
+
+/// \ref vdq_dequeue_rear
+/// \brief Removes an element from the rear of the deque.
+bool
+vdq_dequeue_rear(ValueDeque_t *deque, void *result);
+
+/// \ref vdq_peek_front
+/// \brief Returns a pointer to the front element of the deque.
+void *
+vdq_peek_front(ValueDeque_t *deque);
+
+/// \ref vdq_peek_rear
+/// \brief Returns a pointer to the rear element of the deque.
+void *
+vdq_peek_rear(ValueDeque_t *deque);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref vdq_empty
+/// \brief Returns true if the deque is empty, false otherwise.
+bool
+vdq_empty(ValueDeque_t *deque);
+
+/// \ref vdq_full
+/// \brief Returns true if the deque is full, false otherwise.
+bool
+vdq_full(ValueDeque_t *deque);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref vdq_contains
+/// \brief Returns true if an element is present in the deque.
+bool
+vdq_contains(ValueDeque_t *deque, const void *key);
+
+/// \ref vdq_copy
+/// \brief Makes a copy of the deque and all of its elements.
+ValueDeque_t *
+vdq_copy(ValueDeque_t *deque);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref vdq_display
+/// \brief Displays a ValueDeque_s in the console.
+void
+vdq_display(ValueDeque_t *deque, int display_mode);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueDequeIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueDequeWrapper
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_VALUEDEQUE_H
@@ -0,0 +1,177 @@
+/**
+ * @file ValueHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_VALUEHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_VALUEHEAP_H
+
+#include "Core.h"
+#include "Heap.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ValueHeap_s
+/// \brief An array-based binary heap that stores its elements by value.
+struct ValueHeap_s;
+
+/// \ref ValueHeap_t
+/// \brief A type for a value heap.
+///
+/// A type for a <code> struct ValueHeap_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct ValueHeap_s ValueHeap_t;
+
+/// \ref ValueHeap
+/// \brief A pointer type for a value heap.
+///
+/// Defines a pointer type to <code> struct ValueHeap_s </code>. This typedef
+/// is used to avoid having to declare every value heap as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct ValueHeap_s *ValueHeap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref vhp_new
+/// \brief Initializes a new value heap with default parameters.
+ValueHeap_t *
+vhp_new(Interface_t *interface, size_t element_size, HeapKind kind);
+
+/// \ref vhp_create
+/// \brief Initializes a new value heap with custom parameters.
+ValueHeap_t *
+vhp_create(Interface_t *interface, size_t element_size, integer_t size,
+           integer_t growth_rate, HeapKind kind);
+
+/// \ref vhp_free
+/// \brief Frees from memory a ValueHeap_s and its buffer.
+void
+vhp_free(ValueHeap_t *heap);
+
+/// \ref vhp_erase
+/// \brief Removes all elements from a ValueHeap_s.
+void
+vhp_erase(ValueHeap_t *heap);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref vhp_config
+/// \brief Sets a new interface for the target value heap.
+void
+vhp_config(ValueHeap_t *heap, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref vhp_count
+/// \brief Returns the amount of elements in the value heap.
+integer_t
+vhp_count(ValueHeap_t *heap);
+
+/// \ref vhp_capacity
+/// \brief Returns the buffer's capacity.
+integer_t
+vhp_capacity(ValueHeap_t *heap);
+
+/// \ref vhp_element_size
+/// \brief Returns the size in bytes of each element.
+size_t
+vhp_element_size(ValueHeap_t *heap);
+
+/// \ref vhp_growth
+/// \brief Returns the buffer's growth rate.
+integer_t
+vhp_growth(ValueHeap_t *heap);
+
+/// \ref vhp_locked
+/// \brief Returns true if the buffer's growth is locked, false otherwise.
+bool
+vhp_locked(ValueHeap_t *heap);
+
+/// \ref vhp_kind
+/// \brief Returns the kind of the value heap.
+HeapKind
+vhp_kind(ValueHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref vhp_set_growth
+/// \brief Sets a new growth rate to the buffer.
+bool
+vhp_set_growth(ValueHeap_t *heap, integer_t growth_rate);
+
+/// \ref vhp_capacity_lock
+/// \brief Locks the buffer's growth.
+void
+vhp_capacity_lock(ValueHeap_t *heap);
+
+/// \ref vhp_capacity_unlock
+/// \brief Unlocks the buffer's growth.
+void
+vhp_capacity_unlock(ValueHeap_t *heap);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref vhp_insert
+/// \brief Inserts an element into the value heap.
+bool
+vhp_insert(ValueHeap_t *heap, const void *element);
+
+/// \ref vhp_remove
+/// \brief Removes the root element of the value heap.
+bool
+vhp_remove(ValueHeap_t *heap, void *result);
+
+/// \ref vhp_peek
+/// \brief Returns a pointer to the root element of the value heap.
+void *
+vhp_peek(ValueHeap_t *heap);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref vhp_empty
+/// \brief Returns true if the heap is empty, false otherwise.
+bool
+vhp_empty(ValueHeap_t *heap);
+
+/// \ref vhp_full
+/// \brief Returns true if the heap is full, false otherwise.
+bool
+vhp_full(ValueHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref vhp_copy
+/// \brief Makes a copy of the heap and all of its elements.
+ValueHeap_t *
+vhp_copy(ValueHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref vhp_display
+/// \brief Displays a ValueHeap_s in the console.
+void
+vhp_display(ValueHeap_t *heap, int display_mode);
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueHeapIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueHeapWrapper
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_VALUEHEAP_H
@@ -11,13 +11,20 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Benchmark.h"
 
-void AssociativeListBench(void);
+void AssociativeListBench(Benchmark_t *bench);
 
-void AVLTreeBench(void);
+void AVLTreeBench(Benchmark_t *bench);
 
-void HeapBench(void);
+void ComparisonBench(Benchmark_t *bench);
 
-void RedBlackTreeBench(void);
+void HeapBench(Benchmark_t *bench);
+
+void RedBlackTreeBench(Benchmark_t *bench);
+
+void ReplayBench(Benchmark_t *bench);
+
+void ThreadedBench(Benchmark_t *bench);
 
 #endif //C_DATASTRUCTURES_LIBRARY_BENCHMARKS_H
@@ -0,0 +1,61 @@
+/**
+ * @file Config.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CONFIG_H
+#define C_DATASTRUCTURES_LIBRARY_CONFIG_H
+
+/// Compile-time configuration of the library. Each switch below is off by
+/// default and can be turned on with a <code> -D </code> flag or, for all of
+/// them at once, in a header of your own given to CMake with
+/// <code> cmake -DDS_CONFIG_FILE=/path/to/config.h </code>, which is included
+/// here before anything else. The library and everything that uses it must
+/// be compiled with the same switches since they change the layout of the
+/// structures and the types of the functions.
+#ifdef DS_CONFIG_FILE
+#include DS_CONFIG_FILE
+#endif
+
+/// \c DS_SMALL_SIZES makes integer_t a 32-bit integer instead of intmax_t.
+/// Sizes, capacities, indexes and growth rates of every container take half
+/// the space, which adds up across millions of small containers, but no
+/// container can hold more than 2^31 - 1 elements.
+#ifdef DS_SMALL_SIZES
+#define DS_INTEGER_MAX INT32_MAX
+#define DS_PRI_INTEGER PRId32
+#else
+#define DS_INTEGER_MAX INTMAX_MAX
+#define DS_PRI_INTEGER PRIdMAX
+#endif
+
+/// \c DS_NO_VERSION_ID removes the version_id that DynamicArray_s,
+/// StackArray_s, QueueArray_s, DequeArray_s, Heap_s and the list-backed
+/// stack, queue and deque increment on every change. Their iterators no
+/// longer notice when the container is modified behind them, so it is up to
+/// the caller not to do that.
+#ifdef DS_NO_VERSION_ID
+#define DS_VERSION_RESET(container) ((void)0)
+#define DS_VERSION_BUMP(container) ((void)0)
+#define DS_VERSION_SYNC(iter, container) ((void)0)
+#define DS_VERSION_CHANGED(iter, container) false
+#else
+#define DS_VERSION_RESET(container) ((container)->version_id = 0)
+#define DS_VERSION_BUMP(container) ((container)->version_id++)
+#define DS_VERSION_SYNC(iter, container) \
+    ((iter)->target_id = (container)->version_id)
+#define DS_VERSION_CHANGED(iter, container) \
+    ((iter)->target_id != (container)->version_id)
+#endif
+
+/// \c DS_NO_LIMIT removes the element limit of the list-backed stack, queue
+/// and deque. Their \c set_limit functions only accept 0 and they are never
+/// full.
+
+/// \c DS_NO_DISPLAY removes the display functions of the same containers as
+/// DS_NO_VERSION_ID.
+
+#endif //C_DATASTRUCTURES_LIBRARY_CONFIG_H
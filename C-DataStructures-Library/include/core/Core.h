@@ -17,6 +17,8 @@
 #include <string.h>
 #include <time.h>
 
+#include "Config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -78,10 +80,166 @@ enum Status
 /// Defines a type to an <code> enum Status </code>
 typedef enum Status Status;
 
+#ifdef DS_SMALL_SIZES
+typedef int32_t integer_t;
+#else
 typedef intmax_t integer_t;
+#endif
 
 typedef uintmax_t unsigned_t;
 
+/// Compares two numbers following the rules of \ref compare_f. Meant to be
+/// used as the comparator of the type-specialized structures.
+#define DS_COMPARE_NUMBER(a, b) (((a) > (b)) - ((a) < (b)))
+
+/// Hints the processor to start loading the memory at \c address into the
+/// cache, for reading. Does nothing on compilers without such a hint. Meant
+/// for loops over the spans of array-backed containers, to load the elements
+/// that a few iterations ahead will point to. The spans given by functions
+/// like dar_span() or qar_span() are plain arrays, so a loop over one has no
+/// call or version check per element and can be vectorised.
+#if defined(__GNUC__) || defined(__clang__)
+#define DS_PREFETCH(address) __builtin_prefetch((address), 0, 3)
+#else
+#define DS_PREFETCH(address) ((void)(address))
+#endif
+
+/// Size in bytes assumed for a cache line. Fields written by different
+/// threads are kept this far apart so that a write by one thread doesn't
+/// invalidate the line another thread is reading (false sharing). Can be
+/// changed with <code> cmake -DDS_CACHE_LINE=128 </code>.
+#ifndef DS_CACHE_LINE
+#define DS_CACHE_LINE 64
+#endif
+
+/// Alignment in bytes of the element buffers of the array-backed containers,
+/// a power of two. With zero, the default, buffers have the alignment of
+/// malloc(). With DS_CACHE_LINE, a buffer never shares its first cache line
+/// with another allocation and a given range of elements always touches the
+/// same amount of lines. Set with
+/// <code> cmake -DDS_BUFFER_ALIGNMENT=64 </code>.
+#ifndef DS_BUFFER_ALIGNMENT
+#define DS_BUFFER_ALIGNMENT 0
+#endif
+
+/// Allocates an element buffer of \c size bytes aligned to
+/// DS_BUFFER_ALIGNMENT. It is freed with free().
+static inline void *
+ds_buffer_alloc(size_t size)
+{
+#if DS_BUFFER_ALIGNMENT > 0
+    // aligned_alloc() requires a size that is a multiple of the alignment
+    size = (size + DS_BUFFER_ALIGNMENT - 1)
+           / DS_BUFFER_ALIGNMENT * DS_BUFFER_ALIGNMENT;
+
+    return aligned_alloc(DS_BUFFER_ALIGNMENT,
+                         size > 0 ? size : DS_BUFFER_ALIGNMENT);
+#else
+    return malloc(size);
+#endif
+}
+
+/// Resizes an element buffer from \c old_size to \c size bytes. Like
+/// realloc(), the buffer is left intact if allocation fails.
+static inline void *
+ds_buffer_realloc(void *buffer, size_t old_size, size_t size)
+{
+#if DS_BUFFER_ALIGNMENT > 0
+    // realloc() only keeps the alignment of malloc()
+    void *result = ds_buffer_alloc(size);
+
+    if (result && buffer)
+    {
+        memcpy(result, buffer, old_size < size ? old_size : size);
+        free(buffer);
+    }
+
+    return result;
+#else
+    (void)old_size;
+
+    return realloc(buffer, size);
+#endif
+}
+
+/// Size in bytes of a memory page, used by DS_GROWTH_PAGES.
+#ifndef DS_PAGE_SIZE
+#define DS_PAGE_SIZE 4096
+#endif
+
+/// \brief How an array-backed container computes the capacity of a bigger
+/// buffer.
+///
+/// Set with the \c set_policy function of each container. All of them grow
+/// by at least 4 elements and to at least the capacity an operation needs.
+enum GrowthPolicy_e
+{
+    /// <code> capacity * growth_rate / 100 </code>. The default.
+    DS_GROWTH_GEOMETRIC = 0,
+
+    /// <code> capacity * 1.5 </code>. Since this is less than the golden
+    /// ratio, the blocks freed by earlier growths eventually add up to the
+    /// size of the next one and an allocator can reuse them.
+    DS_GROWTH_GOLDEN = 1,
+
+    /// <code> capacity + step </code>. Wastes at most \c step elements but
+    /// each growth copies the whole buffer, so it is meant for containers
+    /// with a known bound.
+    DS_GROWTH_STEP = 2,
+
+    /// Like DS_GROWTH_GEOMETRIC but buffers bigger than a page are rounded
+    /// up to whole pages. Big buffers are mapped directly by the allocator;
+    /// the rounding uses all of the last page and lets realloc() remap them
+    /// instead of copying.
+    DS_GROWTH_PAGES = 3
+};
+
+/// Defines a type to an <code> enum GrowthPolicy_e </code>
+typedef enum GrowthPolicy_e GrowthPolicy;
+
+/// Returns the capacity a buffer of elements of \c size bytes grows to.
+///
+/// \param[in] policy The growth policy.
+/// \param[in] capacity The current capacity.
+/// \param[in] required The capacity needed by the operation.
+/// \param[in] growth_rate The growth rate of DS_GROWTH_GEOMETRIC and
+/// DS_GROWTH_PAGES.
+/// \param[in] step The step of DS_GROWTH_STEP.
+/// \param[in] size The size of each element.
+///
+/// \return The new capacity.
+static inline integer_t
+ds_grown_capacity(GrowthPolicy policy, integer_t capacity, integer_t required,
+                  integer_t growth_rate, integer_t step, size_t size)
+{
+    integer_t result;
+
+    if (policy == DS_GROWTH_GOLDEN)
+        result = capacity + capacity / 2;
+    else if (policy == DS_GROWTH_STEP)
+        result = capacity + step;
+    else
+        result = (integer_t) ((double) capacity *
+                              ((double) growth_rate / 100.0));
+
+    // 4 is the minimum growth
+    if (result - capacity < 4)
+        result = capacity + 4;
+
+    if (result < required)
+        result = required;
+
+    if (policy == DS_GROWTH_PAGES && (size_t)result * size > DS_PAGE_SIZE)
+    {
+        size_t bytes = ((size_t)result * size + DS_PAGE_SIZE - 1)
+                       / DS_PAGE_SIZE * DS_PAGE_SIZE;
+
+        result = (integer_t)(bytes / size);
+    }
+
+    return result;
+}
+
 /// Prime numbers used for hashing
 /// https://planetmath.org/goodhashtableprimes
 static const integer_t ds_hash_primes[] = {
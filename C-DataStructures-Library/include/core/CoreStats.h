@@ -0,0 +1,91 @@
+/**
+ * @file CoreStats.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CORESTATS_H
+#define C_DATASTRUCTURES_LIBRARY_CORESTATS_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Counters of the work done inside a container.
+///
+/// Containers only count when the library is compiled with \c DS_STATS
+/// defined, for example with <code> cmake -DDS_STATS=ON </code>. Otherwise
+/// the counters are not part of the containers and every function that
+/// reads them returns false, so they cost nothing.
+struct ContainerStats_s
+{
+    /// \brief Calls to the compare function of the interface.
+    unsigned_t compares;
+
+    /// \brief Calls to the copy function of the interface.
+    unsigned_t copies;
+
+    /// \brief Elements freed through the interface.
+    unsigned_t frees;
+
+    /// \brief Blocks of memory allocated by the container itself.
+    unsigned_t allocations;
+
+    /// \brief Bytes of memory currently held by the container itself, not
+    /// counting its elements.
+    unsigned_t bytes;
+
+    /// \brief Times a buffer was reallocated to grow or shrink.
+    unsigned_t grows;
+
+    /// \brief Rotations done to keep a tree balanced.
+    unsigned_t rotations;
+
+    /// \brief Levels elements moved up or down while sifting a heap.
+    unsigned_t sifts;
+};
+
+/// \ref ContainerStats_t
+/// \brief A type for the counters of a container.
+typedef struct ContainerStats_s ContainerStats_t;
+
+// The macros below are only meant to be used by the containers. They take a
+// container that has a ContainerStats_t field named stats when DS_STATS is
+// defined, and expand to nothing otherwise.
+
+#ifdef DS_STATS
+
+#define DS_STATS_ADD(c, counter, amount) \
+    ((c)->stats.counter += (unsigned_t)(amount))
+
+#define DS_STATS_RESET(c) \
+    memset(&(c)->stats, 0, sizeof(ContainerStats_t))
+
+// Copies the counters to a ContainerStats_t and evaluates to true
+#define DS_STATS_GET(c, out) \
+    (*(out) = (c)->stats, true)
+
+#else
+
+#define DS_STATS_ADD(c, counter, amount) ((void)0)
+
+#define DS_STATS_RESET(c) ((void)0)
+
+#define DS_STATS_GET(c, out) \
+    (memset((out), 0, sizeof(ContainerStats_t)), false)
+
+#endif
+
+// Calls the compare function of the interface of a container
+#define DS_STATS_COMPARE(c, a, b) \
+    (DS_STATS_ADD(c, compares, 1), (c)->interface->compare((a), (b)))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_CORESTATS_H
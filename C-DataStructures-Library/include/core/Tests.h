@@ -18,6 +18,10 @@ extern "C" {
 
 // Includes all test functions
 
+Status AdaptiveRadixTreeTests(void);
+
+Status ArenaTests(void);
+
 Status ArrayTests(void);
 
 Status AssociativeListTests(void);
@@ -28,34 +32,116 @@ Status BinarySearchTreeTests(void);
 
 Status BitArrayTests(void);
 
+Status BloomFilterTests(void);
+
+Status BPlusTreeTests(void);
+
+Status CacheTests(void);
+
+Status ChannelTests(void);
+
 Status CircularLinkedListTests(void);
 
+Status ClockTests(void);
+
+Status CompactRedBlackTreeTests(void);
+
+Status CountMinSketchTests(void);
+
 Status DequeArrayTests(void);
 
 Status DequeListTests(void);
 
+Status DequeStealingTests(void);
+
 Status DoublyLinkedListTests(void);
 
 Status DynamicArrayTests(void);
 
+Status EpochReclaimerTests(void);
+
+Status FenwickTreeTests(void);
+
+Status GraphTests(void);
+
+Status HashMapTests(void);
+
+Status HashTableTests(void);
+
 Status HeapTests(void);
 
+Status InternTableTests(void);
+
+Status IntrusiveAVLTreeTests(void);
+
+Status IntrusiveListTests(void);
+
+Status IntrusiveRedBlackTreeTests(void);
+
+Status NodePoolTests(void);
+
+Status PagedBitArrayTests(void);
+
 Status PriorityListTests(void);
 
+Status QuantileSketchTests(void);
+
 Status QueueArrayTests(void);
 
 Status QueueListTests(void);
 
+Status QueueMPMCTests(void);
+
+Status QueueSPSCTests(void);
+
 Status RedBlackTreeTests(void);
 
+Status RoaringBitmapTests(void);
+
+Status RopeTests(void);
+
+Status SegmentTreeTests(void);
+
+Status ShardedTests(void);
+
 Status SinglyLinkedListTests(void);
 
+Status SkipListTests(void);
+
+Status SortTests(void);
+
 Status SortedListTests(void);
 
 Status StackArrayTests(void);
 
 Status StackListTests(void);
 
+Status StaticSortedSetTests(void);
+
+Status StringTests(void);
+
+Status SynchronizedTests(void);
+
+Status ThreadPoolTests(void);
+
+Status TimerWheelTests(void);
+
+Status TopKTests(void);
+
+Status TraceTests(void);
+
+Status TypedContainerTests(void);
+
+Status UtilityTests(void);
+
+Status ValueArrayTests(void);
+
+Status ValueDequeTests(void);
+
+Status ValueHeapTests(void);
+
+Status WorkloadTests(void);
+
 #ifdef __cplusplus
 }
 #endif
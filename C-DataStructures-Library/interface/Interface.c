@@ -35,6 +35,10 @@ interface_new(compare_f compare, copy_f copy, display_f display, free_f free,
     interface->free = free;
     interface->hash = hash;
     interface->priority = priority;
+    interface->copy_alloc = NULL;
+    interface->allocator = NULL;
+    interface->serialize = NULL;
+    interface->deserialize = NULL;
 
     return interface;
 }
@@ -60,6 +64,10 @@ interface_init(Interface_t *interface, compare_f compare, copy_f copy,
     interface->free = free;
     interface->hash = hash;
     interface->priority = priority;
+    interface->copy_alloc = NULL;
+    interface->allocator = NULL;
+    interface->serialize = NULL;
+    interface->deserialize = NULL;
 }
 
 /// Changes the configuration of an interface. Any NULL parameters are ignored
@@ -91,6 +99,69 @@ interface_config(Interface_t *interface,
         interface->priority = priority;
 }
 
+/// Sets a custom allocator to an interface. From now on, copies are made with
+/// \c copy_alloc from the given allocator and elements are released with the
+/// allocator's deallocation function. Pass in both parameters as NULL to go
+/// back to using the copy and free functions.
+///
+/// \param interface An interface to be changed.
+/// \param copy_alloc A copy function that uses an allocator.
+/// \param allocator The allocator where copies are allocated from.
+void
+interface_allocator(Interface_t *interface, copy_alloc_f copy_alloc,
+                    Allocator_t *allocator)
+{
+    interface->copy_alloc = copy_alloc;
+    interface->allocator = allocator;
+}
+
+/// Sets the functions that write elements to a stream and read them back,
+/// used by functions that save and restore whole structures like dar_save()
+/// and dar_restore(). Pass in both parameters as NULL to remove them.
+///
+/// \param interface An interface to be changed.
+/// \param serialize A function that writes an element to a stream.
+/// \param deserialize A function that reads back an element.
+void
+interface_serializer(Interface_t *interface, serialize_f serialize,
+                     deserialize_f deserialize)
+{
+    interface->serialize = serialize;
+    interface->deserialize = deserialize;
+}
+
+/// Makes a copy of an element. If the interface has an allocator the copy is
+/// allocated from it, otherwise the interface's copy function is used.
+///
+/// \param interface The interface of the element.
+/// \param element The element to be copied.
+///
+/// \return A copy of the element or NULL if allocation failed.
+void *
+interface_copy(Interface_t *interface, const void *element)
+{
+    if (interface->allocator)
+        return interface->copy_alloc(element, interface->allocator);
+
+    return interface->copy(element);
+}
+
+/// Releases an element. If the interface has an allocator the element is
+/// given back to it, otherwise the interface's free function is used.
+///
+/// \param interface The interface of the element.
+/// \param element The element to be released.
+void
+interface_release(Interface_t *interface, void *element)
+{
+    Allocator_t *allocator = interface->allocator;
+
+    if (!allocator)
+        interface->free(element);
+    else if (allocator->dealloc)
+        allocator->dealloc(allocator->context, element);
+}
+
 /// Frees from memory the specified interface.
 ///
 /// \param interface The interface to be deallocated.
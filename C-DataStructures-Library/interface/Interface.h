@@ -46,6 +46,43 @@ typedef void(*free_f)(void *);
 /// A function that returns a hash number for a given element.
 typedef unsigned_t(*hash_f)(const void *);
 
+/// \brief A function that returns a radix sort key for a given element.
+///
+/// A function that maps an element to an unsigned key such that comparing two
+/// keys as unsigned integers orders the elements. Used by radix sorts instead
+/// of a \ref compare_f and by some structures to keep keys inline.
+typedef uint64_t(*key_f)(const void *);
+
+/// \brief A function called for each element visited by a structure.
+///
+/// Receives the element and a user defined argument. Used by traversals and
+/// range queries.
+typedef void(*visit_f)(void *, void *);
+
+/// \brief A function that makes a new element out of another one.
+///
+/// Receives the element and a user defined argument and returns the new
+/// element or NULL if it could not be made. Used by bulk operations.
+typedef void *(*map_f)(const void *, void *);
+
+/// \brief A function that tells if an element should be kept.
+///
+/// Receives the element and a user defined argument. Used by bulk operations
+/// to filter elements.
+typedef bool(*predicate_f)(const void *, void *);
+
+/// \brief A function that folds a value into an accumulator.
+///
+/// Receives the accumulator and either an element or another accumulator to
+/// be folded into it. Used by bulk operations.
+typedef void(*reduce_f)(void *, const void *);
+
+/// \brief A function that applies an update to an aggregate.
+///
+/// Receives the aggregate of a range, the update and the amount of elements
+/// in the range. Used by segment trees for range updates.
+typedef void(*apply_f)(void *, const void *, integer_t);
+
 /// \brief A function that compares the priority of two elements.
 ///
 /// This function is used when comparing the priority of two elements. The
@@ -58,6 +95,55 @@ typedef unsigned_t(*hash_f)(const void *);
 /// - <code>[ 0 ]</code> if elements have the same priority.
 typedef int(*priority_f)(const void *, const void *);
 
+/// \brief Allocation function.
+///
+/// A function that allocates \c size bytes from a given allocator context.
+/// Returns NULL if allocation failed.
+typedef void *(*alloc_f)(void *, size_t);
+
+/// \brief Deallocation function.
+///
+/// A function that gives a block of memory back to an allocator context.
+typedef void(*dealloc_f)(void *, void *);
+
+/// \brief A custom memory allocator.
+///
+/// An allocator is a pair of allocation and deallocation functions that
+/// operate on a given context, like an arena or a pool. The deallocation
+/// function may be NULL for allocators that release all of their memory at
+/// once, in which case releasing an element does nothing.
+struct Allocator_s
+{
+    alloc_f alloc;
+
+    dealloc_f dealloc;
+
+    void *context;
+};
+
+typedef struct Allocator_s Allocator_t;
+
+typedef struct Allocator_s *Allocator;
+
+/// \brief Copy function using a custom allocator.
+///
+/// A function that returns an exact copy of an element allocated from the
+/// given allocator.
+typedef void *(*copy_alloc_f)(const void *, Allocator_t *);
+
+/// \brief A function that writes an element to a stream.
+///
+/// Writes the element to the stream in a form that the matching
+/// \ref deserialize_f can read back. Returns false if writing failed.
+typedef bool(*serialize_f)(const void *, FILE *);
+
+/// \brief A function that reads an element from a stream.
+///
+/// Reads an element written by the matching \ref serialize_f and returns it
+/// in memory that the interface's free function can release. Returns NULL if
+/// reading or allocation failed.
+typedef void *(*deserialize_f)(FILE *);
+
 /// \brief An interface used by all data structures that stores functions for a
 /// user defined data type.
 ///
@@ -75,7 +161,20 @@ typedef int(*priority_f)(const void *, const void *);
 /// - hash - Creates a hash number from a single element according to the
 /// specification of \ref hash_f;
 /// - priority - A function that compares the priority of two elements
-/// according to the specification of \ref priority_f.
+/// according to the specification of \ref priority_f;
+/// - copy_alloc - Makes a copy of an element using a custom allocator
+/// according to the specification of \ref copy_alloc_f;
+/// - allocator - The allocator used by copy_alloc and to release elements;
+/// - serialize - Writes an element to a stream according to the
+/// specification of \ref serialize_f;
+/// - deserialize - Reads back an element written by serialize according to
+/// the specification of \ref deserialize_f.
+///
+/// When an allocator is set, every element handled by a data structure using
+/// this interface must come from that allocator. Copies are made with
+/// copy_alloc and elements are released with the allocator's deallocation
+/// function instead of free. This can be used, for example, to copy a whole
+/// structure into an arena and later release all of its elements at once.
 ///
 /// \par Functions
 /// Located in file Interface.c
@@ -92,6 +191,14 @@ struct Interface_s
     hash_f hash;
 
     priority_f priority;
+
+    copy_alloc_f copy_alloc;
+
+    struct Allocator_s *allocator;
+
+    serialize_f serialize;
+
+    deserialize_f deserialize;
 };
 
 typedef struct Interface_s Interface_t;
@@ -118,6 +225,28 @@ interface_config(Interface_t *interface,
                  compare_f compare, copy_f copy, display_f display,
                  free_f free, hash_f hash, priority_f priority);
 
+/// \ref interface_allocator
+/// \brief Sets a custom allocator to an interface.
+void
+interface_allocator(Interface_t *interface, copy_alloc_f copy_alloc,
+                    Allocator_t *allocator);
+
+/// \ref interface_serializer
+/// \brief Sets the functions used to save and restore elements.
+void
+interface_serializer(Interface_t *interface, serialize_f serialize,
+                     deserialize_f deserialize);
+
+/// \ref interface_copy
+/// \brief Copies an element using the interface's allocator, if any.
+void *
+interface_copy(Interface_t *interface, const void *element);
+
+/// \ref interface_release
+/// \brief Frees an element using the interface's allocator, if any.
+void
+interface_release(Interface_t *interface, void *element);
+
 /// \ref interface_free
 /// \brief Frees from memory an Interface_s.
 void
@@ -7,6 +7,13 @@
  */
 
 #include "AVLTree.h"
+#include "Snapshot.h"
+#include "Sort.h"
+#include "Trace.h"
+
+/// A batch given to avl_insert_all() is merged by rebuilding the tree when
+/// it has at least one element for every this many elements in the tree.
+#define AVL_BULK_RATIO 8
 
 /// An AVLTree_s is a self-balancing binary search tree where the heights of
 /// two child subtrees of any node differ by at most one. If at any time they
@@ -48,6 +55,12 @@ struct AVLTree_s
     /// The root element of an AVL tree.
     struct AVLTreeNode_s *root;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief AVLTree_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
@@ -61,6 +74,19 @@ struct AVLTree_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief If subtree sizes are maintained.
+    ///
+    /// When true, every node keeps the amount of nodes in its subtree, which
+    /// allows avl_select() and avl_rank() to run in logarithmic time. Disabled
+    /// by default since it costs an extra walk to the root on insertions and
+    /// removals.
+    bool ranked;
+
+#ifdef DS_STATS
+    /// \brief Operation counters, see avl_stats().
+    ContainerStats_t stats;
+#endif
 };
 
 /// \brief An AVLTree_s node.
@@ -97,6 +123,11 @@ struct AVLTreeNode_s
     ///
     /// Pointer to parent node or NULL if this is the root node.
     struct AVLTreeNode_s *parent;
+
+    /// \brief Amount of nodes in this subtree, including itself.
+    ///
+    /// Only valid if the tree is ranked.
+    integer_t count;
 };
 
 /// \brief A type for an AVL tree node.
@@ -112,19 +143,22 @@ typedef struct AVLTreeNode_s *AVLTreeNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AVLTreeNode_t *
-avl_new_node(void *element);
+avl_new_node(NodePool_t *pool, void *element);
 
 static void
-avl_free_node(AVLTreeNode_t *node, free_f function);
+avl_free_node(NodePool_t *pool, AVLTreeNode_t *node, free_f function);
 
 static void
-avl_free_node_shallow(AVLTreeNode_t *node);
+avl_free_node_shallow(NodePool_t *pool, AVLTreeNode_t *node);
 
 static void
-avl_free_tree(AVLTreeNode_t *root, free_f function);
+avl_free_tree(NodePool_t *pool, AVLTreeNode_t *root, free_f function);
 
 static void
-avl_free_tree_shallow(AVLTreeNode_t *root);
+avl_free_tree_shallow(NodePool_t *pool, AVLTreeNode_t *root);
+
+static bool
+avl_insert_node(AVLTree_t *tree, void *element, AVLTreeNode_t **found);
 
 static AVLTreeNode_t *
 avl_find(AVLTree_t *tree, void *element);
@@ -137,10 +171,10 @@ static int8_t
 avl_height_update(AVLTreeNode_t *node);
 
 static void
-avl_rotate_right(AVLTreeNode_t **Z);
+avl_rotate_right(AVLTree_t *tree, AVLTreeNode_t **Z);
 
 static void
-avl_rotate_left(AVLTreeNode_t **Z);
+avl_rotate_left(AVLTree_t *tree, AVLTreeNode_t **Z);
 
 static void
 avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node);
@@ -161,16 +195,86 @@ avl_display_treeview(AVLTreeNode_t *root, integer_t depth, char *path,
 
 // Traversal
 static void
-avl_traversal_preorder(AVLTreeNode_t *root, display_f function);
+avl_traversal_preorder(AVLTreeNode_t *root, visit_f visit,
+                       void *argument);
+
+static void
+avl_traversal_inorder(AVLTreeNode_t *root, visit_f visit,
+                      void *argument, bool leaves);
+
+static void
+avl_traversal_postorder(AVLTreeNode_t *root, visit_f visit,
+                        void *argument);
+
+static bool
+avl_traversal_levelorder(AVLTree_t *tree, visit_f visit, void *argument);
+
+static void
+avl_traversal_display(void *element, void *argument);
+
+static AVLTreeNode_t *
+avl_bound(AVLTree_t *tree, void *element, bool upper);
+
+static integer_t
+avl_node_count(AVLTreeNode_t *node);
+
+static integer_t
+avl_count_update(AVLTreeNode_t *node);
+
+static integer_t
+avl_count_tree(AVLTreeNode_t *root);
+
+static AVLTreeNode_t *
+avl_successor(AVLTreeNode_t *N);
+
+static AVLTreeNode_t *
+avl_predecessor(AVLTreeNode_t *N);
+
+static AVLTreeNode_t *
+avl_minimum(AVLTreeNode_t *N);
+
+static AVLTreeNode_t *
+avl_maximum(AVLTreeNode_t *N);
 
 static void
-avl_traversal_inorder(AVLTreeNode_t *root, display_f function);
+avl_build(AVLTree_t *tree, AVLTreeNode_t **nodes, integer_t size);
 
+static AVLTreeNode_t *
+avl_build_subtree(AVLTreeNode_t **nodes, integer_t size,
+                  AVLTreeNode_t *parent);
+
+// Join-based set operations
 static void
-avl_traversal_postorder(AVLTreeNode_t *root, display_f function);
+avl_expose(AVLTreeNode_t *N);
+
+static AVLTreeNode_t *
+avl_join_node(AVLTree_t *tree, AVLTreeNode_t *L, AVLTreeNode_t *K,
+              AVLTreeNode_t *R);
+
+static AVLTreeNode_t *
+avl_join_subtrees(AVLTree_t *tree, AVLTreeNode_t *L, AVLTreeNode_t *R);
 
 static void
-avl_traversal_leaves(AVLTreeNode_t *root, display_f function);
+avl_split_nodes(AVLTree_t *tree, AVLTreeNode_t *T, void *element,
+                AVLTreeNode_t **L, AVLTreeNode_t **K, AVLTreeNode_t **R);
+
+static AVLTreeNode_t *
+avl_split_last(AVLTree_t *tree, AVLTreeNode_t *T, AVLTreeNode_t **K);
+
+static AVLTreeNode_t *
+avl_union_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                integer_t *found);
+
+static AVLTreeNode_t *
+avl_intersection_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                      integer_t *found);
+
+static AVLTreeNode_t *
+avl_difference_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                     integer_t *found);
+
+static bool
+avl_save_tree(AVLTree_t *tree, AVLTreeNode_t *root, FILE *stream);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -195,10 +299,83 @@ avl_new(Interface_t *interface)
     tree->size = 0;
     tree->limit = 0;
     tree->version_id = 0;
+    tree->ranked = false;
     tree->root = NULL;
 
+    tree->pool = NULL;
     tree->interface = interface;
 
+    DS_STATS_RESET(tree);
+    DS_STATS_ADD(tree, allocations, 1);
+
+    return tree;
+}
+
+/// Builds a perfectly balanced AVLTree_s from a buffer of elements sorted in
+/// ascending order without duplicates. Every node is linked once, without
+/// any comparisons besides checking the order, so it takes linear time
+/// instead of one descent and rebalance per element. On success the tree
+/// takes ownership of the elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param interface An interface defining all necessary functions for the
+/// AVL tree to operate.
+/// \param elements Buffer of sorted elements.
+/// \param size Amount of elements in the buffer.
+///
+/// \return A new AVLTree_s or NULL if allocation failed or the elements are not
+/// sorted and unique.
+AVLTree_t *
+avl_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size)
+{
+    if (size < 0)
+        return NULL;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (interface->compare(elements[i - 1], elements[i]) >= 0)
+            return NULL;
+    }
+
+    AVLTree_t *tree = avl_new(interface);
+
+    if (!tree || size == 0)
+        return tree;
+
+    AVLTreeNode_t **nodes =
+            malloc(sizeof(AVLTreeNode_t*) * (size_t)size);
+
+    if (!nodes)
+    {
+        avl_free_shallow(tree);
+        return NULL;
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        nodes[i] = avl_new_node(tree->pool, elements[i]);
+
+        if (!nodes[i])
+        {
+            while (i > 0)
+                avl_free_node_shallow(tree->pool, nodes[--i]);
+
+            free(nodes);
+            avl_free_shallow(tree);
+
+            return NULL;
+        }
+    }
+
+    avl_build(tree, nodes, size);
+
+    free(nodes);
+
+    DS_STATS_ADD(tree, allocations, size + 1);
+
     return tree;
 }
 
@@ -212,7 +389,7 @@ avl_new(Interface_t *interface)
 void
 avl_free(AVLTree_t *tree)
 {
-    avl_free_tree(tree->root, tree->interface->free);
+    avl_free_tree(tree->pool, tree->root, tree->interface->free);
 
     free(tree);
 }
@@ -226,7 +403,7 @@ avl_free(AVLTree_t *tree)
 void
 avl_free_shallow(AVLTree_t *tree)
 {
-    avl_free_tree_shallow(tree->root);
+    avl_free_tree_shallow(tree->pool, tree->root);
 
     free(tree);
 }
@@ -242,7 +419,9 @@ avl_free_shallow(AVLTree_t *tree)
 void
 avl_erase(AVLTree_t *tree)
 {
-    avl_free_tree(tree->root, tree->interface->free);
+    avl_free_tree(tree->pool, tree->root, tree->interface->free);
+
+    DS_STATS_ADD(tree, frees, tree->size);
 
     tree->root = NULL;
     tree->size = 0;
@@ -258,7 +437,7 @@ avl_erase(AVLTree_t *tree)
 void
 avl_erase_shallow(AVLTree_t *tree)
 {
-    avl_free_tree_shallow(tree->root);
+    avl_free_tree_shallow(tree->pool, tree->root);
 
     tree->root = NULL;
     tree->size = 0;
@@ -305,6 +484,63 @@ avl_limit(AVLTree_t *tree)
     return tree->limit;
 }
 
+/// Returns true if the tree keeps the size of every subtree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+///
+/// \return True if avl_select() and avl_rank() can be used.
+bool
+avl_ranked(AVLTree_t *tree)
+{
+    return tree->ranked;
+}
+
+/// Copies the operation counters of the tree. They are only kept when the
+/// library is compiled with \c DS_STATS defined. Every node is an allocation
+/// and the bytes held are those of the tree and its nodes.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+/// \param stats Where the counters are copied to.
+///
+/// \return True if the counters are kept, otherwise false and every counter
+/// is zero.
+bool
+avl_stats(AVLTree_t *tree, ContainerStats_t *stats)
+{
+    if (!DS_STATS_GET(tree, stats))
+        return false;
+
+    stats->bytes = sizeof(AVLTree_t)
+                   + (unsigned_t)tree->size * sizeof(AVLTreeNode_t);
+
+    return true;
+}
+
+/// Returns the element in the tree that is equal to the given element. Useful
+/// when elements are compared by a part of them, like a key, and the rest of
+/// the element in the tree is needed.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree AVLTree_s reference.
+/// \param element The element to be searched in the tree.
+///
+/// \return The element in the tree or NULL if it is not present.
+void *
+avl_get(AVLTree_t *tree, void *element)
+{
+    AVLTreeNode_t *node = avl_find(tree, element);
+
+    return node == NULL ? NULL : node->key;
+}
+
 /// Sets a limit to the amount of elements in the AVL tree. To remove the limit
 /// set.
 ///
@@ -327,6 +563,53 @@ avl_set_limit(AVLTree_t *tree, integer_t limit)
     return true;
 }
 
+/// Sets a node pool from where all nodes of the AVL tree are allocated.
+/// A pool can be shared between many containers as long as its nodes are
+/// big enough. Set it to NULL to go back to using malloc() and free(). The
+/// pool can only be changed when the tree is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+/// \param pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the tree is not empty or if the pool's nodes are too
+/// small.
+bool
+avl_set_pool(AVLTree_t *tree, NodePool_t *pool)
+{
+    if (!avl_empty(tree))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(AVLTreeNode_t)))
+        return false;
+
+    tree->pool = pool;
+
+    return true;
+}
+
+/// Enables or disables order statistics. While enabled every node keeps
+/// the size of its subtree, updated by insertions, removals and rotations,
+/// so avl_select() and avl_rank() take logarithmic time. Enabling it computes
+/// the sizes of a non-empty tree in linear time.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+/// \param ranked If subtree sizes should be maintained.
+void
+avl_set_ranked(AVLTree_t *tree, bool ranked)
+{
+    if (ranked && !tree->ranked)
+        avl_count_tree(tree->root);
+
+    tree->ranked = ranked;
+}
+
 /// Adds a new element in the specified AVL tree. The tree does not accepts
 /// duplicate values.
 ///
@@ -342,63 +625,181 @@ avl_set_limit(AVLTree_t *tree, integer_t limit)
 bool
 avl_insert(AVLTree_t *tree, void *element)
 {
-    if (avl_full(tree))
+    return avl_insert_node(tree, element, NULL);
+}
+
+/// Looks for an element equal to the given one and inserts the given element
+/// if there is none, with a single descent. If an equal element is found the
+/// given element is not added and still belongs to the caller.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree AVLTree_s reference.
+/// \param element The element to be searched or added.
+/// \param existing The element equal to \c element in the tree after the
+/// call, or NULL if it was not found and could not be added.
+///
+/// \return True if the element was added to the tree.
+/// \return False if an equal element was found, if the tree has a limited
+/// size or if any allocations failed.
+bool
+avl_find_or_insert(AVLTree_t *tree, void *element, void **existing)
+{
+    AVLTreeNode_t *found;
+
+    bool inserted = avl_insert_node(tree, element, &found);
+
+    *existing = inserted ? element : found ? found->key : NULL;
+
+    return inserted;
+}
+
+/// Adds an element or, if an equal element is already in the tree, merges
+/// the given element into it and frees the given element, all with a single
+/// descent. The merge function must not change how the element in the tree
+/// compares to others.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree AVLTree_s reference.
+/// \param element The element to be added or merged.
+/// \param merge A function that folds the given element into the element
+/// already in the tree.
+///
+/// \return True if the element was added or merged. The tree then owns it.
+/// \return False if it was not found and could not be added.
+bool
+avl_upsert(AVLTree_t *tree, void *element, reduce_f merge)
+{
+    void *existing;
+
+    if (avl_find_or_insert(tree, element, &existing))
+        return true;
+
+    if (!existing)
         return false;
 
-    if (avl_empty(tree))
+    merge(existing, element);
+
+    tree->interface->free(element);
+
+    return true;
+}
+/// Adds every element of a buffer to the AVL tree. The buffer is sorted first.
+/// Small batches are then inserted one by one. Batches that are big compared
+/// to the tree are merged with the elements already in it, and the whole
+/// tree is rebuilt in linear time, reusing its nodes.
+///
+/// When the function returns, the inserted elements are at the start of the
+/// buffer in ascending order. The rest are elements that could not be
+/// inserted because they were duplicates, the tree was full or an
+/// allocation failed. They still belong to the caller.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree AVLTree_s reference.
+/// \param elements Buffer of elements to be added.
+/// \param size Amount of elements in the buffer.
+///
+/// \return The amount of elements inserted.
+integer_t
+avl_insert_all(AVLTree_t *tree, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return 0;
+
+    srt_sort(elements, size, tree->interface->compare);
+
+    integer_t total = 0;
+
+    AVLTreeNode_t **nodes = NULL;
+
+    // Rebuilding only pays off if it touches few nodes per new element
+    if (tree->limit <= 0 && size * AVL_BULK_RATIO >= tree->size)
+        nodes = malloc(sizeof(AVLTreeNode_t*)
+                       * (size_t)(size + tree->size));
+
+    if (!nodes)
     {
-        tree->root = avl_new_node(element);
+        for (integer_t i = 0; i < size; i++)
+        {
+            if (avl_insert(tree, elements[i]))
+            {
+                void *element = elements[i];
+                elements[i] = elements[total];
+                elements[total++] = element;
+            }
+        }
 
-        if (!tree->root)
-            return false;
+        return total;
     }
-    else
+
+    DS_STATS_ADD(tree, allocations, 1);
+
+    // The nodes of the tree go to the end of the array and the merged
+    // sequence is written from the start, which never overtakes them
+    integer_t count = tree->size, old = size, merged = 0;
+
+    if (tree->root)
     {
-        AVLTreeNode scan = tree->root;
-        AVLTreeNode parent = scan;
+        AVLTreeNode_t *node = avl_minimum(tree->root);
 
-        while (scan != NULL)
+        for (integer_t i = size; node != NULL; i++)
         {
-            parent = scan;
-
-            if (tree->interface->compare(scan->key, element) > 0)
-                scan = scan->left;
-            else if (tree->interface->compare(scan->key, element) < 0)
-                scan = scan->right;
-            else
-                return false; /* No duplicates are allowed */
+            nodes[i] = node;
+            node = avl_successor(node);
         }
+    }
+
+    for (integer_t i = 0; i < size || old < size + count; )
+    {
+        int comparison = -1;
 
-        AVLTreeNode_t *node;
+        if (old < size + count && i < size)
+            comparison = DS_STATS_COMPARE(tree, nodes[old]->key,
+                                                  elements[i]);
 
-        if (tree->interface->compare(parent->key, element) < 0)
+        if (old < size + count && (i == size || comparison < 0))
         {
-            parent->right = avl_new_node(element);
-
-            if (!parent->right)
-                return false;
+            nodes[merged++] = nodes[old++];
+            continue;
+        }
 
-            parent->right->parent = parent;
-            node = parent->right;
+        // Equal to an element already in the tree or in the batch
+        if (comparison == 0 || (merged > 0 && DS_STATS_COMPARE(tree, 
+                nodes[merged - 1]->key, elements[i]) == 0))
+        {
+            i++;
+            continue;
         }
-        else
+
+        AVLTreeNode_t *node = avl_new_node(tree->pool, elements[i]);
+
+        if (node)
         {
-            parent->left = avl_new_node(element);
+            DS_STATS_ADD(tree, allocations, 1);
 
-            if (!parent->left)
-                return false;
+            nodes[merged++] = node;
 
-            parent->left->parent = parent;
-            node = parent->left;
+            void *element = elements[i];
+            elements[i] = elements[total];
+            elements[total++] = element;
         }
 
-        avl_rebalance(tree, node);
+        i++;
     }
 
-    tree->size++;
+    avl_build(tree, nodes, merged);
+
+    free(nodes);
+
     tree->version_id++;
 
-    return true;
+    return total;
 }
 
 /// Removes an element, if present, that matches a given element from the
@@ -416,12 +817,17 @@ avl_insert(AVLTree_t *tree, void *element)
 bool
 avl_remove(AVLTree_t *tree, void *element)
 {
+    DS_TRACE_ENTRY(avl_remove, tree->size);
+
     AVLTreeNode_t *temp = NULL,
                   *unbalanced = NULL,
                   *node = avl_find(tree, element);
 
     if (node == NULL)
+    {
+        DS_TRACE_RETURN(avl_remove, tree->size);
         return false;
+    }
 
     bool is_root = node->parent == NULL;
 
@@ -444,7 +850,7 @@ avl_remove(AVLTree_t *tree, void *element)
                 node->parent->left = NULL;
         }
 
-        avl_free_node(node, tree->interface->free);
+        avl_free_node(tree->pool, node, tree->interface->free);
     }
     // Only right subtree. Need to update right subtree parent pointer.
     else if (node->left == NULL)
@@ -472,7 +878,7 @@ avl_remove(AVLTree_t *tree, void *element)
                 node->parent->left = node->right;
         }
 
-        avl_free_node(node, tree->interface->free);
+        avl_free_node(tree->pool, node, tree->interface->free);
     }
     // Only left subtree. Need to update left subtree parent pointer.
     else if (node->right == NULL)
@@ -500,7 +906,7 @@ avl_remove(AVLTree_t *tree, void *element)
                 node->parent->left = node->left;
         }
 
-        avl_free_node(node, tree->interface->free);
+        avl_free_node(tree->pool, node, tree->interface->free);
     }
     // Node has left and right subtrees
     else
@@ -564,7 +970,7 @@ avl_remove(AVLTree_t *tree, void *element)
         }
 
         // Delete temp node
-        avl_free_node_shallow(temp);
+        avl_free_node_shallow(tree->pool, temp);
 
         tree->interface->free(node->key);
 
@@ -578,6 +984,10 @@ avl_remove(AVLTree_t *tree, void *element)
     tree->size--;
     tree->version_id++;
 
+    DS_STATS_ADD(tree, frees, 1);
+
+    DS_TRACE_RETURN(avl_remove, tree->size);
+
     return true;
 }
 
@@ -710,44 +1120,462 @@ avl_min(AVLTree_t *tree)
     return scan->key;
 }
 
-/// Displays an AVLTree_s in the console. There are currently four modes:
-/// - -1 Displays the tree with \c avl_display_tree.
-/// - 0 Displays the tree with \c avl_display_simple.
-/// - 1 Displays the tree with \c avl_display_height
-/// - Any other values defaults to \c avl_display_treeview
+/// Visits in ascending order every element that is not smaller than \c low
+/// and not bigger than \c high. The search goes straight to the first
+/// element of the range and then follows the parent pointers, so only
+/// <code> O(log n + k) </code> nodes are visited where \c k is the amount of
+/// elements in the range.
 ///
 /// \par Interface Requirements
-/// - display
-///
+/// - compare
 ///
 /// \param tree AVLTree_s reference.
-/// \param display_mode The way the tree is to be displayed.
-void
-avl_display(AVLTree_t *tree, int display_mode)
+/// \param low Lower bound of the range.
+/// \param high Upper bound of the range.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+avl_range(AVLTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument)
 {
-    if (display_mode)
-    {
-        printf("\n+--------------------------------------------------+");
-        printf("\n|                     AVL Tree                     |");
-        printf("\n+--------------------------------------------------+\n");
-    }
+    AVLTreeNode_t *node = avl_bound(tree, low, false);
 
-    if (avl_empty(tree) && display_mode)
-    {
-        printf(" EMPTY\n");
-    }
+    integer_t total = 0;
 
-    if (display_mode == -1)
-    {
-        avl_display_tree(tree->root, 0, tree->interface->display);
-    }
-    else if (display_mode == 0)
-    {
-        avl_display_simple(tree->root, 0, tree->interface->display);
-    }
-    else if (display_mode == 1)
+    while (node != NULL && DS_STATS_COMPARE(tree, node->key, high) <= 0)
     {
-        avl_display_height(tree->root, 1, tree->interface->display);
+        visit(node->key, argument);
+        total++;
+
+        node = avl_successor(node);
+    }
+
+    return total;
+}
+
+/// Calls a function with every element of the tree in a given order:
+/// - -1 Pre-order traversal.
+/// - 0 In-order traversal.
+/// - 1 Post-order traversal.
+/// - 2 Level-order traversal.
+/// - Any other values defaults to leaves traversal, in order.
+///
+/// The walks go from node to node through the parent pointers, so they don't
+/// recurse and don't use a stack, even on a degenerate tree. Only the
+/// level-order traversal needs memory, for a queue of nodes.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+/// \param traversal_mode The way the tree is to be traversed.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return True if the tree was traversed.
+/// \return False if the level-order queue could not be allocated.
+bool
+avl_visit(AVLTree_t *tree, int traversal_mode, visit_f visit, void *argument)
+{
+    switch (traversal_mode)
+    {
+        case -1:
+            avl_traversal_preorder(tree->root, visit, argument);
+            break;
+        case 0:
+            avl_traversal_inorder(tree->root, visit, argument, false);
+            break;
+        case 1:
+            avl_traversal_postorder(tree->root, visit, argument);
+            break;
+        case 2:
+            return avl_traversal_levelorder(tree, visit, argument);
+        default:
+            avl_traversal_inorder(tree->root, visit, argument, true);
+            break;
+    }
+
+    return true;
+}
+
+/// Returns the element that has exactly \c index elements smaller than it,
+/// that is, the element at the position \c index of an ascending order
+/// starting at 0. For example the median of a tree is at
+/// <code> avl_size(tree) / 2 </code>.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree AVLTree_s reference.
+/// \param index Position of the element.
+///
+/// \return The element at the given position or NULL if the position is out
+/// of bounds or the tree is not ranked.
+void *
+avl_select(AVLTree_t *tree, integer_t index)
+{
+    if (!tree->ranked || index < 0 || index >= tree->size)
+        return NULL;
+
+    AVLTreeNode_t *scan = tree->root;
+
+    for (;;)
+    {
+        integer_t left = avl_node_count(scan->left);
+
+        if (index < left)
+            scan = scan->left;
+        else if (index > left)
+        {
+            index -= left + 1;
+            scan = scan->right;
+        }
+        else
+            return scan->key;
+    }
+}
+
+/// Returns the amount of elements that are smaller than the given element,
+/// which does not need to be in the tree. If it is, this is its position for
+/// avl_select().
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree AVLTree_s reference.
+/// \param element The element to be compared.
+///
+/// \return The amount of smaller elements or -1 if the tree is not ranked.
+integer_t
+avl_rank(AVLTree_t *tree, void *element)
+{
+    if (!tree->ranked)
+        return -1;
+
+    AVLTreeNode_t *scan = tree->root;
+
+    integer_t rank = 0;
+
+    while (scan != NULL)
+    {
+        if (DS_STATS_COMPARE(tree, scan->key, element) < 0)
+        {
+            rank += avl_node_count(scan->left) + 1;
+            scan = scan->right;
+        }
+        else
+            scan = scan->left;
+    }
+
+    return rank;
+}
+
+/// Writes the tree to a stream as a snapshot that avl_restore() reads back.
+/// The elements are written in ascending order with the interface's
+/// serialize function, so restoring the tree builds it in linear time with
+/// avl_from_sorted_array() instead of inserting them one by one.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param tree AVLTree_s reference.
+/// \param stream Where the snapshot is written to.
+///
+/// \return True if the snapshot was written or false if writing failed or if
+/// the interface has no serialize function.
+bool
+avl_save(AVLTree_t *tree, FILE *stream)
+{
+    if (!tree->interface->serialize)
+        return false;
+
+    SnapshotHeader_t header;
+
+    snp_header_init(&header, SnapshotAVLTree, (uint64_t)tree->size);
+
+    header.fields[0] = tree->ranked;
+
+    return snp_write_header(stream, &header)
+           && avl_save_tree(tree, tree->root, stream);
+}
+
+/// Reads a tree written by avl_save(). The new tree is ranked if the saved one
+/// was.
+///
+/// \par Interface Requirements
+/// - compare
+/// - deserialize
+/// - free
+///
+/// \param interface An interface defining all necessary functions for the
+/// AVL tree to operate.
+/// \param stream Where the snapshot is read from.
+///
+/// \return A new AVLTree_s or NULL if the stream doesn't hold a snapshot of
+/// an AVL tree, if its elements are out of order, if reading or allocation
+/// failed or if the interface has no deserialize function.
+AVLTree_t *
+avl_restore(Interface_t *interface, FILE *stream)
+{
+    SnapshotHeader_t header;
+
+    if (!interface->deserialize
+        || !snp_read_header(stream, SnapshotAVLTree, &header))
+        return NULL;
+
+    integer_t size = (integer_t)header.count;
+
+    void **elements = snp_read_elements(stream, interface, size);
+
+    if (!elements)
+        return NULL;
+
+    AVLTree_t *tree = avl_from_sorted_array(interface, elements, size);
+
+    if (!tree)
+    {
+        for (integer_t i = 0; i < size; i++)
+            interface_release(interface, elements[i]);
+    }
+    else if (header.fields[0])
+        avl_set_ranked(tree, true);
+
+    free(elements);
+
+    return tree;
+}
+
+/// Moves every element of tree2 to tree1, leaving tree2 empty. Elements of
+/// tree2 that are already in tree1 are freed. Instead of inserting elements
+/// one by one, tree2 is split around the nodes of tree1 and the parts are
+/// joined back, so no node is allocated and it takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree. Both trees must use the same node pool.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 AVLTree_s reference where the result is stored.
+/// \param tree2 AVLTree_s reference to be emptied.
+///
+/// \return False if the trees have different node pools or if the sum of
+/// their sizes is greater than the limit of tree1.
+bool
+avl_union(AVLTree_t *tree1, AVLTree_t *tree2)
+{
+    if (tree1 == tree2)
+        return true;
+
+    if (tree1->pool != tree2->pool)
+        return false;
+
+    if (tree1->limit > 0 && tree1->size + tree2->size > tree1->limit)
+        return false;
+
+    if (tree1->ranked && !tree2->ranked)
+        avl_count_tree(tree2->root);
+
+    integer_t found = 0;
+
+    tree1->root = avl_union_nodes(tree1, tree1->root, tree2->root, &found);
+    tree1->size += tree2->size - found;
+    tree1->version_id++;
+
+    DS_STATS_ADD(tree1, frees, found);
+
+    tree2->root = NULL;
+    tree2->size = 0;
+    tree2->version_id++;
+
+    return true;
+}
+
+/// Removes from tree1 every element that is not in tree2. The removed
+/// elements are freed and tree2 is not changed. Takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 AVLTree_s reference where the result is stored.
+/// \param tree2 AVLTree_s reference with the elements to be kept.
+void
+avl_intersection(AVLTree_t *tree1, AVLTree_t *tree2)
+{
+    if (tree1 == tree2)
+        return;
+
+    integer_t found = 0;
+
+    tree1->root = avl_intersection_nodes(tree1, tree1->root, tree2->root,
+                                         &found);
+
+    DS_STATS_ADD(tree1, frees, tree1->size - found);
+
+    tree1->size = found;
+    tree1->version_id++;
+}
+
+/// Removes from tree1 every element that is also in tree2. The removed
+/// elements are freed and tree2 is not changed. Takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 AVLTree_s reference where the result is stored.
+/// \param tree2 AVLTree_s reference with the elements to be removed.
+void
+avl_difference(AVLTree_t *tree1, AVLTree_t *tree2)
+{
+    if (tree1 == tree2)
+    {
+        avl_erase(tree1);
+        return;
+    }
+
+    integer_t found = 0;
+
+    tree1->root = avl_difference_nodes(tree1, tree1->root, tree2->root,
+                                       &found);
+    tree1->size -= found;
+
+    DS_STATS_ADD(tree1, frees, found);
+    tree1->version_id++;
+}
+
+/// Moves every element that is greater than or equal to the given element to
+/// a new tree, which uses the same interface and node pool. Takes
+/// <code> O(log n) </code> time if the tree is ranked. Otherwise the moved
+/// elements also have to be counted.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree AVLTree_s reference.
+/// \param element Where the tree is split.
+///
+/// \return A new AVLTree_s with the greater elements or NULL if allocation
+/// failed, in which case the tree is not changed.
+AVLTree_t *
+avl_split(AVLTree_t *tree, void *element)
+{
+    AVLTree_t *result = avl_new(tree->interface);
+
+    if (!result)
+        return NULL;
+
+    result->pool = tree->pool;
+    result->ranked = tree->ranked;
+
+    if (avl_empty(tree))
+        return result;
+
+    AVLTreeNode_t *L, *K, *R;
+
+    avl_split_nodes(tree, tree->root, element, &L, &K, &R);
+
+    if (K != NULL)
+        R = avl_join_node(tree, NULL, K, R);
+    tree->root = L;
+    result->root = R;
+
+    result->size = tree->ranked ? avl_node_count(R) : avl_count_tree(R);
+    tree->size -= result->size;
+    tree->version_id++;
+
+    return result;
+}
+
+/// Moves every element of tree2 to the end of tree1, leaving tree2 empty. All
+/// elements of tree1 must be smaller than the elements of tree2. Takes
+/// <code> O(log n) </code> time. Both trees must use the same node pool.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree1 AVLTree_s reference where the result is stored.
+/// \param tree2 AVLTree_s reference to be emptied.
+///
+/// \return False if the elements are not in order, the trees have different
+/// node pools or if the sum of their sizes is greater than the limit of
+/// tree1.
+bool
+avl_join(AVLTree_t *tree1, AVLTree_t *tree2)
+{
+    if (tree1 == tree2 || tree1->pool != tree2->pool)
+        return false;
+
+    if (avl_empty(tree2))
+        return true;
+
+    if (tree1->limit > 0 && tree1->size + tree2->size > tree1->limit)
+        return false;
+
+    if (!avl_empty(tree1)
+        && DS_STATS_COMPARE(tree1, avl_maximum(tree1->root)->key,
+                                     avl_minimum(tree2->root)->key) >= 0)
+        return false;
+
+    if (tree1->ranked && !tree2->ranked)
+        avl_count_tree(tree2->root);
+
+    tree1->root = avl_join_subtrees(tree1, tree1->root, tree2->root);
+    tree1->size += tree2->size;
+    tree1->version_id++;
+
+    tree2->root = NULL;
+    tree2->size = 0;
+    tree2->version_id++;
+
+    return true;
+}
+
+/// Displays an AVLTree_s in the console. There are currently four modes:
+/// - -1 Displays the tree with \c avl_display_tree.
+/// - 0 Displays the tree with \c avl_display_simple.
+/// - 1 Displays the tree with \c avl_display_height
+/// - Any other values defaults to \c avl_display_treeview
+///
+/// \par Interface Requirements
+/// - display
+///
+///
+/// \param tree AVLTree_s reference.
+/// \param display_mode The way the tree is to be displayed.
+void
+avl_display(AVLTree_t *tree, int display_mode)
+{
+    if (display_mode)
+    {
+        printf("\n+--------------------------------------------------+");
+        printf("\n|                     AVL Tree                     |");
+        printf("\n+--------------------------------------------------+\n");
+    }
+
+    if (avl_empty(tree) && display_mode)
+    {
+        printf(" EMPTY\n");
+    }
+
+    if (display_mode == -1)
+    {
+        avl_display_tree(tree->root, 0, tree->interface->display);
+    }
+    else if (display_mode == 0)
+    {
+        avl_display_simple(tree->root, 0, tree->interface->display);
+    }
+    else if (display_mode == 1)
+    {
+        avl_display_height(tree->root, 1, tree->interface->display);
     }
     else
     {
@@ -763,6 +1591,7 @@ avl_display(AVLTree_t *tree, int display_mode)
 /// - -1 Pre-order traversal.
 /// - 0 In-order traversal.
 /// - 1 Post-order traversal.
+/// - 2 Level-order traversal.
 /// - Any other values defaults to leaves traversal
 ///
 /// \par Interface Requirements
@@ -778,37 +1607,40 @@ avl_traversal(AVLTree_t *tree, int traversal_mode)
     {
         case -1:
             printf("Pre-order Traversal\n");
-            avl_traversal_preorder(tree->root, tree->interface->display);
             break;
         case 0:
             printf("In-order Traversal\n");
-            avl_traversal_inorder(tree->root, tree->interface->display);
             break;
         case 1:
             printf("Post-order Traversal\n");
-            avl_traversal_postorder(tree->root, tree->interface->display);
+            break;
+        case 2:
+            printf("Level-order Traversal\n");
             break;
         default:
             printf("Leaves Traversal\n");
-            avl_traversal_leaves(tree->root, tree->interface->display);
             break;
     }
 
+    avl_visit(tree, traversal_mode, avl_traversal_display, tree->interface);
+
     printf("\n");
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AVLTreeNode_t *
-avl_new_node(void *element)
+avl_new_node(NodePool_t *pool, void *element)
 {
-    AVLTreeNode_t *node = malloc(sizeof(AVLTreeNode_t));
+    AVLTreeNode_t *node = npl_node_alloc(pool,
+            sizeof(AVLTreeNode_t));
 
     if (!node)
         return NULL;
 
     node->key = element;
-    node->height = 0;
+    node->height = 1;
+    node->count = 1;
 
     node->left = NULL;
     node->right = NULL;
@@ -818,21 +1650,21 @@ avl_new_node(void *element)
 }
 
 static void
-avl_free_node(AVLTreeNode_t *node, free_f function)
+avl_free_node(NodePool_t *pool, AVLTreeNode_t *node, free_f function)
 {
     function(node->key);
 
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-avl_free_node_shallow(AVLTreeNode_t *node)
+avl_free_node_shallow(NodePool_t *pool, AVLTreeNode_t *node)
 {
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-avl_free_tree(AVLTreeNode_t *root, free_f function)
+avl_free_tree(NodePool_t *pool, AVLTreeNode_t *root, free_f function)
 {
     AVLTreeNode_t *scan = root;
     AVLTreeNode_t *up = NULL;
@@ -860,13 +1692,13 @@ avl_free_tree(AVLTreeNode_t *root, free_f function)
         {
             if (up == NULL)
             {
-                avl_free_node(scan, function);
+                avl_free_node(pool, scan, function);
                 scan = NULL;
             }
 
             while (up != NULL)
             {
-                avl_free_node(scan, function);
+                avl_free_node(pool, scan, function);
 
                 if (up->right != NULL)
                 {
@@ -885,7 +1717,7 @@ avl_free_tree(AVLTreeNode_t *root, free_f function)
 }
 
 static void
-avl_free_tree_shallow(AVLTreeNode_t *root)
+avl_free_tree_shallow(NodePool_t *pool, AVLTreeNode_t *root)
 {
     AVLTreeNode_t *scan = root;
     AVLTreeNode_t *up = NULL;
@@ -913,13 +1745,13 @@ avl_free_tree_shallow(AVLTreeNode_t *root)
         {
             if (up == NULL)
             {
-                avl_free_node_shallow(scan);
+                avl_free_node_shallow(pool, scan);
                 scan = NULL;
             }
 
             while (up != NULL)
             {
-                avl_free_node_shallow(scan);
+                avl_free_node_shallow(pool, scan);
 
                 if (up->right != NULL)
                 {
@@ -937,16 +1769,79 @@ avl_free_tree_shallow(AVLTreeNode_t *root)
     }
 }
 
-static AVLTreeNode_t *
-avl_find(AVLTree_t *tree, void *element)
+// Inserts an element. If found is given, an equal element is reported in it
+// instead of being refused
+static bool
+avl_insert_node(AVLTree_t *tree, void *element, AVLTreeNode_t **found)
 {
-    AVLTreeNode_t *scan = tree->root;
+    if (found)
+        *found = NULL;
 
-    while (scan != NULL)
+    AVLTreeNode_t *parent = NULL;
+
+    int comparison = 0;
+
+    for (AVLTreeNode_t *scan = tree->root; scan != NULL; )
     {
-        if (tree->interface->compare(scan->key, element) > 0)
+        parent = scan;
+
+        comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0)
             scan = scan->left;
-        else if (tree->interface->compare(scan->key, element) < 0)
+        else if (comparison < 0)
+            scan = scan->right;
+        else
+        {
+            if (found)
+                *found = scan;
+
+            return false; /* No duplicates are allowed */
+        }
+    }
+
+    if (avl_full(tree))
+        return false;
+
+    AVLTreeNode_t *node = avl_new_node(tree->pool, element);
+
+    if (!node)
+        return false;
+
+    node->parent = parent;
+
+    if (parent == NULL)
+        tree->root = node;
+    else
+    {
+        if (comparison > 0)
+            parent->left = node;
+        else
+            parent->right = node;
+
+        avl_rebalance(tree, node);
+    }
+
+    tree->size++;
+    tree->version_id++;
+
+    DS_STATS_ADD(tree, allocations, 1);
+
+    return true;
+}
+
+static AVLTreeNode_t *
+avl_find(AVLTree_t *tree, void *element)
+{
+    AVLTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
             scan = scan->right;
         else
             return scan;
@@ -979,7 +1874,7 @@ avl_height_update(AVLTreeNode_t *node)
 }
 
 static void
-avl_rotate_right(AVLTreeNode_t **Z)
+avl_rotate_right(AVLTree_t *tree, AVLTreeNode_t **Z)
 {
     AVLTreeNode_t *root = *Z;
     AVLTreeNode_t *new_root = root->left;
@@ -1007,12 +1902,20 @@ avl_rotate_right(AVLTreeNode_t **Z)
     root->height = avl_height_update(root);
     new_root->height = avl_height_update(new_root);
 
+    if (tree->ranked)
+    {
+        avl_count_update(root);
+        avl_count_update(new_root);
+    }
+
+    DS_STATS_ADD(tree, rotations, 1);
+
     // New root node
     *Z = new_root;
 }
 
 static void
-avl_rotate_left(AVLTreeNode_t **Z)
+avl_rotate_left(AVLTree_t *tree, AVLTreeNode_t **Z)
 {
     AVLTreeNode_t *root = *Z;
     AVLTreeNode_t *new_root = root->right;
@@ -1040,6 +1943,14 @@ avl_rotate_left(AVLTreeNode_t **Z)
     root->height = avl_height_update(root);
     new_root->height = avl_height_update(new_root);
 
+    if (tree->ranked)
+    {
+        avl_count_update(root);
+        avl_count_update(new_root);
+    }
+
+    DS_STATS_ADD(tree, rotations, 1);
+
     // New root node
     *Z = new_root;
 }
@@ -1048,6 +1959,8 @@ avl_rotate_left(AVLTreeNode_t **Z)
 static void
 avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node)
 {
+    DS_TRACE_ENTRY(avl_rebalance, tree->size);
+
     AVLTreeNode scan = node, child = NULL;
 
     int balance;
@@ -1063,6 +1976,11 @@ avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node)
         // Updates scan height
         scan->height = avl_height_update(scan);
 
+        // Every ancestor of a change is visited so subtree sizes are fixed
+        // here too
+        if (tree->ranked)
+            avl_count_update(scan);
+
         balance = avl_node_height(scan->right) - avl_node_height(scan->left);
 
         // Right skewed
@@ -1073,10 +1991,10 @@ avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node)
             // Right Left skewed
             if (avl_node_height(child->right) < avl_node_height(child->left))
             {
-                avl_rotate_right(&(scan->right));
+                avl_rotate_right(tree, &(scan->right));
             }
 
-            avl_rotate_left(&scan);
+            avl_rotate_left(tree, &scan);
         }
         // Left skewed
         else if (balance <= -2)
@@ -1086,10 +2004,10 @@ avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node)
             // Left Right skewed
             if (avl_node_height(child->left) < avl_node_height(child->right))
             {
-                avl_rotate_left(&(scan->left));
+                avl_rotate_left(tree, &(scan->left));
             }
 
-            avl_rotate_right(&scan);
+            avl_rotate_right(tree, &scan);
         }
 
         if (is_root)
@@ -1103,6 +2021,7 @@ avl_rebalance(AVLTree_t *tree, AVLTreeNode_t *node)
         scan = scan->parent;
     }
 
+    DS_TRACE_RETURN(avl_rebalance, tree->size);
 }
 
 static void
@@ -1216,63 +2135,514 @@ avl_display_treeview(AVLTreeNode_t *root, integer_t depth, char *path,
     avl_display_treeview(root->left, depth, path, function, false);
 }
 
+// Follows the parent pointers, so no stack is needed even on a degenerate
+// tree
 static void
-avl_traversal_preorder(AVLTreeNode_t *root, display_f function)
+avl_traversal_preorder(AVLTreeNode_t *root, visit_f visit,
+                       void *argument)
 {
-    if (root == NULL)
-        return;
+    AVLTreeNode_t *node = root;
 
-    function(root->key);
-    printf(" ");
+    while (node != NULL)
+    {
+        visit(node->key, argument);
 
-    avl_traversal_preorder(root->left, function);
+        if (node->left != NULL)
+            node = node->left;
+        else if (node->right != NULL)
+            node = node->right;
+        else
+        {
+            // Go up to the first left child that has a right sibling
+            while (node->parent != NULL && (node == node->parent->right ||
+                                            node->parent->right == NULL))
+                node = node->parent;
 
-    avl_traversal_preorder(root->right, function);
+            node = node->parent == NULL ? NULL : node->parent->right;
+        }
+    }
 }
 
 static void
-avl_traversal_inorder(AVLTreeNode_t *root, display_f function)
+avl_traversal_inorder(AVLTreeNode_t *root, visit_f visit,
+                      void *argument, bool leaves)
 {
     if (root == NULL)
         return;
 
-    avl_traversal_inorder(root->left, function);
+    for (AVLTreeNode_t *node = avl_minimum(root); node != NULL;
+         node = avl_successor(node))
+    {
+        if (!leaves || (node->left == NULL && node->right == NULL))
+            visit(node->key, argument);
+    }
+}
 
-    function(root->key);
-    printf(" ");
+static void
+avl_traversal_postorder(AVLTreeNode_t *root, visit_f visit,
+                        void *argument)
+{
+    AVLTreeNode_t *node = root;
+
+    // Every subtree starts at its first leaf
+    while (node != NULL && (node->left != NULL || node->right != NULL))
+        node = node->left != NULL ? node->left : node->right;
+
+    while (node != NULL)
+    {
+        AVLTreeNode_t *parent = node->parent;
+
+        visit(node->key, argument);
 
-    avl_traversal_inorder(root->right, function);
+        if (parent != NULL && node == parent->left && parent->right != NULL)
+        {
+            node = parent->right;
+
+            while (node->left != NULL || node->right != NULL)
+                node = node->left != NULL ? node->left : node->right;
+        }
+        else
+            node = parent;
+    }
 }
 
+// The queue never holds more nodes than the tree
+static bool
+avl_traversal_levelorder(AVLTree_t *tree, visit_f visit, void *argument)
+{
+    if (tree->root == NULL)
+        return true;
+
+    AVLTreeNode_t **queue = malloc(sizeof(AVLTreeNode_t *) *
+                                     (size_t)tree->size);
+
+    if (!queue)
+        return false;
+
+    integer_t front = 0, rear = 0;
+
+    queue[rear++] = tree->root;
+
+    while (front < rear)
+    {
+        AVLTreeNode_t *node = queue[front++];
+
+        visit(node->key, argument);
+
+        if (node->left != NULL)
+            queue[rear++] = node->left;
+        if (node->right != NULL)
+            queue[rear++] = node->right;
+    }
+
+    free(queue);
+
+    return true;
+}
+
+// Displays an element of a tree given its interface
 static void
-avl_traversal_postorder(AVLTreeNode_t *root, display_f function)
+avl_traversal_display(void *element, void *argument)
+{
+    ((Interface_t *)argument)->display(element);
+    printf(" ");
+}
+
+static integer_t
+avl_node_count(AVLTreeNode_t *node)
+{
+    return node == NULL ? 0 : node->count;
+}
+
+// Recomputes the subtree size of a node from its children
+static integer_t
+avl_count_update(AVLTreeNode_t *node)
+{
+    node->count = avl_node_count(node->left) + avl_node_count(node->right) + 1;
+
+    return node->count;
+}
+
+// Recomputes the subtree size of every node, used when the tree becomes
+// ranked
+static integer_t
+avl_count_tree(AVLTreeNode_t *root)
 {
     if (root == NULL)
-        return;
+        return 0;
 
-    avl_traversal_postorder(root->left, function);
+    avl_count_tree(root->left);
+    avl_count_tree(root->right);
 
-    avl_traversal_postorder(root->right, function);
+    return avl_count_update(root);
+}
 
-    function(root->key);
-    printf(" ");
+// Links a sorted array of nodes as a balanced tree and makes it the tree's
+// content
+static void
+avl_build(AVLTree_t *tree, AVLTreeNode_t **nodes, integer_t size)
+{
+    tree->root = avl_build_subtree(nodes, size, NULL);
+    tree->size = size;
+}
+
+// Uses the middle node as the root of a subtree and builds both halves
+static AVLTreeNode_t *
+avl_build_subtree(AVLTreeNode_t **nodes, integer_t size, AVLTreeNode_t *parent)
+{
+    if (size == 0)
+        return NULL;
+
+    integer_t middle = size / 2;
+
+    AVLTreeNode_t *node = nodes[middle];
+
+    node->parent = parent;
+    node->count = size;
+
+    node->left = avl_build_subtree(nodes, middle, node);
+    node->right = avl_build_subtree(nodes + middle + 1, size - middle - 1,
+                                    node);
+
+    node->height = avl_height_update(node);
+
+    return node;
+}
+
+// Finds the first node with a key not smaller than the element or, if upper
+// is true, the first node with a key bigger than the element
+static AVLTreeNode_t *
+avl_bound(AVLTree_t *tree, void *element, bool upper)
+{
+    AVLTreeNode_t *scan = tree->root, *result = NULL;
+
+    while (scan != NULL)
+    {
+        int comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0 || (comparison == 0 && !upper))
+        {
+            result = scan;
+            scan = scan->left;
+        }
+        else
+            scan = scan->right;
+    }
+
+    return result;
+}
+
+static AVLTreeNode_t *
+avl_successor(AVLTreeNode_t *N)
+{
+    if (N->right != NULL)
+        return avl_minimum(N->right);
+
+    AVLTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->right)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
+}
+
+static AVLTreeNode_t *
+avl_predecessor(AVLTreeNode_t *N)
+{
+    if (N->left != NULL)
+        return avl_maximum(N->left);
+
+    AVLTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->left)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
 }
 
+static AVLTreeNode_t *
+avl_minimum(AVLTreeNode_t *N)
+{
+    // Finds the minimum node of subtree N
+    while (N->left != NULL)
+        N = N->left;
+
+    return N;
+}
+
+static AVLTreeNode_t *
+avl_maximum(AVLTreeNode_t *N)
+{
+    // Finds the maximum node of subtree N
+    while (N->right != NULL)
+        N = N->right;
+
+    return N;
+}
+
+// Joins two subtrees and a node with a key between them. If their heights
+// differ by more than one, the node is linked in the taller subtree where
+// the height is about the same as in the shorter one, and the path back to
+// the root is rebalanced.
+static AVLTreeNode_t *
+avl_join_node(AVLTree_t *tree, AVLTreeNode_t *L, AVLTreeNode_t *K,
+              AVLTreeNode_t *R)
+{
+    int height_l = avl_node_height(L);
+    int height_r = avl_node_height(R);
+
+    // Rotations change the root of the tree they are given
+    AVLTree_t subtree = *tree;
+
+    AVLTreeNode_t *N, *P = NULL;
+
+    if (height_l > height_r + 1)
+    {
+        subtree.root = L;
+
+        // Goes down the right spine of L
+        for (N = L; avl_node_height(N) > height_r + 1; N = N->right)
+            P = N;
+
+        K->left = N;
+        K->right = R;
+        P->right = K;
+    }
+    else if (height_r > height_l + 1)
+    {
+        subtree.root = R;
+
+        // Goes down the left spine of R
+        for (N = R; avl_node_height(N) > height_l + 1; N = N->left)
+            P = N;
+
+        K->left = L;
+        K->right = N;
+        P->left = K;
+    }
+    else
+    {
+        K->left = L;
+        K->right = R;
+    }
+
+    K->parent = P;
+
+    if (K->left != NULL)
+        K->left->parent = K;
+
+    if (K->right != NULL)
+        K->right->parent = K;
+
+    if (P == NULL)
+        subtree.root = K;
+
+    // Fixes heights and sizes from K up to the root
+    avl_rebalance(&subtree, K);
+
+#ifdef DS_STATS
+    tree->stats = subtree.stats;
+#endif
+
+    return subtree.root;
+}
+
+// Detaches a node from its children so it can be joined again
 static void
-avl_traversal_leaves(AVLTreeNode_t *root, display_f function)
+avl_expose(AVLTreeNode_t *N)
 {
-    if (root == NULL)
+    if (N->left != NULL)
+        N->left->parent = NULL;
+
+    if (N->right != NULL)
+        N->right->parent = NULL;
+
+    N->left = NULL;
+    N->right = NULL;
+    N->parent = NULL;
+}
+
+// Joins two subtrees where every key of L is smaller than every key of R
+static AVLTreeNode_t *
+avl_join_subtrees(AVLTree_t *tree, AVLTreeNode_t *L, AVLTreeNode_t *R)
+{
+    if (L == NULL)
+        return R;
+
+    AVLTreeNode_t *K;
+
+    L = avl_split_last(tree, L, &K);
+
+    return avl_join_node(tree, L, K, R);
+}
+
+// Splits a subtree into the nodes smaller and greater than an element. The
+// node with the element itself, if it exists, is returned in K.
+static void
+avl_split_nodes(AVLTree_t *tree, AVLTreeNode_t *T, void *element,
+                AVLTreeNode_t **L, AVLTreeNode_t **K, AVLTreeNode_t **R)
+{
+    if (T == NULL)
+    {
+        *L = *K = *R = NULL;
         return;
+    }
+
+    AVLTreeNode_t *X = T->left, *Y = T->right;
+
+    avl_expose(T);
+
+    int comparison = DS_STATS_COMPARE(tree, T->key, element);
+
+    if (comparison > 0)
+    {
+        avl_split_nodes(tree, X, element, L, K, &X);
+
+        *R = avl_join_node(tree, X, T, Y);
+    }
+    else if (comparison < 0)
+    {
+        avl_split_nodes(tree, Y, element, &Y, K, R);
+
+        *L = avl_join_node(tree, X, T, Y);
+    }
+    else
+    {
+        *L = X;
+        *K = T;
+        *R = Y;
+    }
+}
+
+// Removes the maximum node of a subtree, returned in K
+static AVLTreeNode_t *
+avl_split_last(AVLTree_t *tree, AVLTreeNode_t *T, AVLTreeNode_t **K)
+{
+    AVLTreeNode_t *X = T->left, *Y = T->right;
+
+    avl_expose(T);
+
+    if (Y == NULL)
+    {
+        *K = T;
+        return X;
+    }
+
+    Y = avl_split_last(tree, Y, K);
+
+    return avl_join_node(tree, X, T, Y);
+}
+
+// Splits T2 by the root of T1 and joins the unions of each side back. Nodes
+// of T2 that are duplicates are freed and counted in found.
+static AVLTreeNode_t *
+avl_union_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                integer_t *found)
+{
+    if (T1 == NULL)
+        return T2;
+
+    if (T2 == NULL)
+        return T1;
+
+    AVLTreeNode_t *X = T1->left, *Y = T1->right, *L, *K, *R;
+
+    avl_expose(T1);
+
+    avl_split_nodes(tree, T2, T1->key, &L, &K, &R);
+
+    if (K != NULL)
+    {
+        avl_free_node(tree->pool, K, tree->interface->free);
+
+        (*found)++;
+    }
+
+    X = avl_union_nodes(tree, X, L, found);
+    Y = avl_union_nodes(tree, Y, R, found);
+
+    return avl_join_node(tree, X, T1, Y);
+}
+
+// Splits T1 by the root of T2 and only keeps the node that matched it. The
+// nodes kept are counted in found. T2 is not changed.
+static AVLTreeNode_t *
+avl_intersection_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                      integer_t *found)
+{
+    if (T1 == NULL)
+        return NULL;
+
+    if (T2 == NULL)
+    {
+        avl_free_tree(tree->pool, T1, tree->interface->free);
+        return NULL;
+    }
+
+    AVLTreeNode_t *L, *K, *R;
+
+    avl_split_nodes(tree, T1, T2->key, &L, &K, &R);
 
-    avl_traversal_leaves(root->left, function);
+    L = avl_intersection_nodes(tree, L, T2->left, found);
+    R = avl_intersection_nodes(tree, R, T2->right, found);
 
-    avl_traversal_leaves(root->right, function);
+    if (K == NULL)
+        return avl_join_subtrees(tree, L, R);
 
-    if (root->right == NULL && root->left == NULL)
+    (*found)++;
+
+    return avl_join_node(tree, L, K, R);
+}
+
+// Splits T1 by the root of T2 and frees the node that matched it. The nodes
+// freed are counted in found. T2 is not changed.
+static AVLTreeNode_t *
+avl_difference_nodes(AVLTree_t *tree, AVLTreeNode_t *T1, AVLTreeNode_t *T2,
+                     integer_t *found)
+{
+    if (T1 == NULL)
+        return NULL;
+
+    if (T2 == NULL)
+        return T1;
+
+    AVLTreeNode_t *L, *K, *R;
+
+    avl_split_nodes(tree, T1, T2->key, &L, &K, &R);
+
+    if (K != NULL)
     {
-        function(root->key);
-        printf(" ");
+        avl_free_node(tree->pool, K, tree->interface->free);
+
+        (*found)++;
     }
+
+    L = avl_difference_nodes(tree, L, T2->left, found);
+    R = avl_difference_nodes(tree, R, T2->right, found);
+
+    return avl_join_subtrees(tree, L, R);
+}
+
+// Writes the elements of a subtree in ascending order
+static bool
+avl_save_tree(AVLTree_t *tree, AVLTreeNode_t *root, FILE *stream)
+{
+    while (root != NULL)
+    {
+        if (!avl_save_tree(tree, root->left, stream)
+            || !tree->interface->serialize(root->key, stream))
+            return false;
+
+        root = root->right;
+    }
+
+    return true;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -1282,7 +2652,240 @@ avl_traversal_leaves(AVLTreeNode_t *root, display_f function)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo AVLTreeIterator
+/// An iterator that walks through the elements of a AVLTree_s in order. It only
+/// keeps the current node and follows the parent pointers to reach the next or
+/// previous one, so a full iteration takes linear time and each step takes
+/// constant time on average. The iterator can be placed at the start of a range
+/// with avl_iter_lower_bound() or avl_iter_upper_bound().
+///
+/// If the tree is modified the cursor might point to a node that was freed.
+/// Until the iterator is placed again with avl_iter_to_start(),
+/// avl_iter_to_end() or one of the bound functions, all other functions fail.
+struct AVLTreeIterator_s
+{
+    /// \brief Target AVLTree_s.
+    ///
+    /// Target AVLTree_s. The iterator might need to use some information
+    /// provided by the tree.
+    struct AVLTree_s *target;
+
+    /// \brief Current node.
+    ///
+    /// The node of the element pointed by the cursor or NULL if the tree is
+    /// empty or a bound was not found.
+    struct AVLTreeNode_s *cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is placed it stores the version_id of the target
+    /// structure.
+    integer_t target_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+avl_iter_target_modified(AVLTreeIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new iterator with its cursor at the minimum element of the
+/// target tree.
+///
+/// \param target The target tree.
+///
+/// \return A new iterator or NULL if allocation failed.
+AVLTreeIterator_t *
+avl_iter_new(AVLTree_t *target)
+{
+    AVLTreeIterator_t *iter = malloc(sizeof(AVLTreeIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    avl_iter_retarget(iter, target);
+
+    return iter;
+}
+
+/// Changes the target tree of an iterator and moves its cursor to the
+/// minimum element.
+///
+/// \param iter The iterator to be retargeted.
+/// \param target The new target tree.
+void
+avl_iter_retarget(AVLTreeIterator_t *iter, AVLTree_t *target)
+{
+    iter->target = target;
+
+    avl_iter_to_start(iter);
+}
+
+/// Frees from memory an iterator. The target tree is not changed.
+///
+/// \param iter The iterator to be freed from memory.
+void
+avl_iter_free(AVLTreeIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor to the next element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the maximum element, if it is not at
+/// any element or if the target was modified.
+bool
+avl_iter_next(AVLTreeIterator_t *iter)
+{
+    if (!avl_iter_has_next(iter))
+        return false;
+
+    iter->cursor = avl_successor(iter->cursor);
+
+    return true;
+}
+
+/// Moves the cursor to the previous element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the minimum element, if it is not at
+/// any element or if the target was modified.
+bool
+avl_iter_prev(AVLTreeIterator_t *iter)
+{
+    if (!avl_iter_has_prev(iter))
+        return false;
+
+    iter->cursor = avl_predecessor(iter->cursor);
+
+    return true;
+}
+
+/// Moves the cursor to the minimum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+avl_iter_to_start(AVLTreeIterator_t *iter)
+{
+    AVLTree_t *tree = iter->target;
+
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? avl_minimum(tree->root) : NULL;
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the maximum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+avl_iter_to_end(AVLTreeIterator_t *iter)
+{
+    AVLTree_t *tree = iter->target;
+
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? avl_maximum(tree->root) : NULL;
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the first element that is not smaller than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if every element is smaller than the given one. The cursor
+/// is then not at any element.
+bool
+avl_iter_lower_bound(AVLTreeIterator_t *iter, void *element)
+{
+    iter->target_id = iter->target->version_id;
+    iter->cursor = avl_bound(iter->target, element, false);
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the first element that is bigger than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if no element is bigger than the given one. The cursor is
+/// then not at any element.
+bool
+avl_iter_upper_bound(AVLTreeIterator_t *iter, void *element)
+{
+    iter->target_id = iter->target->version_id;
+    iter->cursor = avl_bound(iter->target, element, true);
+
+    return iter->cursor != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a successor and the
+/// target was not modified.
+bool
+avl_iter_has_next(AVLTreeIterator_t *iter)
+{
+    if (avl_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
+
+    return avl_successor(iter->cursor) != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a predecessor and
+/// the target was not modified.
+bool
+avl_iter_has_prev(AVLTreeIterator_t *iter)
+{
+    if (avl_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
+
+    return avl_predecessor(iter->cursor) != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return The element at the cursor or NULL if the cursor is not at any
+/// element or the target was modified.
+void *
+avl_iter_peek(AVLTreeIterator_t *iter)
+{
+    if (avl_iter_target_modified(iter) || iter->cursor == NULL)
+        return NULL;
+
+    return iter->cursor->key;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+avl_iter_target_modified(AVLTreeIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -0,0 +1,1658 @@
+/**
+ * @file AdaptiveRadixTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "AdaptiveRadixTree.h"
+
+// SSE2 is part of x86-64, so the vector search in nodes of 16 children needs
+// no runtime check
+#if defined(__GNUC__) && defined(__SSE2__)
+#define ART_SSE2
+#include <emmintrin.h>
+#endif
+
+/// Amount of prefix bytes stored in each inner node. Longer prefixes are
+/// skipped when searching and checked against the key of a leaf.
+#define ART_PREFIX 12
+
+/// Inner node types, named after the most children they can have.
+#define ART_NODE4 0
+#define ART_NODE16 1
+#define ART_NODE48 2
+#define ART_NODE256 3
+
+/// An AdaptiveRadixTree_s is a trie over the bytes of its keys. Looking up a
+/// key takes one step per byte and never compares whole keys until the leaf,
+/// unlike a search tree that compares the key once per level with
+/// \c compare_string. Keys that share a prefix share the path to it, so every
+/// key starting with a prefix is in the subtree where the prefix ends.
+///
+/// Inner nodes grow and shrink with their amount of children:
+/// - \c ART_NODE4 and \c ART_NODE16 keep sorted arrays of bytes and children.
+/// A byte is searched in a node of 16 with a single SSE2 comparison where
+/// available;
+/// - \c ART_NODE48 maps every byte to one of 48 children;
+/// - \c ART_NODE256 has a child for every byte.
+///
+/// A chain of inner nodes with a single child is collapsed into the prefix of
+/// its last node, so the height is bounded by the amount of branching bytes
+/// instead of the key length. Only the first \c ART_PREFIX bytes of a prefix
+/// are stored.
+///
+/// Leaves keep a copy of the key, including its terminating null byte, and
+/// are told apart from inner nodes by the lowest bit of their pointers. Since
+/// no key contains a null byte before its end, no key is a prefix of another
+/// and every key ends in a leaf. Children are ordered by byte, so visiting
+/// them in order gives the keys in the order of \c strcmp.
+///
+/// \par Functions
+/// Located in the file AdaptiveRadixTree.c
+struct AdaptiveRadixTree_s
+{
+    /// \brief Root node or leaf.
+    void *root;
+
+    /// \brief Current amount of keys.
+    integer_t count;
+
+    /// \brief Length of the longest key inserted since the last erase.
+    ///
+    /// Bounds the height of the tree, which is the size of the stack of an
+    /// iterator.
+    integer_t longest;
+
+    /// \brief AdaptiveRadixTree_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. This interface is responsible
+    /// for freeing the values of this tree.
+    struct Interface_s *V_interface;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified.
+    integer_t version_id;
+};
+
+/// \brief Header of every inner node.
+struct ArtNode_s
+{
+    /// \brief One of \c ART_NODE4, \c ART_NODE16, \c ART_NODE48 or
+    /// \c ART_NODE256.
+    uint8_t type;
+
+    /// \brief Amount of children.
+    uint16_t count;
+
+    /// \brief Length of the prefix shared by every key below this node.
+    uint32_t prefix_length;
+
+    /// \brief First bytes of the prefix.
+    unsigned char prefix[ART_PREFIX];
+};
+
+/// \brief An inner node with up to 4 children.
+struct ArtNode4_s
+{
+    struct ArtNode_s header;
+    unsigned char keys[4];
+    void *children[4];
+};
+
+/// \brief An inner node with up to 16 children.
+struct ArtNode16_s
+{
+    struct ArtNode_s header;
+    unsigned char keys[16];
+    void *children[16];
+};
+
+/// \brief An inner node with up to 48 children.
+struct ArtNode48_s
+{
+    struct ArtNode_s header;
+
+    /// \brief Position of the child of each byte plus one, or zero.
+    unsigned char index[256];
+
+    void *children[48];
+};
+
+/// \brief An inner node with up to 256 children.
+struct ArtNode256_s
+{
+    struct ArtNode_s header;
+    void *children[256];
+};
+
+/// \brief A key and its value.
+struct ArtLeaf_s
+{
+    void *value;
+
+    /// \brief Length of the key without its null byte.
+    integer_t length;
+
+    char key[];
+};
+
+/// \brief An inner node and the position of its next child to be visited.
+struct ArtFrame_s
+{
+    struct ArtNode_s *node;
+    integer_t position;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+art_is_leaf(const void *node);
+
+static struct ArtLeaf_s *
+art_leaf(const void *node);
+
+static void *
+art_leaf_new(const unsigned char *key, integer_t size, void *value);
+
+static bool
+art_leaf_matches(struct ArtLeaf_s *leaf, const unsigned char *key,
+                 integer_t size);
+
+static struct ArtNode_s *
+art_node_new(uint8_t type);
+
+static void
+art_node_copy_header(struct ArtNode_s *destination, struct ArtNode_s *source);
+
+static integer_t
+art_find16(const unsigned char *keys, integer_t count, unsigned char byte);
+
+static integer_t
+art_lower16(const unsigned char *keys, integer_t count, unsigned char byte);
+
+static void **
+art_find_child(struct ArtNode_s *node, unsigned char byte);
+
+static void *
+art_child_at(struct ArtNode_s *node, integer_t *position);
+
+static struct ArtLeaf_s *
+art_minimum(void *node);
+
+static integer_t
+art_mismatch(struct ArtNode_s *node, const unsigned char *key, integer_t size,
+             integer_t depth);
+
+static bool
+art_add_child(struct ArtNode_s *node, void **ref, unsigned char byte,
+              void *child);
+
+static void
+art_add_child4(struct ArtNode4_s *node, unsigned char byte, void *child);
+
+static void
+art_remove_child(struct ArtNode_s *node, void **ref, unsigned char byte,
+                 void **child);
+
+static struct ArtLeaf_s *
+art_search(AdaptiveRadixTree_t *tree, const unsigned char *key,
+           integer_t size);
+
+static bool
+art_insert_key(AdaptiveRadixTree_t *tree, const unsigned char *key,
+               integer_t size, void *value);
+
+static struct ArtLeaf_s *
+art_remove_key(AdaptiveRadixTree_t *tree, const unsigned char *key,
+               integer_t size);
+
+static void *
+art_seek(AdaptiveRadixTree_t *tree, const unsigned char *prefix,
+         integer_t length);
+
+static integer_t
+art_visit(void *node, visit_f visit, void *argument);
+
+static void
+art_destroy(void *node, Interface_t *interface);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty AdaptiveRadixTree_s.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] value_interface Value interface.
+///
+/// \return A new AdaptiveRadixTree_s or NULL if allocation failed.
+AdaptiveRadixTree_t *
+art_new(Interface_t *value_interface)
+{
+    AdaptiveRadixTree_t *tree = malloc(sizeof(AdaptiveRadixTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->root = NULL;
+    tree->count = 0;
+    tree->longest = 0;
+    tree->V_interface = value_interface;
+    tree->version_id = 0;
+
+    return tree;
+}
+
+/// Frees from memory an AdaptiveRadixTree_s, its keys and its values.
+///
+/// \par Interface Requirements
+/// - Value interface: free
+///
+/// \param[in] tree The adaptive radix tree to be freed from memory.
+void
+art_free(AdaptiveRadixTree_t *tree)
+{
+    art_destroy(tree->root, tree->V_interface);
+
+    free(tree);
+}
+
+/// Frees from memory an AdaptiveRadixTree_s and its keys leaving its values
+/// intact.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree The adaptive radix tree to be freed from memory.
+void
+art_free_shallow(AdaptiveRadixTree_t *tree)
+{
+    art_destroy(tree->root, NULL);
+
+    free(tree);
+}
+
+/// Frees from memory every key and value, leaving the tree empty.
+///
+/// \par Interface Requirements
+/// - Value interface: free
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+void
+art_erase(AdaptiveRadixTree_t *tree)
+{
+    art_destroy(tree->root, tree->V_interface);
+
+    tree->root = NULL;
+    tree->count = 0;
+    tree->longest = 0;
+    tree->version_id++;
+}
+
+/// \param[in] tree AdaptiveRadixTree_s reference.
+///
+/// \return The amount of keys in the tree.
+integer_t
+art_count(AdaptiveRadixTree_t *tree)
+{
+    return tree->count;
+}
+
+/// Searches a key one byte per level and compares it as a whole only at the
+/// leaf.
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value associated with the key or NULL if it was not found.
+void *
+art_get(AdaptiveRadixTree_t *tree, const char *key)
+{
+    struct ArtLeaf_s *leaf = art_search(tree, (const unsigned char *)key,
+                                        (integer_t)strlen(key) + 1);
+
+    return leaf ? leaf->value : NULL;
+}
+
+/// Searches a String key without copying it.
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value associated with the key or NULL if it was not found.
+void *
+art_get_string(AdaptiveRadixTree_t *tree, String key)
+{
+    const char *view;
+
+    if (str_view(key, &view) != DS_OK)
+        return NULL;
+
+    struct ArtLeaf_s *leaf = art_search(tree, (const unsigned char *)view,
+                                        str_length(key) + 1);
+
+    return leaf ? leaf->value : NULL;
+}
+
+/// Inserts a key mapped to a value. The key is copied into its leaf and the
+/// value now belongs to the tree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted.
+/// \return False if the key is already present or if any allocations failed,
+/// in which case the tree is not changed.
+bool
+art_insert(AdaptiveRadixTree_t *tree, const char *key, void *value)
+{
+    return art_insert_key(tree, (const unsigned char *)key,
+                          (integer_t)strlen(key) + 1, value);
+}
+
+/// Inserts a String key mapped to a value. The characters of the key are
+/// copied into its leaf and the String is left intact.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted.
+/// \return False if the key is already present or if any allocations failed,
+/// in which case the tree is not changed.
+bool
+art_insert_string(AdaptiveRadixTree_t *tree, String key, void *value)
+{
+    const char *view;
+
+    if (str_view(key, &view) != DS_OK)
+        return false;
+
+    return art_insert_key(tree, (const unsigned char *)view,
+                          str_length(key) + 1, value);
+}
+
+/// Removes a key from the tree and retrieves its value, which now belongs to
+/// the caller. Inner nodes left with too few children are shrunk.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value associated with \c key.
+///
+/// \return True if the key was removed or false if it was not found.
+bool
+art_remove(AdaptiveRadixTree_t *tree, const char *key, void **value)
+{
+    struct ArtLeaf_s *leaf = art_remove_key(tree, (const unsigned char *)key,
+                                            (integer_t)strlen(key) + 1);
+
+    if (!leaf)
+        return false;
+
+    *value = leaf->value;
+
+    free(leaf);
+
+    return true;
+}
+
+/// Removes a String key from the tree and retrieves its value, which now
+/// belongs to the caller.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value associated with \c key.
+///
+/// \return True if the key was removed or false if it was not found.
+bool
+art_remove_string(AdaptiveRadixTree_t *tree, String key, void **value)
+{
+    const char *view;
+
+    if (str_view(key, &view) != DS_OK)
+        return false;
+
+    struct ArtLeaf_s *leaf = art_remove_key(tree,
+                                            (const unsigned char *)view,
+                                            str_length(key) + 1);
+
+    if (!leaf)
+        return false;
+
+    *value = leaf->value;
+
+    free(leaf);
+
+    return true;
+}
+
+/// \param[in] tree AdaptiveRadixTree_s reference.
+///
+/// \return True if the tree has no keys, otherwise false.
+bool
+art_empty(AdaptiveRadixTree_t *tree)
+{
+    return tree->count == 0;
+}
+
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is in the tree, otherwise false.
+bool
+art_contains(AdaptiveRadixTree_t *tree, const char *key)
+{
+    return art_search(tree, (const unsigned char *)key,
+                      (integer_t)strlen(key) + 1) != NULL;
+}
+
+/// Visits the value of every key starting with a prefix, in the order of
+/// \c strcmp on the keys. The prefix is searched once and its whole subtree is
+/// visited without comparing any more keys. An empty prefix visits every key.
+///
+/// \param[in] tree AdaptiveRadixTree_s reference.
+/// \param[in] prefix The prefix of the keys to be visited.
+/// \param[in] visit Function called with each value and \c argument.
+/// \param[in] argument A user defined argument passed to \c visit.
+///
+/// \return The amount of values visited.
+integer_t
+art_prefix(AdaptiveRadixTree_t *tree, const char *prefix, visit_f visit,
+           void *argument)
+{
+    void *node = art_seek(tree, (const unsigned char *)prefix,
+                          (integer_t)strlen(prefix));
+
+    return art_visit(node, visit, argument);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+art_is_leaf(const void *node)
+{
+    return ((uintptr_t)node & 1) != 0;
+}
+
+static struct ArtLeaf_s *
+art_leaf(const void *node)
+{
+    return (struct ArtLeaf_s *)((uintptr_t)node & ~(uintptr_t)1);
+}
+
+// Returns a tagged leaf with a copy of the key, size including the null byte
+static void *
+art_leaf_new(const unsigned char *key, integer_t size, void *value)
+{
+    struct ArtLeaf_s *leaf = malloc(sizeof(struct ArtLeaf_s) + (size_t)size);
+
+    if (!leaf)
+        return NULL;
+
+    leaf->value = value;
+    leaf->length = size - 1;
+
+    memcpy(leaf->key, key, (size_t)size);
+
+    return (void *)((uintptr_t)leaf | 1);
+}
+
+static bool
+art_leaf_matches(struct ArtLeaf_s *leaf, const unsigned char *key,
+                 integer_t size)
+{
+    return leaf->length + 1 == size
+           && memcmp(leaf->key, key, (size_t)size) == 0;
+}
+
+static struct ArtNode_s *
+art_node_new(uint8_t type)
+{
+    size_t sizes[] = {
+            sizeof(struct ArtNode4_s), sizeof(struct ArtNode16_s),
+            sizeof(struct ArtNode48_s), sizeof(struct ArtNode256_s)
+    };
+
+    struct ArtNode_s *node = calloc(1, sizes[type]);
+
+    if (node)
+        node->type = type;
+
+    return node;
+}
+
+static void
+art_node_copy_header(struct ArtNode_s *destination, struct ArtNode_s *source)
+{
+    destination->count = source->count;
+    destination->prefix_length = source->prefix_length;
+
+    memcpy(destination->prefix, source->prefix, ART_PREFIX);
+}
+
+// Position of a byte in the sorted keys of a node of 16 or -1
+static integer_t
+art_find16(const unsigned char *keys, integer_t count, unsigned char byte)
+{
+#if defined(ART_SSE2)
+    __m128i equal = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte),
+                                   _mm_loadu_si128((const __m128i *)keys));
+
+    unsigned mask = (unsigned)_mm_movemask_epi8(equal) & ((1u << count) - 1);
+
+    return mask ? __builtin_ctz(mask) : -1;
+#else
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (keys[i] == byte)
+            return i;
+    }
+
+    return -1;
+#endif
+}
+
+// Amount of keys of a node of 16 smaller than a byte, where it is inserted
+static integer_t
+art_lower16(const unsigned char *keys, integer_t count, unsigned char byte)
+{
+#if defined(ART_SSE2)
+    // SSE2 only compares signed bytes, flipping the sign bit orders them as
+    // unsigned
+    __m128i bias = _mm_set1_epi8((char)0x80);
+    __m128i less = _mm_cmplt_epi8(
+            _mm_xor_si128(_mm_loadu_si128((const __m128i *)keys), bias),
+            _mm_xor_si128(_mm_set1_epi8((char)byte), bias));
+
+    unsigned mask = (unsigned)_mm_movemask_epi8(less) & ((1u << count) - 1);
+
+    return __builtin_popcount(mask);
+#else
+    integer_t i = 0;
+
+    while (i < count && keys[i] < byte)
+        i++;
+
+    return i;
+#endif
+}
+
+static void **
+art_find_child(struct ArtNode_s *node, unsigned char byte)
+{
+    switch (node->type)
+    {
+        case ART_NODE4:
+        {
+            struct ArtNode4_s *node4 = (struct ArtNode4_s *)node;
+
+            for (integer_t i = 0; i < node->count; i++)
+            {
+                if (node4->keys[i] == byte)
+                    return &node4->children[i];
+            }
+
+            return NULL;
+        }
+        case ART_NODE16:
+        {
+            struct ArtNode16_s *node16 = (struct ArtNode16_s *)node;
+
+            integer_t i = art_find16(node16->keys, node->count, byte);
+
+            return i < 0 ? NULL : &node16->children[i];
+        }
+        case ART_NODE48:
+        {
+            struct ArtNode48_s *node48 = (struct ArtNode48_s *)node;
+
+            integer_t i = node48->index[byte];
+
+            return i == 0 ? NULL : &node48->children[i - 1];
+        }
+        default:
+        {
+            struct ArtNode256_s *node256 = (struct ArtNode256_s *)node;
+
+            return node256->children[byte] ? &node256->children[byte] : NULL;
+        }
+    }
+}
+
+// Returns the first child in byte order at or after a position and moves the
+// position past it, or NULL if there are no more children
+static void *
+art_child_at(struct ArtNode_s *node, integer_t *position)
+{
+    switch (node->type)
+    {
+        case ART_NODE4:
+        {
+            struct ArtNode4_s *node4 = (struct ArtNode4_s *)node;
+
+            return *position < node->count
+                   ? node4->children[(*position)++] : NULL;
+        }
+        case ART_NODE16:
+        {
+            struct ArtNode16_s *node16 = (struct ArtNode16_s *)node;
+
+            return *position < node->count
+                   ? node16->children[(*position)++] : NULL;
+        }
+        case ART_NODE48:
+        {
+            struct ArtNode48_s *node48 = (struct ArtNode48_s *)node;
+
+            while (*position < 256)
+            {
+                integer_t i = node48->index[(*position)++];
+
+                if (i != 0)
+                    return node48->children[i - 1];
+            }
+
+            return NULL;
+        }
+        default:
+        {
+            struct ArtNode256_s *node256 = (struct ArtNode256_s *)node;
+
+            while (*position < 256)
+            {
+                void *child = node256->children[(*position)++];
+
+                if (child)
+                    return child;
+            }
+
+            return NULL;
+        }
+    }
+}
+
+// Leaf with the smallest key below a node
+static struct ArtLeaf_s *
+art_minimum(void *node)
+{
+    while (!art_is_leaf(node))
+    {
+        integer_t position = 0;
+
+        node = art_child_at(node, &position);
+    }
+
+    return art_leaf(node);
+}
+
+// Length of the part of the prefix of a node that matches a key from a depth,
+// reading the bytes that are not stored from the smallest leaf below it
+static integer_t
+art_mismatch(struct ArtNode_s *node, const unsigned char *key, integer_t size,
+             integer_t depth)
+{
+    integer_t limit = node->prefix_length;
+
+    if (limit > size - depth)
+        limit = size - depth;
+
+    integer_t stored = limit < ART_PREFIX ? limit : ART_PREFIX;
+    integer_t i = 0;
+
+    for (; i < stored; i++)
+    {
+        if (node->prefix[i] != key[depth + i])
+            return i;
+    }
+
+    if (limit > ART_PREFIX)
+    {
+        const unsigned char *full =
+                (const unsigned char *)art_minimum(node)->key + depth;
+
+        for (; i < limit; i++)
+        {
+            if (full[i] != key[depth + i])
+                return i;
+        }
+    }
+
+    return i;
+}
+
+// Adds a child to a node that does not have its byte, growing the node into
+// ref when it is full
+static bool
+art_add_child(struct ArtNode_s *node, void **ref, unsigned char byte,
+              void *child)
+{
+    switch (node->type)
+    {
+        case ART_NODE4:
+        {
+            struct ArtNode4_s *node4 = (struct ArtNode4_s *)node;
+
+            if (node->count < 4)
+            {
+                art_add_child4(node4, byte, child);
+                return true;
+            }
+
+            struct ArtNode16_s *node16 =
+                    (struct ArtNode16_s *)art_node_new(ART_NODE16);
+
+            if (!node16)
+                return false;
+
+            art_node_copy_header(&node16->header, node);
+
+            memcpy(node16->keys, node4->keys, 4);
+            memcpy(node16->children, node4->children, sizeof(void *) * 4);
+
+            *ref = node16;
+            free(node4);
+
+            return art_add_child(&node16->header, ref, byte, child);
+        }
+        case ART_NODE16:
+        {
+            struct ArtNode16_s *node16 = (struct ArtNode16_s *)node;
+
+            if (node->count < 16)
+            {
+                integer_t i = art_lower16(node16->keys, node->count, byte);
+                integer_t after = node->count - i;
+
+                memmove(node16->keys + i + 1, node16->keys + i,
+                        (size_t)after);
+                memmove(node16->children + i + 1, node16->children + i,
+                        sizeof(void *) * (size_t)after);
+
+                node16->keys[i] = byte;
+                node16->children[i] = child;
+                node->count++;
+
+                return true;
+            }
+
+            struct ArtNode48_s *node48 =
+                    (struct ArtNode48_s *)art_node_new(ART_NODE48);
+
+            if (!node48)
+                return false;
+
+            art_node_copy_header(&node48->header, node);
+
+            memcpy(node48->children, node16->children, sizeof(void *) * 16);
+
+            for (integer_t i = 0; i < 16; i++)
+                node48->index[node16->keys[i]] = (unsigned char)(i + 1);
+
+            *ref = node48;
+            free(node16);
+
+            return art_add_child(&node48->header, ref, byte, child);
+        }
+        case ART_NODE48:
+        {
+            struct ArtNode48_s *node48 = (struct ArtNode48_s *)node;
+
+            if (node->count < 48)
+            {
+                // Removals leave holes anywhere
+                integer_t i = 0;
+
+                while (node48->children[i])
+                    i++;
+
+                node48->children[i] = child;
+                node48->index[byte] = (unsigned char)(i + 1);
+                node->count++;
+
+                return true;
+            }
+
+            struct ArtNode256_s *node256 =
+                    (struct ArtNode256_s *)art_node_new(ART_NODE256);
+
+            if (!node256)
+                return false;
+
+            art_node_copy_header(&node256->header, node);
+
+            for (integer_t b = 0; b < 256; b++)
+            {
+                integer_t i = node48->index[b];
+
+                if (i != 0)
+                    node256->children[b] = node48->children[i - 1];
+            }
+
+            *ref = node256;
+            free(node48);
+
+            return art_add_child(&node256->header, ref, byte, child);
+        }
+        default:
+        {
+            struct ArtNode256_s *node256 = (struct ArtNode256_s *)node;
+
+            node256->children[byte] = child;
+            node->count++;
+
+            return true;
+        }
+    }
+}
+
+static void
+art_add_child4(struct ArtNode4_s *node, unsigned char byte, void *child)
+{
+    integer_t i = 0;
+
+    while (i < node->header.count && node->keys[i] < byte)
+        i++;
+
+    integer_t after = node->header.count - i;
+
+    memmove(node->keys + i + 1, node->keys + i, (size_t)after);
+    memmove(node->children + i + 1, node->children + i,
+            sizeof(void *) * (size_t)after);
+
+    node->keys[i] = byte;
+    node->children[i] = child;
+    node->header.count++;
+}
+
+// Removes the child of a byte, shrinking the node into ref when it is left
+// with few enough children. A failed allocation only keeps the bigger node.
+static void
+art_remove_child(struct ArtNode_s *node, void **ref, unsigned char byte,
+                 void **child)
+{
+    switch (node->type)
+    {
+        case ART_NODE4:
+        {
+            struct ArtNode4_s *node4 = (struct ArtNode4_s *)node;
+
+            integer_t i = child - node4->children;
+            integer_t after = node->count - i - 1;
+
+            memmove(node4->keys + i, node4->keys + i + 1, (size_t)after);
+            memmove(node4->children + i, node4->children + i + 1,
+                    sizeof(void *) * (size_t)after);
+
+            node->count--;
+
+            if (node->count > 1)
+                return;
+
+            // A single child takes the place of the node and its prefix
+            void *last = node4->children[0];
+
+            if (!art_is_leaf(last))
+            {
+                struct ArtNode_s *next = last;
+
+                integer_t length = node->prefix_length;
+
+                if (length < ART_PREFIX)
+                    node->prefix[length++] = node4->keys[0];
+
+                if (length < ART_PREFIX)
+                {
+                    integer_t copied = next->prefix_length;
+
+                    if (copied > ART_PREFIX - length)
+                        copied = ART_PREFIX - length;
+
+                    memcpy(node->prefix + length, next->prefix,
+                           (size_t)copied);
+
+                    length += copied;
+                }
+
+                memcpy(next->prefix, node->prefix,
+                       (size_t)(length < ART_PREFIX ? length : ART_PREFIX));
+
+                next->prefix_length += node->prefix_length + 1;
+            }
+
+            *ref = last;
+            free(node4);
+
+            return;
+        }
+        case ART_NODE16:
+        {
+            struct ArtNode16_s *node16 = (struct ArtNode16_s *)node;
+
+            integer_t i = child - node16->children;
+            integer_t after = node->count - i - 1;
+
+            memmove(node16->keys + i, node16->keys + i + 1, (size_t)after);
+            memmove(node16->children + i, node16->children + i + 1,
+                    sizeof(void *) * (size_t)after);
+
+            node->count--;
+
+            if (node->count > 3)
+                return;
+
+            struct ArtNode4_s *node4 =
+                    (struct ArtNode4_s *)art_node_new(ART_NODE4);
+
+            if (!node4)
+                return;
+
+            art_node_copy_header(&node4->header, node);
+
+            memcpy(node4->keys, node16->keys, 3);
+            memcpy(node4->children, node16->children, sizeof(void *) * 3);
+
+            *ref = node4;
+            free(node16);
+
+            return;
+        }
+        case ART_NODE48:
+        {
+            struct ArtNode48_s *node48 = (struct ArtNode48_s *)node;
+
+            node48->children[node48->index[byte] - 1] = NULL;
+            node48->index[byte] = 0;
+            node->count--;
+
+            if (node->count > 12)
+                return;
+
+            struct ArtNode16_s *node16 =
+                    (struct ArtNode16_s *)art_node_new(ART_NODE16);
+
+            if (!node16)
+                return;
+
+            art_node_copy_header(&node16->header, node);
+
+            integer_t count = 0;
+
+            for (integer_t b = 0; b < 256; b++)
+            {
+                if (node48->index[b])
+                {
+                    node16->keys[count] = (unsigned char)b;
+                    node16->children[count++] =
+                            node48->children[node48->index[b] - 1];
+                }
+            }
+
+            *ref = node16;
+            free(node48);
+
+            return;
+        }
+        default:
+        {
+            struct ArtNode256_s *node256 = (struct ArtNode256_s *)node;
+
+            node256->children[byte] = NULL;
+            node->count--;
+
+            if (node->count > 37)
+                return;
+
+            struct ArtNode48_s *node48 =
+                    (struct ArtNode48_s *)art_node_new(ART_NODE48);
+
+            if (!node48)
+                return;
+
+            art_node_copy_header(&node48->header, node);
+
+            integer_t count = 0;
+
+            for (integer_t b = 0; b < 256; b++)
+            {
+                if (node256->children[b])
+                {
+                    node48->children[count++] = node256->children[b];
+                    node48->index[b] = (unsigned char)count;
+                }
+            }
+
+            *ref = node48;
+            free(node256);
+
+            return;
+        }
+    }
+}
+
+// Prefixes are skipped past their stored bytes, the leaf checks the whole key
+static struct ArtLeaf_s *
+art_search(AdaptiveRadixTree_t *tree, const unsigned char *key,
+           integer_t size)
+{
+    void *current = tree->root;
+    integer_t depth = 0;
+
+    while (current)
+    {
+        if (art_is_leaf(current))
+        {
+            struct ArtLeaf_s *leaf = art_leaf(current);
+
+            return art_leaf_matches(leaf, key, size) ? leaf : NULL;
+        }
+
+        struct ArtNode_s *node = current;
+
+        integer_t stored = node->prefix_length < ART_PREFIX
+                           ? node->prefix_length : ART_PREFIX;
+
+        for (integer_t i = 0; i < stored; i++)
+        {
+            if (depth + i >= size || node->prefix[i] != key[depth + i])
+                return NULL;
+        }
+
+        depth += node->prefix_length;
+
+        if (depth >= size)
+            return NULL;
+
+        void **child = art_find_child(node, key[depth++]);
+
+        current = child ? *child : NULL;
+    }
+
+    return NULL;
+}
+
+static bool
+art_insert_key(AdaptiveRadixTree_t *tree, const unsigned char *key,
+               integer_t size, void *value)
+{
+    void **ref = &tree->root;
+    integer_t depth = 0;
+
+    while (*ref && !art_is_leaf(*ref))
+    {
+        struct ArtNode_s *node = *ref;
+
+        integer_t matched = art_mismatch(node, key, size, depth);
+
+        if (matched < (integer_t)node->prefix_length)
+        {
+            // The key leaves the prefix, which is split by a new parent
+            struct ArtNode_s *parent = art_node_new(ART_NODE4);
+            void *leaf = art_leaf_new(key, size, value);
+
+            if (!parent || !leaf)
+            {
+                free(parent);
+                free(art_leaf(leaf));
+                return false;
+            }
+
+            parent->prefix_length = (uint32_t)matched;
+
+            memcpy(parent->prefix, node->prefix,
+                   (size_t)(matched < ART_PREFIX ? matched : ART_PREFIX));
+
+            unsigned char byte;
+
+            if (node->prefix_length <= ART_PREFIX)
+            {
+                byte = node->prefix[matched];
+
+                node->prefix_length -= (uint32_t)matched + 1;
+
+                memmove(node->prefix, node->prefix + matched + 1,
+                        node->prefix_length);
+            }
+            else
+            {
+                const unsigned char *full = (const unsigned char *)
+                        art_minimum(node)->key + depth + matched;
+
+                byte = full[0];
+
+                node->prefix_length -= (uint32_t)matched + 1;
+
+                memcpy(node->prefix, full + 1, node->prefix_length < ART_PREFIX
+                                               ? node->prefix_length
+                                               : ART_PREFIX);
+            }
+
+            art_add_child4((struct ArtNode4_s *)parent, byte, node);
+            art_add_child4((struct ArtNode4_s *)parent, key[depth + matched],
+                           leaf);
+
+            *ref = parent;
+
+            break;
+        }
+
+        depth += node->prefix_length;
+
+        void **child = art_find_child(node, key[depth]);
+
+        if (child)
+        {
+            ref = child;
+            depth++;
+            continue;
+        }
+
+        void *leaf = art_leaf_new(key, size, value);
+
+        if (!leaf)
+            return false;
+
+        if (!art_add_child(node, ref, key[depth], leaf))
+        {
+            free(art_leaf(leaf));
+            return false;
+        }
+
+        break;
+    }
+
+    if (!*ref)
+    {
+        void *leaf = art_leaf_new(key, size, value);
+
+        if (!leaf)
+            return false;
+
+        *ref = leaf;
+    }
+    else if (art_is_leaf(*ref))
+    {
+        struct ArtLeaf_s *existing = art_leaf(*ref);
+
+        if (art_leaf_matches(existing, key, size))
+            return false;
+
+        // Both keys share a prefix and then branch into a new parent
+        struct ArtNode_s *parent = art_node_new(ART_NODE4);
+        void *leaf = art_leaf_new(key, size, value);
+
+        if (!parent || !leaf)
+        {
+            free(parent);
+            free(art_leaf(leaf));
+            return false;
+        }
+
+        const unsigned char *other = (const unsigned char *)existing->key;
+
+        integer_t matched = 0;
+
+        while (other[depth + matched] == key[depth + matched])
+            matched++;
+
+        parent->prefix_length = (uint32_t)matched;
+
+        memcpy(parent->prefix, key + depth,
+               (size_t)(matched < ART_PREFIX ? matched : ART_PREFIX));
+
+        art_add_child4((struct ArtNode4_s *)parent, other[depth + matched],
+                       *ref);
+        art_add_child4((struct ArtNode4_s *)parent, key[depth + matched],
+                       leaf);
+
+        *ref = parent;
+    }
+
+    tree->count++;
+    tree->version_id++;
+
+    if (tree->longest < size - 1)
+        tree->longest = size - 1;
+
+    return true;
+}
+
+static struct ArtLeaf_s *
+art_remove_key(AdaptiveRadixTree_t *tree, const unsigned char *key,
+               integer_t size)
+{
+    void **ref = &tree->root;
+    integer_t depth = 0;
+    struct ArtLeaf_s *leaf = NULL;
+
+    if (!*ref)
+        return NULL;
+
+    if (art_is_leaf(*ref))
+    {
+        leaf = art_leaf(*ref);
+
+        if (!art_leaf_matches(leaf, key, size))
+            return NULL;
+
+        *ref = NULL;
+    }
+
+    while (!leaf)
+    {
+        struct ArtNode_s *node = *ref;
+
+        integer_t stored = node->prefix_length < ART_PREFIX
+                           ? node->prefix_length : ART_PREFIX;
+
+        for (integer_t i = 0; i < stored; i++)
+        {
+            if (depth + i >= size || node->prefix[i] != key[depth + i])
+                return NULL;
+        }
+
+        depth += node->prefix_length;
+
+        if (depth >= size)
+            return NULL;
+
+        void **child = art_find_child(node, key[depth]);
+
+        if (!child)
+            return NULL;
+
+        if (art_is_leaf(*child))
+        {
+            if (!art_leaf_matches(art_leaf(*child), key, size))
+                return NULL;
+
+            leaf = art_leaf(*child);
+
+            art_remove_child(node, ref, key[depth], child);
+        }
+
+        ref = child;
+        depth++;
+    }
+
+    tree->count--;
+    tree->version_id++;
+
+    return leaf;
+}
+
+// Node or leaf where every key starting with a prefix is found
+static void *
+art_seek(AdaptiveRadixTree_t *tree, const unsigned char *prefix,
+         integer_t length)
+{
+    void *current = tree->root;
+    integer_t depth = 0;
+
+    while (current)
+    {
+        if (art_is_leaf(current))
+        {
+            struct ArtLeaf_s *leaf = art_leaf(current);
+
+            if (leaf->length < length
+                || memcmp(leaf->key, prefix, (size_t)length) != 0)
+                return NULL;
+
+            return current;
+        }
+
+        if (depth == length)
+            return current;
+
+        struct ArtNode_s *node = current;
+
+        integer_t left = length - depth;
+        integer_t matched = art_mismatch(node, prefix, length, depth);
+
+        // The prefix either ends inside the prefix of the node or leaves it
+        if (left <= (integer_t)node->prefix_length)
+            return matched == left ? current : NULL;
+
+        if (matched < (integer_t)node->prefix_length)
+            return NULL;
+
+        depth += node->prefix_length;
+
+        void **child = art_find_child(node, prefix[depth++]);
+
+        current = child ? *child : NULL;
+    }
+
+    return NULL;
+}
+
+static integer_t
+art_visit(void *node, visit_f visit, void *argument)
+{
+    if (!node)
+        return 0;
+
+    if (art_is_leaf(node))
+    {
+        visit(art_leaf(node)->value, argument);
+
+        return 1;
+    }
+
+    integer_t count = 0, position = 0;
+    void *child;
+
+    while ((child = art_child_at(node, &position)) != NULL)
+        count += art_visit(child, visit, argument);
+
+    return count;
+}
+
+static void
+art_destroy(void *node, Interface_t *interface)
+{
+    if (!node)
+        return;
+
+    if (art_is_leaf(node))
+    {
+        struct ArtLeaf_s *leaf = art_leaf(node);
+
+        if (interface)
+            interface_release(interface, leaf->value);
+
+        free(leaf);
+
+        return;
+    }
+
+    integer_t position = 0;
+    void *child;
+
+    while ((child = art_child_at(node, &position)) != NULL)
+        art_destroy(child, interface);
+
+    free(node);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \brief An iterator over an AdaptiveRadixTree_s.
+///
+/// Visits the keys starting with a prefix in order, walking the subtree of the
+/// prefix with a stack of the inner nodes above the current leaf. The stack
+/// is sized for the longest key when the iterator is created. The iterator
+/// stops working once the target is modified by anything other than
+/// art_iter_set_value().
+struct AdaptiveRadixTreeIterator_s
+{
+    /// \brief Target adaptive radix tree.
+    struct AdaptiveRadixTree_s *target;
+
+    /// \brief Subtree of every key starting with the prefix.
+    void *start;
+
+    /// \brief Inner nodes above the leaf after the cursor.
+    struct ArtFrame_s *frames;
+
+    /// \brief Amount of inner nodes in the stack.
+    integer_t depth;
+
+    /// \brief Current leaf or NULL if there are none.
+    struct ArtLeaf_s *cursor;
+
+    /// \brief Leaf after the cursor or NULL if there are none.
+    struct ArtLeaf_s *next;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure.
+    integer_t target_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+art_iter_target_modified(AdaptiveRadixTreeIterator_t *iter);
+
+static struct ArtLeaf_s *
+art_iter_advance(AdaptiveRadixTreeIterator_t *iter);
+
+static void
+art_iter_begin(AdaptiveRadixTreeIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new iterator pointing to the smallest key starting with a prefix.
+/// An empty prefix iterates over every key.
+///
+/// \param[in] target Target adaptive radix tree.
+/// \param[in] prefix The prefix of the keys to be iterated.
+///
+/// \return A new AdaptiveRadixTreeIterator_s or NULL if allocation failed.
+AdaptiveRadixTreeIterator_t *
+art_iter_new(AdaptiveRadixTree_t *target, const char *prefix)
+{
+    AdaptiveRadixTreeIterator_t *iter =
+            malloc(sizeof(AdaptiveRadixTreeIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    // Every inner node on a path consumes at least one byte of its key
+    iter->frames = malloc(sizeof(struct ArtFrame_s)
+                          * (size_t)(target->longest + 1));
+
+    if (!iter->frames)
+    {
+        free(iter);
+        return NULL;
+    }
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->start = art_seek(target, (const unsigned char *)prefix,
+                           (integer_t)strlen(prefix));
+
+    art_iter_begin(iter);
+
+    return iter;
+}
+
+/// Frees from memory an existing iterator.
+///
+/// \param[in] iter The iterator to be freed from memory.
+void
+art_iter_free(AdaptiveRadixTreeIterator_t *iter)
+{
+    free(iter->frames);
+    free(iter);
+}
+
+/// Iterates to the next key-value pair in key order.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+///
+/// \return True if the iterator moved to the next pair.
+/// \return False if the target was modified or if there are no more pairs.
+bool
+art_iter_next(AdaptiveRadixTreeIterator_t *iter)
+{
+    if (art_iter_target_modified(iter))
+        return false;
+
+    if (!iter->next)
+        return false;
+
+    iter->cursor = iter->next;
+    iter->next = art_iter_advance(iter);
+
+    return true;
+}
+
+/// Iterates back to the first key-value pair.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+///
+/// \return True if the operation was successful or false if the target was
+/// modified.
+bool
+art_iter_to_start(AdaptiveRadixTreeIterator_t *iter)
+{
+    if (art_iter_target_modified(iter))
+        return false;
+
+    art_iter_begin(iter);
+
+    return true;
+}
+
+/// Returns true if there is another key-value pair after the current one.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+///
+/// \return True if there is a next pair, otherwise false.
+bool
+art_iter_has_next(AdaptiveRadixTreeIterator_t *iter)
+{
+    return !art_iter_target_modified(iter) && iter->next != NULL;
+}
+
+/// Gets the key of the current key-value pair. The key belongs to the tree.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+/// \param[out] key The current key.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if there are no keys.
+bool
+art_iter_get_key(AdaptiveRadixTreeIterator_t *iter, const char **key)
+{
+    if (art_iter_target_modified(iter) || !iter->cursor)
+        return false;
+
+    *key = iter->cursor->key;
+
+    return true;
+}
+
+/// Gets the value of the current key-value pair.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+/// \param[out] value The current value.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if there are no keys.
+bool
+art_iter_get_value(AdaptiveRadixTreeIterator_t *iter, void **value)
+{
+    if (art_iter_target_modified(iter) || !iter->cursor)
+        return false;
+
+    *value = iter->cursor->value;
+
+    return true;
+}
+
+/// Sets the value of the current key-value pair. The previous value is not
+/// freed and the user is responsible for it.
+///
+/// \param[in] iter AdaptiveRadixTreeIterator_s reference.
+/// \param[in] value The new value.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if there are no keys.
+bool
+art_iter_set_value(AdaptiveRadixTreeIterator_t *iter, void *value)
+{
+    if (art_iter_target_modified(iter) || !iter->cursor)
+        return false;
+
+    iter->cursor->value = value;
+
+    return true;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+art_iter_target_modified(AdaptiveRadixTreeIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+// Depth-first walk to the next leaf
+static struct ArtLeaf_s *
+art_iter_advance(AdaptiveRadixTreeIterator_t *iter)
+{
+    while (iter->depth > 0)
+    {
+        struct ArtFrame_s *frame = &iter->frames[iter->depth - 1];
+
+        void *child = art_child_at(frame->node, &frame->position);
+
+        if (!child)
+        {
+            iter->depth--;
+            continue;
+        }
+
+        if (art_is_leaf(child))
+            return art_leaf(child);
+
+        iter->frames[iter->depth].node = child;
+        iter->frames[iter->depth].position = 0;
+        iter->depth++;
+    }
+
+    return NULL;
+}
+
+static void
+art_iter_begin(AdaptiveRadixTreeIterator_t *iter)
+{
+    iter->depth = 0;
+    iter->cursor = NULL;
+    iter->next = NULL;
+
+    if (!iter->start)
+        return;
+
+    if (art_is_leaf(iter->start))
+    {
+        iter->cursor = art_leaf(iter->start);
+        return;
+    }
+
+    iter->frames[0].node = iter->start;
+    iter->frames[0].position = 0;
+    iter->depth = 1;
+
+    iter->cursor = art_iter_advance(iter);
+    iter->next = art_iter_advance(iter);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
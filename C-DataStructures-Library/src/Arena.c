@@ -0,0 +1,285 @@
+/**
+ * @file Arena.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "Arena.h"
+#include <stddef.h>
+
+/// An Arena_s is a bump allocator. Memory is requested from malloc() in big
+/// blocks and every allocation simply advances an offset inside the current
+/// block. Single allocations can't be freed; instead, everything is released
+/// at once with arn_reset() or arn_free().
+///
+/// This makes it a good fit for "build, use, drop" workloads: copying a whole
+/// structure into an arena costs a couple of malloc() calls instead of one
+/// per element, the copied elements are next to each other in memory and
+/// dropping them is a single operation.
+///
+/// \par Functions
+/// Located in the file Arena.c
+struct Arena_s
+{
+    /// \brief Block size.
+    ///
+    /// Usable size in bytes of each block. Allocations bigger than this get a
+    /// block of their own.
+    size_t block_size;
+
+    /// \brief Blocks list.
+    ///
+    /// Singly-linked list of all blocks. The first block is the one where
+    /// allocations are currently made.
+    struct ArenaBlock_s *blocks;
+
+    /// \brief Bytes handed out.
+    ///
+    /// Sum of the sizes of all allocations, after alignment.
+    size_t used;
+
+    /// \brief Bytes reserved.
+    ///
+    /// Sum of the usable sizes of all blocks.
+    size_t reserved;
+
+    /// \brief Arena allocator.
+    ///
+    /// An allocator whose context is this arena, returned by arn_allocator().
+    struct Allocator_s allocator;
+};
+
+/// \brief An Arena_s block.
+///
+/// Implementation detail. A block header followed by its memory in the same
+/// allocation.
+struct ArenaBlock_s
+{
+    /// \brief Next block.
+    ///
+    /// Next, older, block or NULL if this is the first block allocated.
+    struct ArenaBlock_s *next;
+
+    /// \brief Block size.
+    ///
+    /// Usable size in bytes of this block.
+    size_t size;
+
+    /// \brief Offset of the next allocation.
+    ///
+    /// How many bytes, from the start of the block, were handed out.
+    size_t offset;
+
+    /// \brief Block memory.
+    ///
+    /// Where the memory of this block begins.
+    unsigned char *memory;
+};
+
+typedef struct ArenaBlock_s ArenaBlock_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static ArenaBlock_t *
+arn_new_block(size_t size);
+
+static void *
+arn_allocator_alloc(void *context, size_t size);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new Arena_s. No block is allocated until the first
+/// allocation is made.
+///
+/// \param[in] block_size The usable size of each block.
+///
+/// \return A new Arena_s or NULL if allocation failed or if \c block_size is
+/// 0.
+Arena_t *
+arn_new(size_t block_size)
+{
+    if (block_size == 0)
+        return NULL;
+
+    Arena_t *arena = malloc(sizeof(Arena_t));
+
+    if (!arena)
+        return NULL;
+
+    arena->block_size = block_size;
+    arena->blocks = NULL;
+    arena->used = 0;
+    arena->reserved = 0;
+
+    arena->allocator.alloc = arn_allocator_alloc;
+    arena->allocator.dealloc = NULL;
+    arena->allocator.context = arena;
+
+    return arena;
+}
+
+/// Frees from memory an Arena_s and all of its blocks. Everything allocated
+/// from the arena becomes invalid.
+///
+/// \param[in] arena The arena to be freed from memory.
+void
+arn_free(Arena_t *arena)
+{
+    ArenaBlock_t *scan = arena->blocks;
+
+    while (scan != NULL)
+    {
+        ArenaBlock_t *next = scan->next;
+
+        free(scan);
+
+        scan = next;
+    }
+
+    free(arena);
+}
+
+/// Releases everything allocated from the arena. The newest block is kept so
+/// that the arena can be reused without calling malloc() again, all others
+/// are freed.
+///
+/// \param[in] arena Arena_s reference.
+void
+arn_reset(Arena_t *arena)
+{
+    arena->used = 0;
+
+    if (arena->blocks == NULL)
+        return;
+
+    ArenaBlock_t *scan = arena->blocks->next;
+
+    while (scan != NULL)
+    {
+        ArenaBlock_t *next = scan->next;
+
+        free(scan);
+
+        scan = next;
+    }
+
+    arena->blocks->next = NULL;
+    arena->blocks->offset = 0;
+    arena->reserved = arena->blocks->size;
+}
+
+/// Returns the amount of bytes handed out by the arena, including alignment.
+///
+/// \param[in] arena Arena_s reference.
+///
+/// \return The amount of bytes in use.
+size_t
+arn_used(Arena_t *arena)
+{
+    return arena->used;
+}
+
+/// Returns the amount of bytes of all blocks of the arena.
+///
+/// \param[in] arena Arena_s reference.
+///
+/// \return The amount of bytes reserved.
+size_t
+arn_reserved(Arena_t *arena)
+{
+    return arena->reserved;
+}
+
+/// Returns an allocator that allocates from the arena. Its deallocation
+/// function is NULL since single allocations can't be freed. The allocator
+/// is valid for as long as the arena is.
+///
+/// \param[in] arena Arena_s reference.
+///
+/// \return The arena's allocator.
+Allocator_t *
+arn_allocator(Arena_t *arena)
+{
+    return &(arena->allocator);
+}
+
+/// Allocates a block of memory from the arena, suitably aligned for any type.
+///
+/// \param[in] arena Arena_s reference.
+/// \param[in] size The size of the block.
+///
+/// \return A block of \c size bytes or NULL if allocation failed.
+void *
+arn_alloc(Arena_t *arena, size_t size)
+{
+    const size_t align = _Alignof(max_align_t);
+
+    size = (size + align - 1) / align * align;
+
+    if (size == 0)
+        size = align;
+
+    ArenaBlock_t *block = arena->blocks;
+
+    if (block == NULL || block->size - block->offset < size)
+    {
+        block = arn_new_block(size > arena->block_size ? size
+                                                       : arena->block_size);
+
+        if (!block)
+            return NULL;
+
+        if (arena->blocks != NULL && size > arena->block_size)
+        {
+            // Keep allocating from the current block since this one is full
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        }
+        else
+        {
+            block->next = arena->blocks;
+            arena->blocks = block;
+        }
+
+        arena->reserved += block->size;
+    }
+
+    void *result = block->memory + block->offset;
+
+    block->offset += size;
+    arena->used += size;
+
+    return result;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static ArenaBlock_t *
+arn_new_block(size_t size)
+{
+    const size_t align = _Alignof(max_align_t);
+
+    size_t header = (sizeof(ArenaBlock_t) + align - 1) / align * align;
+
+    ArenaBlock_t *block = malloc(header + size);
+
+    if (!block)
+        return NULL;
+
+    block->next = NULL;
+    block->size = size;
+    block->offset = 0;
+    block->memory = (unsigned char *)block + header;
+
+    return block;
+}
+
+static void *
+arn_allocator_alloc(void *context, size_t size)
+{
+    return arn_alloc(context, size);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
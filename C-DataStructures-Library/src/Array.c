@@ -7,6 +7,8 @@
  */
 
 #include "Array.h"
+#include "Bulk.h"
+#include "Sort.h"
 
 /// An Array_s is an abstraction of a C array composed of a data buffer and a
 /// length variable. It is a static array, that is, it won't increase in size.
@@ -87,13 +89,6 @@ struct Array_s
     integer_t version_id;
 };
 
-///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
-
-static void
-arr_quicksort(Array_t *array, void **buffer, integer_t length,
-                          compare_f comparator);
-
-////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a new Array_s with a custom interface and a defined length.
 ///
@@ -137,7 +132,7 @@ arr_free(Array_t *array)
     for (integer_t i = 0; i < array->length; i++)
     {
         if (array->buffer[i] != NULL)
-            array->interface->free(array->buffer[i]);
+            interface_release(array->interface, array->buffer[i]);
     }
 
     free(array->buffer);
@@ -160,7 +155,7 @@ arr_erase(Array_t *array)
 {
     for (integer_t i = 0; i < array->length; i++)
     {
-        array->interface->free(array->buffer[i]);
+        interface_release(array->interface, array->buffer[i]);
 
         array->buffer[i] = NULL;
     }
@@ -447,7 +442,7 @@ arr_update_first(Array_t *array, void *element)
             void *replaced = array->buffer[i];
             array->buffer[i] = element;
 
-            array->interface->free(replaced);
+            interface_release(array->interface, replaced);
 
             array->version_id++;
 
@@ -478,7 +473,7 @@ arr_update(Array_t *array, void *element, integer_t index)
     array->buffer[index] = element;
 
     if (replaced)
-        array->interface->free(replaced);
+        interface_release(array->interface, replaced);
 
     if (element == NULL)
         array->count--;
@@ -503,7 +498,7 @@ arr_update_last(Array_t *array, void *element)
             void *replaced = array->buffer[i];
             array->buffer[i] = element;
 
-            array->interface->free(replaced);
+            interface_release(array->interface, replaced);
 
             array->version_id++;
 
@@ -699,8 +694,8 @@ arr_copy(Array_t *array)
     for (integer_t i = 0; i < array->length; i++)
     {
         result->buffer[i] = array->buffer[i] == NULL
-                            ? NULL
-                            : array->interface->copy(array->buffer[i]);
+                ? NULL
+                : interface_copy(array->interface, array->buffer[i]);
     }
 
     return result;
@@ -731,8 +726,7 @@ arr_copy_shallow(Array_t *array)
 void
 arr_sort(Array_t *array)
 {
-    arr_quicksort(array, array->buffer, array->length,
-            array->interface->compare);
+    srt_sort(array->buffer, array->length, array->interface->compare);
 
     array->version_id++;
 }
@@ -743,9 +737,36 @@ arr_sort(Array_t *array)
 void
 arr_sortby(Array_t *array, compare_f comparator)
 {
-    arr_quicksort(array, array->buffer, array->length, comparator);
+    srt_sort(array->buffer, array->length, comparator);
+
+    array->version_id++;
+}
+
+/// Sorts the array with its interface's compare function using a temporary
+/// pool of \c threads threads. The result is the same as \ref arr_sort but
+/// the order of equal elements is unspecified.
+///
+/// \param[in] array Array_s reference.
+/// \param[in] threads The amount of threads, greater than 0.
+///
+/// \return True if the array was sorted, false if \c threads is invalid or
+/// the thread pool could not be created.
+bool
+arr_sort_parallel(Array_t *array, integer_t threads)
+{
+    ThreadPool_t *pool = tpl_new(threads);
+
+    if (!pool)
+        return false;
+
+    srt_sort_parallel(array->buffer, array->length, array->interface->compare,
+                      pool);
+
+    tpl_free(pool);
 
     array->version_id++;
+
+    return true;
 }
 
 ///
@@ -777,13 +798,36 @@ arr_to_array(Array_t *array, integer_t *length, bool shallow)
         {
             result[i] = array->buffer[i] == NULL
                         ? NULL
-                        : array->interface->copy(array->buffer[i]);
+                        : interface_copy(array->interface, array->buffer[i]);
         }
     }
 
     return result;
 }
 
+/// Gives direct access to the slots from \c position to the end of the array,
+/// which are stored contiguously. Empty slots are NULL.
+/// The span is invalidated by any change to the array.
+///
+/// \param[in] array Array_s reference.
+/// \param[in] position Index of the first slot of the span.
+/// \param[out] span Set to the first slot of the span.
+///
+/// \return The amount of slots in the span or 0 if \c position is out of
+/// bounds.
+integer_t
+arr_span(Array_t *array, integer_t position, void ***span)
+{
+    *span = NULL;
+
+    if (position < 0 || position >= array->length)
+        return 0;
+
+    *span = array->buffer + position;
+
+    return array->length - position;
+}
+
 ///
 /// \param[in] interface
 /// \param[in] buffer
@@ -811,6 +855,114 @@ arr_from_array(Interface_t *interface, void **buffer, integer_t length)
     return result;
 }
 
+/// Calls \c visit with every element of the array and \c argument, skipping
+/// empty slots. With a \c pool the elements are visited in no particular order
+/// by several threads at once; otherwise they are visited in order.
+///
+/// \param[in] array Array_s reference.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument passed to \c visit.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+arr_for_each(Array_t *array, visit_f visit, void *argument, ThreadPool_t *pool)
+{
+    blk_for_each(array->buffer, array->length, visit, argument, pool);
+}
+
+/// Makes a new Array_s with the elements made by \c map out of each element of
+/// the array, in the same slots. The new array uses \c interface, which may be
+/// of another type of element. With a \c pool the work is split between its
+/// threads, see the functions of Bulk.h; otherwise it runs in the calling
+/// thread.
+///
+/// \par Interface Requirements
+/// - free (of the new interface)
+///
+/// \param[in] array Array_s reference.
+/// \param[in] interface The interface of the new array.
+/// \param[in] map The function that makes each new element.
+/// \param[in] argument An argument passed to \c map.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return A new Array_s or NULL if allocation failed or if \c map
+/// returned NULL for any element.
+Array_t *
+arr_map(Array_t *array, Interface_t *interface, map_f map, void *argument,
+        ThreadPool_t *pool)
+{
+    Array_t *result = arr_new(interface, array->length);
+
+    if (!result)
+        return NULL;
+
+    if (!blk_map(array->buffer, result->buffer, array->length, map, argument,
+                 pool))
+    {
+        for (integer_t i = 0; i < array->length; i++)
+        {
+            if (result->buffer[i])
+                interface_release(interface, result->buffer[i]);
+        }
+
+        arr_free_shallow(result);
+
+        return NULL;
+    }
+
+    result->count = array->count;
+
+    return result;
+}
+
+/// Removes every element of the array for which \c keep returns false,
+/// releasing it with the interface's free function. Their slots become empty;
+/// no element changes its slot. With a \c pool the work is split between its
+/// threads, see the functions of Bulk.h; otherwise it runs in the calling
+/// thread.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] array Array_s reference.
+/// \param[in] keep Returns true for the elements that are kept.
+/// \param[in] argument An argument passed to \c keep.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return The amount of elements removed.
+integer_t
+arr_filter_in_place(Array_t *array, predicate_f keep, void *argument,
+                    ThreadPool_t *pool)
+{
+    integer_t removed = blk_filter(array->buffer, array->length, keep,
+                                   argument, array->interface, false, pool);
+
+    array->count -= removed;
+    array->version_id++;
+
+    return removed;
+}
+
+/// Folds every element of the array into \c accumulator with \c reduce.
+/// With a \c pool, parts of the array are folded into copies of
+/// \c identity and then into \c accumulator with \c combine, see
+/// blk_reduce().
+///
+/// \param[in] array Array_s reference.
+/// \param[in,out] accumulator The initial value and the result.
+/// \param[in] identity The initial value of each partial result.
+/// \param[in] accumulator_size Size in bytes of the accumulator.
+/// \param[in] reduce Folds an element into an accumulator.
+/// \param[in] combine Folds a partial result into an accumulator.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+arr_reduce(Array_t *array, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool)
+{
+    blk_reduce(array->buffer, array->length, accumulator, identity,
+               accumulator_size, reduce, combine, pool);
+}
+
 ///
 /// \param[in] array
 /// \param[in] display_mode
@@ -855,40 +1007,6 @@ arr_display(Array_t *array, int display_mode)
     }
 }
 
-///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
-
-static void
-arr_quicksort(Array_t *array, void **buffer, integer_t length,
-                          compare_f comparator)
-{
-    if (length < 2)
-        return;
-
-    void *pivot = buffer[length / 2];
-
-    integer_t i, j;
-    for (i = 0, j = length - 1; ; i++, j--)
-    {
-        while (comparator(buffer[i], pivot) < 0)
-            i++;
-
-        while (comparator(buffer[j], pivot) > 0)
-            j--;
-
-        if (i >= j)
-            break;
-
-        void *temp = buffer[i];
-        buffer[i] = buffer[j];
-        buffer[j] = temp;
-    }
-
-    arr_quicksort(array, buffer, i, comparator);
-    arr_quicksort(array, buffer + i, length - i, comparator);
-}
-
-////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
-
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
@@ -1068,7 +1186,8 @@ arr_iter_set(ArrayIterator_t *iter, void *element)
         return false;
 
     if (iter->target->buffer[iter->cursor] != NULL)
-        iter->target->interface->free(iter->target->buffer[iter->cursor]);
+        interface_release(iter->target->interface,
+                          iter->target->buffer[iter->cursor]);
 
     iter->target->buffer[iter->cursor] = element;
 
@@ -1090,7 +1209,8 @@ arr_iter_get(ArrayIterator_t *iter, void **result)
         return false;
 
     if (iter->target->buffer[iter->cursor] != NULL)
-        *result = iter->target->interface->copy(iter->target->buffer[iter->cursor]);
+        *result = interface_copy(iter->target->interface,
+                                 iter->target->buffer[iter->cursor]);
     else
         *result = NULL;
 
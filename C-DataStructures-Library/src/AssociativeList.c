@@ -11,6 +11,12 @@
 /// The associative list is a singly-linked list with keys that are mapped to a
 /// single value or possibly more. Each node contains both the key and the
 /// value that the key is mapped to.
+///
+/// Every search is a linear scan, so two options make the scans cheaper. With
+/// move to front, a key found by ali_get() is moved to the head of the list
+/// and keys that are looked up often stay close to it. With hashed keys, each
+/// node caches the hash of its key and the compare function is only called
+/// when the hashes match.
 struct AssociativeList_s
 {
     /// \brief List length.
@@ -34,6 +40,16 @@ struct AssociativeList_s
     /// with an already existing key.
     bool duplicate_keys;
 
+    /// \brief If found keys are moved to the head of the list.
+    ///
+    /// See ali_set_move_to_front().
+    bool move_to_front;
+
+    /// \brief If nodes cache the hash of their keys.
+    ///
+    /// See ali_set_hashed().
+    bool hashed;
+
     /// \brief Points to the first Node on the list.
     ///
     /// Points to the first Node on the list or \c NULL if the list is empty.
@@ -44,6 +60,12 @@ struct AssociativeList_s
     /// Points to the last Node on the list or \c NULL if the list is empty.
     struct AssociativeListNode_s *tail;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief AssociativeList_s key interface.
     ///
     /// An interface is like a table that has function pointers for functions
@@ -86,6 +108,12 @@ struct AssociativeListNode_s
     /// Represents the value in this associative container.
     void *value;
 
+    /// \brief This node's key hash.
+    ///
+    /// Cached result of the key interface's hash function. Only set if the
+    /// list has hashed keys.
+    unsigned_t hash;
+
     /// \brief Next node on the list.
     ///
     /// Next node on the list or NULL if this is the last element.
@@ -99,17 +127,32 @@ typedef struct AssociativeListNode_s *AssociativeListNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AssociativeListNode_t *
-ali_new_node(void *key, void *value);
+ali_new_node(NodePool_t *pool, void *key, void *value);
 
 static void
-ali_free_node(AssociativeListNode_t *node, free_f key_free,
+ali_free_node(NodePool_t *pool, AssociativeListNode_t *node, free_f key_free,
               free_f value_free);
 
 static void
-ali_free_node_shallow(AssociativeListNode_t *node);
+ali_free_node_shallow(NodePool_t *pool, AssociativeListNode_t *node);
 
 static AssociativeListNode_t *
-ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key);
+ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key,
+         unsigned_t hash);
+
+static unsigned_t
+ali_hash(AssociativeList_t *list, void *key);
+
+static void
+ali_unlink(AssociativeList_t *list, AssociativeListNode_t *before,
+           AssociativeListNode_t *node);
+
+static void
+ali_to_front(AssociativeList_t *list, AssociativeListNode_t *before,
+             AssociativeListNode_t *node);
+
+static void
+ali_append(AssociativeList_t *list, AssociativeListNode_t *node);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -134,10 +177,13 @@ ali_new(Interface_t *key_interface, Interface_t *value_interface,
     list->limit = 0;
     list->version_id = 0;
     list->duplicate_keys = duplicate_keys;
+    list->move_to_front = false;
+    list->hashed = false;
 
     list->head = NULL;
     list->tail = NULL;
 
+    list->pool = NULL;
     list->K_interface = key_interface;
     list->V_interface = value_interface;
 
@@ -155,7 +201,8 @@ ali_free(AssociativeList_t *list)
     {
         list->head = list->head->next;
 
-        ali_free_node(prev, list->K_interface->free, list->V_interface->free);
+        ali_free_node(list->pool, prev, list->K_interface->free,
+                      list->V_interface->free);
 
         prev = list->head;
     }
@@ -174,7 +221,7 @@ ali_free_shallow(AssociativeList_t *list)
     {
         list->head = list->head->next;
 
-        ali_free_node_shallow(prev);
+        ali_free_node_shallow(list->pool, prev);
 
         prev = list->head;
     }
@@ -193,12 +240,14 @@ ali_erase(AssociativeList_t *list)
     {
         list->head = list->head->next;
 
-        ali_free_node(prev, list->K_interface->free, list->V_interface->free);
+        ali_free_node(list->pool, prev, list->K_interface->free,
+                      list->V_interface->free);
 
         prev = list->head;
     }
 
     list->head = NULL;
+    list->tail = NULL;
     list->length = 0;
     list->version_id++;
 }
@@ -214,12 +263,13 @@ ali_erase_shallow(AssociativeList_t *list)
     {
         list->head = list->head->next;
 
-        ali_free_node_shallow(prev);
+        ali_free_node_shallow(list->pool, prev);
 
         prev = list->head;
     }
 
     list->head = NULL;
+    list->tail = NULL;
     list->length = 0;
     list->version_id++;
 }
@@ -269,20 +319,58 @@ ali_duplicate_keys(AssociativeList_t *list)
     return list->duplicate_keys;
 }
 
+/// Returns true if ali_get() moves the keys it finds to the head of the list.
 ///
-/// \param[in] list
-/// \param[in] key
+/// \par Interface Requirements
+/// - None
 ///
-/// \return
+/// \param[in] list AssociativeList_s reference.
+///
+/// \return True if move to front is enabled.
+bool
+ali_move_to_front(AssociativeList_t *list)
+{
+    return list->move_to_front;
+}
+
+/// Returns true if the nodes of the list cache the hash of their keys.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] list AssociativeList_s reference.
+///
+/// \return True if the list has hashed keys.
+bool
+ali_hashed(AssociativeList_t *list)
+{
+    return list->hashed;
+}
+
+/// Returns the value associated with a given key. If the list moves keys to
+/// the front, the key found is moved to the head of the list.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash, if the list has hashed keys
+///
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to \c key or NULL if the key is not present.
 void *
 ali_get(AssociativeList_t *list, void *key)
 {
-    AssociativeListNode_t *_;
-    AssociativeListNode_t *node = ali_find(list, &_, key);
+    AssociativeListNode_t *before;
+    AssociativeListNode_t *node = ali_find(list, &before, key,
+                                           ali_hash(list, key));
 
     if (node == NULL)
         return NULL;
 
+    if (list->move_to_front)
+        ali_to_front(list, before, node);
+
     return node->value;
 }
 
@@ -303,43 +391,177 @@ ali_set_limit(AssociativeList_t *list, integer_t limit)
     return true;
 }
 
+/// Sets a node pool from where all nodes of the list are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the list is empty.
+/// \par Interface Requirements
+/// - None
 ///
-/// \param[in] list
-/// \param[in] key
-/// \param[in] value
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] pool The node pool or NULL.
 ///
-/// \return
+/// \return True if the pool was set.
+/// \return False if the list is not empty or if the pool's nodes are too
+/// small.
+bool
+ali_set_pool(AssociativeList_t *list, NodePool_t *pool)
+{
+    if (!ali_empty(list))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(AssociativeListNode_t)))
+        return false;
+
+    list->pool = pool;
+
+    return true;
+}
+
+/// Enables or disables move to front. While enabled, ali_get() moves the key
+/// it finds to the head of the list, so that the keys that are looked up the
+/// most are found after a few nodes. This pays off when a few keys take most
+/// of the lookups and costs an extra relink when they don't.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] move_to_front If found keys are moved to the head of the list.
+void
+ali_set_move_to_front(AssociativeList_t *list, bool move_to_front)
+{
+    list->move_to_front = move_to_front;
+}
+
+/// Enables or disables hashed keys. While enabled, every node keeps the hash
+/// of its key and a search hashes the searched key once, calling the compare
+/// function only on nodes with the same hash. Enabling it hashes every key
+/// already in the list.
+///
+/// \par Interface Requirements
+/// - Key interface: hash
+///
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] hashed If nodes cache the hash of their keys.
+///
+/// \return True if the list is in the requested mode.
+/// \return False if the key interface has no hash function.
+bool
+ali_set_hashed(AssociativeList_t *list, bool hashed)
+{
+    if (hashed && !list->K_interface->hash)
+        return false;
+
+    if (hashed && !list->hashed)
+    {
+        for (AssociativeListNode_t *scan = list->head; scan != NULL;
+             scan = scan->next)
+            scan->hash = list->K_interface->hash(scan->key);
+    }
+
+    list->hashed = hashed;
+
+    return true;
+}
+
+/// Inserts a new key mapped to a value at the tail of the list. Unless the
+/// list has duplicate keys, the key is searched with the same scan that
+/// reaches the tail.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash, if the list has hashed keys
+///
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted.
+/// \return False if the key is already present and the list doesn't have
+/// duplicate keys, if the list is full or if allocation failed.
 bool
 ali_insert(AssociativeList_t *list, void *key, void *value)
 {
     if (ali_full(list))
         return false;
 
+    unsigned_t hash = ali_hash(list, key);
+
     // Duplicate keys not allowed, search if there is an existing one
     if (!list->duplicate_keys)
     {
-        if (ali_contains_key(list, key))
+        AssociativeListNode_t *before;
+
+        if (ali_find(list, &before, key, hash) != NULL)
             return false;
     }
 
-    AssociativeListNode_t *node = ali_new_node(key, value);
+    AssociativeListNode_t *node = ali_new_node(list->pool, key, value);
 
     if (!node)
         return false;
 
-    if (ali_empty(list))
-    {
-        list->head = node;
-        list->tail = node;
-    }
-    else
+    node->hash = hash;
+
+    ali_append(list, node);
+
+    return true;
+}
+
+/// Returns the value associated with a key, inserting the key mapped to a
+/// given value at the tail of the list if it is not present. Both happen in a
+/// single scan. If the key is present, the given key and value are not used
+/// and are still owned by the caller, and the key found is moved to the front
+/// if the list moves keys to the front.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash, if the list has hashed keys
+///
+/// \param[in] list AssociativeList_s reference.
+/// \param[in] key The key to be searched or inserted.
+/// \param[in] value The value associated with \c key if it is inserted.
+/// \param[out] result The value mapped to \c key, or NULL if the key was not
+/// present and could not be inserted.
+///
+/// \return True if the key was inserted.
+/// \return False if the key was already present, if the list is full or if
+/// allocation failed.
+bool
+ali_get_or_insert(AssociativeList_t *list, void *key, void *value,
+                  void **result)
+{
+    unsigned_t hash = ali_hash(list, key);
+
+    AssociativeListNode_t *before;
+    AssociativeListNode_t *node = ali_find(list, &before, key, hash);
+
+    if (node != NULL)
     {
-        list->tail->next = node;
-        list->tail = node;
+        if (list->move_to_front)
+            ali_to_front(list, before, node);
+
+        *result = node->value;
+
+        return false;
     }
 
-    list->length++;
-    list->version_id++;
+    *result = NULL;
+
+    if (ali_full(list))
+        return false;
+
+    node = ali_new_node(list->pool, key, value);
+
+    if (!node)
+        return false;
+
+    node->hash = hash;
+
+    ali_append(list, node);
+
+    *result = value;
 
     return true;
 }
@@ -359,29 +581,19 @@ ali_remove(AssociativeList_t *list, void *key, void **value)
         return false;
 
     AssociativeListNode_t *before;
-    AssociativeListNode_t *node = ali_find(list, &before, key);
+    AssociativeListNode_t *node = ali_find(list, &before, key,
+                                           ali_hash(list, key));
 
     // Not found
     if (node == NULL)
         return false;
 
-    if (before == NULL)
-    {
-        // Removing head
-        list->head = list->head->next;
-    }
-    else
-    {
-        before->next = node->next;
-    }
+    ali_unlink(list, before, node);
 
     *value = node->value;
 
     list->K_interface->free(node->key);
-    free(node);
-
-    list->length--;
-    list->version_id++;
+    npl_node_free(list->pool, node);
 
     return true;
 }
@@ -395,26 +607,17 @@ bool
 ali_pop(AssociativeList_t *list, void *key)
 {
     AssociativeListNode_t *before;
-    AssociativeListNode_t *node = ali_find(list, &before, key);
+    AssociativeListNode_t *node = ali_find(list, &before, key,
+                                           ali_hash(list, key));
 
     // Not found
     if (node == NULL)
         return false;
 
-    if (before == NULL)
-    {
-        // Removing head
-        list->head = list->head->next;
-    }
-    else
-    {
-        before->next = node->next;
-    }
-
-    ali_free_node(node, list->K_interface->free, list->V_interface->free);
+    ali_unlink(list, before, node);
 
-    list->length--;
-    list->version_id++;
+    ali_free_node(list->pool, node, list->K_interface->free,
+                  list->V_interface->free);
 
     return true;
 }
@@ -426,7 +629,7 @@ ali_pop(AssociativeList_t *list, void *key)
 bool
 ali_full(AssociativeList_t *list)
 {
-    return list->limit > 0 && list->limit >= list->length;
+    return list->limit > 0 && list->length >= list->limit;
 }
 
 ///
@@ -447,17 +650,9 @@ ali_empty(AssociativeList_t *list)
 bool
 ali_contains_key(AssociativeList_t *list, void *key)
 {
-    AssociativeListNode_t *scan = list->head;
-
-    while (scan != NULL)
-    {
-        if (list->K_interface->compare(key, scan->key) == 0)
-            return true;
-
-        scan = scan->next;
-    }
+    AssociativeListNode_t *before;
 
-    return false;
+    return ali_find(list, &before, key, ali_hash(list, key)) != NULL;
 }
 
 ///
@@ -541,9 +736,10 @@ ali_display(AssociativeList_t *list)
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AssociativeListNode_t *
-ali_new_node(void *key, void *value)
+ali_new_node(NodePool_t *pool, void *key, void *value)
 {
-    AssociativeListNode_t *node = malloc(sizeof(AssociativeListNode_t));
+    AssociativeListNode_t *node = npl_node_alloc(pool,
+            sizeof(AssociativeListNode_t));
 
     if (!node)
         return NULL;
@@ -556,30 +752,35 @@ ali_new_node(void *key, void *value)
 }
 
 static void
-ali_free_node(AssociativeListNode_t *node, free_f key_free,
+ali_free_node(NodePool_t *pool, AssociativeListNode_t *node, free_f key_free,
               free_f value_free)
 {
     key_free(node->key);
     value_free(node->value);
 
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-ali_free_node_shallow(AssociativeListNode_t *node)
+ali_free_node_shallow(NodePool_t *pool, AssociativeListNode_t *node)
 {
-    free(node);
+    npl_node_free(pool, node);
 }
 
+// Returns the node of a key or NULL, leaving in before the node that comes
+// before it or the tail if the key is not present. The hash is only used if the
+// list has hashed keys
 static AssociativeListNode_t *
-ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key)
+ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key,
+         unsigned_t hash)
 {
     AssociativeListNode_t *scan = list->head;
     *before = NULL;
 
     while (scan != NULL)
     {
-        if (list->K_interface->compare(key, scan->key) == 0)
+        if ((!list->hashed || scan->hash == hash)
+            && list->K_interface->compare(key, scan->key) == 0)
             break;
 
         *before = scan;
@@ -589,6 +790,65 @@ ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key)
     return scan;
 }
 
+// Hashes a key if the list has hashed keys
+static unsigned_t
+ali_hash(AssociativeList_t *list, void *key)
+{
+    return list->hashed ? list->K_interface->hash(key) : 0;
+}
+
+// Takes a node out of the list given the node before it or NULL if it is the
+// head
+static void
+ali_unlink(AssociativeList_t *list, AssociativeListNode_t *before,
+           AssociativeListNode_t *node)
+{
+    if (before == NULL)
+        list->head = node->next;
+    else
+        before->next = node->next;
+
+    if (list->tail == node)
+        list->tail = before;
+
+    list->length--;
+    list->version_id++;
+}
+
+// Moves a node to the head of the list given the node before it
+static void
+ali_to_front(AssociativeList_t *list, AssociativeListNode_t *before,
+             AssociativeListNode_t *node)
+{
+    if (before == NULL)
+        return;
+
+    before->next = node->next;
+
+    if (list->tail == node)
+        list->tail = before;
+
+    node->next = list->head;
+    list->head = node;
+
+    list->version_id++;
+}
+
+// Links a node after the tail of the list
+static void
+ali_append(AssociativeList_t *list, AssociativeListNode_t *node)
+{
+    if (ali_empty(list))
+        list->head = node;
+    else
+        list->tail->next = node;
+
+    list->tail = node;
+
+    list->length++;
+    list->version_id++;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
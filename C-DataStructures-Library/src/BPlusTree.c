@@ -0,0 +1,1149 @@
+/**
+ * @file BPlusTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "BPlusTree.h"
+#include <stddef.h>
+
+/// Maximum amount of elements in a leaf and of separators in an inner node.
+/// With 16 the inline keys of a node take two cache lines and a whole leaf
+/// takes five.
+#define BPT_ORDER 16
+
+/// Minimum amount of elements in a leaf and of separators in an inner node,
+/// except for the root.
+#define BPT_MIN (BPT_ORDER / 2)
+
+/// Maximum height of a tree. Every inner node but the root has at least
+/// <code> BPT_MIN + 1 </code> children so this is never reached.
+#define BPT_MAX_HEIGHT 32
+
+/// A BPlusTree_s is an ordered set where every element is stored in a leaf
+/// and leaves are linked in order. Inner nodes only have separators that
+/// guide searches: all elements in \c children[i] are smaller than the
+/// separator \c items[i], which is smaller than or equal to all elements in
+/// <code> children[i + 1] </code>. Separators are pointers to elements that
+/// are also in a leaf.
+///
+/// Each node keeps up to \c BPT_ORDER elements in contiguous arrays so a
+/// search visits a few cache lines per level instead of one node per
+/// comparison like in a binary tree. If the tree is created with a \ref key_f
+/// the key of each element is also stored in the node, and searches compare
+/// these integers before calling the \ref compare_f, which is only needed to
+/// break ties. The key must be consistent with the comparison: if
+/// <code> key(a) < key(b) </code> then <code> compare(a, b) < 0 </code>.
+///
+/// The tree takes ownership of its elements and does not accept duplicates.
+///
+/// \par Functions
+/// Located in the file BPlusTree.c
+struct BPlusTree_s
+{
+    /// \brief Root node.
+    ///
+    /// Never NULL, an empty tree has an empty leaf as root.
+    struct BPlusTreeNode_s *root;
+
+    /// \brief Leftmost leaf.
+    struct BPlusTreeNode_s *first;
+
+    /// \brief Rightmost leaf.
+    struct BPlusTreeNode_s *last;
+
+    /// \brief Total elements in the tree.
+    integer_t size;
+
+    /// \brief Amount of levels in the tree.
+    integer_t height;
+
+    /// \brief Optional inline key of elements.
+    key_f key;
+
+    /// \brief An interface defining all necessary functions for the tree to
+    /// operate.
+    Interface_t *interface;
+};
+
+/// \brief A BPlusTree_s node.
+///
+/// Implementation detail. Leaves are allocated without \c children.
+struct BPlusTreeNode_s
+{
+    /// \brief Inline keys of \c items, only used with a key_f.
+    uint64_t keys[BPT_ORDER];
+
+    /// \brief Elements of a leaf or separators of an inner node.
+    void *items[BPT_ORDER];
+
+    /// \brief Amount of elements or separators.
+    integer_t count;
+
+    /// \brief If this node is a leaf.
+    bool leaf;
+
+    /// \brief Next leaf in order.
+    struct BPlusTreeNode_s *next;
+
+    /// \brief Previous leaf in order.
+    struct BPlusTreeNode_s *prev;
+
+    /// \brief Children of an inner node, one more than \c count.
+    struct BPlusTreeNode_s *children[];
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct BPlusTreeNode_s *
+bpt_node_new(bool leaf);
+
+static void
+bpt_free_node(struct BPlusTreeNode_s *node, free_f function);
+
+static uint64_t
+bpt_key(BPlusTree_t *tree, void *element);
+
+static integer_t
+bpt_search(BPlusTree_t *tree, struct BPlusTreeNode_s *node, void *element,
+           uint64_t key, bool upper);
+
+static void
+bpt_insert_at(struct BPlusTreeNode_s *node, integer_t index, void *item,
+              uint64_t key, struct BPlusTreeNode_s *child);
+
+static void
+bpt_remove_at(struct BPlusTreeNode_s *node, integer_t index);
+
+static void
+bpt_split(BPlusTree_t *tree, struct BPlusTreeNode_s *node,
+          struct BPlusTreeNode_s *right, integer_t index, void **item,
+          uint64_t *key, struct BPlusTreeNode_s **child);
+
+static void
+bpt_rebalance(BPlusTree_t *tree, struct BPlusTreeNode_s *parent,
+              integer_t index);
+
+static void
+bpt_display_node(struct BPlusTreeNode_s *node, integer_t height,
+                 display_f function);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty BPlusTree_s with only comparisons.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// tree to operate.
+///
+/// \return A new BPlusTree_s or NULL if allocation failed.
+BPlusTree_t *
+bpt_new(Interface_t *interface)
+{
+    return bpt_create(interface, NULL);
+}
+
+/// Initializes a new empty BPlusTree_s that stores the integer key of each
+/// element in the nodes, so most comparisons do not need to dereference the
+/// elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// tree to operate.
+/// \param[in] key A function consistent with the interface comparator or
+/// NULL to only use comparisons.
+///
+/// \return A new BPlusTree_s or NULL if allocation failed.
+BPlusTree_t *
+bpt_create(Interface_t *interface, key_f key)
+{
+    BPlusTree_t *tree = malloc(sizeof(BPlusTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->root = bpt_node_new(true);
+
+    if (!tree->root)
+    {
+        free(tree);
+        return NULL;
+    }
+
+    tree->first = tree->root;
+    tree->last = tree->root;
+    tree->size = 0;
+    tree->height = 1;
+    tree->key = key;
+    tree->interface = interface;
+
+    return tree;
+}
+
+/// Builds a BPlusTree_s from a buffer of elements sorted in ascending order
+/// without duplicates. Nodes are built bottom-up, nearly full and without any
+/// comparison besides checking the order. On success the tree takes
+/// ownership of the elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// tree to operate.
+/// \param[in] key A function consistent with the interface comparator or
+/// NULL to only use comparisons.
+/// \param[in] elements Buffer of sorted elements.
+/// \param[in] size Amount of elements in the buffer.
+///
+/// \return A new BPlusTree_s or NULL if allocation failed or the elements
+/// are not sorted and unique.
+BPlusTree_t *
+bpt_from_sorted_array(Interface_t *interface, key_f key, void **elements,
+                      integer_t size)
+{
+    if (size < 0)
+        return NULL;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (interface->compare(elements[i - 1], elements[i]) >= 0)
+            return NULL;
+    }
+
+    BPlusTree_t *tree = bpt_create(interface, key);
+
+    if (!tree || size == 0)
+        return tree;
+
+    integer_t total = (size + BPT_ORDER - 1) / BPT_ORDER;
+
+    // Nodes of the current level and the smallest element of each one
+    struct BPlusTreeNode_s **level = malloc(sizeof(void*) * (size_t)total);
+    void **mins = malloc(sizeof(void*) * (size_t)total);
+
+    if (!level || !mins)
+    {
+        free(level);
+        free(mins);
+        bpt_free_shallow(tree);
+        return NULL;
+    }
+
+    // The root leaf is replaced by the new leaves
+    free(tree->root);
+
+    struct BPlusTreeNode_s *prev = NULL;
+
+    for (integer_t i = 0, start = 0; i < total; i++)
+    {
+        integer_t count = size / total + (i < size % total ? 1 : 0);
+
+        struct BPlusTreeNode_s *leaf = bpt_node_new(true);
+
+        if (!leaf)
+        {
+            for (integer_t j = 0; j < i; j++)
+                free(level[j]);
+
+            goto error;
+        }
+
+        for (integer_t j = 0; j < count; j++)
+        {
+            leaf->items[j] = elements[start + j];
+            leaf->keys[j] = bpt_key(tree, elements[start + j]);
+        }
+
+        leaf->count = count;
+        leaf->prev = prev;
+
+        if (prev)
+            prev->next = leaf;
+        else
+            tree->first = leaf;
+
+        level[i] = leaf;
+        mins[i] = leaf->items[0];
+
+        prev = leaf;
+        start += count;
+    }
+
+    tree->last = prev;
+
+    // Each pass groups the nodes of a level under new inner nodes. The level
+    // array is reused since there are always fewer parents than children.
+    while (total > 1)
+    {
+        integer_t parents = (total + BPT_ORDER) / (BPT_ORDER + 1);
+
+        for (integer_t i = 0, start = 0; i < parents; i++)
+        {
+            integer_t count = total / parents
+                              + (i < total % parents ? 1 : 0);
+
+            struct BPlusTreeNode_s *node = bpt_node_new(false);
+
+            if (!node)
+            {
+                // New parents and the nodes that were not grouped yet
+                for (integer_t j = 0; j < i; j++)
+                    bpt_free_node(level[j], NULL);
+
+                for (integer_t j = start; j < total; j++)
+                    bpt_free_node(level[j], NULL);
+
+                goto error;
+            }
+
+            node->children[0] = level[start];
+
+            for (integer_t j = 1; j < count; j++)
+            {
+                node->items[j - 1] = mins[start + j];
+                node->keys[j - 1] = bpt_key(tree, mins[start + j]);
+                node->children[j] = level[start + j];
+            }
+
+            node->count = count - 1;
+
+            level[i] = node;
+            mins[i] = mins[start];
+
+            start += count;
+        }
+
+        total = parents;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    tree->size = size;
+
+    free(level);
+    free(mins);
+
+    return tree;
+
+    error:
+    free(level);
+    free(mins);
+    free(tree);
+
+    return NULL;
+}
+
+/// Frees from memory a BPlusTree_s and all its elements using the
+/// interface's free function.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] tree The tree to be freed from memory.
+void
+bpt_free(BPlusTree_t *tree)
+{
+    bpt_free_node(tree->root, tree->interface->free);
+
+    free(tree);
+}
+
+/// Frees from memory a BPlusTree_s without freeing its elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree The tree to be freed from memory.
+void
+bpt_free_shallow(BPlusTree_t *tree)
+{
+    bpt_free_node(tree->root, NULL);
+
+    free(tree);
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The amount of elements in the tree.
+integer_t
+bpt_size(BPlusTree_t *tree)
+{
+    return tree->size;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The amount of levels in the tree, one if the root is a leaf.
+integer_t
+bpt_height(BPlusTree_t *tree)
+{
+    return tree->height;
+}
+
+/// Inserts an element in the tree. Every node that has to be split is
+/// allocated before the tree is changed so a failed insertion leaves it
+/// intact.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be inserted.
+///
+/// \return True if the element was inserted, false if allocation failed or
+/// an equal element is already in the tree.
+bool
+bpt_insert(BPlusTree_t *tree, void *element)
+{
+    struct BPlusTreeNode_s *path[BPT_MAX_HEIGHT];
+    integer_t indexes[BPT_MAX_HEIGHT];
+
+    uint64_t key = bpt_key(tree, element);
+
+    integer_t depth = 0;
+
+    struct BPlusTreeNode_s *node = tree->root;
+
+    while (!node->leaf)
+    {
+        integer_t i = bpt_search(tree, node, element, key, true);
+
+        path[depth] = node;
+        indexes[depth++] = i;
+
+        node = node->children[i];
+    }
+
+    integer_t index = bpt_search(tree, node, element, key, false);
+
+    if (index < node->count
+        && tree->interface->compare(node->items[index], element) == 0)
+        return false;
+
+    // Nodes that will be split, from the leaf up, and a new root if the root
+    // is split too
+    struct BPlusTreeNode_s *spare[BPT_MAX_HEIGHT + 1];
+    integer_t needed = 0;
+
+    if (node->count == BPT_ORDER)
+    {
+        needed = 1;
+
+        for (integer_t i = depth - 1; i >= 0; i--)
+        {
+            if (path[i]->count < BPT_ORDER)
+                break;
+
+            needed++;
+        }
+
+        if (needed == depth + 1)
+            needed++;
+    }
+
+    for (integer_t i = 0; i < needed; i++)
+    {
+        spare[i] = bpt_node_new(i == 0);
+
+        if (!spare[i])
+        {
+            while (i > 0)
+                free(spare[--i]);
+
+            return false;
+        }
+    }
+
+    void *item = element;
+    struct BPlusTreeNode_s *child = NULL;
+
+    for (integer_t i = 0; ; i++)
+    {
+        if (node->count < BPT_ORDER)
+        {
+            bpt_insert_at(node, index, item, key, child);
+            break;
+        }
+
+        bpt_split(tree, node, spare[i], index, &item, &key, &child);
+
+        if (depth == 0)
+        {
+            struct BPlusTreeNode_s *root = spare[i + 1];
+
+            root->items[0] = item;
+            root->keys[0] = key;
+            root->children[0] = node;
+            root->children[1] = child;
+            root->count = 1;
+
+            tree->root = root;
+            tree->height++;
+
+            break;
+        }
+
+        node = path[--depth];
+        index = indexes[depth];
+    }
+
+    tree->size++;
+
+    return true;
+}
+
+/// Removes and frees from memory the element in the tree that is equal to
+/// the given element.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be matched.
+///
+/// \return True if an element was removed, false if it was not found.
+bool
+bpt_remove(BPlusTree_t *tree, void *element)
+{
+    struct BPlusTreeNode_s *path[BPT_MAX_HEIGHT];
+    integer_t indexes[BPT_MAX_HEIGHT];
+
+    uint64_t key = bpt_key(tree, element);
+
+    integer_t depth = 0;
+
+    struct BPlusTreeNode_s *node = tree->root;
+
+    while (!node->leaf)
+    {
+        integer_t i = bpt_search(tree, node, element, key, true);
+
+        path[depth] = node;
+        indexes[depth++] = i;
+
+        node = node->children[i];
+    }
+
+    integer_t index = bpt_search(tree, node, element, key, false);
+
+    if (index == node->count
+        || tree->interface->compare(node->items[index], element) != 0)
+        return false;
+
+    void *result = node->items[index];
+
+    bpt_remove_at(node, index);
+
+    // The smallest element of a leaf might also be a separator of the
+    // nearest ancestor where the path does not go to the leftmost child. It
+    // is replaced by its successor, the new smallest element of the leaf.
+    if (index == 0)
+    {
+        for (integer_t i = depth - 1; i >= 0; i--)
+        {
+            if (indexes[i] == 0)
+                continue;
+
+            struct BPlusTreeNode_s *parent = path[i];
+
+            if (parent->items[indexes[i] - 1] == result)
+            {
+                parent->items[indexes[i] - 1] = node->items[0];
+                parent->keys[indexes[i] - 1] = node->keys[0];
+            }
+
+            break;
+        }
+    }
+
+    for (integer_t i = depth - 1; i >= 0; i--)
+    {
+        if (path[i]->children[indexes[i]]->count >= BPT_MIN)
+            break;
+
+        bpt_rebalance(tree, path[i], indexes[i]);
+    }
+
+    if (!tree->root->leaf && tree->root->count == 0)
+    {
+        struct BPlusTreeNode_s *root = tree->root;
+
+        tree->root = root->children[0];
+        tree->height--;
+
+        free(root);
+    }
+
+    tree->size--;
+
+    tree->interface->free(result);
+
+    return true;
+}
+
+/// Removes and frees from memory the smallest element in the tree.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] tree The tree.
+///
+/// \return True if an element was removed, false if the tree was empty.
+bool
+bpt_pop(BPlusTree_t *tree)
+{
+    if (tree->size == 0)
+        return false;
+
+    return bpt_remove(tree, tree->first->items[0]);
+}
+
+/// \param[in] tree The tree.
+///
+/// \return True if the tree had no elements.
+bool
+bpt_empty(BPlusTree_t *tree)
+{
+    return tree->size == 0;
+}
+
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be searched.
+///
+/// \return True if an equal element is in the tree.
+bool
+bpt_contains(BPlusTree_t *tree, void *element)
+{
+    uint64_t key = bpt_key(tree, element);
+
+    struct BPlusTreeNode_s *node = tree->root;
+
+    while (!node->leaf)
+        node = node->children[bpt_search(tree, node, element, key, true)];
+
+    integer_t index = bpt_search(tree, node, element, key, false);
+
+    return index < node->count
+           && tree->interface->compare(node->items[index], element) == 0;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The smallest element or NULL if the tree is empty.
+void *
+bpt_peek(BPlusTree_t *tree)
+{
+    return bpt_min(tree);
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The biggest element or NULL if the tree is empty.
+void *
+bpt_max(BPlusTree_t *tree)
+{
+    if (tree->size == 0)
+        return NULL;
+
+    return tree->last->items[tree->last->count - 1];
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The smallest element or NULL if the tree is empty.
+void *
+bpt_min(BPlusTree_t *tree)
+{
+    if (tree->size == 0)
+        return NULL;
+
+    return tree->first->items[0];
+}
+
+/// Searches the first element not smaller than \c low and then follows the
+/// linked leaves until an element is bigger than \c high.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The tree.
+/// \param[in] low Lower bound of the range.
+/// \param[in] high Upper bound of the range.
+/// \param[in] visit A function called with each element and the argument.
+/// \param[in] argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+bpt_range(BPlusTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument)
+{
+    uint64_t key = bpt_key(tree, low);
+
+    struct BPlusTreeNode_s *node = tree->root;
+
+    while (!node->leaf)
+        node = node->children[bpt_search(tree, node, low, key, true)];
+
+    integer_t index = bpt_search(tree, node, low, key, false);
+    integer_t total = 0;
+
+    while (node)
+    {
+        for (; index < node->count; index++)
+        {
+            if (tree->interface->compare(node->items[index], high) > 0)
+                return total;
+
+            visit(node->items[index], argument);
+            total++;
+        }
+
+        node = node->next;
+        index = 0;
+    }
+
+    return total;
+}
+
+/// Visits every element in ascending order. The tree must not be changed
+/// by the visit function.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] tree The tree.
+/// \param[in] visit A function called with each element and the argument.
+/// \param[in] argument A value given to every call of the visit function.
+void
+bpt_traversal(BPlusTree_t *tree, visit_f visit, void *argument)
+{
+    for (struct BPlusTreeNode_s *node = tree->first; node; node = node->next)
+    {
+        for (integer_t i = 0; i < node->count; i++)
+            visit(node->items[i], argument);
+    }
+}
+
+/// Displays the nodes of the tree rotated to the left, one node per line
+/// with the root at the leftmost column.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] tree The tree.
+void
+bpt_display(BPlusTree_t *tree)
+{
+    printf("\n+--------------------------------------------------+");
+    printf("\n|                    B+ Tree                       |");
+    printf("\n+--------------------------------------------------+\n");
+
+    if (tree->size == 0)
+    {
+        printf(" EMPTY\n");
+        return;
+    }
+
+    bpt_display_node(tree->root, 0, tree->interface->display);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Allocates a node aligned to a cache line. Leaves have no children array.
+static struct BPlusTreeNode_s *
+bpt_node_new(bool leaf)
+{
+    size_t size = sizeof(struct BPlusTreeNode_s);
+
+    if (!leaf)
+        size += sizeof(struct BPlusTreeNode_s *) * (BPT_ORDER + 1);
+
+    // aligned_alloc requires a size that is a multiple of the alignment
+    size = (size + DS_CACHE_LINE - 1) / DS_CACHE_LINE * DS_CACHE_LINE;
+
+    struct BPlusTreeNode_s *node = aligned_alloc(DS_CACHE_LINE, size);
+
+    if (!node)
+        return NULL;
+
+    node->count = 0;
+    node->leaf = leaf;
+    node->next = NULL;
+    node->prev = NULL;
+
+    return node;
+}
+
+// Frees a subtree. Elements are freed from the leaves if a function is
+// given.
+static void
+bpt_free_node(struct BPlusTreeNode_s *node, free_f function)
+{
+    if (node->leaf)
+    {
+        if (function)
+        {
+            for (integer_t i = 0; i < node->count; i++)
+                function(node->items[i]);
+        }
+    }
+    else
+    {
+        for (integer_t i = 0; i <= node->count; i++)
+            bpt_free_node(node->children[i], function);
+    }
+
+    free(node);
+}
+
+static uint64_t
+bpt_key(BPlusTree_t *tree, void *element)
+{
+    return tree->key ? tree->key(element) : 0;
+}
+
+// Binary search in a node. Returns the index of the first item not smaller
+// than the element or, if upper is true, the first item bigger than it.
+// Inline keys are compared first when present.
+static integer_t
+bpt_search(BPlusTree_t *tree, struct BPlusTreeNode_s *node, void *element,
+           uint64_t key, bool upper)
+{
+    integer_t low = 0, high = node->count;
+
+    while (low < high)
+    {
+        integer_t middle = low + (high - low) / 2;
+
+        int comparison;
+
+        if (tree->key && node->keys[middle] != key)
+            comparison = node->keys[middle] < key ? -1 : 1;
+        else
+            comparison = tree->interface->compare(node->items[middle],
+                                                  element);
+
+        if (comparison < 0 || (upper && comparison == 0))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+// Inserts an item at the given index of a node that is not full. In inner
+// nodes the child is inserted to the right of the item.
+static void
+bpt_insert_at(struct BPlusTreeNode_s *node, integer_t index, void *item,
+              uint64_t key, struct BPlusTreeNode_s *child)
+{
+    for (integer_t i = node->count; i > index; i--)
+    {
+        node->items[i] = node->items[i - 1];
+        node->keys[i] = node->keys[i - 1];
+    }
+
+    node->items[index] = item;
+    node->keys[index] = key;
+
+    if (!node->leaf)
+    {
+        for (integer_t i = node->count + 1; i > index + 1; i--)
+            node->children[i] = node->children[i - 1];
+
+        node->children[index + 1] = child;
+    }
+
+    node->count++;
+}
+
+// Removes the item at the given index. In inner nodes the child to the right
+// of the item is also removed.
+static void
+bpt_remove_at(struct BPlusTreeNode_s *node, integer_t index)
+{
+    for (integer_t i = index; i < node->count - 1; i++)
+    {
+        node->items[i] = node->items[i + 1];
+        node->keys[i] = node->keys[i + 1];
+    }
+
+    if (!node->leaf)
+    {
+        for (integer_t i = index + 1; i < node->count; i++)
+            node->children[i] = node->children[i + 1];
+    }
+
+    node->count--;
+}
+
+// Splits a full node into itself and right while inserting item, key and
+// child at index. On return item, key and child are the separator and the
+// new node to be inserted in the parent.
+static void
+bpt_split(BPlusTree_t *tree, struct BPlusTreeNode_s *node,
+          struct BPlusTreeNode_s *right, integer_t index, void **item,
+          uint64_t *key, struct BPlusTreeNode_s **child)
+{
+    void *items[BPT_ORDER + 1];
+    uint64_t keys[BPT_ORDER + 1];
+    struct BPlusTreeNode_s *children[BPT_ORDER + 2];
+
+    for (integer_t i = 0, j = 0; i <= BPT_ORDER; i++)
+    {
+        if (i == index)
+        {
+            items[i] = *item;
+            keys[i] = *key;
+        }
+        else
+        {
+            items[i] = node->items[j];
+            keys[i] = node->keys[j++];
+        }
+    }
+
+    // Half of the items stay, the rest go to the right node
+    integer_t middle = (BPT_ORDER + 1) / 2;
+
+    if (node->leaf)
+    {
+        for (integer_t i = middle; i <= BPT_ORDER; i++)
+        {
+            right->items[i - middle] = items[i];
+            right->keys[i - middle] = keys[i];
+        }
+
+        for (integer_t i = 0; i < middle; i++)
+        {
+            node->items[i] = items[i];
+            node->keys[i] = keys[i];
+        }
+
+        node->count = middle;
+        right->count = BPT_ORDER + 1 - middle;
+
+        right->next = node->next;
+        right->prev = node;
+
+        if (node->next)
+            node->next->prev = right;
+        else
+            tree->last = right;
+
+        node->next = right;
+
+        *item = right->items[0];
+        *key = right->keys[0];
+        *child = right;
+
+        return;
+    }
+
+    for (integer_t i = 0, j = 0; i <= BPT_ORDER + 1; i++)
+        children[i] = i == index + 1 ? *child : node->children[j++];
+
+    // The middle separator moves up to the parent
+    for (integer_t i = middle + 1; i <= BPT_ORDER; i++)
+    {
+        right->items[i - middle - 1] = items[i];
+        right->keys[i - middle - 1] = keys[i];
+    }
+
+    for (integer_t i = middle + 1; i <= BPT_ORDER + 1; i++)
+        right->children[i - middle - 1] = children[i];
+
+    for (integer_t i = 0; i < middle; i++)
+    {
+        node->items[i] = items[i];
+        node->keys[i] = keys[i];
+    }
+
+    for (integer_t i = 0; i <= middle; i++)
+        node->children[i] = children[i];
+
+    node->count = middle;
+    right->count = BPT_ORDER - middle;
+
+    *item = items[middle];
+    *key = keys[middle];
+    *child = right;
+}
+
+// Fixes the child at index of parent that has fewer than BPT_MIN items by
+// borrowing one from a sibling or, if both siblings are at the minimum,
+// merging it with one of them.
+static void
+bpt_rebalance(BPlusTree_t *tree, struct BPlusTreeNode_s *parent,
+              integer_t index)
+{
+    struct BPlusTreeNode_s *node = parent->children[index];
+
+    struct BPlusTreeNode_s *left = index > 0
+                                   ? parent->children[index - 1] : NULL;
+    struct BPlusTreeNode_s *right = index < parent->count
+                                    ? parent->children[index + 1] : NULL;
+
+    if (left && left->count > BPT_MIN)
+    {
+        if (node->leaf)
+        {
+            bpt_insert_at(node, 0, left->items[left->count - 1],
+                          left->keys[left->count - 1], NULL);
+
+            left->count--;
+
+            parent->items[index - 1] = node->items[0];
+            parent->keys[index - 1] = node->keys[0];
+        }
+        else
+        {
+            // The separator comes down and the last one of left goes up
+            for (integer_t i = node->count; i > 0; i--)
+            {
+                node->items[i] = node->items[i - 1];
+                node->keys[i] = node->keys[i - 1];
+            }
+
+            for (integer_t i = node->count + 1; i > 0; i--)
+                node->children[i] = node->children[i - 1];
+
+            node->items[0] = parent->items[index - 1];
+            node->keys[0] = parent->keys[index - 1];
+            node->children[0] = left->children[left->count];
+            node->count++;
+
+            parent->items[index - 1] = left->items[left->count - 1];
+            parent->keys[index - 1] = left->keys[left->count - 1];
+
+            left->count--;
+        }
+
+        return;
+    }
+
+    if (right && right->count > BPT_MIN)
+    {
+        if (node->leaf)
+        {
+            node->items[node->count] = right->items[0];
+            node->keys[node->count] = right->keys[0];
+            node->count++;
+
+            bpt_remove_at(right, 0);
+
+            parent->items[index] = right->items[0];
+            parent->keys[index] = right->keys[0];
+        }
+        else
+        {
+            // The separator comes down and the first one of right goes up
+            node->items[node->count] = parent->items[index];
+            node->keys[node->count] = parent->keys[index];
+            node->children[node->count + 1] = right->children[0];
+            node->count++;
+
+            parent->items[index] = right->items[0];
+            parent->keys[index] = right->keys[0];
+
+            for (integer_t i = 0; i < right->count - 1; i++)
+            {
+                right->items[i] = right->items[i + 1];
+                right->keys[i] = right->keys[i + 1];
+            }
+
+            for (integer_t i = 0; i < right->count; i++)
+                right->children[i] = right->children[i + 1];
+
+            right->count--;
+        }
+
+        return;
+    }
+
+    // Merges the pair into the left one of them
+    if (left)
+    {
+        right = node;
+        index--;
+    }
+    else
+    {
+        left = node;
+    }
+
+    if (left->leaf)
+    {
+        for (integer_t i = 0; i < right->count; i++)
+        {
+            left->items[left->count + i] = right->items[i];
+            left->keys[left->count + i] = right->keys[i];
+        }
+
+        left->count += right->count;
+        left->next = right->next;
+
+        if (right->next)
+            right->next->prev = left;
+        else
+            tree->last = left;
+    }
+    else
+    {
+        left->items[left->count] = parent->items[index];
+        left->keys[left->count] = parent->keys[index];
+
+        for (integer_t i = 0; i < right->count; i++)
+        {
+            left->items[left->count + 1 + i] = right->items[i];
+            left->keys[left->count + 1 + i] = right->keys[i];
+        }
+
+        for (integer_t i = 0; i <= right->count; i++)
+            left->children[left->count + 1 + i] = right->children[i];
+
+        left->count += right->count + 1;
+    }
+
+    free(right);
+
+    bpt_remove_at(parent, index);
+}
+
+static void
+bpt_display_node(struct BPlusTreeNode_s *node, integer_t height,
+                 display_f function)
+{
+    for (integer_t i = 0; i < height; i++)
+        printf("|------- ");
+
+    printf("[ ");
+
+    for (integer_t i = 0; i < node->count; i++)
+    {
+        function(node->items[i]);
+        printf(" ");
+    }
+
+    printf("]\n");
+
+    if (!node->leaf)
+    {
+        for (integer_t i = 0; i <= node->count; i++)
+            bpt_display_node(node->children[i], height + 1, function);
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
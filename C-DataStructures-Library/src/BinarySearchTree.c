@@ -7,6 +7,7 @@
  */
 
 #include "BinarySearchTree.h"
+#include "Sort.h"
 
 /// A BinarySearchTree_s is a node-based binary tree with the following
 /// properties:
@@ -18,6 +19,12 @@
 ///
 /// This Binary Search Tree does not allow duplicate values.
 ///
+/// By default the tree is never rebalanced. It can be created with
+/// bst_create() to be balanced by one of two engines that only need rotations
+/// and keep the same nodes: a splay tree, that moves every node it reaches to
+/// the root, or a treap, that keeps its nodes in heap order of random
+/// priorities.
+///
 /// To crate a new BinarySearchTree_s use bst_new(). After that you can insert
 /// elements using bst_insert(). To remove elements you can use bst_remove() or
 /// if you wish to remove the \c root element use bst_pop().
@@ -45,6 +52,12 @@ struct BinarySearchTree_s
     /// The root element of a binary search tree.
     struct BinarySearchTreeNode_s *root;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief BinarySearchTree_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
@@ -58,6 +71,14 @@ struct BinarySearchTree_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief How the tree is balanced.
+    ///
+    /// Set when the tree is created and never changed.
+    BinarySearchTreeEngine engine;
+
+    /// \brief State of the generator of treap priorities.
+    uint64_t seed;
 };
 
 /// \brief A BinarySearchTree_s node.
@@ -95,6 +116,12 @@ struct BinarySearchTreeNode_s
     ///
     /// Pointer to parent node or NULL if this is the root node.
     struct BinarySearchTreeNode_s *parent;
+
+    /// \brief Random priority of a treap node.
+    ///
+    /// No node has a bigger priority than its parent. Only used by
+    /// \ref BST_TREAP.
+    uint32_t priority;
 };
 
 /// \brief A type for a binary search tree node.
@@ -110,23 +137,40 @@ typedef struct BinarySearchTreeNode_s *BinarySearchTreeNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static BinarySearchTreeNode_t *
-bst_new_node(void *element);
+bst_new_node(NodePool_t *pool, void *element);
 
 static void
-bst_free_node(BinarySearchTreeNode_t *node, free_f function);
+bst_free_node(NodePool_t *pool, BinarySearchTreeNode_t *node, free_f function);
 
 static void
-bst_free_node_shallow(BinarySearchTreeNode_t *node);
+bst_free_node_shallow(NodePool_t *pool, BinarySearchTreeNode_t *node);
 
 static void
-bst_free_tree(BinarySearchTreeNode_t *root, free_f function);
+bst_free_tree(NodePool_t *pool, BinarySearchTreeNode_t *root, free_f function);
 
 static void
-bst_free_tree_shallow(BinarySearchTreeNode_t *root);
+bst_free_tree_shallow(NodePool_t *pool, BinarySearchTreeNode_t *root);
+
+static bool
+bst_insert_node(BinarySearchTree_t *tree, void *element,
+                BinarySearchTreeNode_t **found);
 
 BinarySearchTreeNode_t *
 bst_node_find(BinarySearchTree_t *tree, void *element);
 
+// Balancing engines
+static void
+bst_rotate_left(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X);
+
+static void
+bst_rotate_right(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X);
+
+static void
+bst_splay(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X);
+
+static uint32_t
+bst_priority(BinarySearchTree_t *tree);
+
 int
 bst_node_height(BinarySearchTreeNode_t *root);
 
@@ -149,26 +193,79 @@ bst_display_treeview(BinarySearchTreeNode_t *root, integer_t depth, char *path,
 
 // Traversal
 static void
-bst_traversal_preorder(BinarySearchTreeNode_t *root, display_f function);
+bst_traversal_preorder(BinarySearchTreeNode_t *root, visit_f visit,
+                       void *argument);
 
 static void
-bst_traversal_inorder(BinarySearchTreeNode_t *root, display_f function);
+bst_traversal_inorder(BinarySearchTreeNode_t *root, visit_f visit,
+                      void *argument, bool leaves);
 
 static void
-bst_traversal_postorder(BinarySearchTreeNode_t *root, display_f function);
+bst_traversal_postorder(BinarySearchTreeNode_t *root, visit_f visit,
+                        void *argument);
+
+static bool
+bst_traversal_levelorder(BinarySearchTree_t *tree, visit_f visit,
+                         void *argument);
+
+static void
+bst_traversal_display(void *element, void *argument);
+
+
+static BinarySearchTreeNode_t *
+bst_bound(BinarySearchTree_t *tree, void *element, bool upper);
+
+static BinarySearchTreeNode_t *
+bst_successor(BinarySearchTreeNode_t *N);
+
+static BinarySearchTreeNode_t *
+bst_predecessor(BinarySearchTreeNode_t *N);
+
+static BinarySearchTreeNode_t *
+bst_minimum(BinarySearchTreeNode_t *N);
+
+static BinarySearchTreeNode_t *
+bst_maximum(BinarySearchTreeNode_t *N);
 
 static void
-bst_traversal_leaves(BinarySearchTreeNode_t *root, display_f function);
+bst_build(BinarySearchTree_t *tree, BinarySearchTreeNode_t **nodes,
+          integer_t size);
 
+static BinarySearchTreeNode_t *
+bst_build_subtree(BinarySearchTreeNode_t **nodes, integer_t size,
+                  BinarySearchTreeNode_t *parent);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
+/// Initializes a new binary search tree that is never rebalanced. Same as
+/// calling bst_create() with \ref BST_PLAIN.
 ///
 /// \param[in] interface
 ///
 /// \return
 BinarySearchTree_t *
 bst_new(Interface_t *interface)
+{
+    return bst_create(interface, BST_PLAIN);
+}
+
+/// Initializes a new binary search tree with a given engine. A plain tree is
+/// the fastest when the elements come in random order. A splay tree is the
+/// fastest when a few elements take most of the accesses, or when accesses
+/// come close to each other in order, but every lookup writes to the tree. A
+/// treap stays balanced in expectation for any order of insertions, like
+/// sorted timestamps, and its lookups don't change it.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// binary search tree to operate.
+/// \param[in] engine How the tree is balanced.
+///
+/// \return A new BinarySearchTree_s or NULL if allocation failed.
+BinarySearchTree_t *
+bst_create(Interface_t *interface, BinarySearchTreeEngine engine)
 {
     BinarySearchTree_t *tree = malloc(sizeof(BinarySearchTree_t));
 
@@ -180,17 +277,88 @@ bst_new(Interface_t *interface)
     tree->version_id = 0;
     tree->root = NULL;
 
+    tree->engine = engine;
+    tree->seed = ((uint64_t)(uintptr_t)tree ^ (uint64_t)time(NULL))
+                 * UINT64_C(0x9e3779b97f4a7c15) | 1;
+
+    tree->pool = NULL;
     tree->interface = interface;
 
     return tree;
 }
 
+/// Builds a perfectly balanced BinarySearchTree_s from a buffer of elements
+/// sorted in ascending order without duplicates. Every node is linked once,
+/// without any comparisons besides checking the order, so it takes linear time
+/// instead of one descent and rebalance per element. On success the tree takes
+/// ownership of the elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param interface An interface defining all necessary functions for the
+/// binary search tree to operate.
+/// \param elements Buffer of sorted elements.
+/// \param size Amount of elements in the buffer.
+///
+/// \return A new BinarySearchTree_s or NULL if allocation failed or the
+/// elements are not sorted and unique.
+BinarySearchTree_t *
+bst_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size)
+{
+    if (size < 0)
+        return NULL;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (interface->compare(elements[i - 1], elements[i]) >= 0)
+            return NULL;
+    }
+
+    BinarySearchTree_t *tree = bst_new(interface);
+
+    if (!tree || size == 0)
+        return tree;
+
+    BinarySearchTreeNode_t **nodes =
+            malloc(sizeof(BinarySearchTreeNode_t*) * (size_t)size);
+
+    if (!nodes)
+    {
+        bst_free_shallow(tree);
+        return NULL;
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        nodes[i] = bst_new_node(tree->pool, elements[i]);
+
+        if (!nodes[i])
+        {
+            while (i > 0)
+                bst_free_node_shallow(tree->pool, nodes[--i]);
+
+            free(nodes);
+            bst_free_shallow(tree);
+
+            return NULL;
+        }
+    }
+
+    bst_build(tree, nodes, size);
+
+    free(nodes);
+
+    return tree;
+}
+
 ///
 /// \param[in] tree
 void
 bst_free(BinarySearchTree_t *tree)
 {
-    bst_free_tree(tree->root, tree->interface->free);
+    bst_free_tree(tree->pool, tree->root, tree->interface->free);
 
     free(tree);
 }
@@ -200,7 +368,7 @@ bst_free(BinarySearchTree_t *tree)
 void
 bst_free_shallow(BinarySearchTree_t *tree)
 {
-    bst_free_tree_shallow(tree->root);
+    bst_free_tree_shallow(tree->pool, tree->root);
 
     free(tree);
 }
@@ -210,7 +378,7 @@ bst_free_shallow(BinarySearchTree_t *tree)
 void
 bst_erase(BinarySearchTree_t *tree)
 {
-    bst_free_tree(tree->root, tree->interface->free);
+    bst_free_tree(tree->pool, tree->root, tree->interface->free);
 
     tree->root = NULL;
     tree->count = 0;
@@ -221,7 +389,7 @@ bst_erase(BinarySearchTree_t *tree)
 void
 bst_erase_shallow(BinarySearchTree_t *tree)
 {
-    bst_free_tree_shallow(tree->root);
+    bst_free_tree_shallow(tree->pool, tree->root);
 
     tree->root = NULL;
     tree->count = 0;
@@ -256,6 +424,36 @@ bst_limit(BinarySearchTree_t *tree)
     return tree->limit;
 }
 
+/// Returns the engine the binary search tree was created with.
+///
+/// \param[in] tree BinarySearchTree_s reference.
+///
+/// \return The binary search tree's engine.
+BinarySearchTreeEngine
+bst_engine(BinarySearchTree_t *tree)
+{
+    return tree->engine;
+}
+
+/// Returns the element in the tree that is equal to the given element. Useful
+/// when elements are compared by a part of them, like a key, and the rest of
+/// the element in the tree is needed.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree BinarySearchTree_s reference.
+/// \param[in] element The element to be searched in the tree.
+///
+/// \return The element in the tree or NULL if it is not present.
+void *
+bst_get(BinarySearchTree_t *tree, void *element)
+{
+    BinarySearchTreeNode_t *node = bst_node_find(tree, element);
+
+    return node == NULL ? NULL : node->key;
+}
+
 ///
 /// \param[in] tree
 /// \param[in] limit
@@ -272,6 +470,34 @@ bst_set_limit(BinarySearchTree_t *tree, integer_t limit)
     return true;
 }
 
+/// Sets a node pool from where all nodes of the binary search tree are
+/// allocated. A pool can be shared between many containers as long as its
+/// nodes are big enough. Set it to NULL to go back to using malloc() and
+/// free(). The pool can only be changed when the tree is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree BinarySearchTree_s reference.
+/// \param pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the tree is not empty or if the pool's nodes are too
+/// small.
+bool
+bst_set_pool(BinarySearchTree_t *tree, NodePool_t *pool)
+{
+    if (!bst_empty(tree))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(BinarySearchTreeNode_t)))
+        return false;
+
+    tree->pool = pool;
+
+    return true;
+}
+
 /// Inserts the specified element into the tree.
 ///
 /// \param[in] tree
@@ -281,57 +507,178 @@ bst_set_limit(BinarySearchTree_t *tree, integer_t limit)
 bool
 bst_insert(BinarySearchTree_t *tree, void *element)
 {
-    if (bst_full(tree))
+    return bst_insert_node(tree, element, NULL);
+}
+
+/// Looks for an element equal to the given one and inserts the given element
+/// if there is none, with a single descent. If an equal element is found the
+/// given element is not added and still belongs to the caller.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree BinarySearchTree_s reference.
+/// \param[in] element The element to be searched or added.
+/// \param[out] existing The element equal to \c element in the tree after
+/// the call, or NULL if it was not found and could not be added.
+///
+/// \return True if the element was added to the tree.
+/// \return False if an equal element was found, if the tree has a limited
+/// size or if any allocations failed.
+bool
+bst_find_or_insert(BinarySearchTree_t *tree, void *element, void **existing)
+{
+    BinarySearchTreeNode_t *found;
+
+    bool inserted = bst_insert_node(tree, element, &found);
+
+    *existing = inserted ? element : found ? found->key : NULL;
+
+    return inserted;
+}
+
+/// Adds an element or, if an equal element is already in the tree, merges
+/// the given element into it and frees the given element, all with a single
+/// descent. The merge function must not change how the element in the tree
+/// compares to others.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] tree BinarySearchTree_s reference.
+/// \param[in] element The element to be added or merged.
+/// \param[in] merge A function that folds the given element into the element
+/// already in the tree.
+///
+/// \return True if the element was added or merged. The tree then owns it.
+/// \return False if it was not found and could not be added.
+bool
+bst_upsert(BinarySearchTree_t *tree, void *element, reduce_f merge)
+{
+    void *existing;
+
+    if (bst_find_or_insert(tree, element, &existing))
+        return true;
+
+    if (!existing)
         return false;
 
-    if (bst_empty(tree))
+    merge(existing, element);
+
+    tree->interface->free(element);
+
+    return true;
+}
+/// Adds every element of a buffer to the binary search tree. The buffer is
+/// sorted and merged with the elements already in the tree, which is then
+/// rebuilt perfectly balanced in linear time, reusing its nodes. Inserting
+/// sorted elements one by one would make the tree degenerate into a list.
+/// Only if the tree has a limit or is a treap are elements inserted one by
+/// one, since a rebuilt treap would lose its random shape.
+///
+/// When the function returns, the inserted elements are at the start of the
+/// buffer in ascending order. The rest are elements that could not be
+/// inserted because they were duplicates, the tree was full or an
+/// allocation failed. They still belong to the caller.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree BinarySearchTree_s reference.
+/// \param elements Buffer of elements to be added.
+/// \param size Amount of elements in the buffer.
+///
+/// \return The amount of elements inserted.
+integer_t
+bst_insert_all(BinarySearchTree_t *tree, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return 0;
+
+    srt_sort(elements, size, tree->interface->compare);
+
+    integer_t total = 0;
+
+    BinarySearchTreeNode_t **nodes = NULL;
+
+    if (tree->limit <= 0 && tree->engine != BST_TREAP)
+        nodes = malloc(sizeof(BinarySearchTreeNode_t*)
+                       * (size_t)(size + tree->count));
+
+    if (!nodes)
     {
-        tree->root = bst_new_node(element);
+        for (integer_t i = 0; i < size; i++)
+        {
+            if (bst_insert(tree, elements[i]))
+            {
+                void *element = elements[i];
+                elements[i] = elements[total];
+                elements[total++] = element;
+            }
+        }
 
-        if (!tree->root)
-            return false;
+        return total;
     }
-    else
+
+    // The nodes of the tree go to the end of the array and the merged
+    // sequence is written from the start, which never overtakes them
+    integer_t count = tree->count, old = size, merged = 0;
+
+    if (tree->root)
     {
-        BinarySearchTreeNode_t *scan = tree->root;
-        BinarySearchTreeNode_t *parent = scan;
+        BinarySearchTreeNode_t *node = bst_minimum(tree->root);
 
-        while (scan != NULL)
+        for (integer_t i = size; node != NULL; i++)
         {
-            parent = scan;
-
-            if (tree->interface->compare(scan->key, element) > 0)
-                scan = scan->left;
-            else if (tree->interface->compare(scan->key, element) < 0)
-                scan = scan->right;
-            else
-                return false; /* No duplicates are allowed */
+            nodes[i] = node;
+            node = bst_successor(node);
         }
+    }
 
-        if (tree->interface->compare(parent->key, element) < 0)
-        {
-            parent->right = bst_new_node(element);
+    for (integer_t i = 0; i < size || old < size + count; )
+    {
+        int comparison = -1;
 
-            if (!parent->right)
-                return false;
+        if (old < size + count && i < size)
+            comparison = tree->interface->compare(nodes[old]->key,
+                                                  elements[i]);
 
-            parent->right->parent = parent;
+        if (old < size + count && (i == size || comparison < 0))
+        {
+            nodes[merged++] = nodes[old++];
+            continue;
         }
-        else
+
+        // Equal to an element already in the tree or in the batch
+        if (comparison == 0 || (merged > 0 && tree->interface->compare(
+                nodes[merged - 1]->key, elements[i]) == 0))
         {
-            parent->left = bst_new_node(element);
+            i++;
+            continue;
+        }
 
-            if (!parent->left)
-                return false;
+        BinarySearchTreeNode_t *node = bst_new_node(tree->pool, elements[i]);
 
-            parent->left->parent = parent;
+        if (node)
+        {
+            nodes[merged++] = node;
+
+            void *element = elements[i];
+            elements[i] = elements[total];
+            elements[total++] = element;
         }
+
+        i++;
     }
 
-    tree->count++;
+    bst_build(tree, nodes, merged);
+
+    free(nodes);
+
     tree->version_id++;
 
-    return true;
+    return total;
 }
 
 /// Removes the specified element from the tree.
@@ -348,6 +695,19 @@ bst_remove(BinarySearchTree_t *tree, void *element)
     if (node == NULL)
         return false;
 
+    // A treap node goes down below its child of highest priority until it
+    // has at most one child, which then takes its place
+    if (tree->engine == BST_TREAP)
+    {
+        while (node->left != NULL && node->right != NULL)
+        {
+            if (node->left->priority > node->right->priority)
+                bst_rotate_right(tree, node);
+            else
+                bst_rotate_left(tree, node);
+        }
+    }
+
     bool is_root = node->parent == NULL;
 
     // Deleting a leaf. No need to update parent pointers.
@@ -366,7 +726,7 @@ bst_remove(BinarySearchTree_t *tree, void *element)
                 node->parent->left = NULL;
         }
 
-        bst_free_node(node, tree->interface->free);
+        bst_free_node(tree->pool, node, tree->interface->free);
     }
     // Only right subtree. Need to update right subtree parent pointer.
     else if (node->left == NULL)
@@ -391,7 +751,7 @@ bst_remove(BinarySearchTree_t *tree, void *element)
                 node->parent->left = node->right;
         }
 
-        bst_free_node(node, tree->interface->free);
+        bst_free_node(tree->pool, node, tree->interface->free);
     }
     // Only left subtree. Need to update left subtree parent pointer.
     else if (node->right == NULL)
@@ -416,7 +776,7 @@ bst_remove(BinarySearchTree_t *tree, void *element)
                 node->parent->left = node->left;
         }
 
-        bst_free_node(node, tree->interface->free);
+        bst_free_node(tree->pool, node, tree->interface->free);
     }
     // Node has left and right subtrees
     else
@@ -480,7 +840,7 @@ bst_remove(BinarySearchTree_t *tree, void *element)
         }
 
         // Delete temp node
-        bst_free_node_shallow(temp);
+        bst_free_node_shallow(tree->pool, temp);
         tree->interface->free(node->key);
 
 
@@ -592,6 +952,87 @@ bst_min(BinarySearchTree_t *tree)
     return scan->key;
 }
 
+/// Visits in ascending order every element that is not smaller than \c low
+/// and not bigger than \c high. The search goes straight to the first
+/// element of the range and then follows the parent pointers, so only
+/// <code> O(log n + k) </code> nodes are visited where \c k is the amount of
+/// elements in the range.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree BinarySearchTree_s reference.
+/// \param low Lower bound of the range.
+/// \param high Upper bound of the range.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+bst_range(BinarySearchTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument)
+{
+    BinarySearchTreeNode_t *node = bst_bound(tree, low, false);
+
+    integer_t total = 0;
+
+    while (node != NULL && tree->interface->compare(node->key, high) <= 0)
+    {
+        visit(node->key, argument);
+        total++;
+
+        node = bst_successor(node);
+    }
+
+    return total;
+}
+
+/// Calls a function with every element of the tree in a given order:
+/// - -1 Pre-order traversal.
+/// - 0 In-order traversal.
+/// - 1 Post-order traversal.
+/// - 2 Level-order traversal.
+/// - Any other values defaults to leaves traversal, in order.
+///
+/// The walks go from node to node through the parent pointers, so they don't
+/// recurse and don't use a stack, even on a degenerate tree. Only the
+/// level-order traversal needs memory, for a queue of nodes.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree BinarySearchTree_s reference.
+/// \param traversal_mode The way the tree is to be traversed.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return True if the tree was traversed.
+/// \return False if the level-order queue could not be allocated.
+bool
+bst_visit(BinarySearchTree_t *tree, int traversal_mode, visit_f visit,
+          void *argument)
+{
+    switch (traversal_mode)
+    {
+        case -1:
+            bst_traversal_preorder(tree->root, visit, argument);
+            break;
+        case 0:
+            bst_traversal_inorder(tree->root, visit, argument, false);
+            break;
+        case 1:
+            bst_traversal_postorder(tree->root, visit, argument);
+            break;
+        case 2:
+            return bst_traversal_levelorder(tree, visit, argument);
+        default:
+            bst_traversal_inorder(tree->root, visit, argument, true);
+            break;
+    }
+
+    return true;
+}
+
 ///
 /// \param[in] tree
 /// \param[in] display_mode
@@ -641,36 +1082,39 @@ bst_traversal(BinarySearchTree_t *tree, int traversal_mode)
     {
         case -1:
             printf("Pre-order Traversal\n");
-            bst_traversal_preorder(tree->root, tree->interface->display);
             break;
         case 0:
             printf("In-order Traversal\n");
-            bst_traversal_inorder(tree->root, tree->interface->display);
             break;
         case 1:
             printf("Post-order Traversal\n");
-            bst_traversal_postorder(tree->root, tree->interface->display);
+            break;
+        case 2:
+            printf("Level-order Traversal\n");
             break;
         default:
             printf("Leaves Traversal\n");
-            bst_traversal_leaves(tree->root, tree->interface->display);
             break;
     }
 
+    bst_visit(tree, traversal_mode, bst_traversal_display, tree->interface);
+
     printf("\n");
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static BinarySearchTreeNode_t *
-bst_new_node(void *element)
+bst_new_node(NodePool_t *pool, void *element)
 {
-    BinarySearchTreeNode_t * node = malloc(sizeof(BinarySearchTreeNode_t));
+    BinarySearchTreeNode_t *node = npl_node_alloc(pool,
+            sizeof(BinarySearchTreeNode_t));
 
     if (!node)
         return NULL;
 
     node->key = element;
+    node->priority = 0;
 
     node->parent = NULL;
     node->left = NULL;
@@ -680,21 +1124,21 @@ bst_new_node(void *element)
 }
 
 static void
-bst_free_node(BinarySearchTreeNode_t *node, free_f function)
+bst_free_node(NodePool_t *pool, BinarySearchTreeNode_t *node, free_f function)
 {
     function(node->key);
 
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-bst_free_node_shallow(BinarySearchTreeNode_t *node)
+bst_free_node_shallow(NodePool_t *pool, BinarySearchTreeNode_t *node)
 {
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-bst_free_tree(BinarySearchTreeNode_t *root, free_f function)
+bst_free_tree(NodePool_t *pool, BinarySearchTreeNode_t *root, free_f function)
 {
     BinarySearchTreeNode_t *scan = root;
     BinarySearchTreeNode_t *up = NULL;
@@ -722,13 +1166,13 @@ bst_free_tree(BinarySearchTreeNode_t *root, free_f function)
         {
             if (up == NULL)
             {
-                bst_free_node(scan, function);
+                bst_free_node(pool, scan, function);
                 scan = NULL;
             }
 
             while (up != NULL)
             {
-                bst_free_node(scan, function);
+                bst_free_node(pool, scan, function);
 
                 if (up->right != NULL)
                 {
@@ -747,7 +1191,7 @@ bst_free_tree(BinarySearchTreeNode_t *root, free_f function)
 }
 
 static void
-bst_free_tree_shallow(BinarySearchTreeNode_t *root)
+bst_free_tree_shallow(NodePool_t *pool, BinarySearchTreeNode_t *root)
 {
     BinarySearchTreeNode_t *scan = root;
     BinarySearchTreeNode_t *up = NULL;
@@ -775,13 +1219,13 @@ bst_free_tree_shallow(BinarySearchTreeNode_t *root)
         {
             if (up == NULL)
             {
-                bst_free_node_shallow(scan);
+                bst_free_node_shallow(pool, scan);
                 scan = NULL;
             }
 
             while (up != NULL)
             {
-                bst_free_node_shallow(scan);
+                bst_free_node_shallow(pool, scan);
 
                 if (up->right != NULL)
                 {
@@ -799,22 +1243,210 @@ bst_free_tree_shallow(BinarySearchTreeNode_t *root)
     }
 }
 
+// Inserts an element. If found is given, an equal element is reported in it
+// instead of being refused
+static bool
+bst_insert_node(BinarySearchTree_t *tree, void *element,
+                BinarySearchTreeNode_t **found)
+{
+    if (found)
+        *found = NULL;
+
+    BinarySearchTreeNode_t *parent = NULL;
+
+    int comparison = 0;
+
+    for (BinarySearchTreeNode_t *scan = tree->root; scan != NULL; )
+    {
+        parent = scan;
+
+        comparison = tree->interface->compare(scan->key, element);
+
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
+            scan = scan->right;
+        else
+        {
+            if (found)
+                *found = scan;
+
+            if (tree->engine == BST_SPLAY)
+                bst_splay(tree, scan);
+
+            return false; /* No duplicates are allowed */
+        }
+    }
+
+    if (bst_full(tree))
+        return false;
+
+    BinarySearchTreeNode_t *node = bst_new_node(tree->pool, element);
+
+    if (!node)
+        return false;
+
+    node->parent = parent;
+
+    if (parent == NULL)
+        tree->root = node;
+    else if (comparison > 0)
+        parent->left = node;
+    else
+        parent->right = node;
+
+    if (tree->engine == BST_SPLAY)
+        bst_splay(tree, node);
+    else if (tree->engine == BST_TREAP)
+    {
+        node->priority = bst_priority(tree);
+
+        // Rotate the node up until its parent has a bigger priority
+        while (node->parent != NULL && node->parent->priority < node->priority)
+        {
+            if (node == node->parent->left)
+                bst_rotate_right(tree, node->parent);
+            else
+                bst_rotate_left(tree, node->parent);
+        }
+    }
+
+    tree->count++;
+    tree->version_id++;
+
+    return true;
+}
+
+// A splay tree moves the node found, or the last node reached, to the root.
+// This keeps the same nodes in order, so iterators are still valid.
 BinarySearchTreeNode_t *
 bst_node_find(BinarySearchTree_t *tree, void *element)
 {
-    BinarySearchTreeNode_t *scan = tree->root;
+    BinarySearchTreeNode_t *scan = tree->root, *last = NULL;
 
     while (scan != NULL)
     {
-        if (tree->interface->compare(scan->key, element) > 0)
+        int comparison = tree->interface->compare(scan->key, element);
+
+        last = scan;
+
+        if (comparison > 0)
             scan = scan->left;
-        else if (tree->interface->compare(scan->key, element) < 0)
+        else if (comparison < 0)
             scan = scan->right;
         else
-            return scan;
+            break;
     }
 
-    return NULL;
+    if (tree->engine == BST_SPLAY && last != NULL)
+        bst_splay(tree, last);
+
+    return scan;
+}
+
+static void
+bst_rotate_left(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X)
+{
+    BinarySearchTreeNode_t *Y = X->right;
+
+    X->right = Y->left;
+
+    if (Y->left != NULL)
+        Y->left->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->left)
+        X->parent->left = Y;
+    else
+        X->parent->right = Y;
+
+    Y->left = X;
+    X->parent = Y;
+}
+
+static void
+bst_rotate_right(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X)
+{
+    BinarySearchTreeNode_t *Y = X->left;
+
+    X->left = Y->right;
+
+    if (Y->right != NULL)
+        Y->right->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->right)
+        X->parent->right = Y;
+    else
+        X->parent->left = Y;
+
+    Y->right = X;
+    X->parent = Y;
+}
+
+// Moves a node to the root with zig, zig-zig and zig-zag steps. A zig-zig
+// rotates the grandparent first, which roughly halves the depth of every node
+// on the path.
+static void
+bst_splay(BinarySearchTree_t *tree, BinarySearchTreeNode_t *X)
+{
+    while (X->parent != NULL)
+    {
+        BinarySearchTreeNode_t *P = X->parent, *G = P->parent;
+
+        bool left = X == P->left;
+
+        if (G == NULL)
+        {
+            if (left)
+                bst_rotate_right(tree, P);
+            else
+                bst_rotate_left(tree, P);
+        }
+        else if (left == (P == G->left))
+        {
+            if (left)
+            {
+                bst_rotate_right(tree, G);
+                bst_rotate_right(tree, P);
+            }
+            else
+            {
+                bst_rotate_left(tree, G);
+                bst_rotate_left(tree, P);
+            }
+        }
+        else
+        {
+            if (left)
+            {
+                bst_rotate_right(tree, P);
+                bst_rotate_left(tree, G);
+            }
+            else
+            {
+                bst_rotate_left(tree, P);
+                bst_rotate_right(tree, G);
+            }
+        }
+    }
+}
+
+// A xorshift generator kept by each tree
+static uint32_t
+bst_priority(BinarySearchTree_t *tree)
+{
+    tree->seed ^= tree->seed >> 12;
+    tree->seed ^= tree->seed << 25;
+    tree->seed ^= tree->seed >> 27;
+
+    return (uint32_t)((tree->seed * UINT64_C(0x2545f4914f6cdd1d)) >> 32);
 }
 
 int
@@ -944,63 +1576,226 @@ bst_display_treeview(BinarySearchTreeNode_t *root, integer_t depth, char *path,
     bst_display_treeview(root->left, depth, path, function, false);
 }
 
+// Follows the parent pointers, so no stack is needed even on a degenerate
+// tree
 static void
-bst_traversal_preorder(BinarySearchTreeNode_t *root, display_f function)
+bst_traversal_preorder(BinarySearchTreeNode_t *root, visit_f visit,
+                       void *argument)
 {
-    if (root == NULL)
-        return;
+    BinarySearchTreeNode_t *node = root;
 
-    function(root->key);
-    printf(" ");
+    while (node != NULL)
+    {
+        visit(node->key, argument);
 
-    bst_traversal_preorder(root->left, function);
+        if (node->left != NULL)
+            node = node->left;
+        else if (node->right != NULL)
+            node = node->right;
+        else
+        {
+            // Go up to the first left child that has a right sibling
+            while (node->parent != NULL && (node == node->parent->right ||
+                                            node->parent->right == NULL))
+                node = node->parent;
 
-    bst_traversal_preorder(root->right, function);
+            node = node->parent == NULL ? NULL : node->parent->right;
+        }
+    }
 }
 
 static void
-bst_traversal_inorder(BinarySearchTreeNode_t *root, display_f function)
+bst_traversal_inorder(BinarySearchTreeNode_t *root, visit_f visit,
+                      void *argument, bool leaves)
 {
     if (root == NULL)
         return;
 
-    bst_traversal_inorder(root->left, function);
+    for (BinarySearchTreeNode_t *node = bst_minimum(root); node != NULL;
+         node = bst_successor(node))
+    {
+        if (!leaves || (node->left == NULL && node->right == NULL))
+            visit(node->key, argument);
+    }
+}
 
-    function(root->key);
-    printf(" ");
+static void
+bst_traversal_postorder(BinarySearchTreeNode_t *root, visit_f visit,
+                        void *argument)
+{
+    BinarySearchTreeNode_t *node = root;
 
-    bst_traversal_inorder(root->right, function);
+    // Every subtree starts at its first leaf
+    while (node != NULL && (node->left != NULL || node->right != NULL))
+        node = node->left != NULL ? node->left : node->right;
+
+    while (node != NULL)
+    {
+        BinarySearchTreeNode_t *parent = node->parent;
+
+        visit(node->key, argument);
+
+        if (parent != NULL && node == parent->left && parent->right != NULL)
+        {
+            node = parent->right;
+
+            while (node->left != NULL || node->right != NULL)
+                node = node->left != NULL ? node->left : node->right;
+        }
+        else
+            node = parent;
+    }
 }
 
-static void
-bst_traversal_postorder(BinarySearchTreeNode_t *root, display_f function)
+// The queue never holds more nodes than the tree
+static bool
+bst_traversal_levelorder(BinarySearchTree_t *tree, visit_f visit,
+                         void *argument)
 {
-    if (root == NULL)
-        return;
+    if (tree->root == NULL)
+        return true;
+
+    BinarySearchTreeNode_t **queue = malloc(sizeof(BinarySearchTreeNode_t *) *
+                                      (size_t)tree->count);
 
-    bst_traversal_postorder(root->left, function);
+    if (!queue)
+        return false;
 
-    bst_traversal_postorder(root->right, function);
+    integer_t front = 0, rear = 0;
 
-    function(root->key);
+    queue[rear++] = tree->root;
+
+    while (front < rear)
+    {
+        BinarySearchTreeNode_t *node = queue[front++];
+
+        visit(node->key, argument);
+
+        if (node->left != NULL)
+            queue[rear++] = node->left;
+        if (node->right != NULL)
+            queue[rear++] = node->right;
+    }
+
+    free(queue);
+
+    return true;
+}
+
+// Displays an element of a tree given its interface
+static void
+bst_traversal_display(void *element, void *argument)
+{
+    ((Interface_t *)argument)->display(element);
     printf(" ");
 }
 
+// Links a sorted array of nodes as a balanced tree and makes it the tree's
+// content
 static void
-bst_traversal_leaves(BinarySearchTreeNode_t *root, display_f function)
+bst_build(BinarySearchTree_t *tree, BinarySearchTreeNode_t **nodes,
+          integer_t size)
 {
-    if (root == NULL)
-        return;
+    tree->root = bst_build_subtree(nodes, size, NULL);
+    tree->count = size;
+}
+
+// Uses the middle node as the root of a subtree and builds both halves
+static BinarySearchTreeNode_t *
+bst_build_subtree(BinarySearchTreeNode_t **nodes, integer_t size,
+                  BinarySearchTreeNode_t *parent)
+{
+    if (size == 0)
+        return NULL;
+
+    integer_t middle = size / 2;
+
+    BinarySearchTreeNode_t *node = nodes[middle];
 
-    bst_traversal_leaves(root->left, function);
+    node->parent = parent;
 
-    bst_traversal_leaves(root->right, function);
+    node->left = bst_build_subtree(nodes, middle, node);
+    node->right = bst_build_subtree(nodes + middle + 1, size - middle - 1,
+                                    node);
 
-    if (root->right == NULL && root->left == NULL)
+    return node;
+}
+
+// Finds the first node with a key not smaller than the element or, if upper
+// is true, the first node with a key bigger than the element
+static BinarySearchTreeNode_t *
+bst_bound(BinarySearchTree_t *tree, void *element, bool upper)
+{
+    BinarySearchTreeNode_t *scan = tree->root, *result = NULL;
+
+    while (scan != NULL)
     {
-        function(root->key);
-        printf(" ");
+        int comparison = tree->interface->compare(scan->key, element);
+
+        if (comparison > 0 || (comparison == 0 && !upper))
+        {
+            result = scan;
+            scan = scan->left;
+        }
+        else
+            scan = scan->right;
     }
+
+    return result;
+}
+
+static BinarySearchTreeNode_t *
+bst_successor(BinarySearchTreeNode_t *N)
+{
+    if (N->right != NULL)
+        return bst_minimum(N->right);
+
+    BinarySearchTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->right)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
+}
+
+static BinarySearchTreeNode_t *
+bst_predecessor(BinarySearchTreeNode_t *N)
+{
+    if (N->left != NULL)
+        return bst_maximum(N->left);
+
+    BinarySearchTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->left)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
+}
+
+static BinarySearchTreeNode_t *
+bst_minimum(BinarySearchTreeNode_t *N)
+{
+    // Finds the minimum node of subtree N
+    while (N->left != NULL)
+        N = N->left;
+
+    return N;
+}
+
+static BinarySearchTreeNode_t *
+bst_maximum(BinarySearchTreeNode_t *N)
+{
+    // Finds the maximum node of subtree N
+    while (N->right != NULL)
+        N = N->right;
+
+    return N;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -1010,7 +1805,241 @@ bst_traversal_leaves(BinarySearchTreeNode_t *root, display_f function)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo BinarySearchTreeIterator
+/// An iterator that walks through the elements of a BinarySearchTree_s in
+/// order. It only keeps the current node and follows the parent pointers to
+/// reach the next or previous one, so a full iteration takes linear time and
+/// each step takes constant time on average. The iterator can be placed at the
+/// start of a range with bst_iter_lower_bound() or bst_iter_upper_bound().
+///
+/// If the tree is modified the cursor might point to a node that was freed.
+/// Until the iterator is placed again with bst_iter_to_start(),
+/// bst_iter_to_end() or one of the bound functions, all other functions fail.
+struct BinarySearchTreeIterator_s
+{
+    /// \brief Target BinarySearchTree_s.
+    ///
+    /// Target BinarySearchTree_s. The iterator might need to use some
+    /// information provided by the tree.
+    struct BinarySearchTree_s *target;
+
+    /// \brief Current node.
+    ///
+    /// The node of the element pointed by the cursor or NULL if the tree is
+    /// empty or a bound was not found.
+    struct BinarySearchTreeNode_s *cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is placed it stores the version_id of the target
+    /// structure.
+    integer_t target_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+bst_iter_target_modified(BinarySearchTreeIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new iterator with its cursor at the minimum element of the
+/// target tree.
+///
+/// \param target The target tree.
+///
+/// \return A new iterator or NULL if allocation failed.
+BinarySearchTreeIterator_t *
+bst_iter_new(BinarySearchTree_t *target)
+{
+    BinarySearchTreeIterator_t *iter =
+            malloc(sizeof(BinarySearchTreeIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    bst_iter_retarget(iter, target);
+
+    return iter;
+}
+
+/// Changes the target tree of an iterator and moves its cursor to the
+/// minimum element.
+///
+/// \param iter The iterator to be retargeted.
+/// \param target The new target tree.
+void
+bst_iter_retarget(BinarySearchTreeIterator_t *iter, BinarySearchTree_t *target)
+{
+    iter->target = target;
+
+    bst_iter_to_start(iter);
+}
+
+/// Frees from memory an iterator. The target tree is not changed.
+///
+/// \param iter The iterator to be freed from memory.
+void
+bst_iter_free(BinarySearchTreeIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor to the next element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the maximum element, if it is not at
+/// any element or if the target was modified.
+bool
+bst_iter_next(BinarySearchTreeIterator_t *iter)
+{
+    if (!bst_iter_has_next(iter))
+        return false;
+
+    iter->cursor = bst_successor(iter->cursor);
+
+    return true;
+}
+
+/// Moves the cursor to the previous element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the minimum element, if it is not at
+/// any element or if the target was modified.
+bool
+bst_iter_prev(BinarySearchTreeIterator_t *iter)
+{
+    if (!bst_iter_has_prev(iter))
+        return false;
+
+    iter->cursor = bst_predecessor(iter->cursor);
+
+    return true;
+}
+
+/// Moves the cursor to the minimum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+bst_iter_to_start(BinarySearchTreeIterator_t *iter)
+{
+    BinarySearchTree_t *tree = iter->target;
+
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? bst_minimum(tree->root) : NULL;
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the maximum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+bst_iter_to_end(BinarySearchTreeIterator_t *iter)
+{
+    BinarySearchTree_t *tree = iter->target;
+
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? bst_maximum(tree->root) : NULL;
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the first element that is not smaller than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if every element is smaller than the given one. The cursor
+/// is then not at any element.
+bool
+bst_iter_lower_bound(BinarySearchTreeIterator_t *iter, void *element)
+{
+    iter->target_id = iter->target->version_id;
+    iter->cursor = bst_bound(iter->target, element, false);
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the cursor to the first element that is bigger than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if no element is bigger than the given one. The cursor is
+/// then not at any element.
+bool
+bst_iter_upper_bound(BinarySearchTreeIterator_t *iter, void *element)
+{
+    iter->target_id = iter->target->version_id;
+    iter->cursor = bst_bound(iter->target, element, true);
+
+    return iter->cursor != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a successor and the
+/// target was not modified.
+bool
+bst_iter_has_next(BinarySearchTreeIterator_t *iter)
+{
+    if (bst_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
+
+    return bst_successor(iter->cursor) != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a predecessor and
+/// the target was not modified.
+bool
+bst_iter_has_prev(BinarySearchTreeIterator_t *iter)
+{
+    if (bst_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
+
+    return bst_predecessor(iter->cursor) != NULL;
+}
+
+/// \param iter The iterator.
+///
+/// \return The element at the cursor or NULL if the cursor is not at any
+/// element or the target was modified.
+void *
+bst_iter_peek(BinarySearchTreeIterator_t *iter)
+{
+    if (bst_iter_target_modified(iter) || iter->cursor == NULL)
+        return NULL;
+
+    return iter->cursor->key;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+bst_iter_target_modified(BinarySearchTreeIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -7,6 +7,8 @@
  */
 
 #include "BitArray.h"
+#include "BitKernels.h"
+#include "MappedFile.h"
 
 /// A bit array (bit set, bit map, bit string or bit vector) is a compacted
 /// array of bits represented by the bits in a word (in this case an unsigned_t)
@@ -30,6 +32,14 @@
 /// a bit array might be a good choice since the required bytes to represent
 /// this array drops from 100 to 12.5 kilobytes.
 ///
+/// Operations over whole buffers (cardinality, binary operations and bit
+/// searches) go through the vectorised kernels of BitKernels.h. The buffer is
+/// always allocated with bkn_alloc() so it is suitably aligned for them.
+///
+/// A bit array opened with bit_map() keeps its buffer in a file mapped in
+/// memory instead. Every change goes straight to the page cache and the array
+/// is there again, without reading it, the next time the file is mapped.
+///
 /// \par Functions
 /// Located in the file BitArray.c
 struct BitArray_s
@@ -49,8 +59,62 @@ struct BitArray_s
     /// Number of bits used by the user, which is less than or equal to the
     /// actual number of bits.
     unsigned_t used_bits;
+
+    /// \brief Rank and select directory.
+    ///
+    /// Built by bit_build_index(). May be NULL.
+    struct BitRankIndex_s *index;
+
+    /// \brief A version id that keeps track of modifications.
+    ///
+    /// This version id is used by the rank and select directory to know when
+    /// it needs to be rebuilt.
+    integer_t version_id;
+
+    /// \brief The file that holds the buffer.
+    ///
+    /// Set by bit_map(), otherwise NULL and the buffer is allocated in memory.
+    struct MappedFile_s *file;
 };
 
+/// \brief A rank and select directory for a BitArray_s.
+///
+/// Implementation detail. The bit array is split in superblocks of
+/// BIT_SUPERBLOCK_WORDS words. Each superblock keeps how many bits are set
+/// before it and each word keeps how many bits are set before it in its own
+/// superblock, so a rank takes two lookups and a popcount. To speed up select,
+/// the superblock of every BIT_SELECT_SAMPLE-th set bit is sampled, which
+/// narrows the binary search over superblocks to a few entries.
+struct BitRankIndex_s
+{
+    /// \brief Set bits before each superblock.
+    unsigned_t *supers;
+
+    /// \brief Set bits before each word inside its superblock.
+    uint16_t *blocks;
+
+    /// \brief Superblock of every BIT_SELECT_SAMPLE-th set bit.
+    unsigned_t *samples;
+
+    /// \brief Amount of superblocks.
+    unsigned_t supers_count;
+
+    /// \brief Total amount of set bits among the used bits.
+    unsigned_t total;
+
+    /// \brief Version of the bit array when this directory was built.
+    integer_t version_id;
+};
+
+typedef struct BitRankIndex_s BitRankIndex_t;
+
+/// Words in each superblock of a BitRankIndex_s, small enough for the set
+/// bits before each word to fit 16 bits.
+#define BIT_SUPERBLOCK_WORDS 64
+
+/// Amount of set bits between each select sample.
+#define BIT_SELECT_SAMPLE 4096
+
 // Finding how many shifts are needed for the highest integer type to be mapped
 // as a buffer index. Used in bit_buffer_index().
 static const unsigned_t bit_shifts =
@@ -78,8 +142,20 @@ bit_clear_unused_bits(BitArray_t *bits);
 static bool
 bit_equalize(BitArray_t *bits1, BitArray_t *bits2);
 
+static bool
+bit_reallocate(BitArray_t *bits, unsigned_t new_size);
+
+static unsigned_t
+bit_lowest(unsigned_t word);
+
 static unsigned_t
-bit_count(unsigned_t i);
+bit_word(BitArray_t *bits, unsigned_t index);
+
+static unsigned_t
+bit_select_word(unsigned_t word, unsigned_t rank);
+
+static bool
+bit_index_ready(BitArray_t *bits);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -94,7 +170,7 @@ bit_new(void)
     if (!bits)
         return NULL;
 
-    bits->buffer = calloc(1, sizeof(unsigned_t));
+    bits->buffer = bkn_alloc(1);
 
     if (!(bits->buffer))
     {
@@ -104,6 +180,9 @@ bit_new(void)
 
     bits->size = 1;
     bits->used_bits = bits->size * bit_word_size;
+    bits->index = NULL;
+    bits->version_id = 0;
+    bits->file = NULL;
 
     return bits;
 }
@@ -127,7 +206,7 @@ bit_create(unsigned_t required_bits)
 
     unsigned_t buffer_size = bit_buffer_index(required_bits - 1) + 1;
 
-    bits->buffer = calloc(buffer_size, sizeof(unsigned_t));
+    bits->buffer = bkn_alloc(buffer_size);
 
     if (!(bits->buffer))
     {
@@ -137,6 +216,71 @@ bit_create(unsigned_t required_bits)
 
     bits->size = buffer_size;
     bits->used_bits = required_bits;
+    bits->index = NULL;
+    bits->version_id = 0;
+    bits->file = NULL;
+
+    return bits;
+}
+
+/// Opens a bit array whose buffer lives in the file at \c path, mapped in
+/// memory. If the file doesn't exist it is created with \c required_bits
+/// cleared bits. Otherwise the bits stored in it are used right away, without
+/// reading them, and grown to \c required_bits if there are less.
+///
+/// Changes to the bits are written to the file by the operating system, even
+/// if the process crashes. The amount of bits in use is only stored by
+/// bit_sync() and bit_free(), and only bit_sync() makes sure everything
+/// survives a crash of the whole system. Growing and shrinking resize the
+/// file. The file can only be opened by one bit array at a time.
+///
+/// \param[in] path The path of the file.
+/// \param[in] required_bits Minimum amount of addressable bits, or 0 to use
+/// the bits in the file.
+///
+/// \return A bit array kept in the file or NULL if the file could not be
+/// opened or mapped, or if it holds another kind of container.
+BitArray_t *
+bit_map(const char *path, unsigned_t required_bits)
+{
+    BitArray_t *bits = malloc(sizeof(BitArray_t));
+
+    if (!bits)
+        return NULL;
+
+    unsigned_t words = required_bits == 0
+            ? 1 : bit_buffer_index(required_bits - 1) + 1;
+
+    bits->file = mpf_open(path, MappedBitArray, sizeof(unsigned_t),
+                          words * sizeof(unsigned_t));
+
+    if (!bits->file)
+    {
+        free(bits);
+        return NULL;
+    }
+
+    MappedHeader_t *header = mpf_header(bits->file);
+
+    bits->buffer = mpf_data(bits->file);
+    bits->size = mpf_bytes(bits->file) / sizeof(unsigned_t);
+    bits->used_bits = header->count > required_bits
+            ? header->count : required_bits;
+    bits->index = NULL;
+    bits->version_id = 0;
+
+    if (bits->used_bits == 0)
+        bits->used_bits = bits->size * bit_word_size;
+
+    // The file was cut short by someone else
+    if (bits->used_bits > bits->size * bit_word_size)
+    {
+        mpf_close(bits->file);
+        free(bits);
+        return NULL;
+    }
+
+    header->count = bits->used_bits;
 
     return bits;
 }
@@ -147,10 +291,37 @@ bit_create(unsigned_t required_bits)
 void
 bit_free(BitArray_t *bits)
 {
-    free(bits->buffer);
+    bit_drop_index(bits);
+
+    if (bits->file)
+    {
+        mpf_header(bits->file)->count = bits->used_bits;
+        mpf_close(bits->file);
+    }
+    else
+        free(bits->buffer);
+
     free(bits);
 }
 
+/// Writes the buffer of a bit array opened with bit_map() to its file and
+/// waits until it is stored, so it survives a crash of the system.
+///
+/// \param[in] bits The target bit array.
+///
+/// \return True if the buffer was written or false if it failed or if the bit
+/// array is not kept in a file.
+bool
+bit_sync(BitArray_t *bits)
+{
+    if (!bits->file)
+        return false;
+
+    mpf_header(bits->file)->count = bits->used_bits;
+
+    return mpf_sync(bits->file);
+}
+
 /// Returns how many words are in the bit array, which is the same as the
 /// array's length.
 ///
@@ -215,28 +386,15 @@ bit_resize(BitArray_t *bits, unsigned_t bit_size)
         // First clear the unused trailing bits
         bit_clear_unused_bits(bits);
 
-        unsigned_t *new_buffer = realloc(bits->buffer,
-                sizeof(unsigned_t) * new_size);
-
-        // Reallocation failed
-        if (!new_buffer)
+        // The new words are set to 0
+        if (!bit_reallocate(bits, new_size))
             return false;
-
-        bits->buffer = new_buffer;
-
-        // Set the new words to 0
-        memset(bits->buffer + bits->size, 0,
-               (new_size - bits->size) * sizeof(unsigned_t));
     }
     // Shrink
     else if (bits->size > words)
     {
         // Reallocate the buffer, possibly truncating values
-        unsigned_t *new_buffer = realloc(bits->buffer,
-                sizeof(unsigned_t) * new_size);
-
-        // Reallocation failed
-        if (!new_buffer)
+        if (!bit_reallocate(bits, new_size))
             return false;
     }
     // if bits->size == words return true
@@ -244,6 +402,8 @@ bit_resize(BitArray_t *bits, unsigned_t bit_size)
     bits->size = new_size;
     bits->used_bits = bit_size;
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -263,7 +423,9 @@ bit_set(BitArray_t *bits, unsigned_t bit_index)
 
     unsigned_t index = bit_buffer_index(bit_index);
 
-    bits->buffer[index] |= ((unsigned_t)1 << bit_index);
+    bits->buffer[index] |= ((unsigned_t)1 << (bit_index % bit_word_size));
+
+    bits->version_id++;
 
     return true;
 }
@@ -289,8 +451,8 @@ bit_set_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
     unsigned_t start_index = bit_buffer_index(from_index);
     unsigned_t end_index = bit_buffer_index(to_index);
 
-    unsigned_t start_mask = ~((unsigned_t)0) << from_index;
-    unsigned_t end_mask = ~((unsigned_t)0) >> -(to_index + 1);
+    unsigned_t start_mask = ~((unsigned_t)0) << (from_index % bit_word_size);
+    unsigned_t end_mask = ~((unsigned_t)0) >> (-(to_index + 1) % bit_word_size);
 
     if (start_index == end_index)
     {
@@ -308,6 +470,8 @@ bit_set_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
         bits->buffer[end_index] |= end_mask;
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -327,7 +491,9 @@ bit_clear(BitArray_t *bits, unsigned_t bit_index)
 
     unsigned_t index = bit_buffer_index(bit_index);
 
-    bits->buffer[index] &= ~((unsigned_t)1 << bit_index);
+    bits->buffer[index] &= ~((unsigned_t)1 << (bit_index % bit_word_size));
+
+    bits->version_id++;
 
     return true;
 }
@@ -353,8 +519,8 @@ bit_clear_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
     unsigned_t start_index = bit_buffer_index(from_index);
     unsigned_t end_index = bit_buffer_index(to_index);
 
-    unsigned_t start_mask = ~((unsigned_t)0) << from_index;
-    unsigned_t end_mask = ~((unsigned_t)0) >> -(to_index + 1);
+    unsigned_t start_mask = ~((unsigned_t)0) << (from_index % bit_word_size);
+    unsigned_t end_mask = ~((unsigned_t)0) >> (-(to_index + 1) % bit_word_size);
 
     if (start_index == end_index)
     {
@@ -372,6 +538,8 @@ bit_clear_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
         bits->buffer[end_index] &= ~end_mask;
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -391,7 +559,9 @@ bit_flip(BitArray_t *bits, unsigned_t bit_index)
 
     unsigned_t index = bit_buffer_index(bit_index);
 
-    bits->buffer[index] ^= ((unsigned_t)1 << bit_index);
+    bits->buffer[index] ^= ((unsigned_t)1 << (bit_index % bit_word_size));
+
+    bits->version_id++;
 
     return true;
 }
@@ -417,8 +587,8 @@ bit_flip_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
     unsigned_t start_index = bit_buffer_index(from_index);
     unsigned_t end_index = bit_buffer_index(to_index);
 
-    unsigned_t start_mask = ~((unsigned_t)0) << from_index;
-    unsigned_t end_mask = ~((unsigned_t)0) >> -(to_index + 1);
+    unsigned_t start_mask = ~((unsigned_t)0) << (from_index % bit_word_size);
+    unsigned_t end_mask = ~((unsigned_t)0) >> (-(to_index + 1) % bit_word_size);
 
     if (start_index == end_index)
     {
@@ -436,6 +606,8 @@ bit_flip_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index)
         bits->buffer[end_index] ^= end_mask;
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -458,13 +630,15 @@ bit_put(BitArray_t *bits, unsigned_t bit_index, bool state)
 
     if (state)
     {
-        bits->buffer[index] |= ((unsigned_t)1 << bit_index);
+        bits->buffer[index] |= ((unsigned_t)1 << (bit_index % bit_word_size));
     }
     else
     {
-        bits->buffer[index] &= ~((unsigned_t)1 << bit_index);
+        bits->buffer[index] &= ~((unsigned_t)1 << (bit_index % bit_word_size));
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -490,8 +664,8 @@ bit_put_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index, bool
     unsigned_t start_index = bit_buffer_index(from_index);
     unsigned_t end_index = bit_buffer_index(to_index);
 
-    unsigned_t start_mask = ~((unsigned_t)0) << from_index;
-    unsigned_t end_mask = ~((unsigned_t)0) >> -(to_index + 1);
+    unsigned_t start_mask = ~((unsigned_t)0) << (from_index % bit_word_size);
+    unsigned_t end_mask = ~((unsigned_t)0) >> (-(to_index + 1) % bit_word_size);
 
     if (state)
     {
@@ -530,6 +704,8 @@ bit_put_range(BitArray_t *bits, unsigned_t from_index, unsigned_t to_index, bool
         }
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -545,6 +721,8 @@ bit_fill(BitArray_t *bits)
         bits->buffer[i] = ~((unsigned_t)0);
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -560,6 +738,8 @@ bit_empty(BitArray_t *bits)
         bits->buffer[i] = (unsigned_t)0;
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -573,7 +753,8 @@ bit_get(BitArray_t *bits, unsigned_t bit_index)
 {
     unsigned_t index = bit_buffer_index(bit_index);
 
-    unsigned_t value = bits->buffer[index] & ((unsigned_t)1 << bit_index);
+    unsigned_t value = bits->buffer[index]
+                       & ((unsigned_t)1 << (bit_index % bit_word_size));
 
     return (value) ? true : false;
 }
@@ -585,12 +766,7 @@ bit_get(BitArray_t *bits, unsigned_t bit_index)
 unsigned_t
 bit_cardinality(BitArray_t *bits)
 {
-    unsigned_t sum = 0;
-
-    for (unsigned_t i = 0; i < bits->size; i++)
-        sum += bit_count(bits->buffer[i]);
-
-    return sum;
+    return bkn_popcount(bits->buffer, bits->size);
 }
 
 /// Returns true if the specified bit array 1 has any bits set to true that are
@@ -605,13 +781,7 @@ bit_intersects(BitArray_t *bits1, BitArray_t *bits2)
 {
     unsigned_t size = bits1->size < bits2->size ? bits1->size : bits2->size;
 
-    for (unsigned_t i = 0; i < size; i++)
-    {
-        if ((bits1->buffer[i] & bits2->buffer[i]) != 0)
-            return true;
-    }
-
-    return false;
+    return bkn_intersects(bits1->buffer, bits2->buffer, size);
 }
 
 ///
@@ -685,35 +855,76 @@ bit_from_array(bool *array, unsigned_t arr_size)
 }
 
 /// Returns the index of the nearest bit that is set to true that occurs on or
-/// after the specified starting index. If no such bit exists, if the bit array
-/// reference is \c NULL, or if a negative index is given as the starting
-/// index, then -1 is returned.
+/// after the specified starting index. Whole words are skipped at once by
+/// bkn_next_word(). If no such bit exists or if the starting index is not
+/// less than the amount of used bits then -1 is returned.
 ///
-/// \param bits
-/// \param bit_index
+/// \param bits The target bit array.
+/// \param bit_index The starting index.
 ///
-/// \return
+/// \return The index of the bit found or -1 cast to unsigned_t.
 unsigned_t
 bit_next_set(BitArray_t *bits, unsigned_t bit_index)
 {
-    /// \todo bit_next_set
-    return -1;
+    if (bit_index >= bits->used_bits)
+        return (unsigned_t)-1;
+
+    unsigned_t index = bit_buffer_index(bit_index);
+
+    // Ignore the bits before bit_index
+    unsigned_t word = bits->buffer[index]
+                      & (~(unsigned_t)0 << (bit_index % bit_word_size));
+
+    if (word == 0)
+    {
+        index = bkn_next_word(bits->buffer, index + 1, bits->size, 0);
+
+        if (index == bits->size)
+            return (unsigned_t)-1;
+
+        word = bits->buffer[index];
+    }
+
+    unsigned_t result = index * bit_word_size + bit_lowest(word);
+
+    return result < bits->used_bits ? result : (unsigned_t)-1;
 }
 
 /// Returns the index of the nearest bit that is set to false that occurs on or
-/// after the specified starting index. If no such bit exists, if the bit array
-/// reference is \c NULL, or if a negative index is given as the starting
-/// index, then -1 is returned.
+/// after the specified starting index. Whole words are skipped at once by
+/// bkn_next_word(). If no such bit exists or if the starting index is not
+/// less than the amount of used bits then -1 is returned.
 ///
-/// \param bits
-/// \param bit_index
+/// \param bits The target bit array.
+/// \param bit_index The starting index.
 ///
-/// \return
+/// \return The index of the bit found or -1 cast to unsigned_t.
 unsigned_t
 bit_next_clear(BitArray_t *bits, unsigned_t bit_index)
 {
-    /// \todo bit_next_clear
-    return -1;
+    if (bit_index >= bits->used_bits)
+        return (unsigned_t)-1;
+
+    unsigned_t index = bit_buffer_index(bit_index);
+
+    // Search for set bits in the inverted words ignoring bits before bit_index
+    unsigned_t word = ~bits->buffer[index]
+                      & (~(unsigned_t)0 << (bit_index % bit_word_size));
+
+    if (word == 0)
+    {
+        index = bkn_next_word(bits->buffer, index + 1, bits->size,
+                              ~(unsigned_t)0);
+
+        if (index == bits->size)
+            return (unsigned_t)-1;
+
+        word = ~bits->buffer[index];
+    }
+
+    unsigned_t result = index * bit_word_size + bit_lowest(word);
+
+    return result < bits->used_bits ? result : (unsigned_t)-1;
 }
 
 /// Returns the index of the nearest bit that is set to true that occurs on or
@@ -748,6 +959,221 @@ bit_prev_clear(BitArray_t *bits, unsigned_t bit_index)
     return -1;
 }
 
+/// Returns how many bits are set among the bits before \c bit_index. If a
+/// directory was built with bit_build_index() this takes constant time,
+/// otherwise every word before \c bit_index is counted.
+///
+/// \param bits The target bit array.
+/// \param bit_index Index of the first bit not counted. Indexes past the
+/// used bits count every set bit.
+///
+/// \return The amount of set bits before \c bit_index.
+unsigned_t
+bit_rank(BitArray_t *bits, unsigned_t bit_index)
+{
+    if (bit_index > bits->used_bits)
+        bit_index = bits->used_bits;
+
+    unsigned_t index = bit_buffer_index(bit_index);
+    unsigned_t offset = bit_index % bit_word_size;
+
+    // Bits of the word bit_index is in that come before it
+    unsigned_t partial = offset == 0 ? 0
+            : bkn_popcount((unsigned_t[]){ bits->buffer[index]
+                    & (~(unsigned_t)0 >> (bit_word_size - offset)) }, 1);
+
+    if (!bit_index_ready(bits))
+        return bkn_popcount(bits->buffer, index) + partial;
+
+    BitRankIndex_t *rank_index = bits->index;
+
+    if (index == bits->size)
+        return rank_index->total;
+
+    return rank_index->supers[index / BIT_SUPERBLOCK_WORDS]
+           + rank_index->blocks[index] + partial;
+}
+
+/// Returns the index of the set bit that has exactly \c rank set bits before
+/// it, so bit_select(bits, 0) is the first set bit. This is the inverse of
+/// bit_rank(). If a directory was built with bit_build_index() the superblock
+/// is found with a short binary search between two samples and the word with
+/// a binary search inside the superblock, otherwise words are counted one by
+/// one.
+///
+/// \param bits The target bit array.
+/// \param rank Amount of set bits before the bit to be found.
+///
+/// \return The index of the bit found or -1 cast to unsigned_t if there are
+/// not enough set bits.
+unsigned_t
+bit_select(BitArray_t *bits, unsigned_t rank)
+{
+    if (!bit_index_ready(bits))
+    {
+        for (unsigned_t i = 0; i < bits->size; i++)
+        {
+            unsigned_t word = bit_word(bits, i);
+            unsigned_t count = bkn_popcount(&word, 1);
+
+            if (rank < count)
+                return i * bit_word_size + bit_select_word(word, rank);
+
+            rank -= count;
+        }
+
+        return (unsigned_t)-1;
+    }
+
+    BitRankIndex_t *rank_index = bits->index;
+
+    if (rank >= rank_index->total)
+        return (unsigned_t)-1;
+
+    // The last superblock starting at or before rank, between two samples
+    unsigned_t sample = rank / BIT_SELECT_SAMPLE;
+
+    unsigned_t low = rank_index->samples[sample];
+    unsigned_t high = rank_index->samples[sample + 1];
+
+    while (low < high)
+    {
+        unsigned_t middle = low + (high - low + 1) / 2;
+
+        if (rank_index->supers[middle] <= rank)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    rank -= rank_index->supers[low];
+
+    // The last word inside the superblock starting at or before rank
+    unsigned_t first = low * BIT_SUPERBLOCK_WORDS;
+    unsigned_t last = first + BIT_SUPERBLOCK_WORDS - 1;
+
+    if (last >= bits->size)
+        last = bits->size - 1;
+
+    while (first < last)
+    {
+        unsigned_t middle = first + (last - first + 1) / 2;
+
+        if (rank_index->blocks[middle] <= rank)
+            first = middle;
+        else
+            last = middle - 1;
+    }
+
+    rank -= rank_index->blocks[first];
+
+    return first * bit_word_size + bit_select_word(bit_word(bits, first),
+                                                   rank);
+}
+
+/// Builds a directory of set bit counts that makes bit_rank() take constant
+/// time and bit_select() nearly constant time, using about 3.5% of the memory
+/// of the bit array. Any modification to the bit array makes the directory
+/// stale and the next bit_rank() or bit_select() rebuilds it, so it is best
+/// used on bit arrays that are queried much more often than modified.
+///
+/// \param bits The target bit array.
+///
+/// \return True if the directory was built or false if there was not enough
+/// memory, in which case bit_rank() and bit_select() still work without it.
+bool
+bit_build_index(BitArray_t *bits)
+{
+    bit_drop_index(bits);
+
+    BitRankIndex_t *rank_index = malloc(sizeof(BitRankIndex_t));
+
+    if (!rank_index)
+        return false;
+
+    unsigned_t supers_count = (bits->size + BIT_SUPERBLOCK_WORDS - 1)
+                              / BIT_SUPERBLOCK_WORDS;
+
+    // Every sample is the superblock of a set bit so there are at most as
+    // many samples as set bits, plus one sentinel
+    unsigned_t samples_count = bits->size * bit_word_size / BIT_SELECT_SAMPLE
+                               + 2;
+
+    rank_index->supers = malloc(sizeof(unsigned_t) * supers_count);
+    rank_index->blocks = malloc(sizeof(uint16_t) * bits->size);
+    rank_index->samples = malloc(sizeof(unsigned_t) * samples_count);
+
+    if (!rank_index->supers || !rank_index->blocks || !rank_index->samples)
+    {
+        free(rank_index->supers);
+        free(rank_index->blocks);
+        free(rank_index->samples);
+        free(rank_index);
+
+        return false;
+    }
+
+    unsigned_t total = 0, samples = 0;
+
+    for (unsigned_t s = 0; s < supers_count; s++)
+    {
+        rank_index->supers[s] = total;
+
+        unsigned_t first = s * BIT_SUPERBLOCK_WORDS;
+        unsigned_t last = first + BIT_SUPERBLOCK_WORDS;
+
+        if (last > bits->size)
+            last = bits->size;
+
+        unsigned_t count = 0;
+
+        for (unsigned_t i = first; i < last; i++)
+        {
+            unsigned_t word = bit_word(bits, i);
+
+            rank_index->blocks[i] = (uint16_t)count;
+            count += bkn_popcount(&word, 1);
+        }
+
+        // Sample every multiple of BIT_SELECT_SAMPLE inside this superblock
+        while (samples * BIT_SELECT_SAMPLE < total + count)
+            rank_index->samples[samples++] = s;
+
+        total += count;
+    }
+
+    // Sentinels so that samples[sample + 1] always exists
+    while (samples < samples_count)
+        rank_index->samples[samples++] = supers_count == 0
+                                         ? 0 : supers_count - 1;
+
+    rank_index->supers_count = supers_count;
+    rank_index->total = total;
+    rank_index->version_id = bits->version_id;
+
+    bits->index = rank_index;
+
+    return true;
+}
+
+/// Frees the directory built by bit_build_index(), if any. bit_rank() and
+/// bit_select() go back to counting words one by one.
+///
+/// \param bits The target bit array.
+void
+bit_drop_index(BitArray_t *bits)
+{
+    if (!bits->index)
+        return;
+
+    free(bits->index->supers);
+    free(bits->index->blocks);
+    free(bits->index->samples);
+    free(bits->index);
+
+    bits->index = NULL;
+}
+
 ///
 /// \param bits
 ///
@@ -792,6 +1218,8 @@ bit_NOT(BitArray_t *bits)
         bits->buffer[i] = ~bits->buffer[i];
     }
 
+    bits->version_id++;
+
     return true;
 }
 
@@ -806,10 +1234,9 @@ bit_AND(BitArray_t *bits1, BitArray_t *bits2)
     if (!bit_equalize(bits1, bits2))
         return false;
 
-    for (unsigned_t i = 0; i < bits1->size; i++)
-    {
-        bits1->buffer[i] &= bits2->buffer[i];
-    }
+    bkn_and(bits1->buffer, bits2->buffer, bits1->size);
+
+    bits1->version_id++;
 
     return true;
 }
@@ -825,10 +1252,9 @@ bit_OR(BitArray_t *bits1, BitArray_t *bits2)
     if (!bit_equalize(bits1, bits2))
         return false;
 
-    for (unsigned_t i = 0; i < bits1->size; i++)
-    {
-        bits1->buffer[i] |= bits2->buffer[i];
-    }
+    bkn_or(bits1->buffer, bits2->buffer, bits1->size);
+
+    bits1->version_id++;
 
     return true;
 }
@@ -844,10 +1270,9 @@ bit_XOR(BitArray_t *bits1, BitArray_t *bits2)
     if (!bit_equalize(bits1, bits2))
         return false;
 
-    for (unsigned_t i = 0; i < bits1->size; i++)
-    {
-        bits1->buffer[i] ^= bits2->buffer[i];
-    }
+    bkn_xor(bits1->buffer, bits2->buffer, bits1->size);
+
+    bits1->version_id++;
 
     return true;
 }
@@ -868,6 +1293,8 @@ bit_NAND(BitArray_t *bits1, BitArray_t *bits2)
         bits1->buffer[i] = ~(bits1->buffer[i] & bits2->buffer[i]);
     }
 
+    bits1->version_id++;
+
     return true;
 }
 
@@ -887,6 +1314,8 @@ bit_NOR(BitArray_t *bits1, BitArray_t *bits2)
         bits1->buffer[i] = ~(bits1->buffer[i] | bits2->buffer[i]);
     }
 
+    bits1->version_id++;
+
     return true;
 }
 
@@ -906,6 +1335,8 @@ bit_NXOR(BitArray_t *bits1, BitArray_t *bits2)
         bits1->buffer[i] = ~(bits1->buffer[i] ^ bits2->buffer[i]);
     }
 
+    bits1->version_id++;
+
     return true;
 }
 
@@ -920,10 +1351,9 @@ bit_DIFF(BitArray_t *bits1, BitArray_t *bits2)
     if (!bit_equalize(bits1, bits2))
         return false;
 
-    for (unsigned_t i = 0; i < bits1->size; i++)
-    {
-        bits1->buffer[i] &= ~(bits2->buffer[i]);
-    }
+    bkn_andnot(bits1->buffer, bits2->buffer, bits1->size);
+
+    bits1->version_id++;
 
     return true;
 }
@@ -972,6 +1402,8 @@ bit_grow(BitArray_t *bits, unsigned_t bit_size)
     if (!bit_clear_unused_bits(bits))
         return false;
 
+    bits->version_id++;
+
     // There is still enough space with the current array
     if (bit_size <= bits->size * bit_word_size)
     {
@@ -986,19 +1418,10 @@ bit_grow(BitArray_t *bits, unsigned_t bit_size)
 
     unsigned_t new_size = bit_buffer_index(new_bit_size - 1) + 1;
 
-    unsigned_t *new_buffer = realloc(bits->buffer,
-            sizeof(unsigned_t) * new_size);
-
-    // Reallocation failed
-    if (!new_buffer)
+    // The new words are set to 0
+    if (!bit_reallocate(bits, new_size))
         return false;
 
-    bits->buffer = new_buffer;
-
-    // Set the new words to 0
-    memset(bits->buffer + bits->size, 0,
-            (new_size - bits->size) * sizeof(unsigned_t));
-
     bits->size = new_size;
     bits->used_bits = new_bit_size;
 
@@ -1046,18 +1469,111 @@ bit_equalize(BitArray_t *bits1, BitArray_t *bits2)
     return true;
 }
 
-// Counts the number of set bits in an unsigned_t using the
-// "bit population count"
+// Moves the buffer to a new aligned one with new_size words, either
+// truncating it or setting the new words to 0. Does not change bits->size.
+static bool
+bit_reallocate(BitArray_t *bits, unsigned_t new_size)
+{
+    // The file zeroes the new words itself
+    if (bits->file)
+    {
+        if (!mpf_resize(bits->file, new_size * sizeof(unsigned_t)))
+            return false;
+
+        bits->buffer = mpf_data(bits->file);
+
+        return true;
+    }
+
+    unsigned_t *new_buffer = bkn_alloc(new_size);
+
+    // Reallocation failed
+    if (!new_buffer)
+        return false;
+
+    unsigned_t words = bits->size < new_size ? bits->size : new_size;
+
+    memcpy(new_buffer, bits->buffer, words * sizeof(unsigned_t));
+
+    free(bits->buffer);
+
+    bits->buffer = new_buffer;
+
+    return true;
+}
+
+// Returns a word of the buffer without the bits past the used ones
+static unsigned_t
+bit_word(BitArray_t *bits, unsigned_t index)
+{
+    unsigned_t word = bits->buffer[index];
+
+    unsigned_t used = bits->used_bits - index * bit_word_size;
+
+    if (used < bit_word_size)
+        word &= ~(unsigned_t)0 >> (bit_word_size - used);
+
+    return word;
+}
+
+// Returns the index of the set bit of a word that has rank set bits before
+// it. The word must have more than rank set bits.
+static unsigned_t
+bit_select_word(unsigned_t word, unsigned_t rank)
+{
+    unsigned_t offset = 0;
+
+    // Skip whole bytes first
+    while (true)
+    {
+        unsigned_t byte = word & 0xFF;
+        unsigned_t count = bkn_popcount(&byte, 1);
+
+        if (rank < count)
+            break;
+
+        rank -= count;
+        word >>= 8;
+        offset += 8;
+    }
+
+    while (rank--)
+        word &= word - 1;
+
+    return offset + bit_lowest(word);
+}
+
+// Returns true if the directory exists and is up to date, rebuilding it if
+// it is stale
+static bool
+bit_index_ready(BitArray_t *bits)
+{
+    if (!bits->index)
+        return false;
+
+    if (bits->index->version_id == bits->version_id)
+        return true;
+
+    return bit_build_index(bits);
+}
+
+// Returns the index of the lowest set bit of a word that is not 0
 static unsigned_t
-bit_count(unsigned_t i)
+bit_lowest(unsigned_t word)
 {
-    i = i - ((i >> 1) & 0x5555555555555555L);
-    i = (i & 0x3333333333333333L) + ((i >> 2) & 0x3333333333333333L);
-    i = (i + (i >> 4)) & 0x0f0f0f0f0f0f0f0fL;
-    i = i + (i >> 8);
-    i = i + (i >> 16);
-    i = i + (i >> 32);
-    return (unsigned_t)i & 0x7f;
+#ifdef __GNUC__
+    return (unsigned_t)__builtin_ctzll(word);
+#else
+    unsigned_t index = 0;
+
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+
+    return index;
+#endif
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,437 @@
+/**
+ * @file BloomFilter.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "BloomFilter.h"
+#include <inttypes.h>
+
+/// Bits in a block of a blocked bloom filter, one cache line of the buffer
+/// allocated by BitArray_s.
+#define BLF_BLOCK_BITS 512
+
+/// Extra bits given to blocked bloom filters. Keeping every element in a
+/// single block makes some blocks fuller than others and raises the false
+/// positive rate for the same amount of bits.
+#define BLF_BLOCKED_OVERHEAD 1.25
+
+/// A bloom filter is a probabilistic set that answers whether an element was
+/// probably inserted or certainly not. Each element sets \c hashes bits in a
+/// BitArray_s and an element is reported as present only if all of its bits
+/// are set. There are no false negatives but there can be false positives,
+/// whose rate depends on the amount of bits per element.
+///
+/// It is useful in front of a slower set, like an AVLTree_s or a
+/// RedBlackTree_s, to skip most of the searches for keys that are not there.
+///
+/// The \c hashes indexes are derived from a single call to the \c hash
+/// function with double hashing, <code> h1 + i * h2 </code>, so the hash
+/// function is only called once per operation.
+///
+/// A blocked bloom filter keeps all the bits of an element inside the same
+/// block of 512 bits, which is a cache line of the buffer. A query then costs
+/// a single cache miss instead of one per hash at the cost of needing a few
+/// more bits for the same false positive rate.
+///
+/// \par Functions
+/// Located in the file BloomFilter.c
+struct BloomFilter_s
+{
+    /// \brief Bits set by the inserted elements.
+    BitArray_t *bits;
+
+    /// \brief Amount of bits in the filter.
+    ///
+    /// A multiple of \c BLF_BLOCK_BITS if the filter is blocked.
+    unsigned_t nbits;
+
+    /// \brief Amount of bits set by each element.
+    integer_t hashes;
+
+    /// \brief Amount of elements inserted.
+    unsigned_t count;
+
+    /// \brief If every element is kept in a single block.
+    bool blocked;
+
+    /// \brief Hash function used for the elements.
+    hash_f hash;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+blf_mix(unsigned_t x);
+
+static unsigned_t
+blf_probe(BloomFilter_t *filter, unsigned_t h1, unsigned_t h2, integer_t i);
+
+static bool
+blf_compatible(BloomFilter_t *filter1, BloomFilter_t *filter2);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a bloom filter with the optimal amount of bits and hashes to keep
+/// the false positive rate below the given one after inserting \c expected
+/// elements.
+///
+/// \param[in] hash A hash function for the elements.
+/// \param[in] expected Amount of elements expected to be inserted.
+/// \param[in] false_positive_rate Target false positive rate, between 0 and 1.
+///
+/// \return A new bloom filter or NULL if allocation failed or the parameters
+/// are invalid.
+BloomFilter_t *
+blf_new(hash_f hash, unsigned_t expected, double false_positive_rate)
+{
+    if (expected == 0)
+        return NULL;
+
+    if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+        return NULL;
+
+    double ln2 = log(2.0);
+    double nbits = ceil(-(double)expected * log(false_positive_rate)
+                        / (ln2 * ln2));
+    double hashes = round(nbits / (double)expected * ln2);
+
+    return blf_create(hash, (unsigned_t)nbits,
+                      hashes < 1.0 ? 1 : (integer_t)hashes, false);
+}
+
+/// Creates a blocked bloom filter for a target false positive rate. Gets
+/// \c BLF_BLOCKED_OVERHEAD times the bits of blf_new with the same amount of
+/// hashes.
+///
+/// \param[in] hash A hash function for the elements.
+/// \param[in] expected Amount of elements expected to be inserted.
+/// \param[in] false_positive_rate Target false positive rate, between 0 and 1.
+///
+/// \return A new bloom filter or NULL if allocation failed or the parameters
+/// are invalid.
+BloomFilter_t *
+blf_new_blocked(hash_f hash, unsigned_t expected, double false_positive_rate)
+{
+    if (expected == 0)
+        return NULL;
+
+    if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+        return NULL;
+
+    double ln2 = log(2.0);
+    double nbits = ceil(-(double)expected * log(false_positive_rate)
+                        / (ln2 * ln2));
+    double hashes = round(nbits / (double)expected * ln2);
+
+    return blf_create(hash, (unsigned_t)(nbits * BLF_BLOCKED_OVERHEAD),
+                      hashes < 1.0 ? 1 : (integer_t)hashes, true);
+}
+
+/// Creates a bloom filter with the given parameters. Blocked filters have
+/// their amount of bits rounded up to a multiple of \c BLF_BLOCK_BITS and can
+/// not have more hashes than bits in a block.
+///
+/// \param[in] hash A hash function for the elements.
+/// \param[in] nbits Amount of bits in the filter.
+/// \param[in] hashes Amount of bits set for each element.
+/// \param[in] blocked If every element is kept in a single block.
+///
+/// \return A new bloom filter or NULL if allocation failed or the parameters
+/// are invalid.
+BloomFilter_t *
+blf_create(hash_f hash, unsigned_t nbits, integer_t hashes, bool blocked)
+{
+    if (!hash || nbits == 0 || hashes < 1)
+        return NULL;
+
+    if (blocked)
+    {
+        if (hashes > BLF_BLOCK_BITS)
+            return NULL;
+
+        nbits = (nbits + BLF_BLOCK_BITS - 1) / BLF_BLOCK_BITS * BLF_BLOCK_BITS;
+    }
+
+    BloomFilter_t *filter = malloc(sizeof(BloomFilter_t));
+
+    if (!filter)
+        return NULL;
+
+    filter->bits = bit_create(nbits);
+
+    if (!filter->bits)
+    {
+        free(filter);
+        return NULL;
+    }
+
+    filter->nbits = nbits;
+    filter->hashes = hashes;
+    filter->count = 0;
+    filter->blocked = blocked;
+    filter->hash = hash;
+
+    return filter;
+}
+
+/// Frees from memory a BloomFilter_s. The elements are not kept by the bloom
+/// filter so there is nothing else to free.
+///
+/// \param[in] filter The bloom filter to be freed from memory.
+void
+blf_free(BloomFilter_t *filter)
+{
+    bit_free(filter->bits);
+
+    free(filter);
+}
+
+/// \param[in] filter The bloom filter.
+///
+/// \return The amount of bits in the bloom filter.
+unsigned_t
+blf_nbits(BloomFilter_t *filter)
+{
+    return filter->nbits;
+}
+
+/// \param[in] filter The bloom filter.
+///
+/// \return The amount of bits set by each element.
+integer_t
+blf_hashes(BloomFilter_t *filter)
+{
+    return filter->hashes;
+}
+
+/// Returns the amount of times blf_insert was called. After a blf_union it
+/// is the sum of both counts, which might include repeated elements.
+///
+/// \param[in] filter The bloom filter.
+///
+/// \return The amount of elements inserted.
+unsigned_t
+blf_count(BloomFilter_t *filter)
+{
+    return filter->count;
+}
+
+/// \param[in] filter The bloom filter.
+///
+/// \return True if the bloom filter is blocked.
+bool
+blf_blocked(BloomFilter_t *filter)
+{
+    return filter->blocked;
+}
+
+/// Estimates the false positive rate as the probability of all the bits of
+/// an element being set, <code> (set_bits / nbits) ^ hashes </code>. For
+/// blocked filters this is a lower bound since some blocks are fuller than
+/// the average.
+///
+/// \param[in] filter The bloom filter.
+///
+/// \return The estimated false positive rate.
+double
+blf_false_positive_rate(BloomFilter_t *filter)
+{
+    double fill = (double)bit_cardinality(filter->bits)
+                  / (double)filter->nbits;
+
+    return pow(fill, (double)filter->hashes);
+}
+
+/// Sets all the bits of an element.
+///
+/// \param[in] filter The bloom filter.
+/// \param[in] element The element to be inserted.
+///
+/// \return True if the element was inserted.
+bool
+blf_insert(BloomFilter_t *filter, void *element)
+{
+    unsigned_t h1 = blf_mix(filter->hash(element));
+    unsigned_t h2 = blf_mix(h1);
+
+    for (integer_t i = 0; i < filter->hashes; i++)
+    {
+        if (!bit_set(filter->bits, blf_probe(filter, h1, h2, i)))
+            return false;
+    }
+
+    filter->count++;
+
+    return true;
+}
+
+/// Checks if all the bits of an element are set, stopping at the first clear
+/// one.
+///
+/// \param[in] filter The bloom filter.
+/// \param[in] element The element to be searched.
+///
+/// \return False if the element was never inserted, true if it probably was.
+bool
+blf_contains(BloomFilter_t *filter, void *element)
+{
+    unsigned_t h1 = blf_mix(filter->hash(element));
+    unsigned_t h2 = blf_mix(h1);
+
+    for (integer_t i = 0; i < filter->hashes; i++)
+    {
+        if (!bit_get(filter->bits, blf_probe(filter, h1, h2, i)))
+            return false;
+    }
+
+    return true;
+}
+
+/// Clears all bits so the bloom filter can be reused.
+///
+/// \param[in] filter The bloom filter.
+///
+/// \return True if the bloom filter was emptied.
+bool
+blf_empty(BloomFilter_t *filter)
+{
+    if (!bit_empty(filter->bits))
+        return false;
+
+    filter->count = 0;
+
+    return true;
+}
+
+/// \param[in] filter The bloom filter to be copied.
+///
+/// \return A copy of the bloom filter or NULL if allocation failed.
+BloomFilter_t *
+blf_copy(BloomFilter_t *filter)
+{
+    BloomFilter_t *result = malloc(sizeof(BloomFilter_t));
+
+    if (!result)
+        return NULL;
+
+    result->bits = bit_copy(filter->bits);
+
+    if (!result->bits)
+    {
+        free(result);
+        return NULL;
+    }
+
+    result->nbits = filter->nbits;
+    result->hashes = filter->hashes;
+    result->count = filter->count;
+    result->blocked = filter->blocked;
+    result->hash = filter->hash;
+
+    return result;
+}
+
+/// Makes \c filter1 contain every element of both bloom filters. This is
+/// exactly the filter that would be built by inserting both sets of elements.
+/// Both filters must have the same parameters and hash function.
+///
+/// \param[in] filter1 The bloom filter that receives the union.
+/// \param[in] filter2 The other bloom filter.
+///
+/// \return True if the operation was successful.
+bool
+blf_union(BloomFilter_t *filter1, BloomFilter_t *filter2)
+{
+    if (!blf_compatible(filter1, filter2))
+        return false;
+
+    if (!bit_OR(filter1->bits, filter2->bits))
+        return false;
+
+    filter1->count += filter2->count;
+
+    return true;
+}
+
+/// Makes \c filter1 contain the elements present in both bloom filters. The
+/// result has no false negatives for the intersection of both sets but might
+/// have more false positives than a filter built from it. Both filters must
+/// have the same parameters and hash function.
+///
+/// \param[in] filter1 The bloom filter that receives the intersection.
+/// \param[in] filter2 The other bloom filter.
+///
+/// \return True if the operation was successful.
+bool
+blf_intersection(BloomFilter_t *filter1, BloomFilter_t *filter2)
+{
+    if (!blf_compatible(filter1, filter2))
+        return false;
+
+    if (!bit_AND(filter1->bits, filter2->bits))
+        return false;
+
+    if (filter2->count < filter1->count)
+        filter1->count = filter2->count;
+
+    return true;
+}
+
+/// \param[in] filter The bloom filter to be displayed.
+void
+blf_display(BloomFilter_t *filter)
+{
+    printf("\nBloomFilter\n");
+    printf("  bits      : %" PRIuMAX "\n", filter->nbits);
+    printf("  hashes    : %" DS_PRI_INTEGER "\n", filter->hashes);
+    printf("  count     : %" PRIuMAX "\n", filter->count);
+    printf("  blocked   : %s\n", filter->blocked ? "true" : "false");
+    printf("  estimated : %lf\n", blf_false_positive_rate(filter));
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Finalizer of splitmix64. Spreads every input bit over the whole word since
+// some hash functions, like hash_float, return the element almost unchanged.
+static unsigned_t
+blf_mix(unsigned_t x)
+{
+    uint64_t z = (uint64_t)x + UINT64_C(0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+// Returns the index of the i-th bit of an element. Blocked filters choose the
+// block with h1 and the bits in it with h2; an odd step makes every bit of the
+// element land in a different position of the block.
+static unsigned_t
+blf_probe(BloomFilter_t *filter, unsigned_t h1, unsigned_t h2, integer_t i)
+{
+    if (filter->blocked)
+    {
+        unsigned_t block = h1 % (filter->nbits / BLF_BLOCK_BITS);
+        unsigned_t step = (h2 >> 32) | 1;
+
+        return block * BLF_BLOCK_BITS
+               + ((h2 + (unsigned_t)i * step) & (BLF_BLOCK_BITS - 1));
+    }
+
+    return (h1 + (unsigned_t)i * (h2 | 1)) % filter->nbits;
+}
+
+static bool
+blf_compatible(BloomFilter_t *filter1, BloomFilter_t *filter2)
+{
+    return filter1->nbits == filter2->nbits
+           && filter1->hashes == filter2->hashes
+           && filter1->blocked == filter2->blocked
+           && filter1->hash == filter2->hash;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
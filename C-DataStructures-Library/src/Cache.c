@@ -0,0 +1,720 @@
+/**
+ * @file Cache.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Cache.h"
+#include "HashMap.h"
+#include "IntrusiveList.h"
+
+/// A Cache_s maps unique keys to values and holds at most \c capacity worth
+/// of entries. Every entry is found through a HashMap_s and is also linked in
+/// an IntrusiveList_s that keeps the order in which entries are evicted, so
+/// get, put and evict all run in constant time.
+///
+/// With \c CACHE_LRU there is a single list ordered by recency. With
+/// \c CACHE_LFU entries are grouped by how many times they were used: there
+/// is one list of entries per frequency and the frequencies themselves are
+/// kept in an ascending list. Using an entry moves it to the next frequency,
+/// which is either the one right after its current frequency or a new one.
+///
+/// \par Functions
+/// Located in the file Cache.c
+struct Cache_s
+{
+    /// \brief Maps each key to its CacheEntry_s.
+    struct HashMap_s *map;
+
+    /// \brief Key interface used by the map.
+    ///
+    /// A copy of the key interface that doesn't free keys, since keys are
+    /// owned by the entries.
+    struct Interface_s map_interface;
+
+    /// \brief Cache_s key interface.
+    struct Interface_s *K_interface;
+
+    /// \brief Cache_s value interface.
+    struct Interface_s *V_interface;
+
+    /// \brief Eviction policy.
+    enum CachePolicy_e policy;
+
+    /// \brief Maximum total weight of the entries.
+    integer_t capacity;
+
+    /// \brief Current total weight of the entries.
+    integer_t weight;
+
+    /// \brief Weight of a key-value pair or NULL if every pair weighs 1.
+    weigh_f weigh;
+
+    /// \brief Receives the values of evicted entries.
+    ///
+    /// If NULL, evicted values are freed with the value interface.
+    free_f on_evict;
+
+    /// \brief Entries ordered from most to least recently used.
+    ///
+    /// Only used by \c CACHE_LRU.
+    struct IntrusiveList_s entries;
+
+    /// \brief CacheFrequency_s nodes in ascending order of frequency.
+    ///
+    /// Only used by \c CACHE_LFU.
+    struct IntrusiveList_s frequencies;
+
+    /// \brief How many times cch_get() found its key.
+    integer_t hits;
+
+    /// \brief How many times cch_get() did not find its key.
+    integer_t misses;
+
+    /// \brief How many entries were evicted to make room for others.
+    integer_t evictions;
+};
+
+/// \brief A key-value pair of a Cache_s.
+struct CacheEntry_s
+{
+    /// \brief This entry's key.
+    void *key;
+
+    /// \brief This entry's value.
+    void *value;
+
+    /// \brief Weight counted against the cache's capacity.
+    integer_t weight;
+
+    /// \brief Frequency this entry belongs to with \c CACHE_LFU.
+    struct CacheFrequency_s *frequency;
+
+    /// \brief Link in the recency list or in its frequency's list.
+    struct ListHook_s hook;
+};
+
+/// \brief A type for a cache entry.
+typedef struct CacheEntry_s CacheEntry_t;
+
+/// \brief Entries of a Cache_s that were used the same amount of times.
+struct CacheFrequency_s
+{
+    /// \brief How many times the entries were used.
+    integer_t frequency;
+
+    /// \brief Entries ordered from most to least recently used.
+    struct IntrusiveList_s entries;
+
+    /// \brief Link in the cache's list of frequencies.
+    struct ListHook_s hook;
+};
+
+/// \brief A type for a cache frequency.
+typedef struct CacheFrequency_s CacheFrequency_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+cch_keep(void *element);
+
+static integer_t
+cch_weigh(Cache_t *cache, void *key, void *value);
+
+static CacheFrequency_t *
+cch_new_frequency(integer_t frequency);
+
+static bool
+cch_link(Cache_t *cache, CacheEntry_t *entry);
+
+static void
+cch_unlink(Cache_t *cache, CacheEntry_t *entry);
+
+static void
+cch_touch(Cache_t *cache, CacheEntry_t *entry);
+
+static CacheEntry_t *
+cch_victim(Cache_t *cache, CacheEntry_t *exclude);
+
+static void
+cch_evict(Cache_t *cache, integer_t weight, CacheEntry_t *exclude);
+
+static void
+cch_drop(Cache_t *cache, CacheEntry_t *entry, bool evicted);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new Cache_s that holds at most \c capacity entries.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] policy Which entry is evicted when the cache is full.
+/// \param[in] capacity Maximum amount of entries.
+///
+/// \return A new Cache_s or NULL if allocation failed or if \c capacity is
+/// not positive.
+Cache_t *
+cch_new(Interface_t *key_interface, Interface_t *value_interface,
+        CachePolicy policy, integer_t capacity)
+{
+    return cch_create(key_interface, value_interface, policy, capacity, NULL);
+}
+
+/// Initializes a new Cache_s where the total weight of the entries, given by
+/// \c weigh, is at most \c capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] policy Which entry is evicted when the cache is full.
+/// \param[in] capacity Maximum total weight.
+/// \param[in] weigh Weight of a key-value pair. If NULL every pair weighs 1.
+///
+/// \return A new Cache_s or NULL if allocation failed or if \c capacity is
+/// not positive.
+Cache_t *
+cch_create(Interface_t *key_interface, Interface_t *value_interface,
+           CachePolicy policy, integer_t capacity, weigh_f weigh)
+{
+    if (capacity <= 0)
+        return NULL;
+
+    Cache_t *cache = malloc(sizeof(Cache_t));
+
+    if (!cache)
+        return NULL;
+
+    cache->map_interface = *key_interface;
+    cache->map_interface.free = cch_keep;
+    cache->map_interface.allocator = NULL;
+
+    cache->map = hmp_new(&cache->map_interface, &cache->map_interface);
+
+    if (!cache->map)
+    {
+        free(cache);
+        return NULL;
+    }
+
+    cache->K_interface = key_interface;
+    cache->V_interface = value_interface;
+
+    cache->policy = policy;
+    cache->capacity = capacity;
+    cache->weight = 0;
+    cache->weigh = weigh;
+    cache->on_evict = NULL;
+
+    ilt_init(&cache->entries, offsetof(CacheEntry_t, hook));
+    ilt_init(&cache->frequencies, offsetof(CacheFrequency_t, hook));
+
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+
+    return cache;
+}
+
+/// Frees from memory a Cache_s and all of its keys and values using the free
+/// functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] cache The cache to be freed from memory.
+void
+cch_free(Cache_t *cache)
+{
+    cch_erase(cache);
+
+    hmp_free_shallow(cache->map);
+
+    free(cache);
+}
+
+/// Frees from memory all keys and values of a Cache_s using the free
+/// functions of both interfaces. The statistics are kept.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] cache The cache to be erased.
+void
+cch_erase(Cache_t *cache)
+{
+    CacheEntry_t *entry;
+    CacheFrequency_t *frequency;
+
+    while ((entry = ilt_remove_head(&cache->entries)) != NULL)
+        cch_drop(cache, entry, false);
+
+    while ((frequency = ilt_remove_head(&cache->frequencies)) != NULL)
+    {
+        while ((entry = ilt_remove_head(&frequency->entries)) != NULL)
+            cch_drop(cache, entry, false);
+
+        free(frequency);
+    }
+}
+
+/// Sets a function that receives the value of every entry evicted to make
+/// room for another one, instead of the value interface's free function. The
+/// function is responsible for the value from then on. Entries removed with
+/// cch_remove(), replaced by cch_put() or freed with the cache are not
+/// passed to it.
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] function A function that takes an evicted value or NULL.
+void
+cch_on_evict(Cache_t *cache, free_f function)
+{
+    cache->on_evict = function;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return The amount of entries in the cache.
+integer_t
+cch_count(Cache_t *cache)
+{
+    return hmp_count(cache->map);
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return The total weight of the entries, which equals cch_count() if the
+/// cache has no weigh function.
+integer_t
+cch_weight(Cache_t *cache)
+{
+    return cache->weight;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return The maximum total weight of the entries.
+integer_t
+cch_capacity(Cache_t *cache)
+{
+    return cache->capacity;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return How many times cch_get() found its key.
+integer_t
+cch_hits(Cache_t *cache)
+{
+    return cache->hits;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return How many times cch_get() did not find its key.
+integer_t
+cch_misses(Cache_t *cache)
+{
+    return cache->misses;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return How many entries were evicted to make room for others.
+integer_t
+cch_evictions(Cache_t *cache)
+{
+    return cache->evictions;
+}
+
+/// Returns the value associated with a key and marks its entry as used,
+/// which makes it the last one to be evicted with \c CACHE_LRU or raises
+/// its frequency with \c CACHE_LFU. Counts as a hit or a miss.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to \c key or NULL if the key is not present.
+void *
+cch_get(Cache_t *cache, void *key)
+{
+    CacheEntry_t *entry = hmp_get(cache->map, key);
+
+    if (!entry)
+    {
+        cache->misses++;
+        return NULL;
+    }
+
+    cache->hits++;
+
+    cch_touch(cache, entry);
+
+    return entry->value;
+}
+
+/// Returns the value associated with a key without changing the eviction
+/// order or the statistics.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to \c key or NULL if the key is not present.
+void *
+cch_peek(Cache_t *cache, void *key)
+{
+    CacheEntry_t *entry = hmp_get(cache->map, key);
+
+    return entry ? entry->value : NULL;
+}
+
+/// Inserts a key mapped to a value, evicting entries until the new one
+/// fits. The cache becomes responsible for the key and the value. If the key
+/// is already present its old value is freed with the value interface, the
+/// new key is freed with the key interface and the entry is marked as used.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted or replaced.
+/// \return False if the pair weighs more than the capacity or if any
+/// allocations failed, in which case the cache does not take the pair.
+bool
+cch_put(Cache_t *cache, void *key, void *value)
+{
+    integer_t weight = cch_weigh(cache, key, value);
+
+    if (weight > cache->capacity)
+        return false;
+
+    CacheEntry_t *entry = hmp_get(cache->map, key);
+
+    if (entry)
+    {
+        if (entry->key != key)
+            interface_release(cache->K_interface, key);
+
+        if (entry->value != value)
+            interface_release(cache->V_interface, entry->value);
+
+        cache->weight += weight - entry->weight;
+
+        entry->value = value;
+        entry->weight = weight;
+
+        cch_touch(cache, entry);
+        cch_evict(cache, 0, entry);
+
+        return true;
+    }
+
+    entry = malloc(sizeof(CacheEntry_t));
+
+    if (!entry)
+        return false;
+
+    entry->key = key;
+    entry->value = value;
+    entry->weight = weight;
+    entry->frequency = NULL;
+
+    if (!hmp_insert(cache->map, key, entry))
+    {
+        free(entry);
+        return false;
+    }
+
+    if (!cch_link(cache, entry))
+    {
+        void *removed;
+
+        hmp_remove(cache->map, key, &removed);
+
+        free(entry);
+        return false;
+    }
+
+    cch_evict(cache, weight, entry);
+
+    cache->weight += weight;
+
+    return true;
+}
+
+/// Removes a key from the cache and frees both the key and its value using
+/// the free functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] key The key to be removed.
+///
+/// \return True if the key was found and removed, otherwise false.
+bool
+cch_remove(Cache_t *cache, void *key)
+{
+    CacheEntry_t *entry = hmp_get(cache->map, key);
+
+    if (!entry)
+        return false;
+
+    cch_unlink(cache, entry);
+    cch_drop(cache, entry, false);
+
+    return true;
+}
+
+/// \param[in] cache Cache_s reference.
+///
+/// \return True if the cache has no entries.
+bool
+cch_empty(Cache_t *cache)
+{
+    return hmp_empty(cache->map);
+}
+
+/// Checks if a key is present without changing the eviction order or the
+/// statistics.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] cache Cache_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is present, otherwise false.
+bool
+cch_contains(Cache_t *cache, void *key)
+{
+    return hmp_contains_key(cache->map, key);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Keys in the map are owned by the entries
+static void
+cch_keep(void *element)
+{
+    (void)element;
+}
+
+static integer_t
+cch_weigh(Cache_t *cache, void *key, void *value)
+{
+    return cache->weigh ? cache->weigh(key, value) : 1;
+}
+
+static CacheFrequency_t *
+cch_new_frequency(integer_t frequency)
+{
+    CacheFrequency_t *node = malloc(sizeof(CacheFrequency_t));
+
+    if (!node)
+        return NULL;
+
+    node->frequency = frequency;
+
+    ilt_init(&node->entries, offsetof(CacheEntry_t, hook));
+
+    return node;
+}
+
+// Links a new entry as the most recently used one or in the frequency 1
+static bool
+cch_link(Cache_t *cache, CacheEntry_t *entry)
+{
+    if (cache->policy == CACHE_LRU)
+    {
+        ilt_insert_head(&cache->entries, entry);
+
+        return true;
+    }
+
+    CacheFrequency_t *first = ilt_head(&cache->frequencies);
+
+    if (!first || first->frequency != 1)
+    {
+        first = cch_new_frequency(1);
+
+        if (!first)
+            return false;
+
+        ilt_insert_head(&cache->frequencies, first);
+    }
+
+    ilt_insert_head(&first->entries, entry);
+
+    entry->frequency = first;
+
+    return true;
+}
+
+// Unlinks an entry from the eviction order, dropping its frequency if it
+// becomes empty
+static void
+cch_unlink(Cache_t *cache, CacheEntry_t *entry)
+{
+    if (cache->policy == CACHE_LRU)
+    {
+        ilt_remove(&cache->entries, entry);
+
+        return;
+    }
+
+    CacheFrequency_t *frequency = entry->frequency;
+
+    ilt_remove(&frequency->entries, entry);
+
+    if (ilt_empty(&frequency->entries))
+    {
+        ilt_remove(&cache->frequencies, frequency);
+
+        free(frequency);
+    }
+
+    entry->frequency = NULL;
+}
+
+// Marks an entry as used
+static void
+cch_touch(Cache_t *cache, CacheEntry_t *entry)
+{
+    if (cache->policy == CACHE_LRU)
+    {
+        ilt_move_head(&cache->entries, entry);
+
+        return;
+    }
+
+    CacheFrequency_t *current = entry->frequency;
+    CacheFrequency_t *next = ilt_next(&cache->frequencies, current);
+
+    if (!next || next->frequency != current->frequency + 1)
+    {
+        // An entry alone in its frequency can just be promoted in place
+        if (ilt_count(&current->entries) == 1)
+        {
+            current->frequency++;
+
+            return;
+        }
+
+        next = cch_new_frequency(current->frequency + 1);
+
+        // Without memory the entry stays where it is
+        if (!next)
+        {
+            ilt_move_head(&current->entries, entry);
+
+            return;
+        }
+
+        ilt_insert_after(&cache->frequencies, current, next);
+    }
+
+    cch_unlink(cache, entry);
+
+    ilt_insert_head(&next->entries, entry);
+
+    entry->frequency = next;
+}
+
+// The entry that would be evicted next, other than exclude
+static CacheEntry_t *
+cch_victim(Cache_t *cache, CacheEntry_t *exclude)
+{
+    CacheEntry_t *victim;
+
+    if (cache->policy == CACHE_LRU)
+    {
+        victim = ilt_tail(&cache->entries);
+
+        if (victim == exclude)
+            victim = ilt_prev(&cache->entries, victim);
+
+        return victim;
+    }
+
+    for (CacheFrequency_t *frequency = ilt_head(&cache->frequencies);
+         frequency != NULL;
+         frequency = ilt_next(&cache->frequencies, frequency))
+    {
+        victim = ilt_tail(&frequency->entries);
+
+        if (victim == exclude)
+            victim = ilt_prev(&frequency->entries, victim);
+
+        if (victim)
+            return victim;
+    }
+
+    return NULL;
+}
+
+// Evicts entries until weight more fits in the cache
+static void
+cch_evict(Cache_t *cache, integer_t weight, CacheEntry_t *exclude)
+{
+    while (cache->weight + weight > cache->capacity)
+    {
+        CacheEntry_t *victim = cch_victim(cache, exclude);
+
+        if (!victim)
+            return;
+
+        cch_unlink(cache, victim);
+        cch_drop(cache, victim, true);
+
+        cache->evictions++;
+    }
+}
+
+// Removes an unlinked entry from the map and frees it with its key and value
+static void
+cch_drop(Cache_t *cache, CacheEntry_t *entry, bool evicted)
+{
+    void *removed;
+
+    hmp_remove(cache->map, entry->key, &removed);
+
+    cache->weight -= entry->weight;
+
+    interface_release(cache->K_interface, entry->key);
+
+    if (evicted && cache->on_evict)
+        cache->on_evict(entry->value);
+    else
+        interface_release(cache->V_interface, entry->value);
+
+    free(entry);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,531 @@
+/**
+ * @file Channel.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+// pthread_condattr_setclock and clock_gettime are not part of strict C11
+#define _POSIX_C_SOURCE 200809L
+
+#include "Channel.h"
+#include "QueueArray.h"
+#include <errno.h>
+#include <pthread.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+/// A Channel_s connects producer threads to consumer threads through a
+/// QueueArray_s with a locked capacity. Unlike QueueMPMC_s, whose operations
+/// fail right away, a thread that cannot send or receive sleeps on a
+/// condition variable until it can, until its timeout expires or until the
+/// channel is closed. Timeouts are in milliseconds; a negative timeout waits
+/// forever and zero does not wait at all.
+///
+/// Wakeups are coalesced: a thread is only signaled if it is waiting, and
+/// adding or removing n elements wakes at most n waiting threads, so a burst
+/// doesn't wake every one of them only for most to go back to sleep. Batches
+/// sent with chn_send_n() and received with chn_receive_n() take the lock
+/// once for as many elements as fit.
+///
+/// Closing a channel makes every send fail, while receivers still get the
+/// elements left in it. Once it is empty they get CHN_CLOSED, which is how
+/// consumers know that no more work is coming.
+///
+/// On Linux the channel also has an eventfd that is readable while there are
+/// elements to be received or the channel is closed, so it can be added to an
+/// epoll or poll loop. The eventfd is only written when it goes from not
+/// readable to readable, so a burst costs a single system call.
+///
+/// \par Functions
+/// Located in the file Channel.c
+struct Channel_s
+{
+    /// \brief Elements waiting to be received.
+    QueueArray_t *queue;
+
+    /// \brief Maximum amount of elements in \c queue.
+    integer_t capacity;
+
+    /// \brief If the channel was closed.
+    bool closed;
+
+    /// \brief Channel lock.
+    ///
+    /// Protects every other field.
+    pthread_mutex_t lock;
+
+    /// \brief Signaled when elements are added or the channel is closed.
+    pthread_cond_t readable;
+
+    /// \brief Signaled when elements are removed or the channel is closed.
+    pthread_cond_t writable;
+
+    /// \brief Amount of threads waiting on \c readable.
+    integer_t receivers;
+
+    /// \brief Amount of threads waiting on \c writable.
+    integer_t senders;
+
+    /// \brief An eventfd or -1 if there is none.
+    int fd;
+
+    /// \brief If the eventfd is currently readable.
+    bool signaled;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+chn_put(Channel_t *channel, void **elements, integer_t size,
+        integer_t timeout, ChannelResult *status);
+
+static integer_t
+chn_take(Channel_t *channel, void **result, integer_t max,
+         integer_t timeout, ChannelResult *status);
+
+static void
+chn_deadline(integer_t timeout, struct timespec *deadline);
+
+static bool
+chn_wait(Channel_t *channel, pthread_cond_t *condition, integer_t *waiters,
+         integer_t timeout, const struct timespec *deadline);
+
+static void
+chn_wake(pthread_cond_t *condition, integer_t waiters, integer_t amount);
+
+static void
+chn_update_fd(Channel_t *channel);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new Channel_s. Its buffer is allocated here and never grows.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] interface An interface used to free the elements left in the
+/// channel when it is freed.
+/// \param[in] capacity Maximum amount of elements waiting to be received.
+///
+/// \return A new Channel_s or NULL if allocation failed or the capacity is
+/// not positive.
+Channel_t *
+chn_new(Interface_t *interface, integer_t capacity)
+{
+    if (capacity < 1)
+        return NULL;
+
+    Channel_t *channel = malloc(sizeof(Channel_t));
+
+    if (!channel)
+        return NULL;
+
+    channel->queue = qar_create(interface, capacity, 200);
+
+    if (!channel->queue)
+    {
+        free(channel);
+        return NULL;
+    }
+
+    qar_capacity_lock(channel->queue);
+
+    // Timeouts are measured with a clock that is not changed by the user
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+
+    pthread_mutex_init(&channel->lock, NULL);
+    pthread_cond_init(&channel->readable, &attributes);
+    pthread_cond_init(&channel->writable, &attributes);
+
+    pthread_condattr_destroy(&attributes);
+
+    channel->capacity = capacity;
+    channel->closed = false;
+    channel->receivers = 0;
+    channel->senders = 0;
+    channel->signaled = false;
+
+#ifdef __linux__
+    channel->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+    channel->fd = -1;
+#endif
+
+    return channel;
+}
+
+/// Frees from memory a Channel_s and every element that was not received. No
+/// thread can be waiting on the channel.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] channel The channel to be freed from memory.
+void
+chn_free(Channel_t *channel)
+{
+#ifdef __linux__
+    if (channel->fd >= 0)
+        close(channel->fd);
+#endif
+
+    pthread_cond_destroy(&channel->readable);
+    pthread_cond_destroy(&channel->writable);
+    pthread_mutex_destroy(&channel->lock);
+
+    qar_free(channel->queue);
+
+    free(channel);
+}
+
+/// \param[in] channel The channel.
+///
+/// \return The maximum amount of elements waiting to be received.
+integer_t
+chn_capacity(Channel_t *channel)
+{
+    return channel->capacity;
+}
+
+/// \param[in] channel The channel.
+///
+/// \return The amount of elements waiting to be received.
+integer_t
+chn_count(Channel_t *channel)
+{
+    pthread_mutex_lock(&channel->lock);
+
+    integer_t count = qar_count(channel->queue);
+
+    pthread_mutex_unlock(&channel->lock);
+
+    return count;
+}
+
+/// \param[in] channel The channel.
+///
+/// \return True if chn_close() was called.
+bool
+chn_closed(Channel_t *channel)
+{
+    pthread_mutex_lock(&channel->lock);
+
+    bool closed = channel->closed;
+
+    pthread_mutex_unlock(&channel->lock);
+
+    return closed;
+}
+
+/// Returns an eventfd that is readable while there are elements to be
+/// received or the channel is closed. It is meant to be watched by an event
+/// loop, which then calls chn_receive() or chn_receive_n() with a timeout of
+/// zero; the channel drains it by itself. The descriptor belongs to the
+/// channel and is closed by chn_free().
+///
+/// \param[in] channel The channel.
+///
+/// \return The eventfd or -1 if the platform doesn't have them.
+int
+chn_fd(Channel_t *channel)
+{
+    return channel->fd;
+}
+
+/// Sends an element, waiting while the channel is full. If the element is not
+/// sent the caller still owns it.
+///
+/// \param[in] channel The channel.
+/// \param[in] element The element to be sent.
+/// \param[in] timeout Maximum time to wait in milliseconds, negative to wait
+/// forever.
+///
+/// \return CHN_OK if the element was sent, CHN_TIMEOUT if the channel was
+/// still full after the timeout or CHN_CLOSED if the channel was closed.
+ChannelResult
+chn_send(Channel_t *channel, void *element, integer_t timeout)
+{
+    ChannelResult status;
+
+    chn_put(channel, &element, 1, timeout, &status);
+
+    return status;
+}
+
+/// Receives the oldest element, waiting while the channel is empty.
+///
+/// \param[in] channel The channel.
+/// \param[out] result The element received or NULL.
+/// \param[in] timeout Maximum time to wait in milliseconds, negative to wait
+/// forever.
+///
+/// \return CHN_OK if an element was received, CHN_TIMEOUT if the channel was
+/// still empty after the timeout or CHN_CLOSED if the channel was closed and
+/// there are no elements left.
+ChannelResult
+chn_receive(Channel_t *channel, void **result, integer_t timeout)
+{
+    ChannelResult status;
+
+    *result = NULL;
+
+    chn_take(channel, result, 1, timeout, &status);
+
+    return status;
+}
+
+/// Sends a buffer of elements in order. As many as fit are added at once and
+/// the rest wait for room until the timeout, which is for the whole buffer,
+/// expires.
+///
+/// \param[in] channel The channel.
+/// \param[in] elements The elements to be sent.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] timeout Maximum time to wait in milliseconds, negative to wait
+/// forever.
+///
+/// \return The amount of elements sent from the start of the buffer. The
+/// caller still owns the others.
+integer_t
+chn_send_n(Channel_t *channel, void **elements, integer_t size,
+           integer_t timeout)
+{
+    ChannelResult status;
+
+    return chn_put(channel, elements, size, timeout, &status);
+}
+
+/// Receives up to a given amount of elements. It only waits while the
+/// channel is empty and then takes every element available up to \c max.
+///
+/// \param[in] channel The channel.
+/// \param[out] result A buffer with room for at least \c max elements.
+/// \param[in] max The maximum amount of elements to be received.
+/// \param[in] timeout Maximum time to wait in milliseconds, negative to wait
+/// forever.
+///
+/// \return The amount of elements received. Zero means that either the
+/// timeout expired or the channel is closed and empty (see chn_closed()).
+integer_t
+chn_receive_n(Channel_t *channel, void **result, integer_t max,
+              integer_t timeout)
+{
+    ChannelResult status;
+
+    return chn_take(channel, result, max, timeout, &status);
+}
+
+/// Closes the channel. Every waiting thread is woken up, sends fail from now
+/// on and receives fail once the elements left are received. Closing a
+/// closed channel does nothing.
+///
+/// \param[in] channel The channel to be closed.
+void
+chn_close(Channel_t *channel)
+{
+    pthread_mutex_lock(&channel->lock);
+
+    if (!channel->closed)
+    {
+        channel->closed = true;
+
+        pthread_cond_broadcast(&channel->readable);
+        pthread_cond_broadcast(&channel->writable);
+
+        chn_update_fd(channel);
+    }
+
+    pthread_mutex_unlock(&channel->lock);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Adds elements while there is room, waiting for more room until all of them
+// were added
+static integer_t
+chn_put(Channel_t *channel, void **elements, integer_t size,
+        integer_t timeout, ChannelResult *status)
+{
+    struct timespec deadline;
+
+    chn_deadline(timeout, &deadline);
+
+    integer_t sent = 0;
+
+    *status = CHN_OK;
+
+    pthread_mutex_lock(&channel->lock);
+
+    while (sent < size)
+    {
+        while (!channel->closed && qar_full(channel->queue))
+        {
+            if (!chn_wait(channel, &channel->writable, &channel->senders,
+                          timeout, &deadline))
+                break;
+        }
+
+        if (channel->closed)
+        {
+            *status = CHN_CLOSED;
+            break;
+        }
+
+        if (qar_full(channel->queue))
+        {
+            *status = CHN_TIMEOUT;
+            break;
+        }
+
+        integer_t room = channel->capacity - qar_count(channel->queue);
+        integer_t amount = size - sent < room ? size - sent : room;
+
+        qar_enqueue_n(channel->queue, elements + sent, amount);
+
+        sent += amount;
+
+        chn_wake(&channel->readable, channel->receivers, amount);
+    }
+
+    chn_update_fd(channel);
+
+    pthread_mutex_unlock(&channel->lock);
+
+    return sent;
+}
+
+// Waits until the channel is not empty and removes up to max elements
+static integer_t
+chn_take(Channel_t *channel, void **result, integer_t max,
+         integer_t timeout, ChannelResult *status)
+{
+    struct timespec deadline;
+
+    chn_deadline(timeout, &deadline);
+
+    integer_t received = 0;
+
+    pthread_mutex_lock(&channel->lock);
+
+    while (!channel->closed && qar_empty(channel->queue))
+    {
+        if (!chn_wait(channel, &channel->readable, &channel->receivers,
+                      timeout, &deadline))
+            break;
+    }
+
+    if (!qar_empty(channel->queue))
+    {
+        received = qar_dequeue_n(channel->queue, result, max);
+
+        chn_wake(&channel->writable, channel->senders, received);
+
+        *status = CHN_OK;
+    }
+    else
+    {
+        *status = channel->closed ? CHN_CLOSED : CHN_TIMEOUT;
+    }
+
+    chn_update_fd(channel);
+
+    pthread_mutex_unlock(&channel->lock);
+
+    return received;
+}
+
+// A positive timeout becomes a point in time of the monotonic clock, so that
+// it is not restarted by every wakeup
+static void
+chn_deadline(integer_t timeout, struct timespec *deadline)
+{
+    if (timeout <= 0)
+        return;
+
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+
+    deadline->tv_sec += (time_t)(timeout / 1000);
+    deadline->tv_nsec += (long)(timeout % 1000) * 1000000L;
+
+    if (deadline->tv_nsec >= 1000000000L)
+    {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+// Sleeps on a condition, counting the thread as a waiter. Returns false once
+// the deadline has passed. Wakeups can be spurious, so the caller checks the
+// state again either way.
+static bool
+chn_wait(Channel_t *channel, pthread_cond_t *condition, integer_t *waiters,
+         integer_t timeout, const struct timespec *deadline)
+{
+    if (timeout == 0)
+        return false;
+
+    int error = 0;
+
+    (*waiters)++;
+
+    if (timeout < 0)
+        pthread_cond_wait(condition, &channel->lock);
+    else
+        error = pthread_cond_timedwait(condition, &channel->lock, deadline);
+
+    (*waiters)--;
+
+    return error != ETIMEDOUT;
+}
+
+// Wakes up as many waiting threads as there are elements or slots for them,
+// and none if nobody is waiting
+static void
+chn_wake(pthread_cond_t *condition, integer_t waiters, integer_t amount)
+{
+    if (waiters == 0 || amount == 0)
+        return;
+
+    if (amount >= waiters)
+    {
+        pthread_cond_broadcast(condition);
+        return;
+    }
+
+    for (integer_t i = 0; i < amount; i++)
+        pthread_cond_signal(condition);
+}
+
+// Makes the eventfd readable if there are elements or the channel is closed
+// and drains it otherwise. It is only touched when that changes.
+static void
+chn_update_fd(Channel_t *channel)
+{
+#ifdef __linux__
+    if (channel->fd < 0)
+        return;
+
+    bool signal = channel->closed || !qar_empty(channel->queue);
+
+    if (signal == channel->signaled)
+        return;
+
+    uint64_t value = 1;
+
+    if (signal)
+        channel->signaled = write(channel->fd, &value, sizeof(value)) > 0;
+    else
+        channel->signaled = !(read(channel->fd, &value, sizeof(value)) > 0);
+#else
+    (void)channel;
+#endif
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -104,6 +104,12 @@ struct CircularLinkedList_s
     /// A function that completely frees an element from memory.
     cll_free_f v_free;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -148,11 +154,18 @@ typedef struct CircularLinkedNode_s *CircularLinkedNode;
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status cll_make_node(CircularLinkedNode *node, void *value);
+static Status cll_make_node(NodePool_t *pool, CircularLinkedNode *node,
+        void *value);
+
+static Status cll_free_node(NodePool_t *pool, CircularLinkedNode *node,
+        cll_free_f free_f);
 
-static Status cll_free_node(CircularLinkedNode *node, cll_free_f free_f);
+static Status cll_free_node_shallow(NodePool_t *pool, CircularLinkedNode *node);
 
-static Status cll_free_node_shallow(CircularLinkedNode *node);
+static CircularLinkedNode cll_split(CircularLinkedNode node, integer_t count);
+
+static CircularLinkedNode cll_merge_sort(CircularLinkedNode head,
+        integer_t length, cll_compare_f compare_f, CircularLinkedNode *tail);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -183,6 +196,10 @@ Status cll_init(CircularLinkedList *list)
     (*list)->v_display = NULL;
     (*list)->v_free = NULL;
 
+    (*list)->pool = NULL;
+
+    (*list)->version_id = 0;
+
     return DS_OK;
 }
 
@@ -204,6 +221,10 @@ Status cll_create(CircularLinkedList *list, cll_compare_f compare_f,
     (*list)->v_display = display_f;
     (*list)->v_free = free_f;
 
+    (*list)->pool = NULL;
+
+    (*list)->version_id = 0;
+
     return DS_OK;
 }
 
@@ -234,7 +255,7 @@ Status cll_free(CircularLinkedList *list)
     {
         (*list)->cursor = (*list)->cursor->next;
 
-        st = cll_free_node(&prev, (*list)->v_free);
+        st = cll_free_node((*list)->pool, &prev, (*list)->v_free);
 
         if (st != DS_OK)
             return st;
@@ -275,7 +296,7 @@ Status cll_free_shallow(CircularLinkedList *list)
     {
         (*list)->cursor = (*list)->cursor->next;
 
-        st = cll_free_node_shallow(&prev);
+        st = cll_free_node_shallow((*list)->pool, &prev);
 
         if (st != DS_OK)
             return st;
@@ -304,6 +325,8 @@ Status cll_erase(CircularLinkedList *cll)
     if ((*cll) == NULL)
         return DS_ERR_NULL_POINTER;
 
+    NodePool_t *pool = (*cll)->pool;
+
     Status st = cll_free(cll);
 
     if (st != DS_OK)
@@ -314,6 +337,8 @@ Status cll_erase(CircularLinkedList *cll)
     if (st != DS_OK)
         return st;
 
+    (*cll)->pool = pool;
+
     return DS_OK;
 }
 
@@ -410,6 +435,36 @@ Status cll_set_limit(CircularLinkedList list, integer_t limit)
     return DS_OK;
 }
 
+/// \brief Sets a node pool for the specified CircularLinkedList_s.
+///
+/// Sets a node pool from where all nodes of the list are allocated. A pool can
+/// be shared between many containers as long as its nodes are big enough. To
+/// go back to using malloc() and free() simply set the pool to \c NULL. The
+/// pool can only be changed when the list is empty.
+///
+/// \param[in] list CircularLinkedList_s reference.
+/// \param[in] pool The node pool or \c NULL.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if the pool's nodes are too small.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status cll_set_pool(CircularLinkedList list, NodePool_t *pool)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!cll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (pool && !npl_fits(pool, sizeof(CircularLinkedNode_t)))
+        return DS_ERR_INVALID_ARGUMENT;
+
+    list->pool = pool;
+
+    return DS_OK;
+}
+
 integer_t cll_length(CircularLinkedList list)
 {
     if (list == NULL)
@@ -448,7 +503,7 @@ Status cll_insert_after(CircularLinkedList cll, void *element)
     if (cll_full(cll))
         return DS_ERR_FULL;
 
-    Status st = cll_make_node(&node, element);
+    Status st = cll_make_node(cll->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -497,7 +552,7 @@ Status cll_insert_before(CircularLinkedList cll, void *element)
 
     CircularLinkedNode node;
 
-    Status st = cll_make_node(&node, element);
+    Status st = cll_make_node(cll->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -550,7 +605,7 @@ Status cll_remove_after(CircularLinkedList cll, void **result)
     {
         *result = cll->cursor->data;
 
-        st = cll_free_node_shallow(&(cll->cursor));
+        st = cll_free_node_shallow(cll->pool, &(cll->cursor));
 
         if (st != DS_OK)
             return st;
@@ -564,7 +619,7 @@ Status cll_remove_after(CircularLinkedList cll, void **result)
         node->prev->next = node->next;
         node->next->prev = node->prev;
 
-        st = cll_free_node_shallow(&node);
+        st = cll_free_node_shallow(cll->pool, &node);
 
         if (st != DS_OK)
             return st;
@@ -601,7 +656,7 @@ Status cll_remove_current(CircularLinkedList cll, void **result)
     {
         *result = cll->cursor->data;
 
-        st = cll_free_node_shallow(&(cll->cursor));
+        st = cll_free_node_shallow(cll->pool, &(cll->cursor));
 
         if (st != DS_OK)
             return st;
@@ -618,7 +673,7 @@ Status cll_remove_current(CircularLinkedList cll, void **result)
         node->prev->next = node->next;
         node->next->prev = node->prev;
 
-        st = cll_free_node_shallow(&node);
+        st = cll_free_node_shallow(cll->pool, &node);
 
         if (st != DS_OK)
             return st;
@@ -655,7 +710,7 @@ Status cll_remove_before(CircularLinkedList cll, void **result)
     {
         *result = cll->cursor->data;
 
-        st = cll_free_node_shallow(&(cll->cursor));
+        st = cll_free_node_shallow(cll->pool, &(cll->cursor));
 
         if (st != DS_OK)
             return st;
@@ -669,7 +724,7 @@ Status cll_remove_before(CircularLinkedList cll, void **result)
         node->prev->next = node->next;
         node->next->prev = node->prev;
 
-        st = cll_free_node_shallow(&node);
+        st = cll_free_node_shallow(cll->pool, &node);
 
         if (st != DS_OK)
             return st;
@@ -794,6 +849,56 @@ void *cll_peek_prev(CircularLinkedList cll)
     return cll->cursor->prev->data;
 }
 
+/// \brief Sorts a CircularLinkedList_s.
+///
+/// Sorts the list in ascending order according to its default compare
+/// function, starting at the cursor, using a bottom-up merge sort that only
+/// relinks the nodes. It takes O(n log n), allocates nothing and keeps equal
+/// elements in their original order. The cursor is moved to the smallest
+/// element, so the biggest one is right before it.
+///
+/// \param[in] cll CircularLinkedList_s reference to be sorted.
+///
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status cll_sort(CircularLinkedList cll)
+{
+    if (cll == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (cll->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (cll->length < 2)
+        return DS_OK;
+
+    CircularLinkedNode head = cll->cursor, tail;
+
+    // Open the ring right before the cursor
+    head->prev->next = NULL;
+
+    head = cll_merge_sort(head, cll->length, cll->v_compare, &tail);
+
+    // The sort only follows the next pointers
+    CircularLinkedNode prev = tail;
+
+    for (CircularLinkedNode scan = head; scan != NULL; scan = scan->next)
+    {
+        scan->prev = prev;
+
+        prev = scan;
+    }
+
+    tail->next = head;
+
+    cll->cursor = head;
+
+    cll->version_id++;
+
+    return DS_OK;
+}
+
 Status cll_copy(CircularLinkedList list, CircularLinkedList *result)
 {
     *result = NULL;
@@ -810,6 +915,8 @@ Status cll_copy(CircularLinkedList list, CircularLinkedList *result)
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+
     if (cll_empty(list))
         return DS_OK;
 
@@ -1035,9 +1142,10 @@ Status cll_display_raw(CircularLinkedList list)
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status cll_make_node(CircularLinkedNode *node, void *value)
+static Status cll_make_node(NodePool_t *pool, CircularLinkedNode *node,
+        void *value)
 {
-    *node = malloc(sizeof(CircularLinkedNode_t));
+    *node = npl_node_alloc(pool, sizeof(CircularLinkedNode_t));
 
     if (!(*node))
         return DS_ERR_ALLOC;
@@ -1050,32 +1158,120 @@ static Status cll_make_node(CircularLinkedNode *node, void *value)
     return DS_OK;
 }
 
-static Status cll_free_node(CircularLinkedNode *node, cll_free_f free_f)
+static Status cll_free_node(NodePool_t *pool, CircularLinkedNode *node,
+        cll_free_f free_f)
 {
     if ((*node) == NULL)
         return DS_ERR_NULL_POINTER;
 
     free_f((*node)->data);
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     *node = NULL;
 
     return DS_OK;
 }
 
-static Status cll_free_node_shallow(CircularLinkedNode *node)
+static Status cll_free_node_shallow(NodePool_t *pool, CircularLinkedNode *node)
 {
     if ((*node) == NULL)
         return DS_ERR_NULL_POINTER;
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     *node = NULL;
 
     return DS_OK;
 }
 
+/// \brief Cuts a chain of nodes.
+///
+/// Implementation detail. Cuts a \c NULL terminated chain after \c count
+/// nodes.
+///
+/// \param[in] node First node of the chain.
+/// \param[in] count Amount of nodes that are kept in the chain.
+///
+/// \return The first node after the cut or \c NULL if the chain is not
+/// longer than \c count.
+static CircularLinkedNode cll_split(CircularLinkedNode node, integer_t count)
+{
+    for (integer_t i = 1; node != NULL && i < count; i++)
+        node = node->next;
+
+    if (node == NULL)
+        return NULL;
+
+    CircularLinkedNode rest = node->next;
+
+    node->next = NULL;
+
+    return rest;
+}
+
+/// \brief Sorts a chain of nodes.
+///
+/// Implementation detail. A bottom-up merge sort that only follows and changes
+/// the \c next pointers of the nodes. Each pass merges pairs of sorted runs of
+/// the same width, starting at 1 and doubling every pass, so it takes
+/// O(n log n) and no extra memory. Equal elements keep their order.
+///
+/// \param[in] head First node of a \c NULL terminated chain.
+/// \param[in] length Amount of nodes in the chain.
+/// \param[in] compare_f Function used to compare the nodes' data.
+/// \param[out] tail Last node of the sorted chain.
+///
+/// \return The first node of the sorted chain.
+static CircularLinkedNode cll_merge_sort(CircularLinkedNode head,
+        integer_t length, cll_compare_f compare_f, CircularLinkedNode *tail)
+{
+    CircularLinkedNode_t first;
+
+    first.next = head;
+
+    *tail = head;
+
+    for (integer_t width = 1; width < length; width *= 2)
+    {
+        CircularLinkedNode last = &first, scan = first.next;
+
+        while (scan != NULL)
+        {
+            CircularLinkedNode left = scan;
+            CircularLinkedNode right = cll_split(left, width);
+
+            scan = cll_split(right, width);
+
+            // Merge both runs after last, taking from the left one on ties
+            while (left != NULL && right != NULL)
+            {
+                if (compare_f(right->data, left->data) < 0)
+                {
+                    last->next = right;
+                    right = right->next;
+                }
+                else
+                {
+                    last->next = left;
+                    left = left->next;
+                }
+
+                last = last->next;
+            }
+
+            last->next = left != NULL ? left : right;
+
+            while (last->next != NULL)
+                last = last->next;
+        }
+
+        *tail = last;
+    }
+
+    return first.next;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,794 @@
+/**
+ * @file CompactRedBlackTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CompactRedBlackTree.h"
+
+/// The lowest bit of a node's left link. Set if the node is red.
+#define CRB_RED ((uintptr_t)1)
+
+/// A CompactRedBlackTree_s is a red-black tree that keeps the same ordering
+/// and balance guarantees as a RedBlackTree_s with nodes that are half as big.
+///
+/// Its nodes have no parent pointer, and the color is kept in the lowest bit
+/// of the left link, which is always zero in a pointer given by malloc(). A
+/// node is then only a key and two links.
+///
+/// Without parent pointers, insertions and removals can't walk back up to fix
+/// the tree. They fix it top-down instead: on the way down, colors are flipped
+/// and nodes are rotated so that the node reached is never a problem for its
+/// parent. An element is then attached or removed at the bottom and nothing
+/// is written on the way back up. A removal makes sure the node it goes
+/// through is red before going further, so that the node finally taken out,
+/// the in-order predecessor of the element, can be unlinked without a fixup.
+///
+/// The tree has no iterator, no ranks and no snapshots, all of which need
+/// the parent pointers. Use a RedBlackTree_s for those.
+///
+/// \par Functions
+/// Located in the file CompactRedBlackTree.c
+struct CompactRedBlackTree_s
+{
+    /// \brief Tree size.
+    ///
+    /// Current amount of elements.
+    integer_t size;
+
+    /// \brief Tree size limit.
+    ///
+    /// If it is set to 0 or a negative value then the tree has no limit to its
+    /// size. Otherwise it won't be able to have more elements than the
+    /// specified value.
+    integer_t limit;
+
+    /// \brief The tree's root.
+    struct CompactRedBlackTreeNode_s *root;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
+    /// \brief CompactRedBlackTree_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A CompactRedBlackTree_s node.
+///
+/// Implementation detail. A key and its two children, with the color of the
+/// node in the lowest bit of the left one.
+struct CompactRedBlackTreeNode_s
+{
+    /// \brief Node's key.
+    void *key;
+
+    /// \brief The left and the right children.
+    ///
+    /// The left link also has the \c CRB_RED bit. Only read and written
+    /// through crb_child() and crb_link().
+    uintptr_t link[2];
+};
+
+/// \brief A type for a compact red-black tree node.
+///
+/// Defines a type to a <code> struct CompactRedBlackTreeNode_s </code>.
+typedef struct CompactRedBlackTreeNode_s CompactRedBlackTreeNode_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static CompactRedBlackTreeNode_t *
+crb_new_node(NodePool_t *pool, void *element);
+
+static void
+crb_free_tree(NodePool_t *pool, CompactRedBlackTreeNode_t *root,
+              free_f function);
+
+static CompactRedBlackTreeNode_t *
+crb_find(CompactRedBlackTree_t *tree, void *element);
+
+static CompactRedBlackTreeNode_t *
+crb_child(CompactRedBlackTreeNode_t *node, int dir);
+
+static void
+crb_link(CompactRedBlackTreeNode_t *node, int dir,
+         CompactRedBlackTreeNode_t *child);
+
+static bool
+crb_red(CompactRedBlackTreeNode_t *node);
+
+static void
+crb_paint(CompactRedBlackTreeNode_t *node, bool red);
+
+static CompactRedBlackTreeNode_t *
+crb_rotate(CompactRedBlackTreeNode_t *node, int dir);
+
+static CompactRedBlackTreeNode_t *
+crb_rotate_double(CompactRedBlackTreeNode_t *node, int dir);
+
+static integer_t
+crb_height_nodes(CompactRedBlackTreeNode_t *root);
+
+static integer_t
+crb_range_nodes(Interface_t *interface, CompactRedBlackTreeNode_t *root,
+                void *low, void *high, visit_f visit, void *argument);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new CompactRedBlackTree_s with \c size and \c limit set to 0
+/// and \c root to NULL.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param interface An interface defining all necessary functions for the
+/// tree to operate.
+///
+/// \return A new CompactRedBlackTree_s or NULL if allocation failed.
+CompactRedBlackTree_t *
+crb_new(Interface_t *interface)
+{
+    CompactRedBlackTree_t *tree = malloc(sizeof(CompactRedBlackTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->size = 0;
+    tree->limit = 0;
+    tree->root = NULL;
+    tree->pool = NULL;
+    tree->interface = interface;
+
+    return tree;
+}
+
+/// Frees a CompactRedBlackTree_s, freeing all of its elements using the
+/// interface's free function.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param tree The tree to be freed from memory.
+void
+crb_free(CompactRedBlackTree_t *tree)
+{
+    crb_free_tree(tree->pool, tree->root, tree->interface->free);
+
+    free(tree);
+}
+
+/// Frees a CompactRedBlackTree_s and all of its nodes, leaving its elements
+/// intact.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree The tree to be freed from memory.
+void
+crb_free_shallow(CompactRedBlackTree_t *tree)
+{
+    crb_free_tree(tree->pool, tree->root, NULL);
+
+    free(tree);
+}
+
+/// Frees all of the elements of a CompactRedBlackTree_s using the interface's
+/// free function, leaving the tree empty.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param tree The tree to have all of its elements freed from memory.
+void
+crb_erase(CompactRedBlackTree_t *tree)
+{
+    crb_free_tree(tree->pool, tree->root, tree->interface->free);
+
+    tree->root = NULL;
+    tree->size = 0;
+}
+
+/// Returns the amount of elements in the tree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return The amount of elements in the tree.
+integer_t
+crb_size(CompactRedBlackTree_t *tree)
+{
+    return tree->size;
+}
+
+/// Returns the tree's size limit. If the limit is 0 or less the tree has no
+/// limit.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return The tree's size limit.
+integer_t
+crb_limit(CompactRedBlackTree_t *tree)
+{
+    return tree->limit;
+}
+
+/// Returns the amount of nodes in the longest path from the root to a leaf.
+/// It is never more than <code> 2 * log2(n + 1) </code>. Takes linear time.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return The height of the tree or 0 if it is empty.
+integer_t
+crb_height(CompactRedBlackTree_t *tree)
+{
+    return crb_height_nodes(tree->root);
+}
+
+/// Searches the tree for an element equal to the given one.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param element The element to be searched for.
+///
+/// \return The element in the tree or NULL if there is no equal element.
+void *
+crb_get(CompactRedBlackTree_t *tree, void *element)
+{
+    CompactRedBlackTreeNode_t *node = crb_find(tree, element);
+
+    return node ? node->key : NULL;
+}
+
+/// Sets a limit to the amount of elements in the tree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param limit The specified limit.
+///
+/// \return False if the limit is less than the tree's current size and greater
+/// than 0. Returns true if the limit was successfully set.
+bool
+crb_set_limit(CompactRedBlackTree_t *tree, integer_t limit)
+{
+    if (tree->size > limit && limit > 0)
+        return false;
+
+    tree->limit = limit;
+
+    return true;
+}
+
+/// Sets a node pool from where all nodes of the tree are allocated. A pool
+/// can be shared between many containers as long as its nodes are big enough.
+/// Set it to NULL to go back to using malloc() and free(). The pool can only
+/// be changed when the tree is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the tree is not empty or if the pool's nodes are too
+/// small.
+bool
+crb_set_pool(CompactRedBlackTree_t *tree, NodePool_t *pool)
+{
+    if (!crb_empty(tree))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(CompactRedBlackTreeNode_t)))
+        return false;
+
+    tree->pool = pool;
+
+    return true;
+}
+
+/// Inserts an element into the tree in a single pass from the root. On the
+/// way down, every black node with two red children is made red and its
+/// children black, and two red nodes in a row are fixed with a rotation of
+/// their grandparent, so the new red leaf can be attached without going back
+/// up. Duplicate elements are not inserted, but the tree might still be
+/// rebalanced on the way to them.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param element Element to be inserted.
+///
+/// \return True if the element was inserted.
+/// \return False if an equal element is already in the tree, if the tree is
+/// full or if allocation failed.
+bool
+crb_insert(CompactRedBlackTree_t *tree, void *element)
+{
+    if (tree->root == NULL)
+    {
+        if (crb_full(tree))
+            return false;
+
+        tree->root = crb_new_node(tree->pool, element);
+
+        if (!tree->root)
+            return false;
+
+        crb_paint(tree->root, false);
+
+        tree->size++;
+
+        return true;
+    }
+
+    // A false root above the real one, so that the root can be rotated
+    CompactRedBlackTreeNode_t head = { NULL, { 0, 0 } };
+
+    // The great-grandparent, grandparent, parent and current node
+    CompactRedBlackTreeNode_t *T = &head, *G = NULL, *P = NULL;
+    CompactRedBlackTreeNode_t *Q = tree->root;
+
+    int dir = 0, last = 0;
+    bool inserted = false;
+
+    crb_link(T, 1, Q);
+
+    for (;;)
+    {
+        if (Q == NULL)
+        {
+            if (crb_full(tree))
+                break;
+
+            Q = crb_new_node(tree->pool, element);
+
+            if (!Q)
+                break;
+
+            crb_link(P, dir, Q);
+
+            inserted = true;
+        }
+        else if (crb_red(crb_child(Q, 0)) && crb_red(crb_child(Q, 1)))
+        {
+            // Color flip
+            crb_paint(Q, true);
+            crb_paint(crb_child(Q, 0), false);
+            crb_paint(crb_child(Q, 1), false);
+        }
+
+        // Two red nodes in a row
+        if (crb_red(Q) && crb_red(P))
+        {
+            int dir2 = crb_child(T, 1) == G;
+
+            if (Q == crb_child(P, last))
+                crb_link(T, dir2, crb_rotate(G, !last));
+            else
+                crb_link(T, dir2, crb_rotate_double(G, !last));
+        }
+
+        if (inserted)
+            break;
+
+        int comparison = tree->interface->compare(Q->key, element);
+
+        if (comparison == 0)
+            break;
+
+        last = dir;
+        dir = comparison < 0;
+
+        if (G != NULL)
+            T = G;
+
+        G = P;
+        P = Q;
+        Q = crb_child(Q, dir);
+    }
+
+    tree->root = crb_child(&head, 1);
+
+    crb_paint(tree->root, false);
+
+    if (inserted)
+        tree->size++;
+
+    return inserted;
+}
+
+/// Removes an element from the tree in a single pass from the root and frees
+/// it. On the way down, the current node is made red by pushing a red node
+/// down from its parent or its sibling, so the node that is finally unlinked,
+/// the in-order predecessor of the element or the element itself, is red or
+/// has a red child and never needs a fixup. Its element then takes the place
+/// of the removed one.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param element The element to be removed has to match this element.
+///
+/// \return True if the element was removed.
+/// \return False if the element was not found.
+bool
+crb_remove(CompactRedBlackTree_t *tree, void *element)
+{
+    if (tree->root == NULL)
+        return false;
+
+    CompactRedBlackTreeNode_t head = { NULL, { 0, 0 } };
+
+    // The grandparent, parent, current and matching nodes
+    CompactRedBlackTreeNode_t *G = NULL, *P = NULL, *Q = &head, *F = NULL;
+
+    int dir = 1;
+
+    crb_link(Q, 1, tree->root);
+
+    while (crb_child(Q, dir) != NULL)
+    {
+        int last = dir;
+
+        G = P;
+        P = Q;
+        Q = crb_child(Q, dir);
+
+        // Past the match every key is smaller, so the path only goes right
+        int comparison = F ? -1 : tree->interface->compare(Q->key, element);
+
+        if (comparison == 0)
+            F = Q;
+
+        dir = comparison < 0;
+
+        // Push a red node down
+        if (!crb_red(Q) && !crb_red(crb_child(Q, dir)))
+        {
+            if (crb_red(crb_child(Q, !dir)))
+            {
+                crb_link(P, last, crb_rotate(Q, dir));
+
+                P = crb_child(P, last);
+            }
+            else
+            {
+                CompactRedBlackTreeNode_t *S = crb_child(P, !last);
+
+                if (S == NULL)
+                    continue;
+
+                if (!crb_red(crb_child(S, !last)) &&
+                    !crb_red(crb_child(S, last)))
+                {
+                    // Color flip
+                    crb_paint(P, false);
+                    crb_paint(S, true);
+                    crb_paint(Q, true);
+                }
+                else
+                {
+                    int dir2 = crb_child(G, 1) == P;
+
+                    if (crb_red(crb_child(S, last)))
+                        crb_link(G, dir2, crb_rotate_double(P, last));
+                    else
+                        crb_link(G, dir2, crb_rotate(P, last));
+
+                    CompactRedBlackTreeNode_t *R = crb_child(G, dir2);
+
+                    crb_paint(Q, true);
+                    crb_paint(R, true);
+                    crb_paint(crb_child(R, 0), false);
+                    crb_paint(crb_child(R, 1), false);
+                }
+            }
+        }
+    }
+
+    if (F != NULL)
+    {
+        tree->interface->free(F->key);
+
+        F->key = Q->key;
+
+        // Q has at most one child
+        CompactRedBlackTreeNode_t *child = crb_child(Q, crb_child(Q, 0) == NULL);
+
+        crb_link(P, crb_child(P, 1) == Q, child);
+
+        npl_node_free(tree->pool, Q);
+
+        tree->size--;
+    }
+
+    tree->root = crb_child(&head, 1);
+
+    if (tree->root)
+        crb_paint(tree->root, false);
+
+    return F != NULL;
+}
+
+/// Checks if the tree is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return True if \c size equals 0, otherwise false.
+bool
+crb_empty(CompactRedBlackTree_t *tree)
+{
+    return tree->size == 0;
+}
+
+/// Checks if the tree is full. The tree can only be full if the limit is
+/// greater than 0 and the tree's size reached the limit.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return True if the tree has reached its limit, otherwise false.
+bool
+crb_full(CompactRedBlackTree_t *tree)
+{
+    return tree->limit > 0 && tree->size >= tree->limit;
+}
+
+/// Checks if a given element is in the tree.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param element The element to be searched in the tree.
+///
+/// \return True if the tree contains the element, otherwise false.
+bool
+crb_contains(CompactRedBlackTree_t *tree, void *element)
+{
+    return crb_find(tree, element) != NULL;
+}
+
+/// Returns the maximum element in the tree or NULL if it is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return The maximum element or NULL if the tree is empty.
+void *
+crb_max(CompactRedBlackTree_t *tree)
+{
+    CompactRedBlackTreeNode_t *scan = tree->root;
+
+    if (scan == NULL)
+        return NULL;
+
+    while (crb_child(scan, 1) != NULL)
+        scan = crb_child(scan, 1);
+
+    return scan->key;
+}
+
+/// Returns the minimum element in the tree or NULL if it is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree CompactRedBlackTree_s reference.
+///
+/// \return The minimum element or NULL if the tree is empty.
+void *
+crb_min(CompactRedBlackTree_t *tree)
+{
+    CompactRedBlackTreeNode_t *scan = tree->root;
+
+    if (scan == NULL)
+        return NULL;
+
+    while (crb_child(scan, 0) != NULL)
+        scan = crb_child(scan, 0);
+
+    return scan->key;
+}
+
+/// Visits in ascending order every element that is not smaller than \c low
+/// and not bigger than \c high. Subtrees outside of the range are skipped, so
+/// only <code> O(log n + k) </code> nodes are visited where \c k is the
+/// amount of elements in the range.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree CompactRedBlackTree_s reference.
+/// \param low Lower bound of the range.
+/// \param high Upper bound of the range.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+crb_range(CompactRedBlackTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument)
+{
+    return crb_range_nodes(tree->interface, tree->root, low, high, visit,
+                           argument);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static CompactRedBlackTreeNode_t *
+crb_new_node(NodePool_t *pool, void *element)
+{
+    CompactRedBlackTreeNode_t *node = npl_node_alloc(pool,
+            sizeof(CompactRedBlackTreeNode_t));
+
+    if (!node)
+        return NULL;
+
+    // All new nodes are red
+    node->key = element;
+    node->link[0] = CRB_RED;
+    node->link[1] = 0;
+
+    return node;
+}
+
+// The height of the tree is logarithmic so the recursion is bounded
+static void
+crb_free_tree(NodePool_t *pool, CompactRedBlackTreeNode_t *root,
+              free_f function)
+{
+    if (root == NULL)
+        return;
+
+    crb_free_tree(pool, crb_child(root, 0), function);
+    crb_free_tree(pool, crb_child(root, 1), function);
+
+    if (function)
+        function(root->key);
+
+    npl_node_free(pool, root);
+}
+
+static CompactRedBlackTreeNode_t *
+crb_find(CompactRedBlackTree_t *tree, void *element)
+{
+    CompactRedBlackTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = tree->interface->compare(scan->key, element);
+
+        if (comparison == 0)
+            return scan;
+
+        scan = crb_child(scan, comparison < 0);
+    }
+
+    return NULL;
+}
+
+static CompactRedBlackTreeNode_t *
+crb_child(CompactRedBlackTreeNode_t *node, int dir)
+{
+    return (CompactRedBlackTreeNode_t *)(node->link[dir] & ~CRB_RED);
+}
+
+// Keeps the color bit of the left link
+static void
+crb_link(CompactRedBlackTreeNode_t *node, int dir,
+         CompactRedBlackTreeNode_t *child)
+{
+    node->link[dir] = (uintptr_t)child | (node->link[dir] & CRB_RED);
+}
+
+// A NULL child is black
+static bool
+crb_red(CompactRedBlackTreeNode_t *node)
+{
+    return node != NULL && (node->link[0] & CRB_RED);
+}
+
+static void
+crb_paint(CompactRedBlackTreeNode_t *node, bool red)
+{
+    if (red)
+        node->link[0] |= CRB_RED;
+    else
+        node->link[0] &= ~CRB_RED;
+}
+
+// Rotates the node towards dir. The node becomes red and its replacement black
+static CompactRedBlackTreeNode_t *
+crb_rotate(CompactRedBlackTreeNode_t *node, int dir)
+{
+    CompactRedBlackTreeNode_t *save = crb_child(node, !dir);
+
+    crb_link(node, !dir, crb_child(save, dir));
+    crb_link(save, dir, node);
+
+    crb_paint(node, true);
+    crb_paint(save, false);
+
+    return save;
+}
+
+static CompactRedBlackTreeNode_t *
+crb_rotate_double(CompactRedBlackTreeNode_t *node, int dir)
+{
+    crb_link(node, !dir, crb_rotate(crb_child(node, !dir), !dir));
+
+    return crb_rotate(node, dir);
+}
+
+static integer_t
+crb_height_nodes(CompactRedBlackTreeNode_t *root)
+{
+    if (root == NULL)
+        return 0;
+
+    integer_t left = crb_height_nodes(crb_child(root, 0));
+    integer_t right = crb_height_nodes(crb_child(root, 1));
+
+    return 1 + (left > right ? left : right);
+}
+
+static integer_t
+crb_range_nodes(Interface_t *interface, CompactRedBlackTreeNode_t *root,
+                void *low, void *high, visit_f visit, void *argument)
+{
+    if (root == NULL)
+        return 0;
+
+    bool above = interface->compare(root->key, low) >= 0;
+    bool below = interface->compare(root->key, high) <= 0;
+
+    integer_t total = 0;
+
+    if (above)
+        total += crb_range_nodes(interface, crb_child(root, 0), low, high,
+                                 visit, argument);
+
+    if (above && below)
+    {
+        visit(root->key, argument);
+        total++;
+    }
+
+    if (below)
+        total += crb_range_nodes(interface, crb_child(root, 1), low, high,
+                                 visit, argument);
+
+    return total;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,308 @@
+/**
+ * @file CountMinSketch.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CountMinSketch.h"
+#include <inttypes.h>
+
+/// A count-min sketch estimates the frequency of the elements of a stream
+/// with a fixed table of \c depth rows of \c width counters. Each element
+/// adds to one counter in every row and its estimate is the smallest of
+/// them. Collisions only ever add to a counter, so an estimate is never
+/// lower than the real count. With <code> width = e / epsilon </code> and
+/// <code> depth = ln(1 / delta) </code> it is higher by at most
+/// <code> epsilon * total </code> with probability <code> 1 - delta </code>.
+///
+/// Like BloomFilter_s, the index of an element in every row is derived from a
+/// single call to the \c hash function with double hashing,
+/// <code> h1 + i * h2 </code>. Sketches with the same parameters are merged
+/// by adding their counters, which gives exactly the sketch of both streams.
+///
+/// \par Functions
+/// Located in the file CountMinSketch.c
+struct CountMinSketch_s
+{
+    /// \brief The \c depth rows of counters, one after the other.
+    unsigned_t *counters;
+
+    /// \brief Amount of counters in each row.
+    integer_t width;
+
+    /// \brief Amount of rows.
+    integer_t depth;
+
+    /// \brief Sum of all the amounts added.
+    unsigned_t total;
+
+    /// \brief Hash function used for the elements.
+    hash_f hash;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+cms_mix(unsigned_t x);
+
+static unsigned_t *
+cms_counter(CountMinSketch_t *sketch, unsigned_t h1, unsigned_t h2,
+            integer_t row);
+
+static bool
+cms_compatible(CountMinSketch_t *sketch1, CountMinSketch_t *sketch2);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a count-min sketch whose estimates are at most
+/// <code> epsilon * total </code> above the real counts with a probability
+/// of at least <code> 1 - delta </code>.
+///
+/// \param[in] hash A hash function for the elements.
+/// \param[in] epsilon Maximum error relative to the total, between 0 and 1.
+/// \param[in] delta Probability of exceeding the error, between 0 and 1.
+///
+/// \return A new count-min sketch or NULL if allocation failed or the
+/// parameters are invalid.
+CountMinSketch_t *
+cms_new(hash_f hash, double epsilon, double delta)
+{
+    if (!(epsilon > 0.0 && epsilon < 1.0) || !(delta > 0.0 && delta < 1.0))
+        return NULL;
+
+    double width = ceil(exp(1.0) / epsilon);
+    double depth = ceil(log(1.0 / delta));
+
+    return cms_create(hash, (integer_t)width,
+                      depth < 1.0 ? 1 : (integer_t)depth);
+}
+
+/// Creates a count-min sketch with the given parameters. It takes
+/// <code> width * depth </code> counters of memory no matter how many
+/// elements are added.
+///
+/// \param[in] hash A hash function for the elements.
+/// \param[in] width Amount of counters in each row.
+/// \param[in] depth Amount of rows.
+///
+/// \return A new count-min sketch or NULL if allocation failed or the
+/// parameters are invalid.
+CountMinSketch_t *
+cms_create(hash_f hash, integer_t width, integer_t depth)
+{
+    if (!hash || width < 1 || depth < 1)
+        return NULL;
+
+    CountMinSketch_t *sketch = malloc(sizeof(CountMinSketch_t));
+
+    if (!sketch)
+        return NULL;
+
+    sketch->counters = calloc((size_t)(width * depth), sizeof(unsigned_t));
+
+    if (!sketch->counters)
+    {
+        free(sketch);
+        return NULL;
+    }
+
+    sketch->width = width;
+    sketch->depth = depth;
+    sketch->total = 0;
+    sketch->hash = hash;
+
+    return sketch;
+}
+
+/// Frees from memory a CountMinSketch_s. The elements are not kept by the
+/// sketch so there is nothing else to free.
+///
+/// \param[in] sketch The count-min sketch to be freed from memory.
+void
+cms_free(CountMinSketch_t *sketch)
+{
+    free(sketch->counters);
+
+    free(sketch);
+}
+
+/// \param[in] sketch The count-min sketch.
+///
+/// \return The amount of counters in each row.
+integer_t
+cms_width(CountMinSketch_t *sketch)
+{
+    return sketch->width;
+}
+
+/// \param[in] sketch The count-min sketch.
+///
+/// \return The amount of rows.
+integer_t
+cms_depth(CountMinSketch_t *sketch)
+{
+    return sketch->depth;
+}
+
+/// \param[in] sketch The count-min sketch.
+///
+/// \return The sum of all the amounts added.
+unsigned_t
+cms_total(CountMinSketch_t *sketch)
+{
+    return sketch->total;
+}
+
+/// Adds an amount to one counter of the element in every row.
+///
+/// \param[in] sketch The count-min sketch.
+/// \param[in] element The element seen.
+/// \param[in] amount How many times it was seen.
+///
+/// \return True if the amount was added.
+bool
+cms_insert(CountMinSketch_t *sketch, void *element, unsigned_t amount)
+{
+    unsigned_t h1 = cms_mix(sketch->hash(element));
+    unsigned_t h2 = cms_mix(h1);
+
+    for (integer_t i = 0; i < sketch->depth; i++)
+        *cms_counter(sketch, h1, h2, i) += amount;
+
+    sketch->total += amount;
+
+    return true;
+}
+
+/// Returns the smallest counter of the element, which is never lower than
+/// the amount of times it was seen.
+///
+/// \param[in] sketch The count-min sketch.
+/// \param[in] element The element to be estimated.
+///
+/// \return An upper bound of the count of the element.
+unsigned_t
+cms_estimate(CountMinSketch_t *sketch, void *element)
+{
+    unsigned_t h1 = cms_mix(sketch->hash(element));
+    unsigned_t h2 = cms_mix(h1);
+
+    unsigned_t estimate = *cms_counter(sketch, h1, h2, 0);
+
+    for (integer_t i = 1; i < sketch->depth; i++)
+    {
+        unsigned_t count = *cms_counter(sketch, h1, h2, i);
+
+        if (count < estimate)
+            estimate = count;
+    }
+
+    return estimate;
+}
+
+/// Sets every counter to zero so the count-min sketch can be reused.
+///
+/// \param[in] sketch The count-min sketch.
+void
+cms_erase(CountMinSketch_t *sketch)
+{
+    memset(sketch->counters, 0,
+           sizeof(unsigned_t) * (size_t)(sketch->width * sketch->depth));
+
+    sketch->total = 0;
+}
+
+/// \param[in] sketch The count-min sketch to be copied.
+///
+/// \return A copy of the count-min sketch or NULL if allocation failed.
+CountMinSketch_t *
+cms_copy(CountMinSketch_t *sketch)
+{
+    CountMinSketch_t *result = cms_create(sketch->hash, sketch->width,
+                                          sketch->depth);
+
+    if (!result)
+        return NULL;
+
+    memcpy(result->counters, sketch->counters,
+           sizeof(unsigned_t) * (size_t)(sketch->width * sketch->depth));
+
+    result->total = sketch->total;
+
+    return result;
+}
+
+/// Adds the counters of \c sketch2 to \c sketch1. The result is exactly the
+/// sketch that would be built by adding both streams, so a sketch per thread
+/// can be combined at the end. Both sketches must have the same parameters
+/// and hash function.
+///
+/// \param[in] sketch1 The count-min sketch that receives the counts.
+/// \param[in] sketch2 The other count-min sketch.
+///
+/// \return True if the operation was successful.
+bool
+cms_merge(CountMinSketch_t *sketch1, CountMinSketch_t *sketch2)
+{
+    if (!cms_compatible(sketch1, sketch2))
+        return false;
+
+    integer_t size = sketch1->width * sketch1->depth;
+
+    for (integer_t i = 0; i < size; i++)
+        sketch1->counters[i] += sketch2->counters[i];
+
+    sketch1->total += sketch2->total;
+
+    return true;
+}
+
+/// \param[in] sketch The count-min sketch to be displayed.
+void
+cms_display(CountMinSketch_t *sketch)
+{
+    printf("\nCountMinSketch\n");
+    printf("  width : %" DS_PRI_INTEGER "\n", sketch->width);
+    printf("  depth : %" DS_PRI_INTEGER "\n", sketch->depth);
+    printf("  total : %" PRIuMAX "\n", sketch->total);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Finalizer of splitmix64. Spreads every input bit over the whole word since
+// some hash functions return the element almost unchanged.
+static unsigned_t
+cms_mix(unsigned_t x)
+{
+    uint64_t z = (uint64_t)x + UINT64_C(0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+// Returns the counter of an element in a row. An odd step keeps the indexes
+// of different rows apart when the width is a power of two.
+static unsigned_t *
+cms_counter(CountMinSketch_t *sketch, unsigned_t h1, unsigned_t h2,
+            integer_t row)
+{
+    unsigned_t index = (h1 + (unsigned_t)row * (h2 | 1))
+                       % (unsigned_t)sketch->width;
+
+    return &sketch->counters[row * sketch->width + (integer_t)index];
+}
+
+static bool
+cms_compatible(CountMinSketch_t *sketch1, CountMinSketch_t *sketch2)
+{
+    return sketch1 != sketch2
+           && sketch1->width == sketch2->width
+           && sketch1->depth == sketch2->depth
+           && sketch1->hash == sketch2->hash;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -7,6 +7,8 @@
  */
 
 #include "DequeArray.h"
+#include "Bulk.h"
+#include "Trace.h"
 
 /// A DequeArray_s is a buffered Deque_s with enqueue and dequeue operations on
 /// both ends that are represented by indexes. The deque is implemented as a
@@ -18,6 +20,12 @@
 /// portion; otherwise it will shift the right portion to the end of the
 /// buffer. This effectively decreases the amount of shifts needed.
 ///
+/// The buffer can be grown ahead of time with dqa_reserve(). With
+/// dqa_set_shrink() the buffer is halved when it is only a quarter full, so
+/// memory is given back after bursts without alternating between growing and
+/// shrinking. A deque that must never copy its elements when growing can use
+/// a DequeList_s with bigger nodes instead (see dql_set_chunk()).
+///
 /// \par Advantages over DequeList_s
 /// - Fast insertion
 /// - No need of pointers, only the data is allocated in memory
@@ -63,18 +71,33 @@ struct DequeArray_s
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
 
+    /// \brief How the new capacity is calculated, see GrowthPolicy_e.
+    GrowthPolicy policy;
+
+    /// \brief Amount of elements added by DS_GROWTH_STEP.
+    integer_t step;
+
     /// \brief Flag for locked capacity.
     ///
     /// If \c locked is set to true the buffer will not grow and insertions
     /// won't be successful once the buffer gets filled up.
     bool locked;
 
+    /// \brief Flag for shrinking the buffer when it is mostly empty.
+    bool shrink;
+
+    /// \brief The buffer is never shrunk below this capacity.
+    ///
+    /// The initial capacity of the deque.
+    integer_t minimum;
+
     /// \brief DequeArray_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -82,6 +105,7 @@ struct DequeArray_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
@@ -93,6 +117,26 @@ const unsigned_t dqa_size = sizeof(DequeArray_t);
 bool
 static dqa_grow(DequeArray_t *deque);
 
+static bool
+dqa_resize(DequeArray_t *deque, integer_t capacity);
+
+static void
+dqa_shrink(DequeArray_t *deque);
+
+static void
+dqa_linearize(DequeArray_t *deque);
+
+static bool
+dqa_make_room(DequeArray_t *deque, integer_t size);
+
+static void
+dqa_copy_in(DequeArray_t *deque, integer_t index, void **elements,
+            integer_t size);
+
+static void
+dqa_copy_out(DequeArray_t *deque, integer_t index, void **result,
+             integer_t size);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a DequeArray_s with an initial capacity of 32 and a growth rate
@@ -112,7 +156,7 @@ dqa_new(Interface_t *interface)
     if (!deque)
         return NULL;
 
-    deque->buffer = malloc(sizeof(void*) * 32);
+    deque->buffer = ds_buffer_alloc(sizeof(void*) * 32);
 
     if (!(deque->buffer))
     {
@@ -125,11 +169,15 @@ dqa_new(Interface_t *interface)
 
     deque->capacity = 32;
     deque->growth_rate = 200;
-    deque->version_id = 0;
+    DS_VERSION_RESET(deque);
     deque->count = 0;
     deque->front = 0;
     deque->rear = 0;
     deque->locked = false;
+    deque->shrink = false;
+    deque->policy = DS_GROWTH_GEOMETRIC;
+    deque->step = 0;
+    deque->minimum = 32;
 
     deque->interface = interface;
 
@@ -155,7 +203,8 @@ dqa_init(DequeArray_t *deque, Interface_t *interface,
     if (growth_rate <= 100 || initial_capacity <= 0)
         return false;
 
-    deque->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    deque->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!deque->buffer)
         return false;
@@ -165,11 +214,15 @@ dqa_init(DequeArray_t *deque, Interface_t *interface,
 
     deque->capacity = initial_capacity;
     deque->growth_rate = growth_rate;
-    deque->version_id = 0;
+    DS_VERSION_RESET(deque);
     deque->count = 0;
     deque->front = 0;
     deque->rear = 0;
     deque->locked = false;
+    deque->shrink = false;
+    deque->policy = DS_GROWTH_GEOMETRIC;
+    deque->step = 0;
+    deque->minimum = initial_capacity;
     deque->interface = interface;
 
     return true;
@@ -204,7 +257,8 @@ dqa_create(Interface_t *interface, integer_t initial_capacity,
     if (!deque)
         return NULL;
 
-    deque->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    deque->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!(deque->buffer))
     {
@@ -217,11 +271,15 @@ dqa_create(Interface_t *interface, integer_t initial_capacity,
 
     deque->capacity = initial_capacity;
     deque->growth_rate = growth_rate;
-    deque->version_id = 0;
+    DS_VERSION_RESET(deque);
     deque->count = 0;
     deque->front = 0;
     deque->rear = 0;
     deque->locked = false;
+    deque->shrink = false;
+    deque->policy = DS_GROWTH_GEOMETRIC;
+    deque->step = 0;
+    deque->minimum = initial_capacity;
 
     deque->interface = interface;
 
@@ -241,7 +299,7 @@ dqa_free(DequeArray_t *deque)
          j < deque->count;
          i = (i + 1) % deque->capacity, j++)
     {
-        deque->interface->free(deque->buffer[i]);
+        interface_release(deque->interface, deque->buffer[i]);
     }
 
     free(deque->buffer);
@@ -278,7 +336,7 @@ dqa_erase(DequeArray_t *deque)
          j < deque->count;
          i = (i + 1) % deque->capacity, j++)
     {
-        deque->interface->free(deque->buffer[i]);
+        interface_release(deque->interface, deque->buffer[i]);
 
         deque->buffer[i] = NULL;
     }
@@ -286,7 +344,7 @@ dqa_erase(DequeArray_t *deque)
     deque->count = 0;
     deque->front = 0;
     deque->rear = 0;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
 }
 
 /// This function will reset the DequeArray_s, freeing all of its nodes but not
@@ -309,7 +367,7 @@ dqa_erase_shallow(DequeArray_t *deque)
     deque->count = 0;
     deque->front = 0;
     deque->rear = 0;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
 }
 
 /// Sets a new interface for the specified DequeArray_s.
@@ -363,6 +421,19 @@ dqa_growth(DequeArray_t *deque)
     return deque->growth_rate;
 }
 
+/// Returns how the buffer grows.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The target deque.
+///
+/// \return The buffer's growth policy.
+GrowthPolicy
+dqa_policy(DequeArray_t *deque)
+{
+    return deque->policy;
+}
+
 /// Returns the boolean state of \c locked member.
 /// \par Interface Requirements
 /// - None
@@ -416,6 +487,80 @@ dqa_capacity_unlock(DequeArray_t *deque)
     deque->locked = false;
 }
 
+/// Sets how the buffer grows. The buffer is grown with realloc(), so a big
+/// buffer can often be extended in place; DS_GROWTH_PAGES makes that more
+/// likely for buffers mapped directly by the allocator.
+///
+/// \param[in] deque The target deque.
+/// \param[in] policy The new growth policy.
+/// \param[in] step Amount of elements added on each growth by
+/// DS_GROWTH_STEP. Ignored by the other policies.
+///
+/// \return True if the policy was changed or false if the step is less than
+/// 1 for DS_GROWTH_STEP.
+bool
+dqa_set_policy(DequeArray_t *deque, GrowthPolicy policy, integer_t step)
+{
+    if (policy == DS_GROWTH_STEP && step < 1)
+        return false;
+
+    deque->policy = policy;
+    deque->step = step;
+
+    return true;
+}
+
+/// Makes the deque shrink its buffer to half of its capacity whenever it is a
+/// quarter full after a dequeue, but never below its initial capacity. Since
+/// the buffer is then half full, it takes many operations before it has to
+/// grow or shrink again.
+///
+/// \param[in] deque The target deque.
+/// \param[in] shrink True to shrink the buffer automatically.
+void
+dqa_set_shrink(DequeArray_t *deque, bool shrink)
+{
+    deque->shrink = shrink;
+}
+
+/// Makes sure that the deque can hold at least a given amount of elements
+/// without growing. This works even if the capacity is locked.
+///
+/// \param[in] deque The target deque.
+/// \param[in] capacity Amount of elements the deque must be able to hold.
+///
+/// \return True if the buffer is big enough or false if allocation failed.
+bool
+dqa_reserve(DequeArray_t *deque, integer_t capacity)
+{
+    if (capacity <= deque->capacity)
+        return true;
+
+    if (!dqa_resize(deque, capacity))
+        return false;
+
+    DS_VERSION_BUMP(deque);
+
+    return true;
+}
+
+/// Reallocates the buffer to the smallest capacity that holds every element.
+/// An empty deque keeps a capacity of one.
+///
+/// \param[in] deque The target deque.
+///
+/// \return True if the buffer was shrunk or false if allocation failed.
+bool
+dqa_shrink_to_fit(DequeArray_t *deque)
+{
+    if (!dqa_resize(deque, deque->count > 0 ? deque->count : 1))
+        return false;
+
+    DS_VERSION_BUMP(deque);
+
+    return true;
+}
+
 /// Inserts an element to the front of the specified deque.
 /// \par Interface Requirements
 /// - None
@@ -428,10 +573,15 @@ dqa_capacity_unlock(DequeArray_t *deque)
 bool
 dqa_enqueue_front(DequeArray_t *deque, void *element)
 {
+    DS_TRACE_ENTRY(dqa_enqueue_front, deque->count);
+
     if (dqa_full(deque))
     {
         if (!dqa_grow(deque))
+        {
+            DS_TRACE_RETURN(dqa_enqueue_front, deque->count);
             return false;
+        }
     }
 
     deque->front = (deque->front == 0) ? deque->capacity - 1 : deque->front -1;
@@ -439,7 +589,9 @@ dqa_enqueue_front(DequeArray_t *deque, void *element)
     deque->buffer[deque->front] = element;
 
     deque->count++;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
+
+    DS_TRACE_RETURN(dqa_enqueue_front, deque->count);
 
     return true;
 }
@@ -456,10 +608,15 @@ dqa_enqueue_front(DequeArray_t *deque, void *element)
 bool
 dqa_enqueue_rear(DequeArray_t *deque, void *element)
 {
+    DS_TRACE_ENTRY(dqa_enqueue_rear, deque->count);
+
     if (dqa_full(deque))
     {
         if (!dqa_grow(deque))
+        {
+            DS_TRACE_RETURN(dqa_enqueue_rear, deque->count);
             return false;
+        }
     }
 
     deque->buffer[deque->rear] = element;
@@ -467,7 +624,9 @@ dqa_enqueue_rear(DequeArray_t *deque, void *element)
     deque->rear = (deque->rear == deque->capacity - 1) ? 0 : deque->rear + 1;
 
     deque->count++;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
+
+    DS_TRACE_RETURN(dqa_enqueue_rear, deque->count);
 
     return true;
 }
@@ -484,10 +643,15 @@ dqa_enqueue_rear(DequeArray_t *deque, void *element)
 bool
 dqa_dequeue_front(DequeArray_t *deque, void **result)
 {
+    DS_TRACE_ENTRY(dqa_dequeue_front, deque->count);
+
     *result = NULL;
 
     if (dqa_empty(deque))
+    {
+        DS_TRACE_RETURN(dqa_dequeue_front, deque->count);
         return false;
+    }
 
     *result = deque->buffer[deque->front];
 
@@ -496,7 +660,11 @@ dqa_dequeue_front(DequeArray_t *deque, void **result)
     deque->front = (deque->front == deque->capacity - 1) ? 0 : deque->front +1;
 
     deque->count--;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
+
+    dqa_shrink(deque);
+
+    DS_TRACE_RETURN(dqa_dequeue_front, deque->count);
 
     return true;
 }
@@ -513,10 +681,15 @@ dqa_dequeue_front(DequeArray_t *deque, void **result)
 bool
 dqa_dequeue_rear(DequeArray_t *deque, void **result)
 {
+    DS_TRACE_ENTRY(dqa_dequeue_rear, deque->count);
+
     *result = NULL;
 
     if (dqa_empty(deque))
+    {
+        DS_TRACE_RETURN(dqa_dequeue_rear, deque->count);
         return false;
+    }
 
     deque->rear = (deque->rear == 0) ? deque->capacity - 1 : deque->rear - 1;
 
@@ -525,11 +698,142 @@ dqa_dequeue_rear(DequeArray_t *deque, void **result)
     deque->buffer[deque->rear] = NULL;
 
     deque->count--;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
+
+    dqa_shrink(deque);
+
+    DS_TRACE_RETURN(dqa_dequeue_rear, deque->count);
+
+    return true;
+}
+
+/// Inserts a buffer of elements at the front of the specified deque keeping
+/// their order, so the first element of the buffer becomes the front. The
+/// capacity is checked once and the elements are copied with at most two
+/// memcpy() calls. Either every element is inserted or none of them.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque where the elements are to be inserted.
+/// \param[in] elements The elements to be inserted in the deque.
+/// \param[in] size The amount of elements in the buffer.
+///
+/// \return True if every element was added to the deque or false if the
+/// buffer reallocation failed or the deque buffer capacity is locked.
+bool
+dqa_enqueue_front_n(DequeArray_t *deque, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return size == 0;
+
+    if (!dqa_make_room(deque, size))
+        return false;
+
+    deque->front = (deque->front - size + deque->capacity) % deque->capacity;
+
+    dqa_copy_in(deque, deque->front, elements, size);
+
+    deque->count += size;
+    DS_VERSION_BUMP(deque);
+
+    return true;
+}
+
+/// Inserts a buffer of elements at the rear of the specified deque keeping
+/// their order, so the last element of the buffer becomes the rear. The
+/// capacity is checked once and the elements are copied with at most two
+/// memcpy() calls. Either every element is inserted or none of them.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque where the elements are to be inserted.
+/// \param[in] elements The elements to be inserted in the deque.
+/// \param[in] size The amount of elements in the buffer.
+///
+/// \return True if every element was added to the deque or false if the
+/// buffer reallocation failed or the deque buffer capacity is locked.
+bool
+dqa_enqueue_rear_n(DequeArray_t *deque, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return size == 0;
+
+    if (!dqa_make_room(deque, size))
+        return false;
+
+    dqa_copy_in(deque, deque->rear, elements, size);
+
+    deque->rear = (deque->rear + size) % deque->capacity;
+
+    deque->count += size;
+    DS_VERSION_BUMP(deque);
 
     return true;
 }
 
+/// Removes up to \c max elements from the front of the specified deque with
+/// at most two memcpy() calls. The first element in \c result is the old
+/// front, so giving that buffer to dqa_enqueue_front_n() restores the deque.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque where the elements are to be removed from.
+/// \param[out] result A buffer with room for at least \c max elements.
+/// \param[in] max The maximum amount of elements to be removed.
+///
+/// \return The amount of elements removed.
+integer_t
+dqa_dequeue_front_n(DequeArray_t *deque, void **result, integer_t max)
+{
+    integer_t size = deque->count < max ? deque->count : max;
+
+    if (size <= 0)
+        return 0;
+
+    dqa_copy_out(deque, deque->front, result, size);
+
+    deque->front = (deque->front + size) % deque->capacity;
+
+    deque->count -= size;
+    DS_VERSION_BUMP(deque);
+
+    dqa_shrink(deque);
+
+    return size;
+}
+
+/// Removes up to \c max elements from the rear of the specified deque with at
+/// most two memcpy() calls. The elements keep the order they had in the
+/// deque, so the old rear is the last one in \c result and giving that buffer
+/// to dqa_enqueue_rear_n() restores the deque.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque where the elements are to be removed from.
+/// \param[out] result A buffer with room for at least \c max elements.
+/// \param[in] max The maximum amount of elements to be removed.
+///
+/// \return The amount of elements removed.
+integer_t
+dqa_dequeue_rear_n(DequeArray_t *deque, void **result, integer_t max)
+{
+    integer_t size = deque->count < max ? deque->count : max;
+
+    if (size <= 0)
+        return 0;
+
+    deque->rear = (deque->rear - size + deque->capacity) % deque->capacity;
+
+    dqa_copy_out(deque, deque->rear, result, size);
+
+    deque->count -= size;
+    DS_VERSION_BUMP(deque);
+
+    dqa_shrink(deque);
+
+    return size;
+}
+
 /// Returns the element at the front of the deque or NULL if the deque is
 /// empty.
 ///
@@ -645,13 +949,18 @@ dqa_copy(DequeArray_t *deque)
          j < deque->count;
          i = (i + 1) % deque->capacity, j++)
     {
-        new_deque->buffer[i] = deque->interface->copy(deque->buffer[i]);
+        new_deque->buffer[i] =
+                interface_copy(deque->interface, deque->buffer[i]);
     }
 
     new_deque->front = deque->front;
     new_deque->rear = deque->rear;
     new_deque->count = deque->count;
     new_deque->locked = deque->locked;
+    new_deque->shrink = deque->shrink;
+    new_deque->policy = deque->policy;
+    new_deque->step = deque->step;
+    new_deque->minimum = deque->minimum;
 
     return new_deque;
 }
@@ -684,6 +993,10 @@ dqa_copy_shallow(DequeArray_t *deque)
     new_deque->rear = deque->rear;
     new_deque->count = deque->count;
     new_deque->locked = deque->locked;
+    new_deque->shrink = deque->shrink;
+    new_deque->policy = deque->policy;
+    new_deque->step = deque->step;
+    new_deque->minimum = deque->minimum;
 
     return new_deque;
 }
@@ -742,7 +1055,23 @@ dqa_compare(DequeArray_t *deque1, DequeArray_t *deque2)
 bool
 dqa_append(DequeArray_t *deque1, DequeArray_t *deque2)
 {
-    /// \todo dqa_append
+    if (deque1 == deque2)
+        return false;
+
+    // Makes room once so that no span below fails to be inserted
+    if (!dqa_make_room(deque1, deque2->count))
+        return false;
+
+    void **span;
+
+    for (integer_t position = 0, size;
+         (size = dqa_span(deque2, position, &span)) > 0; position += size)
+    {
+        dqa_enqueue_rear_n(deque1, span, size);
+    }
+
+    dqa_erase_shallow(deque2);
+
     return true;
 }
 
@@ -758,7 +1087,24 @@ dqa_append(DequeArray_t *deque1, DequeArray_t *deque2)
 bool
 dqa_prepend(DequeArray_t *deque1, DequeArray_t *deque2)
 {
-    /// \todo dqa_prepend
+    if (deque1 == deque2)
+        return false;
+
+    if (!dqa_make_room(deque1, deque2->count))
+        return false;
+
+    // The buffer of deque2 has at most two spans; the second one goes in
+    // first so that both keep their order
+    void **head, **tail;
+
+    integer_t size = dqa_span(deque2, 0, &head);
+    integer_t rest = dqa_span(deque2, size, &tail);
+
+    dqa_enqueue_front_n(deque1, tail, rest);
+    dqa_enqueue_front_n(deque1, head, size);
+
+    dqa_erase_shallow(deque2);
+
     return true;
 }
 
@@ -787,7 +1133,7 @@ dqa_to_array(DequeArray_t *deque, integer_t *length)
          j < deque->count;
          i = (i + 1) % deque->capacity, j++)
     {
-        array[i] = deque->interface->copy(deque->buffer[i]);
+        array[j] = interface_copy(deque->interface, deque->buffer[i]);
     }
 
     *length = deque->count;
@@ -795,6 +1141,206 @@ dqa_to_array(DequeArray_t *deque, integer_t *length)
     return array;
 }
 
+/// Moves all the elements of the deque to a C array, from the front element
+/// to the rear element, leaving the deque empty. Unlike dqa_to_array() the
+/// elements are not copied, so they now belong to the caller.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque to be emptied.
+/// \param[out] length The resulting array's length.
+///
+/// \return The resulting array or NULL if the deque is empty or the array
+/// allocation failed, in which case the deque is left intact.
+void **
+dqa_to_array_move(DequeArray_t *deque, integer_t *length)
+{
+    *length = 0;
+
+    if (dqa_empty(deque))
+        return NULL;
+
+    void **array = malloc(sizeof(void*) * (size_t)deque->count);
+
+    if (!array)
+        return NULL;
+
+    *length = dqa_dequeue_front_n(deque, array, deque->count);
+
+    return array;
+}
+
+/// Gives direct access to the elements stored contiguously from \c position,
+/// counting from the front of the deque. The circular buffer holds at most
+/// two spans, one up to the end of the buffer and one from its start.
+/// Calling this function again with \c position advanced by the returned
+/// amount visits both in order.
+/// The span is invalidated by any change to the deque.
+///
+/// \param[in] deque DequeArray_s reference.
+/// \param[in] position Position of the first element of the span, counting
+/// from the front.
+/// \param[out] span Set to the first element of the span.
+///
+/// \return The amount of elements in the span or 0 if \c position is out of
+/// bounds.
+integer_t
+dqa_span(DequeArray_t *deque, integer_t position, void ***span)
+{
+    *span = NULL;
+
+    if (position < 0 || position >= deque->count)
+        return 0;
+
+    integer_t index = (deque->front + position) % deque->capacity;
+
+    *span = deque->buffer + index;
+
+    // Up to the end of the elements or of the buffer, whichever comes first
+    return deque->count - position < deque->capacity - index
+           ? deque->count - position : deque->capacity - index;
+}
+
+/// Calls \c visit with every element of the deque and \c argument. With
+/// a \c pool the elements are visited in no particular order by several
+/// threads at once; otherwise they are visited from the front to the rear.
+///
+/// \param[in] deque DequeArray_s reference.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument passed to \c visit.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+dqa_for_each(DequeArray_t *deque, visit_f visit, void *argument,
+             ThreadPool_t *pool)
+{
+    void **span;
+
+    for (integer_t position = 0, length;
+         (length = dqa_span(deque, position, &span)) > 0; position += length)
+        blk_for_each(span, length, visit, argument, pool);
+}
+
+/// Makes a new DequeArray_s with the elements made by \c map out of each
+/// element of the deque, in the same order. The new deque uses \c interface,
+/// which may be of another type of element. With a \c pool the work is split
+/// between its threads, see the functions of Bulk.h; otherwise it runs in the
+/// calling thread.
+///
+/// \par Interface Requirements
+/// - free (of the new interface)
+///
+/// \param[in] deque DequeArray_s reference.
+/// \param[in] interface The interface of the new deque.
+/// \param[in] map The function that makes each new element.
+/// \param[in] argument An argument passed to \c map.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return A new DequeArray_s or NULL if allocation failed or if \c map
+/// returned NULL for any element.
+DequeArray_t *
+dqa_map(DequeArray_t *deque, Interface_t *interface, map_f map, void *argument,
+        ThreadPool_t *pool)
+{
+    DequeArray_t *result = dqa_create(interface,
+                                      deque->count > 0 ? deque->count : 1,
+                                      deque->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    void **span;
+    bool mapped = true;
+
+    // Both halves of the circular buffer go to the start of the new one
+    for (integer_t position = 0, length;
+         (length = dqa_span(deque, position, &span)) > 0; position += length)
+    {
+        if (!blk_map(span, result->buffer + position, length, map, argument,
+                     pool))
+            mapped = false;
+    }
+
+    if (!mapped)
+    {
+        for (integer_t i = 0; i < deque->count; i++)
+        {
+            if (result->buffer[i])
+                interface_release(interface, result->buffer[i]);
+        }
+
+        dqa_free_shallow(result);
+
+        return NULL;
+    }
+
+    result->count = deque->count;
+    result->rear = deque->count % result->capacity;
+
+    return result;
+}
+
+/// Removes every element of the deque for which \c keep returns false,
+/// releasing it with the interface's free function. The elements that are kept
+/// stay in the same order, moved to the start of the buffer. With a \c pool the
+/// work is split between its threads, see the functions of Bulk.h; otherwise it
+/// runs in the calling thread.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] deque DequeArray_s reference.
+/// \param[in] keep Returns true for the elements that are kept.
+/// \param[in] argument An argument passed to \c keep.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return The amount of elements removed.
+integer_t
+dqa_filter_in_place(DequeArray_t *deque, predicate_f keep, void *argument,
+                    ThreadPool_t *pool)
+{
+    dqa_linearize(deque);
+
+    integer_t removed = blk_filter(deque->buffer, deque->count, keep, argument,
+                                   deque->interface, true, pool);
+
+    for (integer_t i = deque->count - removed; i < deque->count; i++)
+        deque->buffer[i] = NULL;
+
+    deque->count -= removed;
+    deque->rear = deque->count % deque->capacity;
+    DS_VERSION_BUMP(deque);
+
+    dqa_shrink(deque);
+
+    return removed;
+}
+
+/// Folds every element of the deque into \c accumulator with \c reduce.
+/// With a \c pool, parts of the deque are folded into copies of
+/// \c identity and then into \c accumulator with \c combine, see
+/// blk_reduce().
+///
+/// \param[in] deque DequeArray_s reference.
+/// \param[in,out] accumulator The initial value and the result.
+/// \param[in] identity The initial value of each partial result.
+/// \param[in] accumulator_size Size in bytes of the accumulator.
+/// \param[in] reduce Folds an element into an accumulator.
+/// \param[in] combine Folds a partial result into an accumulator.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+dqa_reduce(DequeArray_t *deque, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool)
+{
+    void **span;
+
+    for (integer_t position = 0, length;
+         (length = dqa_span(deque, position, &span)) > 0; position += length)
+        blk_reduce(span, length, accumulator, identity, accumulator_size,
+                   reduce, combine, pool);
+}
+
+#ifndef DS_NO_DISPLAY
 /// Displays a DequeArray_s in the console starting from the front element to
 /// the rear element. There are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -868,6 +1414,7 @@ dqa_display(DequeArray_t *deque, int display_mode)
             break;
     }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
@@ -876,26 +1423,31 @@ dqa_display(DequeArray_t *deque, int display_mode)
 bool
 static dqa_grow(DequeArray_t *deque)
 {
+    DS_TRACE_ENTRY(dqa_grow, deque->capacity);
+
     if (deque->locked)
+    {
+        DS_TRACE_RETURN(dqa_grow, deque->capacity);
         return false;
+    }
 
     integer_t old_capacity = deque->capacity;
 
-    // capacity = capacity * (growth_rate / 100)
-    deque->capacity = (integer_t) ((double) (deque->capacity)
-            * ((double) (deque->growth_rate) / 100.0));
-
-    // 4 is the minimum growth
-    if (deque->capacity - old_capacity < 4)
-        deque->capacity = old_capacity + 4;
+    deque->capacity = ds_grown_capacity(deque->policy, old_capacity, 0,
+                                        deque->growth_rate, deque->step,
+                                        sizeof(void*));
 
-    void **new_buffer = realloc(deque->buffer,
+    void **new_buffer = ds_buffer_realloc(deque->buffer,
+            sizeof(void*) * (size_t)old_capacity,
             sizeof(void*) * (size_t)deque->capacity);
 
     // Reallocation failed
     if (!new_buffer)
     {
         deque->capacity = old_capacity;
+
+        DS_TRACE_RETURN(dqa_grow, deque->capacity);
+
         return false;
     }
 
@@ -952,11 +1504,130 @@ static dqa_grow(DequeArray_t *deque)
     // This should never happen. This function should never be called when the
     // buffer is not full (front == rear and count == capacity).
     else
+    {
+        DS_TRACE_RETURN(dqa_grow, deque->capacity);
         return false;
+    }
+
+    DS_TRACE_RETURN(dqa_grow, deque->capacity);
 
     return true;
 }
 
+// Moves every element to the start of a new buffer. The capacity must be at
+// least the amount of elements in the deque.
+static bool
+dqa_resize(DequeArray_t *deque, integer_t capacity)
+{
+    void **buffer = ds_buffer_alloc(sizeof(void*) * (size_t)capacity);
+
+    if (!buffer)
+        return false;
+
+    for (integer_t i = deque->front, j = 0;
+         j < deque->count;
+         i = (i + 1) % deque->capacity, j++)
+    {
+        buffer[j] = deque->buffer[i];
+    }
+
+    for (integer_t i = deque->count; i < capacity; i++)
+        buffer[i] = NULL;
+
+    free(deque->buffer);
+
+    deque->buffer = buffer;
+    deque->capacity = capacity;
+    deque->front = 0;
+    deque->rear = deque->count == capacity ? 0 : deque->count;
+
+    return true;
+}
+
+// Shrinking at a quarter to half of the capacity leaves room for both
+// insertions and removals before the next reallocation
+static void
+dqa_shrink(DequeArray_t *deque)
+{
+    if (deque->shrink && deque->count <= deque->capacity / 4 &&
+        deque->capacity / 2 >= deque->minimum)
+    {
+        dqa_resize(deque, deque->capacity / 2);
+    }
+}
+
+// Rotates the buffer in place so that the front element is at its start
+static void
+dqa_linearize(DequeArray_t *deque)
+{
+    if (deque->front == 0)
+        return;
+
+    // Rotating left by front is reversing both parts and then the whole
+    integer_t bounds[3][2] = { { 0, deque->front - 1 },
+                               { deque->front, deque->capacity - 1 },
+                               { 0, deque->capacity - 1 } };
+
+    for (int k = 0; k < 3; k++)
+    {
+        for (integer_t i = bounds[k][0], j = bounds[k][1]; i < j; i++, j--)
+        {
+            void *temp = deque->buffer[i];
+            deque->buffer[i] = deque->buffer[j];
+            deque->buffer[j] = temp;
+        }
+    }
+
+    deque->front = 0;
+    deque->rear = deque->count % deque->capacity;
+}
+
+// Grows the buffer once so that a given amount of elements fits, by the
+// growth policy or more
+static bool
+dqa_make_room(DequeArray_t *deque, integer_t size)
+{
+    if (dqa_fits(deque, (unsigned_t)size))
+        return true;
+
+    if (deque->locked)
+        return false;
+
+    integer_t capacity = ds_grown_capacity(deque->policy, deque->capacity,
+                                           deque->count + size,
+                                           deque->growth_rate, deque->step,
+                                           sizeof(void*));
+
+    return dqa_resize(deque, capacity);
+}
+
+// Copies elements into the buffer starting at a given index. The part that
+// doesn't fit before the end of the buffer goes to its start.
+static void
+dqa_copy_in(DequeArray_t *deque, integer_t index, void **elements,
+            integer_t size)
+{
+    integer_t head = deque->capacity - index < size ? deque->capacity - index
+                                                    : size;
+
+    memcpy(deque->buffer + index, elements, sizeof(void*) * (size_t)head);
+    memcpy(deque->buffer, elements + head,
+           sizeof(void*) * (size_t)(size - head));
+}
+
+// Copies elements out of the buffer starting at a given index
+static void
+dqa_copy_out(DequeArray_t *deque, integer_t index, void **result,
+             integer_t size)
+{
+    integer_t head = deque->capacity - index < size ? deque->capacity - index
+                                                    : size;
+
+    memcpy(result, deque->buffer + index, sizeof(void*) * (size_t)head);
+    memcpy(result + head, deque->buffer,
+           sizeof(void*) * (size_t)(size - head));
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,14 @@
 /// - More memory usage as in every node there are two pointers to the
 /// neighbouring nodes
 ///
+/// Each node holds \c chunk elements, one by default. With dql_set_chunk() a
+/// node can hold many elements, turning the deque into a list of blocks much
+/// like the block map of a \c std::deque, so enqueuing at either end only
+/// allocates once every \c chunk elements. Only the front and the rear nodes
+/// can be partially filled. The last node emptied by a dequeue is kept as a
+/// spare and reused by the next node allocation. An empty deque holds no
+/// nodes.
+///
 /// \par Functions
 /// Located in the file DequeList.c
 struct DequeList_s
@@ -34,6 +42,7 @@ struct DequeList_s
     /// Current amount of elements in the DequeList_s.
     integer_t count;
 
+#ifndef DS_NO_LIMIT
     /// \brief DequeList length limit.
     ///
     /// If it is set to 0 or a negative value then the deque has no limit to
@@ -43,6 +52,7 @@ struct DequeList_s
     /// limit the deque length if it already has more elements than the
     /// specified limit.
     integer_t limit;
+#endif
 
     /// \brief Points to the first Node on the deque.
     ///
@@ -51,15 +61,38 @@ struct DequeList_s
 
     /// \brief Points to the last Node on the deque.
     ///
-    /// Points to the first Node on the deque or \c NULL if the deque is empty.
+    /// Points to the last Node on the deque or \c NULL if the deque is empty.
     struct DequeListNode_s *rear;
 
+    /// \brief Index of the front element in the front node.
+    integer_t head;
+
+    /// \brief Index after the rear element in the rear node.
+    integer_t tail;
+
+    /// \brief Amount of elements each node holds.
+    ///
+    /// Set with dql_set_chunk(). It is 1 by default.
+    integer_t chunk;
+
+    /// \brief An empty node kept to be reused.
+    ///
+    /// NULL if there is no spare node.
+    struct DequeListNode_s *spare;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief DequeList_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -67,6 +100,7 @@ struct DequeList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
@@ -75,16 +109,12 @@ const unsigned_t dql_size = sizeof(DequeList_t);
 
 /// \brief A DequeList_s node.
 ///
-/// Implementation detail. This is a doubly-linked node with a pointer to the
-/// previous node (or \c NULL if it is the front node) and another pointer to
-/// the next node (or \c NULL if it is the rear node).
+/// Implementation detail. This is a doubly-linked node with \c chunk data
+/// members, a pointer to the previous node (or \c NULL if it is the front
+/// node) and another pointer to the next node (or \c NULL if it is the rear
+/// node).
 struct DequeListNode_s
 {
-    /// \brief Data pointer.
-    ///
-    /// Points to node's data. The data needs to be dynamically allocated.
-    void *data;
-
     /// \brief Next node on the deque.
     ///
     /// Next node on the deque or \c NULL if this is the rear node.
@@ -94,6 +124,12 @@ struct DequeListNode_s
     ///
     /// Previous node on the deque or \c NULL if this is the front node.
     struct DequeListNode_s *prev;
+
+    /// \brief Data pointers.
+    ///
+    /// Points to the node's data, from the front to the rear. The data needs
+    /// to be dynamically allocated.
+    void *data[];
 };
 
 /// \brief A type for a deque node.
@@ -109,13 +145,19 @@ typedef struct DequeListNode_s *DequeListNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static DequeListNode_t *
-dql_new_node(void *element);
+dql_new_node(DequeList_t *deque);
+
+static void
+dql_free_node(DequeList_t *deque, DequeListNode_t *node);
 
 static void
-dql_free_node(DequeListNode_t *node, free_f function);
+dql_free_nodes(DequeList_t *deque, free_f function);
 
 static void
-dql_free_node_shallow(DequeListNode_t *node);
+dql_free_spare(DequeList_t *deque);
+
+static size_t
+dql_node_size(integer_t chunk);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -136,13 +178,7 @@ dql_new(Interface_t *interface)
     if (!deque)
         return NULL;
 
-    deque->count = 0;
-    deque->limit = 0;
-    deque->version_id = 0;
-    deque->front = NULL;
-    deque->rear = NULL;
-
-    deque->interface = interface;
+    dql_init(deque, interface);
 
     return deque;
 }
@@ -158,10 +194,17 @@ bool
 dql_init(DequeList_t *deque, Interface_t *interface)
 {
     deque->count = 0;
+#ifndef DS_NO_LIMIT
     deque->limit = 0;
-    deque->version_id = 0;
+#endif
+    DS_VERSION_RESET(deque);
     deque->front = NULL;
     deque->rear = NULL;
+    deque->head = 0;
+    deque->tail = 0;
+    deque->chunk = 1;
+    deque->spare = NULL;
+    deque->pool = NULL;
     deque->interface = interface;
 
     return true;
@@ -176,16 +219,7 @@ dql_init(DequeList_t *deque, Interface_t *interface)
 void
 dql_free(DequeList_t *deque)
 {
-    DequeListNode_t *prev = deque->front;
-
-    while (deque->front != NULL)
-    {
-        deque->front = deque->front->prev;
-
-        dql_free_node(prev, deque->interface->free);
-
-        prev = deque->front;
-    }
+    dql_free_nodes(deque, deque->interface->free);
 
     free(deque);
 }
@@ -200,16 +234,7 @@ dql_free(DequeList_t *deque)
 void
 dql_free_shallow(DequeList_t *deque)
 {
-    DequeListNode_t *prev = deque->front;
-
-    while (deque->front != NULL)
-    {
-        deque->front = deque->front->prev;
-
-        dql_free_node_shallow(prev);
-
-        prev = deque->front;
-    }
+    dql_free_nodes(deque, NULL);
 
     free(deque);
 }
@@ -224,21 +249,10 @@ dql_free_shallow(DequeList_t *deque)
 void
 dql_erase(DequeList_t *deque)
 {
-    DequeListNode_t *prev = deque->front;
-
-    while (deque->front != NULL)
-    {
-        deque->front = deque->front->prev;
-
-        dql_free_node(prev, deque->interface->free);
-
-        prev = deque->front;
-    }
+    dql_free_nodes(deque, deque->interface->free);
 
     deque->count = 0;
-    deque->version_id++;
-    deque->front = NULL;
-    deque->rear = NULL;
+    DS_VERSION_BUMP(deque);
 }
 
 /// This function will reset the DequeList_s, freeing all of its nodes but not
@@ -251,21 +265,10 @@ dql_erase(DequeList_t *deque)
 void
 dql_erase_shallow(DequeList_t *deque)
 {
-    DequeListNode_t *prev = deque->front;
-
-    while (deque->front != NULL)
-    {
-        deque->front = deque->front->prev;
-
-        dql_free_node_shallow(prev);
-
-        prev = deque->front;
-    }
+    dql_free_nodes(deque, NULL);
 
     deque->count = 0;
-    deque->version_id++;
-    deque->front = NULL;
-    deque->rear = NULL;
+    DS_VERSION_BUMP(deque);
 }
 
 /// Sets a new interface for the specified DequeList_s.
@@ -293,6 +296,19 @@ dql_count(DequeList_t *deque)
     return deque->count;
 }
 
+/// Returns how many elements each node of the deque holds.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque DequeList_s reference.
+///
+/// \return The amount of elements per node.
+integer_t
+dql_chunk(DequeList_t *deque)
+{
+    return deque->chunk;
+}
+
 /// Returns the current deque limit.
 /// \par Interface Requirements
 /// - None
@@ -303,12 +319,19 @@ dql_count(DequeList_t *deque)
 integer_t
 dql_limit(DequeList_t *deque)
 {
+#ifdef DS_NO_LIMIT
+    (void)deque;
+
+    return 0;
+#else
     return deque->limit;
+#endif
 }
 
 /// Limit's the DequeList_s's length. You can only set a limit greater or equal to
 /// the deque's current length and greater than 0. To remove this limitation
-/// simply set the limit to 0 or less.
+/// simply set the limit to 0 or less. If compiled with DS_NO_LIMIT only 0 or
+/// less is accepted.
 ///
 /// \param[in] deque DequeList_s reference.
 /// \param[in] limit New deque limit.
@@ -318,12 +341,72 @@ dql_limit(DequeList_t *deque)
 bool
 dql_set_limit(DequeList_t *deque, integer_t limit)
 {
+#ifdef DS_NO_LIMIT
+    (void)deque;
+
+    return limit <= 0;
+#else
     // The new limit can't be lower than the deque's current length.
     if (deque->count > limit && limit > 0)
         return false;
 
     deque->limit = limit;
 
+    return true;
+#endif
+}
+
+/// Sets a node pool from where all nodes of the deque are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the deque is empty.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque DequeList_s reference.
+/// \param[in] pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the deque is not empty or if the pool's nodes are too
+/// small.
+bool
+dql_set_pool(DequeList_t *deque, NodePool_t *pool)
+{
+    if (!dql_empty(deque))
+        return false;
+
+    if (pool && !npl_fits(pool, dql_node_size(deque->chunk)))
+        return false;
+
+    deque->pool = pool;
+
+    return true;
+}
+
+/// Sets how many elements each node of the deque holds. Bigger nodes mean
+/// less allocations and less memory used by pointers, at the cost of up to
+/// two partially filled nodes. The chunk can only be changed when the deque
+/// is empty and, if a node pool is set, its nodes must be big enough.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque DequeList_s reference.
+/// \param[in] chunk Amount of elements per node, 1 or more.
+///
+/// \return True if the chunk was set.
+/// \return False if the deque is not empty, if the chunk is less than 1 or if
+/// the pool's nodes are too small.
+bool
+dql_set_chunk(DequeList_t *deque, integer_t chunk)
+{
+    if (!dql_empty(deque) || chunk < 1)
+        return false;
+
+    if (deque->pool && !npl_fits(deque->pool, dql_node_size(chunk)))
+        return false;
+
+    deque->chunk = chunk;
+
     return true;
 }
 
@@ -340,26 +423,35 @@ dql_enqueue_front(DequeList_t *deque, void *element)
     if (dql_full(deque))
         return false;
 
-    DequeListNode_t *node = dql_new_node(element);
+    if (dql_empty(deque) || deque->head == 0)
+    {
+        DequeListNode_t *node = dql_new_node(deque);
 
-    if (!node)
-        return false;
+        if (!node)
+            return false;
 
-    if (dql_empty(deque))
-    {
-        deque->front = node;
-        deque->rear = node;
-    }
-    else
-    {
-        node->prev = deque->front;
+        if (dql_empty(deque))
+        {
+            // Starts in the middle so both ends can grow
+            deque->rear = node;
+            deque->head = (deque->chunk + 1) / 2;
+            deque->tail = deque->head;
+        }
+        else
+        {
+            node->next = deque->front;
+
+            deque->front->prev = node;
+            deque->head = deque->chunk;
+        }
 
-        deque->front->next = node;
         deque->front = node;
     }
 
+    deque->front->data[--deque->head] = element;
+
     deque->count++;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
 
     return true;
 }
@@ -377,26 +469,35 @@ dql_enqueue_rear(DequeList_t *deque, void *element)
     if (dql_full(deque))
         return false;
 
-    DequeListNode_t *node = dql_new_node(element);
+    if (dql_empty(deque) || deque->tail == deque->chunk)
+    {
+        DequeListNode_t *node = dql_new_node(deque);
 
-    if (!node)
-        return false;
+        if (!node)
+            return false;
 
-    if (dql_empty(deque))
-    {
-        deque->front = node;
-        deque->rear = node;
-    }
-    else
-    {
-        node->next = deque->rear;
+        if (dql_empty(deque))
+        {
+            // Starts in the middle so both ends can grow
+            deque->front = node;
+            deque->head = deque->chunk / 2;
+            deque->tail = deque->head;
+        }
+        else
+        {
+            node->prev = deque->rear;
+
+            deque->rear->next = node;
+            deque->tail = 0;
+        }
 
-        deque->rear->prev = node;
         deque->rear = node;
     }
 
+    deque->rear->data[deque->tail++] = element;
+
     deque->count++;
-    deque->version_id++;
+    DS_VERSION_BUMP(deque);
 
     return true;
 }
@@ -418,19 +519,28 @@ dql_dequeue_front(DequeList_t *deque, void **result)
 
     DequeListNode_t *node = deque->front;
 
-    *result = node->data;
+    *result = node->data[deque->head++];
 
-    deque->front = deque->front->prev;
+    deque->count--;
+    DS_VERSION_BUMP(deque);
 
-    if (deque->front == NULL)
-        deque->rear = NULL;
-    else
-        deque->front->next = NULL;
+    if (dql_empty(deque))
+    {
+        // An empty deque holds no nodes
+        npl_node_free(deque->pool, node);
+        dql_free_spare(deque);
 
-    dql_free_node_shallow(node);
+        deque->front = NULL;
+        deque->rear = NULL;
+    }
+    else if (deque->head == deque->chunk)
+    {
+        deque->front = node->next;
+        deque->front->prev = NULL;
+        deque->head = 0;
 
-    deque->count--;
-    deque->version_id++;
+        dql_free_node(deque, node);
+    }
 
     return true;
 }
@@ -452,19 +562,28 @@ dql_dequeue_rear(DequeList_t *deque, void **result)
 
     DequeListNode_t *node = deque->rear;
 
-    *result = node->data;
+    *result = node->data[--deque->tail];
 
-    deque->rear = deque->rear->next;
+    deque->count--;
+    DS_VERSION_BUMP(deque);
 
-    if (deque->rear == NULL)
-        deque->front = NULL;
-    else
-        deque->rear->prev = NULL;
+    if (dql_empty(deque))
+    {
+        // An empty deque holds no nodes
+        npl_node_free(deque->pool, node);
+        dql_free_spare(deque);
 
-    dql_free_node_shallow(node);
+        deque->front = NULL;
+        deque->rear = NULL;
+    }
+    else if (deque->tail == 0)
+    {
+        deque->rear = node->prev;
+        deque->rear->next = NULL;
+        deque->tail = deque->chunk;
 
-    deque->count--;
-    deque->version_id++;
+        dql_free_node(deque, node);
+    }
 
     return true;
 }
@@ -484,7 +603,7 @@ dql_peek_front(DequeList_t *deque)
     if (dql_empty(deque))
         return NULL;
 
-    return deque->front->data;
+    return deque->front->data[deque->head];
 }
 
 /// Returns the element located at the rear of the deque or NULL if the deque
@@ -501,7 +620,7 @@ dql_peek_rear(DequeList_t *deque)
     if (dql_empty(deque))
         return NULL;
 
-    return deque->rear->data;
+    return deque->rear->data[deque->tail - 1];
 }
 
 /// Returns true if the deque is empty, or false if there are elements in the
@@ -530,7 +649,13 @@ dql_empty(DequeList_t *deque)
 bool
 dql_full(DequeList_t *deque)
 {
+#ifdef DS_NO_LIMIT
+    (void)deque;
+
+    return false;
+#else
     return deque->limit > 0 && deque->count >= deque->limit;
+#endif
 }
 
 /// Returns true if the specified size will fit in the deque before it reaches
@@ -545,10 +670,17 @@ dql_full(DequeList_t *deque)
 bool
 dql_fits(DequeList_t *deque, unsigned_t size)
 {
+#ifdef DS_NO_LIMIT
+    (void)deque;
+    (void)size;
+
+    return true;
+#else
     if (deque->limit <= 0)
         return true;
 
     return (deque->count + size) <= deque->limit;
+#endif
 }
 
 /// Returns true if the element is present in the deque, otherwise false.
@@ -564,12 +696,16 @@ dql_contains(DequeList_t *deque, void *key)
 {
     DequeListNode_t *scan = deque->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = deque->head; i < deque->count; i++)
     {
-        if (deque->interface->compare(scan->data, key) == 0)
+        if (deque->interface->compare(scan->data[index], key) == 0)
             return true;
 
-        scan = scan->next;
+        if (++index == deque->chunk)
+        {
+            scan = scan->next;
+            index = 0;
+        }
     }
 
     return false;
@@ -592,39 +728,32 @@ dql_copy(DequeList_t *deque)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = deque->limit;
+#endif
+    result->chunk = deque->chunk;
+    result->pool = deque->pool;
 
     DequeListNode_t *scan = deque->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = deque->head; i < deque->count; i++)
     {
-        void *element = deque->interface->copy(scan->data);
-        DequeListNode_t *copy = dql_new_node(element);
+        void *element = deque->interface->copy(scan->data[index]);
 
-        if (!copy)
+        if (!dql_enqueue_rear(result, element))
         {
             deque->interface->free(element);
-            return false;
+            dql_free(result);
+            return NULL;
         }
 
-        if (result->front == NULL)
+        if (++index == deque->chunk)
         {
-            result->front = copy;
-            result->rear = copy;
+            scan = scan->next;
+            index = 0;
         }
-        else
-        {
-            copy->next = result->rear;
-
-            result->rear->prev = copy;
-            result->rear = copy;
-        }
-
-        scan = scan->next;
     }
 
-    result->count = deque->count;
-
     return result;
 }
 
@@ -644,35 +773,29 @@ dql_copy_shallow(DequeList_t *deque)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = deque->limit;
+#endif
+    result->chunk = deque->chunk;
+    result->pool = deque->pool;
 
     DequeListNode_t *scan = deque->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = deque->head; i < deque->count; i++)
     {
-        DequeListNode_t *copy = dql_new_node(scan->data);
-
-        if (!copy)
-            return false;
-
-        if (result->front == NULL)
+        if (!dql_enqueue_rear(result, scan->data[index]))
         {
-            result->front = copy;
-            result->rear = copy;
+            dql_free_shallow(result);
+            return NULL;
         }
-        else
-        {
-            copy->next = result->rear;
 
-            result->rear->prev = copy;
-            result->rear = copy;
+        if (++index == deque->chunk)
+        {
+            scan = scan->next;
+            index = 0;
         }
-
-        scan = scan->next;
     }
 
-    result->count = deque->count;
-
     return result;
 }
 
@@ -693,17 +816,32 @@ dql_compare(DequeList_t *deque1, DequeList_t *deque2)
 {
     DequeListNode_t *scan1 = deque1->front, *scan2 = deque2->front;
 
+    integer_t index1 = deque1->head, index2 = deque2->head;
+
+    integer_t length = deque1->count < deque2->count ? deque1->count
+                                                     : deque2->count;
+
     int comparison = 0;
-    while (scan1 != NULL && scan2 != NULL)
+    for (integer_t i = 0; i < length; i++)
     {
-        comparison = deque1->interface->compare(scan1->data, scan2->data);
+        comparison = deque1->interface->compare(scan1->data[index1],
+                                                scan2->data[index2]);
         if (comparison > 0)
             return 1;
         else if (comparison < 0)
             return -1;
 
-        scan1 = scan1->prev;
-        scan2 = scan2->prev;
+        if (++index1 == deque1->chunk)
+        {
+            scan1 = scan1->next;
+            index1 = 0;
+        }
+
+        if (++index2 == deque2->chunk)
+        {
+            scan2 = scan2->next;
+            index2 = 0;
+        }
     }
 
     // So far all elements were the same
@@ -772,11 +910,15 @@ dql_to_array(DequeList_t *deque, integer_t *length)
 
     DequeListNode_t *scan = deque->front;
 
-    integer_t i = 0;
-    while (scan != NULL)
+    for (integer_t i = 0, index = deque->head; i < deque->count; i++)
     {
-        array[i++] = deque->interface->copy(scan->data);
-        scan = scan->prev;
+        array[i] = deque->interface->copy(scan->data[index]);
+
+        if (++index == deque->chunk)
+        {
+            scan = scan->next;
+            index = 0;
+        }
     }
 
     *length = deque->count;
@@ -784,6 +926,7 @@ dql_to_array(DequeList_t *deque, integer_t *length)
     return array;
 }
 
+#ifndef DS_NO_DISPLAY
 /// Displays a DequeList_s in the console starting from the front element to
 /// the rear element. There are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -804,65 +947,59 @@ dql_display(DequeList_t *deque, int display_mode)
         return;
     }
 
-    DequeListNode_t *scan = deque->front;
+    const char *begin, *separator, *end;
 
     switch (display_mode)
     {
         case -1:
-            printf("\nDequeList\n");
-            while (scan != NULL)
-            {
-                deque->interface->display(scan->data);
-                printf("\n");
-                scan = scan->prev;
-            }
+            begin = "\nDequeList\n", separator = "\n", end = "\n";
             break;
         case 0:
-            printf("\nDequeList\nFront -> ");
-            while (scan->prev != NULL)
-            {
-                deque->interface->display(scan->data);
-                printf(" -> ");
-                scan = scan->prev;
-            }
-            deque->interface->display(scan->data);
-            printf(" Rear\n");
+            begin = "\nDequeList\nFront -> ", separator = " -> ";
+            end = " Rear\n";
             break;
         case 1:
-            printf("\nDequeList\n");
-            while (scan != NULL)
-            {
-                deque->interface->display(scan->data);
-                printf(" ");
-                scan = scan->prev;
-            }
-            printf("\n");
+            begin = "\nDequeList\n", separator = " ", end = " \n";
             break;
         default:
-            printf("\nDequeList\n[ ");
-            while (scan->prev != NULL)
-            {
-                deque->interface->display(scan->data);
-                printf(", ");
-                scan = scan->prev;
-            }
-            deque->interface->display(scan->data);
-            printf(" ]\n");
+            begin = "\nDequeList\n[ ", separator = ", ", end = " ]\n";
             break;
     }
+
+    printf("%s", begin);
+
+    DequeListNode_t *scan = deque->front;
+
+    for (integer_t i = 0, index = deque->head; i < deque->count; i++)
+    {
+        deque->interface->display(scan->data[index]);
+
+        printf("%s", i < deque->count - 1 ? separator : end);
+
+        if (++index == deque->chunk)
+        {
+            scan = scan->next;
+            index = 0;
+        }
+    }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static DequeListNode_t *
-dql_new_node(void *element)
+dql_new_node(DequeList_t *deque)
 {
-    DequeListNode_t *node = malloc(sizeof(DequeListNode_t));
+    DequeListNode_t *node = deque->spare;
+
+    if (node)
+        deque->spare = NULL;
+    else
+        node = npl_node_alloc(deque->pool, dql_node_size(deque->chunk));
 
     if (!node)
         return NULL;
 
-    node->data = element;
     node->prev = NULL;
     node->next = NULL;
 
@@ -870,16 +1007,61 @@ dql_new_node(void *element)
 }
 
 static void
-dql_free_node(DequeListNode_t *node, free_f function)
+dql_free_node(DequeList_t *deque, DequeListNode_t *node)
 {
-    function(node->data);
-    free(node);
+    if (deque->spare == NULL)
+        deque->spare = node;
+    else
+        npl_node_free(deque->pool, node);
+}
+
+static void
+dql_free_nodes(DequeList_t *deque, free_f function)
+{
+    if (function)
+    {
+        DequeListNode_t *scan = deque->front;
+
+        for (integer_t i = 0, index = deque->head; i < deque->count; i++)
+        {
+            function(scan->data[index]);
+
+            if (++index == deque->chunk)
+            {
+                scan = scan->next;
+                index = 0;
+            }
+        }
+    }
+
+    DequeListNode_t *node = deque->front, *next;
+
+    while (node != NULL)
+    {
+        next = node->next;
+        npl_node_free(deque->pool, node);
+        node = next;
+    }
+
+    deque->front = NULL;
+    deque->rear = NULL;
+
+    dql_free_spare(deque);
 }
 
 static void
-dql_free_node_shallow(DequeListNode_t *node)
+dql_free_spare(DequeList_t *deque)
 {
-    free(node);
+    if (deque->spare)
+        npl_node_free(deque->pool, deque->spare);
+
+    deque->spare = NULL;
+}
+
+static size_t
+dql_node_size(integer_t chunk)
+{
+    return sizeof(DequeListNode_t) + sizeof(void*) * (size_t)chunk;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -889,7 +1071,7 @@ dql_free_node_shallow(DequeListNode_t *node)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// This is a DequeList_s iterator and its cursor is represented by pointing to
-/// the current node in the deque.
+/// the current node in the deque and an index inside of it.
 struct DequeListIterator_s
 {
     /// \brief Target DequeList_s.
@@ -904,6 +1086,13 @@ struct DequeListIterator_s
     /// cursor pointing to the start (front) pointer.
     struct DequeListNode_s *cursor;
 
+    /// \brief Index of the current element inside the cursor node.
+    integer_t index;
+
+    /// \brief Position of the current element, starting at the front.
+    integer_t position;
+
+#ifndef DS_NO_VERSION_ID
     /// \brief Target version ID.
     ///
     /// When the iterator is initialized it stores the version_id of the target
@@ -911,6 +1100,7 @@ struct DequeListIterator_s
     /// that may have been modified and thus causing undefined behaviours or
     /// run-time crashes.
     integer_t target_id;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -936,8 +1126,10 @@ dql_iter_new(DequeList_t *target)
         return NULL;
 
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
     iter->cursor = target->front;
+    iter->index = target->head;
+    iter->position = 0;
 
     return iter;
 }
@@ -949,7 +1141,10 @@ void
 dql_iter_retarget(DequeListIterator_t *iter, DequeList_t *target)
 {
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
+    iter->cursor = target->front;
+    iter->index = target->head;
+    iter->position = 0;
 }
 
 ///
@@ -973,7 +1168,13 @@ dql_iter_next(DequeListIterator_t *iter)
     if (!dql_iter_has_next(iter))
         return false;
 
-    iter->cursor = iter->cursor->next;
+    if (++iter->index == iter->target->chunk)
+    {
+        iter->cursor = iter->cursor->next;
+        iter->index = 0;
+    }
+
+    iter->position++;
 
     return true;
 }
@@ -991,7 +1192,13 @@ dql_iter_prev(DequeListIterator_t *iter)
     if (!dql_iter_has_prev(iter))
         return false;
 
-    iter->cursor = iter->cursor->prev;
+    if (iter->index-- == 0)
+    {
+        iter->cursor = iter->cursor->prev;
+        iter->index = iter->target->chunk - 1;
+    }
+
+    iter->position--;
 
     return true;
 }
@@ -1007,6 +1214,8 @@ dql_iter_to_front(DequeListIterator_t *iter)
         return false;
 
     iter->cursor = iter->target->front;
+    iter->index = iter->target->head;
+    iter->position = 0;
 
     return true;
 }
@@ -1022,6 +1231,8 @@ dql_iter_to_rear(DequeListIterator_t *iter)
         return false;
 
     iter->cursor = iter->target->rear;
+    iter->index = iter->target->tail - 1;
+    iter->position = iter->target->count - 1;
 
     return true;
 }
@@ -1033,7 +1244,7 @@ dql_iter_to_rear(DequeListIterator_t *iter)
 bool
 dql_iter_has_next(DequeListIterator_t *iter)
 {
-    return iter->cursor->next != NULL;
+    return iter->position + 1 < iter->target->count;
 }
 
 ///
@@ -1043,7 +1254,7 @@ dql_iter_has_next(DequeListIterator_t *iter)
 bool
 dql_iter_has_prev(DequeListIterator_t *iter)
 {
-    return iter->cursor->prev != NULL;
+    return iter->position > 0;
 }
 
 ///
@@ -1057,7 +1268,7 @@ dql_iter_get(DequeListIterator_t *iter, void **result)
     if (dql_iter_target_modified(iter))
         return false;
 
-    *result = iter->cursor->data;
+    *result = iter->cursor->data[iter->index];
 
     return true;
 }
@@ -1073,9 +1284,9 @@ dql_iter_set(DequeListIterator_t *iter, void *element)
     if (dql_iter_target_modified(iter))
         return false;
 
-    iter->target->interface->free(iter->cursor->data);
+    iter->target->interface->free(iter->cursor->data[iter->index]);
 
-    iter->cursor->data = element;
+    iter->cursor->data[iter->index] = element;
 
     return true;
 }
@@ -1093,7 +1304,10 @@ dql_iter_peek_next(DequeListIterator_t *iter)
     if (!dql_iter_has_next(iter))
         return NULL;
 
-    return iter->cursor->next->data;
+    if (iter->index + 1 == iter->target->chunk)
+        return iter->cursor->next->data[0];
+
+    return iter->cursor->data[iter->index + 1];
 }
 
 ///
@@ -1106,7 +1320,7 @@ dql_iter_peek(DequeListIterator_t *iter)
     if (dql_iter_target_modified(iter))
         return NULL;
 
-    return iter->cursor->data;
+    return iter->cursor->data[iter->index];
 }
 
 ///
@@ -1122,7 +1336,10 @@ dql_iter_peek_prev(DequeListIterator_t *iter)
     if (!dql_iter_has_prev(iter))
         return NULL;
 
-    return iter->cursor->prev->data;
+    if (iter->index == 0)
+        return iter->cursor->prev->data[iter->target->chunk - 1];
+
+    return iter->cursor->data[iter->index - 1];
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -1130,7 +1347,7 @@ dql_iter_peek_prev(DequeListIterator_t *iter)
 static bool
 dql_iter_target_modified(DequeListIterator_t *iter)
 {
-    return iter->target_id != iter->target->version_id;
+    return DS_VERSION_CHANGED(iter, iter->target);
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
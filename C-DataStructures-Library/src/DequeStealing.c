@@ -0,0 +1,383 @@
+/**
+ * @file DequeStealing.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "DequeStealing.h"
+#include <stdatomic.h>
+
+/// A DequeStealing_s is the Chase-Lev work-stealing deque with the memory
+/// orderings from Lê et al., "Correct and Efficient Work-Stealing for Weak
+/// Memory Models". It splits the operations of a DequeArray_s between one
+/// owner thread and any amount of thieves:
+/// - The owner inserts and removes at the rear with dqs_enqueue_rear() and
+/// dqs_dequeue_rear() without any atomic read-modify-write, except when
+/// racing a thief for the last element;
+/// - Thieves remove from the front with dqs_dequeue_front() using a
+/// compare-and-swap on \c top.
+///
+/// When the buffer is full the owner copies the elements to a buffer twice
+/// as big. Thieves might still be reading the old buffer so it is kept in a
+/// list and only freed by dqs_free().
+///
+/// Elements are only stored as pointers and are never freed by the deque.
+///
+/// \par Functions
+/// Located in the file DequeStealing.c
+struct DequeStealing_s
+{
+    /// \brief Index of the front element.
+    ///
+    /// Incremented by whoever removes the front element.
+    _Alignas(DS_CACHE_LINE) _Atomic(integer_t) top;
+
+    /// \brief Index after the rear element.
+    ///
+    /// Only written by the owner.
+    _Alignas(DS_CACHE_LINE) _Atomic(integer_t) bottom;
+
+    /// \brief Current buffer.
+    _Atomic(struct DequeStealingBuffer_s *) buffer;
+
+    /// \brief Buffers replaced by a bigger one.
+    ///
+    /// Only accessed by the owner.
+    struct DequeStealingBuffer_s *retired;
+
+    /// \brief Amount of compare-and-swap races lost on top.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) retries;
+};
+
+/// \brief A buffer of a DequeStealing_s.
+///
+/// Implementation detail. Slots are atomic because a thief might read a slot
+/// while the owner reuses it. The thief then fails its compare-and-swap and
+/// discards what it read.
+struct DequeStealingBuffer_s
+{
+    /// \brief Amount of slots, a power of two.
+    integer_t capacity;
+
+    /// \brief Older buffer, if this one was retired.
+    struct DequeStealingBuffer_s *next;
+
+    /// \brief Slots of the circular buffer.
+    _Atomic(void *) slots[];
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct DequeStealingBuffer_s *
+dqs_buffer_new(integer_t capacity);
+
+static struct DequeStealingBuffer_s *
+dqs_grow(DequeStealing_t *deque, struct DequeStealingBuffer_s *buffer,
+         integer_t top, integer_t bottom);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new DequeStealing_s. The initial capacity is rounded up to
+/// the next power of two.
+///
+/// \param[in] initial_capacity Amount of elements before the first growth.
+///
+/// \return A new DequeStealing_s or NULL if allocation failed or the
+/// capacity is not positive.
+DequeStealing_t *
+dqs_new(integer_t initial_capacity)
+{
+    if (initial_capacity < 1 || initial_capacity > DS_INTEGER_MAX / 4)
+        return NULL;
+
+    integer_t capacity = 1;
+
+    while (capacity < initial_capacity)
+        capacity <<= 1;
+
+    DequeStealing_t *deque = aligned_alloc(DS_CACHE_LINE,
+                                           sizeof(DequeStealing_t));
+
+    if (!deque)
+        return NULL;
+
+    struct DequeStealingBuffer_s *buffer = dqs_buffer_new(capacity);
+
+    if (!buffer)
+    {
+        free(deque);
+        return NULL;
+    }
+
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->buffer, buffer);
+    atomic_init(&deque->retries, 0);
+
+    deque->retired = NULL;
+
+    return deque;
+}
+
+/// Frees from memory a DequeStealing_s and all of its buffers. No thread can
+/// be using the deque.
+///
+/// \param[in] deque The deque to be freed from memory.
+void
+dqs_free(DequeStealing_t *deque)
+{
+    free(atomic_load_explicit(&deque->buffer, memory_order_relaxed));
+
+    while (deque->retired)
+    {
+        struct DequeStealingBuffer_s *next = deque->retired->next;
+
+        free(deque->retired);
+
+        deque->retired = next;
+    }
+
+    free(deque);
+}
+
+/// The result is exact only if no thread is using the deque.
+///
+/// \param[in] deque The deque.
+///
+/// \return The amount of elements in the deque.
+integer_t
+dqs_count(DequeStealing_t *deque)
+{
+    integer_t bottom = atomic_load_explicit(&deque->bottom,
+                                            memory_order_acquire);
+    integer_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    return bottom > top ? bottom - top : 0;
+}
+
+/// Counts how many times a thief or the owner lost the race for the front
+/// element to another thread, a measure of contention on the deque.
+///
+/// \param[in] deque The deque.
+///
+/// \return The amount of retries since the deque was created.
+unsigned_t
+dqs_retries(DequeStealing_t *deque)
+{
+    return atomic_load_explicit(&deque->retries, memory_order_relaxed);
+}
+
+/// Only accurate when called by the owner thread.
+///
+/// \param[in] deque The deque.
+///
+/// \return The current buffer capacity of the deque.
+integer_t
+dqs_capacity(DequeStealing_t *deque)
+{
+    return atomic_load_explicit(&deque->buffer, memory_order_acquire)->capacity;
+}
+
+/// Inserts an element at the rear, growing the buffer if it is full. Must
+/// only be called by the owner thread.
+///
+/// \param[in] deque The deque.
+/// \param[in] element The element to be inserted.
+///
+/// \return False if the buffer had to grow and allocation failed.
+bool
+dqs_enqueue_rear(DequeStealing_t *deque, void *element)
+{
+    integer_t bottom = atomic_load_explicit(&deque->bottom,
+                                            memory_order_relaxed);
+    integer_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    struct DequeStealingBuffer_s *buffer =
+            atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+
+    if (bottom - top > buffer->capacity - 1)
+    {
+        buffer = dqs_grow(deque, buffer, top, bottom);
+
+        if (!buffer)
+            return false;
+    }
+
+    atomic_store_explicit(&buffer->slots[bottom & (buffer->capacity - 1)],
+                          element, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_release);
+
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+    return true;
+}
+
+/// Removes the most recently inserted element. Must only be called by the
+/// owner thread.
+///
+/// \param[in] deque The deque.
+/// \param[out] result Resulting element removed from the deque.
+///
+/// \return False if the deque was empty or a thief took the last element.
+bool
+dqs_dequeue_rear(DequeStealing_t *deque, void **result)
+{
+    integer_t bottom = atomic_load_explicit(&deque->bottom,
+                                            memory_order_relaxed) - 1;
+
+    struct DequeStealingBuffer_s *buffer =
+            atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_seq_cst);
+
+    integer_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    bool success = true;
+
+    void *element = NULL;
+
+    if (top <= bottom)
+    {
+        element = atomic_load_explicit(
+                &buffer->slots[bottom & (buffer->capacity - 1)],
+                memory_order_relaxed);
+
+        // Last element, race the thieves for it
+        if (top == bottom)
+        {
+            success = atomic_compare_exchange_strong_explicit(
+                    &deque->top, &top, top + 1,
+                    memory_order_seq_cst, memory_order_relaxed);
+
+            atomic_store_explicit(&deque->bottom, bottom + 1,
+                                  memory_order_relaxed);
+
+            if (!success)
+                atomic_fetch_add_explicit(&deque->retries, 1,
+                                          memory_order_relaxed);
+        }
+    }
+    else
+    {
+        success = false;
+
+        atomic_store_explicit(&deque->bottom, bottom + 1,
+                              memory_order_relaxed);
+    }
+
+    if (success)
+        *result = element;
+
+    return success;
+}
+
+/// Removes the oldest element. Can be called by any thread, including the
+/// owner. Retries while other threads are taking elements so it only fails
+/// if the deque is empty.
+///
+/// \param[in] deque The deque.
+/// \param[out] result Resulting element removed from the deque.
+///
+/// \return False if the deque was empty.
+bool
+dqs_dequeue_front(DequeStealing_t *deque, void **result)
+{
+    for (;;)
+    {
+        integer_t top = atomic_load_explicit(&deque->top,
+                                             memory_order_acquire);
+
+        atomic_thread_fence(memory_order_seq_cst);
+
+        integer_t bottom = atomic_load_explicit(&deque->bottom,
+                                                memory_order_acquire);
+
+        if (top >= bottom)
+            return false;
+
+        struct DequeStealingBuffer_s *buffer =
+                atomic_load_explicit(&deque->buffer, memory_order_acquire);
+
+        void *element = atomic_load_explicit(
+                &buffer->slots[top & (buffer->capacity - 1)],
+                memory_order_relaxed);
+
+        if (atomic_compare_exchange_strong_explicit(
+                &deque->top, &top, top + 1,
+                memory_order_seq_cst, memory_order_relaxed))
+        {
+            *result = element;
+
+            return true;
+        }
+
+        atomic_fetch_add_explicit(&deque->retries, 1, memory_order_relaxed);
+    }
+}
+
+/// \param[in] deque The deque.
+///
+/// \return True if the deque had no elements.
+bool
+dqs_empty(DequeStealing_t *deque)
+{
+    return dqs_count(deque) == 0;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct DequeStealingBuffer_s *
+dqs_buffer_new(integer_t capacity)
+{
+    struct DequeStealingBuffer_s *buffer =
+            malloc(sizeof(struct DequeStealingBuffer_s)
+                   + sizeof(_Atomic(void *)) * (size_t)capacity);
+
+    if (!buffer)
+        return NULL;
+
+    buffer->capacity = capacity;
+    buffer->next = NULL;
+
+    for (integer_t i = 0; i < capacity; i++)
+        atomic_init(&buffer->slots[i], NULL);
+
+    return buffer;
+}
+
+// Copies the elements from top to bottom to a buffer twice as big and
+// publishes it. The old buffer is retired since thieves might be reading it.
+static struct DequeStealingBuffer_s *
+dqs_grow(DequeStealing_t *deque, struct DequeStealingBuffer_s *buffer,
+         integer_t top, integer_t bottom)
+{
+    struct DequeStealingBuffer_s *result =
+            dqs_buffer_new(buffer->capacity * 2);
+
+    if (!result)
+        return NULL;
+
+    for (integer_t i = top; i < bottom; i++)
+    {
+        void *element = atomic_load_explicit(
+                &buffer->slots[i & (buffer->capacity - 1)],
+                memory_order_relaxed);
+
+        atomic_store_explicit(&result->slots[i & (result->capacity - 1)],
+                              element, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&deque->buffer, result, memory_order_release);
+
+    buffer->next = deque->retired;
+    deque->retired = buffer;
+
+    return result;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
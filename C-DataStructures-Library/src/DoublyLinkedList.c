@@ -28,7 +28,6 @@
 ///
 /// Located in the file DoublyLinkedList.c
 ///
-/// \todo Add Link and Unlink functions
 /// \todo Add support to negative index searches
 struct DoublyLinkedList_s
 {
@@ -84,6 +83,12 @@ struct DoublyLinkedList_s
     /// A function that completely frees an element from memory.
     dll_free_f v_free;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -91,6 +96,20 @@ struct DoublyLinkedList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief Last node found by a positional search.
+    ///
+    /// Positional operations start walking from this node when it is closer
+    /// to the wanted position than the head or the tail, so looping over the
+    /// positions of the list is linear instead of quadratic. It is only valid
+    /// while \c cursor_version equals \c version_id.
+    struct DoublyLinkedNode_s *cursor;
+
+    /// \brief Position of \c cursor in the list.
+    integer_t cursor_index;
+
+    /// \brief The version id of the list when \c cursor was cached.
+    integer_t cursor_version;
 };
 
 /// \brief A DoublyLinkedList_s node.
@@ -128,14 +147,21 @@ typedef struct DoublyLinkedNode_s *DoublyLinkedNode;
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status dll_make_node(DoublyLinkedNode *node, void *element);
+static Status dll_make_node(NodePool_t *pool, DoublyLinkedNode *node,
+        void *element);
 
-static Status dll_free_node(DoublyLinkedNode *node, dll_free_f free_f);
+static Status dll_free_node(NodePool_t *pool, DoublyLinkedNode *node,
+        dll_free_f free_f);
 
-static Status dll_free_node_shallow(DoublyLinkedNode *node);
+static Status dll_free_node_shallow(NodePool_t *pool, DoublyLinkedNode *node);
 
 static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, integer_t position);
 
+static DoublyLinkedNode dll_split(DoublyLinkedNode node, integer_t count);
+
+static DoublyLinkedNode dll_merge_sort(DoublyLinkedNode head,
+        integer_t length, dll_compare_f compare_f, DoublyLinkedNode *tail);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a DoublyLinkedList_s structure.
@@ -158,6 +184,7 @@ Status dll_init(DoublyLinkedList *list)
 
     (*list)->length = 0;
     (*list)->limit = 0;
+    (*list)->version_id = 0;
 
     (*list)->head = NULL;
     (*list)->tail = NULL;
@@ -167,6 +194,12 @@ Status dll_init(DoublyLinkedList *list)
     (*list)->v_display = NULL;
     (*list)->v_free = NULL;
 
+    (*list)->pool = NULL;
+
+    (*list)->cursor = NULL;
+    (*list)->cursor_index = 0;
+    (*list)->cursor_version = -1;
+
     return DS_OK;
 }
 
@@ -203,6 +236,12 @@ Status dll_create(DoublyLinkedList *list, dll_compare_f compare_f,
     (*list)->v_display = display_f;
     (*list)->v_free = free_f;
 
+    (*list)->pool = NULL;
+
+    (*list)->cursor = NULL;
+    (*list)->cursor_index = 0;
+    (*list)->cursor_version = -1;
+
     return DS_OK;
 }
 
@@ -233,7 +272,7 @@ Status dll_free(DoublyLinkedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = dll_free_node(&prev, (*list)->v_free);
+        st = dll_free_node((*list)->pool, &prev, (*list)->v_free);
 
         if (st != DS_OK)
             return st;
@@ -271,7 +310,7 @@ Status dll_free_shallow(DoublyLinkedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = dll_free_node_shallow(&prev);
+        st = dll_free_node_shallow((*list)->pool, &prev);
 
         if (st != DS_OK)
             return st;
@@ -311,6 +350,8 @@ Status dll_erase(DoublyLinkedList *list)
     if (st !=  DS_OK)
         return st;
 
+    new_list->pool = (*list)->pool;
+
     st = dll_free(list);
 
     // Probably didn't set the free function...
@@ -433,6 +474,36 @@ Status dll_set_limit(DoublyLinkedList list, integer_t limit)
     return DS_OK;
 }
 
+/// \brief Sets a node pool for the specified DoublyLinkedList_s.
+///
+/// Sets a node pool from where all nodes of the list are allocated. A pool can
+/// be shared between many containers as long as its nodes are big enough. To
+/// go back to using malloc() and free() simply set the pool to \c NULL. The
+/// pool can only be changed when the list is empty.
+///
+/// \param[in] list DoublyLinkedList_s reference.
+/// \param[in] pool The node pool or \c NULL.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if the pool's nodes are too small.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status dll_set_pool(DoublyLinkedList list, NodePool_t *pool)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!dll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (pool && !npl_fits(pool, sizeof(DoublyLinkedNode_t)))
+        return DS_ERR_INVALID_ARGUMENT;
+
+    list->pool = pool;
+
+    return DS_OK;
+}
+
 /// \brief Sets the given position to a given element erasing the old one.
 ///
 /// Sets an element at a given position. This function is 0 based, that is, the
@@ -582,7 +653,7 @@ Status dll_insert_head(DoublyLinkedList list, void *element)
 
     DoublyLinkedNode node;
 
-    Status st = dll_make_node(&node, element);
+    Status st = dll_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -670,7 +741,7 @@ Status dll_insert_at(DoublyLinkedList list, void *element, integer_t position)
 
         DoublyLinkedNode node = NULL;
 
-        st = dll_make_node(&node, element);
+        st = dll_make_node(list->pool, &node, element);
 
         if (st != DS_OK)
             return st;
@@ -684,6 +755,11 @@ Status dll_insert_at(DoublyLinkedList list, void *element, integer_t position)
         list->length++;
         list->version_id++;
 
+        // The new node is still a valid starting point for the next search
+        list->cursor = node;
+        list->cursor_index = position;
+        list->cursor_version = list->version_id;
+
         return DS_OK;
     }
 }
@@ -713,7 +789,7 @@ Status dll_insert_tail(DoublyLinkedList list, void *element)
 
     DoublyLinkedNode node;
 
-    Status st = dll_make_node(&node, element);
+    Status st = dll_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -768,7 +844,7 @@ Status dll_remove_head(DoublyLinkedList list, void **result)
     else
         list->head->prev = NULL;
 
-    dll_free_node_shallow(&node);
+    dll_free_node_shallow(list->pool, &node);
 
     list->length--;
     list->version_id++;
@@ -844,13 +920,19 @@ Status dll_remove_at(DoublyLinkedList list, void **result, integer_t position)
         node->prev->next = node->next;
         node->next->prev = node->prev;
 
+        // The previous node is still a valid starting point for the next search
+        list->cursor = node->prev;
+        list->cursor_index = position - 1;
+
         *result = node->data;
 
-        dll_free_node_shallow(&node);
+        dll_free_node_shallow(list->pool, &node);
 
         list->length--;
         list->version_id++;
 
+        list->cursor_version = list->version_id;
+
         if (dll_empty(list))
         {
             list->head = NULL;
@@ -891,7 +973,7 @@ Status dll_remove_tail(DoublyLinkedList list, void **result)
     else
         list->tail->next = NULL;
 
-    dll_free_node_shallow(&node);
+    dll_free_node_shallow(list->pool, &node);
 
     list->length--;
     list->version_id++;
@@ -1167,6 +1249,47 @@ Status dll_reverse(DoublyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Sorts a DoublyLinkedList_s.
+///
+/// Sorts the list in ascending order according to its default compare
+/// function, using a bottom-up merge sort that only relinks the nodes. It
+/// takes O(n log n), allocates nothing and keeps equal elements in their
+/// original order. Use dll_reverse() afterwards for a descending order.
+///
+/// \param[in] list DoublyLinkedList_s reference to be sorted.
+///
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
+/// \return DS_ERR_NULL_POINTER if list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status dll_sort(DoublyLinkedList list)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (list->length < 2)
+        return DS_OK;
+
+    list->head = dll_merge_sort(list->head, list->length, list->v_compare,
+            &list->tail);
+
+    // The sort only follows the next pointers
+    DoublyLinkedNode prev = NULL;
+
+    for (DoublyLinkedNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        scan->prev = prev;
+
+        prev = scan;
+    }
+
+    list->version_id++;
+
+    return DS_OK;
+}
+
 /// \brief Makes a copy of the specified DoublyLinkedList_s.
 ///
 /// Makes an exact copy of a list, copying each element using the default copy
@@ -1195,6 +1318,8 @@ Status dll_copy(DoublyLinkedList list, DoublyLinkedList *result)
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+
     (*result)->limit = list->limit;
 
     DoublyLinkedNode scan = list->head;
@@ -1270,56 +1395,225 @@ Status dll_to_array(DoublyLinkedList list, void ***result, integer_t *length)
 
 /// \brief Appends list2 at the end of list1.
 ///
-/// \param list1
-/// \param list2
+/// Moves all elements of list2 to the end of list1 in O(1). list2 is left
+/// empty.
+///
+/// \param[in] list1 DoublyLinkedList_s where the elements are added to.
+/// \param[in] list2 DoublyLinkedList_s where the elements are removed from.
 ///
-/// \return
+/// \return DS_ERR_FULL if list1's limit would be exceeded.
+/// \return DS_ERR_INVALID_OPERATION if list2 is empty or if the lists have
+/// different node pools.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_OK if all operations are successful.
 Status dll_link(DoublyLinkedList list1, DoublyLinkedList list2)
 {
-    /// \todo dll_link
+    if (list1 == NULL || list2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    // Nodes can only move between lists that share the same node pool
+    if (list1->pool != list2->pool)
+        return DS_ERR_INVALID_OPERATION;
+
+    if (dll_empty(list2))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (list1->limit > 0 && list1->length + list2->length > list1->limit)
+        return DS_ERR_FULL;
+
+    if (dll_empty(list1))
+    {
+        list1->head = list2->head;
+    }
+    else
+    {
+        list1->tail->next = list2->head;
+        list2->head->prev = list1->tail;
+    }
+
+    list1->tail = list2->tail;
+
+    list1->length += list2->length;
+
+    list2->head = NULL;
+    list2->tail = NULL;
+
+    list2->length = 0;
+
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
 /// \brief Links list2 at the specified position of list1.
 ///
-/// \param list1
-/// \param list2
-/// \param position
+/// Moves all elements of list2 to list1, with the first one ending up at the
+/// given position. Only the nodes around the position are relinked, so once
+/// it is found linking takes O(1). list2 is left empty.
+///
+/// \param[in] list1 DoublyLinkedList_s where the elements are added to.
+/// \param[in] list2 DoublyLinkedList_s where the elements are removed from.
+/// \param[in] position Position of list1 where list2 is linked.
 ///
-/// \return
+/// \return DS_ERR_FULL if list1's limit would be exceeded.
+/// \return DS_ERR_INVALID_OPERATION if list2 is empty or if the lists have
+/// different node pools.
+/// \return DS_ERR_NEGATIVE_VALUE if position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position is greater than list1's length.
+/// \return DS_OK if all operations are successful.
 Status dll_link_at(DoublyLinkedList list1, DoublyLinkedList list2,
         integer_t position)
 {
-    /// \todo dll_link_at
+    if (list1 == NULL || list2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (position < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (position > list1->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    if (position == list1->length)
+        return dll_link(list1, list2);
+
+    // Nodes can only move between lists that share the same node pool
+    if (list1->pool != list2->pool)
+        return DS_ERR_INVALID_OPERATION;
+
+    if (dll_empty(list2))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (list1->limit > 0 && list1->length + list2->length > list1->limit)
+        return DS_ERR_FULL;
+
+    DoublyLinkedNode next;
+
+    Status st = dll_get_node_at(list1, &next, position);
+
+    if (st != DS_OK)
+        return st;
+
+    if (next->prev == NULL)
+        list1->head = list2->head;
+    else
+        next->prev->next = list2->head;
+
+    list2->head->prev = next->prev;
+    list2->tail->next = next;
+
+    next->prev = list2->tail;
+
+    list1->length += list2->length;
+
+    list2->head = NULL;
+    list2->tail = NULL;
+
+    list2->length = 0;
+
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
 /// \brief Unlinks elements from the specified position to the end.
 ///
-/// \param list
-/// \param result
-/// \param position
+/// Moves the elements from the given position to the end of the list to an
+/// empty list. Equivalent to dll_unlink_at() up to the last position.
+///
+/// \param[in] list DoublyLinkedList_s where the elements are removed from.
+/// \param[in] result An empty DoublyLinkedList_s that receives the elements.
+/// \param[in] position Position of the first element to be moved.
 ///
-/// \return
+/// \return See dll_unlink_at().
 Status dll_unlink(DoublyLinkedList list, DoublyLinkedList result,
         integer_t position)
 {
-    /// \todo dll_unlink
-    return DS_OK;
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    return dll_unlink_at(list, result, position, list->length - 1);
 }
 
 /// \brief Unlinks elements from a given position to another.
 ///
-/// \param list
-/// \param result
-/// \param position1
-/// \param position2
-///
-/// \return
+/// Moves the elements from \c position1 to \c position2, both inclusive, to
+/// an empty list. Only the nodes at the ends of the range are relinked, so
+/// once they are found moving the range takes O(1).
+///
+/// \param[in] list DoublyLinkedList_s where the elements are removed from.
+/// \param[in] result An empty DoublyLinkedList_s that receives the elements.
+/// \param[in] position1 Position of the first element to be moved.
+/// \param[in] position2 Position of the last element to be moved.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if position2 is less than position1.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty or if the lists
+/// have different node pools.
+/// \return DS_ERR_NEGATIVE_VALUE if a position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position2 is greater than or equal to the
+/// list's length.
+/// \return DS_OK if all operations are successful.
 Status dll_unlink_at(DoublyLinkedList list, DoublyLinkedList result,
         integer_t position1, integer_t position2)
 {
-    /// \todo dll_unlink_at
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!dll_empty(result))
+        return DS_ERR_INVALID_OPERATION;
+
+    // Nodes can only move between lists that share the same node pool
+    if (list->pool != result->pool)
+        return DS_ERR_INVALID_OPERATION;
+
+    if (position1 < 0 || position2 < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (position2 < position1)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (position2 >= list->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    DoublyLinkedNode first, last;
+
+    Status st = dll_get_node_at(list, &first, position1);
+
+    if (st != DS_OK)
+        return st;
+
+    // Starts from the node found above if it is the closest
+    st = dll_get_node_at(list, &last, position2);
+
+    if (st != DS_OK)
+        return st;
+
+    if (first->prev == NULL)
+        list->head = last->next;
+    else
+        first->prev->next = last->next;
+
+    if (last->next == NULL)
+        list->tail = first->prev;
+    else
+        last->next->prev = first->prev;
+
+    first->prev = NULL;
+    last->next = NULL;
+
+    result->head = first;
+    result->tail = last;
+
+    result->length = position2 - position1 + 1;
+
+    list->length -= result->length;
+
+    list->version_id++;
+    result->version_id++;
+
     return DS_OK;
 }
 
@@ -1457,14 +1751,16 @@ Status dll_display_raw(DoublyLinkedList list)
 /// Implementation detail. Function responsible for allocating a new
 /// DoublyLinkedNode_s.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node DoublyLinkedNode_s to be allocated.
 /// \param[in] element Node's data member.
 ///
 /// \return DS_ERR_ALLOC if node allocation failed.
 /// \return DS_OK if all operations are successful.
-static Status dll_make_node(DoublyLinkedNode *node, void *element)
+static Status dll_make_node(NodePool_t *pool, DoublyLinkedNode *node,
+        void *element)
 {
-    (*node) = malloc(sizeof(DoublyLinkedNode_t));
+    (*node) = npl_node_alloc(pool, sizeof(DoublyLinkedNode_t));
 
     if (!(*node))
         return DS_ERR_ALLOC;
@@ -1481,19 +1777,21 @@ static Status dll_make_node(DoublyLinkedNode *node, void *element)
 /// Implementation detail. Frees a DoublyLinkedNode_s and its data using the
 /// list's default free function.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node DoublyLinkedNode_s to be freed from memory.
 /// \param[in] free_f List's default free function.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status dll_free_node(DoublyLinkedNode *node, dll_free_f free_f)
+static Status dll_free_node(NodePool_t *pool, DoublyLinkedNode *node,
+        dll_free_f free_f)
 {
     if ((*node) == NULL)
         return DS_ERR_NULL_POINTER;
 
     free_f((*node)->data);
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     (*node) = NULL;
 
@@ -1505,16 +1803,17 @@ static Status dll_free_node(DoublyLinkedNode *node, dll_free_f free_f)
 /// Implementation detail. Frees a DoublyLinkedNode_s and leaves its data
 /// untouched.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node DoublyLinkedNode_s to be freed from memory.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status dll_free_node_shallow(DoublyLinkedNode *node)
+static Status dll_free_node_shallow(NodePool_t *pool, DoublyLinkedNode *node)
 {
     if ((*node) == NULL)
         return DS_ERR_NULL_POINTER;
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     (*node) = NULL;
 
@@ -1524,7 +1823,8 @@ static Status dll_free_node_shallow(DoublyLinkedNode *node)
 /// \brief Gets a node from a specific position.
 ///
 /// Implementation detail. Searches for a node in O(n / 2) where the search starts
-/// at the head or tail of the list.
+/// at the head or tail of the list, or at the last node found by this function
+/// if it is closer and the list was not modified since then.
 ///
 /// \param[in] list DoublyLinkedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1539,10 +1839,11 @@ static Status dll_free_node_shallow(DoublyLinkedNode *node)
 /// \return DS_OK if all operations are successful.
 static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, integer_t position)
 {
-    // This function effectively searches for a given node. If the position is
-    // greater than the list length the search will begin at the end of the list,
-    // reducing the amount of iterations needed. This effectively reduces searches
-    // to O(n / 2) iterations.
+    // This function effectively searches for a given node. The search begins
+    // at whichever of the head, the tail or the last node found is closest to
+    // the given position, reducing the amount of iterations needed. This
+    // effectively reduces searches to O(n / 2) iterations and sequential
+    // searches to O(1) iterations.
     *result = NULL;
 
     if (list == NULL)
@@ -1557,34 +1858,145 @@ static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, i
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
+    integer_t index, distance;
+
     if (position <= list->length / 2)
     {
         (*result) = list->head;
-
-        for (integer_t i = 0; i < position; i++)
-        {
-            if ((*result) == NULL)
-                return DS_ERR_ITER;
-
-            (*result) = (*result)->next;
-        }
+        index = 0;
+        distance = position;
     }
     else
     {
         (*result) = list->tail;
+        index = list->length - 1;
+        distance = index - position;
+    }
 
-        for (integer_t i = list->length - 1; i > position; i--)
-        {
-            if ((*result) == NULL)
-                return DS_ERR_ITER;
+    if (list->cursor_version == list->version_id)
+    {
+        integer_t cursor_distance = list->cursor_index - position;
+
+        if (cursor_distance < 0)
+            cursor_distance = -cursor_distance;
 
-            (*result) = (*result)->prev;
+        if (cursor_distance < distance)
+        {
+            (*result) = list->cursor;
+            index = list->cursor_index;
         }
     }
 
+    for (; index < position; index++)
+    {
+        if ((*result) == NULL)
+            return DS_ERR_ITER;
+
+        (*result) = (*result)->next;
+    }
+
+    for (; index > position; index--)
+    {
+        if ((*result) == NULL)
+            return DS_ERR_ITER;
+
+        (*result) = (*result)->prev;
+    }
+
+    list->cursor = (*result);
+    list->cursor_index = position;
+    list->cursor_version = list->version_id;
+
     return DS_OK;
 }
 
+/// \brief Cuts a chain of nodes.
+///
+/// Implementation detail. Cuts a \c NULL terminated chain after \c count
+/// nodes.
+///
+/// \param[in] node First node of the chain.
+/// \param[in] count Amount of nodes that are kept in the chain.
+///
+/// \return The first node after the cut or \c NULL if the chain is not
+/// longer than \c count.
+static DoublyLinkedNode dll_split(DoublyLinkedNode node, integer_t count)
+{
+    for (integer_t i = 1; node != NULL && i < count; i++)
+        node = node->next;
+
+    if (node == NULL)
+        return NULL;
+
+    DoublyLinkedNode rest = node->next;
+
+    node->next = NULL;
+
+    return rest;
+}
+
+/// \brief Sorts a chain of nodes.
+///
+/// Implementation detail. A bottom-up merge sort that only follows and changes
+/// the \c next pointers of the nodes. Each pass merges pairs of sorted runs of
+/// the same width, starting at 1 and doubling every pass, so it takes
+/// O(n log n) and no extra memory. Equal elements keep their order.
+///
+/// \param[in] head First node of a \c NULL terminated chain.
+/// \param[in] length Amount of nodes in the chain.
+/// \param[in] compare_f Function used to compare the nodes' data.
+/// \param[out] tail Last node of the sorted chain.
+///
+/// \return The first node of the sorted chain.
+static DoublyLinkedNode dll_merge_sort(DoublyLinkedNode head,
+        integer_t length, dll_compare_f compare_f, DoublyLinkedNode *tail)
+{
+    DoublyLinkedNode_t first;
+
+    first.next = head;
+
+    *tail = head;
+
+    for (integer_t width = 1; width < length; width *= 2)
+    {
+        DoublyLinkedNode last = &first, scan = first.next;
+
+        while (scan != NULL)
+        {
+            DoublyLinkedNode left = scan;
+            DoublyLinkedNode right = dll_split(left, width);
+
+            scan = dll_split(right, width);
+
+            // Merge both runs after last, taking from the left one on ties
+            while (left != NULL && right != NULL)
+            {
+                if (compare_f(right->data, left->data) < 0)
+                {
+                    last->next = right;
+                    right = right->next;
+                }
+                else
+                {
+                    last->next = left;
+                    left = left->next;
+                }
+
+                last = last->next;
+            }
+
+            last->next = left != NULL ? left : right;
+
+            while (last->next != NULL)
+                last = last->next;
+        }
+
+        *tail = last;
+    }
+
+    return first.next;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
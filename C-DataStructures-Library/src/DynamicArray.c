@@ -7,6 +7,11 @@
  */
 
 #include "DynamicArray.h"
+#include "BitArray.h"
+#include "Bulk.h"
+#include "Snapshot.h"
+#include "Sort.h"
+#include "Trace.h"
 
 /// A DynamicArray_s is a dynamic array that grows in size when needed. It has
 /// a \c capacity that grows according to \c growth_rate. Both parameters can
@@ -20,7 +25,17 @@
 /// index bounds are checked.
 ///
 /// The dynamic array can also be transformed from and to a C array, as long as
-/// a copy function of your data type is provided.
+/// a copy function of your data type is provided. To move elements in and out
+/// without copying anything, dar_adopt() takes ownership of a buffer and
+/// dar_release_buffer() gives it back.
+///
+/// With dar_set_tombstones() removals stop shifting the rest of the buffer
+/// and leave a dead slot behind instead, marked in a side BitArray_s. Indexes
+/// keep counting only the elements, so dead slots are invisible to the user:
+/// dar_get() skips them starting from the slot it last resolved, iterators
+/// step over them and every other operation that depends on positions first
+/// compacts the buffer. The buffer is also compacted once the dead slots
+/// reach a percentage of it, which keeps lookups short.
 struct DynamicArray_s
 {
     /// \brief Data buffer.
@@ -46,17 +61,50 @@ struct DynamicArray_s
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
 
+    /// \brief How the new capacity is calculated, see GrowthPolicy_e.
+    GrowthPolicy policy;
+
+    /// \brief Amount of elements added by DS_GROWTH_STEP.
+    integer_t step;
+
     /// \brief Flag for locked capacity.
     ///
     /// If \c locked is set to true the buffer will not grow.
     bool locked;
 
+    /// \brief Flag for shrinking the buffer when it is mostly empty.
+    bool shrink;
+
+    /// \brief The buffer is never shrunk below this capacity.
+    ///
+    /// The initial capacity of the array.
+    integer_t minimum;
+
     /// \brief DynamicArray_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     Interface_t *interface;
 
+    /// \brief Percentage of dead slots at which the buffer is compacted, or
+    /// 0 if removals shift the buffer.
+    integer_t threshold;
+
+    /// \brief Dead slots among the first \c size slots of the buffer.
+    ///
+    /// Allocated by the first removal in tombstone mode, NULL until then.
+    /// The last slot is never dead and dead slots hold NULL.
+    BitArray_t *dead;
+
+    /// \brief Amount of dead slots.
+    integer_t tombstones;
+
+    /// \brief A slot and the amount of elements before it, where the search
+    /// for the slot of an index starts. Only valid while there are dead
+    /// slots.
+    integer_t hint_slot, hint_rank;
+
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -64,6 +112,12 @@ struct DynamicArray_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
+
+#ifdef DS_STATS
+    /// \brief Operation counters, see dar_stats().
+    ContainerStats_t stats;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -72,7 +126,31 @@ bool
 dar_grow(DynamicArray_t *array, integer_t required_size);
 
 static void
-dar_quicksort(DynamicArray_t *array, void **buffer, integer_t size);
+dar_shrink(DynamicArray_t *array);
+
+static void
+dar_settle(DynamicArray_t *array);
+
+static bool
+dar_is_dead(DynamicArray_t *array, integer_t slot);
+
+static integer_t
+dar_slot(DynamicArray_t *array, integer_t index);
+
+static integer_t
+dar_next_live(DynamicArray_t *array, integer_t slot);
+
+static integer_t
+dar_prev_live(DynamicArray_t *array, integer_t slot);
+
+static bool
+dar_bury(DynamicArray_t *array, integer_t slot, void **result);
+
+static void
+dar_trim(DynamicArray_t *array);
+
+static integer_t
+dar_sweep(DynamicArray_t *array, predicate_f remove, void *argument);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -93,7 +171,7 @@ dar_new(Interface_t *interface)
     if (!array)
         return NULL;
 
-    array->buffer = calloc(32, sizeof(void*));
+    array->buffer = ds_buffer_alloc(sizeof(void*) * 32);
 
     if (!(array->buffer))
     {
@@ -102,12 +180,27 @@ dar_new(Interface_t *interface)
         return NULL;
     }
 
+    for (integer_t i = 0; i < 32; i++)
+        array->buffer[i] = NULL;
+
     array->capacity = 32;
     array->growth_rate = 200;
+    array->policy = DS_GROWTH_GEOMETRIC;
+    array->step = 0;
     array->size = 0;
     array->interface = interface;
     array->locked = false;
-    array->version_id = 0;
+    array->shrink = false;
+    array->minimum = 32;
+    array->threshold = 0;
+    array->dead = NULL;
+    array->tombstones = 0;
+    array->hint_slot = 0;
+    array->hint_rank = 0;
+    DS_VERSION_RESET(array);
+
+    DS_STATS_RESET(array);
+    DS_STATS_ADD(array, allocations, 2);
 
     return array;
 }
@@ -140,7 +233,8 @@ dar_create(Interface_t *interface, integer_t initial_capacity,
     if (!array)
         return NULL;
 
-    array->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    array->buffer = ds_buffer_alloc(sizeof(void*) *
+                                    (size_t)initial_capacity);
 
     if (!(array->buffer))
     {
@@ -154,10 +248,72 @@ dar_create(Interface_t *interface, integer_t initial_capacity,
 
     array->capacity = initial_capacity;
     array->growth_rate = growth_rate;
+    array->policy = DS_GROWTH_GEOMETRIC;
+    array->step = 0;
     array->interface = interface;
     array->locked = false;
+    array->shrink = false;
+    array->minimum = initial_capacity;
+    array->threshold = 0;
+    array->dead = NULL;
+    array->tombstones = 0;
+    array->hint_slot = 0;
+    array->hint_rank = 0;
     array->size = 0;
-    array->version_id = 0;
+    DS_VERSION_RESET(array);
+
+    DS_STATS_RESET(array);
+    DS_STATS_ADD(array, allocations, 2);
+
+    return array;
+}
+
+/// Creates a DynamicArray_s that takes ownership of a buffer allocated with
+/// malloc(), without copying it. The buffer must not be used by the caller
+/// afterwards, since it is reallocated when the array grows and freed by
+/// dar_free().
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// dynamic array to operate.
+/// \param[in] buffer A buffer allocated with malloc() or realloc().
+/// \param[in] size Amount of elements at the start of the buffer.
+/// \param[in] capacity Amount of elements the buffer can hold.
+/// \param[in] growth_rate Buffer growth rate.
+///
+/// \return A new DynamicArray_s or NULL if the capacity is less than 1 or the
+/// size, if the growth rate is less than 101 or if allocation failed. In that
+/// case the buffer still belongs to the caller.
+DynamicArray_t *
+dar_adopt(Interface_t *interface, void **buffer, integer_t size,
+          integer_t capacity, integer_t growth_rate)
+{
+    if (capacity < 1 || size < 0 || size > capacity || growth_rate <= 100)
+        return NULL;
+
+    DynamicArray_t *array = malloc(sizeof(DynamicArray_t));
+
+    if (!array)
+        return NULL;
+
+    array->buffer = buffer;
+    array->capacity = capacity;
+    array->growth_rate = growth_rate;
+    array->policy = DS_GROWTH_GEOMETRIC;
+    array->step = 0;
+    array->interface = interface;
+    array->locked = false;
+    array->shrink = false;
+    array->minimum = capacity;
+    array->threshold = 0;
+    array->dead = NULL;
+    array->tombstones = 0;
+    array->hint_slot = 0;
+    array->hint_rank = 0;
+    array->size = size;
+    DS_VERSION_RESET(array);
+
+    DS_STATS_RESET(array);
+    DS_STATS_ADD(array, allocations, 1);
 
     return array;
 }
@@ -168,7 +324,13 @@ void
 dar_free(DynamicArray_t *array)
 {
     for (integer_t i = 0; i < array->size; i++)
-        array->interface->free(array->buffer[i]);
+    {
+        if (!dar_is_dead(array, i))
+            interface_release(array->interface, array->buffer[i]);
+    }
+
+    if (array->dead)
+        bit_free(array->dead);
 
     free(array->buffer);
     free(array);
@@ -179,6 +341,9 @@ dar_free(DynamicArray_t *array)
 void
 dar_free_shallow(DynamicArray_t *array)
 {
+    if (array->dead)
+        bit_free(array->dead);
+
     free(array->buffer);
     free(array);
 }
@@ -188,15 +353,19 @@ dar_free_shallow(DynamicArray_t *array)
 void
 dar_erase(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     for (integer_t i = 0; i < array->size; i++)
     {
-        array->interface->free(array->buffer[i]);
+        interface_release(array->interface, array->buffer[i]);
 
         array->buffer[i] = NULL;
     }
 
+    DS_STATS_ADD(array, frees, array->size);
+
     array->size = 0;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 }
 
 ///
@@ -204,13 +373,15 @@ dar_erase(DynamicArray_t *array)
 void
 dar_erase_shallow(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     for (integer_t i = 0; i < array->size; i++)
     {
         array->buffer[i] = NULL;
     }
 
     array->size = 0;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 }
 
 ///
@@ -238,6 +409,117 @@ dar_capacity_unlock(DynamicArray_t *array)
     array->locked = false;
 }
 
+/// Sets how the buffer grows. With realloc() a buffer can often be extended
+/// in place, and big buffers mapped directly by the allocator can be remapped
+/// without copying, so DS_GROWTH_PAGES is meant for arrays of thousands of
+/// elements or more.
+///
+/// \param[in] array The target dynamic array.
+/// \param[in] policy The new growth policy.
+/// \param[in] step Amount of elements added on each growth by
+/// DS_GROWTH_STEP. Ignored by the other policies.
+///
+/// \return True if the policy was changed or false if the step is less than
+/// 1 for DS_GROWTH_STEP.
+bool
+dar_set_policy(DynamicArray_t *array, GrowthPolicy policy, integer_t step)
+{
+    if (policy == DS_GROWTH_STEP && step < 1)
+        return false;
+
+    array->policy = policy;
+    array->step = step;
+
+    return true;
+}
+
+/// Makes the array shrink its buffer to half of its capacity whenever it is a
+/// quarter full after a removal, but never below its initial capacity. Since
+/// the buffer is then half full, it takes many operations before it has to
+/// grow or shrink again. Buffers are not shrunk while the capacity is locked.
+///
+/// \param[in] array The target dynamic array.
+/// \param[in] shrink True to shrink the buffer automatically.
+void
+dar_set_shrink(DynamicArray_t *array, bool shrink)
+{
+    array->shrink = shrink;
+}
+
+/// Turns tombstone mode on or off. In tombstone mode dar_remove_front() and
+/// dar_remove_at() take constant time: instead of shifting every element
+/// after the removed one, they mark its slot as dead. Indexes still only
+/// count the elements, so the array behaves the same, but dar_get() and
+/// dar_replace() have to skip the dead slots before the index. They start
+/// from the last slot they found, so going through the array in order takes
+/// constant time per element and random accesses take time proportional to
+/// the dead slots they skip.
+///
+/// The buffer is compacted in a single pass when the dead slots reach
+/// \c threshold percent of it, by dar_compact(), or by any operation that
+/// depends on positions, such as inserting in the middle or sorting.
+/// Removing many elements one by one takes linear time instead of quadratic,
+/// and dar_remove_if() does it in a single pass.
+///
+/// \param[in] array The target dynamic array.
+/// \param[in] threshold Percentage of dead slots, from 1 to 100, at which the
+/// buffer is compacted, or 0 to turn tombstone mode off, which compacts the
+/// buffer.
+///
+/// \return True if the mode was changed or false if \c threshold is not
+/// between 0 and 100.
+bool
+dar_set_tombstones(DynamicArray_t *array, integer_t threshold)
+{
+    if (threshold < 0 || threshold > 100)
+        return false;
+
+    if (threshold == 0)
+    {
+        dar_settle(array);
+
+        if (array->dead)
+            bit_free(array->dead);
+
+        array->dead = NULL;
+    }
+
+    array->threshold = threshold;
+
+    return true;
+}
+
+/// Grows the buffer so it can hold at least a given amount of elements, so
+/// that many insertions can be done without reallocating. This works even if
+/// the capacity is locked.
+///
+/// \param[in] array The target dynamic array.
+/// \param[in] capacity Amount of elements the buffer must be able to hold.
+///
+/// \return True if the buffer is big enough or false if allocation failed.
+bool
+dar_reserve(DynamicArray_t *array, integer_t capacity)
+{
+    if (capacity <= array->capacity)
+        return true;
+
+    void **new_buffer = ds_buffer_realloc(array->buffer,
+            sizeof(void*) * (size_t)array->capacity,
+            sizeof(void*) * (size_t)capacity);
+
+    if (!new_buffer)
+        return false;
+
+    array->buffer = new_buffer;
+    array->capacity = capacity;
+    DS_VERSION_BUMP(array);
+
+    DS_STATS_ADD(array, grows, 1);
+    DS_STATS_ADD(array, allocations, 1);
+
+    return true;
+}
+
 ///
 /// \param[in] array
 ///
@@ -255,7 +537,7 @@ dar_capacity(DynamicArray_t *array)
 integer_t
 dar_size(DynamicArray_t *array)
 {
-    return array->size;
+    return array->size - array->tombstones;
 }
 
 ///
@@ -268,6 +550,25 @@ dar_growth_rate(DynamicArray_t *array)
     return array->growth_rate;
 }
 
+/// \param[in] array The target dynamic array.
+///
+/// \return How the buffer grows.
+GrowthPolicy
+dar_policy(DynamicArray_t *array)
+{
+    return array->policy;
+}
+
+/// \param[in] array The target dynamic array.
+///
+/// \return The amount of dead slots left by removals in tombstone mode that
+/// were not compacted yet.
+integer_t
+dar_tombstones(DynamicArray_t *array)
+{
+    return array->tombstones;
+}
+
 ///
 /// \param[in] array
 ///
@@ -278,6 +579,27 @@ dar_is_locked(DynamicArray_t *array)
     return array->locked;
 }
 
+/// Copies the operation counters of the array. They are only kept when the
+/// library is compiled with \c DS_STATS defined. Buffers handed to the
+/// caller, such as the one of dar_remove(), count as allocations.
+///
+/// \param[in] array The dynamic array.
+/// \param[out] stats Where the counters are copied to.
+///
+/// \return True if the counters are kept, otherwise false and every counter
+/// is zero.
+bool
+dar_stats(DynamicArray_t *array, ContainerStats_t *stats)
+{
+    if (!DS_STATS_GET(array, stats))
+        return false;
+
+    stats->bytes = sizeof(DynamicArray_t)
+                   + sizeof(void*) * (size_t)array->capacity;
+
+    return true;
+}
+
 ///
 /// \param[in] array
 /// \param[in] index
@@ -289,13 +611,13 @@ dar_get(DynamicArray_t *array, integer_t index)
     if (dar_empty(array))
         return NULL;
 
-    if (index >= array->size)
+    if (index >= dar_size(array))
         return NULL;
 
     if (index < 0)
         return NULL;
 
-    return array->buffer[index];
+    return array->buffer[dar_slot(array, index)];
 }
 
 ///
@@ -309,6 +631,8 @@ bool
 dar_insert(DynamicArray_t *array, void **elements, integer_t array_size,
            integer_t index)
 {
+    dar_settle(array);
+
     if (index > array->size || index < 0 || array_size <= 0)
         return false;
 
@@ -331,7 +655,7 @@ dar_insert(DynamicArray_t *array, void **elements, integer_t array_size,
     }
 
     array->size += array_size;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 
     return true;
 }
@@ -344,6 +668,8 @@ dar_insert(DynamicArray_t *array, void **elements, integer_t array_size,
 bool
 dar_insert_front(DynamicArray_t *array, void *element)
 {
+    dar_settle(array);
+
     if (dar_full(array))
     {
         if (!dar_grow(array, array->size + 1))
@@ -359,7 +685,7 @@ dar_insert_front(DynamicArray_t *array, void *element)
     array->buffer[0] = element;
 
     array->size++;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 
     return true;
 }
@@ -373,6 +699,8 @@ dar_insert_front(DynamicArray_t *array, void *element)
 bool
 dar_insert_at(DynamicArray_t *array, void *element, integer_t index)
 {
+    dar_settle(array);
+
     if (index > array->size || index < 0)
         return false;
 
@@ -401,7 +729,7 @@ dar_insert_at(DynamicArray_t *array, void *element, integer_t index)
         array->buffer[index] = element;
 
         array->size++;
-        array->version_id++;
+        DS_VERSION_BUMP(array);
     }
 
     return true;
@@ -425,11 +753,38 @@ dar_insert_back(DynamicArray_t *array, void *element)
     array->buffer[array->size] = element;
 
     array->size++;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 
     return true;
 }
 
+/// Adds an empty slot at the end of the array and returns it, so an element
+/// can be written directly into the buffer. The pointer is only valid until
+/// the array is modified again.
+///
+/// \param[in] array The target dynamic array.
+///
+/// \return A pointer to the new slot, set to NULL, or NULL if the buffer
+/// could not grow.
+void **
+dar_emplace_back(DynamicArray_t *array)
+{
+    if (dar_full(array))
+    {
+        if (!dar_grow(array, array->size + 1))
+            return NULL;
+    }
+
+    void **slot = &array->buffer[array->size];
+
+    *slot = NULL;
+
+    array->size++;
+    DS_VERSION_BUMP(array);
+
+    return slot;
+}
+
 ///
 /// \param[in] array
 /// \param[in] from
@@ -442,6 +797,8 @@ bool
 dar_remove(DynamicArray_t *array, integer_t from, integer_t to, void ***result,
            integer_t *size)
 {
+    dar_settle(array);
+
     if (from > to || to >= array->size || from < 0 || to < 0)
         return false;
 
@@ -456,6 +813,8 @@ dar_remove(DynamicArray_t *array, integer_t from, integer_t to, void ***result,
     if (!(*result))
         return false;
 
+    DS_STATS_ADD(array, allocations, 1);
+
     // Passing elements to the output array
     for (integer_t i = from, j = 0; i <= to; i++, j++)
     {
@@ -478,7 +837,9 @@ dar_remove(DynamicArray_t *array, integer_t from, integer_t to, void ***result,
         array->buffer[i] = NULL;
     }
 
-    array->version_id++;
+    DS_VERSION_BUMP(array);
+
+    dar_shrink(array);
 
     return true;
 }
@@ -494,6 +855,15 @@ dar_remove_front(DynamicArray_t *array, void **result)
     if (dar_empty(array))
         return false;
 
+    // Only the last element can be removed from a single element array
+    if (array->threshold > 0 && array->size > 1)
+    {
+        if (dar_bury(array, dar_slot(array, 0), result))
+            return true;
+
+        dar_settle(array);
+    }
+
     *result = array->buffer[0];
 
     // Shift elements
@@ -506,7 +876,9 @@ dar_remove_front(DynamicArray_t *array, void **result)
     array->buffer[array->size - 1] = NULL;
 
     array->size--;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
+
+    dar_shrink(array);
 
     return true;
 }
@@ -520,17 +892,26 @@ dar_remove_front(DynamicArray_t *array, void **result)
 bool
 dar_remove_at(DynamicArray_t *array, void **result, integer_t index)
 {
-    if (index >= array->size || index < 0)
+    if (index >= dar_size(array) || index < 0)
         return false;
 
     if (dar_empty(array))
         return false;
 
+    // The last element is always removed from the end of the buffer
+    if (array->threshold > 0 && index < dar_size(array) - 1)
+    {
+        if (dar_bury(array, dar_slot(array, index), result))
+            return true;
+
+        dar_settle(array);
+    }
+
     if (index == 0)
     {
         return dar_remove_front(array, result);
     }
-    else if (index == array->size - 1)
+    else if (index == dar_size(array) - 1)
     {
         return dar_remove_back(array, result);
     }
@@ -548,7 +929,9 @@ dar_remove_at(DynamicArray_t *array, void **result, integer_t index)
         array->buffer[array->size - 1] = NULL;
 
         array->size--;
-        array->version_id++;
+        DS_VERSION_BUMP(array);
+
+        dar_shrink(array);
     }
 
     return true;
@@ -571,7 +954,10 @@ dar_remove_back(DynamicArray_t *array, void **result)
     array->buffer[array->size - 1] = NULL;
 
     array->size--;
-    array->version_id++;
+    dar_trim(array);
+    DS_VERSION_BUMP(array);
+
+    dar_shrink(array);
 
     return true;
 }
@@ -593,16 +979,34 @@ dar_delete(DynamicArray_t *array, integer_t from, integer_t to)
 
     for (integer_t i = 0; i < size; i++)
     {
-        array->interface->free(buffer[i]);
+        interface_release(array->interface, buffer[i]);
     }
 
     free(buffer);
 
-    array->version_id++;
+    DS_STATS_ADD(array, frees, size);
+
+    DS_VERSION_BUMP(array);
 
     return true;
 }
 
+/// Removes the dead slots left by removals in tombstone mode, moving every
+/// element to its final position in a single pass. See dar_set_tombstones().
+///
+/// \param[in] array The target dynamic array.
+///
+/// \return The amount of dead slots removed.
+integer_t
+dar_compact(DynamicArray_t *array)
+{
+    integer_t tombstones = array->tombstones;
+
+    dar_settle(array);
+
+    return tombstones;
+}
+
 ///
 /// \param[in] array1
 /// \param[in] array2
@@ -611,6 +1015,9 @@ dar_delete(DynamicArray_t *array, integer_t from, integer_t to)
 bool
 dar_prepend(DynamicArray_t *array1, DynamicArray_t *array2)
 {
+    dar_settle(array1);
+    dar_settle(array2);
+
     if (dar_empty(array2))
         return true;
 
@@ -642,8 +1049,8 @@ dar_prepend(DynamicArray_t *array1, DynamicArray_t *array2)
 
     array2->size = 0;
 
-    array1->version_id++;
-    array2->version_id++;
+    DS_VERSION_BUMP(array1);
+    DS_VERSION_BUMP(array2);
 
     return true;
 }
@@ -657,6 +1064,9 @@ dar_prepend(DynamicArray_t *array1, DynamicArray_t *array2)
 bool
 dar_add(DynamicArray_t *array1, DynamicArray_t *array2, integer_t index)
 {
+    dar_settle(array1);
+    dar_settle(array2);
+
     if (index > array1->size || index < 0)
         return false;
 
@@ -701,8 +1111,8 @@ dar_add(DynamicArray_t *array1, DynamicArray_t *array2, integer_t index)
 
         array2->size = 0;
 
-        array1->version_id++;
-        array2->version_id++;
+        DS_VERSION_BUMP(array1);
+        DS_VERSION_BUMP(array2);
     }
 
     return true;
@@ -716,6 +1126,8 @@ dar_add(DynamicArray_t *array1, DynamicArray_t *array2, integer_t index)
 bool
 dar_append(DynamicArray_t *array1, DynamicArray_t *array2)
 {
+    dar_settle(array2);
+
     if (dar_empty(array2))
         return true;
 
@@ -741,8 +1153,8 @@ dar_append(DynamicArray_t *array1, DynamicArray_t *array2)
 
     array2->size = 0;
 
-    array1->version_id++;
-    array2->version_id++;
+    DS_VERSION_BUMP(array1);
+    DS_VERSION_BUMP(array2);
 
     return true;
 }
@@ -756,17 +1168,21 @@ dar_append(DynamicArray_t *array1, DynamicArray_t *array2)
 bool
 dar_replace(DynamicArray_t *array, void *element, integer_t index)
 {
-    if (index >= array->size || index < 0)
+    if (index >= dar_size(array) || index < 0)
         return false;
 
     if (dar_empty(array))
         return false;
 
-    array->interface->free(array->buffer[index]);
+    integer_t slot = dar_slot(array, index);
 
-    array->buffer[index] = element;
+    interface_release(array->interface, array->buffer[slot]);
 
-    array->version_id++;
+    DS_STATS_ADD(array, frees, 1);
+
+    array->buffer[slot] = element;
+
+    DS_VERSION_BUMP(array);
 
     return true;
 }
@@ -809,6 +1225,8 @@ dar_fits(DynamicArray_t *array, integer_t size)
 void *
 dar_max(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     if (dar_empty(array))
         return NULL;
 
@@ -816,7 +1234,7 @@ dar_max(DynamicArray_t *array)
 
     for (integer_t i = 1; i < array->size; i++)
     {
-        if (array->interface->compare(array->buffer[i], result) > 0)
+        if (DS_STATS_COMPARE(array, array->buffer[i], result) > 0)
             result = array->buffer[i];
     }
 
@@ -830,6 +1248,8 @@ dar_max(DynamicArray_t *array)
 void *
 dar_min(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     if (dar_empty(array))
         return NULL;
 
@@ -837,7 +1257,7 @@ dar_min(DynamicArray_t *array)
 
     for (integer_t i = 1; i < array->size; i++)
     {
-        if (array->interface->compare(array->buffer[i], result) < 0)
+        if (DS_STATS_COMPARE(array, array->buffer[i], result) < 0)
             result = array->buffer[i];
     }
 
@@ -852,9 +1272,11 @@ dar_min(DynamicArray_t *array)
 integer_t
 dar_index_first(DynamicArray_t *array, void *key)
 {
+    dar_settle(array);
+
     for (integer_t index = 0; index < array->size; index++)
     {
-        if (array->interface->compare(array->buffer[index], key) == 0)
+        if (DS_STATS_COMPARE(array, array->buffer[index], key) == 0)
             return index;
     }
 
@@ -870,9 +1292,11 @@ dar_index_first(DynamicArray_t *array, void *key)
 integer_t
 dar_index_last(DynamicArray_t *array, void *key)
 {
+    dar_settle(array);
+
     for (integer_t index = array->size - 1; index >= 0; index--)
     {
-        if (array->interface->compare(array->buffer[index], key) == 0)
+        if (DS_STATS_COMPARE(array, array->buffer[index], key) == 0)
             return index;
     }
 
@@ -888,9 +1312,11 @@ dar_index_last(DynamicArray_t *array, void *key)
 bool
 dar_contains(DynamicArray_t *array, void *element)
 {
+    dar_settle(array);
+
     for (integer_t i = 0; i < array->size; i++)
     {
-        if (array->interface->compare(array->buffer[i], element) == 0)
+        if (DS_STATS_COMPARE(array, array->buffer[i], element) == 0)
             return true;
     }
 
@@ -906,6 +1332,8 @@ dar_contains(DynamicArray_t *array, void *element)
 bool
 dar_switch(DynamicArray_t *array, integer_t pos1, integer_t pos2)
 {
+    dar_settle(array);
+
     if (pos1 >= array->size || pos2 >= array->size || pos1 < 0 || pos2 < 0)
         return false;
 
@@ -913,7 +1341,7 @@ dar_switch(DynamicArray_t *array, integer_t pos1, integer_t pos2)
     array->buffer[pos1] = array->buffer[pos2];
     array->buffer[pos2] = temp;
 
-    array->version_id++;
+    DS_VERSION_BUMP(array);
 
     return true;
 }
@@ -925,6 +1353,8 @@ dar_switch(DynamicArray_t *array, integer_t pos1, integer_t pos2)
 bool
 dar_reverse(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     for (integer_t i = 0; i < array->size / 2; i++)
     {
         if (!dar_switch(array, i, array->size - i - 1))
@@ -941,6 +1371,8 @@ dar_reverse(DynamicArray_t *array)
 DynamicArray_t *
 dar_copy(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     DynamicArray_t *result = dar_create(array->interface, array->capacity,
             array->growth_rate);
 
@@ -949,11 +1381,18 @@ dar_copy(DynamicArray_t *array)
 
     for (integer_t i = 0; i < array->size; i++)
     {
-        result->buffer[i] = array->interface->copy(array->buffer[i]);
+        result->buffer[i] = interface_copy(array->interface, array->buffer[i]);
     }
 
+    DS_STATS_ADD(array, copies, array->size);
+
     result->size = array->size;
     result->locked = array->locked;
+    result->policy = array->policy;
+    result->step = array->step;
+    result->shrink = array->shrink;
+    result->minimum = array->minimum;
+    result->threshold = array->threshold;
 
     return result;
 }
@@ -965,6 +1404,8 @@ dar_copy(DynamicArray_t *array)
 DynamicArray_t *
 dar_copy_shallow(DynamicArray_t *array)
 {
+    dar_settle(array);
+
     DynamicArray_t *result = dar_create(array->interface, array->capacity,
                                         array->growth_rate);
 
@@ -978,6 +1419,11 @@ dar_copy_shallow(DynamicArray_t *array)
 
     result->size = array->size;
     result->locked = array->locked;
+    result->policy = array->policy;
+    result->step = array->step;
+    result->shrink = array->shrink;
+    result->minimum = array->minimum;
+    result->threshold = array->threshold;
 
     return result;
 }
@@ -990,23 +1436,57 @@ dar_copy_shallow(DynamicArray_t *array)
 void **
 dar_to_array(DynamicArray_t *array, integer_t *length)
 {
-    *length = -1;
+    dar_settle(array);
+
+    *length = 0;
+
+    if (dar_empty(array))
+        return NULL;
 
     void **result = malloc(sizeof(void*) * (size_t)(array->size));
 
-    if (!(*result))
+    if (!result)
         return NULL;
 
-    for (integer_t i = 0; i < *length; i++)
+    for (integer_t i = 0; i < array->size; i++)
     {
-        result[i] = array->interface->copy(array->buffer[i]);
+        result[i] = interface_copy(array->interface, array->buffer[i]);
     }
 
+    DS_STATS_ADD(array, allocations, 1);
+    DS_STATS_ADD(array, copies, array->size);
+
     *length = array->size;
 
     return result;
 }
 
+/// Gives direct access to the elements from \c position to the end of the
+/// array, which are stored contiguously.
+/// Dead slots left by removals in tombstone mode are compacted first. The
+/// span is invalidated by any change to the array.
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] position Index of the first element of the span.
+/// \param[out] span Set to the first element of the span.
+///
+/// \return The amount of elements in the span or 0 if \c position is out of
+/// bounds.
+integer_t
+dar_span(DynamicArray_t *array, integer_t position, void ***span)
+{
+    dar_settle(array);
+
+    *span = NULL;
+
+    if (position < 0 || position >= array->size)
+        return 0;
+
+    *span = array->buffer + position;
+
+    return array->size - position;
+}
+
 ///
 /// \param[in] interface
 /// \param[in] buffer
@@ -1028,27 +1508,331 @@ dar_from_array(Interface_t *interface, void **buffer, integer_t length,
         result->buffer[i] = buffer[i];
     }
 
-    result->version_id++;
+    result->size = length;
+    DS_VERSION_BUMP(result);
 
     return result;
 }
 
+/// Hands the buffer over to the caller without copying it, leaving the array
+/// empty and without a buffer. The array can still be used; a new buffer is
+/// allocated with the next insertion. The caller frees the buffer with
+/// free().
+///
+/// \param[in] array The target dynamic array.
+/// \param[out] size The amount of elements at the start of the buffer.
+///
+/// \return The buffer, which might be NULL if it was already released.
+void **
+dar_release_buffer(DynamicArray_t *array, integer_t *size)
+{
+    dar_settle(array);
+
+    void **buffer = array->buffer;
+
+    *size = array->size;
+
+    array->buffer = NULL;
+    array->capacity = 0;
+    array->size = 0;
+    DS_VERSION_BUMP(array);
+
+    return buffer;
+}
+
+/// Writes the array to a stream as a snapshot that dar_restore() reads back.
+/// Each element is written with the interface's serialize function.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] stream Where the snapshot is written to.
+///
+/// \return True if the snapshot was written or false if writing failed or if
+/// the interface has no serialize function.
+bool
+dar_save(DynamicArray_t *array, FILE *stream)
+{
+    dar_settle(array);
+
+    if (!array->interface->serialize)
+        return false;
+
+    SnapshotHeader_t header;
+
+    snp_header_init(&header, SnapshotDynamicArray, (uint64_t)array->size);
+
+    header.fields[0] = array->growth_rate;
+
+    return snp_write_header(stream, &header)
+           && snp_write_elements(stream, array->interface, array->buffer,
+                                 array->size);
+}
+
+/// Reads an array written by dar_save(). The elements are read straight into
+/// the buffer of the new array, which has the same growth rate as the saved
+/// one.
+///
+/// \par Interface Requirements
+/// - deserialize
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// array to operate.
+/// \param[in] stream Where the snapshot is read from.
+///
+/// \return A new DynamicArray_s or NULL if the stream doesn't hold a snapshot
+/// of an array, if reading or allocation failed or if the interface has no
+/// deserialize function.
+DynamicArray_t *
+dar_restore(Interface_t *interface, FILE *stream)
+{
+    SnapshotHeader_t header;
+
+    if (!interface->deserialize
+        || !snp_read_header(stream, SnapshotDynamicArray, &header))
+        return NULL;
+
+    integer_t size = (integer_t)header.count;
+
+    void **buffer = snp_read_elements(stream, interface, size);
+
+    if (!buffer)
+        return NULL;
+
+    // snp_read_elements() allocates room for at least one element
+    DynamicArray_t *array = dar_adopt(interface, buffer, size,
+                                      size > 0 ? size : 1,
+                                      (integer_t)header.fields[0]);
+
+    if (!array)
+    {
+        for (integer_t i = 0; i < size; i++)
+            interface_release(interface, buffer[i]);
+
+        free(buffer);
+    }
+
+    return array;
+}
+
 ///
 /// \param[in] array
 void
 dar_sort(DynamicArray_t *array)
 {
-    dar_quicksort(array, array->buffer, array->size);
+    dar_settle(array);
+
+    srt_sort(array->buffer, array->size, array->interface->compare);
+
+    DS_VERSION_BUMP(array);
+}
+
+/// Sorts the array in ascending order of the keys returned by \c key using
+/// radix sort. This is a stable sort that takes linear time, much faster than
+/// \ref dar_sort for integer and floating point elements. The interface's
+/// compare function is not used.
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] key The key extractor, like key_int64_t() or key_double().
+///
+/// \return True if the array was sorted or false if there was not enough
+/// memory, in which case the array is left untouched.
+bool
+dar_sort_radix(DynamicArray_t *array, key_f key)
+{
+    dar_settle(array);
+
+    if (!srt_radix_sort(array->buffer, array->size, key))
+        return false;
+
+    DS_VERSION_BUMP(array);
+
+    return true;
+}
+
+/// Sorts the array with its interface's compare function using a temporary
+/// pool of \c threads threads. The result is the same as \ref dar_sort but
+/// the order of equal elements is unspecified.
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] threads The amount of threads, greater than 0.
+///
+/// \return True if the array was sorted, false if \c threads is invalid or
+/// the thread pool could not be created.
+bool
+dar_sort_parallel(DynamicArray_t *array, integer_t threads)
+{
+    dar_settle(array);
+
+    ThreadPool_t *pool = tpl_new(threads);
+
+    if (!pool)
+        return false;
+
+    srt_sort_parallel(array->buffer, array->size, array->interface->compare,
+                      pool);
+
+    tpl_free(pool);
+
+    DS_VERSION_BUMP(array);
+
+    return true;
+}
+
+/// Calls \c visit with every element of the array and \c argument. With
+/// a \c pool the elements are visited in no particular order by several
+/// threads at once; otherwise they are visited in order.
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument passed to \c visit.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+dar_for_each(DynamicArray_t *array, visit_f visit, void *argument,
+             ThreadPool_t *pool)
+{
+    dar_settle(array);
+
+    blk_for_each(array->buffer, array->size, visit, argument, pool);
+}
+
+/// Makes a new DynamicArray_s with the elements made by \c map out of each
+/// element of the array, in the same order. The new array uses \c interface,
+/// which may be of another type of element. With a \c pool the work is split
+/// between its threads, see the functions of Bulk.h; otherwise it runs in the
+/// calling thread.
+///
+/// \par Interface Requirements
+/// - free (of the new interface)
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] interface The interface of the new array.
+/// \param[in] map The function that makes each new element.
+/// \param[in] argument An argument passed to \c map.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return A new DynamicArray_s or NULL if allocation failed or if \c map
+/// returned NULL for any element.
+DynamicArray_t *
+dar_map(DynamicArray_t *array, Interface_t *interface, map_f map,
+        void *argument, ThreadPool_t *pool)
+{
+    dar_settle(array);
+
+    DynamicArray_t *result = dar_create(interface,
+                                        array->size > 0 ? array->size : 1,
+                                        array->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    if (!blk_map(array->buffer, result->buffer, array->size, map, argument,
+                 pool))
+    {
+        for (integer_t i = 0; i < array->size; i++)
+        {
+            if (result->buffer[i])
+                interface_release(interface, result->buffer[i]);
+        }
+
+        dar_free_shallow(result);
+
+        return NULL;
+    }
+
+    result->size = array->size;
+
+    return result;
+}
+
+/// Removes every element of the array for which \c keep returns false,
+/// releasing it with the interface's free function. The elements that are kept
+/// stay in the same order. With a \c pool the work is split between its
+/// threads, see the functions of Bulk.h; otherwise it runs in the calling
+/// thread.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] keep Returns true for the elements that are kept.
+/// \param[in] argument An argument passed to \c keep.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return The amount of elements removed.
+integer_t
+dar_filter_in_place(DynamicArray_t *array, predicate_f keep, void *argument,
+                    ThreadPool_t *pool)
+{
+    dar_settle(array);
+
+    integer_t removed = blk_filter(array->buffer, array->size, keep, argument,
+                                   array->interface, true, pool);
+
+    for (integer_t i = array->size - removed; i < array->size; i++)
+        array->buffer[i] = NULL;
+
+    array->size -= removed;
+    DS_VERSION_BUMP(array);
+
+    dar_shrink(array);
+
+    return removed;
+}
+
+/// Removes and frees every element for which \c remove returns true in a
+/// single pass, keeping the others in the same order. This is faster than
+/// calling dar_remove_at() for each of them, which shifts every element
+/// after the removed one, and it also compacts the dead slots left by
+/// removals in tombstone mode.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in] remove Returns true for the elements that are removed.
+/// \param[in] argument An argument passed to \c remove.
+///
+/// \return The amount of elements removed.
+integer_t
+dar_remove_if(DynamicArray_t *array, predicate_f remove, void *argument)
+{
+    return dar_sweep(array, remove, argument);
+}
 
-    array->version_id++;
+/// Folds every element of the array into \c accumulator with \c reduce.
+/// With a \c pool, parts of the array are folded into copies of
+/// \c identity and then into \c accumulator with \c combine, see
+/// blk_reduce().
+///
+/// \param[in] array DynamicArray_s reference.
+/// \param[in,out] accumulator The initial value and the result.
+/// \param[in] identity The initial value of each partial result.
+/// \param[in] accumulator_size Size in bytes of the accumulator.
+/// \param[in] reduce Folds an element into an accumulator.
+/// \param[in] combine Folds a partial result into an accumulator.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+dar_reduce(DynamicArray_t *array, void *accumulator, const void *identity,
+           size_t accumulator_size, reduce_f reduce, reduce_f combine,
+           ThreadPool_t *pool)
+{
+    dar_settle(array);
+
+    blk_reduce(array->buffer, array->size, accumulator, identity,
+               accumulator_size, reduce, combine, pool);
 }
 
+#ifndef DS_NO_DISPLAY
 ///
 /// \param[in] array
 /// \param[in] display_mode
 void
 dar_display(DynamicArray_t *array, int display_mode)
 {
+    dar_settle(array);
+
     if (dar_empty(array))
     {
         printf("\nDynamicArray\n[ Empty ] \n");
@@ -1088,74 +1872,265 @@ dar_display(DynamicArray_t *array, int display_mode)
             break;
     }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 bool
 dar_grow(DynamicArray_t *array, integer_t required_capacity)
 {
+    DS_TRACE_ENTRY(dar_grow, array->capacity);
+
     if (array->locked)
+    {
+        DS_TRACE_RETURN(dar_grow, array->capacity);
         return false;
+    }
 
     integer_t old_capacity = array->capacity;
 
     // Either grows or get the required capacity
-    integer_t new_capacity = (integer_t) ((double) (array->capacity) *
-                               ((double) (array->growth_rate) / 100.0));
-
-    // 4 is the minimum growth
-    if (array->capacity - old_capacity < 4)
-        array->capacity = old_capacity + 4;
+    array->capacity = ds_grown_capacity(array->policy, old_capacity,
+                                        required_capacity, array->growth_rate,
+                                        array->step, sizeof(void*));
 
-    // Not enough...
-    if (new_capacity < required_capacity)
-        new_capacity = required_capacity;
-
-    array->capacity = new_capacity;
-
-    void **new_buffer = realloc(array->buffer,
+    void **new_buffer = ds_buffer_realloc(array->buffer,
+            sizeof(void*) * (size_t)old_capacity,
             sizeof(void*) * (size_t)array->capacity);
 
     if (!new_buffer)
     {
         array->capacity = old_capacity;
 
+        DS_TRACE_RETURN(dar_grow, array->capacity);
+
         return false;
     }
 
     array->buffer = new_buffer;
-    array->version_id++;
+    DS_VERSION_BUMP(array);
+
+    DS_STATS_ADD(array, grows, 1);
+    DS_STATS_ADD(array, allocations, 1);
+
+    DS_TRACE_RETURN(dar_grow, array->capacity);
 
     return true;
 }
 
+// Halves the buffer while it is a quarter full, which leaves room for both
+// insertions and removals before the next reallocation. Removing a range can
+// halve it many times with a single reallocation.
 static void
-dar_quicksort(DynamicArray_t *array, void **buffer, integer_t size)
+dar_shrink(DynamicArray_t *array)
 {
-    if (size < 2)
+    if (!array->shrink || array->locked)
         return;
 
-    void *pivot = buffer[size / 2];
+    integer_t capacity = array->capacity;
+
+    while (array->size <= capacity / 4 && capacity / 2 >= array->minimum)
+        capacity /= 2;
+
+    if (capacity == array->capacity)
+        return;
+
+    void **new_buffer = ds_buffer_realloc(array->buffer,
+            sizeof(void*) * (size_t)array->capacity,
+            sizeof(void*) * (size_t)capacity);
+
+    // The bigger buffer is still valid
+    if (!new_buffer)
+        return;
+
+    array->buffer = new_buffer;
+    array->capacity = capacity;
+
+    DS_STATS_ADD(array, allocations, 1);
+}
+
+static void
+dar_settle(DynamicArray_t *array)
+{
+    if (array->tombstones > 0)
+        dar_sweep(array, NULL, NULL);
+}
+
+static bool
+dar_is_dead(DynamicArray_t *array, integer_t slot)
+{
+    return array->tombstones > 0
+           && slot < (integer_t)bit_nbits(array->dead)
+           && bit_get(array->dead, (unsigned_t)slot);
+}
 
-    integer_t i, j;
-    for (i = 0, j = size - 1; ; i++, j--)
+// Finds the slot of the element at a given index, skipping whole runs of
+// live slots between the dead ones. The search starts from the last slot
+// found, or from the start of the buffer if the index is before it.
+static integer_t
+dar_slot(DynamicArray_t *array, integer_t index)
+{
+    if (array->tombstones == 0)
+        return index;
+
+    integer_t slot = array->hint_slot;
+    integer_t rank = array->hint_rank;
+
+    if (index < rank)
+        slot = rank = 0;
+
+    integer_t nbits = (integer_t)bit_nbits(array->dead);
+
+    for (;;)
     {
-        while (array->interface->compare(buffer[i], pivot) < 0)
-            i++;
+        unsigned_t next = slot < nbits
+                          ? bit_next_set(array->dead, (unsigned_t)slot)
+                          : (unsigned_t)-1;
 
-        while (array->interface->compare(buffer[j], pivot) > 0)
-            j--;
+        integer_t dead = next == (unsigned_t)-1 ? array->size
+                                                : (integer_t)next;
 
-        if (i >= j)
+        if (rank + (dead - slot) > index)
             break;
 
-        void *temp = buffer[i];
-        buffer[i] = buffer[j];
-        buffer[j] = temp;
+        rank += dead - slot;
+        slot = dead + 1;
+    }
+
+    slot += index - rank;
+
+    array->hint_slot = slot;
+    array->hint_rank = index;
+
+    return slot;
+}
+
+// The first live slot on or after a given slot, the last slot is never dead
+static integer_t
+dar_next_live(DynamicArray_t *array, integer_t slot)
+{
+    if (array->tombstones == 0 || slot >= (integer_t)bit_nbits(array->dead))
+        return slot;
+
+    unsigned_t next = bit_next_clear(array->dead, (unsigned_t)slot);
+
+    return next == (unsigned_t)-1 ? (integer_t)bit_nbits(array->dead)
+                                  : (integer_t)next;
+}
+
+// The last live slot on or before a given slot or -1 if there is none
+static integer_t
+dar_prev_live(DynamicArray_t *array, integer_t slot)
+{
+    while (slot >= 0 && dar_is_dead(array, slot))
+        slot--;
+
+    return slot;
+}
+
+// Marks a slot as dead instead of shifting the elements after it
+static bool
+dar_bury(DynamicArray_t *array, integer_t slot, void **result)
+{
+    if (!array->dead)
+    {
+        array->dead = bit_create((unsigned_t)array->size);
+
+        if (!array->dead)
+            return false;
+    }
+
+    if (!bit_set(array->dead, (unsigned_t)slot))
+        return false;
+
+    // Any hint left from before is outdated
+    if (array->tombstones == 0)
+        array->hint_slot = array->hint_rank = 0;
+
+    if (array->hint_slot > slot)
+        array->hint_rank--;
+
+    *result = array->buffer[slot];
+
+    // Keep no references to removed elements in the buffer
+    array->buffer[slot] = NULL;
+
+    array->tombstones++;
+
+    dar_trim(array);
+
+    DS_VERSION_BUMP(array);
+
+    if (array->tombstones > 0
+        && array->tombstones * 100 >= array->size * array->threshold)
+        dar_sweep(array, NULL, NULL);
+    else
+        dar_shrink(array);
+
+    return true;
+}
+
+// Drops the dead slots at the end of the buffer so the last slot is live
+static void
+dar_trim(DynamicArray_t *array)
+{
+    while (array->size > 0 && dar_is_dead(array, array->size - 1))
+    {
+        array->size--;
+        array->tombstones--;
+
+        bit_clear(array->dead, (unsigned_t)array->size);
+    }
+
+    if (array->hint_slot > array->size)
+    {
+        array->hint_slot = array->size;
+        array->hint_rank = array->size - array->tombstones;
+    }
+}
+
+// Moves every live element that is not removed to the front of the buffer
+static integer_t
+dar_sweep(DynamicArray_t *array, predicate_f remove, void *argument)
+{
+    integer_t kept = 0;
+    integer_t removed = 0;
+
+    for (integer_t i = 0; i < array->size; i++)
+    {
+        if (dar_is_dead(array, i))
+            continue;
+
+        void *element = array->buffer[i];
+
+        if (remove && remove(element, argument))
+        {
+            interface_release(array->interface, element);
+
+            removed++;
+        }
+        else
+            array->buffer[kept++] = element;
     }
 
-    dar_quicksort(array, buffer, i);
-    dar_quicksort(array, buffer + i, size - i);
+    // Keep no references to removed elements in the buffer
+    for (integer_t i = kept; i < array->size; i++)
+        array->buffer[i] = NULL;
+
+    DS_STATS_ADD(array, frees, removed);
+
+    if (array->dead)
+        bit_empty(array->dead);
+
+    array->size = kept;
+    array->tombstones = 0;
+    array->hint_slot = array->hint_rank = 0;
+
+    DS_VERSION_BUMP(array);
+
+    dar_shrink(array);
+
+    return removed;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -1181,11 +2156,13 @@ struct DynamicArrayIterator_s
     /// Index of the current element pointed by the cursor;
     integer_t cursor;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief Target version ID.
     ///
     /// When the iterator is initialized it stores the version_id of the target
     /// structure.
     integer_t target_id;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -1207,8 +2184,8 @@ dar_iter_new(DynamicArray_t *target)
         return NULL;
 
     iter->target = target;
-    iter->target_id = target->version_id;
-    iter->cursor = 0;
+    DS_VERSION_SYNC(iter, target);
+    iter->cursor = dar_next_live(target, 0);
 
     return iter;
 }
@@ -1220,7 +2197,7 @@ void
 dar_iter_retarget(DynamicArrayIterator_t *iter, DynamicArray_t *target)
 {
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
 }
 
 ///
@@ -1244,7 +2221,7 @@ dar_iter_next(DynamicArrayIterator_t *iter)
     if (!dar_iter_has_next(iter))
         return false;
 
-    iter->cursor++;
+    iter->cursor = dar_next_live(iter->target, iter->cursor + 1);
 
     return true;
 }
@@ -1259,10 +2236,10 @@ dar_iter_prev(DynamicArrayIterator_t *iter)
     if (dar_iter_target_modified(iter))
         return false;
 
-    if (!dar_iter_has_next(iter))
+    if (!dar_iter_has_prev(iter))
         return false;
 
-    iter->cursor--;
+    iter->cursor = dar_prev_live(iter->target, iter->cursor - 1);
 
     return true;
 }
@@ -1277,7 +2254,7 @@ dar_iter_to_start(DynamicArrayIterator_t *iter)
     if (dar_iter_target_modified(iter))
         return false;
 
-    iter->cursor = 0;
+    iter->cursor = dar_next_live(iter->target, 0);
 
     return true;
 }
@@ -1314,7 +2291,7 @@ dar_iter_has_next(DynamicArrayIterator_t *iter)
 bool
 dar_iter_has_prev(DynamicArrayIterator_t *iter)
 {
-    return iter->cursor > 0;
+    return dar_prev_live(iter->target, iter->cursor - 1) >= 0;
 }
 
 ///
@@ -1331,8 +2308,8 @@ dar_iter_set(DynamicArrayIterator_t *iter, void *element)
     // The user is responsible for freeing the element
     iter->target->buffer[iter->cursor] = element;
 
-    iter->target_id++;
-    iter->target->version_id++;
+    DS_VERSION_BUMP(iter->target);
+    DS_VERSION_SYNC(iter, iter->target);
 
     return true;
 }
@@ -1368,7 +2345,8 @@ dar_iter_peek_next(DynamicArrayIterator_t *iter)
     if (!dar_iter_has_next(iter))
         return NULL;
 
-    return iter->target->buffer[iter->cursor + 1];
+    return iter->target->buffer[dar_next_live(iter->target,
+                                              iter->cursor + 1)];
 }
 
 ///
@@ -1397,14 +2375,15 @@ dar_iter_peek_prev(DynamicArrayIterator_t *iter)
     if (!dar_iter_has_prev(iter))
         return NULL;
 
-    return iter->target->buffer[iter->cursor - 1];
+    return iter->target->buffer[dar_prev_live(iter->target,
+                                              iter->cursor - 1)];
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool dar_iter_target_modified(DynamicArrayIterator_t *iter)
 {
-    return iter->target_id != iter->target->version_id;
+    return DS_VERSION_CHANGED(iter, iter->target);
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,510 @@
+/**
+ * @file EpochReclaimer.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "EpochReclaimer.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/// Amount of pointers kept in each batch of retired pointers.
+#define EBR_BATCH 64
+
+/// A thread tries to reclaim memory when it leaves a critical section after
+/// retiring at least this many pointers.
+#define EBR_RECLAIM_PERIOD 64
+
+/// An EpochReclaimer_s frees memory that was unlinked from a concurrent
+/// container once no thread can still be reading it. Threads register
+/// themselves and read shared memory only inside critical sections, between
+/// ebr_enter() and ebr_exit(). On entering, a thread announces the global
+/// epoch. The epoch only advances when every thread inside a critical section
+/// has announced the current one.
+///
+/// A pointer unlinked and retired at epoch \c e can only be reached by threads
+/// that entered at \c e or before. Once the epoch reaches <code> e + 2
+/// </code> all of them have left, so the pointer is freed. Retired pointers are
+/// kept by their thread in batches of the same epoch, so a whole batch is
+/// freed at once and retiring rarely allocates.
+///
+/// A thread that stays inside a critical section stops the epoch and every
+/// retired pointer is kept. To bound this, a limit can be set with
+/// ebr_set_limit(). A thread over the limit waits when it leaves its critical
+/// section until enough memory is freed, which delays writers instead of
+/// letting memory grow.
+///
+/// \par Functions
+/// Located in the file EpochReclaimer.c
+struct EpochReclaimer_s
+{
+    /// \brief The global epoch.
+    _Atomic(integer_t) epoch;
+
+    /// \brief Maximum amount of pending pointers of a thread or 0.
+    _Atomic(integer_t) limit;
+
+    /// \brief Protects the list of threads and orphans.
+    pthread_mutex_t lock;
+
+    /// \brief Registered threads.
+    struct EpochThread_s *threads;
+
+    /// \brief Batches left by threads that were unregistered.
+    struct EpochBatch_s *orphans;
+};
+
+/// \brief A thread registered in an EpochReclaimer_s.
+///
+/// Implementation detail. Only the state is read by other threads, everything
+/// else belongs to the thread.
+struct EpochThread_s
+{
+    /// \brief Announced epoch.
+    ///
+    /// <code> 2 * epoch + 1 </code> inside a critical section, 0 outside.
+    _Atomic(integer_t) state;
+
+    /// \brief Nesting depth of critical sections.
+    integer_t depth;
+
+    /// \brief Amount of retired pointers not yet freed.
+    integer_t pending;
+
+    /// \brief Amount of pointers retired since the last reclaim.
+    integer_t retired;
+
+    /// \brief Batches of retired pointers from the oldest to the newest.
+    struct EpochBatch_s *oldest, *newest;
+
+    /// \brief An empty batch kept to avoid allocations.
+    struct EpochBatch_s *spare;
+
+    /// \brief The reclaimer where the thread is registered.
+    struct EpochReclaimer_s *reclaimer;
+
+    /// \brief Neighbours in the list of registered threads.
+    struct EpochThread_s *prev, *next;
+};
+
+/// \brief Pointers retired in the same epoch.
+///
+/// Implementation detail.
+struct EpochBatch_s
+{
+    /// \brief The epoch when the pointers were retired.
+    integer_t epoch;
+
+    /// \brief Amount of pointers.
+    integer_t count;
+
+    /// \brief Next newer batch.
+    struct EpochBatch_s *next;
+
+    /// \brief The pointers and the functions that free them.
+    void *pointers[EBR_BATCH];
+    free_f functions[EBR_BATCH];
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+ebr_advance(EpochReclaimer_t *reclaimer);
+
+static integer_t
+ebr_free_batch(struct EpochBatch_s *batch);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new EpochReclaimer_s at epoch 0 with no limit.
+///
+/// \return A new EpochReclaimer_s or NULL if allocation failed.
+EpochReclaimer_t *
+ebr_new(void)
+{
+    EpochReclaimer_t *reclaimer = malloc(sizeof(EpochReclaimer_t));
+
+    if (!reclaimer)
+        return NULL;
+
+    if (pthread_mutex_init(&reclaimer->lock, NULL) != 0)
+    {
+        free(reclaimer);
+        return NULL;
+    }
+
+    atomic_init(&reclaimer->epoch, 0);
+    atomic_init(&reclaimer->limit, 0);
+
+    reclaimer->threads = NULL;
+    reclaimer->orphans = NULL;
+
+    return reclaimer;
+}
+
+/// Frees from memory the reclaimer and every thread still registered, and
+/// frees every pointer that was retired. No thread can be inside a critical
+/// section.
+///
+/// \param[in] reclaimer The reclaimer to be freed from memory.
+void
+ebr_free(EpochReclaimer_t *reclaimer)
+{
+    while (reclaimer->threads)
+        ebr_unregister(reclaimer->threads);
+
+    while (reclaimer->orphans)
+    {
+        struct EpochBatch_s *batch = reclaimer->orphans;
+        reclaimer->orphans = batch->next;
+
+        ebr_free_batch(batch);
+
+        free(batch);
+    }
+
+    pthread_mutex_destroy(&reclaimer->lock);
+
+    free(reclaimer);
+}
+
+/// Registers a thread. The returned handle must only be used by that thread.
+///
+/// \param[in] reclaimer The reclaimer.
+///
+/// \return A new EpochThread_s or NULL if allocation failed.
+EpochThread_t *
+ebr_register(EpochReclaimer_t *reclaimer)
+{
+    EpochThread_t *thread = malloc(sizeof(EpochThread_t));
+
+    if (!thread)
+        return NULL;
+
+    atomic_init(&thread->state, 0);
+
+    thread->depth = 0;
+    thread->pending = 0;
+    thread->retired = 0;
+    thread->oldest = NULL;
+    thread->newest = NULL;
+    thread->spare = NULL;
+    thread->reclaimer = reclaimer;
+    thread->prev = NULL;
+
+    pthread_mutex_lock(&reclaimer->lock);
+
+    thread->next = reclaimer->threads;
+
+    if (reclaimer->threads)
+        reclaimer->threads->prev = thread;
+
+    reclaimer->threads = thread;
+
+    pthread_mutex_unlock(&reclaimer->lock);
+
+    return thread;
+}
+
+/// Unregisters a thread and frees its handle. Its pending pointers are handed
+/// to the reclaimer and freed by the other threads once it is safe. The thread
+/// can't be inside a critical section.
+///
+/// \param[in] thread The thread to be unregistered.
+void
+ebr_unregister(EpochThread_t *thread)
+{
+    EpochReclaimer_t *reclaimer = thread->reclaimer;
+
+    pthread_mutex_lock(&reclaimer->lock);
+
+    if (thread->prev)
+        thread->prev->next = thread->next;
+    else
+        reclaimer->threads = thread->next;
+
+    if (thread->next)
+        thread->next->prev = thread->prev;
+
+    if (thread->newest)
+    {
+        thread->newest->next = reclaimer->orphans;
+        reclaimer->orphans = thread->oldest;
+    }
+
+    pthread_mutex_unlock(&reclaimer->lock);
+
+    free(thread->spare);
+    free(thread);
+}
+
+/// \param[in] reclaimer The reclaimer.
+///
+/// \return The global epoch.
+integer_t
+ebr_epoch(EpochReclaimer_t *reclaimer)
+{
+    return atomic_load(&reclaimer->epoch);
+}
+
+/// \param[in] reclaimer The reclaimer.
+///
+/// \return The amount of pending pointers a thread may have or 0 if there is
+/// no limit.
+integer_t
+ebr_limit(EpochReclaimer_t *reclaimer)
+{
+    return atomic_load_explicit(&reclaimer->limit, memory_order_relaxed);
+}
+
+/// \param[in] thread The thread.
+///
+/// \return The amount of pointers retired by the thread that were not freed
+/// yet.
+integer_t
+ebr_pending(EpochThread_t *thread)
+{
+    return thread->pending;
+}
+
+/// Sets the amount of pending pointers a thread may have. A thread over the
+/// limit waits when it leaves its critical section until it is back under the
+/// limit. Memory is then bounded even if a thread stalls inside a critical
+/// section, but the threads that retire pointers wait for it. No thread can
+/// wait for another thread while inside a critical section.
+///
+/// \param[in] reclaimer The reclaimer.
+/// \param[in] limit Maximum amount of pending pointers of every thread or 0 for
+/// no limit.
+void
+ebr_set_limit(EpochReclaimer_t *reclaimer, integer_t limit)
+{
+    atomic_store_explicit(&reclaimer->limit, limit > 0 ? limit : 0,
+                          memory_order_relaxed);
+}
+
+/// Starts a critical section. Memory retired by other threads is not freed
+/// until the section ends. Sections can be nested.
+///
+/// \param[in] thread The calling thread.
+void
+ebr_enter(EpochThread_t *thread)
+{
+    if (thread->depth++ > 0)
+        return;
+
+    integer_t epoch = atomic_load(&thread->reclaimer->epoch);
+
+    atomic_store(&thread->state, 2 * epoch + 1);
+
+    // The announcement must be visible before any shared memory is read
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/// Ends a critical section. Leaving the outermost section tries to reclaim
+/// memory if enough pointers were retired, and waits if the thread is over the
+/// limit.
+///
+/// \param[in] thread The calling thread.
+void
+ebr_exit(EpochThread_t *thread)
+{
+    if (--thread->depth > 0)
+        return;
+
+    atomic_store(&thread->state, 0);
+
+    integer_t limit = ebr_limit(thread->reclaimer);
+
+    if (limit > 0 && thread->pending > limit)
+    {
+        while (thread->pending > limit)
+        {
+            if (ebr_reclaim(thread) == 0)
+                sched_yield();
+        }
+    }
+    else if (thread->retired >= EBR_RECLAIM_PERIOD)
+        ebr_reclaim(thread);
+}
+
+/// Retires a pointer that was unlinked from a shared structure. It is freed
+/// with the given function once every thread that might have reached it has
+/// left its critical section. Can be called inside or outside a critical
+/// section.
+///
+/// \param[in] thread The calling thread.
+/// \param[in] pointer The pointer to be freed.
+/// \param[in] function The function that frees it.
+///
+/// \return True if the pointer was retired.
+/// \return False if allocation failed. The pointer is then still owned by the
+/// caller.
+bool
+ebr_retire(EpochThread_t *thread, void *pointer, free_f function)
+{
+    integer_t epoch = atomic_load(&thread->reclaimer->epoch);
+
+    struct EpochBatch_s *batch = thread->newest;
+
+    if (!batch || batch->epoch != epoch || batch->count == EBR_BATCH)
+    {
+        if (thread->spare)
+        {
+            batch = thread->spare;
+            thread->spare = NULL;
+        }
+        else
+        {
+            batch = malloc(sizeof(struct EpochBatch_s));
+
+            if (!batch)
+                return false;
+        }
+
+        batch->epoch = epoch;
+        batch->count = 0;
+        batch->next = NULL;
+
+        if (thread->newest)
+            thread->newest->next = batch;
+        else
+            thread->oldest = batch;
+
+        thread->newest = batch;
+    }
+
+    batch->pointers[batch->count] = pointer;
+    batch->functions[batch->count] = function;
+    batch->count++;
+
+    thread->pending++;
+    thread->retired++;
+
+    return true;
+}
+
+/// Advances the global epoch if every thread inside a critical section has
+/// announced it, and frees the batches of the thread and of unregistered
+/// threads that became safe.
+///
+/// \param[in] thread The calling thread.
+///
+/// \return The amount of pointers freed.
+integer_t
+ebr_reclaim(EpochThread_t *thread)
+{
+    EpochReclaimer_t *reclaimer = thread->reclaimer;
+
+    ebr_advance(reclaimer);
+
+    integer_t epoch = atomic_load(&reclaimer->epoch);
+    integer_t total = 0;
+
+    while (thread->oldest && thread->oldest->epoch + 2 <= epoch)
+    {
+        struct EpochBatch_s *batch = thread->oldest;
+
+        thread->oldest = batch->next;
+
+        if (!thread->oldest)
+            thread->newest = NULL;
+
+        integer_t count = ebr_free_batch(batch);
+
+        // Kept for the next retire instead of freed
+        if (!thread->spare)
+            thread->spare = batch;
+        else
+            free(batch);
+
+        thread->pending -= count;
+        total += count;
+    }
+
+    thread->retired = 0;
+
+    pthread_mutex_lock(&reclaimer->lock);
+
+    for (struct EpochBatch_s **link = &reclaimer->orphans; *link; )
+    {
+        struct EpochBatch_s *batch = *link;
+
+        if (batch->epoch + 2 <= epoch)
+        {
+            *link = batch->next;
+            total += ebr_free_batch(batch);
+
+            free(batch);
+        }
+        else
+            link = &batch->next;
+    }
+
+    pthread_mutex_unlock(&reclaimer->lock);
+
+    return total;
+}
+
+/// Waits until every pointer retired by the thread is freed. The thread can't
+/// be inside a critical section.
+///
+/// \param[in] thread The calling thread.
+void
+ebr_drain(EpochThread_t *thread)
+{
+    while (thread->pending > 0)
+    {
+        if (ebr_reclaim(thread) == 0)
+            sched_yield();
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Moves the global epoch forward if no thread in a critical section is
+// behind it
+static bool
+ebr_advance(EpochReclaimer_t *reclaimer)
+{
+    pthread_mutex_lock(&reclaimer->lock);
+
+    integer_t epoch = atomic_load(&reclaimer->epoch);
+
+    for (EpochThread_t *thread = reclaimer->threads; thread;
+         thread = thread->next)
+    {
+        integer_t state = atomic_load(&thread->state);
+
+        if (state != 0 && state != 2 * epoch + 1)
+        {
+            pthread_mutex_unlock(&reclaimer->lock);
+            return false;
+        }
+    }
+
+    atomic_store(&reclaimer->epoch, epoch + 1);
+
+    pthread_mutex_unlock(&reclaimer->lock);
+
+    return true;
+}
+
+// Frees every pointer of a batch, but not the batch
+static integer_t
+ebr_free_batch(struct EpochBatch_s *batch)
+{
+    integer_t count = batch->count;
+
+    for (integer_t i = 0; i < count; i++)
+        batch->functions[i](batch->pointers[i]);
+
+    batch->count = 0;
+
+    return count;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,282 @@
+/**
+ * @file FenwickTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "FenwickTree.h"
+
+/// A FenwickTree_s, or binary indexed tree, keeps an array of integers so
+/// that both changing a value and summing a prefix of the array take
+/// <code> O(log n) </code> time, where rescanning the array takes
+/// <code> O(n) </code> per sum.
+///
+/// The buffer is indexed from 1. Position \c i holds the sum of the values in
+/// <code> (i - lowbit(i), i] </code>, where \c lowbit(i) is the lowest set bit
+/// of \c i. A prefix sum adds the positions found by clearing the lowest bit
+/// until zero, and an update adds to the positions found by adding it until
+/// past the end.
+///
+/// Values are stored by value in a single buffer, without any pointers.
+///
+/// \par Functions
+/// Located in the file FenwickTree.c
+struct FenwickTree_s
+{
+    /// \brief Partial sums, indexed from 1.
+    int64_t *buffer;
+
+    /// \brief Amount of values.
+    integer_t size;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+fwt_build(FenwickTree_t *tree);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a FenwickTree_s of a given size with every value set to zero.
+///
+/// \param[in] size Amount of values.
+///
+/// \return A new FenwickTree_s or NULL if allocation failed or the size is
+/// negative.
+FenwickTree_t *
+fwt_new(integer_t size)
+{
+    if (size < 0)
+        return NULL;
+
+    FenwickTree_t *tree = malloc(sizeof(FenwickTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->buffer = calloc((size_t)size + 1, sizeof(int64_t));
+
+    if (!tree->buffer)
+    {
+        free(tree);
+        return NULL;
+    }
+
+    tree->size = size;
+
+    return tree;
+}
+
+/// Builds a FenwickTree_s from a buffer of values. Each partial sum is pushed
+/// once to the position that contains it, so it takes linear time instead of
+/// one update per value.
+///
+/// \param[in] values Buffer of values.
+/// \param[in] size Amount of values in the buffer.
+///
+/// \return A new FenwickTree_s or NULL if allocation failed or the size is
+/// negative.
+FenwickTree_t *
+fwt_from_buffer(const int64_t *values, integer_t size)
+{
+    FenwickTree_t *tree = fwt_new(size);
+
+    if (!tree)
+        return NULL;
+
+    if (size > 0)
+        memcpy(tree->buffer + 1, values, sizeof(int64_t) * (size_t)size);
+
+    fwt_build(tree);
+
+    return tree;
+}
+
+/// Builds a FenwickTree_s from a DynamicArray_s whose elements are pointers to
+/// \c int64_t. The values are copied and the array is not changed.
+///
+/// \param[in] array DynamicArray_s reference.
+///
+/// \return A new FenwickTree_s or NULL if allocation failed.
+FenwickTree_t *
+fwt_from_array(DynamicArray_t *array)
+{
+    integer_t size = dar_size(array);
+
+    FenwickTree_t *tree = fwt_new(size);
+
+    if (!tree)
+        return NULL;
+
+    for (integer_t i = 0; i < size; i++)
+        tree->buffer[i + 1] = *(int64_t*)dar_get(array, i);
+
+    fwt_build(tree);
+
+    return tree;
+}
+
+/// Frees from memory a FenwickTree_s.
+///
+/// \param[in] tree The Fenwick tree to be freed from memory.
+void
+fwt_free(FenwickTree_t *tree)
+{
+    free(tree->buffer);
+    free(tree);
+}
+
+/// \param[in] tree FenwickTree_s reference.
+///
+/// \return The amount of values in the tree.
+integer_t
+fwt_size(FenwickTree_t *tree)
+{
+    return tree->size;
+}
+
+/// Returns the value at a given index. Takes <code> O(log n) </code> time
+/// since only partial sums are stored.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] index Index of the value.
+/// \param[out] result The value.
+///
+/// \return False if the index is out of bounds.
+bool
+fwt_get(FenwickTree_t *tree, integer_t index, int64_t *result)
+{
+    return fwt_sum(tree, index, index, result);
+}
+
+/// Adds an amount to the value at a given index.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] index Index of the value.
+/// \param[in] delta The amount to be added.
+///
+/// \return False if the index is out of bounds.
+bool
+fwt_add(FenwickTree_t *tree, integer_t index, int64_t delta)
+{
+    if (index < 0 || index >= tree->size)
+        return false;
+
+    for (integer_t i = index + 1; i <= tree->size; i += i & -i)
+        tree->buffer[i] += delta;
+
+    return true;
+}
+
+/// Replaces the value at a given index.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] index Index of the value.
+/// \param[in] value The new value.
+///
+/// \return False if the index is out of bounds.
+bool
+fwt_set(FenwickTree_t *tree, integer_t index, int64_t value)
+{
+    int64_t current;
+
+    if (!fwt_get(tree, index, &current))
+        return false;
+
+    return fwt_add(tree, index, value - current);
+}
+
+/// Sums the first \c count values of the tree. A count bigger than the tree
+/// sums every value and a count smaller than one sums none.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] count Amount of values to be summed.
+///
+/// \return The sum of the values at the indexes from 0 to
+/// <code> count - 1 </code>.
+int64_t
+fwt_prefix(FenwickTree_t *tree, integer_t count)
+{
+    if (count > tree->size)
+        count = tree->size;
+
+    int64_t sum = 0;
+
+    for (integer_t i = count; i > 0; i -= i & -i)
+        sum += tree->buffer[i];
+
+    return sum;
+}
+
+/// Sums the values between two indexes, both inclusive.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] from Index of the first value.
+/// \param[in] to Index of the last value.
+/// \param[out] result The sum.
+///
+/// \return False if the indexes are out of bounds or not in order.
+bool
+fwt_sum(FenwickTree_t *tree, integer_t from, integer_t to, int64_t *result)
+{
+    if (from < 0 || from > to || to >= tree->size)
+        return false;
+
+    *result = fwt_prefix(tree, to + 1) - fwt_prefix(tree, from);
+
+    return true;
+}
+
+/// Finds the first index where the prefix sum, including the value at that
+/// index, is not smaller than a target. Descends through the partial sums in
+/// <code> O(log n) </code> time, so every value must be non-negative.
+///
+/// \param[in] tree FenwickTree_s reference.
+/// \param[in] target The sum to be reached.
+///
+/// \return The index or the size of the tree if the sum of every value is
+/// smaller than the target.
+integer_t
+fwt_lower_bound(FenwickTree_t *tree, int64_t target)
+{
+    if (target <= 0)
+        return 0;
+
+    integer_t position = 0, step = 1;
+
+    while (step * 2 <= tree->size)
+        step *= 2;
+
+    for (; step > 0; step /= 2)
+    {
+        if (position + step <= tree->size
+            && tree->buffer[position + step] < target)
+        {
+            position += step;
+            target -= tree->buffer[position];
+        }
+    }
+
+    // Every prefix up to position is smaller than the target
+    return position;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Turns a buffer of values into partial sums by adding each position to the
+// next one that contains it
+static void
+fwt_build(FenwickTree_t *tree)
+{
+    for (integer_t i = 1; i <= tree->size; i++)
+    {
+        integer_t parent = i + (i & -i);
+
+        if (parent <= tree->size)
+            tree->buffer[parent] += tree->buffer[i];
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,807 @@
+/**
+ * @file Graph.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Graph.h"
+#include "BitArray.h"
+#include "Heap.h"
+#include "Utility.h"
+
+#include <stdatomic.h>
+
+/// Graphs with fewer vertices are not worth searching in parallel.
+#define GPH_PARALLEL_THRESHOLD 65536
+
+/// Amount of bits in a word.
+#define GPH_WORD_BITS (sizeof(unsigned_t) * 8)
+
+/// A Graph_s stores its edges in compressed sparse row (CSR) format: the
+/// targets of every edge, grouped by source vertex, in a single array, and an
+/// array of offsets where the edges of each vertex start. A traversal reads
+/// both arrays front to back instead of chasing a list node per edge, and
+/// the graph takes two integers per edge plus one per vertex.
+///
+/// A graph is built at once from a list of edges in O(V + E) and can't be
+/// changed afterwards. Undirected graphs store each edge in both directions.
+/// Searches write their results to arrays given by the caller, indexed by
+/// vertex, so a graph can be searched by many threads at once.
+///
+/// \par Functions
+/// Located in the file Graph.c
+struct Graph_s
+{
+    /// \brief Where the edges of each vertex start in \c targets. Has one
+    /// more element than there are vertices, the amount of stored edges.
+    integer_t *offsets;
+
+    /// \brief The target of every stored edge.
+    integer_t *targets;
+
+    /// \brief The weight of every stored edge or NULL if they are all 1.
+    int64_t *weights;
+
+    /// \brief Amount of vertices.
+    integer_t vertices;
+
+    /// \brief Amount of edges the graph was built with.
+    integer_t edges;
+
+    /// \brief If the edges only go from their source to their target.
+    bool directed;
+};
+
+/// \brief A part of one level of a parallel breadth-first search.
+///
+/// Implementation detail. Explores the vertices of \c current in
+/// [from, to) and adds the ones they discover to \c next.
+struct GraphTask_s
+{
+    Graph_t *graph;
+
+    /// \brief The vertices of the level being explored.
+    BitArray_t *current;
+
+    /// \brief The vertices discovered by this task.
+    BitArray_t *next;
+
+    /// \brief One bit for every vertex that was discovered, shared by every
+    /// task and set atomically.
+    _Atomic(unsigned_t) *visited;
+
+    /// \brief The results.
+    integer_t *distances, *parents;
+
+    /// \brief The range of vertices explored by this task.
+    integer_t from, to;
+
+    /// \brief Distance of the explored vertices.
+    integer_t level;
+
+    /// \brief If the task discovered any vertex.
+    bool found;
+};
+
+typedef struct GraphTask_s GraphTask_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+gph_bfs_task(void *argument);
+
+static integer_t
+gph_find(integer_t *roots, integer_t vertex);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Builds a graph from a list of edges. Edge \c i goes from \c sources[i] to
+/// \c targets[i] and, if the graph is undirected, also back. The edges are
+/// placed with a counting sort on their source, in O(V + E), and keep their
+/// order among those of the same vertex.
+///
+/// \param[in] vertices Amount of vertices, numbered from 0.
+/// \param[in] edges Amount of edges in the list.
+/// \param[in] sources The source vertex of each edge.
+/// \param[in] targets The target vertex of each edge.
+/// \param[in] weights The weight of each edge, which can't be negative, or
+/// NULL for a weight of 1 on every edge.
+/// \param[in] directed If the edges only go from their source to their
+/// target.
+///
+/// \return A new graph or NULL if allocation failed, if \c vertices is not
+/// positive or if an edge has an invalid vertex or a negative weight.
+Graph_t *
+gph_new(integer_t vertices, integer_t edges, const integer_t *sources,
+        const integer_t *targets, const int64_t *weights, bool directed)
+{
+    if (vertices <= 0 || edges < 0)
+        return NULL;
+
+    for (integer_t i = 0; i < edges; i++)
+    {
+        if (sources[i] < 0 || sources[i] >= vertices || targets[i] < 0 ||
+            targets[i] >= vertices || (weights && weights[i] < 0))
+            return NULL;
+    }
+
+    Graph_t *graph = malloc(sizeof(Graph_t));
+
+    if (!graph)
+        return NULL;
+
+    integer_t stored = directed ? edges : edges * 2;
+
+    graph->offsets = calloc((size_t)vertices + 1, sizeof(integer_t));
+    graph->targets = malloc(sizeof(integer_t) * (size_t)(stored + 1));
+    graph->weights = NULL;
+
+    if (weights)
+        graph->weights = malloc(sizeof(int64_t) * (size_t)(stored + 1));
+
+    if (!graph->offsets || !graph->targets || (weights && !graph->weights))
+    {
+        gph_free(graph);
+        return NULL;
+    }
+
+    graph->vertices = vertices;
+    graph->edges = edges;
+    graph->directed = directed;
+
+    integer_t *offsets = graph->offsets;
+
+    // The degree of each vertex, shifted by one
+    for (integer_t i = 0; i < edges; i++)
+    {
+        offsets[sources[i] + 1]++;
+
+        if (!directed)
+            offsets[targets[i] + 1]++;
+    }
+
+    for (integer_t v = 0; v < vertices; v++)
+        offsets[v + 1] += offsets[v];
+
+    // Each edge is placed at the next free position of its source, which
+    // moves the offsets one vertex ahead; they are moved back at the end
+    for (integer_t i = 0; i < edges; i++)
+    {
+        integer_t position = offsets[sources[i]]++;
+
+        graph->targets[position] = targets[i];
+
+        if (weights)
+            graph->weights[position] = weights[i];
+
+        if (!directed)
+        {
+            position = offsets[targets[i]]++;
+
+            graph->targets[position] = sources[i];
+
+            if (weights)
+                graph->weights[position] = weights[i];
+        }
+    }
+
+    for (integer_t v = vertices; v > 0; v--)
+        offsets[v] = offsets[v - 1];
+
+    offsets[0] = 0;
+
+    return graph;
+}
+
+/// Frees from memory a graph.
+///
+/// \param[in] graph The graph to be freed.
+void
+gph_free(Graph_t *graph)
+{
+    free(graph->offsets);
+    free(graph->targets);
+    free(graph->weights);
+    free(graph);
+}
+
+/// \param[in] graph The graph.
+///
+/// \return The amount of vertices.
+integer_t
+gph_vertices(Graph_t *graph)
+{
+    return graph->vertices;
+}
+
+/// \param[in] graph The graph.
+///
+/// \return The amount of edges the graph was built with. Undirected graphs
+/// store twice as many.
+integer_t
+gph_edges(Graph_t *graph)
+{
+    return graph->edges;
+}
+
+/// \param[in] graph The graph.
+///
+/// \return True if the graph is directed, otherwise false.
+bool
+gph_directed(Graph_t *graph)
+{
+    return graph->directed;
+}
+
+/// \param[in] graph The graph.
+/// \param[in] vertex A vertex of the graph.
+///
+/// \return The amount of edges that leave the vertex or -1 if it is not a
+/// vertex of the graph.
+integer_t
+gph_degree(Graph_t *graph, integer_t vertex)
+{
+    if (vertex < 0 || vertex >= graph->vertices)
+        return -1;
+
+    return graph->offsets[vertex + 1] - graph->offsets[vertex];
+}
+
+/// Returns the targets of the edges that leave a vertex, in the order they
+/// were given to gph_new(), straight from the storage of the graph.
+///
+/// \param[in] graph The graph.
+/// \param[in] vertex A vertex of the graph.
+/// \param[out] degree The amount of targets.
+///
+/// \return The targets of the edges or NULL if \c vertex is not a vertex of
+/// the graph.
+const integer_t *
+gph_neighbours(Graph_t *graph, integer_t vertex, integer_t *degree)
+{
+    if (vertex < 0 || vertex >= graph->vertices)
+        return NULL;
+
+    *degree = graph->offsets[vertex + 1] - graph->offsets[vertex];
+
+    return graph->targets + graph->offsets[vertex];
+}
+
+/// Returns the weights of the edges that leave a vertex, in the same order
+/// as gph_neighbours().
+///
+/// \param[in] graph The graph.
+/// \param[in] vertex A vertex of the graph.
+///
+/// \return The weights of the edges or NULL if the graph was built without
+/// weights or \c vertex is not a vertex of the graph.
+const int64_t *
+gph_weights(Graph_t *graph, integer_t vertex)
+{
+    if (!graph->weights || vertex < 0 || vertex >= graph->vertices)
+        return NULL;
+
+    return graph->weights + graph->offsets[vertex];
+}
+
+/// Finds the amount of edges on the shortest path from \c source to every
+/// vertex. The search goes one level at a time: the vertices of the current
+/// level, a BitArray_s, are read in order with bit_next_set() and the ones
+/// they discover are added to the next level, so the edges are read in the
+/// order they are stored.
+///
+/// \param[in] graph The graph.
+/// \param[in] source Where the search starts.
+/// \param[out] distances The distance of each vertex, -1 for the ones that
+/// are not reachable. Must have room for every vertex.
+/// \param[out] parents The vertex each vertex was discovered from, -1 for
+/// the source and the vertices that are not reachable. Can be NULL.
+///
+/// \return True if the search was done, false if \c source is not a vertex
+/// or if allocation failed.
+bool
+gph_bfs(Graph_t *graph, integer_t source, integer_t *distances,
+        integer_t *parents)
+{
+    if (source < 0 || source >= graph->vertices)
+        return false;
+
+    unsigned_t size = (unsigned_t)graph->vertices;
+
+    BitArray_t *visited = bit_create(size);
+    BitArray_t *current = bit_create(size);
+    BitArray_t *next = bit_create(size);
+
+    if (!visited || !current || !next)
+    {
+        if (visited) bit_free(visited);
+        if (current) bit_free(current);
+        if (next) bit_free(next);
+
+        return false;
+    }
+
+    for (integer_t v = 0; v < graph->vertices; v++)
+    {
+        distances[v] = -1;
+
+        if (parents)
+            parents[v] = -1;
+    }
+
+    distances[source] = 0;
+
+    bit_set(visited, (unsigned_t)source);
+    bit_set(current, (unsigned_t)source);
+
+    for (integer_t level = 1; ; level++)
+    {
+        bool found = false;
+
+        unsigned_t v = bit_next_set(current, 0);
+
+        while (v != (unsigned_t)-1)
+        {
+            for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1];
+                 e++)
+            {
+                unsigned_t w = (unsigned_t)graph->targets[e];
+
+                if (bit_get(visited, w))
+                    continue;
+
+                bit_set(visited, w);
+                bit_set(next, w);
+
+                distances[w] = level;
+
+                if (parents)
+                    parents[w] = (integer_t)v;
+
+                found = true;
+            }
+
+            v = bit_next_set(current, v + 1);
+        }
+
+        if (!found)
+            break;
+
+        BitArray_t *swap = current;
+        current = next;
+        next = swap;
+
+        bit_empty(next);
+    }
+
+    bit_free(visited);
+    bit_free(current);
+    bit_free(next);
+
+    return true;
+}
+
+/// Same as gph_bfs() but each level is split in one range of vertices per
+/// thread of \c pool. Each thread discovers vertices into a BitArray_s of
+/// its own and the vertex is claimed by setting its bit in a shared array
+/// with an atomic or, so only one thread writes its distance and parent.
+/// The next level is the union of what every thread discovered.
+///
+/// The results are the same as those of gph_bfs() except for the parents,
+/// since a vertex reachable from many vertices of a level is discovered by
+/// any of them. Graphs with few vertices and pools with a single thread fall
+/// back to gph_bfs().
+///
+/// \param[in] graph The graph.
+/// \param[in] source Where the search starts.
+/// \param[out] distances The distance of each vertex, -1 for the ones that
+/// are not reachable. Must have room for every vertex.
+/// \param[out] parents The vertex each vertex was discovered from, -1 for
+/// the source and the vertices that are not reachable. Can be NULL.
+/// \param[in] pool The thread pool that will run the search.
+///
+/// \return True if the search was done, false if \c source is not a vertex
+/// or if allocation failed.
+bool
+gph_bfs_parallel(Graph_t *graph, integer_t source, integer_t *distances,
+                 integer_t *parents, ThreadPool_t *pool)
+{
+    integer_t count = tpl_threads(pool);
+
+    if (count == 1 || graph->vertices < GPH_PARALLEL_THRESHOLD)
+        return gph_bfs(graph, source, distances, parents);
+
+    if (source < 0 || source >= graph->vertices)
+        return false;
+
+    unsigned_t size = (unsigned_t)graph->vertices;
+    unsigned_t words = (size + GPH_WORD_BITS - 1) / GPH_WORD_BITS;
+
+    _Atomic(unsigned_t) *visited = malloc(sizeof(*visited) * words);
+    BitArray_t *current = bit_create(size);
+    GraphTask_t *tasks = calloc((size_t)count, sizeof(GraphTask_t));
+
+    bool success = visited && current && tasks;
+
+    for (integer_t t = 0; success && t < count; t++)
+    {
+        tasks[t].next = bit_create(size);
+
+        success = tasks[t].next != NULL;
+    }
+
+    if (success)
+    {
+        for (unsigned_t i = 0; i < words; i++)
+            atomic_init(&visited[i], 0);
+
+        for (integer_t v = 0; v < graph->vertices; v++)
+        {
+            distances[v] = -1;
+
+            if (parents)
+                parents[v] = -1;
+        }
+
+        distances[source] = 0;
+
+        atomic_store_explicit(&visited[source / GPH_WORD_BITS],
+                              (unsigned_t)1 << (source % GPH_WORD_BITS),
+                              memory_order_relaxed);
+
+        bit_set(current, (unsigned_t)source);
+
+        // Every range is made of whole words of the current level
+        integer_t chunk = (integer_t)((words + count - 1) / count)
+                          * (integer_t)GPH_WORD_BITS;
+
+        for (integer_t t = 0; t < count; t++)
+        {
+            tasks[t].graph = graph;
+            tasks[t].visited = visited;
+            tasks[t].distances = distances;
+            tasks[t].parents = parents;
+            tasks[t].from = chunk * t < graph->vertices ? chunk * t
+                                                        : graph->vertices;
+            tasks[t].to = chunk * (t + 1) < graph->vertices ? chunk * (t + 1)
+                                                            : graph->vertices;
+        }
+    }
+
+    for (integer_t level = 1; success; level++)
+    {
+        for (integer_t t = 0; t < count; t++)
+        {
+            tasks[t].current = current;
+            tasks[t].level = level;
+            tasks[t].found = false;
+
+            if (!tpl_submit(pool, gph_bfs_task, &tasks[t]))
+            {
+                gph_bfs_task(&tasks[t]);
+            }
+        }
+
+        tpl_wait(pool);
+
+        bool found = false;
+
+        bit_empty(current);
+
+        for (integer_t t = 0; t < count; t++)
+        {
+            if (!tasks[t].found)
+                continue;
+
+            bit_OR(current, tasks[t].next);
+            bit_empty(tasks[t].next);
+
+            found = true;
+        }
+
+        if (!found)
+            break;
+    }
+
+    for (integer_t t = 0; tasks && t < count; t++)
+    {
+        if (tasks[t].next)
+            bit_free(tasks[t].next);
+    }
+
+    if (current)
+        bit_free(current);
+
+    free(visited);
+    free(tasks);
+
+    return success;
+}
+
+/// Lists the vertices reachable from \c source in the order a depth-first
+/// search first visits them, the same order as a recursive search that
+/// follows the edges of each vertex in the order they are stored. The
+/// search keeps its own stack, so it works on paths of any length.
+///
+/// \param[in] graph The graph.
+/// \param[in] source Where the search starts.
+/// \param[out] order The visited vertices, in order. Must have room for
+/// every vertex.
+/// \param[out] parents The vertex each vertex was visited from, -1 for the
+/// source and the vertices that are not reachable. Can be NULL.
+///
+/// \return The amount of visited vertices or -1 if \c source is not a vertex
+/// or if allocation failed.
+integer_t
+gph_dfs(Graph_t *graph, integer_t source, integer_t *order,
+        integer_t *parents)
+{
+    if (source < 0 || source >= graph->vertices)
+        return -1;
+
+    BitArray_t *visited = bit_create((unsigned_t)graph->vertices);
+
+    // The vertices of the current path and the next edge of each one
+    integer_t *stack = malloc(sizeof(integer_t) * (size_t)graph->vertices);
+    integer_t *edges = malloc(sizeof(integer_t) * (size_t)graph->vertices);
+
+    if (!visited || !stack || !edges)
+    {
+        if (visited) bit_free(visited);
+        free(stack);
+        free(edges);
+
+        return -1;
+    }
+
+    if (parents)
+    {
+        for (integer_t v = 0; v < graph->vertices; v++)
+            parents[v] = -1;
+    }
+
+    integer_t count = 0, top = 0;
+
+    bit_set(visited, (unsigned_t)source);
+
+    order[count++] = source;
+    stack[0] = source;
+    edges[0] = graph->offsets[source];
+
+    while (top >= 0)
+    {
+        integer_t v = stack[top];
+
+        if (edges[top] == graph->offsets[v + 1])
+        {
+            top--;
+            continue;
+        }
+
+        integer_t w = graph->targets[edges[top]++];
+
+        if (bit_get(visited, (unsigned_t)w))
+            continue;
+
+        bit_set(visited, (unsigned_t)w);
+
+        order[count++] = w;
+
+        if (parents)
+            parents[w] = v;
+
+        top++;
+        stack[top] = w;
+        edges[top] = graph->offsets[w];
+    }
+
+    bit_free(visited);
+    free(stack);
+    free(edges);
+
+    return count;
+}
+
+/// Finds the smallest sum of weights on a path from \c source to every
+/// vertex. The vertices waiting to be settled are kept in a min Heap_s of
+/// pointers to their distances, so the distance of a vertex is lowered in
+/// place and fixed with hep_update(), the decrease-key of the heap, instead
+/// of inserting the vertex again. Each vertex is in the heap at most once.
+///
+/// \param[in] graph The graph.
+/// \param[in] source Where the search starts.
+/// \param[out] distances The distance of each vertex, INT64_MAX for the
+/// ones that are not reachable. Must have room for every vertex.
+/// \param[out] parents The previous vertex on the path to each vertex, -1
+/// for the source and the vertices that are not reachable. Can be NULL.
+///
+/// \return True if the search was done, false if \c source is not a vertex
+/// or if allocation failed.
+bool
+gph_dijkstra(Graph_t *graph, integer_t source, int64_t *distances,
+             integer_t *parents)
+{
+    if (source < 0 || source >= graph->vertices)
+        return false;
+
+    // The heap only compares the distances, it never copies or frees them
+    Interface_t interface;
+    interface_init(&interface, compare_int64_t, NULL, NULL, NULL, NULL, NULL);
+
+    Heap_t *heap = hep_new(&interface, MinHeap);
+    BitArray_t *settled = bit_create((unsigned_t)graph->vertices);
+    HeapHandle *handles =
+            malloc(sizeof(HeapHandle) * (size_t)graph->vertices);
+
+    bool success = heap && settled && handles;
+
+    if (success)
+    {
+        for (integer_t v = 0; v < graph->vertices; v++)
+        {
+            distances[v] = INT64_MAX;
+
+            if (parents)
+                parents[v] = -1;
+        }
+
+        distances[source] = 0;
+
+        success = hep_insert_handle(heap, &distances[source],
+                                    &handles[source]);
+    }
+
+    void *result;
+
+    while (success && hep_remove(heap, &result))
+    {
+        integer_t v = (integer_t)((int64_t *)result - distances);
+
+        bit_set(settled, (unsigned_t)v);
+
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            integer_t w = graph->targets[e];
+            int64_t weight = graph->weights ? graph->weights[e] : 1;
+
+            if (bit_get(settled, (unsigned_t)w) ||
+                weight >= distances[w] - distances[v])
+                continue;
+
+            bool waiting = distances[w] != INT64_MAX;
+
+            distances[w] = distances[v] + weight;
+
+            if (parents)
+                parents[w] = v;
+
+            if (waiting)
+                hep_update(heap, handles[w]);
+            else
+                success = hep_insert_handle(heap, &distances[w], &handles[w]);
+        }
+    }
+
+    if (heap)
+        hep_free_shallow(heap);
+
+    if (settled)
+        bit_free(settled);
+
+    free(handles);
+
+    return success;
+}
+
+/// Labels every vertex with the connected component it belongs to. Edges
+/// are followed in both directions, so the components of a directed graph
+/// are its weakly connected components. Components are found by merging the
+/// two ends of every edge in a disjoint-set forest and numbered from 0 in
+/// the order of their lowest vertex.
+///
+/// \param[in] graph The graph.
+/// \param[out] labels The component of each vertex. Must have room for
+/// every vertex.
+///
+/// \return The amount of components or -1 if allocation failed.
+integer_t
+gph_components(Graph_t *graph, integer_t *labels)
+{
+    integer_t *roots = malloc(sizeof(integer_t) * (size_t)graph->vertices);
+
+    if (!roots)
+        return -1;
+
+    for (integer_t v = 0; v < graph->vertices; v++)
+        roots[v] = v;
+
+    for (integer_t v = 0; v < graph->vertices; v++)
+    {
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            integer_t a = gph_find(roots, v);
+            integer_t b = gph_find(roots, graph->targets[e]);
+
+            // The lower vertex becomes the root, which keeps the labels in
+            // order below
+            if (a < b)
+                roots[b] = a;
+            else if (b < a)
+                roots[a] = b;
+        }
+    }
+
+    integer_t count = 0;
+
+    // The root of a component is its lowest vertex, so it is labeled before
+    // any other vertex of the component
+    for (integer_t v = 0; v < graph->vertices; v++)
+    {
+        integer_t root = gph_find(roots, v);
+
+        labels[v] = root == v ? count++ : labels[root];
+    }
+
+    free(roots);
+
+    return count;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+gph_bfs_task(void *argument)
+{
+    GraphTask_t *task = argument;
+
+    Graph_t *graph = task->graph;
+
+    unsigned_t v = bit_next_set(task->current, (unsigned_t)task->from);
+
+    while (v != (unsigned_t)-1 && v < (unsigned_t)task->to)
+    {
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            unsigned_t w = (unsigned_t)graph->targets[e];
+            unsigned_t bit = (unsigned_t)1 << (w % GPH_WORD_BITS);
+
+            _Atomic(unsigned_t) *word = &task->visited[w / GPH_WORD_BITS];
+
+            // Most vertices were already visited, which is checked without
+            // writing to the word
+            if (atomic_load_explicit(word, memory_order_relaxed) & bit)
+                continue;
+
+            if (atomic_fetch_or_explicit(word, bit, memory_order_relaxed)
+                & bit)
+                continue;
+
+            bit_set(task->next, w);
+
+            task->distances[w] = task->level;
+
+            if (task->parents)
+                task->parents[w] = (integer_t)v;
+
+            task->found = true;
+        }
+
+        v = bit_next_set(task->current, v + 1);
+    }
+}
+
+// Finds the root of a vertex, pointing every other vertex on the way to its
+// grandparent (path halving)
+static integer_t
+gph_find(integer_t *roots, integer_t vertex)
+{
+    while (roots[vertex] != vertex)
+    {
+        roots[vertex] = roots[roots[vertex]];
+        vertex = roots[vertex];
+    }
+
+    return vertex;
+}
@@ -0,0 +1,1459 @@
+/**
+ * @file HashMap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "HashMap.h"
+#include "Snapshot.h"
+
+/// A HashMap_s is an associative container that maps unique keys to values.
+/// It uses open addressing with robin hood hashing: all entries live in a
+/// single flat buffer of buckets and collisions are resolved with linear
+/// probing. On insertion an entry that is farther away from its home bucket
+/// steals the place of an entry that is closer to its own home bucket, which
+/// keeps the variance of the probe sequence lengths low and allows a search
+/// to stop as soon as it finds an entry that is closer to its home than the
+/// searched key would be.
+///
+/// Removals use backward shift deletion, so no tombstones are ever left in
+/// the buffer.
+///
+/// The amount of buckets is always one of the primes in \c ds_hash_primes
+/// and the map grows to the next prime when the load factor reaches
+/// \c max_load percent.
+///
+/// With multiple keys enabled a key maps to a group of values instead of a
+/// single one. The group is a small array kept in the value of the bucket, so
+/// all values of a key are found with a single probe sequence.
+///
+/// \par Functions
+/// Located in the file HashMap.c
+struct HashMap_s
+{
+    /// \brief Buckets buffer.
+    ///
+    /// Flat buffer where all key-value pairs are stored in.
+    struct HashMapEntry_s *buffer;
+
+    /// \brief Current amount of key-value pairs.
+    ///
+    /// Current amount of key-value pairs in the hash map.
+    integer_t count;
+
+    /// \brief Amount of buckets.
+    ///
+    /// Total amount of buckets in the buffer. Always a value of
+    /// \c ds_hash_primes.
+    integer_t capacity;
+
+    /// \brief Index of \c capacity in \c ds_hash_primes.
+    ///
+    /// Index of the current capacity in \c ds_hash_primes. When the map grows
+    /// the next prime is used.
+    unsigned prime_index;
+
+    /// \brief Maximum load factor.
+    ///
+    /// Maximum load factor in percent. When <code> count * 100 </code>
+    /// reaches <code> capacity * max_load </code> the buffer is rehashed into
+    /// a bigger one.
+    integer_t max_load;
+
+    /// \brief HashMap_s key interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. This interface is responsible
+    /// for handling all necessary operations on the keys of this hash map.
+    struct Interface_s *K_interface;
+
+    /// \brief HashMap_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. This interface is responsible
+    /// for handling all necessary operations on the values of this hash map.
+    struct Interface_s *V_interface;
+
+    /// \brief If a key can be mapped to more than one value.
+    ///
+    /// When true the value of every bucket is a HashMapGroup_s. See
+    /// hmp_set_multiple_keys().
+    bool multiple;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified. The iterator can only function if its version_id is the same
+    /// as the structure's version id, that is, there have been no structural
+    /// modifications (except for those done by the iterator itself).
+    integer_t version_id;
+};
+
+/// \brief A HashMap_s bucket.
+///
+/// Implementation detail. Each bucket stores a key, its value, the key's
+/// full hash and how far the entry is from its home bucket.
+struct HashMapEntry_s
+{
+    /// \brief This entry's key.
+    ///
+    /// Represents the key in this associative container.
+    void *key;
+
+    /// \brief This entry's value.
+    ///
+    /// Represents the value in this associative container.
+    void *value;
+
+    /// \brief The key's hash.
+    ///
+    /// Cached result of the key interface's hash function. Used to skip most
+    /// calls to the compare function and to rehash without calling the hash
+    /// function again.
+    unsigned_t hash;
+
+    /// \brief Probe sequence length.
+    ///
+    /// How many buckets away from its home bucket this entry is or -1 if the
+    /// bucket is empty.
+    integer_t psl;
+};
+
+/// \brief A type for a hash map bucket.
+///
+/// Defines a type to a <code> struct HashMapEntry_s </code>.
+typedef struct HashMapEntry_s HashMapEntry_t;
+
+/// \brief A pointer type for a hash map bucket.
+///
+/// Defines a pointer type to a <code> struct HashMapEntry_s </code>.
+typedef struct HashMapEntry_s *HashMapEntry;
+
+/// \brief Values of a key in a hash map with multiple keys.
+///
+/// Implementation detail. Stored in the value of a bucket, so that every
+/// value of a key can be given as a single span.
+struct HashMapGroup_s
+{
+    /// \brief Amount of values.
+    integer_t count;
+
+    /// \brief Amount of values the group can hold before growing.
+    integer_t capacity;
+
+    /// \brief The values in the order they were inserted.
+    void *values[];
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static HashMapEntry_t *
+hmp_new_buffer(integer_t capacity);
+
+static integer_t
+hmp_find(HashMap_t *map, void *key, unsigned_t hash);
+
+static void
+hmp_place(HashMapEntry_t *buffer, integer_t capacity, HashMapEntry_t entry);
+
+static void
+hmp_remove_at(HashMap_t *map, integer_t position);
+
+static bool
+hmp_rehash(HashMap_t *map, unsigned prime_index);
+
+static bool
+hmp_overloaded(HashMap_t *map, integer_t count);
+
+static bool
+hmp_group_add(void **group, void *value);
+
+static void
+hmp_release_values(HashMap_t *map, void *value, bool deep);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new HashMap_s with the smallest prime in \c ds_hash_primes
+/// as its capacity and a maximum load factor of 85 percent.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+///
+/// \return A new HashMap_s or NULL if allocation failed.
+HashMap_t *
+hmp_new(Interface_t *key_interface, Interface_t *value_interface)
+{
+    return hmp_create(key_interface, value_interface, ds_hash_primes[0], 85);
+}
+
+/// Initializes a new HashMap_s with a capacity of at least \c min_capacity,
+/// rounded up to the next prime in \c ds_hash_primes, and a custom maximum
+/// load factor.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] min_capacity Minimum amount of buckets.
+/// \param[in] max_load Maximum load factor in percent, between 10 and 95.
+///
+/// \return A new HashMap_s or NULL if allocation failed, if
+/// \c min_capacity is greater than the biggest prime available or if
+/// \c max_load is out of range.
+HashMap_t *
+hmp_create(Interface_t *key_interface, Interface_t *value_interface,
+           integer_t min_capacity, integer_t max_load)
+{
+    if (max_load < 10 || max_load > 95)
+        return NULL;
+
+    unsigned prime_index = 0;
+
+    while (prime_index < ds_hash_primes_size &&
+           ds_hash_primes[prime_index] < min_capacity)
+        prime_index++;
+
+    if (prime_index == ds_hash_primes_size)
+        return NULL;
+
+    HashMap_t *map = malloc(sizeof(HashMap_t));
+
+    if (!map)
+        return NULL;
+
+    map->buffer = hmp_new_buffer(ds_hash_primes[prime_index]);
+
+    if (!map->buffer)
+    {
+        free(map);
+        return NULL;
+    }
+
+    map->count = 0;
+    map->capacity = ds_hash_primes[prime_index];
+    map->prime_index = prime_index;
+    map->max_load = max_load;
+    map->multiple = false;
+    map->version_id = 0;
+
+    map->K_interface = key_interface;
+    map->V_interface = value_interface;
+
+    return map;
+}
+
+/// Frees from memory a HashMap_s and all of its keys and values using the
+/// free functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] map The hash map to be freed from memory.
+void
+hmp_free(HashMap_t *map)
+{
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl >= 0)
+        {
+            interface_release(map->K_interface, map->buffer[i].key);
+            hmp_release_values(map, map->buffer[i].value, true);
+        }
+    }
+
+    free(map->buffer);
+    free(map);
+}
+
+/// Frees from memory a HashMap_s leaving its keys and values intact.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map The hash map to be freed from memory.
+void
+hmp_free_shallow(HashMap_t *map)
+{
+    for (integer_t i = 0; i < map->capacity && map->multiple; i++)
+    {
+        if (map->buffer[i].psl >= 0)
+            hmp_release_values(map, map->buffer[i].value, false);
+    }
+
+    free(map->buffer);
+    free(map);
+}
+
+/// Frees from memory all keys and values of a HashMap_s using the free
+/// functions of both interfaces. The buffer keeps its current capacity.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] map The hash map to have its key-value pairs freed.
+void
+hmp_erase(HashMap_t *map)
+{
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl >= 0)
+        {
+            interface_release(map->K_interface, map->buffer[i].key);
+            hmp_release_values(map, map->buffer[i].value, true);
+        }
+
+        map->buffer[i].key = NULL;
+        map->buffer[i].value = NULL;
+        map->buffer[i].psl = -1;
+    }
+
+    map->count = 0;
+    map->version_id++;
+}
+
+/// Removes all key-value pairs from the HashMap_s without freeing them. The
+/// buffer keeps its current capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map The hash map to be emptied.
+void
+hmp_erase_shallow(HashMap_t *map)
+{
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl >= 0)
+            hmp_release_values(map, map->buffer[i].value, false);
+
+        map->buffer[i].key = NULL;
+        map->buffer[i].value = NULL;
+        map->buffer[i].psl = -1;
+    }
+
+    map->count = 0;
+    map->version_id++;
+}
+
+/// Sets new interfaces for the hash map. Any NULL interfaces are ignored and
+/// the previous interface is kept. Note that changing the key interface's
+/// hash function of a non-empty map leaves it in an invalid state.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key_interface A new key interface.
+/// \param[in] value_interface A new value interface.
+void
+hmp_config(HashMap_t *map, Interface_t *key_interface,
+           Interface_t *value_interface)
+{
+    if (key_interface)
+        map->K_interface = key_interface;
+
+    if (value_interface)
+        map->V_interface = value_interface;
+}
+
+/// Returns the amount of key-value pairs in the hash map. With multiple keys
+/// this is the amount of distinct keys.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return The amount of key-value pairs in the hash map.
+integer_t
+hmp_count(HashMap_t *map)
+{
+    return map->count;
+}
+
+/// Returns the amount of buckets in the hash map.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return The amount of buckets in the hash map.
+integer_t
+hmp_capacity(HashMap_t *map)
+{
+    return map->capacity;
+}
+
+/// Returns the maximum load factor in percent.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return The maximum load factor in percent.
+integer_t
+hmp_max_load(HashMap_t *map)
+{
+    return map->max_load;
+}
+
+/// Returns the current load factor, that is, the amount of key-value pairs
+/// divided by the amount of buckets.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return The current load factor, between 0.0 and 1.0.
+double
+hmp_load(HashMap_t *map)
+{
+    return (double)map->count / (double)map->capacity;
+}
+
+/// Returns the value associated with a given key. With multiple keys this is
+/// the first value inserted with it.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to \c key or NULL if the key is not present.
+void *
+hmp_get(HashMap_t *map, void *key)
+{
+    integer_t position = hmp_find(map, key, map->K_interface->hash(key));
+
+    if (position < 0)
+        return NULL;
+
+    if (map->multiple)
+    {
+        struct HashMapGroup_s *group = map->buffer[position].value;
+
+        return group->values[0];
+    }
+
+    return map->buffer[position].value;
+}
+
+/// Gives every value mapped to a key as a contiguous span, in the order they
+/// were inserted. The span belongs to the map and is only valid until the map
+/// is changed. Without multiple keys the span has at most one value.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be searched.
+/// \param[out] values Where the start of the span is written to, or NULL if
+/// the key is not present.
+///
+/// \return The amount of values in the span.
+integer_t
+hmp_get_all(HashMap_t *map, void *key, void ***values)
+{
+    integer_t position = hmp_find(map, key, map->K_interface->hash(key));
+
+    if (position < 0)
+    {
+        *values = NULL;
+        return 0;
+    }
+
+    if (map->multiple)
+    {
+        struct HashMapGroup_s *group = map->buffer[position].value;
+
+        *values = group->values;
+
+        return group->count;
+    }
+
+    *values = &(map->buffer[position].value);
+
+    return 1;
+}
+
+/// Returns the amount of values mapped to a key.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The amount of values mapped to \c key.
+integer_t
+hmp_key_count(HashMap_t *map, void *key)
+{
+    void **values;
+
+    return hmp_get_all(map, key, &values);
+}
+
+/// Returns true if a key can be mapped to more than one value.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return True if the map has multiple keys.
+bool
+hmp_multiple_keys(HashMap_t *map)
+{
+    return map->multiple;
+}
+
+/// Sets a new maximum load factor. If the current load factor is already
+/// above the new maximum the map is rehashed into a buffer big enough.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] max_load The new maximum load factor in percent, between 10 and
+/// 95.
+///
+/// \return True if the new maximum load factor was set.
+/// \return False if it is out of range or if the rehash failed.
+bool
+hmp_set_max_load(HashMap_t *map, integer_t max_load)
+{
+    if (max_load < 10 || max_load > 95)
+        return false;
+
+    integer_t old_max_load = map->max_load;
+
+    map->max_load = max_load;
+
+    if (!hmp_reserve(map, map->count))
+    {
+        map->max_load = old_max_load;
+        return false;
+    }
+
+    return true;
+}
+
+/// Lets a key be mapped to more than one value, or makes the map refuse
+/// repeated keys again. Inserting a key that is already present then appends
+/// the value to the values of that key, and hmp_get_all() gives all of them
+/// as one contiguous span. The amount of buckets used does not change, since
+/// every key still takes a single bucket.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] multiple If a key can be mapped to more than one value.
+///
+/// \return True if the map is in the requested mode.
+/// \return False if the map is not empty.
+bool
+hmp_set_multiple_keys(HashMap_t *map, bool multiple)
+{
+    if (multiple == map->multiple)
+        return true;
+
+    if (!hmp_empty(map))
+        return false;
+
+    map->multiple = multiple;
+
+    return true;
+}
+
+/// Inserts a new key mapped to a value. The hash map does not accept
+/// duplicate keys unless it has multiple keys. Then the value is added to the
+/// values of the key already present and the given key is freed with the key
+/// interface's free function, unless it is the key already present.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted.
+/// \return False if the key is already present and the map doesn't have
+/// multiple keys, if the map could not grow or if any allocations failed.
+bool
+hmp_insert(HashMap_t *map, void *key, void *value)
+{
+    unsigned_t hash = map->K_interface->hash(key);
+
+    integer_t position = hmp_find(map, key, hash);
+
+    if (position >= 0)
+    {
+        HashMapEntry_t *found = &(map->buffer[position]);
+
+        if (!map->multiple || !hmp_group_add(&(found->value), value))
+            return false;
+
+        if (found->key != key)
+            interface_release(map->K_interface, key);
+
+        map->version_id++;
+
+        return true;
+    }
+
+    if (hmp_overloaded(map, map->count + 1))
+    {
+        if (!hmp_rehash(map, map->prime_index + 1))
+            return false;
+    }
+
+    HashMapEntry_t entry = { key, value, hash, 0 };
+
+    if (map->multiple)
+    {
+        entry.value = NULL;
+
+        if (!hmp_group_add(&(entry.value), value))
+            return false;
+    }
+
+    hmp_place(map->buffer, map->capacity, entry);
+
+    map->count++;
+    map->version_id++;
+
+    return true;
+}
+
+/// Removes a key from the hash map, frees it using the key interface's free
+/// function and retrieves its associated value.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+///
+/// With multiple keys only the last value inserted with the key is removed,
+/// and the key is only removed and freed with its last value.
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value that was mapped to \c key.
+///
+/// \return True if the key was found and removed, otherwise false.
+bool
+hmp_remove(HashMap_t *map, void *key, void **value)
+{
+    *value = NULL;
+
+    integer_t position = hmp_find(map, key, map->K_interface->hash(key));
+
+    if (position < 0)
+        return false;
+
+    if (map->multiple)
+    {
+        struct HashMapGroup_s *group = map->buffer[position].value;
+
+        *value = group->values[--group->count];
+
+        map->version_id++;
+
+        if (group->count > 0)
+            return true;
+
+        free(group);
+    }
+    else
+        *value = map->buffer[position].value;
+
+    interface_release(map->K_interface, map->buffer[position].key);
+
+    hmp_remove_at(map, position);
+
+    return true;
+}
+
+/// Removes a key from the hash map and frees both the key and its value
+/// using the free functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+/// - Value interface: free
+///
+/// With multiple keys only the last value inserted with the key is removed,
+/// like in hmp_remove().
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be removed.
+///
+/// \return True if the key was found and removed, otherwise false.
+bool
+hmp_pop(HashMap_t *map, void *key)
+{
+    void *value;
+
+    if (!hmp_remove(map, key, &value))
+        return false;
+
+    interface_release(map->V_interface, value);
+
+    return true;
+}
+
+/// Removes a key and every value mapped to it, freeing all of them using the
+/// free functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be removed.
+///
+/// \return The amount of values that were mapped to \c key.
+integer_t
+hmp_remove_all(HashMap_t *map, void *key)
+{
+    void **values;
+
+    integer_t count = hmp_get_all(map, key, &values);
+
+    if (count == 0)
+        return 0;
+
+    integer_t position = hmp_find(map, key, map->K_interface->hash(key));
+
+    interface_release(map->K_interface, map->buffer[position].key);
+    hmp_release_values(map, map->buffer[position].value, true);
+
+    hmp_remove_at(map, position);
+
+    return count;
+}
+
+/// Returns true if the hash map has no key-value pairs.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+///
+/// \return True if \c count equals 0, otherwise false.
+bool
+hmp_empty(HashMap_t *map)
+{
+    return map->count == 0;
+}
+
+/// Returns true if the hash map contains a given key.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is present, otherwise false.
+bool
+hmp_contains_key(HashMap_t *map, void *key)
+{
+    return hmp_find(map, key, map->K_interface->hash(key)) >= 0;
+}
+
+/// Returns true if the hash map contains a given value. This is a linear
+/// search on all buckets.
+///
+/// \par Interface Requirements
+/// - Value interface: compare
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] value The value to be searched.
+///
+/// \return True if the value is present, otherwise false.
+bool
+hmp_contains_value(HashMap_t *map, void *value)
+{
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl < 0)
+            continue;
+
+        void **values;
+        integer_t count = 1;
+
+        if (map->multiple)
+        {
+            struct HashMapGroup_s *group = map->buffer[i].value;
+
+            values = group->values;
+            count = group->count;
+        }
+        else
+            values = &(map->buffer[i].value);
+
+        for (integer_t j = 0; j < count; j++)
+        {
+            if (map->V_interface->compare(values[j], value) == 0)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+/// Grows the hash map so that it can hold \c count key-value pairs without
+/// exceeding its maximum load factor. Useful before inserting a big amount
+/// of pairs so that only one rehash is made.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] count Amount of key-value pairs the map must be able to hold.
+///
+/// \return True if the map can hold \c count pairs.
+/// \return False if there is no prime big enough or if allocation failed.
+bool
+hmp_reserve(HashMap_t *map, integer_t count)
+{
+    if (!hmp_overloaded(map, count))
+        return true;
+
+    unsigned prime_index = map->prime_index;
+
+    while (prime_index < ds_hash_primes_size &&
+           ds_hash_primes[prime_index] * map->max_load < count * 100)
+        prime_index++;
+
+    return hmp_rehash(map, prime_index);
+}
+
+/// Writes the hash map to a stream as a snapshot that hmp_restore() reads
+/// back. Every pair is written in bucket order along with the cached hash of
+/// its key, so that restoring the map doesn't need to hash the keys again.
+///
+/// \par Interface Requirements
+/// - Key interface: serialize
+/// - Value interface: serialize
+///
+/// \param[in] map HashMap_s reference.
+/// \param[in] stream Where the snapshot is written to.
+///
+/// \return True if the snapshot was written or false if writing failed, if
+/// any of the interfaces has no serialize function or if the map has multiple
+/// keys.
+bool
+hmp_save(HashMap_t *map, FILE *stream)
+{
+    if (!map->K_interface->serialize || !map->V_interface->serialize
+        || map->multiple)
+        return false;
+
+    SnapshotHeader_t header;
+
+    snp_header_init(&header, SnapshotHashMap, (uint64_t)map->count);
+
+    header.fields[0] = map->capacity;
+    header.fields[1] = map->max_load;
+
+    if (!snp_write_header(stream, &header))
+        return false;
+
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        HashMapEntry_t *entry = &(map->buffer[i]);
+
+        if (entry->psl < 0)
+            continue;
+
+        if (!snp_write_u64(stream, (uint64_t)entry->hash)
+            || !map->K_interface->serialize(entry->key, stream)
+            || !map->V_interface->serialize(entry->value, stream))
+            return false;
+    }
+
+    return true;
+}
+
+/// Reads a hash map written by hmp_save(). The map is created with the saved
+/// capacity, so it never rehashes while the pairs are placed back. The saved
+/// hashes are only used if the key interface's hash function still gives the
+/// same hash for the first key; a hash function with a random seed, like
+/// hash_string_keyed(), gives different hashes in every process and then
+/// every key is hashed again.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: deserialize
+/// - Key interface: free
+/// - Value interface: deserialize
+/// - Value interface: free
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] stream Where the snapshot is read from.
+///
+/// \return A new HashMap_s or NULL if the stream doesn't hold a snapshot of a
+/// hash map, if it has repeated keys, if reading or allocation failed or if
+/// any of the interfaces has no deserialize function.
+HashMap_t *
+hmp_restore(Interface_t *key_interface, Interface_t *value_interface,
+            FILE *stream)
+{
+    SnapshotHeader_t header;
+
+    if (!key_interface->deserialize || !value_interface->deserialize
+        || !snp_read_header(stream, SnapshotHashMap, &header))
+        return NULL;
+
+    integer_t count = (integer_t)header.count;
+
+    // A map always has more buckets than pairs
+    if (header.fields[0] <= count)
+        return NULL;
+
+    HashMap_t *map = hmp_create(key_interface, value_interface,
+                                (integer_t)header.fields[0],
+                                (integer_t)header.fields[1]);
+
+    if (!map)
+        return NULL;
+
+    if (!hmp_reserve(map, count))
+    {
+        hmp_free(map);
+        return NULL;
+    }
+
+    bool rehash = false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        uint64_t saved;
+        void *key = NULL, *value = NULL;
+
+        if (!snp_read_u64(stream, &saved)
+            || !(key = key_interface->deserialize(stream))
+            || !(value = value_interface->deserialize(stream)))
+        {
+            if (key)
+                interface_release(key_interface, key);
+
+            hmp_free(map);
+            return NULL;
+        }
+
+        unsigned_t hash = (unsigned_t)saved;
+
+        if (i == 0)
+            rehash = key_interface->hash(key) != hash;
+
+        if (rehash)
+            hash = key_interface->hash(key);
+
+        if (hmp_find(map, key, hash) >= 0)
+        {
+            interface_release(key_interface, key);
+            interface_release(value_interface, value);
+            hmp_free(map);
+            return NULL;
+        }
+
+        HashMapEntry_t entry = { key, value, hash, 0 };
+
+        hmp_place(map->buffer, map->capacity, entry);
+
+        map->count++;
+    }
+
+    return map;
+}
+
+/// Displays a HashMap_s in the console, one key-value pair per line.
+///
+/// \par Interface Requirements
+/// - Key interface: display
+/// - Value interface: display
+///
+/// \param[in] map HashMap_s reference.
+void
+hmp_display(HashMap_t *map)
+{
+    if (hmp_empty(map))
+    {
+        printf("\nHashMap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nHashMap\n");
+
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl < 0)
+            continue;
+
+        map->K_interface->display(map->buffer[i].key);
+
+        printf(" : ");
+
+        if (map->multiple)
+        {
+            struct HashMapGroup_s *group = map->buffer[i].value;
+
+            for (integer_t j = 0; j < group->count; j++)
+            {
+                if (j > 0)
+                    printf(", ");
+
+                map->V_interface->display(group->values[j]);
+            }
+        }
+        else
+            map->V_interface->display(map->buffer[i].value);
+
+        printf("\n");
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static HashMapEntry_t *
+hmp_new_buffer(integer_t capacity)
+{
+    HashMapEntry_t *buffer = malloc(sizeof(HashMapEntry_t) * (size_t)capacity);
+
+    if (!buffer)
+        return NULL;
+
+    for (integer_t i = 0; i < capacity; i++)
+    {
+        buffer[i].key = NULL;
+        buffer[i].value = NULL;
+        buffer[i].hash = 0;
+        buffer[i].psl = -1;
+    }
+
+    return buffer;
+}
+
+// Returns the bucket index of key or -1 if it is not present
+static integer_t
+hmp_find(HashMap_t *map, void *key, unsigned_t hash)
+{
+    integer_t position = (integer_t)(hash % (unsigned_t)map->capacity);
+
+    for (integer_t psl = 0; ; psl++)
+    {
+        HashMapEntry_t *entry = &(map->buffer[position]);
+
+        // An empty bucket or an entry closer to its home than the key would
+        // be means that the key is not in the map
+        if (entry->psl < psl)
+            return -1;
+
+        if (entry->hash == hash &&
+            map->K_interface->compare(entry->key, key) == 0)
+            return position;
+
+        if (++position == map->capacity)
+            position = 0;
+    }
+}
+
+// Places a new entry in a buffer that has at least one empty bucket
+static void
+hmp_place(HashMapEntry_t *buffer, integer_t capacity, HashMapEntry_t entry)
+{
+    integer_t position = (integer_t)(entry.hash % (unsigned_t)capacity);
+
+    entry.psl = 0;
+
+    while (buffer[position].psl >= 0)
+    {
+        // Robin hood: take from the rich (close to home) and give to the poor
+        if (buffer[position].psl < entry.psl)
+        {
+            HashMapEntry_t temp = buffer[position];
+            buffer[position] = entry;
+            entry = temp;
+        }
+
+        entry.psl++;
+
+        if (++position == capacity)
+            position = 0;
+    }
+
+    buffer[position] = entry;
+}
+
+// Empties a bucket and shifts back all the entries that come after it, until
+// an empty bucket or an entry at its home bucket is found
+static void
+hmp_remove_at(HashMap_t *map, integer_t position)
+{
+    integer_t next = position + 1 == map->capacity ? 0 : position + 1;
+
+    while (map->buffer[next].psl > 0)
+    {
+        map->buffer[position] = map->buffer[next];
+        map->buffer[position].psl--;
+
+        position = next;
+
+        if (++next == map->capacity)
+            next = 0;
+    }
+
+    map->buffer[position].key = NULL;
+    map->buffer[position].value = NULL;
+    map->buffer[position].psl = -1;
+
+    map->count--;
+    map->version_id++;
+}
+
+// Moves every entry to a new buffer with the capacity of
+// ds_hash_primes[prime_index]
+static bool
+hmp_rehash(HashMap_t *map, unsigned prime_index)
+{
+    if (prime_index >= ds_hash_primes_size)
+        return false;
+
+    integer_t new_capacity = ds_hash_primes[prime_index];
+
+    HashMapEntry_t *new_buffer = hmp_new_buffer(new_capacity);
+
+    if (!new_buffer)
+        return false;
+
+    for (integer_t i = 0; i < map->capacity; i++)
+    {
+        if (map->buffer[i].psl >= 0)
+            hmp_place(new_buffer, new_capacity, map->buffer[i]);
+    }
+
+    free(map->buffer);
+
+    map->buffer = new_buffer;
+    map->capacity = new_capacity;
+    map->prime_index = prime_index;
+    map->version_id++;
+
+    return true;
+}
+
+// Returns true if the map can't hold count pairs within its max_load
+static bool
+hmp_overloaded(HashMap_t *map, integer_t count)
+{
+    return count * 100 > map->capacity * map->max_load;
+}
+
+// Appends a value to the group kept in a bucket, creating it if the bucket
+// has none yet
+static bool
+hmp_group_add(void **group, void *value)
+{
+    struct HashMapGroup_s *values = *group;
+
+    if (!values || values->count == values->capacity)
+    {
+        integer_t capacity = values ? values->capacity * 2 : 2;
+
+        values = realloc(values, sizeof(struct HashMapGroup_s)
+                                 + sizeof(void*) * (size_t)capacity);
+
+        if (!values)
+            return false;
+
+        if (!*group)
+            values->count = 0;
+
+        values->capacity = capacity;
+        *group = values;
+    }
+
+    values->values[values->count++] = value;
+
+    return true;
+}
+
+// Frees the value of a bucket and, with multiple keys, its group. Without
+// deep only the group is freed
+static void
+hmp_release_values(HashMap_t *map, void *value, bool deep)
+{
+    if (!map->multiple)
+    {
+        if (deep)
+            interface_release(map->V_interface, value);
+
+        return;
+    }
+
+    struct HashMapGroup_s *group = value;
+
+    for (integer_t i = 0; i < group->count && deep; i++)
+        interface_release(map->V_interface, group->values[i]);
+
+    free(group);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \brief A HashMap_s iterator.
+///
+/// A forward iterator that visits every key-value pair of the hash map in
+/// bucket order. The iteration order is unspecified and changes whenever the
+/// map is rehashed.
+struct HashMapIterator_s
+{
+    /// \brief Target HashMap_s.
+    ///
+    /// Target HashMap_s. The iterator might need to use some information
+    /// provided by the map or change some of its data members.
+    struct HashMap_s *target;
+
+    /// \brief Current bucket.
+    ///
+    /// Index of the current bucket pointed by the cursor or the map's
+    /// capacity if there are no key-value pairs.
+    integer_t cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure.
+    integer_t target_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+hmp_iter_target_modified(HashMapIterator_t *iter);
+
+static integer_t
+hmp_iter_seek(HashMapIterator_t *iter, integer_t from);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new iterator pointing to the first key-value pair of the target
+/// hash map.
+///
+/// \param[in] target Target hash map.
+///
+/// \return A new HashMapIterator_s or NULL if allocation failed.
+HashMapIterator_t *
+hmp_iter_new(HashMap_t *target)
+{
+    HashMapIterator_t *iter = malloc(sizeof(HashMapIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = hmp_iter_seek(iter, 0);
+
+    return iter;
+}
+
+/// Retargets an existing iterator to a new hash map, pointing to its first
+/// key-value pair.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new target hash map.
+void
+hmp_iter_retarget(HashMapIterator_t *iter, HashMap_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = hmp_iter_seek(iter, 0);
+}
+
+/// Frees from memory an existing iterator.
+///
+/// \param[in] iter The iterator to be freed from memory.
+void
+hmp_iter_free(HashMapIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Iterates to the next key-value pair.
+///
+/// \param[in] iter HashMapIterator_s reference.
+///
+/// \return True if the iterator moved to the next pair.
+/// \return False if the target was modified or if there are no more pairs.
+bool
+hmp_iter_next(HashMapIterator_t *iter)
+{
+    if (hmp_iter_target_modified(iter))
+        return false;
+
+    if (!hmp_iter_has_next(iter))
+        return false;
+
+    iter->cursor = hmp_iter_seek(iter, iter->cursor + 1);
+
+    return true;
+}
+
+/// Iterates back to the first key-value pair.
+///
+/// \param[in] iter HashMapIterator_s reference.
+///
+/// \return True if the operation was successful or false if the target was
+/// modified.
+bool
+hmp_iter_to_start(HashMapIterator_t *iter)
+{
+    if (hmp_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = hmp_iter_seek(iter, 0);
+
+    return true;
+}
+
+/// Returns true if there is another key-value pair after the current one.
+///
+/// \param[in] iter HashMapIterator_s reference.
+///
+/// \return True if there is a next pair, otherwise false.
+bool
+hmp_iter_has_next(HashMapIterator_t *iter)
+{
+    if (iter->cursor >= iter->target->capacity)
+        return false;
+
+    return hmp_iter_seek(iter, iter->cursor + 1) < iter->target->capacity;
+}
+
+/// Gets the key of the current key-value pair.
+///
+/// \param[in] iter HashMapIterator_s reference.
+/// \param[out] key The current key.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if it is empty.
+bool
+hmp_iter_get_key(HashMapIterator_t *iter, void **key)
+{
+    if (hmp_iter_target_modified(iter))
+        return false;
+
+    if (iter->cursor >= iter->target->capacity)
+        return false;
+
+    *key = iter->target->buffer[iter->cursor].key;
+
+    return true;
+}
+
+/// Gets the value of the current key-value pair.
+///
+/// \param[in] iter HashMapIterator_s reference.
+/// \param[out] value The current value.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if it is empty.
+bool
+hmp_iter_get_value(HashMapIterator_t *iter, void **value)
+{
+    if (hmp_iter_target_modified(iter))
+        return false;
+
+    if (iter->cursor >= iter->target->capacity)
+        return false;
+
+    *value = iter->target->buffer[iter->cursor].value;
+
+    if (iter->target->multiple)
+        *value = ((struct HashMapGroup_s *)*value)->values[0];
+
+    return true;
+}
+
+/// Sets the value of the current key-value pair. The previous value is not
+/// freed and the user is responsible for it. Keys can't be changed since that
+/// would invalidate their position in the buffer.
+///
+/// \param[in] iter HashMapIterator_s reference.
+/// \param[in] value The new value.
+///
+/// \return True if the operation was successful.
+/// \return False if the target was modified or if it is empty.
+bool
+hmp_iter_set_value(HashMapIterator_t *iter, void *value)
+{
+    if (hmp_iter_target_modified(iter))
+        return false;
+
+    if (iter->cursor >= iter->target->capacity)
+        return false;
+
+    if (iter->target->multiple)
+    {
+        struct HashMapGroup_s *group = iter->target->buffer[iter->cursor].value;
+
+        group->values[0] = value;
+    }
+    else
+        iter->target->buffer[iter->cursor].value = value;
+
+    return true;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+hmp_iter_target_modified(HashMapIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+// Returns the first occupied bucket starting from a given position or the
+// capacity if there are none
+static integer_t
+hmp_iter_seek(HashMapIterator_t *iter, integer_t from)
+{
+    while (from < iter->target->capacity && iter->target->buffer[from].psl < 0)
+        from++;
+
+    return from;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,884 @@
+/**
+ * @file HashTable.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "HashTable.h"
+
+/// A HashTable_s is an associative container that maps unique keys to values.
+/// Each bucket is the head of a singly-linked chain of nodes whose keys hash
+/// to that bucket.
+///
+/// \par Incremental rehashing
+/// When the load factor crosses \c max_load a new buffer with the next prime
+/// of \c ds_hash_primes is allocated but no node is moved yet. Instead, every
+/// following insertion, removal and search moves \c rehash_step buckets from
+/// the old buffer to the new one. While rehashing, searches look at both
+/// buffers and new keys are always inserted in the new buffer. This spreads
+/// the cost of a rehash over many operations so that no single operation has
+/// to move all nodes at once. The user can also drive the rehash with
+/// htb_rehash_step(), for example, when the table is idle.
+///
+/// \par Functions
+/// Located in the file HashTable.c
+struct HashTable_s
+{
+    /// \brief Buckets buffer.
+    ///
+    /// Buffer of chains where new keys are inserted. While rehashing this is
+    /// the bigger buffer that is being filled.
+    struct HashTableNode_s **buffer;
+
+    /// \brief Amount of buckets in \c buffer.
+    ///
+    /// Amount of buckets in \c buffer. Always a value of \c ds_hash_primes.
+    integer_t capacity;
+
+    /// \brief Index of \c capacity in \c ds_hash_primes.
+    ///
+    /// Index of the current capacity in \c ds_hash_primes. When the table
+    /// grows the next prime is used.
+    unsigned prime_index;
+
+    /// \brief Buffer being drained.
+    ///
+    /// The buffer that is being moved to \c buffer or NULL if the table is not
+    /// rehashing.
+    struct HashTableNode_s **old_buffer;
+
+    /// \brief Amount of buckets in \c old_buffer.
+    ///
+    /// Amount of buckets in \c old_buffer or 0 if the table is not rehashing.
+    integer_t old_capacity;
+
+    /// \brief Next bucket of \c old_buffer to be moved.
+    ///
+    /// All buckets of \c old_buffer before this index are already empty.
+    integer_t rehash_index;
+
+    /// \brief Amount of buckets moved per operation.
+    ///
+    /// How many non-empty buckets are moved from \c old_buffer to \c buffer
+    /// on each insertion, removal or search while rehashing.
+    integer_t rehash_step;
+
+    /// \brief Current amount of key-value pairs.
+    ///
+    /// Current amount of key-value pairs in both buffers.
+    integer_t count;
+
+    /// \brief Maximum load factor.
+    ///
+    /// Maximum load factor in percent. When <code> count * 100 </code>
+    /// reaches <code> capacity * max_load </code> a rehash is started.
+    integer_t max_load;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
+    /// \brief HashTable_s key interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. This interface is responsible
+    /// for handling all necessary operations on the keys of this hash table.
+    struct Interface_s *K_interface;
+
+    /// \brief HashTable_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. This interface is responsible
+    /// for handling all necessary operations on the values of this hash
+    /// table.
+    struct Interface_s *V_interface;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified. The iterator can only function if its version_id is the same
+    /// as the structure's version id, that is, there have been no structural
+    /// modifications (except for those done by the iterator itself).
+    integer_t version_id;
+};
+
+/// \brief A HashTable_s node.
+///
+/// Implementation detail. A singly-linked node with a key, its value and the
+/// key's hash so that moving nodes to a new buffer doesn't need to call the
+/// hash function again.
+struct HashTableNode_s
+{
+    /// \brief This node's key.
+    ///
+    /// Represents the key in this associative container.
+    void *key;
+
+    /// \brief This node's value.
+    ///
+    /// Represents the value in this associative container.
+    void *value;
+
+    /// \brief The key's hash.
+    ///
+    /// Cached result of the key interface's hash function.
+    unsigned_t hash;
+
+    /// \brief Next node on the chain.
+    ///
+    /// Next node on the chain or NULL if this is the last node.
+    struct HashTableNode_s *next;
+};
+
+/// \brief A type for a hash table node.
+///
+/// Defines a type to a <code> struct HashTableNode_s </code>.
+typedef struct HashTableNode_s HashTableNode_t;
+
+/// \brief A pointer type for a hash table node.
+///
+/// Defines a pointer type to a <code> struct HashTableNode_s </code>.
+typedef struct HashTableNode_s *HashTableNode;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static HashTableNode_t *
+htb_new_node(NodePool_t *pool, void *key, void *value, unsigned_t hash);
+
+static void
+htb_free_buffer(NodePool_t *pool, HashTableNode_t **buffer,
+                integer_t capacity, free_f key_free, free_f value_free);
+
+static void
+htb_free_buffer_shallow(NodePool_t *pool, HashTableNode_t **buffer,
+                        integer_t capacity);
+
+static HashTableNode_t **
+htb_find(HashTable_t *table, void *key, unsigned_t hash);
+
+static bool
+htb_start_rehash(HashTable_t *table);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new HashTable_s with the smallest prime in \c ds_hash_primes
+/// as its capacity, a maximum load factor of 100 percent and a rehash step of
+/// 4 buckets.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+///
+/// \return A new HashTable_s or NULL if allocation failed.
+HashTable_t *
+htb_new(Interface_t *key_interface, Interface_t *value_interface)
+{
+    return htb_create(key_interface, value_interface, ds_hash_primes[0], 100,
+                      4);
+}
+
+/// Initializes a new HashTable_s with a capacity of at least
+/// \c min_capacity, rounded up to the next prime in \c ds_hash_primes, a
+/// custom maximum load factor and a custom rehash step.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] min_capacity Minimum amount of buckets.
+/// \param[in] max_load Maximum load factor in percent, between 10 and 1000.
+/// \param[in] rehash_step Amount of buckets moved per operation while
+/// rehashing. Must be greater than 0.
+///
+/// \return A new HashTable_s or NULL if allocation failed or if any of the
+/// parameters is out of range.
+HashTable_t *
+htb_create(Interface_t *key_interface, Interface_t *value_interface,
+           integer_t min_capacity, integer_t max_load, integer_t rehash_step)
+{
+    if (max_load < 10 || max_load > 1000 || rehash_step < 1)
+        return NULL;
+
+    unsigned prime_index = 0;
+
+    while (prime_index < ds_hash_primes_size &&
+           ds_hash_primes[prime_index] < min_capacity)
+        prime_index++;
+
+    if (prime_index == ds_hash_primes_size)
+        return NULL;
+
+    HashTable_t *table = malloc(sizeof(HashTable_t));
+
+    if (!table)
+        return NULL;
+
+    table->buffer = calloc((size_t)ds_hash_primes[prime_index],
+                           sizeof(HashTableNode_t *));
+
+    if (!table->buffer)
+    {
+        free(table);
+        return NULL;
+    }
+
+    table->capacity = ds_hash_primes[prime_index];
+    table->prime_index = prime_index;
+
+    table->old_buffer = NULL;
+    table->old_capacity = 0;
+    table->rehash_index = 0;
+    table->rehash_step = rehash_step;
+
+    table->count = 0;
+    table->max_load = max_load;
+    table->version_id = 0;
+
+    table->pool = NULL;
+    table->K_interface = key_interface;
+    table->V_interface = value_interface;
+
+    return table;
+}
+
+/// Frees from memory a HashTable_s and all of its keys and values using the
+/// free functions of both interfaces.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] table The hash table to be freed from memory.
+void
+htb_free(HashTable_t *table)
+{
+    htb_free_buffer(table->pool, table->buffer, table->capacity,
+                    table->K_interface->free, table->V_interface->free);
+
+    if (table->old_buffer)
+        htb_free_buffer(table->pool, table->old_buffer, table->old_capacity,
+                        table->K_interface->free, table->V_interface->free);
+
+    free(table->buffer);
+    free(table->old_buffer);
+    free(table);
+}
+
+/// Frees from memory a HashTable_s and all of its nodes, leaving its keys and
+/// values intact.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table The hash table to be freed from memory.
+void
+htb_free_shallow(HashTable_t *table)
+{
+    htb_free_buffer_shallow(table->pool, table->buffer, table->capacity);
+
+    if (table->old_buffer)
+        htb_free_buffer_shallow(table->pool, table->old_buffer,
+                                table->old_capacity);
+
+    free(table->buffer);
+    free(table->old_buffer);
+    free(table);
+}
+
+/// Frees from memory all keys and values of a HashTable_s using the free
+/// functions of both interfaces. Any rehash in progress is finished and the
+/// table keeps its current capacity.
+///
+/// \par Interface Requirements
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] table The hash table to have its key-value pairs freed.
+void
+htb_erase(HashTable_t *table)
+{
+    htb_free_buffer(table->pool, table->buffer, table->capacity,
+                    table->K_interface->free, table->V_interface->free);
+
+    if (table->old_buffer)
+    {
+        htb_free_buffer(table->pool, table->old_buffer, table->old_capacity,
+                        table->K_interface->free, table->V_interface->free);
+
+        free(table->old_buffer);
+
+        table->old_buffer = NULL;
+        table->old_capacity = 0;
+        table->rehash_index = 0;
+    }
+
+    table->count = 0;
+    table->version_id++;
+}
+
+/// Frees from memory all nodes of a HashTable_s, leaving its keys and values
+/// intact. Any rehash in progress is finished and the table keeps its current
+/// capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table The hash table to have its nodes freed.
+void
+htb_erase_shallow(HashTable_t *table)
+{
+    htb_free_buffer_shallow(table->pool, table->buffer, table->capacity);
+
+    if (table->old_buffer)
+    {
+        htb_free_buffer_shallow(table->pool, table->old_buffer,
+                                table->old_capacity);
+
+        free(table->old_buffer);
+
+        table->old_buffer = NULL;
+        table->old_capacity = 0;
+        table->rehash_index = 0;
+    }
+
+    table->count = 0;
+    table->version_id++;
+}
+
+/// Sets new interfaces for the hash table. Any NULL interfaces are ignored
+/// and the previous interface is kept. Note that changing the key interface's
+/// hash function of a non-empty table leaves it in an invalid state.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key_interface A new key interface.
+/// \param[in] value_interface A new value interface.
+void
+htb_config(HashTable_t *table, Interface_t *key_interface,
+           Interface_t *value_interface)
+{
+    if (key_interface)
+        table->K_interface = key_interface;
+
+    if (value_interface)
+        table->V_interface = value_interface;
+}
+
+/// Returns the amount of key-value pairs in the hash table.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+///
+/// \return The amount of key-value pairs in the hash table.
+integer_t
+htb_count(HashTable_t *table)
+{
+    return table->count;
+}
+
+/// Returns the amount of buckets of the hash table. While rehashing this is
+/// the capacity of the new buffer.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+///
+/// \return The amount of buckets in the hash table.
+integer_t
+htb_capacity(HashTable_t *table)
+{
+    return table->capacity;
+}
+
+/// Returns the maximum load factor in percent.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+///
+/// \return The maximum load factor in percent.
+integer_t
+htb_max_load(HashTable_t *table)
+{
+    return table->max_load;
+}
+
+/// Returns the value associated with a given key. If the table is rehashing,
+/// a rehash step is executed first.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to \c key or NULL if the key is not present.
+void *
+htb_get(HashTable_t *table, void *key)
+{
+    htb_rehash_step(table, table->rehash_step);
+
+    HashTableNode_t **link = htb_find(table, key, table->K_interface->hash(key));
+
+    if (link == NULL)
+        return NULL;
+
+    return (*link)->value;
+}
+
+/// Sets a node pool from where all nodes of the hash table are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the hash table is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the hash table is not empty or if the pool's nodes are
+/// too small.
+bool
+htb_set_pool(HashTable_t *table, NodePool_t *pool)
+{
+    if (!htb_empty(table))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(HashTableNode_t)))
+        return false;
+
+    table->pool = pool;
+
+    return true;
+}
+
+/// Inserts a new key mapped to a value. The hash table does not accept
+/// duplicate keys. If the table is rehashing, a rehash step is executed
+/// first. If the insertion makes the load factor cross \c max_load a new
+/// rehash is started.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value associated with \c key.
+///
+/// \return True if the key-value pair was inserted.
+/// \return False if the key is already present or if allocation failed.
+bool
+htb_insert(HashTable_t *table, void *key, void *value)
+{
+    htb_rehash_step(table, table->rehash_step);
+
+    unsigned_t hash = table->K_interface->hash(key);
+
+    if (htb_find(table, key, hash) != NULL)
+        return false;
+
+    HashTableNode_t *node = htb_new_node(table->pool, key, value, hash);
+
+    if (!node)
+        return false;
+
+    // A chained table can go over its load factor so a failed rehash is not
+    // an error, it is tried again on the next insertion
+    if ((table->count + 1) * 100 > table->capacity * table->max_load)
+        htb_start_rehash(table);
+
+    integer_t position = (integer_t)(hash % (unsigned_t)table->capacity);
+
+    node->next = table->buffer[position];
+    table->buffer[position] = node;
+
+    table->count++;
+    table->version_id++;
+
+    return true;
+}
+
+/// Removes a key from the hash table, frees it using the key interface's
+/// free function and retrieves its associated value. If the table is
+/// rehashing, a rehash step is executed first.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value that was mapped to \c key.
+///
+/// \return True if the key was found and removed, otherwise false.
+bool
+htb_remove(HashTable_t *table, void *key, void **value)
+{
+    *value = NULL;
+
+    htb_rehash_step(table, table->rehash_step);
+
+    HashTableNode_t **link = htb_find(table, key, table->K_interface->hash(key));
+
+    if (link == NULL)
+        return false;
+
+    HashTableNode_t *node = *link;
+
+    *link = node->next;
+    *value = node->value;
+
+    table->K_interface->free(node->key);
+    npl_node_free(table->pool, node);
+
+    table->count--;
+    table->version_id++;
+
+    return true;
+}
+
+/// Removes a key from the hash table and frees both the key and its value
+/// using the free functions of both interfaces. If the table is rehashing, a
+/// rehash step is executed first.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+/// - Key interface: free
+/// - Value interface: free
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key The key to be removed.
+///
+/// \return True if the key was found and removed, otherwise false.
+bool
+htb_pop(HashTable_t *table, void *key)
+{
+    void *value;
+
+    if (!htb_remove(table, key, &value))
+        return false;
+
+    table->V_interface->free(value);
+
+    return true;
+}
+
+/// Returns true if the hash table has no key-value pairs.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+///
+/// \return True if \c count equals 0, otherwise false.
+bool
+htb_empty(HashTable_t *table)
+{
+    return table->count == 0;
+}
+
+/// Returns true if the hash table is still moving nodes from an old buffer to
+/// a new one.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+///
+/// \return True if the table is rehashing, otherwise false.
+bool
+htb_rehashing(HashTable_t *table)
+{
+    return table->old_buffer != NULL;
+}
+
+/// Returns true if the hash table contains a given key. If the table is
+/// rehashing, a rehash step is executed first.
+///
+/// \par Interface Requirements
+/// - Key interface: compare
+/// - Key interface: hash
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is present, otherwise false.
+bool
+htb_contains_key(HashTable_t *table, void *key)
+{
+    htb_rehash_step(table, table->rehash_step);
+
+    return htb_find(table, key, table->K_interface->hash(key)) != NULL;
+}
+
+/// Moves up to \c buckets non-empty buckets from the old buffer to the new
+/// one. At most ten empty buckets per requested bucket are visited so that a
+/// sparse old buffer doesn't make a step take too long. When the last bucket
+/// is moved the old buffer is freed.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] table HashTable_s reference.
+/// \param[in] buckets Maximum amount of non-empty buckets to be moved.
+///
+/// \return True if the step was executed or false if the table is not
+/// rehashing.
+bool
+htb_rehash_step(HashTable_t *table, integer_t buckets)
+{
+    if (!htb_rehashing(table))
+        return false;
+
+    integer_t empty_visits = buckets * 10;
+
+    while (buckets > 0 && table->rehash_index < table->old_capacity)
+    {
+        HashTableNode_t *scan = table->old_buffer[table->rehash_index];
+
+        if (scan == NULL)
+        {
+            table->rehash_index++;
+
+            if (--empty_visits == 0)
+                break;
+
+            continue;
+        }
+
+        while (scan != NULL)
+        {
+            HashTableNode_t *next = scan->next;
+
+            integer_t position = (integer_t)(scan->hash %
+                                             (unsigned_t)table->capacity);
+
+            scan->next = table->buffer[position];
+            table->buffer[position] = scan;
+
+            scan = next;
+        }
+
+        table->old_buffer[table->rehash_index] = NULL;
+        table->rehash_index++;
+
+        buckets--;
+    }
+
+    if (table->rehash_index == table->old_capacity)
+    {
+        free(table->old_buffer);
+
+        table->old_buffer = NULL;
+        table->old_capacity = 0;
+        table->rehash_index = 0;
+    }
+
+    table->version_id++;
+
+    return true;
+}
+
+/// Displays a HashTable_s in the console, one key-value pair per line.
+///
+/// \par Interface Requirements
+/// - Key interface: display
+/// - Value interface: display
+///
+/// \param[in] table HashTable_s reference.
+void
+htb_display(HashTable_t *table)
+{
+    if (htb_empty(table))
+    {
+        printf("\nHashTable\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nHashTable\n");
+
+    HashTableNode_t **buffers[2] = { table->old_buffer, table->buffer };
+    integer_t capacities[2] = { table->old_capacity, table->capacity };
+
+    for (int b = 0; b < 2; b++)
+    {
+        for (integer_t i = 0; i < capacities[b]; i++)
+        {
+            HashTableNode_t *scan = buffers[b][i];
+
+            while (scan != NULL)
+            {
+                table->K_interface->display(scan->key);
+
+                printf(" : ");
+
+                table->V_interface->display(scan->value);
+
+                printf("\n");
+
+                scan = scan->next;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static HashTableNode_t *
+htb_new_node(NodePool_t *pool, void *key, void *value, unsigned_t hash)
+{
+    HashTableNode_t *node = npl_node_alloc(pool, sizeof(HashTableNode_t));
+
+    if (!node)
+        return NULL;
+
+    node->key = key;
+    node->value = value;
+    node->hash = hash;
+    node->next = NULL;
+
+    return node;
+}
+
+static void
+htb_free_buffer(NodePool_t *pool, HashTableNode_t **buffer,
+                integer_t capacity, free_f key_free, free_f value_free)
+{
+    for (integer_t i = 0; i < capacity; i++)
+    {
+        HashTableNode_t *scan = buffer[i];
+
+        while (scan != NULL)
+        {
+            HashTableNode_t *next = scan->next;
+
+            key_free(scan->key);
+            value_free(scan->value);
+            npl_node_free(pool, scan);
+
+            scan = next;
+        }
+
+        buffer[i] = NULL;
+    }
+}
+
+static void
+htb_free_buffer_shallow(NodePool_t *pool, HashTableNode_t **buffer,
+                        integer_t capacity)
+{
+    for (integer_t i = 0; i < capacity; i++)
+    {
+        HashTableNode_t *scan = buffer[i];
+
+        while (scan != NULL)
+        {
+            HashTableNode_t *next = scan->next;
+
+            npl_node_free(pool, scan);
+
+            scan = next;
+        }
+
+        buffer[i] = NULL;
+    }
+}
+
+// Returns the link that points to the node with the given key so that it can
+// be unlinked, or NULL if it is not present in either buffer
+static HashTableNode_t **
+htb_find(HashTable_t *table, void *key, unsigned_t hash)
+{
+    HashTableNode_t **link;
+
+    if (table->old_buffer)
+    {
+        link = &(table->old_buffer[hash % (unsigned_t)table->old_capacity]);
+
+        while (*link != NULL)
+        {
+            if ((*link)->hash == hash &&
+                table->K_interface->compare((*link)->key, key) == 0)
+                return link;
+
+            link = &((*link)->next);
+        }
+    }
+
+    link = &(table->buffer[hash % (unsigned_t)table->capacity]);
+
+    while (*link != NULL)
+    {
+        if ((*link)->hash == hash &&
+            table->K_interface->compare((*link)->key, key) == 0)
+            return link;
+
+        link = &((*link)->next);
+    }
+
+    return NULL;
+}
+
+// Allocates a bigger buffer and makes the current one the old buffer that
+// will be drained by htb_rehash_step()
+static bool
+htb_start_rehash(HashTable_t *table)
+{
+    if (table->prime_index + 1 >= ds_hash_primes_size)
+        return false;
+
+    // Only one rehash at a time; finishing the current one is rare since the
+    // old buffer is drained much faster than the new one fills up
+    if (htb_rehashing(table))
+        htb_rehash_step(table, table->old_capacity);
+
+    integer_t new_capacity = ds_hash_primes[table->prime_index + 1];
+
+    HashTableNode_t **new_buffer = calloc((size_t)new_capacity,
+                                          sizeof(HashTableNode_t *));
+
+    if (!new_buffer)
+        return false;
+
+    table->old_buffer = table->buffer;
+    table->old_capacity = table->capacity;
+    table->rehash_index = 0;
+
+    table->buffer = new_buffer;
+    table->capacity = new_capacity;
+    table->prime_index++;
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo HashTableIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo HashTableWrapper
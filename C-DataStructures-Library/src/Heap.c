@@ -7,6 +7,8 @@
  */
 
 #include "Heap.h"
+#include "Snapshot.h"
+#include "Trace.h"
 
 /// A Heap is a data structure that can be seen as a nearly complete binary
 /// heap. Each node is represented by an element of an internal array storage.
@@ -22,19 +24,42 @@
 /// The advantages of heaps implemented as arrays is that there is no overhead
 /// of pointers to child nodes and a couple of operations is enough to find
 /// each node as shown above.
+///
+/// The heap can also have more than two children per node (see
+/// hep_set_arity()). With an arity \c D the children of \c I are located at
+/// <code> D * I + 1 </code> up to <code> D * I + D </code> and its parent at
+/// <code> (I - 1) / D </code>. The buffer starts <code> D - 1 </code> slots
+/// after a cache-aligned block, so that all children of a node start at a
+/// multiple of \c D slots and with 4 or 8 children they share a single cache
+/// line.
+///
+/// A min-max heap is a binary heap whose levels alternate between min levels,
+/// starting at the root, and max levels. An element on a min level is lesser
+/// than all of its descendants and one on a max level is greater, so both the
+/// lowest and the highest elements are found in constant time and removed in
+/// logarithmic time from a single buffer. Elements are only compared with
+/// their parents and grandparents on the way up and with their children and
+/// grandchildren on the way down. Handles work the same for every kind.
 struct Heap_s
 {
     /// \brief What kind of heap this is.
     ///
     ///  1 - Max-Heap
     /// -1 - Min-Heap
+    ///  2 - Min-Max-Heap
     enum HeapKind_e kind;
 
     /// \brief Data buffer.
     ///
-    /// Buffer where elements are stored in.
+    /// Buffer where elements are stored in. Points inside of \c block.
     void **buffer;
 
+    /// \brief Cache-aligned allocation that holds the buffer.
+    void **block;
+
+    /// \brief Amount of children of each node.
+    integer_t arity;
+
     /// \brief Current amount of elements in the heap.
     ///
     /// Current amount of elements in the heap.
@@ -54,17 +79,32 @@ struct Heap_s
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
 
+    /// \brief How the new capacity is calculated, see GrowthPolicy_e.
+    GrowthPolicy policy;
+
+    /// \brief Amount of elements added by DS_GROWTH_STEP.
+    integer_t step;
+
     /// \brief Flag for locked capacity.
     ///
     /// If \c locked is set to true the buffer will not grow.
     bool locked;
 
+    /// \brief Flag for shrinking the buffer when it is mostly empty.
+    bool shrink;
+
+    /// \brief The buffer is never shrunk below this capacity.
+    ///
+    /// The initial capacity of the heap.
+    integer_t minimum;
+
     /// \brief Heap_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -72,30 +112,105 @@ struct Heap_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
+
+    /// \brief Position of each handle in the buffer.
+    ///
+    /// Indexed by HeapHandle. Free handles hold a negative value that links
+    /// them to the next free handle (see \c free_handle). Only allocated
+    /// after the first call to hep_insert_handle(), NULL until then. Has the
+    /// same size as the buffer.
+    integer_t *positions;
+
+    /// \brief Handle of each element in the buffer.
+    ///
+    /// The inverse of \c positions, kept in sync by every swap.
+    integer_t *handles;
+
+    /// \brief First free handle to be reused or -1 if there is none.
+    integer_t free_handle;
+
+    /// \brief Amount of handles ever given, free or not.
+    integer_t next_handle;
+
+#ifdef DS_STATS
+    /// \brief Operation counters, see hep_stats().
+    ContainerStats_t stats;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static integer_t
-hep_p(integer_t position);
+hep_p(Heap_t *heap, integer_t position);
 
 static integer_t
-hep_l(integer_t position);
+hep_c(Heap_t *heap, integer_t position);
 
-static integer_t
-hep_r(integer_t position);
+static void **
+hep_new_block(integer_t capacity, integer_t arity);
 
 static bool
 hep_grow(Heap_t *heap);
 
+static bool
+hep_reserve(Heap_t *heap, integer_t capacity);
+
+static void
+hep_shrink(Heap_t *heap);
+
+static void
+hep_build(Heap_t *heap, integer_t from);
+
+static bool
+hep_index(Heap_t *heap);
+
+static HeapHandle
+hep_handle_take(Heap_t *heap, integer_t position);
+
+static void
+hep_handle_release(Heap_t *heap, HeapHandle handle);
+
+static bool
+hep_handle_valid(Heap_t *heap, HeapHandle handle);
+
+static void
+hep_move(Heap_t *heap, integer_t from, integer_t to);
+
+static void
+hep_swap(Heap_t *heap, integer_t i, integer_t j);
+
+static void
+hep_fix(Heap_t *heap, integer_t index);
+
+static bool
+hep_remove_at(Heap_t *heap, integer_t position, void **result);
+
+static integer_t
+hep_max_position(Heap_t *heap);
+
+static integer_t
+hep_minmax_mod(integer_t index);
+
+static void
+hep_minmax_fix(Heap_t *heap, integer_t index);
+
+static bool
+hep_minmax_up(Heap_t *heap, integer_t index, integer_t mod);
+
+static void
+hep_minmax_down(Heap_t *heap, integer_t index);
+
 bool
 hep_float_up(Heap_t *heap, integer_t index);
 
 bool
 hep_float_down(Heap_t *heap, integer_t index);
 
+#ifndef DS_NO_DISPLAY
 void
 hep_display_tree(Heap_t *heap, integer_t index, integer_t height);
+#endif
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -107,7 +222,7 @@ hep_display_tree(Heap_t *heap, integer_t index, integer_t height);
 Heap_t *
 hep_new(Interface_t *interface, HeapKind kind)
 {
-    if (!(kind == MaxHeap || kind == MinHeap))
+    if (!(kind == MaxHeap || kind == MinHeap || kind == MinMaxHeap))
         return NULL;
 
     Heap_t *heap = malloc(sizeof(Heap_t));
@@ -115,27 +230,42 @@ hep_new(Interface_t *interface, HeapKind kind)
     if (!heap)
         return NULL;
 
-    heap->buffer = malloc(sizeof(void *) * 32);
+    heap->block = hep_new_block(32, 2);
 
-    if (!heap->buffer)
+    if (!heap->block)
     {
         free(heap);
         return NULL;
     }
 
+    heap->arity = 2;
+    heap->buffer = heap->block + 1;
+
     for (integer_t i = 0; i < 32; i++)
         heap->buffer[i] = NULL;
 
     heap->capacity = 32;
+    heap->minimum = 32;
     heap->growth_rate = 200;
     heap->count = 0;
-    heap->version_id = 0;
+    DS_VERSION_RESET(heap);
 
     heap->locked = false;
+    heap->shrink = false;
+    heap->policy = DS_GROWTH_GEOMETRIC;
+    heap->step = 0;
 
     heap->interface = interface;
     heap->kind = kind;
 
+    heap->positions = NULL;
+    heap->handles = NULL;
+    heap->free_handle = -1;
+    heap->next_handle = 0;
+
+    DS_STATS_RESET(heap);
+    DS_STATS_ADD(heap, allocations, 2);
+
     return heap;
 }
 
@@ -153,7 +283,7 @@ hep_create(Interface_t *interface, integer_t size, integer_t growth_rate,
     if (size < 1 || growth_rate < 101)
         return NULL;
 
-    if (!(kind == MaxHeap || kind == MinHeap))
+    if (!(kind == MaxHeap || kind == MinHeap || kind == MinMaxHeap))
         return NULL;
 
     Heap_t *heap = malloc(sizeof(Heap_t));
@@ -161,25 +291,78 @@ hep_create(Interface_t *interface, integer_t size, integer_t growth_rate,
     if (!heap)
         return NULL;
 
-    heap->buffer = malloc(sizeof(void *) * (size_t) size);
+    heap->block = hep_new_block(size, 2);
 
-    if (!heap->buffer)
+    if (!heap->block)
     {
         free(heap);
         return NULL;
     }
 
+    heap->arity = 2;
+    heap->buffer = heap->block + 1;
+
     for (integer_t i = 0; i < size; i++)
         heap->buffer[i] = NULL;
 
     heap->capacity = size;
+    heap->minimum = size;
     heap->growth_rate = growth_rate;
     heap->count = 0;
-    heap->version_id = 0;
+    DS_VERSION_RESET(heap);
+
+    heap->locked = false;
+    heap->shrink = false;
+    heap->policy = DS_GROWTH_GEOMETRIC;
+    heap->step = 0;
 
     heap->interface = interface;
     heap->kind = kind;
 
+    heap->positions = NULL;
+    heap->handles = NULL;
+    heap->free_handle = -1;
+    heap->next_handle = 0;
+
+    DS_STATS_RESET(heap);
+    DS_STATS_ADD(heap, allocations, 2);
+
+    return heap;
+}
+
+/// Builds a heap from a buffer of elements with Floyd's bottom-up method. Every
+/// internal node is floated down once, starting from the last one, which takes
+/// O(n) instead of the O(n log n) of inserting the elements one by one. On
+/// success the heap takes ownership of the elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// heap to operate.
+/// \param[in] buffer Buffer of elements in any order.
+/// \param[in] length Amount of elements in the buffer.
+/// \param[in] kind If the heap is a MaxHeap, a MinHeap or a MinMaxHeap.
+///
+/// \return A new Heap_s or NULL if allocation failed or the kind is invalid.
+Heap_t *
+hep_from_array(Interface_t *interface, void **buffer, integer_t length,
+               HeapKind kind)
+{
+    if (length < 0)
+        return NULL;
+
+    Heap_t *heap = hep_create(interface, length > 0 ? length : 1, 200, kind);
+
+    if (!heap)
+        return NULL;
+
+    memcpy(heap->buffer, buffer, sizeof(void *) * (size_t)length);
+
+    heap->count = length;
+
+    hep_build(heap, 0);
+
     return heap;
 }
 
@@ -190,10 +373,12 @@ hep_free(Heap_t *heap)
 {
     for (integer_t i = 0; i < heap->count; i++)
     {
-        heap->interface->free(heap->buffer[i]);
+        interface_release(heap->interface, heap->buffer[i]);
     }
 
-    free(heap->buffer);
+    free(heap->positions);
+    free(heap->handles);
+    free(heap->block);
     free(heap);
 }
 
@@ -202,7 +387,9 @@ hep_free(Heap_t *heap)
 void
 hep_free_shallow(Heap_t *heap)
 {
-    free(heap->buffer);
+    free(heap->positions);
+    free(heap->handles);
+    free(heap->block);
     free(heap);
 }
 
@@ -213,12 +400,17 @@ hep_erase(Heap_t *heap)
 {
     for (integer_t i = 0; i < heap->count; i++)
     {
-        heap->interface->free(heap->buffer[i]);
+        interface_release(heap->interface, heap->buffer[i]);
         heap->buffer[i] = NULL;
     }
 
+    DS_STATS_ADD(heap, frees, heap->count);
+
     heap->count = 0;
-    heap->version_id++;
+    DS_VERSION_BUMP(heap);
+
+    heap->free_handle = -1;
+    heap->next_handle = 0;
 }
 
 ///
@@ -232,7 +424,10 @@ hep_erase_shallow(Heap_t *heap)
     }
 
     heap->count = 0;
-    heap->version_id++;
+    DS_VERSION_BUMP(heap);
+
+    heap->free_handle = -1;
+    heap->next_handle = 0;
 }
 
 ///
@@ -274,6 +469,15 @@ hep_growth(Heap_t *heap)
     return heap->growth_rate;
 }
 
+/// \param[in] heap The heap.
+///
+/// \return How the buffer grows.
+GrowthPolicy
+hep_policy(Heap_t *heap)
+{
+    return heap->policy;
+}
+
 ///
 /// \param[in] heap
 ///
@@ -294,6 +498,42 @@ hep_kind(Heap_t *heap)
     return heap->kind;
 }
 
+/// \param[in] heap The heap.
+///
+/// \return The amount of children of each node.
+integer_t
+hep_arity(Heap_t *heap)
+{
+    return heap->arity;
+}
+
+/// Copies the operation counters of the heap. They are only kept when the
+/// library is compiled with \c DS_STATS defined. Every level an element is
+/// swapped up or down counts as one sift step.
+///
+/// \param[in] heap The heap.
+/// \param[out] stats Where the counters are copied to.
+///
+/// \return True if the counters are kept, otherwise false and every counter
+/// is zero.
+bool
+hep_stats(Heap_t *heap, ContainerStats_t *stats)
+{
+    if (!DS_STATS_GET(heap, stats))
+        return false;
+
+    size_t block = sizeof(void *) * (size_t)(heap->capacity + heap->arity - 1);
+
+    stats->bytes = sizeof(Heap_t)
+                   + (block + DS_CACHE_LINE - 1) / DS_CACHE_LINE
+                     * DS_CACHE_LINE;
+
+    if (heap->positions)
+        stats->bytes += 2 * sizeof(integer_t) * (size_t)heap->capacity;
+
+    return true;
+}
+
 ///
 /// \param[in] heap
 /// \param[in] growth_rate
@@ -310,6 +550,55 @@ hep_set_growth(Heap_t *heap, integer_t growth_rate)
     return true;
 }
 
+/// Changes the amount of children of each node. A binary heap does the
+/// least comparisons, but on heaps bigger than the cache a 4-ary or 8-ary
+/// heap is shallower and each node's children share a cache line, which
+/// makes removals faster. If the heap has elements it is rebuilt in linear
+/// time. Handles stay valid. A MinMaxHeap is always binary.
+///
+/// \param[in] heap The heap.
+/// \param[in] arity Amount of children of each node, from 2 to 16.
+///
+/// \return True if the arity was changed, false if it is out of range, if the
+/// heap is a MinMaxHeap or if allocation failed.
+bool
+hep_set_arity(Heap_t *heap, integer_t arity)
+{
+    if (arity < 2 || arity > 16)
+        return false;
+
+    if (heap->kind == MinMaxHeap && arity != 2)
+        return false;
+
+    if (arity == heap->arity)
+        return true;
+
+    void **block = hep_new_block(heap->capacity, arity);
+
+    if (!block)
+        return false;
+
+    void **buffer = block + arity - 1;
+
+    memcpy(buffer, heap->buffer, sizeof(void *) * (size_t)heap->count);
+
+    free(heap->block);
+
+    heap->block = block;
+    heap->buffer = buffer;
+    heap->arity = arity;
+
+    DS_STATS_ADD(heap, allocations, 1);
+
+    // Bottom-up heap construction
+    for (integer_t i = hep_p(heap, heap->count - 1); i >= 0; i--)
+        hep_float_down(heap, i);
+
+    DS_VERSION_BUMP(heap);
+
+    return true;
+}
+
 ///
 /// \param[in] heap
 void
@@ -326,6 +615,40 @@ hep_capacity_unlock(Heap_t *heap)
     heap->locked = false;
 }
 
+/// Sets how the buffer grows. The buffer is cache-line aligned, so it is
+/// always moved to a new allocation instead of being extended in place.
+///
+/// \param[in] heap The heap.
+/// \param[in] policy The new growth policy.
+/// \param[in] step Amount of elements added on each growth by
+/// DS_GROWTH_STEP. Ignored by the other policies.
+///
+/// \return True if the policy was changed or false if the step is less than
+/// 1 for DS_GROWTH_STEP.
+bool
+hep_set_policy(Heap_t *heap, GrowthPolicy policy, integer_t step)
+{
+    if (policy == DS_GROWTH_STEP && step < 1)
+        return false;
+
+    heap->policy = policy;
+    heap->step = step;
+
+    return true;
+}
+
+/// Makes the heap shrink its buffer to half of its capacity whenever it is a
+/// quarter full after a removal, but never below its initial capacity.
+/// Buffers are not shrunk while the capacity is locked.
+///
+/// \param[in] heap The heap.
+/// \param[in] shrink True to shrink the buffer automatically.
+void
+hep_set_shrink(Heap_t *heap, bool shrink)
+{
+    heap->shrink = shrink;
+}
+
 ///
 /// \param[in] heap
 /// \param[in] element
@@ -334,19 +657,29 @@ hep_capacity_unlock(Heap_t *heap)
 bool
 hep_insert(Heap_t *heap, void *element)
 {
+    DS_TRACE_ENTRY(hep_insert, heap->count);
+
     integer_t C = heap->count;
 
     if (hep_full(heap))
     {
         if (!hep_grow(heap))
+        {
+            DS_TRACE_RETURN(hep_insert, heap->count);
             return false;
+        }
     }
 
+    if (heap->positions)
+        hep_handle_take(heap, C);
+
     if (C == 0)
     {
         heap->buffer[heap->count] = element;
         heap->count++;
 
+        DS_TRACE_RETURN(hep_insert, heap->count);
+
         return true;
     }
 
@@ -354,7 +687,12 @@ hep_insert(Heap_t *heap, void *element)
     heap->count++;
 
     if (!hep_float_up(heap, C))
+    {
+        DS_TRACE_RETURN(hep_insert, heap->count);
         return false;
+    }
+
+    DS_TRACE_RETURN(hep_insert, heap->count);
 
     return true;
 }
@@ -367,23 +705,187 @@ hep_insert(Heap_t *heap, void *element)
 bool
 hep_remove(Heap_t *heap, void **result)
 {
+    DS_TRACE_ENTRY(hep_remove, heap->count);
+
     if (hep_empty(heap))
+    {
+        DS_TRACE_RETURN(hep_remove, heap->count);
         return false;
+    }
 
     *result = heap->buffer[0];
 
+    if (heap->positions)
+        hep_handle_release(heap, heap->handles[0]);
+
     // Swap bottom element with root
-    heap->buffer[0] = heap->buffer[heap->count - 1];
+    if (heap->count > 1)
+        hep_move(heap, heap->count - 1, 0);
     heap->buffer[heap->count - 1] = NULL;
 
     heap->count--;
 
     if (!hep_float_down(heap, 0))
+    {
+        DS_TRACE_RETURN(hep_remove, heap->count);
+        return false;
+    }
+
+    hep_shrink(heap);
+
+    DS_TRACE_RETURN(hep_remove, heap->count);
+
+    return true;
+}
+
+/// Inserts a buffer of elements in the heap. The buffer grows at most once and
+/// the elements are appended to it. If they are at least as many as the
+/// elements already in the heap, the whole heap is rebuilt bottom-up in linear
+/// time. Otherwise each one is floated up like in hep_insert(). If the heap
+/// keeps handles, every new element gets one. Either all elements are
+/// inserted or none is.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The heap where the elements are inserted.
+/// \param[in] elements Buffer of elements in any order. The heap takes
+/// ownership of the elements, but not of the buffer.
+/// \param[in] size Amount of elements in the buffer.
+///
+/// \return True if all elements were inserted, false if the heap is locked
+/// and has no room for them or if allocation failed.
+bool
+hep_insert_all(Heap_t *heap, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return size == 0;
+
+    integer_t from = heap->count;
+
+    if (!hep_reserve(heap, from + size))
+        return false;
+
+    memcpy(heap->buffer + from, elements, sizeof(void *) * (size_t)size);
+
+    heap->count += size;
+
+    if (heap->positions)
+    {
+        for (integer_t i = from; i < heap->count; i++)
+            hep_handle_take(heap, i);
+    }
+
+    hep_build(heap, from);
+
+    return true;
+}
+
+/// Removes up to a given amount of elements from the top of the heap, like
+/// calling hep_remove() that many times. Useful to take the k highest priority
+/// elements at once.
+///
+/// \param[in] heap The heap.
+/// \param[in] amount How many elements to remove.
+/// \param[out] result Buffer with room for \c amount elements, where the
+/// removed elements are written in the order they left the heap.
+///
+/// \return The amount of elements removed, which is less than \c amount if the
+/// heap had less elements.
+integer_t
+hep_remove_n(Heap_t *heap, integer_t amount, void **result)
+{
+    integer_t total = 0;
+
+    while (total < amount && hep_remove(heap, &result[total]))
+        total++;
+
+    return total;
+}
+
+/// Removes the lowest element. Same as hep_remove() for a MinHeap or a
+/// MinMaxHeap.
+///
+/// \param[in] heap The heap.
+/// \param[out] result The element that was removed.
+///
+/// \return True if the element was removed, false if the heap is empty or if
+/// it is a MaxHeap.
+bool
+hep_remove_min(Heap_t *heap, void **result)
+{
+    if (heap->kind == MaxHeap)
+        return false;
+
+    return hep_remove(heap, result);
+}
+
+/// Removes the highest element. In a MinMaxHeap it is the greater child of
+/// the root, which is replaced by the last element and floated down its max
+/// levels.
+///
+/// \param[in] heap The heap.
+/// \param[out] result The element that was removed.
+///
+/// \return True if the element was removed, false if the heap is empty or if
+/// it is a MinHeap.
+bool
+hep_remove_max(Heap_t *heap, void **result)
+{
+    if (heap->kind == MinHeap || hep_empty(heap))
+        return false;
+
+    return hep_remove_at(heap, hep_max_position(heap), result);
+}
+
+/// Inserts an element like hep_insert() and returns a handle that keeps
+/// track of its position, so that it can later be changed with hep_update()
+/// or removed with hep_remove_handle(). The heap starts keeping handles for
+/// all of its elements on the first call to this function.
+///
+/// \param[in] heap The heap where the element is inserted.
+/// \param[in] element The element to be inserted.
+/// \param[out] handle The element's handle.
+///
+/// \return True if the element was inserted, false if the heap could not
+/// grow or if allocation failed.
+bool
+hep_insert_handle(Heap_t *heap, void *element, HeapHandle *handle)
+{
+    if (!heap->positions && !hep_index(heap))
+        return false;
+
+    // The handle hep_insert() will take
+    HeapHandle next = heap->free_handle >= 0
+                      ? heap->free_handle : heap->next_handle;
+
+    if (!hep_insert(heap, element))
         return false;
 
+    *handle = next;
+
     return true;
 }
 
+/// Removes an element in the middle of the heap in logarithmic time. The
+/// handle is no longer valid afterwards.
+///
+/// \param[in] heap The heap.
+/// \param[in] handle The handle of the element to be removed.
+/// \param[out] result The element that was removed.
+///
+/// \return True if the element was removed, false if the handle is invalid.
+bool
+hep_remove_handle(Heap_t *heap, HeapHandle handle, void **result)
+{
+    if (!hep_handle_valid(heap, handle))
+        return false;
+
+    return hep_remove_at(heap, heap->positions[handle], result);
+}
+
+/// Returns the root element, the highest of a MaxHeap and the lowest of a
+/// MinHeap or a MinMaxHeap.
 ///
 /// \param[in] heap
 ///
@@ -397,6 +899,32 @@ hep_peek(Heap_t *heap)
     return heap->buffer[0];
 }
 
+/// \param[in] heap The heap.
+///
+/// \return The lowest element or NULL if the heap is empty or if it is a
+/// MaxHeap.
+void *
+hep_peek_min(Heap_t *heap)
+{
+    if (heap->kind == MaxHeap)
+        return NULL;
+
+    return hep_peek(heap);
+}
+
+/// \param[in] heap The heap.
+///
+/// \return The highest element or NULL if the heap is empty or if it is a
+/// MinHeap.
+void *
+hep_peek_max(Heap_t *heap)
+{
+    if (heap->kind == MinHeap || hep_empty(heap))
+        return NULL;
+
+    return heap->buffer[hep_max_position(heap)];
+}
+
 ///
 /// \param[in] heap
 ///
@@ -427,6 +955,68 @@ hep_heapify(Heap_t *heap)
     return hep_float_down(heap, 0);
 }
 
+/// Moves the element of a handle up or down after its priority is changed
+/// in place, like decrease-key in a min-heap.
+///
+/// \param[in] heap The heap.
+/// \param[in] handle The handle of the changed element.
+///
+/// \return True if the tree was fixed, false if the handle is invalid.
+bool
+hep_update(Heap_t *heap, HeapHandle handle)
+{
+    if (!hep_handle_valid(heap, handle))
+        return false;
+
+    hep_fix(heap, heap->positions[handle]);
+
+    return true;
+}
+
+/// Moves every element of heap2 into heap1 with hep_insert_all(), which
+/// concatenates both buffers and rebuilds heap1 in linear time when heap2 is
+/// the bigger one. heap2 is left empty and its handles are no longer valid.
+///
+/// \warning Both heaps must have the same interface and handling the same data
+/// type, otherwise you'll be mixing elements into a heap that doesn't know how
+/// to handle it (probably crashing).
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap1 The heap that receives the elements.
+/// \param[in] heap2 The heap whose elements are moved.
+///
+/// \return True if the elements were merged, false if both heaps are the
+/// same, if heap1 is locked and has no room for them or if allocation failed,
+/// in which case both heaps are left unchanged.
+bool
+hep_merge(Heap_t *heap1, Heap_t *heap2)
+{
+    if (heap1 == heap2)
+        return false;
+
+    if (!hep_insert_all(heap1, heap2->buffer, heap2->count))
+        return false;
+
+    hep_erase_shallow(heap2);
+
+    return true;
+}
+
+/// \param[in] heap The heap.
+/// \param[in] handle A handle.
+///
+/// \return The element of the handle or NULL if the handle is invalid.
+void *
+hep_handle_get(Heap_t *heap, HeapHandle handle)
+{
+    if (!hep_handle_valid(heap, handle))
+        return NULL;
+
+    return heap->buffer[heap->positions[handle]];
+}
+
 ///
 /// \param[in] heap
 ///
@@ -440,15 +1030,27 @@ hep_copy(Heap_t *heap)
     if (!copy)
         return NULL;
 
-    copy->locked = copy->locked;
+    if (!hep_set_arity(copy, heap->arity))
+    {
+        hep_free(copy);
+        return NULL;
+    }
+
+    copy->locked = heap->locked;
+    copy->shrink = heap->shrink;
+    copy->policy = heap->policy;
+    copy->step = heap->step;
+    copy->minimum = heap->minimum;
 
     for (integer_t i = 0; i < heap->count; i++)
     {
-        copy->buffer[i] = heap->interface->copy(heap->buffer[i]);
+        copy->buffer[i] = interface_copy(heap->interface, heap->buffer[i]);
     }
 
+    DS_STATS_ADD(heap, copies, heap->count);
+
     copy->count = heap->count;
-    copy->version_id++;
+    DS_VERSION_BUMP(copy);
 
     return copy;
 }
@@ -466,7 +1068,17 @@ hep_copy_shallow(Heap_t *heap)
     if (!copy)
         return NULL;
 
-    copy->locked = copy->locked;
+    if (!hep_set_arity(copy, heap->arity))
+    {
+        hep_free(copy);
+        return NULL;
+    }
+
+    copy->locked = heap->locked;
+    copy->shrink = heap->shrink;
+    copy->policy = heap->policy;
+    copy->step = heap->step;
+    copy->minimum = heap->minimum;
 
     for (integer_t i = 0; i < heap->count; i++)
     {
@@ -474,11 +1086,137 @@ hep_copy_shallow(Heap_t *heap)
     }
 
     copy->count = heap->count;
-    copy->version_id++;
+    DS_VERSION_BUMP(copy);
 
     return copy;
 }
 
+/// Moves all the elements of the heap to a C array, leaving the heap empty.
+/// The elements are not copied, so they now belong to the caller, and every
+/// handle is released. They come in the order of the heap's buffer, not
+/// sorted; hep_remove_n() gives them in order at the cost of a removal each.
+/// The array can be given to dar_adopt() to drain a heap into a dynamic array
+/// without any per-element work.
+///
+/// \param[in] heap The heap to be emptied.
+/// \param[out] length The resulting array's length.
+///
+/// \return The resulting array or NULL if the heap is empty or the array
+/// allocation failed, in which case the heap is left intact.
+void **
+hep_to_array_move(Heap_t *heap, integer_t *length)
+{
+    *length = 0;
+
+    if (hep_empty(heap))
+        return NULL;
+
+    void **array = malloc(sizeof(void *) * (size_t)heap->count);
+
+    if (!array)
+        return NULL;
+
+    memcpy(array, heap->buffer, sizeof(void *) * (size_t)heap->count);
+
+    *length = heap->count;
+
+    hep_erase_shallow(heap);
+
+    DS_STATS_ADD(heap, allocations, 1);
+
+    return array;
+}
+
+/// Writes the heap to a stream as a snapshot that hep_restore() reads back.
+/// The buffer is written as it is, in heap order, along with the kind, arity
+/// and growth rate of the heap. Handles are not saved.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] heap The heap.
+/// \param[in] stream Where the snapshot is written to.
+///
+/// \return True if the snapshot was written or false if writing failed or if
+/// the interface has no serialize function.
+bool
+hep_save(Heap_t *heap, FILE *stream)
+{
+    if (!heap->interface->serialize)
+        return false;
+
+    SnapshotHeader_t header;
+
+    snp_header_init(&header, SnapshotHeap, (uint64_t)heap->count);
+
+    header.fields[0] = heap->kind;
+    header.fields[1] = heap->arity;
+    header.fields[2] = heap->growth_rate;
+
+    return snp_write_header(stream, &header)
+           && snp_write_elements(stream, heap->interface, heap->buffer,
+                                 heap->count);
+}
+
+/// Reads a heap written by hep_save(). The elements are read straight into
+/// the buffer, which is then checked with a bottom-up pass that only moves
+/// elements if the snapshot was not in heap order, so restoring takes
+/// linear time.
+///
+/// \par Interface Requirements
+/// - compare
+/// - deserialize
+/// - free
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// heap to operate.
+/// \param[in] stream Where the snapshot is read from.
+///
+/// \return A new Heap_s or NULL if the stream doesn't hold a snapshot of a
+/// heap, if reading or allocation failed or if the interface has no
+/// deserialize function.
+Heap_t *
+hep_restore(Interface_t *interface, FILE *stream)
+{
+    SnapshotHeader_t header;
+
+    if (!interface->deserialize
+        || !snp_read_header(stream, SnapshotHeap, &header))
+        return NULL;
+
+    integer_t count = (integer_t)header.count;
+
+    Heap_t *heap = hep_create(interface, count > 0 ? count : 1,
+                              (integer_t)header.fields[2],
+                              (HeapKind)header.fields[0]);
+
+    if (!heap)
+        return NULL;
+
+    if (!hep_set_arity(heap, (integer_t)header.fields[1]))
+    {
+        hep_free(heap);
+        return NULL;
+    }
+
+    for (; heap->count < count; heap->count++)
+    {
+        heap->buffer[heap->count] = interface->deserialize(stream);
+
+        if (!heap->buffer[heap->count])
+        {
+            hep_free(heap);
+            return NULL;
+        }
+    }
+
+    for (integer_t i = hep_p(heap, heap->count - 1); i >= 0; i--)
+        hep_float_down(heap, i);
+
+    return heap;
+}
+
+#ifndef DS_NO_DISPLAY
 ///
 /// \param[in] heap
 /// \param[in] display_mode
@@ -527,62 +1265,284 @@ hep_display(Heap_t *heap, int display_mode)
             break;
     }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // Parent
 static integer_t
-hep_p(integer_t position)
+hep_p(Heap_t *heap, integer_t position)
 {
-    return (position - 1) / 2;
+    return (position - 1) / heap->arity;
 }
 
-// Left child
+// First child
 static integer_t
-hep_l(integer_t position)
+hep_c(Heap_t *heap, integer_t position)
 {
-    return (2 * position) + 1;
+    return heap->arity * position + 1;
 }
 
-// Right child
-static integer_t
-hep_r(integer_t position)
+// Allocates a cache-aligned block with room for the D - 1 slots before the
+// buffer
+static void **
+hep_new_block(integer_t capacity, integer_t arity)
 {
-    return (2 * position) + 2;
+    size_t size = sizeof(void *) * (size_t)(capacity + arity - 1);
+
+    // aligned_alloc requires a size that is a multiple of the alignment
+    size = (size + DS_CACHE_LINE - 1) / DS_CACHE_LINE * DS_CACHE_LINE;
+
+    return aligned_alloc(DS_CACHE_LINE, size);
 }
 
 // Increases the heap's buffer
 static bool
 hep_grow(Heap_t *heap)
 {
+    DS_TRACE_ENTRY(hep_grow, heap->capacity);
+
+    if (heap->locked)
+    {
+        DS_TRACE_RETURN(hep_grow, heap->capacity);
+        return false;
+    }
+
+    integer_t capacity = ds_grown_capacity(heap->policy, heap->capacity, 0,
+                                           heap->growth_rate, heap->step,
+                                           sizeof(void *));
+
+    bool grown = hep_reserve(heap, capacity);
+
+    DS_TRACE_RETURN(hep_grow, heap->capacity);
+
+    return grown;
+}
+
+// Makes the buffer big enough for a given capacity in a single allocation
+static bool
+hep_reserve(Heap_t *heap, integer_t capacity)
+{
+    if (capacity <= heap->capacity)
+        return true;
+
     if (heap->locked)
         return false;
 
-    integer_t old_capacity = heap->capacity;
+    // The index grows first so that it is never smaller than the buffer
+    if (heap->positions)
+    {
+        integer_t *new_positions = realloc(heap->positions,
+                sizeof(integer_t) * (size_t)capacity);
+
+        if (!new_positions)
+            return false;
+
+        heap->positions = new_positions;
+
+        integer_t *new_handles = realloc(heap->handles,
+                sizeof(integer_t) * (size_t)capacity);
+
+        if (!new_handles)
+            return false;
+
+        heap->handles = new_handles;
+    }
+
+    void **new_block = hep_new_block(capacity, heap->arity);
+
+    // Allocation failed
+    if (!new_block)
+        return false;
+
+    void **new_buffer = new_block + heap->arity - 1;
+
+    memcpy(new_buffer, heap->buffer, sizeof(void *) * (size_t)heap->count);
+
+    free(heap->block);
+
+    heap->block = new_block;
+    heap->buffer = new_buffer;
+    heap->capacity = capacity;
+
+    DS_STATS_ADD(heap, grows, 1);
+    DS_STATS_ADD(heap, allocations, 1);
+
+    return true;
+}
+
+// Halves the buffer when it is a quarter full, which leaves room for both
+// insertions and removals before the next reallocation. The handle index
+// keeps its size.
+static void
+hep_shrink(Heap_t *heap)
+{
+    if (!heap->shrink || heap->locked ||
+        heap->count > heap->capacity / 4 ||
+        heap->capacity / 2 < heap->minimum)
+        return;
+
+    integer_t capacity = heap->capacity / 2;
+
+    void **new_block = hep_new_block(capacity, heap->arity);
+
+    // The bigger buffer is still valid
+    if (!new_block)
+        return;
+
+    void **new_buffer = new_block + heap->arity - 1;
+
+    memcpy(new_buffer, heap->buffer, sizeof(void *) * (size_t)heap->count);
+
+    free(heap->block);
+
+    heap->block = new_block;
+    heap->buffer = new_buffer;
+    heap->capacity = capacity;
+
+    DS_STATS_ADD(heap, allocations, 1);
+}
 
-    // capacity = capacity * (growth_rate / 100)
-    heap->capacity = (integer_t) ((double) (heap->capacity) *
-                                   ((double) (heap->growth_rate) / 100.0));
+// Restores the heap property after elements were appended from a given
+// position. Floating every node down from the last parent takes O(n), which
+// beats floating each new element up once they are as many as the old ones.
+static void
+hep_build(Heap_t *heap, integer_t from)
+{
+    if (heap->count - from >= from)
+    {
+        for (integer_t i = hep_p(heap, heap->count - 1); i >= 0; i--)
+            hep_float_down(heap, i);
+    }
+    else
+    {
+        for (integer_t i = from; i < heap->count; i++)
+            hep_float_up(heap, i);
+    }
 
-    // 4 is the minimum growth
-    if (heap->capacity - old_capacity < 4)
-        heap->capacity = old_capacity + 4;
+    DS_VERSION_BUMP(heap);
+}
 
-    void **new_buffer = realloc(heap->buffer,
-                                sizeof(void*) * (size_t)heap->capacity);
+// Starts keeping a handle for every element. Existing elements get handles
+// equal to their positions.
+static bool
+hep_index(Heap_t *heap)
+{
+    heap->positions = malloc(sizeof(integer_t) * (size_t)heap->capacity);
+    heap->handles = malloc(sizeof(integer_t) * (size_t)heap->capacity);
 
-    // Reallocation failed
-    if (!new_buffer)
+    if (!heap->positions || !heap->handles)
     {
-        heap->capacity = old_capacity;
+        free(heap->positions);
+        free(heap->handles);
+
+        heap->positions = NULL;
+        heap->handles = NULL;
+
         return false;
     }
 
-    heap->buffer = new_buffer;
+    for (integer_t i = 0; i < heap->count; i++)
+    {
+        heap->positions[i] = i;
+        heap->handles[i] = i;
+    }
+
+    heap->free_handle = -1;
+    heap->next_handle = heap->count;
+
+    DS_STATS_ADD(heap, allocations, 2);
 
     return true;
 }
 
+// Gives a handle to the element at position. There are never more handles
+// than elements, so the index always has room for a new one.
+static HeapHandle
+hep_handle_take(Heap_t *heap, integer_t position)
+{
+    HeapHandle handle;
+
+    if (heap->free_handle >= 0)
+    {
+        handle = heap->free_handle;
+        heap->free_handle = -2 - heap->positions[handle];
+    }
+    else
+        handle = heap->next_handle++;
+
+    heap->positions[handle] = position;
+    heap->handles[position] = handle;
+
+    return handle;
+}
+
+// Free handles store -2 - next, so that -1 ends the list and every free
+// handle is negative
+static void
+hep_handle_release(Heap_t *heap, HeapHandle handle)
+{
+    heap->positions[handle] = -2 - heap->free_handle;
+    heap->free_handle = handle;
+}
+
+static bool
+hep_handle_valid(Heap_t *heap, HeapHandle handle)
+{
+    return heap->positions && handle >= 0 && handle < heap->next_handle &&
+           heap->positions[handle] >= 0;
+}
+
+// Moves an element to another position, overwriting what was there
+static void
+hep_move(Heap_t *heap, integer_t from, integer_t to)
+{
+    heap->buffer[to] = heap->buffer[from];
+
+    if (heap->positions)
+    {
+        heap->handles[to] = heap->handles[from];
+        heap->positions[heap->handles[to]] = to;
+    }
+}
+
+static void
+hep_swap(Heap_t *heap, integer_t i, integer_t j)
+{
+    void *tmp = heap->buffer[i];
+    heap->buffer[i] = heap->buffer[j];
+    heap->buffer[j] = tmp;
+
+    if (heap->positions)
+    {
+        integer_t handle = heap->handles[i];
+        heap->handles[i] = heap->handles[j];
+        heap->handles[j] = handle;
+
+        heap->positions[heap->handles[i]] = i;
+        heap->positions[heap->handles[j]] = j;
+    }
+}
+
+// Floats an element that was changed up or down
+static void
+hep_fix(Heap_t *heap, integer_t index)
+{
+    if (heap->kind == MinMaxHeap)
+    {
+        hep_minmax_fix(heap, index);
+        return;
+    }
+
+    integer_t mod = heap->kind;
+
+    if (index > 0 && DS_STATS_COMPARE(heap, heap->buffer[index],
+            heap->buffer[hep_p(heap, index)]) * mod > 0)
+        hep_float_up(heap, index);
+    else
+        hep_float_down(heap, index);
+}
+
 /// Floats up the newly added element, maintaining the heap properties
 bool
 hep_float_up(Heap_t *heap, integer_t index)
@@ -590,11 +1550,17 @@ hep_float_up(Heap_t *heap, integer_t index)
     if (index < 0)
         return false;
 
+    if (heap->kind == MinMaxHeap)
+    {
+        hep_minmax_fix(heap, index);
+        return true;
+    }
+
     integer_t C = index;
 
     // Maintaining the heap property
     void *child = heap->buffer[C];
-    void *parent = heap->buffer[hep_p(C)];
+    void *parent = heap->buffer[hep_p(heap, C)];
 
     // This modifier changes the compare function's result.
     // If the heap is a MinHeap and the comparison returns -1, it means that
@@ -605,17 +1571,17 @@ hep_float_up(Heap_t *heap, integer_t index)
     integer_t mod = heap->kind;
 
     // Float up
-    while (C > 0 && heap->interface->compare(child, parent) * mod > 0)
+    while (C > 0 && DS_STATS_COMPARE(heap, child, parent) * mod > 0)
     {
         // Swap child with parent
-        void *tmp = heap->buffer[C];
-        heap->buffer[C] = heap->buffer[hep_p(C)];
-        heap->buffer[hep_p(C)] = tmp;
+        hep_swap(heap, C, hep_p(heap, C));
+
+        DS_STATS_ADD(heap, sifts, 1);
 
-        C = hep_p(C);
+        C = hep_p(heap, C);
 
         child = heap->buffer[C];
-        parent = heap->buffer[hep_p(C)];
+        parent = heap->buffer[hep_p(heap, C)];
     }
 
     return true;
@@ -629,6 +1595,12 @@ hep_float_down(Heap_t *heap, integer_t index)
     if (index < 0)
         return false;
 
+    if (heap->kind == MinMaxHeap)
+    {
+        hep_minmax_down(heap, index);
+        return true;
+    }
+
     // Modifier here is very important because it defines if this heap is a
     // min-heap or a max-heap and it inverts the compare function output when
     // working with a min-heap.
@@ -637,29 +1609,27 @@ hep_float_down(Heap_t *heap, integer_t index)
     // Float down
     while (index < heap->count)
     {
-        integer_t L = hep_l(index); // Left
-        integer_t R = hep_r(index); // Right
-        integer_t C = index;        // Current (largest)
+        integer_t F = hep_c(heap, index); // First child
+        integer_t C = index;              // Current (largest)
 
-        // Check if both child nodes
-        if (L < heap->count &&
-            heap->interface->compare(heap->buffer[L], heap->buffer[C]) * mod > 0)
-        {
-            C = L;
-        }
+        integer_t last = F + heap->arity;
 
-        if (R < heap->count &&
-            heap->interface->compare(heap->buffer[R], heap->buffer[C]) * mod > 0)
+        if (last > heap->count)
+            last = heap->count;
+
+        // Check all child nodes
+        for (integer_t K = F; K < last; K++)
         {
-            C = R;
+            if (DS_STATS_COMPARE(heap, heap->buffer[K], heap->buffer[C]) * mod > 0)
+                C = K;
         }
 
         if (C != index)
         {
             // Swap index with C
-            void *tmp = heap->buffer[index];
-            heap->buffer[index] = heap->buffer[C];
-            heap->buffer[C] = tmp;
+            hep_swap(heap, index, C);
+
+            DS_STATS_ADD(heap, sifts, 1);
 
             index = C;
         }
@@ -670,13 +1640,188 @@ hep_float_down(Heap_t *heap, integer_t index)
     return true;
 }
 
+// Removes the element at a position, filling it with the last element
+static bool
+hep_remove_at(Heap_t *heap, integer_t position, void **result)
+{
+    *result = heap->buffer[position];
+
+    if (heap->positions)
+        hep_handle_release(heap, heap->handles[position]);
+
+    integer_t last = heap->count - 1;
+
+    if (position != last)
+        hep_move(heap, last, position);
+
+    heap->buffer[last] = NULL;
+    heap->count--;
+
+    if (position != last)
+        hep_fix(heap, position);
+
+    hep_shrink(heap);
+
+    return true;
+}
+
+// Position of the highest element of a MaxHeap or a MinMaxHeap that is not
+// empty
+static integer_t
+hep_max_position(Heap_t *heap)
+{
+    if (heap->kind == MaxHeap || heap->count == 1)
+        return 0;
+
+    if (heap->count == 2 || DS_STATS_COMPARE(heap, heap->buffer[1],
+            heap->buffer[2]) >= 0)
+        return 1;
+
+    return 2;
+}
+
+// The modifier of the level of a position in a min-max heap, like the kind
+// of a heap: -1 on min levels, 1 on max levels
+static integer_t
+hep_minmax_mod(integer_t index)
+{
+    integer_t depth = 0;
+
+    for (integer_t i = index + 1; i > 1; i >>= 1)
+        depth++;
+
+    return depth % 2 == 0 ? -1 : 1;
+}
+
+// Moves an element of a min-max heap that was changed, or added as a leaf,
+// to its place. If it belongs to the other kind of level it is swapped with
+// its parent first and the parent, which bounds the whole subtree, is floated
+// down in its place. Otherwise the element is floated up through its
+// grandparents or, if it did not move, down.
+static void
+hep_minmax_fix(Heap_t *heap, integer_t index)
+{
+    integer_t mod = hep_minmax_mod(index);
+
+    if (index > 0)
+    {
+        integer_t P = hep_p(heap, index);
+
+        if (DS_STATS_COMPARE(heap, heap->buffer[index], heap->buffer[P])
+            * mod < 0)
+        {
+            hep_swap(heap, index, P);
+
+            DS_STATS_ADD(heap, sifts, 1);
+
+            hep_minmax_down(heap, index);
+            hep_minmax_up(heap, P, -mod);
+
+            return;
+        }
+    }
+
+    if (!hep_minmax_up(heap, index, mod))
+        hep_minmax_down(heap, index);
+}
+
+// Floats an element up through its grandparents, which are on the same kind of
+// level. Returns true if it moved.
+static bool
+hep_minmax_up(Heap_t *heap, integer_t index, integer_t mod)
+{
+    bool moved = false;
+
+    while (index > 2)
+    {
+        integer_t G = hep_p(heap, hep_p(heap, index));
+
+        if (DS_STATS_COMPARE(heap, heap->buffer[index], heap->buffer[G])
+            * mod <= 0)
+            break;
+
+        hep_swap(heap, index, G);
+
+        DS_STATS_ADD(heap, sifts, 1);
+
+        index = G;
+        moved = true;
+    }
+
+    return moved;
+}
+
+// Floats an element down through its grandchildren. The most extreme of the
+// children and grandchildren takes its place; when it was a grandchild the
+// element might then belong above its new parent, on the other kind of level.
+static void
+hep_minmax_down(Heap_t *heap, integer_t index)
+{
+    integer_t mod = hep_minmax_mod(index);
+
+    while (index < heap->count)
+    {
+        integer_t F = hep_c(heap, index);
+
+        if (F >= heap->count)
+            break;
+
+        // The children and then the grandchildren, which are contiguous
+        integer_t M = F;
+        integer_t last = F + 1 < heap->count ? F + 1 : F;
+        integer_t G = hep_c(heap, F);
+        integer_t G_last = G + 3 < heap->count ? G + 3 : heap->count - 1;
+
+        if (DS_STATS_COMPARE(heap, heap->buffer[last], heap->buffer[M])
+            * mod > 0)
+            M = last;
+
+        for (integer_t K = G; K <= G_last; K++)
+        {
+            if (DS_STATS_COMPARE(heap, heap->buffer[K], heap->buffer[M])
+                * mod > 0)
+                M = K;
+        }
+
+        if (DS_STATS_COMPARE(heap, heap->buffer[M], heap->buffer[index])
+            * mod <= 0)
+            break;
+
+        hep_swap(heap, index, M);
+
+        DS_STATS_ADD(heap, sifts, 1);
+
+        // A child has no children left to check
+        if (M < G)
+            break;
+
+        integer_t P = hep_p(heap, M);
+
+        if (DS_STATS_COMPARE(heap, heap->buffer[M], heap->buffer[P])
+            * mod < 0)
+        {
+            hep_swap(heap, M, P);
+
+            DS_STATS_ADD(heap, sifts, 1);
+        }
+
+        index = M;
+    }
+}
+
+#ifndef DS_NO_DISPLAY
 void
 hep_display_tree(Heap_t *heap, integer_t index, integer_t height)
 {
     if (index >= heap->count || index < 0)
         return;
 
-    hep_display_tree(heap, hep_r(index), height + 1);
+    integer_t first = hep_c(heap, index);
+    integer_t middle = first + heap->arity / 2;
+
+    // The later half of the children is displayed above the node
+    for (integer_t K = first + heap->arity - 1; K >= middle; K--)
+        hep_display_tree(heap, K, height + 1);
 
     for (integer_t i = 0; i < height; i++)
         printf("|------- ");
@@ -684,8 +1829,10 @@ hep_display_tree(Heap_t *heap, integer_t index, integer_t height)
     heap->interface->display(heap->buffer[index]);
     printf("\n");
 
-    hep_display_tree(heap, hep_l(index), height + 1);
+    for (integer_t K = middle - 1; K >= first; K--)
+        hep_display_tree(heap, K, height + 1);
 }
+#endif
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -0,0 +1,262 @@
+/**
+ * @file InternTable.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "InternTable.h"
+#include "HashMap.h"
+#include <stddef.h>
+
+/// An InternTable_s keeps a single copy of each string added to it. Interning
+/// a string returns a pointer to that copy, so two interned strings are equal
+/// if and only if they are the same pointer. Copies are found through a
+/// HashMap_s and allocated from an Arena_s, so they are never freed one by
+/// one; they all live until the arena is freed.
+///
+/// Each copy is stored after an InternString_s header with its hash and
+/// length, so itn_hash() and itn_length() take constant time and interned
+/// strings can be used as keys of other hash maps without hashing them
+/// again.
+///
+/// \par Functions
+/// Located in the file InternTable.c
+struct InternTable_s
+{
+    /// \brief Maps each string to its canonical copy.
+    HashMap_t *map;
+
+    /// \brief Interface of the strings in the map.
+    ///
+    /// Hashes and compares the characters, not the pointers, so strings that
+    /// are not interned yet can be looked up.
+    struct Interface_s interface;
+
+    /// \brief Where the copies are allocated.
+    Arena_t *arena;
+
+    /// \brief If the arena was created by the table and is freed with it.
+    bool owns_arena;
+};
+
+/// \brief Header of an interned string.
+///
+/// Implementation detail. The characters follow it in the same allocation.
+struct InternString_s
+{
+    /// \brief Hash of the characters.
+    unsigned_t hash;
+
+    /// \brief Amount of characters, not counting the '\0'.
+    integer_t length;
+
+    /// \brief The null-terminated characters.
+    char chars[];
+};
+
+typedef struct InternString_s InternString_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static InternString_t *
+itn_header(const void *interned);
+
+static unsigned_t
+itn_hash_chars(const void *string);
+
+static int
+itn_compare_chars(const void *string1, const void *string2);
+
+static void
+itn_keep(void *element);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new InternTable_s.
+///
+/// \param[in] arena Where the interned strings are allocated. They are valid
+/// until the arena is freed or reset, which has to happen after the table is
+/// freed. If NULL the table creates its own arena and frees it in itn_free().
+///
+/// \return A new InternTable_s or NULL if allocation failed.
+InternTable_t *
+itn_new(Arena_t *arena)
+{
+    InternTable_t *table = malloc(sizeof(InternTable_t));
+
+    if (!table)
+        return NULL;
+
+    interface_init(&table->interface, itn_compare_chars, NULL, NULL,
+                   itn_keep, itn_hash_chars, NULL);
+
+    table->map = hmp_new(&table->interface, &table->interface);
+
+    table->owns_arena = arena == NULL;
+    table->arena = arena ? arena : arn_new(4096);
+
+    if (!table->map || !table->arena)
+    {
+        if (table->map)
+            hmp_free_shallow(table->map);
+
+        if (table->owns_arena && table->arena)
+            arn_free(table->arena);
+
+        free(table);
+
+        return NULL;
+    }
+
+    return table;
+}
+
+/// Frees from memory an InternTable_s. Its strings are freed too if the
+/// table created its own arena.
+///
+/// \param[in] table The intern table to be freed from memory.
+void
+itn_free(InternTable_t *table)
+{
+    hmp_free_shallow(table->map);
+
+    if (table->owns_arena)
+        arn_free(table->arena);
+
+    free(table);
+}
+
+/// \param[in] table The intern table.
+///
+/// \return The amount of different strings interned.
+integer_t
+itn_count(InternTable_t *table)
+{
+    return hmp_count(table->map);
+}
+
+/// Returns the canonical copy of a string. The first time a string is
+/// interned it is copied to the table's arena.
+///
+/// \param[in] table The intern table.
+/// \param[in] string A null-terminated string.
+///
+/// \return The canonical copy of the string or NULL if allocation failed.
+const char *
+itn_intern(InternTable_t *table, const char *string)
+{
+    const char *interned = hmp_get(table->map, (void *)string);
+
+    if (interned)
+        return interned;
+
+    size_t length = strlen(string);
+
+    InternString_t *header = arn_alloc(table->arena,
+            sizeof(InternString_t) + length + 1);
+
+    if (!header)
+        return NULL;
+
+    header->hash = itn_hash_chars(string);
+    header->length = (integer_t)length;
+
+    memcpy(header->chars, string, length + 1);
+
+    // The arena has no way to give back the copy
+    if (!hmp_insert(table->map, header->chars, header->chars))
+        return NULL;
+
+    return header->chars;
+}
+
+/// \param[in] table The intern table.
+/// \param[in] string A null-terminated string.
+///
+/// \return The canonical copy of the string or NULL if it was never interned.
+const char *
+itn_lookup(InternTable_t *table, const char *string)
+{
+    return hmp_get(table->map, (void *)string);
+}
+
+/// \param[in] interned A string returned by itn_intern().
+///
+/// \return The length of the string.
+integer_t
+itn_length(const char *interned)
+{
+    return itn_header(interned)->length;
+}
+
+/// A \ref hash_f for strings returned by itn_intern(). The hash was computed
+/// when the string was interned.
+///
+/// \param[in] interned A string returned by itn_intern().
+///
+/// \return The hash of the string.
+unsigned_t
+itn_hash(const void *interned)
+{
+    return itn_header(interned)->hash;
+}
+
+/// A \ref compare_f for strings returned by itn_intern() from the same
+/// table. Equal strings are the same pointer and are compared in constant
+/// time; different strings are ordered by their characters.
+///
+/// \param[in] interned1 A string returned by itn_intern().
+/// \param[in] interned2 A string returned by itn_intern().
+///
+/// \return An int with the same meaning as the one returned by strcmp().
+int
+itn_compare(const void *interned1, const void *interned2)
+{
+    if (interned1 == interned2)
+        return 0;
+
+    return strcmp(interned1, interned2);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static InternString_t *
+itn_header(const void *interned)
+{
+    return (InternString_t *)((char *)interned
+                              - offsetof(InternString_t, chars));
+}
+
+// FNV-1a
+static unsigned_t
+itn_hash_chars(const void *string)
+{
+    const unsigned char *chars = string;
+
+    uint64_t hash = UINT64_C(14695981039346656037);
+
+    while (*chars)
+    {
+        hash ^= *chars++;
+        hash *= UINT64_C(1099511628211);
+    }
+
+    return (unsigned_t)hash;
+}
+
+static int
+itn_compare_chars(const void *string1, const void *string2)
+{
+    return strcmp(string1, string2);
+}
+
+// The strings belong to the arena
+static void
+itn_keep(void *element)
+{
+    (void)element;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
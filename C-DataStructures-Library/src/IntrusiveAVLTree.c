@@ -0,0 +1,468 @@
+/**
+ * @file IntrusiveAVLTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "IntrusiveAVLTree.h"
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static AVLHook_t *
+iav_hook(IntrusiveAVLTree_t *tree, void *element);
+
+static void *
+iav_element(IntrusiveAVLTree_t *tree, AVLHook_t *hook);
+
+static int8_t
+iav_height(AVLHook_t *hook);
+
+static void
+iav_height_update(AVLHook_t *hook);
+
+static AVLHook_t *
+iav_rotate_left(IntrusiveAVLTree_t *tree, AVLHook_t *X);
+
+static AVLHook_t *
+iav_rotate_right(IntrusiveAVLTree_t *tree, AVLHook_t *X);
+
+static void
+iav_transplant(IntrusiveAVLTree_t *tree, AVLHook_t *U, AVLHook_t *V);
+
+static void
+iav_rebalance(IntrusiveAVLTree_t *tree, AVLHook_t *hook);
+
+static AVLHook_t *
+iav_minimum(AVLHook_t *hook);
+
+static AVLHook_t *
+iav_maximum(AVLHook_t *hook);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes an empty tree. Elements are linked through an AVLHook_s at
+/// \c offset bytes from their start, usually given with offsetof(), and are
+/// ordered by \c compare.
+///
+/// \param[in] tree The tree to be initialized.
+/// \param[in] offset Offset of the AVLHook_s inside the elements.
+/// \param[in] compare A function that compares two elements.
+void
+iav_init(IntrusiveAVLTree_t *tree, size_t offset, compare_f compare)
+{
+    tree->root = NULL;
+    tree->count = 0;
+    tree->offset = offset;
+    tree->compare = compare;
+}
+
+/// Unlinks every element so they can be inserted in another tree. The
+/// elements themselves are not changed and their hooks are left as they are.
+///
+/// \param[in] tree The tree to be cleared.
+void
+iav_clear(IntrusiveAVLTree_t *tree)
+{
+    tree->root = NULL;
+    tree->count = 0;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The amount of elements in the tree.
+integer_t
+iav_count(IntrusiveAVLTree_t *tree)
+{
+    return tree->count;
+}
+
+/// Links an element to the tree. No memory is allocated. The element can't be
+/// in any tree that uses the same hook.
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be linked.
+///
+/// \return False if an equal element is already in the tree.
+bool
+iav_insert(IntrusiveAVLTree_t *tree, void *element)
+{
+    AVLHook_t *parent = NULL, *scan = tree->root;
+
+    int comparison = 0;
+
+    while (scan != NULL)
+    {
+        parent = scan;
+
+        comparison = tree->compare(element, iav_element(tree, scan));
+
+        if (comparison < 0)
+            scan = scan->left;
+        else if (comparison > 0)
+            scan = scan->right;
+        else
+            return false;
+    }
+
+    AVLHook_t *hook = iav_hook(tree, element);
+
+    hook->parent = parent;
+    hook->left = NULL;
+    hook->right = NULL;
+    hook->height = 1;
+
+    if (parent == NULL)
+        tree->root = hook;
+    else if (comparison < 0)
+        parent->left = hook;
+    else
+        parent->right = hook;
+
+    iav_rebalance(tree, parent);
+
+    tree->count++;
+
+    return true;
+}
+
+/// Unlinks an element without searching for it. The element must be in the
+/// tree.
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be unlinked.
+void
+iav_remove(IntrusiveAVLTree_t *tree, void *element)
+{
+    AVLHook_t *Z = iav_hook(tree, element);
+
+    // Lowest hook whose height might have changed
+    AVLHook_t *start;
+
+    if (Z->left == NULL)
+    {
+        start = Z->parent;
+
+        iav_transplant(tree, Z, Z->right);
+    }
+    else if (Z->right == NULL)
+    {
+        start = Z->parent;
+
+        iav_transplant(tree, Z, Z->left);
+    }
+    else
+    {
+        // Z is replaced by its successor
+        AVLHook_t *Y = iav_minimum(Z->right);
+
+        if (Y->parent == Z)
+            start = Y;
+        else
+        {
+            start = Y->parent;
+
+            iav_transplant(tree, Y, Y->right);
+
+            Y->right = Z->right;
+            Y->right->parent = Y;
+        }
+
+        iav_transplant(tree, Z, Y);
+
+        Y->left = Z->left;
+        Y->left->parent = Y;
+        Y->height = Z->height;
+    }
+
+    iav_rebalance(tree, start);
+
+    Z->parent = NULL;
+    Z->left = NULL;
+    Z->right = NULL;
+
+    tree->count--;
+}
+
+/// Unlinks the smallest element, like when the earliest timer expires.
+///
+/// \param[in] tree The tree.
+///
+/// \return The element that was unlinked or NULL if the tree is empty.
+void *
+iav_remove_min(IntrusiveAVLTree_t *tree)
+{
+    void *element = iav_min(tree);
+
+    if (element != NULL)
+        iav_remove(tree, element);
+
+    return element;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return True if the tree has no elements.
+bool
+iav_empty(IntrusiveAVLTree_t *tree)
+{
+    return tree->count == 0;
+}
+
+/// The key is compared to the elements with the tree's compare function, so
+/// it is usually a stack variable of the element's type with only the fields
+/// that are compared filled in.
+///
+/// \param[in] tree The tree.
+/// \param[in] key The key to be searched.
+///
+/// \return The element equal to the key or NULL if there is none.
+void *
+iav_search(IntrusiveAVLTree_t *tree, const void *key)
+{
+    AVLHook_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = tree->compare(key, iav_element(tree, scan));
+
+        if (comparison < 0)
+            scan = scan->left;
+        else if (comparison > 0)
+            scan = scan->right;
+        else
+            return iav_element(tree, scan);
+    }
+
+    return NULL;
+}
+
+/// \param[in] tree The tree.
+/// \param[in] key The key to be searched.
+///
+/// \return The first element not less than the key or NULL if there is none.
+void *
+iav_lower_bound(IntrusiveAVLTree_t *tree, const void *key)
+{
+    AVLHook_t *scan = tree->root, *result = NULL;
+
+    while (scan != NULL)
+    {
+        if (tree->compare(iav_element(tree, scan), key) >= 0)
+        {
+            result = scan;
+            scan = scan->left;
+        }
+        else
+            scan = scan->right;
+    }
+
+    return result == NULL ? NULL : iav_element(tree, result);
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The smallest element or NULL if the tree is empty.
+void *
+iav_min(IntrusiveAVLTree_t *tree)
+{
+    if (tree->root == NULL)
+        return NULL;
+
+    return iav_element(tree, iav_minimum(tree->root));
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The greatest element or NULL if the tree is empty.
+void *
+iav_max(IntrusiveAVLTree_t *tree)
+{
+    if (tree->root == NULL)
+        return NULL;
+
+    return iav_element(tree, iav_maximum(tree->root));
+}
+
+/// \param[in] tree The tree.
+/// \param[in] element An element of the tree.
+///
+/// \return The element after the given one or NULL if it is the last one.
+void *
+iav_next(IntrusiveAVLTree_t *tree, void *element)
+{
+    AVLHook_t *hook = iav_hook(tree, element);
+
+    if (hook->right != NULL)
+        return iav_element(tree, iav_minimum(hook->right));
+
+    AVLHook_t *parent = hook->parent;
+
+    while (parent != NULL && hook == parent->right)
+    {
+        hook = parent;
+        parent = parent->parent;
+    }
+
+    return parent == NULL ? NULL : iav_element(tree, parent);
+}
+
+/// \param[in] tree The tree.
+/// \param[in] element An element of the tree.
+///
+/// \return The element before the given one or NULL if it is the first one.
+void *
+iav_prev(IntrusiveAVLTree_t *tree, void *element)
+{
+    AVLHook_t *hook = iav_hook(tree, element);
+
+    if (hook->left != NULL)
+        return iav_element(tree, iav_maximum(hook->left));
+
+    AVLHook_t *parent = hook->parent;
+
+    while (parent != NULL && hook == parent->left)
+    {
+        hook = parent;
+        parent = parent->parent;
+    }
+
+    return parent == NULL ? NULL : iav_element(tree, parent);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static AVLHook_t *
+iav_hook(IntrusiveAVLTree_t *tree, void *element)
+{
+    return (AVLHook_t *)((char *)element + tree->offset);
+}
+
+static void *
+iav_element(IntrusiveAVLTree_t *tree, AVLHook_t *hook)
+{
+    return (char *)hook - tree->offset;
+}
+
+static int8_t
+iav_height(AVLHook_t *hook)
+{
+    return hook == NULL ? 0 : hook->height;
+}
+
+static void
+iav_height_update(AVLHook_t *hook)
+{
+    int8_t left = iav_height(hook->left), right = iav_height(hook->right);
+
+    hook->height = (int8_t)((left > right ? left : right) + 1);
+}
+
+// Returns the new root of the subtree
+static AVLHook_t *
+iav_rotate_left(IntrusiveAVLTree_t *tree, AVLHook_t *X)
+{
+    AVLHook_t *Y = X->right;
+
+    X->right = Y->left;
+
+    if (Y->left != NULL)
+        Y->left->parent = X;
+
+    iav_transplant(tree, X, Y);
+
+    Y->left = X;
+    X->parent = Y;
+
+    iav_height_update(X);
+    iav_height_update(Y);
+
+    return Y;
+}
+
+// Returns the new root of the subtree
+static AVLHook_t *
+iav_rotate_right(IntrusiveAVLTree_t *tree, AVLHook_t *X)
+{
+    AVLHook_t *Y = X->left;
+
+    X->left = Y->right;
+
+    if (Y->right != NULL)
+        Y->right->parent = X;
+
+    iav_transplant(tree, X, Y);
+
+    Y->right = X;
+    X->parent = Y;
+
+    iav_height_update(X);
+    iav_height_update(Y);
+
+    return Y;
+}
+
+// Puts V in the place of U under U's parent
+static void
+iav_transplant(IntrusiveAVLTree_t *tree, AVLHook_t *U, AVLHook_t *V)
+{
+    if (U->parent == NULL)
+        tree->root = V;
+    else if (U == U->parent->left)
+        U->parent->left = V;
+    else
+        U->parent->right = V;
+
+    if (V != NULL)
+        V->parent = U->parent;
+}
+
+// Fixes heights and balance from a hook up to the root
+static void
+iav_rebalance(IntrusiveAVLTree_t *tree, AVLHook_t *hook)
+{
+    while (hook != NULL)
+    {
+        iav_height_update(hook);
+
+        int balance = iav_height(hook->left) - iav_height(hook->right);
+
+        if (balance > 1)
+        {
+            if (iav_height(hook->left->left) < iav_height(hook->left->right))
+                iav_rotate_left(tree, hook->left);
+
+            hook = iav_rotate_right(tree, hook);
+        }
+        else if (balance < -1)
+        {
+            if (iav_height(hook->right->right) < iav_height(hook->right->left))
+                iav_rotate_right(tree, hook->right);
+
+            hook = iav_rotate_left(tree, hook);
+        }
+
+        hook = hook->parent;
+    }
+}
+
+static AVLHook_t *
+iav_minimum(AVLHook_t *hook)
+{
+    while (hook->left != NULL)
+        hook = hook->left;
+
+    return hook;
+}
+
+static AVLHook_t *
+iav_maximum(AVLHook_t *hook)
+{
+    while (hook->right != NULL)
+        hook = hook->right;
+
+    return hook;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,322 @@
+/**
+ * @file IntrusiveList.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "IntrusiveList.h"
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static ListHook_t *
+ilt_hook(IntrusiveList_t *list, void *element);
+
+static void *
+ilt_element(IntrusiveList_t *list, ListHook_t *hook);
+
+static void
+ilt_link(ListHook_t *prev, ListHook_t *hook, ListHook_t *next);
+
+static void
+ilt_unlink(ListHook_t *hook);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes an empty list. Elements are linked through a ListHook_s at
+/// \c offset bytes from their start, usually given with offsetof().
+///
+/// \param[in] list The list to be initialized.
+/// \param[in] offset Offset of the ListHook_s inside the elements.
+void
+ilt_init(IntrusiveList_t *list, size_t offset)
+{
+    list->head.next = &list->head;
+    list->head.prev = &list->head;
+    list->count = 0;
+    list->offset = offset;
+}
+
+/// Unlinks every element so they can be inserted in another list. The
+/// elements themselves are not changed.
+///
+/// \param[in] list The list to be cleared.
+void
+ilt_clear(IntrusiveList_t *list)
+{
+    while (!ilt_empty(list))
+        ilt_remove_head(list);
+}
+
+/// \param[in] list The list.
+///
+/// \return The amount of elements in the list.
+integer_t
+ilt_count(IntrusiveList_t *list)
+{
+    return list->count;
+}
+
+/// Links an element at the start of the list. The element can't be in any
+/// list that uses the same hook.
+///
+/// \param[in] list The list.
+/// \param[in] element The element to be linked.
+void
+ilt_insert_head(IntrusiveList_t *list, void *element)
+{
+    ilt_link(&list->head, ilt_hook(list, element), list->head.next);
+
+    list->count++;
+}
+
+/// Links an element at the end of the list. The element can't be in any list
+/// that uses the same hook.
+///
+/// \param[in] list The list.
+/// \param[in] element The element to be linked.
+void
+ilt_insert_tail(IntrusiveList_t *list, void *element)
+{
+    ilt_link(list->head.prev, ilt_hook(list, element), &list->head);
+
+    list->count++;
+}
+
+/// \param[in] list The list.
+/// \param[in] position An element of the list.
+/// \param[in] element The element to be linked before position.
+void
+ilt_insert_before(IntrusiveList_t *list, void *position, void *element)
+{
+    ListHook_t *next = ilt_hook(list, position);
+
+    ilt_link(next->prev, ilt_hook(list, element), next);
+
+    list->count++;
+}
+
+/// \param[in] list The list.
+/// \param[in] position An element of the list.
+/// \param[in] element The element to be linked after position.
+void
+ilt_insert_after(IntrusiveList_t *list, void *position, void *element)
+{
+    ListHook_t *prev = ilt_hook(list, position);
+
+    ilt_link(prev, ilt_hook(list, element), prev->next);
+
+    list->count++;
+}
+
+/// Unlinks an element in constant time. The element must be in the list.
+///
+/// \param[in] list The list.
+/// \param[in] element The element to be unlinked.
+void
+ilt_remove(IntrusiveList_t *list, void *element)
+{
+    ilt_unlink(ilt_hook(list, element));
+
+    list->count--;
+}
+
+/// \param[in] list The list.
+///
+/// \return The element that was unlinked or NULL if the list is empty.
+void *
+ilt_remove_head(IntrusiveList_t *list)
+{
+    if (ilt_empty(list))
+        return NULL;
+
+    ListHook_t *hook = list->head.next;
+
+    ilt_unlink(hook);
+
+    list->count--;
+
+    return ilt_element(list, hook);
+}
+
+/// \param[in] list The list.
+///
+/// \return The element that was unlinked or NULL if the list is empty.
+void *
+ilt_remove_tail(IntrusiveList_t *list)
+{
+    if (ilt_empty(list))
+        return NULL;
+
+    ListHook_t *hook = list->head.prev;
+
+    ilt_unlink(hook);
+
+    list->count--;
+
+    return ilt_element(list, hook);
+}
+
+/// Moves an element of the list to its start, like when an entry of a LRU
+/// cache is used.
+///
+/// \param[in] list The list.
+/// \param[in] element An element of the list.
+void
+ilt_move_head(IntrusiveList_t *list, void *element)
+{
+    ListHook_t *hook = ilt_hook(list, element);
+
+    ilt_unlink(hook);
+    ilt_link(&list->head, hook, list->head.next);
+}
+
+/// \param[in] list The list.
+/// \param[in] element An element of the list.
+void
+ilt_move_tail(IntrusiveList_t *list, void *element)
+{
+    ListHook_t *hook = ilt_hook(list, element);
+
+    ilt_unlink(hook);
+    ilt_link(list->head.prev, hook, &list->head);
+}
+
+/// \param[in] list The list.
+///
+/// \return True if the list has no elements.
+bool
+ilt_empty(IntrusiveList_t *list)
+{
+    return list->count == 0;
+}
+
+/// Checks if an element is in a list that uses the same hook. Its hook must
+/// have been zero initialized before it was first inserted.
+///
+/// \param[in] list A list that uses the element's hook.
+/// \param[in] element The element to be checked.
+///
+/// \return True if the element is linked.
+bool
+ilt_linked(IntrusiveList_t *list, void *element)
+{
+    return ilt_hook(list, element)->next != NULL;
+}
+
+/// \param[in] list The list.
+///
+/// \return The first element or NULL if the list is empty.
+void *
+ilt_head(IntrusiveList_t *list)
+{
+    if (ilt_empty(list))
+        return NULL;
+
+    return ilt_element(list, list->head.next);
+}
+
+/// \param[in] list The list.
+///
+/// \return The last element or NULL if the list is empty.
+void *
+ilt_tail(IntrusiveList_t *list)
+{
+    if (ilt_empty(list))
+        return NULL;
+
+    return ilt_element(list, list->head.prev);
+}
+
+/// \param[in] list The list.
+/// \param[in] element An element of the list.
+///
+/// \return The element after the given one or NULL if it is the last one.
+void *
+ilt_next(IntrusiveList_t *list, void *element)
+{
+    ListHook_t *next = ilt_hook(list, element)->next;
+
+    if (next == &list->head)
+        return NULL;
+
+    return ilt_element(list, next);
+}
+
+/// \param[in] list The list.
+/// \param[in] element An element of the list.
+///
+/// \return The element before the given one or NULL if it is the first one.
+void *
+ilt_prev(IntrusiveList_t *list, void *element)
+{
+    ListHook_t *prev = ilt_hook(list, element)->prev;
+
+    if (prev == &list->head)
+        return NULL;
+
+    return ilt_element(list, prev);
+}
+
+/// Moves every element of list2 to the end of list1 in constant time,
+/// leaving list2 empty. Both lists must use the same hook.
+///
+/// \param[in] list1 The list where the elements are appended.
+/// \param[in] list2 The list to be emptied.
+void
+ilt_append(IntrusiveList_t *list1, IntrusiveList_t *list2)
+{
+    if (list1 == list2 || ilt_empty(list2))
+        return;
+
+    ListHook_t *first = list2->head.next;
+    ListHook_t *last = list2->head.prev;
+
+    first->prev = list1->head.prev;
+    list1->head.prev->next = first;
+
+    last->next = &list1->head;
+    list1->head.prev = last;
+
+    list1->count += list2->count;
+
+    ilt_init(list2, list2->offset);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static ListHook_t *
+ilt_hook(IntrusiveList_t *list, void *element)
+{
+    return (ListHook_t *)((char *)element + list->offset);
+}
+
+static void *
+ilt_element(IntrusiveList_t *list, ListHook_t *hook)
+{
+    return (char *)hook - list->offset;
+}
+
+static void
+ilt_link(ListHook_t *prev, ListHook_t *hook, ListHook_t *next)
+{
+    hook->prev = prev;
+    hook->next = next;
+
+    prev->next = hook;
+    next->prev = hook;
+}
+
+// Unlinks a hook and clears it so ilt_linked() returns false
+static void
+ilt_unlink(ListHook_t *hook)
+{
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+
+    hook->next = NULL;
+    hook->prev = NULL;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,592 @@
+/**
+ * @file IntrusiveRedBlackTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "IntrusiveRedBlackTree.h"
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static RBHook_t *
+irb_hook(IntrusiveRedBlackTree_t *tree, void *element);
+
+static void *
+irb_element(IntrusiveRedBlackTree_t *tree, RBHook_t *hook);
+
+static bool
+irb_is_red(RBHook_t *hook);
+
+static void
+irb_rotate_left(IntrusiveRedBlackTree_t *tree, RBHook_t *X);
+
+static void
+irb_rotate_right(IntrusiveRedBlackTree_t *tree, RBHook_t *X);
+
+static void
+irb_transplant(IntrusiveRedBlackTree_t *tree, RBHook_t *U, RBHook_t *V);
+
+static void
+irb_insert_fixup(IntrusiveRedBlackTree_t *tree, RBHook_t *Z);
+
+static void
+irb_remove_fixup(IntrusiveRedBlackTree_t *tree, RBHook_t *X,
+                 RBHook_t *parent);
+
+static RBHook_t *
+irb_minimum(RBHook_t *hook);
+
+static RBHook_t *
+irb_maximum(RBHook_t *hook);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes an empty tree. Elements are linked through a RBHook_s at
+/// \c offset bytes from their start, usually given with offsetof(), and are
+/// ordered by \c compare.
+///
+/// \param[in] tree The tree to be initialized.
+/// \param[in] offset Offset of the RBHook_s inside the elements.
+/// \param[in] compare A function that compares two elements.
+void
+irb_init(IntrusiveRedBlackTree_t *tree, size_t offset, compare_f compare)
+{
+    tree->root = NULL;
+    tree->count = 0;
+    tree->offset = offset;
+    tree->compare = compare;
+}
+
+/// Unlinks every element so they can be inserted in another tree. The
+/// elements themselves are not changed and their hooks are left as they are.
+///
+/// \param[in] tree The tree to be cleared.
+void
+irb_clear(IntrusiveRedBlackTree_t *tree)
+{
+    tree->root = NULL;
+    tree->count = 0;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The amount of elements in the tree.
+integer_t
+irb_count(IntrusiveRedBlackTree_t *tree)
+{
+    return tree->count;
+}
+
+/// Links an element to the tree. No memory is allocated. The element can't be
+/// in any tree that uses the same hook.
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be linked.
+///
+/// \return False if an equal element is already in the tree.
+bool
+irb_insert(IntrusiveRedBlackTree_t *tree, void *element)
+{
+    RBHook_t *parent = NULL, *scan = tree->root;
+
+    int comparison = 0;
+
+    while (scan != NULL)
+    {
+        parent = scan;
+
+        comparison = tree->compare(element, irb_element(tree, scan));
+
+        if (comparison < 0)
+            scan = scan->left;
+        else if (comparison > 0)
+            scan = scan->right;
+        else
+            return false;
+    }
+
+    RBHook_t *hook = irb_hook(tree, element);
+
+    hook->parent = parent;
+    hook->left = NULL;
+    hook->right = NULL;
+    hook->red = true;
+
+    if (parent == NULL)
+        tree->root = hook;
+    else if (comparison < 0)
+        parent->left = hook;
+    else
+        parent->right = hook;
+
+    irb_insert_fixup(tree, hook);
+
+    tree->count++;
+
+    return true;
+}
+
+/// Unlinks an element without searching for it. The element must be in the
+/// tree.
+///
+/// \param[in] tree The tree.
+/// \param[in] element The element to be unlinked.
+void
+irb_remove(IntrusiveRedBlackTree_t *tree, void *element)
+{
+    RBHook_t *Z = irb_hook(tree, element);
+    RBHook_t *Y = Z, *X, *parent;
+
+    bool removed_red = Y->red;
+
+    if (Z->left == NULL)
+    {
+        X = Z->right;
+        parent = Z->parent;
+
+        irb_transplant(tree, Z, Z->right);
+    }
+    else if (Z->right == NULL)
+    {
+        X = Z->left;
+        parent = Z->parent;
+
+        irb_transplant(tree, Z, Z->left);
+    }
+    else
+    {
+        // Z is replaced by its successor
+        Y = irb_minimum(Z->right);
+
+        removed_red = Y->red;
+
+        X = Y->right;
+
+        if (Y->parent == Z)
+            parent = Y;
+        else
+        {
+            parent = Y->parent;
+
+            irb_transplant(tree, Y, Y->right);
+
+            Y->right = Z->right;
+            Y->right->parent = Y;
+        }
+
+        irb_transplant(tree, Z, Y);
+
+        Y->left = Z->left;
+        Y->left->parent = Y;
+        Y->red = Z->red;
+    }
+
+    if (!removed_red)
+        irb_remove_fixup(tree, X, parent);
+
+    Z->parent = NULL;
+    Z->left = NULL;
+    Z->right = NULL;
+
+    tree->count--;
+}
+
+/// Unlinks the smallest element, like when the earliest timer expires.
+///
+/// \param[in] tree The tree.
+///
+/// \return The element that was unlinked or NULL if the tree is empty.
+void *
+irb_remove_min(IntrusiveRedBlackTree_t *tree)
+{
+    void *element = irb_min(tree);
+
+    if (element != NULL)
+        irb_remove(tree, element);
+
+    return element;
+}
+
+/// \param[in] tree The tree.
+///
+/// \return True if the tree has no elements.
+bool
+irb_empty(IntrusiveRedBlackTree_t *tree)
+{
+    return tree->count == 0;
+}
+
+/// The key is compared to the elements with the tree's compare function, so
+/// it is usually a stack variable of the element's type with only the fields
+/// that are compared filled in.
+///
+/// \param[in] tree The tree.
+/// \param[in] key The key to be searched.
+///
+/// \return The element equal to the key or NULL if there is none.
+void *
+irb_search(IntrusiveRedBlackTree_t *tree, const void *key)
+{
+    RBHook_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = tree->compare(key, irb_element(tree, scan));
+
+        if (comparison < 0)
+            scan = scan->left;
+        else if (comparison > 0)
+            scan = scan->right;
+        else
+            return irb_element(tree, scan);
+    }
+
+    return NULL;
+}
+
+/// \param[in] tree The tree.
+/// \param[in] key The key to be searched.
+///
+/// \return The first element not less than the key or NULL if there is none.
+void *
+irb_lower_bound(IntrusiveRedBlackTree_t *tree, const void *key)
+{
+    RBHook_t *scan = tree->root, *result = NULL;
+
+    while (scan != NULL)
+    {
+        if (tree->compare(irb_element(tree, scan), key) >= 0)
+        {
+            result = scan;
+            scan = scan->left;
+        }
+        else
+            scan = scan->right;
+    }
+
+    return result == NULL ? NULL : irb_element(tree, result);
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The smallest element or NULL if the tree is empty.
+void *
+irb_min(IntrusiveRedBlackTree_t *tree)
+{
+    if (tree->root == NULL)
+        return NULL;
+
+    return irb_element(tree, irb_minimum(tree->root));
+}
+
+/// \param[in] tree The tree.
+///
+/// \return The greatest element or NULL if the tree is empty.
+void *
+irb_max(IntrusiveRedBlackTree_t *tree)
+{
+    if (tree->root == NULL)
+        return NULL;
+
+    return irb_element(tree, irb_maximum(tree->root));
+}
+
+/// \param[in] tree The tree.
+/// \param[in] element An element of the tree.
+///
+/// \return The element after the given one or NULL if it is the last one.
+void *
+irb_next(IntrusiveRedBlackTree_t *tree, void *element)
+{
+    RBHook_t *hook = irb_hook(tree, element);
+
+    if (hook->right != NULL)
+        return irb_element(tree, irb_minimum(hook->right));
+
+    RBHook_t *parent = hook->parent;
+
+    while (parent != NULL && hook == parent->right)
+    {
+        hook = parent;
+        parent = parent->parent;
+    }
+
+    return parent == NULL ? NULL : irb_element(tree, parent);
+}
+
+/// \param[in] tree The tree.
+/// \param[in] element An element of the tree.
+///
+/// \return The element before the given one or NULL if it is the first one.
+void *
+irb_prev(IntrusiveRedBlackTree_t *tree, void *element)
+{
+    RBHook_t *hook = irb_hook(tree, element);
+
+    if (hook->left != NULL)
+        return irb_element(tree, irb_maximum(hook->left));
+
+    RBHook_t *parent = hook->parent;
+
+    while (parent != NULL && hook == parent->left)
+    {
+        hook = parent;
+        parent = parent->parent;
+    }
+
+    return parent == NULL ? NULL : irb_element(tree, parent);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static RBHook_t *
+irb_hook(IntrusiveRedBlackTree_t *tree, void *element)
+{
+    return (RBHook_t *)((char *)element + tree->offset);
+}
+
+static void *
+irb_element(IntrusiveRedBlackTree_t *tree, RBHook_t *hook)
+{
+    return (char *)hook - tree->offset;
+}
+
+// NULL leaves are black
+static bool
+irb_is_red(RBHook_t *hook)
+{
+    return hook != NULL && hook->red;
+}
+
+static void
+irb_rotate_left(IntrusiveRedBlackTree_t *tree, RBHook_t *X)
+{
+    RBHook_t *Y = X->right;
+
+    X->right = Y->left;
+
+    if (Y->left != NULL)
+        Y->left->parent = X;
+
+    irb_transplant(tree, X, Y);
+
+    Y->left = X;
+    X->parent = Y;
+}
+
+static void
+irb_rotate_right(IntrusiveRedBlackTree_t *tree, RBHook_t *X)
+{
+    RBHook_t *Y = X->left;
+
+    X->left = Y->right;
+
+    if (Y->right != NULL)
+        Y->right->parent = X;
+
+    irb_transplant(tree, X, Y);
+
+    Y->right = X;
+    X->parent = Y;
+}
+
+// Puts V in the place of U under U's parent
+static void
+irb_transplant(IntrusiveRedBlackTree_t *tree, RBHook_t *U, RBHook_t *V)
+{
+    if (U->parent == NULL)
+        tree->root = V;
+    else if (U == U->parent->left)
+        U->parent->left = V;
+    else
+        U->parent->right = V;
+
+    if (V != NULL)
+        V->parent = U->parent;
+}
+
+static void
+irb_insert_fixup(IntrusiveRedBlackTree_t *tree, RBHook_t *Z)
+{
+    while (irb_is_red(Z->parent))
+    {
+        RBHook_t *P = Z->parent;
+        RBHook_t *G = P->parent;
+
+        if (P == G->left)
+        {
+            RBHook_t *U = G->right;
+
+            if (irb_is_red(U))
+            {
+                P->red = false;
+                U->red = false;
+                G->red = true;
+
+                Z = G;
+            }
+            else
+            {
+                if (Z == P->right)
+                {
+                    Z = P;
+                    irb_rotate_left(tree, Z);
+                    P = Z->parent;
+                }
+
+                P->red = false;
+                G->red = true;
+
+                irb_rotate_right(tree, G);
+            }
+        }
+        else
+        {
+            RBHook_t *U = G->left;
+
+            if (irb_is_red(U))
+            {
+                P->red = false;
+                U->red = false;
+                G->red = true;
+
+                Z = G;
+            }
+            else
+            {
+                if (Z == P->left)
+                {
+                    Z = P;
+                    irb_rotate_right(tree, Z);
+                    P = Z->parent;
+                }
+
+                P->red = false;
+                G->red = true;
+
+                irb_rotate_left(tree, G);
+            }
+        }
+    }
+
+    tree->root->red = false;
+}
+
+// X may be NULL, so its parent is given separately
+static void
+irb_remove_fixup(IntrusiveRedBlackTree_t *tree, RBHook_t *X,
+                 RBHook_t *parent)
+{
+    while (X != tree->root && !irb_is_red(X))
+    {
+        if (X == parent->left)
+        {
+            RBHook_t *W = parent->right;
+
+            if (irb_is_red(W))
+            {
+                W->red = false;
+                parent->red = true;
+
+                irb_rotate_left(tree, parent);
+
+                W = parent->right;
+            }
+
+            if (!irb_is_red(W->left) && !irb_is_red(W->right))
+            {
+                W->red = true;
+
+                X = parent;
+                parent = X->parent;
+            }
+            else
+            {
+                if (!irb_is_red(W->right))
+                {
+                    W->left->red = false;
+                    W->red = true;
+
+                    irb_rotate_right(tree, W);
+
+                    W = parent->right;
+                }
+
+                W->red = parent->red;
+                parent->red = false;
+                W->right->red = false;
+
+                irb_rotate_left(tree, parent);
+
+                X = tree->root;
+            }
+        }
+        else
+        {
+            RBHook_t *W = parent->left;
+
+            if (irb_is_red(W))
+            {
+                W->red = false;
+                parent->red = true;
+
+                irb_rotate_right(tree, parent);
+
+                W = parent->left;
+            }
+
+            if (!irb_is_red(W->left) && !irb_is_red(W->right))
+            {
+                W->red = true;
+
+                X = parent;
+                parent = X->parent;
+            }
+            else
+            {
+                if (!irb_is_red(W->left))
+                {
+                    W->right->red = false;
+                    W->red = true;
+
+                    irb_rotate_left(tree, W);
+
+                    W = parent->left;
+                }
+
+                W->red = parent->red;
+                parent->red = false;
+                W->left->red = false;
+
+                irb_rotate_right(tree, parent);
+
+                X = tree->root;
+            }
+        }
+    }
+
+    if (X != NULL)
+        X->red = false;
+}
+
+static RBHook_t *
+irb_minimum(RBHook_t *hook)
+{
+    while (hook->left != NULL)
+        hook = hook->left;
+
+    return hook;
+}
+
+static RBHook_t *
+irb_maximum(RBHook_t *hook)
+{
+    while (hook->right != NULL)
+        hook = hook->right;
+
+    return hook;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
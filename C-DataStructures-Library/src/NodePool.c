@@ -0,0 +1,380 @@
+/**
+ * @file NodePool.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "NodePool.h"
+#include <stddef.h>
+
+/// A NodePool_s is a slab allocator that hands out nodes of a single, fixed
+/// size. Memory is requested from malloc() in big blocks called slabs, each
+/// one holding \c slab_nodes nodes. A node is taken either from a list of
+/// previously released nodes or from the unused tail of the newest slab, so
+/// both npl_alloc() and npl_release() are a couple of pointer operations.
+///
+/// Nodes that are allocated one after the other are also next to each other
+/// in memory, which improves locality when traversing linked structures.
+///
+/// Every linked container in this library can be configured to take its
+/// nodes from a pool (see the \c *_set_pool functions). A single pool can be
+/// shared between many containers as long as its node size is big enough for
+/// all of them. When all containers using a pool are done with their nodes,
+/// npl_reset() gives all nodes back at once without touching each one.
+///
+/// \par Functions
+/// Located in the file NodePool.c
+struct NodePool_s
+{
+    /// \brief Node size.
+    ///
+    /// Size in bytes of each node, rounded up so that every node is suitably
+    /// aligned for any type.
+    size_t node_size;
+
+    /// \brief Nodes per slab.
+    ///
+    /// How many nodes are allocated at once when the pool runs out of nodes.
+    integer_t slab_nodes;
+
+    /// \brief Slabs list.
+    ///
+    /// Singly-linked list of all slabs. The first slab is the newest one.
+    struct NodePoolSlab_s *slabs;
+
+    /// \brief Released nodes.
+    ///
+    /// Singly-linked list of nodes that were given back to the pool. The first
+    /// bytes of a released node are used as the pointer to the next one.
+    struct NodePoolFree_s *free_list;
+
+    /// \brief Nodes in use.
+    ///
+    /// Current amount of nodes handed out by the pool.
+    integer_t in_use;
+
+    /// \brief Total nodes.
+    ///
+    /// Total amount of nodes in all slabs.
+    integer_t capacity;
+};
+
+/// \brief A NodePool_s slab.
+///
+/// Implementation detail. A slab header followed by \c slab_nodes nodes in
+/// the same allocation.
+struct NodePoolSlab_s
+{
+    /// \brief Next slab.
+    ///
+    /// Next, older, slab or NULL if this is the first slab allocated.
+    struct NodePoolSlab_s *next;
+
+    /// \brief Nodes taken from this slab.
+    ///
+    /// How many nodes, from the start of the slab, were ever handed out. The
+    /// nodes after this index have never been used.
+    integer_t used;
+
+    /// \brief First node of the slab.
+    ///
+    /// Where the nodes of this slab begin.
+    unsigned char *nodes;
+};
+
+/// \brief A released node.
+///
+/// Implementation detail. How a node is seen while it is in the free list.
+struct NodePoolFree_s
+{
+    /// \brief Next released node.
+    ///
+    /// Next released node or NULL if this is the last one.
+    struct NodePoolFree_s *next;
+};
+
+typedef struct NodePoolSlab_s NodePoolSlab_t;
+
+typedef struct NodePoolFree_s NodePoolFree_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+npl_grow(NodePool_t *pool);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new NodePool_s. No slab is allocated until the first node is
+/// requested.
+///
+/// \param[in] node_size The size of each node. Usually the \c sizeof of a
+/// container's node structure.
+/// \param[in] slab_nodes The amount of nodes allocated at once.
+///
+/// \return A new NodePool_s or NULL if allocation failed, if \c node_size is
+/// 0 or if \c slab_nodes is less than 1.
+NodePool_t *
+npl_new(size_t node_size, integer_t slab_nodes)
+{
+    if (node_size == 0 || slab_nodes < 1)
+        return NULL;
+
+    NodePool_t *pool = malloc(sizeof(NodePool_t));
+
+    if (!pool)
+        return NULL;
+
+    const size_t align = _Alignof(max_align_t);
+
+    // Released nodes must hold a pointer and all nodes must be aligned
+    if (node_size < sizeof(NodePoolFree_t))
+        node_size = sizeof(NodePoolFree_t);
+
+    pool->node_size = (node_size + align - 1) / align * align;
+    pool->slab_nodes = slab_nodes;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->in_use = 0;
+    pool->capacity = 0;
+
+    return pool;
+}
+
+/// Frees from memory a NodePool_s and all of its slabs. Any node still in use
+/// becomes invalid.
+///
+/// \param[in] pool The node pool to be freed from memory.
+void
+npl_free(NodePool_t *pool)
+{
+    NodePoolSlab_t *scan = pool->slabs;
+
+    while (scan != NULL)
+    {
+        NodePoolSlab_t *next = scan->next;
+
+        free(scan);
+
+        scan = next;
+    }
+
+    free(pool);
+}
+
+/// Gives every node back to the pool at once. The slabs are kept so that
+/// they can be reused without calling malloc() again. Any node still in use
+/// becomes invalid, so this can only be called when all containers that use
+/// this pool were erased or freed.
+///
+/// \param[in] pool NodePool_s reference.
+void
+npl_reset(NodePool_t *pool)
+{
+    pool->free_list = NULL;
+    pool->in_use = 0;
+
+    if (pool->slabs == NULL)
+        return;
+
+    // Nodes are only bumped from the newest slab, so the nodes of all older
+    // slabs go to the free list
+    pool->slabs->used = 0;
+
+    for (NodePoolSlab_t *scan = pool->slabs->next; scan != NULL;
+         scan = scan->next)
+    {
+        for (integer_t i = 0; i < pool->slab_nodes; i++)
+        {
+            NodePoolFree_t *node = (NodePoolFree_t *)(scan->nodes +
+                                            (size_t)i * pool->node_size);
+
+            node->next = pool->free_list;
+            pool->free_list = node;
+        }
+    }
+}
+
+/// Frees all slabs of a NodePool_s if none of its nodes are in use.
+///
+/// \param[in] pool NodePool_s reference.
+///
+/// \return True if the slabs were freed or false if there are nodes in use.
+bool
+npl_shrink(NodePool_t *pool)
+{
+    if (pool->in_use > 0)
+        return false;
+
+    NodePoolSlab_t *scan = pool->slabs;
+
+    while (scan != NULL)
+    {
+        NodePoolSlab_t *next = scan->next;
+
+        free(scan);
+
+        scan = next;
+    }
+
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->capacity = 0;
+
+    return true;
+}
+
+/// Returns the size of each node handed out by the pool. This can be bigger
+/// than the size requested in npl_new() due to alignment.
+///
+/// \param[in] pool NodePool_s reference.
+///
+/// \return The size of each node.
+size_t
+npl_node_size(NodePool_t *pool)
+{
+    return pool->node_size;
+}
+
+/// Returns the amount of nodes currently handed out by the pool.
+///
+/// \param[in] pool NodePool_s reference.
+///
+/// \return The amount of nodes in use.
+integer_t
+npl_in_use(NodePool_t *pool)
+{
+    return pool->in_use;
+}
+
+/// Returns the total amount of nodes in all slabs of the pool.
+///
+/// \param[in] pool NodePool_s reference.
+///
+/// \return The total amount of nodes.
+integer_t
+npl_capacity(NodePool_t *pool)
+{
+    return pool->capacity;
+}
+
+/// Takes a node from the pool. Released nodes are reused first, then the
+/// unused nodes of the newest slab and, if both are exhausted, a new slab is
+/// allocated.
+///
+/// \param[in] pool NodePool_s reference.
+///
+/// \return A node of \c node_size bytes or NULL if allocation failed.
+void *
+npl_alloc(NodePool_t *pool)
+{
+    void *node;
+
+    if (pool->free_list != NULL)
+    {
+        node = pool->free_list;
+
+        pool->free_list = pool->free_list->next;
+    }
+    else
+    {
+        if (pool->slabs == NULL || pool->slabs->used == pool->slab_nodes)
+        {
+            if (!npl_grow(pool))
+                return NULL;
+        }
+
+        node = pool->slabs->nodes + (size_t)pool->slabs->used * pool->node_size;
+
+        pool->slabs->used++;
+    }
+
+    pool->in_use++;
+
+    return node;
+}
+
+/// Gives a node back to the pool. The node must have been taken from this
+/// same pool.
+///
+/// \param[in] pool NodePool_s reference.
+/// \param[in] node The node to be released.
+void
+npl_release(NodePool_t *pool, void *node)
+{
+    NodePoolFree_t *released = node;
+
+    released->next = pool->free_list;
+    pool->free_list = released;
+
+    pool->in_use--;
+}
+
+/// Takes a node from a pool or, if \c pool is NULL, allocates it with
+/// malloc(). Used by the containers so that a pool is always optional.
+///
+/// \param[in] pool NodePool_s reference or NULL.
+/// \param[in] size The node size used when there is no pool.
+///
+/// \return A new node or NULL if allocation failed.
+void *
+npl_node_alloc(NodePool_t *pool, size_t size)
+{
+    if (pool)
+        return npl_alloc(pool);
+
+    return malloc(size);
+}
+
+/// Gives a node back to a pool or, if \c pool is NULL, frees it with free().
+///
+/// \param[in] pool NodePool_s reference or NULL.
+/// \param[in] node The node to be released.
+void
+npl_node_free(NodePool_t *pool, void *node)
+{
+    if (pool)
+        npl_release(pool, node);
+    else
+        free(node);
+}
+
+/// Returns true if the nodes of a pool are big enough to hold \c size bytes.
+///
+/// \param[in] pool NodePool_s reference.
+/// \param[in] size The required node size.
+///
+/// \return True if each node has at least \c size bytes, otherwise false.
+bool
+npl_fits(NodePool_t *pool, size_t size)
+{
+    return pool->node_size >= size;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+npl_grow(NodePool_t *pool)
+{
+    const size_t align = _Alignof(max_align_t);
+
+    size_t header = (sizeof(NodePoolSlab_t) + align - 1) / align * align;
+
+    NodePoolSlab_t *slab = malloc(header +
+                                  pool->node_size * (size_t)pool->slab_nodes);
+
+    if (!slab)
+        return false;
+
+    slab->nodes = (unsigned char *)slab + header;
+    slab->used = 0;
+    slab->next = pool->slabs;
+
+    pool->slabs = slab;
+    pool->capacity += pool->slab_nodes;
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,822 @@
+/**
+ * @file PagedBitArray.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "PagedBitArray.h"
+#include "BitKernels.h"
+
+/// Size in bytes of a page.
+#define PBA_PAGE_BYTES 4096
+
+/// Amount of bits in a word.
+#define PBA_WORD_BITS (sizeof(unsigned_t) * 8)
+
+/// Amount of words in a page.
+#define PBA_PAGE_WORDS (PBA_PAGE_BYTES / sizeof(unsigned_t))
+
+/// Amount of bits in a page.
+#define PBA_PAGE_BITS (PBA_PAGE_BYTES * 8)
+
+/// Amount of pages in a directory.
+#define PBA_DIRECTORY_PAGES 512
+
+/// Amount of words in the summary of a directory.
+#define PBA_SUMMARY_WORDS (PBA_DIRECTORY_PAGES / PBA_WORD_BITS)
+
+/// \brief A group of consecutive pages.
+///
+/// Implementation detail. A directory only exists while at least one of its
+/// pages does.
+struct PagedDirectory_s
+{
+    /// \brief The pages, NULL while all of their bits are clear.
+    unsigned_t *pages[PBA_DIRECTORY_PAGES];
+
+    /// \brief Amount of set bits in each page.
+    uint16_t counts[PBA_DIRECTORY_PAGES];
+
+    /// \brief One bit for each page that is allocated.
+    unsigned_t summary[PBA_SUMMARY_WORDS];
+
+    /// \brief Amount of allocated pages.
+    integer_t size;
+};
+
+/// A PagedBitArray_s is a bit array for address spaces so large that even
+/// zeroing their buffer is not feasible, like a bitmap of 2^40 bits. The bits
+/// are split in 4 KB pages and a page is only allocated by the first write
+/// that sets one of its bits. A page whose bits are all clear is freed, so
+/// memory is only spent on the pages that have bits set and every missing
+/// page reads as zeros.
+///
+/// Pages are grouped in directories of 512 pages, also allocated on demand,
+/// so the only memory taken up front is a pointer for every 2^24 bits. Each
+/// directory has a summary with a bit for every allocated page and the array
+/// has a summary with a bit for every allocated directory. pba_next_set()
+/// goes through them to jump over empty pages and directories instead of
+/// reading them.
+///
+/// The existing BitArray_s API works on top of it through windows: a range of
+/// bits is copied to a BitArray_s by pba_read_bitarray(), changed or combined
+/// with any bit_* function and written back by pba_write_bitarray().
+///
+/// \par Functions
+/// Located in the file PagedBitArray.c
+struct PagedBitArray_s
+{
+    /// \brief The directories, NULL while all of their pages are missing.
+    struct PagedDirectory_s **directories;
+
+    /// \brief One bit for each directory that is allocated.
+    unsigned_t *summary;
+
+    /// \brief Amount of directories.
+    unsigned_t size;
+
+    /// \brief Amount of words in the summary.
+    unsigned_t summary_size;
+
+    /// \brief Amount of addressable bits.
+    unsigned_t used_bits;
+
+    /// \brief Amount of set bits.
+    unsigned_t cardinality;
+
+    /// \brief Amount of allocated pages.
+    unsigned_t pages;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t *
+pba_page(PagedBitArray_t *bits, unsigned_t page, bool create);
+
+static void
+pba_release(PagedBitArray_t *bits, unsigned_t page);
+
+static unsigned_t
+pba_next_page(PagedBitArray_t *bits, unsigned_t page);
+
+static bool
+pba_range(PagedBitArray_t *bits, unsigned_t from_index, unsigned_t to_index,
+          bool state);
+
+static void
+pba_fill(unsigned_t *page, unsigned_t from, unsigned_t to, bool state);
+
+static unsigned_t
+pba_scan(const unsigned_t *words, unsigned_t bit_index, unsigned_t size);
+
+static unsigned_t
+pba_lowest(unsigned_t word);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a paged bit array that addresses the required amount of bits, all
+/// of them clear. No page is allocated yet.
+///
+/// \param[in] required_bits Required addressable bits.
+///
+/// \return A new paged bit array or NULL if \c required_bits is 0 or if
+/// allocation failed.
+PagedBitArray_t *
+pba_create(unsigned_t required_bits)
+{
+    if (required_bits == 0)
+        return NULL;
+
+    PagedBitArray_t *bits = malloc(sizeof(PagedBitArray_t));
+
+    if (!bits)
+        return NULL;
+
+    unsigned_t pages = (required_bits - 1) / PBA_PAGE_BITS + 1;
+
+    bits->size = (pages - 1) / PBA_DIRECTORY_PAGES + 1;
+    bits->summary_size = (bits->size - 1) / PBA_WORD_BITS + 1;
+
+    bits->directories = calloc((size_t)bits->size,
+                               sizeof(struct PagedDirectory_s *));
+
+    bits->summary = bkn_alloc(bits->summary_size);
+
+    if (!bits->directories || !bits->summary)
+    {
+        free(bits->directories);
+        free(bits->summary);
+        free(bits);
+        return NULL;
+    }
+
+    bits->used_bits = required_bits;
+    bits->cardinality = 0;
+    bits->pages = 0;
+
+    return bits;
+}
+
+/// Frees from memory every page and the paged bit array.
+///
+/// \param[in] bits The paged bit array to be freed from memory.
+void
+pba_free(PagedBitArray_t *bits)
+{
+    pba_empty(bits);
+
+    free(bits->directories);
+    free(bits->summary);
+    free(bits);
+}
+
+/// \param[in] bits The target paged bit array.
+///
+/// \return The amount of addressable bits.
+unsigned_t
+pba_nbits(PagedBitArray_t *bits)
+{
+    return bits->used_bits;
+}
+
+/// Returns the amount of pages that are allocated, which are the pages that
+/// have at least one bit set.
+///
+/// \param[in] bits The target paged bit array.
+///
+/// \return The amount of allocated pages.
+unsigned_t
+pba_pages(PagedBitArray_t *bits)
+{
+    return bits->pages;
+}
+
+/// Returns the amount of memory taken by the paged bit array, its pages and
+/// its directories.
+///
+/// \param[in] bits The target paged bit array.
+///
+/// \return The amount of bytes used.
+unsigned_t
+pba_bytes(PagedBitArray_t *bits)
+{
+    unsigned_t directories = bkn_popcount(bits->summary, bits->summary_size);
+
+    return sizeof(PagedBitArray_t)
+           + bits->size * sizeof(struct PagedDirectory_s *)
+           + bits->summary_size * sizeof(unsigned_t)
+           + directories * sizeof(struct PagedDirectory_s)
+           + bits->pages * PBA_PAGE_BYTES;
+}
+
+/// Sets to true a bit at a given index, allocating its page if it is the
+/// first bit set in it.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit was set or false if the index is out of range or
+/// if allocation failed.
+bool
+pba_set(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    if (bit_index >= bits->used_bits)
+        return false;
+
+    unsigned_t page_index = bit_index / PBA_PAGE_BITS;
+
+    unsigned_t *page = pba_page(bits, page_index, true);
+
+    if (!page)
+        return false;
+
+    unsigned_t offset = bit_index % PBA_PAGE_BITS;
+    unsigned_t mask = (unsigned_t)1 << (offset % PBA_WORD_BITS);
+
+    if ((page[offset / PBA_WORD_BITS] & mask) == 0)
+    {
+        page[offset / PBA_WORD_BITS] |= mask;
+
+        bits->directories[page_index / PBA_DIRECTORY_PAGES]
+            ->counts[page_index % PBA_DIRECTORY_PAGES]++;
+        bits->cardinality++;
+    }
+
+    return true;
+}
+
+/// Sets to true every bit from \c from_index to \c to_index, both inclusive.
+/// Every page of the range is allocated.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] from_index The first bit of the range.
+/// \param[in] to_index The last bit of the range.
+///
+/// \return True if the bits were set or false if the range is invalid or if
+/// allocation failed, in which case only part of the range might be set.
+bool
+pba_set_range(PagedBitArray_t *bits, unsigned_t from_index,
+              unsigned_t to_index)
+{
+    if (from_index > to_index || to_index >= bits->used_bits)
+        return false;
+
+    return pba_range(bits, from_index, to_index, true);
+}
+
+/// Sets to false a bit at a given index. The page is freed when its last set
+/// bit is cleared.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit is clear or false if the index is out of range.
+bool
+pba_clear(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    if (bit_index >= bits->used_bits)
+        return false;
+
+    unsigned_t page_index = bit_index / PBA_PAGE_BITS;
+
+    unsigned_t *page = pba_page(bits, page_index, false);
+
+    if (!page)
+        return true;
+
+    unsigned_t offset = bit_index % PBA_PAGE_BITS;
+    unsigned_t mask = (unsigned_t)1 << (offset % PBA_WORD_BITS);
+
+    if ((page[offset / PBA_WORD_BITS] & mask) != 0)
+    {
+        page[offset / PBA_WORD_BITS] &= ~mask;
+
+        bits->cardinality--;
+
+        if (--bits->directories[page_index / PBA_DIRECTORY_PAGES]
+                ->counts[page_index % PBA_DIRECTORY_PAGES] == 0)
+        {
+            pba_release(bits, page_index);
+        }
+    }
+
+    return true;
+}
+
+/// Sets to false every bit from \c from_index to \c to_index, both inclusive.
+/// Missing pages are skipped and pages left without set bits are freed.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] from_index The first bit of the range.
+/// \param[in] to_index The last bit of the range.
+///
+/// \return True if the bits were cleared or false if the range is invalid.
+bool
+pba_clear_range(PagedBitArray_t *bits, unsigned_t from_index,
+                unsigned_t to_index)
+{
+    if (from_index > to_index || to_index >= bits->used_bits)
+        return false;
+
+    return pba_range(bits, from_index, to_index, false);
+}
+
+/// Flips the state of a bit at a given index.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit was flipped or false if the index is out of range
+/// or if allocation failed.
+bool
+pba_flip(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    return pba_put(bits, bit_index, !pba_get(bits, bit_index));
+}
+
+/// Sets a bit at a given index to a given state.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The bit index.
+/// \param[in] state The new state of the bit.
+///
+/// \return True if the bit was changed or false if the index is out of range
+/// or if allocation failed.
+bool
+pba_put(PagedBitArray_t *bits, unsigned_t bit_index, bool state)
+{
+    if (state)
+        return pba_set(bits, bit_index);
+
+    return pba_clear(bits, bit_index);
+}
+
+/// Sets to false every bit. Every page and directory is freed.
+///
+/// \param[in] bits The target paged bit array.
+void
+pba_empty(PagedBitArray_t *bits)
+{
+    for (unsigned_t i = 0; i < bits->size; i++)
+    {
+        struct PagedDirectory_s *directory = bits->directories[i];
+
+        if (!directory)
+            continue;
+
+        for (unsigned_t j = 0; j < PBA_DIRECTORY_PAGES; j++)
+            free(directory->pages[j]);
+
+        free(directory);
+
+        bits->directories[i] = NULL;
+    }
+
+    for (unsigned_t i = 0; i < bits->summary_size; i++)
+        bits->summary[i] = 0;
+
+    bits->cardinality = 0;
+    bits->pages = 0;
+}
+
+/// Retrieves the state of a bit at a given index. Bits of missing pages are
+/// always false.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The bit index.
+///
+/// \return The state of the bit or false if the index is out of range.
+bool
+pba_get(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    if (bit_index >= bits->used_bits)
+        return false;
+
+    unsigned_t *page = pba_page(bits, bit_index / PBA_PAGE_BITS, false);
+
+    if (!page)
+        return false;
+
+    unsigned_t offset = bit_index % PBA_PAGE_BITS;
+
+    return (page[offset / PBA_WORD_BITS]
+            & ((unsigned_t)1 << (offset % PBA_WORD_BITS))) != 0;
+}
+
+/// Returns the amount of set bits. It is kept up to date by every operation
+/// so no page is read.
+///
+/// \param[in] bits The target paged bit array.
+///
+/// \return The amount of set bits.
+unsigned_t
+pba_cardinality(PagedBitArray_t *bits)
+{
+    return bits->cardinality;
+}
+
+/// Makes a BitArray_s with the bits from \c from_index to \c to_index, both
+/// inclusive, where bit \c from_index becomes bit 0. Only the set bits are
+/// visited, so missing pages cost nothing besides zeroing the result.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] from_index The first bit of the range.
+/// \param[in] to_index The last bit of the range.
+///
+/// \return A new BitArray_s or NULL if the range is invalid or if allocation
+/// failed.
+BitArray_t *
+pba_read_bitarray(PagedBitArray_t *bits, unsigned_t from_index,
+                  unsigned_t to_index)
+{
+    if (from_index > to_index || to_index >= bits->used_bits)
+        return NULL;
+
+    BitArray_t *result = bit_create(to_index - from_index + 1);
+
+    if (!result)
+        return NULL;
+
+    unsigned_t index = pba_next_set(bits, from_index);
+
+    while (index <= to_index)
+    {
+        bit_set(result, index - from_index);
+
+        index = pba_next_set(bits, index + 1);
+    }
+
+    return result;
+}
+
+/// Replaces the bits from \c offset to <code> offset + bit_nbits(source) - 1
+/// </code> with the bits of a BitArray_s, where bit 0 of \c source goes to
+/// bit \c offset.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] source The bits to be written.
+/// \param[in] offset Where the first bit of \c source goes.
+///
+/// \return True if the bits were written or false if they don't fit or if
+/// allocation failed, in which case only part of them might be written.
+bool
+pba_write_bitarray(PagedBitArray_t *bits, BitArray_t *source,
+                   unsigned_t offset)
+{
+    unsigned_t size = bit_nbits(source);
+
+    if (offset >= bits->used_bits || size > bits->used_bits - offset)
+        return false;
+
+    pba_range(bits, offset, offset + size - 1, false);
+
+    unsigned_t index = bit_next_set(source, 0);
+
+    while (index != (unsigned_t)-1)
+    {
+        if (!pba_set(bits, offset + index))
+            return false;
+
+        index = bit_next_set(source, index + 1);
+    }
+
+    return true;
+}
+
+/// Returns the index of the nearest set bit on or after a given index.
+/// Missing pages and directories are skipped through their summaries without
+/// being read.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The starting index.
+///
+/// \return The index of the bit found or -1 cast to unsigned_t.
+unsigned_t
+pba_next_set(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    if (bit_index >= bits->used_bits)
+        return (unsigned_t)-1;
+
+    unsigned_t page_index = bit_index / PBA_PAGE_BITS;
+    unsigned_t offset = bit_index % PBA_PAGE_BITS;
+
+    for (;;)
+    {
+        unsigned_t next = pba_next_page(bits, page_index);
+
+        if (next == (unsigned_t)-1)
+            return (unsigned_t)-1;
+
+        // The whole page is searched if it is not the first one
+        if (next != page_index)
+            offset = 0;
+
+        unsigned_t *page = pba_page(bits, next, false);
+
+        unsigned_t found = pba_scan(page, offset, PBA_PAGE_WORDS);
+
+        if (found != (unsigned_t)-1)
+            return next * PBA_PAGE_BITS + found;
+
+        page_index = next + 1;
+        offset = 0;
+    }
+}
+
+/// Returns the index of the nearest clear bit on or after a given index.
+/// Pages with every bit set are skipped without being read.
+///
+/// \param[in] bits The target paged bit array.
+/// \param[in] bit_index The starting index.
+///
+/// \return The index of the bit found or -1 cast to unsigned_t.
+unsigned_t
+pba_next_clear(PagedBitArray_t *bits, unsigned_t bit_index)
+{
+    unsigned_t page_index = bit_index / PBA_PAGE_BITS;
+    unsigned_t offset = bit_index % PBA_PAGE_BITS;
+
+    while (bit_index < bits->used_bits)
+    {
+        unsigned_t *page = pba_page(bits, page_index, false);
+
+        if (!page)
+            return bit_index;
+
+        if (bits->directories[page_index / PBA_DIRECTORY_PAGES]
+                ->counts[page_index % PBA_DIRECTORY_PAGES] < PBA_PAGE_BITS)
+        {
+            unsigned_t index = offset / PBA_WORD_BITS;
+
+            unsigned_t word = ~page[index]
+                              & (~(unsigned_t)0 << (offset % PBA_WORD_BITS));
+
+            if (word == 0 && index + 1 < PBA_PAGE_WORDS)
+            {
+                index = bkn_next_word(page, index + 1, PBA_PAGE_WORDS,
+                                      ~(unsigned_t)0);
+
+                if (index < PBA_PAGE_WORDS)
+                    word = ~page[index];
+            }
+
+            if (word != 0)
+            {
+                unsigned_t result = page_index * PBA_PAGE_BITS
+                                    + index * PBA_WORD_BITS + pba_lowest(word);
+
+                return result < bits->used_bits ? result : (unsigned_t)-1;
+            }
+        }
+
+        page_index++;
+        offset = 0;
+        bit_index = page_index * PBA_PAGE_BITS;
+    }
+
+    return (unsigned_t)-1;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Returns a page, or NULL if it is missing. If create is true a missing page
+// is allocated and NULL means that allocation failed.
+static unsigned_t *
+pba_page(PagedBitArray_t *bits, unsigned_t page, bool create)
+{
+    unsigned_t index = page / PBA_DIRECTORY_PAGES;
+    unsigned_t slot = page % PBA_DIRECTORY_PAGES;
+
+    struct PagedDirectory_s *directory = bits->directories[index];
+
+    if (directory && directory->pages[slot])
+        return directory->pages[slot];
+
+    if (!create)
+        return NULL;
+
+    if (!directory)
+    {
+        directory = calloc(1, sizeof(struct PagedDirectory_s));
+
+        if (!directory)
+            return NULL;
+
+        bits->directories[index] = directory;
+        bits->summary[index / PBA_WORD_BITS] |=
+            (unsigned_t)1 << (index % PBA_WORD_BITS);
+    }
+
+    unsigned_t *buffer = bkn_alloc(PBA_PAGE_WORDS);
+
+    if (!buffer)
+    {
+        if (directory->size == 0)
+        {
+            free(directory);
+
+            bits->directories[index] = NULL;
+            bits->summary[index / PBA_WORD_BITS] &=
+                ~((unsigned_t)1 << (index % PBA_WORD_BITS));
+        }
+
+        return NULL;
+    }
+
+    directory->pages[slot] = buffer;
+    directory->counts[slot] = 0;
+    directory->summary[slot / PBA_WORD_BITS] |=
+        (unsigned_t)1 << (slot % PBA_WORD_BITS);
+    directory->size++;
+
+    bits->pages++;
+
+    return buffer;
+}
+
+// Frees a page without set bits and its directory if it was the last page
+static void
+pba_release(PagedBitArray_t *bits, unsigned_t page)
+{
+    unsigned_t index = page / PBA_DIRECTORY_PAGES;
+    unsigned_t slot = page % PBA_DIRECTORY_PAGES;
+
+    struct PagedDirectory_s *directory = bits->directories[index];
+
+    free(directory->pages[slot]);
+
+    directory->pages[slot] = NULL;
+    directory->summary[slot / PBA_WORD_BITS] &=
+        ~((unsigned_t)1 << (slot % PBA_WORD_BITS));
+    directory->size--;
+
+    bits->pages--;
+
+    if (directory->size == 0)
+    {
+        free(directory);
+
+        bits->directories[index] = NULL;
+        bits->summary[index / PBA_WORD_BITS] &=
+            ~((unsigned_t)1 << (index % PBA_WORD_BITS));
+    }
+}
+
+// Returns the first allocated page on or after a given page or -1 cast to
+// unsigned_t if there is none
+static unsigned_t
+pba_next_page(PagedBitArray_t *bits, unsigned_t page)
+{
+    unsigned_t index = page / PBA_DIRECTORY_PAGES;
+    unsigned_t slot = page % PBA_DIRECTORY_PAGES;
+
+    while (index < bits->size)
+    {
+        struct PagedDirectory_s *directory = bits->directories[index];
+
+        if (directory)
+        {
+            unsigned_t found = pba_scan(directory->summary, slot,
+                                        PBA_SUMMARY_WORDS);
+
+            if (found != (unsigned_t)-1)
+                return index * PBA_DIRECTORY_PAGES + found;
+        }
+
+        index = pba_scan(bits->summary, index + 1, bits->summary_size);
+
+        if (index == (unsigned_t)-1)
+            return (unsigned_t)-1;
+
+        slot = 0;
+    }
+
+    return (unsigned_t)-1;
+}
+
+// Sets or clears a valid range of bits one page at a time. Clearing skips
+// missing pages.
+static bool
+pba_range(PagedBitArray_t *bits, unsigned_t from_index, unsigned_t to_index,
+          bool state)
+{
+    unsigned_t first = from_index / PBA_PAGE_BITS;
+    unsigned_t last = to_index / PBA_PAGE_BITS;
+
+    unsigned_t page_index = first;
+
+    while (page_index <= last)
+    {
+        if (!state)
+        {
+            page_index = pba_next_page(bits, page_index);
+
+            if (page_index == (unsigned_t)-1 || page_index > last)
+                break;
+        }
+
+        unsigned_t *page = pba_page(bits, page_index, state);
+
+        if (!page)
+            return false;
+
+        unsigned_t from = page_index == first ? from_index % PBA_PAGE_BITS : 0;
+        unsigned_t to = page_index == last ? to_index % PBA_PAGE_BITS
+                                           : PBA_PAGE_BITS - 1;
+
+        uint16_t *count = &bits->directories[page_index / PBA_DIRECTORY_PAGES]
+                              ->counts[page_index % PBA_DIRECTORY_PAGES];
+
+        pba_fill(page, from, to, state);
+
+        unsigned_t after = bkn_popcount(page, PBA_PAGE_WORDS);
+
+        bits->cardinality = bits->cardinality - *count + after;
+
+        *count = (uint16_t)after;
+
+        if (after == 0)
+            pba_release(bits, page_index);
+
+        page_index++;
+    }
+
+    return true;
+}
+
+// Sets or clears the bits of a page from one offset to another, both
+// inclusive
+static void
+pba_fill(unsigned_t *page, unsigned_t from, unsigned_t to, bool state)
+{
+    unsigned_t first = from / PBA_WORD_BITS;
+    unsigned_t last = to / PBA_WORD_BITS;
+
+    for (unsigned_t i = first; i <= last; i++)
+    {
+        unsigned_t mask = ~(unsigned_t)0;
+
+        if (i == first)
+            mask &= ~(unsigned_t)0 << (from % PBA_WORD_BITS);
+
+        if (i == last)
+            mask &= ~(unsigned_t)0 >> (PBA_WORD_BITS - 1 - to % PBA_WORD_BITS);
+
+        if (state)
+            page[i] |= mask;
+        else
+            page[i] &= ~mask;
+    }
+}
+
+// Returns the index of the first set bit on or after bit_index in a buffer of
+// words or -1 cast to unsigned_t if there is none
+static unsigned_t
+pba_scan(const unsigned_t *words, unsigned_t bit_index, unsigned_t size)
+{
+    unsigned_t index = bit_index / PBA_WORD_BITS;
+
+    if (index >= size)
+        return (unsigned_t)-1;
+
+    unsigned_t word = words[index]
+                      & (~(unsigned_t)0 << (bit_index % PBA_WORD_BITS));
+
+    if (word == 0)
+    {
+        if (index + 1 == size)
+            return (unsigned_t)-1;
+
+        index = bkn_next_word(words, index + 1, size, 0);
+
+        if (index == size)
+            return (unsigned_t)-1;
+
+        word = words[index];
+    }
+
+    return index * PBA_WORD_BITS + pba_lowest(word);
+}
+
+// Returns the index of the lowest set bit of a word that is not 0
+static unsigned_t
+pba_lowest(unsigned_t word)
+{
+#ifdef __GNUC__
+    return (unsigned_t)__builtin_ctzll(word);
+#else
+    unsigned_t index = 0;
+
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+
+    return index;
+#endif
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -8,8 +8,18 @@
 
 #include "PriorityList.h"
 
+/// Amount of buckets of a radix heap, one for each bit of a key plus one for
+/// the keys equal to the last key removed.
+#define PLI_RADIX_BUCKETS 65
+
 /// A PriorityList is a data structure that sorts its elements according to
 /// their natural priority implemented by their interface.
+///
+/// Its nodes can be arranged by three engines. The default one keeps them in
+/// a sorted linked list. A pairing heap keeps them in a multi-way tree where
+/// the first child of a node is in \c child and its siblings are linked
+/// through \c next. A radix heap keeps them in buckets, where bucket \c i has
+/// the keys that differ from the last key removed at bit \c i - 1 and above.
 struct PriorityList_s
 {
     /// \brief Current amount of elements in the priority list.
@@ -30,9 +40,37 @@ struct PriorityList_s
     /// \brief The front of the priority list.
     ///
     /// Elements with higher priority are removed from the front of the
-    /// priority list.
+    /// priority list. With a pairing heap this is the root of the heap. Not
+    /// used by a radix heap.
     struct PriorityListNode_s *front;
 
+    /// \brief How the nodes are arranged.
+    ///
+    /// Set when the priority list is created and never changed.
+    PriorityListEngine engine;
+
+    /// \brief Radix heap buckets.
+    ///
+    /// Each bucket is a singly-linked list through \c next. Only allocated by
+    /// a radix heap.
+    struct PriorityListNode_s **buckets;
+
+    /// \brief Radix heap key function.
+    ///
+    /// Maps each element to its priority. Smaller keys are removed first.
+    key_f key;
+
+    /// \brief Last key removed from a radix heap.
+    ///
+    /// No element with a smaller key can be inserted.
+    uint64_t last;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief PriorityList_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
@@ -50,9 +88,9 @@ struct PriorityList_s
 
 /// \brief A PriorityList_s node.
 ///
-/// Implementation detail. This node is like a singly-linked list node with one
-/// pointer to a nextious node that has a lower priority than this one, or NULL
-/// if this is the node with the lowest priority in the list.
+/// Implementation detail. In a sorted list this node is like a singly-linked
+/// list node with one pointer to a next node that has a lower priority than
+/// this one, or NULL if this is the node with the lowest priority in the list.
 struct PriorityListNode_s
 {
     /// \brief Node's data.
@@ -60,11 +98,23 @@ struct PriorityListNode_s
     /// A pointer to the node's data.
     void *data;
 
-    /// \brief Previous element in the priority list.
+    /// \brief Next element in the priority list.
     ///
-    /// Points to the nextious element in the priority list or NULL if this
-    /// element is the one with the lowest priority in the list.
+    /// Points to the next element in the priority list or NULL if this
+    /// element is the one with the lowest priority in the list. In a pairing
+    /// heap it points to the next sibling and in a radix heap to the next
+    /// element of the same bucket.
     struct PriorityListNode_s *next;
+
+    /// \brief First child of a pairing heap node.
+    ///
+    /// All children have a priority lower than or equal to this node.
+    struct PriorityListNode_s *child;
+
+    /// \brief Radix heap key.
+    ///
+    /// The key of the element, computed once when it is inserted.
+    uint64_t key;
 };
 
 /// \brief A type for a priority list node.
@@ -80,16 +130,49 @@ typedef struct PriorityListNode_s *PriorityListNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static PriorityListNode_t *
-pli_new_node(void *element);
+pli_new_node(NodePool_t *pool, void *element);
+
+static void
+pli_free_node(NodePool_t *pool, PriorityListNode_t *node, free_f function);
+
+static void
+pli_free_node_shallow(NodePool_t *pool, PriorityListNode_t *node);
+
+static PriorityListNode_t *
+pli_unlink(PriorityList_t *plist);
 
 static void
-pli_free_node(PriorityListNode_t *node, free_f function);
+pli_link(PriorityList_t *plist, PriorityListNode_t *node);
+
+static PriorityListNode_t *
+pli_meld(PriorityList_t *plist, PriorityListNode_t *node1,
+         PriorityListNode_t *node2);
+
+static PriorityListNode_t *
+pli_pairs(PriorityList_t *plist, PriorityListNode_t *first);
+
+static integer_t
+pli_radix_index(uint64_t last, uint64_t key);
+
+static PriorityListNode_t *
+pli_radix_min(PriorityList_t *plist);
 
 static void
-pli_free_node_shallow(PriorityListNode_t *node);
+pli_radix_pull(PriorityList_t *plist);
+
+static PriorityListNode_t **
+pli_nodes(PriorityList_t *plist);
+
+static void **
+pli_ordered(PriorityList_t *plist);
+
+static bool
+pli_merge_nodes(PriorityList_t *plist1, PriorityList_t *plist2);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
+/// Initializes a new priority list backed by a sorted linked list. Same as
+/// calling pli_create() with \ref PLI_SORTED.
 ///
 /// \param[in] interface
 ///
@@ -97,17 +180,61 @@ pli_free_node_shallow(PriorityListNode_t *node);
 PriorityList_t *
 pli_new(Interface_t *interface)
 {
+    return pli_create(interface, PLI_SORTED, NULL);
+}
+
+/// Initializes a new priority list with a given engine. A sorted list is
+/// faster for small lists or when elements with the same priority must be
+/// removed in insertion order. A pairing heap is faster for big lists and for
+/// merging lists, since pli_merge() takes O(1). A radix heap is the fastest
+/// for monotone integer priorities, like the distances in Dijkstra's
+/// algorithm, and ignores the priority function of the interface.
+/// \par Interface Requirements
+/// - priority (except for \ref PLI_RADIX)
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// priority list to operate.
+/// \param[in] engine How the elements are stored.
+/// \param[in] key The priority of each element, only required by
+/// \ref PLI_RADIX. Elements with smaller keys are removed first.
+///
+/// \return A new priority list or NULL if allocation failed or if a radix
+/// heap has no key function.
+PriorityList_t *
+pli_create(Interface_t *interface, PriorityListEngine engine, key_f key)
+{
+    if (engine == PLI_RADIX && !key)
+        return NULL;
+
     PriorityList_t *plist = malloc(sizeof(PriorityList_t));
 
     if (!plist)
         return NULL;
 
+    plist->buckets = NULL;
+
+    if (engine == PLI_RADIX)
+    {
+        plist->buckets = calloc(PLI_RADIX_BUCKETS, sizeof(PriorityListNode_t*));
+
+        if (!plist->buckets)
+        {
+            free(plist);
+            return NULL;
+        }
+    }
+
     plist->count = 0;
     plist->limit = 0;
     plist->version_id = 0;
 
     plist->front = NULL;
 
+    plist->engine = engine;
+    plist->key = key;
+    plist->last = 0;
+
+    plist->pool = NULL;
     plist->interface = interface;
 
     return plist;
@@ -118,17 +245,9 @@ pli_new(Interface_t *interface)
 void
 pli_free(PriorityList_t *plist)
 {
-    PriorityListNode_t *scan = plist->front;
-
-    while (plist->front != NULL)
-    {
-        plist->front = plist->front->next;
-
-        pli_free_node(scan, plist->interface->free);
-
-        scan = plist->front;
-    }
+    pli_erase(plist);
 
+    free(plist->buckets);
     free(plist);
 }
 
@@ -137,17 +256,9 @@ pli_free(PriorityList_t *plist)
 void
 pli_free_shallow(PriorityList_t *plist)
 {
-    PriorityListNode_t *scan = plist->front;
-
-    while (plist->front != NULL)
-    {
-        plist->front = plist->front->next;
-
-        pli_free_node_shallow(scan);
-
-        scan = plist->front;
-    }
+    pli_erase_shallow(plist);
 
+    free(plist->buckets);
     free(plist);
 }
 
@@ -156,21 +267,19 @@ pli_free_shallow(PriorityList_t *plist)
 void
 pli_erase(PriorityList_t *plist)
 {
-    PriorityListNode_t *scan = plist->front;
+    PriorityListNode_t *scan = pli_unlink(plist), *next;
 
-    while (plist->front != NULL)
+    while (scan != NULL)
     {
-        plist->front = plist->front->next;
+        next = scan->next;
 
-        pli_free_node(scan, plist->interface->free);
+        pli_free_node(plist->pool, scan, plist->interface->free);
 
-        scan = plist->front;
+        scan = next;
     }
 
     plist->count = 0;
     plist->version_id++;
-
-    plist->front = NULL;
 }
 
 ///
@@ -178,21 +287,19 @@ pli_erase(PriorityList_t *plist)
 void
 pli_erase_shallow(PriorityList_t *plist)
 {
-    PriorityListNode_t *scan = plist->front;
+    PriorityListNode_t *scan = pli_unlink(plist), *next;
 
-    while (plist->front != NULL)
+    while (scan != NULL)
     {
-        plist->front = plist->front->next;
+        next = scan->next;
 
-        pli_free_node_shallow(scan);
+        pli_free_node_shallow(plist->pool, scan);
 
-        scan = plist->front;
+        scan = next;
     }
 
     plist->count = 0;
     plist->version_id++;
-
-    plist->front = NULL;
 }
 
 ///
@@ -224,6 +331,17 @@ pli_limit(PriorityList_t *plist)
     return plist->limit;
 }
 
+/// Returns the engine the priority list was created with.
+///
+/// \param[in] plist PriorityList_s reference.
+///
+/// \return The priority list's engine.
+PriorityListEngine
+pli_engine(PriorityList_t *plist)
+{
+    return plist->engine;
+}
+
 ///
 /// \param[in] plist
 /// \param[in] limit
@@ -241,6 +359,35 @@ pli_set_limit(PriorityList_t *plist, integer_t limit)
     return true;
 }
 
+/// Sets a node pool from where all nodes of the priority list are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the priority list is empty.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] plist PriorityList_s reference.
+/// \param[in] pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the priority list is not empty or if the pool's nodes are
+/// too small.
+bool
+pli_set_pool(PriorityList_t *plist, NodePool_t *pool)
+{
+    if (!pli_empty(plist))
+        return false;
+
+    if (pool && !npl_fits(pool, sizeof(PriorityListNode_t)))
+        return false;
+
+    plist->pool = pool;
+
+    return true;
+}
+
+/// Inserts an element in the priority list. With a radix heap the element's
+/// key can't be smaller than the key of the last element removed.
 ///
 /// \param[in] plist
 /// \param[in] element
@@ -252,51 +399,24 @@ pli_insert(PriorityList_t *plist, void *element)
     if (pli_full(plist))
         return false;
 
-    PriorityListNode_t *node = pli_new_node(element);
-
-    if (!node)
-        return false;
+    uint64_t key = 0;
 
-    if (pli_empty(plist))
+    if (plist->engine == PLI_RADIX)
     {
-        // Case for the first node
-        plist->front = node;
+        key = plist->key(element);
+
+        if (key < plist->last)
+            return false;
     }
-    else
-    {
-        if (plist->interface->priority(node->data, plist->front->data) > 0)
-        {
-            // Case for when the front pointer needs to be changed
-            // The element has the highest priority in the list
-            node->next = plist->front;
 
-            plist->front = node;
-        }
-        else
-        {
-            PriorityListNode_t *scan = plist->front->next;
-            PriorityListNode_t *before = plist->front;
+    PriorityListNode_t *node = pli_new_node(plist->pool, element);
 
-            while (scan != NULL &&
-                   plist->interface->priority(node->data, scan->data) <= 0)
-            {
-                before = scan;
-                scan = scan->next;
-            }
+    if (!node)
+        return false;
 
-            if (scan == NULL)
-            {
-                // The element has the lowest priority in the list
-                before->next = node;
-            }
-            else
-            {
-                // Adding to the middle of the list
-                before->next = node;
-                node->next = scan;
-            }
-        }
-    }
+    node->key = key;
+
+    pli_link(plist, node);
 
     plist->count++;
     plist->version_id++;
@@ -315,12 +435,32 @@ pli_remove(PriorityList_t *plist, void **result)
     if (pli_empty(plist))
         return false;
 
-    PriorityListNode_t *node = plist->front;
-    *result = node->data;
+    PriorityListNode_t *node;
 
-    plist->front = plist->front->next;
+    if (plist->engine == PLI_RADIX)
+    {
+        pli_radix_pull(plist);
+
+        node = plist->buckets[0];
+
+        plist->buckets[0] = node->next;
+    }
+    else if (plist->engine == PLI_PAIRING)
+    {
+        node = plist->front;
+
+        plist->front = pli_pairs(plist, node->child);
+    }
+    else
+    {
+        node = plist->front;
+
+        plist->front = plist->front->next;
+    }
 
-    pli_free_node_shallow(node);
+    *result = node->data;
+
+    pli_free_node_shallow(plist->pool, node);
 
     plist->count--;
     plist->version_id++;
@@ -341,6 +481,10 @@ pli_peek(PriorityList_t *plist)
     if (pli_empty(plist))
         return NULL;
 
+    // Pulling would make the smallest key the last key removed
+    if (plist->engine == PLI_RADIX)
+        return pli_radix_min(plist)->data;
+
     return plist->front->data;
 }
 
@@ -372,6 +516,23 @@ pli_full(PriorityList_t *plist)
 bool
 pli_contains(PriorityList_t *plist, void *key)
 {
+    if (plist->engine != PLI_SORTED)
+    {
+        PriorityListNode_t **nodes = pli_nodes(plist);
+
+        if (!nodes)
+            return false;
+
+        bool found = false;
+
+        for (integer_t i = 0; i < plist->count && !found; i++)
+            found = plist->interface->compare(nodes[i]->data, key) == 0;
+
+        free(nodes);
+
+        return found;
+    }
+
     PriorityListNode_t *scan = plist->front;
 
     while (scan != NULL)
@@ -392,12 +553,44 @@ pli_contains(PriorityList_t *plist, void *key)
 PriorityList_t *
 pli_copy(PriorityList_t *plist)
 {
-    PriorityList_t *result = pli_new(plist->interface);
+    PriorityList_t *result = pli_create(plist->interface, plist->engine,
+                                        plist->key);
 
     if (!result)
         return NULL;
 
     result->limit = plist->limit;
+    result->pool = plist->pool;
+    result->last = plist->last;
+
+    if (plist->engine != PLI_SORTED)
+    {
+        // Heaps are rebuilt by inserting every element, in O(1) each
+        PriorityListNode_t **nodes = pli_nodes(plist);
+
+        if (!nodes && !pli_empty(plist))
+        {
+            pli_free(result);
+            return NULL;
+        }
+
+        for (integer_t i = 0; i < plist->count; i++)
+        {
+            void *element = plist->interface->copy(nodes[i]->data);
+
+            if (!pli_insert(result, element))
+            {
+                plist->interface->free(element);
+                pli_free(result);
+                free(nodes);
+                return NULL;
+            }
+        }
+
+        free(nodes);
+
+        return result;
+    }
 
     // scan -> goes through the original stack
     // copy -> current element being copied
@@ -406,11 +599,11 @@ pli_copy(PriorityList_t *plist)
 
     while (scan != NULL)
     {
-        copy = pli_new_node(plist->interface->copy(scan->data));
+        copy = pli_new_node(result->pool, plist->interface->copy(scan->data));
 
         if (!copy)
         {
-            pli_free_node(copy, plist->interface->free);
+            pli_free_node(result->pool, copy, plist->interface->free);
             return false;
         }
 
@@ -440,12 +633,40 @@ pli_copy(PriorityList_t *plist)
 PriorityList_t *
 pli_copy_shallow(PriorityList_t *plist)
 {
-    PriorityList_t *result = pli_new(plist->interface);
+    PriorityList_t *result = pli_create(plist->interface, plist->engine,
+                                        plist->key);
 
     if (!result)
         return NULL;
 
     result->limit = plist->limit;
+    result->pool = plist->pool;
+    result->last = plist->last;
+
+    if (plist->engine != PLI_SORTED)
+    {
+        PriorityListNode_t **nodes = pli_nodes(plist);
+
+        if (!nodes && !pli_empty(plist))
+        {
+            pli_free_shallow(result);
+            return NULL;
+        }
+
+        for (integer_t i = 0; i < plist->count; i++)
+        {
+            if (!pli_insert(result, nodes[i]->data))
+            {
+                pli_free_shallow(result);
+                free(nodes);
+                return NULL;
+            }
+        }
+
+        free(nodes);
+
+        return result;
+    }
 
     // scan -> goes through the original stack
     // copy -> current element being copied
@@ -454,11 +675,11 @@ pli_copy_shallow(PriorityList_t *plist)
 
     while (scan != NULL)
     {
-        copy = pli_new_node(scan->data);
+        copy = pli_new_node(result->pool, scan->data);
 
         if (!copy)
         {
-            pli_free_node_shallow(copy);
+            pli_free_node_shallow(result->pool, copy);
             return false;
         }
 
@@ -481,6 +702,8 @@ pli_copy_shallow(PriorityList_t *plist)
     return result;
 }
 
+/// Compares two priority lists element by element, in the order they would
+/// be removed.
 ///
 /// \param[in] plist1
 /// \param[in] plist2
@@ -489,20 +712,27 @@ pli_copy_shallow(PriorityList_t *plist)
 int
 pli_compare(PriorityList_t *plist1, PriorityList_t *plist2)
 {
-    PriorityListNode_t *scan1 = plist1->front, *scan2 = plist2->front;
+    void **elements1 = pli_ordered(plist1);
+    void **elements2 = pli_ordered(plist2);
+
+    integer_t length = plist1->count < plist2->count ? plist1->count
+                                                     : plist2->count;
 
     int comparison = 0;
-    while (scan1 != NULL && scan2 != NULL)
-    {
-        comparison = plist1->interface->compare(scan1->data, scan2->data);
-        if (comparison > 0)
-            return 1;
-        else if (comparison < 0)
-            return -1;
 
-        scan1 = scan1->next;
-        scan2 = scan2->next;
-    }
+    if (length > 0 && (!elements1 || !elements2))
+        length = 0;
+
+    for (integer_t i = 0; i < length && comparison == 0; i++)
+        comparison = plist1->interface->compare(elements1[i], elements2[i]);
+
+    free(elements1);
+    free(elements2);
+
+    if (comparison > 0)
+        return 1;
+    else if (comparison < 0)
+        return -1;
 
     // So far all elements were the same
     if (plist1->count > plist2->count)
@@ -513,7 +743,11 @@ pli_compare(PriorityList_t *plist1, PriorityList_t *plist2)
     return 0;
 }
 
-/// Merges list2 into list1, emptying the second.
+/// Merges list2 into list1, emptying the second. If both lists have the same
+/// engine and node pool and the result fits in the first list's limit, the
+/// nodes of the second list are moved without allocating. This takes O(1)
+/// with a pairing heap, O(n + m) with a sorted list and O(m) with a radix
+/// heap. Otherwise the elements are moved one by one.
 ///
 /// \warning Both lists must have the same interface and handling the same data
 /// type, otherwise you'll be mixing elements into a list that doesn't know how
@@ -526,6 +760,9 @@ pli_compare(PriorityList_t *plist1, PriorityList_t *plist2)
 bool
 pli_merge(PriorityList_t *plist1, PriorityList_t *plist2)
 {
+    if (pli_merge_nodes(plist1, plist2))
+        return true;
+
     void *result;
     while (!pli_empty(plist2))
     {
@@ -540,6 +777,8 @@ pli_merge(PriorityList_t *plist1, PriorityList_t *plist2)
     return true;
 }
 
+/// Makes a copy of every element of the priority list in the order they would
+/// be removed.
 ///
 /// \param[in] plist
 /// \param[in] length
@@ -553,19 +792,13 @@ pli_to_array(PriorityList_t *plist, integer_t *length)
     if (pli_empty(plist))
         return NULL;
 
-    void **array = malloc(sizeof(void*) * (size_t)plist->count);
+    void **array = pli_ordered(plist);
 
     if (!array)
         return NULL;
 
-    PriorityListNode_t *scan = plist->front;
-
-    integer_t i = 0;
-    while (scan != NULL)
-    {
-        array[i++] = plist->interface->copy(scan->data);
-        scan = scan->next;
-    }
+    for (integer_t i = 0; i < plist->count; i++)
+        array[i] = plist->interface->copy(array[i]);
 
     *length = plist->count;
 
@@ -584,80 +817,482 @@ pli_display(PriorityList_t *plist, int display_mode)
         return;
     }
 
-    PriorityListNode_t *scan = plist->front;
+    void **elements = pli_ordered(plist);
+
+    if (!elements)
+        return;
+
+    integer_t last = plist->count - 1;
 
     switch (display_mode)
     {
         case -1:
             printf("\nPriorityList\n");
-            while (scan != NULL)
+            for (integer_t i = 0; i <= last; i++)
             {
-                plist->interface->display(scan->data);
+                plist->interface->display(elements[i]);
                 printf("\n");
-                scan = scan->next;
             }
             break;
         case 0:
             printf("\nPriorityList\nHigh -> ");
-            while (scan->next != NULL)
+            for (integer_t i = 0; i < last; i++)
             {
-                plist->interface->display(scan->data);
+                plist->interface->display(elements[i]);
                 printf(" -> ");
-                scan = scan->next;
             }
-            plist->interface->display(scan->data);
+            plist->interface->display(elements[last]);
             printf(" Low\n");
             break;
         case 1:
             printf("\nPriorityList\n");
-            while (scan != NULL)
+            for (integer_t i = 0; i <= last; i++)
             {
-                plist->interface->display(scan->data);
+                plist->interface->display(elements[i]);
                 printf(" ");
-                scan = scan->next;
             }
             printf("\n");
             break;
         default:
             printf("\nPriorityList\n[ ");
-            while (scan->next != NULL)
+            for (integer_t i = 0; i < last; i++)
             {
-                plist->interface->display(scan->data);
+                plist->interface->display(elements[i]);
                 printf(", ");
             }
-            plist->interface->display(scan->data);
+            plist->interface->display(elements[last]);
             printf(" ]\n");
             break;
     }
+
+    free(elements);
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static PriorityListNode_t *
-pli_new_node(void *element)
+pli_new_node(NodePool_t *pool, void *element)
 {
-    PriorityListNode_t *node = malloc(sizeof(PriorityListNode_t));
+    PriorityListNode_t *node = npl_node_alloc(pool,
+            sizeof(PriorityListNode_t));
 
     if (!node)
         return NULL;
 
     node->data = element;
     node->next = NULL;
+    node->child = NULL;
+    node->key = 0;
 
     return node;
 }
 
 static void
-pli_free_node(PriorityListNode_t *node, free_f function)
+pli_free_node(NodePool_t *pool, PriorityListNode_t *node, free_f function)
 {
     function(node->data);
-    free(node);
+    npl_node_free(pool, node);
 }
 
 static void
-pli_free_node_shallow(PriorityListNode_t *node)
+pli_free_node_shallow(NodePool_t *pool, PriorityListNode_t *node)
 {
-    free(node);
+    npl_node_free(pool, node);
+}
+
+// Takes every node out of the priority list and returns them as a chain
+// linked through next. The count is not changed.
+static PriorityListNode_t *
+pli_unlink(PriorityList_t *plist)
+{
+    PriorityListNode_t *chain = NULL, *scan, *next;
+
+    if (plist->engine == PLI_RADIX)
+    {
+        for (integer_t i = 0; i < PLI_RADIX_BUCKETS; i++)
+        {
+            for (scan = plist->buckets[i]; scan != NULL; scan = next)
+            {
+                next = scan->next;
+                scan->next = chain;
+                chain = scan;
+            }
+
+            plist->buckets[i] = NULL;
+        }
+    }
+    else if (plist->engine == PLI_PAIRING)
+    {
+        // Rotates the first child of a node above it until the node has no
+        // children left, so every node is visited a constant amount of times
+        scan = plist->front;
+
+        while (scan != NULL)
+        {
+            if (scan->child != NULL)
+            {
+                PriorityListNode_t *child = scan->child;
+
+                scan->child = child->next;
+                child->next = scan;
+                scan = child;
+            }
+            else
+            {
+                next = scan->next;
+                scan->next = chain;
+                chain = scan;
+                scan = next;
+            }
+        }
+    }
+    else
+    {
+        chain = plist->front;
+    }
+
+    plist->front = NULL;
+
+    return chain;
+}
+
+// Adds a node to the priority list without changing its count
+static void
+pli_link(PriorityList_t *plist, PriorityListNode_t *node)
+{
+    if (plist->engine == PLI_RADIX)
+    {
+        integer_t i = pli_radix_index(plist->last, node->key);
+
+        node->next = plist->buckets[i];
+        plist->buckets[i] = node;
+    }
+    else if (plist->engine == PLI_PAIRING)
+    {
+        plist->front = pli_meld(plist, plist->front, node);
+    }
+    else if (plist->front == NULL)
+    {
+        // Case for the first node
+        plist->front = node;
+    }
+    else if (plist->interface->priority(node->data, plist->front->data) > 0)
+    {
+        // Case for when the front pointer needs to be changed
+        // The element has the highest priority in the list
+        node->next = plist->front;
+
+        plist->front = node;
+    }
+    else
+    {
+        PriorityListNode_t *scan = plist->front->next;
+        PriorityListNode_t *before = plist->front;
+
+        while (scan != NULL &&
+               plist->interface->priority(node->data, scan->data) <= 0)
+        {
+            before = scan;
+            scan = scan->next;
+        }
+
+        // Adding to the middle or to the end of the list
+        before->next = node;
+        node->next = scan;
+    }
+}
+
+// Links two pairing heap roots, making the one with the lower priority the
+// first child of the other
+static PriorityListNode_t *
+pli_meld(PriorityList_t *plist, PriorityListNode_t *node1,
+         PriorityListNode_t *node2)
+{
+    if (node1 == NULL)
+        return node2;
+    if (node2 == NULL)
+        return node1;
+
+    if (plist->interface->priority(node2->data, node1->data) > 0)
+    {
+        PriorityListNode_t *temp = node1;
+        node1 = node2;
+        node2 = temp;
+    }
+
+    node2->next = node1->child;
+    node1->child = node2;
+    node1->next = NULL;
+
+    return node1;
+}
+
+// Two-pass pairing of the children of a removed root. The first pass melds
+// the siblings in pairs from left to right and the second one melds the pairs
+// from right to left.
+static PriorityListNode_t *
+pli_pairs(PriorityList_t *plist, PriorityListNode_t *first)
+{
+    PriorityListNode_t *pairs = NULL, *node1, *node2, *root = NULL;
+
+    while (first != NULL)
+    {
+        node1 = first;
+        node2 = first->next;
+
+        first = node2 ? node2->next : NULL;
+
+        node1->next = NULL;
+        if (node2)
+            node2->next = NULL;
+
+        node1 = pli_meld(plist, node1, node2);
+
+        // The pairs are kept in reverse order
+        node1->next = pairs;
+        pairs = node1;
+    }
+
+    while (pairs != NULL)
+    {
+        node1 = pairs;
+        pairs = pairs->next;
+
+        node1->next = NULL;
+
+        root = pli_meld(plist, root, node1);
+    }
+
+    return root;
+}
+
+// Bucket of a key, given by the highest bit where it differs from the last
+// key removed
+static integer_t
+pli_radix_index(uint64_t last, uint64_t key)
+{
+    if (key == last)
+        return 0;
+
+    return 64 - __builtin_clzll(key ^ last);
+}
+
+// A node with the smallest key, which is in the first bucket that is not
+// empty. The radix heap must not be empty.
+static PriorityListNode_t *
+pli_radix_min(PriorityList_t *plist)
+{
+    integer_t i = 0;
+
+    while (plist->buckets[i] == NULL)
+        i++;
+
+    PriorityListNode_t *min = plist->buckets[i], *scan;
+
+    // Every key of the first bucket is the last key removed
+    if (i == 0)
+        return min;
+
+    for (scan = min->next; scan != NULL; scan = scan->next)
+    {
+        if (scan->key < min->key)
+            min = scan;
+    }
+
+    return min;
+}
+
+// Makes sure that the first bucket has the smallest keys. The first bucket
+// that is not empty is emptied into the lower buckets after its smallest key
+// becomes the last key removed. Each node can only move to lower buckets, so
+// it is moved at most 64 times. Only called when a node is removed.
+static void
+pli_radix_pull(PriorityList_t *plist)
+{
+    if (plist->buckets[0] != NULL)
+        return;
+
+    integer_t i = 1;
+
+    while (plist->buckets[i] == NULL)
+        i++;
+
+    uint64_t min = pli_radix_min(plist)->key;
+
+    PriorityListNode_t *scan, *next;
+
+    plist->last = min;
+
+    scan = plist->buckets[i];
+    plist->buckets[i] = NULL;
+
+    while (scan != NULL)
+    {
+        next = scan->next;
+
+        integer_t j = pli_radix_index(min, scan->key);
+
+        scan->next = plist->buckets[j];
+        plist->buckets[j] = scan;
+
+        scan = next;
+    }
+}
+
+// Returns every node of the priority list in no particular order. The
+// array has the length of the priority list and must be freed.
+static PriorityListNode_t **
+pli_nodes(PriorityList_t *plist)
+{
+    if (pli_empty(plist))
+        return NULL;
+
+    PriorityListNode_t **nodes = malloc(sizeof(PriorityListNode_t*) *
+                                        (size_t)plist->count);
+
+    if (!nodes)
+        return NULL;
+
+    integer_t length = 0;
+
+    if (plist->engine == PLI_RADIX)
+    {
+        for (integer_t i = 0; i < PLI_RADIX_BUCKETS; i++)
+        {
+            for (PriorityListNode_t *scan = plist->buckets[i]; scan != NULL;
+                 scan = scan->next)
+                nodes[length++] = scan;
+        }
+    }
+    else if (plist->engine == PLI_PAIRING)
+    {
+        // Breadth first, using the array itself as the queue
+        nodes[length++] = plist->front;
+
+        for (integer_t i = 0; i < length; i++)
+        {
+            for (PriorityListNode_t *scan = nodes[i]->child; scan != NULL;
+                 scan = scan->next)
+                nodes[length++] = scan;
+        }
+    }
+    else
+    {
+        for (PriorityListNode_t *scan = plist->front; scan != NULL;
+             scan = scan->next)
+            nodes[length++] = scan;
+    }
+
+    return nodes;
+}
+
+// Returns every element of the priority list in the order they would be
+// removed. The array has the length of the priority list and must be freed.
+static void **
+pli_ordered(PriorityList_t *plist)
+{
+    if (pli_empty(plist))
+        return NULL;
+
+    void **elements = malloc(sizeof(void*) * (size_t)plist->count);
+
+    if (!elements)
+        return NULL;
+
+    if (plist->engine == PLI_SORTED)
+    {
+        // The nodes are already sorted
+        integer_t i = 0;
+
+        for (PriorityListNode_t *scan = plist->front; scan != NULL;
+             scan = scan->next)
+            elements[i++] = scan->data;
+
+        return elements;
+    }
+
+    PriorityList_t *copy = pli_copy_shallow(plist);
+
+    if (!copy)
+    {
+        free(elements);
+        return NULL;
+    }
+
+    for (integer_t i = 0; pli_remove(copy, &elements[i]); i++);
+
+    pli_free_shallow(copy);
+
+    return elements;
+}
+
+// Moves all nodes of plist2 into plist1 without allocating. Returns false,
+// leaving both lists untouched, if they are not compatible.
+static bool
+pli_merge_nodes(PriorityList_t *plist1, PriorityList_t *plist2)
+{
+    if (pli_empty(plist2))
+        return true;
+
+    if (plist1->engine != plist2->engine || plist1->pool != plist2->pool)
+        return false;
+
+    if (plist1->limit > 0 && plist1->count + plist2->count > plist1->limit)
+        return false;
+
+    if (plist1->engine == PLI_RADIX)
+    {
+        // Every key must still be insertable in the first radix heap
+        if (pli_radix_min(plist2)->key < plist1->last)
+            return false;
+
+        PriorityListNode_t *scan = pli_unlink(plist2), *next;
+
+        while (scan != NULL)
+        {
+            next = scan->next;
+            pli_link(plist1, scan);
+            scan = next;
+        }
+    }
+    else if (plist1->engine == PLI_PAIRING)
+    {
+        plist1->front = pli_meld(plist1, plist1->front, plist2->front);
+    }
+    else
+    {
+        // Merges two sorted lists. Elements of the second list go after the
+        // elements of the first list with the same priority.
+        PriorityListNode_t *scan1 = plist1->front, *scan2 = plist2->front;
+        PriorityListNode_t **tail = &plist1->front;
+
+        while (scan1 != NULL && scan2 != NULL)
+        {
+            if (plist1->interface->priority(scan2->data, scan1->data) > 0)
+            {
+                *tail = scan2;
+                scan2 = scan2->next;
+            }
+            else
+            {
+                *tail = scan1;
+                scan1 = scan1->next;
+            }
+
+            tail = &(*tail)->next;
+        }
+
+        *tail = scan1 ? scan1 : scan2;
+    }
+
+    plist1->count += plist2->count;
+    plist1->version_id++;
+
+    plist2->front = NULL;
+    plist2->count = 0;
+    plist2->version_id++;
+
+    return true;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,523 @@
+/**
+ * @file QuantileSketch.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "QuantileSketch.h"
+#include <inttypes.h>
+
+/// Maximum amount of levels. A value at level \c h stands for 2^h values, so
+/// this is enough for any stream whose length fits in an unsigned_t.
+#define QSK_MAX_LEVELS 64
+
+/// Smallest accepted accuracy parameter.
+#define QSK_MIN_K 8
+
+/// A quantile sketch estimates the quantiles and ranks of a stream of numbers
+/// of any length. This is a KLL sketch: values are kept in levels, called
+/// compactors, where a value at level \c h stands for 2^h values of the
+/// stream. New values go to level 0. When the sketch is over its capacity the
+/// lowest level that is full is sorted and every other value is promoted to
+/// the next level, starting at a random one of the first two, while the rest
+/// are dropped. This halves the level and keeps the weight of the values.
+///
+/// The top level can hold \c k values and each level below it two thirds of
+/// the one above, down to 2 values. The sketch never keeps much more than
+/// <code> 3 * k </code> values and the error of a rank is about
+/// <code> 1.7 / k </code> of the stream's length. Sketches with the same \c k
+/// are merged by concatenating their levels and compacting again, so a
+/// sketch per thread can be combined at the end with the same error.
+///
+/// The exact minimum and maximum are kept apart and answer the quantiles 0
+/// and 1.
+///
+/// \par Functions
+/// Located in the file QuantileSketch.c
+struct QuantileSketch_s
+{
+    /// \brief Values kept at each level.
+    double *levels[QSK_MAX_LEVELS];
+
+    /// \brief Amount of values at each level.
+    integer_t sizes[QSK_MAX_LEVELS];
+
+    /// \brief Amount of values that fit in the buffer of each level.
+    integer_t allocated[QSK_MAX_LEVELS];
+
+    /// \brief Amount of levels in use, at least one.
+    integer_t height;
+
+    /// \brief Amount of values kept at the top level.
+    integer_t k;
+
+    /// \brief Amount of values inserted.
+    unsigned_t count;
+
+    /// \brief Lowest value inserted.
+    double min;
+
+    /// \brief Highest value inserted.
+    double max;
+
+    /// \brief State of the generator that chooses the values promoted.
+    uint64_t seed;
+};
+
+/// \brief A value and the amount of values of the stream it stands for.
+struct QuantileSketchItem_s
+{
+    double value;
+    unsigned_t weight;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+qsk_capacity(QuantileSketch_t *sketch, integer_t level);
+
+static bool
+qsk_reserve(QuantileSketch_t *sketch, integer_t level, integer_t amount);
+
+static void
+qsk_push(QuantileSketch_t *sketch, integer_t level, double value);
+
+static bool
+qsk_compress(QuantileSketch_t *sketch);
+
+static bool
+qsk_compact(QuantileSketch_t *sketch, integer_t level);
+
+static bool
+qsk_random_bit(QuantileSketch_t *sketch);
+
+static int
+qsk_compare_value(const void *value1, const void *value2);
+
+static int
+qsk_compare_item(const void *item1, const void *item2);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates an empty quantile sketch. A bigger \c k gives smaller errors at the
+/// cost of keeping more values; 200 keeps the rank error around 1%.
+///
+/// \param[in] k Amount of values kept at the top level, at least 8.
+///
+/// \return A new quantile sketch or NULL if allocation failed or \c k is too
+/// small.
+QuantileSketch_t *
+qsk_new(integer_t k)
+{
+    if (k < QSK_MIN_K)
+        return NULL;
+
+    QuantileSketch_t *sketch = malloc(sizeof(QuantileSketch_t));
+
+    if (!sketch)
+        return NULL;
+
+    for (integer_t i = 0; i < QSK_MAX_LEVELS; i++)
+    {
+        sketch->levels[i] = NULL;
+        sketch->sizes[i] = 0;
+        sketch->allocated[i] = 0;
+    }
+
+    sketch->height = 1;
+    sketch->k = k;
+    sketch->count = 0;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+    sketch->seed = ((uint64_t)(uintptr_t)sketch ^ (uint64_t)time(NULL))
+                   * UINT64_C(0x9e3779b97f4a7c15) | 1;
+
+    return sketch;
+}
+
+/// Frees from memory a QuantileSketch_s and the values it keeps.
+///
+/// \param[in] sketch The quantile sketch to be freed from memory.
+void
+qsk_free(QuantileSketch_t *sketch)
+{
+    for (integer_t i = 0; i < QSK_MAX_LEVELS; i++)
+        free(sketch->levels[i]);
+
+    free(sketch);
+}
+
+/// \param[in] sketch The quantile sketch.
+///
+/// \return The amount of values kept at the top level.
+integer_t
+qsk_k(QuantileSketch_t *sketch)
+{
+    return sketch->k;
+}
+
+/// \param[in] sketch The quantile sketch.
+///
+/// \return The amount of values inserted, including those of merged sketches.
+unsigned_t
+qsk_count(QuantileSketch_t *sketch)
+{
+    return sketch->count;
+}
+
+/// Returns the amount of values kept in all levels, which stays around
+/// <code> 3 * k </code> no matter how many values are inserted.
+///
+/// \param[in] sketch The quantile sketch.
+///
+/// \return The amount of values kept.
+integer_t
+qsk_retained(QuantileSketch_t *sketch)
+{
+    integer_t retained = 0;
+
+    for (integer_t i = 0; i < sketch->height; i++)
+        retained += sketch->sizes[i];
+
+    return retained;
+}
+
+/// Adds a value to the lowest level and compacts the sketch if it is over its
+/// capacity. Takes O(1) amortized.
+///
+/// \param[in] sketch The quantile sketch.
+/// \param[in] value The value to be added.
+///
+/// \return True if the value was added, false if it is NaN or if allocation
+/// failed.
+bool
+qsk_insert(QuantileSketch_t *sketch, double value)
+{
+    if (isnan(value) || !qsk_reserve(sketch, 0, 1))
+        return false;
+
+    qsk_push(sketch, 0, value);
+
+    sketch->count++;
+
+    if (value < sketch->min)
+        sketch->min = value;
+    if (value > sketch->max)
+        sketch->max = value;
+
+    return qsk_compress(sketch);
+}
+
+/// Estimates the value below which a given fraction of the stream lies, like
+/// 0.5 for the median or 0.99 for the 99th percentile. The quantiles 0 and 1
+/// are the exact minimum and maximum.
+///
+/// \param[in] sketch The quantile sketch.
+/// \param[in] quantile Fraction of the stream, between 0 and 1.
+/// \param[out] result The estimated value.
+///
+/// \return True if the value was estimated, false if the sketch is empty, the
+/// quantile is out of range or if allocation failed.
+bool
+qsk_quantile(QuantileSketch_t *sketch, double quantile, double *result)
+{
+    if (qsk_empty(sketch) || !(quantile >= 0.0 && quantile <= 1.0))
+        return false;
+
+    if (quantile == 0.0 || quantile == 1.0)
+    {
+        *result = quantile == 0.0 ? sketch->min : sketch->max;
+        return true;
+    }
+
+    integer_t size = qsk_retained(sketch), index = 0;
+
+    struct QuantileSketchItem_s *items =
+            malloc(sizeof(struct QuantileSketchItem_s) * (size_t)size);
+
+    if (!items)
+        return false;
+
+    for (integer_t h = 0; h < sketch->height; h++)
+    {
+        for (integer_t i = 0; i < sketch->sizes[h]; i++)
+        {
+            items[index].value = sketch->levels[h][i];
+            items[index].weight = (unsigned_t)1 << h;
+            index++;
+        }
+    }
+
+    qsort(items, (size_t)size, sizeof(struct QuantileSketchItem_s),
+          qsk_compare_item);
+
+    double target = quantile * (double)sketch->count;
+    unsigned_t weight = 0;
+
+    *result = sketch->max;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        weight += items[i].weight;
+
+        if ((double)weight >= target)
+        {
+            *result = items[i].value;
+            break;
+        }
+    }
+
+    free(items);
+
+    return true;
+}
+
+/// Estimates the fraction of the stream that is lower or equal to a value.
+/// Takes time linear in the amount of values kept and allocates nothing.
+///
+/// \param[in] sketch The quantile sketch.
+/// \param[in] value The value to be ranked.
+///
+/// \return The estimated rank, between 0 and 1, or 0 if the sketch is empty.
+double
+qsk_rank(QuantileSketch_t *sketch, double value)
+{
+    if (qsk_empty(sketch) || value < sketch->min)
+        return 0.0;
+
+    if (value >= sketch->max)
+        return 1.0;
+
+    unsigned_t weight = 0;
+
+    for (integer_t h = 0; h < sketch->height; h++)
+    {
+        for (integer_t i = 0; i < sketch->sizes[h]; i++)
+        {
+            if (sketch->levels[h][i] <= value)
+                weight += (unsigned_t)1 << h;
+        }
+    }
+
+    return (double)weight / (double)sketch->count;
+}
+
+/// \param[in] sketch The quantile sketch.
+///
+/// \return True if no values were inserted.
+bool
+qsk_empty(QuantileSketch_t *sketch)
+{
+    return sketch->count == 0;
+}
+
+/// Removes every value so the quantile sketch can be reused for a new
+/// stream. The buffers of the levels are kept.
+///
+/// \param[in] sketch The quantile sketch.
+void
+qsk_erase(QuantileSketch_t *sketch)
+{
+    for (integer_t i = 0; i < sketch->height; i++)
+        sketch->sizes[i] = 0;
+
+    sketch->height = 1;
+    sketch->count = 0;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+}
+
+/// Adds every value of \c sketch2 to \c sketch1, level by level, and then
+/// compacts \c sketch1 until it is within its capacity. The result has the
+/// same error guarantees as a sketch built from both streams. Both sketches
+/// must have the same \c k and \c sketch2 is left unchanged.
+///
+/// \param[in] sketch1 The quantile sketch that receives the values.
+/// \param[in] sketch2 The other quantile sketch.
+///
+/// \return True if the operation was successful, false if both sketches are
+/// the same, have a different \c k or if allocation failed, in which case
+/// \c sketch1 is left unchanged.
+bool
+qsk_merge(QuantileSketch_t *sketch1, QuantileSketch_t *sketch2)
+{
+    if (sketch1 == sketch2 || sketch1->k != sketch2->k)
+        return false;
+
+    for (integer_t h = 0; h < sketch2->height; h++)
+    {
+        if (!qsk_reserve(sketch1, h, sketch2->sizes[h]))
+            return false;
+    }
+
+    if (sketch2->height > sketch1->height)
+        sketch1->height = sketch2->height;
+
+    for (integer_t h = 0; h < sketch2->height; h++)
+    {
+        for (integer_t i = 0; i < sketch2->sizes[h]; i++)
+            qsk_push(sketch1, h, sketch2->levels[h][i]);
+    }
+
+    sketch1->count += sketch2->count;
+
+    if (sketch2->min < sketch1->min)
+        sketch1->min = sketch2->min;
+    if (sketch2->max > sketch1->max)
+        sketch1->max = sketch2->max;
+
+    return qsk_compress(sketch1);
+}
+
+/// \param[in] sketch The quantile sketch to be displayed.
+void
+qsk_display(QuantileSketch_t *sketch)
+{
+    printf("\nQuantileSketch\n");
+    printf("  k        : %" DS_PRI_INTEGER "\n", sketch->k);
+    printf("  count    : %" PRIuMAX "\n", sketch->count);
+    printf("  retained : %" DS_PRI_INTEGER "\n", qsk_retained(sketch));
+    printf("  levels   : %" DS_PRI_INTEGER "\n", sketch->height);
+
+    if (!qsk_empty(sketch))
+    {
+        printf("  min      : %lf\n", sketch->min);
+        printf("  max      : %lf\n", sketch->max);
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// The top level holds k values and each level below it two thirds of the one
+// above, but never less than two
+static integer_t
+qsk_capacity(QuantileSketch_t *sketch, integer_t level)
+{
+    double depth = (double)(sketch->height - 1 - level);
+    double capacity = ceil((double)sketch->k * pow(2.0 / 3.0, depth));
+
+    return capacity < 2.0 ? 2 : (integer_t)capacity;
+}
+
+// Makes room for an amount of values in a level, doubling its buffer until
+// they fit
+static bool
+qsk_reserve(QuantileSketch_t *sketch, integer_t level, integer_t amount)
+{
+    integer_t needed = sketch->sizes[level] + amount;
+
+    if (needed <= sketch->allocated[level])
+        return true;
+
+    integer_t allocated = sketch->allocated[level] == 0
+                          ? 8 : sketch->allocated[level];
+
+    while (allocated < needed)
+        allocated *= 2;
+
+    double *buffer = realloc(sketch->levels[level],
+                             sizeof(double) * (size_t)allocated);
+
+    if (!buffer)
+        return false;
+
+    sketch->levels[level] = buffer;
+    sketch->allocated[level] = allocated;
+
+    return true;
+}
+
+// Appends a value to a level that has room for it
+static void
+qsk_push(QuantileSketch_t *sketch, integer_t level, double value)
+{
+    sketch->levels[level][sketch->sizes[level]++] = value;
+}
+
+// While the sketch keeps more values than its capacity, the lowest level that
+// is full is compacted. Such a level always exists and every compaction drops
+// at least one value.
+static bool
+qsk_compress(QuantileSketch_t *sketch)
+{
+    for (;;)
+    {
+        integer_t retained = 0, capacity = 0, full = -1;
+
+        for (integer_t h = 0; h < sketch->height; h++)
+        {
+            integer_t level_capacity = qsk_capacity(sketch, h);
+
+            retained += sketch->sizes[h];
+            capacity += level_capacity;
+
+            if (full < 0 && sketch->sizes[h] >= level_capacity)
+                full = h;
+        }
+
+        if (retained <= capacity || full < 0)
+            return true;
+
+        if (!qsk_compact(sketch, full))
+            return false;
+    }
+}
+
+// Sorts a level and promotes every other value to the next one. With an odd
+// amount of values the lowest one stays behind.
+static bool
+qsk_compact(QuantileSketch_t *sketch, integer_t level)
+{
+    double *values = sketch->levels[level];
+    integer_t size = sketch->sizes[level];
+    integer_t odd = size & 1;
+
+    if (level + 1 == QSK_MAX_LEVELS
+        || !qsk_reserve(sketch, level + 1, size / 2))
+        return false;
+
+    if (level + 1 == sketch->height)
+        sketch->height++;
+
+    qsort(values, (size_t)size, sizeof(double), qsk_compare_value);
+
+    integer_t first = odd + (qsk_random_bit(sketch) ? 1 : 0);
+
+    for (integer_t i = first; i < size; i += 2)
+        qsk_push(sketch, level + 1, values[i]);
+
+    sketch->sizes[level] = odd;
+
+    return true;
+}
+
+// A xorshift generator kept by each sketch
+static bool
+qsk_random_bit(QuantileSketch_t *sketch)
+{
+    sketch->seed ^= sketch->seed >> 12;
+    sketch->seed ^= sketch->seed << 25;
+    sketch->seed ^= sketch->seed >> 27;
+
+    return ((sketch->seed * UINT64_C(0x2545f4914f6cdd1d)) >> 63) != 0;
+}
+
+static int
+qsk_compare_value(const void *value1, const void *value2)
+{
+    double a = *(const double *)value1, b = *(const double *)value2;
+
+    return (a > b) - (a < b);
+}
+
+static int
+qsk_compare_item(const void *item1, const void *item2)
+{
+    const struct QuantileSketchItem_s *a = item1, *b = item2;
+
+    return qsk_compare_value(&a->value, &b->value);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -7,6 +7,7 @@
  */
 
 #include "QueueArray.h"
+#include "Trace.h"
 
 /// A QueueArray_s is a buffered Queue_s with FIFO (First-in First-out) or LILO
 /// (Last-in Last-out) operations, so the first item added is the first one to
@@ -19,6 +20,14 @@
 /// right portion to the end of the buffer. This effectively decreases the
 /// amount of shifts needed.
 ///
+/// With qar_set_segmented() a full buffer is never reallocated. Instead it is
+/// kept as a segment, linked after the segments that came before it, and a new
+/// bigger buffer receives the next elements. Segments are only dequeued from
+/// and are freed once they are emptied, so growing never copies elements. With
+/// qar_set_shrink() the buffer is halved when it is only a quarter full, so
+/// memory is given back after bursts without alternating between growing and
+/// shrinking.
+///
 /// \par Advantages over QueueList_s
 /// - No need of pointers, only the data is allocated in memory
 ///
@@ -55,7 +64,8 @@ struct QueueArray_s
 
     /// \brief Current amount of elements in the \c QueueArray.
     ///
-    /// Current amount of elements in the \c QueueArray.
+    /// Current amount of elements in the \c QueueArray, including the ones in
+    /// segments.
     integer_t count;
 
     /// \brief \c QueueArray buffer maximum capacity.
@@ -71,18 +81,50 @@ struct QueueArray_s
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
 
+    /// \brief How the new capacity is calculated, see GrowthPolicy_e.
+    GrowthPolicy policy;
+
+    /// \brief Amount of elements added by DS_GROWTH_STEP.
+    integer_t step;
+
     /// \brief Flag for locked capacity.
     ///
     /// If \c locked is set to true the buffer will not grow and insertions
     /// won't be successful once the buffer gets filled up.
     bool locked;
 
+    /// \brief Flag for segmented growth.
+    ///
+    /// If set, a full buffer becomes a segment instead of being reallocated.
+    bool segmented;
+
+    /// \brief Flag for shrinking the buffer when it is mostly empty.
+    bool shrink;
+
+    /// \brief The buffer is never shrunk below this capacity.
+    ///
+    /// The initial capacity of the queue.
+    integer_t minimum;
+
+    /// \brief Amount of elements in segments.
+    ///
+    /// These are the oldest elements in the queue and are dequeued before the
+    /// ones in \c buffer.
+    integer_t frozen;
+
+    /// \brief The oldest segment or NULL if there are none.
+    struct QueueArraySegment_s *first;
+
+    /// \brief The newest segment or NULL if there are none.
+    struct QueueArraySegment_s *last;
+
     /// \brief QueueArray_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -90,17 +132,71 @@ struct QueueArray_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
 /// instead of a heap allocation.
 const unsigned_t qar_size = sizeof(QueueArray_t);
 
+/// \brief A full buffer that stopped receiving elements.
+///
+/// Implementation detail. A circular buffer that is only dequeued from, in
+/// a singly-linked list of segments from the oldest to the newest.
+struct QueueArraySegment_s
+{
+    /// \brief Data buffer.
+    void **buffer;
+
+    /// \brief Index of the front element.
+    integer_t front;
+
+    /// \brief Amount of elements left in the segment.
+    integer_t count;
+
+    /// \brief Buffer capacity.
+    integer_t capacity;
+
+    /// \brief The next (newer) segment or NULL.
+    struct QueueArraySegment_s *next;
+};
+
+/// \brief A type for a queue segment.
+///
+/// Defines a type to a <code> struct QueueArraySegment_s </code>.
+typedef struct QueueArraySegment_s QueueArraySegment_t;
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 bool
 static qar_grow(QueueArray_t *queue);
 
+static bool
+qar_freeze(QueueArray_t *queue, integer_t minimum);
+
+static integer_t
+qar_grown(QueueArray_t *queue, integer_t required);
+
+static void
+qar_shrink(QueueArray_t *queue);
+
+static void
+qar_copy_in(void **buffer, integer_t capacity, integer_t index,
+            void **elements, integer_t size);
+
+static void
+qar_copy_out(void **buffer, integer_t capacity, integer_t index,
+             void **result, integer_t size);
+
+static bool
+qar_resize(QueueArray_t *queue, integer_t capacity);
+
+static void **
+qar_at(QueueArray_t *queue, integer_t position);
+
+static void
+qar_free_segments(QueueArray_t *queue);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a QueueArray_s with an initial capacity of 32 and a growth rate
@@ -120,7 +216,7 @@ qar_new(Interface_t *interface)
     if (!queue)
         return NULL;
 
-    queue->buffer = malloc(sizeof(void*) * 32);
+    queue->buffer = ds_buffer_alloc(sizeof(void*) * 32);
 
     if (!(queue->buffer))
     {
@@ -133,11 +229,19 @@ qar_new(Interface_t *interface)
 
     queue->capacity = 32;
     queue->growth_rate = 200;
-    queue->version_id = 0;
+    DS_VERSION_RESET(queue);
     queue->count = 0;
     queue->front = 0;
     queue->rear = 0;
     queue->locked = false;
+    queue->segmented = false;
+    queue->shrink = false;
+    queue->policy = DS_GROWTH_GEOMETRIC;
+    queue->step = 0;
+    queue->minimum = 32;
+    queue->frozen = 0;
+    queue->first = NULL;
+    queue->last = NULL;
 
     queue->interface = interface;
 
@@ -163,7 +267,8 @@ qar_init(QueueArray_t *queue, Interface_t *interface,
     if (growth_rate <= 100 || initial_capacity <= 0)
         return false;
 
-    queue->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    queue->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!(queue->buffer))
         return false;
@@ -173,11 +278,19 @@ qar_init(QueueArray_t *queue, Interface_t *interface,
 
     queue->capacity = initial_capacity;
     queue->growth_rate = growth_rate;
-    queue->version_id = 0;
+    DS_VERSION_RESET(queue);
     queue->count = 0;
     queue->front = 0;
     queue->rear = 0;
     queue->locked = false;
+    queue->segmented = false;
+    queue->shrink = false;
+    queue->policy = DS_GROWTH_GEOMETRIC;
+    queue->step = 0;
+    queue->minimum = initial_capacity;
+    queue->frozen = 0;
+    queue->first = NULL;
+    queue->last = NULL;
 
     queue->interface = interface;
 
@@ -213,7 +326,8 @@ qar_create(Interface_t *interface, integer_t initial_capacity,
     if (!queue)
         return NULL;
 
-    queue->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    queue->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!(queue->buffer))
     {
@@ -226,11 +340,19 @@ qar_create(Interface_t *interface, integer_t initial_capacity,
 
     queue->capacity = initial_capacity;
     queue->growth_rate = growth_rate;
-    queue->version_id = 0;
+    DS_VERSION_RESET(queue);
     queue->count = 0;
     queue->front = 0;
     queue->rear = 0;
     queue->locked = false;
+    queue->segmented = false;
+    queue->shrink = false;
+    queue->policy = DS_GROWTH_GEOMETRIC;
+    queue->step = 0;
+    queue->minimum = initial_capacity;
+    queue->frozen = 0;
+    queue->first = NULL;
+    queue->last = NULL;
 
     queue->interface = interface;
 
@@ -246,12 +368,10 @@ qar_create(Interface_t *interface, integer_t initial_capacity,
 void
 qar_free(QueueArray_t *queue)
 {
-    for (integer_t i = queue->front, j = 0;
-            j < queue->count;
-            i = (i + 1) % queue->capacity, j++)
-    {
-        queue->interface->free(queue->buffer[i]);
-    }
+    for (integer_t i = 0; i < queue->count; i++)
+        interface_release(queue->interface, *qar_at(queue, i));
+
+    qar_free_segments(queue);
 
     free(queue->buffer);
 
@@ -268,6 +388,8 @@ qar_free(QueueArray_t *queue)
 void
 qar_free_shallow(QueueArray_t *queue)
 {
+    qar_free_segments(queue);
+
     free(queue->buffer);
 
     free(queue);
@@ -282,17 +404,19 @@ qar_free_shallow(QueueArray_t *queue)
 void
 qar_erase(QueueArray_t *queue)
 {
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count;
-         i = (i + 1) % queue->capacity, j++)
+    for (integer_t i = 0; i < queue->count; i++)
     {
-        queue->interface->free(queue->buffer[i]);
+        void **slot = qar_at(queue, i);
 
-        queue->buffer[i] = NULL;
+        interface_release(queue->interface, *slot);
+
+        *slot = NULL;
     }
 
+    qar_free_segments(queue);
+
     queue->count = 0;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
     queue->front = 0;
     queue->rear = 0;
 }
@@ -304,15 +428,13 @@ qar_erase(QueueArray_t *queue)
 void
 qar_erase_shallow(QueueArray_t *queue)
 {
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count;
-         i = (i + 1) % queue->capacity, j++)
-    {
-        queue->buffer[i] = NULL;
-    }
+    for (integer_t i = 0; i < queue->count; i++)
+        *qar_at(queue, i) = NULL;
+
+    qar_free_segments(queue);
 
     queue->count = 0;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
     queue->front = 0;
     queue->rear = 0;
 }
@@ -342,7 +464,8 @@ qar_count(QueueArray_t *queue)
     return queue->count;
 }
 
-/// Returns the current buffer's size of the specified queue.
+/// Returns the current buffer's size of the specified queue. Segments are not
+/// included since they no longer receive elements.
 /// \par Interface Requirements
 /// - None
 ///
@@ -368,6 +491,19 @@ qar_growth(QueueArray_t *queue)
     return queue->growth_rate;
 }
 
+/// Returns how the buffer grows.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return The buffer's growth policy.
+GrowthPolicy
+qar_policy(QueueArray_t *queue)
+{
+    return queue->policy;
+}
+
 /// Returns the boolean state of \c locked member.
 /// \par Interface Requirements
 /// - None
@@ -421,6 +557,97 @@ qar_capacity_unlock(QueueArray_t *queue)
     queue->locked = false;
 }
 
+/// Sets how the buffer grows. The buffer is grown with realloc(), so a big
+/// buffer can often be extended in place; DS_GROWTH_PAGES makes that more
+/// likely for buffers mapped directly by the allocator.
+///
+/// \param[in] queue The target queue.
+/// \param[in] policy The new growth policy.
+/// \param[in] step Amount of elements added on each growth by
+/// DS_GROWTH_STEP. Ignored by the other policies.
+///
+/// \return True if the policy was changed or false if the step is less than
+/// 1 for DS_GROWTH_STEP.
+bool
+qar_set_policy(QueueArray_t *queue, GrowthPolicy policy, integer_t step)
+{
+    if (policy == DS_GROWTH_STEP && step < 1)
+        return false;
+
+    queue->policy = policy;
+    queue->step = step;
+
+    return true;
+}
+
+/// Sets how the buffer grows. When segmented, a full buffer is kept as a
+/// segment and a new buffer, bigger according to the growth rate, receives
+/// the next elements. No element is ever copied, so enqueueing has no latency
+/// spikes. Otherwise the buffer is reallocated, which is the default.
+///
+/// \param[in] queue The target queue.
+/// \param[in] segmented True to grow by adding segments.
+void
+qar_set_segmented(QueueArray_t *queue, bool segmented)
+{
+    queue->segmented = segmented;
+}
+
+/// Makes the queue shrink its buffer to half of its capacity whenever it is a
+/// quarter full after a dequeue, but never below its initial capacity. Since
+/// the buffer is then half full, it takes many operations before it has to
+/// grow or shrink again. Buffers are not shrunk while there are segments.
+///
+/// \param[in] queue The target queue.
+/// \param[in] shrink True to shrink the buffer automatically.
+void
+qar_set_shrink(QueueArray_t *queue, bool shrink)
+{
+    queue->shrink = shrink;
+}
+
+/// Makes sure that the queue can hold at least a given amount of elements
+/// without growing. Segments are merged into the buffer. This works even if
+/// the capacity is locked.
+///
+/// \param[in] queue The target queue.
+/// \param[in] capacity Amount of elements the queue must be able to hold.
+///
+/// \return True if the buffer is big enough or false if allocation failed.
+bool
+qar_reserve(QueueArray_t *queue, integer_t capacity)
+{
+    if (capacity <= queue->capacity && queue->first == NULL)
+        return true;
+
+    if (capacity < queue->count)
+        capacity = queue->count;
+
+    if (!qar_resize(queue, capacity))
+        return false;
+
+    DS_VERSION_BUMP(queue);
+
+    return true;
+}
+
+/// Reallocates the buffer to the smallest capacity that holds every element,
+/// merging all segments. An empty queue keeps a capacity of one.
+///
+/// \param[in] queue The target queue.
+///
+/// \return True if the buffer was shrunk or false if allocation failed.
+bool
+qar_shrink_to_fit(QueueArray_t *queue)
+{
+    if (!qar_resize(queue, queue->count > 0 ? queue->count : 1))
+        return false;
+
+    DS_VERSION_BUMP(queue);
+
+    return true;
+}
+
 /// Inserts an element into the specified queue. The element is added at the
 /// \c rear index.
 /// \par Interface Requirements
@@ -434,10 +661,21 @@ qar_capacity_unlock(QueueArray_t *queue)
 bool
 qar_enqueue(QueueArray_t *queue, void *element)
 {
+    DS_TRACE_ENTRY(qar_enqueue, queue->count);
+
     if (qar_full(queue))
     {
-        if (!qar_grow(queue))
+        if (queue->locked)
+        {
+            DS_TRACE_RETURN(qar_enqueue, queue->count);
+            return false;
+        }
+
+        if (queue->segmented ? !qar_freeze(queue, 0) : !qar_grow(queue))
+        {
+            DS_TRACE_RETURN(qar_enqueue, queue->count);
             return false;
+        }
     }
 
     queue->buffer[queue->rear] = element;
@@ -445,7 +683,9 @@ qar_enqueue(QueueArray_t *queue, void *element)
     queue->rear = (queue->rear == queue->capacity - 1) ? 0 : queue->rear + 1;
 
     queue->count++;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
+
+    DS_TRACE_RETURN(qar_enqueue, queue->count);
 
     return true;
 }
@@ -468,18 +708,180 @@ qar_dequeue(QueueArray_t *queue, void **result)
     if (qar_empty(queue))
         return false;
 
-    *result = queue->buffer[queue->front];
+    if (queue->frozen > 0)
+    {
+        QueueArraySegment_t *segment = queue->first;
+
+        *result = segment->buffer[segment->front];
 
-    queue->buffer[queue->front] = NULL;
+        segment->front = (segment->front + 1) % segment->capacity;
+        segment->count--;
 
-    queue->front = (queue->front == queue->capacity - 1) ? 0 : queue->front +1;
+        queue->frozen--;
+
+        if (segment->count == 0)
+        {
+            queue->first = segment->next;
+
+            if (queue->first == NULL)
+                queue->last = NULL;
+
+            free(segment->buffer);
+            free(segment);
+        }
+    }
+    else
+    {
+        *result = queue->buffer[queue->front];
+
+        queue->buffer[queue->front] = NULL;
+
+        queue->front = (queue->front == queue->capacity - 1) ? 0
+                                                             : queue->front + 1;
+    }
 
     queue->count--;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
+
+    qar_shrink(queue);
+
+    return true;
+}
+
+/// Inserts a buffer of elements at the rear of the specified queue keeping
+/// their order, so the first element of the buffer is the first one to be
+/// removed. The capacity is checked once and the elements are copied with at
+/// most two memcpy() calls for each buffer they land in. Either every element
+/// is inserted or none of them.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The queue where the elements are to be inserted.
+/// \param[in] elements The elements to be inserted in the queue.
+/// \param[in] size The amount of elements in the buffer.
+///
+/// \return True if every element was added to the queue or false if the
+/// buffer reallocation failed or the queue buffer capacity is locked.
+bool
+qar_enqueue_n(QueueArray_t *queue, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return size == 0;
+
+    integer_t room = queue->capacity - (queue->count - queue->frozen);
+
+    if (room < size)
+    {
+        if (queue->locked)
+            return false;
+
+        if (!queue->segmented)
+        {
+            if (!qar_resize(queue, qar_grown(queue, queue->count + size)))
+                return false;
+
+            room = queue->capacity - queue->count;
+        }
+    }
+
+    integer_t head = room < size ? room : size;
+
+    qar_copy_in(queue->buffer, queue->capacity, queue->rear, elements, head);
+
+    if (head < size)
+    {
+        // A segmented queue fills up its buffer and freezes it. The indexes
+        // are only moved once the new buffer was allocated.
+        if (!qar_freeze(queue, size - head))
+            return false;
+
+        qar_copy_in(queue->buffer, queue->capacity, 0, elements + head,
+                    size - head);
+
+        queue->rear = (size - head) % queue->capacity;
+    }
+    else
+    {
+        queue->rear = (queue->rear + size) % queue->capacity;
+    }
+
+    queue->count += size;
+    DS_VERSION_BUMP(queue);
 
     return true;
 }
 
+/// Removes up to \c max elements from the front of the specified queue. They
+/// are stored in \c result in the order they were removed, so giving that
+/// buffer to qar_enqueue_n() preserves their order. Each buffer the elements
+/// are in is emptied with at most two memcpy() calls.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The queue where the elements are to be removed from.
+/// \param[out] result A buffer with room for at least \c max elements.
+/// \param[in] max The maximum amount of elements to be removed.
+///
+/// \return The amount of elements removed.
+integer_t
+qar_dequeue_n(QueueArray_t *queue, void **result, integer_t max)
+{
+    integer_t total = 0;
+
+    while (total < max && queue->frozen > 0)
+    {
+        QueueArraySegment_t *segment = queue->first;
+
+        integer_t size = segment->count < max - total ? segment->count
+                                                      : max - total;
+
+        qar_copy_out(segment->buffer, segment->capacity, segment->front,
+                     result + total, size);
+
+        segment->front = (segment->front + size) % segment->capacity;
+        segment->count -= size;
+
+        queue->frozen -= size;
+        total += size;
+
+        if (segment->count == 0)
+        {
+            queue->first = segment->next;
+
+            if (queue->first == NULL)
+                queue->last = NULL;
+
+            free(segment->buffer);
+            free(segment);
+        }
+    }
+
+    integer_t size = queue->count - total - queue->frozen;
+
+    if (size > max - total)
+        size = max - total;
+
+    if (size > 0)
+    {
+        qar_copy_out(queue->buffer, queue->capacity, queue->front,
+                     result + total, size);
+
+        queue->front = (queue->front + size) % queue->capacity;
+
+        total += size;
+    }
+
+    if (total > 0)
+    {
+        queue->count -= total;
+        DS_VERSION_BUMP(queue);
+
+        qar_shrink(queue);
+    }
+
+    return total;
+}
+
 /// Returns the element at the front of the queue, that is, the oldest element
 /// and the next one to be removed, or NULL if the queue is empty.
 /// \par Interface Requirements
@@ -495,7 +897,7 @@ qar_peek_front(QueueArray_t *queue)
     if (qar_empty(queue))
         return NULL;
 
-    return queue->buffer[queue->front];
+    return *qar_at(queue, 0);
 }
 
 /// Returns the element at the rear of the queue, that is, the newest element
@@ -544,7 +946,7 @@ qar_empty(QueueArray_t *queue)
 bool
 qar_full(QueueArray_t *queue)
 {
-    return queue->count == queue->capacity;
+    return queue->count - queue->frozen == queue->capacity;
 }
 
 /// Returns true if the specified size will fit in the queue's buffer without
@@ -558,7 +960,7 @@ qar_full(QueueArray_t *queue)
 bool
 qar_fits(QueueArray_t *queue, unsigned_t size)
 {
-    return (queue->count + size) <= queue->capacity;
+    return (queue->count - queue->frozen + size) <= queue->capacity;
 }
 
 /// Returns true if the element is present in the queue, otherwise false.
@@ -572,11 +974,9 @@ qar_fits(QueueArray_t *queue, unsigned_t size)
 bool
 qar_contains(QueueArray_t *queue, void *key)
 {
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count;
-         i = (i + 1) % queue->capacity, j++)
+    for (integer_t i = 0; i < queue->count; i++)
     {
-        if (queue->interface->compare(queue->buffer[i], key) == 0)
+        if (queue->interface->compare(*qar_at(queue, i), key) == 0)
             return true;
     }
 
@@ -594,23 +994,27 @@ qar_contains(QueueArray_t *queue, void *key)
 QueueArray_t *
 qar_copy(QueueArray_t *queue)
 {
-    QueueArray_t *new_queue = qar_create(queue->interface, queue->capacity,
+    integer_t capacity = queue->count > queue->capacity ? queue->count
+                                                        : queue->capacity;
+
+    QueueArray_t *new_queue = qar_create(queue->interface, capacity,
                                          queue->growth_rate);
 
     if (!new_queue)
         return NULL;
 
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count - 1;
-         i = (i + 1) % queue->capacity, j++)
-    {
-        new_queue->buffer[i] = queue->interface->copy(queue->buffer[i]);
-    }
+    for (integer_t i = 0; i < queue->count; i++)
+        new_queue->buffer[i] = 
+                interface_copy(queue->interface, *qar_at(queue, i));
 
-    new_queue->front = queue->front;
-    new_queue->rear = queue->rear;
+    new_queue->rear = queue->count == capacity ? 0 : queue->count;
     new_queue->count = queue->count;
     new_queue->locked = queue->locked;
+    new_queue->segmented = queue->segmented;
+    new_queue->shrink = queue->shrink;
+    new_queue->policy = queue->policy;
+    new_queue->step = queue->step;
+    new_queue->minimum = queue->minimum;
 
     return new_queue;
 }
@@ -626,23 +1030,26 @@ qar_copy(QueueArray_t *queue)
 QueueArray_t *
 qar_copy_shallow(QueueArray_t *queue)
 {
-    QueueArray_t *new_queue = qar_create(queue->interface, queue->capacity,
+    integer_t capacity = queue->count > queue->capacity ? queue->count
+                                                        : queue->capacity;
+
+    QueueArray_t *new_queue = qar_create(queue->interface, capacity,
                                          queue->growth_rate);
 
     if (!new_queue)
         return NULL;
 
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count - 1;
-         i = (i + 1) % queue->capacity, j++)
-    {
-        new_queue->buffer[i] = queue->buffer[i];
-    }
+    for (integer_t i = 0; i < queue->count; i++)
+        new_queue->buffer[i] = *qar_at(queue, i);
 
-    new_queue->front = queue->front;
-    new_queue->rear = queue->rear;
+    new_queue->rear = queue->count == capacity ? 0 : queue->count;
     new_queue->count = queue->count;
     new_queue->locked = queue->locked;
+    new_queue->segmented = queue->segmented;
+    new_queue->shrink = queue->shrink;
+    new_queue->policy = queue->policy;
+    new_queue->step = queue->step;
+    new_queue->minimum = queue->minimum;
 
     return new_queue;
 }
@@ -671,9 +1078,8 @@ qar_compare(QueueArray_t *queue1, QueueArray_t *queue2)
     {
         // Since its a circular buffer we need to calculate where the ith
         // element of each queue is.
-        comparison = queue1->interface->compare(
-                queue1->buffer[(i + queue1->front) % queue1->capacity],
-                queue2->buffer[(i + queue2->front) % queue2->capacity]);
+        comparison = queue1->interface->compare(*qar_at(queue1, i),
+                                                *qar_at(queue2, i));
         if (comparison > 0)
             return 1;
         else if (comparison < 0)
@@ -698,10 +1104,37 @@ qar_compare(QueueArray_t *queue1, QueueArray_t *queue2)
 /// \param[in] queue2 Queue where the elements are going to be taken from.
 ///
 /// \return True if all operations were successful, otherwise false.
+/// Nothing is moved if the queues are the same, if \c queue1 is locked and
+/// full or if allocation failed.
 bool
 qar_append(QueueArray_t *queue1, QueueArray_t *queue2)
 {
-    /// \todo qar_append
+    if (queue1 == queue2)
+        return false;
+
+    if (qar_empty(queue2))
+        return true;
+
+    // Makes room once so that no span below fails to be inserted
+    integer_t room = queue1->capacity - (queue1->count - queue1->frozen);
+
+    if (room < queue2->count)
+    {
+        if (queue1->locked ||
+            !qar_reserve(queue1, queue1->count + queue2->count))
+            return false;
+    }
+
+    void **span;
+
+    for (integer_t position = 0, size;
+         (size = qar_span(queue2, position, &span)) > 0; position += size)
+    {
+        qar_enqueue_n(queue1, span, size);
+    }
+
+    qar_erase_shallow(queue2);
+
     return true;
 }
 
@@ -726,18 +1159,99 @@ qar_to_array(QueueArray_t *queue, integer_t *length)
     if (!array)
         return NULL;
 
-    for (integer_t i = queue->front, j = 0;
-         j < queue->count;
-         i = (i + 1) % queue->capacity, j++)
-    {
-        array[i] = queue->interface->copy(queue->buffer[i]);
-    }
+    for (integer_t i = 0; i < queue->count; i++)
+        array[i] = interface_copy(queue->interface, *qar_at(queue, i));
 
     *length = queue->count;
 
     return array;
 }
 
+/// Moves all the elements of the queue to a C array, from the front element
+/// to the rear element, leaving the queue empty. Unlike qar_to_array() the
+/// elements are not copied, so they now belong to the caller.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The queue to be emptied.
+/// \param[out] length The resulting array's length.
+///
+/// \return The resulting array or NULL if the queue is empty or the array
+/// allocation failed, in which case the queue is left intact.
+void **
+qar_to_array_move(QueueArray_t *queue, integer_t *length)
+{
+    *length = 0;
+
+    if (qar_empty(queue))
+        return NULL;
+
+    void **array = malloc(sizeof(void*) * (size_t)queue->count);
+
+    if (!array)
+        return NULL;
+
+    *length = qar_dequeue_n(queue, array, queue->count);
+
+    return array;
+}
+
+/// Gives direct access to the elements stored contiguously from \c position,
+/// counting from the front of the queue. The circular buffer holds at most
+/// two spans, one up to the end of the buffer and one from its start, and
+/// each segment of a segmented queue holds two more. Calling this function
+/// again with \c position advanced by the returned amount visits them all in
+/// order.
+/// The span is invalidated by any change to the queue.
+///
+/// \param[in] queue QueueArray_s reference.
+/// \param[in] position Position of the first element of the span, counting
+/// from the front.
+/// \param[out] span Set to the first element of the span.
+///
+/// \return The amount of elements in the span or 0 if \c position is out of
+/// bounds.
+integer_t
+qar_span(QueueArray_t *queue, integer_t position, void ***span)
+{
+    *span = NULL;
+
+    if (position < 0 || position >= queue->count)
+        return 0;
+
+    void **buffer = queue->buffer;
+    integer_t front = queue->front;
+    integer_t count = queue->count - queue->frozen;
+    integer_t capacity = queue->capacity;
+
+    if (position < queue->frozen)
+    {
+        QueueArraySegment_t *segment = queue->first;
+
+        while (position >= segment->count)
+        {
+            position -= segment->count;
+            segment = segment->next;
+        }
+
+        buffer = segment->buffer;
+        front = segment->front;
+        count = segment->count;
+        capacity = segment->capacity;
+    }
+    else
+        position -= queue->frozen;
+
+    integer_t index = (front + position) % capacity;
+
+    *span = buffer + index;
+
+    // Up to the end of the elements or of the buffer, whichever comes first
+    return count - position < capacity - index ? count - position
+                                               : capacity - index;
+}
+
+#ifndef DS_NO_DISPLAY
 /// Displays a QueueArray_s in the console starting from the front element to
 /// the rear element. There are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -758,59 +1272,35 @@ qar_display(QueueArray_t *queue, int display_mode)
         return;
     }
 
+    const char *begin, *separator, *end;
+
     switch (display_mode)
     {
         case -1:
-            printf("\nQueueArray\n");
-            for (integer_t i = queue->front, j = 0;
-                 j < queue->count;
-                 i = (i + 1) % queue->capacity, j++)
-            {
-                queue->interface->display(queue->buffer[i]);
-                printf("\n");
-            }
+            begin = "\nQueueArray\n", separator = "\n", end = "\n";
             break;
         case 0:
-            printf("\nQueueArray\nFront -> ");
-            for (integer_t i = queue->front, j = 0;
-                 j < queue->count - 1;
-                 i = (i + 1) % queue->capacity, j++)
-            {
-                queue->interface->display(queue->buffer[i]);
-                printf(" -> ");
-            }
-            queue->interface->display(queue->buffer[
-                    (queue->rear == 0) ? queue->capacity - 1 : queue->rear - 1
-                    ]);
-            printf(" -> Rear\n");
+            begin = "\nQueueArray\nFront -> ", separator = " -> ";
+            end = " -> Rear\n";
             break;
         case 1:
-            printf("\nQueueArray\n");
-            for (integer_t i = queue->front, j = 0;
-                 j < queue->count;
-                 i = (i + 1) % queue->capacity, j++)
-            {
-                queue->interface->display(queue->buffer[i]);
-                printf(" ");
-            }
-            printf("\n");
+            begin = "\nQueueArray\n", separator = " ", end = " \n";
             break;
         default:
-            printf("\nQueueArray\n[ ");
-            for (integer_t i = queue->front, j = 0;
-                 j < queue->count - 1;
-                 i = (i + 1) % queue->capacity, j++)
-            {
-                queue->interface->display(queue->buffer[i]);
-                printf(", ");
-            }
-            queue->interface->display(queue->buffer[
-                    (queue->rear == 0) ? queue->capacity - 1 : queue->rear - 1
-                    ]);
-            printf(" ]\n");
+            begin = "\nQueueArray\n[ ", separator = ", ", end = " ]\n";
             break;
     }
+
+    printf("%s", begin);
+
+    for (integer_t i = 0; i < queue->count; i++)
+    {
+        queue->interface->display(*qar_at(queue, i));
+
+        printf("%s", i < queue->count - 1 ? separator : end);
+    }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
@@ -819,26 +1309,23 @@ qar_display(QueueArray_t *queue, int display_mode)
 bool
 static qar_grow(QueueArray_t *queue)
 {
-    if (queue->locked)
-        return false;
+    DS_TRACE_ENTRY(qar_grow, queue->capacity);
 
     integer_t old_capacity = queue->capacity;
 
-    // capacity = capacity * (growth_rate / 100)
-    queue->capacity = (integer_t) ((double) (queue->capacity) *
-            ((double) (queue->growth_rate) / 100.0));
+    queue->capacity = qar_grown(queue, 0);
 
-    // 4 is the minimum growth
-    if (queue->capacity - old_capacity < 4)
-        queue->capacity = old_capacity + 4;
-
-    void **new_buffer = realloc(queue->buffer,
+    void **new_buffer = ds_buffer_realloc(queue->buffer,
+            sizeof(void*) * (size_t)old_capacity,
             sizeof(void*) * (size_t)queue->capacity);
 
     // Reallocation failed
     if (!new_buffer)
     {
         queue->capacity = old_capacity;
+
+        DS_TRACE_RETURN(qar_grow, queue->capacity);
+
         return false;
     }
 
@@ -893,11 +1380,174 @@ static qar_grow(QueueArray_t *queue)
     // This should never happen. This function should never be called when the
     // buffer is not full (front == rear and count == capacity).
     else
+    {
+        DS_TRACE_RETURN(qar_grow, queue->capacity);
+        return false;
+    }
+
+    DS_TRACE_RETURN(qar_grow, queue->capacity);
+
+    return true;
+}
+
+// Turns the full buffer into the newest segment and starts a bigger one that
+// can hold at least a minimum amount of elements
+static bool
+qar_freeze(QueueArray_t *queue, integer_t minimum)
+{
+    QueueArraySegment_t *segment = malloc(sizeof(QueueArraySegment_t));
+
+    if (!segment)
+        return false;
+
+    integer_t capacity = qar_grown(queue, minimum);
+
+    void **buffer = ds_buffer_alloc(sizeof(void*) * (size_t)capacity);
+
+    if (!buffer)
+    {
+        free(segment);
+        return false;
+    }
+
+    segment->buffer = queue->buffer;
+    segment->front = queue->front;
+    segment->count = queue->capacity;
+    segment->capacity = queue->capacity;
+    segment->next = NULL;
+
+    if (queue->last == NULL)
+        queue->first = segment;
+    else
+        queue->last->next = segment;
+
+    queue->last = segment;
+    queue->frozen += queue->capacity;
+
+    queue->buffer = buffer;
+    queue->capacity = capacity;
+    queue->front = 0;
+    queue->rear = 0;
+
+    return true;
+}
+
+// The next capacity according to the growth policy, or the required one if
+// it is bigger
+static integer_t
+qar_grown(QueueArray_t *queue, integer_t required)
+{
+    return ds_grown_capacity(queue->policy, queue->capacity, required,
+                             queue->growth_rate, queue->step, sizeof(void*));
+}
+
+// Shrinking at a quarter to half of the capacity leaves room for both
+// enqueues and dequeues before the next reallocation
+static void
+qar_shrink(QueueArray_t *queue)
+{
+    if (queue->shrink && queue->first == NULL &&
+        queue->count <= queue->capacity / 4 &&
+        queue->capacity / 2 >= queue->minimum)
+    {
+        qar_resize(queue, queue->capacity / 2);
+    }
+}
+
+// Copies elements into a circular buffer starting at a given index. The part
+// that doesn't fit before the end of the buffer goes to its start.
+static void
+qar_copy_in(void **buffer, integer_t capacity, integer_t index,
+            void **elements, integer_t size)
+{
+    integer_t head = capacity - index < size ? capacity - index : size;
+
+    memcpy(buffer + index, elements, sizeof(void*) * (size_t)head);
+    memcpy(buffer, elements + head, sizeof(void*) * (size_t)(size - head));
+}
+
+// Copies elements out of a circular buffer starting at a given index
+static void
+qar_copy_out(void **buffer, integer_t capacity, integer_t index,
+             void **result, integer_t size)
+{
+    integer_t head = capacity - index < size ? capacity - index : size;
+
+    memcpy(result, buffer + index, sizeof(void*) * (size_t)head);
+    memcpy(result + head, buffer, sizeof(void*) * (size_t)(size - head));
+}
+
+// Moves every element to a new buffer, merging all segments. The capacity
+// must be at least the amount of elements in the queue.
+static bool
+qar_resize(QueueArray_t *queue, integer_t capacity)
+{
+    void **buffer = ds_buffer_alloc(sizeof(void*) * (size_t)capacity);
+
+    if (!buffer)
         return false;
 
+    for (integer_t i = 0; i < queue->count; i++)
+        buffer[i] = *qar_at(queue, i);
+
+    for (integer_t i = queue->count; i < capacity; i++)
+        buffer[i] = NULL;
+
+    qar_free_segments(queue);
+
+    free(queue->buffer);
+
+    queue->buffer = buffer;
+    queue->capacity = capacity;
+    queue->front = 0;
+    queue->rear = queue->count == capacity ? 0 : queue->count;
+
     return true;
 }
 
+// Returns where the element at a given position from the front is. Positions
+// inside segments cost one step for each segment before them.
+static void **
+qar_at(QueueArray_t *queue, integer_t position)
+{
+    if (position < queue->frozen)
+    {
+        QueueArraySegment_t *segment = queue->first;
+
+        while (position >= segment->count)
+        {
+            position -= segment->count;
+            segment = segment->next;
+        }
+
+        return &segment->buffer[(segment->front + position)
+                                % segment->capacity];
+    }
+
+    return &queue->buffer[(queue->front + position - queue->frozen)
+                          % queue->capacity];
+}
+
+static void
+qar_free_segments(QueueArray_t *queue)
+{
+    QueueArraySegment_t *segment = queue->first, *next;
+
+    while (segment != NULL)
+    {
+        next = segment->next;
+
+        free(segment->buffer);
+        free(segment);
+
+        segment = next;
+    }
+
+    queue->frozen = 0;
+    queue->first = NULL;
+    queue->last = NULL;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +53,13 @@
 /// - No random access
 /// - More memory usage as in every node there is a pointer to the next node
 ///
+/// Each node holds \c chunk elements, one by default. With qli_set_chunk() a
+/// node can hold many elements, like an unrolled linked list, so enqueuing
+/// only allocates once every \c chunk elements and the pointer overhead is
+/// shared between them. Only the front and the rear nodes can be partially
+/// filled. The last node emptied by qli_dequeue() is kept as a spare and
+/// reused by the next node allocation. An empty queue holds no nodes.
+///
 /// \par Functions
 /// Located in the file QueueList.c
 struct QueueList_s
@@ -62,6 +69,7 @@ struct QueueList_s
     /// Current amount of elements in the QueueList_s.
     integer_t count;
 
+#ifndef DS_NO_LIMIT
     /// \brief QueueList count limit.
     ///
     /// If it is set to 0 or a negative value then the queue has no limit to
@@ -71,6 +79,7 @@ struct QueueList_s
     /// limit the queue count if it already has more elements than the
     /// specified limit.
     integer_t limit;
+#endif
 
     /// \brief The front of the queue.
     ///
@@ -84,12 +93,37 @@ struct QueueList_s
     /// relative to this pointer.
     struct QueueListNode_s *rear;
 
+    /// \brief Index of the front element in the front node.
+    integer_t head;
+
+    /// \brief Index after the rear element in the rear node.
+    integer_t tail;
+
+    /// \brief Amount of elements each node holds.
+    ///
+    /// Set with qli_set_chunk(). It is 1 by default.
+    integer_t chunk;
+
+    /// \brief An empty node kept to be reused.
+    ///
+    /// Saves an allocation every time the front node is emptied and a new rear
+    /// node is needed, which happens at every chunk when the queue is used as
+    /// a buffer of roughly constant length. NULL if there is no spare node.
+    struct QueueListNode_s *spare;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief QueueList_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -97,6 +131,7 @@ struct QueueList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
@@ -105,21 +140,21 @@ const unsigned_t qli_size = sizeof(QueueList_t);
 
 /// \brief A QueueList_s node.
 ///
-/// Implementation detail. This is a singly-linked node. It has one data member
-/// and one pointer to the previous node or \c NULL if it is the last node
-/// added to the queue.
+/// Implementation detail. This is a singly-linked node. It has \c chunk data
+/// members and one pointer to the previous node or \c NULL if it is the last
+/// node added to the queue.
 struct QueueListNode_s
 {
-    /// \brief Data pointer.
+    /// \brief Previous node in the queue.
     ///
-    /// Points to node's data. The data needs to be dynamically allocated.
-    void *data;
+    /// Points to the previous node in the queue or \c NULL if this was the
+    /// last one added.
+    struct QueueListNode_s *prev;
 
-    /// \brief Previous element in the queue.
+    /// \brief Data pointers.
     ///
-    /// Points to the previous element in the queue or \c NULL if this was the
-    /// last one enqueued.
-    struct QueueListNode_s *prev;
+    /// Points to the node's data. The data needs to be dynamically allocated.
+    void *data[];
 };
 
 /// \brief A type for a queue node.
@@ -135,13 +170,19 @@ typedef struct QueueListNode_s *QueueListNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static QueueListNode_t *
-qli_new_node(void *element);
+qli_new_node(QueueList_t *queue);
 
 static void
-qli_free_node(QueueListNode_t *node, free_f function);
+qli_free_node(QueueList_t *queue, QueueListNode_t *node);
 
 static void
-qli_free_node_shallow(QueueListNode_t *node);
+qli_free_nodes(QueueList_t *queue, free_f function);
+
+static void
+qli_free_spare(QueueList_t *queue);
+
+static size_t
+qli_node_size(integer_t chunk);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -162,13 +203,7 @@ qli_new(Interface_t *interface)
     if (!queue)
         return NULL;
 
-    queue->count = 0;
-    queue->limit = 0;
-    queue->version_id = 0;
-    queue->front = NULL;
-    queue->rear = NULL;
-
-    queue->interface = interface;
+    qli_init(queue, interface);
 
     return queue;
 }
@@ -187,10 +222,17 @@ bool
 qli_init(QueueList_t *queue, Interface_t *interface)
 {
     queue->count = 0;
+#ifndef DS_NO_LIMIT
     queue->limit = 0;
-    queue->version_id = 0;
+#endif
+    DS_VERSION_RESET(queue);
     queue->front = NULL;
     queue->rear = NULL;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->chunk = 1;
+    queue->spare = NULL;
+    queue->pool = NULL;
     queue->interface = interface;
 
     return true;
@@ -205,16 +247,7 @@ qli_init(QueueList_t *queue, Interface_t *interface)
 void
 qli_free(QueueList_t *queue)
 {
-    QueueListNode_t *prev = queue->front;
-
-    while (queue->front != NULL)
-    {
-        queue->front = queue->front->prev;
-
-        qli_free_node(prev, queue->interface->free);
-
-        prev = queue->front;
-    }
+    qli_free_nodes(queue, queue->interface->free);
 
     free(queue);
 }
@@ -229,16 +262,7 @@ qli_free(QueueList_t *queue)
 void
 qli_free_shallow(QueueList_t *queue)
 {
-    QueueListNode_t *prev = queue->front;
-
-    while (queue->front != NULL)
-    {
-        queue->front = queue->front->prev;
-
-        qli_free_node_shallow(prev);
-
-        prev = queue->front;
-    }
+    qli_free_nodes(queue, NULL);
 
     free(queue);
 }
@@ -252,22 +276,10 @@ qli_free_shallow(QueueList_t *queue)
 void
 qli_erase(QueueList_t *queue)
 {
-    QueueListNode_t *prev = queue->front;
-
-    while (queue->front != NULL)
-    {
-        queue->front = queue->front->prev;
-
-        qli_free_node(prev, queue->interface->free);
-
-        prev = queue->front;
-    }
+    qli_free_nodes(queue, queue->interface->free);
 
     queue->count = 0;
-    queue->version_id++;
-
-    queue->front = NULL;
-    queue->rear = NULL;
+    DS_VERSION_BUMP(queue);
 }
 
 /// This function will reset the QueueList_s, freeing all of its nodes but not
@@ -280,22 +292,10 @@ qli_erase(QueueList_t *queue)
 void
 qli_erase_shallow(QueueList_t *queue)
 {
-    QueueListNode_t *prev = queue->front;
-
-    while (queue->front != NULL)
-    {
-        queue->front = queue->front->prev;
-
-        qli_free_node_shallow(prev);
-
-        prev = queue->front;
-    }
+    qli_free_nodes(queue, NULL);
 
     queue->count = 0;
-    queue->version_id++;
-
-    queue->front = NULL;
-    queue->rear = NULL;
+    DS_VERSION_BUMP(queue);
 }
 
 /// Sets a new interface for the specified QueueList_s.
@@ -323,6 +323,19 @@ qli_count(QueueList_t *queue)
     return queue->count;
 }
 
+/// Returns how many elements each node of the queue holds.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue QueueList_s reference.
+///
+/// \return The amount of elements per node.
+integer_t
+qli_chunk(QueueList_t *queue)
+{
+    return queue->chunk;
+}
+
 /// Returns the current queue limit.
 /// \par Interface Requirements
 /// - None
@@ -333,12 +346,19 @@ qli_count(QueueList_t *queue)
 integer_t
 qli_limit(QueueList_t *queue)
 {
+#ifdef DS_NO_LIMIT
+    (void)queue;
+
+    return 0;
+#else
     return queue->limit;
+#endif
 }
 
 /// Limit's the QueueList_s's length. You can only set a limit greater or equal
 /// to the queue's current length and greater than 0. To remove this limitation
-/// simply set the limit to 0 or less.
+/// simply set the limit to 0 or less. If compiled with DS_NO_LIMIT only 0 or
+/// less is accepted.
 ///
 /// \param[in] queue QueueList_s reference.
 /// \param[in] limit New queue limit.
@@ -348,12 +368,74 @@ qli_limit(QueueList_t *queue)
 bool
 qli_set_limit(QueueList_t *queue, integer_t limit)
 {
+#ifdef DS_NO_LIMIT
+    (void)queue;
+
+    return limit <= 0;
+#else
     // The new limit can't be lower than the queue's current length.
     if (queue->count > limit && limit > 0)
         return false;
 
     queue->limit = limit;
 
+    return true;
+#endif
+}
+
+/// Sets a node pool from where all nodes of the queue are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the queue is empty.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue QueueList_s reference.
+/// \param[in] pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the queue is not empty or if the pool's nodes are too
+/// small.
+bool
+qli_set_pool(QueueList_t *queue, NodePool_t *pool)
+{
+    if (!qli_empty(queue))
+        return false;
+
+    if (pool && !npl_fits(pool, qli_node_size(queue->chunk)))
+        return false;
+
+    queue->pool = pool;
+
+    return true;
+}
+
+/// Sets how many elements each node of the queue holds. Bigger nodes mean
+/// less allocations and less memory used by pointers, at the cost of up to
+/// two partially filled nodes. A chunk of 64 elements gives a throughput close
+/// to a QueueArray_s without ever copying the elements. The chunk can only be
+/// changed when the queue is empty and, if a node pool is set, its nodes must
+/// be big enough.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue QueueList_s reference.
+/// \param[in] chunk Amount of elements per node, 1 or more.
+///
+/// \return True if the chunk was set.
+/// \return False if the queue is not empty, if the chunk is less than 1 or if
+/// the pool's nodes are too small.
+bool
+qli_set_chunk(QueueList_t *queue, integer_t chunk)
+{
+    if (!qli_empty(queue) || chunk < 1)
+        return false;
+
+    if (queue->pool && !npl_fits(queue->pool, qli_node_size(chunk)))
+        return false;
+
+    queue->chunk = chunk;
+
     return true;
 }
 
@@ -373,24 +455,31 @@ qli_enqueue(QueueList_t *queue, void *element)
     if (qli_full(queue))
         return false;
 
-    QueueListNode_t *node = qli_new_node(element);
+    if (qli_empty(queue) || queue->tail == queue->chunk)
+    {
+        QueueListNode_t *node = qli_new_node(queue);
 
-    if (!node)
-        return false;
+        if (!node)
+            return false;
+
+        if (qli_empty(queue))
+        {
+            queue->front = node;
+            queue->head = 0;
+        }
+        else
+        {
+            queue->rear->prev = node;
+        }
 
-    if (qli_empty(queue))
-    {
-        queue->rear = node;
-        queue->front = node;
-    }
-    else
-    {
-        queue->rear->prev = node;
         queue->rear = node;
+        queue->tail = 0;
     }
 
+    queue->rear->data[queue->tail++] = element;
+
     queue->count++;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
 
     return true;
 }
@@ -415,20 +504,27 @@ qli_dequeue(QueueList_t *queue, void **result)
 
     QueueListNode_t *node = queue->front;
 
-    *result = node->data;
-
-    queue->front = queue->front->prev;
-
-    qli_free_node_shallow(node);
+    *result = node->data[queue->head++];
 
     queue->count--;
-    queue->version_id++;
+    DS_VERSION_BUMP(queue);
 
     if (qli_empty(queue))
     {
+        // An empty queue holds no nodes
+        npl_node_free(queue->pool, node);
+        qli_free_spare(queue);
+
         queue->front = NULL;
         queue->rear = NULL;
     }
+    else if (queue->head == queue->chunk)
+    {
+        queue->front = node->prev;
+        queue->head = 0;
+
+        qli_free_node(queue, node);
+    }
 
     return true;
 }
@@ -448,7 +544,7 @@ qli_peek_front(QueueList_t *queue)
     if (qli_empty(queue))
         return NULL;
 
-    return queue->front->data;
+    return queue->front->data[queue->head];
 }
 
 /// Returns the element at the rear of the queue, that is, the newest element
@@ -465,7 +561,7 @@ qli_peek_rear(QueueList_t *queue)
     if (qli_empty(queue))
         return NULL;
 
-    return queue->rear->data;
+    return queue->rear->data[queue->tail - 1];
 }
 
 /// Returns true if the queue is empty, or false if there are elements in the
@@ -494,7 +590,13 @@ qli_empty(QueueList_t *queue)
 bool
 qli_full(QueueList_t *queue)
 {
+#ifdef DS_NO_LIMIT
+    (void)queue;
+
+    return false;
+#else
     return queue->limit > 0 && queue->count >= queue->limit;
+#endif
 }
 
 /// Returns true if the specified size will fit in the queue before it reaches
@@ -509,10 +611,17 @@ qli_full(QueueList_t *queue)
 bool
 qli_fits(QueueList_t *queue, unsigned_t size)
 {
+#ifdef DS_NO_LIMIT
+    (void)queue;
+    (void)size;
+
+    return true;
+#else
     if (queue->limit <= 0)
         return true;
 
     return (queue->count + size) <= queue->limit;
+#endif
 }
 
 /// Returns true if the element is present in the queue, otherwise false.
@@ -528,12 +637,16 @@ qli_contains(QueueList_t *queue, void *key)
 {
     QueueListNode_t *scan = queue->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
     {
-        if (queue->interface->compare(scan->data, key) == 0)
+        if (queue->interface->compare(scan->data[index], key) == 0)
             return true;
 
-        scan = scan->prev;
+        if (++index == queue->chunk)
+        {
+            scan = scan->prev;
+            index = 0;
+        }
     }
 
     return false;
@@ -556,42 +669,32 @@ qli_copy(QueueList_t *queue)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = queue->limit;
+#endif
+    result->chunk = queue->chunk;
+    result->pool = queue->pool;
 
-    // scan -> goes through the original queue
-    // copy -> current element being copied
-    // prev -> copy's previous node to make the link
-    QueueListNode_t *prev = NULL, *copy = NULL, *scan = queue->front;
+    QueueListNode_t *scan = queue->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
     {
-        void *element = queue->interface->copy(scan->data);
-        copy = qli_new_node(element);
+        void *element = queue->interface->copy(scan->data[index]);
 
-        if (!copy)
+        if (!qli_enqueue(result, element))
         {
             queue->interface->free(element);
-            return false;
+            qli_free(result);
+            return NULL;
         }
 
-        if (prev == NULL)
-        {
-            prev = copy;
-            result->front = prev;
-        }
-        else
+        if (++index == queue->chunk)
         {
-            prev->prev = copy;
-            prev = prev->prev;
+            scan = scan->prev;
+            index = 0;
         }
-
-        scan = scan->prev;
     }
 
-    result->rear = copy;
-
-    result->count = queue->count;
-
     return result;
 }
 
@@ -611,41 +714,29 @@ qli_copy_shallow(QueueList_t *queue)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = queue->limit;
+#endif
+    result->chunk = queue->chunk;
+    result->pool = queue->pool;
 
-    // scan -> goes through the original queue
-    // copy -> current element being copied
-    // prev -> copy's previous node to make the link
-    QueueListNode_t *prev = NULL, *copy = NULL, *scan = queue->front;
+    QueueListNode_t *scan = queue->front;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
     {
-        copy = qli_new_node(scan->data);
-
-        if (!copy)
+        if (!qli_enqueue(result, scan->data[index]))
         {
-            qli_free_node_shallow(copy);
-            return false;
+            qli_free_shallow(result);
+            return NULL;
         }
 
-        if (prev == NULL)
-        {
-            prev = copy;
-            result->front = prev;
-        }
-        else
+        if (++index == queue->chunk)
         {
-            prev->prev = copy;
-            prev = prev->prev;
+            scan = scan->prev;
+            index = 0;
         }
-
-        scan = scan->prev;
     }
 
-    result->rear = copy;
-
-    result->count = queue->count;
-
     return result;
 }
 
@@ -666,17 +757,32 @@ qli_compare(QueueList_t *queue1, QueueList_t *queue2)
 {
     QueueListNode_t *scan1 = queue1->front, *scan2 = queue2->front;
 
+    integer_t index1 = queue1->head, index2 = queue2->head;
+
+    integer_t length = queue1->count < queue2->count ? queue1->count
+                                                     : queue2->count;
+
     int comparison = 0;
-    while (scan1 != NULL && scan2 != NULL)
+    for (integer_t i = 0; i < length; i++)
     {
-        comparison = queue1->interface->compare(scan1->data, scan2->data);
+        comparison = queue1->interface->compare(scan1->data[index1],
+                                                scan2->data[index2]);
         if (comparison > 0)
             return 1;
         else if (comparison < 0)
             return -1;
 
-        scan1 = scan1->prev;
-        scan2 = scan2->prev;
+        if (++index1 == queue1->chunk)
+        {
+            scan1 = scan1->prev;
+            index1 = 0;
+        }
+
+        if (++index2 == queue2->chunk)
+        {
+            scan2 = scan2->prev;
+            index2 = 0;
+        }
     }
 
     // So far all elements were the same
@@ -729,11 +835,15 @@ qli_to_array(QueueList_t *queue, integer_t *length)
 
     QueueListNode_t *scan = queue->front;
 
-    integer_t i = 0;
-    while (scan != NULL)
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
     {
-        array[i++] = queue->interface->copy(scan->data);
-        scan = scan->prev;
+        array[i] = queue->interface->copy(scan->data[index]);
+
+        if (++index == queue->chunk)
+        {
+            scan = scan->prev;
+            index = 0;
+        }
     }
 
     *length = queue->count;
@@ -741,6 +851,51 @@ qli_to_array(QueueList_t *queue, integer_t *length)
     return array;
 }
 
+/// Moves all the elements of the queue to a C array, from the front element
+/// to the rear element, leaving the queue empty. Unlike qli_to_array() the
+/// elements are not copied, so they now belong to the caller.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The queue to be emptied.
+/// \param[out] length The resulting array's length.
+///
+/// \return The resulting array or NULL if the queue is empty or the array
+/// allocation failed, in which case the queue is left intact.
+void **
+qli_to_array_move(QueueList_t *queue, integer_t *length)
+{
+    *length = 0;
+
+    if (qli_empty(queue))
+        return NULL;
+
+    void **array = malloc(sizeof(void*) * (size_t)queue->count);
+
+    if (!array)
+        return NULL;
+
+    QueueListNode_t *scan = queue->front;
+
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
+    {
+        array[i] = scan->data[index];
+
+        if (++index == queue->chunk)
+        {
+            scan = scan->prev;
+            index = 0;
+        }
+    }
+
+    *length = queue->count;
+
+    qli_erase_shallow(queue);
+
+    return array;
+}
+
+#ifndef DS_NO_DISPLAY
 /// Displays a QueueList_s in the console starting from the front element to
 /// the rear element. There are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -761,81 +916,111 @@ qli_display(QueueList_t *queue, int display_mode)
         return;
     }
 
-    QueueListNode_t *scan = queue->front;
+    const char *begin, *separator, *end;
 
     switch (display_mode)
     {
         case -1:
-            printf("\nQueueList\n");
-            while (scan != NULL)
-            {
-                queue->interface->display(scan->data);
-                printf("\n");
-                scan = scan->prev;
-            }
+            begin = "\nQueueList\n", separator = "\n", end = "\n";
             break;
         case 0:
-            printf("\nQueueList\nFront -> ");
-            while (scan->prev != NULL)
-            {
-                queue->interface->display(scan->data);
-                printf(" -> ");
-                scan = scan->prev;
-            }
-            queue->interface->display(scan->data);
-            printf(" Rear\n");
+            begin = "\nQueueList\nFront -> ", separator = " -> ";
+            end = " Rear\n";
             break;
         case 1:
-            printf("\nQueueList\n");
-            while (scan != NULL)
-            {
-                queue->interface->display(scan->data);
-                printf(" ");
-                scan = scan->prev;
-            }
-            printf("\n");
+            begin = "\nQueueList\n", separator = " ", end = " \n";
             break;
         default:
-            printf("\nQueueList\n[ ");
-            while (scan->prev != NULL)
-            {
-                queue->interface->display(scan->data);
-                printf(", ");
-                scan = scan->prev;
-            }
-            queue->interface->display(scan->data);
-            printf(" ]\n");
+            begin = "\nQueueList\n[ ", separator = ", ", end = " ]\n";
             break;
     }
+
+    QueueListNode_t *scan = queue->front;
+
+    printf("%s", begin);
+
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
+    {
+        queue->interface->display(scan->data[index]);
+
+        printf("%s", i < queue->count - 1 ? separator : end);
+
+        if (++index == queue->chunk)
+        {
+            scan = scan->prev;
+            index = 0;
+        }
+    }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static QueueListNode_t *
-qli_new_node(void *element)
+qli_new_node(QueueList_t *queue)
 {
-    QueueListNode_t *node = malloc(sizeof(QueueListNode_t));
+    QueueListNode_t *node = queue->spare;
+
+    if (node)
+        queue->spare = NULL;
+    else
+        node = npl_node_alloc(queue->pool, qli_node_size(queue->chunk));
 
     if (!node)
         return NULL;
 
-    node->data = element;
     node->prev = NULL;
 
     return node;
 }
 
 static void
-qli_free_node(QueueListNode_t *node, free_f function)
+qli_free_node(QueueList_t *queue, QueueListNode_t *node)
 {
-    function(node->data);
-    free(node);
+    if (queue->spare == NULL)
+        queue->spare = node;
+    else
+        npl_node_free(queue->pool, node);
 }
 
 static void
-qli_free_node_shallow(QueueListNode_t *node)
+qli_free_nodes(QueueList_t *queue, free_f function)
 {
-    free(node);
+    QueueListNode_t *scan = queue->front, *prev;
+
+    for (integer_t i = 0, index = queue->head; i < queue->count; i++)
+    {
+        if (function)
+            function(scan->data[index]);
+
+        if (++index == queue->chunk || i == queue->count - 1)
+        {
+            prev = scan->prev;
+            qli_free_node(queue, scan);
+            scan = prev;
+            index = 0;
+        }
+    }
+
+    queue->front = NULL;
+    queue->rear = NULL;
+
+    qli_free_spare(queue);
+}
+
+static void
+qli_free_spare(QueueList_t *queue)
+{
+    if (queue->spare)
+        npl_node_free(queue->pool, queue->spare);
+
+    queue->spare = NULL;
+}
+
+static size_t
+qli_node_size(integer_t chunk)
+{
+    return sizeof(QueueListNode_t) + sizeof(void*) * (size_t)chunk;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -845,7 +1030,7 @@ qli_free_node_shallow(QueueListNode_t *node)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// This iterator is a forward-only iterator. Its cursor is represented by a
-/// pointer to one of the queue's node.
+/// pointer to one of the queue's node and an index inside of it.
 struct QueueListIterator_s
 {
     /// \brief Target QueueList_s.
@@ -860,6 +1045,13 @@ struct QueueListIterator_s
     /// cursor pointing to the start (front) of the queue.
     struct QueueListNode_s *cursor;
 
+    /// \brief Index of the current element inside the cursor node.
+    integer_t index;
+
+    /// \brief Position of the current element, starting at the front.
+    integer_t position;
+
+#ifndef DS_NO_VERSION_ID
     /// \brief Target version ID.
     ///
     /// When the iterator is initialized it stores the version_id of the target
@@ -867,6 +1059,7 @@ struct QueueListIterator_s
     /// that may have been modified and thus causing undefined behaviours or
     /// run-time crashes.
     integer_t target_id;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -874,6 +1067,9 @@ struct QueueListIterator_s
 static bool
 qli_iter_target_modified(QueueListIterator_t *iter);
 
+static void
+qli_iter_move(QueueListIterator_t *iter, integer_t position);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///
@@ -892,8 +1088,9 @@ qli_iter_new(QueueList_t *target)
         return NULL;
 
     iter->target = target;
-    iter->target_id = target->version_id;
-    iter->cursor = target->front;
+    DS_VERSION_SYNC(iter, target);
+
+    qli_iter_move(iter, 0);
 
     return iter;
 }
@@ -910,8 +1107,9 @@ qli_iter_init(QueueListIterator_t *iter, QueueList_t *target)
         return false;
 
     iter->target = target;
-    iter->target_id = target->version_id;
-    iter->cursor = target->front;
+    DS_VERSION_SYNC(iter, target);
+
+    qli_iter_move(iter, 0);
 
     return true;
 }
@@ -923,7 +1121,9 @@ void
 qli_iter_retarget(QueueListIterator_t *iter, QueueList_t *target)
 {
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
+
+    qli_iter_move(iter, 0);
 }
 
 ///
@@ -947,7 +1147,13 @@ qli_iter_next(QueueListIterator_t *iter)
     if (!qli_iter_has_next(iter))
         return false;
 
-    iter->cursor = iter->cursor->prev;
+    if (++iter->index == iter->target->chunk)
+    {
+        iter->cursor = iter->cursor->prev;
+        iter->index = 0;
+    }
+
+    iter->position++;
 
     return true;
 }
@@ -962,7 +1168,7 @@ qli_iter_to_front(QueueListIterator_t *iter)
     if (qli_iter_target_modified(iter))
         return false;
 
-    iter->cursor = iter->target->front;
+    qli_iter_move(iter, 0);
 
     return true;
 }
@@ -977,7 +1183,7 @@ qli_iter_to_rear(QueueListIterator_t *iter)
     if (qli_iter_target_modified(iter))
         return false;
 
-    iter->cursor = iter->target->rear;
+    qli_iter_move(iter, iter->target->count - 1);
 
     return true;
 }
@@ -989,7 +1195,7 @@ qli_iter_to_rear(QueueListIterator_t *iter)
 bool
 qli_iter_has_next(QueueListIterator_t *iter)
 {
-    return iter->cursor->prev != NULL;
+    return iter->position + 1 < iter->target->count;
 }
 
 ///
@@ -1003,7 +1209,7 @@ qli_iter_get(QueueListIterator_t *iter, void **result)
     if (qli_iter_target_modified(iter))
         return false;
 
-    *result = iter->cursor->data;
+    *result = iter->cursor->data[iter->index];
 
     return true;
 }
@@ -1019,9 +1225,9 @@ qli_iter_set(QueueListIterator_t *iter, void *element)
     if (qli_iter_target_modified(iter))
         return false;
 
-    iter->target->interface->free(iter->cursor->data);
+    iter->target->interface->free(iter->cursor->data[iter->index]);
 
-    iter->cursor->data = element;
+    iter->cursor->data[iter->index] = element;
 
     return true;
 }
@@ -1039,7 +1245,10 @@ qli_iter_peek_next(QueueListIterator_t *iter)
     if (!qli_iter_has_next(iter))
         return NULL;
 
-    return iter->cursor->prev->data;
+    if (iter->index + 1 == iter->target->chunk)
+        return iter->cursor->prev->data[0];
+
+    return iter->cursor->data[iter->index + 1];
 }
 
 ///
@@ -1052,7 +1261,7 @@ qli_iter_peek(QueueListIterator_t *iter)
     if (qli_iter_target_modified(iter))
         return NULL;
 
-    return iter->cursor->data;
+    return iter->cursor->data[iter->index];
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -1060,7 +1269,32 @@ qli_iter_peek(QueueListIterator_t *iter)
 static bool
 qli_iter_target_modified(QueueListIterator_t *iter)
 {
-    return iter->target_id != iter->target->version_id;
+    return DS_VERSION_CHANGED(iter, iter->target);
+}
+
+// Moves the cursor to the element at a given position from the front
+static void
+qli_iter_move(QueueListIterator_t *iter, integer_t position)
+{
+    QueueList_t *queue = iter->target;
+
+    iter->cursor = NULL;
+    iter->index = 0;
+    iter->position = 0;
+
+    if (qli_empty(queue))
+        return;
+
+    // Index from the start of the front node
+    integer_t offset = queue->head + position;
+
+    iter->cursor = queue->front;
+
+    for (integer_t i = offset / queue->chunk; i > 0; i--)
+        iter->cursor = iter->cursor->prev;
+
+    iter->index = offset % queue->chunk;
+    iter->position = position;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,341 @@
+/**
+ * @file QueueMPMC.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "QueueMPMC.h"
+#include <stdatomic.h>
+
+/// A QueueMPMC_s is a fixed-capacity queue that can be used by any amount of
+/// producer and consumer threads at the same time without any locks. This is
+/// the bounded queue described by Dmitry Vyukov.
+///
+/// Every slot has a sequence number that says whose turn it is. A producer
+/// that wants the position \c p waits for the slot sequence to be \c p, claims
+/// the position by moving \c enqueue_pos forward, writes the element and sets
+/// the sequence to <code> p + 1 </code>. A consumer of the position \c p waits
+/// for the sequence to be <code> p + 1 </code>, claims it by moving
+/// \c dequeue_pos forward, reads the element and sets the sequence to
+/// <code> p + capacity </code>, which is the next position that will use the
+/// same slot. Producers and consumers only contend among themselves on their
+/// own position and on the slot they are using.
+///
+/// Batch operations claim several consecutive positions with a single
+/// compare-and-swap.
+///
+/// Elements are only stored as pointers and are never freed by the queue.
+///
+/// \par Functions
+/// Located in the file QueueMPMC.c
+struct QueueMPMC_s
+{
+    /// \brief Next position to be claimed by a producer.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) enqueue_pos;
+
+    /// \brief Next position to be claimed by a consumer.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) dequeue_pos;
+
+    /// \brief Slots of the queue.
+    ///
+    /// Never changes after initialization.
+    _Alignas(DS_CACHE_LINE) struct QueueMPMCCell_s *buffer;
+
+    /// \brief Amount of slots, a power of two.
+    unsigned_t capacity;
+
+    /// \brief <code> capacity - 1 </code>.
+    unsigned_t mask;
+
+    /// \brief Amount of times a thread had to retry claiming a position.
+    ///
+    /// Only written when a compare-and-swap loses a race.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) retries;
+};
+
+/// \brief A QueueMPMC_s slot.
+///
+/// Implementation detail.
+struct QueueMPMCCell_s
+{
+    /// \brief Position that can use this slot next.
+    _Atomic(unsigned_t) sequence;
+
+    /// \brief Element stored in this slot.
+    void *data;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+qmp_claim(QueueMPMC_t *queue, _Atomic(unsigned_t) *position,
+          unsigned_t offset, integer_t count, unsigned_t *start);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new QueueMPMC_s. The capacity is rounded up to the next
+/// power of two and is at least two.
+///
+/// \param[in] capacity Minimum amount of elements the queue can hold.
+///
+/// \return A new QueueMPMC_s or NULL if allocation failed or the capacity is
+/// not positive.
+QueueMPMC_t *
+qmp_new(integer_t capacity)
+{
+    if (capacity < 1 || capacity > DS_INTEGER_MAX / 2)
+        return NULL;
+
+    unsigned_t slots = 2;
+
+    while (slots < (unsigned_t)capacity)
+        slots <<= 1;
+
+    QueueMPMC_t *queue = aligned_alloc(DS_CACHE_LINE, sizeof(QueueMPMC_t));
+
+    if (!queue)
+        return NULL;
+
+    queue->buffer = malloc(sizeof(struct QueueMPMCCell_s) * slots);
+
+    if (!queue->buffer)
+    {
+        free(queue);
+        return NULL;
+    }
+
+    for (unsigned_t i = 0; i < slots; i++)
+    {
+        atomic_init(&queue->buffer[i].sequence, i);
+        queue->buffer[i].data = NULL;
+    }
+
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->retries, 0);
+
+    queue->capacity = slots;
+    queue->mask = slots - 1;
+
+    return queue;
+}
+
+/// Frees from memory a QueueMPMC_s. No thread can be using the queue.
+///
+/// \param[in] queue The queue to be freed from memory.
+void
+qmp_free(QueueMPMC_t *queue)
+{
+    free(queue->buffer);
+
+    free(queue);
+}
+
+/// \param[in] queue The queue.
+///
+/// \return The maximum amount of elements in the queue.
+integer_t
+qmp_capacity(QueueMPMC_t *queue)
+{
+    return (integer_t)queue->capacity;
+}
+
+/// The result is exact only if no thread is using the queue. Positions that
+/// were claimed but are still being written or read are counted as used.
+///
+/// \param[in] queue The queue.
+///
+/// \return The amount of elements in the queue.
+integer_t
+qmp_count(QueueMPMC_t *queue)
+{
+    unsigned_t dequeue = atomic_load_explicit(&queue->dequeue_pos,
+                                              memory_order_acquire);
+    unsigned_t enqueue = atomic_load_explicit(&queue->enqueue_pos,
+                                              memory_order_acquire);
+
+    unsigned_t count = enqueue - dequeue;
+
+    return (integer_t)(count > queue->capacity ? queue->capacity : count);
+}
+
+/// Counts how many times a producer or a consumer lost the race for a
+/// position to another thread, a measure of contention on the queue.
+///
+/// \param[in] queue The queue.
+///
+/// \return The amount of retries since the queue was created.
+unsigned_t
+qmp_retries(QueueMPMC_t *queue)
+{
+    return atomic_load_explicit(&queue->retries, memory_order_relaxed);
+}
+
+/// Inserts an element at the back of the queue.
+///
+/// \param[in] queue The queue.
+/// \param[in] element The element to be inserted.
+///
+/// \return False if the queue is full.
+bool
+qmp_try_enqueue(QueueMPMC_t *queue, void *element)
+{
+    return qmp_enqueue_batch(queue, &element, 1) == 1;
+}
+
+/// Removes the element at the front of the queue.
+///
+/// \param[in] queue The queue.
+/// \param[out] result Resulting element removed from the queue.
+///
+/// \return False if the queue is empty.
+bool
+qmp_try_dequeue(QueueMPMC_t *queue, void **result)
+{
+    return qmp_dequeue_batch(queue, result, 1) == 1;
+}
+
+/// Inserts elements from a buffer in order until the queue is full. The
+/// inserted elements are consecutive in the queue, no other producer can
+/// insert elements between them.
+///
+/// \param[in] queue The queue.
+/// \param[in] elements Buffer of elements to be inserted.
+/// \param[in] count Amount of elements in the buffer.
+///
+/// \return The amount of elements inserted from the start of the buffer.
+integer_t
+qmp_enqueue_batch(QueueMPMC_t *queue, void **elements, integer_t count)
+{
+    unsigned_t start;
+
+    integer_t total = qmp_claim(queue, &queue->enqueue_pos, 0, count, &start);
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        unsigned_t position = start + (unsigned_t)i;
+
+        struct QueueMPMCCell_s *cell = &queue->buffer[position & queue->mask];
+
+        cell->data = elements[i];
+
+        atomic_store_explicit(&cell->sequence, position + 1,
+                              memory_order_release);
+    }
+
+    return total;
+}
+
+/// Removes consecutive elements from the front of the queue until it is
+/// empty or the buffer is full.
+///
+/// \param[in] queue The queue.
+/// \param[out] results Buffer that receives the removed elements.
+/// \param[in] count Size of the buffer.
+///
+/// \return The amount of elements removed.
+integer_t
+qmp_dequeue_batch(QueueMPMC_t *queue, void **results, integer_t count)
+{
+    unsigned_t start;
+
+    integer_t total = qmp_claim(queue, &queue->dequeue_pos, 1, count, &start);
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        unsigned_t position = start + (unsigned_t)i;
+
+        struct QueueMPMCCell_s *cell = &queue->buffer[position & queue->mask];
+
+        results[i] = cell->data;
+
+        atomic_store_explicit(&cell->sequence, position + queue->capacity,
+                              memory_order_release);
+    }
+
+    return total;
+}
+
+/// \param[in] queue The queue.
+///
+/// \return True if the queue had no elements.
+bool
+qmp_empty(QueueMPMC_t *queue)
+{
+    return qmp_count(queue) == 0;
+}
+
+/// \param[in] queue The queue.
+///
+/// \return True if the queue had no free slots.
+bool
+qmp_full(QueueMPMC_t *queue)
+{
+    return qmp_count(queue) == (integer_t)queue->capacity;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Claims up to count consecutive positions from either enqueue_pos or
+// dequeue_pos. A slot is ready for the position p when its sequence is
+// p + offset, that is, 0 for producers and 1 for consumers. Retries while
+// other threads move the position and returns 0 only when the first slot is
+// not ready, meaning the queue is full or empty.
+static integer_t
+qmp_claim(QueueMPMC_t *queue, _Atomic(unsigned_t) *position,
+          unsigned_t offset, integer_t count, unsigned_t *start)
+{
+    if (count < 1)
+        return 0;
+
+    if ((unsigned_t)count > queue->capacity)
+        count = (integer_t)queue->capacity;
+
+    unsigned_t current = atomic_load_explicit(position, memory_order_relaxed);
+
+    for (;;)
+    {
+        integer_t ready = 0;
+
+        while (ready < count)
+        {
+            unsigned_t p = current + (unsigned_t)ready;
+
+            unsigned_t sequence = atomic_load_explicit(
+                    &queue->buffer[p & queue->mask].sequence,
+                    memory_order_acquire);
+
+            integer_t difference = (integer_t)(sequence - (p + offset));
+
+            if (difference != 0)
+            {
+                // The first slot is one lap behind, nothing to claim
+                if (ready == 0 && difference < 0)
+                    return 0;
+
+                break;
+            }
+
+            ready++;
+        }
+
+        if (ready > 0 && atomic_compare_exchange_weak_explicit(
+                position, &current, current + (unsigned_t)ready,
+                memory_order_relaxed, memory_order_relaxed))
+        {
+            *start = current;
+
+            return ready;
+        }
+
+        // Another thread claimed the position first
+        if (ready == 0)
+            current = atomic_load_explicit(position, memory_order_relaxed);
+
+        atomic_fetch_add_explicit(&queue->retries, 1, memory_order_relaxed);
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,278 @@
+/**
+ * @file QueueSPSC.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "QueueSPSC.h"
+#include <stdatomic.h>
+
+/// A QueueSPSC_s is a fixed-capacity ring buffer that can be used by exactly
+/// one producer thread and one consumer thread at the same time without any
+/// locks. Every operation finishes in a bounded amount of steps.
+///
+/// The producer owns \c tail and the consumer owns \c head; each of them only
+/// reads the index of the other side with acquire semantics. Each side also
+/// keeps a private copy of the other index so it only touches the other
+/// cache line when the queue looks full or empty.
+///
+/// Indexes are never wrapped. The slot of an index is <code> index & mask
+/// </code>, which is why the capacity is always a power of two.
+///
+/// Elements are only stored as pointers and are never freed by the queue.
+///
+/// \par Functions
+/// Located in the file QueueSPSC.c
+struct QueueSPSC_s
+{
+    /// \brief Index of the next element to be dequeued.
+    ///
+    /// Written by the consumer.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) head;
+
+    /// \brief Last value of \c tail seen by the consumer.
+    unsigned_t cached_tail;
+
+    /// \brief Index of the next free slot.
+    ///
+    /// Written by the producer.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) tail;
+
+    /// \brief Last value of \c head seen by the producer.
+    unsigned_t cached_head;
+
+    /// \brief Slots of the ring buffer.
+    ///
+    /// Never changes after initialization.
+    _Alignas(DS_CACHE_LINE) void **buffer;
+
+    /// \brief Amount of slots, a power of two.
+    unsigned_t capacity;
+
+    /// \brief <code> capacity - 1 </code>.
+    unsigned_t mask;
+};
+
+/// Initializes a new QueueSPSC_s. The capacity is rounded up to the next
+/// power of two.
+///
+/// \param[in] capacity Minimum amount of elements the queue can hold.
+///
+/// \return A new QueueSPSC_s or NULL if allocation failed or the capacity is
+/// not positive.
+QueueSPSC_t *
+qsp_new(integer_t capacity)
+{
+    if (capacity < 1 || capacity > DS_INTEGER_MAX / 2)
+        return NULL;
+
+    unsigned_t slots = 1;
+
+    while (slots < (unsigned_t)capacity)
+        slots <<= 1;
+
+    QueueSPSC_t *queue = aligned_alloc(DS_CACHE_LINE, sizeof(QueueSPSC_t));
+
+    if (!queue)
+        return NULL;
+
+    queue->buffer = malloc(sizeof(void*) * slots);
+
+    if (!queue->buffer)
+    {
+        free(queue);
+        return NULL;
+    }
+
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+    queue->capacity = slots;
+    queue->mask = slots - 1;
+
+    return queue;
+}
+
+/// Frees from memory a QueueSPSC_s. No thread can be using the queue.
+///
+/// \param[in] queue The queue to be freed from memory.
+void
+qsp_free(QueueSPSC_t *queue)
+{
+    free(queue->buffer);
+
+    free(queue);
+}
+
+/// \param[in] queue The queue.
+///
+/// \return The maximum amount of elements in the queue.
+integer_t
+qsp_capacity(QueueSPSC_t *queue)
+{
+    return (integer_t)queue->capacity;
+}
+
+/// The result is exact only if no thread is using the queue.
+///
+/// \param[in] queue The queue.
+///
+/// \return The amount of elements in the queue.
+integer_t
+qsp_count(QueueSPSC_t *queue)
+{
+    unsigned_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    unsigned_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return (integer_t)(tail - head);
+}
+
+/// Inserts an element at the back of the queue. Must only be called by the
+/// producer thread.
+///
+/// \param[in] queue The queue.
+/// \param[in] element The element to be inserted.
+///
+/// \return False if the queue is full.
+bool
+qsp_try_enqueue(QueueSPSC_t *queue, void *element)
+{
+    unsigned_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    if (tail - queue->cached_head == queue->capacity)
+    {
+        queue->cached_head = atomic_load_explicit(&queue->head,
+                                                  memory_order_acquire);
+
+        if (tail - queue->cached_head == queue->capacity)
+            return false;
+    }
+
+    queue->buffer[tail & queue->mask] = element;
+
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return true;
+}
+
+/// Removes the element at the front of the queue. Must only be called by the
+/// consumer thread.
+///
+/// \param[in] queue The queue.
+/// \param[out] result Resulting element removed from the queue.
+///
+/// \return False if the queue is empty.
+bool
+qsp_try_dequeue(QueueSPSC_t *queue, void **result)
+{
+    unsigned_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (head == queue->cached_tail)
+    {
+        queue->cached_tail = atomic_load_explicit(&queue->tail,
+                                                  memory_order_acquire);
+
+        if (head == queue->cached_tail)
+            return false;
+    }
+
+    *result = queue->buffer[head & queue->mask];
+
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return true;
+}
+
+/// Inserts elements from a buffer in order until the queue is full. All of
+/// them are published to the consumer at once. Must only be called by the
+/// producer thread.
+///
+/// \param[in] queue The queue.
+/// \param[in] elements Buffer of elements to be inserted.
+/// \param[in] count Amount of elements in the buffer.
+///
+/// \return The amount of elements inserted from the start of the buffer.
+integer_t
+qsp_enqueue_batch(QueueSPSC_t *queue, void **elements, integer_t count)
+{
+    if (count < 1)
+        return 0;
+
+    unsigned_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned_t space = queue->capacity - (tail - queue->cached_head);
+
+    if (space < (unsigned_t)count)
+    {
+        queue->cached_head = atomic_load_explicit(&queue->head,
+                                                  memory_order_acquire);
+
+        space = queue->capacity - (tail - queue->cached_head);
+    }
+
+    unsigned_t total = space < (unsigned_t)count ? space : (unsigned_t)count;
+
+    for (unsigned_t i = 0; i < total; i++)
+        queue->buffer[(tail + i) & queue->mask] = elements[i];
+
+    atomic_store_explicit(&queue->tail, tail + total, memory_order_release);
+
+    return (integer_t)total;
+}
+
+/// Removes elements from the front of the queue until it is empty or the
+/// buffer is full. Must only be called by the consumer thread.
+///
+/// \param[in] queue The queue.
+/// \param[out] results Buffer that receives the removed elements.
+/// \param[in] count Size of the buffer.
+///
+/// \return The amount of elements removed.
+integer_t
+qsp_dequeue_batch(QueueSPSC_t *queue, void **results, integer_t count)
+{
+    if (count < 1)
+        return 0;
+
+    unsigned_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    unsigned_t available = queue->cached_tail - head;
+
+    if (available < (unsigned_t)count)
+    {
+        queue->cached_tail = atomic_load_explicit(&queue->tail,
+                                                  memory_order_acquire);
+
+        available = queue->cached_tail - head;
+    }
+
+    unsigned_t total = available < (unsigned_t)count ? available
+                                                     : (unsigned_t)count;
+
+    for (unsigned_t i = 0; i < total; i++)
+        results[i] = queue->buffer[(head + i) & queue->mask];
+
+    atomic_store_explicit(&queue->head, head + total, memory_order_release);
+
+    return (integer_t)total;
+}
+
+/// \param[in] queue The queue.
+///
+/// \return True if the queue had no elements.
+bool
+qsp_empty(QueueSPSC_t *queue)
+{
+    return qsp_count(queue) == 0;
+}
+
+/// \param[in] queue The queue.
+///
+/// \return True if the queue had no free slots.
+bool
+qsp_full(QueueSPSC_t *queue)
+{
+    return qsp_count(queue) == (integer_t)queue->capacity;
+}
@@ -7,6 +7,22 @@
  */
 
 #include "RedBlackTree.h"
+#include "Snapshot.h"
+#include "Sort.h"
+#include "Trace.h"
+#include <pthread.h>
+
+/// A batch given to rbt_insert_all() is merged by rebuilding the tree when
+/// it has at least one element for every this many elements in the tree.
+#define RBT_BULK_RATIO 8
+
+/// An upper bound on the nodes a persistent insertion or removal copies for
+/// every level of the tree it goes through.
+#define RBT_COPIES_PER_LEVEL 10
+
+/// An upper bound on the height of a red-black tree, which is never more than
+/// <code> 2 * log2(n + 1) </code> for \c n elements.
+#define RBT_MAX_HEIGHT 128
 
 /// A red-black tree is a binary search tree where each node has a color, which
 /// can be either \c RED or \c BLACK. By constraining the node colors on any
@@ -53,6 +69,12 @@ struct RedBlackTree_s
     /// The root element of a red-black tree.
     struct RedBlackTreeNode_s *root;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief RedBlackTree_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
@@ -66,6 +88,31 @@ struct RedBlackTree_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief If subtree sizes are maintained.
+    ///
+    /// When true, every node keeps the amount of nodes in its subtree, which
+    /// allows rbt_select() and rbt_rank() to run in logarithmic time. Disabled
+    /// by default since it costs an extra walk to the root on insertions and
+    /// removals.
+    bool ranked;
+
+    /// \brief If equal elements are accepted.
+    ///
+    /// When true, an element equal to one already in the tree is grouped with
+    /// it in the same node instead of being refused. See
+    /// rbt_set_multiple_keys().
+    bool multiple;
+
+    /// \brief Versions still reachable from snapshots.
+    ///
+    /// Only set while the tree is persistent, see rbt_set_persistent().
+    struct RedBlackTreeHistory_s *history;
+
+#ifdef DS_STATS
+    /// \brief Operation counters, see rbt_stats().
+    ContainerStats_t stats;
+#endif
 };
 
 /// \brief A RedBlackTree_s node.
@@ -84,6 +131,11 @@ struct RedBlackTreeNode_s
     /// If true, the node is black, if false, the node is red.
     bool color;
 
+    /// \brief If a retired node frees its element when it is reclaimed.
+    ///
+    /// Only used by persistent trees.
+    bool release;
+
     /// \brief A pointer to its right child.
     ///
     /// A pointer to its right child where its element is greater than the
@@ -100,8 +152,31 @@ struct RedBlackTreeNode_s
 
     /// \brief Pointer to parent node.
     ///
-    /// Pointer to parent node or NULL if this is the root node.
+    /// Pointer to parent node or NULL if this is the root node. Persistent
+    /// trees share nodes between versions, so they don't keep it and use it
+    /// instead to chain their retired and spare nodes.
     struct RedBlackTreeNode_s *parent;
+
+    union
+    {
+        /// \brief Amount of nodes in this subtree, including itself.
+        ///
+        /// Only valid if the tree is ranked.
+        integer_t count;
+
+        /// \brief Version where the node was created or, once retired, the
+        /// version where it left the tree.
+        ///
+        /// Only used by persistent trees, which are never ranked.
+        integer_t version;
+
+        /// \brief Every element equal to the key, starting with it, or NULL if
+        /// the key is the only one.
+        ///
+        /// Only used by trees with multiple keys, which are never ranked or
+        /// persistent.
+        struct RedBlackTreeGroup_s *group;
+    };
 };
 
 /// \brief A type for a red-black tree node.
@@ -114,25 +189,111 @@ typedef struct RedBlackTreeNode_s RedBlackTreeNode_t;
 /// Defines a pointer type to a <code> struct RedBlackTreeNode_s </code>.
 typedef struct RedBlackTreeNode_s *RedBlackTreeNode;
 
+/// \brief Elements of a tree with multiple keys that compare equal.
+///
+/// Implementation detail. Kept by the node of the first of them, so that they
+/// can be given as a single span.
+struct RedBlackTreeGroup_s
+{
+    /// \brief Amount of elements.
+    integer_t count;
+
+    /// \brief Amount of elements the group can hold before growing.
+    integer_t capacity;
+
+    /// \brief The elements, starting with the key of the node.
+    void *elements[];
+};
+
+/// The versions of a persistent RedBlackTree_s that are still in use. The tree
+/// is a left-leaning red-black tree that copies every node it has to change
+/// if a live snapshot might see it, so the changes of an operation are made on
+/// a new path from the root while older versions stay untouched. Nodes that
+/// leave the tree are retired instead of freed, and are reclaimed by the
+/// writer once the oldest live snapshot is newer than them.
+///
+/// Only the list of snapshots is shared with the threads that release them
+/// and it is protected by a mutex. Everything else is only used by the thread
+/// that changes the tree.
+struct RedBlackTreeHistory_s
+{
+    /// \brief Protects the list of live snapshots.
+    pthread_mutex_t lock;
+
+    /// \brief Oldest and newest live snapshots.
+    struct RedBlackTreeSnapshot_s *oldest, *newest;
+
+    /// \brief Version of the newest snapshot taken.
+    ///
+    /// Nodes created up to this version might be seen by a snapshot.
+    integer_t frozen;
+
+    /// \brief If a snapshot was alive when the operation started.
+    bool shared;
+
+    /// \brief Retired nodes chained from the oldest to the newest.
+    struct RedBlackTreeNode_s *retired, *last_retired;
+
+    /// \brief Nodes reserved for the copies of the current operation.
+    struct RedBlackTreeNode_s *spare;
+
+    /// \brief Amount of nodes reserved.
+    integer_t spares;
+};
+
+/// An immutable version of a persistent RedBlackTree_s. It only holds the root
+/// of the tree at the moment it was taken, so it can be read from any thread
+/// without locks while the tree keeps changing.
+struct RedBlackTreeSnapshot_s
+{
+    /// \brief The root of this version.
+    struct RedBlackTreeNode_s *root;
+
+    /// \brief The amount of elements in this version.
+    integer_t size;
+
+    /// \brief The version_id of the tree when the snapshot was taken.
+    integer_t version;
+
+    /// \brief The interface of the tree.
+    struct Interface_s *interface;
+
+    /// \brief The history where the snapshot is listed.
+    struct RedBlackTreeHistory_s *history;
+
+    /// \brief Older and newer live snapshots.
+    struct RedBlackTreeSnapshot_s *older, *newer;
+};
+
 static const bool BLACK = true;
 static const bool RED = false;
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static RedBlackTreeNode_t *
-rbt_new_node(void *element);
+rbt_new_node(NodePool_t *pool, void *element);
 
 static void
-rbt_free_node(RedBlackTreeNode_t *node, free_f function);
+rbt_free_node(NodePool_t *pool, RedBlackTreeNode_t *node, free_f function);
 
 static void
-rbt_free_node_shallow(RedBlackTreeNode_t *node);
+rbt_free_node_shallow(NodePool_t *pool, RedBlackTreeNode_t *node);
 
 static void
-rbt_free_tree(RedBlackTreeNode_t *root, free_f function);
+rbt_free_tree(NodePool_t *pool, RedBlackTreeNode_t *root, free_f function);
+
+static void
+rbt_free_tree_shallow(NodePool_t *pool, RedBlackTreeNode_t *root);
+
+static bool
+rbt_insert_node(RedBlackTree_t *tree, void *element,
+                RedBlackTreeNode_t **found);
+
+static bool
+rbt_group_add(RedBlackTreeNode_t *node, void *element);
 
 static void
-rbt_free_tree_shallow(RedBlackTreeNode_t *root);
+rbt_group_free_all(RedBlackTree_t *tree, free_f function);
 
 // Rotations, re-balancing and other things to maintain the red-black tree's
 // properties
@@ -146,7 +307,8 @@ static void
 rbt_insert_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *Z);
 
 static void
-rbt_remove_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *X);
+rbt_remove_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *X,
+        RedBlackTreeNode_t *P);
 
 static RedBlackTreeNode_t *
 rbt_find(RedBlackTree_t *tree, void *element);
@@ -186,16 +348,151 @@ rbt_display_treeview(RedBlackTreeNode_t *root, integer_t depth, char *path,
 
 // Traversal
 static void
-rbt_traversal_preorder(RedBlackTreeNode_t *root, display_f function);
+rbt_traversal_preorder(RedBlackTree_t *tree, visit_f visit, void *argument);
+
+static void
+rbt_traversal_inorder(RedBlackTree_t *tree, visit_f visit, void *argument,
+                      bool leaves);
+
+static void
+rbt_traversal_postorder(RedBlackTree_t *tree, visit_f visit, void *argument);
+
+static bool
+rbt_traversal_levelorder(RedBlackTree_t *tree, visit_f visit, void *argument);
+
+static void
+rbt_traversal_visit(RedBlackTree_t *tree, RedBlackTreeNode_t *node,
+                    visit_f visit, void *argument);
+
+static void
+rbt_traversal_display(void *element, void *argument);
+
+static RedBlackTreeNode_t *
+rbt_bound(RedBlackTree_t *tree, void *element, bool upper);
+
+static integer_t
+rbt_node_count(RedBlackTreeNode_t *node);
+
+static integer_t
+rbt_count_update(RedBlackTreeNode_t *node);
+
+static integer_t
+rbt_count_tree(RedBlackTreeNode_t *root);
+
+static RedBlackTreeNode_t *
+rbt_predecessor(RedBlackTreeNode_t *N);
+
+static void
+rbt_build(RedBlackTree_t *tree, RedBlackTreeNode_t **nodes, integer_t size);
+
+static RedBlackTreeNode_t *
+rbt_build_subtree(RedBlackTreeNode_t **nodes, integer_t size,
+                  RedBlackTreeNode_t *parent, integer_t depth, integer_t red);
+
+// Join-based set operations
+static void
+rbt_expose(RedBlackTreeNode_t *N);
+
+static integer_t
+rbt_black_height(RedBlackTreeNode_t *N);
+
+static RedBlackTreeNode_t *
+rbt_join_node(RedBlackTree_t *tree, RedBlackTreeNode_t *L,
+              RedBlackTreeNode_t *K, RedBlackTreeNode_t *R);
+
+static RedBlackTreeNode_t *
+rbt_join_subtrees(RedBlackTree_t *tree, RedBlackTreeNode_t *L,
+                  RedBlackTreeNode_t *R);
+
+static void
+rbt_split_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T, void *element,
+                RedBlackTreeNode_t **L, RedBlackTreeNode_t **K,
+                RedBlackTreeNode_t **R);
+
+static RedBlackTreeNode_t *
+rbt_split_last(RedBlackTree_t *tree, RedBlackTreeNode_t *T,
+               RedBlackTreeNode_t **K);
+
+static RedBlackTreeNode_t *
+rbt_union_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                RedBlackTreeNode_t *T2, integer_t *found);
+
+static RedBlackTreeNode_t *
+rbt_intersection_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                       RedBlackTreeNode_t *T2, integer_t *found);
+
+static RedBlackTreeNode_t *
+rbt_difference_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                     RedBlackTreeNode_t *T2, integer_t *found);
+
+static bool
+rbt_save_tree(RedBlackTree_t *tree, RedBlackTreeNode_t *root, FILE *stream);
+
+static integer_t
+rbt_range_nodes(Interface_t *interface, RedBlackTreeNode_t *root, void *low,
+                void *high, visit_f visit, void *argument);
+
+static void
+rbt_history_delete(RedBlackTree_t *tree);
+
+static void
+rbt_history_begin(RedBlackTree_t *tree);
+
+static bool
+rbt_history_reserve(RedBlackTree_t *tree);
+
+static RedBlackTreeNode_t *
+rbt_history_node(RedBlackTree_t *tree, void *element);
+
+static void
+rbt_history_retire(RedBlackTree_t *tree, RedBlackTreeNode_t *node,
+                   bool release);
 
 static void
-rbt_traversal_inorder(RedBlackTreeNode_t *root, display_f function);
+rbt_history_retire_tree(RedBlackTree_t *tree, RedBlackTreeNode_t *root,
+                        bool release);
+
+static RedBlackTreeNode_t *
+rbt_history_own(RedBlackTree_t *tree, RedBlackTreeNode_t *node);
+
+static bool
+rbt_history_insert(RedBlackTree_t *tree, void *element);
+
+static bool
+rbt_history_remove(RedBlackTree_t *tree, void *element);
+
+static RedBlackTreeNode_t *
+rbt_history_insert_node(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                        RedBlackTreeNode_t *node);
+
+static RedBlackTreeNode_t *
+rbt_history_remove_node(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                        void *element);
+
+static RedBlackTreeNode_t *
+rbt_history_remove_min(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                       RedBlackTreeNode_t **min);
+
+static RedBlackTreeNode_t *
+rbt_history_rotate_left(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
+
+static RedBlackTreeNode_t *
+rbt_history_rotate_right(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
 
 static void
-rbt_traversal_postorder(RedBlackTreeNode_t *root, display_f function);
+rbt_history_flip(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
+
+static RedBlackTreeNode_t *
+rbt_history_move_red_left(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
+
+static RedBlackTreeNode_t *
+rbt_history_move_red_right(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
+
+static RedBlackTreeNode_t *
+rbt_history_balance(RedBlackTree_t *tree, RedBlackTreeNode_t *h);
 
 static void
-rbt_traversal_leaves(RedBlackTreeNode_t *root, display_f function);
+rbt_history_link(RedBlackTreeNode_t *root, RedBlackTreeNode_t *parent);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -220,15 +517,91 @@ rbt_new(Interface_t *interface)
     tree->size = 0;
     tree->limit = 0;
     tree->version_id = 0;
+    tree->ranked = false;
+    tree->multiple = false;
     tree->root = NULL;
+    tree->history = NULL;
 
+    tree->pool = NULL;
     tree->interface = interface;
 
+    DS_STATS_RESET(tree);
+    DS_STATS_ADD(tree, allocations, 1);
+
+    return tree;
+}
+
+/// Builds a perfectly balanced RedBlackTree_s from a buffer of elements sorted
+/// in ascending order without duplicates. Every node is linked once, without
+/// any comparisons besides checking the order, so it takes linear time instead
+/// of one descent and rebalance per element. On success the tree takes
+/// ownership of the elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param interface An interface defining all necessary functions for the
+/// red-black tree to operate.
+/// \param elements Buffer of sorted elements.
+/// \param size Amount of elements in the buffer.
+///
+/// \return A new RedBlackTree_s or NULL if allocation failed or the elements
+/// are not sorted and unique.
+RedBlackTree_t *
+rbt_from_sorted_array(Interface_t *interface, void **elements,
+                      integer_t size)
+{
+    if (size < 0)
+        return NULL;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (interface->compare(elements[i - 1], elements[i]) >= 0)
+            return NULL;
+    }
+
+    RedBlackTree_t *tree = rbt_new(interface);
+
+    if (!tree || size == 0)
+        return tree;
+
+    RedBlackTreeNode_t **nodes =
+            malloc(sizeof(RedBlackTreeNode_t*) * (size_t)size);
+
+    if (!nodes)
+    {
+        rbt_free_shallow(tree);
+        return NULL;
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        nodes[i] = rbt_new_node(tree->pool, elements[i]);
+
+        if (!nodes[i])
+        {
+            while (i > 0)
+                rbt_free_node_shallow(tree->pool, nodes[--i]);
+
+            free(nodes);
+            rbt_free_shallow(tree);
+
+            return NULL;
+        }
+    }
+
+    rbt_build(tree, nodes, size);
+
+    free(nodes);
+
+    DS_STATS_ADD(tree, allocations, size + 1);
+
     return tree;
 }
 
 /// Frees a RedBlackTree_s, freeing all of its elements using the interface's
-/// free function.
+/// free function. Every snapshot of a persistent tree has to be released
+/// before.
 ///
 /// \par Interface Requirements
 /// - free
@@ -237,13 +610,19 @@ rbt_new(Interface_t *interface)
 void
 rbt_free(RedBlackTree_t *tree)
 {
-    rbt_free_tree(tree->root, tree->interface->free);
+    if (tree->history)
+        rbt_history_delete(tree);
+
+    if (tree->multiple)
+        rbt_group_free_all(tree, tree->interface->free);
+
+    rbt_free_tree(tree->pool, tree->root, tree->interface->free);
 
     free(tree);
 }
 
 /// Frees a RedBlackTree_s, freeing all of its nodes, leaving its elements
-/// intact.
+/// intact. Every snapshot of a persistent tree has to be released before.
 ///
 /// \par Interface Requirements
 /// - None
@@ -252,7 +631,13 @@ rbt_free(RedBlackTree_t *tree)
 void
 rbt_free_shallow(RedBlackTree_t *tree)
 {
-    rbt_free_tree_shallow(tree->root);
+    if (tree->history)
+        rbt_history_delete(tree);
+
+    if (tree->multiple)
+        rbt_group_free_all(tree, NULL);
+
+    rbt_free_tree_shallow(tree->pool, tree->root);
 
     free(tree);
 }
@@ -268,7 +653,22 @@ rbt_free_shallow(RedBlackTree_t *tree)
 void
 rbt_erase(RedBlackTree_t *tree)
 {
-    rbt_free_tree(tree->root, tree->interface->free);
+    if (tree->history)
+    {
+        // Live snapshots might still see every node
+        rbt_history_begin(tree);
+        tree->version_id++;
+        rbt_history_retire_tree(tree, tree->root, true);
+    }
+    else
+    {
+        if (tree->multiple)
+            rbt_group_free_all(tree, tree->interface->free);
+
+        rbt_free_tree(tree->pool, tree->root, tree->interface->free);
+    }
+
+    DS_STATS_ADD(tree, frees, tree->size);
 
     tree->root = NULL;
     tree->size = 0;
@@ -284,7 +684,19 @@ rbt_erase(RedBlackTree_t *tree)
 void
 rbt_erase_shallow(RedBlackTree_t *tree)
 {
-    rbt_free_tree_shallow(tree->root);
+    if (tree->history)
+    {
+        rbt_history_begin(tree);
+        tree->version_id++;
+        rbt_history_retire_tree(tree, tree->root, false);
+    }
+    else
+    {
+        if (tree->multiple)
+            rbt_group_free_all(tree, NULL);
+
+        rbt_free_tree_shallow(tree->pool, tree->root);
+    }
 
     tree->root = NULL;
     tree->size = 0;
@@ -332,1013 +744,3523 @@ rbt_limit(RedBlackTree_t *tree)
     return tree->limit;
 }
 
-/// Sets a limit to the amount of elements in the red-black tree.
+/// Returns true if the tree keeps the size of every subtree.
 ///
 /// \par Interface Requirements
 /// - None
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param limit The specified limit
 ///
-/// \return false if the limit is less than the tree's current size and greater
-/// than 0. Returns true if the limit was successfully set.
+/// \return True if rbt_select() and rbt_rank() can be used.
 bool
-rbt_set_limit(RedBlackTree_t *tree, integer_t limit)
+rbt_ranked(RedBlackTree_t *tree)
 {
-    if (tree->size > limit && limit > 0)
-        return false;
+    return tree->ranked;
+}
 
-    tree->limit = limit;
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return True if rbt_snapshot() can be used.
+bool
+rbt_persistent(RedBlackTree_t *tree)
+{
+    return tree->history != NULL;
+}
 
-    return true;
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return True if the tree accepts elements equal to one already in it.
+bool
+rbt_multiple_keys(RedBlackTree_t *tree)
+{
+    return tree->multiple;
 }
 
-/// Adds a new element in the specified red-black tree. The tree does not
-/// accepts duplicate values.
+/// Copies the operation counters of the tree. They are only kept when the
+/// library is compiled with \c DS_STATS defined. Every node is an allocation
+/// and the bytes held are those of the tree and its nodes.
 ///
 /// \par Interface Requirements
-/// - compare
+/// - None
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param element The element to be added to the red-black tree.
+/// \param stats Where the counters are copied to.
 ///
-/// \return True if the element was added to the tree.
-/// \return False if the element is already present in the red-black tree, if
-/// the tree has a limited size or if any allocations failed.
+/// \return True if the counters are kept, otherwise false and every counter
+/// is zero.
 bool
-rbt_insert(RedBlackTree_t *tree, void *element)
+rbt_stats(RedBlackTree_t *tree, ContainerStats_t *stats)
 {
-    if (rbt_full(tree))
+    if (!DS_STATS_GET(tree, stats))
         return false;
 
-    if (rbt_empty(tree))
-    {
-        tree->root = rbt_new_node(element);
-
-        if (!tree->root)
-            return false;
-
-        tree->root->color = BLACK;
-    }
-    else
-    {
-        RedBlackTreeNode_t *scan = tree->root;
-        RedBlackTreeNode_t *parent = scan;
-
-        while (scan != NULL)
-        {
-            parent = scan;
-
-            if (tree->interface->compare(scan->key, element) > 0)
-                scan = scan->left;
-            else if (tree->interface->compare(scan->key, element) < 0)
-                scan = scan->right;
-            else
-                return false; /* No duplicates are allowed */
-        }
-
-        RedBlackTreeNode_t *node;
-
-        if (tree->interface->compare(parent->key, element) < 0)
-        {
-            parent->right = rbt_new_node(element);
-
-            if (!parent->right)
-                return false;
-
-            parent->right->parent = parent;
-            node = parent->right;
-        }
-        else
-        {
-            parent->left = rbt_new_node(element);
-
-            if (!parent->left)
-                return false;
-
-            parent->left->parent = parent;
-            node = parent->left;
-        }
-
-        rbt_insert_fixup(tree, node);
-    }
-
-    tree->size++;
-    tree->version_id++;
+    stats->bytes = sizeof(RedBlackTree_t)
+                   + (unsigned_t)tree->size * sizeof(RedBlackTreeNode_t);
 
     return true;
 }
 
-/// Removes an element, if present, that matches a given element from the
-/// specified red-black tree.
+/// Returns the element in the tree that is equal to the given element. Useful
+/// when elements are compared by a part of them, like a key, and the rest of
+/// the element in the tree is needed.
 ///
 /// \par Interface Requirements
 /// - compare
-/// - free
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param element The element to be removed has to match this element.
+/// \param element The element to be searched in the tree.
 ///
-/// \return True if the element was removed.
-/// \return False if the element was not found.
-bool
-rbt_remove(RedBlackTree_t *tree, void *element)
+/// \return The element in the tree or NULL if it is not present.
+void *
+rbt_get(RedBlackTree_t *tree, void *element)
 {
-    RedBlackTreeNode_t *Z = rbt_find(tree, element);
+    RedBlackTreeNode_t *node = rbt_find(tree, element);
 
-    if (Z == NULL)
-        return false;
+    return node == NULL ? NULL : node->key;
+}
 
-    if (rbt_size(tree) == 1)
-    {
-        // Remove the last node
-        rbt_free_node(tree->root, tree->interface->free);
-
-        tree->root = NULL;
-    }
-    else
-    {
-        RedBlackTreeNode_t *Y = NULL;
-        RedBlackTreeNode_t *X = NULL;
-
-        if (Z->left == NULL || Z->right == NULL)
-            Y = Z;
-        else
-            Y = rbt_successor(Z);
-
-        if (Y->left != NULL)
-            X = Y->left;
-        else
-            X = Y->right;
-
-        if (X)
-            X->parent = Y->parent;
-
-        // Disassociate Y from the tree
-        if (Y->parent == NULL)
-            tree->root = X;
-        else if (Y == Y->parent->left)
-            Y->parent->left = X;
-        else
-            Y->parent->right = X;
-
-        // Move Y's element to Z's and Z's to Y's because Y is to be deleted
-        // instead of Z
-        if (Y != Z)
-        {
-            void *temp = Y->key;
-            Y->key = Z->key;
-            Z->key = temp;
-        }
-
-        if (rbt_color(Y) == BLACK)
-            rbt_remove_fixup(tree, X);
-
-        rbt_free_node(Y, tree->interface->free);
-    }
+/// Sets a limit to the amount of elements in the red-black tree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+/// \param limit The specified limit
+///
+/// \return false if the limit is less than the tree's current size and greater
+/// than 0. Returns true if the limit was successfully set.
+bool
+rbt_set_limit(RedBlackTree_t *tree, integer_t limit)
+{
+    if (tree->size > limit && limit > 0)
+        return false;
 
-    tree->size--;
-    tree->version_id++;
+    tree->limit = limit;
 
     return true;
 }
 
-/// Removes the root element and frees it from memory.
+/// Sets a node pool from where all nodes of the red-black tree are allocated.
+/// A pool can be shared between many containers as long as its nodes are
+/// big enough. Set it to NULL to go back to using malloc() and free(). The
+/// pool can only be changed when the tree is empty.
 ///
 /// \par Interface Requirements
 /// - None
 ///
 /// \param tree RedBlackTree_s reference.
+/// \param pool The node pool or NULL.
 ///
-/// \return True if the element was removed.
-/// \return False if the element was not found.
+/// \return True if the pool was set.
+/// \return False if the tree is not empty or persistent or if the pool's
+/// nodes are too small.
 bool
-rbt_pop(RedBlackTree_t *tree)
+rbt_set_pool(RedBlackTree_t *tree, NodePool_t *pool)
 {
-    void *element = rbt_peek(tree);
+    if (!rbt_empty(tree) || tree->history)
+        return false;
 
-    if (!element)
+    if (pool && !npl_fits(pool, sizeof(RedBlackTreeNode_t)))
         return false;
 
-    return rbt_remove(tree, element);
+    tree->pool = pool;
+
+    return true;
 }
 
-/// Checks if the specified red-black tree is empty based on its \c size
-/// counter.
+/// Enables or disables order statistics. While enabled every node keeps
+/// the size of its subtree, updated by insertions, removals and rotations,
+/// so rbt_select() and rbt_rank() take logarithmic time. Enabling it computes
+/// the sizes of a non-empty tree in linear time.
 ///
 /// \par Interface Requirements
 /// - None
 ///
 /// \param tree RedBlackTree_s reference.
-///
-/// \return True if \c size equals 0, otherwise false.
-bool
-rbt_empty(RedBlackTree_t *tree)
+/// \param ranked If subtree sizes should be maintained.
+void
+rbt_set_ranked(RedBlackTree_t *tree, bool ranked)
 {
-    return tree->size == 0;
+    if (tree->history || tree->multiple)
+        return;
+
+    if (ranked && !tree->ranked)
+        rbt_count_tree(tree->root);
+
+    tree->ranked = ranked;
 }
 
-/// Checks if the specified red-black tree is full. The tree can only be full
-/// if the limit is greater than 0 and the tree's size equals the limit.
+/// Makes the tree persistent, so that rbt_snapshot() can take an immutable
+/// version of it in constant time, or makes it a regular tree again. A
+/// persistent tree copies the nodes that a live snapshot might see instead of
+/// changing them, which costs \c O(log n) allocations per insertion or
+/// removal while snapshots are alive, and keeps the nodes that left the tree
+/// until every snapshot that might see them is released.
+///
+/// Persistent trees don't keep parent pointers. Iterators can't be placed on
+/// them, they can't be ranked and the set operations, rbt_split() and
+/// rbt_join() refuse them. Only one thread may change the tree and take
+/// snapshots, while any thread may read and release them.
 ///
 /// \par Interface Requirements
-/// - None
+/// - compare
 ///
 /// \param tree RedBlackTree_s reference.
+/// \param persistent If snapshots can be taken.
 ///
-/// \return True if \c limit is greater than 0 and the tree's size equals the
-/// tree's limit, otherwise false.
+/// \return True if the tree is in the requested mode.
+/// \return False if the tree is ranked or has multiple keys, if a snapshot is
+/// still alive or if an allocation failed. The tree is then not changed.
 bool
-rbt_full(RedBlackTree_t *tree)
+rbt_set_persistent(RedBlackTree_t *tree, bool persistent)
 {
-    return tree->limit > 0 && tree->size >= tree->limit;
+    if (persistent == (tree->history != NULL))
+        return true;
+
+    if (!persistent)
+    {
+        struct RedBlackTreeHistory_s *history = tree->history;
+
+        pthread_mutex_lock(&history->lock);
+        bool alive = history->oldest != NULL;
+        pthread_mutex_unlock(&history->lock);
+
+        if (alive)
+            return false;
+
+        rbt_history_delete(tree);
+        rbt_history_link(tree->root, NULL);
+
+        tree->version_id++;
+
+        return true;
+    }
+
+    if (tree->ranked || tree->multiple)
+        return false;
+
+    struct RedBlackTreeHistory_s *history = malloc(sizeof(*history));
+
+    if (!history)
+        return false;
+
+    RedBlackTreeNode_t **nodes = NULL;
+
+    if (tree->size > 0)
+    {
+        nodes = malloc(sizeof(RedBlackTreeNode_t*) * (size_t)tree->size);
+
+        if (!nodes)
+        {
+            free(history);
+            return false;
+        }
+    }
+
+    if (pthread_mutex_init(&history->lock, NULL) != 0)
+    {
+        free(nodes);
+        free(history);
+        return false;
+    }
+
+    history->oldest = NULL;
+    history->newest = NULL;
+    history->frozen = 0;
+    history->shared = false;
+    history->retired = NULL;
+    history->last_retired = NULL;
+    history->spare = NULL;
+    history->spares = 0;
+
+    tree->history = history;
+
+    // The tree might lean right, so its nodes are inserted again
+    integer_t size = 0;
+
+    for (RedBlackTreeNode_t *node = tree->root ? rbt_minimum(tree->root)
+                                               : NULL;
+         node != NULL; node = rbt_successor(node))
+        nodes[size++] = node;
+
+    tree->root = NULL;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        nodes[i]->left = NULL;
+        nodes[i]->right = NULL;
+        nodes[i]->parent = NULL;
+        nodes[i]->color = RED;
+        nodes[i]->release = false;
+        nodes[i]->version = 0;
+
+        tree->root = rbt_history_insert_node(tree, tree->root, nodes[i]);
+        tree->root->color = BLACK;
+    }
+
+    free(nodes);
+
+    tree->version_id++;
+
+    return true;
 }
 
-/// Checks if a given element is in the red-black tree.
+/// Makes the tree accept elements that compare equal to one already in it, or
+/// makes it refuse them again. Equal elements share a single node, which
+/// keeps them in insertion order in a small array, so rbt_get_all() gives all
+/// of them as one contiguous span without walking the tree. The size of the
+/// tree counts every element, while iterators, rbt_min(), rbt_max() and
+/// rbt_peek() only see the first element of each group.
+///
+/// Trees with multiple keys can't be ranked or persistent and they are
+/// refused by the set operations, rbt_split(), rbt_join() and rbt_save().
 ///
 /// \par Interface Requirements
 /// - None
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param element The element to be searched in the tree.
+/// \param multiple If equal elements are accepted.
 ///
-/// \return True if the the red-black tree contains the element, otherwise
-/// false.
+/// \return True if the tree is in the requested mode.
+/// \return False if the tree is not empty, ranked or persistent.
 bool
-rbt_contains(RedBlackTree_t *tree, void *element)
+rbt_set_multiple_keys(RedBlackTree_t *tree, bool multiple)
 {
-    RedBlackTreeNode_t *node = rbt_find(tree, element);
+    if (multiple == tree->multiple)
+        return true;
 
-    return node != NULL;
+    if (!rbt_empty(tree) || tree->ranked || tree->history)
+        return false;
+
+    tree->multiple = multiple;
+
+    return true;
 }
 
-/// Returns the root element.
+/// Adds a new element in the specified red-black tree. The tree does not
+/// accepts duplicate values, unless it has multiple keys. Then the element is
+/// added to the group of the equal element already in the tree.
 ///
 /// \par Interface Requirements
-/// - None
+/// - compare
 ///
 /// \param tree RedBlackTree_s reference.
+/// \param element The element to be added to the red-black tree.
 ///
-/// \return Returns the root element or NULL if the tree is empty.
-void *
-rbt_peek(RedBlackTree_t *tree)
+/// \return True if the element was added to the tree.
+/// \return False if the element is already present in the red-black tree and
+/// it doesn't have multiple keys, if the tree has a limited size or if any
+/// allocations failed.
+bool
+rbt_insert(RedBlackTree_t *tree, void *element)
 {
-    if (rbt_empty(tree))
-        return NULL;
+    DS_TRACE_ENTRY(rbt_insert, tree->size);
 
-    return tree->root->key;
+    bool inserted = rbt_insert_node(tree, element, NULL);
+
+    DS_TRACE_RETURN(rbt_insert, tree->size);
+
+    return inserted;
 }
 
-/// Returns the maximum element in the tree or NULL if it is empty.
+/// Looks for an element equal to the given one and inserts the given element
+/// if there is none, with a single descent. If an equal element is found the
+/// given element is not added, even if the tree has multiple keys, and it
+/// still belongs to the caller.
 ///
 /// \par Interface Requirements
-/// - None
+/// - compare
 ///
 /// \param tree RedBlackTree_s reference.
+/// \param element The element to be searched or added.
+/// \param existing The element equal to \c element in the tree after the
+/// call, or NULL if it was not found and could not be added.
 ///
-/// \return The maximum element or NULL if the tree is empty.
-void *
-rbt_max(RedBlackTree_t *tree)
+/// \return True if the element was added to the tree.
+/// \return False if an equal element was found, if the tree has a limited
+/// size or if any allocations failed.
+bool
+rbt_find_or_insert(RedBlackTree_t *tree, void *element, void **existing)
 {
-    if (rbt_empty(tree))
-        return NULL;
+    RedBlackTreeNode_t *found;
 
-    RedBlackTreeNode_t *scan = tree->root;
+    bool inserted = rbt_insert_node(tree, element, &found);
 
-    while (scan->right != NULL)
-        scan = scan->right;
+    *existing = inserted ? element : found ? found->key : NULL;
 
-    return scan->key;
+    return inserted;
 }
 
-/// Returns the minimum element in the tree or NULL if it is empty.
+/// Adds an element or, if an equal element is already in the tree, merges
+/// the given element into it and frees the given element, all with a single
+/// descent. The merge function must not change how the element in the tree
+/// compares to others.
 ///
 /// \par Interface Requirements
-/// - None
+/// - compare
+/// - free
 ///
 /// \param tree RedBlackTree_s reference.
+/// \param element The element to be added or merged.
+/// \param merge A function that folds the given element into the element
+/// already in the tree.
 ///
-/// \return The minimum element or NULL if the tree is empty.
-void *
-rbt_min(RedBlackTree_t *tree)
+/// \return True if the element was added or merged. The tree then owns it.
+/// \return False if it was not found and could not be added.
+bool
+rbt_upsert(RedBlackTree_t *tree, void *element, reduce_f merge)
 {
-    if (rbt_empty(tree))
-        return NULL;
+    void *existing;
 
-    RedBlackTreeNode_t *scan = tree->root;
+    if (rbt_find_or_insert(tree, element, &existing))
+        return true;
 
-    while (scan->left != NULL)
-        scan = scan->left;
+    if (!existing)
+        return false;
 
-    return scan->key;
-}
+    merge(existing, element);
 
-/// Displays a RedBlackTree_s in the console. There are currently four modes:
-/// - -1 Displays the tree with \c rbt_display_tree.
-/// - 0 Displays the tree with \c rbt_display_simple.
-/// - 1 Displays the tree with \c rbt_display_color
-/// - Any other values defaults to \c rbt_display_treeview
+    tree->interface->free(element);
+
+    return true;
+}
+/// Adds every element of a buffer to the red-black tree. The buffer is sorted
+/// first. Small batches are then inserted one by one. Batches that are big
+/// compared to the tree are merged with the elements already in it, and the
+/// whole tree is rebuilt in linear time, reusing its nodes.
+///
+/// When the function returns, the inserted elements are at the start of the
+/// buffer in ascending order. The rest are elements that could not be
+/// inserted because they were duplicates, the tree was full or an
+/// allocation failed. They still belong to the caller.
 ///
 /// \par Interface Requirements
-/// - display
+/// - compare
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param display_mode The way the tree is to be displayed.
-void
-rbt_display(RedBlackTree_t *tree, int display_mode)
+/// \param elements Buffer of elements to be added.
+/// \param size Amount of elements in the buffer.
+///
+/// \return The amount of elements inserted.
+integer_t
+rbt_insert_all(RedBlackTree_t *tree, void **elements, integer_t size)
 {
-    if (display_mode)
-    {
-        printf("\n+--------------------------------------------------+");
-        printf("\n|                  Red-Black Tree                  |");
-        printf("\n+--------------------------------------------------+\n");
-    }
+    if (size <= 0)
+        return 0;
 
-    if (rbt_empty(tree) && display_mode)
-    {
-        printf(" EMPTY\n");
-    }
+    srt_sort(elements, size, tree->interface->compare);
 
-    if (display_mode == -1)
-    {
-        rbt_display_tree(tree->root, 0, tree->interface->display);
-    }
-    else if (display_mode == 0)
+    integer_t total = 0;
+
+    RedBlackTreeNode_t **nodes = NULL;
+
+    // Rebuilding only pays off if it touches few nodes per new element
+    if (tree->limit <= 0 && !tree->history && !tree->multiple
+        && size * RBT_BULK_RATIO >= tree->size)
+        nodes = malloc(sizeof(RedBlackTreeNode_t*)
+                       * (size_t)(size + tree->size));
+
+    if (!nodes)
     {
-        rbt_display_simple(tree->root, 0, tree->interface->display);
+        for (integer_t i = 0; i < size; i++)
+        {
+            if (rbt_insert(tree, elements[i]))
+            {
+                void *element = elements[i];
+                elements[i] = elements[total];
+                elements[total++] = element;
+            }
+        }
+
+        return total;
     }
-    else if (display_mode == 1)
+
+    DS_STATS_ADD(tree, allocations, 1);
+
+    // The nodes of the tree go to the end of the array and the merged
+    // sequence is written from the start, which never overtakes them
+    integer_t count = tree->size, old = size, merged = 0;
+
+    if (tree->root)
     {
-        rbt_display_color(tree->root, 1, tree->interface->display);
+        RedBlackTreeNode_t *node = rbt_minimum(tree->root);
+
+        for (integer_t i = size; node != NULL; i++)
+        {
+            nodes[i] = node;
+            node = rbt_successor(node);
+        }
     }
-    else
+
+    for (integer_t i = 0; i < size || old < size + count; )
     {
-        char path[5000] = {};
+        int comparison = -1;
 
-        rbt_display_treeview(tree->root, 0, path, tree->interface->display, false);
-        printf("\n");
+        if (old < size + count && i < size)
+            comparison = DS_STATS_COMPARE(tree, nodes[old]->key,
+                                                  elements[i]);
+
+        if (old < size + count && (i == size || comparison < 0))
+        {
+            nodes[merged++] = nodes[old++];
+            continue;
+        }
+
+        // Equal to an element already in the tree or in the batch
+        if (comparison == 0 || (merged > 0 && DS_STATS_COMPARE(tree, 
+                nodes[merged - 1]->key, elements[i]) == 0))
+        {
+            i++;
+            continue;
+        }
+
+        RedBlackTreeNode_t *node = rbt_new_node(tree->pool, elements[i]);
+
+        if (node)
+        {
+            DS_STATS_ADD(tree, allocations, 1);
+
+            nodes[merged++] = node;
+
+            void *element = elements[i];
+            elements[i] = elements[total];
+            elements[total++] = element;
+        }
+
+        i++;
     }
-}
 
-/// Displays an RedBlackTree_s in the console. There are currently four modes:
-/// - -1 Pre-order traversal.
-/// - 0 In-order traversal.
-/// - 1 Post-order traversal.
-/// - Any other values defaults to leaves traversal
+    rbt_build(tree, nodes, merged);
+
+    free(nodes);
+
+    tree->version_id++;
+
+    return total;
+}
+
+/// Removes an element, if present, that matches a given element from the
+/// specified red-black tree.
 ///
 /// \par Interface Requirements
-/// - display
+/// - compare
+/// - free
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The element to be removed has to match this element.
+///
+/// If the tree has multiple keys and more than one element matches the given
+/// element, only the last one added is removed.
+///
+/// \return True if the element was removed.
+/// \return False if the element was not found.
+bool
+rbt_remove(RedBlackTree_t *tree, void *element)
+{
+    if (tree->history)
+        return rbt_history_remove(tree, element);
+
+    RedBlackTreeNode_t *Z = rbt_find(tree, element);
+
+    if (Z == NULL)
+        return false;
+
+    if (tree->multiple && Z->group)
+    {
+        // Only the last element of the group is removed
+        struct RedBlackTreeGroup_s *group = Z->group;
+
+        tree->interface->free(group->elements[--group->count]);
+
+        if (group->count == 1)
+        {
+            free(group);
+            Z->group = NULL;
+        }
+    }
+    else if (rbt_size(tree) == 1)
+    {
+        // Remove the last node
+        rbt_free_node(tree->pool, tree->root, tree->interface->free);
+
+        tree->root = NULL;
+    }
+    else
+    {
+        RedBlackTreeNode_t *Y = NULL;
+        RedBlackTreeNode_t *X = NULL;
+
+        if (Z->left == NULL || Z->right == NULL)
+            Y = Z;
+        else
+            Y = rbt_successor(Z);
+
+        if (Y->left != NULL)
+            X = Y->left;
+        else
+            X = Y->right;
+
+        if (X)
+            X->parent = Y->parent;
+
+        // Disassociate Y from the tree
+        if (Y->parent == NULL)
+            tree->root = X;
+        else if (Y == Y->parent->left)
+            Y->parent->left = X;
+        else
+            Y->parent->right = X;
+
+        // Move Y's element to Z's and Z's to Y's because Y is to be deleted
+        // instead of Z
+        if (Y != Z)
+        {
+            void *temp = Y->key;
+            Y->key = Z->key;
+            Z->key = temp;
+
+            // Z has no group, otherwise it would not be removed
+            if (tree->multiple)
+            {
+                Z->group = Y->group;
+                Y->group = NULL;
+            }
+        }
+
+        if (tree->ranked)
+        {
+            for (RedBlackTreeNode_t *P = Y->parent; P; P = P->parent)
+                P->count--;
+        }
+
+        if (rbt_color(Y) == BLACK)
+            rbt_remove_fixup(tree, X, Y->parent);
+
+        rbt_free_node(tree->pool, Y, tree->interface->free);
+    }
+
+    tree->size--;
+    tree->version_id++;
+
+    DS_STATS_ADD(tree, frees, 1);
+
+    return true;
+}
+
+/// Removes and frees every element that matches a given element. Without
+/// multiple keys this is the same as rbt_remove().
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The elements to be removed have to match this element.
+///
+/// \return The amount of removed elements.
+integer_t
+rbt_remove_all(RedBlackTree_t *tree, void *element)
+{
+    RedBlackTreeNode_t *node = tree->multiple ? rbt_find(tree, element) : NULL;
+
+    if (node == NULL)
+        return rbt_remove(tree, element) ? 1 : 0;
+
+    integer_t count = 1;
+
+    if (node->group)
+    {
+        struct RedBlackTreeGroup_s *group = node->group;
+
+        count = group->count;
+
+        for (integer_t i = 1; i < count; i++)
+            tree->interface->free(group->elements[i]);
+
+        free(group);
+        node->group = NULL;
+
+        tree->size -= count - 1;
+    }
+
+    rbt_remove(tree, node->key);
+
+    return count;
+}
+
+/// Removes the root element and frees it from memory.
 ///
+/// \par Interface Requirements
+/// - None
 ///
 /// \param tree RedBlackTree_s reference.
-/// \param traversal_mode The way the tree is to be traversed.
-void
-rbt_traversal(RedBlackTree_t *tree, int traversal_mode)
+///
+/// \return True if the element was removed.
+/// \return False if the element was not found.
+bool
+rbt_pop(RedBlackTree_t *tree)
+{
+    void *element = rbt_peek(tree);
+
+    if (!element)
+        return false;
+
+    return rbt_remove(tree, element);
+}
+
+/// Checks if the specified red-black tree is empty based on its \c size
+/// counter.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return True if \c size equals 0, otherwise false.
+bool
+rbt_empty(RedBlackTree_t *tree)
+{
+    return tree->size == 0;
+}
+
+/// Checks if the specified red-black tree is full. The tree can only be full
+/// if the limit is greater than 0 and the tree's size equals the limit.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return True if \c limit is greater than 0 and the tree's size equals the
+/// tree's limit, otherwise false.
+bool
+rbt_full(RedBlackTree_t *tree)
+{
+    return tree->limit > 0 && tree->size >= tree->limit;
+}
+
+/// Checks if a given element is in the red-black tree.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The element to be searched in the tree.
+///
+/// \return True if the the red-black tree contains the element, otherwise
+/// false.
+bool
+rbt_contains(RedBlackTree_t *tree, void *element)
+{
+    RedBlackTreeNode_t *node = rbt_find(tree, element);
+
+    return node != NULL;
+}
+
+/// Returns the root element.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return Returns the root element or NULL if the tree is empty.
+void *
+rbt_peek(RedBlackTree_t *tree)
+{
+    if (rbt_empty(tree))
+        return NULL;
+
+    return tree->root->key;
+}
+
+/// Returns the maximum element in the tree or NULL if it is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return The maximum element or NULL if the tree is empty.
+void *
+rbt_max(RedBlackTree_t *tree)
+{
+    if (rbt_empty(tree))
+        return NULL;
+
+    RedBlackTreeNode_t *scan = tree->root;
+
+    while (scan->right != NULL)
+        scan = scan->right;
+
+    return scan->key;
+}
+
+/// Returns the minimum element in the tree or NULL if it is empty.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return The minimum element or NULL if the tree is empty.
+void *
+rbt_min(RedBlackTree_t *tree)
+{
+    if (rbt_empty(tree))
+        return NULL;
+
+    RedBlackTreeNode_t *scan = tree->root;
+
+    while (scan->left != NULL)
+        scan = scan->left;
+
+    return scan->key;
+}
+
+/// Visits in ascending order every element that is not smaller than \c low
+/// and not bigger than \c high. The search goes straight to the first
+/// element of the range and then follows the parent pointers, so only
+/// <code> O(log n + k) </code> nodes are visited where \c k is the amount of
+/// elements in the range.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree RedBlackTree_s reference.
+/// \param low Lower bound of the range.
+/// \param high Upper bound of the range.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+rbt_range(RedBlackTree_t *tree, void *low, void *high, visit_f visit,
+          void *argument)
+{
+    if (tree->history)
+        return rbt_range_nodes(tree->interface, tree->root, low, high, visit,
+                               argument);
+
+    RedBlackTreeNode_t *node = rbt_bound(tree, low, false);
+
+    integer_t total = 0;
+
+    while (node != NULL && DS_STATS_COMPARE(tree, node->key, high) <= 0)
+    {
+        if (tree->multiple && node->group)
+        {
+            for (integer_t i = 0; i < node->group->count; i++)
+                visit(node->group->elements[i], argument);
+
+            total += node->group->count;
+        }
+        else
+        {
+            visit(node->key, argument);
+            total++;
+        }
+
+        node = rbt_successor(node);
+    }
+
+    return total;
+}
+
+/// Calls a function with every element of the tree in a given order:
+/// - -1 Pre-order traversal.
+/// - 0 In-order traversal.
+/// - 1 Post-order traversal.
+/// - 2 Level-order traversal.
+/// - Any other values defaults to leaves traversal, in order.
+///
+/// The walks don't recurse. They keep a stack of at most \c RBT_MAX_HEIGHT
+/// nodes, since a persistent tree has no parent pointers to climb back up.
+/// Only the level-order traversal allocates memory, for a queue of nodes.
+/// Every element of a group of equal elements is visited.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+/// \param traversal_mode The way the tree is to be traversed.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return True if the tree was traversed.
+/// \return False if the level-order queue could not be allocated.
+bool
+rbt_visit(RedBlackTree_t *tree, int traversal_mode, visit_f visit,
+          void *argument)
+{
+    switch (traversal_mode)
+    {
+        case -1:
+            rbt_traversal_preorder(tree, visit, argument);
+            break;
+        case 0:
+            rbt_traversal_inorder(tree, visit, argument, false);
+            break;
+        case 1:
+            rbt_traversal_postorder(tree, visit, argument);
+            break;
+        case 2:
+            return rbt_traversal_levelorder(tree, visit, argument);
+        default:
+            rbt_traversal_inorder(tree, visit, argument, true);
+            break;
+    }
+
+    return true;
+}
+
+/// Returns the element that has exactly \c index elements smaller than it,
+/// that is, the element at the position \c index of an ascending order
+/// starting at 0. For example the median of a tree is at
+/// <code> rbt_size(tree) / 2 </code>.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param tree RedBlackTree_s reference.
+/// \param index Position of the element.
+///
+/// \return The element at the given position or NULL if the position is out
+/// of bounds or the tree is not ranked.
+void *
+rbt_select(RedBlackTree_t *tree, integer_t index)
+{
+    if (!tree->ranked || index < 0 || index >= tree->size)
+        return NULL;
+
+    RedBlackTreeNode_t *scan = tree->root;
+
+    for (;;)
+    {
+        integer_t left = rbt_node_count(scan->left);
+
+        if (index < left)
+            scan = scan->left;
+        else if (index > left)
+        {
+            index -= left + 1;
+            scan = scan->right;
+        }
+        else
+            return scan->key;
+    }
+}
+
+/// Returns the amount of elements that are smaller than the given element,
+/// which does not need to be in the tree. If it is, this is its position for
+/// rbt_select().
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The element to be compared.
+///
+/// \return The amount of smaller elements or -1 if the tree is not ranked.
+integer_t
+rbt_rank(RedBlackTree_t *tree, void *element)
+{
+    if (!tree->ranked)
+        return -1;
+
+    RedBlackTreeNode_t *scan = tree->root;
+
+    integer_t rank = 0;
+
+    while (scan != NULL)
+    {
+        if (DS_STATS_COMPARE(tree, scan->key, element) < 0)
+        {
+            rank += rbt_node_count(scan->left) + 1;
+            scan = scan->right;
+        }
+        else
+            scan = scan->left;
+    }
+
+    return rank;
+}
+
+/// Gives every element that matches a given element as a contiguous span, in
+/// the order they were added. The span belongs to the tree and is only valid
+/// until the tree is changed. Without multiple keys the span has at most one
+/// element.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The elements have to match this element.
+/// \param elements Where the start of the span is written to, or NULL if no
+/// element matches.
+///
+/// \return The amount of elements in the span.
+integer_t
+rbt_get_all(RedBlackTree_t *tree, void *element, void ***elements)
+{
+    RedBlackTreeNode_t *node = rbt_find(tree, element);
+
+    if (node == NULL)
+    {
+        *elements = NULL;
+        return 0;
+    }
+
+    if (tree->multiple && node->group)
+    {
+        *elements = node->group->elements;
+        return node->group->count;
+    }
+
+    *elements = &node->key;
+
+    return 1;
+}
+
+/// Counts the elements that match a given element without copying them.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element The elements have to match this element.
+///
+/// \return The amount of matching elements.
+integer_t
+rbt_key_count(RedBlackTree_t *tree, void *element)
+{
+    void **elements;
+
+    return rbt_get_all(tree, element, &elements);
+}
+
+/// Writes the tree to a stream as a snapshot that rbt_restore() reads back.
+/// The elements are written in ascending order with the interface's
+/// serialize function, so restoring the tree builds it in linear time with
+/// rbt_from_sorted_array() instead of inserting them one by one.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param tree RedBlackTree_s reference.
+/// \param stream Where the snapshot is written to.
+///
+/// \return True if the snapshot was written or false if writing failed, if
+/// the interface has no serialize function or if the tree has multiple keys.
+bool
+rbt_save(RedBlackTree_t *tree, FILE *stream)
+{
+    if (!tree->interface->serialize || tree->multiple)
+        return false;
+
+    SnapshotHeader_t header;
+
+    snp_header_init(&header, SnapshotRedBlackTree, (uint64_t)tree->size);
+
+    header.fields[0] = tree->ranked;
+
+    return snp_write_header(stream, &header)
+           && rbt_save_tree(tree, tree->root, stream);
+}
+
+/// Reads a tree written by rbt_save(). The new tree is ranked if the saved one
+/// was.
+///
+/// \par Interface Requirements
+/// - compare
+/// - deserialize
+/// - free
+///
+/// \param interface An interface defining all necessary functions for the
+/// red-black tree to operate.
+/// \param stream Where the snapshot is read from.
+///
+/// \return A new RedBlackTree_s or NULL if the stream doesn't hold a snapshot of
+/// a red-black tree, if its elements are out of order, if reading or allocation
+/// failed or if the interface has no deserialize function.
+RedBlackTree_t *
+rbt_restore(Interface_t *interface, FILE *stream)
+{
+    SnapshotHeader_t header;
+
+    if (!interface->deserialize
+        || !snp_read_header(stream, SnapshotRedBlackTree, &header))
+        return NULL;
+
+    integer_t size = (integer_t)header.count;
+
+    void **elements = snp_read_elements(stream, interface, size);
+
+    if (!elements)
+        return NULL;
+
+    RedBlackTree_t *tree = rbt_from_sorted_array(interface, elements, size);
+
+    if (!tree)
+    {
+        for (integer_t i = 0; i < size; i++)
+            interface_release(interface, elements[i]);
+    }
+    else if (header.fields[0])
+        rbt_set_ranked(tree, true);
+
+    free(elements);
+
+    return tree;
+}
+
+/// Moves every element of tree2 to tree1, leaving tree2 empty. Elements of
+/// tree2 that are already in tree1 are freed. Instead of inserting elements
+/// one by one, tree2 is split around the nodes of tree1 and the parts are
+/// joined back, so no node is allocated and it takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree. Both trees must use the same node pool.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 RedBlackTree_s reference where the result is stored.
+/// \param tree2 RedBlackTree_s reference to be emptied.
+///
+/// \return False if the trees have different node pools, if either is
+/// persistent or has multiple keys or if the sum of their sizes is greater
+/// than the limit of tree1.
+bool
+rbt_union(RedBlackTree_t *tree1, RedBlackTree_t *tree2)
+{
+    if (tree1 == tree2)
+        return true;
+
+    if (tree1->pool != tree2->pool || tree1->history || tree2->history
+        || tree1->multiple || tree2->multiple)
+        return false;
+
+    if (tree1->limit > 0 && tree1->size + tree2->size > tree1->limit)
+        return false;
+
+    if (tree1->ranked && !tree2->ranked)
+        rbt_count_tree(tree2->root);
+
+    integer_t found = 0;
+
+    tree1->root = rbt_union_nodes(tree1, tree1->root, tree2->root, &found);
+
+    if (tree1->root != NULL)
+        tree1->root->color = BLACK;
+    tree1->size += tree2->size - found;
+    tree1->version_id++;
+
+    DS_STATS_ADD(tree1, frees, found);
+
+    tree2->root = NULL;
+    tree2->size = 0;
+    tree2->version_id++;
+
+    return true;
+}
+
+/// Removes from tree1 every element that is not in tree2. The removed
+/// elements are freed and tree2 is not changed. Takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree. Does nothing if either tree is persistent or has multiple
+/// keys.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 RedBlackTree_s reference where the result is stored.
+/// \param tree2 RedBlackTree_s reference with the elements to be kept.
+void
+rbt_intersection(RedBlackTree_t *tree1, RedBlackTree_t *tree2)
+{
+    if (tree1 == tree2 || tree1->history || tree2->history || tree1->multiple
+        || tree2->multiple)
+        return;
+
+    integer_t found = 0;
+
+    tree1->root = rbt_intersection_nodes(tree1, tree1->root, tree2->root,
+                                         &found);
+
+    if (tree1->root != NULL)
+        tree1->root->color = BLACK;
+
+    DS_STATS_ADD(tree1, frees, tree1->size - found);
+
+    tree1->size = found;
+    tree1->version_id++;
+}
+
+/// Removes from tree1 every element that is also in tree2. The removed
+/// elements are freed and tree2 is not changed. Takes
+/// <code> O(m log(n / m + 1)) </code> time where \c m is the size of the
+/// smaller tree. Does nothing if either tree is persistent or has multiple
+/// keys.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param tree1 RedBlackTree_s reference where the result is stored.
+/// \param tree2 RedBlackTree_s reference with the elements to be removed.
+void
+rbt_difference(RedBlackTree_t *tree1, RedBlackTree_t *tree2)
+{
+    if (tree1->history || tree2->history || tree1->multiple || tree2->multiple)
+        return;
+
+    if (tree1 == tree2)
+    {
+        rbt_erase(tree1);
+        return;
+    }
+
+    integer_t found = 0;
+
+    tree1->root = rbt_difference_nodes(tree1, tree1->root, tree2->root,
+                                       &found);
+
+    if (tree1->root != NULL)
+        tree1->root->color = BLACK;
+    tree1->size -= found;
+    tree1->version_id++;
+
+    DS_STATS_ADD(tree1, frees, found);
+}
+
+/// Moves every element that is greater than or equal to the given element to
+/// a new tree, which uses the same interface and node pool. Takes
+/// <code> O(log n) </code> time if the tree is ranked. Otherwise the moved
+/// elements also have to be counted.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree RedBlackTree_s reference.
+/// \param element Where the tree is split.
+///
+/// \return A new RedBlackTree_s with the greater elements or NULL if allocation
+/// failed or the tree is persistent or has multiple keys, in which case the
+/// tree is not changed.
+RedBlackTree_t *
+rbt_split(RedBlackTree_t *tree, void *element)
+{
+    if (tree->history || tree->multiple)
+        return NULL;
+
+    RedBlackTree_t *result = rbt_new(tree->interface);
+
+    if (!result)
+        return NULL;
+
+    result->pool = tree->pool;
+    result->ranked = tree->ranked;
+
+    if (rbt_empty(tree))
+        return result;
+
+    RedBlackTreeNode_t *L, *K, *R;
+
+    rbt_split_nodes(tree, tree->root, element, &L, &K, &R);
+
+    if (K != NULL)
+        R = rbt_join_node(tree, NULL, K, R);
+
+    if (L != NULL)
+        L->color = BLACK;
+
+    if (R != NULL)
+        R->color = BLACK;
+    tree->root = L;
+    result->root = R;
+
+    result->size = tree->ranked ? rbt_node_count(R) : rbt_count_tree(R);
+    tree->size -= result->size;
+    tree->version_id++;
+
+    return result;
+}
+
+/// Moves every element of tree2 to the end of tree1, leaving tree2 empty. All
+/// elements of tree1 must be smaller than the elements of tree2. Takes
+/// <code> O(log n) </code> time. Both trees must use the same node pool.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param tree1 RedBlackTree_s reference where the result is stored.
+/// \param tree2 RedBlackTree_s reference to be emptied.
+///
+/// \return False if the elements are not in order, the trees have different
+/// node pools, either is persistent or has multiple keys or if the sum of
+/// their sizes is greater than the limit of tree1.
+bool
+rbt_join(RedBlackTree_t *tree1, RedBlackTree_t *tree2)
+{
+    if (tree1 == tree2 || tree1->pool != tree2->pool || tree1->history
+        || tree2->history || tree1->multiple || tree2->multiple)
+        return false;
+
+    if (rbt_empty(tree2))
+        return true;
+
+    if (tree1->limit > 0 && tree1->size + tree2->size > tree1->limit)
+        return false;
+
+    if (!rbt_empty(tree1)
+        && DS_STATS_COMPARE(tree1, rbt_maximum(tree1->root)->key,
+                                     rbt_minimum(tree2->root)->key) >= 0)
+        return false;
+
+    if (tree1->ranked && !tree2->ranked)
+        rbt_count_tree(tree2->root);
+
+    tree1->root = rbt_join_subtrees(tree1, tree1->root, tree2->root);
+    tree1->size += tree2->size;
+    tree1->version_id++;
+
+    tree2->root = NULL;
+    tree2->size = 0;
+    tree2->version_id++;
+
+    return true;
+}
+
+/// Displays a RedBlackTree_s in the console. There are currently four modes:
+/// - -1 Displays the tree with \c rbt_display_tree.
+/// - 0 Displays the tree with \c rbt_display_simple.
+/// - 1 Displays the tree with \c rbt_display_color
+/// - Any other values defaults to \c rbt_display_treeview
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param tree RedBlackTree_s reference.
+/// \param display_mode The way the tree is to be displayed.
+void
+rbt_display(RedBlackTree_t *tree, int display_mode)
+{
+    if (display_mode)
+    {
+        printf("\n+--------------------------------------------------+");
+        printf("\n|                  Red-Black Tree                  |");
+        printf("\n+--------------------------------------------------+\n");
+    }
+
+    if (rbt_empty(tree) && display_mode)
+    {
+        printf(" EMPTY\n");
+    }
+
+    if (display_mode == -1)
+    {
+        rbt_display_tree(tree->root, 0, tree->interface->display);
+    }
+    else if (display_mode == 0)
+    {
+        rbt_display_simple(tree->root, 0, tree->interface->display);
+    }
+    else if (display_mode == 1)
+    {
+        rbt_display_color(tree->root, 1, tree->interface->display);
+    }
+    else
+    {
+        char path[5000] = {};
+
+        rbt_display_treeview(tree->root, 0, path, tree->interface->display, false);
+        printf("\n");
+    }
+}
+
+/// Displays an RedBlackTree_s in the console. There are currently four modes:
+/// - -1 Pre-order traversal.
+/// - 0 In-order traversal.
+/// - 1 Post-order traversal.
+/// - 2 Level-order traversal.
+/// - Any other values defaults to leaves traversal
+///
+/// \par Interface Requirements
+/// - display
+///
+///
+/// \param tree RedBlackTree_s reference.
+/// \param traversal_mode The way the tree is to be traversed.
+void
+rbt_traversal(RedBlackTree_t *tree, int traversal_mode)
+{
+    switch (traversal_mode)
+    {
+        case -1:
+            printf("Pre-order Traversal\n");
+            break;
+        case 0:
+            printf("In-order Traversal\n");
+            break;
+        case 1:
+            printf("Post-order Traversal\n");
+            break;
+        case 2:
+            printf("Level-order Traversal\n");
+            break;
+        default:
+            printf("Leaves Traversal\n");
+            break;
+    }
+
+    rbt_visit(tree, traversal_mode, rbt_traversal_display, tree->interface);
+
+    printf("\n");
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static RedBlackTreeNode_t *
+rbt_new_node(NodePool_t *pool, void *element)
+{
+    RedBlackTreeNode_t *node = npl_node_alloc(pool,
+            sizeof(RedBlackTreeNode_t));
+
+    if (!node)
+        return NULL;
+
+    // All new nodes are red
+    node->color = RED;
+    node->key = element;
+    node->count = 1;
+
+    node->parent = NULL;
+    node->left = NULL;
+    node->right = NULL;
+
+    return node;
+}
+
+static void
+rbt_free_node(NodePool_t *pool, RedBlackTreeNode_t *node, free_f function)
+{
+    function(node->key);
+
+    npl_node_free(pool, node);
+}
+
+static void
+rbt_free_node_shallow(NodePool_t *pool, RedBlackTreeNode_t *node)
+{
+    npl_node_free(pool, node);
+}
+
+static void
+rbt_free_tree(NodePool_t *pool, RedBlackTreeNode_t *root, free_f function)
+{
+    RedBlackTreeNode_t *scan = root;
+    RedBlackTreeNode_t *up = NULL;
+
+    while (scan != NULL)
+    {
+        if (scan->left != NULL)
+        {
+            RedBlackTreeNode_t *left = scan->left;
+
+            scan->left = up;
+            up = scan;
+            scan = left;
+        }
+        else if (scan->right != NULL)
+        {
+            RedBlackTreeNode_t *right = scan->right;
+
+            scan->left = up;
+            scan->right = NULL;
+            up = scan;
+            scan = right;
+        }
+        else
+        {
+            if (up == NULL)
+            {
+                rbt_free_node(pool, scan, function);
+                scan = NULL;
+            }
+
+            while (up != NULL)
+            {
+                rbt_free_node(pool, scan, function);
+
+                if (up->right != NULL)
+                {
+                    scan = up->right;
+                    up->right = NULL;
+                    break;
+                }
+                else
+                {
+                    scan = up;
+                    up = up->left;
+                }
+            }
+        }
+    }
+}
+
+static void
+rbt_free_tree_shallow(NodePool_t *pool, RedBlackTreeNode_t *root)
+{
+    RedBlackTreeNode_t *scan = root;
+    RedBlackTreeNode_t *up = NULL;
+
+    while (scan != NULL)
+    {
+        if (scan->left != NULL)
+        {
+            RedBlackTreeNode_t *left = scan->left;
+
+            scan->left = up;
+            up = scan;
+            scan = left;
+        }
+        else if (scan->right != NULL)
+        {
+            RedBlackTreeNode_t *right = scan->right;
+
+            scan->left = up;
+            scan->right = NULL;
+            up = scan;
+            scan = right;
+        }
+        else
+        {
+            if (up == NULL)
+            {
+                rbt_free_node_shallow(pool, scan);
+                scan = NULL;
+            }
+
+            while (up != NULL)
+            {
+                rbt_free_node_shallow(pool, scan);
+
+                if (up->right != NULL)
+                {
+                    scan = up->right;
+                    up->right = NULL;
+                    break;
+                }
+                else
+                {
+                    scan = up;
+                    up = up->left;
+                }
+            }
+        }
+    }
+}
+
+// Inserts an element. If found is given, an equal element is reported in it
+// instead of being refused or grouped
+static bool
+rbt_insert_node(RedBlackTree_t *tree, void *element,
+                RedBlackTreeNode_t **found)
+{
+    if (found)
+        *found = NULL;
+
+    if (tree->history)
+    {
+        if (found && (*found = rbt_find(tree, element)) != NULL)
+            return false;
+
+        return !rbt_full(tree) && rbt_history_insert(tree, element);
+    }
+
+    RedBlackTreeNode_t *parent = NULL;
+
+    int comparison = 0;
+
+    for (RedBlackTreeNode_t *scan = tree->root; scan != NULL; )
+    {
+        parent = scan;
+
+        comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
+            scan = scan->right;
+        else if (found)
+        {
+            *found = scan;
+            return false;
+        }
+        else if (tree->multiple)
+        {
+            if (rbt_full(tree) || !rbt_group_add(scan, element))
+                return false;
+
+            tree->size++;
+            tree->version_id++;
+
+            return true;
+        }
+        else
+            return false; /* No duplicates are allowed */
+    }
+
+    if (rbt_full(tree))
+        return false;
+
+    RedBlackTreeNode_t *node = rbt_new_node(tree->pool, element);
+
+    if (!node)
+        return false;
+
+    node->parent = parent;
+
+    if (parent == NULL)
+        tree->root = node;
+    else if (comparison > 0)
+        parent->left = node;
+    else
+        parent->right = node;
+
+    if (tree->ranked)
+    {
+        for (; parent; parent = parent->parent)
+            parent->count++;
+    }
+    else if (tree->multiple)
+        node->group = NULL;
+
+    rbt_insert_fixup(tree, node);
+
+    tree->size++;
+    tree->version_id++;
+
+    DS_STATS_ADD(tree, allocations, 1);
+
+    return true;
+}
+
+// Appends an element to the group of a node, creating the group with the key
+// of the node first
+static bool
+rbt_group_add(RedBlackTreeNode_t *node, void *element)
+{
+    struct RedBlackTreeGroup_s *group = node->group;
+
+    if (!group || group->count == group->capacity)
+    {
+        integer_t capacity = group ? group->capacity * 2 : 4;
+
+        group = realloc(group, sizeof(struct RedBlackTreeGroup_s)
+                               + sizeof(void*) * (size_t)capacity);
+
+        if (!group)
+            return false;
+
+        if (!node->group)
+        {
+            group->elements[0] = node->key;
+            group->count = 1;
+        }
+
+        group->capacity = capacity;
+        node->group = group;
+    }
+
+    group->elements[group->count++] = element;
+
+    return true;
+}
+
+// Frees the group of every node and, if a function is given, every element
+// in them but the keys of the nodes
+static void
+rbt_group_free_all(RedBlackTree_t *tree, free_f function)
+{
+    if (!tree->root)
+        return;
+
+    for (RedBlackTreeNode_t *node = rbt_minimum(tree->root); node != NULL;
+         node = rbt_successor(node))
+    {
+        struct RedBlackTreeGroup_s *group = node->group;
+
+        if (!group)
+            continue;
+
+        if (function)
+        {
+            for (integer_t i = 1; i < group->count; i++)
+                function(group->elements[i]);
+        }
+
+        free(group);
+        node->group = NULL;
+    }
+}
+
+static void
+rbt_rotate_left(RedBlackTree_t *tree, RedBlackTreeNode_t *X)
+{
+    RedBlackTreeNode_t *Y = X->right;
+
+    X->right = Y->left;
+
+    if (Y->left != NULL)
+        Y->left->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->left)
+        X->parent->left = Y;
+    else
+        X->parent->right = Y;
+
+    Y->left = X;
+    X->parent = Y;
+
+    if (tree->ranked)
+    {
+        rbt_count_update(X);
+        rbt_count_update(Y);
+    }
+
+    DS_STATS_ADD(tree, rotations, 1);
+}
+
+static void
+rbt_rotate_right(RedBlackTree_t *tree, RedBlackTreeNode_t *X)
+{
+    RedBlackTreeNode_t *Y = X->left;
+
+    X->left = Y->right;
+
+    if (Y->right != NULL)
+        Y->right->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->left)
+        X->parent->left = Y;
+    else
+        X->parent->right = Y;
+
+    Y->right = X;
+    X->parent = Y;
+
+    if (tree->ranked)
+    {
+        rbt_count_update(X);
+        rbt_count_update(Y);
+    }
+
+    DS_STATS_ADD(tree, rotations, 1);
+}
+
+static void
+rbt_insert_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *Z)
+{
+    DS_TRACE_ENTRY(rbt_insert_fixup, tree->size);
+
+    RedBlackTreeNode_t *Y;
+
+    // Cases 1, 2, 3 are symmetric to 4, 5, 6
+    while (rbt_color(Z->parent) == RED)
+    {
+        if (Z->parent == Z->parent->parent->left)
+        {
+            // Uncle
+            Y = Z->parent->parent->right;
+
+            // Uncle is red, recolor parent and grandparent
+            // CASE 1 (symmetrical to 4)
+            if (rbt_color(Y) == RED)
+            {
+                Z->parent->color = BLACK;
+                Y->color = BLACK;
+                Z->parent->parent->color = RED;
+                Z = Z->parent->parent;
+            }
+            else
+            {
+                // CASE 2 (symmetrical to 5)
+                // Left-right skewed
+                if (Z == Z->parent->right)
+                {
+                    Z = Z->parent;
+                    rbt_rotate_left(tree, Z);
+                }
+                // Left-Left skewed
+                // CASE 3 (symmetrical to 6)
+                Z->parent->color = BLACK;
+                Z->parent->parent->color = RED;
+                rbt_rotate_right(tree, Z->parent->parent);
+            }
+        }
+        else /* if Z->parent == Z->parent->parent->right */
+        {
+            // Uncle
+            Y = Z->parent->parent->left;
+
+            // Uncle is red, recolor parent and grandparent
+            // CASE 4 (symmetrical to 1)
+            if (rbt_color(Y) == RED)
+            {
+                Z->parent->color = BLACK;
+                Y->color = BLACK;
+                Z->parent->parent->color = RED;
+                Z = Z->parent->parent;
+            }
+            else
+            {
+                // CASE 5 (symmetrical to 2)
+                // Right-left skewed
+                if (Z == Z->parent->left)
+                {
+                    Z = Z->parent;
+                    rbt_rotate_right(tree, Z);
+                }
+                // CASE 6 (symmetrical to 3)
+                // Right-Right skewed
+                Z->parent->color = BLACK;
+                Z->parent->parent->color = RED;
+                rbt_rotate_left(tree, Z->parent->parent);
+            }
+        }
+    }
+
+    //keep root always black
+    tree->root->color = BLACK;
+
+    DS_TRACE_RETURN(rbt_insert_fixup, tree->size);
+}
+
+static void
+rbt_remove_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *X,
+        RedBlackTreeNode_t *P)
+{
+    RedBlackTreeNode_t *W = NULL;
+
+    // X might be NULL so its parent is tracked separately
+    while (X != tree->root && rbt_color(X) == BLACK)
+    {
+        if (X == P->left)
+        {
+            W = P->right;
+
+            // CASE 1
+            if (rbt_color(W) == RED)
+            {
+                W->color = BLACK;
+                P->color = RED;
+                rbt_rotate_left(tree, P);
+                W = P->right;
+            }
+
+            // CASE 2
+            if (rbt_color(W->left) == BLACK && rbt_color(W->right) == BLACK)
+            {
+                W->color = RED;
+                X = P;
+                P = P->parent;
+            }
+            else
+            {
+                // CASE 3
+                if (rbt_color(W->right) == BLACK)
+                {
+                    if (W->left != NULL)
+                        W->left->color = BLACK;
+
+                    W->color = RED;
+                    rbt_rotate_right(tree, W);
+                    W = P->right;
+                }
+
+                // CASE 4
+                W->color = P->color;
+                P->color = BLACK;
+
+                if (W->right != NULL)
+                    W->right->color = BLACK;
+
+                rbt_rotate_left(tree, P);
+                X = tree->root;
+            }
+        }
+        else /* if X == P->right */
+        {
+            W = P->left;
+
+            // CASE 1
+            if (rbt_color(W) == RED)
+            {
+                W->color = BLACK;
+                P->color = RED;
+                rbt_rotate_right(tree, P);
+                W = P->left;
+            }
+
+            // CASE 2
+            if (rbt_color(W->left) == BLACK && rbt_color(W->right) == BLACK)
+            {
+                W->color = RED;
+                X = P;
+                P = P->parent;
+            }
+            else
+            {
+                // CASE 3
+                if (rbt_color(W->left) == BLACK)
+                {
+                    if (W->right != NULL)
+                        W->right->color = BLACK;
+
+                    W->color = RED;
+                    rbt_rotate_left(tree, W);
+                    W = P->left;
+                }
+
+                // CASE 4
+                W->color = P->color;
+                P->color = BLACK;
+
+                if (W->left != NULL)
+                    W->left->color = BLACK;
+
+                rbt_rotate_right(tree, P);
+                X = tree->root;
+            }
+        }
+    } /* End While */
+
+    if (X != NULL)
+        X->color = BLACK;
+}
+
+static RedBlackTreeNode_t *
+rbt_find(RedBlackTree_t *tree, void *element)
+{
+    RedBlackTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
+            scan = scan->right;
+        else
+            return scan;
+    }
+
+    return NULL;
+}
+
+static RedBlackTreeNode_t *
+rbt_successor(RedBlackTreeNode_t *N)
+{
+    if (N->right != NULL)
+        return rbt_minimum(N->right);
+
+    RedBlackTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->right)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
+}
+
+static RedBlackTreeNode_t *
+rbt_minimum(RedBlackTreeNode_t *N)
+{
+    // Finds the minimum node of subtree N
+    while (N->left != NULL)
+        N = N->left;
+
+    return N;
+}
+
+static RedBlackTreeNode_t *
+rbt_maximum(RedBlackTreeNode_t *N)
+{
+    // Finds the maximum node of subtree N
+    while (N->right != NULL)
+        N = N->right;
+
+    return N;
+}
+
+static void
+rbt_transplant(RedBlackTree_t *tree, RedBlackTreeNode_t *U,
+        RedBlackTreeNode_t *V)
+{
+    if (U->parent == NULL)
+        tree->root = V;
+    else if (U == U->parent->left)
+        U->parent->left = V;
+    else
+        U->parent->right = V;
+
+    if (V == NULL)
+        return;
+
+    V->parent = U->parent;
+}
+
+static bool
+rbt_color(RedBlackTreeNode_t *node)
+{
+    if (node == NULL)
+        return BLACK;
+
+    return node->color;
+}
+
+static void
+rbt_display_tree(RedBlackTreeNode_t *root, integer_t height,
+                 display_f function)
+{
+    if (root == NULL)
+        return;
+
+    rbt_display_tree(root->right, height + 1, function);
+
+    for (integer_t i = 0; i < height; i++)
+        printf("|------- ");
+
+    function(root->key);
+
+    printf("\n");
+
+    rbt_display_tree(root->left, height + 1, function);
+}
+
+static void
+rbt_display_color(RedBlackTreeNode_t *root, integer_t height,
+        display_f function)
+{
+    if (root == NULL)
+        return;
+
+    rbt_display_color(root->right, height + 1, function);
+
+    for (integer_t i = 0; i < height - 1; i++)
+        printf("        ");
+
+    printf("|---%c---< ", root->color ? 'B' : 'R');
+
+    function(root->key);
+    printf("\n");
+
+    rbt_display_color(root->left, height + 1, function);
+}
+
+static void
+rbt_display_simple(RedBlackTreeNode_t *root, integer_t height,
+        display_f function)
+{
+    if (root == NULL)
+        return;
+
+    rbt_display_simple(root->right, height + 1, function);
+
+    for (integer_t i = 0; i < height; i++)
+        printf("        ");
+
+    function(root->key);
+    printf("\n");
+
+    rbt_display_simple(root->left, height + 1, function);
+}
+
+static void
+rbt_display_treeview(RedBlackTreeNode_t *root, integer_t depth, char *path,
+        display_f function, bool direction)
+{
+    const integer_t spaces = 8;
+
+    if (root == NULL)
+        return;
+
+    depth++;
+
+    rbt_display_treeview(root->right, depth, path, function, true);
+
+    path[depth - 2] = 0;
+
+    if(direction)
+        path[depth - 2] = 1;
+
+    if(root->left)
+        path[depth - 1] = 1;
+
+    printf("\n");
+
+    for (integer_t i = 0; i < depth - 1; i++)
+    {
+        if (i == depth - 2)
+            printf("%c", direction ? 218 : 192);
+        else if (path[i])
+            printf("%c", 179);
+        else
+            printf(" ");
+
+        for (integer_t j = 1; j < spaces; j++)
+            if (i < depth - 2)
+                printf(" ");
+            else
+                printf("%c", 196);
+    }
+
+    printf(" ");
+    function(root->key);
+    printf("\n");
+
+    for (int i = 0; i < depth; i++)
+    {
+        if (path[i] && (root->left || i != depth -1))
+            printf("%c", 179);
+        else
+            printf(" ");
+
+        for (integer_t j = 1; j < spaces; j++)
+            printf(" ");
+    }
+
+    rbt_display_treeview(root->left, depth, path, function, false);
+}
+
+// Persistent trees have no parent pointers, so the walks keep their own stack,
+// which is never deeper than the tree
+static void
+rbt_traversal_preorder(RedBlackTree_t *tree, visit_f visit, void *argument)
+{
+    RedBlackTreeNode_t *stack[RBT_MAX_HEIGHT + 1];
+    integer_t top = 0;
+
+    if (tree->root != NULL)
+        stack[top++] = tree->root;
+
+    while (top > 0)
+    {
+        RedBlackTreeNode_t *node = stack[--top];
+
+        rbt_traversal_visit(tree, node, visit, argument);
+
+        if (node->right != NULL)
+            stack[top++] = node->right;
+        if (node->left != NULL)
+            stack[top++] = node->left;
+    }
+}
+
+static void
+rbt_traversal_inorder(RedBlackTree_t *tree, visit_f visit, void *argument,
+                      bool leaves)
+{
+    RedBlackTreeNode_t *stack[RBT_MAX_HEIGHT];
+    integer_t top = 0;
+
+    RedBlackTreeNode_t *node = tree->root;
+
+    while (node != NULL || top > 0)
+    {
+        while (node != NULL)
+        {
+            stack[top++] = node;
+            node = node->left;
+        }
+
+        node = stack[--top];
+
+        if (!leaves || (node->left == NULL && node->right == NULL))
+            rbt_traversal_visit(tree, node, visit, argument);
+
+        node = node->right;
+    }
+}
+
+static void
+rbt_traversal_postorder(RedBlackTree_t *tree, visit_f visit, void *argument)
+{
+    RedBlackTreeNode_t *stack[RBT_MAX_HEIGHT];
+    integer_t top = 0;
+
+    RedBlackTreeNode_t *node = tree->root, *last = NULL;
+
+    while (node != NULL || top > 0)
+    {
+        if (node != NULL)
+        {
+            stack[top++] = node;
+            node = node->left;
+        }
+        else
+        {
+            RedBlackTreeNode_t *peek = stack[top - 1];
+
+            // The right subtree goes first, unless it was just visited
+            if (peek->right != NULL && peek->right != last)
+                node = peek->right;
+            else
+            {
+                rbt_traversal_visit(tree, peek, visit, argument);
+
+                last = peek;
+                top--;
+            }
+        }
+    }
+}
+
+// The queue never holds more nodes than the tree
+static bool
+rbt_traversal_levelorder(RedBlackTree_t *tree, visit_f visit, void *argument)
+{
+    if (tree->root == NULL)
+        return true;
+
+    RedBlackTreeNode_t **queue = malloc(sizeof(RedBlackTreeNode_t *) *
+                                        (size_t)tree->size);
+
+    if (!queue)
+        return false;
+
+    integer_t front = 0, rear = 0;
+
+    queue[rear++] = tree->root;
+
+    while (front < rear)
+    {
+        RedBlackTreeNode_t *node = queue[front++];
+
+        rbt_traversal_visit(tree, node, visit, argument);
+
+        if (node->left != NULL)
+            queue[rear++] = node->left;
+        if (node->right != NULL)
+            queue[rear++] = node->right;
+    }
+
+    free(queue);
+
+    return true;
+}
+
+// Visits the key of a node or every element of its group
+static void
+rbt_traversal_visit(RedBlackTree_t *tree, RedBlackTreeNode_t *node,
+                    visit_f visit, void *argument)
+{
+    if (tree->multiple && node->group)
+    {
+        for (integer_t i = 0; i < node->group->count; i++)
+            visit(node->group->elements[i], argument);
+    }
+    else
+        visit(node->key, argument);
+}
+
+// Displays an element of a tree given its interface
+static void
+rbt_traversal_display(void *element, void *argument)
+{
+    ((Interface_t *)argument)->display(element);
+    printf(" ");
+}
+
+static integer_t
+rbt_node_count(RedBlackTreeNode_t *node)
+{
+    return node == NULL ? 0 : node->count;
+}
+
+// Recomputes the subtree size of a node from its children
+static integer_t
+rbt_count_update(RedBlackTreeNode_t *node)
+{
+    node->count = rbt_node_count(node->left) + rbt_node_count(node->right) + 1;
+
+    return node->count;
+}
+
+// Recomputes the subtree size of every node, used when the tree becomes
+// ranked
+static integer_t
+rbt_count_tree(RedBlackTreeNode_t *root)
+{
+    if (root == NULL)
+        return 0;
+
+    rbt_count_tree(root->left);
+    rbt_count_tree(root->right);
+
+    return rbt_count_update(root);
+}
+
+// Links a sorted array of nodes as a balanced tree and makes it the tree's
+// content
+static void
+rbt_build(RedBlackTree_t *tree, RedBlackTreeNode_t **nodes, integer_t size)
+{
+    // With the middle node as the root, a subtree of size n has
+    // floor(log2(n)) + 1 levels. Painting the deepest level red keeps the
+    // same amount of black nodes in every path, unless it is the root.
+    integer_t deepest = 0;
+
+    while (((integer_t)2 << deepest) <= size)
+        deepest++;
+
+    tree->root = rbt_build_subtree(nodes, size, NULL, 0,
+                                   deepest > 0 ? deepest : -1);
+    tree->size = size;
+}
+
+// Uses the middle node as the root of a subtree and builds both halves
+static RedBlackTreeNode_t *
+rbt_build_subtree(RedBlackTreeNode_t **nodes, integer_t size,
+                  RedBlackTreeNode_t *parent, integer_t depth, integer_t red)
+{
+    if (size == 0)
+        return NULL;
+
+    integer_t middle = size / 2;
+
+    RedBlackTreeNode_t *node = nodes[middle];
+
+    node->parent = parent;
+    node->color = depth == red ? RED : BLACK;
+    node->count = size;
+
+    node->left = rbt_build_subtree(nodes, middle, node, depth + 1, red);
+    node->right = rbt_build_subtree(nodes + middle + 1, size - middle - 1,
+                                    node, depth + 1, red);
+
+    return node;
+}
+
+// Finds the first node with a key not smaller than the element or, if upper
+// is true, the first node with a key bigger than the element
+static RedBlackTreeNode_t *
+rbt_bound(RedBlackTree_t *tree, void *element, bool upper)
+{
+    RedBlackTreeNode_t *scan = tree->root, *result = NULL;
+
+    while (scan != NULL)
+    {
+        int comparison = DS_STATS_COMPARE(tree, scan->key, element);
+
+        if (comparison > 0 || (comparison == 0 && !upper))
+        {
+            result = scan;
+            scan = scan->left;
+        }
+        else
+            scan = scan->right;
+    }
+
+    return result;
+}
+
+static RedBlackTreeNode_t *
+rbt_predecessor(RedBlackTreeNode_t *N)
+{
+    if (N->left != NULL)
+        return rbt_maximum(N->left);
+
+    RedBlackTreeNode_t *Y = N->parent;
+
+    while (Y != NULL && N == Y->left)
+    {
+        N = Y;
+        Y = Y->parent;
+    }
+
+    return Y;
+}
+
+// Amount of black nodes from a node to a leaf, including itself
+static integer_t
+rbt_black_height(RedBlackTreeNode_t *N)
+{
+    integer_t height = 0;
+
+    for (; N != NULL; N = N->left)
+    {
+        if (N->color == BLACK)
+            height++;
+    }
+
+    return height;
+}
+
+// Joins two subtrees and a node with a key between them. The node is linked
+// as a red node in the taller subtree, where the black-height is the same as
+// in the shorter one, and the insertion fixup repairs the colors.
+static RedBlackTreeNode_t *
+rbt_join_node(RedBlackTree_t *tree, RedBlackTreeNode_t *L,
+              RedBlackTreeNode_t *K, RedBlackTreeNode_t *R)
+{
+    // Parts of a split might have a red root
+    if (L != NULL)
+        L->color = BLACK;
+
+    if (R != NULL)
+        R->color = BLACK;
+
+    integer_t height_l = rbt_black_height(L);
+    integer_t height_r = rbt_black_height(R);
+
+    // Rotations and the fixup change the root of the tree they are given
+    RedBlackTree_t subtree = *tree;
+
+    RedBlackTreeNode_t *N, *P = NULL;
+
+    if (height_l >= height_r)
+    {
+        subtree.root = L;
+
+        // Goes down the right spine of L
+        for (N = L; rbt_color(N) == RED || height_l > height_r; N = N->right)
+        {
+            if (rbt_color(N) == BLACK)
+                height_l--;
+
+            P = N;
+        }
+
+        K->left = N;
+        K->right = R;
+
+        if (P != NULL)
+            P->right = K;
+    }
+    else
+    {
+        subtree.root = R;
+
+        // Goes down the left spine of R
+        for (N = R; rbt_color(N) == RED || height_r > height_l; N = N->left)
+        {
+            if (rbt_color(N) == BLACK)
+                height_r--;
+
+            P = N;
+        }
+
+        K->left = L;
+        K->right = N;
+
+        if (P != NULL)
+            P->left = K;
+    }
+
+    K->color = RED;
+    K->parent = P;
+
+    if (K->left != NULL)
+        K->left->parent = K;
+
+    if (K->right != NULL)
+        K->right->parent = K;
+
+    if (P == NULL)
+        subtree.root = K;
+
+    if (tree->ranked)
+    {
+        integer_t added = rbt_count_update(K) - rbt_node_count(N);
+
+        for (; P != NULL; P = P->parent)
+            P->count += added;
+    }
+
+    rbt_insert_fixup(&subtree, K);
+
+#ifdef DS_STATS
+    tree->stats = subtree.stats;
+#endif
+
+    return subtree.root;
+}
+
+// Detaches a node from its children so it can be joined again
+static void
+rbt_expose(RedBlackTreeNode_t *N)
+{
+    if (N->left != NULL)
+        N->left->parent = NULL;
+
+    if (N->right != NULL)
+        N->right->parent = NULL;
+
+    N->left = NULL;
+    N->right = NULL;
+    N->parent = NULL;
+}
+
+// Joins two subtrees where every key of L is smaller than every key of R
+static RedBlackTreeNode_t *
+rbt_join_subtrees(RedBlackTree_t *tree, RedBlackTreeNode_t *L,
+                  RedBlackTreeNode_t *R)
+{
+    if (L == NULL)
+        return R;
+
+    RedBlackTreeNode_t *K;
+
+    L = rbt_split_last(tree, L, &K);
+
+    return rbt_join_node(tree, L, K, R);
+}
+
+// Splits a subtree into the nodes smaller and greater than an element. The
+// node with the element itself, if it exists, is returned in K.
+static void
+rbt_split_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T, void *element,
+                RedBlackTreeNode_t **L, RedBlackTreeNode_t **K,
+                RedBlackTreeNode_t **R)
+{
+    if (T == NULL)
+    {
+        *L = *K = *R = NULL;
+        return;
+    }
+
+    RedBlackTreeNode_t *X = T->left, *Y = T->right;
+
+    rbt_expose(T);
+
+    int comparison = DS_STATS_COMPARE(tree, T->key, element);
+
+    if (comparison > 0)
+    {
+        rbt_split_nodes(tree, X, element, L, K, &X);
+
+        *R = rbt_join_node(tree, X, T, Y);
+    }
+    else if (comparison < 0)
+    {
+        rbt_split_nodes(tree, Y, element, &Y, K, R);
+
+        *L = rbt_join_node(tree, X, T, Y);
+    }
+    else
+    {
+        *L = X;
+        *K = T;
+        *R = Y;
+    }
+}
+
+// Removes the maximum node of a subtree, returned in K
+static RedBlackTreeNode_t *
+rbt_split_last(RedBlackTree_t *tree, RedBlackTreeNode_t *T,
+               RedBlackTreeNode_t **K)
 {
-    switch (traversal_mode)
+    RedBlackTreeNode_t *X = T->left, *Y = T->right;
+
+    rbt_expose(T);
+
+    if (Y == NULL)
     {
-        case -1:
-            printf("Pre-order Traversal\n");
-            rbt_traversal_preorder(tree->root, tree->interface->display);
-            break;
-        case 0:
-            printf("In-order Traversal\n");
-            rbt_traversal_inorder(tree->root, tree->interface->display);
-            break;
-        case 1:
-            printf("Post-order Traversal\n");
-            rbt_traversal_postorder(tree->root, tree->interface->display);
-            break;
-        default:
-            printf("Leaves Traversal\n");
-            rbt_traversal_leaves(tree->root, tree->interface->display);
-            break;
+        *K = T;
+        return X;
     }
 
-    printf("\n");
+    Y = rbt_split_last(tree, Y, K);
+
+    return rbt_join_node(tree, X, T, Y);
 }
 
-///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+// Splits T2 by the root of T1 and joins the unions of each side back. Nodes
+// of T2 that are duplicates are freed and counted in found.
+static RedBlackTreeNode_t *
+rbt_union_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                RedBlackTreeNode_t *T2, integer_t *found)
+{
+    if (T1 == NULL)
+        return T2;
+
+    if (T2 == NULL)
+        return T1;
+
+    RedBlackTreeNode_t *X = T1->left, *Y = T1->right, *L, *K, *R;
+
+    rbt_expose(T1);
+
+    rbt_split_nodes(tree, T2, T1->key, &L, &K, &R);
+
+    if (K != NULL)
+    {
+        rbt_free_node(tree->pool, K, tree->interface->free);
+
+        (*found)++;
+    }
+
+    X = rbt_union_nodes(tree, X, L, found);
+    Y = rbt_union_nodes(tree, Y, R, found);
+
+    return rbt_join_node(tree, X, T1, Y);
+}
 
+// Splits T1 by the root of T2 and only keeps the node that matched it. The
+// nodes kept are counted in found. T2 is not changed.
 static RedBlackTreeNode_t *
-rbt_new_node(void *element)
+rbt_intersection_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                       RedBlackTreeNode_t *T2, integer_t *found)
 {
-    RedBlackTreeNode_t *node = malloc(sizeof(RedBlackTreeNode_t));
+    if (T1 == NULL)
+        return NULL;
 
-    if (!node)
+    if (T2 == NULL)
+    {
+        rbt_free_tree(tree->pool, T1, tree->interface->free);
         return NULL;
+    }
 
-    // All new nodes are red
-    node->color = RED;
-    node->key = element;
+    RedBlackTreeNode_t *L, *K, *R;
 
-    node->parent = NULL;
-    node->left = NULL;
-    node->right = NULL;
+    rbt_split_nodes(tree, T1, T2->key, &L, &K, &R);
 
-    return node;
+    L = rbt_intersection_nodes(tree, L, T2->left, found);
+    R = rbt_intersection_nodes(tree, R, T2->right, found);
+
+    if (K == NULL)
+        return rbt_join_subtrees(tree, L, R);
+
+    (*found)++;
+
+    return rbt_join_node(tree, L, K, R);
 }
 
-static void
-rbt_free_node(RedBlackTreeNode_t *node, free_f function)
+// Splits T1 by the root of T2 and frees the node that matched it. The nodes
+// freed are counted in found. T2 is not changed.
+static RedBlackTreeNode_t *
+rbt_difference_nodes(RedBlackTree_t *tree, RedBlackTreeNode_t *T1,
+                     RedBlackTreeNode_t *T2, integer_t *found)
 {
-    function(node->key);
+    if (T1 == NULL)
+        return NULL;
+
+    if (T2 == NULL)
+        return T1;
+
+    RedBlackTreeNode_t *L, *K, *R;
+
+    rbt_split_nodes(tree, T1, T2->key, &L, &K, &R);
+
+    if (K != NULL)
+    {
+        rbt_free_node(tree->pool, K, tree->interface->free);
 
-    free(node);
+        (*found)++;
+    }
+
+    L = rbt_difference_nodes(tree, L, T2->left, found);
+    R = rbt_difference_nodes(tree, R, T2->right, found);
+
+    return rbt_join_subtrees(tree, L, R);
 }
 
-static void
-rbt_free_node_shallow(RedBlackTreeNode_t *node)
+// Writes the elements of a subtree in ascending order
+static bool
+rbt_save_tree(RedBlackTree_t *tree, RedBlackTreeNode_t *root, FILE *stream)
 {
-    free(node);
+    while (root != NULL)
+    {
+        if (!rbt_save_tree(tree, root->left, stream)
+            || !tree->interface->serialize(root->key, stream))
+            return false;
+
+        root = root->right;
+    }
+
+    return true;
 }
 
-static void
-rbt_free_tree(RedBlackTreeNode_t *root, free_f function)
+// Visits in order the elements of a subtree between low and high without
+// parent pointers, so it also works on persistent trees and snapshots
+static integer_t
+rbt_range_nodes(Interface_t *interface, RedBlackTreeNode_t *root, void *low,
+                void *high, visit_f visit, void *argument)
 {
-    RedBlackTreeNode_t *scan = root;
-    RedBlackTreeNode_t *up = NULL;
+    integer_t total = 0;
 
-    while (scan != NULL)
+    while (root != NULL)
     {
-        if (scan->left != NULL)
+        if (interface->compare(root->key, low) < 0)
         {
-            RedBlackTreeNode_t *left = scan->left;
-
-            scan->left = up;
-            up = scan;
-            scan = left;
+            root = root->right;
+            continue;
         }
-        else if (scan->right != NULL)
-        {
-            RedBlackTreeNode_t *right = scan->right;
 
-            scan->left = up;
-            scan->right = NULL;
-            up = scan;
-            scan = right;
+        if (interface->compare(root->key, high) > 0)
+        {
+            root = root->left;
+            continue;
         }
+
+        total += rbt_range_nodes(interface, root->left, low, high, visit,
+                                 argument);
+
+        visit(root->key, argument);
+        total++;
+
+        root = root->right;
+    }
+
+    return total;
+}
+
+// Frees the history of a persistent tree, its retired and spare nodes. No
+// snapshot can be alive.
+static void
+rbt_history_delete(RedBlackTree_t *tree)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    while (history->retired)
+    {
+        RedBlackTreeNode_t *node = history->retired;
+        history->retired = node->parent;
+
+        if (node->release)
+            rbt_free_node(tree->pool, node, tree->interface->free);
         else
-        {
-            if (up == NULL)
-            {
-                rbt_free_node(scan, function);
-                scan = NULL;
-            }
+            rbt_free_node_shallow(tree->pool, node);
+    }
 
-            while (up != NULL)
-            {
-                rbt_free_node(scan, function);
+    while (history->spare)
+    {
+        RedBlackTreeNode_t *node = history->spare;
+        history->spare = node->parent;
 
-                if (up->right != NULL)
-                {
-                    scan = up->right;
-                    up->right = NULL;
-                    break;
-                }
-                else
-                {
-                    scan = up;
-                    up = up->left;
-                }
-            }
-        }
+        rbt_free_node_shallow(tree->pool, node);
+    }
+
+    pthread_mutex_destroy(&history->lock);
+    free(history);
+
+    tree->history = NULL;
+}
+
+// Starts an operation on a persistent tree. Retired nodes that left the tree
+// after the version of the oldest live snapshot might still be seen by it,
+// all others are reclaimed.
+static void
+rbt_history_begin(RedBlackTree_t *tree)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    pthread_mutex_lock(&history->lock);
+
+    bool alive = history->oldest != NULL;
+    integer_t oldest = alive ? history->oldest->version : 0;
+
+    pthread_mutex_unlock(&history->lock);
+
+    history->shared = alive;
+
+    while (history->retired
+           && (!alive || history->retired->version <= oldest))
+    {
+        RedBlackTreeNode_t *node = history->retired;
+        history->retired = node->parent;
+
+        if (node->release)
+            rbt_free_node(tree->pool, node, tree->interface->free);
+        else
+            rbt_free_node_shallow(tree->pool, node);
+    }
+
+    if (!history->retired)
+        history->last_retired = NULL;
+}
+
+// Allocates beforehand every node an insertion or removal might copy, so that
+// it can't fail halfway with some paths already copied
+static bool
+rbt_history_reserve(RedBlackTree_t *tree)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    // The height of a left-leaning red-black tree is at most 2 * log2(n + 1)
+    integer_t levels = 2;
+
+    for (integer_t n = tree->size + 1; n > 1; n >>= 1)
+        levels += 2;
+
+    integer_t needed = history->shared ? RBT_COPIES_PER_LEVEL * levels + 1
+                                       : 1;
+
+    while (history->spares < needed)
+    {
+        RedBlackTreeNode_t *node = npl_node_alloc(tree->pool,
+                sizeof(RedBlackTreeNode_t));
+
+        if (!node)
+            return false;
+
+        node->parent = history->spare;
+        history->spare = node;
+        history->spares++;
+    }
+
+    return true;
+}
+
+// Takes a reserved node for the given element, created at this version
+static RedBlackTreeNode_t *
+rbt_history_node(RedBlackTree_t *tree, void *element)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    RedBlackTreeNode_t *node = history->spare;
+    history->spare = node->parent;
+    history->spares--;
+
+    node->key = element;
+    node->color = RED;
+    node->release = false;
+    node->left = NULL;
+    node->right = NULL;
+    node->parent = NULL;
+    node->version = tree->version_id;
+
+    return node;
+}
+
+// Takes a node out of a persistent tree. It is freed right away if no
+// snapshot is alive, otherwise it waits for the snapshots that might see it.
+static void
+rbt_history_retire(RedBlackTree_t *tree, RedBlackTreeNode_t *node,
+                   bool release)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    if (!history->shared)
+    {
+        if (release)
+            rbt_free_node(tree->pool, node, tree->interface->free);
+        else
+            rbt_free_node_shallow(tree->pool, node);
+
+        return;
+    }
+
+    // Snapshots only read the key and the children
+    node->release = release;
+    node->version = tree->version_id;
+    node->parent = NULL;
+
+    if (history->last_retired)
+        history->last_retired->parent = node;
+    else
+        history->retired = node;
+
+    history->last_retired = node;
+}
+
+static void
+rbt_history_retire_tree(RedBlackTree_t *tree, RedBlackTreeNode_t *root,
+                        bool release)
+{
+    while (root != NULL)
+    {
+        RedBlackTreeNode_t *right = root->right;
+
+        rbt_history_retire_tree(tree, root->left, release);
+        rbt_history_retire(tree, root, release);
+
+        root = right;
     }
 }
 
-static void
-rbt_free_tree_shallow(RedBlackTreeNode_t *root)
+// Returns a node that can be changed in place. A node created up to the
+// version of the newest snapshot might be seen by a live snapshot, so it is
+// copied and the original is retired.
+static RedBlackTreeNode_t *
+rbt_history_own(RedBlackTree_t *tree, RedBlackTreeNode_t *node)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
+
+    if (node == NULL || !history->shared || node->version > history->frozen)
+        return node;
+
+    RedBlackTreeNode_t *copy = rbt_history_node(tree, node->key);
+
+    copy->color = node->color;
+    copy->left = node->left;
+    copy->right = node->right;
+
+    rbt_history_retire(tree, node, false);
+
+    return copy;
+}
+
+static bool
+rbt_history_insert(RedBlackTree_t *tree, void *element)
+{
+    if (rbt_find(tree, element) != NULL)
+        return false;
+
+    rbt_history_begin(tree);
+
+    if (!rbt_history_reserve(tree))
+        return false;
+
+    tree->version_id++;
+
+    RedBlackTreeNode_t *node = rbt_history_node(tree, element);
+
+    tree->root = rbt_history_insert_node(tree, tree->root, node);
+    tree->root->color = BLACK;
+
+    tree->size++;
+
+    DS_STATS_ADD(tree, allocations, 1);
+
+    return true;
+}
+
+static bool
+rbt_history_remove(RedBlackTree_t *tree, void *element)
+{
+    if (rbt_find(tree, element) == NULL)
+        return false;
+
+    rbt_history_begin(tree);
+
+    if (!rbt_history_reserve(tree))
+        return false;
+
+    tree->version_id++;
+
+    tree->root = rbt_history_own(tree, tree->root);
+
+    if (rbt_color(tree->root->left) == BLACK
+        && rbt_color(tree->root->right) == BLACK)
+        tree->root->color = RED;
+
+    tree->root = rbt_history_remove_node(tree, tree->root, element);
+
+    if (tree->root != NULL)
+        tree->root->color = BLACK;
+
+    tree->size--;
+
+    DS_STATS_ADD(tree, frees, 1);
+
+    return true;
+}
+
+static RedBlackTreeNode_t *
+rbt_history_insert_node(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                        RedBlackTreeNode_t *node)
+{
+    if (h == NULL)
+        return node;
+
+    h = rbt_history_own(tree, h);
+
+    if (DS_STATS_COMPARE(tree, h->key, node->key) > 0)
+        h->left = rbt_history_insert_node(tree, h->left, node);
+    else
+        h->right = rbt_history_insert_node(tree, h->right, node);
+
+    return rbt_history_balance(tree, h);
+}
+
+// Removes an element known to be in the subtree. The node that holds it is
+// replaced by its successor instead of swapping their keys, which would
+// change a node that snapshots might see.
+static RedBlackTreeNode_t *
+rbt_history_remove_node(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                        void *element)
 {
-    RedBlackTreeNode_t *scan = root;
-    RedBlackTreeNode_t *up = NULL;
+    h = rbt_history_own(tree, h);
 
-    while (scan != NULL)
+    if (DS_STATS_COMPARE(tree, h->key, element) > 0)
     {
-        if (scan->left != NULL)
-        {
-            RedBlackTreeNode_t *left = scan->left;
+        if (rbt_color(h->left) == BLACK && rbt_color(h->left->left) == BLACK)
+            h = rbt_history_move_red_left(tree, h);
 
-            scan->left = up;
-            up = scan;
-            scan = left;
-        }
-        else if (scan->right != NULL)
-        {
-            RedBlackTreeNode_t *right = scan->right;
+        h->left = rbt_history_remove_node(tree, h->left, element);
 
-            scan->left = up;
-            scan->right = NULL;
-            up = scan;
-            scan = right;
-        }
-        else
-        {
-            if (up == NULL)
-            {
-                rbt_free_node_shallow(scan);
-                scan = NULL;
-            }
+        return rbt_history_balance(tree, h);
+    }
 
-            while (up != NULL)
-            {
-                rbt_free_node_shallow(scan);
+    if (rbt_color(h->left) == RED)
+        h = rbt_history_rotate_right(tree, h);
 
-                if (up->right != NULL)
-                {
-                    scan = up->right;
-                    up->right = NULL;
-                    break;
-                }
-                else
-                {
-                    scan = up;
-                    up = up->left;
-                }
-            }
-        }
+    if (h->right == NULL && DS_STATS_COMPARE(tree, h->key, element) == 0)
+    {
+        rbt_history_retire(tree, h, true);
+        return NULL;
     }
-}
 
-static void
-rbt_rotate_left(RedBlackTree_t *tree, RedBlackTreeNode_t *X)
-{
-    RedBlackTreeNode_t *Y = X->right;
+    if (rbt_color(h->right) == BLACK && rbt_color(h->right->left) == BLACK)
+        h = rbt_history_move_red_right(tree, h);
 
-    X->right = Y->left;
+    if (DS_STATS_COMPARE(tree, h->key, element) == 0)
+    {
+        RedBlackTreeNode_t *min = NULL;
+        RedBlackTreeNode_t *right = rbt_history_remove_min(tree, h->right,
+                                                           &min);
 
-    if (Y->left != NULL)
-        Y->left->parent = X;
+        min = rbt_history_own(tree, min);
 
-    Y->parent = X->parent;
+        min->left = h->left;
+        min->right = right;
+        min->color = h->color;
 
-    if (X->parent == NULL)
-        tree->root = Y;
-    else if (X == X->parent->left)
-        X->parent->left = Y;
+        rbt_history_retire(tree, h, true);
+
+        h = min;
+    }
     else
-        X->parent->right = Y;
+        h->right = rbt_history_remove_node(tree, h->right, element);
 
-    Y->left = X;
-    X->parent = Y;
+    return rbt_history_balance(tree, h);
 }
 
-static void
-rbt_rotate_right(RedBlackTree_t *tree, RedBlackTreeNode_t *X)
+// Unlinks the minimum node of a subtree and gives it back through min
+// without changing it
+static RedBlackTreeNode_t *
+rbt_history_remove_min(RedBlackTree_t *tree, RedBlackTreeNode_t *h,
+                       RedBlackTreeNode_t **min)
 {
-    RedBlackTreeNode_t *Y = X->left;
-
-    X->left = Y->right;
+    if (h->left == NULL)
+    {
+        *min = h;
+        return NULL;
+    }
 
-    if (Y->right != NULL)
-        Y->right->parent = X;
+    h = rbt_history_own(tree, h);
 
-    Y->parent = X->parent;
+    if (rbt_color(h->left) == BLACK && rbt_color(h->left->left) == BLACK)
+        h = rbt_history_move_red_left(tree, h);
 
-    if (X->parent == NULL)
-        tree->root = Y;
-    else if (X == X->parent->left)
-        X->parent->left = Y;
-    else
-        X->parent->right = Y;
+    h->left = rbt_history_remove_min(tree, h->left, min);
 
-    Y->right = X;
-    X->parent = Y;
+    return rbt_history_balance(tree, h);
 }
 
-static void
-rbt_insert_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *Z)
+// The following functions expect h to be owned and own every other node they
+// change
+
+static RedBlackTreeNode_t *
+rbt_history_rotate_left(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
 {
-    RedBlackTreeNode_t *Y;
+    RedBlackTreeNode_t *x = rbt_history_own(tree, h->right);
 
-    // Cases 1, 2, 3 are symmetric to 4, 5, 6
-    while (rbt_color(Z->parent) == RED)
-    {
-        if (Z->parent == Z->parent->parent->left)
-        {
-            // Uncle
-            Y = Z->parent->parent->right;
+    h->right = x->left;
+    x->left = h;
+    x->color = h->color;
+    h->color = RED;
 
-            // Uncle is red, recolor parent and grandparent
-            // CASE 1 (symmetrical to 4)
-            if (rbt_color(Y) == RED)
-            {
-                Z->parent->color = BLACK;
-                Y->color = BLACK;
-                Z->parent->parent->color = RED;
-                Z = Z->parent->parent;
-            }
-            else
-            {
-                // CASE 2 (symmetrical to 5)
-                // Left-right skewed
-                if (Z == Z->parent->right)
-                {
-                    Z = Z->parent;
-                    rbt_rotate_left(tree, Z);
-                }
-                // Left-Left skewed
-                // CASE 3 (symmetrical to 6)
-                Z->parent->color = BLACK;
-                Z->parent->parent->color = RED;
-                rbt_rotate_right(tree, Z->parent->parent);
-            }
-        }
-        else /* if Z->parent == Z->parent->parent->right */
-        {
-            // Uncle
-            Y = Z->parent->parent->left;
+    return x;
+}
 
-            // Uncle is red, recolor parent and grandparent
-            // CASE 4 (symmetrical to 1)
-            if (rbt_color(Y) == RED)
-            {
-                Z->parent->color = BLACK;
-                Y->color = BLACK;
-                Z->parent->parent->color = RED;
-                Z = Z->parent->parent;
-            }
-            else
-            {
-                // CASE 5 (symmetrical to 2)
-                // Right-left skewed
-                if (Z == Z->parent->left)
-                {
-                    Z = Z->parent;
-                    rbt_rotate_right(tree, Z);
-                }
-                // CASE 6 (symmetrical to 3)
-                // Right-Right skewed
-                Z->parent->color = BLACK;
-                Z->parent->parent->color = RED;
-                rbt_rotate_left(tree, Z->parent->parent);
-            }
-        }
-    }
+static RedBlackTreeNode_t *
+rbt_history_rotate_right(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
+{
+    RedBlackTreeNode_t *x = rbt_history_own(tree, h->left);
 
-    //keep root always black
-    tree->root->color = BLACK;
+    h->left = x->right;
+    x->right = h;
+    x->color = h->color;
+    h->color = RED;
+
+    return x;
 }
 
 static void
-rbt_remove_fixup(RedBlackTree_t *tree, RedBlackTreeNode_t *X)
+rbt_history_flip(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
 {
-    RedBlackTreeNode_t *W = NULL;
-
-    while (X && X != tree->root && rbt_color(X) == BLACK)
-    {
-        if (X == X->parent->left)
-        {
-            W = X->parent->right;
+    h->left = rbt_history_own(tree, h->left);
+    h->right = rbt_history_own(tree, h->right);
 
-            // CASE 1
-            if (rbt_color(W) == RED)
-            {
-                W->color = BLACK;
-                X->parent->color = RED;
-                rbt_rotate_left(tree, X->parent);
-                W = X->parent->right;
-            }
+    h->color = !h->color;
 
-            // CASE 2
-            if (rbt_color(W->left) == BLACK && rbt_color(W->right) == BLACK)
-            {
-                W->color = RED;
-                X = X->parent;
-            }
-            else
-            {
-                // CASE 3
-                if (rbt_color(W->right) == BLACK)
-                {
-                    if (W->left != NULL)
-                        W->left->color = BLACK;
+    if (h->left != NULL)
+        h->left->color = !h->left->color;
 
-                    W->color = RED;
-                    rbt_rotate_right(tree, W);
-                    W = X->parent->right;
-                }
+    if (h->right != NULL)
+        h->right->color = !h->right->color;
+}
 
-                // CASE 4
-                W->color = X->parent->color;
-                X->parent->color = BLACK;
+static RedBlackTreeNode_t *
+rbt_history_move_red_left(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
+{
+    rbt_history_flip(tree, h);
 
-                if (W->right != NULL)
-                    W->right->color = BLACK;
+    if (rbt_color(h->right->left) == RED)
+    {
+        h->right = rbt_history_rotate_right(tree, h->right);
+        h = rbt_history_rotate_left(tree, h);
+        rbt_history_flip(tree, h);
+    }
 
-                rbt_rotate_left(tree, X->parent);
-                X = tree->root;
-            }
-        }
-        else /* if X == X->parent->right */
-        {
-            W = X->parent->left;
+    return h;
+}
 
-            // CASE 1
-            if (rbt_color(W) == RED)
-            {
-                W->color = BLACK;
-                X->parent->color = RED;
-                rbt_rotate_right(tree, X->parent);
-                W = X->parent->left;
-            }
+static RedBlackTreeNode_t *
+rbt_history_move_red_right(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
+{
+    rbt_history_flip(tree, h);
 
-            // CASE 2
-            if (rbt_color(W->left) == BLACK && rbt_color(W->right) == BLACK)
-            {
-                W->color = RED;
-                X = X->parent;
-            }
-            else
-            {
-                // CASE 3
-                if (rbt_color(W->left) == BLACK)
-                {
-                    if (W->right != NULL)
-                        W->right->color = BLACK;
+    if (rbt_color(h->left->left) == RED)
+    {
+        h = rbt_history_rotate_right(tree, h);
+        rbt_history_flip(tree, h);
+    }
 
-                    W->color = RED;
-                    rbt_rotate_left(tree, W);
-                    W = X->parent->left;
-                }
+    return h;
+}
 
-                // CASE 4
-                W->color = X->parent->color;
-                X->parent->color = BLACK;
+static RedBlackTreeNode_t *
+rbt_history_balance(RedBlackTree_t *tree, RedBlackTreeNode_t *h)
+{
+    if (rbt_color(h->right) == RED && rbt_color(h->left) == BLACK)
+        h = rbt_history_rotate_left(tree, h);
 
-                if (W->left != NULL)
-                    W->left->color = BLACK;
+    if (rbt_color(h->left) == RED && rbt_color(h->left->left) == RED)
+        h = rbt_history_rotate_right(tree, h);
 
-                rbt_rotate_right(tree, X->parent);
-                X = tree->root;
-            }
-        }
-    } /* End While */
+    if (rbt_color(h->left) == RED && rbt_color(h->right) == RED)
+        rbt_history_flip(tree, h);
 
-    if (X != NULL)
-        X->color = BLACK;
+    return h;
 }
 
-static RedBlackTreeNode_t *
-rbt_find(RedBlackTree_t *tree, void *element)
+// Restores the parent pointers of a tree that is no longer persistent
+static void
+rbt_history_link(RedBlackTreeNode_t *root, RedBlackTreeNode_t *parent)
 {
-    RedBlackTreeNode_t *scan = tree->root;
-
-    while (scan != NULL)
+    while (root != NULL)
     {
-        if (tree->interface->compare(scan->key, element) > 0)
-            scan = scan->left;
-        else if (tree->interface->compare(scan->key, element) < 0)
-            scan = scan->right;
-        else
-            return scan;
+        root->parent = parent;
+
+        rbt_history_link(root->left, root);
+
+        parent = root;
+        root = root->right;
     }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// An iterator that walks through the elements of a RedBlackTree_s in order. It
+/// only keeps the current node and follows the parent pointers to reach the
+/// next or previous one, so a full iteration takes linear time and each step
+/// takes constant time on average. The iterator can be placed at the start of a
+/// range with rbt_iter_lower_bound() or rbt_iter_upper_bound().
+///
+/// If the tree is modified the cursor might point to a node that was freed.
+/// Until the iterator is placed again with rbt_iter_to_start(),
+/// rbt_iter_to_end() or one of the bound functions, all other functions fail.
+/// They always fail on persistent trees, which have no parent pointers.
+struct RedBlackTreeIterator_s
+{
+    /// \brief Target RedBlackTree_s.
+    ///
+    /// Target RedBlackTree_s. The iterator might need to use some information
+    /// provided by the tree.
+    struct RedBlackTree_s *target;
+
+    /// \brief Current node.
+    ///
+    /// The node of the element pointed by the cursor or NULL if the tree is
+    /// empty or a bound was not found.
+    struct RedBlackTreeNode_s *cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is placed it stores the version_id of the target
+    /// structure.
+    integer_t target_id;
+};
 
-    return NULL;
-}
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static RedBlackTreeNode_t *
-rbt_successor(RedBlackTreeNode_t *N)
+static bool
+rbt_iter_target_modified(RedBlackTreeIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new iterator with its cursor at the minimum element of the
+/// target tree.
+///
+/// \param target The target tree.
+///
+/// \return A new iterator or NULL if allocation failed.
+RedBlackTreeIterator_t *
+rbt_iter_new(RedBlackTree_t *target)
 {
-    if (N->right != NULL)
-        return rbt_minimum(N->right);
+    RedBlackTreeIterator_t *iter = malloc(sizeof(RedBlackTreeIterator_t));
 
-    RedBlackTreeNode_t *Y = N->parent;
+    if (!iter)
+        return NULL;
 
-    while (Y != NULL && N == Y->right)
-    {
-        N = Y;
-        Y = Y->parent;
-    }
+    rbt_iter_retarget(iter, target);
 
-    return Y;
+    return iter;
 }
 
-static RedBlackTreeNode_t *
-rbt_minimum(RedBlackTreeNode_t *N)
+/// Changes the target tree of an iterator and moves its cursor to the
+/// minimum element.
+///
+/// \param iter The iterator to be retargeted.
+/// \param target The new target tree.
+void
+rbt_iter_retarget(RedBlackTreeIterator_t *iter, RedBlackTree_t *target)
 {
-    // Finds the minimum node of subtree N
-    while (N->left != NULL)
-        N = N->left;
+    iter->target = target;
 
-    return N;
+    rbt_iter_to_start(iter);
 }
 
-static RedBlackTreeNode_t *
-rbt_maximum(RedBlackTreeNode_t *N)
+/// Frees from memory an iterator. The target tree is not changed.
+///
+/// \param iter The iterator to be freed from memory.
+void
+rbt_iter_free(RedBlackTreeIterator_t *iter)
 {
-    // Finds the maximum node of subtree N
-    while (N->right != NULL)
-        N = N->right;
-
-    return N;
+    free(iter);
 }
 
-static void
-rbt_transplant(RedBlackTree_t *tree, RedBlackTreeNode_t *U,
-        RedBlackTreeNode_t *V)
+/// Moves the cursor to the next element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the maximum element, if it is not at
+/// any element or if the target was modified.
+bool
+rbt_iter_next(RedBlackTreeIterator_t *iter)
 {
-    if (U->parent == NULL)
-        tree->root = V;
-    else if (U == U->parent->left)
-        U->parent->left = V;
-    else
-        U->parent->right = V;
+    if (!rbt_iter_has_next(iter))
+        return false;
 
-    if (V == NULL)
-        return;
+    iter->cursor = rbt_successor(iter->cursor);
 
-    V->parent = U->parent;
+    return true;
 }
 
-static bool
-rbt_color(RedBlackTreeNode_t *node)
+/// Moves the cursor to the previous element in ascending order.
+///
+/// \param iter The iterator.
+///
+/// \return False if the cursor is at the minimum element, if it is not at
+/// any element or if the target was modified.
+bool
+rbt_iter_prev(RedBlackTreeIterator_t *iter)
 {
-    if (node == NULL)
-        return BLACK;
+    if (!rbt_iter_has_prev(iter))
+        return false;
 
-    return node->color;
+    iter->cursor = rbt_predecessor(iter->cursor);
+
+    return true;
 }
 
-static void
-rbt_display_tree(RedBlackTreeNode_t *root, integer_t height,
-                 display_f function)
+/// Moves the cursor to the minimum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+rbt_iter_to_start(RedBlackTreeIterator_t *iter)
 {
-    if (root == NULL)
-        return;
+    RedBlackTree_t *tree = iter->target;
 
-    rbt_display_tree(root->right, height + 1, function);
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? rbt_minimum(tree->root) : NULL;
 
-    for (integer_t i = 0; i < height; i++)
-        printf("|------- ");
+    return iter->cursor != NULL;
+}
 
-    function(root->key);
+/// Moves the cursor to the maximum element. Can be used after the target was
+/// modified.
+///
+/// \param iter The iterator.
+///
+/// \return False if the target is empty.
+bool
+rbt_iter_to_end(RedBlackTreeIterator_t *iter)
+{
+    RedBlackTree_t *tree = iter->target;
 
-    printf("\n");
+    iter->target_id = tree->version_id;
+    iter->cursor = tree->root ? rbt_maximum(tree->root) : NULL;
 
-    rbt_display_tree(root->left, height + 1, function);
+    return iter->cursor != NULL;
 }
 
-static void
-rbt_display_color(RedBlackTreeNode_t *root, integer_t height,
-        display_f function)
+/// Moves the cursor to the first element that is not smaller than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if every element is smaller than the given one. The cursor
+/// is then not at any element.
+bool
+rbt_iter_lower_bound(RedBlackTreeIterator_t *iter, void *element)
 {
-    if (root == NULL)
-        return;
-
-    rbt_display_color(root->right, height + 1, function);
+    iter->target_id = iter->target->version_id;
+    iter->cursor = rbt_bound(iter->target, element, false);
 
-    for (integer_t i = 0; i < height - 1; i++)
-        printf("        ");
-
-    printf("|---%c---< ", root->color ? 'B' : 'R');
+    return iter->cursor != NULL;
+}
 
-    function(root->key);
-    printf("\n");
+/// Moves the cursor to the first element that is bigger than the given
+/// element. Can be used after the target was modified.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param iter The iterator.
+/// \param element The element to be compared.
+///
+/// \return False if no element is bigger than the given one. The cursor is
+/// then not at any element.
+bool
+rbt_iter_upper_bound(RedBlackTreeIterator_t *iter, void *element)
+{
+    iter->target_id = iter->target->version_id;
+    iter->cursor = rbt_bound(iter->target, element, true);
 
-    rbt_display_color(root->left, height + 1, function);
+    return iter->cursor != NULL;
 }
 
-static void
-rbt_display_simple(RedBlackTreeNode_t *root, integer_t height,
-        display_f function)
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a successor and the
+/// target was not modified.
+bool
+rbt_iter_has_next(RedBlackTreeIterator_t *iter)
 {
-    if (root == NULL)
-        return;
-
-    rbt_display_simple(root->right, height + 1, function);
+    if (rbt_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
 
-    for (integer_t i = 0; i < height; i++)
-        printf("        ");
+    return rbt_successor(iter->cursor) != NULL;
+}
 
-    function(root->key);
-    printf("\n");
+/// \param iter The iterator.
+///
+/// \return True if the cursor is at an element that has a predecessor and
+/// the target was not modified.
+bool
+rbt_iter_has_prev(RedBlackTreeIterator_t *iter)
+{
+    if (rbt_iter_target_modified(iter) || iter->cursor == NULL)
+        return false;
 
-    rbt_display_simple(root->left, height + 1, function);
+    return rbt_predecessor(iter->cursor) != NULL;
 }
 
-static void
-rbt_display_treeview(RedBlackTreeNode_t *root, integer_t depth, char *path,
-        display_f function, bool direction)
+/// \param iter The iterator.
+///
+/// \return The element at the cursor or NULL if the cursor is not at any
+/// element or the target was modified.
+void *
+rbt_iter_peek(RedBlackTreeIterator_t *iter)
 {
-    const integer_t spaces = 8;
+    if (rbt_iter_target_modified(iter) || iter->cursor == NULL)
+        return NULL;
 
-    if (root == NULL)
-        return;
+    return iter->cursor->key;
+}
 
-    depth++;
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-    rbt_display_treeview(root->right, depth, path, function, true);
+static bool
+rbt_iter_target_modified(RedBlackTreeIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id
+           || iter->target->history != NULL;
+}
 
-    path[depth - 2] = 0;
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
-    if(direction)
-        path[depth - 2] = 1;
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Snapshot ///
+///////////////////////////////////////////////////////////////////////////////
 
-    if(root->left)
-        path[depth - 1] = 1;
+/// Takes an immutable version of a persistent RedBlackTree_s in constant
+/// time. The snapshot can be read from any thread without locks while the
+/// tree keeps changing, and the nodes it sees are kept until it is released.
+/// Only the thread that changes the tree may take snapshots.
+///
+/// \param tree RedBlackTree_s reference.
+///
+/// \return A new snapshot or NULL if the tree is not persistent or allocation
+/// failed.
+RedBlackTreeSnapshot_t *
+rbt_snapshot(RedBlackTree_t *tree)
+{
+    struct RedBlackTreeHistory_s *history = tree->history;
 
-    printf("\n");
+    if (!history)
+        return NULL;
 
-    for (integer_t i = 0; i < depth - 1; i++)
-    {
-        if (i == depth - 2)
-            printf("%c", direction ? 218 : 192);
-        else if (path[i])
-            printf("%c", 179);
-        else
-            printf(" ");
+    RedBlackTreeSnapshot_t *snapshot = malloc(sizeof(RedBlackTreeSnapshot_t));
 
-        for (integer_t j = 1; j < spaces; j++)
-            if (i < depth - 2)
-                printf(" ");
-            else
-                printf("%c", 196);
-    }
+    if (!snapshot)
+        return NULL;
 
-    printf(" ");
-    function(root->key);
-    printf("\n");
+    snapshot->root = tree->root;
+    snapshot->size = tree->size;
+    snapshot->version = tree->version_id;
+    snapshot->interface = tree->interface;
+    snapshot->history = history;
+    snapshot->newer = NULL;
 
-    for (int i = 0; i < depth; i++)
-    {
-        if (path[i] && (root->left || i != depth -1))
-            printf("%c", 179);
-        else
-            printf(" ");
+    pthread_mutex_lock(&history->lock);
 
-        for (integer_t j = 1; j < spaces; j++)
-            printf(" ");
-    }
+    snapshot->older = history->newest;
 
-    rbt_display_treeview(root->left, depth, path, function, false);
-}
+    if (history->newest)
+        history->newest->newer = snapshot;
+    else
+        history->oldest = snapshot;
 
-static void
-rbt_traversal_preorder(RedBlackTreeNode_t *root, display_f function)
-{
-    if (root == NULL)
-        return;
+    history->newest = snapshot;
 
-    function(root->key);
-    printf(" ");
+    pthread_mutex_unlock(&history->lock);
 
-    rbt_traversal_preorder(root->left, function);
+    history->frozen = tree->version_id;
 
-    rbt_traversal_preorder(root->right, function);
+    return snapshot;
 }
 
-static void
-rbt_traversal_inorder(RedBlackTreeNode_t *root, display_f function)
+/// Releases a snapshot. It can be called from any thread. The nodes that only
+/// this snapshot could see are reclaimed by the next change to the tree.
+///
+/// \param snapshot The snapshot to be released.
+void
+rbt_snapshot_release(RedBlackTreeSnapshot_t *snapshot)
 {
-    if (root == NULL)
-        return;
-
-    rbt_traversal_inorder(root->left, function);
-
-    function(root->key);
-    printf(" ");
+    struct RedBlackTreeHistory_s *history = snapshot->history;
 
-    rbt_traversal_inorder(root->right, function);
-}
+    pthread_mutex_lock(&history->lock);
 
-static void
-rbt_traversal_postorder(RedBlackTreeNode_t *root, display_f function)
-{
-    if (root == NULL)
-        return;
+    if (snapshot->older)
+        snapshot->older->newer = snapshot->newer;
+    else
+        history->oldest = snapshot->newer;
 
-    rbt_traversal_postorder(root->left, function);
+    if (snapshot->newer)
+        snapshot->newer->older = snapshot->older;
+    else
+        history->newest = snapshot->older;
 
-    rbt_traversal_postorder(root->right, function);
+    pthread_mutex_unlock(&history->lock);
 
-    function(root->key);
-    printf(" ");
+    free(snapshot);
 }
 
-static void
-rbt_traversal_leaves(RedBlackTreeNode_t *root, display_f function)
+/// \param snapshot The snapshot.
+///
+/// \return The amount of elements in the tree when the snapshot was taken.
+integer_t
+rbt_snapshot_size(RedBlackTreeSnapshot_t *snapshot)
 {
-    if (root == NULL)
-        return;
+    return snapshot->size;
+}
 
-    rbt_traversal_leaves(root->left, function);
+/// Every change to a tree increases its version, so two snapshots with the
+/// same version have the same elements.
+///
+/// \param snapshot The snapshot.
+///
+/// \return The version of the tree when the snapshot was taken.
+integer_t
+rbt_snapshot_version(RedBlackTreeSnapshot_t *snapshot)
+{
+    return snapshot->version;
+}
 
-    rbt_traversal_leaves(root->right, function);
+/// \par Interface Requirements
+/// - compare
+///
+/// \param snapshot The snapshot.
+/// \param element The element to be searched.
+///
+/// \return True if the element was in the tree when the snapshot was taken.
+bool
+rbt_snapshot_contains(RedBlackTreeSnapshot_t *snapshot, void *element)
+{
+    RedBlackTreeNode_t *scan = snapshot->root;
 
-    if (root->right == NULL && root->left == NULL)
+    while (scan != NULL)
     {
-        function(root->key);
-        printf(" ");
-    }
-}
+        int comparison = snapshot->interface->compare(scan->key, element);
 
-////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
+            scan = scan->right;
+        else
+            return true;
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////// Iterator ///
-///////////////////////////////////////////////////////////////////////////////
+    return false;
+}
 
-/// \todo RedBlackTreeIterator
+/// Calls a function with every element of the snapshot that is not smaller
+/// than \c low and not bigger than \c high, in ascending order.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param snapshot The snapshot.
+/// \param low Lower bound of the range.
+/// \param high Upper bound of the range.
+/// \param visit A function called with each element and the argument.
+/// \param argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+rbt_snapshot_range(RedBlackTreeSnapshot_t *snapshot, void *low, void *high,
+                   visit_f visit, void *argument)
+{
+    return rbt_range_nodes(snapshot->interface, snapshot->root, low, high,
+                           visit, argument);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
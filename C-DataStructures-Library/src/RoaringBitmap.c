@@ -0,0 +1,1589 @@
+/**
+ * @file RoaringBitmap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "RoaringBitmap.h"
+#include "BitKernels.h"
+#include <inttypes.h>
+
+/// Maximum amount of values in an array container. Above it a bitmap
+/// container is smaller.
+#define RBM_ARRAY_MAX 4096
+
+/// Amount of words in a bitmap container.
+#define RBM_WORDS (65536 / 64)
+
+/// \brief Types of RoaringContainer_s.
+///
+/// Implementation detail.
+enum RoaringType
+{
+    RoaringArray  = 0, ///< Sorted array of 16-bit values.
+    RoaringWords  = 1, ///< Bitmap of 65536 bits.
+    RoaringRuns   = 2  ///< Sorted array of runs.
+};
+
+/// \brief A run of consecutive values.
+///
+/// Implementation detail. Represents the values from \c start to
+/// <code> start + length </code>, both inclusive.
+struct RoaringRun_s
+{
+    uint16_t start;
+    uint16_t length;
+};
+
+typedef struct RoaringRun_s RoaringRun_t;
+
+/// \brief A container of the lower 16 bits of values sharing the same higher
+/// 16 bits.
+///
+/// Implementation detail. Containers are kept by value in the bitmap.
+struct RoaringContainer_s
+{
+    /// \brief Container type.
+    enum RoaringType type;
+
+    /// \brief Amount of values in the container.
+    integer_t cardinality;
+
+    /// \brief Used entries in the buffer.
+    ///
+    /// Values for array containers and runs for run containers. Not used by
+    /// bitmap containers.
+    integer_t size;
+
+    /// \brief Allocated entries in the buffer.
+    integer_t capacity;
+
+    /// \brief Container buffer.
+    union
+    {
+        uint16_t *values;
+        unsigned_t *words;
+        RoaringRun_t *runs;
+    };
+};
+
+typedef struct RoaringContainer_s RoaringContainer_t;
+
+/// A RoaringBitmap_s is a compressed bitmap of 32-bit integers. The universe
+/// is split in chunks of 65536 values that share the same higher 16 bits and
+/// each non-empty chunk is stored in the container that uses the least memory
+/// for it:
+/// - An array container keeps up to 4096 values as a sorted array of 16-bit
+/// integers;
+/// - A bitmap container is a plain 8 KB bitmap, used for denser chunks;
+/// - A run container keeps sorted runs of consecutive values and is only
+/// created by rbm_optimize(). Modifying a run container converts it back.
+///
+/// Only chunks with set bits take any memory, so a sparse set spread over the
+/// whole 32-bit universe is orders of magnitude smaller than a BitArray_s.
+/// Binary operations work chunk by chunk and skip chunks that are missing
+/// from either side when possible. Bitmap containers use the kernels in
+/// BitKernels.h.
+///
+/// \par Functions
+/// Located in the file RoaringBitmap.c
+struct RoaringBitmap_s
+{
+    /// \brief Higher 16 bits of each container.
+    ///
+    /// Sorted array of keys, one for each container.
+    uint16_t *keys;
+
+    /// \brief Containers.
+    ///
+    /// Containers in the same order as \c keys.
+    RoaringContainer_t *containers;
+
+    /// \brief Amount of containers.
+    integer_t size;
+
+    /// \brief Buffer capacity.
+    ///
+    /// Capacity of both \c keys and \c containers.
+    integer_t capacity;
+};
+
+/// \brief Binary operations.
+///
+/// Implementation detail.
+enum RoaringOperation
+{
+    RoaringAND, RoaringOR, RoaringXOR, RoaringDIFF
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+rbm_find(RoaringBitmap_t *bitmap, uint16_t key);
+
+static RoaringContainer_t *
+rbm_container_of(RoaringBitmap_t *bitmap, uint16_t key, bool create);
+
+static bool
+rbm_append(RoaringBitmap_t *bitmap, uint16_t key,
+           RoaringContainer_t *container);
+
+static void
+rbm_remove_at(RoaringBitmap_t *bitmap, integer_t index);
+
+static bool
+rbm_operation(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2,
+              enum RoaringOperation operation);
+
+static bool
+rbm_container_init(RoaringContainer_t *container);
+
+static void
+rbm_container_free(RoaringContainer_t *container);
+
+static bool
+rbm_container_copy(RoaringContainer_t *container, RoaringContainer_t *result);
+
+static integer_t
+rbm_container_bytes(RoaringContainer_t *container);
+
+static integer_t
+rbm_lower_bound(uint16_t *values, integer_t size, uint16_t value);
+
+static integer_t
+rbm_run_of(RoaringContainer_t *container, uint16_t value);
+
+static bool
+rbm_container_get(RoaringContainer_t *container, uint16_t value);
+
+static bool
+rbm_container_set(RoaringContainer_t *container, uint16_t value);
+
+static bool
+rbm_container_clear(RoaringContainer_t *container, uint16_t value);
+
+static bool
+rbm_container_next(RoaringContainer_t *container, uint32_t value,
+                   uint16_t *result);
+
+static uint16_t
+rbm_container_max(RoaringContainer_t *container);
+
+static unsigned_t
+rbm_lowest(unsigned_t word);
+
+static bool
+rbm_to_words(RoaringContainer_t *container);
+
+static bool
+rbm_to_array(RoaringContainer_t *container);
+
+static bool
+rbm_to_runs(RoaringContainer_t *container);
+
+static bool
+rbm_unrun(RoaringContainer_t *container);
+
+static integer_t
+rbm_count_runs(RoaringContainer_t *container);
+
+static bool
+rbm_container_operation(RoaringContainer_t *container1,
+                        RoaringContainer_t *container2,
+                        enum RoaringOperation operation,
+                        RoaringContainer_t *result);
+
+static bool
+rbm_merge_arrays(RoaringContainer_t *container1,
+                 RoaringContainer_t *container2,
+                 enum RoaringOperation operation,
+                 RoaringContainer_t *result);
+
+static bool
+rbm_filter_array(RoaringContainer_t *array, RoaringContainer_t *words,
+                 bool keep, RoaringContainer_t *result);
+
+static bool
+rbm_merge_words(RoaringContainer_t *container1,
+                RoaringContainer_t *container2,
+                enum RoaringOperation operation,
+                RoaringContainer_t *result);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new empty roaring bitmap. No containers are allocated until
+/// the first bit is set.
+///
+/// \return A new roaring bitmap or NULL if allocation failed.
+RoaringBitmap_t *
+rbm_new(void)
+{
+    RoaringBitmap_t *bitmap = malloc(sizeof(RoaringBitmap_t));
+
+    if (!bitmap)
+        return NULL;
+
+    bitmap->keys = NULL;
+    bitmap->containers = NULL;
+    bitmap->size = 0;
+    bitmap->capacity = 0;
+
+    return bitmap;
+}
+
+/// Frees from memory a RoaringBitmap_s and all of its containers.
+///
+/// \param[in] bitmap The roaring bitmap to be freed from memory.
+void
+rbm_free(RoaringBitmap_t *bitmap)
+{
+    for (integer_t i = 0; i < bitmap->size; i++)
+        rbm_container_free(&bitmap->containers[i]);
+
+    free(bitmap->keys);
+    free(bitmap->containers);
+    free(bitmap);
+}
+
+/// Returns the amount of set bits. Each container keeps its own cardinality
+/// so this takes time proportional to the amount of containers.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return The amount of set bits.
+unsigned_t
+rbm_cardinality(RoaringBitmap_t *bitmap)
+{
+    unsigned_t sum = 0;
+
+    for (integer_t i = 0; i < bitmap->size; i++)
+        sum += (unsigned_t)bitmap->containers[i].cardinality;
+
+    return sum;
+}
+
+/// Returns how many chunks of 65536 bits have at least one bit set.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return The amount of containers.
+integer_t
+rbm_containers(RoaringBitmap_t *bitmap)
+{
+    return bitmap->size;
+}
+
+/// Returns how many bytes are used by the roaring bitmap, including the
+/// structure itself and every container.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return The amount of memory used in bytes.
+unsigned_t
+rbm_bytes(RoaringBitmap_t *bitmap)
+{
+    unsigned_t bytes = sizeof(RoaringBitmap_t) + (unsigned_t)bitmap->capacity
+            * (sizeof(uint16_t) + sizeof(RoaringContainer_t));
+
+    for (integer_t i = 0; i < bitmap->size; i++)
+        bytes += (unsigned_t)rbm_container_bytes(&bitmap->containers[i]);
+
+    return bytes;
+}
+
+/// Sets to true a bit at a given index, creating its container if needed.
+///
+/// \param[in] bitmap The target roaring bitmap.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit was set or false if an allocation failed.
+bool
+rbm_set(RoaringBitmap_t *bitmap, uint32_t bit_index)
+{
+    RoaringContainer_t *container = rbm_container_of(bitmap,
+            (uint16_t)(bit_index >> 16), true);
+
+    if (!container)
+        return false;
+
+    return rbm_container_set(container, (uint16_t)bit_index);
+}
+
+/// Sets to false a bit at a given index, removing its container if it
+/// becomes empty.
+///
+/// \param[in] bitmap The target roaring bitmap.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit was cleared or false if an allocation failed.
+bool
+rbm_clear(RoaringBitmap_t *bitmap, uint32_t bit_index)
+{
+    integer_t index = rbm_find(bitmap, (uint16_t)(bit_index >> 16));
+
+    if (index < 0)
+        return true;
+
+    RoaringContainer_t *container = &bitmap->containers[index];
+
+    if (!rbm_container_clear(container, (uint16_t)bit_index))
+        return false;
+
+    if (container->cardinality == 0)
+        rbm_remove_at(bitmap, index);
+
+    return true;
+}
+
+/// Retrieves the state of a bit at a given index.
+///
+/// \param[in] bitmap The target roaring bitmap.
+/// \param[in] bit_index The bit index.
+///
+/// \return True if the bit is set, false otherwise.
+bool
+rbm_get(RoaringBitmap_t *bitmap, uint32_t bit_index)
+{
+    integer_t index = rbm_find(bitmap, (uint16_t)(bit_index >> 16));
+
+    if (index < 0)
+        return false;
+
+    return rbm_container_get(&bitmap->containers[index], (uint16_t)bit_index);
+}
+
+/// Returns true if no bits are set.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return True if the roaring bitmap is empty, false otherwise.
+bool
+rbm_empty(RoaringBitmap_t *bitmap)
+{
+    return bitmap->size == 0;
+}
+
+/// Creates a copy of a RoaringBitmap_s with the same containers.
+///
+/// \param[in] bitmap The roaring bitmap to be copied.
+///
+/// \return A copy of the roaring bitmap or NULL if an allocation failed.
+RoaringBitmap_t *
+rbm_copy(RoaringBitmap_t *bitmap)
+{
+    RoaringBitmap_t *result = rbm_new();
+
+    if (!result)
+        return NULL;
+
+    for (integer_t i = 0; i < bitmap->size; i++)
+    {
+        RoaringContainer_t container;
+
+        if (!rbm_container_copy(&bitmap->containers[i], &container))
+        {
+            rbm_free(result);
+            return NULL;
+        }
+
+        if (!rbm_append(result, bitmap->keys[i], &container))
+        {
+            rbm_container_free(&container);
+            rbm_free(result);
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+/// Converts every container to a run container if that uses less memory and
+/// run containers back if they don't. Useful after building a bitmap with
+/// long sequences of consecutive bits.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return True if all conversions succeeded or false if an allocation
+/// failed, in which case the bitmap is still valid.
+bool
+rbm_optimize(RoaringBitmap_t *bitmap)
+{
+    for (integer_t i = 0; i < bitmap->size; i++)
+    {
+        RoaringContainer_t *container = &bitmap->containers[i];
+
+        integer_t runs = rbm_count_runs(container);
+
+        integer_t run_bytes = runs * (integer_t)sizeof(RoaringRun_t);
+        integer_t other_bytes = container->cardinality <= RBM_ARRAY_MAX
+                ? container->cardinality * (integer_t)sizeof(uint16_t)
+                : RBM_WORDS * (integer_t)sizeof(unsigned_t);
+
+        bool converted = run_bytes < other_bytes
+                ? rbm_to_runs(container)
+                : rbm_unrun(container);
+
+        if (!converted)
+            return false;
+    }
+
+    return true;
+}
+
+/// Makes a BitArray_s with the same set bits. The bit array is just big
+/// enough to hold the highest set bit.
+///
+/// \param[in] bitmap The target roaring bitmap.
+///
+/// \return A new BitArray_s or NULL if an allocation failed.
+BitArray_t *
+rbm_to_bitarray(RoaringBitmap_t *bitmap)
+{
+    unsigned_t nbits = 1;
+
+    // The last container has the highest set bit
+    if (bitmap->size > 0)
+    {
+        uint16_t highest = rbm_container_max(&bitmap->containers[bitmap->size
+                                                                 - 1]);
+
+        nbits = ((unsigned_t)bitmap->keys[bitmap->size - 1] << 16)
+                + highest + 1;
+    }
+
+    BitArray_t *bits = bit_create(nbits);
+
+    if (!bits)
+        return NULL;
+
+    for (integer_t i = 0; i < bitmap->size; i++)
+    {
+        unsigned_t high = (unsigned_t)bitmap->keys[i] << 16;
+
+        uint16_t value;
+
+        for (uint32_t v = 0; rbm_container_next(&bitmap->containers[i], v,
+                                                &value); v = value + 1u)
+        {
+            bit_set(bits, high + value);
+        }
+    }
+
+    return bits;
+}
+
+/// Makes a RoaringBitmap_s with the same set bits as a BitArray_s. Only the
+/// first \c 2^32 bits can be represented.
+///
+/// \param[in] bits The bit array to be converted.
+///
+/// \return A new RoaringBitmap_s or NULL if the bit array is too big or if an
+/// allocation failed.
+RoaringBitmap_t *
+rbm_from_bitarray(BitArray_t *bits)
+{
+    if (bit_nbits(bits) > (unsigned_t)UINT32_MAX + 1)
+        return NULL;
+
+    RoaringBitmap_t *bitmap = rbm_new();
+
+    if (!bitmap)
+        return NULL;
+
+    for (unsigned_t i = bit_next_set(bits, 0); i != (unsigned_t)-1;
+         i = bit_next_set(bits, i + 1))
+    {
+        if (!rbm_set(bitmap, (uint32_t)i))
+        {
+            rbm_free(bitmap);
+            return NULL;
+        }
+    }
+
+    return bitmap;
+}
+
+/// Returns the index of the nearest set bit that occurs on or after the
+/// specified index. Missing chunks are skipped at once.
+///
+/// \param[in] bitmap The target roaring bitmap.
+/// \param[in] bit_index The starting index.
+///
+/// \return The index of the bit found or -1 cast to unsigned_t.
+unsigned_t
+rbm_next_set(RoaringBitmap_t *bitmap, uint32_t bit_index)
+{
+    uint16_t key = (uint16_t)(bit_index >> 16);
+
+    integer_t index = rbm_find(bitmap, key);
+
+    uint32_t from = bit_index & 0xFFFF;
+
+    // Start at the first container after the key
+    if (index < 0)
+    {
+        index = -index - 1;
+        from = 0;
+    }
+
+    for (; index < bitmap->size; index++)
+    {
+        uint16_t value;
+
+        if (rbm_container_next(&bitmap->containers[index], from, &value))
+            return ((unsigned_t)bitmap->keys[index] << 16) + value;
+
+        from = 0;
+    }
+
+    return (unsigned_t)-1;
+}
+
+/// Performs an \c AND operation between two roaring bitmaps, storing the
+/// result in \c bitmap1.
+///
+/// \param[in] bitmap1 The roaring bitmap that receives the result.
+/// \param[in] bitmap2 The second operand.
+///
+/// \return True if the operation succeeded or false if an allocation failed,
+/// in which case \c bitmap1 is left untouched.
+bool
+rbm_AND(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2)
+{
+    return rbm_operation(bitmap1, bitmap2, RoaringAND);
+}
+
+/// Performs an \c OR operation between two roaring bitmaps, storing the
+/// result in \c bitmap1.
+///
+/// \param[in] bitmap1 The roaring bitmap that receives the result.
+/// \param[in] bitmap2 The second operand.
+///
+/// \return True if the operation succeeded or false if an allocation failed,
+/// in which case \c bitmap1 is left untouched.
+bool
+rbm_OR(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2)
+{
+    return rbm_operation(bitmap1, bitmap2, RoaringOR);
+}
+
+/// Performs an \c XOR operation between two roaring bitmaps, storing the
+/// result in \c bitmap1.
+///
+/// \param[in] bitmap1 The roaring bitmap that receives the result.
+/// \param[in] bitmap2 The second operand.
+///
+/// \return True if the operation succeeded or false if an allocation failed,
+/// in which case \c bitmap1 is left untouched.
+bool
+rbm_XOR(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2)
+{
+    return rbm_operation(bitmap1, bitmap2, RoaringXOR);
+}
+
+/// Removes from \c bitmap1 every bit that is set in \c bitmap2.
+///
+/// \param[in] bitmap1 The roaring bitmap that receives the result.
+/// \param[in] bitmap2 The second operand.
+///
+/// \return True if the operation succeeded or false if an allocation failed,
+/// in which case \c bitmap1 is left untouched.
+bool
+rbm_DIFF(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2)
+{
+    return rbm_operation(bitmap1, bitmap2, RoaringDIFF);
+}
+
+/// Displays every set bit index in the console separated by commas and
+/// delimited by brackets.
+///
+/// \param[in] bitmap The roaring bitmap to be displayed in the console.
+void
+rbm_display(RoaringBitmap_t *bitmap)
+{
+    printf("\nRoaringBitmap\n[ ");
+
+    bool first = true;
+
+    for (unsigned_t i = rbm_next_set(bitmap, 0); i != (unsigned_t)-1;
+         i = i == UINT32_MAX ? (unsigned_t)-1
+                             : rbm_next_set(bitmap, (uint32_t)i + 1))
+    {
+        printf(first ? "%" PRIuMAX : ", %" PRIuMAX, i);
+        first = false;
+    }
+
+    printf(" ]\n");
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Binary search for a key. Returns its index or -(insertion point) - 1.
+static integer_t
+rbm_find(RoaringBitmap_t *bitmap, uint16_t key)
+{
+    integer_t low = 0, high = bitmap->size - 1;
+
+    while (low <= high)
+    {
+        integer_t middle = low + (high - low) / 2;
+
+        if (bitmap->keys[middle] < key)
+            low = middle + 1;
+        else if (bitmap->keys[middle] > key)
+            high = middle - 1;
+        else
+            return middle;
+    }
+
+    return -low - 1;
+}
+
+// Returns the container of a key, optionally creating an empty one
+static RoaringContainer_t *
+rbm_container_of(RoaringBitmap_t *bitmap, uint16_t key, bool create)
+{
+    integer_t index = rbm_find(bitmap, key);
+
+    if (index >= 0)
+        return &bitmap->containers[index];
+
+    if (!create)
+        return NULL;
+
+    index = -index - 1;
+
+    RoaringContainer_t container;
+
+    if (!rbm_container_init(&container))
+        return NULL;
+
+    // Appending might grow the buffers
+    if (!rbm_append(bitmap, key, &container))
+    {
+        rbm_container_free(&container);
+        return NULL;
+    }
+
+    // Move it from the end to its sorted position
+    memmove(bitmap->keys + index + 1, bitmap->keys + index,
+            sizeof(uint16_t) * (size_t)(bitmap->size - 1 - index));
+    memmove(bitmap->containers + index + 1, bitmap->containers + index,
+            sizeof(RoaringContainer_t) * (size_t)(bitmap->size - 1 - index));
+
+    bitmap->keys[index] = key;
+    bitmap->containers[index] = container;
+
+    return &bitmap->containers[index];
+}
+
+// Adds a container at the end taking ownership of its buffer
+static bool
+rbm_append(RoaringBitmap_t *bitmap, uint16_t key,
+           RoaringContainer_t *container)
+{
+    if (bitmap->size == bitmap->capacity)
+    {
+        integer_t new_capacity = bitmap->capacity < 4
+                                 ? 4 : bitmap->capacity * 2;
+
+        uint16_t *new_keys = realloc(bitmap->keys,
+                sizeof(uint16_t) * (size_t)new_capacity);
+
+        if (!new_keys)
+            return false;
+
+        bitmap->keys = new_keys;
+
+        RoaringContainer_t *new_containers = realloc(bitmap->containers,
+                sizeof(RoaringContainer_t) * (size_t)new_capacity);
+
+        if (!new_containers)
+            return false;
+
+        bitmap->containers = new_containers;
+        bitmap->capacity = new_capacity;
+    }
+
+    bitmap->keys[bitmap->size] = key;
+    bitmap->containers[bitmap->size] = *container;
+    bitmap->size++;
+
+    return true;
+}
+
+// Frees and removes the container at a given index
+static void
+rbm_remove_at(RoaringBitmap_t *bitmap, integer_t index)
+{
+    rbm_container_free(&bitmap->containers[index]);
+
+    memmove(bitmap->keys + index, bitmap->keys + index + 1,
+            sizeof(uint16_t) * (size_t)(bitmap->size - index - 1));
+    memmove(bitmap->containers + index, bitmap->containers + index + 1,
+            sizeof(RoaringContainer_t) * (size_t)(bitmap->size - index - 1));
+
+    bitmap->size--;
+}
+
+// Computes the result in a new bitmap and only then swaps it into bitmap1 so
+// that bitmap1 is left untouched on failure and bitmap1 can be bitmap2
+static bool
+rbm_operation(RoaringBitmap_t *bitmap1, RoaringBitmap_t *bitmap2,
+              enum RoaringOperation operation)
+{
+    RoaringBitmap_t *result = rbm_new();
+
+    if (!result)
+        return false;
+
+    integer_t i = 0, j = 0;
+
+    while (i < bitmap1->size || j < bitmap2->size)
+    {
+        RoaringContainer_t container;
+        uint16_t key;
+
+        bool only1 = j == bitmap2->size
+                     || (i < bitmap1->size
+                         && bitmap1->keys[i] < bitmap2->keys[j]);
+        bool only2 = !only1 && (i == bitmap1->size
+                                || bitmap2->keys[j] < bitmap1->keys[i]);
+
+        if (only1)
+        {
+            key = bitmap1->keys[i];
+
+            // Chunks missing from bitmap2 are only kept by OR, XOR and DIFF
+            if (operation == RoaringAND)
+            {
+                i++;
+                continue;
+            }
+
+            if (!rbm_container_copy(&bitmap1->containers[i++], &container))
+                goto error;
+        }
+        else if (only2)
+        {
+            key = bitmap2->keys[j];
+
+            // Chunks missing from bitmap1 are only kept by OR and XOR
+            if (operation == RoaringAND || operation == RoaringDIFF)
+            {
+                // Nothing else can come from bitmap1
+                if (i == bitmap1->size)
+                    break;
+
+                j++;
+                continue;
+            }
+
+            if (!rbm_container_copy(&bitmap2->containers[j++], &container))
+                goto error;
+        }
+        else
+        {
+            key = bitmap1->keys[i];
+
+            if (!rbm_container_operation(&bitmap1->containers[i++],
+                                         &bitmap2->containers[j++],
+                                         operation, &container))
+                goto error;
+
+            if (container.cardinality == 0)
+            {
+                rbm_container_free(&container);
+                continue;
+            }
+        }
+
+        if (!rbm_append(result, key, &container))
+        {
+            rbm_container_free(&container);
+            goto error;
+        }
+    }
+
+    // Swap the result into bitmap1
+    RoaringBitmap_t old = *bitmap1;
+
+    *bitmap1 = *result;
+    *result = old;
+
+    rbm_free(result);
+
+    return true;
+
+    error:
+    rbm_free(result);
+    return false;
+}
+
+// Initializes an empty array container
+static bool
+rbm_container_init(RoaringContainer_t *container)
+{
+    container->type = RoaringArray;
+    container->cardinality = 0;
+    container->size = 0;
+    container->capacity = 4;
+    container->values = malloc(sizeof(uint16_t) * 4);
+
+    return container->values != NULL;
+}
+
+static void
+rbm_container_free(RoaringContainer_t *container)
+{
+    if (container->type == RoaringArray)
+        free(container->values);
+    else if (container->type == RoaringWords)
+        free(container->words);
+    else
+        free(container->runs);
+}
+
+static bool
+rbm_container_copy(RoaringContainer_t *container, RoaringContainer_t *result)
+{
+    *result = *container;
+
+    if (container->type == RoaringWords)
+    {
+        result->words = bkn_alloc(RBM_WORDS);
+
+        if (!result->words)
+            return false;
+
+        memcpy(result->words, container->words,
+               sizeof(unsigned_t) * RBM_WORDS);
+
+        return true;
+    }
+
+    size_t entry = container->type == RoaringArray
+                   ? sizeof(uint16_t) : sizeof(RoaringRun_t);
+
+    // Only what is being used is copied
+    result->capacity = container->size > 4 ? container->size : 4;
+    result->values = malloc(entry * (size_t)result->capacity);
+
+    if (!result->values)
+        return false;
+
+    memcpy(result->values, container->values, entry * (size_t)container->size);
+
+    return true;
+}
+
+static integer_t
+rbm_container_bytes(RoaringContainer_t *container)
+{
+    if (container->type == RoaringArray)
+        return container->capacity * (integer_t)sizeof(uint16_t);
+
+    if (container->type == RoaringRuns)
+        return container->capacity * (integer_t)sizeof(RoaringRun_t);
+
+    return RBM_WORDS * (integer_t)sizeof(unsigned_t);
+}
+
+// Index of the first value not less than value
+static integer_t
+rbm_lower_bound(uint16_t *values, integer_t size, uint16_t value)
+{
+    integer_t low = 0, high = size;
+
+    while (low < high)
+    {
+        integer_t middle = low + (high - low) / 2;
+
+        if (values[middle] < value)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+// Index of the last run starting at or before value or -1 if there is none
+static integer_t
+rbm_run_of(RoaringContainer_t *container, uint16_t value)
+{
+    integer_t low = 0, high = container->size;
+
+    while (low < high)
+    {
+        integer_t middle = low + (high - low) / 2;
+
+        if (container->runs[middle].start <= value)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low - 1;
+}
+
+static bool
+rbm_container_get(RoaringContainer_t *container, uint16_t value)
+{
+    if (container->type == RoaringArray)
+    {
+        integer_t index = rbm_lower_bound(container->values, container->size,
+                                          value);
+
+        return index < container->size && container->values[index] == value;
+    }
+
+    if (container->type == RoaringWords)
+        return (container->words[value >> 6] >> (value & 63)) & 1;
+
+    integer_t run = rbm_run_of(container, value);
+
+    return run >= 0 && (uint32_t)container->runs[run].start
+                       + container->runs[run].length >= value;
+}
+
+static bool
+rbm_container_set(RoaringContainer_t *container, uint16_t value)
+{
+    if (container->type == RoaringRuns)
+    {
+        if (rbm_container_get(container, value))
+            return true;
+
+        if (!rbm_unrun(container))
+            return false;
+    }
+
+    if (container->type == RoaringWords)
+    {
+        unsigned_t mask = (unsigned_t)1 << (value & 63);
+
+        if (!(container->words[value >> 6] & mask))
+        {
+            container->words[value >> 6] |= mask;
+            container->cardinality++;
+        }
+
+        return true;
+    }
+
+    integer_t index = rbm_lower_bound(container->values, container->size,
+                                      value);
+
+    if (index < container->size && container->values[index] == value)
+        return true;
+
+    // A full array container becomes a bitmap
+    if (container->size == RBM_ARRAY_MAX)
+    {
+        if (!rbm_to_words(container))
+            return false;
+
+        return rbm_container_set(container, value);
+    }
+
+    if (container->size == container->capacity)
+    {
+        integer_t new_capacity = container->capacity * 2;
+
+        if (new_capacity > RBM_ARRAY_MAX)
+            new_capacity = RBM_ARRAY_MAX;
+
+        uint16_t *new_values = realloc(container->values,
+                sizeof(uint16_t) * (size_t)new_capacity);
+
+        if (!new_values)
+            return false;
+
+        container->values = new_values;
+        container->capacity = new_capacity;
+    }
+
+    memmove(container->values + index + 1, container->values + index,
+            sizeof(uint16_t) * (size_t)(container->size - index));
+
+    container->values[index] = value;
+    container->size++;
+    container->cardinality++;
+
+    return true;
+}
+
+static bool
+rbm_container_clear(RoaringContainer_t *container, uint16_t value)
+{
+    if (container->type == RoaringRuns)
+    {
+        if (!rbm_container_get(container, value))
+            return true;
+
+        if (!rbm_unrun(container))
+            return false;
+    }
+
+    if (container->type == RoaringWords)
+    {
+        unsigned_t mask = (unsigned_t)1 << (value & 63);
+
+        if (container->words[value >> 6] & mask)
+        {
+            container->words[value >> 6] &= ~mask;
+            container->cardinality--;
+        }
+
+        // A sparse bitmap goes back to being an array. A failure here is not
+        // an error since the bitmap is still valid.
+        if (container->cardinality <= RBM_ARRAY_MAX / 2)
+            rbm_to_array(container);
+
+        return true;
+    }
+
+    integer_t index = rbm_lower_bound(container->values, container->size,
+                                      value);
+
+    if (index == container->size || container->values[index] != value)
+        return true;
+
+    memmove(container->values + index, container->values + index + 1,
+            sizeof(uint16_t) * (size_t)(container->size - index - 1));
+
+    container->size--;
+    container->cardinality--;
+
+    return true;
+}
+
+// Finds the first value not less than value. Takes an uint32_t so that
+// 65536 can be given when the last value has been found.
+static bool
+rbm_container_next(RoaringContainer_t *container, uint32_t value,
+                   uint16_t *result)
+{
+    if (value > UINT16_MAX)
+        return false;
+
+    if (container->type == RoaringArray)
+    {
+        integer_t index = rbm_lower_bound(container->values, container->size,
+                                          (uint16_t)value);
+
+        if (index == container->size)
+            return false;
+
+        *result = container->values[index];
+
+        return true;
+    }
+
+    if (container->type == RoaringWords)
+    {
+        unsigned_t index = value >> 6;
+        unsigned_t word = container->words[index]
+                          & (~(unsigned_t)0 << (value & 63));
+
+        if (word == 0)
+        {
+            index = bkn_next_word(container->words, index + 1, RBM_WORDS, 0);
+
+            if (index == RBM_WORDS)
+                return false;
+
+            word = container->words[index];
+        }
+
+        *result = (uint16_t)(index * 64 + rbm_lowest(word));
+
+        return true;
+    }
+
+    integer_t run = rbm_run_of(container, (uint16_t)value);
+
+    if (run >= 0 && (uint32_t)container->runs[run].start
+                    + container->runs[run].length >= value)
+    {
+        *result = (uint16_t)value;
+
+        return true;
+    }
+
+    if (run + 1 == container->size)
+        return false;
+
+    *result = container->runs[run + 1].start;
+
+    return true;
+}
+
+// Highest value of a container that is not empty
+static uint16_t
+rbm_container_max(RoaringContainer_t *container)
+{
+    if (container->type == RoaringArray)
+        return container->values[container->size - 1];
+
+    if (container->type == RoaringRuns)
+        return (uint16_t)(container->runs[container->size - 1].start
+                          + container->runs[container->size - 1].length);
+
+    unsigned_t i = RBM_WORDS - 1;
+
+    while (container->words[i] == 0)
+        i--;
+
+    unsigned_t word = container->words[i], highest = 63;
+
+    while (!(word >> highest))
+        highest--;
+
+    return (uint16_t)(i * 64 + highest);
+}
+
+// Index of the lowest set bit of a word that is not 0
+static unsigned_t
+rbm_lowest(unsigned_t word)
+{
+#ifdef __GNUC__
+    return (unsigned_t)__builtin_ctzll(word);
+#else
+    unsigned_t index = 0;
+
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+
+    return index;
+#endif
+}
+
+// Converts an array or run container to a bitmap container
+static bool
+rbm_to_words(RoaringContainer_t *container)
+{
+    if (container->type == RoaringWords)
+        return true;
+
+    unsigned_t *words = bkn_alloc(RBM_WORDS);
+
+    if (!words)
+        return false;
+
+    if (container->type == RoaringArray)
+    {
+        for (integer_t i = 0; i < container->size; i++)
+        {
+            uint16_t v = container->values[i];
+
+            words[v >> 6] |= (unsigned_t)1 << (v & 63);
+        }
+
+        free(container->values);
+    }
+    else
+    {
+        for (integer_t i = 0; i < container->size; i++)
+        {
+            uint32_t v = container->runs[i].start;
+            uint32_t end = v + container->runs[i].length;
+
+            for (; v <= end; v++)
+                words[v >> 6] |= (unsigned_t)1 << (v & 63);
+        }
+
+        free(container->runs);
+    }
+
+    container->type = RoaringWords;
+    container->words = words;
+    container->size = 0;
+    container->capacity = 0;
+
+    return true;
+}
+
+// Converts a bitmap or run container to an array container. The cardinality
+// must not be greater than RBM_ARRAY_MAX.
+static bool
+rbm_to_array(RoaringContainer_t *container)
+{
+    if (container->type == RoaringArray)
+        return true;
+
+    integer_t capacity = container->cardinality > 4
+                         ? container->cardinality : 4;
+
+    uint16_t *values = malloc(sizeof(uint16_t) * (size_t)capacity);
+
+    if (!values)
+        return false;
+
+    integer_t size = 0;
+
+    if (container->type == RoaringWords)
+    {
+        for (unsigned_t i = 0; i < RBM_WORDS; i++)
+        {
+            unsigned_t word = container->words[i];
+
+            while (word)
+            {
+                values[size++] = (uint16_t)(i * 64 + rbm_lowest(word));
+                word &= word - 1;
+            }
+        }
+
+        free(container->words);
+    }
+    else
+    {
+        for (integer_t i = 0; i < container->size; i++)
+        {
+            uint32_t v = container->runs[i].start;
+            uint32_t end = v + container->runs[i].length;
+
+            for (; v <= end; v++)
+                values[size++] = (uint16_t)v;
+        }
+
+        free(container->runs);
+    }
+
+    container->type = RoaringArray;
+    container->values = values;
+    container->size = size;
+    container->capacity = capacity;
+
+    return true;
+}
+
+// Converts an array or bitmap container to a run container
+static bool
+rbm_to_runs(RoaringContainer_t *container)
+{
+    if (container->type == RoaringRuns)
+        return true;
+
+    integer_t capacity = rbm_count_runs(container);
+
+    RoaringRun_t *runs = malloc(sizeof(RoaringRun_t) * (size_t)capacity);
+
+    if (!runs)
+        return false;
+
+    integer_t size = 0;
+
+    uint16_t value;
+
+    for (uint32_t v = 0; rbm_container_next(container, v, &value);
+         v = value + 1u)
+    {
+        if (size > 0 && (uint32_t)runs[size - 1].start
+                        + runs[size - 1].length + 1 == value)
+        {
+            runs[size - 1].length++;
+        }
+        else
+        {
+            runs[size].start = value;
+            runs[size].length = 0;
+            size++;
+        }
+    }
+
+    rbm_container_free(container);
+
+    container->type = RoaringRuns;
+    container->runs = runs;
+    container->size = size;
+    container->capacity = capacity;
+
+    return true;
+}
+
+// Converts a run container to whatever is smaller between an array and a
+// bitmap
+static bool
+rbm_unrun(RoaringContainer_t *container)
+{
+    if (container->type != RoaringRuns)
+        return true;
+
+    if (container->cardinality > RBM_ARRAY_MAX)
+        return rbm_to_words(container);
+
+    return rbm_to_array(container);
+}
+
+// Amount of runs of consecutive values in a container
+static integer_t
+rbm_count_runs(RoaringContainer_t *container)
+{
+    if (container->type == RoaringRuns)
+        return container->size;
+
+    integer_t runs = 0;
+
+    if (container->type == RoaringArray)
+    {
+        for (integer_t i = 0; i < container->size; i++)
+        {
+            if (i == 0 || container->values[i] != container->values[i - 1] + 1)
+                runs++;
+        }
+
+        return runs;
+    }
+
+    // A run starts at every set bit whose previous bit is clear
+    unsigned_t starts[RBM_WORDS], carry = 0;
+
+    for (unsigned_t i = 0; i < RBM_WORDS; i++)
+    {
+        unsigned_t word = container->words[i];
+
+        starts[i] = word & ~((word << 1) | carry);
+        carry = word >> 63;
+    }
+
+    return runs + (integer_t)bkn_popcount(starts, RBM_WORDS);
+}
+
+// Computes container1 OP container2 into result. Run containers are worked
+// on as arrays or bitmaps.
+static bool
+rbm_container_operation(RoaringContainer_t *container1,
+                        RoaringContainer_t *container2,
+                        enum RoaringOperation operation,
+                        RoaringContainer_t *result)
+{
+    RoaringContainer_t temp1, temp2;
+
+    bool copied1 = false, copied2 = false, success;
+
+    if (container1->type == RoaringRuns)
+    {
+        if (!rbm_container_copy(container1, &temp1))
+            return false;
+
+        copied1 = true;
+
+        if (!rbm_unrun(&temp1))
+            goto error;
+
+        container1 = &temp1;
+    }
+
+    if (container2->type == RoaringRuns)
+    {
+        if (!rbm_container_copy(container2, &temp2))
+            goto error;
+
+        copied2 = true;
+
+        if (!rbm_unrun(&temp2))
+            goto error;
+
+        container2 = &temp2;
+    }
+
+    bool array1 = container1->type == RoaringArray;
+    bool array2 = container2->type == RoaringArray;
+
+    if (array1 && array2)
+        success = rbm_merge_arrays(container1, container2, operation, result);
+    else if (array1 && operation == RoaringAND)
+        success = rbm_filter_array(container1, container2, true, result);
+    else if (array2 && operation == RoaringAND)
+        success = rbm_filter_array(container2, container1, true, result);
+    else if (array1 && operation == RoaringDIFF)
+        success = rbm_filter_array(container1, container2, false, result);
+    else
+        success = rbm_merge_words(container1, container2, operation, result);
+
+    if (copied1)
+        rbm_container_free(&temp1);
+    if (copied2)
+        rbm_container_free(&temp2);
+
+    return success;
+
+    error:
+    if (copied1)
+        rbm_container_free(&temp1);
+    if (copied2)
+        rbm_container_free(&temp2);
+    return false;
+}
+
+// Merges two sorted arrays keeping values according to the operation
+static bool
+rbm_merge_arrays(RoaringContainer_t *container1,
+                 RoaringContainer_t *container2,
+                 enum RoaringOperation operation,
+                 RoaringContainer_t *result)
+{
+    // Which values are kept: only in the first, only in the second or in both
+    bool keep1 = operation != RoaringAND;
+    bool keep2 = operation == RoaringOR || operation == RoaringXOR;
+    bool keep_both = operation == RoaringAND || operation == RoaringOR;
+
+    integer_t capacity = container1->size + container2->size;
+
+    if (capacity < 4)
+        capacity = 4;
+
+    uint16_t *values = malloc(sizeof(uint16_t) * (size_t)capacity);
+
+    if (!values)
+        return false;
+
+    uint16_t *A = container1->values, *B = container2->values;
+    integer_t i = 0, j = 0, size = 0;
+
+    while (i < container1->size && j < container2->size)
+    {
+        if (A[i] < B[j])
+        {
+            if (keep1)
+                values[size++] = A[i];
+            i++;
+        }
+        else if (B[j] < A[i])
+        {
+            if (keep2)
+                values[size++] = B[j];
+            j++;
+        }
+        else
+        {
+            if (keep_both)
+                values[size++] = A[i];
+            i++;
+            j++;
+        }
+    }
+
+    for (; keep1 && i < container1->size; i++)
+        values[size++] = A[i];
+
+    for (; keep2 && j < container2->size; j++)
+        values[size++] = B[j];
+
+    result->type = RoaringArray;
+    result->values = values;
+    result->size = size;
+    result->capacity = capacity;
+    result->cardinality = size;
+
+    // The union of two arrays might be too big for an array
+    if (size > RBM_ARRAY_MAX && !rbm_to_words(result))
+    {
+        free(values);
+        return false;
+    }
+
+    return true;
+}
+
+// Keeps the values of an array that are (or are not) set in a bitmap
+static bool
+rbm_filter_array(RoaringContainer_t *array, RoaringContainer_t *words,
+                 bool keep, RoaringContainer_t *result)
+{
+    integer_t capacity = array->size > 4 ? array->size : 4;
+
+    uint16_t *values = malloc(sizeof(uint16_t) * (size_t)capacity);
+
+    if (!values)
+        return false;
+
+    integer_t size = 0;
+
+    for (integer_t i = 0; i < array->size; i++)
+    {
+        uint16_t v = array->values[i];
+
+        if ((bool)((words->words[v >> 6] >> (v & 63)) & 1) == keep)
+            values[size++] = v;
+    }
+
+    result->type = RoaringArray;
+    result->values = values;
+    result->size = size;
+    result->capacity = capacity;
+    result->cardinality = size;
+
+    return true;
+}
+
+// Operates word by word, converting arrays to bitmaps first
+static bool
+rbm_merge_words(RoaringContainer_t *container1,
+                RoaringContainer_t *container2,
+                enum RoaringOperation operation,
+                RoaringContainer_t *result)
+{
+    RoaringContainer_t temp;
+
+    bool converted = false;
+
+    // The first container is copied since the result is computed in place
+    if (!rbm_container_copy(container1, result) || !rbm_to_words(result))
+    {
+        if (result->type == RoaringArray)
+            free(result->values);
+        return false;
+    }
+
+    if (container2->type == RoaringArray)
+    {
+        if (!rbm_container_copy(container2, &temp) || !rbm_to_words(&temp))
+        {
+            if (temp.type == RoaringArray)
+                free(temp.values);
+            free(result->words);
+            return false;
+        }
+
+        converted = true;
+        container2 = &temp;
+    }
+
+    switch (operation)
+    {
+        case RoaringAND:
+            bkn_and(result->words, container2->words, RBM_WORDS);
+            break;
+        case RoaringOR:
+            bkn_or(result->words, container2->words, RBM_WORDS);
+            break;
+        case RoaringXOR:
+            bkn_xor(result->words, container2->words, RBM_WORDS);
+            break;
+        default:
+            bkn_andnot(result->words, container2->words, RBM_WORDS);
+            break;
+    }
+
+    if (converted)
+        free(temp.words);
+
+    result->cardinality = (integer_t)bkn_popcount(result->words, RBM_WORDS);
+
+    // A failure here is not an error since the bitmap is still valid
+    if (result->cardinality <= RBM_ARRAY_MAX)
+        rbm_to_array(result);
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,523 @@
+/**
+ * @file SegmentTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "SegmentTree.h"
+
+/// A SegmentTree_s keeps an array of values and the aggregate of every range
+/// in a complete binary tree over it, so that both changing a value and
+/// combining the values of any range take <code> O(log n) </code> time. The
+/// aggregate is given by a \c combine function, which folds the aggregate of a
+/// range into the aggregate of the range to its left. It must be associative
+/// and \c identity must not change any aggregate, but it does not need to be
+/// commutative. Sums, minimums, maximums, products of matrices or compositions
+/// of functions all work.
+///
+/// The tree is stored by value in a single buffer and indexed from 1. Node
+/// \c i has the children <code> 2 * i </code> and <code> 2 * i + 1 </code>.
+/// The leaves start at \c capacity, the size rounded up to a power of two, and
+/// those past the size hold \c identity.
+///
+/// With sgt_set_lazy() updates can be applied to a whole range. An update
+/// stops at the nodes whose ranges are inside the updated range. It changes
+/// their aggregates with \c apply and is kept in the node, composed with any
+/// update already there, until a later operation has to go through the node
+/// and pushes it to the children.
+///
+/// \par Functions
+/// Located in the file SegmentTree.c
+struct SegmentTree_s
+{
+    /// \brief Aggregates of every node, indexed from 1.
+    unsigned char *nodes;
+
+    /// \brief Updates not yet pushed to the children of each inner node.
+    unsigned char *updates;
+
+    /// \brief Which inner nodes have an update.
+    bool *pending;
+
+    /// \brief A value that does not change any aggregate.
+    unsigned char *identity;
+
+    /// \brief Amount of values.
+    integer_t size;
+
+    /// \brief Amount of leaves, a power of two.
+    integer_t capacity;
+
+    /// \brief Size in bytes of each value.
+    size_t element_size;
+
+    /// \brief Size in bytes of each update.
+    size_t update_size;
+
+    /// \brief Folds an aggregate into the aggregate to its left.
+    reduce_f combine;
+
+    /// \brief Applies an update to the aggregate of a range.
+    apply_f apply;
+
+    /// \brief Folds a newer update into an older one.
+    reduce_f compose;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned char *
+sgt_node(SegmentTree_t *tree, integer_t node);
+
+static void
+sgt_build(SegmentTree_t *tree);
+
+static void
+sgt_pull(SegmentTree_t *tree, integer_t node);
+
+static void
+sgt_apply(SegmentTree_t *tree, integer_t node, const void *update,
+          integer_t count);
+
+static void
+sgt_push(SegmentTree_t *tree, integer_t node, integer_t count);
+
+static void
+sgt_push_path(SegmentTree_t *tree, integer_t leaf);
+
+static void
+sgt_query_node(SegmentTree_t *tree, integer_t node, integer_t low,
+               integer_t high, integer_t from, integer_t to, void *result);
+
+static void
+sgt_update_node(SegmentTree_t *tree, integer_t node, integer_t low,
+                integer_t high, integer_t from, integer_t to,
+                const void *update);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a SegmentTree_s of a given size with every value set to
+/// \c identity.
+///
+/// \param[in] element_size Size in bytes of each value.
+/// \param[in] combine Folds an aggregate into the aggregate to its left.
+/// \param[in] identity A value that does not change any aggregate.
+/// \param[in] size Amount of values.
+///
+/// \return A new SegmentTree_s or NULL if allocation failed or a parameter is
+/// invalid.
+SegmentTree_t *
+sgt_new(size_t element_size, reduce_f combine, const void *identity,
+        integer_t size)
+{
+    if (element_size == 0 || size < 0 || !combine || !identity)
+        return NULL;
+
+    integer_t capacity = 1;
+
+    while (capacity < size)
+        capacity *= 2;
+
+    SegmentTree_t *tree = malloc(sizeof(SegmentTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->nodes = malloc(element_size * (size_t)capacity * 2);
+    tree->identity = malloc(element_size);
+
+    if (!tree->nodes || !tree->identity)
+    {
+        free(tree->nodes);
+        free(tree->identity);
+        free(tree);
+        return NULL;
+    }
+
+    memcpy(tree->identity, identity, element_size);
+
+    tree->updates = NULL;
+    tree->pending = NULL;
+    tree->size = size;
+    tree->capacity = capacity;
+    tree->element_size = element_size;
+    tree->update_size = 0;
+    tree->combine = combine;
+    tree->apply = NULL;
+    tree->compose = NULL;
+
+    for (integer_t i = 0; i < capacity * 2; i++)
+        memcpy(sgt_node(tree, i), identity, element_size);
+
+    return tree;
+}
+
+/// Builds a SegmentTree_s from a buffer of values. The leaves are copied and
+/// every inner node is combined once, so it takes linear time.
+///
+/// \param[in] element_size Size in bytes of each value.
+/// \param[in] combine Folds an aggregate into the aggregate to its left.
+/// \param[in] identity A value that does not change any aggregate.
+/// \param[in] values Buffer of values.
+/// \param[in] size Amount of values in the buffer.
+///
+/// \return A new SegmentTree_s or NULL if allocation failed or a parameter is
+/// invalid.
+SegmentTree_t *
+sgt_from_buffer(size_t element_size, reduce_f combine, const void *identity,
+                const void *values, integer_t size)
+{
+    SegmentTree_t *tree = sgt_new(element_size, combine, identity, size);
+
+    if (!tree)
+        return NULL;
+
+    if (size > 0)
+        memcpy(sgt_node(tree, tree->capacity), values,
+               element_size * (size_t)size);
+
+    sgt_build(tree);
+
+    return tree;
+}
+
+/// Builds a SegmentTree_s from a DynamicArray_s. Every element is a pointer to
+/// a value of \c element_size bytes, which is copied. The array is not
+/// changed.
+///
+/// \param[in] element_size Size in bytes of each value.
+/// \param[in] combine Folds an aggregate into the aggregate to its left.
+/// \param[in] identity A value that does not change any aggregate.
+/// \param[in] array DynamicArray_s reference.
+///
+/// \return A new SegmentTree_s or NULL if allocation failed or a parameter is
+/// invalid.
+SegmentTree_t *
+sgt_from_array(size_t element_size, reduce_f combine, const void *identity,
+               DynamicArray_t *array)
+{
+    integer_t size = dar_size(array);
+
+    SegmentTree_t *tree = sgt_new(element_size, combine, identity, size);
+
+    if (!tree)
+        return NULL;
+
+    for (integer_t i = 0; i < size; i++)
+        memcpy(sgt_node(tree, tree->capacity + i), dar_get(array, i),
+               element_size);
+
+    sgt_build(tree);
+
+    return tree;
+}
+
+/// Frees from memory a SegmentTree_s.
+///
+/// \param[in] tree The segment tree to be freed from memory.
+void
+sgt_free(SegmentTree_t *tree)
+{
+    free(tree->nodes);
+    free(tree->updates);
+    free(tree->pending);
+    free(tree->identity);
+    free(tree);
+}
+
+/// Enables sgt_update(). An update is applied to the aggregate of a range
+/// with \c apply, which receives the amount of values in the range. Two
+/// updates are merged with \c compose, which folds the newer update into the
+/// older one, and applying the result must be the same as applying the older
+/// one and then the newer one. For example, adding to every value is applied
+/// to a sum with apply_add_sum_int64_t(), to a minimum or maximum with
+/// apply_add_int64_t(), and composed with reduce_sum_int64_t().
+///
+/// \param[in] tree SegmentTree_s reference.
+/// \param[in] update_size Size in bytes of each update.
+/// \param[in] apply Applies an update to the aggregate of a range.
+/// \param[in] compose Folds a newer update into an older one.
+///
+/// \return False if allocation failed or a parameter is invalid, in which case
+/// the tree is not changed.
+bool
+sgt_set_lazy(SegmentTree_t *tree, size_t update_size, apply_f apply,
+             reduce_f compose)
+{
+    if (update_size == 0 || !apply || !compose)
+        return false;
+
+    // Pending updates are pushed so they don't depend on the old functions
+    for (integer_t i = 0; i < tree->capacity; i++)
+        sgt_push_path(tree, tree->capacity + i);
+
+    unsigned char *updates = malloc(update_size * (size_t)tree->capacity);
+    bool *pending = calloc((size_t)tree->capacity, sizeof(bool));
+
+    if (!updates || !pending)
+    {
+        free(updates);
+        free(pending);
+        return false;
+    }
+
+    free(tree->updates);
+    free(tree->pending);
+
+    tree->updates = updates;
+    tree->pending = pending;
+    tree->update_size = update_size;
+    tree->apply = apply;
+    tree->compose = compose;
+
+    return true;
+}
+
+/// \param[in] tree SegmentTree_s reference.
+///
+/// \return The amount of values in the tree.
+integer_t
+sgt_size(SegmentTree_t *tree)
+{
+    return tree->size;
+}
+
+/// \param[in] tree SegmentTree_s reference.
+///
+/// \return The size in bytes of each value.
+size_t
+sgt_element_size(SegmentTree_t *tree)
+{
+    return tree->element_size;
+}
+
+/// \param[in] tree SegmentTree_s reference.
+///
+/// \return True if sgt_update() can be used.
+bool
+sgt_lazy(SegmentTree_t *tree)
+{
+    return tree->apply != NULL;
+}
+
+/// Copies the value at a given index, with every update applied to it.
+///
+/// \param[in] tree SegmentTree_s reference.
+/// \param[in] index Index of the value.
+/// \param[out] result Where the value is copied to.
+///
+/// \return False if the index is out of bounds.
+bool
+sgt_get(SegmentTree_t *tree, integer_t index, void *result)
+{
+    if (index < 0 || index >= tree->size)
+        return false;
+
+    integer_t leaf = tree->capacity + index;
+
+    sgt_push_path(tree, leaf);
+
+    memcpy(result, sgt_node(tree, leaf), tree->element_size);
+
+    return true;
+}
+
+/// Replaces the value at a given index and recombines its ancestors.
+///
+/// \param[in] tree SegmentTree_s reference.
+/// \param[in] index Index of the value.
+/// \param[in] element The new value.
+///
+/// \return False if the index is out of bounds.
+bool
+sgt_set(SegmentTree_t *tree, integer_t index, const void *element)
+{
+    if (index < 0 || index >= tree->size)
+        return false;
+
+    integer_t leaf = tree->capacity + index;
+
+    sgt_push_path(tree, leaf);
+
+    memcpy(sgt_node(tree, leaf), element, tree->element_size);
+
+    for (integer_t node = leaf / 2; node > 0; node /= 2)
+        sgt_pull(tree, node);
+
+    return true;
+}
+
+/// Applies an update to every value between two indexes, both inclusive, in
+/// <code> O(log n) </code> time. Requires sgt_set_lazy().
+///
+/// \param[in] tree SegmentTree_s reference.
+/// \param[in] from Index of the first value.
+/// \param[in] to Index of the last value.
+/// \param[in] update The update.
+///
+/// \return False if range updates are not enabled or the indexes are out of
+/// bounds or not in order.
+bool
+sgt_update(SegmentTree_t *tree, integer_t from, integer_t to,
+           const void *update)
+{
+    if (!tree->apply || from < 0 || from > to || to >= tree->size)
+        return false;
+
+    sgt_update_node(tree, 1, 0, tree->capacity - 1, from, to, update);
+
+    return true;
+}
+
+/// Combines every value between two indexes, both inclusive, from left to
+/// right in <code> O(log n) </code> time.
+///
+/// \param[in] tree SegmentTree_s reference.
+/// \param[in] from Index of the first value.
+/// \param[in] to Index of the last value.
+/// \param[out] result The aggregate of the range.
+///
+/// \return False if the indexes are out of bounds or not in order.
+bool
+sgt_query(SegmentTree_t *tree, integer_t from, integer_t to, void *result)
+{
+    if (from < 0 || from > to || to >= tree->size)
+        return false;
+
+    memcpy(result, tree->identity, tree->element_size);
+
+    sgt_query_node(tree, 1, 0, tree->capacity - 1, from, to, result);
+
+    return true;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned char *
+sgt_node(SegmentTree_t *tree, integer_t node)
+{
+    return tree->nodes + (size_t)node * tree->element_size;
+}
+
+static void
+sgt_build(SegmentTree_t *tree)
+{
+    for (integer_t node = tree->capacity - 1; node > 0; node--)
+        sgt_pull(tree, node);
+}
+
+// Recomputes the aggregate of an inner node from its children
+static void
+sgt_pull(SegmentTree_t *tree, integer_t node)
+{
+    unsigned char *aggregate = sgt_node(tree, node);
+
+    memcpy(aggregate, sgt_node(tree, 2 * node), tree->element_size);
+
+    tree->combine(aggregate, sgt_node(tree, 2 * node + 1));
+}
+
+// Applies an update to a node covering count values and keeps it for its
+// children
+static void
+sgt_apply(SegmentTree_t *tree, integer_t node, const void *update,
+          integer_t count)
+{
+    tree->apply(sgt_node(tree, node), update, count);
+
+    if (node >= tree->capacity)
+        return;
+
+    unsigned char *pending = tree->updates + (size_t)node * tree->update_size;
+
+    if (tree->pending[node])
+        tree->compose(pending, update);
+    else
+    {
+        memcpy(pending, update, tree->update_size);
+        tree->pending[node] = true;
+    }
+}
+
+// Hands the update kept in a node covering count values to its children
+static void
+sgt_push(SegmentTree_t *tree, integer_t node, integer_t count)
+{
+    if (!tree->pending || !tree->pending[node])
+        return;
+
+    unsigned char *pending = tree->updates + (size_t)node * tree->update_size;
+
+    sgt_apply(tree, 2 * node, pending, count / 2);
+    sgt_apply(tree, 2 * node + 1, pending, count / 2);
+
+    tree->pending[node] = false;
+}
+
+// Pushes every update on the way from the root to a leaf
+static void
+sgt_push_path(SegmentTree_t *tree, integer_t leaf)
+{
+    if (!tree->pending)
+        return;
+
+    integer_t height = 0;
+
+    while (((integer_t)1 << height) < tree->capacity)
+        height++;
+
+    for (integer_t level = height; level > 0; level--)
+        sgt_push(tree, leaf >> level, (integer_t)1 << level);
+}
+
+// Folds into result the aggregates of the nodes inside [from, to] below a node
+// covering [low, high], from left to right
+static void
+sgt_query_node(SegmentTree_t *tree, integer_t node, integer_t low,
+               integer_t high, integer_t from, integer_t to, void *result)
+{
+    if (to < low || high < from)
+        return;
+
+    if (from <= low && high <= to)
+    {
+        tree->combine(result, sgt_node(tree, node));
+        return;
+    }
+
+    sgt_push(tree, node, high - low + 1);
+
+    integer_t middle = low + (high - low) / 2;
+
+    sgt_query_node(tree, 2 * node, low, middle, from, to, result);
+    sgt_query_node(tree, 2 * node + 1, middle + 1, high, from, to, result);
+}
+
+static void
+sgt_update_node(SegmentTree_t *tree, integer_t node, integer_t low,
+                integer_t high, integer_t from, integer_t to,
+                const void *update)
+{
+    if (to < low || high < from)
+        return;
+
+    // Nodes inside the range never cover the padding past the size
+    if (from <= low && high <= to)
+    {
+        sgt_apply(tree, node, update, high - low + 1);
+        return;
+    }
+
+    sgt_push(tree, node, high - low + 1);
+
+    integer_t middle = low + (high - low) / 2;
+
+    sgt_update_node(tree, 2 * node, low, middle, from, to, update);
+    sgt_update_node(tree, 2 * node + 1, middle + 1, high, from, to, update);
+
+    sgt_pull(tree, node);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,444 @@
+/**
+ * @file Sharded.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Sharded.h"
+
+/// A Sharded_s splits one logical container in N independent containers, the
+/// shards, each protected by its own Synchronized_s. Keys are sent to a shard
+/// by their hash, so threads writing different keys mostly take different
+/// locks instead of all waiting on the same one. Any container can be sharded;
+/// it is created, counted and visited through the ShardFunctions_s given to
+/// shd_new().
+///
+/// The shard of a key is found with shd_find() and used like any other
+/// Synchronized_s:
+///
+/// <code>
+/// Synchronized_t *shard = shd_find(sharded, key);
+/// SYN_WRITE(shard, rbt_insert(syn_target(shard), key));
+/// </code>
+///
+/// The hash is mixed before picking a shard, so a HashMap_s in each shard that
+/// uses the same hash function still spreads its keys over all of its
+/// buckets. Operations over every shard, like shd_count(), lock one shard at a
+/// time, except shd_visit_sorted() which needs a consistent view of all of
+/// them. Shards are always locked in the order of their indexes.
+///
+/// Lock hold times are not measured by default since the clock readings
+/// would cost more than most sections. They can be enabled on each shard with
+/// syn_set_timing().
+///
+/// \par Functions
+/// Located in the file Sharded.c
+struct Sharded_s
+{
+    /// \brief The lock of each shard, which holds its container.
+    Synchronized_t **shards;
+
+    /// \brief Amount of shards.
+    integer_t count;
+
+    /// \brief Hash function used to pick the shard of a key.
+    hash_f hash;
+
+    /// \brief Functions that manage the containers.
+    ShardFunctions_t functions;
+};
+
+/// \brief Buffer filled by shd_visit_sorted() with the elements of a shard.
+///
+/// Implementation detail.
+struct ShardCollector_s
+{
+    /// \brief Where the next element is written.
+    void **buffer;
+
+    /// \brief Amount of elements written so far.
+    integer_t size;
+
+    /// \brief Amount of elements that fit.
+    integer_t capacity;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+shd_mix(unsigned_t x);
+
+static void
+shd_collect(void *element, void *argument);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a sharded container. Each shard gets a container made by the
+/// \c create function of \c functions.
+///
+/// \param[in] shards The amount of shards, greater than 0. A few times the
+/// amount of writer threads keeps two writers from picking the same shard
+/// most of the time.
+/// \param[in] hash A hash function for the keys.
+/// \param[in] functions The functions that manage the containers. They are
+/// copied.
+/// \param[in] context An argument given to \c create.
+///
+/// \return A new Sharded_s or NULL if the parameters are invalid or if any
+/// allocation failed.
+Sharded_t *
+shd_new(integer_t shards, hash_f hash, const ShardFunctions_t *functions,
+        void *context)
+{
+    if (shards < 1 || !hash || !functions || !functions->create ||
+        !functions->destroy)
+        return NULL;
+
+    Sharded_t *sharded = malloc(sizeof(Sharded_t));
+
+    if (!sharded)
+        return NULL;
+
+    sharded->shards = malloc(sizeof(Synchronized_t *) * (size_t)shards);
+
+    if (!sharded->shards)
+    {
+        free(sharded);
+        return NULL;
+    }
+
+    sharded->count = 0;
+    sharded->hash = hash;
+    sharded->functions = *functions;
+
+    while (sharded->count < shards)
+    {
+        void *container = functions->create(context);
+
+        if (!container)
+            break;
+
+        Synchronized_t *shard = syn_new(container);
+
+        if (!shard)
+        {
+            functions->destroy(container);
+            break;
+        }
+
+        syn_set_timing(shard, false);
+
+        sharded->shards[sharded->count++] = shard;
+    }
+
+    if (sharded->count < shards)
+    {
+        shd_free(sharded);
+        return NULL;
+    }
+
+    return sharded;
+}
+
+/// Frees from memory every shard and its container. No thread can be using
+/// any of the shards.
+///
+/// \param[in] sharded The sharded container to be freed from memory.
+void
+shd_free(Sharded_t *sharded)
+{
+    for (integer_t i = 0; i < sharded->count; i++)
+    {
+        sharded->functions.destroy(syn_target(sharded->shards[i]));
+
+        syn_free(sharded->shards[i]);
+    }
+
+    free(sharded->shards);
+
+    free(sharded);
+}
+
+/// \param[in] sharded The sharded container.
+///
+/// \return The amount of shards.
+integer_t
+shd_shards(Sharded_t *sharded)
+{
+    return sharded->count;
+}
+
+/// Returns the index of the shard of a key. The same key always gets the same
+/// index.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] key The key.
+///
+/// \return An index between 0 and the amount of shards minus one.
+integer_t
+shd_index(Sharded_t *sharded, const void *key)
+{
+    return (integer_t)(shd_mix(sharded->hash(key))
+                       % (unsigned_t)sharded->count);
+}
+
+/// Returns the lock of a shard. Its container is accessed through
+/// syn_target() inside a section of the lock.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] index The index of the shard.
+///
+/// \return The lock of the shard or NULL if the index is out of range.
+Synchronized_t *
+shd_shard(Sharded_t *sharded, integer_t index)
+{
+    if (index < 0 || index >= sharded->count)
+        return NULL;
+
+    return sharded->shards[index];
+}
+
+/// Returns the lock of the shard that holds a key. Inserting, searching and
+/// removing that key must be done in a section of this lock.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] key The key.
+///
+/// \return The lock of the shard of the key.
+Synchronized_t *
+shd_find(Sharded_t *sharded, const void *key)
+{
+    return sharded->shards[shd_index(sharded, key)];
+}
+
+/// Adds together the lock statistics of every shard. A high amount of waits
+/// compared to the amount of sections means that threads still contend and
+/// more shards might help.
+///
+/// \param[in] sharded The sharded container.
+///
+/// \return The statistics of all shards.
+SyncStats_t
+shd_stats(Sharded_t *sharded)
+{
+    SyncStats_t total = { 0 };
+
+    for (integer_t i = 0; i < sharded->count; i++)
+    {
+        SyncStats_t stats = syn_stats(sharded->shards[i]);
+
+        total.reads += stats.reads;
+        total.read_time += stats.read_time;
+        total.writes += stats.writes;
+        total.write_time += stats.write_time;
+        total.optimistic += stats.optimistic;
+        total.retries += stats.retries;
+        total.waits += stats.waits;
+        total.wait_time += stats.wait_time;
+
+        if (stats.read_max > total.read_max)
+            total.read_max = stats.read_max;
+
+        if (stats.write_max > total.write_max)
+            total.write_max = stats.write_max;
+    }
+
+    return total;
+}
+
+/// Adds the amount of elements of every shard. Each shard is counted while
+/// holding its read lock, so with concurrent writers the result is not the
+/// amount at a single point in time.
+///
+/// \param[in] sharded The sharded container.
+///
+/// \return The amount of elements or -1 if there is no \c count function.
+integer_t
+shd_count(Sharded_t *sharded)
+{
+    if (!sharded->functions.count)
+        return -1;
+
+    integer_t total = 0;
+
+    for (integer_t i = 0; i < sharded->count; i++)
+    {
+        Synchronized_t *shard = sharded->shards[i];
+
+        SYN_READ(shard, total += sharded->functions.count(syn_target(shard)));
+    }
+
+    return total;
+}
+
+/// Calls a function with the container of each shard while holding its
+/// write lock, so the function can also modify the container. The function
+/// must not use the sharded container.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] visit The function called with each container.
+/// \param[in] argument An argument given to every call.
+void
+shd_for_each(Sharded_t *sharded, visit_f visit, void *argument)
+{
+    for (integer_t i = 0; i < sharded->count; i++)
+    {
+        Synchronized_t *shard = sharded->shards[i];
+
+        SYN_WRITE(shard, visit(syn_target(shard), argument));
+    }
+}
+
+/// Calls a function with every element, one shard at a time while holding
+/// its read lock. Elements come in no particular order. The function must
+/// not use the sharded container.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument given to every call.
+void
+shd_visit(Sharded_t *sharded, visit_f visit, void *argument)
+{
+    if (!sharded->functions.visit)
+        return;
+
+    for (integer_t i = 0; i < sharded->count; i++)
+    {
+        Synchronized_t *shard = sharded->shards[i];
+
+        SYN_READ(shard, sharded->functions.visit(syn_target(shard), visit,
+                                                 argument));
+    }
+}
+
+/// Calls a function with every element in ascending order. Each container
+/// must visit its own elements in order; they are then merged across shards,
+/// which costs <code> O(n * shards) </code>. The read lock of every shard is
+/// held during the whole merge so that no element is freed or moved while it
+/// is visited. The function must not use the sharded container.
+///
+/// \param[in] sharded The sharded container.
+/// \param[in] compare The function that orders the elements.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument given to every call.
+///
+/// \return True if every element was visited or false if allocation failed
+/// or there is no \c count or \c visit function.
+bool
+shd_visit_sorted(Sharded_t *sharded, compare_f compare, visit_f visit,
+                 void *argument)
+{
+    if (!sharded->functions.count || !sharded->functions.visit)
+        return false;
+
+    integer_t count = sharded->count;
+
+    integer_t *bounds = malloc(sizeof(integer_t) * (size_t)(count * 2));
+
+    if (!bounds)
+        return false;
+
+    // Where the elements of each shard start and end in the buffer
+    integer_t *heads = bounds, *ends = bounds + count;
+
+    unsigned_t *tickets = malloc(sizeof(unsigned_t) * (size_t)count);
+
+    if (!tickets)
+    {
+        free(bounds);
+        return false;
+    }
+
+    integer_t total = 0;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        tickets[i] = syn_read_begin(sharded->shards[i]);
+
+        heads[i] = total;
+
+        total += sharded->functions.count(syn_target(sharded->shards[i]));
+
+        ends[i] = total;
+    }
+
+    void **buffer = malloc(sizeof(void *) * (size_t)(total > 0 ? total : 1));
+
+    if (buffer)
+    {
+        struct ShardCollector_s collector = { buffer, 0, total };
+
+        for (integer_t i = 0; i < count; i++)
+        {
+            collector.buffer = buffer + heads[i];
+            collector.size = 0;
+            collector.capacity = ends[i] - heads[i];
+
+            sharded->functions.visit(syn_target(sharded->shards[i]),
+                                     shd_collect, &collector);
+
+            ends[i] = heads[i] + collector.size;
+        }
+
+        for (;;)
+        {
+            integer_t lowest = -1;
+
+            for (integer_t i = 0; i < count; i++)
+            {
+                if (heads[i] < ends[i] &&
+                    (lowest < 0 ||
+                     compare(buffer[heads[i]], buffer[heads[lowest]]) < 0))
+                {
+                    lowest = i;
+                }
+            }
+
+            if (lowest < 0)
+                break;
+
+            visit(buffer[heads[lowest]++], argument);
+        }
+    }
+
+    for (integer_t i = count - 1; i >= 0; i--)
+        syn_read_end(sharded->shards[i], tickets[i]);
+
+    bool visited = buffer != NULL;
+
+    free(buffer);
+    free(tickets);
+    free(bounds);
+
+    return visited;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Finalizer of splitmix64. Keeps the shard from depending only on the low
+// bits of the hash, which a hash table in the shard also uses.
+static unsigned_t
+shd_mix(unsigned_t x)
+{
+    uint64_t z = (uint64_t)x + UINT64_C(0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+// Appends an element to a ShardCollector_s, ignoring any element beyond the
+// amount given by the count function
+static void
+shd_collect(void *element, void *argument)
+{
+    struct ShardCollector_s *collector = argument;
+
+    if (collector->size < collector->capacity)
+        collector->buffer[collector->size++] = element;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -85,6 +85,12 @@ struct SinglyLinkedList_s
     /// A function that completely frees an element from memory.
     sll_free_f v_free;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -92,6 +98,20 @@ struct SinglyLinkedList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief Last node found by a positional search.
+    ///
+    /// Positional operations start walking from this node instead of the head
+    /// when possible, so looping over the positions of the list is linear
+    /// instead of quadratic. It is only valid while \c cursor_version equals
+    /// \c version_id.
+    struct SinglyLinkedNode_s *cursor;
+
+    /// \brief Position of \c cursor in the list.
+    integer_t cursor_index;
+
+    /// \brief The version id of the list when \c cursor was cached.
+    integer_t cursor_version;
 };
 
 /// \brief A SinglyLinkedList_s node.
@@ -123,15 +143,22 @@ typedef struct SinglyLinkedNode_s *SinglyLinkedNode;
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status sll_make_node(SinglyLinkedNode *node, void *element);
+static Status sll_make_node(NodePool_t *pool, SinglyLinkedNode *node,
+        void *element);
 
-static Status sll_free_node(SinglyLinkedNode *node, sll_free_f free_f);
+static Status sll_free_node(NodePool_t *pool, SinglyLinkedNode *node,
+        sll_free_f free_f);
 
-static Status sll_free_node_shallow(SinglyLinkedNode *node);
+static Status sll_free_node_shallow(NodePool_t *pool, SinglyLinkedNode *node);
 
 static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result,
         integer_t position);
 
+static SinglyLinkedNode sll_split(SinglyLinkedNode node, integer_t count);
+
+static SinglyLinkedNode sll_merge_sort(SinglyLinkedNode head,
+        integer_t length, sll_compare_f compare_f, SinglyLinkedNode *tail);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a SinglyLinkedList_s structure.
@@ -164,6 +191,12 @@ Status sll_init(SinglyLinkedList *list)
     (*list)->v_display = NULL;
     (*list)->v_free = NULL;
 
+    (*list)->pool = NULL;
+
+    (*list)->cursor = NULL;
+    (*list)->cursor_index = 0;
+    (*list)->cursor_version = -1;
+
     return DS_OK;
 }
 
@@ -200,6 +233,12 @@ Status sll_create(SinglyLinkedList *list, sll_compare_f compare_f,
     (*list)->v_display = display_f;
     (*list)->v_free = free_f;
 
+    (*list)->pool = NULL;
+
+    (*list)->cursor = NULL;
+    (*list)->cursor_index = 0;
+    (*list)->cursor_version = -1;
+
     return DS_OK;
 }
 
@@ -230,7 +269,7 @@ Status sll_free(SinglyLinkedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = sll_free_node(&prev, (*list)->v_free);
+        st = sll_free_node((*list)->pool, &prev, (*list)->v_free);
 
         if (st != DS_OK)
             return st;
@@ -268,7 +307,7 @@ Status sll_free_shallow(SinglyLinkedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = sll_free_node_shallow(&prev);
+        st = sll_free_node_shallow((*list)->pool, &prev);
 
         if (st != DS_OK)
             return st;
@@ -308,6 +347,8 @@ Status sll_erase(SinglyLinkedList *list)
     if (st !=  DS_OK)
         return st;
 
+    new_list->pool = (*list)->pool;
+
     st = sll_free(list);
 
     // Probably didn't set the free function...
@@ -430,6 +471,36 @@ Status sll_set_limit(SinglyLinkedList list, integer_t limit)
     return DS_OK;
 }
 
+/// \brief Sets a node pool for the specified SinglyLinkedList_s.
+///
+/// Sets a node pool from where all nodes of the list are allocated. A pool can
+/// be shared between many containers as long as its nodes are big enough. To
+/// go back to using malloc() and free() simply set the pool to \c NULL. The
+/// pool can only be changed when the list is empty.
+///
+/// \param[in] list SinglyLinkedList_s reference.
+/// \param[in] pool The node pool or \c NULL.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if the pool's nodes are too small.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sll_set_pool(SinglyLinkedList list, NodePool_t *pool)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!sll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (pool && !npl_fits(pool, sizeof(SinglyLinkedNode_t)))
+        return DS_ERR_INVALID_ARGUMENT;
+
+    list->pool = pool;
+
+    return DS_OK;
+}
+
 /// \brief Sets the given position to a given element erasing the old one.
 ///
 /// Sets an element at a given position. This function is 0 based, that is, the
@@ -579,7 +650,7 @@ Status sll_insert_head(SinglyLinkedList list, void *element)
 
     SinglyLinkedNode node;
 
-    Status st = sll_make_node(&node, element);
+    Status st = sll_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -667,7 +738,7 @@ Status sll_insert_at(SinglyLinkedList list, void *element, integer_t position)
 
         SinglyLinkedNode node = NULL;
 
-        st = sll_make_node(&node, element);
+        st = sll_make_node(list->pool, &node, element);
 
         if (st != DS_OK)
             return st;
@@ -681,6 +752,11 @@ Status sll_insert_at(SinglyLinkedList list, void *element, integer_t position)
         list->length++;
         list->version_id++;
 
+        // The new node is still a valid starting point for the next search
+        list->cursor = node;
+        list->cursor_index = position;
+        list->cursor_version = list->version_id;
+
         return DS_OK;
     }
 }
@@ -710,7 +786,7 @@ Status sll_insert_tail(SinglyLinkedList list, void *element)
 
     SinglyLinkedNode node;
 
-    Status st = sll_make_node(&node, element);
+    Status st = sll_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -760,7 +836,7 @@ Status sll_remove_head(SinglyLinkedList list, void **result)
 
     list->head = list->head->next;
 
-    sll_free_node_shallow(&node);
+    sll_free_node_shallow(list->pool, &node);
 
     list->length--;
     list->version_id++;
@@ -840,7 +916,7 @@ Status sll_remove_at(SinglyLinkedList list, void **result, integer_t position)
 
         *result = node->data;
 
-        sll_free_node_shallow(&node);
+        sll_free_node_shallow(list->pool, &node);
 
         list->length--;
         list->version_id++;
@@ -851,6 +927,11 @@ Status sll_remove_at(SinglyLinkedList list, void **result, integer_t position)
             list->tail = NULL;
         }
 
+        // The previous node is still a valid starting point for the next search
+        list->cursor = prev;
+        list->cursor_index = position - 1;
+        list->cursor_version = list->version_id;
+
         return DS_OK;
     }
 }
@@ -896,7 +977,7 @@ Status sll_remove_tail(SinglyLinkedList list, void **result)
         list->tail = prev;
     }
 
-    sll_free_node_shallow(&curr);
+    sll_free_node_shallow(list->pool, &curr);
 
     list->length--;
     list->version_id++;
@@ -1165,6 +1246,37 @@ Status sll_reverse(SinglyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Sorts a SinglyLinkedList_s.
+///
+/// Sorts the list in ascending order according to its default compare
+/// function, using a bottom-up merge sort that only relinks the nodes. It
+/// takes O(n log n), allocates nothing and keeps equal elements in their
+/// original order. Use sll_reverse() afterwards for a descending order.
+///
+/// \param[in] list SinglyLinkedList_s reference to be sorted.
+///
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
+/// \return DS_ERR_NULL_POINTER if list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sll_sort(SinglyLinkedList list)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (list->length < 2)
+        return DS_OK;
+
+    list->head = sll_merge_sort(list->head, list->length, list->v_compare,
+            &list->tail);
+
+    list->version_id++;
+
+    return DS_OK;
+}
+
 /// \brief Makes a copy of the specified SinglyLinkedList_s.
 ///
 /// Makes an exact copy of a list, copying each element using the default copy
@@ -1193,6 +1305,8 @@ Status sll_copy(SinglyLinkedList list, SinglyLinkedList *result)
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+
     (*result)->limit = list->limit;
 
     SinglyLinkedNode scan = list->head;
@@ -1279,6 +1393,10 @@ Status sll_link(SinglyLinkedList list1, SinglyLinkedList list2)
     if (list1 == NULL || list2 == NULL)
         return DS_ERR_NULL_POINTER;
 
+    // Nodes can only move between lists that share the same node pool
+    if (list1->pool != list2->pool)
+        return DS_ERR_INVALID_OPERATION;
+
     if (sll_empty(list2))
         return DS_ERR_INVALID_OPERATION;
 
@@ -1294,7 +1412,7 @@ Status sll_link(SinglyLinkedList list1, SinglyLinkedList list2)
         list1->tail->next = list2->head;
         list1->tail = list2->tail;
 
-        list2->length += list2->length;
+        list1->length += list2->length;
     }
 
     list2->head = NULL;
@@ -1302,6 +1420,9 @@ Status sll_link(SinglyLinkedList list1, SinglyLinkedList list2)
 
     list2->length = 0;
 
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
@@ -1320,6 +1441,10 @@ Status sll_link_at(SinglyLinkedList list1, SinglyLinkedList list2,
     if (list1 == NULL || list2 == NULL)
         return DS_ERR_NULL_POINTER;
 
+    // Nodes can only move between lists that share the same node pool
+    if (list1->pool != list2->pool)
+        return DS_ERR_INVALID_OPERATION;
+
     if (position > list1->length)
         return DS_ERR_OUT_OF_RANGE;
 
@@ -1354,6 +1479,9 @@ Status sll_link_at(SinglyLinkedList list1, SinglyLinkedList list2,
     list1->length += list2->length;
     list2->length = 0;
 
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
@@ -1375,6 +1503,10 @@ Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
     if (!sll_empty(result))
         return DS_ERR_INVALID_OPERATION;
 
+    // Nodes can only move between lists that share the same node pool
+    if (list->pool != result->pool)
+        return DS_ERR_INVALID_OPERATION;
+
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
@@ -1387,8 +1519,8 @@ Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
 
         result->length = list->length;
 
-        result->tail = NULL;
-        result->head = NULL;
+        list->tail = NULL;
+        list->head = NULL;
     }
     else
     {
@@ -1411,24 +1543,95 @@ Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
 
     result->length = len - position;
 
+    list->version_id++;
+    result->version_id++;
+
     return DS_OK;
 }
 
 /// \brief Unlinks elements from a given position to another.
 ///
-/// \param list
-/// \param result
-/// \param position1
-/// \param position2
-///
-/// \return
+/// Moves the elements from \c position1 to \c position2, both inclusive, to
+/// the end of an empty list. Only the nodes at the ends of the range are
+/// relinked, so once they are found moving the range takes O(1).
+///
+/// \param[in] list SinglyLinkedList_s where the elements are removed from.
+/// \param[in] result An empty SinglyLinkedList_s that receives the elements.
+/// \param[in] position1 Position of the first element to be moved.
+/// \param[in] position2 Position of the last element to be moved.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if position2 is less than position1.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty or if the lists
+/// have different node pools.
+/// \return DS_ERR_NEGATIVE_VALUE if a position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position2 is greater than or equal to the
+/// list's length.
+/// \return DS_OK if all operations are successful.
 Status sll_unlink_at(SinglyLinkedList list, SinglyLinkedList result,
         integer_t position1, integer_t position2)
 {
-    /// \todo sll_unlink_at
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!sll_empty(result))
+        return DS_ERR_INVALID_OPERATION;
+
+    // Nodes can only move between lists that share the same node pool
+    if (list->pool != result->pool)
+        return DS_ERR_INVALID_OPERATION;
+
+    if (position1 < 0 || position2 < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (position2 < position1)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (position2 >= list->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    SinglyLinkedNode before = NULL, last;
+
+    Status st;
+
+    if (position1 > 0)
+    {
+        st = sll_get_node_at(list, &before, position1 - 1);
+
+        if (st != DS_OK)
+            return st;
+    }
+
+    // Continues from the node found above
+    st = sll_get_node_at(list, &last, position2);
+
+    if (st != DS_OK)
+        return st;
+
+    SinglyLinkedNode first = before == NULL ? list->head : before->next;
+
+    if (before == NULL)
+        list->head = last->next;
+    else
+        before->next = last->next;
+
+    if (last == list->tail)
+        list->tail = before;
+
+    last->next = NULL;
+
+    result->head = first;
+    result->tail = last;
+
+    result->length = position2 - position1 + 1;
+
+    list->length -= result->length;
+
+    list->version_id++;
+    result->version_id++;
+
     return DS_OK;
 }
-
 /// \brief Displays a SinglyLinkedList_s in the console.
 ///
 /// Displays a SinglyLinkedList_s in the console with its elements separated by
@@ -1563,14 +1766,16 @@ Status sll_display_raw(SinglyLinkedList list)
 /// Implementation detail. Function responsible for allocating a new
 /// SinglyLinkedNode_s.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SinglyLinkedNode_s to be allocated.
 /// \param[in] element Node's data member.
 ///
 /// \return DS_ERR_ALLOC if node allocation failed.
 /// \return DS_OK if all operations are successful.
-static Status sll_make_node(SinglyLinkedNode *node, void *element)
+static Status sll_make_node(NodePool_t *pool, SinglyLinkedNode *node,
+        void *element)
 {
-    (*node) = malloc(sizeof(SinglyLinkedNode_t));
+    (*node) = npl_node_alloc(pool, sizeof(SinglyLinkedNode_t));
 
     if (!(*node))
         return DS_ERR_ALLOC;
@@ -1586,19 +1791,21 @@ static Status sll_make_node(SinglyLinkedNode *node, void *element)
 /// Implementation detail. Frees a SinglyLinkedNode_s and its data using the
 /// list's default free function.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SinglyLinkedNode_s to be freed from memory.
 /// \param[in] free_f List's default free function.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status sll_free_node(SinglyLinkedNode *node, sll_free_f free_f)
+static Status sll_free_node(NodePool_t *pool, SinglyLinkedNode *node,
+        sll_free_f free_f)
 {
     if (*node == NULL)
         return DS_ERR_NULL_POINTER;
 
     free_f((*node)->data);
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     (*node) = NULL;
 
@@ -1610,16 +1817,17 @@ static Status sll_free_node(SinglyLinkedNode *node, sll_free_f free_f)
 /// Implementation detail. Frees a SinglyLinkedNode_s and leaves its data
 /// untouched.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SinglyLinkedNode_s to be freed from memory.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status sll_free_node_shallow(SinglyLinkedNode *node)
+static Status sll_free_node_shallow(NodePool_t *pool, SinglyLinkedNode *node)
 {
     if (*node == NULL)
         return DS_ERR_NULL_POINTER;
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     (*node) = NULL;
 
@@ -1629,7 +1837,8 @@ static Status sll_free_node_shallow(SinglyLinkedNode *node)
 /// \brief Gets a node from a specific position.
 ///
 /// Implementation detail. Searches for a node in O(n) where the search starts
-/// at the head of the list.
+/// at the head of the list, or at the last node found by this function if it
+/// comes before the wanted position and the list was not modified since then.
 ///
 /// \param[in] list SinglyLinkedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1658,9 +1867,23 @@ static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result, i
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
+    integer_t index = 0;
+
     (*result) = list->head;
 
-    for (integer_t i = 0; i < position; i++)
+    if (position == list->length - 1)
+    {
+        (*result) = list->tail;
+        index = position;
+    }
+    else if (list->cursor_version == list->version_id &&
+             list->cursor_index <= position)
+    {
+        (*result) = list->cursor;
+        index = list->cursor_index;
+    }
+
+    for (; index < position; index++)
     {
         if ((*result) == NULL)
             return DS_ERR_ITER;
@@ -1668,9 +1891,100 @@ static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result, i
         (*result) = (*result)->next;
     }
 
+    list->cursor = (*result);
+    list->cursor_index = position;
+    list->cursor_version = list->version_id;
+
     return DS_OK;
 }
 
+/// \brief Cuts a chain of nodes.
+///
+/// Implementation detail. Cuts a \c NULL terminated chain after \c count
+/// nodes.
+///
+/// \param[in] node First node of the chain.
+/// \param[in] count Amount of nodes that are kept in the chain.
+///
+/// \return The first node after the cut or \c NULL if the chain is not
+/// longer than \c count.
+static SinglyLinkedNode sll_split(SinglyLinkedNode node, integer_t count)
+{
+    for (integer_t i = 1; node != NULL && i < count; i++)
+        node = node->next;
+
+    if (node == NULL)
+        return NULL;
+
+    SinglyLinkedNode rest = node->next;
+
+    node->next = NULL;
+
+    return rest;
+}
+
+/// \brief Sorts a chain of nodes.
+///
+/// Implementation detail. A bottom-up merge sort that only follows and changes
+/// the \c next pointers of the nodes. Each pass merges pairs of sorted runs of
+/// the same width, starting at 1 and doubling every pass, so it takes
+/// O(n log n) and no extra memory. Equal elements keep their order.
+///
+/// \param[in] head First node of a \c NULL terminated chain.
+/// \param[in] length Amount of nodes in the chain.
+/// \param[in] compare_f Function used to compare the nodes' data.
+/// \param[out] tail Last node of the sorted chain.
+///
+/// \return The first node of the sorted chain.
+static SinglyLinkedNode sll_merge_sort(SinglyLinkedNode head,
+        integer_t length, sll_compare_f compare_f, SinglyLinkedNode *tail)
+{
+    SinglyLinkedNode_t first;
+
+    first.next = head;
+
+    *tail = head;
+
+    for (integer_t width = 1; width < length; width *= 2)
+    {
+        SinglyLinkedNode last = &first, scan = first.next;
+
+        while (scan != NULL)
+        {
+            SinglyLinkedNode left = scan;
+            SinglyLinkedNode right = sll_split(left, width);
+
+            scan = sll_split(right, width);
+
+            // Merge both runs after last, taking from the left one on ties
+            while (left != NULL && right != NULL)
+            {
+                if (compare_f(right->data, left->data) < 0)
+                {
+                    last->next = right;
+                    right = right->next;
+                }
+                else
+                {
+                    last->next = left;
+                    left = left->next;
+                }
+
+                last = last->next;
+            }
+
+            last->next = left != NULL ? left : right;
+
+            while (last->next != NULL)
+                last = last->next;
+        }
+
+        *tail = last;
+    }
+
+    return first.next;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,779 @@
+/**
+ * @file SkipList.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "SkipList.h"
+#include <stdatomic.h>
+#include <sched.h>
+
+/// Maximum amount of levels of a node. With a 1/4 chance of going up a level
+/// this is enough for billions of elements.
+#define SKL_MAX_LEVEL 20
+
+/// A SkipList_s is an ordered set of unique elements that can be used by many
+/// threads at the same time. It is the lazy skip list by Herlihy, Lev,
+/// Luchangco and Shavit. Every element is in a sorted linked list at level 0
+/// and some of them are also in sparser lists at higher levels, so searches
+/// take a logarithmic amount of steps like a RedBlackTree_s.
+///
+/// skl_contains(), skl_min(), skl_max() and iterators never lock or wait,
+/// reads scale with the amount of threads. skl_insert() and skl_remove() only
+/// lock the few nodes that precede the element at each of its levels, so
+/// operations on different parts of the list do not block each other.
+///
+/// A removed node might still be in use by a reader, so instead of being
+/// freed it is kept in a list of retired nodes together with its element.
+/// They are freed by skl_reclaim() once no other thread is using the skip
+/// list, or by skl_free().
+///
+/// \par Functions
+/// Located in the file SkipList.c
+struct SkipList_s
+{
+    /// \brief Sentinel node that precedes every element.
+    ///
+    /// Has every level and no element.
+    struct SkipListNode_s *head;
+
+    /// \brief Amount of elements.
+    _Atomic(integer_t) size;
+
+    /// \brief Removed nodes waiting to be freed.
+    _Atomic(struct SkipListNode_s *) retired;
+
+    /// \brief An interface for the elements.
+    ///
+    /// Requires at least compare and free.
+    Interface_t *interface;
+};
+
+/// \brief A SkipList_s node.
+///
+/// Implementation detail. A node is part of the set only after \c linked is
+/// set and until \c marked is set.
+struct SkipListNode_s
+{
+    /// \brief Element of this node.
+    void *key;
+
+    /// \brief Amount of levels this node is linked in.
+    integer_t levels;
+
+    /// \brief If the node was removed.
+    atomic_bool marked;
+
+    /// \brief If the node was linked in all of its levels.
+    atomic_bool linked;
+
+    /// \brief Held while changing this node or its successors.
+    atomic_flag lock;
+
+    /// \brief Next node in the retired list.
+    struct SkipListNode_s *retired;
+
+    /// \brief Next node at each level.
+    _Atomic(struct SkipListNode_s *) next[];
+};
+
+/// \brief A SkipList_s iterator.
+///
+/// Implementation detail. The current node might have been removed after the
+/// iterator reached it, its next pointers are still valid until the node is
+/// reclaimed.
+struct SkipListIterator_s
+{
+    /// \brief Current node or NULL past the end.
+    struct SkipListNode_s *cursor;
+
+    /// \brief Target skip list.
+    SkipList_t *target;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct SkipListNode_s *
+skl_new_node(void *element, integer_t levels);
+
+static integer_t
+skl_random_level(void);
+
+static integer_t
+skl_find(SkipList_t *list, void *element, struct SkipListNode_s **preds,
+         struct SkipListNode_s **succs);
+
+static bool
+skl_valid(struct SkipListNode_s *node);
+
+static struct SkipListNode_s *
+skl_next_valid(struct SkipListNode_s *node);
+
+static void
+skl_lock(struct SkipListNode_s *node);
+
+static void
+skl_unlock(struct SkipListNode_s *node);
+
+static void
+skl_unlock_preds(struct SkipListNode_s **preds, integer_t highest);
+
+static void
+skl_free_nodes(SkipList_t *list, bool deep);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new SkipList_s.
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// skip list to operate.
+///
+/// \return A new SkipList_s or NULL if allocation failed.
+SkipList_t *
+skl_new(Interface_t *interface)
+{
+    SkipList_t *list = malloc(sizeof(SkipList_t));
+
+    if (!list)
+        return NULL;
+
+    list->head = skl_new_node(NULL, SKL_MAX_LEVEL);
+
+    if (!list->head)
+    {
+        free(list);
+        return NULL;
+    }
+
+    atomic_store(&list->head->linked, true);
+
+    atomic_init(&list->size, 0);
+    atomic_init(&list->retired, NULL);
+
+    list->interface = interface;
+
+    return list;
+}
+
+/// Frees from memory a SkipList_s, all its elements and all removed elements
+/// still waiting to be reclaimed. No other thread can be using the list.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] list The skip list to be freed from memory.
+void
+skl_free(SkipList_t *list)
+{
+    skl_free_nodes(list, true);
+
+    free(list);
+}
+
+/// Frees from memory a SkipList_s leaving all elements intact, including the
+/// removed ones. No other thread can be using the list.
+///
+/// \param[in] list The skip list to be freed from memory.
+void
+skl_free_shallow(SkipList_t *list)
+{
+    skl_free_nodes(list, false);
+
+    free(list);
+}
+
+/// Frees every node removed so far together with its element. Readers might
+/// still be at a removed node, so this can only be called when no other
+/// thread is using the skip list, for example between two phases of work.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] list The skip list.
+///
+/// \return The amount of elements freed.
+integer_t
+skl_reclaim(SkipList_t *list)
+{
+    struct SkipListNode_s *node = atomic_exchange(&list->retired, NULL);
+
+    integer_t count = 0;
+
+    while (node)
+    {
+        struct SkipListNode_s *next = node->retired;
+
+        list->interface->free(node->key);
+
+        free(node);
+
+        node = next;
+        count++;
+    }
+
+    return count;
+}
+
+/// \param[in] list The skip list.
+///
+/// \return The amount of elements in the skip list.
+integer_t
+skl_size(SkipList_t *list)
+{
+    return atomic_load(&list->size);
+}
+
+/// Adds an element to the skip list. The list becomes the owner of the
+/// element.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] list The skip list.
+/// \param[in] element The element to be inserted.
+///
+/// \return True if the element was inserted.
+/// \return False if an equal element is already present or allocation failed.
+bool
+skl_insert(SkipList_t *list, void *element)
+{
+    struct SkipListNode_s *preds[SKL_MAX_LEVEL], *succs[SKL_MAX_LEVEL];
+
+    integer_t levels = skl_random_level();
+
+    for (;;)
+    {
+        integer_t found = skl_find(list, element, preds, succs);
+
+        if (found != -1)
+        {
+            struct SkipListNode_s *node = succs[found];
+
+            if (!atomic_load(&node->marked))
+            {
+                // Wait until it is part of the set
+                while (!atomic_load(&node->linked))
+                    sched_yield();
+
+                return false;
+            }
+
+            // Being removed, try again once it is gone
+            continue;
+        }
+
+        integer_t highest = -1;
+        bool valid = true;
+
+        for (integer_t level = 0; valid && level < levels; level++)
+        {
+            struct SkipListNode_s *pred = preds[level], *succ = succs[level];
+
+            if (level == 0 || pred != preds[level - 1])
+                skl_lock(pred);
+
+            highest = level;
+
+            valid = !atomic_load(&pred->marked)
+                    && (!succ || !atomic_load(&succ->marked))
+                    && atomic_load_explicit(&pred->next[level],
+                                            memory_order_acquire) == succ;
+        }
+
+        if (!valid)
+        {
+            skl_unlock_preds(preds, highest);
+            continue;
+        }
+
+        struct SkipListNode_s *node = skl_new_node(element, levels);
+
+        if (!node)
+        {
+            skl_unlock_preds(preds, highest);
+            return false;
+        }
+
+        for (integer_t level = 0; level < levels; level++)
+            atomic_init(&node->next[level], succs[level]);
+
+        for (integer_t level = 0; level < levels; level++)
+            atomic_store_explicit(&preds[level]->next[level], node,
+                                  memory_order_release);
+
+        atomic_store(&node->linked, true);
+        atomic_fetch_add(&list->size, 1);
+
+        skl_unlock_preds(preds, highest);
+
+        return true;
+    }
+}
+
+/// Removes the element equal to a given key. The removed element is freed by
+/// skl_reclaim().
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] list The skip list.
+/// \param[in] element The key to be removed.
+///
+/// \return True if an element was removed.
+bool
+skl_remove(SkipList_t *list, void *element)
+{
+    struct SkipListNode_s *preds[SKL_MAX_LEVEL], *succs[SKL_MAX_LEVEL];
+
+    struct SkipListNode_s *victim = NULL;
+
+    for (;;)
+    {
+        integer_t found = skl_find(list, element, preds, succs);
+
+        if (!victim)
+        {
+            // Only a fully linked node found at its top level can be removed
+            if (found == -1)
+                return false;
+
+            struct SkipListNode_s *node = succs[found];
+
+            if (!atomic_load(&node->linked) || node->levels - 1 != found
+                || atomic_load(&node->marked))
+                return false;
+
+            skl_lock(node);
+
+            if (atomic_load(&node->marked))
+            {
+                skl_unlock(node);
+                return false;
+            }
+
+            atomic_store(&node->marked, true);
+
+            victim = node;
+        }
+
+        integer_t highest = -1;
+        bool valid = true;
+
+        for (integer_t level = 0; valid && level < victim->levels; level++)
+        {
+            struct SkipListNode_s *pred = preds[level];
+
+            if (level == 0 || pred != preds[level - 1])
+                skl_lock(pred);
+
+            highest = level;
+
+            valid = !atomic_load(&pred->marked)
+                    && atomic_load_explicit(&pred->next[level],
+                                            memory_order_acquire) == victim;
+        }
+
+        if (!valid)
+        {
+            skl_unlock_preds(preds, highest);
+            continue;
+        }
+
+        for (integer_t level = victim->levels - 1; level >= 0; level--)
+        {
+            struct SkipListNode_s *next =
+                    atomic_load_explicit(&victim->next[level],
+                                         memory_order_acquire);
+
+            atomic_store_explicit(&preds[level]->next[level], next,
+                                  memory_order_release);
+        }
+
+        skl_unlock(victim);
+        skl_unlock_preds(preds, highest);
+
+        atomic_fetch_sub(&list->size, 1);
+
+        // Push to the retired list
+        victim->retired = atomic_load(&list->retired);
+
+        while (!atomic_compare_exchange_weak(&list->retired, &victim->retired,
+                                             victim))
+            continue;
+
+        return true;
+    }
+}
+
+/// Removes the smallest element. If another thread removes it first the next
+/// smallest one is tried.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] list The skip list.
+///
+/// \return True if an element was removed, false if the list was empty.
+bool
+skl_pop(SkipList_t *list)
+{
+    for (;;)
+    {
+        void *element = skl_min(list);
+
+        if (!element)
+            return false;
+
+        if (skl_remove(list, element))
+            return true;
+    }
+}
+
+/// \param[in] list The skip list.
+///
+/// \return True if the skip list had no elements.
+bool
+skl_empty(SkipList_t *list)
+{
+    return skl_size(list) == 0;
+}
+
+/// Searches for an element without locking.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] list The skip list.
+/// \param[in] element The key to be searched.
+///
+/// \return True if an element equal to the key is in the skip list.
+bool
+skl_contains(SkipList_t *list, void *element)
+{
+    struct SkipListNode_s *preds[SKL_MAX_LEVEL], *succs[SKL_MAX_LEVEL];
+
+    integer_t found = skl_find(list, element, preds, succs);
+
+    return found != -1 && skl_valid(succs[found]);
+}
+
+/// Finds the last node by going down from the highest level. If it is being
+/// inserted or removed, level 0 is scanned for the last valid one instead.
+///
+/// \param[in] list The skip list.
+///
+/// \return The greatest element or NULL if the skip list is empty.
+void *
+skl_max(SkipList_t *list)
+{
+    struct SkipListNode_s *node = list->head;
+
+    for (integer_t level = SKL_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        struct SkipListNode_s *next;
+
+        while ((next = atomic_load_explicit(&node->next[level],
+                                            memory_order_acquire)) != NULL)
+            node = next;
+    }
+
+    if (node != list->head && skl_valid(node))
+        return node->key;
+
+    struct SkipListNode_s *last = NULL;
+
+    for (node = skl_next_valid(list->head); node; node = skl_next_valid(node))
+        last = node;
+
+    return last ? last->key : NULL;
+}
+
+/// \param[in] list The skip list.
+///
+/// \return The smallest element or NULL if the skip list is empty.
+void *
+skl_min(SkipList_t *list)
+{
+    struct SkipListNode_s *node = skl_next_valid(list->head);
+
+    return node ? node->key : NULL;
+}
+
+/// Displays the elements in order.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] list The skip list to be displayed.
+void
+skl_display(SkipList_t *list)
+{
+    printf("\nSkipList\n[ ");
+
+    for (struct SkipListNode_s *node = skl_next_valid(list->head); node;
+         node = skl_next_valid(node))
+    {
+        list->interface->display(node->key);
+        printf(" ");
+    }
+
+    printf("]\n");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// Creates a new iterator at the smallest element. Elements inserted or
+/// removed by other threads during the iteration might or might not be seen,
+/// but the elements seen are always in increasing order.
+///
+/// \param[in] target The skip list to be iterated.
+///
+/// \return A new iterator or NULL if allocation failed.
+SkipListIterator_t *
+skl_iter_new(SkipList_t *target)
+{
+    SkipListIterator_t *iter = malloc(sizeof(SkipListIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    iter->target = target;
+    iter->cursor = skl_next_valid(target->head);
+
+    return iter;
+}
+
+/// \param[in] iter The iterator to be freed from memory.
+void
+skl_iter_free(SkipListIterator_t *iter)
+{
+    free(iter);
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return False if there are no more elements.
+bool
+skl_iter_next(SkipListIterator_t *iter)
+{
+    if (!iter->cursor)
+        return false;
+
+    iter->cursor = skl_next_valid(iter->cursor);
+
+    return iter->cursor != NULL;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return False if the skip list is empty.
+bool
+skl_iter_to_front(SkipListIterator_t *iter)
+{
+    iter->cursor = skl_next_valid(iter->target->head);
+
+    return iter->cursor != NULL;
+}
+
+/// Moves the iterator to the smallest element that is not less than a key,
+/// which is where a range query starts.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] iter The iterator.
+/// \param[in] element The key to be searched.
+///
+/// \return False if every element is less than the key.
+bool
+skl_iter_seek(SkipListIterator_t *iter, void *element)
+{
+    struct SkipListNode_s *preds[SKL_MAX_LEVEL], *succs[SKL_MAX_LEVEL];
+
+    skl_find(iter->target, element, preds, succs);
+
+    iter->cursor = skl_next_valid(preds[0]);
+
+    return iter->cursor != NULL;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return The current element or NULL past the end.
+void *
+skl_iter_peek(SkipListIterator_t *iter)
+{
+    return iter->cursor ? iter->cursor->key : NULL;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct SkipListNode_s *
+skl_new_node(void *element, integer_t levels)
+{
+    struct SkipListNode_s *node =
+            malloc(sizeof(struct SkipListNode_s)
+                   + sizeof(_Atomic(struct SkipListNode_s *))
+                     * (size_t)levels);
+
+    if (!node)
+        return NULL;
+
+    node->key = element;
+    node->levels = levels;
+    node->retired = NULL;
+
+    atomic_init(&node->marked, false);
+    atomic_init(&node->linked, false);
+    atomic_flag_clear(&node->lock);
+
+    for (integer_t i = 0; i < levels; i++)
+        atomic_init(&node->next[i], NULL);
+
+    return node;
+}
+
+// Each thread has its own xorshift generator so inserts don't contend on it
+static integer_t
+skl_random_level(void)
+{
+    static _Thread_local uint64_t state = 0;
+
+    if (state == 0)
+        state = ((uint64_t)(uintptr_t)&state ^ (uint64_t)time(NULL))
+                * UINT64_C(0x9e3779b97f4a7c15) | 1;
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    uint64_t bits = state * UINT64_C(0x2545f4914f6cdd1d);
+
+    integer_t levels = 1;
+
+    while (levels < SKL_MAX_LEVEL && (bits & 3) == 0)
+    {
+        levels++;
+        bits >>= 2;
+    }
+
+    return levels;
+}
+
+// Fills preds and succs with the nodes around the key at each level. Returns
+// the highest level where a node equal to the key was found or -1.
+static integer_t
+skl_find(SkipList_t *list, void *element, struct SkipListNode_s **preds,
+         struct SkipListNode_s **succs)
+{
+    integer_t found = -1;
+
+    struct SkipListNode_s *pred = list->head;
+
+    for (integer_t level = SKL_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        struct SkipListNode_s *curr =
+                atomic_load_explicit(&pred->next[level], memory_order_acquire);
+
+        int comparison = 1;
+
+        while (curr && (comparison = list->interface->compare(curr->key,
+                                                              element)) < 0)
+        {
+            pred = curr;
+            curr = atomic_load_explicit(&pred->next[level],
+                                        memory_order_acquire);
+        }
+
+        if (found == -1 && curr && comparison == 0)
+            found = level;
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return found;
+}
+
+static bool
+skl_valid(struct SkipListNode_s *node)
+{
+    return atomic_load(&node->linked) && !atomic_load(&node->marked);
+}
+
+// The next node at level 0 that is part of the set
+static struct SkipListNode_s *
+skl_next_valid(struct SkipListNode_s *node)
+{
+    do
+    {
+        node = atomic_load_explicit(&node->next[0], memory_order_acquire);
+    }
+    while (node && !skl_valid(node));
+
+    return node;
+}
+
+static void
+skl_lock(struct SkipListNode_s *node)
+{
+    while (atomic_flag_test_and_set_explicit(&node->lock,
+                                             memory_order_acquire))
+        sched_yield();
+}
+
+static void
+skl_unlock(struct SkipListNode_s *node)
+{
+    atomic_flag_clear_explicit(&node->lock, memory_order_release);
+}
+
+// The same predecessor can be in many consecutive levels but was locked once
+static void
+skl_unlock_preds(struct SkipListNode_s **preds, integer_t highest)
+{
+    for (integer_t level = 0; level <= highest; level++)
+    {
+        if (level == 0 || preds[level] != preds[level - 1])
+            skl_unlock(preds[level]);
+    }
+}
+
+static void
+skl_free_nodes(SkipList_t *list, bool deep)
+{
+    struct SkipListNode_s *node = list->head;
+
+    while (node)
+    {
+        struct SkipListNode_s *next =
+                atomic_load_explicit(&node->next[0], memory_order_relaxed);
+
+        if (deep && node != list->head)
+            list->interface->free(node->key);
+
+        free(node);
+
+        node = next;
+    }
+
+    node = atomic_load(&list->retired);
+
+    while (node)
+    {
+        struct SkipListNode_s *next = node->retired;
+
+        if (deep)
+            list->interface->free(node->key);
+
+        free(node);
+
+        node = next;
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -7,6 +7,11 @@
  */
 
 #include "SortedList.h"
+#include "Sort.h"
+
+/// Maximum amount of levels of the index of a list. With a 1/4 chance of going
+/// up a level this is enough for billions of elements.
+#define SLI_MAX_LEVEL 16
 
 /// \brief A generic sorted doubly-linked list.
 ///
@@ -42,6 +47,12 @@
 /// structure is changed. It works to prevent any undefined behaviour or
 /// run-time errors.
 ///
+/// A list can also keep an index over its nodes with sli_set_indexed(). The
+/// index adds skip list express lanes to some of the nodes, so sli_insert(),
+/// sli_get(), sli_remove(), sli_index_first(), sli_index_last() and
+/// sli_contains() take an expected O(log n) instead of O(n). The nodes and the
+/// iterator are not affected by it.
+///
 /// \b Functions \b List
 /// - sli_init()
 /// - sli_create()
@@ -54,9 +65,11 @@
 /// - sli_set_v_free()
 /// - sli_set_limit()
 /// - sli_set_order()
+/// - sli_set_indexed()
 /// - sli_length()
 /// - sli_limit()
 /// - sli_order()
+/// - sli_indexed()
 /// - sli_get()
 /// - sli_insert()
 /// - sli_insert_all()
@@ -138,6 +151,12 @@ struct SortedList_s
     /// A function that completely frees an element from memory.
     sli_free_f v_free;
 
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -145,6 +164,27 @@ struct SortedList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief If the list keeps an index over its nodes.
+    ///
+    /// False by default. See sli_set_indexed().
+    bool indexed;
+
+    /// \brief The first lane of the index.
+    ///
+    /// Points to a lane with every level and no node or \c NULL if the index
+    /// is not built.
+    struct SortedListLane_s *index;
+
+    /// \brief The version id of the list when the index was last updated.
+    ///
+    /// The index is only used while this matches \c version_id. Changes that
+    /// don't update the index, like sli_reverse() or removals done by an
+    /// iterator, leave it outdated and it is rebuilt in O(n) when needed.
+    integer_t index_version;
+
+    /// \brief State of the generator of lane heights.
+    uint64_t index_state;
 };
 
 /// \brief A SortedList_s node.
@@ -180,19 +220,80 @@ typedef struct SortedListNode_s SortedListNode_t;
 /// Defines a pointer type to a <code> struct SortedListNode_s </code>.
 typedef struct SortedListNode_s *SortedListNode;
 
+/// \brief A link between two lanes of the index of a SortedList_s.
+///
+/// Implementation detail. Points to the next lane at the same level and keeps
+/// how many positions of the list are skipped by following it.
+struct SortedListLink_s
+{
+    /// \brief Next lane at this level or \c NULL.
+    struct SortedListLane_s *next;
+
+    /// \brief Position of \c next minus the position of this lane.
+    ///
+    /// The list length is used as the position of a \c NULL lane.
+    integer_t span;
+};
+
+/// \brief An express lane of the index of a SortedList_s.
+///
+/// Implementation detail. Some nodes of an indexed list also have a lane with
+/// one or more levels, and each level links to the next lane that has that
+/// level, like in a skip list. The first lane of the index has every level, no
+/// node and sits at position -1.
+struct SortedListLane_s
+{
+    /// \brief The node of this lane or \c NULL for the first lane.
+    struct SortedListNode_s *node;
+
+    /// \brief Links at each level of this lane.
+    struct SortedListLink_s links[];
+};
+
+/// \brief A pointer type for a lane of the index of a sorted list.
+///
+/// Defines a pointer type to a <code> struct SortedListLane_s </code>.
+typedef struct SortedListLane_s *SortedListLane;
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status sli_make_node(SortedListNode *node, void *element);
+static Status sli_make_node(NodePool_t *pool, SortedListNode *node,
+        void *element);
 
-static Status sli_free_node(SortedListNode *node, sli_free_f free_f);
+static Status sli_free_node(NodePool_t *pool, SortedListNode *node,
+        sli_free_f free_f);
 
-static Status sli_free_node_shallow(SortedListNode *node);
+static Status sli_free_node_shallow(NodePool_t *pool, SortedListNode *node);
 
 static Status sli_get_node_at(SortedList list, SortedListNode *result,
         integer_t position);
 
 static Status sli_insert_tail(SortedList list, void *element);
 
+static bool sli_index_sync(SortedList list);
+
+static bool sli_index_rebuild(SortedList list);
+
+static void sli_index_free(SortedList list);
+
+static SortedListLane sli_index_new_lane(SortedListNode node, integer_t levels);
+
+static integer_t sli_index_levels(SortedList list);
+
+static bool sli_index_skip(SortedList list, void *element, void *key,
+        bool last);
+
+static SortedListNode sli_index_find(SortedList list, void *key, bool last,
+        integer_t *rank);
+
+static bool sli_index_insert(SortedList list, SortedListNode node);
+
+static SortedListNode sli_index_unlink(SortedList list, integer_t position);
+
+static SortedListNode sli_index_node_at(SortedList list, integer_t position);
+
+static void sli_splice(SortedList list, SortedListNode chain, integer_t count);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a SortedList_s structure.
@@ -227,6 +328,13 @@ Status sli_init(SortedList *list)
     (*list)->v_display = NULL;
     (*list)->v_free = NULL;
 
+    (*list)->pool = NULL;
+
+    (*list)->indexed = false;
+    (*list)->index = NULL;
+    (*list)->index_version = -1;
+    (*list)->index_state = 0;
+
     return DS_OK;
 }
 
@@ -266,6 +374,13 @@ Status sli_create(SortedList *list, SortOrder order, sli_compare_f compare_f,
     (*list)->v_display = display_f;
     (*list)->v_free = free_f;
 
+    (*list)->pool = NULL;
+
+    (*list)->indexed = false;
+    (*list)->index = NULL;
+    (*list)->index_version = -1;
+    (*list)->index_state = 0;
+
     return DS_OK;
 }
 
@@ -296,7 +411,7 @@ Status sli_free(SortedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = sli_free_node(&prev, (*list)->v_free);
+        st = sli_free_node((*list)->pool, &prev, (*list)->v_free);
 
         if (st != DS_OK)
             return st;
@@ -304,6 +419,8 @@ Status sli_free(SortedList *list)
         prev = (*list)->head;
     }
 
+    sli_index_free(*list);
+
     free(*list);
 
     (*list) = NULL;
@@ -334,7 +451,7 @@ Status sli_free_shallow(SortedList *list)
     {
         (*list)->head = (*list)->head->next;
 
-        st = sli_free_node_shallow(&prev);
+        st = sli_free_node_shallow((*list)->pool, &prev);
 
         if (st != DS_OK)
             return st;
@@ -342,6 +459,8 @@ Status sli_free_shallow(SortedList *list)
         prev = (*list)->head;
     }
 
+    sli_index_free(*list);
+
     free(*list);
 
     (*list) = NULL;
@@ -374,6 +493,9 @@ Status sli_erase(SortedList *list)
     if (st !=  DS_OK)
         return st;
 
+    new_list->pool = (*list)->pool;
+    new_list->indexed = (*list)->indexed;
+
     st = sli_free(list);
 
     // Probably didn't set the free function...
@@ -505,6 +627,36 @@ Status sli_set_limit(SortedList list, integer_t limit)
     return DS_OK;
 }
 
+/// \brief Sets a node pool for the specified SortedList_s.
+///
+/// Sets a node pool from where all nodes of the list are allocated. A pool can
+/// be shared between many containers as long as its nodes are big enough. To
+/// go back to using malloc() and free() simply set the pool to \c NULL. The
+/// pool can only be changed when the list is empty.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] pool The node pool or \c NULL.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if the pool's nodes are too small.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sli_set_pool(SortedList list, NodePool_t *pool)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!sli_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (pool && !npl_fits(pool, sizeof(SortedListNode_t)))
+        return DS_ERR_INVALID_ARGUMENT;
+
+    list->pool = pool;
+
+    return DS_OK;
+}
+
 /// \brief Sets the sorting order of elements of the specified SortedList_s.
 ///
 /// Sets the sorting order of elements to either \c ASCENDING or \c DESCENDING.
@@ -529,6 +681,32 @@ Status sli_set_order(SortedList list, SortOrder order)
     return DS_OK;
 }
 
+/// \brief Sets if the specified SortedList_s keeps an index over its nodes.
+///
+/// An indexed list keeps skip list express lanes over about one in four of its
+/// nodes, so inserting elements, searching for them and accessing them by
+/// position take an expected O(log n) instead of O(n). Turning the index off
+/// frees the lanes. Removing elements at the head or tail of the list becomes
+/// O(log n) as well, since their lanes have to be updated.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] indexed True to keep an index, false otherwise.
+///
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sli_set_indexed(SortedList list, bool indexed)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!indexed)
+        sli_index_free(list);
+
+    list->indexed = indexed;
+
+    return DS_OK;
+}
+
 /// \brief Returns the SortedList_s's length.
 ///
 /// Returns the list's current length or -1 if the list references to \c NULL.
@@ -578,6 +756,20 @@ SortOrder sli_order(SortedList list)
     return list->order;
 }
 
+/// \brief Returns true if the SortedList_s keeps an index over its nodes.
+///
+/// \param[in] list SortedList_s reference.
+///
+/// \return False if the list references to \c NULL or if it is not indexed.
+/// \return True if the list is indexed.
+bool sli_indexed(SortedList list)
+{
+    if (list == NULL)
+        return false;
+
+    return list->indexed;
+}
+
 /// \brief Returns a copy of an element at a given position.
 ///
 /// This function is zero-based and returns a copy of the element located at
@@ -628,7 +820,8 @@ Status sli_get(SortedList list, void **result, integer_t index)
 /// \brief Inserts an element to the specified SortedList_s.
 ///
 /// Inserts an element according to the sort order specified by the list. This
-/// function can take up to O(n) to add an element in its correct position.
+/// function can take up to O(n) to add an element in its correct position, or
+/// an expected O(log n) if the list is indexed.
 ///
 /// \param[in] list SortedList_s reference where the element is to be inserted.
 /// \param[in] element Element to be inserted in the list.
@@ -652,13 +845,20 @@ Status sli_insert(SortedList list, void *element)
 
     SortedListNode node;
 
-    Status st = sli_make_node(&node, element);
+    Status st = sli_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
 
+    bool indexed = false;
+
+    // Find the node's position through the index.
+    if (sli_index_sync(list))
+    {
+        indexed = sli_index_insert(list, node);
+    }
     // First node.
-    if (sli_empty(list))
+    else if (sli_empty(list))
     {
         list->head = node;
         list->tail = node;
@@ -763,18 +963,28 @@ Status sli_insert(SortedList list, void *element)
 
     list->version_id++;
 
+    if (indexed)
+        list->index_version = list->version_id;
+
     return DS_OK;
 }
 
 /// \brief Inserts an array of elements to the specified SortedList_s.
 ///
 /// Inserts an array of void pointers into the list, with a size of \c count.
+/// The batch is sorted with srt_sort() and then merged with the list in a
+/// single pass, so inserting \c m elements in a list of length \c n takes
+/// O(m log m + n) instead of O(m * n). Either all elements are inserted or
+/// none of them. The \c elements array itself is not changed.
 ///
 /// \param[in] list SortedList_s reference where all elements are to be
 /// inserted.
 /// \param[in] elements Elements to be inserted in the list.
 /// \param[in] count Amount of elements to be inserted.
 ///
+/// \return DS_ERR_ALLOC if node allocation failed.
+/// \return DS_ERR_FULL if \c limit is set and the elements would not fit.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
 /// \return DS_ERR_NEGATIVE_VALUE if count parameter is negative.
 /// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
 /// \return DS_OK if all operations are successful.
@@ -786,19 +996,63 @@ Status sli_insert_all(SortedList list, void **elements, integer_t count)
     if (count < 0)
         return DS_ERR_NEGATIVE_VALUE;
 
-    Status st;
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (list->limit > 0 && list->length + count > list->limit)
+        return DS_ERR_FULL;
+
+    if (count == 0)
+        return DS_OK;
+
+    // Sort a copy of the batch so the caller's array is left untouched
+    void **buffer = malloc(sizeof(void*) * (size_t)count);
+
+    if (!buffer)
+        return DS_ERR_ALLOC;
+
+    memcpy(buffer, elements, sizeof(void*) * (size_t)count);
+
+    srt_sort(buffer, count, (compare_f)list->v_compare);
+
+    // Chain the new nodes in the list's order
+    SortedListNode chain = NULL, node;
 
     for (integer_t i = 0; i < count; i++)
     {
-        st = sli_insert(list, elements[i]);
+        void *element = list->order == ASCENDING ? buffer[count - 1 - i]
+                                                 : buffer[i];
 
-        if (st != DS_OK)
-            return st;
+        if (sli_make_node(list->pool, &node, element) != DS_OK)
+        {
+            while (chain != NULL)
+            {
+                node = chain->next;
+
+                npl_node_free(list->pool, chain);
+
+                chain = node;
+            }
+
+            free(buffer);
+
+            return DS_ERR_ALLOC;
+        }
+
+        node->next = chain;
+
+        if (chain != NULL)
+            chain->prev = node;
+
+        chain = node;
     }
 
+    free(buffer);
+
+    sli_splice(list, chain, count);
+
     return DS_OK;
 }
-
 /// \brief Removes an element at a specified position from a SortedList_s.
 ///
 /// Removes an element at the specified position. The position is 0 based so
@@ -831,7 +1085,13 @@ Status sli_remove(SortedList list, void **result, integer_t position)
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    SortedListNode node;
+    SortedListNode node = NULL;
+
+    // The lanes of an indexed list are removed before the node is unlinked
+    bool indexed = sli_index_sync(list);
+
+    if (indexed)
+        node = sli_index_unlink(list, position);
 
     // Remove head
     if (position == 0)
@@ -860,10 +1120,13 @@ Status sli_remove(SortedList list, void **result, integer_t position)
     // Remove somewhere in the middle
     else
     {
-        Status st = sli_get_node_at(list, &node, position);
+        if (node == NULL)
+        {
+            Status st = sli_get_node_at(list, &node, position);
 
-        if (st != DS_OK)
-            return st;
+            if (st != DS_OK)
+                return st;
+        }
 
         // Unlink the current node
         // Behold the power of doubly-linked lists!
@@ -873,12 +1136,15 @@ Status sli_remove(SortedList list, void **result, integer_t position)
         *result = node->data;
     }
 
-    free(node);
+    npl_node_free(list->pool, node);
 
     list->length--;
 
     list->version_id++;
 
+    if (indexed)
+        list->index_version = list->version_id;
+
     if (sli_empty(list))
     {
         list->head = NULL;
@@ -912,6 +1178,12 @@ Status sli_remove_max(SortedList list, void **result)
 
     SortedListNode node;
 
+    // The lanes of an indexed list are removed before the node is unlinked
+    bool indexed = sli_index_sync(list);
+
+    if (indexed)
+        sli_index_unlink(list, list->order == ASCENDING ? list->length - 1 : 0);
+
     // Remove from tail.
     if (list->order == ASCENDING)
     {
@@ -924,7 +1196,7 @@ Status sli_remove_max(SortedList list, void **result)
         if (list->tail != NULL)
             list->tail->next = NULL;
 
-        free(node);
+        npl_node_free(list->pool, node);
     }
     // Remove from head.
     else
@@ -938,7 +1210,7 @@ Status sli_remove_max(SortedList list, void **result)
         if (list->head != NULL)
             list->head->prev = NULL;
 
-        free(node);
+        npl_node_free(list->pool, node);
     }
 
     list->length--;
@@ -951,6 +1223,9 @@ Status sli_remove_max(SortedList list, void **result)
 
     list->version_id++;
 
+    if (indexed)
+        list->index_version = list->version_id;
+
     return DS_OK;
 }
 
@@ -978,6 +1253,12 @@ Status sli_remove_min(SortedList list, void **result)
 
     SortedListNode node;
 
+    // The lanes of an indexed list are removed before the node is unlinked
+    bool indexed = sli_index_sync(list);
+
+    if (indexed)
+        sli_index_unlink(list, list->order == ASCENDING ? 0 : list->length - 1);
+
     // Remove from head.
     if (list->order == ASCENDING)
     {
@@ -990,7 +1271,7 @@ Status sli_remove_min(SortedList list, void **result)
         if (list->head != NULL)
             list->head->prev = NULL;
 
-        free(node);
+        npl_node_free(list->pool, node);
     }
     // Remove from tail.
     else
@@ -1004,7 +1285,7 @@ Status sli_remove_min(SortedList list, void **result)
         if (list->tail != NULL)
             list->tail->next = NULL;
 
-        free(node);
+        npl_node_free(list->pool, node);
     }
 
     list->length--;
@@ -1017,6 +1298,9 @@ Status sli_remove_min(SortedList list, void **result)
 
     list->version_id++;
 
+    if (indexed)
+        list->index_version = list->version_id;
+
     return DS_OK;
 }
 
@@ -1128,9 +1412,21 @@ integer_t sli_index_first(SortedList list, void *key)
     if (list->v_compare == NULL)
         return -3;
 
+    integer_t index;
+
+    if (sli_index_sync(list))
+    {
+        SortedListNode node = sli_index_find(list, key, false, &index);
+
+        if (node != NULL && list->v_compare(node->data, key) == 0)
+            return index;
+
+        return -1;
+    }
+
     SortedListNode scan = list->head;
 
-    integer_t index = 0;
+    index = 0;
 
     while (scan != NULL)
     {
@@ -1166,9 +1462,24 @@ integer_t sli_index_last(SortedList list, void *key)
     if (list->v_compare == NULL)
         return -3;
 
+    integer_t index;
+
+    if (sli_index_sync(list))
+    {
+        // The node before the first one that goes after the key
+        SortedListNode node = sli_index_find(list, key, true, &index);
+
+        node = node == NULL ? list->tail : node->prev;
+
+        if (node != NULL && list->v_compare(node->data, key) == 0)
+            return index - 1;
+
+        return -1;
+    }
+
     SortedListNode scan = list->tail;
 
-    integer_t index = 0;
+    index = 0;
 
     while (scan != NULL)
     {
@@ -1197,6 +1508,15 @@ integer_t sli_index_last(SortedList list, void *key)
 /// \return False if the element is not present in the list.
 bool sli_contains(SortedList list, void *key)
 {
+    if (sli_index_sync(list))
+    {
+        integer_t index;
+
+        SortedListNode node = sli_index_find(list, key, false, &index);
+
+        return node != NULL && list->v_compare(node->data, key) == 0;
+    }
+
     SortedListNode scan = list->head;
 
     while (scan != NULL)
@@ -1288,6 +1608,9 @@ Status sli_copy(SortedList list, SortedList *result)
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+    (*result)->indexed = list->indexed;
+
     (*result)->limit = list->limit;
 
     SortedListNode scan = list->head;
@@ -1363,38 +1686,87 @@ Status sli_to_array(SortedList list, void ***result, integer_t *length)
 
 /// \brief Merge two SortedList_s.
 ///
-/// Removes all elements from list2 and inserts them into list1.
+/// Removes all elements from list2 and inserts them into list1. If both lists
+/// share the same node pool the nodes of list2 are spliced into list1 in a
+/// single pass, in O(n + m). Otherwise each element is moved on its own.
 ///
 /// \param[in] list1 SortedList_s where elements are added to.
 /// \param[in] list2 SortedList_s where elements are removed from.
 ///
+/// \return DS_ERR_FULL if \c limit is set in list1 and the elements of list2
+/// would not fit.
+/// \return DS_ERR_INCOMPLETE_TYPE if list1 has no default compare function.
 /// \return DS_ERR_NULL_POINTER if either list1 or list2 references are
 /// \c NULL.
+/// \return DS_OK if all operations are successful.
 Status sli_merge(SortedList list1, SortedList list2)
 {
     if (list1 == NULL || list2 == NULL)
         return DS_ERR_NULL_POINTER;
 
+    if (list1->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (sli_empty(list2))
+        return DS_OK;
+
+    if (list1->limit > 0 && list1->length + list2->length > list1->limit)
+        return DS_ERR_FULL;
+
     Status st;
 
     void *result;
 
-    while (!sli_empty(list2))
+    // Nodes can only move between lists that share the same node pool
+    if (list1->pool != list2->pool)
     {
-        st = sli_remove(list2, &result, 0);
+        while (!sli_empty(list2))
+        {
+            st = sli_remove(list2, &result, 0);
 
-        if (st != DS_OK)
-            return st;
+            if (st != DS_OK)
+                return st;
 
-        st = sli_insert(list1, result);
+            st = sli_insert(list1, result);
 
-        if (st != DS_OK)
-            return st;
+            if (st != DS_OK)
+                return st;
+        }
+
+        return DS_OK;
+    }
+
+    SortedListNode chain = list2->head;
+
+    // The chain has to follow the order of list1
+    if (list2->order != list1->order)
+    {
+        SortedListNode scan = chain, next;
+
+        while (scan != NULL)
+        {
+            next = scan->next;
+
+            scan->next = scan->prev;
+            scan->prev = next;
+
+            chain = scan;
+            scan = next;
+        }
     }
 
+    integer_t count = list2->length;
+
+    list2->head = NULL;
+    list2->tail = NULL;
+    list2->length = 0;
+
+    list2->version_id++;
+
+    sli_splice(list1, chain, count);
+
     return DS_OK;
 }
-
 /// \brief Unlinks elements from the specified SortedList_s.
 ///
 /// Unlinks all elements starting from \c position all the way to the end of
@@ -1432,6 +1804,9 @@ Status sli_unlink(SortedList list, SortedList *result, integer_t position)
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+    (*result)->indexed = list->indexed;
+
     (*result)->limit = list->limit;
 
     SortedListNode node, new_tail;
@@ -1526,6 +1901,9 @@ Status sli_sublist(SortedList list, SortedList *result, integer_t start,
     if (st != DS_OK)
         return st;
 
+    (*result)->pool = list->pool;
+    (*result)->indexed = list->indexed;
+
     (*result)->limit = list->limit;
 
     SortedListNode node;
@@ -1766,14 +2144,16 @@ Status sli_display_raw(SortedList list)
 /// Implementation detail. Function responsible for allocating a new
 /// SortedListNode_s.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SortedListNode_s to be allocated.
 /// \param[in] element Node's data member.
 ///
 /// \return DS_ERR_ALLOC if node allocation failed.
 /// \return DS_OK if all operations are successful.
-static Status sli_make_node(SortedListNode *node, void *element)
+static Status sli_make_node(NodePool_t *pool, SortedListNode *node,
+        void *element)
 {
-    *node = malloc(sizeof(SortedListNode_t));
+    *node = npl_node_alloc(pool, sizeof(SortedListNode_t));
 
     if (!(*node))
         return DS_ERR_ALLOC;
@@ -1791,19 +2171,21 @@ static Status sli_make_node(SortedListNode *node, void *element)
 /// Implementation detail. Frees a SortedListNode_s and its data using the
 /// list's default free function.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SortedListNode_s to be freed from memory.
 /// \param[in] free_f List's default free function.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status sli_free_node(SortedListNode *node, sli_free_f free_f)
+static Status sli_free_node(NodePool_t *pool, SortedListNode *node,
+        sli_free_f free_f)
 {
     if (*node == NULL)
         return DS_ERR_NULL_POINTER;
 
     free_f((*node)->data);
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     *node = NULL;
 
@@ -1815,16 +2197,17 @@ static Status sli_free_node(SortedListNode *node, sli_free_f free_f)
 /// Implementation detail. Frees a SortedListNode_s and leaves its data
 /// untouched.
 ///
+/// \param[in] pool List's node pool or \c NULL.
 /// \param[in,out] node SortedListNode_s to be freed from memory.
 ///
 /// \return DS_ERR_NULL_POINTER if node references to \c NULL.
 /// \return DS_OK if all operations are successful.
-static Status sli_free_node_shallow(SortedListNode *node)
+static Status sli_free_node_shallow(NodePool_t *pool, SortedListNode *node)
 {
     if (*node == NULL)
         return DS_ERR_NULL_POINTER;
 
-    free(*node);
+    npl_node_free(pool, *node);
 
     *node = NULL;
 
@@ -1835,7 +2218,8 @@ static Status sli_free_node_shallow(SortedListNode *node)
 ///
 /// Implementation detail. Searches for a node in O(n / 2), the search starts
 /// at the tail pointer if position is greater than half the list's length,
-/// otherwise it starts at the head pointer.
+/// otherwise it starts at the head pointer. If the list is indexed the search
+/// goes through its lanes instead and takes an expected O(log n).
 ///
 /// \param[in] list SortedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1869,6 +2253,13 @@ static Status sli_get_node_at(SortedList list, SortedListNode *result,
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
+    if (sli_index_sync(list))
+    {
+        (*result) = sli_index_node_at(list, position);
+
+        return DS_OK;
+    }
+
     // Start looking for the node at the start of the list
     if (position <= list->length / 2)
     {
@@ -1921,7 +2312,7 @@ static Status sli_insert_tail(SortedList list, void *element)
 
     SortedListNode node;
 
-    Status st = sli_make_node(&node, element);
+    Status st = sli_make_node(list->pool, &node, element);
 
     if (st != DS_OK)
         return st;
@@ -1942,9 +2333,516 @@ static Status sli_insert_tail(SortedList list, void *element)
 
     (list->length)++;
 
+    list->version_id++;
+
     return DS_OK;
 }
 
+/// \brief Makes sure the index of a SortedList_s is up to date.
+///
+/// Implementation detail. Rebuilds the index if the list was changed by an
+/// operation that does not update it.
+///
+/// \param[in] list SortedList_s reference.
+///
+/// \return False if the list is not indexed or if the index could not be
+/// rebuilt, in which case the list has to be searched without it.
+/// \return True if the index can be used.
+static bool sli_index_sync(SortedList list)
+{
+    if (!list->indexed)
+        return false;
+
+    if (list->index != NULL && list->index_version == list->version_id)
+        return true;
+
+    return sli_index_rebuild(list);
+}
+
+/// \brief Builds the index of a SortedList_s from scratch.
+///
+/// Implementation detail. Gives each node a new random height and links the
+/// nodes that got a lane in a single pass, in O(n).
+///
+/// \param[in] list SortedList_s reference.
+///
+/// \return False if a lane could not be allocated.
+/// \return True if the index was built.
+static bool sli_index_rebuild(SortedList list)
+{
+    sli_index_free(list);
+
+    list->index = sli_index_new_lane(NULL, SLI_MAX_LEVEL);
+
+    if (!list->index)
+        return false;
+
+    // Last lane at each level and its position
+    SortedListLane last[SLI_MAX_LEVEL];
+    integer_t ranks[SLI_MAX_LEVEL];
+
+    for (integer_t i = 0; i < SLI_MAX_LEVEL; i++)
+    {
+        last[i] = list->index;
+        ranks[i] = -1;
+    }
+
+    bool built = true;
+
+    SortedListNode scan = list->head;
+
+    for (integer_t rank = 0; scan != NULL; rank++, scan = scan->next)
+    {
+        integer_t levels = sli_index_levels(list);
+
+        if (levels == 0)
+            continue;
+
+        SortedListLane lane = sli_index_new_lane(scan, levels);
+
+        if (!lane)
+        {
+            built = false;
+            break;
+        }
+
+        for (integer_t i = 0; i < levels; i++)
+        {
+            last[i]->links[i].next = lane;
+            last[i]->links[i].span = rank - ranks[i];
+
+            last[i] = lane;
+            ranks[i] = rank;
+        }
+    }
+
+    for (integer_t i = 0; i < SLI_MAX_LEVEL; i++)
+    {
+        last[i]->links[i].next = NULL;
+        last[i]->links[i].span = list->length - ranks[i];
+    }
+
+    if (!built)
+    {
+        sli_index_free(list);
+
+        return false;
+    }
+
+    list->index_version = list->version_id;
+
+    return true;
+}
+
+/// \brief Frees the index of a SortedList_s.
+///
+/// Implementation detail. Every lane is linked at the first level, so they
+/// are all freed by following it.
+///
+/// \param[in] list SortedList_s reference.
+static void sli_index_free(SortedList list)
+{
+    SortedListLane lane = list->index;
+
+    while (lane != NULL)
+    {
+        SortedListLane next = lane->links[0].next;
+
+        free(lane);
+
+        lane = next;
+    }
+
+    list->index = NULL;
+}
+
+/// \brief Allocates a new lane.
+///
+/// Implementation detail. All of its links start unlinked.
+///
+/// \param[in] node The node of the lane or \c NULL.
+/// \param[in] levels Amount of levels of the lane.
+///
+/// \return NULL if allocation failed.
+/// \return A new lane.
+static SortedListLane sli_index_new_lane(SortedListNode node, integer_t levels)
+{
+    SortedListLane lane = malloc(sizeof(struct SortedListLane_s)
+                                 + sizeof(struct SortedListLink_s)
+                                   * (size_t)levels);
+
+    if (!lane)
+        return NULL;
+
+    lane->node = node;
+
+    for (integer_t i = 0; i < levels; i++)
+    {
+        lane->links[i].next = NULL;
+        lane->links[i].span = 0;
+    }
+
+    return lane;
+}
+
+/// \brief Returns a random height for a new lane.
+///
+/// Implementation detail. Uses a xorshift generator kept by the list. Each
+/// level has a 1/4 chance of being added, so three in four nodes get no lane.
+///
+/// \param[in] list SortedList_s reference.
+///
+/// \return The amount of levels of the new lane, possibly 0.
+static integer_t sli_index_levels(SortedList list)
+{
+    if (list->index_state == 0)
+        list->index_state = ((uint64_t)(uintptr_t)list ^ (uint64_t)time(NULL))
+                            * UINT64_C(0x9e3779b97f4a7c15) | 1;
+
+    list->index_state ^= list->index_state >> 12;
+    list->index_state ^= list->index_state << 25;
+    list->index_state ^= list->index_state >> 27;
+
+    uint64_t bits = list->index_state * UINT64_C(0x2545f4914f6cdd1d);
+
+    integer_t levels = 0;
+
+    while (levels < SLI_MAX_LEVEL && (bits & 3) == 0)
+    {
+        levels++;
+        bits >>= 2;
+    }
+
+    return levels;
+}
+
+/// \brief Checks if a search for a key continues past an element.
+///
+/// Implementation detail. Follows the list's sort order.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] element An element of the list.
+/// \param[in] key Key being searched.
+/// \param[in] last If the search is for the last position of the key.
+///
+/// \return True if the element goes before the key or, when \c last is set,
+/// if it does not go after it.
+static bool sli_index_skip(SortedList list, void *element, void *key,
+        bool last)
+{
+    int comparison = last ? list->v_compare(key, element)
+                          : list->v_compare(element, key);
+
+    if (list->order == ASCENDING)
+        return last ? comparison >= 0 : comparison < 0;
+
+    return last ? comparison <= 0 : comparison > 0;
+}
+
+/// \brief Searches for the position of a key through the index.
+///
+/// Implementation detail. Goes down the levels of the index starting at the
+/// highest one and finishes the search along the nodes, in an expected
+/// O(log n).
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] key Key to be searched.
+/// \param[in] last False to find the first node that does not go before the
+/// key, true to find the first node that goes after it.
+/// \param[out] rank The position of the resulting node, or the list length if
+/// there is no such node.
+///
+/// \return The node found or \c NULL.
+static SortedListNode sli_index_find(SortedList list, void *key, bool last,
+        integer_t *rank)
+{
+    SortedListLane lane = list->index, next;
+
+    integer_t position = -1;
+
+    for (integer_t i = SLI_MAX_LEVEL - 1; i >= 0; i--)
+    {
+        while ((next = lane->links[i].next) != NULL &&
+               sli_index_skip(list, next->node->data, key, last))
+        {
+            position += lane->links[i].span;
+
+            lane = next;
+        }
+    }
+
+    SortedListNode scan = lane->node ? lane->node->next : list->head;
+
+    position++;
+
+    while (scan != NULL && sli_index_skip(list, scan->data, key, last))
+    {
+        scan = scan->next;
+
+        position++;
+    }
+
+    *rank = position;
+
+    return scan;
+}
+
+/// \brief Inserts a node in its position through the index.
+///
+/// Implementation detail. Links the node in the list and gives it a lane with
+/// a random height. New equal elements go before the old ones, like in an
+/// unindexed list. The list length is not changed.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] node Node to be inserted.
+///
+/// \return False if the node's lane could not be allocated. The node is still
+/// inserted but the index is outdated.
+/// \return True if the index was updated.
+static bool sli_index_insert(SortedList list, SortedListNode node)
+{
+    SortedListLane preds[SLI_MAX_LEVEL], lane = list->index, next;
+
+    integer_t ranks[SLI_MAX_LEVEL], position = -1;
+
+    // Same as sli_index_find() but keeps the last lane at each level
+    for (integer_t i = SLI_MAX_LEVEL - 1; i >= 0; i--)
+    {
+        while ((next = lane->links[i].next) != NULL &&
+               sli_index_skip(list, next->node->data, node->data, false))
+        {
+            position += lane->links[i].span;
+
+            lane = next;
+        }
+
+        preds[i] = lane;
+        ranks[i] = position;
+    }
+
+    SortedListNode scan = lane->node ? lane->node->next : list->head;
+
+    position++;
+
+    while (scan != NULL && sli_index_skip(list, scan->data, node->data, false))
+    {
+        scan = scan->next;
+
+        position++;
+    }
+
+    // Link the node before scan
+    if (scan == NULL)
+    {
+        node->prev = list->tail;
+
+        if (list->tail != NULL)
+            list->tail->next = node;
+        else
+            list->head = node;
+
+        list->tail = node;
+    }
+    else
+    {
+        node->next = scan;
+        node->prev = scan->prev;
+
+        if (scan->prev != NULL)
+            scan->prev->next = node;
+        else
+            list->head = node;
+
+        scan->prev = node;
+    }
+
+    integer_t levels = sli_index_levels(list);
+
+    lane = NULL;
+
+    if (levels > 0)
+    {
+        lane = sli_index_new_lane(node, levels);
+
+        if (!lane)
+            return false;
+    }
+
+    for (integer_t i = 0; i < SLI_MAX_LEVEL; i++)
+    {
+        struct SortedListLink_s *link = &preds[i]->links[i];
+
+        if (i < levels)
+        {
+            lane->links[i].next = link->next;
+            lane->links[i].span = ranks[i] + link->span + 1 - position;
+
+            link->next = lane;
+            link->span = position - ranks[i];
+        }
+        else
+        {
+            link->span++;
+        }
+    }
+
+    return true;
+}
+
+/// \brief Removes the lane of the node at a given position.
+///
+/// Implementation detail. Updates the links that go over the position and
+/// frees the node's lane if it has one. The node itself stays in the list.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] position A valid position of the list.
+///
+/// \return The node at the given position.
+static SortedListNode sli_index_unlink(SortedList list, integer_t position)
+{
+    SortedListLane lane = list->index, victim = NULL;
+
+    integer_t rank = -1;
+
+    for (integer_t i = SLI_MAX_LEVEL - 1; i >= 0; i--)
+    {
+        struct SortedListLink_s *link = &lane->links[i];
+
+        while (link->next != NULL && rank + link->span < position)
+        {
+            rank += link->span;
+
+            lane = link->next;
+            link = &lane->links[i];
+        }
+
+        if (link->next != NULL && rank + link->span == position)
+        {
+            victim = link->next;
+
+            link->next = victim->links[i].next;
+            link->span += victim->links[i].span - 1;
+        }
+        else
+        {
+            link->span--;
+        }
+    }
+
+    if (victim != NULL)
+    {
+        SortedListNode node = victim->node;
+
+        free(victim);
+
+        return node;
+    }
+
+    SortedListNode node = lane->node ? lane->node->next : list->head;
+
+    for (rank++; rank < position; rank++)
+        node = node->next;
+
+    return node;
+}
+
+/// \brief Returns the node at a given position through the index.
+///
+/// Implementation detail. Takes an expected O(log n).
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] position A valid position of the list.
+///
+/// \return The node at the given position.
+static SortedListNode sli_index_node_at(SortedList list, integer_t position)
+{
+    SortedListLane lane = list->index;
+
+    integer_t rank = -1;
+
+    for (integer_t i = SLI_MAX_LEVEL - 1; i >= 0; i--)
+    {
+        while (lane->links[i].next != NULL &&
+               rank + lane->links[i].span <= position)
+        {
+            rank += lane->links[i].span;
+
+            lane = lane->links[i].next;
+        }
+    }
+
+    SortedListNode node = lane->node;
+
+    if (node == NULL)
+    {
+        node = list->head;
+
+        rank = 0;
+    }
+
+    for (; rank < position; rank++)
+        node = node->next;
+
+    return node;
+}
+
+/// \brief Merges a chain of nodes into a SortedList_s.
+///
+/// Implementation detail. The chain must be sorted in the list's order and is
+/// merged with the list in a single pass, in O(n + m). Elements of the chain
+/// go before equal elements already in the list. The index, if any, is left
+/// outdated.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] chain First node of a \c NULL terminated chain.
+/// \param[in] count Amount of nodes in the chain.
+static void sli_splice(SortedList list, SortedListNode chain,
+        integer_t count)
+{
+    SortedListNode scan = list->head, next;
+
+    while (chain != NULL)
+    {
+        next = chain->next;
+
+        while (scan != NULL && sli_index_skip(list, scan->data, chain->data,
+                                              false))
+            scan = scan->next;
+
+        // Link the node before scan
+        if (scan == NULL)
+        {
+            chain->next = NULL;
+            chain->prev = list->tail;
+
+            if (list->tail != NULL)
+                list->tail->next = chain;
+            else
+                list->head = chain;
+
+            list->tail = chain;
+        }
+        else
+        {
+            chain->next = scan;
+            chain->prev = scan->prev;
+
+            if (scan->prev != NULL)
+                scan->prev->next = chain;
+            else
+                list->head = chain;
+
+            scan->prev = chain;
+        }
+
+        chain = next;
+    }
+
+    list->length += count;
+
+    list->version_id++;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2338,7 +3236,7 @@ Status sli_iter_remove_next(SortedListIterator iter, void **result)
         node->next->prev = iter->cursor;
     }
 
-    free(node);
+    npl_node_free(iter->target->pool, node);
 
     iter->target->length--;
 
@@ -2419,7 +3317,7 @@ Status sli_iter_remove_curr(SortedListIterator iter, void **result)
         // WHOA...
     }
 
-    free(node);
+    npl_node_free(iter->target->pool, node);
 
     iter->target->length--;
 
@@ -2478,7 +3376,7 @@ Status sli_iter_remove_prev(SortedListIterator iter, void **result)
         node->prev->next = iter->cursor;
     }
 
-    free(node);
+    npl_node_free(iter->target->pool, node);
 
     iter->target->length--;
 
@@ -49,18 +49,33 @@ struct StackArray_s
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
 
+    /// \brief How the new capacity is calculated, see GrowthPolicy_e.
+    GrowthPolicy policy;
+
+    /// \brief Amount of elements added by DS_GROWTH_STEP.
+    integer_t step;
+
     /// \brief Flag for locked capacity.
     ///
     /// If \c locked is set to true the buffer will not grow and insertions
     /// won't be successful once the buffer gets filled up.
     bool locked;
 
+    /// \brief Flag for shrinking the buffer when it is mostly empty.
+    bool shrink;
+
+    /// \brief The buffer is never shrunk below this capacity.
+    ///
+    /// The initial capacity of the stack.
+    integer_t minimum;
+
     /// \brief StackArray_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -68,6 +83,7 @@ struct StackArray_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
@@ -79,6 +95,9 @@ const unsigned_t sta_size = sizeof(StackArray_t);
 bool
 static sta_grow(StackArray_t *stack, integer_t required_size);
 
+static void
+sta_shrink(StackArray_t *stack);
+
 integer_t
 sta_calculate_growth(integer_t required, integer_t current,
                      integer_t multiplier);
@@ -102,7 +121,7 @@ sta_new(Interface_t *interface)
     if (!stack)
         return NULL;
 
-    stack->buffer = malloc(sizeof(void*) * 32);
+    stack->buffer = ds_buffer_alloc(sizeof(void*) * 32);
 
     if (!(stack->buffer))
     {
@@ -115,10 +134,14 @@ sta_new(Interface_t *interface)
         stack->buffer[i] = NULL;
 
     stack->capacity = 32;
+    stack->minimum = 32;
     stack->growth_rate = 200;
-    stack->version_id = 0;
+    DS_VERSION_RESET(stack);
     stack->count = 0;
     stack->locked = false;
+    stack->shrink = false;
+    stack->policy = DS_GROWTH_GEOMETRIC;
+    stack->step = 0;
 
     stack->interface = interface;
 
@@ -144,7 +167,8 @@ sta_init(StackArray_t *stack, Interface_t *interface,
     if (growth_rate <= 100 || initial_capacity <= 0)
         return false;
 
-    stack->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    stack->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!(stack->buffer))
         return false;
@@ -153,10 +177,14 @@ sta_init(StackArray_t *stack, Interface_t *interface,
         stack->buffer[i] = NULL;
 
     stack->capacity = initial_capacity;
+    stack->minimum = initial_capacity;
     stack->growth_rate = growth_rate;
-    stack->version_id = 0;
+    DS_VERSION_RESET(stack);
     stack->count = 0;
     stack->locked = false;
+    stack->shrink = false;
+    stack->policy = DS_GROWTH_GEOMETRIC;
+    stack->step = 0;
 
     stack->interface = interface;
 
@@ -192,7 +220,8 @@ sta_create(Interface_t *interface, integer_t initial_capacity,
     if (!stack)
         return NULL;
 
-    stack->buffer = malloc(sizeof(void*) * (size_t)initial_capacity);
+    stack->buffer = ds_buffer_alloc(sizeof(void*) *
+                                   (size_t)initial_capacity);
 
     if (!(stack->buffer))
     {
@@ -205,10 +234,14 @@ sta_create(Interface_t *interface, integer_t initial_capacity,
         stack->buffer[i] = NULL;
 
     stack->capacity = initial_capacity;
+    stack->minimum = initial_capacity;
     stack->growth_rate = growth_rate;
-    stack->version_id = 0;
+    DS_VERSION_RESET(stack);
     stack->count = 0;
     stack->locked = false;
+    stack->shrink = false;
+    stack->policy = DS_GROWTH_GEOMETRIC;
+    stack->step = 0;
 
     stack->interface = interface;
 
@@ -225,7 +258,7 @@ void
 sta_free(StackArray_t *stack)
 {
     for (integer_t i = 0; i < stack->count; i++)
-        stack->interface->free(stack->buffer[i]);
+        interface_release(stack->interface, stack->buffer[i]);
 
     free(stack->buffer);
 
@@ -259,12 +292,12 @@ sta_erase(StackArray_t *stack)
 {
     for (integer_t i = 0; i < stack->count; i++)
     {
-        stack->interface->free(stack->buffer[i]);
+        interface_release(stack->interface, stack->buffer[i]);
 
         stack->buffer[i] = NULL;
     }
 
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
     stack->count = 0;
 }
 
@@ -282,7 +315,7 @@ sta_erase_shallow(StackArray_t *stack)
         stack->buffer[i] = NULL;
     }
 
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
     stack->count = 0;
 }
 
@@ -337,6 +370,19 @@ sta_growth(StackArray_t *stack)
     return stack->growth_rate;
 }
 
+/// Returns how the buffer grows.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+///
+/// \return The buffer's growth policy.
+GrowthPolicy
+sta_policy(StackArray_t *stack)
+{
+    return stack->policy;
+}
+
 /// Returns the boolean state of \c locked member.
 /// \par Interface Requirements
 /// - None
@@ -394,6 +440,45 @@ sta_capacity_unlock(StackArray_t *stack)
     stack->locked = false;
 }
 
+/// Sets how the buffer grows. The buffer is grown with realloc(), so a big
+/// buffer can often be extended in place; DS_GROWTH_PAGES makes that more
+/// likely for buffers mapped directly by the allocator.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+/// \param[in] policy The new growth policy.
+/// \param[in] step Amount of elements added on each growth by
+/// DS_GROWTH_STEP. Ignored by the other policies.
+///
+/// \return True if the policy was changed or false if the step is less than
+/// 1 for DS_GROWTH_STEP.
+bool
+sta_set_policy(StackArray_t *stack, GrowthPolicy policy, integer_t step)
+{
+    if (policy == DS_GROWTH_STEP && step < 1)
+        return false;
+
+    stack->policy = policy;
+    stack->step = step;
+
+    return true;
+}
+
+/// Makes the stack shrink its buffer to half of its capacity whenever it is a
+/// quarter full after a pop, but never below its initial capacity. Buffers
+/// are not shrunk while the capacity is locked.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+/// \param[in] shrink True to shrink the buffer automatically.
+void
+sta_set_shrink(StackArray_t *stack, bool shrink)
+{
+    stack->shrink = shrink;
+}
+
 /// Inserts an element at the top of the specified stack.
 /// \par Interface Requirements
 /// - None
@@ -415,7 +500,7 @@ sta_push(StackArray_t *stack, void *element)
     stack->buffer[stack->count] = element;
 
     stack->count++;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
 
     return true;
 }
@@ -442,11 +527,77 @@ sta_pop(StackArray_t *stack, void **result)
     stack->buffer[stack->count - 1] = NULL;
 
     stack->count--;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
+
+    sta_shrink(stack);
+
+    return true;
+}
+
+/// Inserts a buffer of elements at the top of the specified stack with a
+/// single capacity check and memcpy(). The last element of the buffer ends up
+/// at the top. Either every element is inserted or none of them.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The stack where the elements are to be inserted.
+/// \param[in] elements The elements to be inserted onto the stack.
+/// \param[in] size The amount of elements in the buffer.
+///
+/// \return True if every element was added to the stack or false if the
+/// buffer reallocation failed or the stack buffer capacity is locked.
+bool
+sta_push_n(StackArray_t *stack, void **elements, integer_t size)
+{
+    if (size <= 0)
+        return size == 0;
+
+    if (!sta_fits(stack, size))
+    {
+        if (!sta_grow(stack, stack->count + size))
+            return false;
+    }
+
+    memcpy(stack->buffer + stack->count, elements,
+           sizeof(void*) * (size_t)size);
+
+    stack->count += size;
+    DS_VERSION_BUMP(stack);
 
     return true;
 }
 
+/// Removes up to \c max elements from the top of the specified stack with a
+/// single memcpy(). The elements keep the order they had in the stack, so the
+/// old top is the last one in \c result and giving that buffer to
+/// sta_push_n() restores the stack.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The stack where the elements are to be removed from.
+/// \param[out] result A buffer with room for at least \c max elements.
+/// \param[in] max The maximum amount of elements to be removed.
+///
+/// \return The amount of elements removed.
+integer_t
+sta_pop_n(StackArray_t *stack, void **result, integer_t max)
+{
+    integer_t size = stack->count < max ? stack->count : max;
+
+    if (size <= 0)
+        return 0;
+
+    stack->count -= size;
+    DS_VERSION_BUMP(stack);
+
+    memcpy(result, stack->buffer + stack->count,
+           sizeof(void*) * (size_t)size);
+
+    sta_shrink(stack);
+
+    return size;
+}
+
 /// Returns the element at the top of the stack or NULL if the stack is empty.
 /// \par Interface Requirements
 /// - None
@@ -548,11 +699,16 @@ sta_copy(StackArray_t *stack)
 
     for (integer_t i = 0; i < stack->count; i++)
     {
-        new_stack->buffer[i] = stack->interface->copy(stack->buffer[i]);
+        new_stack->buffer[i] =
+                interface_copy(stack->interface, stack->buffer[i]);
     }
 
     new_stack->count = stack->count;
     new_stack->locked = stack->locked;
+    new_stack->policy = stack->policy;
+    new_stack->step = stack->step;
+    new_stack->shrink = stack->shrink;
+    new_stack->minimum = stack->minimum;
 
     return new_stack;
 }
@@ -582,6 +738,10 @@ sta_copy_shallow(StackArray_t *stack)
     new_stack->count = stack->count;
 
     new_stack->locked = stack->locked;
+    new_stack->policy = stack->policy;
+    new_stack->step = stack->step;
+    new_stack->shrink = stack->shrink;
+    new_stack->minimum = stack->minimum;
 
     return new_stack;
 }
@@ -641,22 +801,11 @@ sta_stack(StackArray_t *stack1, StackArray_t *stack2)
     if (sta_empty(stack2))
         return true;
 
-    if (!sta_fits(stack1, stack2->count))
-    {
-        if (!sta_grow(stack1, stack2->count))
-            return false;
-    }
-
-    for (integer_t i = stack1->count, j = 0; j < stack2->count; i++, j++)
-    {
-        stack1->buffer[i] = stack2->buffer[j];
-    }
-
-    for (integer_t i = 0; i < stack2->count; i++)
-        stack2->buffer[i] = NULL;
+    if (!sta_push_n(stack1, stack2->buffer, stack2->count))
+        return false;
 
-    stack1->count += stack2->count;
     stack2->count = 0;
+    DS_VERSION_BUMP(stack2);
 
     return true;
 }
@@ -685,13 +834,69 @@ sta_to_array(StackArray_t *stack, integer_t *length)
         return NULL;
 
     for (integer_t i = stack->count - 1; i > 0; i--)
-        array[i] = stack->interface->copy(stack->buffer[i]);
+        array[i] = interface_copy(stack->interface, stack->buffer[i]);
 
     *length = stack->count;
 
     return array;
 }
 
+/// Moves all the elements of the stack to a C array, leaving the stack empty.
+/// Unlike sta_to_array() the elements are not copied, so they now belong to
+/// the caller. The top element is the last one in the array, so giving it to
+/// sta_push_n() restores the stack.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The stack to be emptied.
+/// \param[out] length The resulting array's length.
+///
+/// \return The resulting array or NULL if the stack is empty or the array
+/// allocation failed, in which case the stack is left intact.
+void **
+sta_to_array_move(StackArray_t *stack, integer_t *length)
+{
+    *length = 0;
+
+    if (sta_empty(stack))
+        return NULL;
+
+    void **array = malloc(sizeof(void*) * (size_t)stack->count);
+
+    if (!array)
+        return NULL;
+
+    *length = sta_pop_n(stack, array, stack->count);
+
+    return array;
+}
+
+/// Gives direct access to the elements from \c position to the top of the
+/// stack, which are stored contiguously. Positions start at the bottom
+/// element, so a span lists elements in the opposite order of sta_pop().
+/// The span is invalidated by any change to the stack.
+///
+/// \param[in] stack StackArray_s reference.
+/// \param[in] position Position of the first element of the span, counting
+/// from the bottom.
+/// \param[out] span Set to the first element of the span.
+///
+/// \return The amount of elements in the span or 0 if \c position is out of
+/// bounds.
+integer_t
+sta_span(StackArray_t *stack, integer_t position, void ***span)
+{
+    *span = NULL;
+
+    if (position < 0 || position >= stack->count)
+        return 0;
+
+    *span = stack->buffer + position;
+
+    return stack->count - position;
+}
+
+#ifndef DS_NO_DISPLAY
 /// Displays a StackArray_s in the console starting from the top element. There
 /// are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -753,6 +958,7 @@ sta_display(StackArray_t *stack, int display_mode)
             break;
     }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
@@ -765,19 +971,12 @@ static sta_grow(StackArray_t *stack, integer_t required_size)
 
     integer_t old_capacity = stack->capacity;
 
-    // capacity = capacity * (growth_rate / 100)
-    stack->capacity = (integer_t) ((double) (stack->capacity) *
-            ((double) (stack->growth_rate) / 100.0));
-
-    // 4 is the minimum growth
-    if (stack->capacity - old_capacity < 4)
-        stack->capacity = old_capacity + 4;
+    stack->capacity = ds_grown_capacity(stack->policy, old_capacity,
+                                        required_size, stack->growth_rate,
+                                        stack->step, sizeof(void*));
 
-    // If not enough...
-    if (stack->capacity < required_size)
-        stack->capacity = required_size;
-
-    void **new_buffer = realloc(stack->buffer,
+    void **new_buffer = ds_buffer_realloc(stack->buffer,
+            sizeof(void*) * (size_t)old_capacity,
             sizeof(void*) * (size_t)stack->capacity);
 
     // Reallocation failed
@@ -792,6 +991,35 @@ static sta_grow(StackArray_t *stack, integer_t required_size)
     return true;
 }
 
+// Halves the buffer while it is a quarter full, which leaves room for both
+// pushes and pops before the next reallocation. sta_pop_n() can halve it many
+// times with a single reallocation.
+static void
+sta_shrink(StackArray_t *stack)
+{
+    if (!stack->shrink || stack->locked)
+        return;
+
+    integer_t capacity = stack->capacity;
+
+    while (stack->count <= capacity / 4 && capacity / 2 >= stack->minimum)
+        capacity /= 2;
+
+    if (capacity == stack->capacity)
+        return;
+
+    void **new_buffer = ds_buffer_realloc(stack->buffer,
+            sizeof(void*) * (size_t)stack->capacity,
+            sizeof(void*) * (size_t)capacity);
+
+    // The bigger buffer is still valid
+    if (!new_buffer)
+        return;
+
+    stack->buffer = new_buffer;
+    stack->capacity = capacity;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -815,6 +1043,7 @@ struct StackArrayIterator_s
     /// that is, the start (top) of the stack.
     integer_t cursor;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief Target version ID.
     ///
     /// When the iterator is initialized it stores the version_id of the target
@@ -822,6 +1051,7 @@ struct StackArrayIterator_s
     /// that may have been modified and thus causing undefined behaviours or
     /// run-time crashes.
     integer_t target_id;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -847,7 +1077,7 @@ sta_iter_new(StackArray_t *target)
         return NULL;
 
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
     iter->cursor = 0;
 
     return iter;
@@ -860,7 +1090,7 @@ void
 sta_iter_retarget(StackArrayIterator_t *iter, StackArray_t *target)
 {
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
 }
 
 ///
@@ -984,7 +1214,8 @@ sta_iter_set(StackArrayIterator_t *iter, void *element)
     if (sta_iter_target_modified(iter))
         return false;
 
-    iter->target->interface->free(iter->target->buffer[iter->cursor]);
+    interface_release(iter->target->interface,
+                      iter->target->buffer[iter->cursor]);
 
     iter->target->buffer[iter->cursor] = element;
 
@@ -1041,7 +1272,7 @@ sta_iter_peek_prev(StackArrayIterator_t *iter)
 static bool
 sta_iter_target_modified(StackArrayIterator_t *iter)
 {
-    return iter->target_id != iter->target->version_id;
+    return DS_VERSION_CHANGED(iter, iter->target);
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
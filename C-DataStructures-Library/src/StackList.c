@@ -53,6 +53,14 @@
 /// - No random access
 /// - More memory usage as in every node there is a pointer to the next node
 ///
+/// Each node holds \c chunk elements, one by default. With stl_set_chunk() a
+/// node can hold many elements, like an unrolled linked list, so pushing only
+/// allocates once every \c chunk elements and the pointer overhead is shared
+/// between them. Only the top node can be partially filled. The last node
+/// emptied by stl_pop() is kept as a spare, so pushing and popping around the
+/// boundary of a node doesn't allocate every time. An empty stack holds no
+/// nodes.
+///
 /// \b Functions
 /// Located in the file StackList.c
 struct StackList_s
@@ -62,6 +70,7 @@ struct StackList_s
     /// Current amount of elements in the StackList_s.
     integer_t count;
 
+#ifndef DS_NO_LIMIT
     /// \brief StackList count limit.
     ///
     /// If it is set to 0 or a negative value then the stack has no limit to
@@ -71,6 +80,7 @@ struct StackList_s
     /// limit the stack count if it already has more elements than the
     /// specified limit.
     integer_t limit;
+#endif
 
     /// \brief The element at the top of the \c StackList.
     ///
@@ -78,12 +88,32 @@ struct StackList_s
     /// relative to this pointer. It points to \c NULL if the stack is empty.
     struct StackListNode_s *top;
 
+    /// \brief Amount of elements in the top node.
+    integer_t height;
+
+    /// \brief Amount of elements each node holds.
+    ///
+    /// Set with stl_set_chunk(). It is 1 by default.
+    integer_t chunk;
+
+    /// \brief An empty node kept to be reused.
+    ///
+    /// NULL if there is no spare node.
+    struct StackListNode_s *spare;
+
+    /// \brief Node pool.
+    ///
+    /// If set, all nodes are taken from and given back to this pool instead of
+    /// using malloc() and free(). NULL by default.
+    struct NodePool_s *pool;
+
     /// \brief StackList_s interface.
     ///
     /// An interface is like a table that has function pointers for functions
     /// that will manipulate a desired data type.
     struct Interface_s *interface;
 
+#ifndef DS_NO_VERSION_ID
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -91,6 +121,7 @@ struct StackList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+#endif
 };
 
 /// This can be used together with VLAs to allocate the structure on the stack
@@ -103,16 +134,17 @@ const unsigned_t stl_size = sizeof(StackList_t);
 /// and one pointer to the next node or \c NULL if it is the bottommost node.
 struct StackListNode_s
 {
-    /// \brief Data pointer.
-    ///
-    /// Points to node's data. The data needs to be dynamically allocated.
-    void *data;
-
     /// \brief Node underneath the current node.
     ///
     /// Node underneath the current node or \c NULL if it is the bottommost
     /// node.
     struct StackListNode_s *below;
+
+    /// \brief Data pointers.
+    ///
+    /// Points to the node's data, from the bottom to the top. The data needs
+    /// to be dynamically allocated.
+    void *data[];
 };
 
 /// \brief A type for a stack node.
@@ -128,13 +160,19 @@ typedef struct StackListNode_s *StackListNode;
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static StackListNode_t *
-stl_new_node(void *element);
+stl_new_node(StackList_t *stack);
+
+static void
+stl_free_node(StackList_t *stack, StackListNode_t *node);
 
 static void
-stl_free_node(StackListNode_t *node, free_f function);
+stl_free_nodes(StackList_t *stack, free_f function);
 
 static void
-stl_free_node_shallow(StackListNode_t *node);
+stl_free_spare(StackList_t *stack);
+
+static size_t
+stl_node_size(integer_t chunk);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -155,12 +193,7 @@ stl_new(Interface_t *interface)
     if (!stack)
         return NULL;
 
-    stack->count = 0;
-    stack->limit = 0;
-    stack->version_id = 0;
-    stack->top = NULL;
-
-    stack->interface = interface;
+    stl_init(stack, interface);
 
     return stack;
 }
@@ -179,9 +212,15 @@ bool
 stl_init(StackList_t *stack, Interface_t *interface)
 {
     stack->count = 0;
+#ifndef DS_NO_LIMIT
     stack->limit = 0;
-    stack->version_id = 0;
+#endif
+    DS_VERSION_RESET(stack);
     stack->top = NULL;
+    stack->height = 0;
+    stack->chunk = 1;
+    stack->spare = NULL;
+    stack->pool = NULL;
     stack->interface = interface;
 
     return true;
@@ -197,16 +236,7 @@ stl_init(StackList_t *stack, Interface_t *interface)
 void
 stl_free(StackList_t *stack)
 {
-    StackListNode_t *prev = stack->top;
-
-    while (stack->top != NULL)
-    {
-        stack->top = stack->top->below;
-
-        stl_free_node(prev, stack->interface->free);
-
-        prev = stack->top;
-    }
+    stl_free_nodes(stack, stack->interface->free);
 
     free(stack);
 }
@@ -220,16 +250,7 @@ stl_free(StackList_t *stack)
 void
 stl_free_shallow(StackList_t *stack)
 {
-    StackListNode_t *prev = stack->top;
-
-    while (stack->top != NULL)
-    {
-        stack->top = stack->top->below;
-
-        stl_free_node_shallow(prev);
-
-        prev = stack->top;
-    }
+    stl_free_nodes(stack, NULL);
 
     free(stack);
 }
@@ -243,19 +264,10 @@ stl_free_shallow(StackList_t *stack)
 void
 stl_erase(StackList_t *stack)
 {
-    StackListNode_t *prev = stack->top;
-
-    while (stack->top != NULL)
-    {
-        stack->top = stack->top->below;
-
-        stl_free_node(prev, stack->interface->free);
-
-        prev = stack->top;
-    }
+    stl_free_nodes(stack, stack->interface->free);
 
     stack->count = 0;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
 }
 
 /// This function will reset the StackList_s, freeing all of its nodes but not
@@ -268,19 +280,10 @@ stl_erase(StackList_t *stack)
 void
 stl_erase_shallow(StackList_t *stack)
 {
-    StackListNode_t *prev = stack->top;
-
-    while (stack->top != NULL)
-    {
-        stack->top = stack->top->below;
-
-        stl_free_node_shallow(prev);
-
-        prev = stack->top;
-    }
+    stl_free_nodes(stack, NULL);
 
     stack->count = 0;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
 }
 
 /// Sets a new interface for the specified StackList_s.
@@ -308,6 +311,19 @@ stl_count(StackList_t *stack)
     return stack->count;
 }
 
+/// Returns how many elements each node of the stack holds.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack StackList_s reference.
+///
+/// \return The amount of elements per node.
+integer_t
+stl_chunk(StackList_t *stack)
+{
+    return stack->chunk;
+}
+
 /// Returns the current stack limit.
 /// \par Interface Requirements
 /// - None
@@ -318,12 +334,19 @@ stl_count(StackList_t *stack)
 integer_t
 stl_limit(StackList_t *stack)
 {
+#ifdef DS_NO_LIMIT
+    (void)stack;
+
+    return 0;
+#else
     return stack->limit;
+#endif
 }
 
 /// Limit's the StackList_s's length. You can only set a limit greater or equal
 /// to the stack's current length and greater than 0. To remove this limitation
-/// simply set the limit to 0 or less.
+/// simply set the limit to 0 or less. If compiled with DS_NO_LIMIT only 0 or
+/// less is accepted.
 /// \par Interface Requirements
 /// - None
 ///
@@ -335,12 +358,72 @@ stl_limit(StackList_t *stack)
 bool
 stl_set_limit(StackList_t *stack, integer_t limit)
 {
+#ifdef DS_NO_LIMIT
+    (void)stack;
+
+    return limit <= 0;
+#else
     // The new limit can't be lower than the stack's current length.
     if (stack->count > limit && limit > 0)
         return false;
 
     stack->limit = limit;
 
+    return true;
+#endif
+}
+
+/// Sets a node pool from where all nodes of the stack are allocated. A
+/// pool can be shared between many containers as long as its nodes are big
+/// enough. Set it to NULL to go back to using malloc() and free(). The pool
+/// can only be changed when the stack is empty.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack StackList_s reference.
+/// \param[in] pool The node pool or NULL.
+///
+/// \return True if the pool was set.
+/// \return False if the stack is not empty or if the pool's nodes are too
+/// small.
+bool
+stl_set_pool(StackList_t *stack, NodePool_t *pool)
+{
+    if (!stl_empty(stack))
+        return false;
+
+    if (pool && !npl_fits(pool, stl_node_size(stack->chunk)))
+        return false;
+
+    stack->pool = pool;
+
+    return true;
+}
+
+/// Sets how many elements each node of the stack holds. Bigger nodes mean
+/// less allocations and less memory used by pointers, at the cost of a
+/// partially filled top node. The chunk can only be changed when the stack is
+/// empty and, if a node pool is set, its nodes must be big enough.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack StackList_s reference.
+/// \param[in] chunk Amount of elements per node, 1 or more.
+///
+/// \return True if the chunk was set.
+/// \return False if the stack is not empty, if the chunk is less than 1 or if
+/// the pool's nodes are too small.
+bool
+stl_set_chunk(StackList_t *stack, integer_t chunk)
+{
+    if (!stl_empty(stack) || chunk < 1)
+        return false;
+
+    if (stack->pool && !npl_fits(stack->pool, stl_node_size(chunk)))
+        return false;
+
+    stack->chunk = chunk;
+
     return true;
 }
 
@@ -359,16 +442,23 @@ stl_push(StackList_t *stack, void *element)
     if (stl_full(stack))
         return false;
 
-    StackListNode_t *node = stl_new_node(element);
+    if (stl_empty(stack) || stack->height == stack->chunk)
+    {
+        StackListNode_t *node = stl_new_node(stack);
 
-    if (!node)
-        return false;
+        if (!node)
+            return false;
+
+        node->below = stack->top;
 
-    node->below = stack->top;
-    stack->top = node;
+        stack->top = node;
+        stack->height = 0;
+    }
+
+    stack->top->data[stack->height++] = element;
 
     stack->count++;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
 
     return true;
 }
@@ -392,14 +482,27 @@ stl_pop(StackList_t *stack, void **result)
         return false;
 
     StackListNode_t *node = stack->top;
-    stack->top = stack->top->below;
-
-    *result = node->data;
 
-    stl_free_node_shallow(node);
+    *result = node->data[--stack->height];
 
     stack->count--;
-    stack->version_id++;
+    DS_VERSION_BUMP(stack);
+
+    if (stl_empty(stack))
+    {
+        // An empty stack holds no nodes
+        npl_node_free(stack->pool, node);
+        stl_free_spare(stack);
+
+        stack->top = NULL;
+    }
+    else if (stack->height == 0)
+    {
+        stack->top = node->below;
+        stack->height = stack->chunk;
+
+        stl_free_node(stack, node);
+    }
 
     return true;
 }
@@ -417,7 +520,7 @@ stl_peek(StackList_t *stack)
     if (stl_empty(stack))
         return NULL;
 
-    return stack->top->data;
+    return stack->top->data[stack->height - 1];
 }
 
 /// Returns true if the stack is empty or false otherwise. The stack is empty
@@ -448,7 +551,13 @@ stl_empty(StackList_t *stack)
 bool
 stl_full(StackList_t *stack)
 {
+#ifdef DS_NO_LIMIT
+    (void)stack;
+
+    return false;
+#else
     return stack->limit > 0 && stack->count >= stack->limit;
+#endif
 }
 
 /// Returns true if the specified size will fit in the stack before it reaches
@@ -463,10 +572,17 @@ stl_full(StackList_t *stack)
 bool
 stl_fits(StackList_t *stack, unsigned_t size)
 {
+#ifdef DS_NO_LIMIT
+    (void)stack;
+    (void)size;
+
+    return true;
+#else
     if (stack->limit <= 0)
         return true;
 
     return (stack->count + size) <= stack->limit;
+#endif
 }
 
 /// Returns true if the element is present in the stack, otherwise false.
@@ -482,12 +598,16 @@ stl_contains(StackList_t *stack, void *key)
 {
     StackListNode_t *scan = stack->top;
 
-    while (scan != NULL)
+    for (integer_t i = 0, index = stack->height - 1; i < stack->count; i++)
     {
-        if (stack->interface->compare(scan->data, key) == 0)
+        if (stack->interface->compare(scan->data[index], key) == 0)
             return true;
 
-        scan = scan->below;
+        if (--index < 0)
+        {
+            scan = scan->below;
+            index = stack->chunk - 1;
+        }
     }
 
     return false;
@@ -510,39 +630,43 @@ stl_copy(StackList_t *stack)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = stack->limit;
+#endif
+    result->chunk = stack->chunk;
+    result->pool = stack->pool;
 
-    // scan -> goes through the original stack
-    // copy -> current element being copied
-    // prev -> copy's previous node to make the link
-    StackListNode_t *prev = NULL, *copy = NULL, *scan = stack->top;
+    // Both stacks have the same shape, so the nodes are copied one by one and
+    // linked from the top to the bottom
+    StackListNode_t *scan = stack->top, **link = &result->top;
 
-    while (scan != NULL)
+    for (integer_t length = stack->height; scan != NULL;
+         length = stack->chunk)
     {
-        void *element = stack->interface->copy(scan->data);
-        copy = stl_new_node(element);
+        StackListNode_t *copy = stl_new_node(result);
 
         if (!copy)
         {
-            stack->interface->free(element);
-            return false;
+            *link = NULL;
+            result->height = stack->height;
+            stl_free(result);
+            return NULL;
         }
 
-        if (prev == NULL)
-        {
-            prev = copy;
-            result->top = prev;
-        }
-        else
-        {
-            prev->below = copy;
-            prev = prev->below;
-        }
+        for (integer_t i = 0; i < length; i++)
+            copy->data[i] = stack->interface->copy(scan->data[i]);
+
+        *link = copy;
+        link = &copy->below;
+
+        result->count += length;
 
         scan = scan->below;
     }
 
-    result->count = stack->count;
+    *link = NULL;
+
+    result->height = stack->height;
 
     return result;
 }
@@ -563,38 +687,43 @@ stl_copy_shallow(StackList_t *stack)
     if (!result)
         return NULL;
 
+#ifndef DS_NO_LIMIT
     result->limit = stack->limit;
+#endif
+    result->chunk = stack->chunk;
+    result->pool = stack->pool;
 
-    // scan -> goes through the original stack
-    // copy -> current element being copied
-    // prev -> copy's previous node to make the link
-    StackListNode_t *prev = NULL, *copy, *scan = stack->top;
+    // Both stacks have the same shape, so the nodes are copied one by one and
+    // linked from the top to the bottom
+    StackListNode_t *scan = stack->top, **link = &result->top;
 
-    while (scan != NULL)
+    for (integer_t length = stack->height; scan != NULL;
+         length = stack->chunk)
     {
-        copy = stl_new_node(scan->data);
+        StackListNode_t *copy = stl_new_node(result);
 
         if (!copy)
         {
-            stl_free_node(copy, stack->interface->free);
-            return false;
+            *link = NULL;
+            result->height = stack->height;
+            stl_free_shallow(result);
+            return NULL;
         }
 
-        if (prev == NULL)
-        {
-            prev = copy;
-            result->top = prev;
-        }
-        else
-        {
-            prev->below = copy;
-            prev = prev->below;
-        }
+        for (integer_t i = 0; i < length; i++)
+            copy->data[i] = scan->data[i];
+
+        *link = copy;
+        link = &copy->below;
+
+        result->count += length;
 
         scan = scan->below;
     }
 
-    result->count = stack->count;
+    *link = NULL;
+
+    result->height = stack->height;
 
     return result;
 }
@@ -616,17 +745,32 @@ stl_compare(StackList_t *stack1, StackList_t *stack2)
 {
     StackListNode_t *scan1 = stack1->top, *scan2 = stack2->top;
 
+    integer_t index1 = stack1->height - 1, index2 = stack2->height - 1;
+
+    integer_t length = stack1->count < stack2->count ? stack1->count
+                                                     : stack2->count;
+
     int comparison = 0;
-    while (scan1 != NULL && scan2 != NULL)
+    for (integer_t i = 0; i < length; i++)
     {
-        comparison = stack1->interface->compare(scan1->data, scan2->data);
+        comparison = stack1->interface->compare(scan1->data[index1],
+                                                scan2->data[index2]);
         if (comparison > 0)
             return 1;
         else if (comparison < 0)
             return -1;
 
-        scan1 = scan1->below;
-        scan2 = scan2->below;
+        if (--index1 < 0)
+        {
+            scan1 = scan1->below;
+            index1 = stack1->chunk - 1;
+        }
+
+        if (--index2 < 0)
+        {
+            scan2 = scan2->below;
+            index2 = stack2->chunk - 1;
+        }
     }
 
     // So far all elements were the same
@@ -642,7 +786,9 @@ stl_compare(StackList_t *stack1, StackList_t *stack2)
 /// stacks need to have been initialized. If the stack1 is empty it will
 /// receive all elements contained in the stack2, otherwise the bottommost
 /// node of stack2 will point to the top node of stack1. If both stacks are
-/// empty nothing will happen.
+/// empty nothing will happen. Nodes can only be linked if both stacks have the
+/// same chunk and pool and the top node of stack1 is full, otherwise the
+/// elements of stack2 are pushed one by one.
 /// \par Interface Requirements
 /// - None
 ///
@@ -656,15 +802,17 @@ stl_stack(StackList_t *stack1, StackList_t *stack2)
     if (stl_empty(stack2))
         return true;
 
-    if (stl_empty(stack1))
+    bool same = stack1->chunk == stack2->chunk && stack1->pool == stack2->pool;
+
+    if (same && stl_empty(stack1))
     {
+        stl_free_spare(stack1);
+
         stack1->top = stack2->top;
+        stack1->height = stack2->height;
         stack1->count = stack2->count;
-
-        stack2->top = NULL;
-        stack2->count = 0;
     }
-    else
+    else if (same && stack1->height == stack1->chunk)
     {
         StackListNode_t *scan = stack2->top;
 
@@ -675,14 +823,58 @@ stl_stack(StackList_t *stack1, StackList_t *stack2)
         scan->below = stack1->top;
 
         stack1->top = stack2->top;
+        stack1->height = stack2->height;
         stack1->count += stack2->count;
+    }
+    else
+    {
+        // The elements of stack2 from the top to the bottom
+        void **elements = malloc(sizeof(void*) * (size_t)stack2->count);
+
+        if (!elements)
+            return false;
+
+        StackListNode_t *scan = stack2->top;
+
+        for (integer_t i = 0, index = stack2->height - 1; i < stack2->count;
+             i++)
+        {
+            elements[i] = scan->data[index];
+
+            if (--index < 0)
+            {
+                scan = scan->below;
+                index = stack2->chunk - 1;
+            }
+        }
 
-        stack2->top = NULL;
-        stack2->count = 0;
+        for (integer_t i = stack2->count - 1; i >= 0; i--)
+        {
+            if (!stl_push(stack1, elements[i]))
+            {
+                // Leaves both stacks as they were
+                void *result;
+
+                for (i++; i < stack2->count; i++)
+                    stl_pop(stack1, &result);
+
+                free(elements);
+
+                return false;
+            }
+        }
+
+        free(elements);
+
+        stl_free_nodes(stack2, NULL);
     }
 
-    stack1->version_id++;
-    stack2->version_id++;
+    stack2->top = NULL;
+    stack2->count = 0;
+    stl_free_spare(stack2);
+
+    DS_VERSION_BUMP(stack1);
+    DS_VERSION_BUMP(stack2);
 
     return true;
 }
@@ -712,11 +904,15 @@ stl_to_array(StackList_t *stack, integer_t *length)
 
     StackListNode_t *scan = stack->top;
 
-    integer_t i = 0;
-    while (scan != NULL)
+    for (integer_t i = 0, index = stack->height - 1; i < stack->count; i++)
     {
-        array[i++] = stack->interface->copy(scan->data);
-        scan = scan->below;
+        array[i] = stack->interface->copy(scan->data[index]);
+
+        if (--index < 0)
+        {
+            scan = scan->below;
+            index = stack->chunk - 1;
+        }
     }
 
     *length = stack->count;
@@ -724,6 +920,7 @@ stl_to_array(StackList_t *stack, integer_t *length)
     return array;
 }
 
+#ifndef DS_NO_DISPLAY
 /// Displays a StackList_s in the console starting from the top element. There
 /// are currently four modes:
 /// - -1 Displays each element separated by newline;
@@ -744,81 +941,110 @@ stl_display(StackList_t *stack, int display_mode)
         return;
     }
 
-    StackListNode_t *scan = stack->top;
+    const char *begin, *separator, *end;
 
     switch (display_mode)
     {
         case -1:
-            printf("\nStackList\n");
-            while (scan != NULL)
-            {
-                stack->interface->display(scan->data);
-                printf("\n");
-                scan = scan->below;
-            }
+            begin = "\nStackList\n", separator = "\n", end = "\n";
             break;
         case 0:
-            printf("\nStackList\nTop -> ");
-            while (scan->below != NULL)
-            {
-                stack->interface->display(scan->data);
-                printf(" -> ");
-                scan = scan->below;
-            }
-            stack->interface->display(scan->data);
-            printf(" NULL\n");
+            begin = "\nStackList\nTop -> ", separator = " -> ";
+            end = " NULL\n";
             break;
         case 1:
-            printf("\nStackList\n");
-            while (scan != NULL)
-            {
-                stack->interface->display(scan->data);
-                printf(" ");
-                scan = scan->below;
-            }
-            printf("\n");
+            begin = "\nStackList\n", separator = " ", end = " \n";
             break;
         default:
-            printf("\nStackList\n[ ");
-            while (scan->below != NULL)
-            {
-                stack->interface->display(scan->data);
-                printf(", ");
-                scan = scan->below;
-            }
-            stack->interface->display(scan->data);
-            printf(" ]\n");
+            begin = "\nStackList\n[ ", separator = ", ", end = " ]\n";
             break;
     }
+
+    printf("%s", begin);
+
+    StackListNode_t *scan = stack->top;
+
+    for (integer_t i = 0, index = stack->height - 1; i < stack->count; i++)
+    {
+        stack->interface->display(scan->data[index]);
+
+        printf("%s", i < stack->count - 1 ? separator : end);
+
+        if (--index < 0)
+        {
+            scan = scan->below;
+            index = stack->chunk - 1;
+        }
+    }
 }
+#endif
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static StackListNode_t *
-stl_new_node(void *element)
+stl_new_node(StackList_t *stack)
 {
-    StackListNode_t *node = malloc(sizeof(StackListNode_t));
+    StackListNode_t *node = stack->spare;
+
+    if (node)
+        stack->spare = NULL;
+    else
+        node = npl_node_alloc(stack->pool, stl_node_size(stack->chunk));
 
     if (!node)
         return NULL;
 
     node->below = NULL;
-    node->data = element;
 
     return node;
 }
 
 static void
-stl_free_node(StackListNode_t *node, free_f function)
+stl_free_node(StackList_t *stack, StackListNode_t *node)
 {
-    function(node->data);
-    free(node);
+    if (stack->spare == NULL)
+        stack->spare = node;
+    else
+        npl_node_free(stack->pool, node);
+}
+
+static void
+stl_free_nodes(StackList_t *stack, free_f function)
+{
+    StackListNode_t *scan = stack->top, *below;
+
+    for (integer_t length = stack->height; scan != NULL;
+         length = stack->chunk)
+    {
+        if (function)
+        {
+            for (integer_t i = 0; i < length; i++)
+                function(scan->data[i]);
+        }
+
+        below = scan->below;
+        npl_node_free(stack->pool, scan);
+        scan = below;
+    }
+
+    stack->top = NULL;
+
+    stl_free_spare(stack);
 }
 
 static void
-stl_free_node_shallow(StackListNode_t *node)
+stl_free_spare(StackList_t *stack)
 {
-    free(node);
+    if (stack->spare)
+        npl_node_free(stack->pool, stack->spare);
+
+    stack->spare = NULL;
+}
+
+static size_t
+stl_node_size(integer_t chunk)
+{
+    return sizeof(StackListNode_t) + sizeof(void*) * (size_t)chunk;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -828,7 +1054,7 @@ stl_free_node_shallow(StackListNode_t *node)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// This iterator is a forward-only iterator. Its cursor is represented by a
-/// pointer to one of the stack's node.
+/// pointer to one of the stack's node and an index inside of it.
 struct StackListIterator_s
 {
     /// \brief Target StackList_s.
@@ -843,6 +1069,13 @@ struct StackListIterator_s
     /// cursor pointing to the start (top) of the stack.
     struct StackListNode_s *cursor;
 
+    /// \brief Index of the current element inside the cursor node.
+    integer_t index;
+
+    /// \brief Position of the current element, starting at the top.
+    integer_t position;
+
+#ifndef DS_NO_VERSION_ID
     /// \brief Target version ID.
     ///
     /// When the iterator is initialized it stores the version_id of the target
@@ -850,6 +1083,7 @@ struct StackListIterator_s
     /// that may have been modified and thus causing undefined behaviours or
     /// run-time crashes.
     integer_t target_id;
+#endif
 };
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -875,8 +1109,10 @@ stl_iter_new(StackList_t *target)
         return NULL;
 
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
     iter->cursor = target->top;
+    iter->index = target->height - 1;
+    iter->position = 0;
 
     return iter;
 }
@@ -888,7 +1124,10 @@ void
 stl_iter_retarget(StackListIterator_t *iter, StackList_t *target)
 {
     iter->target = target;
-    iter->target_id = target->version_id;
+    DS_VERSION_SYNC(iter, target);
+    iter->cursor = target->top;
+    iter->index = target->height - 1;
+    iter->position = 0;
 }
 
 ///
@@ -912,7 +1151,13 @@ stl_iter_next(StackListIterator_t *iter)
     if (!stl_iter_has_next(iter))
         return false;
 
-    iter->cursor = iter->cursor->below;
+    if (--iter->index < 0)
+    {
+        iter->cursor = iter->cursor->below;
+        iter->index = iter->target->chunk - 1;
+    }
+
+    iter->position++;
 
     return true;
 }
@@ -928,6 +1173,8 @@ stl_iter_to_top(StackListIterator_t *iter)
         return false;
 
     iter->cursor = iter->target->top;
+    iter->index = iter->target->height - 1;
+    iter->position = 0;
 
     return true;
 }
@@ -939,7 +1186,7 @@ stl_iter_to_top(StackListIterator_t *iter)
 bool
 stl_iter_has_next(StackListIterator_t *iter)
 {
-    return iter->cursor->below != NULL;
+    return iter->position + 1 < iter->target->count;
 }
 
 ///
@@ -953,7 +1200,7 @@ stl_iter_get(StackListIterator_t *iter, void **result)
     if (stl_iter_target_modified(iter))
         return false;
 
-    *result = iter->cursor->data;
+    *result = iter->cursor->data[iter->index];
 
     return true;
 }
@@ -969,9 +1216,9 @@ stl_iter_set(StackListIterator_t *iter, void *element)
     if (stl_iter_target_modified(iter))
         return false;
 
-    iter->target->interface->free(iter->cursor->data);
+    iter->target->interface->free(iter->cursor->data[iter->index]);
 
-    iter->cursor->data = element;
+    iter->cursor->data[iter->index] = element;
 
     return true;
 }
@@ -989,7 +1236,10 @@ stl_iter_peek_next(StackListIterator_t *iter)
     if (!stl_iter_has_next(iter))
         return NULL;
 
-    return iter->cursor->below->data;
+    if (iter->index == 0)
+        return iter->cursor->below->data[iter->target->chunk - 1];
+
+    return iter->cursor->data[iter->index - 1];
 }
 
 ///
@@ -1002,7 +1252,7 @@ stl_iter_peek(StackListIterator_t *iter)
     if (stl_iter_target_modified(iter))
         return NULL;
 
-    return iter->cursor->data;
+    return iter->cursor->data[iter->index];
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -1010,7 +1260,7 @@ stl_iter_peek(StackListIterator_t *iter)
 static bool
 stl_iter_target_modified(StackListIterator_t *iter)
 {
-    return iter->target_id != iter->target->version_id;
+    return DS_VERSION_CHANGED(iter, iter->target);
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,659 @@
+/**
+ * @file StaticSortedSet.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "StaticSortedSet.h"
+#include "Sort.h"
+
+/// In the Eytzinger layout the descendants of position \c k three levels
+/// below are at <code> 8 * k </code> up to <code> 8 * k + 7 </code>. With
+/// aligned buffers their keys share a cache line, which is prefetched while
+/// the three levels above are searched.
+#define SSS_AHEAD 8
+
+/// Ranges of the interpolation search this small are scanned instead.
+#define SSS_LINEAR 8
+
+/// A StaticSortedSet_s is an ordered set that is built once and then only
+/// searched. All elements are kept in a single buffer, with an optional
+/// buffer of integer keys next to it, so the set takes one or two pointers
+/// per element instead of a whole node with two children, a parent and a
+/// balance factor like an AVLTree_s.
+///
+/// In the Eytzinger layout the buffer holds the elements in breadth-first
+/// order of a complete binary search tree: the children of position \c k are
+/// at \c 2k and <code> 2k + 1 </code>. A search goes down the tree by
+/// computing the next position from the result of each comparison, without
+/// branches, and prefetches the positions three levels ahead, so the top of
+/// the tree stays in cache and most searches wait on one cache miss at a
+/// time.
+///
+/// In the interpolation layout the buffer is in ascending order and a search
+/// guesses the position of an element from its integer key and the keys at
+/// both ends of the range, which takes <code> O(log log n) </code> steps on
+/// uniformly distributed keys. Steps that don't halve the range are followed
+/// by a binary search step, so skewed keys still take
+/// <code> O(log n) </code> steps.
+///
+/// As in a BPlusTree_s, the key must be consistent with the comparison: if
+/// <code> key(a) < key(b) </code> then <code> compare(a, b) < 0 </code>. The
+/// \ref compare_f is only called to break ties between equal keys.
+///
+/// The set takes ownership of its elements and does not accept duplicates.
+///
+/// \par Functions
+/// Located in the file StaticSortedSet.c
+struct StaticSortedSet_s
+{
+    /// \brief Elements, from position 1 up to \c size.
+    void **items;
+
+    /// \brief Keys of \c items, only used with a key_f.
+    uint64_t *keys;
+
+    /// \brief Total elements in the set.
+    integer_t size;
+
+    /// \brief How the elements are laid out.
+    SortedSetLayout layout;
+
+    /// \brief Optional inline key of elements.
+    key_f key;
+
+    /// \brief An interface defining all necessary functions for the set to
+    /// operate.
+    Interface_t *interface;
+};
+
+// State of sss_collect
+struct StaticSortedSetCollect_s
+{
+    void **buffer;
+    integer_t count;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void *
+sss_alloc(integer_t count, size_t size);
+
+static bool
+sss_sorted(Interface_t *interface, void **elements, integer_t size);
+
+static StaticSortedSet_t *
+sss_build(Interface_t *interface, key_f key, SortedSetLayout layout,
+          void **elements, integer_t size);
+
+static void
+sss_fill(StaticSortedSet_t *set, void **elements, integer_t *next,
+         integer_t position);
+
+static void
+sss_collect(void *element, void *argument);
+
+static integer_t
+sss_search(StaticSortedSet_t *set, void *element);
+
+static integer_t
+sss_search_eytzinger(StaticSortedSet_t *set, void *element, uint64_t key);
+
+static integer_t
+sss_search_interpolation(StaticSortedSet_t *set, void *element,
+                         uint64_t key);
+
+static integer_t
+sss_first(StaticSortedSet_t *set);
+
+static integer_t
+sss_next(StaticSortedSet_t *set, integer_t position);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Builds a StaticSortedSet_s from a buffer of elements sorted in ascending
+/// order without duplicates. On success the set takes ownership of the
+/// elements, but not of the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// set to operate.
+/// \param[in] key A function consistent with the interface comparator or
+/// NULL to only use comparisons. Required by the interpolation layout.
+/// \param[in] layout How the elements are laid out.
+/// \param[in] elements Buffer of sorted elements.
+/// \param[in] size Amount of elements in the buffer.
+///
+/// \return A new StaticSortedSet_s or NULL if allocation failed, the
+/// elements are not sorted and unique or the layout needs a key.
+StaticSortedSet_t *
+sss_from_sorted_array(Interface_t *interface, key_f key,
+                      SortedSetLayout layout, void **elements,
+                      integer_t size)
+{
+    if (size < 0 || !sss_sorted(interface, elements, size))
+        return NULL;
+
+    return sss_build(interface, key, layout, elements, size);
+}
+
+/// Builds a StaticSortedSet_s with every element of a DynamicArray_s, in any
+/// order. On success the elements are moved to the set and the array is left
+/// empty, otherwise the array is left untouched.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// set to operate.
+/// \param[in] key A function consistent with the interface comparator or
+/// NULL to only use comparisons. Required by the interpolation layout.
+/// \param[in] layout How the elements are laid out.
+/// \param[in] array The array with the elements.
+///
+/// \return A new StaticSortedSet_s or NULL if allocation failed, the array
+/// has duplicates or the layout needs a key.
+StaticSortedSet_t *
+sss_from_array(Interface_t *interface, key_f key, SortedSetLayout layout,
+               DynamicArray_t *array)
+{
+    void **span = NULL;
+
+    integer_t size = dar_span(array, 0, &span);
+
+    void **elements = malloc(sizeof(void*) * (size_t)(size > 0 ? size : 1));
+
+    if (!elements)
+        return NULL;
+
+    if (size > 0)
+        memcpy(elements, span, sizeof(void*) * (size_t)size);
+
+    srt_sort(elements, size, interface->compare);
+
+    StaticSortedSet_t *set = sss_from_sorted_array(interface, key, layout,
+                                                   elements, size);
+
+    free(elements);
+
+    if (set)
+        dar_erase_shallow(array);
+
+    return set;
+}
+
+/// Builds a StaticSortedSet_s with every element of an AVLTree_s. On success
+/// the elements are moved to the set and the nodes of the tree are freed,
+/// leaving it empty. Otherwise the tree is left untouched.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// set to operate.
+/// \param[in] key A function consistent with the interface comparator or
+/// NULL to only use comparisons. Required by the interpolation layout.
+/// \param[in] layout How the elements are laid out.
+/// \param[in] tree The tree with the elements.
+///
+/// \return A new StaticSortedSet_s or NULL if allocation failed or the
+/// layout needs a key.
+StaticSortedSet_t *
+sss_from_tree(Interface_t *interface, key_f key, SortedSetLayout layout,
+              AVLTree_t *tree)
+{
+    integer_t size = avl_size(tree);
+
+    struct StaticSortedSetCollect_s collect;
+
+    collect.buffer = malloc(sizeof(void*) * (size_t)(size > 0 ? size : 1));
+    collect.count = 0;
+
+    if (!collect.buffer)
+        return NULL;
+
+    if (size > 0)
+        avl_range(tree, avl_min(tree), avl_max(tree), sss_collect, &collect);
+
+    StaticSortedSet_t *set = sss_build(interface, key, layout,
+                                       collect.buffer, collect.count);
+
+    free(collect.buffer);
+
+    if (set)
+        avl_erase_shallow(tree);
+
+    return set;
+}
+
+/// Frees from memory a StaticSortedSet_s and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] set The set to be freed from memory.
+void
+sss_free(StaticSortedSet_t *set)
+{
+    for (integer_t i = 1; i <= set->size; i++)
+        interface_release(set->interface, set->items[i]);
+
+    sss_free_shallow(set);
+}
+
+/// Frees from memory a StaticSortedSet_s without freeing its elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] set The set to be freed from memory.
+void
+sss_free_shallow(StaticSortedSet_t *set)
+{
+    free(set->items);
+    free(set->keys);
+    free(set);
+}
+
+/// \param[in] set The set.
+///
+/// \return The amount of elements in the set.
+integer_t
+sss_size(StaticSortedSet_t *set)
+{
+    return set->size;
+}
+
+/// \param[in] set The set.
+///
+/// \return How the elements of the set are laid out.
+SortedSetLayout
+sss_layout(StaticSortedSet_t *set)
+{
+    return set->layout;
+}
+
+/// \param[in] set The set.
+///
+/// \return True if the set has no elements, false otherwise.
+bool
+sss_empty(StaticSortedSet_t *set)
+{
+    return set->size == 0;
+}
+
+/// Checks if an element equal to the given one is in the set.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] set The set.
+/// \param[in] element The element to be searched.
+///
+/// \return True if the element is present, false otherwise.
+bool
+sss_contains(StaticSortedSet_t *set, void *element)
+{
+    integer_t position = sss_search(set, element);
+
+    return position != 0
+           && set->interface->compare(set->items[position], element) == 0;
+}
+
+/// Returns the smallest element of the set that is not smaller than the
+/// given one.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] set The set.
+/// \param[in] element The element to be searched.
+///
+/// \return The element found or NULL if every element is smaller.
+void *
+sss_lower_bound(StaticSortedSet_t *set, void *element)
+{
+    integer_t position = sss_search(set, element);
+
+    return position != 0 ? set->items[position] : NULL;
+}
+
+/// Visits in ascending order every element that is not smaller than \c low
+/// and not bigger than \c high. In the Eytzinger layout the next element is
+/// found by walking the implicit tree, in the interpolation layout it is the
+/// next one in the buffer.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] set The set.
+/// \param[in] low Lower bound of the range.
+/// \param[in] high Upper bound of the range.
+/// \param[in] visit A function called with each element and the argument.
+/// \param[in] argument A value given to every call of the visit function.
+///
+/// \return The amount of visited elements.
+integer_t
+sss_range(StaticSortedSet_t *set, void *low, void *high, visit_f visit,
+          void *argument)
+{
+    integer_t total = 0;
+
+    for (integer_t position = sss_search(set, low); position != 0;
+         position = sss_next(set, position))
+    {
+        if (set->interface->compare(set->items[position], high) > 0)
+            break;
+
+        visit(set->items[position], argument);
+        total++;
+    }
+
+    return total;
+}
+
+/// Visits every element in ascending order.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] set The set.
+/// \param[in] visit A function called with each element and the argument.
+/// \param[in] argument A value given to every call of the visit function.
+void
+sss_traversal(StaticSortedSet_t *set, visit_f visit, void *argument)
+{
+    for (integer_t position = sss_first(set); position != 0;
+         position = sss_next(set, position))
+        visit(set->items[position], argument);
+}
+
+/// Displays every element of the set in ascending order.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] set The set.
+void
+sss_display(StaticSortedSet_t *set)
+{
+    printf("\n+--------------------------------------------------+");
+    printf("\n|                 Static Sorted Set                |");
+    printf("\n+--------------------------------------------------+\n");
+
+    if (set->size == 0)
+    {
+        printf(" EMPTY\n");
+        return;
+    }
+
+    printf("[ ");
+
+    for (integer_t position = sss_first(set); position != 0;
+         position = sss_next(set, position))
+    {
+        set->interface->display(set->items[position]);
+        printf(" ");
+    }
+
+    printf("]\n");
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Allocates a buffer aligned to a cache line
+static void *
+sss_alloc(integer_t count, size_t size)
+{
+    // aligned_alloc() requires the size to be a multiple of the alignment
+    size_t bytes = size * (size_t)count;
+
+    bytes = (bytes + DS_CACHE_LINE - 1) / DS_CACHE_LINE * DS_CACHE_LINE;
+
+    return aligned_alloc(DS_CACHE_LINE, bytes);
+}
+
+// Checks that the elements are in strictly ascending order
+static bool
+sss_sorted(Interface_t *interface, void **elements, integer_t size)
+{
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (interface->compare(elements[i - 1], elements[i]) >= 0)
+            return false;
+    }
+
+    return true;
+}
+
+// Builds a set from elements that are known to be sorted and unique
+static StaticSortedSet_t *
+sss_build(Interface_t *interface, key_f key, SortedSetLayout layout,
+          void **elements, integer_t size)
+{
+    if (layout == SortedSetInterpolation && !key)
+        return NULL;
+
+    StaticSortedSet_t *set = malloc(sizeof(StaticSortedSet_t));
+
+    if (!set)
+        return NULL;
+
+    // Position 0 is not used
+    set->items = sss_alloc(size + 1, sizeof(void*));
+    set->keys = key ? sss_alloc(size + 1, sizeof(uint64_t)) : NULL;
+
+    if (!set->items || (key && !set->keys))
+    {
+        free(set->items);
+        free(set->keys);
+        free(set);
+        return NULL;
+    }
+
+    set->size = size;
+    set->layout = layout;
+    set->key = key;
+    set->interface = interface;
+
+    if (layout == SortedSetEytzinger)
+    {
+        integer_t next = 0;
+
+        sss_fill(set, elements, &next, 1);
+    }
+    else if (size > 0)
+        memcpy(set->items + 1, elements, sizeof(void*) * (size_t)size);
+
+    for (integer_t i = 1; key && i <= size; i++)
+        set->keys[i] = key(set->items[i]);
+
+    return set;
+}
+
+// Places the elements in the subtree at position in order
+static void
+sss_fill(StaticSortedSet_t *set, void **elements, integer_t *next,
+         integer_t position)
+{
+    if (position > set->size)
+        return;
+
+    sss_fill(set, elements, next, 2 * position);
+
+    set->items[position] = elements[(*next)++];
+
+    sss_fill(set, elements, next, 2 * position + 1);
+}
+
+static void
+sss_collect(void *element, void *argument)
+{
+    struct StaticSortedSetCollect_s *collect = argument;
+
+    collect->buffer[collect->count++] = element;
+}
+
+// Returns the position of the first element not smaller than the given one
+// or 0 if there is none
+static integer_t
+sss_search(StaticSortedSet_t *set, void *element)
+{
+    uint64_t key = set->key ? set->key(element) : 0;
+
+    if (set->layout == SortedSetInterpolation)
+        return sss_search_interpolation(set, element, key);
+
+    return sss_search_eytzinger(set, element, key);
+}
+
+static integer_t
+sss_search_eytzinger(StaticSortedSet_t *set, void *element, uint64_t key)
+{
+    const integer_t n = set->size;
+
+    integer_t k = 1;
+
+    if (set->keys)
+    {
+        const uint64_t *keys = set->keys;
+
+        while (k <= n)
+        {
+            DS_PREFETCH(keys + (SSS_AHEAD * k <= n ? SSS_AHEAD * k : 0));
+
+            bool less = keys[k] < key
+                        || (keys[k] == key
+                            && set->interface->compare(set->items[k],
+                                                       element) < 0);
+
+            k = 2 * k + less;
+        }
+    }
+    else
+    {
+        void **items = set->items;
+
+        while (k <= n)
+        {
+            DS_PREFETCH(items + (SSS_AHEAD * k <= n ? SSS_AHEAD * k : 0));
+
+            k = 2 * k + (set->interface->compare(items[k], element) < 0);
+        }
+    }
+
+    // The search went left at the answer and then always right, so the
+    // right turns and the last left turn are undone
+    while (k & 1)
+        k >>= 1;
+
+    return k >> 1;
+}
+
+static integer_t
+sss_search_interpolation(StaticSortedSet_t *set, void *element,
+                         uint64_t key)
+{
+    const uint64_t *keys = set->keys;
+
+    // Keys before low are smaller than key, keys from high on are not
+    integer_t low = 1, high = set->size + 1;
+
+    bool bisect = false;
+
+    while (high - low > SSS_LINEAR)
+    {
+        uint64_t first = keys[low], last = keys[high - 1];
+
+        if (key <= first)
+        {
+            high = low;
+            break;
+        }
+
+        if (key > last)
+        {
+            low = high;
+            break;
+        }
+
+        integer_t width = high - low, middle;
+
+        // Since first < key <= last the guess is in [low, high - 1]
+        if (bisect)
+            middle = low + width / 2;
+        else
+            middle = low + (integer_t)((double)(key - first)
+                                       / (double)(last - first)
+                                       * (double)(width - 1));
+
+        if (keys[middle] < key)
+            low = middle + 1;
+        else
+            high = middle;
+
+        // A guess that didn't halve the range is followed by a bisection
+        bisect = !bisect && high - low > width / 2;
+    }
+
+    while (low < high && keys[low] < key)
+        low++;
+
+    // Elements with the same key are told apart by the comparator
+    while (low <= set->size && keys[low] == key
+           && set->interface->compare(set->items[low], element) < 0)
+        low++;
+
+    return low <= set->size ? low : 0;
+}
+
+// Position of the smallest element or 0 if the set is empty
+static integer_t
+sss_first(StaticSortedSet_t *set)
+{
+    if (set->size == 0)
+        return 0;
+
+    integer_t k = 1;
+
+    if (set->layout == SortedSetEytzinger)
+    {
+        while (2 * k <= set->size)
+            k = 2 * k;
+    }
+
+    return k;
+}
+
+// Position of the element after the one at position or 0 if it is the last
+static integer_t
+sss_next(StaticSortedSet_t *set, integer_t position)
+{
+    if (set->layout == SortedSetInterpolation)
+        return position < set->size ? position + 1 : 0;
+
+    integer_t k = position;
+
+    // Leftmost element of the right subtree
+    if (2 * k + 1 <= set->size)
+    {
+        k = 2 * k + 1;
+
+        while (2 * k <= set->size)
+            k = 2 * k;
+
+        return k;
+    }
+
+    // Otherwise the first ancestor whose left subtree has this element
+    while (k & 1)
+        k >>= 1;
+
+    return k >> 1;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,359 @@
+/**
+ * @file Synchronized.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+// pthread_rwlock_t and clock_gettime are not part of strict C11
+#define _POSIX_C_SOURCE 200809L
+
+#include "Synchronized.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/// A Synchronized_s makes any container safe to use from many threads. It
+/// does not know the type of the container; instead every access is put in a
+/// section:
+/// - Read sections, from syn_read_begin() to syn_read_end(), can run at the
+/// same time as other read sections. A group of lookups can be done in a
+/// single section so the lock is only taken once;
+/// - Write sections, from syn_write_begin() to syn_write_end(), have
+/// exclusive access to the container;
+/// - Optimistic reads, from syn_optimistic_begin() to
+/// syn_optimistic_validate(), take no lock at all. A sequence number is
+/// incremented at the beginning and at the end of every write section, so a
+/// read that saw the same even number at both ends did not overlap a writer.
+/// Otherwise the read has to be repeated.
+///
+/// Optimistic reads can see the container in the middle of a write, so their
+/// result must be discarded if validation fails, and they must not follow
+/// pointers that a writer might free. They are meant for containers with a
+/// fixed buffer, like an Array_s, a BitArray_s that is not resized or a
+/// DynamicArray_s with a locked capacity. For everything else use read
+/// sections.
+///
+/// Every section is counted and, unless disabled with syn_set_timing(), the
+/// time each lock was held is measured.
+///
+/// The statistics are updated by every section, so they start on their own
+/// cache line. Otherwise each counted read would invalidate the line that
+/// optimistic readers poll for the sequence number.
+///
+/// \par Functions
+/// Located in the file Synchronized.c
+struct Synchronized_s
+{
+    /// \brief The protected container.
+    void *target;
+
+    /// \brief Lock of read and write sections.
+    pthread_rwlock_t lock;
+
+    /// \brief Sequence number of optimistic reads.
+    ///
+    /// Odd while a write section is running.
+    _Atomic(unsigned_t) sequence;
+
+    /// \brief If lock hold times are measured.
+    atomic_bool timing;
+
+    /// \brief When the current write section started.
+    ///
+    /// Zero if it was not measured.
+    unsigned_t write_start;
+
+    /// \brief Statistics, see SyncStats_s.
+    _Alignas(DS_CACHE_LINE) _Atomic(unsigned_t) reads;
+    _Atomic(unsigned_t) read_time;
+    _Atomic(unsigned_t) read_max;
+    _Atomic(unsigned_t) writes;
+    _Atomic(unsigned_t) write_time;
+    _Atomic(unsigned_t) write_max;
+    _Atomic(unsigned_t) optimistic;
+    _Atomic(unsigned_t) retries;
+    _Atomic(unsigned_t) waits;
+    _Atomic(unsigned_t) wait_time;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+syn_now(void);
+
+static void
+syn_record(_Atomic(unsigned_t) *total, _Atomic(unsigned_t) *max,
+           unsigned_t start);
+
+static void
+syn_lock(Synchronized_t *sync, bool write);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new lock for a container. The container must not be used
+/// directly anymore, only through the sections of the lock.
+///
+/// \param[in] target The container to be protected.
+///
+/// \return A new Synchronized_s or NULL if allocation failed.
+Synchronized_t *
+syn_new(void *target)
+{
+    Synchronized_t *sync = aligned_alloc(DS_CACHE_LINE,
+                                         sizeof(Synchronized_t));
+
+    if (!sync)
+        return NULL;
+
+    if (pthread_rwlock_init(&sync->lock, NULL) != 0)
+    {
+        free(sync);
+        return NULL;
+    }
+
+    sync->target = target;
+    sync->write_start = 0;
+
+    atomic_init(&sync->sequence, 0);
+    atomic_init(&sync->timing, true);
+
+    syn_reset_stats(sync);
+
+    return sync;
+}
+
+/// Frees from memory the lock. The container is not freed. No thread can be
+/// inside a section.
+///
+/// \param[in] sync The lock to be freed from memory.
+void
+syn_free(Synchronized_t *sync)
+{
+    pthread_rwlock_destroy(&sync->lock);
+
+    free(sync);
+}
+
+/// \param[in] sync The lock.
+///
+/// \return The protected container.
+void *
+syn_target(Synchronized_t *sync)
+{
+    return sync->target;
+}
+
+/// \param[in] sync The lock.
+///
+/// \return A copy of the statistics.
+SyncStats_t
+syn_stats(Synchronized_t *sync)
+{
+    SyncStats_t stats;
+
+    stats.reads = atomic_load(&sync->reads);
+    stats.read_time = atomic_load(&sync->read_time);
+    stats.read_max = atomic_load(&sync->read_max);
+    stats.writes = atomic_load(&sync->writes);
+    stats.write_time = atomic_load(&sync->write_time);
+    stats.write_max = atomic_load(&sync->write_max);
+    stats.optimistic = atomic_load(&sync->optimistic);
+    stats.retries = atomic_load(&sync->retries);
+    stats.waits = atomic_load(&sync->waits);
+    stats.wait_time = atomic_load(&sync->wait_time);
+
+    return stats;
+}
+
+/// Measuring hold times costs two clock readings per section. Sections are
+/// still counted when timing is disabled.
+///
+/// \param[in] sync The lock.
+/// \param[in] timing If lock hold times should be measured.
+void
+syn_set_timing(Synchronized_t *sync, bool timing)
+{
+    atomic_store(&sync->timing, timing);
+}
+
+/// \param[in] sync The lock.
+void
+syn_reset_stats(Synchronized_t *sync)
+{
+    atomic_store(&sync->reads, 0);
+    atomic_store(&sync->read_time, 0);
+    atomic_store(&sync->read_max, 0);
+    atomic_store(&sync->writes, 0);
+    atomic_store(&sync->write_time, 0);
+    atomic_store(&sync->write_max, 0);
+    atomic_store(&sync->optimistic, 0);
+    atomic_store(&sync->retries, 0);
+    atomic_store(&sync->waits, 0);
+    atomic_store(&sync->wait_time, 0);
+}
+
+/// Takes the lock for reading. Blocks while a write section is running.
+///
+/// \param[in] sync The lock.
+///
+/// \return A ticket to be given to syn_read_end().
+unsigned_t
+syn_read_begin(Synchronized_t *sync)
+{
+    syn_lock(sync, false);
+
+    return atomic_load_explicit(&sync->timing, memory_order_relaxed)
+           ? syn_now() : 0;
+}
+
+/// \param[in] sync The lock.
+/// \param[in] ticket The value returned by syn_read_begin().
+void
+syn_read_end(Synchronized_t *sync, unsigned_t ticket)
+{
+    atomic_fetch_add_explicit(&sync->reads, 1, memory_order_relaxed);
+
+    if (ticket != 0)
+        syn_record(&sync->read_time, &sync->read_max, ticket);
+
+    pthread_rwlock_unlock(&sync->lock);
+}
+
+/// Takes the lock for writing and invalidates running optimistic reads.
+/// Blocks while any other section is running.
+///
+/// \param[in] sync The lock.
+void
+syn_write_begin(Synchronized_t *sync)
+{
+    syn_lock(sync, true);
+
+    unsigned_t sequence = atomic_load_explicit(&sync->sequence,
+                                               memory_order_relaxed);
+
+    atomic_store_explicit(&sync->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    sync->write_start = atomic_load_explicit(&sync->timing,
+                                             memory_order_relaxed)
+                        ? syn_now() : 0;
+}
+
+/// \param[in] sync The lock.
+void
+syn_write_end(Synchronized_t *sync)
+{
+    atomic_fetch_add_explicit(&sync->writes, 1, memory_order_relaxed);
+
+    if (sync->write_start != 0)
+        syn_record(&sync->write_time, &sync->write_max, sync->write_start);
+
+    unsigned_t sequence = atomic_load_explicit(&sync->sequence,
+                                               memory_order_relaxed);
+
+    atomic_store_explicit(&sync->sequence, sequence + 1, memory_order_release);
+
+    pthread_rwlock_unlock(&sync->lock);
+}
+
+/// Waits until no write section is running and returns the current sequence
+/// number.
+///
+/// \param[in] sync The lock.
+///
+/// \return A sequence number to be given to syn_optimistic_validate().
+unsigned_t
+syn_optimistic_begin(Synchronized_t *sync)
+{
+    unsigned_t sequence;
+
+    while ((sequence = atomic_load_explicit(&sync->sequence,
+                                            memory_order_acquire)) & 1)
+        continue;
+
+    return sequence;
+}
+
+/// \param[in] sync The lock.
+/// \param[in] sequence The value returned by syn_optimistic_begin().
+///
+/// \return True if the values read since syn_optimistic_begin() are valid.
+bool
+syn_optimistic_validate(Synchronized_t *sync, unsigned_t sequence)
+{
+    atomic_thread_fence(memory_order_acquire);
+
+    if (atomic_load_explicit(&sync->sequence, memory_order_relaxed)
+        == sequence)
+    {
+        atomic_fetch_add_explicit(&sync->optimistic, 1, memory_order_relaxed);
+        return true;
+    }
+
+    atomic_fetch_add_explicit(&sync->retries, 1, memory_order_relaxed);
+
+    return false;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Current time in nanoseconds, never zero
+static unsigned_t
+syn_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned_t)now.tv_sec * 1000000000 + (unsigned_t)now.tv_nsec + 1;
+}
+
+static void
+syn_record(_Atomic(unsigned_t) *total, _Atomic(unsigned_t) *max,
+           unsigned_t start)
+{
+    unsigned_t now = syn_now();
+    unsigned_t elapsed = now > start ? now - start : 0;
+
+    atomic_fetch_add_explicit(total, elapsed, memory_order_relaxed);
+
+    unsigned_t current = atomic_load_explicit(max, memory_order_relaxed);
+
+    while (elapsed > current
+           && !atomic_compare_exchange_weak_explicit(max, &current, elapsed,
+                                                     memory_order_relaxed,
+                                                     memory_order_relaxed))
+        continue;
+}
+
+// Tries the lock first so uncontended sections cost nothing more. Otherwise
+// counts a wait and, if timing is enabled, how long it took.
+static void
+syn_lock(Synchronized_t *sync, bool write)
+{
+    if ((write ? pthread_rwlock_trywrlock(&sync->lock)
+               : pthread_rwlock_tryrdlock(&sync->lock)) == 0)
+        return;
+
+    atomic_fetch_add_explicit(&sync->waits, 1, memory_order_relaxed);
+
+    unsigned_t start = atomic_load_explicit(&sync->timing,
+                                            memory_order_relaxed)
+                       ? syn_now() : 0;
+
+    if (write)
+        pthread_rwlock_wrlock(&sync->lock);
+    else
+        pthread_rwlock_rdlock(&sync->lock);
+
+    if (start != 0)
+    {
+        unsigned_t now = syn_now();
+
+        atomic_fetch_add_explicit(&sync->wait_time, now - start,
+                                  memory_order_relaxed);
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,324 @@
+/**
+ * @file ThreadPool.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ThreadPool.h"
+#include <pthread.h>
+
+/// A ThreadPool_s keeps a fixed amount of threads alive and hands them tasks
+/// from a queue. Creating threads is expensive, so a pool is meant to be
+/// created once and reused for many batches of work: submit tasks with
+/// tpl_submit() and block until all of them are done with tpl_wait().
+///
+/// Tasks are kept in a circular buffer that grows when needed. All fields are
+/// protected by \c lock.
+///
+/// \par Functions
+/// Located in the file ThreadPool.c
+struct ThreadPool_s
+{
+    /// \brief Worker threads.
+    ///
+    /// Buffer with the handles of all threads.
+    pthread_t *threads;
+
+    /// \brief Amount of threads.
+    ///
+    /// Amount of threads in \c threads.
+    integer_t thread_count;
+
+    /// \brief Task queue.
+    ///
+    /// Circular buffer of tasks not yet picked up by a thread.
+    struct ThreadPoolTask_s *queue;
+
+    /// \brief Queue capacity.
+    ///
+    /// Size of the \c queue buffer.
+    integer_t capacity;
+
+    /// \brief Front of the queue.
+    ///
+    /// Index of the next task to be picked up.
+    integer_t front;
+
+    /// \brief Amount of queued tasks.
+    ///
+    /// Amount of tasks in \c queue.
+    integer_t count;
+
+    /// \brief Unfinished tasks.
+    ///
+    /// Amount of tasks either queued or running.
+    integer_t pending;
+
+    /// \brief Shutdown flag.
+    ///
+    /// When true, threads exit as soon as the queue is empty.
+    bool shutdown;
+
+    /// \brief Pool lock.
+    ///
+    /// Protects every other field.
+    pthread_mutex_t lock;
+
+    /// \brief Work condition.
+    ///
+    /// Signaled when a task is queued or the pool shuts down.
+    pthread_cond_t work;
+
+    /// \brief Done condition.
+    ///
+    /// Signaled when \c pending reaches zero.
+    pthread_cond_t done;
+};
+
+/// \brief A ThreadPool_s task.
+///
+/// Implementation detail. A function and its argument.
+struct ThreadPoolTask_s
+{
+    /// \brief Task function.
+    task_f task;
+
+    /// \brief Task argument.
+    void *argument;
+};
+
+typedef struct ThreadPoolTask_s ThreadPoolTask_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void *
+tpl_worker(void *argument);
+
+static bool
+tpl_grow(ThreadPool_t *pool);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new ThreadPool_s and starts all of its threads.
+///
+/// \param[in] threads The amount of threads, greater than 0.
+///
+/// \return A new ThreadPool_s or NULL if \c threads is invalid or if any
+/// allocation or thread creation failed.
+ThreadPool_t *
+tpl_new(integer_t threads)
+{
+    if (threads < 1)
+        return NULL;
+
+    ThreadPool_t *pool = malloc(sizeof(ThreadPool_t));
+
+    if (!pool)
+        return NULL;
+
+    pool->threads = malloc(sizeof(pthread_t) * (size_t)threads);
+    pool->queue = malloc(sizeof(ThreadPoolTask_t) * 32);
+
+    if (!pool->threads || !pool->queue)
+    {
+        free(pool->threads);
+        free(pool->queue);
+        free(pool);
+
+        return NULL;
+    }
+
+    pool->thread_count = 0;
+    pool->capacity = 32;
+    pool->front = 0;
+    pool->count = 0;
+    pool->pending = 0;
+    pool->shutdown = false;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (integer_t i = 0; i < threads; i++)
+    {
+        if (pthread_create(&pool->threads[i], NULL, tpl_worker, pool) != 0)
+        {
+            tpl_free(pool);
+
+            return NULL;
+        }
+
+        pool->thread_count++;
+    }
+
+    return pool;
+}
+
+/// Waits for every queued task to finish, stops all threads and frees the
+/// pool from memory.
+///
+/// \param[in] pool The thread pool to be freed.
+void
+tpl_free(ThreadPool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    pool->shutdown = true;
+
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (integer_t i = 0; i < pool->thread_count; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work);
+    pthread_cond_destroy(&pool->done);
+
+    free(pool->threads);
+    free(pool->queue);
+    free(pool);
+}
+
+/// Returns the amount of threads in the pool.
+///
+/// \param[in] pool ThreadPool_s reference.
+///
+/// \return The amount of threads.
+integer_t
+tpl_threads(ThreadPool_t *pool)
+{
+    return pool->thread_count;
+}
+
+/// Returns the amount of tasks that were submitted and have not finished yet.
+///
+/// \param[in] pool ThreadPool_s reference.
+///
+/// \return The amount of queued or running tasks.
+integer_t
+tpl_pending(ThreadPool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    integer_t pending = pool->pending;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return pending;
+}
+
+/// Queues a task to be executed by one of the threads. Tasks are picked up
+/// in the order they were submitted but may finish in any order.
+///
+/// \param[in] pool ThreadPool_s reference.
+/// \param[in] task The function to be executed.
+/// \param[in] argument The argument given to \c task.
+///
+/// \return True if the task was queued or false if the queue could not grow.
+bool
+tpl_submit(ThreadPool_t *pool, task_f task, void *argument)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->count == pool->capacity && !tpl_grow(pool))
+    {
+        pthread_mutex_unlock(&pool->lock);
+
+        return false;
+    }
+
+    integer_t rear = (pool->front + pool->count) % pool->capacity;
+
+    pool->queue[rear].task = task;
+    pool->queue[rear].argument = argument;
+
+    pool->count++;
+    pool->pending++;
+
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    return true;
+}
+
+/// Blocks the calling thread until every submitted task has finished. Tasks
+/// must not call this function on their own pool.
+///
+/// \param[in] pool ThreadPool_s reference.
+void
+tpl_wait(ThreadPool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void *
+tpl_worker(void *argument)
+{
+    ThreadPool_t *pool = argument;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (true)
+    {
+        while (pool->count == 0 && !pool->shutdown)
+            pthread_cond_wait(&pool->work, &pool->lock);
+
+        if (pool->count == 0 && pool->shutdown)
+            break;
+
+        ThreadPoolTask_t task = pool->queue[pool->front];
+
+        pool->front = (pool->front + 1) % pool->capacity;
+        pool->count--;
+
+        pthread_mutex_unlock(&pool->lock);
+
+        task.task(task.argument);
+
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0)
+            pthread_cond_broadcast(&pool->done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// Doubles the queue, moving the queued tasks to the start of the new buffer.
+// Must be called with the lock held.
+static bool
+tpl_grow(ThreadPool_t *pool)
+{
+    integer_t new_capacity = pool->capacity * 2;
+
+    ThreadPoolTask_t *new_queue = malloc(sizeof(ThreadPoolTask_t)
+                                         * (size_t)new_capacity);
+
+    if (!new_queue)
+        return false;
+
+    for (integer_t i = 0; i < pool->count; i++)
+        new_queue[i] = pool->queue[(pool->front + i) % pool->capacity];
+
+    free(pool->queue);
+
+    pool->queue = new_queue;
+    pool->capacity = new_capacity;
+    pool->front = 0;
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,385 @@
+/**
+ * @file TimerWheel.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "TimerWheel.h"
+
+/// Bits of a tick covered by each level of the wheel.
+#define TWL_BITS 6
+
+/// Slots of each level.
+#define TWL_SLOTS (1 << TWL_BITS)
+
+/// Levels needed to cover every 64-bit tick. The last one only uses 4 bits.
+#define TWL_LEVELS 11
+
+/// A TimerWheel_s keeps timers in TWL_LEVELS levels of TWL_SLOTS slots each,
+/// where every slot is an IntrusiveList_s. Each level is a digit in base
+/// TWL_SLOTS of a tick. A timer is kept at the highest digit where its
+/// deadline differs from the current tick, in the slot given by the deadline's
+/// digit at that level, so scheduling and cancelling take constant time.
+///
+/// When the current tick reaches a slot of a level above the first one, the
+/// timers of that slot are cascaded to lower levels. When it reaches a slot of
+/// the first level, its timers expire. Empty slots are skipped with a bitmap
+/// per level, so advancing the wheel costs nothing for ticks without timers.
+///
+/// \par Functions
+/// Located in the file TimerWheel.c
+struct TimerWheel_s
+{
+    /// \brief The current tick.
+    uint64_t now;
+
+    /// \brief Amount of timers scheduled.
+    integer_t count;
+
+    /// \brief Offset of the TimerHook_s inside the elements.
+    size_t offset;
+
+    /// \brief One bit per slot that has at least one timer.
+    uint64_t occupied[TWL_LEVELS];
+
+    /// \brief Timers waiting for the current tick to reach their slot.
+    struct IntrusiveList_s slots[TWL_LEVELS][TWL_SLOTS];
+
+    /// \brief Timers scheduled at or before the current tick.
+    ///
+    /// They expire on the next call to twl_advance(). They are kept in the
+    /// order of their deadlines.
+    struct IntrusiveList_s pending;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static TimerHook_t *
+twl_hook(TimerWheel_t *wheel, void *element);
+
+static integer_t
+twl_digit(uint64_t tick, integer_t level);
+
+static IntrusiveList_t *
+twl_locate(TimerWheel_t *wheel, uint64_t deadline, integer_t *level,
+           integer_t *slot);
+
+static void
+twl_link(TimerWheel_t *wheel, void *element);
+
+static uint64_t
+twl_next_event(TimerWheel_t *wheel);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new timer wheel. Ticks have no unit; they can be the
+/// milliseconds given by clk_now() or any other monotonic counter.
+///
+/// \param[in] offset Offset of the TimerHook_s inside the elements, usually
+/// given with offsetof().
+/// \param[in] now The current tick.
+///
+/// \return A new timer wheel or NULL if allocation failed.
+TimerWheel_t *
+twl_new(size_t offset, uint64_t now)
+{
+    TimerWheel_t *wheel = malloc(sizeof(TimerWheel_t));
+
+    if (!wheel)
+        return NULL;
+
+    for (integer_t i = 0; i < TWL_LEVELS; i++)
+    {
+        for (integer_t j = 0; j < TWL_SLOTS; j++)
+            ilt_init(&wheel->slots[i][j], offset);
+
+        wheel->occupied[i] = 0;
+    }
+
+    ilt_init(&wheel->pending, offset);
+
+    wheel->now = now;
+    wheel->count = 0;
+    wheel->offset = offset;
+
+    return wheel;
+}
+
+/// Frees the wheel. Its timers are unscheduled but not freed, since they are
+/// owned by the user.
+///
+/// \param[in] wheel The timer wheel to be freed.
+void
+twl_free(TimerWheel_t *wheel)
+{
+    for (integer_t i = 0; i < TWL_LEVELS; i++)
+    {
+        for (integer_t j = 0; j < TWL_SLOTS; j++)
+            ilt_clear(&wheel->slots[i][j]);
+    }
+
+    ilt_clear(&wheel->pending);
+
+    free(wheel);
+}
+
+/// \param[in] wheel The timer wheel.
+///
+/// \return The amount of timers scheduled.
+integer_t
+twl_count(TimerWheel_t *wheel)
+{
+    return wheel->count;
+}
+
+/// \param[in] wheel The timer wheel.
+///
+/// \return The last tick given to twl_advance() or to twl_new().
+uint64_t
+twl_now(TimerWheel_t *wheel)
+{
+    return wheel->now;
+}
+
+/// \param[in] wheel The timer wheel.
+/// \param[in] element An element that was scheduled at least once.
+///
+/// \return The tick at which the timer expires or expired.
+uint64_t
+twl_deadline(TimerWheel_t *wheel, void *element)
+{
+    return twl_hook(wheel, element)->deadline;
+}
+
+/// Schedules a timer in constant time. A timer that is already scheduled in
+/// the wheel is moved to its new deadline. A deadline at or before the
+/// current tick expires on the next call to twl_advance(); such a timer
+/// takes time proportional to the overdue timers with later deadlines.
+///
+/// \warning An element that is in a list of expired timers has to be removed
+/// from it before it is scheduled again.
+///
+/// \param[in] wheel The timer wheel.
+/// \param[in] element The element to be scheduled.
+/// \param[in] deadline The tick at which the timer expires.
+void
+twl_schedule(TimerWheel_t *wheel, void *element, uint64_t deadline)
+{
+    twl_cancel(wheel, element);
+
+    twl_hook(wheel, element)->deadline = deadline;
+
+    twl_link(wheel, element);
+
+    wheel->count++;
+}
+
+/// Cancels a timer in constant time, so it never expires.
+///
+/// \param[in] wheel The timer wheel.
+/// \param[in] element The element to be cancelled.
+///
+/// \return True if the timer was scheduled, otherwise false.
+bool
+twl_cancel(TimerWheel_t *wheel, void *element)
+{
+    if (!twl_scheduled(wheel, element))
+        return false;
+
+    integer_t level, slot;
+
+    IntrusiveList_t *list = twl_locate(wheel,
+            twl_hook(wheel, element)->deadline, &level, &slot);
+
+    ilt_remove(list, element);
+
+    if (list != &wheel->pending && ilt_empty(list))
+        wheel->occupied[level] &= ~((uint64_t)1 << slot);
+
+    wheel->count--;
+
+    return true;
+}
+
+/// Moves the wheel to a given tick and appends every timer that expired to a
+/// list, in the order of their deadlines. The list must be initialized with
+/// the same offset given to twl_new(). Its timers are no longer scheduled but
+/// their hooks are linked to it until they are removed from the list.
+///
+/// \param[in] wheel The timer wheel.
+/// \param[in] now The new current tick. Ticks before the current one are
+/// ignored.
+/// \param[in] expired The list where the expired timers are appended.
+///
+/// \return The amount of timers that expired.
+integer_t
+twl_advance(TimerWheel_t *wheel, uint64_t now, IntrusiveList_t *expired)
+{
+    integer_t count = ilt_count(&wheel->pending);
+
+    ilt_append(expired, &wheel->pending);
+
+    while (wheel->now < now)
+    {
+        uint64_t next = twl_next_event(wheel);
+
+        if (next > now)
+        {
+            // No slot is reached on the way, so every timer stays where it is
+            wheel->now = now;
+            break;
+        }
+
+        wheel->now = next;
+
+        // Higher levels cascade into lower ones, which are handled after
+        for (integer_t level = TWL_LEVELS - 1; level >= 0; level--)
+        {
+            integer_t slot = twl_digit(next, level);
+
+            if (!(wheel->occupied[level] & ((uint64_t)1 << slot)))
+                continue;
+
+            IntrusiveList_t *list = &wheel->slots[level][slot];
+
+            wheel->occupied[level] &= ~((uint64_t)1 << slot);
+
+            void *element;
+
+            while ((element = ilt_remove_head(list)) != NULL)
+            {
+                if (twl_hook(wheel, element)->deadline <= next)
+                {
+                    ilt_insert_tail(expired, element);
+                    count++;
+                }
+                else
+                {
+                    twl_link(wheel, element);
+                }
+            }
+        }
+    }
+
+    wheel->count -= count;
+
+    return count;
+}
+
+/// \param[in] wheel The timer wheel.
+///
+/// \return True if no timers are scheduled.
+bool
+twl_empty(TimerWheel_t *wheel)
+{
+    return wheel->count == 0;
+}
+
+/// Checks if a timer is linked. Its hook must have been zero initialized
+/// before it was first scheduled.
+///
+/// \param[in] wheel The timer wheel.
+/// \param[in] element The element to be checked.
+///
+/// \return True if the timer is scheduled or in a list of expired timers.
+bool
+twl_scheduled(TimerWheel_t *wheel, void *element)
+{
+    return ilt_linked(&wheel->pending, element);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static TimerHook_t *
+twl_hook(TimerWheel_t *wheel, void *element)
+{
+    return (TimerHook_t *)((char *)element + wheel->offset);
+}
+
+static integer_t
+twl_digit(uint64_t tick, integer_t level)
+{
+    return (integer_t)((tick >> (TWL_BITS * level)) & (TWL_SLOTS - 1));
+}
+
+// Returns the list where a timer with the given deadline is kept
+static IntrusiveList_t *
+twl_locate(TimerWheel_t *wheel, uint64_t deadline, integer_t *level,
+           integer_t *slot)
+{
+    if (deadline <= wheel->now)
+        return &wheel->pending;
+
+    integer_t bit = 63 - __builtin_clzll(deadline ^ wheel->now);
+
+    *level = bit / TWL_BITS;
+    *slot = twl_digit(deadline, *level);
+
+    return &wheel->slots[*level][*slot];
+}
+
+static void
+twl_link(TimerWheel_t *wheel, void *element)
+{
+    integer_t level, slot;
+
+    IntrusiveList_t *list = twl_locate(wheel,
+            twl_hook(wheel, element)->deadline, &level, &slot);
+
+    if (list != &wheel->pending)
+    {
+        ilt_insert_tail(list, element);
+
+        wheel->occupied[level] |= (uint64_t)1 << slot;
+
+        return;
+    }
+
+    // Overdue timers are usually scheduled in order, so the search starts
+    // from the latest deadline
+    uint64_t deadline = twl_hook(wheel, element)->deadline;
+    void *position = ilt_tail(list);
+
+    while (position && twl_hook(wheel, position)->deadline > deadline)
+        position = ilt_prev(list, position);
+
+    if (position)
+        ilt_insert_after(list, position, element);
+    else
+        ilt_insert_head(list, element);
+}
+
+// The first tick after the current one where a slot with timers is reached,
+// or UINT64_MAX if there are no timers. Every slot with timers in a level is
+// after the current tick's digit in that level.
+static uint64_t
+twl_next_event(TimerWheel_t *wheel)
+{
+    uint64_t next = UINT64_MAX;
+
+    for (integer_t level = 0; level < TWL_LEVELS; level++)
+    {
+        if (wheel->occupied[level] == 0)
+            continue;
+
+        integer_t shift = TWL_BITS * level;
+
+        // Digits above this level are kept and digits below are zero
+        uint64_t prefix = 0;
+
+        if (level < TWL_LEVELS - 1)
+            prefix = wheel->now >> (shift + TWL_BITS) << (shift + TWL_BITS);
+
+        uint64_t slot = (uint64_t)__builtin_ctzll(wheel->occupied[level]);
+        uint64_t tick = prefix | slot << shift;
+
+        if (tick < next)
+            next = tick;
+    }
+
+    return next;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,381 @@
+/**
+ * @file TopK.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "TopK.h"
+
+/// A TopK_s keeps the k highest elements of a stream of any length. They are
+/// kept in a min-heap whose buffer is allocated once with room for k elements
+/// and locked, so memory never grows with the stream. The root of the heap is
+/// the lowest element kept and a new element is only admitted if it is
+/// higher, in which case it replaces the root. Admitting an element takes
+/// O(log k) and rejecting it a single comparison.
+///
+/// Elements that don't make it, either because they were rejected or because
+/// they were pushed out, are freed with the interface.
+///
+/// \par Functions
+/// Located in the file TopK.c
+struct TopK_s
+{
+    /// \brief Min-heap with the elements kept.
+    Heap_t *heap;
+
+    /// \brief Maximum amount of elements kept.
+    integer_t k;
+
+    /// \brief Amount of elements offered so far.
+    unsigned_t seen;
+
+    /// \brief TopK_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    Interface_t *interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+tpk_offer(TopK_t *topk, void *element);
+
+static void **
+tpk_sorted(TopK_t *topk);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new TopK_s. The buffer for all k elements is allocated here.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// top-k container to operate.
+/// \param[in] k Maximum amount of elements kept.
+///
+/// \return A new TopK_s or NULL if allocation failed or k is not positive.
+TopK_t *
+tpk_new(Interface_t *interface, integer_t k)
+{
+    if (k < 1)
+        return NULL;
+
+    TopK_t *topk = malloc(sizeof(TopK_t));
+
+    if (!topk)
+        return NULL;
+
+    topk->heap = hep_create(interface, k, 200, MinHeap);
+
+    if (!topk->heap)
+    {
+        free(topk);
+        return NULL;
+    }
+
+    hep_capacity_lock(topk->heap);
+
+    topk->k = k;
+    topk->seen = 0;
+    topk->interface = interface;
+
+    return topk;
+}
+
+/// Frees from memory a TopK_s and every element it keeps.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] topk The TopK_s to be freed from memory.
+void
+tpk_free(TopK_t *topk)
+{
+    hep_free(topk->heap);
+
+    free(topk);
+}
+
+/// Frees every element kept so the TopK_s can be used for a new stream.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] topk The TopK_s to be erased.
+void
+tpk_erase(TopK_t *topk)
+{
+    hep_erase(topk->heap);
+
+    topk->seen = 0;
+}
+
+/// \param[in] topk The TopK_s.
+///
+/// \return The maximum amount of elements kept.
+integer_t
+tpk_k(TopK_t *topk)
+{
+    return topk->k;
+}
+
+/// \param[in] topk The TopK_s.
+///
+/// \return The amount of elements kept, never more than k.
+integer_t
+tpk_count(TopK_t *topk)
+{
+    return hep_count(topk->heap);
+}
+
+/// Returns the amount of calls to tpk_insert(). After a tpk_merge() it is the
+/// sum of both counts.
+///
+/// \param[in] topk The TopK_s.
+///
+/// \return The amount of elements offered so far.
+unsigned_t
+tpk_seen(TopK_t *topk)
+{
+    return topk->seen;
+}
+
+/// Checks if an element would be kept without inserting it, so that the
+/// caller only allocates elements that make it into the top k.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] topk The TopK_s.
+/// \param[in] element The element to be checked.
+///
+/// \return True if the TopK_s is not full or the element is higher than the
+/// lowest element kept.
+bool
+tpk_admits(TopK_t *topk, void *element)
+{
+    if (!tpk_full(topk))
+        return true;
+
+    return topk->interface->compare(element, hep_peek(topk->heap)) > 0;
+}
+
+/// Offers an element to the TopK_s, which takes ownership of it. If it is
+/// admitted and the TopK_s is full, the lowest element kept is freed.
+/// Otherwise the element itself is freed. Elements equal to the lowest one
+/// kept are not admitted.
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] topk The TopK_s.
+/// \param[in] element The element to be offered.
+///
+/// \return True if the element was kept, false if it was freed.
+bool
+tpk_insert(TopK_t *topk, void *element)
+{
+    topk->seen++;
+
+    return tpk_offer(topk, element);
+}
+
+/// \param[in] topk The TopK_s.
+///
+/// \return The lowest element kept or NULL if the TopK_s is empty.
+void *
+tpk_peek(TopK_t *topk)
+{
+    return hep_peek(topk->heap);
+}
+
+/// \param[in] topk The TopK_s.
+///
+/// \return True if no elements are kept.
+bool
+tpk_empty(TopK_t *topk)
+{
+    return hep_empty(topk->heap);
+}
+
+/// \param[in] topk The TopK_s.
+///
+/// \return True if k elements are kept.
+bool
+tpk_full(TopK_t *topk)
+{
+    return hep_count(topk->heap) == topk->k;
+}
+
+/// Offers every element of topk2 to topk1, leaving topk2 empty. The result
+/// keeps the k highest elements of both streams, so a TopK_s per thread can
+/// be combined at the end.
+///
+/// \warning Both containers must have the same interface and handling the same
+/// data type, otherwise you'll be mixing elements into a container that
+/// doesn't know how to handle it (probably crashing).
+///
+/// \par Interface Requirements
+/// - compare
+/// - free
+///
+/// \param[in] topk1 The TopK_s that receives the elements.
+/// \param[in] topk2 The TopK_s whose elements are offered.
+///
+/// \return True if the elements were merged or false if both are the same.
+bool
+tpk_merge(TopK_t *topk1, TopK_t *topk2)
+{
+    if (topk1 == topk2)
+        return false;
+
+    void *element;
+
+    while (hep_remove(topk2->heap, &element))
+        tpk_offer(topk1, element);
+
+    topk1->seen += topk2->seen;
+    topk2->seen = 0;
+
+    return true;
+}
+
+/// Makes a copy of every element kept, in order from the highest to the
+/// lowest.
+///
+/// \par Interface Requirements
+/// - copy
+/// - free
+///
+/// \param[in] topk The TopK_s.
+/// \param[out] length The amount of elements in the returned buffer.
+///
+/// \return A buffer with the copies, NULL if the TopK_s is empty or if
+/// allocation failed.
+void **
+tpk_to_array(TopK_t *topk, integer_t *length)
+{
+    *length = 0;
+
+    if (tpk_empty(topk))
+        return NULL;
+
+    void **array = tpk_sorted(topk);
+
+    if (!array)
+        return NULL;
+
+    integer_t count = hep_count(topk->heap);
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        array[i] = interface_copy(topk->interface, array[i]);
+
+        if (!array[i])
+        {
+            for (integer_t j = 0; j < i; j++)
+                interface_release(topk->interface, array[j]);
+
+            free(array);
+
+            return NULL;
+        }
+    }
+
+    *length = count;
+
+    return array;
+}
+
+/// Displays the elements kept, from the highest to the lowest.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] topk The TopK_s to be displayed.
+void
+tpk_display(TopK_t *topk)
+{
+    if (tpk_empty(topk))
+    {
+        printf("\nTopK\n[ empty ]\n");
+        return;
+    }
+
+    void **array = tpk_sorted(topk);
+
+    if (!array)
+        return;
+
+    printf("\nTopK\n[ ");
+
+    for (integer_t i = 0; i < hep_count(topk->heap); i++)
+    {
+        if (i > 0)
+            printf(", ");
+
+        topk->interface->display(array[i]);
+    }
+
+    printf(" ]\n");
+
+    free(array);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Keeps or frees an element. A full heap has its root replaced, so its
+// locked buffer always has room.
+static bool
+tpk_offer(TopK_t *topk, void *element)
+{
+    if (!tpk_admits(topk, element))
+    {
+        interface_release(topk->interface, element);
+
+        return false;
+    }
+
+    void *lowest;
+
+    if (tpk_full(topk) && hep_remove(topk->heap, &lowest))
+        interface_release(topk->interface, lowest);
+
+    return hep_insert(topk->heap, element);
+}
+
+// Removes the elements from a shallow copy of the heap, from the lowest to the
+// highest, filling the buffer from its end
+static void **
+tpk_sorted(TopK_t *topk)
+{
+    integer_t count = hep_count(topk->heap);
+
+    void **array = malloc(sizeof(void *) * (size_t)count);
+
+    if (!array)
+        return NULL;
+
+    Heap_t *copy = hep_copy_shallow(topk->heap);
+
+    if (!copy)
+    {
+        free(array);
+        return NULL;
+    }
+
+    for (integer_t i = count - 1; i >= 0; i--)
+        hep_remove(copy, &array[i]);
+
+    hep_free_shallow(copy);
+
+    return array;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,1031 @@
+/**
+ * @file ValueArray.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueArray.h"
+#include "MappedFile.h"
+#include "SearchKernels.h"
+#include "Utility.h"
+
+/// A ValueArray_s is a dynamic array that stores its elements by value. While
+/// a DynamicArray_s keeps a buffer of pointers to elements that were each
+/// allocated on their own, a ValueArray_s keeps the elements themselves next
+/// to each other in a single buffer. The size of each element is given when
+/// the array is created and elements are copied in and out of the buffer with
+/// memcpy().
+///
+/// This saves one allocation and one pointer per element and, since all
+/// elements are contiguous, traversing, searching and sorting the array
+/// touch far less memory. The drawback is that only plain data types, that
+/// can be copied byte by byte, can be stored.
+///
+/// An array opened with var_map() keeps its buffer in a file mapped in memory,
+/// so a large array is there again, without reading it, the next time the
+/// file is mapped.
+///
+/// Inserting and removing elements at the end of the buffer is also what a
+/// stack does, so a ValueArray_s can be used as a by-value StackArray_s with
+/// var_insert_back(), var_remove_back() and var_peek_back().
+///
+/// \par Advantages over DynamicArray_s
+/// - One allocation for all elements
+/// - Elements are contiguous in memory
+///
+/// \par Drawbacks
+/// - Only elements that can be copied with memcpy() can be stored
+/// - Pointers returned by var_get() are invalidated when the buffer grows
+///
+/// \par Functions
+/// Located in the file ValueArray.c
+struct ValueArray_s
+{
+    /// \brief Data buffer.
+    ///
+    /// Buffer where elements are stored in, one after the other.
+    unsigned char *buffer;
+
+    /// \brief Element size.
+    ///
+    /// The size in bytes of each element.
+    size_t element_size;
+
+    /// \brief Current amount of elements in the ValueArray_s.
+    ///
+    /// Current amount of elements in the ValueArray_s.
+    integer_t size;
+
+    /// \brief Buffer maximum capacity.
+    ///
+    /// Buffer maximum capacity. When \c size reaches \c capacity the buffer is
+    /// reallocated and increases according to \c growth_rate.
+    integer_t capacity;
+
+    /// \brief Buffer growth rate.
+    ///
+    /// Buffer growth rate. The new buffer capacity is calculated as:
+    ///
+    /// <code> capacity *= (growth_rate / 100.0) </code>
+    integer_t growth_rate;
+
+    /// \brief Flag for locked capacity.
+    ///
+    /// If \c locked is set to true the buffer will not grow.
+    bool locked;
+
+    /// \brief ValueArray_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. Only the compare and display
+    /// functions are used since elements are copied with memcpy().
+    struct Interface_s *interface;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified. The iterator can only function if its version_id is the same
+    /// as the structure's version id, that is, there have been no structural
+    /// modifications (except for those done by the iterator itself).
+    integer_t version_id;
+
+    /// \brief The file that holds the buffer.
+    ///
+    /// Set by var_map(), otherwise NULL and the buffer is allocated in memory.
+    struct MappedFile_s *file;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+var_grow(ValueArray_t *array, integer_t required_capacity);
+
+static bool
+var_reallocate(ValueArray_t *array, integer_t capacity);
+
+static int
+var_integer_width(ValueArray_t *array, bool ordered);
+
+static integer_t
+var_extremum(ValueArray_t *array, int sign);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a ValueArray_s with an initial capacity of 32 and a growth rate
+/// of 200, that is, twice the size after each growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// array to operate.
+/// \param[in] element_size The size in bytes of each element.
+///
+/// \return A new ValueArray_s or NULL if allocation failed or if
+/// \c element_size is 0.
+ValueArray_t *
+var_new(Interface_t *interface, size_t element_size)
+{
+    return var_create(interface, element_size, 32, 200);
+}
+
+/// Initializes a ValueArray_s with a user defined \c initial_capacity and
+/// \c growth_rate. This function only accepts an \c initial_capacity greater
+/// than 0 and a \c growth_rate greater than 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// array to operate.
+/// \param[in] element_size The size in bytes of each element.
+/// \param[in] initial_capacity Buffer initial capacity.
+/// \param[in] growth_rate Buffer growth rate.
+///
+/// \return A new ValueArray_s or NULL if allocation failed or if any of the
+/// parameters is invalid.
+ValueArray_t *
+var_create(Interface_t *interface, size_t element_size,
+           integer_t initial_capacity, integer_t growth_rate)
+{
+    if (element_size == 0 || initial_capacity < 1 || growth_rate <= 100)
+        return NULL;
+
+    ValueArray_t *array = malloc(sizeof(ValueArray_t));
+
+    if (!array)
+        return NULL;
+
+    array->buffer = malloc(element_size * (size_t)initial_capacity);
+
+    if (!array->buffer)
+    {
+        free(array);
+
+        return NULL;
+    }
+
+    array->element_size = element_size;
+    array->capacity = initial_capacity;
+    array->growth_rate = growth_rate;
+    array->size = 0;
+    array->locked = false;
+    array->version_id = 0;
+    array->file = NULL;
+
+    array->interface = interface;
+
+    return array;
+}
+
+/// Opens a ValueArray_s whose buffer lives in the file at \c path, mapped in
+/// memory, with a growth rate of 200. If the file doesn't exist it is created
+/// with a capacity of 32 elements. Otherwise the elements stored in it are
+/// used right away, without reading them. The file must have been created
+/// with the same \c element_size.
+///
+/// Changes to the elements are written to the file by the operating system,
+/// even if the process crashes. The amount of elements is only stored by
+/// var_sync() and var_free(), and only var_sync() makes sure everything
+/// survives a crash of the whole system. Growing the buffer resizes the file.
+/// The file can only be opened by one array at a time.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// array to operate.
+/// \param[in] path The path of the file.
+/// \param[in] element_size The size in bytes of each element.
+///
+/// \return A ValueArray_s kept in the file or NULL if the file could not be
+/// opened or mapped, or if it holds another kind of container or elements of
+/// another size.
+ValueArray_t *
+var_map(Interface_t *interface, const char *path, size_t element_size)
+{
+    if (element_size == 0)
+        return NULL;
+
+    ValueArray_t *array = malloc(sizeof(ValueArray_t));
+
+    if (!array)
+        return NULL;
+
+    array->file = mpf_open(path, MappedValueArray, element_size,
+                           element_size * 32);
+
+    if (!array->file)
+    {
+        free(array);
+
+        return NULL;
+    }
+
+    array->buffer = mpf_data(array->file);
+    array->element_size = element_size;
+    array->capacity = (integer_t)(mpf_bytes(array->file) / element_size);
+    array->growth_rate = 200;
+    array->size = (integer_t)mpf_header(array->file)->count;
+    array->locked = false;
+    array->version_id = 0;
+
+    array->interface = interface;
+
+    // The file was cut short by someone else
+    if (array->size > array->capacity)
+    {
+        mpf_close(array->file);
+        free(array);
+
+        return NULL;
+    }
+
+    return array;
+}
+
+/// Frees from memory the ValueArray_s buffer and structure. Since elements are
+/// stored by value there is nothing else to be freed.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The array to be freed from memory.
+void
+var_free(ValueArray_t *array)
+{
+    if (array->file)
+    {
+        mpf_header(array->file)->count = (uint64_t)array->size;
+        mpf_close(array->file);
+    }
+    else
+        free(array->buffer);
+
+    free(array);
+}
+
+/// Writes the elements of an array opened with var_map() to its file and
+/// waits until they are stored, so they survive a crash of the system.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return True if the elements were written or false if it failed or if the
+/// array is not kept in a file.
+bool
+var_sync(ValueArray_t *array)
+{
+    if (!array->file)
+        return false;
+
+    mpf_header(array->file)->count = (uint64_t)array->size;
+
+    return mpf_sync(array->file);
+}
+
+/// Removes all elements from the array. The buffer keeps its capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+void
+var_erase(ValueArray_t *array)
+{
+    array->size = 0;
+    array->version_id++;
+}
+
+/// Sets a new interface for the target array.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] new_interface The new interface.
+void
+var_config(ValueArray_t *array, Interface_t *new_interface)
+{
+    array->interface = new_interface;
+}
+
+/// Returns the amount of elements in the array.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The amount of elements in the array.
+integer_t
+var_size(ValueArray_t *array)
+{
+    return array->size;
+}
+
+/// Returns the buffer's capacity, in elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The buffer's capacity.
+integer_t
+var_capacity(ValueArray_t *array)
+{
+    return array->capacity;
+}
+
+/// Returns the size in bytes of each element.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The size of each element.
+size_t
+var_element_size(ValueArray_t *array)
+{
+    return array->element_size;
+}
+
+/// Returns the buffer's growth rate.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The buffer's growth rate.
+integer_t
+var_growth(ValueArray_t *array)
+{
+    return array->growth_rate;
+}
+
+/// Returns true if the buffer's growth is locked, false otherwise.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return True if the buffer will not grow.
+bool
+var_locked(ValueArray_t *array)
+{
+    return array->locked;
+}
+
+/// Returns a pointer to the element at a given index. The pointer is valid
+/// until the buffer grows or the element is moved by an insertion or a
+/// removal.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] index The element's index.
+///
+/// \return A pointer to the element or NULL if the index is out of bounds.
+void *
+var_get(ValueArray_t *array, integer_t index)
+{
+    if (index < 0 || index >= array->size)
+        return NULL;
+
+    return array->buffer + (size_t)index * array->element_size;
+}
+
+/// Returns a pointer to the first element of the buffer. All elements are
+/// stored contiguously so this can be used as a plain C array of \c size
+/// elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return A pointer to the buffer.
+void *
+var_data(ValueArray_t *array)
+{
+    return array->buffer;
+}
+
+/// Sets a new growth rate to the buffer. It only accepts values greater than
+/// 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] growth_rate The new growth rate.
+///
+/// \return True if the growth rate was changed.
+bool
+var_set_growth(ValueArray_t *array, integer_t growth_rate)
+{
+    if (growth_rate <= 100)
+        return false;
+
+    array->growth_rate = growth_rate;
+
+    return true;
+}
+
+/// Locks the buffer's growth. Insertions will fail once it is full.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+void
+var_capacity_lock(ValueArray_t *array)
+{
+    array->locked = true;
+}
+
+/// Unlocks the buffer's growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+void
+var_capacity_unlock(ValueArray_t *array)
+{
+    array->locked = false;
+}
+
+/// Overwrites the element at a given index with a copy of \c element.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] index The element's index.
+/// \param[in] element A pointer to the new value.
+///
+/// \return True if the element was set or false if the index is out of
+/// bounds.
+bool
+var_set(ValueArray_t *array, integer_t index, const void *element)
+{
+    if (index < 0 || index >= array->size)
+        return false;
+
+    memcpy(array->buffer + (size_t)index * array->element_size, element,
+           array->element_size);
+
+    array->version_id++;
+
+    return true;
+}
+
+/// Inserts \c count elements, stored contiguously in \c elements, at a given
+/// index. All elements are copied at once.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] elements A pointer to the first element to be inserted.
+/// \param[in] count How many elements are to be inserted.
+/// \param[in] index Where the first element will be placed.
+///
+/// \return True if all elements were inserted, otherwise false.
+bool
+var_insert(ValueArray_t *array, const void *elements, integer_t count,
+           integer_t index)
+{
+    if (index < 0 || index > array->size || count < 1)
+        return false;
+
+    if (array->capacity - array->size < count)
+    {
+        if (!var_grow(array, array->size + count))
+            return false;
+    }
+
+    const size_t S = array->element_size;
+
+    unsigned char *position = array->buffer + (size_t)index * S;
+
+    memmove(position + (size_t)count * S, position,
+            (size_t)(array->size - index) * S);
+
+    memcpy(position, elements, (size_t)count * S);
+
+    array->size += count;
+    array->version_id++;
+
+    return true;
+}
+
+/// Inserts a copy of \c element at a given index, shifting all elements after
+/// it to the right.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] element A pointer to the element to be inserted.
+/// \param[in] index Where the element will be placed.
+///
+/// \return True if the element was inserted, otherwise false.
+bool
+var_insert_at(ValueArray_t *array, const void *element, integer_t index)
+{
+    return var_insert(array, element, 1, index);
+}
+
+/// Inserts a copy of \c element at the end of the array.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] element A pointer to the element to be inserted.
+///
+/// \return True if the element was inserted, otherwise false.
+bool
+var_insert_back(ValueArray_t *array, const void *element)
+{
+    if (var_full(array))
+    {
+        if (!var_grow(array, array->size + 1))
+            return false;
+    }
+
+    memcpy(array->buffer + (size_t)array->size * array->element_size,
+           element, array->element_size);
+
+    array->size++;
+    array->version_id++;
+
+    return true;
+}
+
+/// Removes the element at a given index, shifting all elements after it to
+/// the left. If \c result is not NULL the removed element is copied to it.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] index The index of the element to be removed.
+/// \param[out] result Where the removed element is copied to, or NULL.
+///
+/// \return True if the element was removed or false if the index is out of
+/// bounds.
+bool
+var_remove_at(ValueArray_t *array, integer_t index, void *result)
+{
+    if (index < 0 || index >= array->size)
+        return false;
+
+    const size_t S = array->element_size;
+
+    unsigned char *position = array->buffer + (size_t)index * S;
+
+    if (result)
+        memcpy(result, position, S);
+
+    memmove(position, position + S, (size_t)(array->size - index - 1) * S);
+
+    array->size--;
+    array->version_id++;
+
+    return true;
+}
+
+/// Removes the element at the end of the array. If \c result is not NULL the
+/// removed element is copied to it.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[out] result Where the removed element is copied to, or NULL.
+///
+/// \return True if the element was removed or false if the array is empty.
+bool
+var_remove_back(ValueArray_t *array, void *result)
+{
+    if (var_empty(array))
+        return false;
+
+    array->size--;
+
+    if (result)
+        memcpy(result,
+               array->buffer + (size_t)array->size * array->element_size,
+               array->element_size);
+
+    array->version_id++;
+
+    return true;
+}
+
+/// Returns a pointer to the element at the end of the array.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return A pointer to the last element or NULL if the array is empty.
+void *
+var_peek_back(ValueArray_t *array)
+{
+    return var_get(array, array->size - 1);
+}
+
+/// Returns true if the array is empty, otherwise false.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return True if the array is empty, otherwise false.
+bool
+var_empty(ValueArray_t *array)
+{
+    return array->size == 0;
+}
+
+/// Returns true if the array is full, otherwise false. The array can still
+/// grow if it is not locked.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return True if the buffer is full, otherwise false.
+bool
+var_full(ValueArray_t *array)
+{
+    return array->size >= array->capacity;
+}
+
+/// Makes sure the buffer can hold at least \c capacity elements without
+/// growing again. This works even if the array is locked.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] capacity The required capacity.
+///
+/// \return True if the buffer can hold \c capacity elements, otherwise false.
+bool
+var_reserve(ValueArray_t *array, integer_t capacity)
+{
+    if (capacity <= array->capacity)
+        return true;
+
+    return var_reallocate(array, capacity);
+}
+
+/// Returns the index of the first element that is equal to \c key according
+/// to the interface's compare function. If the array holds 32 or 64-bit
+/// integers compared with one of the comparators from Utility.h the buffer is
+/// searched with the vector kernels of SearchKernels.h instead.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] key A pointer to the value to be searched.
+///
+/// \return The index of the first matching element or -1 if it was not found.
+integer_t
+var_index_first(ValueArray_t *array, const void *key)
+{
+    switch (var_integer_width(array, false))
+    {
+        case 32:
+            return skn_find_int32_t((const int32_t*)array->buffer,
+                                    array->size, *(const int32_t*)key);
+        case 64:
+            return skn_find_int64_t((const int64_t*)array->buffer,
+                                    array->size, *(const int64_t*)key);
+        default:
+            break;
+    }
+
+    const size_t S = array->element_size;
+
+    unsigned char *scan = array->buffer;
+
+    for (integer_t i = 0; i < array->size; i++, scan += S)
+    {
+        if (array->interface->compare(scan, key) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+/// Returns true if an element equal to \c key is present in the array.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] key A pointer to the value to be searched.
+///
+/// \return True if the element is present, otherwise false.
+bool
+var_contains(ValueArray_t *array, const void *key)
+{
+    return var_index_first(array, key) >= 0;
+}
+
+/// Returns the index of the first greatest element according to the
+/// interface's compare function. Arrays of signed 32 or 64-bit integers
+/// compared with compare_int32_t() or compare_int64_t() use the vector
+/// kernels of SearchKernels.h.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The index of the greatest element or -1 if the array is empty.
+integer_t
+var_max(ValueArray_t *array)
+{
+    return var_extremum(array, 1);
+}
+
+/// Returns the index of the first smallest element according to the
+/// interface's compare function. Arrays of signed 32 or 64-bit integers
+/// compared with compare_int32_t() or compare_int64_t() use the vector
+/// kernels of SearchKernels.h.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return The index of the smallest element or -1 if the array is empty.
+integer_t
+var_min(ValueArray_t *array)
+{
+    return var_extremum(array, -1);
+}
+
+/// Sorts the array in ascending order. Since elements are stored by value the
+/// interface's compare function can be given to qsort() directly.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array ValueArray_s reference.
+void
+var_sort(ValueArray_t *array)
+{
+    if (array->size < 2)
+        return;
+
+    qsort(array->buffer, (size_t)array->size, array->element_size,
+          array->interface->compare);
+
+    array->version_id++;
+}
+
+/// Makes a copy of the array. All elements are copied at once with a single
+/// memcpy().
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array ValueArray_s reference.
+///
+/// \return A copy of the array or NULL if allocation failed.
+ValueArray_t *
+var_copy(ValueArray_t *array)
+{
+    ValueArray_t *result = var_create(array->interface, array->element_size,
+                                      array->capacity, array->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    memcpy(result->buffer, array->buffer,
+           array->element_size * (size_t)array->size);
+
+    result->size = array->size;
+    result->locked = array->locked;
+
+    return result;
+}
+
+/// Displays a ValueArray_s in the console. There are currently four modes:
+/// - -1 Displays each element separated by newline;
+/// -  0 Displays each element like a linked list;
+/// -  1 Displays each element separated by a space;
+/// - Any other number defaults to the array representation.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] array ValueArray_s reference.
+/// \param[in] display_mode The way the array is to be displayed.
+void
+var_display(ValueArray_t *array, int display_mode)
+{
+    if (var_empty(array))
+    {
+        printf("\nValueArray\n[ empty ]\n");
+        return;
+    }
+
+    const size_t S = array->element_size;
+
+    switch (display_mode)
+    {
+        case -1:
+            printf("\nValueArray\n");
+            for (integer_t i = 0; i < array->size; i++)
+            {
+                array->interface->display(array->buffer + (size_t)i * S);
+                printf("\n");
+            }
+            break;
+        case 0:
+            printf("\nValueArray\n");
+            for (integer_t i = 0; i < array->size - 1; i++)
+            {
+                array->interface->display(array->buffer + (size_t)i * S);
+                printf(" -> ");
+            }
+            array->interface->display(var_peek_back(array));
+            printf("\n");
+            break;
+        case 1:
+            printf("\nValueArray\n");
+            for (integer_t i = 0; i < array->size; i++)
+            {
+                array->interface->display(array->buffer + (size_t)i * S);
+                printf(" ");
+            }
+            printf("\n");
+            break;
+        default:
+            printf("\nValueArray\n[ ");
+            for (integer_t i = 0; i < array->size - 1; i++)
+            {
+                array->interface->display(array->buffer + (size_t)i * S);
+                printf(", ");
+            }
+            array->interface->display(var_peek_back(array));
+            printf(" ]\n");
+            break;
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+var_grow(ValueArray_t *array, integer_t required_capacity)
+{
+    if (array->locked)
+        return false;
+
+    integer_t old_capacity = array->capacity;
+
+    // capacity = capacity * (growth_rate / 100)
+    integer_t new_capacity = (integer_t) ((double) (array->capacity)
+            * ((double) (array->growth_rate) / 100.0));
+
+    // 4 is the minimum growth
+    if (new_capacity - old_capacity < 4)
+        new_capacity = old_capacity + 4;
+
+    // Not enough...
+    if (new_capacity < required_capacity)
+        new_capacity = required_capacity;
+
+    return var_reallocate(array, new_capacity);
+}
+
+// Moves the buffer to one that holds capacity elements, in memory or in the
+// file of the array
+static bool
+var_reallocate(ValueArray_t *array, integer_t capacity)
+{
+    size_t bytes = array->element_size * (size_t)capacity;
+
+    if (array->file)
+    {
+        if (!mpf_resize(array->file, bytes))
+            return false;
+
+        array->buffer = mpf_data(array->file);
+    }
+    else
+    {
+        unsigned char *new_buffer = realloc(array->buffer, bytes);
+
+        if (!new_buffer)
+            return false;
+
+        array->buffer = new_buffer;
+    }
+
+    array->capacity = capacity;
+    array->version_id++;
+
+    return true;
+}
+
+// Returns 32 or 64 if the elements are integers of that width compared by
+// one of the comparators from Utility.h, otherwise 0. The comparators of
+// unsigned integers only count when just equality is needed, since the
+// kernels order elements as signed integers.
+static int
+var_integer_width(ValueArray_t *array, bool ordered)
+{
+    compare_f compare = array->interface->compare;
+
+    if (array->element_size == sizeof(int32_t)
+        && (compare == compare_int32_t
+            || (!ordered && compare == compare_uint32_t)))
+        return 32;
+
+    if (array->element_size == sizeof(int64_t)
+        && (compare == compare_int64_t
+            || (!ordered && compare == compare_uint64_t)))
+        return 64;
+
+    return 0;
+}
+
+// Index of the first greatest element if sign is 1 or of the first smallest
+// if sign is -1
+static integer_t
+var_extremum(ValueArray_t *array, int sign)
+{
+    switch (var_integer_width(array, true))
+    {
+        case 32:
+            return sign > 0
+                   ? skn_max_int32_t((const int32_t*)array->buffer,
+                                     array->size)
+                   : skn_min_int32_t((const int32_t*)array->buffer,
+                                     array->size);
+        case 64:
+            return sign > 0
+                   ? skn_max_int64_t((const int64_t*)array->buffer,
+                                     array->size)
+                   : skn_min_int64_t((const int64_t*)array->buffer,
+                                     array->size);
+        default:
+            break;
+    }
+
+    if (array->size == 0)
+        return -1;
+
+    const size_t S = array->element_size;
+
+    integer_t best = 0;
+
+    for (integer_t i = 1; i < array->size; i++)
+    {
+        int c = array->interface->compare(array->buffer + S * (size_t)i,
+                                          array->buffer
+                                          + S * (size_t)best);
+
+        if (c * sign > 0)
+            best = i;
+    }
+
+    return best;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueArrayIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueArrayWrapper
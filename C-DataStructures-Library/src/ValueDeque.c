@@ -0,0 +1,707 @@
+/**
+ * @file ValueDeque.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueDeque.h"
+
+/// A ValueDeque_s is a double-ended queue backed by a circular buffer that
+/// stores its elements by value. It works just like a DequeArray_s except that
+/// elements are copied in and out of the buffer with memcpy() instead of being
+/// referenced by pointers. The size of each element is given when the deque
+/// is created.
+///
+/// Since a queue only inserts at the rear and removes at the front, a
+/// ValueDeque_s can be used as a by-value QueueArray_s with
+/// vdq_enqueue_rear(), vdq_dequeue_front() and vdq_peek_front().
+///
+/// \par Functions
+/// Located in the file ValueDeque.c
+struct ValueDeque_s
+{
+    /// \brief Data buffer.
+    ///
+    /// Circular buffer where elements are stored in.
+    unsigned char *buffer;
+
+    /// \brief Element size.
+    ///
+    /// The size in bytes of each element.
+    size_t element_size;
+
+    /// \brief Front of the deque.
+    ///
+    /// An index that represents the front of the deque.
+    integer_t front;
+
+    /// \brief Rear of the deque.
+    ///
+    /// An index that represents the position after the rear of the deque.
+    integer_t rear;
+
+    /// \brief Current amount of elements in the ValueDeque_s.
+    ///
+    /// Current amount of elements in the ValueDeque_s.
+    integer_t count;
+
+    /// \brief Buffer maximum capacity.
+    ///
+    /// Buffer maximum capacity. When \c count reaches \c capacity the buffer
+    /// is reallocated and increases according to \c growth_rate.
+    integer_t capacity;
+
+    /// \brief Buffer growth rate.
+    ///
+    /// Buffer growth rate. The new buffer capacity is calculated as:
+    ///
+    /// <code> capacity *= (growth_rate / 100.0) </code>
+    integer_t growth_rate;
+
+    /// \brief Flag for locked capacity.
+    ///
+    /// If \c locked is set to true the buffer will not grow.
+    bool locked;
+
+    /// \brief ValueDeque_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. Only the compare and display
+    /// functions are used since elements are copied with memcpy().
+    struct Interface_s *interface;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified. The iterator can only function if its version_id is the same
+    /// as the structure's version id, that is, there have been no structural
+    /// modifications (except for those done by the iterator itself).
+    integer_t version_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+vdq_grow(ValueDeque_t *deque);
+
+static unsigned char *
+vdq_at(ValueDeque_t *deque, integer_t position);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a ValueDeque_s with an initial capacity of 32 and a growth rate
+/// of 200, that is, twice the size after each growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// deque to operate.
+/// \param[in] element_size The size in bytes of each element.
+///
+/// \return A new ValueDeque_s or NULL if allocation failed or if
+/// \c element_size is 0.
+ValueDeque_t *
+vdq_new(Interface_t *interface, size_t element_size)
+{
+    return vdq_create(interface, element_size, 32, 200);
+}
+
+/// Initializes a ValueDeque_s with a user defined \c initial_capacity and
+/// \c growth_rate. This function only accepts an \c initial_capacity greater
+/// than 0 and a \c growth_rate greater than 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// deque to operate.
+/// \param[in] element_size The size in bytes of each element.
+/// \param[in] initial_capacity Buffer initial capacity.
+/// \param[in] growth_rate Buffer growth rate.
+///
+/// \return A new ValueDeque_s or NULL if allocation failed or if any of the
+/// parameters is invalid.
+ValueDeque_t *
+vdq_create(Interface_t *interface, size_t element_size,
+           integer_t initial_capacity, integer_t growth_rate)
+{
+    if (element_size == 0 || initial_capacity < 1 || growth_rate <= 100)
+        return NULL;
+
+    ValueDeque_t *deque = malloc(sizeof(ValueDeque_t));
+
+    if (!deque)
+        return NULL;
+
+    deque->buffer = malloc(element_size * (size_t)initial_capacity);
+
+    if (!deque->buffer)
+    {
+        free(deque);
+
+        return NULL;
+    }
+
+    deque->element_size = element_size;
+    deque->capacity = initial_capacity;
+    deque->growth_rate = growth_rate;
+    deque->front = 0;
+    deque->rear = 0;
+    deque->count = 0;
+    deque->locked = false;
+    deque->version_id = 0;
+
+    deque->interface = interface;
+
+    return deque;
+}
+
+/// Frees from memory the ValueDeque_s buffer and structure.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque The deque to be freed from memory.
+void
+vdq_free(ValueDeque_t *deque)
+{
+    free(deque->buffer);
+    free(deque);
+}
+
+/// Removes all elements from the deque. The buffer keeps its capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+void
+vdq_erase(ValueDeque_t *deque)
+{
+    deque->front = 0;
+    deque->rear = 0;
+    deque->count = 0;
+    deque->version_id++;
+}
+
+/// Sets a new interface for the target deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] new_interface The new interface.
+void
+vdq_config(ValueDeque_t *deque, Interface_t *new_interface)
+{
+    deque->interface = new_interface;
+}
+
+/// Returns the amount of elements in the deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return The amount of elements in the deque.
+integer_t
+vdq_count(ValueDeque_t *deque)
+{
+    return deque->count;
+}
+
+/// Returns the buffer's capacity, in elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return The buffer's capacity.
+integer_t
+vdq_capacity(ValueDeque_t *deque)
+{
+    return deque->capacity;
+}
+
+/// Returns the size in bytes of each element.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return The size of each element.
+size_t
+vdq_element_size(ValueDeque_t *deque)
+{
+    return deque->element_size;
+}
+
+/// Returns the buffer's growth rate.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return The buffer's growth rate.
+integer_t
+vdq_growth(ValueDeque_t *deque)
+{
+    return deque->growth_rate;
+}
+
+/// Returns true if the buffer's growth is locked, false otherwise.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return True if the buffer will not grow.
+bool
+vdq_locked(ValueDeque_t *deque)
+{
+    return deque->locked;
+}
+
+/// Returns a pointer to the element at a given position, counting from the
+/// front of the deque. The pointer is valid until the deque is modified.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] index The element's position from the front.
+///
+/// \return A pointer to the element or NULL if the index is out of bounds.
+void *
+vdq_get(ValueDeque_t *deque, integer_t index)
+{
+    if (index < 0 || index >= deque->count)
+        return NULL;
+
+    return vdq_at(deque, index);
+}
+
+/// Sets a new growth rate to the buffer. It only accepts values greater than
+/// 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] growth_rate The new growth rate.
+///
+/// \return True if the growth rate was changed.
+bool
+vdq_set_growth(ValueDeque_t *deque, integer_t growth_rate)
+{
+    if (growth_rate <= 100)
+        return false;
+
+    deque->growth_rate = growth_rate;
+
+    return true;
+}
+
+/// Locks the buffer's growth. Insertions will fail once it is full.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+void
+vdq_capacity_lock(ValueDeque_t *deque)
+{
+    deque->locked = true;
+}
+
+/// Unlocks the buffer's growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+void
+vdq_capacity_unlock(ValueDeque_t *deque)
+{
+    deque->locked = false;
+}
+
+/// Inserts a copy of \c element at the front of the deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] element A pointer to the element to be inserted.
+///
+/// \return True if the element was inserted, otherwise false.
+bool
+vdq_enqueue_front(ValueDeque_t *deque, const void *element)
+{
+    if (vdq_full(deque))
+    {
+        if (!vdq_grow(deque))
+            return false;
+    }
+
+    deque->front = (deque->front == 0) ? deque->capacity - 1 : deque->front -1;
+
+    memcpy(deque->buffer + (size_t)deque->front * deque->element_size,
+           element, deque->element_size);
+
+    deque->count++;
+    deque->version_id++;
+
+    return true;
+}
+
+/// Inserts a copy of \c element at the rear of the deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] element A pointer to the element to be inserted.
+///
+/// \return True if the element was inserted, otherwise false.
+bool
+vdq_enqueue_rear(ValueDeque_t *deque, const void *element)
+{
+    if (vdq_full(deque))
+    {
+        if (!vdq_grow(deque))
+            return false;
+    }
+
+    memcpy(deque->buffer + (size_t)deque->rear * deque->element_size,
+           element, deque->element_size);
+
+    deque->rear = (deque->rear == deque->capacity - 1) ? 0 : deque->rear + 1;
+
+    deque->count++;
+    deque->version_id++;
+
+    return true;
+}
+
+/// Removes the element at the front of the deque. If \c result is not NULL
+/// the removed element is copied to it.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[out] result Where the removed element is copied to, or NULL.
+///
+/// \return True if the element was removed or false if the deque is empty.
+bool
+vdq_dequeue_front(ValueDeque_t *deque, void *result)
+{
+    if (vdq_empty(deque))
+        return false;
+
+    if (result)
+        memcpy(result,
+               deque->buffer + (size_t)deque->front * deque->element_size,
+               deque->element_size);
+
+    deque->front = (deque->front == deque->capacity - 1) ? 0 : deque->front +1;
+
+    deque->count--;
+    deque->version_id++;
+
+    return true;
+}
+
+/// Removes the element at the rear of the deque. If \c result is not NULL the
+/// removed element is copied to it.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[out] result Where the removed element is copied to, or NULL.
+///
+/// \return True if the element was removed or false if the deque is empty.
+bool
+vdq_dequeue_rear(ValueDeque_t *deque, void *result)
+{
+    if (vdq_empty(deque))
+        return false;
+
+    deque->rear = (deque->rear == 0) ? deque->capacity - 1 : deque->rear - 1;
+
+    if (result)
+        memcpy(result,
+               deque->buffer + (size_t)deque->rear * deque->element_size,
+               deque->element_size);
+
+    deque->count--;
+    deque->version_id++;
+
+    return true;
+}
+
+/// Returns a pointer to the element at the front of the deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return A pointer to the front element or NULL if the deque is empty.
+void *
+vdq_peek_front(ValueDeque_t *deque)
+{
+    return vdq_get(deque, 0);
+}
+
+/// Returns a pointer to the element at the rear of the deque.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return A pointer to the rear element or NULL if the deque is empty.
+void *
+vdq_peek_rear(ValueDeque_t *deque)
+{
+    return vdq_get(deque, deque->count - 1);
+}
+
+/// Returns true if the deque is empty, otherwise false.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return True if the deque is empty, otherwise false.
+bool
+vdq_empty(ValueDeque_t *deque)
+{
+    return deque->count == 0;
+}
+
+/// Returns true if the deque is full, otherwise false. The deque can still
+/// grow if it is not locked.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return True if the buffer is full, otherwise false.
+bool
+vdq_full(ValueDeque_t *deque)
+{
+    return deque->count >= deque->capacity;
+}
+
+/// Returns true if an element equal to \c key is present in the deque.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] key A pointer to the value to be searched.
+///
+/// \return True if the element is present, otherwise false.
+bool
+vdq_contains(ValueDeque_t *deque, const void *key)
+{
+    for (integer_t i = 0; i < deque->count; i++)
+    {
+        if (deque->interface->compare(vdq_at(deque, i), key) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+/// Makes a copy of the deque. The elements of the copy start at the beginning
+/// of its buffer, so at most two memcpy() calls are made.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] deque ValueDeque_s reference.
+///
+/// \return A copy of the deque or NULL if allocation failed.
+ValueDeque_t *
+vdq_copy(ValueDeque_t *deque)
+{
+    ValueDeque_t *result = vdq_create(deque->interface, deque->element_size,
+                                      deque->capacity, deque->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    const size_t S = deque->element_size;
+
+    integer_t first = deque->capacity - deque->front;
+
+    if (first > deque->count)
+        first = deque->count;
+
+    memcpy(result->buffer, deque->buffer + (size_t)deque->front * S,
+           (size_t)first * S);
+    memcpy(result->buffer + (size_t)first * S, deque->buffer,
+           (size_t)(deque->count - first) * S);
+
+    result->count = deque->count;
+    result->rear = deque->count == deque->capacity ? 0 : deque->count;
+    result->locked = deque->locked;
+
+    return result;
+}
+
+/// Displays a ValueDeque_s in the console. There are currently four modes:
+/// - -1 Displays each element separated by newline;
+/// -  0 Displays each element like a linked list;
+/// -  1 Displays each element separated by a space;
+/// - Any other number defaults to the array representation.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] deque ValueDeque_s reference.
+/// \param[in] display_mode The way the deque is to be displayed.
+void
+vdq_display(ValueDeque_t *deque, int display_mode)
+{
+    if (vdq_empty(deque))
+    {
+        printf("\nValueDeque\n[ empty ]\n");
+        return;
+    }
+
+    switch (display_mode)
+    {
+        case -1:
+            printf("\nValueDeque\n");
+            for (integer_t i = 0; i < deque->count; i++)
+            {
+                deque->interface->display(vdq_at(deque, i));
+                printf("\n");
+            }
+            break;
+        case 0:
+            printf("\nValueDeque\nFront <-> ");
+            for (integer_t i = 0; i < deque->count; i++)
+            {
+                deque->interface->display(vdq_at(deque, i));
+                printf(" <-> ");
+            }
+            printf("Rear\n");
+            break;
+        case 1:
+            printf("\nValueDeque\nFront ");
+            for (integer_t i = 0; i < deque->count; i++)
+            {
+                deque->interface->display(vdq_at(deque, i));
+                printf(" ");
+            }
+            printf("Rear\n");
+            break;
+        default:
+            printf("\nValueDeque\n[ ");
+            for (integer_t i = 0; i < deque->count - 1; i++)
+            {
+                deque->interface->display(vdq_at(deque, i));
+                printf(", ");
+            }
+            deque->interface->display(vdq_at(deque, deque->count - 1));
+            printf(" ]\n");
+            break;
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+vdq_grow(ValueDeque_t *deque)
+{
+    if (deque->locked)
+        return false;
+
+    integer_t old_capacity = deque->capacity;
+
+    // capacity = capacity * (growth_rate / 100)
+    deque->capacity = (integer_t) ((double) (deque->capacity)
+            * ((double) (deque->growth_rate) / 100.0));
+
+    // 4 is the minimum growth
+    if (deque->capacity - old_capacity < 4)
+        deque->capacity = old_capacity + 4;
+
+    const size_t S = deque->element_size;
+
+    unsigned char *new_buffer = realloc(deque->buffer,
+            S * (size_t)deque->capacity);
+
+    // Reallocation failed
+    if (!new_buffer)
+    {
+        deque->capacity = old_capacity;
+
+        return false;
+    }
+
+    deque->buffer = new_buffer;
+
+    // The deque is full, so front == rear. Move the elements that were
+    // between front and the end of the old buffer to the end of the new one.
+    if (deque->front != 0)
+    {
+        integer_t tail = old_capacity - deque->front;
+        integer_t new_front = deque->capacity - tail;
+
+        memmove(deque->buffer + (size_t)new_front * S,
+                deque->buffer + (size_t)deque->front * S, (size_t)tail * S);
+
+        deque->front = new_front;
+    }
+    else
+    {
+        deque->rear = old_capacity;
+    }
+
+    deque->version_id++;
+
+    return true;
+}
+
+static unsigned char *
+vdq_at(ValueDeque_t *deque, integer_t position)
+{
+    integer_t index = deque->front + position;
+
+    if (index >= deque->capacity)
+        index -= deque->capacity;
+
+    return deque->buffer + (size_t)index * deque->element_size;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueDequeIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueDequeWrapper
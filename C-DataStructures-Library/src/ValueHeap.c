@@ -0,0 +1,706 @@
+/**
+ * @file ValueHeap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueHeap.h"
+
+/// A ValueHeap_s is a binary heap that stores its elements by value. It works
+/// just like a Heap_s except that elements are copied in and out of the
+/// buffer with memcpy() instead of being referenced by pointers. The size of
+/// each element is given when the heap is created.
+///
+/// Since elements can't be swapped by swapping pointers, floating an element
+/// up or down is done by moving a hole instead: the element is kept aside in
+/// a scratch slot, the elements in its way are moved into the hole one at a
+/// time and the element is only written once, at its final position.
+///
+/// \par Functions
+/// Located in the file ValueHeap.c
+struct ValueHeap_s
+{
+    /// \brief Data buffer.
+    ///
+    /// Buffer where elements are stored in.
+    unsigned char *buffer;
+
+    /// \brief Scratch slot.
+    ///
+    /// Space for one element, used to keep the element being moved aside.
+    unsigned char *scratch;
+
+    /// \brief Element size.
+    ///
+    /// The size in bytes of each element.
+    size_t element_size;
+
+    /// \brief Current amount of elements in the ValueHeap_s.
+    ///
+    /// Current amount of elements in the ValueHeap_s.
+    integer_t count;
+
+    /// \brief Buffer maximum capacity.
+    ///
+    /// Buffer maximum capacity. When \c count reaches \c capacity the buffer
+    /// is reallocated and increases according to \c growth_rate.
+    integer_t capacity;
+
+    /// \brief Buffer growth rate.
+    ///
+    /// Buffer growth rate. The new buffer capacity is calculated as:
+    ///
+    /// <code> capacity *= (growth_rate / 100.0) </code>
+    integer_t growth_rate;
+
+    /// \brief Flag for locked capacity.
+    ///
+    /// If \c locked is set to true the buffer will not grow.
+    bool locked;
+
+    /// \brief The kind of the heap.
+    ///
+    /// Either a MaxHeap or a MinHeap.
+    HeapKind kind;
+
+    /// \brief ValueHeap_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. Only the compare and display
+    /// functions are used since elements are copied with memcpy().
+    struct Interface_s *interface;
+
+    /// \brief A version id to keep track of modifications.
+    ///
+    /// This version id is used by the iterator to check if the structure was
+    /// modified. The iterator can only function if its version_id is the same
+    /// as the structure's version id, that is, there have been no structural
+    /// modifications (except for those done by the iterator itself).
+    integer_t version_id;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+vhp_p(integer_t position);
+
+static integer_t
+vhp_l(integer_t position);
+
+static integer_t
+vhp_r(integer_t position);
+
+static bool
+vhp_grow(ValueHeap_t *heap);
+
+static void
+vhp_float_up(ValueHeap_t *heap, integer_t index);
+
+static void
+vhp_float_down(ValueHeap_t *heap, integer_t index);
+
+static void
+vhp_display_tree(ValueHeap_t *heap, integer_t index, integer_t height);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a ValueHeap_s with an initial capacity of 32 and a growth rate
+/// of 200, that is, twice the size after each growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// heap to operate.
+/// \param[in] element_size The size in bytes of each element.
+/// \param[in] kind The kind of the heap.
+///
+/// \return A new ValueHeap_s or NULL if allocation failed or if
+/// \c element_size is 0.
+ValueHeap_t *
+vhp_new(Interface_t *interface, size_t element_size, HeapKind kind)
+{
+    return vhp_create(interface, element_size, 32, 200, kind);
+}
+
+/// Initializes a ValueHeap_s with a user defined initial \c size and
+/// \c growth_rate. This function only accepts a \c size greater than 0 and a
+/// \c growth_rate greater than 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// heap to operate.
+/// \param[in] element_size The size in bytes of each element.
+/// \param[in] size Buffer initial capacity.
+/// \param[in] growth_rate Buffer growth rate.
+/// \param[in] kind The kind of the heap.
+///
+/// \return A new ValueHeap_s or NULL if allocation failed or if any of the
+/// parameters is invalid.
+ValueHeap_t *
+vhp_create(Interface_t *interface, size_t element_size, integer_t size,
+           integer_t growth_rate, HeapKind kind)
+{
+    if (element_size == 0 || size < 1 || growth_rate <= 100)
+        return NULL;
+
+    if (kind != MaxHeap && kind != MinHeap)
+        return NULL;
+
+    ValueHeap_t *heap = malloc(sizeof(ValueHeap_t));
+
+    if (!heap)
+        return NULL;
+
+    heap->buffer = malloc(element_size * (size_t)size);
+    heap->scratch = malloc(element_size);
+
+    if (!heap->buffer || !heap->scratch)
+    {
+        free(heap->buffer);
+        free(heap->scratch);
+        free(heap);
+
+        return NULL;
+    }
+
+    heap->element_size = element_size;
+    heap->capacity = size;
+    heap->growth_rate = growth_rate;
+    heap->count = 0;
+    heap->locked = false;
+    heap->kind = kind;
+    heap->version_id = 0;
+
+    heap->interface = interface;
+
+    return heap;
+}
+
+/// Frees from memory the ValueHeap_s buffer and structure.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+vhp_free(ValueHeap_t *heap)
+{
+    free(heap->buffer);
+    free(heap->scratch);
+    free(heap);
+}
+
+/// Removes all elements from the heap. The buffer keeps its capacity.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+void
+vhp_erase(ValueHeap_t *heap)
+{
+    heap->count = 0;
+    heap->version_id++;
+}
+
+/// Sets a new interface for the target heap.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+/// \param[in] new_interface The new interface.
+void
+vhp_config(ValueHeap_t *heap, Interface_t *new_interface)
+{
+    heap->interface = new_interface;
+}
+
+/// Returns the amount of elements in the heap.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return The amount of elements in the heap.
+integer_t
+vhp_count(ValueHeap_t *heap)
+{
+    return heap->count;
+}
+
+/// Returns the buffer's capacity, in elements.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return The buffer's capacity.
+integer_t
+vhp_capacity(ValueHeap_t *heap)
+{
+    return heap->capacity;
+}
+
+/// Returns the size in bytes of each element.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return The size of each element.
+size_t
+vhp_element_size(ValueHeap_t *heap)
+{
+    return heap->element_size;
+}
+
+/// Returns the buffer's growth rate.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return The buffer's growth rate.
+integer_t
+vhp_growth(ValueHeap_t *heap)
+{
+    return heap->growth_rate;
+}
+
+/// Returns true if the buffer's growth is locked, false otherwise.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return True if the buffer will not grow.
+bool
+vhp_locked(ValueHeap_t *heap)
+{
+    return heap->locked;
+}
+
+/// Returns the kind of the heap.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return Either MaxHeap or MinHeap.
+HeapKind
+vhp_kind(ValueHeap_t *heap)
+{
+    return heap->kind;
+}
+
+/// Sets a new growth rate to the buffer. It only accepts values greater than
+/// 100.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+/// \param[in] growth_rate The new growth rate.
+///
+/// \return True if the growth rate was changed.
+bool
+vhp_set_growth(ValueHeap_t *heap, integer_t growth_rate)
+{
+    if (growth_rate <= 100)
+        return false;
+
+    heap->growth_rate = growth_rate;
+
+    return true;
+}
+
+/// Locks the buffer's growth. Insertions will fail once it is full.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+void
+vhp_capacity_lock(ValueHeap_t *heap)
+{
+    heap->locked = true;
+}
+
+/// Unlocks the buffer's growth.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+void
+vhp_capacity_unlock(ValueHeap_t *heap)
+{
+    heap->locked = false;
+}
+
+/// Inserts a copy of \c element into the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap ValueHeap_s reference.
+/// \param[in] element A pointer to the element to be inserted.
+///
+/// \return True if the element was inserted, otherwise false.
+bool
+vhp_insert(ValueHeap_t *heap, const void *element)
+{
+    if (vhp_full(heap))
+    {
+        if (!vhp_grow(heap))
+            return false;
+    }
+
+    memcpy(heap->scratch, element, heap->element_size);
+
+    heap->count++;
+
+    vhp_float_up(heap, heap->count - 1);
+
+    heap->version_id++;
+
+    return true;
+}
+
+/// Removes the root element of the heap. If \c result is not NULL the removed
+/// element is copied to it.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap ValueHeap_s reference.
+/// \param[out] result Where the removed element is copied to, or NULL.
+///
+/// \return True if the element was removed or false if the heap is empty.
+bool
+vhp_remove(ValueHeap_t *heap, void *result)
+{
+    if (vhp_empty(heap))
+        return false;
+
+    const size_t S = heap->element_size;
+
+    if (result)
+        memcpy(result, heap->buffer, S);
+
+    heap->count--;
+
+    if (heap->count > 0)
+    {
+        // The bottom element fills the hole left by the root
+        memcpy(heap->scratch, heap->buffer + (size_t)heap->count * S, S);
+
+        vhp_float_down(heap, 0);
+    }
+
+    heap->version_id++;
+
+    return true;
+}
+
+/// Returns a pointer to the root element of the heap. The pointer is valid
+/// until the heap is modified.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return A pointer to the root element or NULL if the heap is empty.
+void *
+vhp_peek(ValueHeap_t *heap)
+{
+    if (vhp_empty(heap))
+        return NULL;
+
+    return heap->buffer;
+}
+
+/// Returns true if the heap is empty, otherwise false.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return True if the heap is empty, otherwise false.
+bool
+vhp_empty(ValueHeap_t *heap)
+{
+    return heap->count == 0;
+}
+
+/// Returns true if the heap is full, otherwise false. The heap can still grow
+/// if it is not locked.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return True if the buffer is full, otherwise false.
+bool
+vhp_full(ValueHeap_t *heap)
+{
+    return heap->count >= heap->capacity;
+}
+
+/// Makes a copy of the heap. All elements are copied at once with a single
+/// memcpy().
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] heap ValueHeap_s reference.
+///
+/// \return A copy of the heap or NULL if allocation failed.
+ValueHeap_t *
+vhp_copy(ValueHeap_t *heap)
+{
+    ValueHeap_t *copy = vhp_create(heap->interface, heap->element_size,
+                                   heap->capacity, heap->growth_rate,
+                                   heap->kind);
+
+    if (!copy)
+        return NULL;
+
+    memcpy(copy->buffer, heap->buffer,
+           heap->element_size * (size_t)heap->count);
+
+    copy->count = heap->count;
+    copy->locked = heap->locked;
+
+    return copy;
+}
+
+/// Displays a ValueHeap_s in the console. There are currently four modes:
+/// - -1 Displays each element separated by newline;
+/// -  0 Displays each element separated by a space;
+/// -  1 Displays the heap as a tree;
+/// - Any other number defaults to the array representation.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] heap ValueHeap_s reference.
+/// \param[in] display_mode The way the heap is to be displayed.
+void
+vhp_display(ValueHeap_t *heap, int display_mode)
+{
+    if (vhp_empty(heap))
+    {
+        printf("\nValueHeap\n[ empty ]\n");
+        return;
+    }
+
+    const size_t S = heap->element_size;
+
+    switch (display_mode)
+    {
+        case -1:
+            printf("\nValueHeap\n");
+            for (integer_t i = 0; i < heap->count; i++)
+            {
+                heap->interface->display(heap->buffer + (size_t)i * S);
+                printf("\n");
+            }
+            break;
+        case 0:
+            printf("\nValueHeap\n");
+            for (integer_t i = 0; i < heap->count; i++)
+            {
+                heap->interface->display(heap->buffer + (size_t)i * S);
+                printf(" ");
+            }
+            printf("\n");
+            break;
+        case 1:
+            printf("\nValueHeap\n");
+            vhp_display_tree(heap, 0, 0);
+            printf("\n");
+            break;
+        default:
+            printf("\nValueHeap\n[ ");
+            for (integer_t i = 0; i < heap->count - 1; i++)
+            {
+                heap->interface->display(heap->buffer + (size_t)i * S);
+                printf(", ");
+            }
+            heap->interface->display(
+                    heap->buffer + (size_t)(heap->count - 1) * S);
+            printf(" ]\n");
+            break;
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Parent
+static integer_t
+vhp_p(integer_t position)
+{
+    return (position - 1) / 2;
+}
+
+// Left child
+static integer_t
+vhp_l(integer_t position)
+{
+    return 2 * position + 1;
+}
+
+// Right child
+static integer_t
+vhp_r(integer_t position)
+{
+    return 2 * position + 2;
+}
+
+static bool
+vhp_grow(ValueHeap_t *heap)
+{
+    if (heap->locked)
+        return false;
+
+    integer_t old_capacity = heap->capacity;
+
+    // capacity = capacity * (growth_rate / 100)
+    heap->capacity = (integer_t) ((double) (heap->capacity)
+            * ((double) (heap->growth_rate) / 100.0));
+
+    // 4 is the minimum growth
+    if (heap->capacity - old_capacity < 4)
+        heap->capacity = old_capacity + 4;
+
+    unsigned char *new_buffer = realloc(heap->buffer,
+            heap->element_size * (size_t)heap->capacity);
+
+    // Reallocation failed
+    if (!new_buffer)
+    {
+        heap->capacity = old_capacity;
+
+        return false;
+    }
+
+    heap->buffer = new_buffer;
+
+    return true;
+}
+
+// Moves the hole at index up until the element in the scratch slot can be
+// placed there without breaking the heap property
+static void
+vhp_float_up(ValueHeap_t *heap, integer_t index)
+{
+    const size_t S = heap->element_size;
+
+    // Inverts the compare function's result for min-heaps. See hep_float_up()
+    integer_t mod = heap->kind;
+
+    while (index > 0)
+    {
+        integer_t P = vhp_p(index);
+
+        unsigned char *parent = heap->buffer + (size_t)P * S;
+
+        if (heap->interface->compare(heap->scratch, parent) * mod <= 0)
+            break;
+
+        // The parent moves down into the hole
+        memcpy(heap->buffer + (size_t)index * S, parent, S);
+
+        index = P;
+    }
+
+    memcpy(heap->buffer + (size_t)index * S, heap->scratch, S);
+}
+
+// Moves the hole at index down until the element in the scratch slot can be
+// placed there without breaking the heap property
+static void
+vhp_float_down(ValueHeap_t *heap, integer_t index)
+{
+    const size_t S = heap->element_size;
+
+    integer_t mod = heap->kind;
+
+    while (true)
+    {
+        integer_t L = vhp_l(index);
+        integer_t R = vhp_r(index);
+
+        if (L >= heap->count)
+            break;
+
+        // Child with the highest priority
+        integer_t C = L;
+
+        if (R < heap->count &&
+            heap->interface->compare(heap->buffer + (size_t)R * S,
+                                     heap->buffer + (size_t)L * S) * mod > 0)
+        {
+            C = R;
+        }
+
+        unsigned char *child = heap->buffer + (size_t)C * S;
+
+        if (heap->interface->compare(child, heap->scratch) * mod <= 0)
+            break;
+
+        // The child moves up into the hole
+        memcpy(heap->buffer + (size_t)index * S, child, S);
+
+        index = C;
+    }
+
+    memcpy(heap->buffer + (size_t)index * S, heap->scratch, S);
+}
+
+static void
+vhp_display_tree(ValueHeap_t *heap, integer_t index, integer_t height)
+{
+    if (index >= heap->count || index < 0)
+        return;
+
+    vhp_display_tree(heap, vhp_r(index), height + 1);
+
+    for (integer_t i = 0; i < height; i++)
+        printf("|------- ");
+
+    heap->interface->display(heap->buffer + (size_t)index * heap->element_size);
+    printf("\n");
+
+    vhp_display_tree(heap, vhp_l(index), height + 1);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////// Iterator ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueHeapIterator
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////// Wrapper ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \todo ValueHeapWrapper
@@ -257,6 +257,840 @@ void avl_test_IO3(UnitTest ut)
     ut_error();
 }
 
+// State of avl_test_visit
+struct AVLTreeTest_s
+{
+    int64_t previous;
+    integer_t count;
+    bool ordered;
+};
+
+// Checks that elements are visited in strictly ascending order
+static void
+avl_test_visit(void *element, void *argument)
+{
+    struct AVLTreeTest_s *test = argument;
+
+    int64_t value = *(int64_t*)element;
+
+    if (test->count > 0 && value <= test->previous)
+        test->ordered = false;
+
+    test->previous = value;
+    test->count++;
+}
+
+// Tests range queries and the bounds and steps of iterators
+void avl_test_range(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+
+    AVLTreeIterator_t *iter = NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    iter = avl_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t key = 0;
+
+    ut_equals_bool(ut, true, avl_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, avl_iter_to_start(iter), __func__);
+    ut_equals_bool(ut, false, avl_iter_lower_bound(iter, &key), __func__);
+
+    // Shuffled insertion of the even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!avl_insert(tree, new_int64_t((i * 337) % 1000 * 2)))
+            goto error;
+    }
+
+    int64_t low = 101, high = 300;
+
+    struct AVLTreeTest_s test = { 0, 0, true };
+
+    ut_equals_integer_t(ut, 100, avl_range(tree, &low, &high, avl_test_visit,
+                                           &test), __func__);
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_int(ut, 300, (int)test.previous, __func__);
+    ut_equals_integer_t(ut, 0, avl_range(tree, &high, &low, avl_test_visit,
+                                         &test), __func__);
+
+    // Bounds
+    ut_equals_bool(ut, true, avl_iter_lower_bound(iter, &low), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+
+    key = 102;
+
+    ut_equals_bool(ut, true, avl_iter_lower_bound(iter, &key), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, avl_iter_upper_bound(iter, &key), __func__);
+    ut_equals_int(ut, 104, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, avl_iter_prev(iter), __func__);
+    ut_equals_bool(ut, true, avl_iter_prev(iter), __func__);
+    ut_equals_int(ut, 100, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+
+    key = 1990;
+
+    avl_iter_lower_bound(iter, &key);
+
+    integer_t count = 1;
+
+    while (avl_iter_next(iter))
+        count++;
+
+    ut_equals_integer_t(ut, 5, count, __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+    ut_equals_bool(ut, false, avl_iter_has_next(iter), __func__);
+
+    key = 1998;
+
+    ut_equals_bool(ut, false, avl_iter_upper_bound(iter, &key), __func__);
+    ut_equals_bool(ut, true, avl_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, avl_iter_next(iter), __func__);
+
+    // Full backwards iteration
+    ut_equals_bool(ut, true, avl_iter_to_end(iter), __func__);
+
+    bool ordered = true;
+    int64_t expected = 1998;
+
+    count = 0;
+
+    do
+    {
+        if (*(int64_t*)avl_iter_peek(iter) != expected)
+            ordered = false;
+
+        expected -= 2;
+        count++;
+    }
+    while (avl_iter_prev(iter));
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 1000, count, __func__);
+    ut_equals_bool(ut, false, avl_iter_has_prev(iter), __func__);
+
+    // The iterator stops working after a modification
+    if (!avl_insert(tree, new_int64_t(-1)))
+        goto error;
+
+    ut_equals_bool(ut, true, avl_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, avl_iter_next(iter), __func__);
+    ut_equals_bool(ut, true, avl_iter_to_start(iter), __func__);
+    ut_equals_int(ut, -1, (int)*(int64_t*)avl_iter_peek(iter), __func__);
+
+    avl_iter_free(iter);
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) avl_iter_free(iter);
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Tests select and rank while elements are inserted and removed
+void avl_test_rank(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+
+    static bool present[2000];
+
+    if (!interface || !tree)
+        goto error;
+
+    int64_t key = 0;
+
+    ut_equals_bool(ut, true, avl_select(tree, 0) == NULL, __func__);
+    ut_equals_integer_t(ut, -1, avl_rank(tree, &key), __func__);
+
+    // Sizes are computed when the tree becomes ranked
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!avl_insert(tree, new_int64_t((i * 337) % 1000)))
+            goto error;
+    }
+
+    avl_set_ranked(tree, true);
+
+    ut_equals_bool(ut, true, avl_ranked(tree), __func__);
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (*(int64_t*)avl_select(tree, i) != i || avl_rank(tree, &i) != i)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_bool(ut, true, avl_select(tree, 1000) == NULL, __func__);
+    ut_equals_bool(ut, true, avl_select(tree, -1) == NULL, __func__);
+
+    key = -5;
+
+    ut_equals_integer_t(ut, 0, avl_rank(tree, &key), __func__);
+
+    key = 5000;
+
+    ut_equals_integer_t(ut, 1000, avl_rank(tree, &key), __func__);
+
+    // Random changes checked against a sorted boolean array
+    for (int64_t i = 0; i < 2000; i++)
+        present[i] = i < 1000;
+
+    srand(7);
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        key = rand() % 2000;
+
+        if (rand() % 2)
+        {
+            void *element = new_int64_t(key);
+
+            if (!avl_insert(tree, element))
+                free(element);
+
+            present[key] = true;
+        }
+        else
+        {
+            avl_remove(tree, &key);
+
+            present[key] = false;
+        }
+    }
+
+    integer_t rank = 0;
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        if (avl_rank(tree, &i) != rank)
+            correct = false;
+
+        if (present[i])
+        {
+            void *element = avl_select(tree, rank);
+
+            if (!element || *(int64_t*)element != i)
+                correct = false;
+
+            rank++;
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, avl_size(tree), rank, __func__);
+
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Tests building from a sorted buffer and inserting batches
+void avl_test_bulk(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    void **elements = malloc(sizeof(void*) * 1200);
+
+    AVLTree_t *tree = NULL;
+
+    AVLTreeIterator_t *iter = NULL;
+
+    if (!interface || !elements)
+        goto error;
+
+    // Even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t(i * 2);
+
+    void *swap = elements[0];
+    elements[0] = elements[1];
+    elements[1] = swap;
+
+    ut_equals_bool(ut, true, avl_from_sorted_array(interface, elements, 1000)
+                             == NULL, __func__);
+
+    elements[1] = elements[0];
+    elements[0] = swap;
+
+    tree = avl_from_sorted_array(interface, elements, 1000);
+
+    if (!tree)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, avl_size(tree), __func__);
+    ut_equals_int(ut, 0, (int)*(int64_t*)avl_min(tree), __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)avl_max(tree), __func__);
+
+    // Odd numbers from 1 to 1999, shuffled, with 200 duplicates
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t((i * 337) % 1000 * 2 + 1);
+
+    for (int64_t i = 1000; i < 1200; i++)
+        elements[i] = new_int64_t(i % 2 == 0 ? i : i - 999);
+
+    integer_t total = avl_insert_all(tree, elements, 1200);
+
+    ut_equals_integer_t(ut, 1000, total, __func__);
+    ut_equals_integer_t(ut, 2000, avl_size(tree), __func__);
+
+    bool correct = true;
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        if (*(int64_t*)elements[i] != i * 2 + 1)
+            correct = false;
+    }
+
+    for (integer_t i = total; i < 1200; i++)
+        free(elements[i]);
+
+    // A small batch, where the second element is already in the tree
+    elements[0] = new_int64_t(-1);
+    elements[1] = new_int64_t(1000);
+    elements[2] = new_int64_t(2000);
+
+    ut_equals_integer_t(ut, 2, avl_insert_all(tree, elements, 3), __func__);
+    ut_equals_int(ut, 1000, (int)*(int64_t*)elements[2], __func__);
+
+    free(elements[2]);
+
+    iter = avl_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t expected = -1;
+
+    do
+    {
+        if (*(int64_t*)avl_iter_peek(iter) != expected++)
+            correct = false;
+    }
+    while (avl_iter_next(iter));
+
+    ut_equals_bool(ut, true, correct && expected == 2001, __func__);
+
+    // The rebuilt tree still supports removals
+    for (int64_t i = -1; i <= 2000; i += 3)
+    {
+        if (!avl_remove(tree, &i))
+            correct = false;
+    }
+
+    for (int64_t i = -1; i <= 2000; i++)
+    {
+        if (avl_contains(tree, &i) != ((i + 1) % 3 != 0))
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    avl_iter_free(iter);
+    avl_free(tree);
+    free(elements);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) avl_iter_free(iter);
+    if (tree) avl_free(tree);
+    free(elements);
+    if (interface) interface_free(interface);
+}
+
+// Tests union, intersection, difference, split and join with and without
+// subtree sizes
+void avl_test_set_operations(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree1 = NULL, *tree2 = NULL, *tree3 = NULL;
+
+    if (!interface)
+        goto error;
+
+    bool correct = true;
+
+    for (int ranked = 0; ranked < 2; ranked++)
+    {
+        tree1 = avl_new(interface);
+        tree2 = avl_new(interface);
+
+        if (!tree1 || !tree2)
+            goto error;
+
+        avl_set_ranked(tree1, ranked);
+
+        // Multiples of 2 below 2000 and multiples of 3 below 3000
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            if (!avl_insert(tree1, new_int64_t(i * 2))
+                || !avl_insert(tree2, new_int64_t(i * 3)))
+                goto error;
+        }
+
+        avl_intersection(tree1, tree2);
+
+        ut_equals_integer_t(ut, 334, avl_size(tree1), __func__);
+        ut_equals_integer_t(ut, 1000, avl_size(tree2), __func__);
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            if (avl_contains(tree1, &i) != (i % 6 == 0 && i < 2000))
+                correct = false;
+        }
+
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            void *element = new_int64_t(i * 2);
+
+            if (!avl_insert(tree1, element))
+                free(element);
+        }
+
+        avl_difference(tree1, tree2);
+
+        ut_equals_integer_t(ut, 666, avl_size(tree1), __func__);
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            if (avl_contains(tree1, &i) != (i % 2 == 0 && i % 3 != 0
+                                            && i < 2000))
+                correct = false;
+        }
+
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            void *element = new_int64_t(i * 2);
+
+            if (!avl_insert(tree1, element))
+                free(element);
+        }
+
+        ut_equals_bool(ut, true, avl_union(tree1, tree2), __func__);
+        ut_equals_integer_t(ut, 1666, avl_size(tree1), __func__);
+        ut_equals_bool(ut, true, avl_empty(tree2), __func__);
+
+        integer_t rank = 0;
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            bool expected = (i % 2 == 0 && i < 2000) || i % 3 == 0;
+
+            if (avl_contains(tree1, &i) != expected)
+                correct = false;
+
+            if (ranked && expected
+                && *(int64_t*)avl_select(tree1, rank++) != i)
+                correct = false;
+        }
+
+        // Split at an element that is not in the tree
+        int64_t key = 1001;
+
+        tree3 = avl_split(tree1, &key);
+
+        if (!tree3)
+            goto error;
+
+        ut_equals_integer_t(ut, 668, avl_size(tree1), __func__);
+        ut_equals_integer_t(ut, 998, avl_size(tree3), __func__);
+        ut_equals_int(ut, 1000, (int)*(int64_t*)avl_max(tree1), __func__);
+        ut_equals_int(ut, 1002, (int)*(int64_t*)avl_min(tree3), __func__);
+
+        ut_equals_bool(ut, false, avl_join(tree3, tree1), __func__);
+        ut_equals_bool(ut, true, avl_join(tree1, tree3), __func__);
+        ut_equals_integer_t(ut, 1666, avl_size(tree1), __func__);
+        ut_equals_bool(ut, true, avl_empty(tree3), __func__);
+
+        if (ranked)
+        {
+            key = 1002;
+
+            ut_equals_integer_t(ut, 668, avl_rank(tree1, &key), __func__);
+        }
+
+        avl_free(tree1);
+        avl_free(tree2);
+        avl_free(tree3);
+
+        tree1 = tree2 = tree3 = NULL;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree1) avl_free(tree1);
+    if (tree2) avl_free(tree2);
+    if (tree3) avl_free(tree3);
+    if (interface) interface_free(interface);
+}
+
+// Checks the operation counters, which are only kept with DS_STATS
+void avl_test_stats(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+
+    if (!interface || !tree)
+        goto error;
+
+    // Sorted insertions always rotate
+    for (integer_t i = 0; i < 1000; i++)
+    {
+        void *element = new_int64_t(i);
+
+        if (!avl_insert(tree, element))
+        {
+            free(element);
+            goto error;
+        }
+    }
+
+    for (integer_t i = 0; i < 100; i++)
+    {
+        void *key = new_int64_t(i);
+
+        bool removed = avl_remove(tree, key);
+
+        free(key);
+
+        if (!removed)
+            goto error;
+    }
+
+    ContainerStats_t stats;
+
+    if (avl_stats(tree, &stats))
+    {
+        ut_equals_bool(ut, true, stats.compares > 0, __func__);
+        ut_equals_bool(ut, true, stats.rotations > 0, __func__);
+        ut_equals_bool(ut, true, stats.bytes > 0, __func__);
+        ut_equals_integer_t(ut, 1001, (integer_t)stats.allocations, __func__);
+        ut_equals_integer_t(ut, 100, (integer_t)stats.frees, __func__);
+    }
+    else
+    {
+        ut_equals_bool(ut, true, stats.compares == 0 && stats.rotations == 0
+                                 && stats.bytes == 0 && stats.frees == 0,
+                       __func__);
+    }
+
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Saves a ranked tree to a snapshot and restores it
+void avl_test_snapshot(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+    AVLTree_t *restored = NULL;
+
+    FILE *stream = tmpfile();
+
+    if (!interface || !tree || !stream)
+        goto error;
+
+    interface_serializer(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!avl_insert(tree, new_int64_t((i * 337) % 1000)))
+            goto error;
+    }
+
+    avl_set_ranked(tree, true);
+
+    ut_equals_bool(ut, true, avl_save(tree, stream), __func__);
+
+    rewind(stream);
+
+    restored = avl_restore(interface, stream);
+
+    if (!restored)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, avl_size(restored), __func__);
+    ut_equals_bool(ut, true, avl_ranked(restored), __func__);
+
+    bool equal = true;
+
+    for (int64_t i = 0; equal && i < 1000; i++)
+        equal = *(int64_t *)avl_select(restored, i) == i;
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    // Restoring from the end of the stream fails
+    ut_equals_bool(ut, true, avl_restore(interface, stream) == NULL,
+                   __func__);
+
+    fclose(stream);
+    avl_free(restored);
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stream) fclose(stream);
+    if (restored) avl_free(restored);
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// A key with a counter, compared only by its key
+struct AVLTreeTestCounter_s
+{
+    int64_t key;
+    int64_t count;
+};
+
+static int
+avl_test_counter_compare(const void *element1, const void *element2)
+{
+    const struct AVLTreeTestCounter_s *counter1 = element1, *counter2 = element2;
+
+    return (counter1->key > counter2->key) - (counter1->key < counter2->key);
+}
+
+static void
+avl_test_counter_merge(void *accumulator, const void *element)
+{
+    ((struct AVLTreeTestCounter_s *)accumulator)->count +=
+            ((const struct AVLTreeTestCounter_s *)element)->count;
+}
+
+static struct AVLTreeTestCounter_s *
+avl_test_counter_new(int64_t key)
+{
+    struct AVLTreeTestCounter_s *counter = malloc(sizeof(struct AVLTreeTestCounter_s));
+
+    if (counter)
+    {
+        counter->key = key;
+        counter->count = 1;
+    }
+
+    return counter;
+}
+
+// Aggregates counters with upserts and looks them up with a single descent
+void avl_test_upsert(UnitTest ut)
+{
+    Interface_t *interface = interface_new(avl_test_counter_compare, NULL,
+                                           NULL, free, NULL, NULL);
+
+    AVLTree_t *tree = interface ? avl_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        struct AVLTreeTestCounter_s *counter = avl_test_counter_new(i % 100);
+
+        if (!counter || !avl_upsert(tree, counter, avl_test_counter_merge))
+        {
+            free(counter);
+            goto error;
+        }
+    }
+
+    ut_equals_integer_t(ut, 100, avl_size(tree), __func__);
+
+    struct AVLTreeTestCounter_s search = { 42, 0 };
+
+    struct AVLTreeTestCounter_s *stored = avl_get(tree, &search);
+
+    ut_equals_bool(ut, true, stored != NULL && stored->count == 10, __func__);
+
+    search.key = 100;
+
+    ut_equals_bool(ut, true, avl_get(tree, &search) == NULL, __func__);
+
+    // An equal element is found and the new one is left to the caller
+    struct AVLTreeTestCounter_s *counter = avl_test_counter_new(42);
+    void *existing = NULL;
+
+    if (!counter)
+        goto error;
+
+    ut_equals_bool(ut, false, avl_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    // A full tree still finds its elements
+    avl_set_limit(tree, 100);
+
+    ut_equals_bool(ut, false, avl_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    counter->key = 100;
+
+    ut_equals_bool(ut, false, avl_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == NULL, __func__);
+
+    avl_set_limit(tree, 0);
+
+    ut_equals_bool(ut, true, avl_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == counter, __func__);
+    ut_equals_integer_t(ut, 101, avl_size(tree), __func__);
+
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Records the visited elements
+struct AVLTreeTestRecord_s
+{
+    int64_t elements[16];
+    integer_t count;
+};
+
+static void
+avl_test_record(void *element, void *argument)
+{
+    struct AVLTreeTestRecord_s *record = argument;
+
+    if (record->count < 16)
+        record->elements[record->count] = *(int64_t*)element;
+
+    record->count++;
+}
+
+// Checks the elements recorded by a traversal
+static bool
+avl_test_recorded(AVLTree_t *tree, int traversal_mode, const int64_t *expected,
+                   integer_t count)
+{
+    struct AVLTreeTestRecord_s record = { { 0 }, 0 };
+
+    if (!avl_visit(tree, traversal_mode, avl_test_record, &record))
+        return false;
+
+    if (record.count != count)
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (record.elements[i] != expected[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Every traversal order visits the elements without recursion
+void avl_test_traversal(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = interface ? avl_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    const int64_t elements[7] = { 4, 2, 6, 1, 3, 5, 7 };
+
+    for (integer_t i = 0; i < 7; i++)
+    {
+        if (!avl_insert(tree, new_int64_t(elements[i])))
+            goto error;
+    }
+
+    const int64_t preorder[7] = { 4, 2, 1, 3, 6, 5, 7 };
+    const int64_t inorder[7] = { 1, 2, 3, 4, 5, 6, 7 };
+    const int64_t postorder[7] = { 1, 3, 2, 5, 7, 6, 4 };
+    const int64_t levelorder[7] = { 4, 2, 6, 1, 3, 5, 7 };
+    const int64_t leaves[4] = { 1, 3, 5, 7 };
+
+    ut_equals_bool(ut, true, avl_test_recorded(tree, -1, preorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, avl_test_recorded(tree, 0, inorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, avl_test_recorded(tree, 1, postorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, avl_test_recorded(tree, 2, levelorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, avl_test_recorded(tree, 3, leaves, 4),
+                   __func__);
+
+    avl_free(tree);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
 // Runs all AVLTree tests
 Status AVLTreeTests(void)
 {
@@ -271,6 +1105,14 @@ Status AVLTreeTests(void)
     avl_test_IO1(ut);
     avl_test_IO2(ut);
     avl_test_IO3(ut);
+    avl_test_range(ut);
+    avl_test_rank(ut);
+    avl_test_bulk(ut);
+    avl_test_set_operations(ut);
+    avl_test_stats(ut);
+    avl_test_snapshot(ut);
+    avl_test_upsert(ut);
+    avl_test_traversal(ut);
 
     ut_report(ut, "AVLTree");
 
@@ -0,0 +1,346 @@
+/**
+ * @file AdaptiveRadixTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "AdaptiveRadixTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Amount of keys to pick from
+#define ART_TEST_KEYS 3000
+
+// Counts the values visited by art_prefix
+static void
+art_test_count(void *value, void *argument)
+{
+    (void)value;
+
+    (*(integer_t *)argument)++;
+}
+
+static int
+art_test_compare(const void *key1, const void *key2)
+{
+    return strcmp(*(char *const *)key1, *(char *const *)key2);
+}
+
+// Fills a buffer with a random key. Keys share long prefixes and branch into
+// many bytes, so every node type and long prefixes are used.
+static void
+art_test_key(char *buffer)
+{
+    int shape = rand() % 4, length = 0;
+
+    if (shape == 0)
+        length = sprintf(buffer, "a/long/shared/directory/");
+    else if (shape == 1)
+        length = sprintf(buffer, "b");
+
+    int suffix = rand() % 6;
+
+    for (int i = 0; i < suffix; i++)
+    {
+        if (shape == 2)
+            buffer[length++] = (char)(rand() % 255 + 1);
+        else
+            buffer[length++] = (char)('a' + rand() % 3);
+    }
+
+    buffer[length] = '\0';
+}
+
+// Random insertions and removals match a sorted array, both when searching
+// and when iterating in order or by prefix
+void art_test_keys(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AdaptiveRadixTree_t *tree = interface ? art_new(interface) : NULL;
+
+    char **keys = malloc(sizeof(char *) * ART_TEST_KEYS);
+    bool *present = calloc(ART_TEST_KEYS, sizeof(bool));
+
+    integer_t total = 0;
+
+    if (!tree || !keys || !present)
+        goto error;
+
+    for (integer_t i = 0; i < ART_TEST_KEYS; i++)
+    {
+        char buffer[64];
+
+        art_test_key(buffer);
+
+        if (!(keys[total] = malloc(strlen(buffer) + 1)))
+            goto error;
+
+        strcpy(keys[total++], buffer);
+    }
+
+    // Sorted and without duplicates, the order of an iteration
+    qsort(keys, (size_t)total, sizeof(char *), art_test_compare);
+
+    integer_t unique = 0;
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        if (unique > 0 && strcmp(keys[unique - 1], keys[i]) == 0)
+            free(keys[i]);
+        else
+            keys[unique++] = keys[i];
+    }
+
+    total = unique;
+
+    bool correct = true;
+    integer_t count = 0;
+
+    for (integer_t k = 1; k <= 40000; k++)
+    {
+        integer_t i = rand() % total;
+
+        if (rand() % 3 != 0)
+        {
+            int64_t *value = new_int64_t(i);
+
+            bool inserted = art_insert(tree, keys[i], value);
+
+            if (inserted != !present[i])
+                correct = false;
+
+            if (!inserted)
+                free(value);
+            else
+                count++;
+
+            present[i] = true;
+        }
+        else
+        {
+            void *value = NULL;
+
+            bool removed = art_remove(tree, keys[i], &value);
+
+            if (removed != present[i]
+                || (removed && *(int64_t *)value != i))
+                correct = false;
+
+            if (removed)
+                count--;
+
+            free(value);
+
+            present[i] = false;
+        }
+
+        integer_t j = rand() % total;
+
+        int64_t *found = art_get(tree, keys[j]);
+
+        if (present[j] != (found != NULL) || (found && *found != j))
+            correct = false;
+
+        if (k % 4000 != 0)
+            continue;
+
+        for (j = 0; j < total; j++)
+        {
+            found = art_get(tree, keys[j]);
+
+            if (present[j] != (found != NULL) || (found && *found != j)
+                || present[j] != art_contains(tree, keys[j]))
+                correct = false;
+        }
+
+        // Iterates by the prefix of a random key, the first time every key
+        char prefix[64];
+
+        strcpy(prefix, k == 4000 ? "" : keys[rand() % total]);
+        prefix[rand() % (strlen(prefix) + 1)] = '\0';
+
+        AdaptiveRadixTreeIterator_t *iter = art_iter_new(tree, prefix);
+
+        if (!iter)
+            goto error;
+
+        integer_t expected = 0, visited = 0;
+        size_t length = strlen(prefix);
+
+        for (integer_t j = 0; j < total; j++)
+        {
+            if (!present[j] || strncmp(keys[j], prefix, length) != 0)
+                continue;
+
+            const char *key = NULL;
+            void *value = NULL;
+
+            if (expected > 0 && !art_iter_next(iter))
+                correct = false;
+
+            if (!art_iter_get_key(iter, &key) || strcmp(key, keys[j]) != 0
+                || !art_iter_get_value(iter, &value)
+                || *(int64_t *)value != j)
+                correct = false;
+
+            expected++;
+        }
+
+        if (art_iter_has_next(iter))
+            correct = false;
+
+        art_iter_free(iter);
+
+        art_prefix(tree, prefix, art_test_count, &visited);
+
+        if (visited != expected)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, count, art_count(tree), __func__);
+
+    art_erase(tree);
+
+    ut_equals_bool(ut, true, art_empty(tree), __func__);
+    ut_equals_bool(ut, false, art_contains(tree, keys[0]), __func__);
+
+    art_free(tree);
+    interface_free(interface);
+
+    for (integer_t i = 0; i < total; i++)
+        free(keys[i]);
+
+    free(keys);
+    free(present);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) art_free(tree);
+    if (interface) interface_free(interface);
+    for (integer_t i = 0; i < total; i++)
+        free(keys[i]);
+    free(keys);
+    free(present);
+}
+
+// String keys, empty keys, a single key at the root and iterators that are
+// invalidated by changes
+void art_test_string(UnitTest ut)
+{
+    AdaptiveRadixTree_t *tree = art_new(NULL);
+
+    String key = NULL;
+
+    if (!tree || str_make(&key, "gap") != DS_OK)
+        goto error;
+
+    // Moves the gap of the String away from its end
+    str_push_char_front(key, 'a');
+    str_push_char_at(key, '-', 1);
+
+    int values[4] = { 0, 1, 2, 3 };
+
+    ut_equals_bool(ut, true, art_insert_string(tree, key, &values[0]),
+                   __func__);
+    ut_equals_bool(ut, false, art_insert(tree, "a-gap", &values[1]),
+                   __func__);
+    ut_equals_bool(ut, true, art_get(tree, "a-gap") == &values[0], __func__);
+    ut_equals_bool(ut, true, art_get_string(tree, key) == &values[0],
+                   __func__);
+
+    // A single leaf at the root
+    AdaptiveRadixTreeIterator_t *iter = art_iter_new(tree, "a-");
+
+    if (!iter)
+        goto error;
+
+    const char *found = NULL;
+
+    ut_equals_bool(ut, true, art_iter_get_key(iter, &found), __func__);
+    ut_equals_bool(ut, true, found && strcmp(found, "a-gap") == 0, __func__);
+    ut_equals_bool(ut, false, art_iter_has_next(iter), __func__);
+
+    art_iter_free(iter);
+
+    iter = art_iter_new(tree, "b");
+
+    if (!iter)
+        goto error;
+
+    ut_equals_bool(ut, false, art_iter_get_key(iter, &found), __func__);
+
+    art_iter_free(iter);
+
+    ut_equals_bool(ut, true, art_insert(tree, "", &values[1]), __func__);
+    ut_equals_bool(ut, true, art_insert(tree, "a", &values[2]), __func__);
+    ut_equals_bool(ut, true, art_get(tree, "") == &values[1], __func__);
+
+    iter = art_iter_new(tree, "");
+
+    if (!iter)
+        goto error;
+
+    void *value = NULL;
+
+    ut_equals_bool(ut, true, art_iter_get_key(iter, &found), __func__);
+    ut_equals_bool(ut, true, found && strcmp(found, "") == 0, __func__);
+    ut_equals_bool(ut, true, art_iter_next(iter), __func__);
+    ut_equals_bool(ut, true, art_iter_set_value(iter, &values[3]), __func__);
+    ut_equals_bool(ut, true, art_get(tree, "a") == &values[3], __func__);
+
+    // Changing the tree stops the iterator
+    ut_equals_bool(ut, true, art_remove_string(tree, key, &value), __func__);
+    ut_equals_bool(ut, true, value == &values[0], __func__);
+    ut_equals_bool(ut, false, art_iter_next(iter), __func__);
+    ut_equals_bool(ut, false, art_iter_get_value(iter, &value), __func__);
+
+    art_iter_free(iter);
+
+    ut_equals_integer_t(ut, 2, art_count(tree), __func__);
+    ut_equals_bool(ut, false, art_remove(tree, "a-gap", &value), __func__);
+
+    art_free(tree);
+    str_delete(&key);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) art_free(tree);
+    if (key) str_delete(&key);
+}
+
+// Runs all AdaptiveRadixTree tests
+Status AdaptiveRadixTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    art_test_keys(ut);
+    art_test_string(ut);
+
+    ut_report(ut, "AdaptiveRadixTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "AdaptiveRadixTree");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file ArenaTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "Arena.h"
+#include "DynamicArray.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <stddef.h>
+
+// Checks alignment, allocations bigger than a block and reset
+void arn_test_alloc(UnitTest ut)
+{
+    Arena_t *arena = arn_new(256);
+
+    if (!arena)
+        goto error;
+
+    const size_t align = _Alignof(max_align_t);
+
+    bool aligned = true;
+
+    for (size_t i = 1; i <= 100; i++)
+    {
+        unsigned char *block = arn_alloc(arena, i);
+
+        if (!block)
+            goto error;
+
+        memset(block, 0xFF, i);
+
+        if ((uintptr_t)block % align != 0)
+            aligned = false;
+    }
+
+    ut_equals_bool(ut, true, aligned, __func__);
+
+    size_t reserved = arn_reserved(arena);
+    size_t used = arn_used(arena);
+
+    // Bigger than a block so it gets a block of its own
+    void *big = arn_alloc(arena, 1000);
+
+    if (!big)
+        goto error;
+
+    memset(big, 0, 1000);
+
+    ut_equals_bool(ut, true, arn_reserved(arena) >= reserved + 1000, __func__);
+    ut_equals_bool(ut, true, arn_used(arena) >= used + 1000, __func__);
+
+    // The current block is still used after an oversized allocation
+    unsigned char *small = arn_alloc(arena, 1);
+
+    if (!small)
+        goto error;
+
+    arn_reset(arena);
+
+    ut_equals_bool(ut, true, arn_used(arena) == 0, __func__);
+    ut_equals_bool(ut, true, arn_reserved(arena) <= 1000, __func__);
+
+    if (!arn_alloc(arena, 8))
+        goto error;
+
+    arn_free(arena);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (arena) arn_free(arena);
+    ut_error();
+}
+
+// Builds, copies and drops a DynamicArray_s whose elements live in an arena
+void arn_test_interface(UnitTest ut)
+{
+    const int64_t elements = 1000;
+
+    Arena_t *arena = arn_new(4096);
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    DynamicArray_t *array = NULL, *copy = NULL;
+
+    if (!arena || !int_interface)
+        goto error;
+
+    Allocator_t *allocator = arn_allocator(arena);
+
+    interface_allocator(int_interface, copy_alloc_int64_t, allocator);
+
+    array = dar_new(int_interface);
+
+    if (!array)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!dar_insert_back(array, copy_alloc_int64_t(&i, allocator)))
+            goto error;
+    }
+
+    size_t used = arn_used(arena);
+
+    copy = dar_copy(array);
+
+    if (!copy)
+        goto error;
+
+    // All copies came from the arena
+    ut_equals_bool(ut, true, arn_used(arena) > used, __func__);
+    ut_equals_integer_t(ut, elements, dar_size(copy), __func__);
+
+    bool equal = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        int64_t *a = dar_get(array, i), *b = dar_get(copy, i);
+
+        if (a == b || *a != *b)
+            equal = false;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    // Releasing elements is a no-op for the arena
+    if (!dar_delete(copy, 0, elements / 2 - 1))
+        goto error;
+
+    ut_equals_integer_t(ut, elements / 2, dar_size(copy), __func__);
+
+    dar_free(array);
+    dar_free(copy);
+    arn_free(arena);
+
+    // Back to malloc and free
+    interface_allocator(int_interface, NULL, NULL);
+
+    int64_t value = 10;
+    void *element = interface_copy(int_interface, &value);
+
+    ut_equals_bool(ut, true, element != NULL && *(int64_t*)element == 10,
+                   __func__);
+
+    interface_release(int_interface, element);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (array) dar_free(array);
+    if (copy) dar_free(copy);
+    if (arena) arn_free(arena);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Runs all Arena tests
+Status ArenaTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    arn_test_alloc(ut);
+    arn_test_interface(ut);
+
+    ut_report(ut, "Arena");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Arena");
+    ut_delete(&ut);
+    return st;
+}
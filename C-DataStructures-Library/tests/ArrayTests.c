@@ -160,6 +160,136 @@ void arr_test_IO2(UnitTest ut)
     ut_error();
 }
 
+// Walks the slots of the array through its span
+void arr_test_span(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    Array_t *array = arr_new(interface, 10);
+
+    if (!interface || !array)
+        goto error;
+
+    for (int64_t i = 0; i < 10; i += 2)
+    {
+        if (arr_set(array, new_int64_t(i), i) != 0)
+            goto error;
+    }
+
+    void **span;
+
+    integer_t length = arr_span(array, 0, &span);
+
+    bool correct = length == 10;
+
+    for (integer_t i = 0; correct && i < length; i++)
+    {
+        if (i % 2 == 0)
+            correct = span[i] && *(int64_t *)span[i] == i;
+        else
+            correct = span[i] == NULL;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, 0, arr_span(array, -1, &span), __func__);
+
+    arr_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) arr_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Keeps even numbers
+static bool
+arr_test_even(const void *element, void *argument)
+{
+    (void)argument;
+
+    return *(const int64_t*)element % 2 == 0;
+}
+
+// Adds an int64_t element to a sum
+static void
+arr_test_sum(void *accumulator, const void *element)
+{
+    *(int64_t*)accumulator += *(const int64_t*)element;
+}
+
+// Filters and reduces an array with empty slots using a thread pool
+void arr_test_bulk(UnitTest ut)
+{
+    const int64_t length = 6000;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    ThreadPool_t *pool = tpl_new(4);
+
+    Array_t *array = arr_new(interface, length);
+
+    if (!interface || !pool || !array)
+        goto error;
+
+    // Every third slot stays empty
+    for (int64_t i = 0; i < length; i++)
+    {
+        if (i % 3 != 0 && arr_set(array, new_int64_t(i), i) != 0)
+            goto error;
+    }
+
+    integer_t count = arr_count(array);
+
+    ut_equals_integer_t(ut, count / 2,
+                        arr_filter_in_place(array, arr_test_even, NULL, pool),
+                        __func__);
+
+    ut_equals_integer_t(ut, count - count / 2, arr_count(array), __func__);
+
+    bool correct = true;
+
+    for (int64_t i = 0; correct && i < length; i++)
+    {
+        void *element = NULL;
+
+        arr_get(array, &element, i);
+
+        correct = (i % 3 != 0 && i % 2 == 0) == (element != NULL);
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    // Sum of the even numbers that are not multiples of 3
+    int64_t sum = 0, zero = 0, expected = 0;
+
+    for (int64_t i = 0; i < length; i += 2)
+        expected += i % 3 != 0 ? i : 0;
+
+    arr_reduce(array, &sum, &zero, sizeof(int64_t), arr_test_sum,
+               arr_test_sum, pool);
+
+    ut_equals_bool(ut, true, sum == expected, __func__);
+
+    arr_free(array);
+    tpl_free(pool);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) arr_free(array);
+    if (pool) tpl_free(pool);
+    if (interface) interface_free(interface);
+}
+
 // Runs all Array tests
 Status ArrayTests(void)
 {
@@ -172,6 +302,8 @@ Status ArrayTests(void)
 
     arr_test_IO1(ut);
     arr_test_IO2(ut);
+    arr_test_span(ut);
+    arr_test_bulk(ut);
 
     ut_report(ut, "Array");
 
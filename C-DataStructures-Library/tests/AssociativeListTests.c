@@ -75,6 +75,121 @@ void ali_test_IO(UnitTest ut)
     ut_error();
 }
 
+// Counts the calls to the key compare function
+static integer_t ali_test_compares = 0;
+
+static int
+ali_test_compare(const void *element1, const void *element2)
+{
+    ali_test_compares++;
+
+    return compare_int64_t(element1, element2);
+}
+
+// Tests hashed keys, move to front, find-or-insert and the tail after removals
+void ali_test_fast_paths(UnitTest ut)
+{
+    Interface_t *key_interface = interface_new(ali_test_compare, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+    Interface_t *value_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    AssociativeList_t *list = NULL;
+
+    if (!key_interface || !value_interface)
+        goto error;
+
+    list = ali_new(key_interface, value_interface, false);
+
+    if (!list)
+        goto error;
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        if (!ali_insert(list, new_int64_t(i), new_int64_t(i * 2)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, ali_set_hashed(list, true), __func__);
+    ut_equals_bool(ut, true, ali_hashed(list), __func__);
+
+    // Only equal hashes are compared
+    int64_t key = 100;
+
+    ali_test_compares = 0;
+
+    ut_equals_bool(ut, false, ali_contains_key(list, &key), __func__);
+    ut_equals_integer_t(ut, 0, ali_test_compares, __func__);
+
+    key = 99;
+
+    ut_equals_bool(ut, true, ali_contains_key(list, &key), __func__);
+    ut_equals_integer_t(ut, 1, ali_test_compares, __func__);
+
+    // The key found moves to the head, so the next lookup is immediate
+    ali_set_move_to_front(list, true);
+
+    ut_equals_int(ut, 198, (int)*(int64_t*)ali_get(list, &key), __func__);
+
+    ali_set_hashed(list, false);
+    ali_test_compares = 0;
+
+    ut_equals_int(ut, 198, (int)*(int64_t*)ali_get(list, &key), __func__);
+    ut_equals_integer_t(ut, 1, ali_test_compares, __func__);
+
+    ali_set_hashed(list, true);
+
+    void *value = NULL;
+    int64_t *new_key = new_int64_t(50), *new_value = new_int64_t(-1);
+
+    ut_equals_bool(ut, false, ali_get_or_insert(list, new_key, new_value,
+                                                &value), __func__);
+    ut_equals_int(ut, 100, (int)*(int64_t*)value, __func__);
+
+    *new_key = 100;
+
+    ut_equals_bool(ut, true, ali_get_or_insert(list, new_key, new_value,
+                                               &value), __func__);
+    ut_equals_bool(ut, true, value == new_value, __func__);
+    ut_equals_integer_t(ut, 101, ali_length(list), __func__);
+
+    // The new tail is kept after removing the old one
+    if (!ali_pop(list, &key) || !ali_pop(list, new_key))
+        goto error;
+
+    key = 98;
+
+    if (!ali_remove(list, &key, &value))
+        goto error;
+
+    free(value);
+
+    if (!ali_insert(list, new_int64_t(200), new_int64_t(400)))
+        goto error;
+
+    key = 200;
+
+    ut_equals_int(ut, 400, (int)*(int64_t*)ali_get(list, &key), __func__);
+    ut_equals_integer_t(ut, 99, ali_length(list), __func__);
+
+    // A limit of the current length makes the list full
+    ut_equals_bool(ut, true, ali_set_limit(list, 99), __func__);
+    ut_equals_bool(ut, true, ali_full(list), __func__);
+
+    ali_free(list);
+    interface_free(key_interface);
+    interface_free(value_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list) ali_free(list);
+    if (key_interface) interface_free(key_interface);
+    if (value_interface) interface_free(value_interface);
+    ut_error();
+}
+
 // Runs all AssociativeList tests
 Status AssociativeListTests(void)
 {
@@ -86,6 +201,7 @@ Status AssociativeListTests(void)
         goto error;
 
     ali_test_IO(ut);
+    ali_test_fast_paths(ut);
 
     ut_report(ut, "AssociativeList");
 
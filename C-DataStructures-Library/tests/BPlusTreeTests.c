@@ -0,0 +1,278 @@
+/**
+ * @file BPlusTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "BPlusTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Range of the random keys
+#define BPT_TEST_KEYS 5000
+
+// State of bpt_test_visit
+struct BPlusTreeTest_s
+{
+    int64_t previous;
+    integer_t count;
+    bool ordered;
+};
+
+// Checks that elements are visited in strictly ascending order
+static void
+bpt_test_visit(void *element, void *argument)
+{
+    struct BPlusTreeTest_s *test = argument;
+
+    int64_t value = *(int64_t*)element;
+
+    if (test->count > 0 && value <= test->previous)
+        test->ordered = false;
+
+    test->previous = value;
+    test->count++;
+}
+
+// Random insertions and removals checked against a boolean array, with and
+// without inline keys
+void bpt_test_insert_remove(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    BPlusTree_t *tree = NULL;
+
+    static bool present[BPT_TEST_KEYS];
+
+    if (!interface)
+        goto error;
+
+    for (int inline_keys = 0; inline_keys < 2; inline_keys++)
+    {
+        tree = bpt_create(interface, inline_keys ? key_int64_t : NULL);
+
+        if (!tree)
+            goto error;
+
+        for (int64_t i = 0; i < BPT_TEST_KEYS; i++)
+            present[i] = false;
+
+        ut_equals_bool(ut, true, bpt_empty(tree), __func__);
+        ut_equals_bool(ut, true, bpt_min(tree) == NULL, __func__);
+        ut_equals_bool(ut, false, bpt_pop(tree), __func__);
+
+        bool correct = true;
+        integer_t size = 0;
+
+        srand(42);
+
+        for (int64_t i = 0; i < 100000; i++)
+        {
+            int64_t key = rand() % BPT_TEST_KEYS - BPT_TEST_KEYS / 2;
+            int64_t index = key + BPT_TEST_KEYS / 2;
+
+            if (rand() % 3 != 0)
+            {
+                void *element = new_int64_t(key);
+
+                bool inserted = bpt_insert(tree, element);
+
+                if (inserted == present[index])
+                    correct = false;
+
+                if (inserted)
+                    size++;
+                else
+                    free(element);
+
+                present[index] = true;
+            }
+            else
+            {
+                if (bpt_remove(tree, &key) != present[index])
+                    correct = false;
+
+                if (present[index])
+                    size--;
+
+                present[index] = false;
+            }
+
+            if (bpt_contains(tree, &key) != present[index])
+                correct = false;
+        }
+
+        ut_equals_bool(ut, true, correct, __func__);
+        ut_equals_integer_t(ut, size, bpt_size(tree), __func__);
+
+        struct BPlusTreeTest_s test = { 0, 0, true };
+
+        bpt_traversal(tree, bpt_test_visit, &test);
+
+        ut_equals_bool(ut, true, test.ordered, __func__);
+        ut_equals_integer_t(ut, size, test.count, __func__);
+
+        int64_t min = 0, max = BPT_TEST_KEYS - 1;
+
+        while (!present[min]) min++;
+        while (!present[max]) max--;
+
+        ut_equals_int(ut, (int)(min - BPT_TEST_KEYS / 2),
+                      (int)*(int64_t*)bpt_min(tree), __func__);
+        ut_equals_int(ut, (int)(max - BPT_TEST_KEYS / 2),
+                      (int)*(int64_t*)bpt_max(tree), __func__);
+
+        // Empties the tree from the smallest element
+        while (bpt_pop(tree))
+            size--;
+
+        ut_equals_integer_t(ut, 0, size, __func__);
+        ut_equals_integer_t(ut, 1, bpt_height(tree), __func__);
+        ut_equals_bool(ut, true, bpt_max(tree) == NULL, __func__);
+
+        bpt_free(tree);
+        tree = NULL;
+    }
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) bpt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Bulk loading followed by range queries and changes to the loaded tree
+void bpt_test_bulk_load(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    void **elements = malloc(sizeof(void*) * 10000);
+
+    BPlusTree_t *tree = NULL;
+
+    if (!interface || !elements)
+        goto error;
+
+    // Even numbers from 0 to 19998
+    for (int64_t i = 0; i < 10000; i++)
+        elements[i] = new_int64_t(i * 2);
+
+    // Not sorted
+    void *swap = elements[10];
+    elements[10] = elements[11];
+    elements[11] = swap;
+
+    ut_equals_bool(ut, true, bpt_from_sorted_array(interface, key_int64_t,
+            elements, 10000) == NULL, __func__);
+
+    elements[11] = elements[10];
+    elements[10] = swap;
+
+    tree = bpt_from_sorted_array(interface, key_int64_t, elements, 10000);
+
+    if (!tree)
+        goto error;
+
+    ut_equals_integer_t(ut, 10000, bpt_size(tree), __func__);
+    ut_equals_integer_t(ut, 4, bpt_height(tree), __func__);
+    ut_equals_int(ut, 0, (int)*(int64_t*)bpt_min(tree), __func__);
+    ut_equals_int(ut, 19998, (int)*(int64_t*)bpt_max(tree), __func__);
+
+    int64_t low = 101, high = 300;
+
+    struct BPlusTreeTest_s test = { 0, 0, true };
+
+    ut_equals_integer_t(ut, 100, bpt_range(tree, &low, &high, bpt_test_visit,
+                                           &test), __func__);
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_int(ut, 300, (int)test.previous, __func__);
+
+    low = 19998;
+    high = 30000;
+
+    ut_equals_integer_t(ut, 1, bpt_range(tree, &low, &high, bpt_test_visit,
+                                         &test), __func__);
+
+    high = 100;
+
+    ut_equals_integer_t(ut, 0, bpt_range(tree, &low, &high, bpt_test_visit,
+                                         &test), __func__);
+
+    // Full leaves split and the odd numbers fill the gaps
+    bool correct = true;
+
+    for (int64_t i = 1; i < 20000; i += 2)
+    {
+        if (!bpt_insert(tree, new_int64_t(i)))
+            correct = false;
+    }
+
+    for (int64_t i = 0; i < 20000; i += 4)
+    {
+        if (!bpt_remove(tree, &i))
+            correct = false;
+    }
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        if (bpt_contains(tree, &i) != (i % 4 != 0))
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, 15000, bpt_size(tree), __func__);
+
+    test = (struct BPlusTreeTest_s){ 0, 0, true };
+
+    bpt_traversal(tree, bpt_test_visit, &test);
+
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_integer_t(ut, 15000, test.count, __func__);
+
+    bpt_free(tree);
+    free(elements);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) bpt_free(tree);
+    free(elements);
+    if (interface) interface_free(interface);
+}
+
+// Runs all BPlusTree tests
+Status BPlusTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    bpt_test_insert_remove(ut);
+    bpt_test_bulk_load(ut);
+
+    ut_report(ut, "BPlusTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "BPlusTree");
+    ut_delete(&ut);
+    return st;
+}
@@ -257,6 +257,606 @@ void bst_test_IO3(UnitTest ut)
     ut_error();
 }
 
+// State of bst_test_visit
+struct BinarySearchTreeTest_s
+{
+    int64_t previous;
+    integer_t count;
+    bool ordered;
+};
+
+// Checks that elements are visited in strictly ascending order
+static void
+bst_test_visit(void *element, void *argument)
+{
+    struct BinarySearchTreeTest_s *test = argument;
+
+    int64_t value = *(int64_t*)element;
+
+    if (test->count > 0 && value <= test->previous)
+        test->ordered = false;
+
+    test->previous = value;
+    test->count++;
+}
+
+// Tests range queries and the bounds and steps of iterators
+void bst_test_range(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    BinarySearchTree_t *tree = bst_new(interface);
+
+    BinarySearchTreeIterator_t *iter = NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    iter = bst_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t key = 0;
+
+    ut_equals_bool(ut, true, bst_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, bst_iter_to_start(iter), __func__);
+    ut_equals_bool(ut, false, bst_iter_lower_bound(iter, &key), __func__);
+
+    // Shuffled insertion of the even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!bst_insert(tree, new_int64_t((i * 337) % 1000 * 2)))
+            goto error;
+    }
+
+    int64_t low = 101, high = 300;
+
+    struct BinarySearchTreeTest_s test = { 0, 0, true };
+
+    ut_equals_integer_t(ut, 100, bst_range(tree, &low, &high, bst_test_visit,
+                                           &test), __func__);
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_int(ut, 300, (int)test.previous, __func__);
+    ut_equals_integer_t(ut, 0, bst_range(tree, &high, &low, bst_test_visit,
+                                         &test), __func__);
+
+    // Bounds
+    ut_equals_bool(ut, true, bst_iter_lower_bound(iter, &low), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+
+    key = 102;
+
+    ut_equals_bool(ut, true, bst_iter_lower_bound(iter, &key), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, bst_iter_upper_bound(iter, &key), __func__);
+    ut_equals_int(ut, 104, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, bst_iter_prev(iter), __func__);
+    ut_equals_bool(ut, true, bst_iter_prev(iter), __func__);
+    ut_equals_int(ut, 100, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+
+    key = 1990;
+
+    bst_iter_lower_bound(iter, &key);
+
+    integer_t count = 1;
+
+    while (bst_iter_next(iter))
+        count++;
+
+    ut_equals_integer_t(ut, 5, count, __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+    ut_equals_bool(ut, false, bst_iter_has_next(iter), __func__);
+
+    key = 1998;
+
+    ut_equals_bool(ut, false, bst_iter_upper_bound(iter, &key), __func__);
+    ut_equals_bool(ut, true, bst_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, bst_iter_next(iter), __func__);
+
+    // Full backwards iteration
+    ut_equals_bool(ut, true, bst_iter_to_end(iter), __func__);
+
+    bool ordered = true;
+    int64_t expected = 1998;
+
+    count = 0;
+
+    do
+    {
+        if (*(int64_t*)bst_iter_peek(iter) != expected)
+            ordered = false;
+
+        expected -= 2;
+        count++;
+    }
+    while (bst_iter_prev(iter));
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 1000, count, __func__);
+    ut_equals_bool(ut, false, bst_iter_has_prev(iter), __func__);
+
+    // The iterator stops working after a modification
+    if (!bst_insert(tree, new_int64_t(-1)))
+        goto error;
+
+    ut_equals_bool(ut, true, bst_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, bst_iter_next(iter), __func__);
+    ut_equals_bool(ut, true, bst_iter_to_start(iter), __func__);
+    ut_equals_int(ut, -1, (int)*(int64_t*)bst_iter_peek(iter), __func__);
+
+    bst_iter_free(iter);
+    bst_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) bst_iter_free(iter);
+    if (tree) bst_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Tests building from a sorted buffer and inserting batches
+void bst_test_bulk(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    void **elements = malloc(sizeof(void*) * 1200);
+
+    BinarySearchTree_t *tree = NULL;
+
+    BinarySearchTreeIterator_t *iter = NULL;
+
+    if (!interface || !elements)
+        goto error;
+
+    // Even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t(i * 2);
+
+    void *swap = elements[0];
+    elements[0] = elements[1];
+    elements[1] = swap;
+
+    ut_equals_bool(ut, true, bst_from_sorted_array(interface, elements, 1000)
+                             == NULL, __func__);
+
+    elements[1] = elements[0];
+    elements[0] = swap;
+
+    tree = bst_from_sorted_array(interface, elements, 1000);
+
+    if (!tree)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, bst_count(tree), __func__);
+    ut_equals_int(ut, 0, (int)*(int64_t*)bst_min(tree), __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)bst_max(tree), __func__);
+
+    // Odd numbers from 1 to 1999, shuffled, with 200 duplicates
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t((i * 337) % 1000 * 2 + 1);
+
+    for (int64_t i = 1000; i < 1200; i++)
+        elements[i] = new_int64_t(i % 2 == 0 ? i : i - 999);
+
+    integer_t total = bst_insert_all(tree, elements, 1200);
+
+    ut_equals_integer_t(ut, 1000, total, __func__);
+    ut_equals_integer_t(ut, 2000, bst_count(tree), __func__);
+
+    bool correct = true;
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        if (*(int64_t*)elements[i] != i * 2 + 1)
+            correct = false;
+    }
+
+    for (integer_t i = total; i < 1200; i++)
+        free(elements[i]);
+
+    // A small batch, where the second element is already in the tree
+    elements[0] = new_int64_t(-1);
+    elements[1] = new_int64_t(1000);
+    elements[2] = new_int64_t(2000);
+
+    ut_equals_integer_t(ut, 2, bst_insert_all(tree, elements, 3), __func__);
+    ut_equals_int(ut, 1000, (int)*(int64_t*)elements[2], __func__);
+
+    free(elements[2]);
+
+    iter = bst_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t expected = -1;
+
+    do
+    {
+        if (*(int64_t*)bst_iter_peek(iter) != expected++)
+            correct = false;
+    }
+    while (bst_iter_next(iter));
+
+    ut_equals_bool(ut, true, correct && expected == 2001, __func__);
+
+    // The rebuilt tree still supports removals
+    for (int64_t i = -1; i <= 2000; i += 3)
+    {
+        if (!bst_remove(tree, &i))
+            correct = false;
+    }
+
+    for (int64_t i = -1; i <= 2000; i++)
+    {
+        if (bst_contains(tree, &i) != ((i + 1) % 3 != 0))
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    bst_iter_free(iter);
+    bst_free(tree);
+    free(elements);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) bst_iter_free(iter);
+    if (tree) bst_free(tree);
+    free(elements);
+    if (interface) interface_free(interface);
+}
+
+// A key with a counter, compared only by its key
+struct BinarySearchTreeTestCounter_s
+{
+    int64_t key;
+    int64_t count;
+};
+
+static int
+bst_test_counter_compare(const void *element1, const void *element2)
+{
+    const struct BinarySearchTreeTestCounter_s *counter1 = element1, *counter2 = element2;
+
+    return (counter1->key > counter2->key) - (counter1->key < counter2->key);
+}
+
+static void
+bst_test_counter_merge(void *accumulator, const void *element)
+{
+    ((struct BinarySearchTreeTestCounter_s *)accumulator)->count +=
+            ((const struct BinarySearchTreeTestCounter_s *)element)->count;
+}
+
+static struct BinarySearchTreeTestCounter_s *
+bst_test_counter_new(int64_t key)
+{
+    struct BinarySearchTreeTestCounter_s *counter = malloc(sizeof(struct BinarySearchTreeTestCounter_s));
+
+    if (counter)
+    {
+        counter->key = key;
+        counter->count = 1;
+    }
+
+    return counter;
+}
+
+// Aggregates counters with upserts and looks them up with a single descent
+void bst_test_upsert(UnitTest ut)
+{
+    Interface_t *interface = interface_new(bst_test_counter_compare, NULL,
+                                           NULL, free, NULL, NULL);
+
+    BinarySearchTree_t *tree = interface ? bst_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        struct BinarySearchTreeTestCounter_s *counter = bst_test_counter_new(i % 100);
+
+        if (!counter || !bst_upsert(tree, counter, bst_test_counter_merge))
+        {
+            free(counter);
+            goto error;
+        }
+    }
+
+    ut_equals_integer_t(ut, 100, bst_count(tree), __func__);
+
+    struct BinarySearchTreeTestCounter_s search = { 42, 0 };
+
+    struct BinarySearchTreeTestCounter_s *stored = bst_get(tree, &search);
+
+    ut_equals_bool(ut, true, stored != NULL && stored->count == 10, __func__);
+
+    search.key = 100;
+
+    ut_equals_bool(ut, true, bst_get(tree, &search) == NULL, __func__);
+
+    // An equal element is found and the new one is left to the caller
+    struct BinarySearchTreeTestCounter_s *counter = bst_test_counter_new(42);
+    void *existing = NULL;
+
+    if (!counter)
+        goto error;
+
+    ut_equals_bool(ut, false, bst_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    // A full tree still finds its elements
+    bst_set_limit(tree, 100);
+
+    ut_equals_bool(ut, false, bst_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    counter->key = 100;
+
+    ut_equals_bool(ut, false, bst_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == NULL, __func__);
+
+    bst_set_limit(tree, 0);
+
+    ut_equals_bool(ut, true, bst_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == counter, __func__);
+    ut_equals_integer_t(ut, 101, bst_count(tree), __func__);
+
+    bst_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) bst_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Records the visited elements
+struct BinarySearchTreeTestRecord_s
+{
+    int64_t elements[16];
+    integer_t count;
+};
+
+static void
+bst_test_record(void *element, void *argument)
+{
+    struct BinarySearchTreeTestRecord_s *record = argument;
+
+    if (record->count < 16)
+        record->elements[record->count] = *(int64_t*)element;
+
+    record->count++;
+}
+
+// Checks the elements recorded by a traversal
+static bool
+bst_test_recorded(BinarySearchTree_t *tree, int traversal_mode, const int64_t *expected,
+                   integer_t count)
+{
+    struct BinarySearchTreeTestRecord_s record = { { 0 }, 0 };
+
+    if (!bst_visit(tree, traversal_mode, bst_test_record, &record))
+        return false;
+
+    if (record.count != count)
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (record.elements[i] != expected[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Every traversal order visits the elements without recursion
+void bst_test_traversal(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    BinarySearchTree_t *tree = interface ? bst_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    const int64_t elements[7] = { 4, 2, 6, 1, 3, 5, 7 };
+
+    for (integer_t i = 0; i < 7; i++)
+    {
+        if (!bst_insert(tree, new_int64_t(elements[i])))
+            goto error;
+    }
+
+    const int64_t preorder[7] = { 4, 2, 1, 3, 6, 5, 7 };
+    const int64_t inorder[7] = { 1, 2, 3, 4, 5, 6, 7 };
+    const int64_t postorder[7] = { 1, 3, 2, 5, 7, 6, 4 };
+    const int64_t levelorder[7] = { 4, 2, 6, 1, 3, 5, 7 };
+    const int64_t leaves[4] = { 1, 3, 5, 7 };
+
+    ut_equals_bool(ut, true, bst_test_recorded(tree, -1, preorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, bst_test_recorded(tree, 0, inorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, bst_test_recorded(tree, 1, postorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, bst_test_recorded(tree, 2, levelorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, bst_test_recorded(tree, 3, leaves, 4),
+                   __func__);
+
+    bst_free(tree);
+
+    // A degenerate tree is as deep as it is big
+    tree = bst_new(interface);
+
+    if (!tree)
+        goto error;
+
+    for (int64_t i = 0; i < 5000; i++)
+    {
+        if (!bst_insert(tree, new_int64_t(i)))
+            goto error;
+    }
+
+    struct BinarySearchTreeTestRecord_s record = { { 0 }, 0 };
+
+    for (int mode = -1; mode <= 2; mode++)
+    {
+        record.count = 0;
+
+        bst_visit(tree, mode, bst_test_record, &record);
+
+        ut_equals_integer_t(ut, 5000, record.count, __func__);
+    }
+
+    record.count = 0;
+
+    bst_visit(tree, 3, bst_test_record, &record);
+
+    ut_equals_integer_t(ut, 1, record.count, __func__);
+
+    bst_free(tree);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) bst_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Splay and treap trees keep sorted insertions usable
+void bst_test_engines(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    BinarySearchTree_t *tree = NULL;
+
+    if (!interface)
+        goto error;
+
+    const BinarySearchTreeEngine engines[2] = { BST_SPLAY, BST_TREAP };
+
+    for (integer_t e = 0; e < 2; e++)
+    {
+        tree = bst_create(interface, engines[e]);
+
+        if (!tree)
+            goto error;
+
+        ut_equals_int(ut, engines[e], bst_engine(tree), __func__);
+
+        for (int64_t i = 0; i < 5000; i++)
+        {
+            if (!bst_insert(tree, new_int64_t(i)))
+                goto error;
+        }
+
+        int64_t *duplicate = new_int64_t(100);
+
+        ut_equals_bool(ut, false, bst_insert(tree, duplicate), __func__);
+
+        free(duplicate);
+
+        // Still ordered
+        struct BinarySearchTreeTestRecord_s record = { { 0 }, 0 };
+        const int64_t first[16] = { 0, 1, 2, 3, 4, 5, 6, 7,
+                                    8, 9, 10, 11, 12, 13, 14, 15 };
+
+        bst_visit(tree, 0, bst_test_record, &record);
+
+        ut_equals_integer_t(ut, 5000, record.count, __func__);
+        ut_equals_bool(ut, true, memcmp(first, record.elements,
+                                        sizeof(first)) == 0, __func__);
+
+        // Every even element is removed
+        bool correct = true;
+
+        for (int64_t i = 0; i < 5000; i += 2)
+        {
+            if (!bst_remove(tree, &i))
+                correct = false;
+        }
+
+        for (int64_t i = 0; i < 5000; i++)
+        {
+            if (bst_contains(tree, &i) != (i % 2 == 1))
+                correct = false;
+        }
+
+        ut_equals_bool(ut, true, correct, __func__);
+        ut_equals_integer_t(ut, 2500, bst_count(tree), __func__);
+
+        record.count = 0;
+
+        bst_visit(tree, 0, bst_test_record, &record);
+
+        ut_equals_integer_t(ut, 2500, record.count, __func__);
+        ut_equals_bool(ut, true, record.elements[0] == 1 &&
+                                 record.elements[15] == 31, __func__);
+
+        if (engines[e] == BST_SPLAY)
+        {
+            // The last element reached is at the root
+            int64_t key = 2021;
+
+            bst_contains(tree, &key);
+
+            ut_equals_int(ut, 2021, (int)*(int64_t*)bst_peek(tree), __func__);
+        }
+        else
+        {
+            // A chain would have a single leaf
+            record.count = 0;
+
+            bst_visit(tree, 3, bst_test_record, &record);
+
+            ut_equals_bool(ut, true, record.count > 500, __func__);
+        }
+
+        bst_free(tree);
+
+        tree = NULL;
+    }
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) bst_free(tree);
+    if (interface) interface_free(interface);
+}
+
 // Runs all BinarySearchTree tests
 Status BinarySearchTreeTests(void)
 {
@@ -271,6 +871,11 @@ Status BinarySearchTreeTests(void)
     bst_test_IO1(ut);
     bst_test_IO2(ut);
     bst_test_IO3(ut);
+    bst_test_range(ut);
+    bst_test_bulk(ut);
+    bst_test_upsert(ut);
+    bst_test_traversal(ut);
+    bst_test_engines(ut);
 
     ut_report(ut, "BinarySearchTree");
 
@@ -7,6 +7,7 @@
  */
 
 #include "BitArray.h"
+#include "BitKernels.h"
 #include "UnitTest.h"
 #include "Utility.h"
 
@@ -1024,6 +1025,340 @@ void bit_test_intersects(UnitTest ut)
     ut_error();
 }
 
+// Checks every kernel supported by the CPU against a bit by bit reference for
+// sizes that do not fill whole vectors
+void bit_test_kernels(UnitTest ut)
+{
+    const unsigned_t sizes[] = { 1, 63, 64, 65, 255, 1000, 4097, 100000 };
+    const unsigned_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    BitArray_t *bits1 = NULL, *bits2 = NULL, *result = NULL;
+
+    bool correct = true;
+
+    for (int k = BitKernelScalar; k <= BitKernelAVX512; k++)
+    {
+        if (!bkn_use((BitKernel)k))
+            continue;
+
+        for (unsigned_t s = 0; s < sizes_count; s++)
+        {
+            unsigned_t size = sizes[s];
+
+            bits1 = bit_create(size);
+            bits2 = bit_create(size);
+
+            if (!bits1 || !bits2)
+                goto error;
+
+            unsigned_t count = 0;
+
+            for (unsigned_t i = 0; i < size; i++)
+            {
+                if (random_int32_t(0, 3) == 0)
+                {
+                    bit_set(bits1, i);
+                    count++;
+                }
+
+                if (random_int32_t(0, 3) == 0)
+                    bit_set(bits2, i);
+            }
+
+            if (bit_cardinality(bits1) != count)
+                correct = false;
+
+            bool intersects = false;
+
+            for (unsigned_t i = 0; i < size; i++)
+            {
+                if (bit_get(bits1, i) && bit_get(bits2, i))
+                    intersects = true;
+            }
+
+            if (bit_intersects(bits1, bits2) != intersects)
+                correct = false;
+
+            // 0 AND, 1 OR, 2 XOR, 3 DIFF
+            for (int op = 0; op < 4; op++)
+            {
+                result = bit_copy(bits1);
+
+                if (!result)
+                    goto error;
+
+                switch (op)
+                {
+                    case 0: bit_AND(result, bits2); break;
+                    case 1: bit_OR(result, bits2); break;
+                    case 2: bit_XOR(result, bits2); break;
+                    default: bit_DIFF(result, bits2); break;
+                }
+
+                for (unsigned_t i = 0; i < size; i++)
+                {
+                    bool a = bit_get(bits1, i), b = bit_get(bits2, i);
+                    bool expected = op == 0 ? a && b : op == 1 ? a || b
+                                  : op == 2 ? a != b : a && !b;
+
+                    if (bit_get(result, i) != expected)
+                        correct = false;
+                }
+
+                bit_free(result);
+                result = NULL;
+            }
+
+            bit_free(bits1);
+            bit_free(bits2);
+            bits1 = bits2 = NULL;
+        }
+    }
+
+    bkn_use(BitKernelAVX512);
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    bkn_use(BitKernelAVX512);
+    if (bits1) bit_free(bits1);
+    if (bits2) bit_free(bits2);
+    if (result) bit_free(result);
+    ut_error();
+}
+
+// Tests bit_next_set and bit_next_clear with every supported kernel
+void bit_test_next(UnitTest ut)
+{
+    const unsigned_t size = 10000;
+
+    BitArray_t *bits = bit_create(size);
+
+    if (!bits)
+        goto error;
+
+    // A few set bits far apart so whole vectors are skipped
+    const unsigned_t set[] = { 3, 64, 65, 900, 5000, 9999 };
+    const unsigned_t set_count = sizeof(set) / sizeof(set[0]);
+
+    for (unsigned_t i = 0; i < set_count; i++)
+        bit_set(bits, set[i]);
+
+    bool correct = true;
+
+    for (int k = BitKernelScalar; k <= BitKernelAVX512; k++)
+    {
+        if (!bkn_use((BitKernel)k))
+            continue;
+
+        unsigned_t j = 0;
+
+        for (unsigned_t i = bit_next_set(bits, 0); i != (unsigned_t)-1;
+             i = bit_next_set(bits, i + 1))
+        {
+            if (j >= set_count || i != set[j])
+                correct = false;
+
+            j++;
+        }
+
+        if (j != set_count)
+            correct = false;
+
+        if (bit_next_set(bits, 901) != 5000)
+            correct = false;
+
+        // Flip every bit so the clear bits are where the set ones were
+        bit_NOT(bits);
+
+        j = 0;
+
+        for (unsigned_t i = bit_next_clear(bits, 0); i != (unsigned_t)-1;
+             i = bit_next_clear(bits, i + 1))
+        {
+            if (j >= set_count || i != set[j])
+                correct = false;
+
+            j++;
+        }
+
+        if (j != set_count)
+            correct = false;
+
+        bit_NOT(bits);
+    }
+
+    bkn_use(BitKernelAVX512);
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    // Out of range and nothing to be found
+    ut_equals_unsigned_t(ut, (unsigned_t)-1, bit_next_set(bits, size),
+                         __func__);
+
+    bit_empty(bits);
+
+    ut_equals_unsigned_t(ut, (unsigned_t)-1, bit_next_set(bits, 0), __func__);
+    ut_equals_unsigned_t(ut, 0, bit_next_clear(bits, 0), __func__);
+
+    bit_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Tests bit_rank and bit_select with and without a directory, including a
+// stale directory after the bit array is modified
+void bit_test_rank_select(UnitTest ut)
+{
+    const unsigned_t size = 300007;
+
+    BitArray_t *bits = bit_create(size);
+    unsigned_t *ranks = malloc(sizeof(unsigned_t) * (size + 1));
+
+    if (!bits || !ranks)
+        goto error;
+
+    bool correct = true;
+
+    // 0 sparse, 1 dense, 2 sparse and indexed, 3 dense and indexed
+    for (int pass = 0; pass < 4; pass++)
+    {
+        bit_empty(bits);
+
+        int density = pass % 2 == 0 ? 500 : 2;
+
+        for (unsigned_t i = 0; i < size; i++)
+        {
+            if (random_int32_t(0, density - 1) == 0)
+                bit_set(bits, i);
+        }
+
+        if (pass >= 2 && !bit_build_index(bits))
+            goto error;
+
+        // Modifying after building makes the directory stale
+        if (pass == 3)
+            bit_flip(bits, 12345);
+
+        ranks[0] = 0;
+
+        for (unsigned_t i = 0; i < size; i++)
+            ranks[i + 1] = ranks[i] + (bit_get(bits, i) ? 1 : 0);
+
+        for (unsigned_t i = 0; i <= size; i += 13)
+        {
+            if (bit_rank(bits, i) != ranks[i])
+                correct = false;
+        }
+
+        if (bit_rank(bits, size) != ranks[size])
+            correct = false;
+
+        for (unsigned_t i = 0; i < size; i++)
+        {
+            // Every set bit is selected by its own rank
+            if (bit_get(bits, i) && bit_select(bits, ranks[i]) != i)
+                correct = false;
+        }
+
+        if (bit_select(bits, ranks[size]) != (unsigned_t)-1)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    // Bits past the used ones are never counted
+    bit_fill(bits);
+
+    ut_equals_unsigned_t(ut, size, bit_rank(bits, size + 100), __func__);
+    ut_equals_unsigned_t(ut, size - 1, bit_select(bits, size - 1), __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)-1, bit_select(bits, size),
+                         __func__);
+
+    bit_drop_index(bits);
+
+    ut_equals_unsigned_t(ut, size, bit_rank(bits, size), __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)-1, bit_select(bits, size),
+                         __func__);
+
+    bit_free(bits);
+    free(ranks);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) bit_free(bits);
+    free(ranks);
+}
+
+// Bits survive closing and opening the file again
+void bit_test_map(UnitTest ut)
+{
+    const char *path = "bit_test_map.bin";
+
+    remove(path);
+
+    BitArray_t *bits = bit_map(path, 1000);
+
+    if (!bits)
+        goto error;
+
+    ut_equals_unsigned_t(ut, 1000, bit_nbits(bits), __func__);
+    ut_equals_unsigned_t(ut, 0, bit_cardinality(bits), __func__);
+
+    for (unsigned_t i = 0; i < 1000; i += 3)
+        bit_set(bits, i);
+
+    // Growing resizes the file
+    bit_set(bits, 200000);
+
+    ut_equals_bool(ut, true, bit_sync(bits), __func__);
+
+    unsigned_t nbits = bit_nbits(bits);
+
+    bit_free(bits);
+
+    bits = bit_map(path, 0);
+
+    if (!bits)
+        goto error;
+
+    ut_equals_unsigned_t(ut, nbits, bit_nbits(bits), __func__);
+    ut_equals_unsigned_t(ut, 335, bit_cardinality(bits), __func__);
+    ut_equals_bool(ut, true, bit_get(bits, 999), __func__);
+    ut_equals_bool(ut, false, bit_get(bits, 998), __func__);
+    ut_equals_bool(ut, true, bit_get(bits, 200000), __func__);
+
+    // Shrinking drops the bits past the new size
+    if (!bit_resize(bits, 100))
+        goto error;
+
+    if (!bit_resize(bits, 300000))
+        goto error;
+
+    ut_equals_unsigned_t(ut, 34, bit_cardinality(bits), __func__);
+
+    bit_free(bits);
+    remove(path);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) bit_free(bits);
+    remove(path);
+}
+
 // Runs all BitArray tests
 Status BitArrayTests(void)
 {
@@ -1056,6 +1391,10 @@ Status BitArrayTests(void)
     bit_test_flip_range(ut);
     bit_test_put_range(ut);
     bit_test_intersects(ut);
+    bit_test_kernels(ut);
+    bit_test_next(ut);
+    bit_test_rank_select(ut);
+    bit_test_map(ut);
 
     ut_report(ut, "BitArray");
     ut_delete(&ut);
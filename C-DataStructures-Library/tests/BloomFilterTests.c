@@ -0,0 +1,222 @@
+/**
+ * @file BloomFilterTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "BloomFilter.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Inserted keys are even and probed keys are odd so every hit is a false
+// positive
+static const int64_t blf_test_keys = 20000;
+
+// Measures the false positive rate of a filter filled with the even keys
+static double
+blf_test_measure(BloomFilter_t *filter)
+{
+    integer_t positives = 0;
+
+    for (int64_t i = 0; i < blf_test_keys; i++)
+    {
+        int64_t key = i * 2 + 1;
+
+        if (blf_contains(filter, &key))
+            positives++;
+    }
+
+    return (double)positives / (double)blf_test_keys;
+}
+
+// Every inserted element is found and the false positive rate stays close to
+// the target for both layouts
+void blf_test_false_positives(UnitTest ut)
+{
+    BloomFilter_t *filter = NULL;
+
+    for (int blocked = 0; blocked < 2; blocked++)
+    {
+        filter = blocked ? blf_new_blocked(hash_int64_t, blf_test_keys, 0.01)
+                         : blf_new(hash_int64_t, blf_test_keys, 0.01);
+
+        if (!filter)
+            goto error;
+
+        for (int64_t i = 0; i < blf_test_keys; i++)
+        {
+            int64_t key = i * 2;
+
+            if (!blf_insert(filter, &key))
+                goto error;
+        }
+
+        bool found = true;
+
+        for (int64_t i = 0; i < blf_test_keys; i++)
+        {
+            int64_t key = i * 2;
+
+            if (!blf_contains(filter, &key))
+                found = false;
+        }
+
+        double measured = blf_test_measure(filter);
+        double estimated = blf_false_positive_rate(filter);
+
+        ut_equals_bool(ut, true, found, __func__);
+        ut_equals_bool(ut, blocked == 1, blf_blocked(filter), __func__);
+        ut_equals_unsigned_t(ut, blf_test_keys, blf_count(filter), __func__);
+        ut_equals_integer_t(ut, 7, blf_hashes(filter), __func__);
+        ut_equals_bool(ut, true, measured < 0.02, __func__);
+        ut_equals_bool(ut, true, estimated < 0.02, __func__);
+
+        blf_free(filter);
+        filter = NULL;
+    }
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (filter) blf_free(filter);
+}
+
+// Tests blf_create parameters and blf_empty
+void blf_test_create(UnitTest ut)
+{
+    BloomFilter_t *filter = blf_create(hash_int64_t, 1000, 3, true);
+
+    if (!filter)
+        goto error;
+
+    ut_equals_unsigned_t(ut, 1024, blf_nbits(filter), __func__);
+    ut_equals_bool(ut, true, blf_new(hash_int64_t, 0, 0.01) == NULL, __func__);
+    ut_equals_bool(ut, true, blf_new(hash_int64_t, 10, 1.0) == NULL, __func__);
+    ut_equals_bool(ut, true, blf_create(hash_int64_t, 10, 0, false) == NULL,
+                   __func__);
+
+    int64_t key = 42;
+
+    if (!blf_insert(filter, &key))
+        goto error;
+
+    ut_equals_bool(ut, true, blf_contains(filter, &key), __func__);
+
+    if (!blf_empty(filter))
+        goto error;
+
+    ut_equals_bool(ut, false, blf_contains(filter, &key), __func__);
+    ut_equals_unsigned_t(ut, 0, blf_count(filter), __func__);
+
+    blf_free(filter);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (filter) blf_free(filter);
+}
+
+// Tests blf_union and blf_intersection against filters of split key sets
+void blf_test_operations(UnitTest ut)
+{
+    BloomFilter_t *filter1 = blf_new(hash_int64_t, 1000, 0.01);
+    BloomFilter_t *filter2 = blf_new(hash_int64_t, 1000, 0.01);
+    BloomFilter_t *other = blf_new(hash_int64_t, 2000, 0.01);
+    BloomFilter_t *copy = NULL;
+
+    if (!filter1 || !filter2 || !other)
+        goto error;
+
+    // filter1 has [0, 1000) and filter2 has [500, 1500)
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        int64_t key1 = i, key2 = i + 500;
+
+        if (!blf_insert(filter1, &key1) || !blf_insert(filter2, &key2))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, blf_union(filter1, other), __func__);
+
+    copy = blf_copy(filter1);
+
+    if (!copy)
+        goto error;
+
+    if (!blf_union(copy, filter2) || !blf_intersection(filter1, filter2))
+        goto error;
+
+    bool in_union = true, in_intersection = true;
+
+    for (int64_t i = 0; i < 1500; i++)
+    {
+        if (!blf_contains(copy, &i))
+            in_union = false;
+
+        if (i >= 500 && i < 1000 && !blf_contains(filter1, &i))
+            in_intersection = false;
+    }
+
+    ut_equals_bool(ut, true, in_union, __func__);
+    ut_equals_bool(ut, true, in_intersection, __func__);
+    ut_equals_unsigned_t(ut, 2000, blf_count(copy), __func__);
+
+    // Most of the keys outside the intersection are rejected
+    integer_t positives = 0;
+
+    for (int64_t i = 0; i < 500; i++)
+    {
+        if (blf_contains(filter1, &i))
+            positives++;
+    }
+
+    ut_equals_bool(ut, true, positives < 250, __func__);
+
+    blf_free(filter1);
+    blf_free(filter2);
+    blf_free(other);
+    blf_free(copy);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (filter1) blf_free(filter1);
+    if (filter2) blf_free(filter2);
+    if (other) blf_free(other);
+    if (copy) blf_free(copy);
+}
+
+// Runs all BloomFilter tests
+Status BloomFilterTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    blf_test_false_positives(ut);
+    blf_test_create(ut);
+    blf_test_operations(ut);
+
+    ut_report(ut, "BloomFilter");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "BloomFilter");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file CacheTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Cache.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+static integer_t cch_test_evicted = 0;
+
+static void cch_count_evicted(void *value)
+{
+    cch_test_evicted++;
+    free(value);
+}
+
+static integer_t cch_weigh_value(const void *key, const void *value)
+{
+    (void)key;
+    return *(const int64_t *)value;
+}
+
+// Least recently used entries are evicted first
+void cch_test_lru(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Cache_t *cache = cch_new(int_interface, int_interface, CACHE_LRU, 3);
+
+    if (!int_interface || !cache)
+        goto error;
+
+    cch_on_evict(cache, cch_count_evicted);
+    cch_test_evicted = 0;
+
+    for (int64_t i = 1; i <= 3; i++)
+    {
+        if (!cch_put(cache, new_int64_t(i), new_int64_t(i * 10)))
+            goto error;
+    }
+
+    int64_t key = 1;
+
+    // 1 becomes the most recently used, so 2 is evicted
+    ut_equals_int(ut, 10, (int)*(int64_t *)cch_get(cache, &key), __func__);
+
+    if (!cch_put(cache, new_int64_t(4), new_int64_t(40)))
+        goto error;
+
+    key = 2;
+
+    ut_equals_bool(ut, false, cch_contains(cache, &key), __func__);
+    ut_equals_bool(ut, true, cch_get(cache, &key) == NULL, __func__);
+    ut_equals_integer_t(ut, 1, cch_test_evicted, __func__);
+
+    // Replacing a value doesn't evict anything
+    if (!cch_put(cache, new_int64_t(3), new_int64_t(33)))
+        goto error;
+
+    key = 3;
+
+    ut_equals_int(ut, 33, (int)*(int64_t *)cch_peek(cache, &key), __func__);
+    ut_equals_integer_t(ut, 3, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 1, cch_evictions(cache), __func__);
+
+    // 1 was used before 3 and 4
+    if (!cch_put(cache, new_int64_t(5), new_int64_t(50)))
+        goto error;
+
+    key = 1;
+
+    ut_equals_bool(ut, false, cch_contains(cache, &key), __func__);
+    ut_equals_integer_t(ut, 1, cch_hits(cache), __func__);
+    ut_equals_integer_t(ut, 1, cch_misses(cache), __func__);
+
+    key = 4;
+
+    ut_equals_bool(ut, true, cch_remove(cache, &key), __func__);
+    ut_equals_bool(ut, false, cch_remove(cache, &key), __func__);
+    ut_equals_integer_t(ut, 2, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 2, cch_test_evicted, __func__);
+
+    cch_erase(cache);
+
+    ut_equals_bool(ut, true, cch_empty(cache), __func__);
+
+    cch_free(cache);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (cache) cch_free(cache);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Least frequently used entries are evicted first
+void cch_test_lfu(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Cache_t *cache = cch_new(int_interface, int_interface, CACHE_LFU, 100);
+
+    if (!int_interface || !cache)
+        goto error;
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        if (!cch_put(cache, new_int64_t(i), new_int64_t(i)))
+            goto error;
+    }
+
+    // Every key but 0 and 1 is used as many times as its value
+    for (int64_t i = 2; i < 100; i++)
+    {
+        for (int64_t j = 0; j < i; j++)
+            cch_get(cache, &i);
+    }
+
+    int64_t key = 1;
+
+    cch_get(cache, &key);
+
+    // 0 was never used
+    if (!cch_put(cache, new_int64_t(100), new_int64_t(100)))
+        goto error;
+
+    key = 0;
+
+    ut_equals_bool(ut, false, cch_contains(cache, &key), __func__);
+
+    // 100 was used less times than 1, even if more recently
+    if (!cch_put(cache, new_int64_t(101), new_int64_t(101)))
+        goto error;
+
+    key = 100;
+
+    ut_equals_bool(ut, false, cch_contains(cache, &key), __func__);
+
+    bool kept = true;
+
+    for (int64_t i = 1; i < 100; i++)
+    {
+        if (!cch_contains(cache, &i))
+            kept = false;
+    }
+
+    ut_equals_bool(ut, true, kept, __func__);
+    ut_equals_integer_t(ut, 100, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 2, cch_evictions(cache), __func__);
+
+    cch_free(cache);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (cache) cch_free(cache);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Capacity given by the weight of the entries
+void cch_test_weight(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Cache_t *cache = cch_create(int_interface, int_interface, CACHE_LRU, 100,
+                                cch_weigh_value);
+
+    if (!int_interface || !cache)
+        goto error;
+
+    for (int64_t i = 0; i < 4; i++)
+    {
+        if (!cch_put(cache, new_int64_t(i), new_int64_t(30)))
+            goto error;
+    }
+
+    // Only three entries of weight 30 fit
+    ut_equals_integer_t(ut, 3, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 90, cch_weight(cache), __func__);
+
+    int64_t *key = new_int64_t(10);
+    int64_t *value = new_int64_t(101);
+
+    // Too heavy for the whole cache
+    ut_equals_bool(ut, false, cch_put(cache, key, value), __func__);
+
+    free(key);
+    free(value);
+
+    if (!cch_put(cache, new_int64_t(10), new_int64_t(70)))
+        goto error;
+
+    ut_equals_integer_t(ut, 2, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 100, cch_weight(cache), __func__);
+
+    // Growing an entry evicts others but never itself
+    if (!cch_put(cache, new_int64_t(10), new_int64_t(100)))
+        goto error;
+
+    ut_equals_integer_t(ut, 1, cch_count(cache), __func__);
+    ut_equals_integer_t(ut, 100, cch_weight(cache), __func__);
+
+    cch_free(cache);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (cache) cch_free(cache);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Runs all Cache tests
+Status CacheTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    cch_test_lru(ut);
+    cch_test_lfu(ut);
+    cch_test_weight(ut);
+
+    ut_report(ut, "Cache");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Cache");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,399 @@
+/**
+ * @file ChannelTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+// poll is not part of strict C11
+#define _POSIX_C_SOURCE 200809L
+
+#include "Channel.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+// Amount of threads on each side and of values sent by each producer
+#define CHN_TEST_THREADS 4
+#define CHN_TEST_VALUES 20000
+
+// Shared by the producers and consumers of chn_test_threads
+struct ChannelTest_s
+{
+    Channel_t *channel;
+    integer_t id;
+    integer_t received;
+    unsigned_t sum;
+    bool ordered;
+};
+
+// Sends id * CHN_TEST_VALUES + 1 to (id + 1) * CHN_TEST_VALUES in order,
+// blocking while the channel is full
+static void *
+chn_test_producer(void *argument)
+{
+    struct ChannelTest_s *test = argument;
+
+    void *batch[8];
+
+    integer_t value = test->id * CHN_TEST_VALUES + 1;
+    integer_t last = (test->id + 1) * CHN_TEST_VALUES;
+
+    while (value <= last)
+    {
+        if (test->id % 2 == 0)
+        {
+            integer_t size = 0;
+
+            while (size < 8 && value + size <= last)
+            {
+                batch[size] = (void*)(intptr_t)(value + size);
+                size++;
+            }
+
+            value += chn_send_n(test->channel, batch, size, -1);
+        }
+        else if (chn_send(test->channel, (void*)(intptr_t)value, -1) == CHN_OK)
+        {
+            value++;
+        }
+    }
+
+    return NULL;
+}
+
+// Receives values until the channel is closed, checking that the values of
+// each producer come in order
+static void *
+chn_test_consumer(void *argument)
+{
+    struct ChannelTest_s *test = argument;
+
+    integer_t previous[CHN_TEST_THREADS] = { 0 };
+
+    void *batch[8];
+
+    for (;;)
+    {
+        integer_t size = chn_receive_n(test->channel, batch,
+                                       test->id % 2 == 0 ? 8 : 1, -1);
+
+        if (size == 0)
+            break;
+
+        for (integer_t i = 0; i < size; i++)
+        {
+            integer_t value = (integer_t)(intptr_t)batch[i];
+
+            integer_t producer = (value - 1) / CHN_TEST_VALUES;
+
+            if (value <= previous[producer])
+                test->ordered = false;
+
+            previous[producer] = value;
+
+            test->received++;
+            test->sum += (unsigned_t)value;
+        }
+    }
+
+    return NULL;
+}
+
+// Shared with the receiver of chn_test_fd
+struct ChannelWaiter_s
+{
+    Channel_t *channel;
+    ChannelResult status;
+};
+
+// Blocks until the channel is closed
+static void *
+chn_test_closed(void *argument)
+{
+    struct ChannelWaiter_s *waiter = argument;
+
+    void *result;
+
+    waiter->status = chn_receive(waiter->channel, &result, -1);
+
+    return NULL;
+}
+
+// Timeouts, full and empty channels and close semantics in a single thread
+void chn_test_basic(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                               display_int32_t, free,
+                                               NULL, NULL);
+
+    Channel_t *channel = chn_new(int_interface, 4);
+
+    if (!int_interface || !channel)
+        goto error;
+
+    ut_equals_bool(ut, true, chn_new(int_interface, 0) == NULL, __func__);
+    ut_equals_integer_t(ut, 4, chn_capacity(channel), __func__);
+
+    void *result, *buffer[8];
+
+    ut_equals_int(ut, CHN_TIMEOUT, chn_receive(channel, &result, 0),
+                  __func__);
+    ut_equals_int(ut, CHN_TIMEOUT, chn_receive(channel, &result, 20),
+                  __func__);
+    ut_equals_bool(ut, true, result == NULL, __func__);
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        if (chn_send(channel, new_int32_t(i), 0) != CHN_OK)
+            goto error;
+    }
+
+    void *element = new_int32_t(4);
+
+    ut_equals_int(ut, CHN_TIMEOUT, chn_send(channel, element, 20), __func__);
+    ut_equals_integer_t(ut, 0, chn_send_n(channel, &element, 1, 0),
+                        __func__);
+    ut_equals_integer_t(ut, 4, chn_count(channel), __func__);
+
+    // Takes what is available without waiting for more
+    integer_t size = chn_receive_n(channel, buffer, 8, -1);
+
+    bool ordered = size == 4;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        ordered = ordered && *(int32_t*)buffer[i] == (int32_t)i;
+
+        free(buffer[i]);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    // The elements left can still be received after closing
+    buffer[0] = element;
+    buffer[1] = new_int32_t(5);
+    buffer[2] = new_int32_t(6);
+
+    ut_equals_integer_t(ut, 3, chn_send_n(channel, buffer, 3, 0), __func__);
+
+    chn_close(channel);
+    chn_close(channel);
+
+    element = new_int32_t(7);
+
+    ut_equals_bool(ut, true, chn_closed(channel), __func__);
+    ut_equals_int(ut, CHN_CLOSED, chn_send(channel, element, -1), __func__);
+
+    free(element);
+
+    ut_equals_int(ut, CHN_OK, chn_receive(channel, &result, -1), __func__);
+    ut_equals_int(ut, 4, *(int32_t*)result, __func__);
+
+    free(result);
+
+    ut_equals_integer_t(ut, 1, chn_receive_n(channel, buffer, 1, -1),
+                        __func__);
+    ut_equals_int(ut, 5, *(int32_t*)buffer[0], __func__);
+
+    free(buffer[0]);
+
+    // The last element is freed with the channel
+    chn_free(channel);
+
+    channel = chn_new(int_interface, 1);
+
+    if (!channel)
+        goto error;
+
+    chn_close(channel);
+
+    ut_equals_int(ut, CHN_CLOSED, chn_receive(channel, &result, -1),
+                  __func__);
+    ut_equals_integer_t(ut, 0, chn_receive_n(channel, buffer, 8, -1),
+                        __func__);
+
+    chn_free(channel);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (channel) chn_free(channel);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Many blocking producers and consumers exchange every value exactly once
+void chn_test_threads(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    Channel_t *channel = chn_new(&int_interface, 16);
+
+    if (!channel)
+        goto error;
+
+    integer_t total = CHN_TEST_THREADS * CHN_TEST_VALUES;
+
+    struct ChannelTest_s producers[CHN_TEST_THREADS];
+    struct ChannelTest_s consumers[CHN_TEST_THREADS];
+
+    pthread_t producer_threads[CHN_TEST_THREADS];
+    pthread_t consumer_threads[CHN_TEST_THREADS];
+
+    for (integer_t i = 0; i < CHN_TEST_THREADS; i++)
+    {
+        producers[i] = (struct ChannelTest_s){ channel, i, 0, 0, true };
+        consumers[i] = (struct ChannelTest_s){ channel, i, 0, 0, true };
+
+        pthread_create(&producer_threads[i], NULL, chn_test_producer,
+                       &producers[i]);
+        pthread_create(&consumer_threads[i], NULL, chn_test_consumer,
+                       &consumers[i]);
+    }
+
+    for (integer_t i = 0; i < CHN_TEST_THREADS; i++)
+        pthread_join(producer_threads[i], NULL);
+
+    // Consumers stop once every value was received
+    chn_close(channel);
+
+    integer_t received = 0;
+    unsigned_t sum = 0;
+    bool ordered = true;
+
+    for (integer_t i = 0; i < CHN_TEST_THREADS; i++)
+    {
+        pthread_join(consumer_threads[i], NULL);
+
+        received += consumers[i].received;
+        sum += consumers[i].sum;
+        ordered = ordered && consumers[i].ordered;
+    }
+
+    ut_equals_integer_t(ut, total, received, __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)total * (unsigned_t)(total + 1) / 2,
+                         sum, __func__);
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 0, chn_count(channel), __func__);
+
+    chn_free(channel);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (channel) chn_free(channel);
+}
+
+// The eventfd is readable exactly while there is something to receive and
+// closing wakes up a blocked receiver
+void chn_test_fd(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    Channel_t *channel = chn_new(&int_interface, 8);
+
+    if (!channel)
+        goto error;
+
+    void *buffer[8];
+
+#ifdef __linux__
+    struct pollfd watch = { chn_fd(channel), POLLIN, 0 };
+
+    ut_equals_bool(ut, true, chn_fd(channel) >= 0, __func__);
+    ut_equals_int(ut, 0, poll(&watch, 1, 0), __func__);
+
+    for (int32_t i = 0; i < 3; i++)
+        buffer[i] = new_int32_t(i);
+
+    if (chn_send_n(channel, buffer, 3, 0) != 3)
+        goto error;
+
+    ut_equals_int(ut, 1, poll(&watch, 1, 0), __func__);
+
+    if (chn_receive_n(channel, buffer, 1, 0) != 1)
+        goto error;
+
+    free(buffer[0]);
+
+    ut_equals_int(ut, 1, poll(&watch, 1, 0), __func__);
+
+    if (chn_receive_n(channel, buffer, 8, 0) != 2)
+        goto error;
+
+    free(buffer[0]);
+    free(buffer[1]);
+
+    ut_equals_int(ut, 0, poll(&watch, 1, 0), __func__);
+#else
+    (void)buffer;
+
+    ut_equals_int(ut, -1, chn_fd(channel), __func__);
+#endif
+
+    struct ChannelWaiter_s waiter = { channel, CHN_OK };
+
+    pthread_t thread;
+
+    pthread_create(&thread, NULL, chn_test_closed, &waiter);
+
+    chn_close(channel);
+
+    pthread_join(thread, NULL);
+
+    ut_equals_int(ut, CHN_CLOSED, waiter.status, __func__);
+
+#ifdef __linux__
+    ut_equals_int(ut, 1, poll(&watch, 1, 0), __func__);
+#endif
+
+    chn_free(channel);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (channel) chn_free(channel);
+}
+
+// Runs all Channel tests
+Status ChannelTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    chn_test_basic(ut);
+    chn_test_threads(ut);
+    chn_test_fd(ut);
+
+    ut_report(ut, "Channel");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Channel");
+    ut_delete(&ut);
+    return st;
+}
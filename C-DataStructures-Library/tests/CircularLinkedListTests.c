@@ -10,6 +10,25 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The list expects functions that take non-const elements
+static int
+cll_test_compare(void *element1, void *element2)
+{
+    return compare_int32_t(element1, element2);
+}
+
+static void *
+cll_test_copy(void *element)
+{
+    return copy_int32_t(element);
+}
+
+static void
+cll_test_display(void *element)
+{
+    display_int32_t(element);
+}
+
 // Tests limit functionality
 Status cll_test_limit(UnitTest ut)
 {
@@ -61,6 +80,70 @@ Status cll_test_limit(UnitTest ut)
     return st;
 }
 
+// Tests sorting starting at the cursor
+Status cll_test_sort(UnitTest ut)
+{
+    CircularLinkedList list;
+
+    Status st = cll_create(&list, cll_test_compare, cll_test_copy,
+                           cll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        st = cll_insert_after(list, new_int32_t(random_int32_t(0, 100)));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    st = cll_iter_next(list, 300);
+    st += cll_sort(list);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, *(int32_t*)cll_min(list), *(int32_t*)cll_peek(list), __func__);
+    ut_equals_int(ut, *(int32_t*)cll_max(list), *(int32_t*)cll_peek_prev(list), __func__);
+
+    int32_t last = -1;
+    bool sorted = true;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        if (*(int32_t*)cll_peek(list) < last)
+            sorted = false;
+
+        last = *(int32_t*)cll_peek(list);
+
+        cll_iter_next(list, 1);
+    }
+
+    // Back at the smallest element, now backwards
+    cll_iter_prev(list, 1);
+
+    for (int i = 0; i < 999; i++)
+    {
+        if (*(int32_t*)cll_peek(list) < *(int32_t*)cll_peek_prev(list))
+            sorted = false;
+
+        cll_iter_prev(list, 1);
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    cll_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    cll_free(&list);
+    return st;
+}
+
 // Runs all CircularLinkedList tests
 Status CircularLinkedListTests(void)
 {
@@ -72,6 +155,7 @@ Status CircularLinkedListTests(void)
         goto error;
 
     st += cll_test_limit(ut);
+    st += cll_test_sort(ut);
 
     if (st != DS_OK)
         goto error;
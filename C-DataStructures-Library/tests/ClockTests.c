@@ -0,0 +1,114 @@
+/**
+ * @file ClockTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Clock.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Keeps the CPU busy for about a given amount of milliseconds
+static void clk_test_spin(uint64_t milliseconds)
+{
+    uint64_t start = clk_now();
+
+    volatile uint64_t sink = 0;
+
+    while (clk_now() - start < milliseconds)
+        sink++;
+}
+
+// Every source measures a few milliseconds of busy work with laps that add
+// up to the total
+void clk_test_sources(UnitTest ut)
+{
+    ClockSource sources[3] = { ClockMonotonic, ClockCycles, ClockThread };
+
+    for (int i = 0; i < 3; i++)
+    {
+        Clock_t *clk = clk_create(4, sources[i]);
+
+        if (!clk)
+            goto error;
+
+        if (sources[i] != ClockCycles)
+            ut_equals_int(ut, sources[i], clk_source(clk), __func__);
+
+        ut_equals_bool(ut, false, clk_stop(clk), __func__);
+        ut_equals_bool(ut, true, clk_start(clk), __func__);
+        ut_equals_bool(ut, false, clk_start(clk), __func__);
+
+        for (int j = 0; j < 4; j++)
+        {
+            clk_test_spin(2);
+            ut_equals_bool(ut, true, clk_lap(clk), __func__);
+        }
+
+        // Full
+        ut_equals_bool(ut, false, clk_lap(clk), __func__);
+
+        ut_equals_bool(ut, true, clk_stop(clk), __func__);
+
+        uint64_t laps = 0;
+
+        for (size_t j = 0; j < 4; j++)
+            laps += clk_lap_time(clk, j);
+
+        ut_equals_bool(ut, true, clk_elapsed(clk) >= 4000000, __func__);
+        ut_equals_bool(ut, true, clk_elapsed(clk) < 1000000000, __func__);
+        ut_equals_bool(ut, true, laps <= clk_elapsed(clk) + 1000, __func__);
+        ut_equals_bool(ut, true, clk_lap_time(clk, 4) == 0, __func__);
+        ut_equals_bool(ut, true, clk->time >= 0.004, __func__);
+
+        // Stopped time is not counted
+        clk_test_spin(20);
+
+        uint64_t elapsed = clk_elapsed(clk);
+
+        clk_start(clk);
+        clk_test_spin(1);
+        clk_stop(clk);
+
+        ut_equals_bool(ut, true, clk_elapsed(clk) > elapsed, __func__);
+        ut_equals_bool(ut, true, clk_elapsed(clk) - elapsed < 10000000, __func__);
+
+        ut_equals_bool(ut, true, clk_reset(clk), __func__);
+        ut_equals_bool(ut, true, clk_elapsed(clk) == 0, __func__);
+
+        clk_free(clk);
+    }
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Runs all Clock tests
+Status ClockTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    clk_test_sources(ut);
+
+    ut_report(ut, "Clock");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Clock");
+    ut_delete(&ut);
+    return st;
+}
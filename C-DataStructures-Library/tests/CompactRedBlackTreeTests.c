@@ -0,0 +1,239 @@
+/**
+ * @file CompactRedBlackTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CompactRedBlackTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Keeps the visited elements in order
+struct CompactRedBlackTreeTestVisit_s
+{
+    int64_t last;
+    bool ordered;
+};
+
+static void
+crb_test_visit(void *element, void *argument)
+{
+    struct CompactRedBlackTreeTestVisit_s *visit = argument;
+
+    if (*(int64_t*)element <= visit->last)
+        visit->ordered = false;
+
+    visit->last = *(int64_t*)element;
+}
+
+// The tree stays ordered and balanced through random insertions and removals
+void crb_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    CompactRedBlackTree_t *tree = interface ? crb_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    // Set the amount of possible elements
+    const int64_t T = 2000;
+
+    bool present[2000] = { false };
+    integer_t count = 0;
+    bool correct = true, balanced = true;
+
+    for (integer_t k = 0; k < 20000; k++)
+    {
+        int64_t value = rand() % T;
+
+        if (rand() % 3 != 0)
+        {
+            int64_t *element = new_int64_t(value);
+
+            bool inserted = crb_insert(tree, element);
+
+            if (inserted == present[value])
+                correct = false;
+
+            if (!inserted)
+                free(element);
+            else
+                count++;
+
+            present[value] = true;
+        }
+        else
+        {
+            if (crb_remove(tree, &value) != present[value])
+                correct = false;
+
+            if (present[value])
+                count--;
+
+            present[value] = false;
+        }
+
+        if (k % 500 == 0)
+        {
+            // Black-height guarantee
+            integer_t bound = 0;
+
+            for (integer_t m = count + 1; m > 1; m >>= 1)
+                bound++;
+
+            if (crb_height(tree) > 2 * (bound + 1))
+                balanced = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_bool(ut, true, balanced, __func__);
+    ut_equals_integer_t(ut, count, crb_size(tree), __func__);
+
+    for (int64_t i = 0; i < T; i++)
+    {
+        if (crb_contains(tree, &i) != present[i])
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    struct CompactRedBlackTreeTestVisit_s visit = { -1, true };
+    int64_t low = 0, high = T;
+
+    ut_equals_integer_t(ut, count,
+                        crb_range(tree, &low, &high, crb_test_visit, &visit),
+                        __func__);
+    ut_equals_bool(ut, true, visit.ordered, __func__);
+
+    // Removing every element leaves an empty tree
+    for (int64_t i = 0; i < T; i++)
+        crb_remove(tree, &i);
+
+    ut_equals_bool(ut, true, crb_empty(tree), __func__);
+    ut_equals_integer_t(ut, 0, crb_height(tree), __func__);
+
+    crb_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) crb_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Sorted insertions, ranges, limits and node pools
+void crb_test_utility(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    NodePool_t *pool = npl_new(sizeof(void*) * 3, 64);
+
+    CompactRedBlackTree_t *tree = interface ? crb_new(interface) : NULL;
+
+    if (!interface || !pool || !tree)
+        goto error;
+
+    ut_equals_bool(ut, true, crb_set_pool(tree, pool), __func__);
+
+    for (int64_t i = 1; i <= 1023; i++)
+    {
+        if (!crb_insert(tree, new_int64_t(i)))
+            goto error;
+    }
+
+    // Ascending insertions still give a balanced tree
+    ut_equals_bool(ut, true, crb_height(tree) <= 20, __func__);
+    ut_equals_integer_t(ut, 1023, npl_in_use(pool), __func__);
+
+    ut_equals_int(ut, 1, (int)*(int64_t*)crb_min(tree), __func__);
+    ut_equals_int(ut, 1023, (int)*(int64_t*)crb_max(tree), __func__);
+
+    int64_t key = 512;
+
+    ut_equals_bool(ut, true, *(int64_t*)crb_get(tree, &key) == 512, __func__);
+
+    struct CompactRedBlackTreeTestVisit_s visit = { 99, true };
+    int64_t low = 100, high = 199;
+
+    ut_equals_integer_t(ut, 100,
+                        crb_range(tree, &low, &high, crb_test_visit, &visit),
+                        __func__);
+    ut_equals_bool(ut, true, visit.ordered && visit.last == 199, __func__);
+
+    ut_equals_bool(ut, false, crb_set_limit(tree, 1000), __func__);
+    ut_equals_bool(ut, true, crb_set_limit(tree, 1024), __func__);
+
+    int64_t *element = new_int64_t(0);
+
+    ut_equals_bool(ut, true, crb_insert(tree, element), __func__);
+    ut_equals_bool(ut, true, crb_full(tree), __func__);
+
+    element = new_int64_t(2000);
+
+    ut_equals_bool(ut, false, crb_insert(tree, element), __func__);
+    ut_equals_bool(ut, false, crb_contains(tree, element), __func__);
+
+    free(element);
+
+    // Removing the root and the extremes
+    ut_equals_bool(ut, true, crb_remove(tree, crb_min(tree)), __func__);
+    ut_equals_bool(ut, true, crb_remove(tree, crb_max(tree)), __func__);
+    ut_equals_bool(ut, false, crb_remove(tree, &low) && crb_remove(tree, &low),
+                   __func__);
+
+    ut_equals_integer_t(ut, 1021, crb_size(tree), __func__);
+    ut_equals_integer_t(ut, 1021, npl_in_use(pool), __func__);
+
+    crb_erase(tree);
+
+    ut_equals_bool(ut, true, crb_empty(tree), __func__);
+    ut_equals_integer_t(ut, 0, npl_in_use(pool), __func__);
+
+    crb_free(tree);
+    npl_free(pool);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) crb_free(tree);
+    if (pool) npl_free(pool);
+    if (interface) interface_free(interface);
+}
+
+// Runs all CompactRedBlackTree tests
+Status CompactRedBlackTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    crb_test_IO(ut);
+    crb_test_utility(ut);
+
+    ut_report(ut, "CompactRedBlackTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "CompactRedBlackTree");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file CountMinSketchTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CountMinSketch.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Estimates never fall below the real counts and stay within the error bound
+void cms_test_estimates(UnitTest ut)
+{
+    CountMinSketch_t *sketch = cms_new(hash_int64_t, 0.001, 0.01);
+
+    unsigned_t counts[1000] = { 0 };
+
+    if (!sketch)
+        goto error;
+
+    ut_equals_bool(ut, true, cms_new(hash_int64_t, 0.0, 0.01) == NULL,
+                   __func__);
+    ut_equals_integer_t(ut, 2719, cms_width(sketch), __func__);
+    ut_equals_integer_t(ut, 5, cms_depth(sketch), __func__);
+
+    // A few keys are much more frequent than the rest
+    for (integer_t i = 0; i < 100000; i++)
+    {
+        int64_t key = random_int64_t(0, 999);
+
+        if (i % 2 == 0)
+            key %= 10;
+
+        cms_insert(sketch, &key, 1);
+        counts[key]++;
+    }
+
+    ut_equals_integer_t(ut, 100000, (integer_t)cms_total(sketch), __func__);
+
+    bool lower = false, bounded = true;
+
+    for (int64_t key = 0; key < 1000; key++)
+    {
+        unsigned_t estimate = cms_estimate(sketch, &key);
+
+        if (estimate < counts[key])
+            lower = true;
+
+        if (estimate > counts[key] + 300)
+            bounded = false;
+    }
+
+    ut_equals_bool(ut, false, lower, __func__);
+    ut_equals_bool(ut, true, bounded, __func__);
+
+    int64_t key = 5000;
+
+    ut_equals_bool(ut, true, cms_estimate(sketch, &key) <= 300, __func__);
+
+    cms_erase(sketch);
+
+    key = 0;
+
+    ut_equals_integer_t(ut, 0, (integer_t)cms_estimate(sketch, &key),
+                        __func__);
+    ut_equals_integer_t(ut, 0, (integer_t)cms_total(sketch), __func__);
+
+    cms_free(sketch);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sketch) cms_free(sketch);
+}
+
+// Merging gives exactly the sketch of both streams
+void cms_test_merge(UnitTest ut)
+{
+    CountMinSketch_t *sketch1 = cms_create(hash_int64_t, 256, 4);
+    CountMinSketch_t *sketch2 = cms_create(hash_int64_t, 256, 4);
+    CountMinSketch_t *whole = cms_create(hash_int64_t, 256, 4);
+    CountMinSketch_t *other = cms_create(hash_int64_t, 128, 4);
+
+    if (!sketch1 || !sketch2 || !whole || !other)
+        goto error;
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        int64_t key = random_int64_t(0, 5000);
+
+        cms_insert(i % 2 == 0 ? sketch1 : sketch2, &key, 2);
+        cms_insert(whole, &key, 2);
+    }
+
+    ut_equals_bool(ut, false, cms_merge(sketch1, other), __func__);
+    ut_equals_bool(ut, false, cms_merge(sketch1, sketch1), __func__);
+    ut_equals_bool(ut, true, cms_merge(sketch1, sketch2), __func__);
+
+    bool equal = cms_total(sketch1) == cms_total(whole);
+
+    for (int64_t key = 0; key <= 5000; key++)
+    {
+        if (cms_estimate(sketch1, &key) != cms_estimate(whole, &key))
+            equal = false;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    CountMinSketch_t *copy = cms_copy(whole);
+
+    if (!copy)
+        goto error;
+
+    int64_t key = 42;
+
+    ut_equals_bool(ut, true, cms_estimate(copy, &key)
+                             == cms_estimate(whole, &key), __func__);
+
+    cms_free(copy);
+    cms_free(sketch1);
+    cms_free(sketch2);
+    cms_free(whole);
+    cms_free(other);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sketch1) cms_free(sketch1);
+    if (sketch2) cms_free(sketch2);
+    if (whole) cms_free(whole);
+    if (other) cms_free(other);
+}
+
+// Runs all CountMinSketch tests
+Status CountMinSketchTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    cms_test_estimates(ut);
+    cms_test_merge(ut);
+
+    ut_report(ut, "CountMinSketch");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "CountMinSketch");
+    ut_delete(&ut);
+    return st;
+}
@@ -358,6 +358,451 @@ void dqa_test_growth(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Tests reserving, shrinking and shrinking automatically after a burst
+void dqa_test_reserve(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    DequeArray_t *deque = dqa_create(&int_interface, 8, 200);
+
+    if (!deque)
+        goto error;
+
+    ut_equals_bool(ut, true, dqa_reserve(deque, 1000), __func__);
+    ut_equals_integer_t(ut, 1000, dqa_capacity(deque), __func__);
+
+    // Both ends wrap around without the buffer growing
+    for (int32_t i = 0; i < 500; i++)
+    {
+        if (!dqa_enqueue_front(deque, new_int32_t(-i - 1)) ||
+            !dqa_enqueue_rear(deque, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1000, dqa_capacity(deque), __func__);
+    ut_equals_bool(ut, true, dqa_full(deque), __func__);
+
+    dqa_set_shrink(deque, true);
+
+    bool failed = false;
+
+    for (int32_t i = 0; i < 498; i++)
+    {
+        void *front, *rear;
+
+        if (!dqa_dequeue_front(deque, &front) ||
+            !dqa_dequeue_rear(deque, &rear))
+            goto error;
+
+        if (*(int32_t*)front != -500 + i || *(int32_t*)rear != 499 - i)
+            failed = true;
+
+        free(front);
+        free(rear);
+    }
+
+    // Halved down to 15, since 7 would be below the initial capacity
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, 15, dqa_capacity(deque), __func__);
+    ut_equals_int(ut, -2, *(int32_t*)dqa_peek_front(deque), __func__);
+    ut_equals_int(ut, 1, *(int32_t*)dqa_peek_rear(deque), __func__);
+
+    ut_equals_bool(ut, true, dqa_shrink_to_fit(deque), __func__);
+    ut_equals_integer_t(ut, 4, dqa_capacity(deque), __func__);
+    ut_equals_int(ut, -2, *(int32_t*)dqa_peek_front(deque), __func__);
+    ut_equals_int(ut, 1, *(int32_t*)dqa_peek_rear(deque), __func__);
+
+    dqa_free(deque);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dqa_free(deque);
+}
+
+// Walks a wrapped deque through both halves of its buffer
+void dqa_test_span(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    DequeArray deque = dqa_create(int_interface, 32, 200);
+
+    if (!int_interface || !deque)
+        goto error;
+
+    // Elements before 0 wrap to the end of the buffer
+    for (int i = 0; i < 10; i++)
+    {
+        if (!dqa_enqueue_rear(deque, new_int32_t(i)))
+            goto error;
+
+        if (!dqa_enqueue_front(deque, new_int32_t(-i - 1)))
+            goto error;
+    }
+
+    void **span;
+    integer_t spans = 0, position = 0, length;
+
+    bool correct = true;
+
+    while ((length = dqa_span(deque, position, &span)) > 0)
+    {
+        for (integer_t i = 0; correct && i < length; i++)
+            correct = *(int *)span[i] == position + i - 10;
+
+        position += length;
+        spans++;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, 20, position, __func__);
+    ut_equals_integer_t(ut, 2, spans, __func__);
+
+    dqa_free(deque);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dqa_free(deque);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Increments an int32_t in place
+static void
+dqa_test_increment(void *element, void *argument)
+{
+    (void)argument;
+
+    (*(int32_t*)element)++;
+}
+
+// Makes an int64_t with twice the value of an int32_t
+static void *
+dqa_test_double(const void *element, void *argument)
+{
+    (void)argument;
+
+    return new_int64_t(2 * (int64_t)*(const int32_t*)element);
+}
+
+// Keeps even numbers
+static bool
+dqa_test_even(const void *element, void *argument)
+{
+    (void)argument;
+
+    return *(const int32_t*)element % 2 == 0;
+}
+
+// Adds an int32_t element to an int64_t sum
+static void
+dqa_test_sum(void *accumulator, const void *element)
+{
+    *(int64_t*)accumulator += *(const int32_t*)element;
+}
+
+// Adds two int64_t sums
+static void
+dqa_test_add(void *accumulator, const void *partial)
+{
+    *(int64_t*)accumulator += *(const int64_t*)partial;
+}
+
+// Runs every bulk operation over both halves of a wrapped deque, with and
+// without a thread pool
+void dqa_test_bulk(UnitTest ut)
+{
+    const int32_t elements = 5000;
+
+    Interface_t *int32 = interface_new(compare_int32_t, copy_int32_t,
+                                       display_int32_t, free, NULL, NULL);
+    Interface_t *int64 = interface_new(compare_int64_t, copy_int64_t,
+                                       display_int64_t, free, NULL, NULL);
+
+    ThreadPool_t *pool = tpl_new(4);
+
+    DequeArray_t *deque = NULL, *doubled = NULL;
+
+    if (!int32 || !int64 || !pool)
+        goto error;
+
+    ThreadPool_t *pools[2] = { NULL, pool };
+
+    for (int k = 0; k < 2; k++)
+    {
+        deque = dqa_create(int32, elements * 2, 200);
+
+        if (!deque)
+            goto error;
+
+        // From -elements to elements - 1, the negative half at the end of the
+        // buffer
+        for (int32_t i = 0; i < elements; i++)
+        {
+            if (!dqa_enqueue_rear(deque, new_int32_t(i)))
+                goto error;
+
+            if (!dqa_enqueue_front(deque, new_int32_t(-i - 1)))
+                goto error;
+        }
+
+        // From -elements + 1 to elements
+        dqa_for_each(deque, dqa_test_increment, NULL, pools[k]);
+
+        int64_t sum = 0, zero = 0;
+
+        dqa_reduce(deque, &sum, &zero, sizeof(int64_t), dqa_test_sum,
+                   dqa_test_add, pools[k]);
+
+        ut_equals_bool(ut, true, sum == elements, __func__);
+
+        doubled = dqa_map(deque, int64, dqa_test_double, NULL, pools[k]);
+
+        if (!doubled)
+            goto error;
+
+        int64_t expected = 2 * (-elements + 1);
+
+        bool correct = dqa_count(doubled) == elements * 2;
+
+        while (correct && !dqa_empty(doubled))
+        {
+            void *element;
+
+            if (!dqa_dequeue_front(doubled, &element))
+                goto error;
+
+            correct = *(int64_t*)element == expected;
+            expected += 2;
+
+            free(element);
+        }
+
+        ut_equals_bool(ut, true, correct, __func__);
+
+        ut_equals_integer_t(ut, elements,
+                            dqa_filter_in_place(deque, dqa_test_even, NULL,
+                                                pools[k]), __func__);
+
+        expected = -elements + 2;
+
+        correct = dqa_count(deque) == elements;
+
+        while (correct && !dqa_empty(deque))
+        {
+            void *element;
+
+            if (!dqa_dequeue_front(deque, &element))
+                goto error;
+
+            correct = *(int32_t*)element == expected;
+            expected += 2;
+
+            free(element);
+        }
+
+        ut_equals_bool(ut, true, correct, __func__);
+
+        dqa_free(doubled);
+        dqa_free(deque);
+
+        doubled = NULL;
+        deque = NULL;
+    }
+
+    tpl_free(pool);
+    interface_free(int32);
+    interface_free(int64);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (doubled) dqa_free(doubled);
+    if (deque) dqa_free(deque);
+    if (pool) tpl_free(pool);
+    if (int32) interface_free(int32);
+    if (int64) interface_free(int64);
+}
+
+// Tests batch insertions and removals at both ends
+void dqa_test_batch(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    DequeArray_t *deque = dqa_create(&int_interface, 4, 150);
+
+    void *buffer[32];
+
+    if (!deque)
+        goto error;
+
+    // Elements from 0 to lowest - 1 were added at the front and from highest
+    // + 1 onwards at the rear
+    int32_t lowest = 0, highest = -1;
+    bool failed = false;
+
+    for (int i = 0; i < 400; i++)
+    {
+        int size = i % 29;
+        bool front = i % 3 == 0;
+
+        for (int j = 0; j < size; j++)
+        {
+            buffer[j] = front ? new_int32_t(lowest - size + j)
+                              : new_int32_t(highest + 1 + j);
+        }
+
+        if (front ? !dqa_enqueue_front_n(deque, buffer, size)
+                  : !dqa_enqueue_rear_n(deque, buffer, size))
+            goto error;
+
+        if (front)
+            lowest -= size;
+        else
+            highest += size;
+
+        bool from_front = i % 2 == 0;
+
+        integer_t removed = from_front
+                            ? dqa_dequeue_front_n(deque, buffer, i % 17)
+                            : dqa_dequeue_rear_n(deque, buffer, i % 17);
+
+        for (integer_t j = 0; j < removed; j++)
+        {
+            int32_t expected = from_front ? lowest + (int32_t)j
+                                          : highest - (int32_t)(removed - j)
+                                            + 1;
+
+            if (*(int32_t*)buffer[j] != expected)
+                failed = true;
+
+            free(buffer[j]);
+        }
+
+        if (from_front)
+            lowest += (int32_t)removed;
+        else
+            highest -= (int32_t)removed;
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, highest - lowest + 1, dqa_count(deque), __func__);
+
+    if (!dqa_empty(deque))
+    {
+        ut_equals_int(ut, lowest, *(int32_t*)dqa_peek_front(deque), __func__);
+        ut_equals_int(ut, highest, *(int32_t*)dqa_peek_rear(deque), __func__);
+    }
+
+    // Either every element is inserted or none of them
+    dqa_capacity_lock(deque);
+
+    integer_t count = dqa_count(deque);
+
+    ut_equals_bool(ut, false, dqa_enqueue_front_n(deque, buffer,
+                   dqa_capacity(deque) - count + 1), __func__);
+    ut_equals_integer_t(ut, count, dqa_count(deque), __func__);
+
+    dqa_free(deque);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dqa_free(deque);
+}
+
+// Appends and prepends a wrapped deque and moves the result to an array
+void dqa_test_move(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DequeArray_t *deque1 = dqa_create(interface, 4, 200);
+    DequeArray_t *deque2 = dqa_create(interface, 8, 200);
+
+    if (!interface || !deque1 || !deque2)
+        goto error;
+
+    // deque2 holds 10 to 14 across the end of its buffer
+    for (int32_t i = 12; i < 15; i++)
+    {
+        if (!dqa_enqueue_rear(deque2, new_int32_t(i)))
+            goto error;
+    }
+
+    for (int32_t i = 11; i >= 10; i--)
+    {
+        if (!dqa_enqueue_front(deque2, new_int32_t(i)))
+            goto error;
+    }
+
+    if (!dqa_enqueue_rear(deque1, new_int32_t(15)))
+        goto error;
+
+    ut_equals_bool(ut, false, dqa_prepend(deque1, deque1), __func__);
+    ut_equals_bool(ut, true, dqa_prepend(deque1, deque2), __func__);
+    ut_equals_bool(ut, true, dqa_empty(deque2), __func__);
+
+    // 10 to 15, then 16 to 17 appended
+    for (int32_t i = 16; i < 18; i++)
+    {
+        if (!dqa_enqueue_front(deque2, new_int32_t(33 - i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, dqa_append(deque1, deque2), __func__);
+    ut_equals_bool(ut, true, dqa_empty(deque2), __func__);
+
+    integer_t length;
+    void **array = dqa_to_array_move(deque1, &length);
+
+    if (!array)
+        goto error;
+
+    ut_equals_bool(ut, true, dqa_empty(deque1), __func__);
+    ut_equals_integer_t(ut, 8, length, __func__);
+
+    bool ordered = true;
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        ordered = ordered && *(int32_t*)array[i] == (int32_t)i + 10;
+
+        free(array[i]);
+    }
+
+    free(array);
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    dqa_free(deque1);
+    dqa_free(deque2);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque1) dqa_free(deque1);
+    if (deque2) dqa_free(deque2);
+    if (interface) interface_free(interface);
+}
+
 // Runs all DequeArray tests
 Status DequeArrayTests(void)
 {
@@ -373,6 +818,11 @@ Status DequeArrayTests(void)
     dqa_test_locked(ut);
     dqa_test_intensive(ut);
     dqa_test_growth(ut);
+    dqa_test_reserve(ut);
+    dqa_test_span(ut);
+    dqa_test_bulk(ut);
+    dqa_test_batch(ut);
+    dqa_test_move(ut);
 
     ut_report(ut, "DequeArray");
 
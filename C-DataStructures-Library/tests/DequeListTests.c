@@ -96,6 +96,129 @@ void dql_test_foreach(UnitTest ut)
     dql_erase(deque);
 }
 
+// Tests nodes holding many elements against an array
+void dql_test_chunk(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    DequeList_t *deque = dql_new(&int_interface), *copy = NULL;
+
+    // The expected elements are model[first, last)
+    int32_t *model = malloc(sizeof(int32_t) * 8000);
+
+    if (!deque || !model)
+        goto error;
+
+    if (!dql_set_chunk(deque, 6))
+        goto error;
+
+    ut_equals_bool(ut, false, dql_set_chunk(deque, 0), __func__);
+    ut_equals_integer_t(ut, 6, dql_chunk(deque), __func__);
+
+    integer_t first = 4000, last = 4000;
+    bool failed = false;
+
+    for (int32_t i = 0; i < 3000; i++)
+    {
+        void *result;
+
+        switch (random_int32_t(0, 3))
+        {
+            case 0:
+                model[--first] = i;
+                if (!dql_enqueue_front(deque, new_int32_t(i)))
+                    goto error;
+                break;
+            case 1:
+                model[last++] = i;
+                if (!dql_enqueue_rear(deque, new_int32_t(i)))
+                    goto error;
+                break;
+            case 2:
+                if (dql_dequeue_front(deque, &result))
+                {
+                    if (first == last || *(int32_t*)result != model[first++])
+                        failed = true;
+                    free(result);
+                }
+                break;
+            default:
+                if (dql_dequeue_rear(deque, &result))
+                {
+                    if (first == last || *(int32_t*)result != model[--last])
+                        failed = true;
+                    free(result);
+                }
+                break;
+        }
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, last - first, dql_count(deque), __func__);
+
+    // Makes sure there is something to look at
+    model[--first] = -1;
+    model[last++] = -2;
+
+    if (!dql_enqueue_front(deque, new_int32_t(-1)) ||
+        !dql_enqueue_rear(deque, new_int32_t(-2)))
+        goto error;
+
+    ut_equals_int(ut, -1, *(int32_t*)dql_peek_front(deque), __func__);
+    ut_equals_int(ut, -2, *(int32_t*)dql_peek_rear(deque), __func__);
+    ut_equals_bool(ut, true, dql_contains(deque, &(int32_t){-2}), __func__);
+    ut_equals_bool(ut, false, dql_contains(deque, &(int32_t){-3}), __func__);
+
+    copy = dql_copy(deque);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_int(ut, 0, dql_compare(deque, copy), __func__);
+
+    // The iterator goes both ways through every element
+    DequeListIterator_t *iter = dql_iter_new(copy);
+
+    if (!iter)
+        goto error;
+
+    integer_t index = first;
+
+    do
+    {
+        if (*(int32_t*)dql_iter_peek(iter) != model[index++])
+            failed = true;
+    } while (dql_iter_next(iter));
+
+    ut_equals_integer_t(ut, last, index, __func__);
+
+    do
+    {
+        if (*(int32_t*)dql_iter_peek(iter) != model[--index])
+            failed = true;
+    } while (dql_iter_prev(iter));
+
+    dql_iter_free(iter);
+
+    ut_equals_integer_t(ut, first, index, __func__);
+    ut_equals_bool(ut, false, failed, __func__);
+
+    dql_free(deque);
+    dql_free(copy);
+    free(model);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dql_free(deque);
+    if (copy) dql_free(copy);
+    free(model);
+}
+
 // Runs all DequeList tests
 Status DequeListTests(void)
 {
@@ -108,6 +231,7 @@ Status DequeListTests(void)
 
     dql_test_limit(ut);
     dql_test_foreach(ut);
+    dql_test_chunk(ut);
 
     ut_report(ut, "DequeList");
 
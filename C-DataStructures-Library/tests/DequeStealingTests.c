@@ -0,0 +1,199 @@
+/**
+ * @file DequeStealingTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "DequeStealing.h"
+#include "UnitTest.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Amount of thieves and of values inserted by the owner
+#define DQS_TEST_THIEVES 3
+#define DQS_TEST_VALUES 200000
+
+// Shared by the owner and the thieves of dqs_test_threads
+struct DequeStealingTest_s
+{
+    DequeStealing_t *deque;
+    atomic_bool *done;
+    integer_t taken;
+    unsigned_t sum;
+};
+
+// Steals until the owner is done and the deque is empty
+static void *
+dqs_test_thief(void *argument)
+{
+    struct DequeStealingTest_s *test = argument;
+
+    void *result;
+
+    for (;;)
+    {
+        bool done = atomic_load(test->done);
+
+        if (dqs_dequeue_front(test->deque, &result))
+        {
+            test->taken++;
+            test->sum += (unsigned_t)(intptr_t)result;
+        }
+        else if (done)
+        {
+            return NULL;
+        }
+    }
+}
+
+// The rear behaves as a stack and the front as a queue, across growths
+void dqs_test_linear(UnitTest ut)
+{
+    DequeStealing_t *deque = dqs_new(3);
+
+    if (!deque)
+        goto error;
+
+    ut_equals_bool(ut, true, dqs_new(0) == NULL, __func__);
+    ut_equals_integer_t(ut, 4, dqs_capacity(deque), __func__);
+
+    void *result = NULL;
+
+    ut_equals_bool(ut, false, dqs_dequeue_rear(deque, &result), __func__);
+    ut_equals_bool(ut, false, dqs_dequeue_front(deque, &result), __func__);
+
+    for (intptr_t i = 1; i <= 100; i++)
+    {
+        if (!dqs_enqueue_rear(deque, (void*)i))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 100, dqs_count(deque), __func__);
+    ut_equals_integer_t(ut, 128, dqs_capacity(deque), __func__);
+
+    bool ordered = true;
+
+    for (intptr_t i = 1; i <= 50; i++)
+    {
+        if (!dqs_dequeue_front(deque, &result) || (intptr_t)result != i)
+            ordered = false;
+    }
+
+    for (intptr_t i = 100; i > 50; i--)
+    {
+        if (!dqs_dequeue_rear(deque, &result) || (intptr_t)result != i)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, dqs_empty(deque), __func__);
+    ut_equals_bool(ut, false, dqs_dequeue_rear(deque, &result), __func__);
+    ut_equals_unsigned_t(ut, 0, dqs_retries(deque), __func__);
+
+    dqs_free(deque);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dqs_free(deque);
+}
+
+// Every value is taken exactly once by either the owner or a thief
+void dqs_test_threads(UnitTest ut)
+{
+    DequeStealing_t *deque = dqs_new(16);
+
+    if (!deque)
+        goto error;
+
+    atomic_bool done = false;
+
+    struct DequeStealingTest_s thieves[DQS_TEST_THIEVES];
+    pthread_t threads[DQS_TEST_THIEVES];
+
+    for (integer_t i = 0; i < DQS_TEST_THIEVES; i++)
+    {
+        thieves[i] = (struct DequeStealingTest_s){ deque, &done, 0, 0 };
+
+        pthread_create(&threads[i], NULL, dqs_test_thief, &thieves[i]);
+    }
+
+    integer_t taken = 0;
+    unsigned_t sum = 0;
+
+    void *result;
+
+    // The owner takes one value back for every four inserted
+    for (intptr_t i = 1; i <= DQS_TEST_VALUES; i++)
+    {
+        if (!dqs_enqueue_rear(deque, (void*)i))
+            goto error;
+
+        if (i % 4 == 0 && dqs_dequeue_rear(deque, &result))
+        {
+            taken++;
+            sum += (unsigned_t)(intptr_t)result;
+        }
+    }
+
+    while (dqs_dequeue_rear(deque, &result))
+    {
+        taken++;
+        sum += (unsigned_t)(intptr_t)result;
+    }
+
+    atomic_store(&done, true);
+
+    for (integer_t i = 0; i < DQS_TEST_THIEVES; i++)
+    {
+        pthread_join(threads[i], NULL);
+
+        taken += thieves[i].taken;
+        sum += thieves[i].sum;
+    }
+
+    integer_t total = DQS_TEST_VALUES;
+
+    ut_equals_integer_t(ut, total, taken, __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)total * (unsigned_t)(total + 1) / 2,
+                         sum, __func__);
+
+    dqs_free(deque);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) dqs_free(deque);
+}
+
+// Runs all DequeStealing tests
+Status DequeStealingTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    dqs_test_linear(ut);
+    dqs_test_threads(ut);
+
+    ut_report(ut, "DequeStealing");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "DequeStealing");
+    ut_delete(&ut);
+    return st;
+}
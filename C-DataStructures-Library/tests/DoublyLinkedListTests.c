@@ -10,6 +10,25 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The list expects functions that take non-const elements
+static int
+dll_test_compare(void *element1, void *element2)
+{
+    return compare_int32_t(element1, element2);
+}
+
+static void *
+dll_test_copy(void *element)
+{
+    return copy_int32_t(element);
+}
+
+static void
+dll_test_display(void *element)
+{
+    display_int32_t(element);
+}
+
 // Tests dll_get
 Status dll_test_get(UnitTest ut)
 {
@@ -204,6 +223,207 @@ Status dll_test_indexof(UnitTest ut)
     return st;
 }
 
+// Tests sequential positional operations, which reuse the last node found
+Status dll_test_cursor(UnitTest ut)
+{
+    DoublyLinkedList list;
+
+    Status st = dll_create(&list, dll_test_compare, dll_test_copy,
+                           dll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    void *elem;
+    for (int i = 0; i < 1000; i += 2)
+    {
+        elem = new_int32_t(i);
+        st = dll_insert_tail(list, elem);
+
+        if (st != DS_OK)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    // Fills in the odd numbers
+    for (int i = 1; i < 1000; i += 2)
+    {
+        elem = new_int32_t(i);
+        st = dll_insert_at(list, elem, i);
+
+        if (st != DS_OK)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    bool sorted = true;
+    for (int i = 0; i < 1000; i++)
+    {
+        st = dll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int*)elem != i)
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    // Removes the odd numbers
+    for (int i = 1; i < dll_length(list) - 1; i++)
+    {
+        st = dll_remove_at(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        free(elem);
+    }
+
+    ut_equals_integer_t(ut, 501, dll_length(list), __func__);
+
+    // Changes made at the head must not be missed by the next search
+    st = dll_get(list, &elem, 250);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 500, *(int*)elem, __func__);
+
+    st = dll_insert_head(list, new_int32_t(-2));
+    st += dll_get(list, &elem, 250);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 498, *(int*)elem, __func__);
+
+    // Backwards
+    sorted = true;
+    for (int i = 500; i >= 0; i--)
+    {
+        st = dll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int*)elem != (i - 1) * 2)
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    dll_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    dll_free(&list);
+    return st;
+}
+
+// Tests sorting and moving ranges between lists
+Status dll_test_sort(UnitTest ut)
+{
+    DoublyLinkedList list = NULL, other = NULL;
+
+    Status st = dll_create(&list, dll_test_compare, dll_test_copy,
+                           dll_test_display, free);
+    st += dll_create(&other, dll_test_compare, dll_test_copy,
+                     dll_test_display, free);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        st = dll_insert_tail(list, new_int32_t(random_int32_t(0, 100)));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    st = dll_sort(list);
+
+    if (st != DS_OK)
+        goto error;
+
+    // Moves a range out and links it back at the same position
+    st = dll_unlink_at(list, other, 100, 199);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 900, dll_length(list), __func__);
+    ut_equals_integer_t(ut, 100, dll_length(other), __func__);
+
+    st = dll_link_at(list, other, 100);
+
+    if (st != DS_OK)
+        goto error;
+
+    // Moves the end out and links it back
+    st = dll_unlink(list, other, 500);
+    st += dll_link(list, other);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, dll_length(list), __func__);
+    ut_equals_bool(ut, true, dll_empty(other), __func__);
+
+    void *elem;
+    int32_t last = -1;
+    bool sorted = true;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        st = dll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int32_t*)elem < last)
+            sorted = false;
+
+        last = *(int32_t*)elem;
+    }
+
+    // Backwards, following the prev pointers
+    last = 101;
+
+    for (int i = 999; i >= 0; i--)
+    {
+        st = dll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int32_t*)elem > last)
+            sorted = false;
+
+        last = *(int32_t*)elem;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    dll_free(&list);
+    dll_free(&other);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list) dll_free(&list);
+    if (other) dll_free(&other);
+    return st;
+}
+
 // Runs all DoublyLinkedList tests
 Status DoublyLinkedListTests(void)
 {
@@ -217,6 +437,8 @@ Status DoublyLinkedListTests(void)
     st += dll_test_get(ut);
     st += dll_test_limit(ut);
     st += dll_test_indexof(ut);
+    st += dll_test_cursor(ut);
+    st += dll_test_sort(ut);
 
     if (st != DS_OK)
         goto error;
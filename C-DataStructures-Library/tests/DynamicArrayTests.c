@@ -105,6 +105,617 @@ void dar_test_growth(UnitTest ut)
     interface_free(interface);
 }
 
+// Tests moving elements in and out of the array without copying them
+void dar_test_zero_copy(UnitTest ut)
+{
+    Interface_t interface;
+    interface_init(&interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    void **buffer = malloc(sizeof(void*) * 10);
+
+    if (!buffer)
+        return;
+
+    for (int32_t i = 0; i < 5; i++)
+        buffer[i] = new_int32_t(i);
+
+    DynamicArray_t *array = dar_adopt(&interface, buffer, 5, 10, 200);
+
+    if (!array)
+        goto error;
+
+    // The same pointers are now in the array
+    ut_equals_bool(ut, true, dar_get(array, 4) == buffer[4], __func__);
+    ut_equals_integer_t(ut, 10, dar_capacity(array), __func__);
+
+    ut_equals_bool(ut, true, dar_reserve(array, 100), __func__);
+    ut_equals_integer_t(ut, 100, dar_capacity(array), __func__);
+
+    for (int32_t i = 5; i < 100; i++)
+    {
+        void **slot = dar_emplace_back(array);
+
+        if (!slot)
+            goto error;
+
+        *slot = new_int32_t(i);
+    }
+
+    // Nothing was reallocated
+    ut_equals_integer_t(ut, 100, dar_capacity(array), __func__);
+    ut_equals_integer_t(ut, 100, dar_size(array), __func__);
+
+    integer_t size;
+    void *first = dar_get(array, 0);
+
+    buffer = dar_release_buffer(array, &size);
+
+    ut_equals_integer_t(ut, 100, size, __func__);
+    ut_equals_bool(ut, true, buffer[0] == first, __func__);
+    ut_equals_bool(ut, true, dar_empty(array), __func__);
+
+    bool failed = false;
+
+    for (int32_t i = 0; i < size; i++)
+    {
+        if (*(int32_t*)buffer[i] != i)
+            failed = true;
+
+        free(buffer[i]);
+    }
+
+    free(buffer);
+
+    ut_equals_bool(ut, false, failed, __func__);
+
+    // A new buffer is allocated when needed
+    ut_equals_bool(ut, true, dar_insert_back(array, new_int32_t(7)), __func__);
+    ut_equals_int(ut, 7, *(int32_t*)dar_get(array, 0), __func__);
+
+    dar_free(array);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    else free(buffer);
+}
+
+// Checks the operation counters, which are only kept with DS_STATS
+void dar_test_stats(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_create(interface, 4, 200);
+
+    if (!interface || !array)
+        goto error;
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    int key = 99;
+
+    bool found = dar_contains(array, &key);
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    dar_erase(array);
+
+    ContainerStats_t stats;
+
+    if (dar_stats(array, &stats))
+    {
+        ut_equals_integer_t(ut, 100, (integer_t)stats.compares, __func__);
+        ut_equals_integer_t(ut, 100, (integer_t)stats.frees, __func__);
+        ut_equals_bool(ut, true, stats.grows > 0, __func__);
+        ut_equals_integer_t(ut, (integer_t)stats.grows + 2,
+                            (integer_t)stats.allocations, __func__);
+    }
+    else
+    {
+        ut_equals_bool(ut, true, stats.compares == 0 && stats.frees == 0
+                                 && stats.grows == 0, __func__);
+    }
+
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Saves an array to a snapshot and restores it
+void dar_test_snapshot(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_create(interface, 8, 150);
+    DynamicArray_t *restored = NULL;
+
+    FILE *stream = tmpfile();
+    FILE *truncated = tmpfile();
+
+    if (!interface || !array || !stream || !truncated)
+        goto error;
+
+    // Without a serializer nothing is written
+    ut_equals_bool(ut, false, dar_save(array, stream), __func__);
+
+    interface_serializer(interface, serialize_int32_t, deserialize_int32_t);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i * 3)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, dar_save(array, stream), __func__);
+
+    rewind(stream);
+
+    restored = dar_restore(interface, stream);
+
+    if (!restored)
+        goto error;
+
+    bool equal = dar_size(restored) == 1000
+                 && dar_growth_rate(restored) == 150;
+
+    for (integer_t i = 0; equal && i < 1000; i++)
+        equal = *(int *)dar_get(restored, i) == i * 3;
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    // A snapshot cut in the middle of the elements is rejected
+    char bytes[256];
+
+    rewind(stream);
+
+    if (fread(bytes, 1, sizeof(bytes), stream) != sizeof(bytes)
+        || fwrite(bytes, 1, sizeof(bytes), truncated) != sizeof(bytes))
+        goto error;
+
+    rewind(truncated);
+
+    ut_equals_bool(ut, true, dar_restore(interface, truncated) == NULL,
+                   __func__);
+
+    fclose(stream);
+    fclose(truncated);
+    dar_free(restored);
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stream) fclose(stream);
+    if (truncated) fclose(truncated);
+    if (restored) dar_free(restored);
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Walks the array through its span
+void dar_test_span(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_create(interface, 8, 200);
+
+    if (!interface || !array)
+        goto error;
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    void **span;
+
+    ut_equals_integer_t(ut, 100, dar_span(array, 0, &span), __func__);
+    ut_equals_integer_t(ut, 40, dar_span(array, 60, &span), __func__);
+    ut_equals_int(ut, 60, *(int *)span[0], __func__);
+    ut_equals_integer_t(ut, 0, dar_span(array, 100, &span), __func__);
+    ut_equals_bool(ut, true, span == NULL, __func__);
+
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Increments an int32_t in place
+static void
+dar_test_increment(void *element, void *argument)
+{
+    (void)argument;
+
+    (*(int32_t*)element)++;
+}
+
+// Makes an int64_t with twice the value of an int32_t
+static void *
+dar_test_double(const void *element, void *argument)
+{
+    (void)argument;
+
+    return new_int64_t(2 * (int64_t)*(const int32_t*)element);
+}
+
+// Keeps even numbers
+static bool
+dar_test_even(const void *element, void *argument)
+{
+    (void)argument;
+
+    return *(const int32_t*)element % 2 == 0;
+}
+
+// Adds an int32_t element to an int64_t sum
+static void
+dar_test_sum(void *accumulator, const void *element)
+{
+    *(int64_t*)accumulator += *(const int32_t*)element;
+}
+
+// Adds two int64_t sums
+static void
+dar_test_add(void *accumulator, const void *partial)
+{
+    *(int64_t*)accumulator += *(const int64_t*)partial;
+}
+
+// Runs every bulk operation with and without a thread pool
+void dar_test_bulk(UnitTest ut)
+{
+    const int32_t elements = 10000;
+
+    Interface_t *int32 = interface_new(compare_int32_t, copy_int32_t,
+                                       display_int32_t, free, NULL, NULL);
+    Interface_t *int64 = interface_new(compare_int64_t, copy_int64_t,
+                                       display_int64_t, free, NULL, NULL);
+
+    ThreadPool_t *pool = tpl_new(4);
+
+    DynamicArray_t *array = NULL, *doubled = NULL;
+
+    if (!int32 || !int64 || !pool)
+        goto error;
+
+    ThreadPool_t *pools[2] = { NULL, pool };
+
+    for (int k = 0; k < 2; k++)
+    {
+        array = dar_create(int32, elements, 200);
+
+        if (!array)
+            goto error;
+
+        for (int32_t i = 0; i < elements; i++)
+        {
+            if (!dar_insert_back(array, new_int32_t(i)))
+                goto error;
+        }
+
+        // From 1 to elements
+        dar_for_each(array, dar_test_increment, NULL, pools[k]);
+
+        int64_t sum = 0, zero = 0;
+
+        dar_reduce(array, &sum, &zero, sizeof(int64_t), dar_test_sum,
+                   dar_test_add, pools[k]);
+
+        ut_equals_bool(ut, true,
+                       sum == (int64_t)elements * (elements + 1) / 2,
+                       __func__);
+
+        doubled = dar_map(array, int64, dar_test_double, NULL, pools[k]);
+
+        if (!doubled)
+            goto error;
+
+        bool correct = dar_size(doubled) == elements;
+
+        for (integer_t i = 0; correct && i < elements; i++)
+            correct = *(int64_t*)dar_get(doubled, i) == 2 * (i + 1);
+
+        ut_equals_bool(ut, true, correct, __func__);
+
+        ut_equals_integer_t(ut, elements / 2,
+                            dar_filter_in_place(array, dar_test_even, NULL,
+                                                pools[k]), __func__);
+
+        correct = dar_size(array) == elements / 2;
+
+        for (integer_t i = 0; correct && i < dar_size(array); i++)
+            correct = *(int32_t*)dar_get(array, i) == 2 * (i + 1);
+
+        ut_equals_bool(ut, true, correct, __func__);
+
+        dar_free(doubled);
+        dar_free(array);
+
+        doubled = NULL;
+        array = NULL;
+    }
+
+    tpl_free(pool);
+    interface_free(int32);
+    interface_free(int64);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (doubled) dar_free(doubled);
+    if (array) dar_free(array);
+    if (pool) tpl_free(pool);
+    if (int32) interface_free(int32);
+    if (int64) interface_free(int64);
+}
+
+// Growth by a fixed step and shrinking after removals
+void dar_test_policy(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_create(interface, 8, 200);
+
+    if (!interface || !array)
+        goto error;
+
+    ut_equals_bool(ut, false, dar_set_policy(array, DS_GROWTH_STEP, -1),
+                   __func__);
+    ut_equals_int(ut, DS_GROWTH_GEOMETRIC, dar_policy(array), __func__);
+
+    dar_set_shrink(array, true);
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 128, dar_capacity(array), __func__);
+
+    void *element;
+
+    for (int i = 0; i < 50; i++)
+    {
+        dar_remove_back(array, &element);
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 128, dar_capacity(array), __func__);
+
+    // Halved at 32 elements
+    for (int i = 0; i < 18; i++)
+    {
+        dar_remove_front(array, &element);
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 64, dar_capacity(array), __func__);
+    ut_equals_int(ut, 18, *(int32_t*)dar_get(array, 0), __func__);
+    ut_equals_int(ut, 49, *(int32_t*)dar_get(array, 31), __func__);
+
+    ut_equals_bool(ut, true, dar_delete(array, 0, 29), __func__);
+    ut_equals_integer_t(ut, 8, dar_capacity(array), __func__);
+    ut_equals_int(ut, 48, *(int32_t*)dar_get(array, 0), __func__);
+
+    // 8 + 100, without any intermediate growth
+    ut_equals_bool(ut, true, dar_set_policy(array, DS_GROWTH_STEP, 100),
+                   __func__);
+
+    for (int i = 0; i < 10; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 108, dar_capacity(array), __func__);
+    ut_equals_integer_t(ut, 12, dar_size(array), __func__);
+
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+void dar_test_tombstones(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(interface);
+    DynamicArrayIterator_t *iter = NULL;
+
+    if (!interface || !array)
+        goto error;
+
+    ut_equals_bool(ut, false, dar_set_tombstones(array, 101), __func__);
+    ut_equals_bool(ut, true, dar_set_tombstones(array, 50), __func__);
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    void *element;
+
+    // Removes every odd number below 99 without shifting
+    for (int i = 1; i < 50; i++)
+    {
+        if (!dar_remove_at(array, &element, i))
+            goto error;
+
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 51, dar_size(array), __func__);
+    ut_equals_integer_t(ut, 49, dar_tombstones(array), __func__);
+    ut_equals_int(ut, 98, *(int32_t*)dar_get(array, 49), __func__);
+    ut_equals_int(ut, 0, *(int32_t*)dar_get(array, 0), __func__);
+    ut_equals_int(ut, 99, *(int32_t*)dar_get(array, 50), __func__);
+    ut_equals_bool(ut, true, dar_get(array, 51) == NULL, __func__);
+
+    bool sorted = true;
+
+    for (int i = 0; i < 50; i++)
+        sorted = sorted && *(int32_t*)dar_get(array, i) == 2 * i;
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    iter = dar_iter_new(array);
+
+    if (!iter)
+        goto error;
+
+    integer_t count = 1;
+    int32_t last = *(int32_t*)dar_iter_peek(iter);
+
+    for (; dar_iter_next(iter); count++)
+    {
+        sorted = sorted && *(int32_t*)dar_iter_peek(iter) > last;
+        last = *(int32_t*)dar_iter_peek(iter);
+    }
+
+    ut_equals_integer_t(ut, 51, count, __func__);
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_int(ut, 98, *(int32_t*)dar_iter_peek_prev(iter), __func__);
+    ut_equals_bool(ut, true, dar_iter_prev(iter), __func__);
+    ut_equals_int(ut, 96, *(int32_t*)dar_iter_peek_prev(iter), __func__);
+
+    dar_iter_free(iter);
+    iter = NULL;
+
+    // The 50th dead slot of 100 compacts the buffer
+    dar_remove_front(array, &element);
+    free(element);
+
+    ut_equals_integer_t(ut, 0, dar_tombstones(array), __func__);
+    ut_equals_integer_t(ut, 50, dar_size(array), __func__);
+    ut_equals_int(ut, 2, *(int32_t*)dar_get(array, 0), __func__);
+    ut_equals_int(ut, 99, *(int32_t*)dar_get(array, 49), __func__);
+
+    // Dead slots at the end are dropped with the last element
+    for (int i = 0; i < 2; i++)
+    {
+        dar_remove_at(array, &element, dar_size(array) - 2);
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 2, dar_tombstones(array), __func__);
+
+    dar_remove_back(array, &element);
+    free(element);
+
+    ut_equals_integer_t(ut, 0, dar_tombstones(array), __func__);
+    ut_equals_integer_t(ut, 47, dar_size(array), __func__);
+    ut_equals_int(ut, 94, *(int32_t*)dar_get(array, 46), __func__);
+
+    for (int i = 0; i < 3; i++)
+    {
+        dar_remove_at(array, &element, 10);
+        free(element);
+    }
+
+    if (!dar_insert_back(array, new_int32_t(100)))
+        goto error;
+
+    ut_equals_integer_t(ut, 3, dar_tombstones(array), __func__);
+    ut_equals_int(ut, 100, *(int32_t*)dar_get(array, 44), __func__);
+    ut_equals_int(ut, 28, *(int32_t*)dar_get(array, 10), __func__);
+
+    dar_replace(array, new_int32_t(-1), 10);
+
+    ut_equals_int(ut, -1, *(int32_t*)dar_get(array, 10), __func__);
+    ut_equals_integer_t(ut, 3, dar_compact(array), __func__);
+    ut_equals_integer_t(ut, 45, dar_size(array), __func__);
+    ut_equals_int(ut, -1, *(int32_t*)dar_get(array, 10), __func__);
+
+    // Removes with dead slots left in the buffer
+    for (int i = 0; i < 4; i++)
+    {
+        dar_remove_at(array, &element, 5);
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 4, dar_tombstones(array), __func__);
+    ut_equals_integer_t(ut, 40, dar_remove_if(array, dar_test_even, NULL),
+                        __func__);
+    ut_equals_integer_t(ut, 0, dar_tombstones(array), __func__);
+    ut_equals_integer_t(ut, 1, dar_size(array), __func__);
+    ut_equals_int(ut, -1, *(int32_t*)dar_get(array, 0), __func__);
+
+    for (int i = 1; i < 6; i += 2)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+    }
+
+    dar_remove_at(array, &element, 0);
+    free(element);
+
+    ut_equals_integer_t(ut, 1, dar_tombstones(array), __func__);
+    ut_equals_bool(ut, true, dar_set_tombstones(array, 0), __func__);
+    ut_equals_integer_t(ut, 0, dar_tombstones(array), __func__);
+    ut_equals_integer_t(ut, 3, dar_size(array), __func__);
+    ut_equals_int(ut, 1, *(int32_t*)dar_get(array, 0), __func__);
+
+    dar_remove_at(array, &element, 0);
+    free(element);
+
+    ut_equals_integer_t(ut, 0, dar_tombstones(array), __func__);
+    ut_equals_int(ut, 3, *(int32_t*)dar_get(array, 0), __func__);
+
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) dar_iter_free(iter);
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
 // Runs all DynamicArray tests
 Status DynamicArrayTests(void)
 {
@@ -117,6 +728,13 @@ Status DynamicArrayTests(void)
 
     dar_test_locked(ut);
     dar_test_growth(ut);
+    dar_test_zero_copy(ut);
+    dar_test_stats(ut);
+    dar_test_snapshot(ut);
+    dar_test_span(ut);
+    dar_test_bulk(ut);
+    dar_test_policy(ut);
+    dar_test_tombstones(ut);
 
     ut_report(ut, "DynamicArray");
 
@@ -0,0 +1,285 @@
+/**
+ * @file EpochReclaimerTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "EpochReclaimer.h"
+#include "UnitTest.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Amount of readers and of replacements made by the writer
+#define EBR_TEST_READERS 3
+#define EBR_TEST_WRITES 50000
+
+// Value every live node of ebr_test_threads has
+#define EBR_TEST_ALIVE 0x5eed
+
+// Pointers freed by ebr_test_release
+static atomic_int ebr_test_freed;
+
+// A node of ebr_test_threads
+struct EpochReclaimerTestNode_s
+{
+    int64_t value;
+    int64_t alive;
+};
+
+// Shared by the writer and the readers of ebr_test_threads
+struct EpochReclaimerTest_s
+{
+    EpochReclaimer_t *reclaimer;
+    _Atomic(struct EpochReclaimerTestNode_s *) current;
+    atomic_bool done;
+    atomic_bool correct;
+};
+
+// Counts a freed pointer and clears its node, so a late read is noticed
+static void
+ebr_test_release(void *pointer)
+{
+    struct EpochReclaimerTestNode_s *node = pointer;
+
+    node->alive = 0;
+
+    atomic_fetch_add(&ebr_test_freed, 1);
+
+    free(node);
+}
+
+static struct EpochReclaimerTestNode_s *
+ebr_test_node(int64_t value)
+{
+    struct EpochReclaimerTestNode_s *node = malloc(sizeof(*node));
+
+    if (node)
+    {
+        node->value = value;
+        node->alive = EBR_TEST_ALIVE;
+    }
+
+    return node;
+}
+
+// Reads the current node until the writer is done, checking it is not freed
+static void *
+ebr_test_reader(void *argument)
+{
+    struct EpochReclaimerTest_s *test = argument;
+
+    EpochThread_t *thread = ebr_register(test->reclaimer);
+
+    if (!thread)
+    {
+        atomic_store(&test->correct, false);
+        return NULL;
+    }
+
+    int64_t previous = -1;
+
+    while (!atomic_load(&test->done))
+    {
+        ebr_enter(thread);
+
+        struct EpochReclaimerTestNode_s *node = atomic_load(&test->current);
+
+        // The writer only moves forward
+        if (node->alive != EBR_TEST_ALIVE || node->value < previous)
+            atomic_store(&test->correct, false);
+
+        previous = node->value;
+
+        ebr_exit(thread);
+    }
+
+    ebr_unregister(thread);
+
+    return NULL;
+}
+
+// Pointers are only freed after every critical section that might have read
+// them, a stalled section holds them back and nesting keeps the section open
+void ebr_test_sections(UnitTest ut)
+{
+    EpochReclaimer_t *reclaimer = ebr_new();
+
+    EpochThread_t *writer = reclaimer ? ebr_register(reclaimer) : NULL;
+    EpochThread_t *reader = reclaimer ? ebr_register(reclaimer) : NULL;
+
+    if (!reclaimer || !writer || !reader)
+        goto error;
+
+    atomic_store(&ebr_test_freed, 0);
+
+    // A reader that stalls inside a section keeps everything
+    ebr_enter(reader);
+    ebr_enter(reader);
+    ebr_exit(reader);
+
+    for (int64_t i = 0; i < 200; i++)
+    {
+        ebr_enter(writer);
+
+        if (!ebr_retire(writer, ebr_test_node(i), ebr_test_release))
+            goto error;
+
+        ebr_exit(writer);
+
+        ebr_reclaim(writer);
+    }
+
+    ut_equals_int(ut, 0, atomic_load(&ebr_test_freed), __func__);
+    ut_equals_integer_t(ut, 200, ebr_pending(writer), __func__);
+
+    ebr_exit(reader);
+
+    ebr_drain(writer);
+
+    ut_equals_int(ut, 200, atomic_load(&ebr_test_freed), __func__);
+    ut_equals_integer_t(ut, 0, ebr_pending(writer), __func__);
+
+    // Without readers two epochs are enough
+    integer_t epoch = ebr_epoch(reclaimer);
+
+    if (!ebr_retire(writer, ebr_test_node(0), ebr_test_release))
+        goto error;
+
+    ebr_reclaim(writer);
+    ebr_reclaim(writer);
+
+    ut_equals_integer_t(ut, epoch + 2, ebr_epoch(reclaimer), __func__);
+    ut_equals_integer_t(ut, 0, ebr_pending(writer), __func__);
+
+    // Pending pointers of an unregistered thread are freed by the others
+    for (int64_t i = 0; i < 10; i++)
+    {
+        if (!ebr_retire(reader, ebr_test_node(i), ebr_test_release))
+            goto error;
+    }
+
+    ebr_unregister(reader);
+    reader = NULL;
+
+    ebr_reclaim(writer);
+    ebr_reclaim(writer);
+
+    ut_equals_int(ut, 211, atomic_load(&ebr_test_freed), __func__);
+
+    // And those still pending when the reclaimer is freed
+    if (!ebr_retire(writer, ebr_test_node(0), ebr_test_release))
+        goto error;
+
+    ebr_free(reclaimer);
+
+    ut_equals_int(ut, 212, atomic_load(&ebr_test_freed), __func__);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (reclaimer) ebr_free(reclaimer);
+}
+
+// Readers never see a freed node while a writer keeps replacing it, and the
+// limit bounds the pending pointers of the writer
+void ebr_test_threads(UnitTest ut)
+{
+    struct EpochReclaimerTest_s test;
+
+    test.reclaimer = ebr_new();
+
+    EpochThread_t *writer = test.reclaimer ? ebr_register(test.reclaimer)
+                                           : NULL;
+
+    struct EpochReclaimerTestNode_s *first = ebr_test_node(0);
+
+    if (!test.reclaimer || !writer || !first)
+        goto error;
+
+    atomic_store(&ebr_test_freed, 0);
+    atomic_init(&test.current, first);
+    atomic_init(&test.done, false);
+    atomic_init(&test.correct, true);
+
+    ebr_set_limit(test.reclaimer, 256);
+
+    ut_equals_integer_t(ut, 256, ebr_limit(test.reclaimer), __func__);
+
+    pthread_t threads[EBR_TEST_READERS];
+
+    for (integer_t i = 0; i < EBR_TEST_READERS; i++)
+        pthread_create(&threads[i], NULL, ebr_test_reader, &test);
+
+    bool bounded = true;
+
+    for (int64_t i = 1; i <= EBR_TEST_WRITES; i++)
+    {
+        struct EpochReclaimerTestNode_s *node = ebr_test_node(i);
+
+        if (!node)
+            goto error;
+
+        ebr_enter(writer);
+
+        struct EpochReclaimerTestNode_s *old =
+                atomic_exchange(&test.current, node);
+
+        if (!ebr_retire(writer, old, ebr_test_release))
+            goto error;
+
+        ebr_exit(writer);
+
+        bounded = bounded && ebr_pending(writer) <= 256;
+    }
+
+    atomic_store(&test.done, true);
+
+    for (integer_t i = 0; i < EBR_TEST_READERS; i++)
+        pthread_join(threads[i], NULL);
+
+    ebr_drain(writer);
+
+    ut_equals_bool(ut, true, atomic_load(&test.correct), __func__);
+    ut_equals_bool(ut, true, bounded, __func__);
+    ut_equals_int(ut, EBR_TEST_WRITES, atomic_load(&ebr_test_freed),
+                  __func__);
+
+    ebr_test_release(atomic_load(&test.current));
+    ebr_free(test.reclaimer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Runs all EpochReclaimer tests
+Status EpochReclaimerTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ebr_test_sections(ut);
+    ebr_test_threads(ut);
+
+    ut_report(ut, "EpochReclaimer");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "EpochReclaimer");
+    ut_delete(&ut);
+    return st;
+}
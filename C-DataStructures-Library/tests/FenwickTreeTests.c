@@ -0,0 +1,186 @@
+/**
+ * @file FenwickTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "FenwickTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Random updates and sums match a plain array
+void fwt_test_sums(UnitTest ut)
+{
+    // Set the amount of values
+    integer_t T = 1000;
+
+    int64_t *values = malloc(sizeof(int64_t) * (size_t)T);
+
+    if (!values)
+        goto error;
+
+    for (integer_t i = 0; i < T; i++)
+        values[i] = rand() % 201 - 100;
+
+    FenwickTree_t *tree = fwt_from_buffer(values, T);
+
+    if (!tree)
+        goto error;
+
+    bool correct = true;
+
+    for (integer_t k = 0; k < 5000; k++)
+    {
+        integer_t i = rand() % T, j = rand() % T;
+
+        if (k % 2 == 0)
+        {
+            int64_t delta = rand() % 201 - 100;
+
+            values[i] += delta;
+
+            if (k % 4 == 0)
+                fwt_add(tree, i, delta);
+            else
+                fwt_set(tree, i, values[i]);
+        }
+
+        integer_t from = i < j ? i : j, to = i < j ? j : i;
+
+        int64_t expected = 0, result = 0;
+
+        for (integer_t m = from; m <= to; m++)
+            expected += values[m];
+
+        if (!fwt_sum(tree, from, to, &result) || result != expected)
+            correct = false;
+
+        fwt_get(tree, i, &result);
+
+        if (result != values[i])
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, T, fwt_size(tree), __func__);
+
+    int64_t total = 0;
+
+    for (integer_t i = 0; i < T; i++)
+        total += values[i];
+
+    ut_equals_bool(ut, true, fwt_prefix(tree, T + 10) == total, __func__);
+    ut_equals_bool(ut, true, fwt_prefix(tree, -1) == 0, __func__);
+
+    int64_t result;
+
+    ut_equals_bool(ut, false, fwt_sum(tree, 5, 4, &result), __func__);
+    ut_equals_bool(ut, false, fwt_sum(tree, 0, T, &result), __func__);
+    ut_equals_bool(ut, false, fwt_add(tree, -1, 1), __func__);
+    ut_equals_bool(ut, false, fwt_get(tree, T, &result), __func__);
+
+    fwt_free(tree);
+    free(values);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(values);
+}
+
+// Lower bound over non-negative values and building from a DynamicArray
+void fwt_test_lower_bound(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    DynamicArray_t *array = interface ? dar_new(interface) : NULL;
+
+    if (!array)
+        goto error;
+
+    // Values 0, 1, 2, 0, 1, 2, ...
+    for (integer_t i = 0; i < 300; i++)
+    {
+        if (!dar_insert_back(array, new_int64_t(i % 3)))
+            goto error;
+    }
+
+    FenwickTree_t *tree = fwt_from_array(array);
+
+    if (!tree)
+        goto error;
+
+    bool correct = true;
+
+    for (int64_t target = -2; target <= 310; target++)
+    {
+        integer_t expected = 0;
+        int64_t sum = 0;
+
+        while (expected < 300 && sum + (expected % 3) < target)
+        {
+            sum += expected % 3;
+            expected++;
+        }
+
+        if (target <= 0)
+            expected = 0;
+
+        if (fwt_lower_bound(tree, target) != expected)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, 300, fwt_lower_bound(tree, 301), __func__);
+
+    fwt_free(tree);
+
+    tree = fwt_new(0);
+
+    ut_equals_bool(ut, true, tree != NULL, __func__);
+    ut_equals_integer_t(ut, 0, fwt_lower_bound(tree, 1), __func__);
+    ut_equals_bool(ut, true, fwt_prefix(tree, 1) == 0, __func__);
+
+    fwt_free(tree);
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Runs all FenwickTree tests
+Status FenwickTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    fwt_test_sums(ut);
+    fwt_test_lower_bound(ut);
+
+    ut_report(ut, "FenwickTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "FenwickTree");
+    ut_delete(&ut);
+    return st;
+}
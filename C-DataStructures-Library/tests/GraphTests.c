@@ -0,0 +1,380 @@
+/**
+ * @file GraphTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Graph.h"
+#include "UnitTest.h"
+
+// Building from an edge list and reading the adjacency back
+void gph_test_new(UnitTest ut)
+{
+    integer_t sources[] = { 0, 2, 0, 1, 3 };
+    integer_t targets[] = { 1, 0, 2, 2, 3 };
+    int64_t weights[] = { 4, 1, 7, 2, 5 };
+    int64_t negative[] = { 4, 1, -7, 2, 5 };
+
+    Graph_t *directed = gph_new(4, 5, sources, targets, weights, true);
+    Graph_t *undirected = gph_new(4, 5, sources, targets, NULL, false);
+
+    if (!directed || !undirected)
+        goto error;
+
+    ut_equals_bool(ut, true, gph_new(0, 0, NULL, NULL, NULL, true) == NULL,
+                   __func__);
+    ut_equals_bool(ut, true, gph_new(3, 5, sources, targets, NULL, true)
+                             == NULL, __func__);
+    ut_equals_bool(ut, true, gph_new(4, 5, sources, targets, negative, true)
+                             == NULL, __func__);
+
+    ut_equals_integer_t(ut, gph_vertices(directed), 4, __func__);
+    ut_equals_integer_t(ut, gph_edges(directed), 5, __func__);
+    ut_equals_bool(ut, true, gph_directed(directed), __func__);
+    ut_equals_bool(ut, false, gph_directed(undirected), __func__);
+
+    integer_t degree = 0;
+
+    const integer_t *neighbours = gph_neighbours(directed, 0, &degree);
+    const int64_t *edge_weights = gph_weights(directed, 0);
+
+    // Edges keep their order among those of the same vertex
+    ut_equals_integer_t(ut, degree, 2, __func__);
+    ut_equals_bool(ut, true, neighbours[0] == 1 && neighbours[1] == 2,
+                   __func__);
+    ut_equals_bool(ut, true, edge_weights[0] == 4 && edge_weights[1] == 7,
+                   __func__);
+
+    ut_equals_integer_t(ut, gph_degree(directed, 2), 1, __func__);
+    ut_equals_integer_t(ut, gph_degree(directed, 4), -1, __func__);
+    ut_equals_integer_t(ut, gph_degree(undirected, 0), 3, __func__);
+    ut_equals_integer_t(ut, gph_degree(undirected, 2), 3, __func__);
+    ut_equals_bool(ut, true, gph_weights(undirected, 0) == NULL, __func__);
+    ut_equals_bool(ut, true, gph_neighbours(directed, -1, &degree) == NULL,
+                   __func__);
+
+    gph_free(directed);
+    gph_free(undirected);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (directed) gph_free(directed);
+    if (undirected) gph_free(undirected);
+}
+
+// Breadth-first and depth-first orders of a small graph
+void gph_test_traversal(UnitTest ut)
+{
+    //   0 -> 1 -> 3
+    //   |    |
+    //   v    v
+    //   2 -> 4    5 -> 6
+    integer_t sources[] = { 0, 0, 1, 1, 2, 5 };
+    integer_t targets[] = { 1, 2, 3, 4, 4, 6 };
+
+    Graph_t *graph = gph_new(7, 6, sources, targets, NULL, true);
+
+    if (!graph)
+        goto error;
+
+    integer_t distances[7], parents[7], order[7];
+
+    ut_equals_bool(ut, false, gph_bfs(graph, 7, distances, NULL), __func__);
+    ut_equals_bool(ut, true, gph_bfs(graph, 0, distances, parents), __func__);
+
+    integer_t expected_distances[7] = { 0, 1, 1, 2, 2, -1, -1 };
+    integer_t expected_parents[7] = { -1, 0, 0, 1, 1, -1, -1 };
+
+    bool equal = true;
+
+    for (int i = 0; i < 7; i++)
+        equal = equal && distances[i] == expected_distances[i]
+                && parents[i] == expected_parents[i];
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    integer_t expected_order[5] = { 0, 1, 3, 4, 2 };
+
+    ut_equals_integer_t(ut, gph_dfs(graph, 0, order, parents), 5, __func__);
+
+    equal = true;
+
+    for (int i = 0; i < 5; i++)
+        equal = equal && order[i] == expected_order[i];
+
+    ut_equals_bool(ut, true, equal, __func__);
+    ut_equals_integer_t(ut, parents[4], 1, __func__);
+    ut_equals_integer_t(ut, parents[2], 0, __func__);
+    ut_equals_integer_t(ut, gph_dfs(graph, 5, order, NULL), 2, __func__);
+    ut_equals_integer_t(ut, gph_dfs(graph, -1, order, NULL), -1, __func__);
+
+    gph_free(graph);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (graph) gph_free(graph);
+}
+
+// Shortest weighted paths, checked against a relaxation of every edge until
+// nothing changes
+void gph_test_dijkstra(UnitTest ut)
+{
+    const integer_t vertices = 2000, edges = 10000;
+
+    integer_t *sources = malloc(sizeof(integer_t) * edges);
+    integer_t *targets = malloc(sizeof(integer_t) * edges);
+    int64_t *weights = malloc(sizeof(int64_t) * edges);
+    int64_t *distances = malloc(sizeof(int64_t) * vertices);
+    int64_t *expected = malloc(sizeof(int64_t) * vertices);
+    integer_t *parents = malloc(sizeof(integer_t) * vertices);
+
+    Graph_t *graph = NULL;
+
+    if (!sources || !targets || !weights || !distances || !expected ||
+        !parents)
+        goto error;
+
+    for (integer_t i = 0; i < edges; i++)
+    {
+        sources[i] = rand() % vertices;
+        targets[i] = rand() % vertices;
+        weights[i] = rand() % 100;
+    }
+
+    graph = gph_new(vertices, edges, sources, targets, weights, true);
+
+    if (!graph || !gph_dijkstra(graph, 0, distances, parents))
+        goto error;
+
+    for (integer_t v = 0; v < vertices; v++)
+        expected[v] = v == 0 ? 0 : INT64_MAX;
+
+    for (bool changed = true; changed; )
+    {
+        changed = false;
+
+        for (integer_t i = 0; i < edges; i++)
+        {
+            if (expected[sources[i]] != INT64_MAX &&
+                expected[sources[i]] + weights[i] < expected[targets[i]])
+            {
+                expected[targets[i]] = expected[sources[i]] + weights[i];
+                changed = true;
+            }
+        }
+    }
+
+    bool equal = true;
+
+    for (integer_t v = 0; v < vertices; v++)
+    {
+        equal = equal && distances[v] == expected[v];
+
+        // The parent of a vertex ends a path that is as short
+        if (v != 0 && parents[v] >= 0)
+        {
+            integer_t degree, p = parents[v];
+
+            const integer_t *neighbours = gph_neighbours(graph, p, &degree);
+            const int64_t *edge_weights = gph_weights(graph, p);
+
+            bool found = false;
+
+            for (integer_t e = 0; e < degree; e++)
+                found = found || (neighbours[e] == v && distances[p]
+                                  + edge_weights[e] == distances[v]);
+
+            equal = equal && found;
+        }
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    // Without weights every edge is worth 1, like the hops of a BFS
+    gph_free(graph);
+
+    graph = gph_new(vertices, edges, sources, targets, NULL, false);
+
+    integer_t *hops = parents;
+
+    if (!graph || !gph_dijkstra(graph, 0, distances, NULL) ||
+        !gph_bfs(graph, 0, hops, NULL))
+        goto error;
+
+    equal = true;
+
+    for (integer_t v = 0; v < vertices; v++)
+        equal = equal && (hops[v] < 0 ? distances[v] == INT64_MAX
+                                      : distances[v] == hops[v]);
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    gph_free(graph);
+    free(sources);
+    free(targets);
+    free(weights);
+    free(distances);
+    free(expected);
+    free(parents);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (graph) gph_free(graph);
+    free(sources);
+    free(targets);
+    free(weights);
+    free(distances);
+    free(expected);
+    free(parents);
+}
+
+// Components of an undirected graph and weak components of a directed one
+void gph_test_components(UnitTest ut)
+{
+    // { 0, 3, 4 }, { 1, 5 }, { 2 }, { 6, 7 } with the last edge reversed
+    integer_t sources[] = { 3, 4, 5, 7 };
+    integer_t targets[] = { 0, 3, 1, 6 };
+
+    Graph_t *undirected = gph_new(8, 4, sources, targets, NULL, false);
+    Graph_t *directed = gph_new(8, 4, sources, targets, NULL, true);
+
+    if (!undirected || !directed)
+        goto error;
+
+    integer_t labels[8];
+    integer_t expected[8] = { 0, 1, 2, 0, 0, 1, 3, 3 };
+
+    for (int g = 0; g < 2; g++)
+    {
+        ut_equals_integer_t(ut, gph_components(g ? directed : undirected,
+                                               labels), 4, __func__);
+
+        bool equal = true;
+
+        for (int i = 0; i < 8; i++)
+            equal = equal && labels[i] == expected[i];
+
+        ut_equals_bool(ut, true, equal, __func__);
+    }
+
+    gph_free(undirected);
+    gph_free(directed);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (undirected) gph_free(undirected);
+    if (directed) gph_free(directed);
+}
+
+// A parallel search finds the same distances as a sequential one and valid
+// parents
+void gph_test_bfs_parallel(UnitTest ut)
+{
+    const integer_t vertices = 200000, edges = 600000;
+
+    integer_t *sources = malloc(sizeof(integer_t) * edges);
+    integer_t *targets = malloc(sizeof(integer_t) * edges);
+    integer_t *distances = malloc(sizeof(integer_t) * vertices);
+    integer_t *expected = malloc(sizeof(integer_t) * vertices);
+    integer_t *parents = malloc(sizeof(integer_t) * vertices);
+
+    Graph_t *graph = NULL;
+    ThreadPool_t *pool = tpl_new(4);
+
+    if (!sources || !targets || !distances || !expected || !parents || !pool)
+        goto error;
+
+    for (integer_t i = 0; i < edges; i++)
+    {
+        sources[i] = (integer_t)(((unsigned)rand() << 8 ^ (unsigned)rand())
+                                 % (unsigned)vertices);
+        targets[i] = (integer_t)(((unsigned)rand() << 8 ^ (unsigned)rand())
+                                 % (unsigned)vertices);
+    }
+
+    graph = gph_new(vertices, edges, sources, targets, NULL, true);
+
+    if (!graph || !gph_bfs(graph, 0, expected, NULL) ||
+        !gph_bfs_parallel(graph, 0, distances, parents, pool))
+        goto error;
+
+    bool equal = true;
+    integer_t reached = 0;
+
+    for (integer_t v = 0; v < vertices; v++)
+    {
+        equal = equal && distances[v] == expected[v];
+
+        if (v != 0 && distances[v] > 0)
+            equal = equal && distances[parents[v]] == distances[v] - 1;
+
+        reached += distances[v] >= 0;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+    ut_equals_bool(ut, true, reached > vertices / 2, __func__);
+
+    gph_free(graph);
+    tpl_free(pool);
+    free(sources);
+    free(targets);
+    free(distances);
+    free(expected);
+    free(parents);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (graph) gph_free(graph);
+    if (pool) tpl_free(pool);
+    free(sources);
+    free(targets);
+    free(distances);
+    free(expected);
+    free(parents);
+}
+
+// Runs all Graph tests
+Status GraphTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    gph_test_new(ut);
+    gph_test_traversal(ut);
+    gph_test_dijkstra(ut);
+    gph_test_components(ut);
+    gph_test_bfs_parallel(ut);
+
+    ut_report(ut, "Graph");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Graph");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,401 @@
+/**
+ * @file HashMapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "HashMap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+void hmp_test_IO(UnitTest ut)
+{
+    Interface_t *string_interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+    Interface_t *double_interface = interface_new(compare_double, copy_double,
+            display_double, free, hash_double, NULL);
+
+    HashMap_t *map = hmp_new(string_interface, double_interface);
+
+    if (!map || !string_interface || !double_interface)
+        goto error;
+
+    if (!hmp_insert(map, new_string("Apple"), new_double(0.49)))
+        goto error;
+    if (!hmp_insert(map, new_string("Grape Juice"), new_double(1.29)))
+        goto error;
+    if (!hmp_insert(map, new_string("Maple Syrup"), new_double(2.99)))
+        goto error;
+    if (!hmp_insert(map, new_string("Soybeans"), new_double(0.99)))
+        goto error;
+
+    double *result[2] = {hmp_get(map, "Apple"), hmp_get(map, "Maple Syrup")};
+
+    ut_equals_double(ut, 0.49, *result[0], __func__);
+    ut_equals_double(ut, 2.99, *result[1], __func__);
+
+    char *str_k = new_string("Grape Juice");
+    double *dbl_v = new_double(1.99);
+
+    ut_equals_bool(ut, false, hmp_insert(map, str_k, dbl_v), __func__);
+
+    void *R = NULL;
+
+    if (!hmp_remove(map, "Apple", &R))
+        goto error;
+    free(R);
+    if (!hmp_remove(map, "Soybeans", &R))
+        goto error;
+    free(R);
+    if (!hmp_pop(map, "Grape Juice"))
+        goto error;
+    if (!hmp_pop(map, "Maple Syrup"))
+        goto error;
+
+    ut_equals_integer_t(ut, 0, hmp_count(map), __func__);
+    ut_equals_bool(ut, false, hmp_contains_key(map, "Apple"), __func__);
+
+    if (!hmp_insert(map, str_k, dbl_v))
+        goto error;
+
+    ut_equals_integer_t(ut, 1, hmp_count(map), __func__);
+
+    hmp_free(map);
+    interface_free(string_interface);
+    interface_free(double_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    hmp_free(map);
+    interface_free(string_interface);
+    interface_free(double_interface);
+    ut_error();
+}
+
+// Inserts enough keys to trigger several rehashes, then removes half of them
+// and checks that every remaining key is still reachable
+void hmp_test_growth(UnitTest ut)
+{
+    const int64_t elements = 100000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    HashMap_t *map = hmp_new(int_interface, int_interface);
+
+    if (!map || !int_interface)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!hmp_insert(map, new_int64_t(i), new_int64_t(i * 2)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, elements, hmp_count(map), __func__);
+    ut_equals_bool(ut, true, hmp_load(map) <= hmp_max_load(map) / 100.0,
+            __func__);
+
+    for (int64_t i = 0; i < elements; i += 2)
+    {
+        if (!hmp_pop(map, &i))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, elements / 2, hmp_count(map), __func__);
+
+    bool found = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        int64_t *value = hmp_get(map, &i);
+
+        if ((i % 2 == 0 && value != NULL) ||
+            (i % 2 == 1 && (value == NULL || *value != i * 2)))
+        {
+            found = false;
+            break;
+        }
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    hmp_free(map);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    hmp_free(map);
+    interface_free(int_interface);
+    ut_error();
+}
+
+void hmp_test_iter(UnitTest ut)
+{
+    const int64_t elements = 1000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    HashMap_t *map = hmp_create(int_interface, int_interface, 1, 50);
+
+    HashMapIterator_t *iter = NULL;
+
+    if (!map || !int_interface)
+        goto error;
+
+    int64_t sum0 = 0, sum1 = 0;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!hmp_insert(map, new_int64_t(i), new_int64_t(i)))
+            goto error;
+
+        sum0 += i;
+    }
+
+    iter = hmp_iter_new(map);
+
+    if (!iter)
+        goto error;
+
+    integer_t visited = 0;
+    void *key, *value;
+
+    do
+    {
+        if (!hmp_iter_get_key(iter, &key) || !hmp_iter_get_value(iter, &value))
+            goto error;
+
+        sum1 += *(int64_t *)value;
+        visited++;
+
+    } while (hmp_iter_next(iter));
+
+    ut_equals_integer_t(ut, elements, visited, __func__);
+    ut_equals_integer_t(ut, sum0, sum1, __func__);
+
+    hmp_iter_free(iter);
+    hmp_free(map);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (iter)
+        hmp_iter_free(iter);
+    hmp_free(map);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Saves a map to a snapshot and restores it, with the same hash function and
+// with one that changed in between
+void hmp_test_snapshot(UnitTest ut)
+{
+    const int64_t elements = 10000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+    Interface_t *string_interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+
+    HashMap_t *map = hmp_new(string_interface, int_interface);
+    HashMap_t *restored = NULL;
+
+    FILE *stream = tmpfile();
+
+    if (!int_interface || !string_interface || !map || !stream)
+        goto error;
+
+    interface_serializer(int_interface, serialize_int64_t,
+                         deserialize_int64_t);
+    interface_serializer(string_interface, serialize_string,
+                         deserialize_string);
+
+    char key[32];
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        snprintf(key, sizeof(key), "key-%lld", (long long)i);
+
+        if (!hmp_insert(map, copy_string(key), new_int64_t(i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, hmp_save(map, stream), __func__);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        // The second pass restores with another hash function
+        if (pass == 1)
+            string_interface->hash = hash_string_keyed;
+
+        rewind(stream);
+
+        restored = hmp_restore(string_interface, int_interface, stream);
+
+        if (!restored)
+            goto error;
+
+        bool found = hmp_count(restored) == elements
+                     && hmp_capacity(restored) == hmp_capacity(map);
+
+        for (int64_t i = 0; found && i < elements; i++)
+        {
+            snprintf(key, sizeof(key), "key-%lld", (long long)i);
+
+            int64_t *value = hmp_get(restored, key);
+
+            found = value != NULL && *value == i;
+        }
+
+        ut_equals_bool(ut, true, found, __func__);
+
+        hmp_free(restored);
+        restored = NULL;
+    }
+
+    fclose(stream);
+    hmp_free(map);
+    interface_free(int_interface);
+    interface_free(string_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stream) fclose(stream);
+    if (restored) hmp_free(restored);
+    if (map) hmp_free(map);
+    if (int_interface) interface_free(int_interface);
+    if (string_interface) interface_free(string_interface);
+}
+
+// Maps keys to many values and checks spans, counts and removals
+void hmp_test_multiple(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    HashMap_t *map = int_interface ? hmp_new(int_interface, int_interface)
+                                   : NULL;
+
+    if (!map || !hmp_set_multiple_keys(map, true))
+        goto error;
+
+    // Key i is mapped to the values from i * 10 to i * 10 + (i % 7)
+    for (int64_t i = 0; i < 500; i++)
+    {
+        for (int64_t j = 0; j <= i % 7; j++)
+        {
+            if (!hmp_insert(map, new_int64_t(i), new_int64_t(i * 10 + j)))
+                goto error;
+        }
+    }
+
+    ut_equals_integer_t(ut, 500, hmp_count(map), __func__);
+    ut_equals_bool(ut, false, hmp_set_multiple_keys(map, false), __func__);
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < 500; i++)
+    {
+        void **values;
+
+        integer_t count = hmp_get_all(map, &i, &values);
+
+        correct = correct && count == i % 7 + 1
+                  && hmp_key_count(map, &i) == count
+                  && *(int64_t*)hmp_get(map, &i) == i * 10;
+
+        for (integer_t j = 0; j < count; j++)
+            correct = correct && *(int64_t*)values[j] == i * 10 + j;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    int64_t key = 6, value = 64, missing = 500;
+
+    ut_equals_bool(ut, true, hmp_contains_value(map, &value), __func__);
+
+    void *removed = NULL;
+
+    // The last value inserted is removed first
+    if (!hmp_remove(map, &key, &removed))
+        goto error;
+
+    ut_equals_int(ut, 66, (int)*(int64_t*)removed, __func__);
+    free(removed);
+
+    ut_equals_bool(ut, true, hmp_pop(map, &key), __func__);
+    ut_equals_integer_t(ut, 5, hmp_key_count(map, &key), __func__);
+    ut_equals_bool(ut, true, hmp_contains_value(map, &value), __func__);
+
+    value = 66;
+
+    ut_equals_bool(ut, false, hmp_contains_value(map, &value), __func__);
+    ut_equals_integer_t(ut, 5, hmp_remove_all(map, &key), __func__);
+    ut_equals_bool(ut, false, hmp_contains_key(map, &key), __func__);
+    ut_equals_integer_t(ut, 0, hmp_remove_all(map, &missing), __func__);
+    ut_equals_integer_t(ut, 499, hmp_count(map), __func__);
+
+    // A key with a single value is removed with it
+    key = 0;
+
+    ut_equals_bool(ut, true, hmp_pop(map, &key), __func__);
+    ut_equals_bool(ut, false, hmp_contains_key(map, &key), __func__);
+
+    hmp_erase(map);
+
+    ut_equals_bool(ut, true, hmp_set_multiple_keys(map, false), __func__);
+
+    hmp_free(map);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        hmp_free(map);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Runs all HashMap tests
+Status HashMapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    hmp_test_IO(ut);
+    hmp_test_growth(ut);
+    hmp_test_iter(ut);
+    hmp_test_snapshot(ut);
+    hmp_test_multiple(ut);
+
+    ut_report(ut, "HashMap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "HashMap");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file HashTableTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "HashTable.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+void htb_test_IO(UnitTest ut)
+{
+    Interface_t *string_interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+    Interface_t *double_interface = interface_new(compare_double, copy_double,
+            display_double, free, hash_double, NULL);
+
+    HashTable_t *table = htb_new(string_interface, double_interface);
+
+    if (!table || !string_interface || !double_interface)
+        goto error;
+
+    if (!htb_insert(table, new_string("Apple"), new_double(0.49)))
+        goto error;
+    if (!htb_insert(table, new_string("Grape Juice"), new_double(1.29)))
+        goto error;
+    if (!htb_insert(table, new_string("Maple Syrup"), new_double(2.99)))
+        goto error;
+    if (!htb_insert(table, new_string("Soybeans"), new_double(0.99)))
+        goto error;
+
+    double *result[2] = {htb_get(table, "Apple"), htb_get(table, "Maple Syrup")};
+
+    ut_equals_double(ut, 0.49, *result[0], __func__);
+    ut_equals_double(ut, 2.99, *result[1], __func__);
+
+    char *str_k = new_string("Grape Juice");
+    double *dbl_v = new_double(1.99);
+
+    ut_equals_bool(ut, false, htb_insert(table, str_k, dbl_v), __func__);
+
+    void *R = NULL;
+
+    if (!htb_remove(table, "Apple", &R))
+        goto error;
+    free(R);
+    if (!htb_remove(table, "Soybeans", &R))
+        goto error;
+    free(R);
+    if (!htb_pop(table, "Grape Juice"))
+        goto error;
+    if (!htb_pop(table, "Maple Syrup"))
+        goto error;
+
+    ut_equals_integer_t(ut, 0, htb_count(table), __func__);
+
+    if (!htb_insert(table, str_k, dbl_v))
+        goto error;
+
+    ut_equals_integer_t(ut, 1, htb_count(table), __func__);
+
+    htb_free(table);
+    interface_free(string_interface);
+    interface_free(double_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    htb_free(table);
+    interface_free(string_interface);
+    interface_free(double_interface);
+    ut_error();
+}
+
+// Checks that keys stay reachable while the table is half-way through a
+// rehash and that the rehash eventually finishes
+void htb_test_rehash(UnitTest ut)
+{
+    const int64_t elements = 100000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    HashTable_t *table = htb_create(int_interface, int_interface, 1, 100, 1);
+
+    if (!table || !int_interface)
+        goto error;
+
+    bool seen_rehashing = false, found = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!htb_insert(table, new_int64_t(i), new_int64_t(i * 3)))
+            goto error;
+
+        if (htb_rehashing(table))
+        {
+            seen_rehashing = true;
+
+            // Every key inserted so far must be found in one of the buffers
+            int64_t k = i / 2;
+            int64_t *value = htb_get(table, &k);
+
+            if (value == NULL || *value != k * 3)
+                found = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, seen_rehashing, __func__);
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_integer_t(ut, elements, htb_count(table), __func__);
+
+    while (htb_rehash_step(table, 16))
+        ;
+
+    ut_equals_bool(ut, false, htb_rehashing(table), __func__);
+
+    for (int64_t i = 0; i < elements; i += 2)
+    {
+        if (!htb_pop(table, &i))
+            goto error;
+    }
+
+    found = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        bool contains = htb_contains_key(table, &i);
+
+        if (contains != (i % 2 == 1))
+        {
+            found = false;
+            break;
+        }
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_integer_t(ut, elements / 2, htb_count(table), __func__);
+
+    htb_free(table);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    htb_free(table);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Runs all HashTable tests
+Status HashTableTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    htb_test_IO(ut);
+    htb_test_rehash(ut);
+
+    ut_report(ut, "HashTable");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "HashTable");
+    ut_delete(&ut);
+    return st;
+}
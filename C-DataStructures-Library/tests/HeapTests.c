@@ -7,6 +7,7 @@
  */
 
 #include "Heap.h"
+#include "DynamicArray.h"
 #include "UnitTest.h"
 #include "Utility.h"
 
@@ -127,6 +128,724 @@ void hep_test_IO1(UnitTest ut)
     }
 }
 
+// Changes and removes elements in the middle of the heap through handles
+void hep_test_handles(UnitTest ut)
+{
+    const int elements = 1000;
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(int_interface, MinHeap);
+
+    HeapHandle *handles = malloc(sizeof(HeapHandle) * (size_t)elements);
+
+    if (!int_interface || !heap || !handles)
+        goto error;
+
+    // Elements without handles are indexed when the first handle is taken
+    if (!hep_insert(heap, new_int32_t(-1)))
+        goto error;
+
+    for (int i = 0; i < elements; i++)
+    {
+        if (!hep_insert_handle(heap, new_int32_t(i * 2), &handles[i]))
+            goto error;
+    }
+
+    bool valid = true;
+
+    for (int i = 0; i < elements; i++)
+    {
+        int *elem = hep_handle_get(heap, handles[i]);
+
+        if (!elem || *elem != i * 2)
+            valid = false;
+    }
+
+    ut_equals_bool(ut, true, valid, __func__);
+
+    // Decrease-key brings an element to the top
+    int *elem = hep_handle_get(heap, handles[700]);
+    *elem = -10;
+
+    ut_equals_bool(ut, true, hep_update(heap, handles[700]), __func__);
+    ut_equals_int(ut, -10, *(int *)hep_peek(heap), __func__);
+
+    // Increase-key sends it back down
+    *elem = 5000;
+
+    ut_equals_bool(ut, true, hep_update(heap, handles[700]), __func__);
+    ut_equals_int(ut, -1, *(int *)hep_peek(heap), __func__);
+
+    void *result;
+
+    // Remove every odd handle from the middle
+    for (int i = 1; i < elements; i += 2)
+    {
+        if (!hep_remove_handle(heap, handles[i], &result))
+            goto error;
+
+        free(result);
+    }
+
+    ut_equals_bool(ut, false, hep_remove_handle(heap, handles[1], &result),
+                   __func__);
+    ut_equals_bool(ut, true, hep_handle_get(heap, handles[3]) == NULL,
+                   __func__);
+
+    // Handles are reused and still point to the right elements
+    if (!hep_insert_handle(heap, new_int32_t(1), &handles[1]))
+        goto error;
+
+    ut_equals_int(ut, 1, *(int *)hep_handle_get(heap, handles[1]), __func__);
+    ut_equals_int(ut, 600, *(int *)hep_handle_get(heap, handles[300]),
+                  __func__);
+
+    bool sorted = true;
+    int last = -2, count = 0;
+
+    while (!hep_empty(heap))
+    {
+        if (!hep_remove(heap, &result))
+            goto error;
+
+        if (*(int *)result < last)
+            sorted = false;
+
+        last = *(int *)result;
+        count++;
+
+        free(result);
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_int(ut, elements / 2 + 2, count, __func__);
+    ut_equals_bool(ut, true, hep_handle_get(heap, handles[0]) == NULL,
+                   __func__);
+
+    free(handles);
+    hep_free(heap);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(handles);
+    if (heap) hep_free(heap);
+    interface_free(int_interface);
+}
+
+// Heaps with more than two children per node
+void hep_test_arity(UnitTest ut)
+{
+    const int elements = 5000;
+
+    integer_t arities[3] = {4, 8, 3};
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(int_interface, MinHeap);
+
+    if (!int_interface || !heap)
+        goto error;
+
+    ut_equals_integer_t(ut, 2, hep_arity(heap), __func__);
+    ut_equals_bool(ut, false, hep_set_arity(heap, 1), __func__);
+    ut_equals_bool(ut, false, hep_set_arity(heap, 17), __func__);
+
+    for (int k = 0; k < 3; k++)
+    {
+        HeapHandle handle;
+
+        for (int i = 0; i < elements; i++)
+        {
+            if (!hep_insert(heap, new_int32_t(random_int32_t(0, elements))))
+                goto error;
+
+            // Change the arity with elements in the heap
+            if (i == elements / 2 && !hep_set_arity(heap, arities[k]))
+                goto error;
+        }
+
+        if (!hep_insert_handle(heap, new_int32_t(elements * 2), &handle))
+            goto error;
+
+        ut_equals_integer_t(ut, arities[k], hep_arity(heap), __func__);
+
+        *(int *)hep_handle_get(heap, handle) = -1;
+
+        if (!hep_update(heap, handle))
+            goto error;
+
+        void *result;
+        bool sorted = true;
+        int last = -2;
+
+        while (!hep_empty(heap))
+        {
+            if (!hep_remove(heap, &result))
+                goto error;
+
+            if (*(int *)result < last)
+                sorted = false;
+
+            last = *(int *)result;
+
+            free(result);
+        }
+
+        ut_equals_bool(ut, true, sorted, __func__);
+    }
+
+    hep_free(heap);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) hep_free(heap);
+    interface_free(int_interface);
+}
+
+// Checks the operation counters, which are only kept with DS_STATS
+void hep_test_stats(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(interface, MinHeap);
+
+    if (!interface || !heap)
+        goto error;
+
+    // Descending insertions into a min heap always sift up
+    for (int i = 1000; i > 0; i--)
+    {
+        if (!hep_insert(heap, new_int32_t(i)))
+            goto error;
+    }
+
+    ContainerStats_t stats;
+
+    if (hep_stats(heap, &stats))
+    {
+        ut_equals_bool(ut, true, stats.compares > 0, __func__);
+        ut_equals_bool(ut, true, stats.sifts > 0, __func__);
+        ut_equals_bool(ut, true, stats.grows > 0, __func__);
+        ut_equals_bool(ut, true, stats.bytes > 0, __func__);
+    }
+    else
+    {
+        ut_equals_bool(ut, true, stats.compares == 0 && stats.sifts == 0
+                                 && stats.grows == 0 && stats.bytes == 0,
+                       __func__);
+    }
+
+    hep_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) hep_free(heap);
+    if (interface) interface_free(interface);
+}
+
+// Saves a heap with a custom arity to a snapshot and restores it
+void hep_test_snapshot(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_create(int_interface, 16, 200, MinHeap);
+    Heap_t *restored = NULL;
+
+    FILE *stream = tmpfile();
+
+    if (!int_interface || !heap || !stream || !hep_set_arity(heap, 4))
+        goto error;
+
+    interface_serializer(int_interface, serialize_int32_t,
+                         deserialize_int32_t);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        if (!hep_insert(heap, new_int32_t(random_int32_t(0, 1000))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, hep_save(heap, stream), __func__);
+
+    rewind(stream);
+
+    restored = hep_restore(int_interface, stream);
+
+    if (!restored)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, hep_count(restored), __func__);
+    ut_equals_integer_t(ut, 4, hep_arity(restored), __func__);
+    ut_equals_bool(ut, true, hep_kind(restored) == MinHeap, __func__);
+
+    // Both heaps give back the same elements in the same order
+    bool equal = true;
+
+    while (equal && !hep_empty(heap))
+    {
+        void *R1, *R2;
+
+        if (!hep_remove(heap, &R1) || !hep_remove(restored, &R2))
+            goto error;
+
+        equal = *(int *)R1 == *(int *)R2;
+
+        free(R1);
+        free(R2);
+    }
+
+    ut_equals_bool(ut, true, equal && hep_empty(restored), __func__);
+
+    fclose(stream);
+    hep_free(restored);
+    hep_free(heap);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stream) fclose(stream);
+    if (restored) hep_free(restored);
+    if (heap) hep_free(heap);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Builds, merges and batches keep the heap order
+void hep_test_bulk(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap1 = NULL, *heap2 = NULL;
+
+    void *buffer[1000];
+
+    if (!int_interface)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+        buffer[i] = new_int32_t(random_int32_t(0, 10000));
+
+    heap1 = hep_from_array(int_interface, buffer, 1000, MinHeap);
+
+    if (!heap1)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, hep_count(heap1), __func__);
+
+    // A few elements are floated up and many rebuild the heap
+    heap2 = hep_new(int_interface, MinHeap);
+
+    if (!heap2)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+        buffer[i] = new_int32_t(random_int32_t(0, 10000));
+
+    ut_equals_bool(ut, true, hep_insert_all(heap2, buffer, 10), __func__);
+
+    for (int i = 0; i < 500; i++)
+        buffer[i] = new_int32_t(random_int32_t(0, 10000));
+
+    ut_equals_bool(ut, true, hep_insert_all(heap2, buffer, 500), __func__);
+    ut_equals_bool(ut, false, hep_merge(heap1, heap1), __func__);
+    ut_equals_bool(ut, true, hep_merge(heap1, heap2), __func__);
+
+    ut_equals_integer_t(ut, 1510, hep_count(heap1), __func__);
+    ut_equals_bool(ut, true, hep_empty(heap2), __func__);
+
+    // A locked heap takes all of the elements or none
+    hep_capacity_lock(heap2);
+
+    integer_t size = hep_capacity(heap2) + 1;
+
+    if (size > 1000)
+        goto error;
+
+    for (integer_t i = 0; i < size; i++)
+        buffer[i] = new_int32_t((int)i);
+
+    ut_equals_bool(ut, false, hep_insert_all(heap2, buffer, size), __func__);
+    ut_equals_bool(ut, true, hep_empty(heap2), __func__);
+
+    for (integer_t i = 0; i < size; i++)
+        free(buffer[i]);
+
+    // The top elements come out in order
+    bool ordered = true;
+    int last = -1;
+    integer_t total = 0, removed;
+
+    while ((removed = hep_remove_n(heap1, 100, buffer)) > 0)
+    {
+        for (integer_t i = 0; i < removed; i++)
+        {
+            if (*(int *)buffer[i] < last)
+                ordered = false;
+
+            last = *(int *)buffer[i];
+
+            free(buffer[i]);
+        }
+
+        total += removed;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 1510, total, __func__);
+    ut_equals_bool(ut, true, hep_empty(heap1), __func__);
+
+    hep_free(heap1);
+    hep_free(heap2);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap1) hep_free(heap1);
+    if (heap2) hep_free(heap2);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Lowest and highest values still counted in a reference
+static int
+hep_test_extreme(const int *counts, int size, bool highest)
+{
+    for (int i = 0; i < size; i++)
+    {
+        int value = highest ? size - 1 - i : i;
+
+        if (counts[value] > 0)
+            return value;
+    }
+
+    return -1;
+}
+
+// Both ends of a min-max heap through insertions, removals, builds and handles
+void hep_test_minmax(UnitTest ut)
+{
+    const int values = 1000;
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(int_interface, MinMaxHeap);
+
+    int *counts = calloc((size_t)values, sizeof(int));
+    HeapHandle *handles = malloc(sizeof(HeapHandle) * (size_t)values);
+
+    void *buffer[1000];
+
+    if (!int_interface || !heap || !counts || !handles)
+        goto error;
+
+    ut_equals_bool(ut, true, hep_kind(heap) == MinMaxHeap, __func__);
+    ut_equals_bool(ut, false, hep_set_arity(heap, 4), __func__);
+    ut_equals_bool(ut, true, hep_peek_max(heap) == NULL, __func__);
+
+    bool correct = true;
+    void *result;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int operation = rand() % 5;
+
+        if (operation < 3 || hep_empty(heap))
+        {
+            int value = random_int32_t(0, values - 1);
+
+            if (!hep_insert(heap, new_int32_t(value)))
+                goto error;
+
+            counts[value]++;
+        }
+        else
+        {
+            bool highest = operation == 4;
+
+            if (*(int *)(highest ? hep_peek_max(heap) : hep_peek_min(heap))
+                != hep_test_extreme(counts, values, highest))
+                correct = false;
+
+            if (!(highest ? hep_remove_max(heap, &result)
+                          : hep_remove_min(heap, &result)))
+                goto error;
+
+            counts[*(int *)result]--;
+
+            free(result);
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    hep_erase(heap);
+
+    for (int i = 0; i < values; i++)
+        counts[i] = 0;
+
+    // Handles change elements in the middle of the heap
+    for (int i = 0; i < values; i++)
+    {
+        int value = random_int32_t(0, values - 1);
+
+        if (!hep_insert_handle(heap, new_int32_t(value), &handles[i]))
+            goto error;
+
+        counts[value]++;
+    }
+
+    for (int i = 0; i < values; i += 3)
+    {
+        int *element = hep_handle_get(heap, handles[i]);
+
+        counts[*element]--;
+        *element = random_int32_t(0, values - 1);
+        counts[*element]++;
+
+        if (!hep_update(heap, handles[i]))
+            goto error;
+    }
+
+    for (int i = 1; i < values; i += 3)
+    {
+        if (!hep_remove_handle(heap, handles[i], &result))
+            goto error;
+
+        counts[*(int *)result]--;
+
+        free(result);
+    }
+
+    // Draining both ends at once meets in the middle
+    for (int i = 0; !hep_empty(heap); i++)
+    {
+        bool highest = i % 2 == 1;
+
+        if (!(highest ? hep_remove_max(heap, &result)
+                      : hep_remove_min(heap, &result)))
+            goto error;
+
+        if (*(int *)result != hep_test_extreme(counts, values, highest))
+            correct = false;
+
+        counts[*(int *)result]--;
+
+        free(result);
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    hep_free(heap);
+
+    // A min-max heap built bottom-up
+    for (int i = 0; i < values; i++)
+    {
+        int value = random_int32_t(0, values - 1);
+
+        buffer[i] = new_int32_t(value);
+        counts[value]++;
+    }
+
+    heap = hep_from_array(int_interface, buffer, values, MinMaxHeap);
+
+    if (!heap)
+        goto error;
+
+    for (int i = 0; !hep_empty(heap); i++)
+    {
+        bool highest = i % 3 == 0;
+
+        if (!(highest ? hep_remove_max(heap, &result)
+                      : hep_remove_min(heap, &result)))
+            goto error;
+
+        if (*(int *)result != hep_test_extreme(counts, values, highest))
+            correct = false;
+
+        counts[*(int *)result]--;
+
+        free(result);
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    hep_free(heap);
+
+    // Other kinds only have one end
+    heap = hep_new(int_interface, MinHeap);
+
+    if (!heap || !hep_insert(heap, new_int32_t(1)))
+        goto error;
+
+    ut_equals_bool(ut, true, hep_peek_max(heap) == NULL, __func__);
+    ut_equals_bool(ut, false, hep_remove_max(heap, &result), __func__);
+    ut_equals_int(ut, 1, *(int *)hep_peek_min(heap), __func__);
+
+    free(counts);
+    free(handles);
+    hep_free(heap);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(counts);
+    free(handles);
+    if (heap) hep_free(heap);
+    if (int_interface) interface_free(int_interface);
+}
+
+// The buffer grows by the golden policy and shrinks while the heap is emptied
+void hep_test_policy(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_create(interface, 8, 200, MinHeap);
+
+    if (!interface || !heap)
+        goto error;
+
+    ut_equals_bool(ut, true, hep_set_policy(heap, DS_GROWTH_GOLDEN, 0),
+                   __func__);
+    ut_equals_int(ut, DS_GROWTH_GOLDEN, hep_policy(heap), __func__);
+
+    hep_set_shrink(heap, true);
+
+    for (int i = 100; i > 0; i--)
+    {
+        if (!hep_insert(heap, new_int32_t(i)))
+            goto error;
+    }
+
+    // 8, 12, 18, 27, 40, 60, 90, 135
+    ut_equals_integer_t(ut, 135, hep_capacity(heap), __func__);
+
+    void *element;
+    bool ordered = true;
+
+    for (int i = 1; i <= 90; i++)
+    {
+        if (!hep_remove(heap, &element))
+            goto error;
+
+        ordered = ordered && *(int32_t*)element == i;
+
+        free(element);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, hep_capacity(heap) < 135, __func__);
+    ut_equals_bool(ut, true, hep_capacity(heap) >= 8, __func__);
+    ut_equals_int(ut, 91, *(int32_t*)hep_peek(heap), __func__);
+
+    hep_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) hep_free(heap);
+    if (interface) interface_free(interface);
+}
+
+// Drains a heap into a dynamic array without copying any element
+void hep_test_move(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(interface, MaxHeap);
+    DynamicArray_t *array = NULL;
+
+    if (!interface || !heap)
+        goto error;
+
+    HeapHandle handle;
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        if (!hep_insert_handle(heap, new_int32_t(i), &handle))
+            goto error;
+    }
+
+    void *top = hep_peek(heap);
+
+    integer_t length;
+    void **buffer = hep_to_array_move(heap, &length);
+
+    if (!buffer)
+        goto error;
+
+    ut_equals_bool(ut, true, hep_empty(heap), __func__);
+    ut_equals_bool(ut, true, hep_handle_get(heap, handle) == NULL, __func__);
+    ut_equals_bool(ut, true, buffer[0] == top, __func__);
+
+    array = dar_adopt(interface, buffer, length, length, 200);
+
+    if (!array)
+    {
+        for (integer_t i = 0; i < length; i++)
+            free(buffer[i]);
+
+        free(buffer);
+        goto error;
+    }
+
+    dar_sort(array);
+
+    bool sorted = dar_size(array) == 100;
+
+    for (integer_t i = 0; i < dar_size(array); i++)
+        sorted = sorted && *(int32_t*)dar_get(array, i) == (int32_t)i;
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    // The heap is still usable
+    ut_equals_bool(ut, true, hep_insert(heap, new_int32_t(1)), __func__);
+    ut_equals_integer_t(ut, 1, hep_count(heap), __func__);
+
+    dar_free(array);
+    hep_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (heap) hep_free(heap);
+    if (interface) interface_free(interface);
+}
+
 // Runs all Heap tests
 Status HeapTests(void)
 {
@@ -139,6 +858,14 @@ Status HeapTests(void)
 
     hep_test_IO0(ut);
     hep_test_IO1(ut);
+    hep_test_handles(ut);
+    hep_test_arity(ut);
+    hep_test_stats(ut);
+    hep_test_snapshot(ut);
+    hep_test_bulk(ut);
+    hep_test_minmax(ut);
+    hep_test_policy(ut);
+    hep_test_move(ut);
 
     ut_report(ut, "Heap");
 
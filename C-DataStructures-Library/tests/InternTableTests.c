@@ -0,0 +1,150 @@
+/**
+ * @file InternTableTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CString.h"
+#include "HashMap.h"
+#include "InternTable.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Equal strings get the same pointer, different ones don't
+void itn_test_IO0(UnitTest ut)
+{
+    InternTable_t *table = itn_new(NULL);
+
+    String string = NULL;
+
+    if (!table)
+        goto error;
+
+    char key[] = "apple";
+
+    const char *apple = itn_intern(table, key);
+    const char *banana = itn_intern(table, "banana");
+
+    // Changing the original doesn't change the copy
+    key[0] = 'A';
+
+    ut_equals_bool(ut, true, apple == itn_intern(table, "apple"), __func__);
+    ut_equals_bool(ut, true, apple != banana, __func__);
+    ut_equals_bool(ut, true, itn_lookup(table, "Apple") == NULL, __func__);
+    ut_equals_integer_t(ut, 2, itn_count(table), __func__);
+    ut_equals_integer_t(ut, 6, itn_length(banana), __func__);
+    ut_equals_int(ut, 0, itn_compare(apple, itn_lookup(table, "apple")),
+                  __func__);
+    ut_equals_bool(ut, true, itn_compare(apple, banana) < 0, __func__);
+
+    // Strings built in pieces are interned by their contents
+    const char *interned;
+
+    if (str_make(&string, "ban") != DS_OK)
+        goto error;
+
+    if (str_push_back(string, "ana") != DS_OK)
+        goto error;
+
+    if (str_intern(string, table, &interned) != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, interned == banana, __func__);
+
+    str_delete(&string);
+    itn_free(table);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (string) str_delete(&string);
+    if (table) itn_free(table);
+}
+
+// Interned strings as keys of a hash map using their cached hashes
+void itn_test_keys(UnitTest ut)
+{
+    Arena_t *arena = arn_new(1024);
+
+    InternTable_t *table = arena ? itn_new(arena) : NULL;
+
+    Interface_t *keys = interface_new(itn_compare, NULL, NULL, NULL,
+                                      itn_hash, NULL);
+    Interface_t *values = interface_new(compare_int32_t, copy_int32_t,
+                                        display_int32_t, free, NULL, NULL);
+
+    HashMap_t *map = keys && values ? hmp_new(keys, values) : NULL;
+
+    if (!table || !map)
+        goto error;
+
+    // The keys belong to the arena
+    interface_allocator(keys, NULL, arn_allocator(arena));
+
+    char buffer[16];
+
+    for (int i = 0; i < 1000; i++)
+    {
+        sprintf(buffer, "key%d", i % 100);
+
+        const char *key = itn_intern(table, buffer);
+        int32_t *count = hmp_get(map, (void *)key);
+
+        if (count)
+            (*count)++;
+        else
+            hmp_insert(map, (void *)key, new_int32_t(1));
+    }
+
+    ut_equals_integer_t(ut, 100, itn_count(table), __func__);
+    ut_equals_integer_t(ut, 100, hmp_count(map), __func__);
+    ut_equals_int(ut, 10, *(int32_t *)hmp_get(map,
+            (void *)itn_lookup(table, "key42")), __func__);
+
+    hmp_free(map);
+    interface_free(keys);
+    interface_free(values);
+    itn_free(table);
+    arn_free(arena);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (map) hmp_free_shallow(map);
+    if (keys) interface_free(keys);
+    if (values) interface_free(values);
+    if (table) itn_free(table);
+    if (arena) arn_free(arena);
+}
+
+// Runs all InternTable tests
+Status InternTableTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    itn_test_IO0(ut);
+    itn_test_keys(ut);
+
+    ut_report(ut, "InternTable");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "InternTable");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file IntrusiveAVLTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "IntrusiveAVLTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+struct iav_timer
+{
+    int64_t deadline;
+    AVLHook_t hook;
+};
+
+static int iav_compare_timer(const void *a, const void *b)
+{
+    int64_t x = ((const struct iav_timer *)a)->deadline;
+    int64_t y = ((const struct iav_timer *)b)->deadline;
+
+    return DS_COMPARE_NUMBER(x, y);
+}
+
+// Returns the height of a subtree or -1 if it is not a valid AVL tree
+static integer_t iav_check(AVLHook_t *hook, AVLHook_t *parent)
+{
+    if (hook == NULL)
+        return 0;
+
+    if (hook->parent != parent)
+        return -1;
+
+    integer_t left = iav_check(hook->left, hook);
+    integer_t right = iav_check(hook->right, hook);
+
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1)
+        return -1;
+
+    integer_t height = (left > right ? left : right) + 1;
+
+    if (height != hook->height)
+        return -1;
+
+    return height;
+}
+
+// Inserts and removes elements in random order checking the AVL property
+void iav_test_insert_remove(UnitTest ut)
+{
+    const int64_t size = 2000;
+
+    struct iav_timer *timers = malloc(sizeof(struct iav_timer) * size);
+    int64_t *order = malloc(sizeof(int64_t) * size);
+
+    if (!timers || !order)
+        goto error;
+
+    IntrusiveAVLTree_t tree;
+
+    iav_init(&tree, offsetof(struct iav_timer, hook), iav_compare_timer);
+
+    for (int64_t i = 0; i < size; i++)
+    {
+        timers[i].deadline = i;
+        order[i] = i;
+    }
+
+    for (int64_t i = size - 1; i > 0; i--)
+    {
+        int64_t j = rand() % (i + 1);
+        int64_t t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+
+    bool inserted = true;
+
+    for (int64_t i = 0; i < size; i++)
+        inserted = iav_insert(&tree, &timers[order[i]]) && inserted;
+
+    ut_equals_bool(ut, true, inserted, __func__);
+    ut_equals_integer_t(ut, size, iav_count(&tree), __func__);
+    ut_equals_bool(ut, true, iav_check(tree.root, NULL) > 0, __func__);
+
+    // Duplicates are rejected
+    struct iav_timer duplicate = { .deadline = 10 };
+
+    ut_equals_bool(ut, false, iav_insert(&tree, &duplicate), __func__);
+
+    bool ordered = true;
+    int64_t expected = 0;
+
+    for (struct iav_timer *t = iav_min(&tree); t; t = iav_next(&tree, t))
+    {
+        if (t->deadline != expected++)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered && expected == size, __func__);
+
+    for (int64_t i = 0; i < size; i += 2)
+        iav_remove(&tree, &timers[order[i]]);
+
+    ut_equals_integer_t(ut, size / 2, iav_count(&tree), __func__);
+    ut_equals_bool(ut, true, iav_check(tree.root, NULL) > 0, __func__);
+
+    bool found = true;
+
+    for (int64_t i = 0; i < size; i++)
+    {
+        struct iav_timer key = { .deadline = order[i] };
+
+        if ((iav_search(&tree, &key) != NULL) != (i % 2 == 1))
+            found = false;
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    free(timers);
+    free(order);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    free(timers);
+    free(order);
+    ut_error();
+}
+
+// Uses the tree as a timer queue
+void iav_test_timers(UnitTest ut)
+{
+    struct iav_timer timers[50];
+
+    IntrusiveAVLTree_t tree;
+
+    iav_init(&tree, offsetof(struct iav_timer, hook), iav_compare_timer);
+
+    ut_equals_bool(ut, true, iav_remove_min(&tree) == NULL, __func__);
+
+    for (int64_t i = 0; i < 50; i++)
+    {
+        timers[i].deadline = (i * 37) % 50 * 10;
+        iav_insert(&tree, &timers[i]);
+    }
+
+    struct iav_timer key = { .deadline = 255 };
+    struct iav_timer *bound = iav_lower_bound(&tree, &key);
+
+    ut_equals_int(ut, 260, (int)bound->deadline, __func__);
+    ut_equals_int(ut, 250, (int)((struct iav_timer *)
+            iav_prev(&tree, bound))->deadline, __func__);
+    ut_equals_int(ut, 490, (int)((struct iav_timer *)
+            iav_max(&tree))->deadline, __func__);
+
+    key.deadline = 1000;
+
+    ut_equals_bool(ut, true, iav_lower_bound(&tree, &key) == NULL, __func__);
+
+    bool ordered = true;
+    int64_t last = -1;
+
+    while (!iav_empty(&tree))
+    {
+        struct iav_timer *t = iav_remove_min(&tree);
+
+        if (t->deadline <= last)
+            ordered = false;
+
+        last = t->deadline;
+
+        if (iav_check(tree.root, NULL) < 0)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered && last == 490, __func__);
+}
+
+// Runs all IntrusiveAVLTree tests
+Status IntrusiveAVLTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    iav_test_insert_remove(ut);
+    iav_test_timers(ut);
+
+    ut_report(ut, "IntrusiveAVLTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "IntrusiveAVLTree");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file IntrusiveListTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "IntrusiveList.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+struct ilt_entry
+{
+    int64_t value;
+    ListHook_t lru;
+    ListHook_t queue;
+};
+
+// Uses the list as a queue and checks the order of the elements
+void ilt_test_queue(UnitTest ut)
+{
+    struct ilt_entry entries[100] = {{0}};
+
+    IntrusiveList_t queue;
+
+    ilt_init(&queue, offsetof(struct ilt_entry, queue));
+
+    ut_equals_bool(ut, true, ilt_empty(&queue), __func__);
+    ut_equals_bool(ut, true, ilt_remove_head(&queue) == NULL, __func__);
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        entries[i].value = i;
+        ilt_insert_tail(&queue, &entries[i]);
+    }
+
+    ut_equals_integer_t(ut, 100, ilt_count(&queue), __func__);
+    ut_equals_bool(ut, true, ilt_linked(&queue, &entries[50]), __func__);
+
+    bool ordered = true;
+    int64_t expected = 0;
+
+    for (struct ilt_entry *e = ilt_head(&queue); e; e = ilt_next(&queue, e))
+    {
+        if (e->value != expected++)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered && expected == 100, __func__);
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        struct ilt_entry *e = ilt_remove_head(&queue);
+
+        if (!e || e->value != i)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, ilt_empty(&queue), __func__);
+    ut_equals_bool(ut, false, ilt_linked(&queue, &entries[50]), __func__);
+}
+
+// The same elements in two lists through two hooks, one of them used as a
+// LRU cache
+void ilt_test_lru(UnitTest ut)
+{
+    struct ilt_entry entries[10] = {{0}};
+
+    IntrusiveList_t lru, queue;
+
+    ilt_init(&lru, offsetof(struct ilt_entry, lru));
+    ilt_init(&queue, offsetof(struct ilt_entry, queue));
+
+    for (int64_t i = 0; i < 10; i++)
+    {
+        entries[i].value = i;
+        ilt_insert_head(&lru, &entries[i]);
+        ilt_insert_tail(&queue, &entries[i]);
+    }
+
+    // Using an entry moves it to the front
+    ilt_move_head(&lru, &entries[0]);
+    ilt_move_head(&lru, &entries[3]);
+
+    struct ilt_entry *head = ilt_head(&lru);
+    struct ilt_entry *tail = ilt_tail(&lru);
+
+    ut_equals_int(ut, 3, (int)head->value, __func__);
+    ut_equals_int(ut, 0, (int)((struct ilt_entry *)
+            ilt_next(&lru, head))->value, __func__);
+    ut_equals_int(ut, 1, (int)tail->value, __func__);
+
+    // Eviction
+    struct ilt_entry *evicted = ilt_remove_tail(&lru);
+
+    ut_equals_int(ut, 1, (int)evicted->value, __func__);
+    ut_equals_integer_t(ut, 9, ilt_count(&lru), __func__);
+
+    // The other list is not affected
+    ut_equals_integer_t(ut, 10, ilt_count(&queue), __func__);
+    ut_equals_int(ut, 0, (int)((struct ilt_entry *)ilt_head(&queue))->value,
+                  __func__);
+
+    ilt_remove(&queue, &entries[5]);
+    ilt_insert_before(&queue, &entries[0], &entries[5]);
+    ilt_move_tail(&queue, &entries[0]);
+
+    ut_equals_int(ut, 5, (int)((struct ilt_entry *)ilt_head(&queue))->value,
+                  __func__);
+    ut_equals_int(ut, 0, (int)((struct ilt_entry *)ilt_tail(&queue))->value,
+                  __func__);
+    ut_equals_bool(ut, true, ilt_prev(&queue, &entries[5]) == NULL, __func__);
+
+    IntrusiveList_t other;
+
+    ilt_init(&other, offsetof(struct ilt_entry, lru));
+
+    ilt_insert_tail(&other, evicted);
+    ilt_append(&lru, &other);
+
+    ut_equals_integer_t(ut, 10, ilt_count(&lru), __func__);
+    ut_equals_bool(ut, true, ilt_empty(&other), __func__);
+    ut_equals_bool(ut, true, ilt_tail(&lru) == evicted, __func__);
+
+    ilt_clear(&lru);
+
+    ut_equals_bool(ut, true, ilt_empty(&lru), __func__);
+    ut_equals_bool(ut, false, ilt_linked(&lru, &entries[3]), __func__);
+}
+
+// Runs all IntrusiveList tests
+Status IntrusiveListTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ilt_test_queue(ut);
+    ilt_test_lru(ut);
+
+    ut_report(ut, "IntrusiveList");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "IntrusiveList");
+    ut_delete(&ut);
+    return st;
+}
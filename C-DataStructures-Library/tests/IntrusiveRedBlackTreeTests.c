@@ -0,0 +1,208 @@
+/**
+ * @file IntrusiveRedBlackTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "IntrusiveRedBlackTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+struct irb_timer
+{
+    int64_t deadline;
+    RBHook_t hook;
+};
+
+static int irb_compare_timer(const void *a, const void *b)
+{
+    int64_t x = ((const struct irb_timer *)a)->deadline;
+    int64_t y = ((const struct irb_timer *)b)->deadline;
+
+    return DS_COMPARE_NUMBER(x, y);
+}
+
+// Returns the black height of a subtree or -1 if it is not a valid red-black
+// tree
+static integer_t irb_check(RBHook_t *hook, RBHook_t *parent)
+{
+    if (hook == NULL)
+        return 0;
+
+    if (hook->parent != parent)
+        return -1;
+
+    if (hook->red && ((hook->left && hook->left->red) ||
+                      (hook->right && hook->right->red)))
+        return -1;
+
+    integer_t left = irb_check(hook->left, hook);
+    integer_t right = irb_check(hook->right, hook);
+
+    if (left < 0 || left != right)
+        return -1;
+
+    return left + (hook->red ? 0 : 1);
+}
+
+// Inserts and removes elements in random order checking the red-black
+// properties
+void irb_test_insert_remove(UnitTest ut)
+{
+    const int64_t size = 2000;
+
+    struct irb_timer *timers = malloc(sizeof(struct irb_timer) * size);
+    int64_t *order = malloc(sizeof(int64_t) * size);
+
+    if (!timers || !order)
+        goto error;
+
+    IntrusiveRedBlackTree_t tree;
+
+    irb_init(&tree, offsetof(struct irb_timer, hook), irb_compare_timer);
+
+    for (int64_t i = 0; i < size; i++)
+    {
+        timers[i].deadline = i;
+        order[i] = i;
+    }
+
+    for (int64_t i = size - 1; i > 0; i--)
+    {
+        int64_t j = rand() % (i + 1);
+        int64_t t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+
+    bool inserted = true;
+
+    for (int64_t i = 0; i < size; i++)
+        inserted = irb_insert(&tree, &timers[order[i]]) && inserted;
+
+    ut_equals_bool(ut, true, inserted, __func__);
+    ut_equals_integer_t(ut, size, irb_count(&tree), __func__);
+    ut_equals_bool(ut, true, irb_check(tree.root, NULL) > 0, __func__);
+
+    // Duplicates are rejected
+    struct irb_timer duplicate = { .deadline = 10 };
+
+    ut_equals_bool(ut, false, irb_insert(&tree, &duplicate), __func__);
+
+    bool ordered = true;
+    int64_t expected = 0;
+
+    for (struct irb_timer *t = irb_min(&tree); t; t = irb_next(&tree, t))
+    {
+        if (t->deadline != expected++)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered && expected == size, __func__);
+
+    for (int64_t i = 0; i < size; i += 2)
+        irb_remove(&tree, &timers[order[i]]);
+
+    ut_equals_integer_t(ut, size / 2, irb_count(&tree), __func__);
+    ut_equals_bool(ut, true, irb_check(tree.root, NULL) > 0, __func__);
+
+    bool found = true;
+
+    for (int64_t i = 0; i < size; i++)
+    {
+        struct irb_timer key = { .deadline = order[i] };
+
+        if ((irb_search(&tree, &key) != NULL) != (i % 2 == 1))
+            found = false;
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    free(timers);
+    free(order);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    free(timers);
+    free(order);
+    ut_error();
+}
+
+// Uses the tree as a timer queue
+void irb_test_timers(UnitTest ut)
+{
+    struct irb_timer timers[50];
+
+    IntrusiveRedBlackTree_t tree;
+
+    irb_init(&tree, offsetof(struct irb_timer, hook), irb_compare_timer);
+
+    ut_equals_bool(ut, true, irb_remove_min(&tree) == NULL, __func__);
+
+    for (int64_t i = 0; i < 50; i++)
+    {
+        timers[i].deadline = (i * 37) % 50 * 10;
+        irb_insert(&tree, &timers[i]);
+    }
+
+    struct irb_timer key = { .deadline = 255 };
+    struct irb_timer *bound = irb_lower_bound(&tree, &key);
+
+    ut_equals_int(ut, 260, (int)bound->deadline, __func__);
+    ut_equals_int(ut, 250, (int)((struct irb_timer *)
+            irb_prev(&tree, bound))->deadline, __func__);
+    ut_equals_int(ut, 490, (int)((struct irb_timer *)
+            irb_max(&tree))->deadline, __func__);
+
+    key.deadline = 1000;
+
+    ut_equals_bool(ut, true, irb_lower_bound(&tree, &key) == NULL, __func__);
+
+    bool ordered = true;
+    int64_t last = -1;
+
+    while (!irb_empty(&tree))
+    {
+        struct irb_timer *t = irb_remove_min(&tree);
+
+        if (t->deadline <= last)
+            ordered = false;
+
+        last = t->deadline;
+
+        if (irb_check(tree.root, NULL) < 0)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered && last == 490, __func__);
+}
+
+// Runs all IntrusiveRedBlackTree tests
+Status IntrusiveRedBlackTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    irb_test_insert_remove(ut);
+    irb_test_timers(ut);
+
+    ut_report(ut, "IntrusiveRedBlackTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "IntrusiveRedBlackTree");
+    ut_delete(&ut);
+    return st;
+}
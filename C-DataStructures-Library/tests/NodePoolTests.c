@@ -0,0 +1,216 @@
+/**
+ * @file NodePoolTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "NodePool.h"
+#include "QueueList.h"
+#include "RedBlackTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Checks that released nodes are reused and that slabs are only allocated
+// when needed
+void npl_test_alloc(UnitTest ut)
+{
+    NodePool_t *pool = npl_new(sizeof(int64_t) * 3, 16);
+
+    if (!pool)
+        goto error;
+
+    ut_equals_bool(ut, true, npl_fits(pool, sizeof(int64_t) * 3), __func__);
+    ut_equals_integer_t(ut, 0, npl_capacity(pool), __func__);
+
+    void *nodes[40];
+
+    for (int i = 0; i < 40; i++)
+    {
+        nodes[i] = npl_alloc(pool);
+
+        if (!nodes[i])
+            goto error;
+
+        // Write the whole node to make sure nodes don't overlap
+        memset(nodes[i], i, npl_node_size(pool));
+    }
+
+    ut_equals_integer_t(ut, 40, npl_in_use(pool), __func__);
+    ut_equals_integer_t(ut, 48, npl_capacity(pool), __func__);
+
+    bool intact = true;
+
+    for (int i = 0; i < 40; i++)
+    {
+        if (((unsigned char *)nodes[i])[npl_node_size(pool) - 1] != i)
+            intact = false;
+    }
+
+    ut_equals_bool(ut, true, intact, __func__);
+
+    void *released = nodes[7];
+
+    npl_release(pool, released);
+
+    ut_equals_integer_t(ut, 39, npl_in_use(pool), __func__);
+    ut_equals_bool(ut, true, npl_alloc(pool) == released, __func__);
+    ut_equals_bool(ut, false, npl_shrink(pool), __func__);
+
+    npl_reset(pool);
+
+    ut_equals_integer_t(ut, 0, npl_in_use(pool), __func__);
+
+    // All nodes can be taken again without allocating a new slab
+    for (int i = 0; i < 48; i++)
+    {
+        if (!npl_alloc(pool))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 48, npl_capacity(pool), __func__);
+
+    npl_reset(pool);
+
+    ut_equals_bool(ut, true, npl_shrink(pool), __func__);
+    ut_equals_integer_t(ut, 0, npl_capacity(pool), __func__);
+
+    npl_free(pool);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (pool) npl_free(pool);
+    ut_error();
+}
+
+// Two different containers sharing the same pool
+void npl_test_containers(UnitTest ut)
+{
+    const int64_t elements = 5000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    NodePool_t *pool = npl_new(64, 256);
+
+    RedBlackTree_t *tree = rbt_new(int_interface);
+    QueueList_t *queue = qli_new(int_interface);
+
+    if (!int_interface || !pool || !tree || !queue)
+        goto error;
+
+    ut_equals_bool(ut, true, rbt_set_pool(tree, pool), __func__);
+    ut_equals_bool(ut, true, qli_set_pool(queue, pool), __func__);
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t(i)))
+            goto error;
+        if (!qli_enqueue(queue, new_int64_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, elements * 2, npl_in_use(pool), __func__);
+
+    // The pool can't be changed while there are nodes in the container
+    ut_equals_bool(ut, false, rbt_set_pool(tree, NULL), __func__);
+
+    // A pool with nodes that are too small is rejected
+    NodePool_t *small = npl_new(1, 16);
+
+    if (!small)
+        goto error;
+
+    RedBlackTree_t *other = rbt_new(int_interface);
+
+    if (!other)
+    {
+        npl_free(small);
+        goto error;
+    }
+
+    ut_equals_bool(ut, false, rbt_set_pool(other, small), __func__);
+
+    rbt_free(other);
+    npl_free(small);
+
+    for (int64_t i = 0; i < elements; i += 2)
+    {
+        if (!rbt_remove(tree, &i))
+            goto error;
+    }
+
+    void *result;
+
+    for (int64_t i = 0; i < elements / 2; i++)
+    {
+        if (!qli_dequeue(queue, &result))
+            goto error;
+
+        free(result);
+    }
+
+    // The queue keeps its last emptied node as a spare
+    ut_equals_integer_t(ut, elements + 1, npl_in_use(pool), __func__);
+    ut_equals_integer_t(ut, elements / 2, rbt_size(tree), __func__);
+    ut_equals_integer_t(ut, elements / 2, qli_count(queue), __func__);
+
+    bool found = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (rbt_contains(tree, &i) != (i % 2 == 1))
+            found = false;
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    rbt_erase(tree);
+    qli_erase(queue);
+
+    ut_equals_integer_t(ut, 0, npl_in_use(pool), __func__);
+
+    rbt_free(tree);
+    qli_free(queue);
+    npl_free(pool);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (tree) rbt_free(tree);
+    if (queue) qli_free(queue);
+    if (pool) npl_free(pool);
+    interface_free(int_interface);
+    ut_error();
+}
+
+// Runs all NodePool tests
+Status NodePoolTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    npl_test_alloc(ut);
+    npl_test_containers(ut);
+
+    ut_report(ut, "NodePool");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "NodePool");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,336 @@
+/**
+ * @file PagedBitArrayTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "PagedBitArray.h"
+#include "UnitTest.h"
+
+// Single bit operations and lazy allocation of pages
+void pba_test_basic(UnitTest ut)
+{
+    PagedBitArray_t *bits = pba_create(100000);
+
+    if (!bits)
+        goto error;
+
+    ut_equals_bool(ut, true, pba_create(0) == NULL, __func__);
+    ut_equals_bool(ut, true, pba_nbits(bits) == 100000, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 0, __func__);
+
+    ut_equals_bool(ut, false, pba_set(bits, 100000), __func__);
+    ut_equals_bool(ut, false, pba_clear(bits, 100000), __func__);
+    ut_equals_bool(ut, false, pba_get(bits, 100000), __func__);
+
+    // Clearing a bit of a missing page allocates nothing
+    ut_equals_bool(ut, true, pba_clear(bits, 5), __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 0, __func__);
+
+    ut_equals_bool(ut, true, pba_set(bits, 5), __func__);
+    ut_equals_bool(ut, true, pba_set(bits, 5), __func__);
+    ut_equals_bool(ut, true, pba_put(bits, 99999, true), __func__);
+    ut_equals_bool(ut, true, pba_flip(bits, 40000), __func__);
+
+    ut_equals_bool(ut, true, pba_get(bits, 5), __func__);
+    ut_equals_bool(ut, true, pba_get(bits, 40000), __func__);
+    ut_equals_bool(ut, true, pba_get(bits, 99999), __func__);
+    ut_equals_bool(ut, false, pba_get(bits, 6), __func__);
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 3, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 3, __func__);
+
+    // A page is freed with its last set bit
+    ut_equals_bool(ut, true, pba_flip(bits, 40000), __func__);
+    ut_equals_bool(ut, true, pba_put(bits, 99999, false), __func__);
+
+    ut_equals_bool(ut, false, pba_get(bits, 40000), __func__);
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 1, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 1, __func__);
+
+    pba_empty(bits);
+
+    ut_equals_bool(ut, false, pba_get(bits, 5), __func__);
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 0, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 0, __func__);
+
+    pba_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) pba_free(bits);
+}
+
+// A 2^40 bit array only takes memory for the pages that are written
+void pba_test_huge(UnitTest ut)
+{
+    unsigned_t size = (unsigned_t)1 << 40;
+
+    PagedBitArray_t *bits = pba_create(size);
+
+    if (!bits)
+        goto error;
+
+    unsigned_t initial = pba_bytes(bits);
+
+    ut_equals_bool(ut, true, initial < 1024 * 1024, __func__);
+
+    unsigned_t indexes[] = { 0, (unsigned_t)1 << 20, ((unsigned_t)1 << 39) + 5,
+                             size - 1 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (!pba_set(bits, indexes[i]))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, pba_pages(bits) == 4, __func__);
+    ut_equals_bool(ut, true, pba_bytes(bits) < initial + 64 * 1024,
+                   __func__);
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 4, __func__);
+
+    unsigned_t index = pba_next_set(bits, 0);
+
+    bool found = true;
+
+    for (int i = 0; i < 4; i++)
+    {
+        found = found && index == indexes[i];
+
+        index = pba_next_set(bits, index + 1);
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_bool(ut, true, index == (unsigned_t)-1, __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, size) == (unsigned_t)-1,
+                   __func__);
+    ut_equals_bool(ut, true, pba_next_clear(bits, 0) == 1, __func__);
+    ut_equals_bool(ut, true, pba_next_clear(bits, size - 1) == (unsigned_t)-1,
+                   __func__);
+
+    for (int i = 0; i < 4; i++)
+        pba_clear(bits, indexes[i]);
+
+    ut_equals_bool(ut, true, pba_pages(bits) == 0, __func__);
+    ut_equals_bool(ut, true, pba_bytes(bits) == initial, __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, 0) == (unsigned_t)-1,
+                   __func__);
+
+    pba_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) pba_free(bits);
+}
+
+// Ranges that span several pages
+void pba_test_range(UnitTest ut)
+{
+    PagedBitArray_t *bits = pba_create(200000);
+
+    if (!bits)
+        goto error;
+
+    ut_equals_bool(ut, false, pba_set_range(bits, 10, 9), __func__);
+    ut_equals_bool(ut, false, pba_set_range(bits, 0, 200000), __func__);
+
+    ut_equals_bool(ut, true, pba_set_range(bits, 100, 70000), __func__);
+
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 69901, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 3, __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, 0) == 100, __func__);
+    ut_equals_bool(ut, true, pba_next_clear(bits, 0) == 0, __func__);
+    ut_equals_bool(ut, true, pba_next_clear(bits, 100) == 70001, __func__);
+
+    // Clearing a whole page frees it
+    ut_equals_bool(ut, true, pba_clear_range(bits, 0, 65535), __func__);
+
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 4465, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 1, __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, 0) == 65536, __func__);
+
+    ut_equals_bool(ut, true, pba_clear_range(bits, 0, 199999), __func__);
+
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 0, __func__);
+    ut_equals_bool(ut, true, pba_pages(bits) == 0, __func__);
+
+    pba_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) pba_free(bits);
+}
+
+// Random operations give the same bits as a dense BitArray_s
+void pba_test_random(UnitTest ut)
+{
+    unsigned_t size = 300000;
+
+    PagedBitArray_t *bits = pba_create(size);
+    BitArray_t *dense = bit_create(size);
+
+    if (!bits || !dense)
+        goto error;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        unsigned_t index = (unsigned_t)rand() % size;
+
+        // Bits are concentrated in a few pages to also free some of them
+        if (i % 2 == 0)
+            index %= 100000;
+
+        if (rand() % 3 == 0)
+        {
+            pba_clear(bits, index);
+            bit_clear(dense, index);
+        }
+        else
+        {
+            pba_set(bits, index);
+            bit_set(dense, index);
+        }
+    }
+
+    ut_equals_bool(ut, true, pba_cardinality(bits) == bit_cardinality(dense),
+                   __func__);
+
+    bool equal = true;
+
+    unsigned_t index = 0, expected = 0;
+
+    while (expected != (unsigned_t)-1)
+    {
+        expected = bit_next_set(dense, index);
+
+        equal = equal && pba_next_set(bits, index) == expected;
+
+        index = expected + 1;
+    }
+
+    index = 0;
+    expected = 0;
+
+    for (int i = 0; i < 1000 && expected != (unsigned_t)-1; i++)
+    {
+        expected = bit_next_clear(dense, index);
+
+        equal = equal && pba_next_clear(bits, index) == expected;
+
+        index = expected + 1;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    pba_free(bits);
+    bit_free(dense);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) pba_free(bits);
+    if (dense) bit_free(dense);
+}
+
+// Windows copied to a BitArray_s and written back
+void pba_test_bitarray(UnitTest ut)
+{
+    PagedBitArray_t *bits = pba_create((unsigned_t)1 << 32);
+    BitArray_t *window = NULL;
+
+    if (!bits)
+        goto error;
+
+    unsigned_t base = (unsigned_t)3 << 30;
+
+    pba_set(bits, base - 1);
+    pba_set(bits, base + 10);
+    pba_set(bits, base + 40000);
+    pba_set(bits, base + 99999);
+    pba_set(bits, base + 100000);
+
+    window = pba_read_bitarray(bits, base, base + 99999);
+
+    if (!window)
+        goto error;
+
+    ut_equals_bool(ut, true, bit_nbits(window) == 100000, __func__);
+    ut_equals_bool(ut, true, bit_cardinality(window) == 3, __func__);
+    ut_equals_bool(ut, true, bit_get(window, 10), __func__);
+    ut_equals_bool(ut, true, bit_get(window, 40000), __func__);
+    ut_equals_bool(ut, true, bit_get(window, 99999), __func__);
+
+    // Changed through the BitArray_s API and written back
+    bit_clear(window, 40000);
+    bit_set_range(window, 500, 599);
+
+    ut_equals_bool(ut, true, pba_write_bitarray(bits, window, base),
+                   __func__);
+    ut_equals_bool(ut, false, pba_write_bitarray(bits, window,
+                                                 ((unsigned_t)1 << 32) - 10),
+                   __func__);
+
+    ut_equals_bool(ut, true, pba_cardinality(bits) == 104, __func__);
+    ut_equals_bool(ut, true, pba_get(bits, base - 1), __func__);
+    ut_equals_bool(ut, false, pba_get(bits, base + 40000), __func__);
+    ut_equals_bool(ut, true, pba_get(bits, base + 100000), __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, base + 11) == base + 500,
+                   __func__);
+    ut_equals_bool(ut, true, pba_next_set(bits, base + 600) == base + 99999,
+                   __func__);
+
+    bit_free(window);
+
+    ut_equals_bool(ut, true, pba_read_bitarray(bits, 10, 9) == NULL, __func__);
+
+    pba_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (window) bit_free(window);
+    if (bits) pba_free(bits);
+}
+
+// Runs all PagedBitArray tests
+Status PagedBitArrayTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    pba_test_basic(ut);
+    pba_test_huge(ut);
+    pba_test_range(ut);
+    pba_test_random(ut);
+    pba_test_bitarray(ut);
+
+    ut_report(ut, "PagedBitArray");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "PagedBitArray");
+    ut_delete(&ut);
+    return st;
+}
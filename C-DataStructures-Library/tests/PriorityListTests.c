@@ -57,6 +57,19 @@ pli_test_pri1(const void *e1, const void *e2)
     }
 }
 
+// Smaller numbers first
+static int
+pli_test_pri2(const void *e1, const void *e2)
+{
+    return *(int32_t*)e2 - *(int32_t*)e1;
+}
+
+static uint64_t
+pli_test_key(const void *e)
+{
+    return (uint64_t)*(int32_t*)e;
+}
+
 void pli_test_IO0(UnitTest ut)
 {
     Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
@@ -165,6 +178,203 @@ void pli_test_limit(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Every engine removes the elements in the same order
+void pli_test_engines(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL,
+                                            pli_test_pri2);
+
+    PriorityList_t *sorted = pli_new(int_interface);
+    PriorityList_t *pairing = pli_create(int_interface, PLI_PAIRING, NULL);
+    PriorityList_t *radix = pli_create(int_interface, PLI_RADIX,
+                                       pli_test_key);
+
+    if (!int_interface || !sorted || !pairing || !radix)
+        goto error;
+
+    ut_equals_bool(ut, true, pli_create(int_interface, PLI_RADIX, NULL) == NULL,
+                   __func__);
+    ut_equals_int(ut, PLI_PAIRING, pli_engine(pairing), __func__);
+
+    int numbers[500];
+
+    for (int i = 0; i < 500; i++)
+    {
+        numbers[i] = (i * 7919) % 1000;
+
+        if (!pli_insert(sorted, &numbers[i]) ||
+            !pli_insert(pairing, &numbers[i]) ||
+            !pli_insert(radix, &numbers[i]))
+            goto error;
+    }
+
+    int key = 7919 % 1000;
+
+    ut_equals_bool(ut, true, pli_contains(pairing, &key), __func__);
+    ut_equals_bool(ut, true, pli_contains(radix, &key), __func__);
+    ut_equals_int(ut, 0, pli_compare(sorted, pairing), __func__);
+    ut_equals_int(ut, 0, pli_compare(sorted, radix), __func__);
+
+    void *result1, *result2, *result3;
+    bool failed = false;
+
+    for (int i = 0; i < 250; i++)
+    {
+        if (!pli_remove(sorted, &result1) || !pli_remove(pairing, &result2) ||
+            !pli_remove(radix, &result3))
+            goto error;
+
+        if (*(int*)result1 != *(int*)result2 ||
+            *(int*)result1 != *(int*)result3)
+            failed = true;
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+
+    // Keys can't go back in a radix heap
+    int smaller = *(int*)result3 - 1, bigger = 2000;
+
+    ut_equals_bool(ut, false, pli_insert(radix, &smaller), __func__);
+    ut_equals_bool(ut, true, pli_insert(radix, &bigger), __func__);
+    ut_equals_bool(ut, true, pli_insert(pairing, &bigger), __func__);
+
+    while (!pli_empty(pairing))
+    {
+        if (!pli_remove(pairing, &result2) || !pli_remove(radix, &result3))
+            goto error;
+
+        if (*(int*)result2 != *(int*)result3)
+            failed = true;
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_bool(ut, true, pli_empty(radix), __func__);
+    ut_equals_int(ut, 2000, *(int*)result2, __func__);
+
+    // Peeking doesn't raise the smallest key that can be inserted
+    int keys[3] = { 3010, 3020, 3015 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!pli_insert(radix, &keys[i]))
+            goto error;
+    }
+
+    if (!pli_remove(radix, &result3))
+        goto error;
+
+    ut_equals_int(ut, 3020, *(int*)pli_peek(radix), __func__);
+    ut_equals_bool(ut, true, pli_insert(radix, &keys[2]), __func__);
+    ut_equals_int(ut, 3015, *(int*)pli_peek(radix), __func__);
+
+    pli_free_shallow(sorted);
+    pli_free_shallow(pairing);
+    pli_free_shallow(radix);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sorted) pli_free_shallow(sorted);
+    if (pairing) pli_free_shallow(pairing);
+    if (radix) pli_free_shallow(radix);
+    interface_free(int_interface);
+}
+
+// Merging and copying lists of every engine
+void pli_test_merge(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL,
+                                            pli_test_pri2);
+
+    PriorityListEngine engines[3] = { PLI_SORTED, PLI_PAIRING, PLI_RADIX };
+
+    PriorityList_t *list1 = NULL, *list2 = NULL, *copy = NULL;
+
+    if (!int_interface)
+        goto error;
+
+    for (int e = 0; e < 3; e++)
+    {
+        list1 = pli_create(int_interface, engines[e], pli_test_key);
+        list2 = pli_create(int_interface, engines[e], pli_test_key);
+
+        if (!list1 || !list2)
+            goto error;
+
+        // Even numbers in the first list and odd numbers in the second
+        for (int i = 0; i < 200; i++)
+        {
+            if (!pli_insert(i % 2 ? list2 : list1, new_int32_t(199 - i)))
+                goto error;
+        }
+
+        if (!pli_merge(list1, list2))
+            goto error;
+
+        ut_equals_integer_t(ut, 200, pli_count(list1), __func__);
+        ut_equals_bool(ut, true, pli_empty(list2), __func__);
+
+        copy = pli_copy(list1);
+
+        if (!copy)
+            goto error;
+
+        ut_equals_int(ut, 0, pli_compare(list1, copy), __func__);
+
+        integer_t length;
+        void **array = pli_to_array(copy, &length);
+        bool failed = length != 200;
+
+        for (integer_t i = 0; i < length; i++)
+        {
+            if (*(int*)array[i] != (int)i)
+                failed = true;
+
+            free(array[i]);
+        }
+
+        free(array);
+
+        void *result;
+
+        for (int i = 0; i < 200; i++)
+        {
+            if (!pli_remove(list1, &result))
+                goto error;
+
+            if (*(int*)result != i)
+                failed = true;
+
+            free(result);
+        }
+
+        ut_equals_bool(ut, false, failed, __func__);
+
+        pli_free(list1);
+        pli_free(list2);
+        pli_free(copy);
+
+        list1 = list2 = copy = NULL;
+    }
+
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (list1) pli_free(list1);
+    if (list2) pli_free(list2);
+    if (copy) pli_free(copy);
+    interface_free(int_interface);
+}
+
 // Runs all PriorityList tests
 Status PriorityListTests(void)
 {
@@ -177,6 +387,8 @@ Status PriorityListTests(void)
 
     pli_test_IO0(ut);
     pli_test_limit(ut);
+    pli_test_engines(ut);
+    pli_test_merge(ut);
 
     ut_report(ut, "PriorityList");
 
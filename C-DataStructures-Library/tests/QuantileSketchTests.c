@@ -0,0 +1,192 @@
+/**
+ * @file QuantileSketchTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "QuantileSketch.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Largest distance between the estimated and the real quantiles of a stream
+// of the numbers from 0 to size - 1
+static double
+qsk_test_error(QuantileSketch_t *sketch, integer_t size)
+{
+    double worst = 0.0;
+
+    for (int i = 1; i < 100; i++)
+    {
+        double q = i / 100.0, value;
+
+        if (!qsk_quantile(sketch, q, &value))
+            return 1.0;
+
+        double error = fabs(value / (double)size - q);
+
+        if (error > worst)
+            worst = error;
+
+        // Ranks are the inverse of quantiles
+        error = fabs(qsk_rank(sketch, q * (double)size) - q);
+
+        if (error > worst)
+            worst = error;
+    }
+
+    return worst;
+}
+
+// Quantiles of a shuffled stream are close while memory stays bounded
+void qsk_test_quantiles(UnitTest ut)
+{
+    const integer_t size = 200000;
+
+    QuantileSketch_t *sketch = qsk_new(200);
+
+    integer_t *stream = malloc(sizeof(integer_t) * (size_t)size);
+
+    if (!sketch || !stream)
+        goto error;
+
+    ut_equals_bool(ut, true, qsk_new(4) == NULL, __func__);
+
+    double value;
+
+    ut_equals_bool(ut, false, qsk_quantile(sketch, 0.5, &value), __func__);
+    ut_equals_bool(ut, false, qsk_insert(sketch, NAN), __func__);
+
+    for (integer_t i = 0; i < size; i++)
+        stream[i] = i;
+
+    for (integer_t i = size - 1; i > 0; i--)
+    {
+        integer_t j = random_int32_t(0, (int32_t)i);
+        integer_t swap = stream[i];
+        stream[i] = stream[j];
+        stream[j] = swap;
+    }
+
+    integer_t most = 0;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        if (!qsk_insert(sketch, (double)stream[i]))
+            goto error;
+
+        if (qsk_retained(sketch) > most)
+            most = qsk_retained(sketch);
+    }
+
+    ut_equals_integer_t(ut, size, (integer_t)qsk_count(sketch), __func__);
+    ut_equals_bool(ut, true, most < 4 * 200, __func__);
+    ut_equals_bool(ut, true, qsk_test_error(sketch, size) < 0.03, __func__);
+
+    qsk_quantile(sketch, 0.0, &value);
+    ut_equals_double(ut, 0.0, value, __func__);
+
+    qsk_quantile(sketch, 1.0, &value);
+    ut_equals_double(ut, (double)(size - 1), value, __func__);
+
+    ut_equals_double(ut, 0.0, qsk_rank(sketch, -1.0), __func__);
+    ut_equals_double(ut, 1.0, qsk_rank(sketch, (double)size), __func__);
+
+    qsk_erase(sketch);
+
+    ut_equals_bool(ut, true, qsk_empty(sketch), __func__);
+    ut_equals_integer_t(ut, 0, qsk_retained(sketch), __func__);
+
+    free(stream);
+    qsk_free(sketch);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(stream);
+    if (sketch) qsk_free(sketch);
+}
+
+// A sketch per thread has the same error once merged
+void qsk_test_merge(UnitTest ut)
+{
+    const integer_t size = 100000;
+
+    QuantileSketch_t *sketch[4] = { NULL, NULL, NULL, NULL };
+    QuantileSketch_t *other = qsk_new(100);
+
+    if (!other)
+        goto error;
+
+    for (integer_t i = 0; i < 4; i++)
+    {
+        sketch[i] = qsk_new(200);
+
+        if (!sketch[i])
+            goto error;
+    }
+
+    // Each sketch sees a different range of the stream, in ascending order
+    for (integer_t i = 0; i < size; i++)
+    {
+        if (!qsk_insert(sketch[i * 4 / size], (double)i))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, qsk_merge(sketch[0], other), __func__);
+    ut_equals_bool(ut, false, qsk_merge(sketch[0], sketch[0]), __func__);
+
+    for (integer_t i = 1; i < 4; i++)
+        ut_equals_bool(ut, true, qsk_merge(sketch[0], sketch[i]), __func__);
+
+    ut_equals_integer_t(ut, size, (integer_t)qsk_count(sketch[0]), __func__);
+    ut_equals_bool(ut, true, qsk_retained(sketch[0]) < 4 * 200, __func__);
+    ut_equals_bool(ut, true, qsk_test_error(sketch[0], size) < 0.03,
+                   __func__);
+
+    // The merged sketches are left as they were
+    ut_equals_integer_t(ut, size / 4, (integer_t)qsk_count(sketch[3]),
+                        __func__);
+
+    for (integer_t i = 0; i < 4; i++)
+        qsk_free(sketch[i]);
+    qsk_free(other);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    for (integer_t i = 0; i < 4; i++)
+        if (sketch[i]) qsk_free(sketch[i]);
+    if (other) qsk_free(other);
+}
+
+// Runs all QuantileSketch tests
+Status QuantileSketchTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    qsk_test_quantiles(ut);
+    qsk_test_merge(ut);
+
+    ut_report(ut, "QuantileSketch");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "QuantileSketch");
+    ut_delete(&ut);
+    return st;
+}
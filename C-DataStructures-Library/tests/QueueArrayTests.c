@@ -269,6 +269,512 @@ void qar_test_growth(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Tests segmented growth with interleaved enqueues and dequeues
+void qar_test_segmented(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue = qar_create(&int_interface, 4, 200), *copy = NULL;
+
+    if (!queue)
+        goto error;
+
+    qar_set_segmented(queue, true);
+
+    int32_t next_in = 0, next_out = 0;
+    bool failed = false;
+
+    for (int i = 0; i < 300; i++)
+    {
+        for (int j = 0; j < i % 17; j++)
+        {
+            if (!qar_enqueue(queue, new_int32_t(next_in++)))
+                goto error;
+        }
+
+        for (int j = 0; j < i % 7 && !qar_empty(queue); j++)
+        {
+            void *result;
+
+            if (!qar_dequeue(queue, &result))
+                goto error;
+
+            if (*(int32_t*)result != next_out++)
+                failed = true;
+
+            free(result);
+        }
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, next_in - next_out, qar_count(queue), __func__);
+    ut_equals_int(ut, next_out, *(int32_t*)qar_peek_front(queue), __func__);
+    ut_equals_int(ut, next_in - 1, *(int32_t*)qar_peek_rear(queue), __func__);
+    ut_equals_bool(ut, true, qar_contains(queue, &(int32_t){next_out}),
+                   __func__);
+
+    copy = qar_copy(queue);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_int(ut, 0, qar_compare(queue, copy), __func__);
+
+    // Merges every segment in a single buffer
+    ut_equals_bool(ut, true, qar_reserve(queue, qar_count(queue) + 100),
+                   __func__);
+    ut_equals_integer_t(ut, qar_count(copy) + 100, qar_capacity(queue),
+                        __func__);
+    ut_equals_int(ut, 0, qar_compare(queue, copy), __func__);
+    ut_equals_bool(ut, true, qar_fits(queue, 100), __func__);
+
+    ut_equals_bool(ut, true, qar_shrink_to_fit(copy), __func__);
+    ut_equals_integer_t(ut, qar_count(copy), qar_capacity(copy), __func__);
+    ut_equals_int(ut, 0, qar_compare(queue, copy), __func__);
+
+    qar_free(queue);
+    qar_free(copy);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+    if (copy) qar_free(copy);
+}
+
+// Tests that the buffer shrinks after a burst
+void qar_test_shrink(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue = qar_create(&int_interface, 8, 200);
+
+    if (!queue)
+        goto error;
+
+    qar_set_shrink(queue, true);
+
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1024, qar_capacity(queue), __func__);
+
+    bool failed = false;
+
+    for (int32_t i = 0; i < 996; i++)
+    {
+        void *result;
+
+        if (!qar_dequeue(queue, &result))
+            goto error;
+
+        if (*(int32_t*)result != i)
+            failed = true;
+
+        free(result);
+    }
+
+    // Never below the initial capacity and at most half full after shrinking
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, 8, qar_capacity(queue), __func__);
+    ut_equals_int(ut, 996, *(int32_t*)qar_peek_front(queue), __func__);
+    ut_equals_int(ut, 999, *(int32_t*)qar_peek_rear(queue), __func__);
+
+    qar_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+}
+
+// Walks a wrapped and segmented queue through its spans
+void qar_test_span(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    QueueArray queue = qar_create(int_interface, 8, 200);
+
+    if (!int_interface || !queue)
+        goto error;
+
+    qar_set_segmented(queue, true);
+
+    int next = 0, front = 0;
+    void *element;
+
+    // Wraps the buffer around before it becomes a segment
+    for (int i = 0; i < 5; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(next++)))
+            goto error;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (!qar_dequeue(queue, &element))
+            goto error;
+
+        free(element);
+        front++;
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(next++)))
+            goto error;
+    }
+
+    void **span;
+    integer_t spans = 0, position = 0, length;
+
+    bool correct = true;
+
+    while ((length = qar_span(queue, position, &span)) > 0)
+    {
+        for (integer_t i = 0; correct && i < length; i++)
+        {
+            if (i + 4 < length)
+                DS_PREFETCH(span[i + 4]);
+
+            correct = *(int *)span[i] == front + position + i;
+        }
+
+        position += length;
+        spans++;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, qar_count(queue), position, __func__);
+    ut_equals_bool(ut, true, spans > 2, __func__);
+
+    qar_free(queue);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Tests batch insertions and removals on plain and segmented queues
+void qar_test_batch(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue = NULL;
+    void *buffer[32];
+
+    for (int k = 0; k < 2; k++)
+    {
+        queue = qar_create(&int_interface, 4, 150);
+
+        if (!queue)
+            goto error;
+
+        qar_set_segmented(queue, k == 1);
+
+        int32_t next_in = 0, next_out = 0;
+        integer_t removed;
+        bool failed = false;
+
+        for (int i = 0; i < 300; i++)
+        {
+            int size = i % 23;
+
+            for (int j = 0; j < size; j++)
+                buffer[j] = new_int32_t(next_in++);
+
+            if (!qar_enqueue_n(queue, buffer, size))
+                goto error;
+
+            removed = qar_dequeue_n(queue, buffer, i % 19);
+
+            for (integer_t j = 0; j < removed; j++)
+            {
+                if (*(int32_t*)buffer[j] != next_out++)
+                    failed = true;
+
+                free(buffer[j]);
+            }
+        }
+
+        ut_equals_bool(ut, false, failed, __func__);
+        ut_equals_integer_t(ut, next_in - next_out, qar_count(queue),
+                            __func__);
+        ut_equals_int(ut, next_out, *(int32_t*)qar_peek_front(queue),
+                      __func__);
+        ut_equals_int(ut, next_in - 1, *(int32_t*)qar_peek_rear(queue),
+                      __func__);
+
+        // Either every element is inserted or none of them
+        qar_capacity_lock(queue);
+
+        integer_t count = qar_count(queue);
+        integer_t room = qar_capacity(queue) - qar_count(queue);
+
+        if (k == 0)
+        {
+            ut_equals_bool(ut, false, qar_enqueue_n(queue, buffer, room + 1),
+                           __func__);
+            ut_equals_integer_t(ut, count, qar_count(queue), __func__);
+        }
+
+        while ((removed = qar_dequeue_n(queue, buffer, 32)) > 0)
+        {
+            for (integer_t j = 0; j < removed; j++)
+            {
+                if (*(int32_t*)buffer[j] != next_out++)
+                    failed = true;
+
+                free(buffer[j]);
+            }
+        }
+
+        ut_equals_bool(ut, false, failed, __func__);
+        ut_equals_int(ut, next_in, next_out, __func__);
+        ut_equals_bool(ut, true, qar_empty(queue), __func__);
+        ut_equals_integer_t(ut, 0, qar_dequeue_n(queue, buffer, 32),
+                            __func__);
+
+        qar_free(queue);
+        queue = NULL;
+    }
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+}
+
+// Removes a batch that spans a frozen segment and the buffer that replaced it
+void qar_test_batch_segments(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue = qar_create(&int_interface, 4, 200);
+    void *buffer[32];
+
+    if (!queue)
+        goto error;
+
+    qar_set_segmented(queue, true);
+    qar_set_shrink(queue, true);
+
+    for (int32_t i = 0; i < 24; i++)
+        buffer[i] = new_int32_t(i);
+
+    // The first four elements are frozen when the buffer grows
+    if (!qar_enqueue_n(queue, buffer, 4) ||
+        !qar_enqueue_n(queue, buffer + 4, 20))
+        goto error;
+
+    bool failed = false;
+
+    // Asks for more elements than there are
+    integer_t removed = qar_dequeue_n(queue, buffer, 32);
+
+    for (integer_t i = 0; i < removed; i++)
+    {
+        if (*(int32_t*)buffer[i] != i)
+            failed = true;
+
+        free(buffer[i]);
+    }
+
+    ut_equals_integer_t(ut, 24, removed, __func__);
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, 0, qar_count(queue), __func__);
+    ut_equals_bool(ut, true, qar_empty(queue), __func__);
+
+    for (int32_t i = 0; i < 2; i++)
+        buffer[i] = new_int32_t(i);
+
+    if (!qar_enqueue_n(queue, buffer, 2))
+        goto error;
+
+    ut_equals_integer_t(ut, 2, qar_count(queue), __func__);
+    ut_equals_int(ut, 0, *(int32_t*)qar_peek_front(queue), __func__);
+    ut_equals_int(ut, 1, *(int32_t*)qar_peek_rear(queue), __func__);
+
+    qar_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+}
+
+// A wrapped buffer grows by a fixed step and keeps the order of its elements
+void qar_test_policy(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue = qar_create(interface, 8, 200);
+
+    if (!interface || !queue)
+        goto error;
+
+    ut_equals_bool(ut, true, qar_set_policy(queue, DS_GROWTH_STEP, 8),
+                   __func__);
+    ut_equals_int(ut, DS_GROWTH_STEP, qar_policy(queue), __func__);
+
+    void *element;
+    int32_t next = 0, expected = 0;
+    bool ordered = true;
+
+    // Wraps the rear index around before each growth
+    for (int i = 0; i < 6; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(next++)))
+            goto error;
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        qar_dequeue(queue, &element);
+        ordered = ordered && *(int32_t*)element == expected++;
+        free(element);
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(next++)))
+            goto error;
+    }
+
+    // 8, 16, 24
+    ut_equals_integer_t(ut, 24, qar_capacity(queue), __func__);
+
+    while (qar_dequeue(queue, &element))
+    {
+        ordered = ordered && *(int32_t*)element == expected++;
+        free(element);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_int(ut, next, expected, __func__);
+
+    qar_free(queue);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qar_free(queue);
+    if (interface) interface_free(interface);
+}
+
+// Moves elements between queues without copying them
+void qar_test_move(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    QueueArray_t *queue1 = qar_create(interface, 4, 200);
+    QueueArray_t *queue2 = qar_create(interface, 8, 200);
+
+    if (!interface || !queue1 || !queue2)
+        goto error;
+
+    void *element;
+
+    // queue2 wraps around its buffer
+    for (int32_t i = 0; i < 6; i++)
+    {
+        if (!qar_enqueue(queue2, new_int32_t(i)))
+            goto error;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        qar_dequeue(queue2, &element);
+        free(element);
+
+        if (!qar_enqueue(queue2, new_int32_t(i + 6)))
+            goto error;
+    }
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        if (!qar_enqueue(queue1, new_int32_t(i + 100)))
+            goto error;
+    }
+
+    void *first = qar_peek_front(queue2);
+
+    ut_equals_bool(ut, false, qar_append(queue1, queue1), __func__);
+    ut_equals_bool(ut, true, qar_append(queue1, queue2), __func__);
+    ut_equals_bool(ut, true, qar_empty(queue2), __func__);
+    ut_equals_integer_t(ut, 8, qar_count(queue1), __func__);
+
+    integer_t length;
+    void **array = qar_to_array_move(queue1, &length);
+
+    if (!array)
+        goto error;
+
+    ut_equals_bool(ut, true, qar_empty(queue1), __func__);
+    ut_equals_integer_t(ut, 8, length, __func__);
+
+    // The same pointers, in order
+    ut_equals_bool(ut, true, array[2] == first, __func__);
+
+    bool ordered = *(int32_t*)array[0] == 100 && *(int32_t*)array[1] == 101;
+
+    for (integer_t i = 2; i < length; i++)
+        ordered = ordered && *(int32_t*)array[i] == (int32_t)i + 2;
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    for (integer_t i = 0; i < length; i++)
+        free(array[i]);
+
+    free(array);
+
+    ut_equals_bool(ut, true, qar_to_array_move(queue1, &length) == NULL,
+                   __func__);
+
+    qar_free(queue1);
+    qar_free(queue2);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue1) qar_free(queue1);
+    if (queue2) qar_free(queue2);
+    if (interface) interface_free(interface);
+}
+
 // Runs all QueueArray tests
 Status QueueArrayTests(void)
 {
@@ -283,6 +789,13 @@ Status QueueArrayTests(void)
     qar_test_locked(ut);
     qar_test_intensive(ut);
     qar_test_growth(ut);
+    qar_test_segmented(ut);
+    qar_test_shrink(ut);
+    qar_test_span(ut);
+    qar_test_batch(ut);
+    qar_test_batch_segments(ut);
+    qar_test_policy(ut);
+    qar_test_move(ut);
 
     ut_report(ut, "QueueArray");
 
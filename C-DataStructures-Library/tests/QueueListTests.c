@@ -97,6 +97,157 @@ void qli_test_foreach(UnitTest ut)
     qli_erase(queue);
 }
 
+// Nodes holding many elements behave like single element nodes
+void qli_test_chunk(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueList_t *queue = qli_new(&int_interface), *copy = NULL;
+
+    if (!queue)
+        goto error;
+
+    if (!qli_set_chunk(queue, 7))
+        goto error;
+
+    ut_equals_bool(ut, false, qli_set_chunk(queue, 0), __func__);
+    ut_equals_integer_t(ut, 7, qli_chunk(queue), __func__);
+
+    // The front and rear move through many nodes
+    int32_t next_in = 0, next_out = 0;
+    bool failed = false;
+
+    for (int i = 0; i < 200; i++)
+    {
+        for (int j = 0; j < i % 13; j++)
+        {
+            if (!qli_enqueue(queue, new_int32_t(next_in++)))
+                goto error;
+        }
+
+        for (int j = 0; j < i % 11 && !qli_empty(queue); j++)
+        {
+            void *result;
+
+            if (!qli_dequeue(queue, &result))
+                goto error;
+
+            if (*(int32_t*)result != next_out++)
+                failed = true;
+
+            free(result);
+        }
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, next_in - next_out, qli_count(queue), __func__);
+    ut_equals_int(ut, next_out, *(int32_t*)qli_peek_front(queue), __func__);
+    ut_equals_int(ut, next_in - 1, *(int32_t*)qli_peek_rear(queue), __func__);
+    ut_equals_bool(ut, true, qli_contains(queue, &(int32_t){next_in - 1}),
+                   __func__);
+    ut_equals_bool(ut, false, qli_contains(queue, &(int32_t){next_out - 1}),
+                   __func__);
+
+    copy = qli_copy(queue);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_int(ut, 0, qli_compare(queue, copy), __func__);
+
+    // The iterator visits every element in order
+    QueueListIterator_t *iter = qli_iter_new(copy);
+
+    if (!iter)
+        goto error;
+
+    int32_t expected = next_out;
+
+    do
+    {
+        if (*(int32_t*)qli_iter_peek(iter) != expected++)
+            failed = true;
+    } while (qli_iter_next(iter));
+
+    qli_iter_free(iter);
+
+    ut_equals_int(ut, next_in, expected, __func__);
+    ut_equals_bool(ut, false, failed, __func__);
+
+    qli_free(queue);
+    qli_free(copy);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qli_free(queue);
+    if (copy) qli_free(copy);
+}
+
+// Moves the elements across chunks to an array and reuses the queue
+void qli_test_move(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QueueList_t *queue = qli_new(&int_interface);
+
+    if (!queue || !qli_set_chunk(queue, 4))
+        goto error;
+
+    void *element;
+
+    for (int32_t i = 0; i < 23; i++)
+    {
+        if (!qli_enqueue(queue, new_int32_t(i)))
+            goto error;
+    }
+
+    qli_dequeue(queue, &element);
+    free(element);
+
+    integer_t length;
+    void **array = qli_to_array_move(queue, &length);
+
+    if (!array)
+        goto error;
+
+    ut_equals_bool(ut, true, qli_empty(queue), __func__);
+    ut_equals_integer_t(ut, 22, length, __func__);
+
+    bool ordered = true;
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        ordered = ordered && *(int32_t*)array[i] == (int32_t)i + 1;
+
+        free(array[i]);
+    }
+
+    free(array);
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    if (!qli_enqueue(queue, new_int32_t(7)))
+        goto error;
+
+    ut_equals_int(ut, 7, *(int32_t*)qli_peek_front(queue), __func__);
+
+    qli_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qli_free(queue);
+}
+
 // Runs all QueueList tests
 Status QueueListTests(void)
 {
@@ -109,6 +260,8 @@ Status QueueListTests(void)
 
     qli_test_limit(ut);
     qli_test_foreach(ut);
+    qli_test_chunk(ut);
+    qli_test_move(ut);
 
     ut_report(ut, "QueueList");
 
@@ -0,0 +1,273 @@
+/**
+ * @file QueueMPMCTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "QueueMPMC.h"
+#include "UnitTest.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Amount of threads on each side and of values sent by each producer
+#define QMP_TEST_THREADS 4
+#define QMP_TEST_VALUES 100000
+
+// Shared by the producers and consumers of qmp_test_threads
+struct QueueMPMCTest_s
+{
+    QueueMPMC_t *queue;
+    _Atomic(integer_t) *remaining;
+    integer_t id;
+    integer_t received;
+    unsigned_t sum;
+    bool ordered;
+};
+
+// Sends id * QMP_TEST_VALUES + 1 to (id + 1) * QMP_TEST_VALUES in order
+static void *
+qmp_test_producer(void *argument)
+{
+    struct QueueMPMCTest_s *test = argument;
+
+    void *batch[8];
+
+    integer_t value = test->id * QMP_TEST_VALUES + 1;
+    integer_t last = (test->id + 1) * QMP_TEST_VALUES;
+
+    while (value <= last)
+    {
+        if (test->id % 2 == 0)
+        {
+            integer_t size = 0;
+
+            while (size < 8 && value + size <= last)
+            {
+                batch[size] = (void*)(intptr_t)(value + size);
+                size++;
+            }
+
+            value += qmp_enqueue_batch(test->queue, batch, size);
+        }
+        else if (qmp_try_enqueue(test->queue, (void*)(intptr_t)value))
+        {
+            value++;
+        }
+    }
+
+    return NULL;
+}
+
+// Receives values until all of them were received, checking that the values
+// of each producer come in order
+static void *
+qmp_test_consumer(void *argument)
+{
+    struct QueueMPMCTest_s *test = argument;
+
+    integer_t previous[QMP_TEST_THREADS] = { 0 };
+
+    void *batch[8];
+
+    while (atomic_load(test->remaining) > 0)
+    {
+        integer_t size = test->id % 2 == 0
+                         ? qmp_dequeue_batch(test->queue, batch, 8)
+                         : qmp_dequeue_batch(test->queue, batch, 1);
+
+        for (integer_t i = 0; i < size; i++)
+        {
+            integer_t value = (integer_t)(intptr_t)batch[i];
+
+            integer_t producer = (value - 1) / QMP_TEST_VALUES;
+
+            if (value <= previous[producer])
+                test->ordered = false;
+
+            previous[producer] = value;
+
+            test->received++;
+            test->sum += (unsigned_t)value;
+        }
+
+        atomic_fetch_sub(test->remaining, size);
+    }
+
+    return NULL;
+}
+
+// Single-threaded behavior of an empty, full and wrapped queue
+void qmp_test_try(UnitTest ut)
+{
+    QueueMPMC_t *queue = qmp_new(1);
+
+    if (!queue)
+        goto error;
+
+    ut_equals_bool(ut, true, qmp_new(-3) == NULL, __func__);
+    ut_equals_integer_t(ut, 2, qmp_capacity(queue), __func__);
+
+    qmp_free(queue);
+
+    queue = qmp_new(8);
+
+    if (!queue)
+        goto error;
+
+    void *result = NULL;
+
+    ut_equals_bool(ut, false, qmp_try_dequeue(queue, &result), __func__);
+
+    bool ordered = true;
+
+    for (intptr_t round = 0; round < 5; round++)
+    {
+        for (intptr_t i = 0; i < 8; i++)
+        {
+            if (!qmp_try_enqueue(queue, (void*)(round * 8 + i)))
+                goto error;
+        }
+
+        ut_equals_bool(ut, true, qmp_full(queue), __func__);
+        ut_equals_bool(ut, false, qmp_try_enqueue(queue, NULL), __func__);
+
+        for (intptr_t i = 0; i < 8; i++)
+        {
+            if (!qmp_try_dequeue(queue, &result))
+                goto error;
+
+            if ((intptr_t)result != round * 8 + i)
+                ordered = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, qmp_empty(queue), __func__);
+
+    void *elements[10], *results[10];
+
+    for (intptr_t i = 0; i < 10; i++)
+        elements[i] = (void*)i;
+
+    ut_equals_integer_t(ut, 3, qmp_enqueue_batch(queue, elements, 3), __func__);
+    ut_equals_integer_t(ut, 5, qmp_enqueue_batch(queue, elements + 3, 10),
+                        __func__);
+    ut_equals_integer_t(ut, 8, qmp_count(queue), __func__);
+    ut_equals_integer_t(ut, 8, qmp_dequeue_batch(queue, results, 10),
+                        __func__);
+    ut_equals_integer_t(ut, 0, qmp_dequeue_batch(queue, results, 10),
+                        __func__);
+
+    ordered = true;
+
+    for (intptr_t i = 0; i < 8; i++)
+    {
+        if ((intptr_t)results[i] != i)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    // Nothing races a single thread
+    ut_equals_unsigned_t(ut, 0, qmp_retries(queue), __func__);
+
+    qmp_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qmp_free(queue);
+}
+
+// Many producers and consumers exchange every value exactly once
+void qmp_test_threads(UnitTest ut)
+{
+    QueueMPMC_t *queue = qmp_new(128);
+
+    if (!queue)
+        goto error;
+
+    integer_t total = QMP_TEST_THREADS * QMP_TEST_VALUES;
+
+    _Atomic(integer_t) remaining = total;
+
+    struct QueueMPMCTest_s producers[QMP_TEST_THREADS];
+    struct QueueMPMCTest_s consumers[QMP_TEST_THREADS];
+
+    pthread_t producer_threads[QMP_TEST_THREADS];
+    pthread_t consumer_threads[QMP_TEST_THREADS];
+
+    for (integer_t i = 0; i < QMP_TEST_THREADS; i++)
+    {
+        producers[i] = (struct QueueMPMCTest_s){ queue, &remaining, i,
+                                                 0, 0, true };
+        consumers[i] = (struct QueueMPMCTest_s){ queue, &remaining, i,
+                                                 0, 0, true };
+
+        pthread_create(&producer_threads[i], NULL, qmp_test_producer,
+                       &producers[i]);
+        pthread_create(&consumer_threads[i], NULL, qmp_test_consumer,
+                       &consumers[i]);
+    }
+
+    for (integer_t i = 0; i < QMP_TEST_THREADS; i++)
+        pthread_join(producer_threads[i], NULL);
+
+    integer_t received = 0;
+    unsigned_t sum = 0;
+    bool ordered = true;
+
+    for (integer_t i = 0; i < QMP_TEST_THREADS; i++)
+    {
+        pthread_join(consumer_threads[i], NULL);
+
+        received += consumers[i].received;
+        sum += consumers[i].sum;
+        ordered = ordered && consumers[i].ordered;
+    }
+
+    ut_equals_integer_t(ut, total, received, __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)total * (unsigned_t)(total + 1) / 2,
+                         sum, __func__);
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, qmp_empty(queue), __func__);
+
+    qmp_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qmp_free(queue);
+}
+
+// Runs all QueueMPMC tests
+Status QueueMPMCTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    qmp_test_try(ut);
+    qmp_test_threads(ut);
+
+    ut_report(ut, "QueueMPMC");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "QueueMPMC");
+    ut_delete(&ut);
+    return st;
+}
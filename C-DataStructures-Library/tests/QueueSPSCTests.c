@@ -0,0 +1,195 @@
+/**
+ * @file QueueSPSCTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "QueueSPSC.h"
+#include "UnitTest.h"
+#include <pthread.h>
+
+// Amount of elements sent from the producer to the consumer
+static const integer_t qsp_test_total = 1000000;
+
+// Sends the values 1 to qsp_test_total, alternating single and batch calls
+static void *
+qsp_test_producer(void *argument)
+{
+    QueueSPSC_t *queue = argument;
+
+    void *batch[16];
+
+    integer_t value = 1;
+
+    while (value <= qsp_test_total)
+    {
+        if (value % 3 == 0)
+        {
+            integer_t size = 0;
+
+            while (size < 16 && value + size <= qsp_test_total)
+            {
+                batch[size] = (void*)(intptr_t)(value + size);
+                size++;
+            }
+
+            value += qsp_enqueue_batch(queue, batch, size);
+        }
+        else if (qsp_try_enqueue(queue, (void*)(intptr_t)value))
+        {
+            value++;
+        }
+    }
+
+    return NULL;
+}
+
+// Single-threaded behavior of an empty, full and wrapped queue
+void qsp_test_try(UnitTest ut)
+{
+    QueueSPSC_t *queue = qsp_new(5);
+
+    if (!queue)
+        goto error;
+
+    ut_equals_bool(ut, true, qsp_new(0) == NULL, __func__);
+    ut_equals_integer_t(ut, 8, qsp_capacity(queue), __func__);
+    ut_equals_bool(ut, true, qsp_empty(queue), __func__);
+
+    void *result = NULL;
+
+    ut_equals_bool(ut, false, qsp_try_dequeue(queue, &result), __func__);
+
+    bool ordered = true;
+
+    // Goes around the buffer a few times
+    for (intptr_t round = 0; round < 5; round++)
+    {
+        for (intptr_t i = 0; i < 8; i++)
+        {
+            if (!qsp_try_enqueue(queue, (void*)(round * 8 + i)))
+                goto error;
+        }
+
+        ut_equals_bool(ut, true, qsp_full(queue), __func__);
+        ut_equals_bool(ut, false, qsp_try_enqueue(queue, NULL), __func__);
+
+        for (intptr_t i = 0; i < 8; i++)
+        {
+            if (!qsp_try_dequeue(queue, &result))
+                goto error;
+
+            if ((intptr_t)result != round * 8 + i)
+                ordered = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, qsp_empty(queue), __func__);
+
+    // Batches are cut to the free space and to the available elements
+    void *elements[10], *results[10];
+
+    for (intptr_t i = 0; i < 10; i++)
+        elements[i] = (void*)i;
+
+    ut_equals_integer_t(ut, 3, qsp_enqueue_batch(queue, elements, 3), __func__);
+    ut_equals_integer_t(ut, 5, qsp_enqueue_batch(queue, elements + 3, 10),
+                        __func__);
+    ut_equals_integer_t(ut, 8, qsp_count(queue), __func__);
+    ut_equals_integer_t(ut, 8, qsp_dequeue_batch(queue, results, 10),
+                        __func__);
+    ut_equals_integer_t(ut, 0, qsp_dequeue_batch(queue, results, 10),
+                        __func__);
+
+    ordered = true;
+
+    for (intptr_t i = 0; i < 8; i++)
+    {
+        if ((intptr_t)results[i] != i)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    qsp_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qsp_free(queue);
+}
+
+// A producer thread sends values to the consumer in order
+void qsp_test_threads(UnitTest ut)
+{
+    QueueSPSC_t *queue = qsp_new(64);
+
+    if (!queue)
+        goto error;
+
+    pthread_t producer;
+
+    if (pthread_create(&producer, NULL, qsp_test_producer, queue) != 0)
+        goto error;
+
+    void *batch[16];
+
+    integer_t expected = 1;
+    bool ordered = true;
+
+    while (expected <= qsp_test_total)
+    {
+        integer_t size = qsp_dequeue_batch(queue, batch, expected % 2 ? 16 : 1);
+
+        for (integer_t i = 0; i < size; i++)
+        {
+            if ((integer_t)(intptr_t)batch[i] != expected++)
+                ordered = false;
+        }
+    }
+
+    pthread_join(producer, NULL);
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, qsp_empty(queue), __func__);
+
+    qsp_free(queue);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (queue) qsp_free(queue);
+}
+
+// Runs all QueueSPSC tests
+Status QueueSPSCTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    qsp_test_try(ut);
+    qsp_test_threads(ut);
+
+    ut_report(ut, "QueueSPSC");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "QueueSPSC");
+    ut_delete(&ut);
+    return st;
+}
@@ -9,6 +9,7 @@
 #include "RedBlackTree.h"
 #include "UnitTest.h"
 #include "Utility.h"
+#include <pthread.h>
 
 void rbt_test_IO0(UnitTest ut)
 {
@@ -258,6 +259,1288 @@ void rbt_test_IO3(UnitTest ut)
     ut_error();
 }
 
+// State of rbt_test_visit
+struct RedBlackTreeTest_s
+{
+    int64_t previous;
+    integer_t count;
+    bool ordered;
+};
+
+// Checks that elements are visited in strictly ascending order
+static void
+rbt_test_visit(void *element, void *argument)
+{
+    struct RedBlackTreeTest_s *test = argument;
+
+    int64_t value = *(int64_t*)element;
+
+    if (test->count > 0 && value <= test->previous)
+        test->ordered = false;
+
+    test->previous = value;
+    test->count++;
+}
+
+// Tests range queries and the bounds and steps of iterators
+void rbt_test_range(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = rbt_new(interface);
+
+    RedBlackTreeIterator_t *iter = NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    iter = rbt_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t key = 0;
+
+    ut_equals_bool(ut, true, rbt_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, rbt_iter_to_start(iter), __func__);
+    ut_equals_bool(ut, false, rbt_iter_lower_bound(iter, &key), __func__);
+
+    // Shuffled insertion of the even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t((i * 337) % 1000 * 2)))
+            goto error;
+    }
+
+    int64_t low = 101, high = 300;
+
+    struct RedBlackTreeTest_s test = { 0, 0, true };
+
+    ut_equals_integer_t(ut, 100, rbt_range(tree, &low, &high, rbt_test_visit,
+                                           &test), __func__);
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_int(ut, 300, (int)test.previous, __func__);
+    ut_equals_integer_t(ut, 0, rbt_range(tree, &high, &low, rbt_test_visit,
+                                         &test), __func__);
+
+    // Bounds
+    ut_equals_bool(ut, true, rbt_iter_lower_bound(iter, &low), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+
+    key = 102;
+
+    ut_equals_bool(ut, true, rbt_iter_lower_bound(iter, &key), __func__);
+    ut_equals_int(ut, 102, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, rbt_iter_upper_bound(iter, &key), __func__);
+    ut_equals_int(ut, 104, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, rbt_iter_prev(iter), __func__);
+    ut_equals_bool(ut, true, rbt_iter_prev(iter), __func__);
+    ut_equals_int(ut, 100, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+
+    key = 1990;
+
+    rbt_iter_lower_bound(iter, &key);
+
+    integer_t count = 1;
+
+    while (rbt_iter_next(iter))
+        count++;
+
+    ut_equals_integer_t(ut, 5, count, __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+    ut_equals_bool(ut, false, rbt_iter_has_next(iter), __func__);
+
+    key = 1998;
+
+    ut_equals_bool(ut, false, rbt_iter_upper_bound(iter, &key), __func__);
+    ut_equals_bool(ut, true, rbt_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, rbt_iter_next(iter), __func__);
+
+    // Full backwards iteration
+    ut_equals_bool(ut, true, rbt_iter_to_end(iter), __func__);
+
+    bool ordered = true;
+    int64_t expected = 1998;
+
+    count = 0;
+
+    do
+    {
+        if (*(int64_t*)rbt_iter_peek(iter) != expected)
+            ordered = false;
+
+        expected -= 2;
+        count++;
+    }
+    while (rbt_iter_prev(iter));
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 1000, count, __func__);
+    ut_equals_bool(ut, false, rbt_iter_has_prev(iter), __func__);
+
+    // The iterator stops working after a modification
+    if (!rbt_insert(tree, new_int64_t(-1)))
+        goto error;
+
+    ut_equals_bool(ut, true, rbt_iter_peek(iter) == NULL, __func__);
+    ut_equals_bool(ut, false, rbt_iter_next(iter), __func__);
+    ut_equals_bool(ut, true, rbt_iter_to_start(iter), __func__);
+    ut_equals_int(ut, -1, (int)*(int64_t*)rbt_iter_peek(iter), __func__);
+
+    rbt_iter_free(iter);
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) rbt_iter_free(iter);
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Tests select and rank while elements are inserted and removed
+void rbt_test_rank(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = rbt_new(interface);
+
+    static bool present[2000];
+
+    if (!interface || !tree)
+        goto error;
+
+    int64_t key = 0;
+
+    ut_equals_bool(ut, true, rbt_select(tree, 0) == NULL, __func__);
+    ut_equals_integer_t(ut, -1, rbt_rank(tree, &key), __func__);
+
+    // Sizes are computed when the tree becomes ranked
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t((i * 337) % 1000)))
+            goto error;
+    }
+
+    rbt_set_ranked(tree, true);
+
+    ut_equals_bool(ut, true, rbt_ranked(tree), __func__);
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (*(int64_t*)rbt_select(tree, i) != i || rbt_rank(tree, &i) != i)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_bool(ut, true, rbt_select(tree, 1000) == NULL, __func__);
+    ut_equals_bool(ut, true, rbt_select(tree, -1) == NULL, __func__);
+
+    key = -5;
+
+    ut_equals_integer_t(ut, 0, rbt_rank(tree, &key), __func__);
+
+    key = 5000;
+
+    ut_equals_integer_t(ut, 1000, rbt_rank(tree, &key), __func__);
+
+    // Random changes checked against a sorted boolean array
+    for (int64_t i = 0; i < 2000; i++)
+        present[i] = i < 1000;
+
+    srand(7);
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        key = rand() % 2000;
+
+        if (rand() % 2)
+        {
+            void *element = new_int64_t(key);
+
+            if (!rbt_insert(tree, element))
+                free(element);
+
+            present[key] = true;
+        }
+        else
+        {
+            rbt_remove(tree, &key);
+
+            present[key] = false;
+        }
+    }
+
+    integer_t rank = 0;
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        if (rbt_rank(tree, &i) != rank)
+            correct = false;
+
+        if (present[i])
+        {
+            void *element = rbt_select(tree, rank);
+
+            if (!element || *(int64_t*)element != i)
+                correct = false;
+
+            rank++;
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, rbt_size(tree), rank, __func__);
+
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Tests building from a sorted buffer and inserting batches
+void rbt_test_bulk(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    void **elements = malloc(sizeof(void*) * 1200);
+
+    RedBlackTree_t *tree = NULL;
+
+    RedBlackTreeIterator_t *iter = NULL;
+
+    if (!interface || !elements)
+        goto error;
+
+    // Even numbers from 0 to 1998
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t(i * 2);
+
+    void *swap = elements[0];
+    elements[0] = elements[1];
+    elements[1] = swap;
+
+    ut_equals_bool(ut, true, rbt_from_sorted_array(interface, elements, 1000)
+                             == NULL, __func__);
+
+    elements[1] = elements[0];
+    elements[0] = swap;
+
+    tree = rbt_from_sorted_array(interface, elements, 1000);
+
+    if (!tree)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, rbt_size(tree), __func__);
+    ut_equals_int(ut, 0, (int)*(int64_t*)rbt_min(tree), __func__);
+    ut_equals_int(ut, 1998, (int)*(int64_t*)rbt_max(tree), __func__);
+
+    // Odd numbers from 1 to 1999, shuffled, with 200 duplicates
+    for (int64_t i = 0; i < 1000; i++)
+        elements[i] = new_int64_t((i * 337) % 1000 * 2 + 1);
+
+    for (int64_t i = 1000; i < 1200; i++)
+        elements[i] = new_int64_t(i % 2 == 0 ? i : i - 999);
+
+    integer_t total = rbt_insert_all(tree, elements, 1200);
+
+    ut_equals_integer_t(ut, 1000, total, __func__);
+    ut_equals_integer_t(ut, 2000, rbt_size(tree), __func__);
+
+    bool correct = true;
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        if (*(int64_t*)elements[i] != i * 2 + 1)
+            correct = false;
+    }
+
+    for (integer_t i = total; i < 1200; i++)
+        free(elements[i]);
+
+    // A small batch, where the second element is already in the tree
+    elements[0] = new_int64_t(-1);
+    elements[1] = new_int64_t(1000);
+    elements[2] = new_int64_t(2000);
+
+    ut_equals_integer_t(ut, 2, rbt_insert_all(tree, elements, 3), __func__);
+    ut_equals_int(ut, 1000, (int)*(int64_t*)elements[2], __func__);
+
+    free(elements[2]);
+
+    iter = rbt_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    int64_t expected = -1;
+
+    do
+    {
+        if (*(int64_t*)rbt_iter_peek(iter) != expected++)
+            correct = false;
+    }
+    while (rbt_iter_next(iter));
+
+    ut_equals_bool(ut, true, correct && expected == 2001, __func__);
+
+    // The rebuilt tree still supports removals
+    for (int64_t i = -1; i <= 2000; i += 3)
+    {
+        if (!rbt_remove(tree, &i))
+            correct = false;
+    }
+
+    for (int64_t i = -1; i <= 2000; i++)
+    {
+        if (rbt_contains(tree, &i) != ((i + 1) % 3 != 0))
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    rbt_iter_free(iter);
+    rbt_free(tree);
+    free(elements);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) rbt_iter_free(iter);
+    if (tree) rbt_free(tree);
+    free(elements);
+    if (interface) interface_free(interface);
+}
+
+// Tests union, intersection, difference, split and join with and without
+// subtree sizes
+void rbt_test_set_operations(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree1 = NULL, *tree2 = NULL, *tree3 = NULL;
+
+    if (!interface)
+        goto error;
+
+    bool correct = true;
+
+    for (int ranked = 0; ranked < 2; ranked++)
+    {
+        tree1 = rbt_new(interface);
+        tree2 = rbt_new(interface);
+
+        if (!tree1 || !tree2)
+            goto error;
+
+        rbt_set_ranked(tree1, ranked);
+
+        // Multiples of 2 below 2000 and multiples of 3 below 3000
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            if (!rbt_insert(tree1, new_int64_t(i * 2))
+                || !rbt_insert(tree2, new_int64_t(i * 3)))
+                goto error;
+        }
+
+        rbt_intersection(tree1, tree2);
+
+        ut_equals_integer_t(ut, 334, rbt_size(tree1), __func__);
+        ut_equals_integer_t(ut, 1000, rbt_size(tree2), __func__);
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            if (rbt_contains(tree1, &i) != (i % 6 == 0 && i < 2000))
+                correct = false;
+        }
+
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            void *element = new_int64_t(i * 2);
+
+            if (!rbt_insert(tree1, element))
+                free(element);
+        }
+
+        rbt_difference(tree1, tree2);
+
+        ut_equals_integer_t(ut, 666, rbt_size(tree1), __func__);
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            if (rbt_contains(tree1, &i) != (i % 2 == 0 && i % 3 != 0
+                                            && i < 2000))
+                correct = false;
+        }
+
+        for (int64_t i = 0; i < 1000; i++)
+        {
+            void *element = new_int64_t(i * 2);
+
+            if (!rbt_insert(tree1, element))
+                free(element);
+        }
+
+        ut_equals_bool(ut, true, rbt_union(tree1, tree2), __func__);
+        ut_equals_integer_t(ut, 1666, rbt_size(tree1), __func__);
+        ut_equals_bool(ut, true, rbt_empty(tree2), __func__);
+
+        integer_t rank = 0;
+
+        for (int64_t i = 0; i < 3000; i++)
+        {
+            bool expected = (i % 2 == 0 && i < 2000) || i % 3 == 0;
+
+            if (rbt_contains(tree1, &i) != expected)
+                correct = false;
+
+            if (ranked && expected
+                && *(int64_t*)rbt_select(tree1, rank++) != i)
+                correct = false;
+        }
+
+        // Split at an element that is not in the tree
+        int64_t key = 1001;
+
+        tree3 = rbt_split(tree1, &key);
+
+        if (!tree3)
+            goto error;
+
+        ut_equals_integer_t(ut, 668, rbt_size(tree1), __func__);
+        ut_equals_integer_t(ut, 998, rbt_size(tree3), __func__);
+        ut_equals_int(ut, 1000, (int)*(int64_t*)rbt_max(tree1), __func__);
+        ut_equals_int(ut, 1002, (int)*(int64_t*)rbt_min(tree3), __func__);
+
+        ut_equals_bool(ut, false, rbt_join(tree3, tree1), __func__);
+        ut_equals_bool(ut, true, rbt_join(tree1, tree3), __func__);
+        ut_equals_integer_t(ut, 1666, rbt_size(tree1), __func__);
+        ut_equals_bool(ut, true, rbt_empty(tree3), __func__);
+
+        if (ranked)
+        {
+            key = 1002;
+
+            ut_equals_integer_t(ut, 668, rbt_rank(tree1, &key), __func__);
+        }
+
+        rbt_free(tree1);
+        rbt_free(tree2);
+        rbt_free(tree3);
+
+        tree1 = tree2 = tree3 = NULL;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree1) rbt_free(tree1);
+    if (tree2) rbt_free(tree2);
+    if (tree3) rbt_free(tree3);
+    if (interface) interface_free(interface);
+}
+
+// Checks the operation counters, which are only kept with DS_STATS
+void rbt_test_stats(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = rbt_new(interface);
+
+    if (!interface || !tree)
+        goto error;
+
+    // Sorted insertions always rotate
+    for (integer_t i = 0; i < 1000; i++)
+    {
+        void *element = new_int64_t(i);
+
+        if (!rbt_insert(tree, element))
+        {
+            free(element);
+            goto error;
+        }
+    }
+
+    for (integer_t i = 0; i < 100; i++)
+    {
+        void *key = new_int64_t(i);
+
+        bool removed = rbt_remove(tree, key);
+
+        free(key);
+
+        if (!removed)
+            goto error;
+    }
+
+    ContainerStats_t stats;
+
+    if (rbt_stats(tree, &stats))
+    {
+        ut_equals_bool(ut, true, stats.compares > 0, __func__);
+        ut_equals_bool(ut, true, stats.rotations > 0, __func__);
+        ut_equals_bool(ut, true, stats.bytes > 0, __func__);
+        ut_equals_integer_t(ut, 1001, (integer_t)stats.allocations, __func__);
+        ut_equals_integer_t(ut, 100, (integer_t)stats.frees, __func__);
+    }
+    else
+    {
+        ut_equals_bool(ut, true, stats.compares == 0 && stats.rotations == 0
+                                 && stats.bytes == 0 && stats.frees == 0,
+                       __func__);
+    }
+
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Saves a ranked tree to a snapshot and restores it
+void rbt_test_snapshot(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = rbt_new(interface);
+    RedBlackTree_t *restored = NULL;
+
+    FILE *stream = tmpfile();
+
+    if (!interface || !tree || !stream)
+        goto error;
+
+    interface_serializer(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t((i * 337) % 1000)))
+            goto error;
+    }
+
+    rbt_set_ranked(tree, true);
+
+    ut_equals_bool(ut, true, rbt_save(tree, stream), __func__);
+
+    rewind(stream);
+
+    restored = rbt_restore(interface, stream);
+
+    if (!restored)
+        goto error;
+
+    ut_equals_integer_t(ut, 1000, rbt_size(restored), __func__);
+    ut_equals_bool(ut, true, rbt_ranked(restored), __func__);
+
+    bool equal = true;
+
+    for (int64_t i = 0; equal && i < 1000; i++)
+        equal = *(int64_t *)rbt_select(restored, i) == i;
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    // Restoring from the end of the stream fails
+    ut_equals_bool(ut, true, rbt_restore(interface, stream) == NULL,
+                   __func__);
+
+    fclose(stream);
+    rbt_free(restored);
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stream) fclose(stream);
+    if (restored) rbt_free(restored);
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Values of rbt_test_persistent and window of rbt_test_persistent_threads
+#define RBT_TEST_VALUES 600
+#define RBT_TEST_WINDOW 500
+
+// A snapshot and the elements the tree had when it was taken
+struct RedBlackTreeTestVersion_s
+{
+    RedBlackTreeSnapshot_t *snapshot;
+    bool present[RBT_TEST_VALUES];
+};
+
+// Checks that a snapshot still has exactly the elements it was taken with
+static bool
+rbt_test_version(struct RedBlackTreeTestVersion_s *version)
+{
+    integer_t size = 0;
+
+    for (int64_t i = 0; i < RBT_TEST_VALUES; i++)
+    {
+        if (rbt_snapshot_contains(version->snapshot, &i)
+            != version->present[i])
+            return false;
+
+        size += version->present[i];
+    }
+
+    struct RedBlackTreeTest_s test = { 0, 0, true };
+
+    integer_t visited = rbt_snapshot_range(version->snapshot,
+                                           &(int64_t){ 0 },
+                                           &(int64_t){ RBT_TEST_VALUES },
+                                           rbt_test_visit, &test);
+
+    return test.ordered && visited == size
+           && rbt_snapshot_size(version->snapshot) == size;
+}
+
+// Snapshots keep their elements while the tree keeps changing, operations
+// that need parent pointers refuse persistent trees and the tree works as
+// before once persistence is turned off
+void rbt_test_persistent(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    RedBlackTreeIterator_t *iter = NULL;
+
+    struct RedBlackTreeTestVersion_s *versions =
+            calloc(4, sizeof(struct RedBlackTreeTestVersion_s));
+
+    bool present[RBT_TEST_VALUES] = { false };
+
+    if (!interface || !tree || !versions)
+        goto error;
+
+    // Nodes of a regular tree are reused
+    for (int64_t i = 0; i < RBT_TEST_VALUES; i += 2)
+    {
+        if (!rbt_insert(tree, new_int64_t(i)))
+            goto error;
+
+        present[i] = true;
+    }
+
+    rbt_set_ranked(tree, true);
+
+    ut_equals_bool(ut, false, rbt_set_persistent(tree, true), __func__);
+
+    rbt_set_ranked(tree, false);
+
+    ut_equals_bool(ut, true, rbt_set_persistent(tree, true), __func__);
+    ut_equals_bool(ut, true, rbt_persistent(tree), __func__);
+
+    iter = rbt_iter_new(tree);
+
+    if (!iter)
+        goto error;
+
+    bool correct = true;
+
+    for (integer_t round = 0; round < 40; round++)
+    {
+        struct RedBlackTreeTestVersion_s *version = &versions[round % 4];
+
+        if (version->snapshot)
+        {
+            correct = correct && rbt_test_version(version);
+            rbt_snapshot_release(version->snapshot);
+        }
+
+        version->snapshot = rbt_snapshot(tree);
+
+        if (!version->snapshot)
+            goto error;
+
+        memcpy(version->present, present, sizeof(present));
+
+        for (integer_t i = 0; i < 60; i++)
+        {
+            int64_t value = rand() % RBT_TEST_VALUES;
+
+            if (present[value])
+            {
+                correct = correct && rbt_remove(tree, &value);
+                present[value] = false;
+            }
+            else
+            {
+                int64_t *element = new_int64_t(value);
+
+                correct = correct && rbt_insert(tree, element);
+                present[value] = true;
+            }
+        }
+
+        // Erasing the tree leaves the snapshots intact
+        if (round == 20)
+        {
+            rbt_erase(tree);
+            memset(present, 0, sizeof(present));
+        }
+
+        for (integer_t i = 0; i < 4; i++)
+        {
+            if (versions[i].snapshot)
+                correct = correct && rbt_test_version(&versions[i]);
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    // Operations that need parent pointers
+    rbt_set_ranked(tree, true);
+
+    ut_equals_bool(ut, false, rbt_ranked(tree), __func__);
+    ut_equals_bool(ut, true, rbt_split(tree, &(int64_t){ 0 }) == NULL,
+                   __func__);
+    ut_equals_bool(ut, false, rbt_iter_to_start(iter)
+                              && rbt_iter_peek(iter) != NULL, __func__);
+    ut_equals_bool(ut, false, rbt_set_persistent(tree, false), __func__);
+
+    for (integer_t i = 0; i < 4; i++)
+        rbt_snapshot_release(versions[i].snapshot);
+
+    ut_equals_bool(ut, true, rbt_set_persistent(tree, false), __func__);
+    ut_equals_bool(ut, true, rbt_snapshot(tree) == NULL, __func__);
+
+    integer_t size = 0;
+
+    for (int64_t i = 0; i < RBT_TEST_VALUES; i++)
+        size += present[i];
+
+    integer_t count = 0;
+
+    if (rbt_iter_to_start(iter))
+    {
+        do
+            count++;
+        while (rbt_iter_next(iter));
+    }
+
+    ut_equals_integer_t(ut, size, count, __func__);
+    ut_equals_integer_t(ut, size, rbt_size(tree), __func__);
+
+    rbt_iter_free(iter);
+    rbt_free(tree);
+    free(versions);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) rbt_iter_free(iter);
+    if (versions)
+    {
+        for (integer_t i = 0; i < 4; i++)
+            if (versions[i].snapshot)
+                rbt_snapshot_release(versions[i].snapshot);
+    }
+    if (tree) rbt_free(tree);
+    free(versions);
+    if (interface) interface_free(interface);
+}
+
+// Hands snapshots from the writer to a reader of rbt_test_persistent_threads
+struct RedBlackTreeTestMailbox_s
+{
+    pthread_mutex_t lock;
+    RedBlackTreeSnapshot_t *snapshot;
+    bool done;
+    integer_t read;
+    bool correct;
+};
+
+// Checks that every snapshot received is a full window of consecutive values
+static void *
+rbt_test_reader(void *argument)
+{
+    struct RedBlackTreeTestMailbox_s *mailbox = argument;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&mailbox->lock);
+
+        RedBlackTreeSnapshot_t *snapshot = mailbox->snapshot;
+        bool done = mailbox->done;
+
+        mailbox->snapshot = NULL;
+
+        pthread_mutex_unlock(&mailbox->lock);
+
+        if (!snapshot)
+        {
+            if (done)
+                return NULL;
+
+            continue;
+        }
+
+        struct RedBlackTreeTest_s test = { 0, 0, true };
+
+        integer_t visited = rbt_snapshot_range(snapshot,
+                                               &(int64_t){ INT64_MIN },
+                                               &(int64_t){ INT64_MAX },
+                                               rbt_test_visit, &test);
+
+        int64_t first = test.previous - RBT_TEST_WINDOW + 1;
+
+        mailbox->correct = mailbox->correct && test.ordered
+                           && visited == RBT_TEST_WINDOW
+                           && rbt_snapshot_size(snapshot) == RBT_TEST_WINDOW
+                           && rbt_snapshot_contains(snapshot, &first)
+                           && !rbt_snapshot_contains(snapshot,
+                                                     &(int64_t){ first - 1 });
+        mailbox->read++;
+
+        rbt_snapshot_release(snapshot);
+    }
+}
+
+// Readers go through snapshots, and release them, while the writer slides a
+// window of values through the tree
+void rbt_test_persistent_threads(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    if (!interface || !tree || !rbt_set_persistent(tree, true))
+        goto error;
+
+    for (int64_t i = 0; i < RBT_TEST_WINDOW; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t(i)))
+            goto error;
+    }
+
+    struct RedBlackTreeTestMailbox_s mailboxes[3];
+    pthread_t threads[3];
+
+    for (integer_t i = 0; i < 3; i++)
+    {
+        mailboxes[i].snapshot = NULL;
+        mailboxes[i].done = false;
+        mailboxes[i].read = 0;
+        mailboxes[i].correct = true;
+
+        pthread_mutex_init(&mailboxes[i].lock, NULL);
+        pthread_create(&threads[i], NULL, rbt_test_reader, &mailboxes[i]);
+    }
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        correct = correct
+                  && rbt_insert(tree, new_int64_t(i + RBT_TEST_WINDOW))
+                  && rbt_remove(tree, &i);
+
+        struct RedBlackTreeTestMailbox_s *mailbox = &mailboxes[i % 3];
+
+        pthread_mutex_lock(&mailbox->lock);
+
+        if (!mailbox->snapshot)
+            mailbox->snapshot = rbt_snapshot(tree);
+
+        pthread_mutex_unlock(&mailbox->lock);
+    }
+
+    integer_t read = 0;
+
+    for (integer_t i = 0; i < 3; i++)
+    {
+        pthread_mutex_lock(&mailboxes[i].lock);
+        mailboxes[i].done = true;
+        pthread_mutex_unlock(&mailboxes[i].lock);
+
+        pthread_join(threads[i], NULL);
+        pthread_mutex_destroy(&mailboxes[i].lock);
+
+        correct = correct && mailboxes[i].correct;
+        read += mailboxes[i].read;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_bool(ut, true, read > 0, __func__);
+    ut_equals_integer_t(ut, RBT_TEST_WINDOW, rbt_size(tree), __func__);
+
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Groups equal elements and checks spans, counts and removals
+void rbt_test_multiple(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    if (!interface || !tree || !rbt_set_multiple_keys(tree, true))
+        goto error;
+
+    void *first[100];
+
+    // Each key is inserted (key % 5) + 1 times
+    for (int64_t i = 0; i < 100; i++)
+    {
+        for (int64_t j = 0; j <= i % 5; j++)
+        {
+            void *element = new_int64_t(i);
+
+            if (!rbt_insert(tree, element))
+            {
+                free(element);
+                goto error;
+            }
+
+            if (j == 0)
+                first[i] = element;
+        }
+    }
+
+    ut_equals_integer_t(ut, 300, rbt_size(tree), __func__);
+    ut_equals_bool(ut, false, rbt_set_multiple_keys(tree, false), __func__);
+    ut_equals_bool(ut, false, rbt_set_persistent(tree, true), __func__);
+
+    rbt_set_ranked(tree, true);
+
+    ut_equals_bool(ut, false, rbt_ranked(tree), __func__);
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        void **elements;
+
+        integer_t count = rbt_get_all(tree, &i, &elements);
+
+        correct = correct && count == i % 5 + 1 && elements[0] == first[i]
+                  && rbt_key_count(tree, &i) == count;
+
+        for (integer_t j = 0; j < count; j++)
+            correct = correct && *(int64_t*)elements[j] == i;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    int64_t low = 10, high = 19;
+
+    struct RedBlackTreeTest_s test = { 0, 0, true };
+
+    ut_equals_integer_t(ut, 30, rbt_range(tree, &low, &high, rbt_test_visit,
+                                          &test), __func__);
+    ut_equals_integer_t(ut, 30, test.count, __func__);
+
+    int64_t key = 4, missing = 100;
+
+    ut_equals_bool(ut, true, rbt_remove(tree, &key), __func__);
+    ut_equals_integer_t(ut, 4, rbt_key_count(tree, &key), __func__);
+    ut_equals_integer_t(ut, 4, rbt_remove_all(tree, &key), __func__);
+    ut_equals_integer_t(ut, 0, rbt_key_count(tree, &key), __func__);
+    ut_equals_integer_t(ut, 0, rbt_remove_all(tree, &missing), __func__);
+    ut_equals_integer_t(ut, 295, rbt_size(tree), __func__);
+
+    // Removing every element one by one leaves the nodes balanced
+    for (int64_t i = 0; i < 100; i++)
+    {
+        while (rbt_remove(tree, &i))
+            continue;
+    }
+
+    ut_equals_bool(ut, true, rbt_empty(tree), __func__);
+
+    for (int64_t i = 0; i < 10; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t(i % 2)))
+            goto error;
+    }
+
+    // Groups left in the tree are freed with it
+    key = 1;
+
+    ut_equals_integer_t(ut, 5, rbt_key_count(tree, &key), __func__);
+    ut_equals_integer_t(ut, 10, rbt_size(tree), __func__);
+
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// A key with a counter, compared only by its key
+struct RedBlackTreeTestCounter_s
+{
+    int64_t key;
+    int64_t count;
+};
+
+static int
+rbt_test_counter_compare(const void *element1, const void *element2)
+{
+    const struct RedBlackTreeTestCounter_s *counter1 = element1, *counter2 = element2;
+
+    return (counter1->key > counter2->key) - (counter1->key < counter2->key);
+}
+
+static void
+rbt_test_counter_merge(void *accumulator, const void *element)
+{
+    ((struct RedBlackTreeTestCounter_s *)accumulator)->count +=
+            ((const struct RedBlackTreeTestCounter_s *)element)->count;
+}
+
+static struct RedBlackTreeTestCounter_s *
+rbt_test_counter_new(int64_t key)
+{
+    struct RedBlackTreeTestCounter_s *counter = malloc(sizeof(struct RedBlackTreeTestCounter_s));
+
+    if (counter)
+    {
+        counter->key = key;
+        counter->count = 1;
+    }
+
+    return counter;
+}
+
+// Aggregates counters with upserts and looks them up with a single descent
+void rbt_test_upsert(UnitTest ut)
+{
+    Interface_t *interface = interface_new(rbt_test_counter_compare, NULL,
+                                           NULL, free, NULL, NULL);
+
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        struct RedBlackTreeTestCounter_s *counter = rbt_test_counter_new(i % 100);
+
+        if (!counter || !rbt_upsert(tree, counter, rbt_test_counter_merge))
+        {
+            free(counter);
+            goto error;
+        }
+    }
+
+    ut_equals_integer_t(ut, 100, rbt_size(tree), __func__);
+
+    struct RedBlackTreeTestCounter_s search = { 42, 0 };
+
+    struct RedBlackTreeTestCounter_s *stored = rbt_get(tree, &search);
+
+    ut_equals_bool(ut, true, stored != NULL && stored->count == 10, __func__);
+
+    search.key = 100;
+
+    ut_equals_bool(ut, true, rbt_get(tree, &search) == NULL, __func__);
+
+    // An equal element is found and the new one is left to the caller
+    struct RedBlackTreeTestCounter_s *counter = rbt_test_counter_new(42);
+    void *existing = NULL;
+
+    if (!counter)
+        goto error;
+
+    ut_equals_bool(ut, false, rbt_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    // A full tree still finds its elements
+    rbt_set_limit(tree, 100);
+
+    ut_equals_bool(ut, false, rbt_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == stored, __func__);
+
+    counter->key = 100;
+
+    ut_equals_bool(ut, false, rbt_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == NULL, __func__);
+
+    rbt_set_limit(tree, 0);
+
+    ut_equals_bool(ut, true, rbt_find_or_insert(tree, counter, &existing),
+                   __func__);
+    ut_equals_bool(ut, true, existing == counter, __func__);
+    ut_equals_integer_t(ut, 101, rbt_size(tree), __func__);
+
+    rbt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Records the visited elements
+struct RedBlackTreeTestRecord_s
+{
+    int64_t elements[16];
+    integer_t count;
+};
+
+static void
+rbt_test_record(void *element, void *argument)
+{
+    struct RedBlackTreeTestRecord_s *record = argument;
+
+    if (record->count < 16)
+        record->elements[record->count] = *(int64_t*)element;
+
+    record->count++;
+}
+
+// Checks the elements recorded by a traversal
+static bool
+rbt_test_recorded(RedBlackTree_t *tree, int traversal_mode, const int64_t *expected,
+                   integer_t count)
+{
+    struct RedBlackTreeTestRecord_s record = { { 0 }, 0 };
+
+    if (!rbt_visit(tree, traversal_mode, rbt_test_record, &record))
+        return false;
+
+    if (record.count != count)
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (record.elements[i] != expected[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Every traversal order visits the elements without recursion
+void rbt_test_traversal(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = interface ? rbt_new(interface) : NULL;
+
+    if (!interface || !tree)
+        goto error;
+
+    const int64_t elements[7] = { 4, 2, 6, 1, 3, 5, 7 };
+
+    for (integer_t i = 0; i < 7; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t(elements[i])))
+            goto error;
+    }
+
+    const int64_t preorder[7] = { 4, 2, 1, 3, 6, 5, 7 };
+    const int64_t inorder[7] = { 1, 2, 3, 4, 5, 6, 7 };
+    const int64_t postorder[7] = { 1, 3, 2, 5, 7, 6, 4 };
+    const int64_t levelorder[7] = { 4, 2, 6, 1, 3, 5, 7 };
+    const int64_t leaves[4] = { 1, 3, 5, 7 };
+
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, -1, preorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, 0, inorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, 1, postorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, 2, levelorder, 7),
+                   __func__);
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, 3, leaves, 4),
+                   __func__);
+
+    rbt_free(tree);
+
+    // Persistent trees have no parent pointers
+    tree = rbt_new(interface);
+
+    if (!tree || !rbt_set_persistent(tree, true))
+        goto error;
+
+    for (integer_t i = 0; i < 7; i++)
+    {
+        if (!rbt_insert(tree, new_int64_t(elements[i])))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, rbt_test_recorded(tree, 0, inorder, 7),
+                   __func__);
+
+    rbt_free(tree);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) rbt_free(tree);
+    if (interface) interface_free(interface);
+}
+
 // Runs all RedBlackTree tests
 Status RedBlackTreeTests(void)
 {
@@ -272,6 +1555,17 @@ Status RedBlackTreeTests(void)
     rbt_test_IO1(ut);
     rbt_test_IO2(ut);
     rbt_test_IO3(ut);
+    rbt_test_range(ut);
+    rbt_test_rank(ut);
+    rbt_test_bulk(ut);
+    rbt_test_set_operations(ut);
+    rbt_test_stats(ut);
+    rbt_test_snapshot(ut);
+    rbt_test_persistent(ut);
+    rbt_test_persistent_threads(ut);
+    rbt_test_multiple(ut);
+    rbt_test_upsert(ut);
+    rbt_test_traversal(ut);
 
     ut_report(ut, "RedBlackTree");
 
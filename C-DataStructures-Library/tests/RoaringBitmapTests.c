@@ -0,0 +1,370 @@
+/**
+ * @file RoaringBitmapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "RoaringBitmap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Universe used by tests that check against a BitArray_s, 16 containers
+static const uint32_t rbm_test_universe = 1 << 20;
+
+// Checks that both structures have exactly the same set bits
+static bool
+rbm_test_equals(RoaringBitmap_t *bitmap, BitArray_t *bits)
+{
+    unsigned_t i = rbm_next_set(bitmap, 0);
+    unsigned_t j = bit_next_set(bits, 0);
+
+    while (i != (unsigned_t)-1 && j != (unsigned_t)-1)
+    {
+        if (i != j)
+            return false;
+
+        i = rbm_next_set(bitmap, (uint32_t)i + 1);
+        j = bit_next_set(bits, j + 1);
+    }
+
+    return i == j && rbm_cardinality(bitmap) == bit_cardinality(bits);
+}
+
+// Fills both structures with sparse, dense and consecutive chunks
+static bool
+rbm_test_fill(RoaringBitmap_t *bitmap, BitArray_t *bits)
+{
+    for (uint32_t i = 0; i < rbm_test_universe; i++)
+    {
+        uint32_t chunk = i >> 16;
+
+        bool set = chunk % 4 == 0 ? random_int32_t(0, 999) == 0
+                 : chunk % 4 == 1 ? random_int32_t(0, 1) == 0
+                 : chunk % 4 == 2 ? (i / 1000) % 2 == 0
+                 : false;
+
+        if (set && (!rbm_set(bitmap, i) || !bit_set(bits, i)))
+            return false;
+    }
+
+    return true;
+}
+
+// Tests rbm_set, rbm_clear and rbm_get against a BitArray_s
+void rbm_test_set_clear(UnitTest ut)
+{
+    RoaringBitmap_t *bitmap = rbm_new();
+    BitArray_t *bits = bit_create(rbm_test_universe);
+
+    if (!bitmap || !bits)
+        goto error;
+
+    ut_equals_bool(ut, true, rbm_empty(bitmap), __func__);
+
+    if (!rbm_test_fill(bitmap, bits))
+        goto error;
+
+    ut_equals_bool(ut, true, rbm_test_equals(bitmap, bits), __func__);
+
+    // Clearing most bits of the dense chunk turns it into an array again
+    for (uint32_t i = 0; i < rbm_test_universe; i++)
+    {
+        if (random_int32_t(0, 9) != 0)
+        {
+            rbm_clear(bitmap, i);
+            bit_clear(bits, i);
+        }
+    }
+
+    ut_equals_bool(ut, true, rbm_test_equals(bitmap, bits), __func__);
+
+    bool gets = true;
+
+    for (uint32_t i = 0; i < rbm_test_universe; i += 7)
+    {
+        if (rbm_get(bitmap, i) != bit_get(bits, i))
+            gets = false;
+    }
+
+    ut_equals_bool(ut, true, gets, __func__);
+
+    // Emptying a chunk removes its container
+    integer_t containers = rbm_containers(bitmap);
+
+    for (uint32_t i = 0; i < 65536; i++)
+        rbm_clear(bitmap, i);
+
+    ut_equals_integer_t(ut, containers - 1, rbm_containers(bitmap), __func__);
+
+    bit_free(bits);
+    rbm_free(bitmap);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bits) bit_free(bits);
+    if (bitmap) rbm_free(bitmap);
+}
+
+// Tests every binary operation against the same BitArray_s operation with
+// every combination of container types
+void rbm_test_operations(UnitTest ut)
+{
+    RoaringBitmap_t *bitmap1 = NULL, *bitmap2 = NULL;
+    BitArray_t *bits1 = NULL, *bits2 = NULL;
+
+    bool correct = true;
+
+    for (int op = 0; op < 4; op++)
+    {
+        for (int optimized = 0; optimized < 2; optimized++)
+        {
+            bitmap1 = rbm_new();
+            bitmap2 = rbm_new();
+            bits1 = bit_create(rbm_test_universe);
+            bits2 = bit_create(rbm_test_universe);
+
+            if (!bitmap1 || !bitmap2 || !bits1 || !bits2)
+                goto error;
+
+            if (!rbm_test_fill(bitmap1, bits1))
+                goto error;
+
+            // The second operand has other chunk types at the same positions
+            for (uint32_t i = 0; i < rbm_test_universe; i++)
+            {
+                uint32_t chunk = (i >> 16) + 1;
+
+                bool set = chunk % 4 == 0 ? random_int32_t(0, 999) == 0
+                         : chunk % 4 == 1 ? random_int32_t(0, 2) == 0
+                         : chunk % 4 == 2 ? (i / 700) % 3 == 0
+                         : false;
+
+                if (set && (!rbm_set(bitmap2, i) || !bit_set(bits2, i)))
+                    goto error;
+            }
+
+            if (optimized && (!rbm_optimize(bitmap1)
+                              || !rbm_optimize(bitmap2)))
+                goto error;
+
+            bool success;
+
+            switch (op)
+            {
+                case 0:
+                    success = rbm_AND(bitmap1, bitmap2);
+                    bit_AND(bits1, bits2);
+                    break;
+                case 1:
+                    success = rbm_OR(bitmap1, bitmap2);
+                    bit_OR(bits1, bits2);
+                    break;
+                case 2:
+                    success = rbm_XOR(bitmap1, bitmap2);
+                    bit_XOR(bits1, bits2);
+                    break;
+                default:
+                    success = rbm_DIFF(bitmap1, bitmap2);
+                    bit_DIFF(bits1, bits2);
+                    break;
+            }
+
+            if (!success || !rbm_test_equals(bitmap1, bits1))
+                correct = false;
+
+            rbm_free(bitmap1);
+            rbm_free(bitmap2);
+            bit_free(bits1);
+            bit_free(bits2);
+
+            bitmap1 = bitmap2 = NULL;
+            bits1 = bits2 = NULL;
+        }
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bitmap1) rbm_free(bitmap1);
+    if (bitmap2) rbm_free(bitmap2);
+    if (bits1) bit_free(bits1);
+    if (bits2) bit_free(bits2);
+}
+
+// Long runs are compressed by rbm_optimize and can still be modified
+void rbm_test_optimize(UnitTest ut)
+{
+    RoaringBitmap_t *bitmap = rbm_new();
+
+    if (!bitmap)
+        goto error;
+
+    for (uint32_t i = 1000; i < 300000; i++)
+    {
+        if (!rbm_set(bitmap, i))
+            goto error;
+    }
+
+    unsigned_t before = rbm_bytes(bitmap);
+
+    if (!rbm_optimize(bitmap))
+        goto error;
+
+    unsigned_t after = rbm_bytes(bitmap);
+
+    ut_equals_bool(ut, true, after * 50 < before, __func__);
+    ut_equals_unsigned_t(ut, 299000, rbm_cardinality(bitmap), __func__);
+    ut_equals_unsigned_t(ut, 1000, rbm_next_set(bitmap, 0), __func__);
+    ut_equals_unsigned_t(ut, 70000, rbm_next_set(bitmap, 70000), __func__);
+    ut_equals_unsigned_t(ut, (unsigned_t)-1, rbm_next_set(bitmap, 300000),
+                         __func__);
+    ut_equals_bool(ut, true, rbm_get(bitmap, 299999), __func__);
+    ut_equals_bool(ut, false, rbm_get(bitmap, 999), __func__);
+
+    // Modifying a run container
+    rbm_clear(bitmap, 5000);
+    rbm_set(bitmap, 10);
+
+    ut_equals_bool(ut, false, rbm_get(bitmap, 5000), __func__);
+    ut_equals_bool(ut, true, rbm_get(bitmap, 10), __func__);
+    ut_equals_unsigned_t(ut, 299000, rbm_cardinality(bitmap), __func__);
+
+    rbm_free(bitmap);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bitmap) rbm_free(bitmap);
+}
+
+// A sparse set over the whole 32-bit universe takes little memory
+void rbm_test_sparse(UnitTest ut)
+{
+    RoaringBitmap_t *bitmap = rbm_new();
+
+    if (!bitmap)
+        goto error;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        if (!rbm_set(bitmap, random_uint32_t(0, UINT32_MAX - 1)))
+            goto error;
+    }
+
+    if (!rbm_set(bitmap, UINT32_MAX))
+        goto error;
+
+    // A BitArray_s would take 512 MB
+    ut_equals_bool(ut, true, rbm_bytes(bitmap) < 1024 * 1024, __func__);
+    ut_equals_bool(ut, true, rbm_get(bitmap, UINT32_MAX), __func__);
+    ut_equals_unsigned_t(ut, UINT32_MAX, rbm_next_set(bitmap, UINT32_MAX),
+                         __func__);
+
+    // Iterating visits every bit in order
+    unsigned_t count = 0, previous = 0;
+    bool sorted = true;
+
+    for (unsigned_t i = rbm_next_set(bitmap, 0); i != (unsigned_t)-1;
+         i = i == UINT32_MAX ? (unsigned_t)-1
+                             : rbm_next_set(bitmap, (uint32_t)i + 1))
+    {
+        if (count > 0 && i <= previous)
+            sorted = false;
+
+        previous = i;
+        count++;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_unsigned_t(ut, rbm_cardinality(bitmap), count, __func__);
+
+    rbm_free(bitmap);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bitmap) rbm_free(bitmap);
+}
+
+// Tests copies and conversions to and from BitArray_s
+void rbm_test_bitarray(UnitTest ut)
+{
+    RoaringBitmap_t *bitmap = rbm_new(), *copy = NULL, *result = NULL;
+    BitArray_t *bits = bit_create(rbm_test_universe), *converted = NULL;
+
+    if (!bitmap || !bits)
+        goto error;
+
+    if (!rbm_test_fill(bitmap, bits))
+        goto error;
+
+    copy = rbm_copy(bitmap);
+    converted = rbm_to_bitarray(bitmap);
+    result = rbm_from_bitarray(bits);
+
+    if (!copy || !converted || !result)
+        goto error;
+
+    ut_equals_bool(ut, true, rbm_test_equals(copy, bits), __func__);
+    ut_equals_bool(ut, true, rbm_test_equals(result, bits), __func__);
+    ut_equals_bool(ut, true, rbm_test_equals(bitmap, converted), __func__);
+
+    rbm_free(bitmap);
+    rbm_free(copy);
+    rbm_free(result);
+    bit_free(bits);
+    bit_free(converted);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (bitmap) rbm_free(bitmap);
+    if (copy) rbm_free(copy);
+    if (result) rbm_free(result);
+    if (bits) bit_free(bits);
+    if (converted) bit_free(converted);
+}
+
+// Runs all RoaringBitmap tests
+Status RoaringBitmapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    rbm_test_set_clear(ut);
+    rbm_test_operations(ut);
+    rbm_test_optimize(ut);
+    rbm_test_sparse(ut);
+    rbm_test_bitarray(ut);
+
+    ut_report(ut, "RoaringBitmap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "RoaringBitmap");
+    ut_delete(&ut);
+    return st;
+}
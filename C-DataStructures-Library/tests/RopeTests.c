@@ -0,0 +1,235 @@
+/**
+ * @file RopeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Rope.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Random insertions and removals anywhere, checked against a plain buffer
+Status rop_test_edits(UnitTest ut)
+{
+    Rope rope = NULL;
+
+    char *model = malloc(sizeof(char) * 200000), *content = NULL;
+    char text[1200];
+
+    Status st = rop_init(&rope);
+
+    if (st != DS_OK || !model)
+        goto error;
+
+    integer_t length = 0;
+
+    bool equal = true;
+
+    for (int i = 0; i < 3000; i++)
+    {
+        integer_t position = random_int32_t(0, (int32_t)length);
+
+        if (random_int32_t(0, 2) > 0 || length == 0)
+        {
+            // Mostly small insertions and a few that span several chunks
+            integer_t size = random_int32_t(0, 9) == 0 ?
+                    random_int32_t(1, 1199) : random_int32_t(1, 8);
+
+            for (integer_t j = 0; j < size; j++)
+                text[j] = random_alpha();
+
+            text[size] = '\0';
+
+            st = rop_push_at(rope, text, position);
+
+            memmove(model + position + size, model + position,
+                    (size_t)(length - position));
+            memcpy(model + position, text, (size_t)size);
+            length += size;
+        }
+        else
+        {
+            if (position == length)
+                position--;
+
+            integer_t to = position + random_int32_t(0, 600);
+
+            if (to >= length)
+                to = length - 1;
+
+            st = rop_remove(rope, position, to);
+
+            memmove(model + position, model + to + 1,
+                    (size_t)(length - to - 1));
+            length -= to - position + 1;
+        }
+
+        if (st != DS_OK)
+            goto error;
+
+        if (i % 100 == 0 && length > 0)
+        {
+            st = rop_get_string(rope, &content);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (memcmp(content, model, (size_t)length) != 0)
+                equal = false;
+
+            free(content);
+            content = NULL;
+
+            char ch;
+
+            position = random_int32_t(0, (int32_t)length - 1);
+
+            st = rop_char_at(rope, position, &ch);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (ch != model[position])
+                equal = false;
+        }
+    }
+
+    ut_equals_integer_t(ut, length, rop_length(rope), __func__);
+    ut_equals_bool(ut, true, equal, __func__);
+
+    rop_delete(&rope);
+    free(model);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (rope) rop_delete(&rope);
+    free(model);
+    free(content);
+    return st;
+}
+
+// Tests splitting, concatenating and searching across chunks
+Status rop_test_split(UnitTest ut)
+{
+    Rope rope = NULL, right = NULL;
+
+    char *content = NULL;
+
+    Status st = rop_init(&rope);
+
+    if (st != DS_OK)
+        goto error;
+
+    // 2000 characters, more than one chunk
+    for (int i = 0; i < 200; i++)
+    {
+        st = rop_push_back(rope, "0123456789");
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    st = rop_push_at(rope, "needle", 1021);
+
+    if (st != DS_OK)
+        goto error;
+
+    integer_t pos;
+
+    st = rop_find_substr(rope, "needle", &pos);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 1021, pos, __func__);
+    ut_equals_bool(ut, true, rop_substr(rope, "90123"), __func__);
+    ut_equals_bool(ut, false, rop_substr(rope, "needles"), __func__);
+
+    // Splits in the middle of the needle
+    st = rop_split(rope, &right, 1024);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 1024, rop_length(rope), __func__);
+    ut_equals_integer_t(ut, 982, rop_length(right), __func__);
+    ut_equals_bool(ut, false, rop_substr(rope, "needle"), __func__);
+    ut_equals_bool(ut, true, rop_substr(right, "dle"), __func__);
+
+    // Back together, the other way around
+    st = rop_prepend(rope, right);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, rop_empty(right), __func__);
+
+    st = rop_find_substr(rope, "dle", &pos);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, pos, __func__);
+
+    st = rop_find_substr(rope, "890nee", &pos);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 982 + 1018, pos, __func__);
+
+    st = rop_remove(rope, 10, 2005);
+    st += rop_append(rope, right);
+    st += rop_get_string(rope, &content);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, strcmp(content, "dle1234567") == 0, __func__);
+
+    free(content);
+
+    rop_delete(&rope);
+    rop_delete(&right);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (rope) rop_delete(&rope);
+    if (right) rop_delete(&right);
+    return st;
+}
+
+// Runs all Rope tests
+Status RopeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    st += rop_test_edits(ut);
+    st += rop_test_split(ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_report(ut, "Rope");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Rope");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,263 @@
+/**
+ * @file SegmentTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "SegmentTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// An affine map x -> a * x + b, which does not commute
+struct SegmentTreeTestMap_s
+{
+    int64_t a;
+    int64_t b;
+};
+
+// Folds a map applied after the accumulated one
+static void
+sgt_test_compose(void *accumulator, const void *element)
+{
+    struct SegmentTreeTestMap_s *first = accumulator;
+    const struct SegmentTreeTestMap_s *second = element;
+
+    first->b = (second->a * first->b + second->b) % 1000003;
+    first->a = (second->a * first->a) % 1000003;
+}
+
+// Sums, minimums and maximums with lazy additions match a plain array
+void sgt_test_lazy(UnitTest ut)
+{
+    // Set the amount of values
+    integer_t T = 777;
+
+    SegmentTree_t *sum = NULL, *max = NULL, *min = NULL;
+
+    int64_t *values = malloc(sizeof(int64_t) * (size_t)T);
+
+    if (!values)
+        goto error;
+
+    for (integer_t i = 0; i < T; i++)
+        values[i] = rand() % 2001 - 1000;
+
+    int64_t zero = 0, low = INT64_MIN, high = INT64_MAX;
+
+    sum = sgt_from_buffer(sizeof(int64_t), reduce_sum_int64_t, &zero, values,
+                          T);
+    max = sgt_from_buffer(sizeof(int64_t), reduce_max_int64_t, &low, values,
+                          T);
+    min = sgt_from_buffer(sizeof(int64_t), reduce_min_int64_t, &high, values,
+                          T);
+
+    if (!sum || !max || !min)
+        goto error;
+
+    ut_equals_bool(ut, false, sgt_lazy(sum), __func__);
+    ut_equals_bool(ut, false, sgt_update(sum, 0, 0, &zero), __func__);
+
+    if (!sgt_set_lazy(sum, sizeof(int64_t), apply_add_sum_int64_t,
+                      reduce_sum_int64_t)
+        || !sgt_set_lazy(max, sizeof(int64_t), apply_add_int64_t,
+                         reduce_sum_int64_t)
+        || !sgt_set_lazy(min, sizeof(int64_t), apply_add_int64_t,
+                         reduce_sum_int64_t))
+        goto error;
+
+    ut_equals_bool(ut, true, sgt_lazy(sum), __func__);
+
+    bool correct = true;
+
+    for (integer_t k = 0; k < 4000; k++)
+    {
+        integer_t i = rand() % T, j = rand() % T;
+        integer_t from = i < j ? i : j, to = i < j ? j : i;
+
+        int64_t value = rand() % 201 - 100;
+
+        if (k % 3 == 0)
+        {
+            for (integer_t m = from; m <= to; m++)
+                values[m] += value;
+
+            sgt_update(sum, from, to, &value);
+            sgt_update(max, from, to, &value);
+            sgt_update(min, from, to, &value);
+        }
+        else if (k % 3 == 1)
+        {
+            values[i] = value;
+
+            sgt_set(sum, i, &value);
+            sgt_set(max, i, &value);
+            sgt_set(min, i, &value);
+        }
+
+        int64_t total = 0, most = INT64_MIN, least = INT64_MAX, result;
+
+        for (integer_t m = from; m <= to; m++)
+        {
+            total += values[m];
+            most = values[m] > most ? values[m] : most;
+            least = values[m] < least ? values[m] : least;
+        }
+
+        if (!sgt_query(sum, from, to, &result) || result != total)
+            correct = false;
+
+        if (!sgt_query(max, from, to, &result) || result != most)
+            correct = false;
+
+        if (!sgt_query(min, from, to, &result) || result != least)
+            correct = false;
+
+        if (!sgt_get(sum, j, &result) || result != values[j])
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, T, sgt_size(sum), __func__);
+
+    int64_t result;
+
+    ut_equals_bool(ut, false, sgt_query(sum, 3, 2, &result), __func__);
+    ut_equals_bool(ut, false, sgt_query(sum, 0, T, &result), __func__);
+    ut_equals_bool(ut, false, sgt_update(sum, -1, 2, &zero), __func__);
+    ut_equals_bool(ut, false, sgt_set(sum, T, &zero), __func__);
+    ut_equals_bool(ut, false, sgt_get(sum, -1, &result), __func__);
+
+    sgt_free(sum);
+    sgt_free(max);
+    sgt_free(min);
+    free(values);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sum) sgt_free(sum);
+    if (max) sgt_free(max);
+    if (min) sgt_free(min);
+    free(values);
+}
+
+// A combine function that does not commute is folded from left to right
+void sgt_test_order(UnitTest ut)
+{
+    Interface_t *interface = interface_new(NULL, NULL, NULL, free, NULL, NULL);
+
+    DynamicArray_t *array = interface ? dar_new(interface) : NULL;
+
+    if (!array)
+        goto error;
+
+    // Set the amount of values
+    integer_t T = 100;
+
+    for (integer_t i = 0; i < T; i++)
+    {
+        struct SegmentTreeTestMap_s *map = malloc(sizeof(*map));
+
+        if (!map)
+            goto error;
+
+        map->a = rand() % 10 + 1;
+        map->b = rand() % 10;
+
+        if (!dar_insert_back(array, map))
+        {
+            free(map);
+            goto error;
+        }
+    }
+
+    struct SegmentTreeTestMap_s identity = { 1, 0 };
+
+    SegmentTree_t *tree = sgt_from_array(sizeof(identity), sgt_test_compose,
+                                         &identity, array);
+
+    if (!tree)
+        goto error;
+
+    ut_equals_bool(ut, true, sgt_element_size(tree) == sizeof(identity),
+                   __func__);
+
+    bool correct = true;
+
+    for (integer_t k = 0; k < 1000; k++)
+    {
+        integer_t i = rand() % T, j = rand() % T;
+        integer_t from = i < j ? i : j, to = i < j ? j : i;
+
+        if (k % 2 == 0)
+        {
+            struct SegmentTreeTestMap_s *map = dar_get(array, i);
+
+            map->a = rand() % 10 + 1;
+            map->b = rand() % 10;
+
+            sgt_set(tree, i, map);
+        }
+
+        struct SegmentTreeTestMap_s expected = identity, result;
+
+        for (integer_t m = from; m <= to; m++)
+            sgt_test_compose(&expected, dar_get(array, m));
+
+        if (!sgt_query(tree, from, to, &result) || result.a != expected.a
+            || result.b != expected.b)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    sgt_free(tree);
+
+    // Empty trees hold nothing
+    tree = sgt_new(sizeof(identity), sgt_test_compose, &identity, 0);
+
+    ut_equals_bool(ut, true, tree != NULL, __func__);
+    ut_equals_bool(ut, false, sgt_get(tree, 0, &identity), __func__);
+
+    sgt_free(tree);
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    if (interface) interface_free(interface);
+}
+
+// Runs all SegmentTree tests
+Status SegmentTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    sgt_test_lazy(ut);
+    sgt_test_order(ut);
+
+    ut_report(ut, "SegmentTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "SegmentTree");
+    ut_delete(&ut);
+    return st;
+}
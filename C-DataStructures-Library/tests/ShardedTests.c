@@ -0,0 +1,264 @@
+/**
+ * @file ShardedTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Sharded.h"
+#include "RedBlackTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+
+// Amount of writer threads and of keys inserted by each of them
+#define SHD_TEST_THREADS 8
+#define SHD_TEST_KEYS 5000
+
+// Functions that make each shard a RedBlackTree_s
+static void *
+shd_test_create(void *context)
+{
+    return rbt_new(context);
+}
+
+static void
+shd_test_destroy(void *container)
+{
+    rbt_free(container);
+}
+
+static integer_t
+shd_test_count(void *container)
+{
+    return rbt_size(container);
+}
+
+static void
+shd_test_visit(void *container, visit_f visit, void *argument)
+{
+    rbt_visit(container, 0, visit, argument);
+}
+
+static const ShardFunctions_t shd_test_functions = {
+    shd_test_create, shd_test_destroy, shd_test_count, shd_test_visit
+};
+
+// Checks that the elements come from 0 to total - 1 in order
+struct ShardedOrder_s
+{
+    int32_t next;
+    bool ordered;
+};
+
+static void
+shd_test_order(void *element, void *argument)
+{
+    struct ShardedOrder_s *order = argument;
+
+    if (*(int32_t*)element != order->next++)
+        order->ordered = false;
+}
+
+static void
+shd_test_sum(void *element, void *argument)
+{
+    *(integer_t*)argument += *(int32_t*)element;
+}
+
+// Adds the size of each container
+static void
+shd_test_sizes(void *container, void *argument)
+{
+    *(integer_t*)argument += rbt_size(container);
+}
+
+// Shared by the writers of shd_test_threads
+struct ShardedTest_s
+{
+    Sharded_t *sharded;
+    integer_t id;
+};
+
+// Inserts every key equal to id modulo SHD_TEST_THREADS
+static void *
+shd_test_writer(void *argument)
+{
+    struct ShardedTest_s *test = argument;
+
+    for (integer_t i = 0; i < SHD_TEST_KEYS; i++)
+    {
+        int32_t *key = new_int32_t((int32_t)(i * SHD_TEST_THREADS + test->id));
+
+        Synchronized_t *shard = shd_find(test->sharded, key);
+
+        SYN_WRITE(shard, rbt_insert(syn_target(shard), key));
+    }
+
+    return NULL;
+}
+
+// Shard selection, validation and operations over every shard
+void shd_test_basic(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                               display_int32_t, free,
+                                               NULL, NULL);
+
+    Sharded_t *sharded = NULL;
+
+    if (!int_interface)
+        goto error;
+
+    ut_equals_bool(ut, true, shd_new(0, hash_int32_t, &shd_test_functions,
+                                     int_interface) == NULL, __func__);
+    ut_equals_bool(ut, true, shd_new(4, NULL, &shd_test_functions,
+                                     int_interface) == NULL, __func__);
+
+    sharded = shd_new(7, hash_int32_t, &shd_test_functions, int_interface);
+
+    if (!sharded)
+        goto error;
+
+    ut_equals_integer_t(ut, 7, shd_shards(sharded), __func__);
+    ut_equals_bool(ut, true, shd_shard(sharded, 7) == NULL, __func__);
+    ut_equals_bool(ut, true, shd_shard(sharded, -1) == NULL, __func__);
+    ut_equals_integer_t(ut, 0, shd_count(sharded), __func__);
+
+    bool stable = true, spread = true;
+    integer_t used[7] = { 0 };
+
+    for (int32_t i = 0; i < 700; i++)
+    {
+        integer_t index = shd_index(sharded, &i);
+
+        stable = stable && index >= 0 && index < 7 &&
+                 index == shd_index(sharded, &i) &&
+                 shd_find(sharded, &i) == shd_shard(sharded, index);
+
+        used[index]++;
+
+        Synchronized_t *shard = shd_shard(sharded, index);
+
+        SYN_WRITE(shard, rbt_insert(syn_target(shard), new_int32_t(i)));
+    }
+
+    for (integer_t i = 0; i < 7; i++)
+        spread = spread && used[i] > 0;
+
+    ut_equals_bool(ut, true, stable, __func__);
+    ut_equals_bool(ut, true, spread, __func__);
+    ut_equals_integer_t(ut, 700, shd_count(sharded), __func__);
+
+    integer_t sizes = 0, sum = 0;
+
+    shd_for_each(sharded, shd_test_sizes, &sizes);
+    shd_visit(sharded, shd_test_sum, &sum);
+
+    ut_equals_integer_t(ut, 700, sizes, __func__);
+    ut_equals_integer_t(ut, 699 * 700 / 2, sum, __func__);
+
+    struct ShardedOrder_s order = { 0, true };
+
+    ut_equals_bool(ut, true, shd_visit_sorted(sharded, compare_int32_t,
+                                              shd_test_order, &order),
+                   __func__);
+    ut_equals_bool(ut, true, order.ordered, __func__);
+    ut_equals_int(ut, 700, order.next, __func__);
+
+    shd_free(sharded);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sharded) shd_free(sharded);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Many writers insert into the same logical container
+void shd_test_threads(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                               display_int32_t, free,
+                                               NULL, NULL);
+
+    Sharded_t *sharded = NULL;
+
+    if (!int_interface)
+        goto error;
+
+    sharded = shd_new(32, hash_int32_t, &shd_test_functions, int_interface);
+
+    if (!sharded)
+        goto error;
+
+    struct ShardedTest_s writers[SHD_TEST_THREADS];
+    pthread_t threads[SHD_TEST_THREADS];
+
+    for (integer_t i = 0; i < SHD_TEST_THREADS; i++)
+    {
+        writers[i] = (struct ShardedTest_s){ sharded, i };
+
+        pthread_create(&threads[i], NULL, shd_test_writer, &writers[i]);
+    }
+
+    for (integer_t i = 0; i < SHD_TEST_THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    integer_t total = SHD_TEST_THREADS * SHD_TEST_KEYS;
+
+    ut_equals_integer_t(ut, total, shd_count(sharded), __func__);
+
+    SyncStats_t stats = shd_stats(sharded);
+
+    ut_equals_bool(ut, true, stats.writes == (unsigned_t)total, __func__);
+
+    struct ShardedOrder_s order = { 0, true };
+
+    ut_equals_bool(ut, true, shd_visit_sorted(sharded, compare_int32_t,
+                                              shd_test_order, &order),
+                   __func__);
+    ut_equals_bool(ut, true, order.ordered, __func__);
+    ut_equals_int(ut, (int)total, order.next, __func__);
+
+    shd_free(sharded);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sharded) shd_free(sharded);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Runs all Sharded tests
+Status ShardedTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    shd_test_basic(ut);
+    shd_test_threads(ut);
+
+    ut_report(ut, "Sharded");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Sharded");
+    ut_delete(&ut);
+    return st;
+}
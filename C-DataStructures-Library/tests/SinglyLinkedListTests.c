@@ -10,6 +10,25 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The list expects functions that take non-const elements
+static int
+sll_test_compare(void *element1, void *element2)
+{
+    return compare_int32_t(element1, element2);
+}
+
+static void *
+sll_test_copy(void *element)
+{
+    return copy_int32_t(element);
+}
+
+static void
+sll_test_display(void *element)
+{
+    display_int32_t(element);
+}
+
 // Tests insertions and removals at the middle of the list
 Status sll_test_middle(UnitTest ut)
 {
@@ -190,6 +209,199 @@ Status sll_test_indexof(UnitTest ut)
     return st;
 }
 
+// Tests sequential positional operations, which reuse the last node found
+Status sll_test_cursor(UnitTest ut)
+{
+    SinglyLinkedList list;
+
+    Status st = sll_create(&list, sll_test_compare, sll_test_copy,
+                           sll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    void *elem;
+    for (int i = 0; i < 1000; i += 2)
+    {
+        elem = new_int32_t(i);
+        st = sll_insert_tail(list, elem);
+
+        if (st != DS_OK)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    // Fills in the odd numbers
+    for (int i = 1; i < 1000; i += 2)
+    {
+        elem = new_int32_t(i);
+        st = sll_insert_at(list, elem, i);
+
+        if (st != DS_OK)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    bool sorted = true;
+    for (int i = 0; i < 1000; i++)
+    {
+        st = sll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int*)elem != i)
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    // Removes the odd numbers
+    for (int i = 1; i < sll_length(list) - 1; i++)
+    {
+        st = sll_remove_at(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        free(elem);
+    }
+
+    ut_equals_integer_t(ut, 501, sll_length(list), __func__);
+
+    // Changes made at the head must not be missed by the next search
+    st = sll_get(list, &elem, 250);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 500, *(int*)elem, __func__);
+
+    st = sll_insert_head(list, new_int32_t(-2));
+    st += sll_get(list, &elem, 250);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 498, *(int*)elem, __func__);
+
+    SinglyLinkedList other;
+
+    st = sll_create(&other, sll_test_compare, sll_test_copy, sll_test_display,
+                    free);
+
+    if (st != DS_OK)
+        goto error;
+
+    st = sll_insert_tail(other, new_int32_t(1000));
+    st += sll_link(list, other);
+    st += sll_get(list, &elem, 502);
+
+    sll_free(&other);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 1000, *(int*)elem, __func__);
+    ut_equals_integer_t(ut, 503, sll_length(list), __func__);
+    sll_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    sll_free(&list);
+    return st;
+}
+
+// Tests sorting and moving ranges between lists
+Status sll_test_sort(UnitTest ut)
+{
+    SinglyLinkedList list = NULL, other = NULL;
+
+    Status st = sll_create(&list, sll_test_compare, sll_test_copy,
+                           sll_test_display, free);
+    st += sll_create(&other, sll_test_compare, sll_test_copy, sll_test_display,
+                     free);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        st = sll_insert_tail(list, new_int32_t(random_int32_t(0, 100)));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    st = sll_sort(list);
+
+    if (st != DS_OK)
+        goto error;
+
+    void *elem;
+    int32_t last = -1;
+    bool sorted = true;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        st = sll_get(list, &elem, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        if (*(int32_t*)elem < last)
+            sorted = false;
+
+        last = *(int32_t*)elem;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    // The tail is still the last node
+    st = sll_insert_tail(list, new_int32_t(1000));
+    st += sll_get(list, &elem, 1000);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 1000, *(int32_t*)elem, __func__);
+
+    // Moves the last 11 elements to another list and back
+    st = sll_unlink_at(list, other, 990, 1000);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 990, sll_length(list), __func__);
+    ut_equals_integer_t(ut, 11, sll_length(other), __func__);
+
+    st = sll_link(list, other);
+    st += sll_get(list, &elem, 1000);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 1000, *(int32_t*)elem, __func__);
+    ut_equals_bool(ut, true, sll_empty(other), __func__);
+
+    sll_free(&list);
+    sll_free(&other);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list) sll_free(&list);
+    if (other) sll_free(&other);
+    return st;
+}
+
 // Runs all SinglyLinkedList tests
 Status SinglyLinkedListTests(void)
 {
@@ -203,6 +415,8 @@ Status SinglyLinkedListTests(void)
     st += sll_test_middle(ut);
     st += sll_test_limit(ut);
     st += sll_test_indexof(ut);
+    st += sll_test_cursor(ut);
+    st += sll_test_sort(ut);
 
     if (st != DS_OK)
         goto error;
@@ -0,0 +1,258 @@
+/**
+ * @file SkipListTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "SkipList.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+
+// Amount of threads and of keys handled by each one
+#define SKL_TEST_THREADS 4
+#define SKL_TEST_KEYS 20000
+
+// Shared by the threads of skl_test_threads
+struct SkipListTest_s
+{
+    SkipList_t *list;
+    int64_t id;
+    bool correct;
+};
+
+// Inserts its own keys, checks them while the other threads do the same and
+// then removes the odd ones
+static void *
+skl_test_worker(void *argument)
+{
+    struct SkipListTest_s *test = argument;
+
+    for (int64_t i = 0; i < SKL_TEST_KEYS; i++)
+    {
+        int64_t key = i * SKL_TEST_THREADS + test->id;
+
+        if (!skl_insert(test->list, new_int64_t(key)))
+            test->correct = false;
+    }
+
+    for (int64_t i = 0; i < SKL_TEST_KEYS; i++)
+    {
+        int64_t key = i * SKL_TEST_THREADS + test->id;
+
+        if (!skl_contains(test->list, &key))
+            test->correct = false;
+    }
+
+    for (int64_t i = 1; i < SKL_TEST_KEYS; i += 2)
+    {
+        int64_t key = i * SKL_TEST_THREADS + test->id;
+
+        if (!skl_remove(test->list, &key) || skl_contains(test->list, &key))
+            test->correct = false;
+    }
+
+    return NULL;
+}
+
+// Tests insertion, removal, minimum, maximum and iteration from one thread
+void skl_test_linear(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    SkipList_t *list = skl_new(interface);
+
+    SkipListIterator_t *iter = NULL;
+
+    if (!interface || !list)
+        goto error;
+
+    ut_equals_bool(ut, true, skl_empty(list), __func__);
+    ut_equals_bool(ut, true, skl_min(list) == NULL, __func__);
+    ut_equals_bool(ut, true, skl_max(list) == NULL, __func__);
+    ut_equals_bool(ut, false, skl_pop(list), __func__);
+
+    // Shuffled insertion of 0 to 999
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!skl_insert(list, new_int64_t((i * 337) % 1000)))
+            goto error;
+    }
+
+    int64_t key = 500;
+
+    void *duplicate = new_int64_t(key);
+
+    ut_equals_bool(ut, false, skl_insert(list, duplicate), __func__);
+    free(duplicate);
+
+    ut_equals_integer_t(ut, 1000, skl_size(list), __func__);
+    ut_equals_bool(ut, true, skl_contains(list, &key), __func__);
+    ut_equals_int(ut, 0, *(int64_t*)skl_min(list), __func__);
+    ut_equals_int(ut, 999, *(int64_t*)skl_max(list), __func__);
+
+    iter = skl_iter_new(list);
+
+    if (!iter)
+        goto error;
+
+    int64_t expected = 0;
+    bool ordered = true;
+
+    do
+    {
+        if (*(int64_t*)skl_iter_peek(iter) != expected++)
+            ordered = false;
+    }
+    while (skl_iter_next(iter));
+
+    ut_equals_bool(ut, true, ordered && expected == 1000, __func__);
+
+    // Removes every multiple of 3 and the smallest element
+    for (key = 0; key < 1000; key += 3)
+    {
+        if (!skl_remove(list, &key))
+            goto error;
+    }
+
+    key = 3;
+
+    ut_equals_bool(ut, false, skl_remove(list, &key), __func__);
+    ut_equals_bool(ut, true, skl_pop(list), __func__);
+    ut_equals_int(ut, 2, *(int64_t*)skl_min(list), __func__);
+    ut_equals_int(ut, 998, *(int64_t*)skl_max(list), __func__);
+    ut_equals_integer_t(ut, 665, skl_size(list), __func__);
+
+    // Range query from 299
+    key = 299;
+
+    ut_equals_bool(ut, true, skl_iter_seek(iter, &key), __func__);
+    ut_equals_int(ut, 299, *(int64_t*)skl_iter_peek(iter), __func__);
+    ut_equals_bool(ut, true, skl_iter_next(iter), __func__);
+    ut_equals_int(ut, 301, *(int64_t*)skl_iter_peek(iter), __func__);
+
+    key = 1000;
+
+    ut_equals_bool(ut, false, skl_iter_seek(iter, &key), __func__);
+    ut_equals_bool(ut, true, skl_iter_peek(iter) == NULL, __func__);
+
+    ut_equals_integer_t(ut, 335, skl_reclaim(list), __func__);
+    ut_equals_integer_t(ut, 0, skl_reclaim(list), __func__);
+
+    skl_iter_free(iter);
+    skl_free(list);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (iter) skl_iter_free(iter);
+    if (list) skl_free(list);
+    if (interface) interface_free(interface);
+}
+
+// Many threads insert, search and remove interleaved keys at the same time
+void skl_test_threads(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    SkipList_t *list = skl_new(interface);
+
+    if (!interface || !list)
+        goto error;
+
+    struct SkipListTest_s tests[SKL_TEST_THREADS];
+    pthread_t threads[SKL_TEST_THREADS];
+
+    for (int64_t i = 0; i < SKL_TEST_THREADS; i++)
+    {
+        tests[i] = (struct SkipListTest_s){ list, i, true };
+
+        pthread_create(&threads[i], NULL, skl_test_worker, &tests[i]);
+    }
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < SKL_TEST_THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+
+        correct = correct && tests[i].correct;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, SKL_TEST_THREADS * SKL_TEST_KEYS / 2,
+                        skl_size(list), __func__);
+
+    // Only the keys with an even index are left, in order
+    SkipListIterator_t *iter = skl_iter_new(list);
+
+    if (!iter)
+        goto error;
+
+    int64_t count = 0;
+    bool ordered = true;
+
+    for (void *element = skl_iter_peek(iter); element;
+         element = skl_iter_next(iter) ? skl_iter_peek(iter) : NULL)
+    {
+        int64_t key = *(int64_t*)element;
+
+        if ((key / SKL_TEST_THREADS) % 2 != 0)
+            ordered = false;
+
+        if (key != (count / SKL_TEST_THREADS) * 2 * SKL_TEST_THREADS
+                   + count % SKL_TEST_THREADS)
+            ordered = false;
+
+        count++;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_int(ut, SKL_TEST_THREADS * SKL_TEST_KEYS / 2, (int)count,
+                  __func__);
+
+    skl_iter_free(iter);
+    skl_free(list);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (list) skl_free(list);
+    if (interface) interface_free(interface);
+}
+
+// Runs all SkipList tests
+Status SkipListTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    skl_test_linear(ut);
+    skl_test_threads(ut);
+
+    ut_report(ut, "SkipList");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "SkipList");
+    ut_delete(&ut);
+    return st;
+}
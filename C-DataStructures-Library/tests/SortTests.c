@@ -0,0 +1,576 @@
+/**
+ * @file SortTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "Array.h"
+#include "DynamicArray.h"
+#include "Sort.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+static integer_t srt_test_comparisons = 0;
+
+static int
+srt_test_compare(const void *element1, const void *element2)
+{
+    srt_test_comparisons++;
+
+    return compare_int32_t(element1, element2);
+}
+
+static bool
+srt_test_sorted(void **buffer, integer_t size)
+{
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (*(int32_t*)buffer[i - 1] > *(int32_t*)buffer[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Checks many input patterns and sizes around the insertion sort and ninther
+// thresholds
+void srt_test_patterns(UnitTest ut)
+{
+    const integer_t sizes[] = { 0, 1, 2, 3, 23, 24, 25, 129, 1000, 50000 };
+    const integer_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    const integer_t max_size = 50000;
+
+    int32_t *values = malloc(sizeof(int32_t) * (size_t)max_size);
+    void **buffer = malloc(sizeof(void*) * (size_t)max_size);
+
+    if (!values || !buffer)
+        goto error;
+
+    bool sorted = true;
+
+    // 0 random, 1 sorted, 2 reversed, 3 all equal, 4 few distinct,
+    // 5 organ pipe, 6 sorted with a few swaps
+    for (int pattern = 0; pattern < 7; pattern++)
+    {
+        for (integer_t s = 0; s < sizes_count; s++)
+        {
+            integer_t size = sizes[s];
+
+            for (integer_t i = 0; i < size; i++)
+            {
+                switch (pattern)
+                {
+                    case 0: values[i] = random_int32_t(-100000, 100000); break;
+                    case 1: values[i] = (int32_t)i; break;
+                    case 2: values[i] = (int32_t)(size - i); break;
+                    case 3: values[i] = 7; break;
+                    case 4: values[i] = random_int32_t(0, 4); break;
+                    case 5: values[i] = (int32_t)(i < size / 2 ? i : size - i);
+                            break;
+                    default: values[i] = (int32_t)i; break;
+                }
+
+                buffer[i] = &values[i];
+            }
+
+            if (pattern == 6)
+            {
+                for (integer_t i = 0; i < size / 100; i++)
+                {
+                    integer_t a = random_int32_t(0, (int32_t)size - 1);
+                    integer_t b = random_int32_t(0, (int32_t)size - 1);
+
+                    void *temp = buffer[a];
+                    buffer[a] = buffer[b];
+                    buffer[b] = temp;
+                }
+            }
+
+            srt_sort(buffer, size, compare_int32_t);
+
+            if (!srt_test_sorted(buffer, size))
+                sorted = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    free(values);
+    free(buffer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(values);
+    free(buffer);
+}
+
+// Checks that sorted, reversed and all-equal inputs take a linear amount of
+// comparisons and that the fallbacks sort correctly
+void srt_test_complexity(UnitTest ut)
+{
+    const integer_t size = 100000;
+
+    int32_t *values = malloc(sizeof(int32_t) * (size_t)size);
+    void **buffer = malloc(sizeof(void*) * (size_t)size);
+
+    if (!values || !buffer)
+        goto error;
+
+    for (int pattern = 0; pattern < 3; pattern++)
+    {
+        for (integer_t i = 0; i < size; i++)
+        {
+            values[i] = pattern == 0 ? (int32_t)i :
+                        pattern == 1 ? (int32_t)(size - i) : 1;
+            buffer[i] = &values[i];
+        }
+
+        srt_test_comparisons = 0;
+
+        srt_sort(buffer, size, srt_test_compare);
+
+        ut_equals_bool(ut, true, srt_test_sorted(buffer, size), __func__);
+        ut_equals_bool(ut, true, srt_test_comparisons < 4 * size, __func__);
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        values[i] = random_int32_t(0, 1000);
+        buffer[i] = &values[i];
+    }
+
+    srt_heap_sort(buffer, size, compare_int32_t);
+
+    ut_equals_bool(ut, true, srt_test_sorted(buffer, size), __func__);
+
+    for (integer_t i = 0; i < 1000; i++)
+        values[i] = random_int32_t(0, 1000);
+
+    srt_insertion_sort(buffer, 1000, compare_int32_t);
+
+    ut_equals_bool(ut, true, srt_test_sorted(buffer, 1000), __func__);
+
+    free(values);
+    free(buffer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(values);
+    free(buffer);
+}
+
+// Checks dar_sort through the sort module
+void srt_test_dynamic_array(UnitTest ut)
+{
+    const int32_t elements = 10000;
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(int_interface);
+
+    if (!int_interface || !array)
+        goto error;
+
+    // Many duplicates
+    for (int32_t i = 0; i < elements; i++)
+    {
+        void *element = new_int32_t(random_int32_t(0, 10));
+
+        if (!dar_insert_back(array, element))
+        {
+            free(element);
+            goto error;
+        }
+    }
+
+    dar_sort(array);
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < dar_size(array); i++)
+    {
+        if (*(int32_t*)dar_get(array, i - 1) > *(int32_t*)dar_get(array, i))
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    dar_free(array);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    interface_free(int_interface);
+}
+
+// Checks radix sort with signed, unsigned and floating point keys
+void srt_test_radix(UnitTest ut)
+{
+    const integer_t size = 20000;
+
+    int32_t *ints = malloc(sizeof(int32_t) * (size_t)size);
+    uint64_t *longs = malloc(sizeof(uint64_t) * (size_t)size);
+    double *doubles = malloc(sizeof(double) * (size_t)size);
+    void **buffer = malloc(sizeof(void*) * (size_t)size);
+
+    if (!ints || !longs || !doubles || !buffer)
+        goto error;
+
+    bool sorted = true;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        ints[i] = random_int32_t(INT32_MIN + 1, INT32_MAX);
+        buffer[i] = &ints[i];
+    }
+
+    ints[0] = INT32_MIN;
+    ints[1] = -1;
+    ints[2] = 0;
+
+    ut_equals_bool(ut, true, srt_radix_sort(buffer, size, key_int32_t),
+                   __func__);
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (compare_int32_t(buffer[i - 1], buffer[i]) > 0)
+            sorted = false;
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        longs[i] = (uint64_t)random_uint32_t(0, UINT32_MAX) << 32
+                   | random_uint32_t(0, UINT32_MAX);
+        buffer[i] = &longs[i];
+    }
+
+    srt_radix_sort(buffer, size, key_uint64_t);
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (compare_uint64_t(buffer[i - 1], buffer[i]) > 0)
+            sorted = false;
+    }
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        doubles[i] = random_double(-1e10, 1e10);
+        buffer[i] = &doubles[i];
+    }
+
+    doubles[0] = -0.0;
+    doubles[1] = 0.0;
+    doubles[2] = -1e-300;
+    doubles[3] = 1e300;
+
+    srt_radix_sort(buffer, size, key_double);
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        if (compare_double(buffer[i - 1], buffer[i]) > 0)
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    free(ints);
+    free(longs);
+    free(doubles);
+    free(buffer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(ints);
+    free(longs);
+    free(doubles);
+    free(buffer);
+}
+
+// Radix sort is stable and keeps pointers of equal keys in order
+void srt_test_radix_stable(UnitTest ut)
+{
+    const integer_t size = 5000;
+
+    int16_t *values = malloc(sizeof(int16_t) * (size_t)size);
+    void **buffer = malloc(sizeof(void*) * (size_t)size);
+
+    if (!values || !buffer)
+        goto error;
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        values[i] = random_int16_t(-3, 3);
+        buffer[i] = &values[i];
+    }
+
+    srt_radix_sort(buffer, size, key_int16_t);
+
+    bool stable = true;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        int16_t *previous = buffer[i - 1], *current = buffer[i];
+
+        if (*previous > *current || (*previous == *current
+                                     && previous > current))
+            stable = false;
+    }
+
+    ut_equals_bool(ut, true, stable, __func__);
+
+    free(values);
+    free(buffer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(values);
+    free(buffer);
+}
+
+// Checks dar_sort_radix
+void srt_test_radix_dynamic_array(UnitTest ut)
+{
+    const int32_t elements = 10000;
+
+    Interface_t *int_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(int_interface);
+
+    if (!int_interface || !array)
+        goto error;
+
+    for (int32_t i = 0; i < elements; i++)
+    {
+        void *element = new_int64_t(random_int64_t(-100000, 100000));
+
+        if (!dar_insert_back(array, element))
+        {
+            free(element);
+            goto error;
+        }
+    }
+
+    ut_equals_bool(ut, true, dar_sort_radix(array, key_int64_t), __func__);
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < dar_size(array); i++)
+    {
+        if (*(int64_t*)dar_get(array, i - 1) > *(int64_t*)dar_get(array, i))
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    dar_free(array);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) dar_free(array);
+    interface_free(int_interface);
+}
+
+// Checks the parallel sort with sizes that do not split evenly among runs and
+// thread counts that are not powers of two
+void srt_test_parallel(UnitTest ut)
+{
+    const integer_t sizes[] = { 100, 8191, 8192, 20001, 100003 };
+    const integer_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+    const integer_t threads[] = { 1, 2, 3, 8 };
+    const integer_t threads_count = sizeof(threads) / sizeof(threads[0]);
+
+    const integer_t max_size = 100003;
+
+    int32_t *values = malloc(sizeof(int32_t) * (size_t)max_size);
+    void **buffer = malloc(sizeof(void*) * (size_t)max_size);
+
+    ThreadPool_t *pool = NULL;
+
+    if (!values || !buffer)
+        goto error;
+
+    bool sorted = true;
+
+    for (integer_t t = 0; t < threads_count; t++)
+    {
+        pool = tpl_new(threads[t]);
+
+        if (!pool)
+            goto error;
+
+        // 0 random, 1 few distinct, 2 reversed
+        for (int pattern = 0; pattern < 3; pattern++)
+        {
+            for (integer_t s = 0; s < sizes_count; s++)
+            {
+                integer_t size = sizes[s];
+                int64_t sum = 0, sorted_sum = 0;
+
+                for (integer_t i = 0; i < size; i++)
+                {
+                    if (pattern == 0)
+                        values[i] = random_int32_t(-100000, 100000);
+                    else if (pattern == 1)
+                        values[i] = random_int32_t(0, 4);
+                    else
+                        values[i] = (int32_t)(size - i);
+
+                    buffer[i] = &values[i];
+                    sum += values[i];
+                }
+
+                srt_sort_parallel(buffer, size, compare_int32_t, pool);
+
+                for (integer_t i = 0; i < size; i++)
+                    sorted_sum += *(int32_t*)buffer[i];
+
+                if (!srt_test_sorted(buffer, size) || sum != sorted_sum)
+                    sorted = false;
+            }
+        }
+
+        tpl_free(pool);
+        pool = NULL;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    free(values);
+    free(buffer);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (pool) tpl_free(pool);
+    free(values);
+    free(buffer);
+}
+
+// Checks dar_sort_parallel and arr_sort_parallel
+void srt_test_parallel_arrays(UnitTest ut)
+{
+    const int32_t elements = 30000;
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *dynamic = dar_new(int_interface);
+    Array_t *array = arr_new(int_interface, elements);
+
+    if (!int_interface || !dynamic || !array)
+        goto error;
+
+    for (int32_t i = 0; i < elements; i++)
+    {
+        void *element = new_int32_t(random_int32_t(-1000, 1000));
+
+        if (!dar_insert_back(dynamic, element))
+        {
+            free(element);
+            goto error;
+        }
+
+        element = new_int32_t(random_int32_t(-1000, 1000));
+
+        if (arr_set(array, element, i) != 0)
+        {
+            free(element);
+            goto error;
+        }
+    }
+
+    ut_equals_bool(ut, false, dar_sort_parallel(dynamic, 0), __func__);
+    ut_equals_bool(ut, true, dar_sort_parallel(dynamic, 4), __func__);
+    ut_equals_bool(ut, false, arr_sort_parallel(array, 0), __func__);
+    ut_equals_bool(ut, true, arr_sort_parallel(array, 3), __func__);
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < elements; i++)
+    {
+        void *previous, *current;
+
+        if (*(int32_t*)dar_get(dynamic, i - 1) > *(int32_t*)dar_get(dynamic, i))
+            sorted = false;
+
+        arr_get(array, &previous, i - 1);
+        arr_get(array, &current, i);
+
+        if (*(int32_t*)previous > *(int32_t*)current)
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    dar_free(dynamic);
+    arr_free(array);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (dynamic) dar_free(dynamic);
+    if (array) arr_free(array);
+    interface_free(int_interface);
+}
+
+// Runs all Sort tests
+Status SortTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    srt_test_patterns(ut);
+    srt_test_complexity(ut);
+    srt_test_dynamic_array(ut);
+    srt_test_radix(ut);
+    srt_test_radix_stable(ut);
+    srt_test_radix_dynamic_array(ut);
+    srt_test_parallel(ut);
+    srt_test_parallel_arrays(ut);
+
+    ut_report(ut, "Sort");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Sort");
+    ut_delete(&ut);
+    return st;
+}
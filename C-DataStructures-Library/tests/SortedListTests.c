@@ -10,6 +10,25 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The list expects functions that take non-const elements
+static int
+sli_test_compare(void *element1, void *element2)
+{
+    return compare_int32_t(element1, element2);
+}
+
+static void *
+sli_test_copy(void *element)
+{
+    return copy_int32_t(element);
+}
+
+static void
+sli_test_display(void *element)
+{
+    display_int32_t(element);
+}
+
 // Tests insertion
 Status sli_test_insertion(UnitTest ut)
 {
@@ -304,6 +323,249 @@ Status sli_test_indexof(UnitTest ut)
     return st;
 }
 
+// Tests the index against an unindexed list with random operations
+Status sli_test_indexed(UnitTest ut)
+{
+    SortedList list = NULL, plain = NULL;
+
+    Status st;
+
+    bool same = true;
+
+    for (int order = 0; order < 2; order++)
+    {
+        SortOrder sort = order == 0 ? ASCENDING : DESCENDING;
+
+        st = sli_create(&list, sort, sli_test_compare, sli_test_copy,
+                        sli_test_display, free);
+        st += sli_create(&plain, sort, sli_test_compare, sli_test_copy,
+                         sli_test_display, free);
+
+        if (st != DS_OK)
+            goto error;
+
+        st = sli_set_indexed(list, true);
+
+        if (st != DS_OK)
+            goto error;
+
+        ut_equals_bool(ut, true, sli_indexed(list), __func__);
+
+        void *a, *b;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            int op = random_int32_t(0, 99);
+
+            a = NULL, b = NULL;
+
+            if (op < 60 || sli_empty(plain))
+            {
+                int32_t value = random_int32_t(0, 300);
+
+                st = sli_insert(list, new_int32_t(value));
+                st += sli_insert(plain, new_int32_t(value));
+            }
+            else if (op < 75)
+            {
+                integer_t position = random_int32_t(0, (int32_t)sli_length(plain) - 1);
+
+                st = sli_remove(list, &a, position);
+                st += sli_remove(plain, &b, position);
+            }
+            else if (op < 80)
+            {
+                st = sli_remove_max(list, &a);
+                st += sli_remove_max(plain, &b);
+            }
+            else if (op < 85)
+            {
+                st = sli_remove_min(list, &a);
+                st += sli_remove_min(plain, &b);
+            }
+            else if (op < 99)
+            {
+                int32_t key = random_int32_t(-1, 301);
+
+                if (sli_index_first(list, &key) != sli_index_first(plain, &key) ||
+                    sli_index_last(list, &key) != sli_index_last(plain, &key) ||
+                    sli_contains(list, &key) != sli_contains(plain, &key))
+                    same = false;
+
+                continue;
+            }
+            else
+            {
+                // Leaves the index outdated
+                st = sli_reverse(list);
+                st += sli_reverse(plain);
+
+                continue;
+            }
+
+            if (st != DS_OK)
+                goto error;
+
+            if (a != NULL)
+            {
+                if (*(int32_t*)a != *(int32_t*)b)
+                    same = false;
+
+                free(a);
+                free(b);
+            }
+        }
+
+        ut_equals_integer_t(ut, sli_length(plain), sli_length(list), __func__);
+
+        for (integer_t i = 0; i < sli_length(plain); i++)
+        {
+            st = sli_get(list, &a, i);
+            st += sli_get(plain, &b, i);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (*(int32_t*)a != *(int32_t*)b)
+                same = false;
+
+            free(a);
+            free(b);
+        }
+
+        sli_free(&list);
+        sli_free(&plain);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list) sli_free(&list);
+    if (plain) sli_free(&plain);
+    return st;
+}
+
+// Tests bulk insertions and merges against single insertions
+Status sli_test_bulk(UnitTest ut)
+{
+    SortedList list = NULL, plain = NULL, other = NULL;
+
+    Status st;
+
+    bool same = true;
+
+    void *elements[1000];
+
+    for (int order = 0; order < 2; order++)
+    {
+        SortOrder sort = order == 0 ? ASCENDING : DESCENDING;
+
+        st = sli_create(&list, sort, sli_test_compare, sli_test_copy,
+                        sli_test_display, free);
+        st += sli_create(&plain, sort, sli_test_compare, sli_test_copy,
+                         sli_test_display, free);
+        st += sli_create(&other, order == 0 ? DESCENDING : ASCENDING,
+                         sli_test_compare, sli_test_copy, sli_test_display,
+                         free);
+
+        if (st != DS_OK)
+            goto error;
+
+        // Two batches, the second one merged with the first one
+        for (int batch = 0; batch < 2; batch++)
+        {
+            for (int i = 0; i < 1000; i++)
+            {
+                int32_t value = random_int32_t(0, 500);
+
+                elements[i] = new_int32_t(value);
+
+                st = sli_insert(plain, new_int32_t(value));
+
+                if (st != DS_OK)
+                    goto error;
+            }
+
+            st = sli_insert_all(list, elements, 1000);
+
+            if (st != DS_OK)
+                goto error;
+        }
+
+        // A list with the opposite order
+        for (int i = 0; i < 500; i++)
+        {
+            int32_t value = random_int32_t(0, 600);
+
+            st = sli_insert(other, new_int32_t(value));
+            st += sli_insert(plain, new_int32_t(value));
+
+            if (st != DS_OK)
+                goto error;
+        }
+
+        st = sli_merge(list, other);
+
+        if (st != DS_OK)
+            goto error;
+
+        ut_equals_bool(ut, true, sli_empty(other), __func__);
+        ut_equals_integer_t(ut, 2500, sli_length(list), __func__);
+
+        void *a, *b;
+
+        for (integer_t i = 0; i < sli_length(plain); i++)
+        {
+            st = sli_get(list, &a, i);
+            st += sli_get(plain, &b, i);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (*(int32_t*)a != *(int32_t*)b)
+                same = false;
+
+            free(a);
+            free(b);
+        }
+
+        sli_free(&list);
+        sli_free(&plain);
+        sli_free(&other);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Nothing is inserted if the batch does not fit
+    st = sli_create(&list, ASCENDING, sli_test_compare, sli_test_copy,
+                    sli_test_display, free);
+
+    if (st != DS_OK)
+        goto error;
+
+    sli_set_limit(list, 10);
+
+    elements[0] = new_int32_t(1);
+
+    ut_equals_int(ut, DS_ERR_FULL, sli_insert_all(list, elements, 11), __func__);
+    ut_equals_bool(ut, true, sli_empty(list), __func__);
+
+    free(elements[0]);
+    sli_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list) sli_free(&list);
+    if (plain) sli_free(&plain);
+    if (other) sli_free(&other);
+    return st;
+}
+
 // Runs all SortedList tests
 Status SortedListTests(void)
 {
@@ -318,6 +580,8 @@ Status SortedListTests(void)
     st += sli_test_incomplete(ut);
     st += sli_test_limit(ut);
     st += sli_test_indexof(ut);
+    st += sli_test_indexed(ut);
+    st += sli_test_bulk(ut);
 
     if (st != DS_OK)
         goto error;
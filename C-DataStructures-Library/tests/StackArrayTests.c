@@ -174,6 +174,207 @@ void sta_test_foreach(UnitTest ut)
     sta_free(stack);
 }
 
+// Walks the stack from the bottom through its span
+void sta_test_span(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    StackArray stack = sta_create(int_interface, 4, 200);
+
+    if (!int_interface || !stack)
+        goto error;
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!sta_push(stack, new_int32_t(i)))
+            goto error;
+    }
+
+    void **span;
+
+    integer_t length = sta_span(stack, 10, &span);
+
+    bool correct = length == 90;
+
+    for (integer_t i = 0; correct && i < length; i++)
+        correct = *(int *)span[i] == i + 10;
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    sta_free(stack);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stack) sta_free(stack);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Tests batch insertions and removals
+void sta_test_batch(UnitTest ut)
+{
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    StackArray stack = sta_create(int_interface, 4, 150);
+    StackArray other = sta_create(int_interface, 4, 150);
+
+    void *buffer[32];
+
+    if (!int_interface || !stack || !other)
+        goto error;
+
+    for (int i = 0; i < 32; i++)
+        buffer[i] = new_int32_t(i);
+
+    if (!sta_push_n(stack, buffer, 32))
+        goto error;
+
+    ut_equals_integer_t(ut, 32, sta_count(stack), __func__);
+    ut_equals_int(ut, 31, *(int32_t*)sta_peek(stack), __func__);
+
+    // The removed elements keep their order so pushing them back restores the
+    // stack
+    ut_equals_integer_t(ut, 10, sta_pop_n(stack, buffer, 10), __func__);
+    ut_equals_int(ut, 22, *(int32_t*)buffer[0], __func__);
+    ut_equals_int(ut, 31, *(int32_t*)buffer[9], __func__);
+    ut_equals_int(ut, 21, *(int32_t*)sta_peek(stack), __func__);
+
+    if (!sta_push_n(other, buffer, 10))
+        goto error;
+
+    ut_equals_bool(ut, true, sta_stack(other, stack), __func__);
+    ut_equals_bool(ut, true, sta_empty(stack), __func__);
+    ut_equals_integer_t(ut, 32, sta_count(other), __func__);
+    ut_equals_int(ut, 21, *(int32_t*)sta_peek(other), __func__);
+
+    // Either every element is inserted or none of them
+    sta_capacity_lock(other);
+
+    ut_equals_bool(ut, false, sta_push_n(other, buffer,
+                   sta_capacity(other) - sta_count(other) + 1), __func__);
+    ut_equals_integer_t(ut, 32, sta_count(other), __func__);
+
+    integer_t removed = sta_pop_n(other, buffer, 100);
+
+    bool correct = removed == 32;
+
+    for (integer_t i = 0; i < removed; i++)
+    {
+        int32_t expected = (int32_t)(i < 10 ? i + 22 : i - 10);
+
+        correct = correct && *(int32_t*)buffer[i] == expected;
+
+        free(buffer[i]);
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, 0, sta_pop_n(other, buffer, 100), __func__);
+
+    sta_free(stack);
+    sta_free(other);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stack) sta_free(stack);
+    if (other) sta_free(other);
+    if (int_interface) interface_free(int_interface);
+}
+
+// Each growth policy and shrinking after pops
+void sta_test_policy(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    StackArray_t *stack = sta_create(&int_interface, 8, 200);
+    StackArray_t *pages = sta_create(&int_interface, 1000, 200);
+
+    if (!stack || !pages)
+        goto error;
+
+    ut_equals_bool(ut, false, sta_set_policy(stack, DS_GROWTH_STEP, 0),
+                   __func__);
+    ut_equals_bool(ut, true, sta_set_policy(stack, DS_GROWTH_STEP, 10),
+                   __func__);
+    ut_equals_int(ut, DS_GROWTH_STEP, sta_policy(stack), __func__);
+
+    for (int32_t i = 0; i < 9; i++)
+    {
+        if (!sta_push(stack, new_int32_t(i)))
+            goto error;
+    }
+
+    // 8 + 10
+    ut_equals_integer_t(ut, 18, sta_capacity(stack), __func__);
+
+    sta_set_policy(stack, DS_GROWTH_GOLDEN, 0);
+
+    for (int32_t i = 9; i < 19; i++)
+    {
+        if (!sta_push(stack, new_int32_t(i)))
+            goto error;
+    }
+
+    // 18 * 1.5
+    ut_equals_integer_t(ut, 27, sta_capacity(stack), __func__);
+
+    // Halves at a quarter full but never goes below the initial capacity
+    sta_set_shrink(stack, true);
+
+    void *element;
+
+    for (int32_t i = 0; i < 13; i++)
+    {
+        sta_pop(stack, &element);
+        free(element);
+    }
+
+    ut_equals_integer_t(ut, 13, sta_capacity(stack), __func__);
+
+    // Half of 13 is below the initial capacity
+    while (sta_pop(stack, &element))
+        free(element);
+
+    ut_equals_integer_t(ut, 13, sta_capacity(stack), __func__);
+
+    // Big buffers end at a page boundary
+    sta_set_policy(pages, DS_GROWTH_PAGES, 0);
+
+    for (int32_t i = 0; i < 1001; i++)
+    {
+        if (!sta_push(pages, new_int32_t(i)))
+            goto error;
+    }
+
+    integer_t capacity = sta_capacity(pages);
+
+    ut_equals_bool(ut, true, capacity >= 2000, __func__);
+    ut_equals_bool(ut, true,
+                   (size_t)capacity * sizeof(void*) % DS_PAGE_SIZE == 0,
+                   __func__);
+
+    sta_free(stack);
+    sta_free(pages);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stack) sta_free(stack);
+    if (pages) sta_free(pages);
+}
+
 // Runs all StackArray tests
 Status StackArrayTests(void)
 {
@@ -187,6 +388,9 @@ Status StackArrayTests(void)
     sta_test_locked(ut);
     sta_test_growth(ut);
     sta_test_foreach(ut);
+    sta_test_span(ut);
+    sta_test_batch(ut);
+    sta_test_policy(ut);
 
     ut_report(ut, "StackArray");
 
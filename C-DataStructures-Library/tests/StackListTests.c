@@ -106,6 +106,132 @@ void stl_test_foreach(UnitTest ut)
     stl_erase(stack);
 }
 
+// Tests nodes holding many elements
+void stl_test_chunk(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    StackList_t *stack = stl_new(&int_interface), *copy = NULL, *other = NULL;
+
+    if (!stack)
+        goto error;
+
+    if (!stl_set_chunk(stack, 5))
+        goto error;
+
+    ut_equals_bool(ut, false, stl_set_chunk(stack, 0), __func__);
+    ut_equals_integer_t(ut, 5, stl_chunk(stack), __func__);
+
+    // The top moves up and down through many nodes
+    int32_t top = 0;
+    bool failed = false;
+
+    for (int i = 0; i < 200; i++)
+    {
+        for (int j = 0; j < i % 13; j++)
+        {
+            if (!stl_push(stack, new_int32_t(top++)))
+                goto error;
+        }
+
+        for (int j = 0; j < i % 11 && !stl_empty(stack); j++)
+        {
+            void *result;
+
+            if (!stl_pop(stack, &result))
+                goto error;
+
+            if (*(int32_t*)result != --top)
+                failed = true;
+
+            free(result);
+        }
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, top, stl_count(stack), __func__);
+    ut_equals_int(ut, top - 1, *(int32_t*)stl_peek(stack), __func__);
+    ut_equals_bool(ut, true, stl_contains(stack, &(int32_t){0}), __func__);
+    ut_equals_bool(ut, false, stl_contains(stack, &(int32_t){top}), __func__);
+
+    copy = stl_copy(stack);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_int(ut, 0, stl_compare(stack, copy), __func__);
+
+    // The iterator visits every element from the top
+    StackListIterator_t *iter = stl_iter_new(copy);
+
+    if (!iter)
+        goto error;
+
+    int32_t expected = top;
+
+    do
+    {
+        if (*(int32_t*)stl_iter_peek(iter) != --expected)
+            failed = true;
+    } while (stl_iter_next(iter));
+
+    stl_iter_free(iter);
+
+    ut_equals_int(ut, 0, expected, __func__);
+    ut_equals_bool(ut, false, failed, __func__);
+
+    // Stacking with a partially filled top and with a different chunk
+    other = stl_new(&int_interface);
+
+    if (!other)
+        goto error;
+
+    for (int32_t i = 0; i < 12; i++)
+    {
+        if (!stl_push(other, new_int32_t(top + i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, stl_stack(stack, other), __func__);
+    ut_equals_bool(ut, true, stl_empty(other), __func__);
+    ut_equals_integer_t(ut, top + 12, stl_count(stack), __func__);
+
+    for (int32_t i = top + 11; i >= 0; i--)
+    {
+        void *result;
+
+        if (!stl_pop(stack, &result))
+            goto error;
+
+        if (*(int32_t*)result != i)
+            failed = true;
+
+        free(result);
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+
+    // An empty stack takes every node
+    ut_equals_bool(ut, true, stl_stack(stack, copy), __func__);
+    ut_equals_integer_t(ut, top, stl_count(stack), __func__);
+    ut_equals_int(ut, top - 1, *(int32_t*)stl_peek(stack), __func__);
+
+    stl_free(stack);
+    stl_free(copy);
+    stl_free(other);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stack) stl_free(stack);
+    if (copy) stl_free(copy);
+    if (other) stl_free(other);
+}
+
 // Runs all StackList tests
 Status StackListTests(void)
 {
@@ -118,6 +244,7 @@ Status StackListTests(void)
 
     stl_test_limit(ut);
     stl_test_foreach(ut);
+    stl_test_chunk(ut);
 
     ut_report(ut, "StackList");
 
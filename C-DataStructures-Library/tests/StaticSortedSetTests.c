@@ -0,0 +1,301 @@
+/**
+ * @file StaticSortedSetTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "StaticSortedSet.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// State of sss_test_visit
+struct StaticSortedSetTest_s
+{
+    int64_t previous;
+    integer_t count;
+    bool ordered;
+};
+
+// Checks that elements are visited in strictly ascending order
+static void
+sss_test_visit(void *element, void *argument)
+{
+    struct StaticSortedSetTest_s *test = argument;
+
+    int64_t value = *(int64_t*)element;
+
+    if (test->count > 0 && value <= test->previous)
+        test->ordered = false;
+
+    test->previous = value;
+    test->count++;
+}
+
+// Index of the first value not smaller than query, or size if there is none
+static integer_t
+sss_test_lower_bound(const int64_t *values, integer_t size, int64_t query)
+{
+    integer_t i = 0;
+
+    while (i < size && values[i] < query)
+        i++;
+
+    return i;
+}
+
+// Checks contains, lower_bound and range of every layout with and without
+// inline keys, on keys with random gaps and on cubes, which are skewed
+// enough to make the interpolation fall back to bisection
+void sss_test_search(UnitTest ut)
+{
+    const integer_t sizes[] = { 0, 1, 2, 7, 8, 9, 100, 1000 };
+    const integer_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    int64_t *values = malloc(sizeof(int64_t) * 1000);
+    void **elements = malloc(sizeof(void*) * 1000);
+
+    StaticSortedSet_t *set = NULL;
+
+    if (!interface || !values || !elements)
+        goto error;
+
+    bool correct = true;
+
+    for (int layout = 0; layout < 2; layout++)
+    for (int inline_keys = 0; inline_keys < 2; inline_keys++)
+    for (int skewed = 0; skewed < 2; skewed++)
+    for (integer_t s = 0; s < sizes_count; s++)
+    {
+        integer_t size = sizes[s];
+
+        for (integer_t i = 0; i < size; i++)
+        {
+            values[i] = skewed ? (i - size / 2) * (i - size / 2)
+                                 * (i - size / 2)
+                               : 3 * i + rand() % 3;
+
+            elements[i] = new_int64_t(values[i]);
+        }
+
+        set = sss_from_sorted_array(interface,
+                                    inline_keys ? key_int64_t : NULL,
+                                    (SortedSetLayout)layout, elements, size);
+
+        if (layout == SortedSetInterpolation && !inline_keys)
+        {
+            ut_equals_bool(ut, true, set == NULL, __func__);
+
+            for (integer_t i = 0; i < size; i++)
+                free(elements[i]);
+
+            continue;
+        }
+
+        if (!set)
+            goto error;
+
+        correct = correct && sss_size(set) == size;
+
+        // Every element, its neighbours and a value before all of them
+        for (integer_t i = -1; i < size; i++)
+        {
+            for (int64_t d = -1; d <= 1; d++)
+            {
+                int64_t query = i < 0 ? INT64_MIN + 1 + d : values[i] + d;
+
+                integer_t expected = sss_test_lower_bound(values, size,
+                                                          query);
+
+                void *found = sss_lower_bound(set, &query);
+
+                if (expected == size)
+                    correct = correct && found == NULL;
+                else
+                    correct = correct && found
+                              && *(int64_t*)found == values[expected];
+
+                bool present = expected < size && values[expected] == query;
+
+                correct = correct && sss_contains(set, &query) == present;
+            }
+        }
+
+        if (size > 0)
+        {
+            integer_t a = size / 3, b = 2 * size / 3;
+
+            struct StaticSortedSetTest_s test = { 0, 0, true };
+
+            integer_t visited = sss_range(set, &values[a], &values[b],
+                                          sss_test_visit, &test);
+
+            correct = correct && test.ordered && visited == b - a + 1
+                      && test.count == visited;
+
+            test = (struct StaticSortedSetTest_s){ 0, 0, true };
+
+            sss_traversal(set, sss_test_visit, &test);
+
+            correct = correct && test.ordered && test.count == size;
+        }
+
+        sss_free(set);
+        set = NULL;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    free(values);
+    free(elements);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (set) sss_free(set);
+    free(values);
+    free(elements);
+    if (interface) interface_free(interface);
+}
+
+// Builds sets from unsorted arrays and from trees, checking that elements
+// are moved and that invalid input leaves the source untouched
+void sss_test_build(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    DynamicArray_t *array = interface ? dar_new(interface) : NULL;
+    AVLTree_t *tree = interface ? avl_new(interface) : NULL;
+
+    StaticSortedSet_t *set = NULL;
+
+    if (!interface || !array || !tree)
+        goto error;
+
+    // Unsorted input is rejected
+    void *unsorted[2] = { new_int64_t(2), new_int64_t(1) };
+
+    ut_equals_bool(ut, true, sss_from_sorted_array(interface, NULL,
+            SortedSetEytzinger, unsorted, 2) == NULL, __func__);
+
+    free(unsorted[0]);
+    free(unsorted[1]);
+
+    for (int64_t i = 0; i < 500; i++)
+    {
+        int64_t value = (i * 7919) % 500;
+
+        if (!dar_insert_back(array, new_int64_t(value))
+            || !avl_insert(tree, new_int64_t(value + 1000)))
+            goto error;
+    }
+
+    // A duplicate is rejected and leaves the array as it was
+    if (!dar_insert_back(array, new_int64_t(42)))
+        goto error;
+
+    ut_equals_bool(ut, true, sss_from_array(interface, key_int64_t,
+            SortedSetEytzinger, array) == NULL, __func__);
+    ut_equals_integer_t(ut, 501, dar_size(array), __func__);
+
+    void *duplicate = NULL;
+
+    if (!dar_remove_back(array, &duplicate))
+        goto error;
+
+    free(duplicate);
+
+    set = sss_from_array(interface, key_int64_t, SortedSetInterpolation,
+                         array);
+
+    if (!set)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, dar_size(array), __func__);
+    ut_equals_integer_t(ut, 500, sss_size(set), __func__);
+    ut_equals_bool(ut, true, sss_contains(set, &(int64_t){ 499 }), __func__);
+    ut_equals_bool(ut, false, sss_contains(set, &(int64_t){ 500 }),
+                   __func__);
+
+    sss_free(set);
+
+    set = sss_from_tree(interface, NULL, SortedSetEytzinger, tree);
+
+    if (!set)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, avl_size(tree), __func__);
+    ut_equals_integer_t(ut, 500, sss_size(set), __func__);
+    ut_equals_int(ut, 1000, (int)*(int64_t*)sss_lower_bound(set,
+            &(int64_t){ -5 }), __func__);
+    ut_equals_bool(ut, true, sss_lower_bound(set, &(int64_t){ 1500 })
+                             == NULL, __func__);
+
+    struct StaticSortedSetTest_s test = { 0, 0, true };
+
+    sss_traversal(set, sss_test_visit, &test);
+
+    ut_equals_bool(ut, true, test.ordered, __func__);
+    ut_equals_integer_t(ut, 500, test.count, __func__);
+
+    sss_free(set);
+
+    // Empty sources give empty sets
+    set = sss_from_tree(interface, key_int64_t, SortedSetEytzinger, tree);
+
+    if (!set)
+        goto error;
+
+    ut_equals_bool(ut, true, sss_empty(set), __func__);
+    ut_equals_bool(ut, false, sss_contains(set, &(int64_t){ 0 }), __func__);
+
+    sss_free(set);
+
+    dar_free(array);
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (set) sss_free(set);
+    if (array) dar_free(array);
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Runs all StaticSortedSet tests
+Status StaticSortedSetTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    sss_test_search(ut);
+    sss_test_build(ut);
+
+    ut_report(ut, "StaticSortedSet");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "StaticSortedSet");
+    ut_delete(&ut);
+    return st;
+}
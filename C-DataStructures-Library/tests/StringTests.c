@@ -0,0 +1,310 @@
+/**
+ * @file StringTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "CString.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Random edits around a moving position, checked against a plain buffer
+Status str_test_gap(UnitTest ut)
+{
+    String string = NULL;
+
+    char *model = malloc(sizeof(char) * 20000), *content = NULL;
+
+    Status st = str_init(&string);
+
+    if (st != DS_OK || !model)
+        goto error;
+
+    integer_t length = 0, position = 0;
+
+    bool equal = true;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        // Edits stay close to each other, like a cursor in a text editor
+        position += random_int32_t(-3, 3);
+
+        if (position < 0)
+            position = 0;
+
+        if (position > length)
+            position = length;
+
+        int op = random_int32_t(0, 3);
+
+        if (op == 0)
+        {
+            char ch = random_alpha();
+
+            st = str_push_char_at(string, ch, position);
+
+            memmove(model + position + 1, model + position,
+                    (size_t)(length - position));
+            model[position] = ch;
+            length++;
+        }
+        else if (op == 1)
+        {
+            char text[] = "abc";
+
+            st = str_push_at(string, text, position);
+
+            memmove(model + position + 3, model + position,
+                    (size_t)(length - position));
+            memcpy(model + position, text, 3);
+            length += 3;
+        }
+        else if (op == 2 && position < length)
+        {
+            st = str_pop_char_at(string, position);
+
+            memmove(model + position, model + position + 1,
+                    (size_t)(length - position - 1));
+            length--;
+        }
+        else if (op == 3 && position + 1 < length)
+        {
+            st = str_remove(string, position, position + 1);
+
+            memmove(model + position, model + position + 2,
+                    (size_t)(length - position - 2));
+            length -= 2;
+        }
+
+        if (st != DS_OK)
+            goto error;
+
+        if (i % 100 == 0 && length > 0)
+        {
+            st = str_get_string(string, &content);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (memcmp(content, model, (size_t)length) != 0)
+                equal = false;
+
+            free(content);
+            content = NULL;
+        }
+    }
+
+    ut_equals_integer_t(ut, length, str_length(string), __func__);
+
+    model[length] = '\0';
+
+    // Comparisons close the gap
+    ut_equals_bool(ut, true, str_equals_str(string, model), __func__);
+    ut_equals_bool(ut, true, equal, __func__);
+
+    str_delete(&string);
+    free(model);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (string) str_delete(&string);
+    free(model);
+    free(content);
+    return st;
+}
+
+// Tests slicing, searching and adding a string to itself
+Status str_test_search(UnitTest ut)
+{
+    String string = NULL, slice = NULL;
+
+    Status st = str_make(&string, "the quick brown fox");
+
+    if (st != DS_OK)
+        goto error;
+
+    integer_t pos;
+
+    st = str_push_at(string, "very ", 4);
+    st += str_find_substr(string, "quick", &pos);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 9, pos, __func__);
+    ut_equals_bool(ut, false, str_substr(string, "lazy dog"), __func__);
+
+    st = str_slice(string, &slice, 4, 13);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, str_equals_str(slice, "very quick"), __func__);
+    ut_equals_bool(ut, true, str_substring(string, slice), __func__);
+
+    st = str_append(slice, slice);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, str_equals_str(slice, "very quickvery quick"),
+                   __func__);
+
+    str_delete(&string);
+    str_delete(&slice);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (string) str_delete(&string);
+    if (slice) str_delete(&slice);
+    return st;
+}
+
+// Every search strategy, checked against a naive search
+Status str_test_find(UnitTest ut)
+{
+    String string = NULL;
+    StringSearcher searcher = NULL;
+
+    integer_t *found = NULL;
+
+    char text[3001], key[65];
+
+    const integer_t lengths[] = { 1, 2, 3, 8, 31, 32, 33, 64 };
+
+    Status st = str_init(&string);
+
+    if (st != DS_OK)
+        goto error;
+
+    bool equal = true;
+
+    for (int round = 0; round < 40; round++)
+    {
+        // A small alphabet gives many partial matches
+        for (int i = 0; i < 3000; i++)
+            text[i] = (char)random_int32_t('a', 'b');
+
+        text[3000] = '\0';
+
+        integer_t length = lengths[round % 8];
+
+        // Keys are mostly taken from the text so they are found
+        integer_t start = random_int32_t(0, 3000 - (int32_t)length);
+
+        memcpy(key, text + start, (size_t)length);
+
+        if (round % 5 == 0)
+            key[length - 1] = 'c';
+
+        key[length] = '\0';
+
+        st = str_clear(string);
+        st += str_push_back(string, text);
+        st += str_searcher_init(&searcher, key);
+
+        if (st != DS_OK)
+            goto error;
+
+        integer_t count;
+
+        st = str_searcher_find_all(searcher, string, &found, &count);
+
+        if (st != DS_OK)
+            goto error;
+
+        integer_t expected = 0;
+
+        for (integer_t i = 0; i + length <= 3000; i++)
+        {
+            if (memcmp(text + i, key, (size_t)length) == 0)
+            {
+                if (expected >= count || found[expected] != i)
+                    equal = false;
+
+                expected++;
+            }
+        }
+
+        if (expected != count)
+            equal = false;
+
+        integer_t pos;
+
+        st = str_searcher_find(searcher, string, 1500, &pos);
+
+        for (integer_t i = 0; i < count; i++)
+        {
+            if (found[i] >= 1500)
+            {
+                if (st != DS_OK || pos != found[i])
+                    equal = false;
+
+                break;
+            }
+        }
+
+        free(found);
+        found = NULL;
+
+        str_searcher_delete(&searcher);
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    integer_t count;
+
+    st = str_find_all(string, "c", &found, &count);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, count, __func__);
+
+    str_delete(&string);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (string) str_delete(&string);
+    if (searcher) str_searcher_delete(&searcher);
+    free(found);
+    return st;
+}
+
+// Runs all String tests
+Status StringTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    st += str_test_gap(ut);
+    st += str_test_search(ut);
+    st += str_test_find(ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_report(ut, "String");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "String");
+    ut_delete(&ut);
+    return st;
+}
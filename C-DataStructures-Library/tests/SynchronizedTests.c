@@ -0,0 +1,341 @@
+/**
+ * @file SynchronizedTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "Synchronized.h"
+#include "AVLTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// Amount of threads of each kind and of operations each one does
+#define SYN_TEST_THREADS 3
+#define SYN_TEST_OPERATIONS 20000
+
+// Both values are always equal outside of a write section
+struct SyncTestPair_s
+{
+    _Atomic(int64_t) first;
+    _Atomic(int64_t) second;
+};
+
+// Inserts keys id, id + SYN_TEST_THREADS, ... in the protected tree
+static void *
+syn_test_writer(void *argument)
+{
+    Synchronized_t *sync = ((void**)argument)[0];
+    int64_t id = (int64_t)(intptr_t)((void**)argument)[1];
+
+    for (int64_t i = 0; i < SYN_TEST_OPERATIONS; i++)
+    {
+        void *element = new_int64_t(i * SYN_TEST_THREADS + id);
+
+        bool inserted;
+
+        SYN_WRITE(sync, inserted = avl_insert(syn_target(sync), element));
+
+        if (!inserted)
+            free(element);
+    }
+
+    return NULL;
+}
+
+// Does groups of lookups under a single read section, the tree never has a
+// key without also having the smaller keys of the same writer
+static void *
+syn_test_reader(void *argument)
+{
+    Synchronized_t *sync = argument;
+
+    bool *correct = malloc(sizeof(bool));
+
+    *correct = true;
+
+    for (int64_t i = 0; i < SYN_TEST_OPERATIONS / 10; i++)
+    {
+        SYN_READ(sync, {
+            AVLTree_t *tree = syn_target(sync);
+
+            for (int64_t key = 0; key < 8; key++)
+            {
+                int64_t next = key + SYN_TEST_THREADS;
+
+                if (avl_contains(tree, &next) && !avl_contains(tree, &key))
+                    *correct = false;
+            }
+        });
+    }
+
+    return correct;
+}
+
+// Keeps both values of the pair equal and increasing
+static void *
+syn_test_pair_writer(void *argument)
+{
+    Synchronized_t *sync = argument;
+
+    struct SyncTestPair_s *pair = syn_target(sync);
+
+    for (int64_t i = 0; i < SYN_TEST_OPERATIONS; i++)
+    {
+        SYN_WRITE(sync, {
+            atomic_fetch_add_explicit(&pair->first, 1, memory_order_relaxed);
+            atomic_fetch_add_explicit(&pair->second, 1, memory_order_relaxed);
+        });
+    }
+
+    return NULL;
+}
+
+// Announces itself and then reads while the main thread holds the lock
+static void *
+syn_test_blocked_reader(void *argument)
+{
+    Synchronized_t *sync = argument;
+
+    struct SyncTestPair_s *pair = syn_target(sync);
+
+    atomic_store(&pair->second, 1);
+
+    SYN_READ(sync, atomic_load(&pair->first));
+
+    return NULL;
+}
+
+// Many writers and readers share an AVLTree_s
+void syn_test_rwlock(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+
+    Synchronized_t *sync = syn_new(tree);
+
+    if (!interface || !tree || !sync)
+        goto error;
+
+    ut_equals_bool(ut, true, syn_target(sync) == tree, __func__);
+
+    pthread_t writers[SYN_TEST_THREADS], readers[SYN_TEST_THREADS];
+    void *arguments[SYN_TEST_THREADS][2];
+
+    for (intptr_t i = 0; i < SYN_TEST_THREADS; i++)
+    {
+        arguments[i][0] = sync;
+        arguments[i][1] = (void*)i;
+
+        pthread_create(&writers[i], NULL, syn_test_writer, arguments[i]);
+        pthread_create(&readers[i], NULL, syn_test_reader, sync);
+    }
+
+    bool correct = true;
+
+    for (integer_t i = 0; i < SYN_TEST_THREADS; i++)
+    {
+        void *result;
+
+        pthread_join(writers[i], NULL);
+        pthread_join(readers[i], &result);
+
+        correct = correct && *(bool*)result;
+
+        free(result);
+    }
+
+    SyncStats_t stats = syn_stats(sync);
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, SYN_TEST_THREADS * SYN_TEST_OPERATIONS,
+                        avl_size(tree), __func__);
+    ut_equals_unsigned_t(ut, SYN_TEST_THREADS * SYN_TEST_OPERATIONS,
+                         stats.writes, __func__);
+    ut_equals_unsigned_t(ut, SYN_TEST_THREADS * SYN_TEST_OPERATIONS / 10,
+                         stats.reads, __func__);
+    ut_equals_bool(ut, true, stats.write_max <= stats.write_time, __func__);
+    ut_equals_bool(ut, true, stats.read_max <= stats.read_time, __func__);
+
+    syn_reset_stats(sync);
+    syn_set_timing(sync, false);
+
+    SYN_READ(sync, avl_size(tree));
+
+    stats = syn_stats(sync);
+
+    ut_equals_unsigned_t(ut, 1, stats.reads, __func__);
+    ut_equals_unsigned_t(ut, 0, stats.read_time, __func__);
+    ut_equals_unsigned_t(ut, 0, stats.writes, __func__);
+
+    syn_free(sync);
+    avl_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (sync) syn_free(sync);
+    if (tree) avl_free(tree);
+    if (interface) interface_free(interface);
+}
+
+// Optimistic reads fail when they overlap a writer and never see a half
+// written pair when validated
+void syn_test_optimistic(UnitTest ut)
+{
+    struct SyncTestPair_s pair;
+
+    atomic_init(&pair.first, 0);
+    atomic_init(&pair.second, 0);
+
+    Synchronized_t *sync = syn_new(&pair);
+
+    if (!sync)
+        goto error;
+
+    unsigned_t sequence = syn_optimistic_begin(sync);
+
+    ut_equals_bool(ut, true, syn_optimistic_validate(sync, sequence),
+                   __func__);
+
+    sequence = syn_optimistic_begin(sync);
+
+    SYN_WRITE(sync, atomic_store(&pair.first, 0));
+
+    ut_equals_bool(ut, false, syn_optimistic_validate(sync, sequence),
+                   __func__);
+
+    pthread_t writer;
+
+    pthread_create(&writer, NULL, syn_test_pair_writer, sync);
+
+    bool correct = true;
+
+    int64_t last = 0;
+
+    for (integer_t i = 0; i < SYN_TEST_OPERATIONS; i++)
+    {
+        int64_t first, second;
+
+        SYN_OPTIMISTIC(sync, {
+            first = atomic_load_explicit(&pair.first, memory_order_relaxed);
+            second = atomic_load_explicit(&pair.second, memory_order_relaxed);
+        });
+
+        if (first != second || first < last)
+            correct = false;
+
+        last = first;
+    }
+
+    pthread_join(writer, NULL);
+
+    SyncStats_t stats = syn_stats(sync);
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_unsigned_t(ut, SYN_TEST_OPERATIONS + 1, stats.optimistic,
+                         __func__);
+    ut_equals_bool(ut, true, stats.retries >= 1, __func__);
+
+    syn_free(sync);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Only sections that find the lock taken are counted as waits
+void syn_test_waits(UnitTest ut)
+{
+    struct SyncTestPair_s pair;
+
+    atomic_init(&pair.first, 0);
+    atomic_init(&pair.second, 0);
+
+    Synchronized_t *sync = syn_new(&pair);
+
+    if (!sync)
+        goto error;
+
+    SYN_READ(sync, atomic_load(&pair.first));
+    SYN_WRITE(sync, atomic_store(&pair.first, 1));
+
+    SyncStats_t stats = syn_stats(sync);
+
+    ut_equals_unsigned_t(ut, 0, stats.waits, __func__);
+    ut_equals_unsigned_t(ut, 0, stats.wait_time, __func__);
+
+    syn_write_begin(sync);
+
+    pthread_t reader;
+
+    pthread_create(&reader, NULL, syn_test_blocked_reader, sync);
+
+    while (atomic_load(&pair.second) == 0)
+        continue;
+
+    // Gives the reader time to find the lock taken
+    struct timespec delay = { 0, 20000000 };
+
+    nanosleep(&delay, NULL);
+
+    syn_write_end(sync);
+
+    pthread_join(reader, NULL);
+
+    stats = syn_stats(sync);
+
+    ut_equals_unsigned_t(ut, 2, stats.reads, __func__);
+    ut_equals_unsigned_t(ut, 1, stats.waits, __func__);
+    ut_equals_bool(ut, true, stats.wait_time > 0, __func__);
+
+    syn_reset_stats(sync);
+
+    ut_equals_unsigned_t(ut, 0, syn_stats(sync).waits, __func__);
+
+    syn_free(sync);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Runs all Synchronized tests
+Status SynchronizedTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    syn_test_rwlock(ut);
+    syn_test_optimistic(ut);
+    syn_test_waits(ut);
+
+    ut_report(ut, "Synchronized");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Synchronized");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file ThreadPoolTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ThreadPool.h"
+#include "UnitTest.h"
+
+// Each task writes to its own slot so no synchronization is needed
+static void
+tpl_test_task(void *argument)
+{
+    integer_t *slot = argument;
+
+    *slot += 1;
+}
+
+// Submits more tasks than the initial queue capacity and waits for all
+void tpl_test_submit(UnitTest ut)
+{
+    const integer_t tasks = 1000;
+
+    integer_t *slots = calloc((size_t)tasks, sizeof(integer_t));
+
+    ThreadPool_t *pool = tpl_new(4);
+
+    if (!slots || !pool)
+        goto error;
+
+    ut_equals_integer_t(ut, 4, tpl_threads(pool), __func__);
+
+    for (integer_t i = 0; i < tasks; i++)
+    {
+        if (!tpl_submit(pool, tpl_test_task, &slots[i]))
+            goto error;
+    }
+
+    tpl_wait(pool);
+
+    ut_equals_integer_t(ut, 0, tpl_pending(pool), __func__);
+
+    bool all = true;
+
+    for (integer_t i = 0; i < tasks; i++)
+    {
+        if (slots[i] != 1)
+            all = false;
+    }
+
+    ut_equals_bool(ut, true, all, __func__);
+
+    tpl_free(pool);
+    free(slots);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (pool) tpl_free(pool);
+    free(slots);
+}
+
+// The same pool is used for many batches
+void tpl_test_reuse(UnitTest ut)
+{
+    const integer_t tasks = 64;
+    const integer_t batches = 50;
+
+    integer_t *slots = calloc((size_t)tasks, sizeof(integer_t));
+
+    ThreadPool_t *pool = tpl_new(3);
+
+    if (!slots || !pool)
+        goto error;
+
+    for (integer_t b = 0; b < batches; b++)
+    {
+        for (integer_t i = 0; i < tasks; i++)
+        {
+            if (!tpl_submit(pool, tpl_test_task, &slots[i]))
+                goto error;
+        }
+
+        tpl_wait(pool);
+    }
+
+    bool all = true;
+
+    for (integer_t i = 0; i < tasks; i++)
+    {
+        if (slots[i] != batches)
+            all = false;
+    }
+
+    ut_equals_bool(ut, true, all, __func__);
+
+    tpl_free(pool);
+    free(slots);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (pool) tpl_free(pool);
+    free(slots);
+}
+
+// Invalid thread counts and freeing a pool with queued tasks
+void tpl_test_new_free(UnitTest ut)
+{
+    const integer_t tasks = 200;
+
+    integer_t *slots = calloc((size_t)tasks, sizeof(integer_t));
+
+    if (!slots)
+        goto error;
+
+    ut_equals_bool(ut, true, tpl_new(0) == NULL, __func__);
+    ut_equals_bool(ut, true, tpl_new(-1) == NULL, __func__);
+
+    ThreadPool_t *pool = tpl_new(2);
+
+    if (!pool)
+        goto error;
+
+    for (integer_t i = 0; i < tasks; i++)
+        tpl_submit(pool, tpl_test_task, &slots[i]);
+
+    // Every queued task still runs
+    tpl_free(pool);
+
+    bool all = true;
+
+    for (integer_t i = 0; i < tasks; i++)
+    {
+        if (slots[i] != 1)
+            all = false;
+    }
+
+    ut_equals_bool(ut, true, all, __func__);
+
+    free(slots);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(slots);
+}
+
+// Runs all ThreadPool tests
+Status ThreadPoolTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    tpl_test_submit(ut);
+    tpl_test_reuse(ut);
+    tpl_test_new_free(ut);
+
+    ut_report(ut, "ThreadPool");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ThreadPool");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file TimerWheelTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "TimerWheel.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+struct twl_timer
+{
+    int64_t id;
+    TimerHook_t timer;
+};
+
+// Schedules, cancels and expires a few timers
+void twl_test_IO0(UnitTest ut)
+{
+    struct twl_timer timers[5] = {{0}};
+
+    IntrusiveList_t expired;
+
+    ilt_init(&expired, offsetof(struct twl_timer, timer));
+
+    TimerWheel_t *wheel = twl_new(offsetof(struct twl_timer, timer), 1000);
+
+    if (!wheel)
+        goto error;
+
+    uint64_t deadlines[5] = { 1010, 1005, 5000, 1000000, 1005 };
+
+    for (int64_t i = 0; i < 5; i++)
+    {
+        timers[i].id = i;
+        twl_schedule(wheel, &timers[i], deadlines[i]);
+    }
+
+    ut_equals_integer_t(ut, 5, twl_count(wheel), __func__);
+    ut_equals_bool(ut, true, twl_scheduled(wheel, &timers[3]), __func__);
+
+    // Cancelled timers never expire
+    ut_equals_bool(ut, true, twl_cancel(wheel, &timers[4]), __func__);
+    ut_equals_bool(ut, false, twl_cancel(wheel, &timers[4]), __func__);
+
+    ut_equals_integer_t(ut, 0, twl_advance(wheel, 1004, &expired), __func__);
+    ut_equals_integer_t(ut, 2, twl_advance(wheel, 1010, &expired), __func__);
+
+    struct twl_timer *first = ilt_remove_head(&expired);
+    struct twl_timer *second = ilt_remove_head(&expired);
+
+    ut_equals_int(ut, 1, (int)first->id, __func__);
+    ut_equals_int(ut, 0, (int)second->id, __func__);
+    ut_equals_bool(ut, false, twl_scheduled(wheel, first), __func__);
+
+    // Rescheduling moves the timer
+    twl_schedule(wheel, &timers[3], 2000);
+    twl_schedule(wheel, first, 900);
+
+    ut_equals_integer_t(ut, 3, twl_count(wheel), __func__);
+    ut_equals_integer_t(ut, 2, twl_advance(wheel, 2000, &expired), __func__);
+    ut_equals_int(ut, 1, (int)((struct twl_timer *)
+            ilt_remove_head(&expired))->id, __func__);
+    ut_equals_int(ut, 3, (int)((struct twl_timer *)
+            ilt_remove_head(&expired))->id, __func__);
+
+    ut_equals_integer_t(ut, 1, twl_advance(wheel, UINT64_MAX, &expired),
+                        __func__);
+    ut_equals_bool(ut, true, twl_now(wheel) == UINT64_MAX, __func__);
+    ut_equals_bool(ut, true, twl_empty(wheel), __func__);
+
+    ilt_clear(&expired);
+    twl_free(wheel);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Timers scheduled in the past expire in the order of their deadlines
+void twl_test_overdue(UnitTest ut)
+{
+    struct twl_timer timers[4] = {{0}};
+
+    IntrusiveList_t expired;
+
+    ilt_init(&expired, offsetof(struct twl_timer, timer));
+
+    TimerWheel_t *wheel = twl_new(offsetof(struct twl_timer, timer), 100);
+
+    if (!wheel)
+        goto error;
+
+    uint64_t deadlines[4] = { 99, 97, 100, 98 };
+
+    for (int64_t i = 0; i < 4; i++)
+    {
+        timers[i].id = i;
+        twl_schedule(wheel, &timers[i], deadlines[i]);
+    }
+
+    ut_equals_integer_t(ut, 4, twl_advance(wheel, 101, &expired), __func__);
+
+    int order[4] = { 1, 3, 0, 2 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        struct twl_timer *timer = ilt_remove_head(&expired);
+
+        ut_equals_int(ut, order[i], (int)timer->id, __func__);
+    }
+
+    ut_equals_bool(ut, true, twl_empty(wheel), __func__);
+
+    twl_free(wheel);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Random deadlines at every level, checked against their expected expiration
+void twl_test_random(UnitTest ut)
+{
+    struct twl_timer *timers = calloc(2000, sizeof(struct twl_timer));
+
+    TimerWheel_t *wheel = twl_new(offsetof(struct twl_timer, timer), 0);
+
+    if (!timers || !wheel)
+        goto error;
+
+    IntrusiveList_t expired;
+
+    ilt_init(&expired, offsetof(struct twl_timer, timer));
+
+    bool failed = false;
+    integer_t pending = 0;
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        uint64_t range = (uint64_t)1 << (random_uint32_t(0, 40));
+
+        timers[i].id = i;
+
+        twl_schedule(wheel, &timers[i], random_uint64_t(0, range));
+
+        // A quarter of the timers is cancelled
+        if (i % 4 == 0)
+            twl_cancel(wheel, &timers[i]);
+        else
+            pending++;
+    }
+
+    ut_equals_integer_t(ut, pending, twl_count(wheel), __func__);
+
+    uint64_t previous = 0, now = 0;
+
+    while (!twl_empty(wheel))
+    {
+        now += random_uint64_t(0, (uint64_t)1 << (random_uint32_t(0, 36)));
+
+        twl_advance(wheel, now, &expired);
+
+        uint64_t last = 0;
+
+        struct twl_timer *timer;
+
+        while ((timer = ilt_remove_head(&expired)) != NULL)
+        {
+            uint64_t deadline = timer->timer.deadline;
+
+            // Expired in this batch, in order, and never cancelled
+            if (deadline > now || (deadline <= previous && previous > 0) ||
+                deadline < last || timer->id % 4 == 0)
+                failed = true;
+
+            last = deadline;
+            pending--;
+        }
+
+        previous = now;
+    }
+
+    ut_equals_bool(ut, false, failed, __func__);
+    ut_equals_integer_t(ut, 0, pending, __func__);
+
+    twl_free(wheel);
+    free(timers);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (wheel) twl_free(wheel);
+    free(timers);
+}
+
+// Runs all TimerWheel tests
+Status TimerWheelTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    twl_test_IO0(ut);
+    twl_test_overdue(ut);
+    twl_test_random(ut);
+
+    ut_report(ut, "TimerWheel");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "TimerWheel");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file TopKTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "TopK.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+static int
+tpk_test_compare(const void *element1, const void *element2)
+{
+    return compare_int64_t(element2, element1);
+}
+
+// Checks that an array holds the highest values of the stream in order
+static bool
+tpk_test_matches(void **array, integer_t length, int64_t *stream,
+                 integer_t size)
+{
+    qsort(stream, (size_t)size, sizeof(int64_t), tpk_test_compare);
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        if (*(int64_t *)array[i] != stream[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Keeps the highest elements of a long stream in a fixed amount of memory
+void tpk_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    TopK_t *topk = interface ? tpk_new(interface, 100) : NULL;
+
+    int64_t *stream = malloc(sizeof(int64_t) * 50000);
+
+    void **array = NULL;
+    integer_t length = 0;
+
+    if (!interface || !topk || !stream)
+        goto error;
+
+    ut_equals_bool(ut, true, tpk_new(interface, 0) == NULL, __func__);
+
+    for (integer_t i = 0; i < 50000; i++)
+    {
+        stream[i] = random_int64_t(0, 1000000);
+
+        if (tpk_admits(topk, &stream[i]))
+            tpk_insert(topk, new_int64_t(stream[i]));
+    }
+
+    ut_equals_bool(ut, true, tpk_full(topk), __func__);
+    ut_equals_integer_t(ut, 100, tpk_count(topk), __func__);
+
+    // The lowest element kept is rejected, so nothing is allocated for it
+    int64_t lowest = *(int64_t *)tpk_peek(topk);
+
+    ut_equals_bool(ut, false, tpk_admits(topk, &lowest), __func__);
+    ut_equals_bool(ut, false, tpk_insert(topk, new_int64_t(lowest)),
+                   __func__);
+
+    array = tpk_to_array(topk, &length);
+
+    if (!array)
+        goto error;
+
+    ut_equals_integer_t(ut, 100, length, __func__);
+    ut_equals_bool(ut, true, tpk_test_matches(array, length, stream, 50000),
+                   __func__);
+    ut_equals_bool(ut, true, lowest == *(int64_t *)array[99], __func__);
+
+    for (integer_t i = 0; i < length; i++)
+        free(array[i]);
+
+    free(array);
+
+    tpk_erase(topk);
+
+    ut_equals_bool(ut, true, tpk_empty(topk), __func__);
+    ut_equals_bool(ut, true, tpk_to_array(topk, &length) == NULL, __func__);
+
+    free(stream);
+    tpk_free(topk);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(stream);
+    if (topk) tpk_free(topk);
+    if (interface) interface_free(interface);
+}
+
+// A container per thread gives the same result once merged
+void tpk_test_merge(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    TopK_t *topk[4] = { NULL, NULL, NULL, NULL };
+
+    int64_t *stream = malloc(sizeof(int64_t) * 40000);
+
+    void **array = NULL;
+    integer_t length = 0;
+
+    if (!interface || !stream)
+        goto error;
+
+    for (integer_t i = 0; i < 4; i++)
+    {
+        topk[i] = tpk_new(interface, 50);
+
+        if (!topk[i])
+            goto error;
+    }
+
+    for (integer_t i = 0; i < 40000; i++)
+    {
+        stream[i] = random_int64_t(-1000000, 1000000);
+
+        tpk_insert(topk[i % 4], new_int64_t(stream[i]));
+    }
+
+    ut_equals_bool(ut, false, tpk_merge(topk[0], topk[0]), __func__);
+
+    for (integer_t i = 1; i < 4; i++)
+    {
+        ut_equals_bool(ut, true, tpk_merge(topk[0], topk[i]), __func__);
+        ut_equals_bool(ut, true, tpk_empty(topk[i]), __func__);
+    }
+
+    ut_equals_integer_t(ut, 40000, (integer_t)tpk_seen(topk[0]), __func__);
+
+    array = tpk_to_array(topk[0], &length);
+
+    if (!array)
+        goto error;
+
+    ut_equals_integer_t(ut, 50, length, __func__);
+    ut_equals_bool(ut, true, tpk_test_matches(array, length, stream, 40000),
+                   __func__);
+
+    for (integer_t i = 0; i < length; i++)
+        free(array[i]);
+
+    free(array);
+
+    free(stream);
+    for (integer_t i = 0; i < 4; i++)
+        tpk_free(topk[i]);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(stream);
+    for (integer_t i = 0; i < 4; i++)
+        if (topk[i]) tpk_free(topk[i]);
+    if (interface) interface_free(interface);
+}
+
+// Runs all TopK tests
+Status TopKTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    tpk_test_IO(ut);
+    tpk_test_merge(ut);
+
+    ut_report(ut, "TopK");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "TopK");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file TraceTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "DynamicArray.h"
+#include "Heap.h"
+#include "Trace.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// What the callback saw
+struct trc_test_events
+{
+    integer_t entries;
+    integer_t returns;
+    integer_t grows;
+    integer_t capacity;
+};
+
+static void trc_test_callback(const char *probe, TracePoint point,
+                              integer_t value, void *argument)
+{
+    struct trc_test_events *events = argument;
+
+    if (point == TraceEntry)
+        events->entries++;
+    else
+        events->returns++;
+
+    if (point == TraceReturn && strcmp(probe, "dar_grow") == 0)
+    {
+        events->grows++;
+        events->capacity = value;
+    }
+}
+
+// Every entry has a matching return and growth events report the capacity
+void trc_test_callback_calls(UnitTest ut)
+{
+    struct trc_test_events events = { 0, 0, 0, 0 };
+
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_create(interface, 4, 200);
+    Heap_t *heap = hep_new(interface, MinHeap);
+
+    if (!interface || !array || !heap)
+        goto error;
+
+    bool enabled = trc_set(trc_test_callback, &events);
+
+    ut_equals_bool(ut, trc_enabled(), enabled, __func__);
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!dar_insert_back(array, new_int32_t(i)))
+            goto error;
+
+        if (!hep_insert(heap, new_int32_t(i)))
+            goto error;
+    }
+
+    trc_set(NULL, NULL);
+
+    // Not seen by the callback anymore
+    if (!hep_insert(heap, new_int32_t(100)))
+        goto error;
+
+    if (enabled)
+    {
+        ut_equals_bool(ut, true, events.entries >= 100, __func__);
+        ut_equals_integer_t(ut, events.entries, events.returns, __func__);
+        ut_equals_bool(ut, true, events.grows > 0, __func__);
+        ut_equals_integer_t(ut, dar_capacity(array), events.capacity,
+                            __func__);
+    }
+    else
+    {
+        ut_equals_integer_t(ut, 0, events.entries + events.returns, __func__);
+    }
+
+    dar_free(array);
+    hep_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    trc_set(NULL, NULL);
+    if (array) dar_free(array);
+    if (heap) hep_free(heap);
+    if (interface) interface_free(interface);
+}
+
+// Runs all Trace tests
+Status TraceTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    trc_test_callback_calls(ut);
+
+    ut_report(ut, "Trace");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Trace");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,331 @@
+/**
+ * @file TypedContainerTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "TypedDynamicArray.h"
+#include "TypedHashMap.h"
+#include "TypedHeap.h"
+#include "TypedRedBlackTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+#define TCT_HASH(x) ((unsigned_t)(x) * 2654435761u)
+
+DS_DEFINE_DYNAMICARRAY(tct_array, int64_t, DS_COMPARE_NUMBER)
+
+DS_DEFINE_HEAP(tct_heap, int64_t, DS_COMPARE_NUMBER)
+
+DS_DEFINE_REDBLACKTREE(tct_tree, int64_t, DS_COMPARE_NUMBER)
+
+DS_DEFINE_HASHMAP(tct_map, int64_t, int64_t, TCT_HASH, DS_COMPARE_NUMBER)
+
+// Returns the black height of a subtree or -1 if it breaks any red-black tree
+// property
+static integer_t
+tct_black_height(tct_tree_node_t *node)
+{
+    if (node == NULL)
+        return 1;
+
+    if (node->red && (tct_tree_is_red(node->left) ||
+                      tct_tree_is_red(node->right)))
+        return -1;
+
+    if (node->left && (node->left->parent != node ||
+                       node->left->key >= node->key))
+        return -1;
+
+    if (node->right && (node->right->parent != node ||
+                        node->right->key <= node->key))
+        return -1;
+
+    integer_t L = tct_black_height(node->left);
+    integer_t R = tct_black_height(node->right);
+
+    if (L < 0 || L != R)
+        return -1;
+
+    return L + (node->red ? 0 : 1);
+}
+
+// Checks insertions, removals and sorting of the typed dynamic array
+void tct_test_array(UnitTest ut)
+{
+    const int64_t elements = 10000;
+
+    tct_array_t *array = tct_array_create(4, 150);
+
+    if (!array)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!tct_array_insert_back(array, random_int64_t(-elements, elements)))
+            goto error;
+    }
+
+    if (!tct_array_insert_at(array, elements * 2, 0))
+        goto error;
+
+    tct_array_sort(array);
+
+    int64_t *data = tct_array_data(array);
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < tct_array_size(array); i++)
+    {
+        if (data[i - 1] > data[i])
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_integer_t(ut, elements,
+                        tct_array_index_first(array, elements * 2), __func__);
+
+    int64_t value;
+
+    if (!tct_array_remove_back(array, &value))
+        goto error;
+
+    ut_equals_bool(ut, true, value == elements * 2, __func__);
+    ut_equals_bool(ut, false, tct_array_contains(array, elements * 2),
+                   __func__);
+
+    if (!tct_array_remove_at(array, 0, &value))
+        goto error;
+
+    ut_equals_integer_t(ut, elements - 1, tct_array_size(array), __func__);
+    ut_equals_bool(ut, false, tct_array_get(array, elements, &value), __func__);
+
+    tct_array_free(array);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) tct_array_free(array);
+}
+
+// Checks if when removed, the elements are sorted for both MinHeap and MaxHeap
+void tct_test_heap(UnitTest ut)
+{
+    const int64_t elements = 10000;
+
+    enum HeapKind_e K[2] = {MaxHeap, MinHeap};
+
+    tct_heap_t *heap = NULL;
+
+    for (int k = 0; k < 2; k++)
+    {
+        heap = tct_heap_create(4, 150, K[k]);
+
+        if (!heap)
+            goto error;
+
+        int64_t sum0 = 0, sum1 = 0;
+
+        for (int64_t i = 0; i < elements; i++)
+        {
+            int64_t value = random_int64_t(-elements, elements);
+
+            sum0 += value;
+
+            if (!tct_heap_insert(heap, value))
+                goto error;
+        }
+
+        ut_equals_integer_t(ut, elements, tct_heap_count(heap), __func__);
+
+        bool sorted = true;
+        int64_t previous, value;
+
+        if (!tct_heap_remove(heap, &previous))
+            goto error;
+
+        sum1 += previous;
+
+        while (tct_heap_remove(heap, &value))
+        {
+            if ((value - previous) * K[k] > 0)
+                sorted = false;
+
+            sum1 += value;
+            previous = value;
+        }
+
+        ut_equals_bool(ut, true, sorted, __func__);
+        ut_equals_bool(ut, true, sum0 == sum1, __func__);
+        ut_equals_bool(ut, false, tct_heap_peek(heap, &value), __func__);
+
+        tct_heap_free(heap);
+        heap = NULL;
+    }
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) tct_heap_free(heap);
+}
+
+// Checks that the red-black tree properties hold after insertions and
+// removals
+void tct_test_tree(UnitTest ut)
+{
+    const int64_t elements = 5000;
+
+    tct_tree_t *tree = tct_tree_new();
+
+    if (!tree)
+        goto error;
+
+    integer_t size = 0;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (tct_tree_insert(tree, random_int64_t(0, elements)))
+            size++;
+    }
+
+    ut_equals_integer_t(ut, size, tct_tree_size(tree), __func__);
+    ut_equals_bool(ut, true, tct_black_height(tree->root) > 0, __func__);
+    ut_equals_bool(ut, false, tct_tree_is_red(tree->root), __func__);
+
+    bool valid = true;
+
+    for (int64_t i = 0; i <= elements; i++)
+    {
+        bool present = tct_tree_contains(tree, i);
+
+        if (tct_tree_remove(tree, i) != present)
+            valid = false;
+
+        if (present)
+            size--;
+
+        if (i % 100 == 0 && tct_black_height(tree->root) < 0)
+            valid = false;
+    }
+
+    ut_equals_bool(ut, true, valid, __func__);
+    ut_equals_integer_t(ut, 0, size, __func__);
+    ut_equals_bool(ut, true, tct_tree_empty(tree), __func__);
+
+    for (int64_t i = 0; i < 100; i++)
+        tct_tree_insert(tree, i);
+
+    int64_t min, max;
+
+    if (!tct_tree_min(tree, &min) || !tct_tree_max(tree, &max))
+        goto error;
+
+    ut_equals_bool(ut, true, min == 0 && max == 99, __func__);
+    ut_equals_bool(ut, false, tct_tree_insert(tree, 50), __func__);
+
+    tct_tree_free(tree);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (tree) tct_tree_free(tree);
+}
+
+// Checks insertions, searches and removals of the typed hash map
+void tct_test_map(UnitTest ut)
+{
+    const int64_t elements = 10000;
+
+    tct_map_t *map = tct_map_new();
+
+    if (!map)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!tct_map_insert(map, i, i * 3))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, elements, tct_map_count(map), __func__);
+    ut_equals_bool(ut, false, tct_map_insert(map, 10, 0), __func__);
+
+    bool found = true;
+    int64_t value;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!tct_map_get(map, i, &value) || value != i * 3)
+            found = false;
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    // Remove all even keys
+    for (int64_t i = 0; i < elements; i += 2)
+    {
+        if (!tct_map_remove(map, i, NULL))
+            goto error;
+    }
+
+    bool correct = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (tct_map_contains(map, i) != (i % 2 == 1))
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_integer_t(ut, elements / 2, tct_map_count(map), __func__);
+
+    tct_map_erase(map);
+
+    ut_equals_bool(ut, true, tct_map_empty(map), __func__);
+    ut_equals_bool(ut, false, tct_map_get(map, 1, &value), __func__);
+
+    tct_map_free(map);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (map) tct_map_free(map);
+}
+
+// Runs all TypedContainer tests
+Status TypedContainerTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    tct_test_array(ut);
+    tct_test_heap(ut);
+    tct_test_tree(ut);
+    tct_test_map(ut);
+
+    ut_report(ut, "TypedContainer");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "TypedContainer");
+    ut_delete(&ut);
+    return st;
+}
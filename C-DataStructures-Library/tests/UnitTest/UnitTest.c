@@ -44,8 +44,8 @@ void ut_report(UnitTest ut, const char *struct_name)
     printf("|                  UnitTest Report                 |\n");
     printf("+--------------------------------------------------+\n");
     printf("  Name   : %s\n", struct_name);
-    printf("  Total  : %" PRIdMAX "\n", ut->total);
-    printf("  Passed : %" PRIdMAX "\n\n", ut->passed);
+    printf("  Total  : %" DS_PRI_INTEGER "\n", ut->total);
+    printf("  Passed : %" DS_PRI_INTEGER "\n\n", ut->passed);
 }
 
 void ut_equals_bool(UnitTest ut, bool param1, bool param2,
@@ -96,8 +96,8 @@ void ut_equals_integer_t(UnitTest ut, integer_t param1, integer_t param2,
     }
     else
     {
-        printf("%-40s FAILED ! { %" PRIdMAX ", %" PRIdMAX " }\n", test_name,
-                param1, param2);
+        printf("%-40s FAILED ! { %" DS_PRI_INTEGER ", %" DS_PRI_INTEGER " }\n",
+               test_name, param1, param2);
     }
 
     ut->total++;
@@ -0,0 +1,174 @@
+/**
+ * @file UtilityTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Checks hash_siphash against the reference implementation
+void utl_test_siphash(UnitTest ut)
+{
+    uint8_t key[16], message[64];
+
+    for (int i = 0; i < 16; i++)
+        key[i] = (uint8_t)i;
+
+    for (int i = 0; i < 64; i++)
+        message[i] = (uint8_t)i;
+
+    uint64_t k0 = 0, k1 = 0;
+
+    for (int i = 7; i >= 0; i--)
+    {
+        k0 = (k0 << 8) | key[i];
+        k1 = (k1 << 8) | key[i + 8];
+    }
+
+    ut_equals_bool(ut, true, hash_siphash(message, 0, k0, k1) ==
+                   UINT64_C(0x726fdb47dd0e0e31), __func__);
+    ut_equals_bool(ut, true, hash_siphash(message, 15, k0, k1) ==
+                   UINT64_C(0xa129ca6149be45e5), __func__);
+    ut_equals_bool(ut, true, hash_siphash(message, 63, k0, k1) ==
+                   UINT64_C(0x958a324ceb064572), __func__);
+
+    // The process-wide key only changes hash_string_keyed()
+    hash_keyed_seed(k0, k1);
+
+    ut_equals_bool(ut, true, hash_string_keyed("abc") ==
+                   hash_siphash("abc", 3, k0, k1), __func__);
+
+    hash_keyed_seed(k1, k0);
+
+    ut_equals_bool(ut, false, hash_string_keyed("abc") ==
+                   hash_siphash("abc", 3, k0, k1), __func__);
+}
+
+// Every length up to 256 bytes, every single-bit change and a few seeds give
+// different hashes and flip about half of the bits
+void utl_test_hash_bytes(UnitTest ut)
+{
+    uint8_t data[256];
+
+    for (int i = 0; i < 256; i++)
+        data[i] = (uint8_t)random_uint32_t(0, 255);
+
+    uint64_t hashes[257];
+
+    bool distinct = true, stable = true;
+
+    for (size_t length = 0; length <= 256; length++)
+    {
+        hashes[length] = hash_bytes(data, length);
+
+        if (hashes[length] != hash_bytes_seeded(data, length, 0))
+            stable = false;
+
+        for (size_t i = 0; i < length; i++)
+            if (hashes[i] == hashes[length])
+                distinct = false;
+    }
+
+    ut_equals_bool(ut, true, distinct, __func__);
+    ut_equals_bool(ut, true, stable, __func__);
+
+    // Avalanche over the inputs handled by each branch
+    size_t lengths[] = { 1, 3, 4, 8, 16, 17, 48, 100, 256 };
+
+    bool avalanche = true;
+
+    for (size_t k = 0; k < sizeof(lengths) / sizeof(size_t); k++)
+    {
+        size_t length = lengths[k];
+
+        uint64_t flipped = 0, total = 0;
+
+        for (size_t bit = 0; bit < length * 8; bit++)
+        {
+            data[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+
+            uint64_t h = hash_bytes(data, length);
+
+            data[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+
+            if (h == hashes[length])
+                avalanche = false;
+
+            flipped += (uint64_t)__builtin_popcountll(h ^ hashes[length]);
+            total += 64;
+        }
+
+        // Between 40% and 60% of the output bits change
+        if (flipped * 10 < total * 4 || flipped * 10 > total * 6)
+            avalanche = false;
+    }
+
+    ut_equals_bool(ut, true, avalanche, __func__);
+
+    ut_equals_bool(ut, false, hash_bytes_seeded(data, 20, 1) ==
+                   hash_bytes_seeded(data, 20, 2), __func__);
+    ut_equals_bool(ut, false, hash_bytes_seeded(data, 0, 1) ==
+                   hash_bytes_seeded(data, 0, 2), __func__);
+
+    // hash_string() hashes the characters before the terminator
+    ut_equals_bool(ut, true, hash_string("C-DataStructures") ==
+                   hash_bytes("C-DataStructures", 16), __func__);
+}
+
+// hash_char() and hash_long_double() are no longer constant
+void utl_test_hash_types(UnitTest ut)
+{
+    bool distinct = true;
+
+    unsigned_t hashes[256];
+
+    for (int i = 0; i < 256; i++)
+    {
+        char c = (char)i;
+
+        hashes[i] = hash_char(&c);
+
+        for (int j = 0; j < i; j++)
+            if (hashes[i] == hashes[j])
+                distinct = false;
+    }
+
+    ut_equals_bool(ut, true, distinct, __func__);
+
+    long double a = 1.5L, b = 2.5L, c = 1.5L;
+
+    ut_equals_bool(ut, false, hash_long_double(&a) == hash_long_double(&b),
+                   __func__);
+    ut_equals_bool(ut, true, hash_long_double(&a) == hash_long_double(&c),
+                   __func__);
+}
+
+// Runs all Utility tests
+Status UtilityTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    utl_test_siphash(ut);
+    utl_test_hash_bytes(ut);
+    utl_test_hash_types(ut);
+
+    ut_report(ut, "Utility");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Utility");
+    ut_delete(&ut);
+    return st;
+}
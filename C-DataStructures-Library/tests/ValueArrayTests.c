@@ -0,0 +1,375 @@
+/**
+ * @file ValueArrayTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueArray.h"
+#include "SearchKernels.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Checks insertions and removals at every position and the stack operations
+void var_test_IO0(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueArray_t *array = var_create(int_interface, sizeof(int32_t), 4, 150);
+
+    if (!int_interface || !array)
+        goto error;
+
+    int32_t block[5] = {1, 2, 3, 4, 5};
+
+    for (int32_t i = 10; i < 20; i++)
+    {
+        if (!var_insert_back(array, &i))
+            goto error;
+    }
+
+    // [ 10, 1, 2, 3, 4, 5, 11, ..., 19 ]
+    if (!var_insert(array, block, 5, 1))
+        goto error;
+
+    int32_t value = 0;
+
+    if (!var_insert_at(array, &value, 0))
+        goto error;
+
+    ut_equals_integer_t(ut, 16, var_size(array), __func__);
+    ut_equals_int(ut, 0, *(int32_t*)var_get(array, 0), __func__);
+    ut_equals_int(ut, 10, *(int32_t*)var_get(array, 1), __func__);
+    ut_equals_int(ut, 5, *(int32_t*)var_get(array, 6), __func__);
+    ut_equals_int(ut, 11, *(int32_t*)var_get(array, 7), __func__);
+    ut_equals_int(ut, 19, *(int32_t*)var_peek_back(array), __func__);
+    ut_equals_bool(ut, true, var_get(array, 16) == NULL, __func__);
+
+    ut_equals_integer_t(ut, 5, var_index_first(array, &block[3]), __func__);
+    ut_equals_bool(ut, false, var_contains(array, &(int32_t){100}), __func__);
+
+    if (!var_remove_at(array, 1, &value))
+        goto error;
+
+    ut_equals_int(ut, 10, value, __func__);
+    ut_equals_int(ut, 1, *(int32_t*)var_get(array, 1), __func__);
+
+    int32_t sum = 0;
+
+    while (var_remove_back(array, &value))
+        sum += value;
+
+    ut_equals_int(ut, 0 + 15 + 11 + 12 + 13 + 14 + 15 + 16 + 17 + 18 + 19, sum,
+                  __func__);
+    ut_equals_bool(ut, true, var_empty(array), __func__);
+
+    // A locked array doesn't grow
+    var_capacity_lock(array);
+
+    for (int32_t i = 0; i < var_capacity(array); i++)
+        var_insert_back(array, &i);
+
+    ut_equals_bool(ut, false, var_insert_back(array, &value), __func__);
+
+    var_free(array);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) var_free(array);
+    interface_free(int_interface);
+}
+
+// Checks sorting and copying
+void var_test_sort(UnitTest ut)
+{
+    const int32_t elements = 10000;
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueArray_t *array = var_new(int_interface, sizeof(int32_t));
+    ValueArray_t *copy = NULL;
+
+    if (!int_interface || !array)
+        goto error;
+
+    for (int32_t i = 0; i < elements; i++)
+    {
+        int32_t value = random_int32_t(-elements, elements);
+
+        if (!var_insert_back(array, &value))
+            goto error;
+    }
+
+    copy = var_copy(array);
+
+    if (!copy)
+        goto error;
+
+    var_sort(array);
+
+    int32_t *data = var_data(array);
+
+    bool sorted = true;
+
+    for (int32_t i = 1; i < elements; i++)
+    {
+        if (data[i - 1] > data[i])
+            sorted = false;
+    }
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_integer_t(ut, elements, var_size(copy), __func__);
+
+    // The copy is independent and keeps the original order
+    var_sort(copy);
+
+    ut_equals_bool(ut, true, memcmp(var_data(array), var_data(copy),
+            sizeof(int32_t) * (size_t)elements) == 0, __func__);
+
+    var_free(array);
+    var_free(copy);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) var_free(array);
+    if (copy) var_free(copy);
+    interface_free(int_interface);
+}
+
+// Elements survive closing and opening the file again
+void var_test_map(UnitTest ut)
+{
+    const char *path = "var_test_map.bin";
+    const int32_t elements = 100000;
+
+    remove(path);
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueArray_t *array = var_map(int_interface, path, sizeof(int32_t));
+
+    if (!int_interface || !array)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, var_size(array), __func__);
+
+    for (int32_t i = 0; i < elements; i++)
+    {
+        if (!var_insert_back(array, &i))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, var_sync(array), __func__);
+
+    var_free(array);
+
+    // Elements of another size are rejected
+    array = var_map(int_interface, path, sizeof(int64_t));
+
+    ut_equals_bool(ut, true, array == NULL, __func__);
+
+    array = var_map(int_interface, path, sizeof(int32_t));
+
+    if (!array)
+        goto error;
+
+    ut_equals_integer_t(ut, elements, var_size(array), __func__);
+
+    bool correct = true;
+
+    for (int32_t i = 0; i < elements; i++)
+    {
+        if (*(int32_t *)var_get(array, i) != i)
+            correct = false;
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    // Arrays in memory can't be synchronized
+    ValueArray_t *copy = var_copy(array);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_bool(ut, false, var_sync(copy), __func__);
+    ut_equals_integer_t(ut, elements, var_size(copy), __func__);
+
+    var_free(copy);
+    var_free(array);
+    interface_free(int_interface);
+    remove(path);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array) var_free(array);
+    interface_free(int_interface);
+    remove(path);
+}
+
+// Checks searches on arrays of 32 and 64-bit integers with every search
+// kernel supported by the CPU against a scan with the compare function
+void var_test_kernels(UnitTest ut)
+{
+    const integer_t sizes[] = { 1, 3, 4, 7, 8, 9, 33, 1000 };
+    const integer_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    Interface_t *int32_interface = interface_new(compare_int32_t,
+            copy_int32_t, display_int32_t, free, NULL, NULL);
+    Interface_t *int64_interface = interface_new(compare_int64_t,
+            copy_int64_t, display_int64_t, free, NULL, NULL);
+    Interface_t *uint32_interface = interface_new(compare_uint32_t,
+            copy_uint32_t, display_uint32_t, free, NULL, NULL);
+
+    ValueArray_t *array32 = NULL, *array64 = NULL, *arrayu = NULL;
+
+    if (!int32_interface || !int64_interface || !uint32_interface)
+        goto error;
+
+    bool correct = true;
+
+    for (int k = SearchKernelScalar; k <= SearchKernel256; k++)
+    {
+        if (!skn_use((SearchKernel)k))
+            continue;
+
+        for (integer_t s = 0; s < sizes_count; s++)
+        {
+            integer_t size = sizes[s];
+
+            array32 = var_new(int32_interface, sizeof(int32_t));
+            array64 = var_new(int64_interface, sizeof(int64_t));
+
+            if (!array32 || !array64)
+                goto error;
+
+            integer_t min = 0, max = 0, first = -1;
+
+            for (integer_t i = 0; i < size; i++)
+            {
+                int32_t value = random_int32_t(-50, 50);
+                int64_t wide = (int64_t)value * ((int64_t)1 << 40);
+
+                if (!var_insert_back(array32, &value)
+                    || !var_insert_back(array64, &wide))
+                    goto error;
+
+                int32_t *values = var_data(array32);
+
+                if (value < values[min])
+                    min = i;
+                if (value > values[max])
+                    max = i;
+                if (first < 0 && value == 7)
+                    first = i;
+            }
+
+            int64_t wide_key = (int64_t)7 << 40;
+
+            correct = correct
+                      && var_index_first(array32, &(int32_t){7}) == first
+                      && var_index_first(array64, &wide_key) == first
+                      && !var_contains(array32, &(int32_t){100})
+                      && var_min(array32) == min
+                      && var_max(array32) == max
+                      && var_min(array64) == min
+                      && var_max(array64) == max;
+
+            var_free(array32);
+            var_free(array64);
+            array32 = array64 = NULL;
+        }
+    }
+
+    skn_use(SearchKernel256);
+
+    ut_equals_bool(ut, true, correct, __func__);
+
+    array32 = var_new(int32_interface, sizeof(int32_t));
+
+    if (!array32)
+        goto error;
+
+    ut_equals_integer_t(ut, -1, var_min(array32), __func__);
+    ut_equals_integer_t(ut, -1, var_max(array32), __func__);
+
+    var_free(array32);
+    array32 = NULL;
+
+    // Unsigned integers are searched with the kernels but ordered by the
+    // compare function
+    arrayu = var_new(uint32_interface, sizeof(uint32_t));
+
+    if (!arrayu)
+        goto error;
+
+    uint32_t values[] = { 5, UINT32_MAX, 1, 9 };
+
+    if (!var_insert(arrayu, values, 4, 0))
+        goto error;
+
+    ut_equals_integer_t(ut, 1, var_index_first(arrayu, &values[1]),
+                        __func__);
+    ut_equals_integer_t(ut, 1, var_max(arrayu), __func__);
+    ut_equals_integer_t(ut, 2, var_min(arrayu), __func__);
+
+    var_free(arrayu);
+    interface_free(int32_interface);
+    interface_free(int64_interface);
+    interface_free(uint32_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    skn_use(SearchKernel256);
+    if (array32) var_free(array32);
+    if (array64) var_free(array64);
+    if (arrayu) var_free(arrayu);
+    interface_free(int32_interface);
+    interface_free(int64_interface);
+    interface_free(uint32_interface);
+}
+
+// Runs all ValueArray tests
+Status ValueArrayTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    var_test_IO0(ut);
+    var_test_sort(ut);
+    var_test_map(ut);
+    var_test_kernels(ut);
+
+    ut_report(ut, "ValueArray");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ValueArray");
+    ut_delete(&ut);
+    return st;
+}
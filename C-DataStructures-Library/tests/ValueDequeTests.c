@@ -0,0 +1,159 @@
+/**
+ * @file ValueDequeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueDeque.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Checks that the order is kept when the buffer grows while wrapped around
+void vdq_test_IO0(UnitTest ut)
+{
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueDeque_t *deque = vdq_create(int_interface, sizeof(int32_t), 4, 150);
+
+    if (!int_interface || !deque)
+        goto error;
+
+    // Enqueue -1 .. -50 at the front and 0 .. 49 at the rear
+    for (int32_t i = 0; i < 50; i++)
+    {
+        int32_t front = -i - 1;
+
+        if (!vdq_enqueue_rear(deque, &i) || !vdq_enqueue_front(deque, &front))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 100, vdq_count(deque), __func__);
+    ut_equals_int(ut, -50, *(int32_t*)vdq_peek_front(deque), __func__);
+    ut_equals_int(ut, 49, *(int32_t*)vdq_peek_rear(deque), __func__);
+
+    bool ordered = true;
+
+    for (integer_t i = 0; i < vdq_count(deque); i++)
+    {
+        if (*(int32_t*)vdq_get(deque, i) != i - 50)
+            ordered = false;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, vdq_contains(deque, &(int32_t){-25}), __func__);
+    ut_equals_bool(ut, false, vdq_contains(deque, &(int32_t){50}), __func__);
+
+    int32_t value;
+
+    if (!vdq_dequeue_rear(deque, &value))
+        goto error;
+
+    ut_equals_int(ut, 49, value, __func__);
+
+    if (!vdq_dequeue_front(deque, &value))
+        goto error;
+
+    ut_equals_int(ut, -50, value, __func__);
+
+    while (vdq_dequeue_front(deque, NULL));
+
+    ut_equals_bool(ut, true, vdq_empty(deque), __func__);
+    ut_equals_bool(ut, true, vdq_peek_front(deque) == NULL, __func__);
+
+    vdq_free(deque);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) vdq_free(deque);
+    interface_free(int_interface);
+}
+
+// Checks the deque as a queue and its copy
+void vdq_test_copy(UnitTest ut)
+{
+    const int32_t elements = 1000;
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueDeque_t *deque = vdq_new(int_interface, sizeof(int32_t));
+    ValueDeque_t *copy = NULL;
+
+    if (!int_interface || !deque)
+        goto error;
+
+    // Moves front and rear around the buffer
+    for (int32_t i = 0; i < elements; i++)
+    {
+        if (!vdq_enqueue_rear(deque, &i))
+            goto error;
+
+        if (i % 3 == 0 && !vdq_dequeue_front(deque, NULL))
+            goto error;
+    }
+
+    copy = vdq_copy(deque);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_integer_t(ut, vdq_count(deque), vdq_count(copy), __func__);
+
+    bool equal = true;
+    int32_t a, b;
+
+    while (vdq_dequeue_front(deque, &a))
+    {
+        if (!vdq_dequeue_front(copy, &b) || a != b)
+            equal = false;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+    ut_equals_bool(ut, true, vdq_empty(copy), __func__);
+
+    vdq_free(deque);
+    vdq_free(copy);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (deque) vdq_free(deque);
+    if (copy) vdq_free(copy);
+    interface_free(int_interface);
+}
+
+// Runs all ValueDeque tests
+Status ValueDequeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    vdq_test_IO0(ut);
+    vdq_test_copy(ut);
+
+    ut_report(ut, "ValueDeque");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ValueDeque");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file ValueHeapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "ValueHeap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// An element bigger than a pointer, ordered by its first member
+struct vhp_test_item
+{
+    int32_t key;
+    int32_t payload[5];
+};
+
+// Checks if when removed, the elements are sorted for both MinHeap and MaxHeap
+void vhp_test_IO0(UnitTest ut)
+{
+    const int32_t elements = 10000;
+
+    enum HeapKind_e K[2] = {MaxHeap, MinHeap};
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    ValueHeap_t *heap = NULL;
+
+    if (!int_interface)
+        goto error;
+
+    for (int k = 0; k < 2; k++)
+    {
+        heap = vhp_create(int_interface, sizeof(int32_t), 4, 150, K[k]);
+
+        if (!heap)
+            goto error;
+
+        int64_t sum0 = 0, sum1 = 0;
+
+        for (int32_t i = 0; i < elements; i++)
+        {
+            int32_t value = random_int32_t(-elements, elements);
+
+            sum0 += value;
+
+            if (!vhp_insert(heap, &value))
+                goto error;
+        }
+
+        ut_equals_integer_t(ut, elements, vhp_count(heap), __func__);
+
+        bool sorted = true;
+        int32_t previous, value;
+
+        if (!vhp_remove(heap, &previous))
+            goto error;
+
+        sum1 += previous;
+
+        while (vhp_remove(heap, &value))
+        {
+            if ((value - previous) * K[k] > 0)
+                sorted = false;
+
+            sum1 += value;
+            previous = value;
+        }
+
+        ut_equals_bool(ut, true, sorted, __func__);
+        ut_equals_bool(ut, true, sum0 == sum1, __func__);
+        ut_equals_bool(ut, true, vhp_peek(heap) == NULL, __func__);
+
+        vhp_free(heap);
+        heap = NULL;
+    }
+
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) vhp_free(heap);
+    interface_free(int_interface);
+}
+
+// Checks that whole elements are moved and that a copy is independent
+void vhp_test_copy(UnitTest ut)
+{
+    const int32_t elements = 500;
+
+    Interface_t *interface = interface_new(compare_int32_t, NULL, NULL, NULL,
+                                           NULL, NULL);
+
+    ValueHeap_t *heap = vhp_new(interface, sizeof(struct vhp_test_item),
+                                MinHeap);
+    ValueHeap_t *copy = NULL;
+
+    if (!interface || !heap)
+        goto error;
+
+    for (int32_t i = elements; i > 0; i--)
+    {
+        struct vhp_test_item item = { i, { i, i * 2, i * 3, i * 4, i * 5 } };
+
+        if (!vhp_insert(heap, &item))
+            goto error;
+    }
+
+    copy = vhp_copy(heap);
+
+    if (!copy)
+        goto error;
+
+    struct vhp_test_item item;
+
+    while (vhp_remove(heap, NULL));
+
+    bool intact = true;
+
+    for (int32_t i = 1; i <= elements; i++)
+    {
+        if (!vhp_remove(copy, &item) || item.key != i)
+            intact = false;
+
+        for (int j = 0; j < 5; j++)
+        {
+            if (item.payload[j] != item.key * (j + 1))
+                intact = false;
+        }
+    }
+
+    ut_equals_bool(ut, true, intact, __func__);
+    ut_equals_bool(ut, true, vhp_empty(copy), __func__);
+
+    vhp_free(heap);
+    vhp_free(copy);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (heap) vhp_free(heap);
+    if (copy) vhp_free(copy);
+    interface_free(interface);
+}
+
+// Runs all ValueHeap tests
+Status ValueHeapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    vhp_test_IO0(ut);
+    vhp_test_copy(ut);
+
+    ut_report(ut, "ValueHeap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ValueHeap");
+    ut_delete(&ut);
+    return st;
+}
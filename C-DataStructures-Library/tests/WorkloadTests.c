@@ -0,0 +1,185 @@
+/**
+ * @file WorkloadTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Workload.h"
+#include "UnitTest.h"
+
+// Operations are recorded in order and counted by kind
+void wkl_test_record(UnitTest ut)
+{
+    Workload_t *workload = wkl_new();
+
+    if (!workload)
+        goto error;
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!wkl_record(workload, (WorkloadOperation)(i % 3), i - 500))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, wkl_record(workload, (WorkloadOperation)3, 0),
+                   __func__);
+
+    ut_equals_integer_t(ut, wkl_size(workload), 1000, __func__);
+    ut_equals_integer_t(ut, wkl_count(workload, WorkloadInsert), 334,
+                        __func__);
+    ut_equals_integer_t(ut, wkl_count(workload, WorkloadSearch), 333,
+                        __func__);
+    ut_equals_integer_t(ut, wkl_count(workload, WorkloadRemove), 333,
+                        __func__);
+
+    bool equal = true;
+
+    for (integer_t i = 0; i < 1000; i++)
+    {
+        equal = equal
+                && wkl_operation(workload, i) == (WorkloadOperation)(i % 3)
+                && wkl_keys(workload)[i] == i - 500;
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+
+    wkl_free(workload);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (workload) wkl_free(workload);
+}
+
+// A saved workload is loaded back with the same operations
+void wkl_test_save_load(UnitTest ut)
+{
+    const char *path = "wkl_test_save_load.txt";
+
+    Workload_t *workload = wkl_new(), *loaded = NULL;
+
+    if (!workload)
+        goto error;
+
+    wkl_record(workload, WorkloadInsert, INT64_MAX);
+    wkl_record(workload, WorkloadSearch, INT64_MIN);
+    wkl_record(workload, WorkloadRemove, 0);
+    wkl_record(workload, WorkloadSearch, -7);
+
+    ut_equals_bool(ut, true, wkl_save(workload, path), __func__);
+
+    loaded = wkl_load(path);
+
+    if (!loaded)
+        goto error;
+
+    ut_equals_integer_t(ut, wkl_size(loaded), 4, __func__);
+
+    bool equal = true;
+
+    for (integer_t i = 0; i < 4; i++)
+    {
+        equal = equal
+                && wkl_operation(loaded, i) == wkl_operation(workload, i)
+                && wkl_keys(loaded)[i] == wkl_keys(workload)[i];
+    }
+
+    ut_equals_bool(ut, true, equal, __func__);
+    ut_equals_integer_t(ut, wkl_count(loaded, WorkloadSearch), 2, __func__);
+
+    remove(path);
+
+    wkl_free(workload);
+    wkl_free(loaded);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    remove(path);
+    if (workload) wkl_free(workload);
+    if (loaded) wkl_free(loaded);
+}
+
+// Comments are skipped and invalid lines are rejected
+void wkl_test_invalid(UnitTest ut)
+{
+    const char *path = "wkl_test_invalid.txt";
+
+    const char *contents[] = {
+        "# written by hand\n\ni 1\ns 2\n# a comment\nr 1\n",
+        "i 1\nx 2\n",
+        "i\n",
+        "i 12abc\n",
+        "s 3"
+    };
+
+    integer_t sizes[] = { 3, -1, -1, -1, 1 };
+
+    bool correct = true;
+
+    for (int i = 0; i < 5; i++)
+    {
+        FILE *file = fopen(path, "w");
+
+        if (!file)
+            goto error;
+
+        fputs(contents[i], file);
+        fclose(file);
+
+        Workload_t *workload = wkl_load(path);
+
+        if (sizes[i] < 0)
+            correct = correct && workload == NULL;
+        else
+            correct = correct && workload && wkl_size(workload) == sizes[i];
+
+        if (workload)
+            wkl_free(workload);
+    }
+
+    ut_equals_bool(ut, true, correct, __func__);
+    ut_equals_bool(ut, true, wkl_load("wkl_test_missing.txt") == NULL,
+                   __func__);
+
+    remove(path);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+// Runs all Workload tests
+Status WorkloadTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    wkl_test_record(ut);
+    wkl_test_save_load(ut);
+    wkl_test_invalid(ut);
+
+    ut_report(ut, "Workload");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Workload");
+    ut_delete(&ut);
+    return st;
+}
@@ -8,25 +8,68 @@ int main(void)
     printf("|                       Tests                      |\n");
     printf("+--------------------------------------------------+\n\n");
 
+    AdaptiveRadixTreeTests();
+    ArenaTests();
     ArrayTests();
     AssociativeListTests();
     AVLTreeTests();
     BinarySearchTreeTests();
     BitArrayTests();
+    BloomFilterTests();
+    BPlusTreeTests();
+    CacheTests();
+    ChannelTests();
     CircularLinkedListTests();
+    ClockTests();
+    CompactRedBlackTreeTests();
+    CountMinSketchTests();
     DequeArrayTests();
     DequeListTests();
+    DequeStealingTests();
     DoublyLinkedListTests();
     DynamicArrayTests();
+    EpochReclaimerTests();
+    FenwickTreeTests();
+    GraphTests();
+    HashMapTests();
+    HashTableTests();
     HeapTests();
+    InternTableTests();
+    IntrusiveAVLTreeTests();
+    IntrusiveListTests();
+    IntrusiveRedBlackTreeTests();
+    NodePoolTests();
+    PagedBitArrayTests();
     PriorityListTests();
+    QuantileSketchTests();
     QueueArrayTests();
     QueueListTests();
+    QueueMPMCTests();
+    QueueSPSCTests();
     RedBlackTreeTests();
+    RopeTests();
+    RoaringBitmapTests();
+    SegmentTreeTests();
+    ShardedTests();
     SinglyLinkedListTests();
+    SkipListTests();
+    SortTests();
     SortedListTests();
     StackArrayTests();
     StackListTests();
+    StaticSortedSetTests();
+    StringTests();
+    SynchronizedTests();
+    ThreadPoolTests();
+    TimerWheelTests();
+    TopKTests();
+    TraceTests();
+    TypedContainerTests();
+    UtilityTests();
+    ValueArrayTests();
+    ValueDequeTests();
+    ValueHeapTests();
+    WorkloadTests();
 
     FinalReport();
 }
\ No newline at end of file
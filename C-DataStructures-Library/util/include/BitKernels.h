@@ -0,0 +1,93 @@
+/**
+ * @file BitKernels.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BITKERNELS_H
+#define C_DATASTRUCTURES_LIBRARY_BITKERNELS_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Alignment in bytes of buffers returned by bkn_alloc(), enough for the
+/// widest kernel.
+#define BKN_ALIGNMENT 64
+
+/// \brief Instruction sets used by the bit kernels.
+///
+/// Kernels are ordered from the most portable to the fastest. The fastest one
+/// supported by the CPU is chosen at runtime.
+enum BitKernel
+{
+    BitKernelScalar = 0, ///< Word at a time, always available.
+    BitKernelAVX2   = 1, ///< 256-bit vectors with Harley-Seal popcount.
+    BitKernelAVX512 = 2  ///< 512-bit vectors with VPOPCNTQ.
+};
+
+/// \ref BitKernel
+/// \brief A type for the instruction sets used by the bit kernels.
+typedef enum BitKernel BitKernel;
+
+/// \ref bkn_kernel
+/// \brief Returns the kernel currently in use.
+BitKernel
+bkn_kernel(void);
+
+/// \ref bkn_use
+/// \brief Limits the kernels to a given instruction set.
+bool
+bkn_use(BitKernel kernel);
+
+/// \ref bkn_alloc
+/// \brief Allocates a zeroed and aligned buffer of words.
+unsigned_t *
+bkn_alloc(unsigned_t words);
+
+/// \ref bkn_popcount
+/// \brief Returns the amount of set bits in a buffer of words.
+unsigned_t
+bkn_popcount(const unsigned_t *words, unsigned_t size);
+
+/// \ref bkn_and
+/// \brief Computes <code> target &= source </code> for each word.
+void
+bkn_and(unsigned_t *target, const unsigned_t *source, unsigned_t size);
+
+/// \ref bkn_or
+/// \brief Computes <code> target |= source </code> for each word.
+void
+bkn_or(unsigned_t *target, const unsigned_t *source, unsigned_t size);
+
+/// \ref bkn_xor
+/// \brief Computes <code> target ^= source </code> for each word.
+void
+bkn_xor(unsigned_t *target, const unsigned_t *source, unsigned_t size);
+
+/// \ref bkn_andnot
+/// \brief Computes <code> target &= ~source </code> for each word.
+void
+bkn_andnot(unsigned_t *target, const unsigned_t *source, unsigned_t size);
+
+/// \ref bkn_intersects
+/// \brief Returns true if any word of both buffers has a bit in common.
+bool
+bkn_intersects(const unsigned_t *words1, const unsigned_t *words2,
+               unsigned_t size);
+
+/// \ref bkn_next_word
+/// \brief Finds the first word that is not equal to a given pattern.
+unsigned_t
+bkn_next_word(const unsigned_t *words, unsigned_t from, unsigned_t size,
+              unsigned_t pattern);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BITKERNELS_H
@@ -0,0 +1,49 @@
+/**
+ * @file Bulk.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BULK_H
+#define C_DATASTRUCTURES_LIBRARY_BULK_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "ThreadPool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \ref blk_for_each
+/// \brief Visits every element of a buffer of pointers.
+void
+blk_for_each(void **buffer, integer_t size, visit_f visit, void *argument,
+             ThreadPool_t *pool);
+
+/// \ref blk_map
+/// \brief Maps every element of a buffer of pointers into another buffer.
+bool
+blk_map(void **source, void **target, integer_t size, map_f map,
+        void *argument, ThreadPool_t *pool);
+
+/// \ref blk_filter
+/// \brief Releases every element of a buffer that doesn't match a predicate.
+integer_t
+blk_filter(void **buffer, integer_t size, predicate_f keep, void *argument,
+           Interface_t *interface, bool compact, ThreadPool_t *pool);
+
+/// \ref blk_reduce
+/// \brief Folds every element of a buffer of pointers into an accumulator.
+void
+blk_reduce(void **buffer, integer_t size, void *accumulator,
+           const void *identity, size_t accumulator_size, reduce_f reduce,
+           reduce_f combine, ThreadPool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BULK_H
@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_STRING_H
 
 #include "Core.h"
+#include "InternTable.h"
 
 // An array of characters. See the source file for the full documentation.
 struct String_s;
@@ -26,6 +27,22 @@ typedef struct String_s String_t;
 /// typedef does that for you.
 typedef struct String_s *String;
 
+// A key compiled for repeated searches. See the source file for the full
+// documentation.
+struct StringSearcher_s;
+
+/// \brief A type for a precompiled substring search.
+///
+/// A type for a <code> struct StringSearcher_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct StringSearcher_s StringSearcher_t;
+
+/// \brief A pointer type to a precompiled substring search.
+///
+/// Useful for not having to declare every variable as pointer type. This
+/// typedef does that for you.
+typedef struct StringSearcher_s *StringSearcher;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 Status str_init(String *string);
@@ -44,6 +61,8 @@ Status str_clear(String string);
 
 Status str_get_string(String string, char **result);
 
+Status str_view(String string, const char **result);
+
 integer_t str_length(String string);
 
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
@@ -104,10 +123,15 @@ Status str_find_substring(String string, String key, integer_t *pos);
 
 Status str_find_substr(String string, char *key, integer_t *pos);
 
+Status str_find_all(String string, char *key, integer_t **result,
+                    integer_t *count);
+
 Status str_reverse(String string);
 
 Status str_copy(String string, String *result);
 
+Status str_intern(String string, InternTable_t *table, const char **result);
+
 Status str_swap(String *string1, String *string2);
 
 Status str_case_upper(String string);
@@ -118,6 +142,18 @@ Status str_capitalize(String string);
 
 Status str_title(String string);
 
+////////////////////////////////////////////////////////////////// SEARCHER ///
+
+Status str_searcher_init(StringSearcher *searcher, char *key);
+
+Status str_searcher_delete(StringSearcher *searcher);
+
+Status str_searcher_find(StringSearcher searcher, String string,
+                         integer_t from, integer_t *pos);
+
+Status str_searcher_find_all(StringSearcher searcher, String string,
+                             integer_t **result, integer_t *count);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 Status str_display(String string);
@@ -15,6 +15,25 @@
 extern "C" {
 #endif
 
+/// \brief Where a Clock_t reads the time from.
+enum ClockSource
+{
+    /// Wall time from CLOCK_MONOTONIC, unaffected by changes to the system
+    /// time.
+    ClockMonotonic = 0,
+    /// The CPU's time stamp counter, calibrated against ClockMonotonic. Only
+    /// used when the counter runs at a constant rate, otherwise the clock
+    /// falls back to ClockMonotonic.
+    ClockCycles = 1,
+    /// CPU time spent by the calling thread, from CLOCK_THREAD_CPUTIME_ID. A
+    /// clock with this source must be started and stopped by the same thread.
+    ClockThread = 2
+};
+
+/// \ref ClockSource
+/// \brief A type for the sources of a Clock_t.
+typedef enum ClockSource ClockSource;
+
 /// \brief A stopwatch wrapper.
 struct Clock_s
 {
@@ -25,13 +44,19 @@ struct Clock_s
 
     /// \brief Last calculated time.
     ///
-    /// The last calculated time.
+    /// The time the clock has been running, in seconds. Updated when the
+    /// clock is stopped.
     double time;
 
+    /// \brief Last calculated time in nanoseconds.
+    ///
+    /// The same as time, without the rounding of a double.
+    uint64_t elapsed;
+
     /// \brief Laps buffer.
     ///
-    /// Stores the laps time
-    double *buffer;
+    /// Stores the laps time in nanoseconds.
+    uint64_t *buffer;
 
     /// \brief Buffer size.
     ///
@@ -43,15 +68,25 @@ struct Clock_s
     /// How many laps are stored in the buffer.
     size_t count;
 
+    /// \brief Where the time is read from.
+    ///
+    /// The source actually in use, which might differ from the requested one.
+    ClockSource source;
+
+    /// \brief Nanoseconds per tick of the source.
+    ///
+    /// 1.0 for every source except ClockCycles.
+    double tick;
+
     /// \brief Current running time.
     ///
-    /// Current running time.
-    clock_t timer;
+    /// Ticks of the source when the clock was started.
+    uint64_t timer;
 
     /// \brief Current lap running time.
     ///
-    /// Current lap running time.
-    clock_t lap_timer;
+    /// Ticks of the source when the current lap started.
+    uint64_t lap_timer;
 };
 
 typedef struct Clock_s Clock_t;
@@ -60,9 +95,16 @@ typedef struct Clock_s *Clock;
 
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
+/// \ref clk_new
+/// \brief Creates a clock that reads from ClockMonotonic.
 Clock_t *
 clk_new(unsigned_t storage_size);
 
+/// \ref clk_create
+/// \brief Creates a clock that reads from a given source.
+Clock_t *
+clk_create(unsigned_t storage_size, ClockSource source);
+
 void
 clk_free(Clock_t *clk);
 
@@ -88,6 +130,28 @@ clk_running(Clock_t *clk);
 bool
 clk_stopped(Clock_t *clk);
 
+/// \ref clk_source
+/// \brief Returns the source the clock reads from.
+ClockSource
+clk_source(Clock_t *clk);
+
+/// \ref clk_elapsed
+/// \brief Returns the nanoseconds the clock has been running, including the
+/// current run if it was not stopped.
+uint64_t
+clk_elapsed(Clock_t *clk);
+
+/// \ref clk_lap_time
+/// \brief Returns the nanoseconds of a stored lap, or 0 if there is no such
+/// lap.
+uint64_t
+clk_lap_time(Clock_t *clk, size_t index);
+
+////////////////////////////////////////////////////////////// WALL TIMING ///
+
+uint64_t
+clk_now(void);
+
 #ifdef __cplusplus
 }
 #endif
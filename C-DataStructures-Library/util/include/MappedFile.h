@@ -0,0 +1,108 @@
+/**
+ * @file MappedFile.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_MAPPEDFILE_H
+#define C_DATASTRUCTURES_LIBRARY_MAPPEDFILE_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Size in bytes of the header at the start of every mapped file. The data
+/// that follows it is aligned to this many bytes.
+#define MPF_HEADER_SIZE 64
+
+/// \brief Which container a mapped file belongs to.
+enum MappedKind
+{
+    MappedBitArray = 1,
+    MappedValueArray = 2
+};
+
+/// \ref MappedKind
+/// \brief A type for the containers that can live in a mapped file.
+typedef enum MappedKind MappedKind;
+
+/// \brief The header at the start of a mapped file.
+///
+/// The fields are kept in the byte order of the machine that wrote them, so
+/// a file can only be opened on machines with the same byte order and word
+/// size.
+struct MappedHeader_s
+{
+    /// \brief Identifies the file as a mapped container.
+    char magic[8];
+
+    /// \brief A MappedKind.
+    uint64_t kind;
+
+    /// \brief Size in bytes of each element of the container.
+    uint64_t element_size;
+
+    /// \brief Amount of elements, or bits, in use.
+    uint64_t count;
+
+    /// \brief Unused, always zero.
+    uint64_t reserved[4];
+};
+
+/// \ref MappedHeader_t
+/// \brief A type for the header of a mapped file.
+typedef struct MappedHeader_s MappedHeader_t;
+
+/// \struct MappedFile_s
+/// \brief A file mapped in memory.
+struct MappedFile_s;
+
+/// \ref MappedFile_t
+/// \brief A type for a mapped file.
+typedef struct MappedFile_s MappedFile_t;
+
+/// \ref mpf_open
+/// \brief Maps a file in memory, creating it if it doesn't exist.
+MappedFile_t *
+mpf_open(const char *path, MappedKind kind, size_t element_size,
+         size_t min_bytes);
+
+/// \ref mpf_close
+/// \brief Unmaps and closes a file.
+void
+mpf_close(MappedFile_t *file);
+
+/// \ref mpf_header
+/// \brief Returns the header of the file.
+MappedHeader_t *
+mpf_header(MappedFile_t *file);
+
+/// \ref mpf_data
+/// \brief Returns the data that follows the header.
+void *
+mpf_data(MappedFile_t *file);
+
+/// \ref mpf_bytes
+/// \brief Returns the size in bytes of the data that follows the header.
+size_t
+mpf_bytes(MappedFile_t *file);
+
+/// \ref mpf_resize
+/// \brief Changes the size of the data, which might move it in memory.
+bool
+mpf_resize(MappedFile_t *file, size_t bytes);
+
+/// \ref mpf_sync
+/// \brief Writes the mapped pages to the file and waits for them.
+bool
+mpf_sync(MappedFile_t *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_MAPPEDFILE_H
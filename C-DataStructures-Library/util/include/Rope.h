@@ -0,0 +1,142 @@
+/**
+ * @file Rope.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_ROPE_H
+#define C_DATASTRUCTURES_LIBRARY_ROPE_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct Rope_s
+/// \brief A string for very large texts, stored as a tree of chunks.
+struct Rope_s;
+
+/// \ref Rope_t
+/// \brief A type for a rope.
+///
+/// A type for a <code> struct Rope_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Rope_s Rope_t;
+
+/// \ref Rope
+/// \brief A pointer type for a rope.
+///
+/// Useful for not having to declare every variable as pointer type. This
+/// typedef does that for you.
+typedef struct Rope_s *Rope;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref rop_init
+/// \brief Initializes an empty rope.
+Status
+rop_init(Rope *rope);
+
+/// \ref rop_make
+/// \brief Initializes a rope with the contents of an array of characters.
+Status
+rop_make(Rope *rope, char *content);
+
+/// \ref rop_delete
+/// \brief Frees from memory a Rope_s and all of its chunks.
+Status
+rop_delete(Rope *rope);
+
+/// \ref rop_clear
+/// \brief Removes every character of the rope.
+Status
+rop_clear(Rope rope);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref rop_get_string
+/// \brief Flattens the rope into a new null-terminated array of characters.
+Status
+rop_get_string(Rope rope, char **result);
+
+/// \ref rop_length
+/// \brief Returns the amount of characters in the rope.
+integer_t
+rop_length(Rope rope);
+
+/// \ref rop_char_at
+/// \brief Returns the character at a given position.
+Status
+rop_char_at(Rope rope, integer_t index, char *result);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref rop_push_front
+/// \brief Inserts an array of characters at the start of the rope.
+Status
+rop_push_front(Rope rope, char *ch);
+
+/// \ref rop_push_at
+/// \brief Inserts an array of characters at a given position.
+Status
+rop_push_at(Rope rope, char *ch, integer_t index);
+
+/// \ref rop_push_back
+/// \brief Inserts an array of characters at the end of the rope.
+Status
+rop_push_back(Rope rope, char *ch);
+
+/// \ref rop_prepend
+/// \brief Moves every character of rope2 to the start of rope1.
+Status
+rop_prepend(Rope rope1, Rope rope2);
+
+/// \ref rop_append
+/// \brief Moves every character of rope2 to the end of rope1.
+Status
+rop_append(Rope rope1, Rope rope2);
+
+/// \ref rop_split
+/// \brief Moves every character from a given position on to a new rope.
+Status
+rop_split(Rope rope, Rope *result, integer_t index);
+
+/// \ref rop_remove
+/// \brief Removes the characters in a range of positions.
+Status
+rop_remove(Rope rope, integer_t from, integer_t to);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref rop_empty
+/// \brief Returns true if the rope has no characters, otherwise false.
+bool
+rop_empty(Rope rope);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref rop_substr
+/// \brief Returns true if the rope contains an array of characters.
+bool
+rop_substr(Rope rope, char *key);
+
+/// \ref rop_find_substr
+/// \brief Finds the first position of an array of characters in the rope.
+Status
+rop_find_substr(Rope rope, char *key, integer_t *pos);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref rop_display
+/// \brief Displays the contents of a rope in the console.
+Status
+rop_display(Rope rope);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_ROPE_H
@@ -0,0 +1,77 @@
+/**
+ * @file SearchKernels.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SEARCHKERNELS_H
+#define C_DATASTRUCTURES_LIBRARY_SEARCHKERNELS_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Instruction sets used by the search kernels.
+///
+/// Kernels are ordered from the most portable to the fastest. The fastest one
+/// supported by the CPU is chosen at runtime.
+enum SearchKernel
+{
+    SearchKernelScalar = 0, ///< One element at a time, always available.
+    SearchKernel128    = 1, ///< 128-bit vectors, SSE4.1 or NEON.
+    SearchKernel256    = 2  ///< 256-bit vectors, AVX2.
+};
+
+/// \ref SearchKernel
+/// \brief A type for the instruction sets used by the search kernels.
+typedef enum SearchKernel SearchKernel;
+
+/// \ref skn_kernel
+/// \brief Returns the kernel currently in use.
+SearchKernel
+skn_kernel(void);
+
+/// \ref skn_use
+/// \brief Limits the kernels to a given instruction set.
+bool
+skn_use(SearchKernel kernel);
+
+/// \ref skn_find_int32_t
+/// \brief Returns the index of the first 32-bit integer equal to a key.
+integer_t
+skn_find_int32_t(const int32_t *buffer, integer_t size, int32_t key);
+
+/// \ref skn_find_int64_t
+/// \brief Returns the index of the first 64-bit integer equal to a key.
+integer_t
+skn_find_int64_t(const int64_t *buffer, integer_t size, int64_t key);
+
+/// \ref skn_min_int32_t
+/// \brief Returns the index of the first smallest 32-bit integer.
+integer_t
+skn_min_int32_t(const int32_t *buffer, integer_t size);
+
+/// \ref skn_max_int32_t
+/// \brief Returns the index of the first greatest 32-bit integer.
+integer_t
+skn_max_int32_t(const int32_t *buffer, integer_t size);
+
+/// \ref skn_min_int64_t
+/// \brief Returns the index of the first smallest 64-bit integer.
+integer_t
+skn_min_int64_t(const int64_t *buffer, integer_t size);
+
+/// \ref skn_max_int64_t
+/// \brief Returns the index of the first greatest 64-bit integer.
+integer_t
+skn_max_int64_t(const int64_t *buffer, integer_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SEARCHKERNELS_H
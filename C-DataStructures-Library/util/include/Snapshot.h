@@ -0,0 +1,109 @@
+/**
+ * @file Snapshot.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SNAPSHOT_H
+#define C_DATASTRUCTURES_LIBRARY_SNAPSHOT_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Version of the snapshot format written by this library. Snapshots of
+/// other versions are rejected.
+#define SNP_VERSION 1
+
+/// \brief Which structure a snapshot belongs to.
+enum SnapshotKind
+{
+    SnapshotDynamicArray = 1,
+    SnapshotAVLTree = 2,
+    SnapshotRedBlackTree = 3,
+    SnapshotHeap = 4,
+    SnapshotHashMap = 5
+};
+
+/// \ref SnapshotKind
+/// \brief A type for the structures that can be saved to a snapshot.
+typedef enum SnapshotKind SnapshotKind;
+
+/// \brief The header at the start of every snapshot.
+///
+/// It is followed by the elements of the structure, each written by the
+/// serialize function of its interface. Integers are kept in the byte order
+/// of the machine that wrote them, which is checked when the snapshot is read.
+struct SnapshotHeader_s
+{
+    /// \brief Identifies the stream as a snapshot.
+    char magic[8];
+
+    /// \brief Version of the format, SNP_VERSION.
+    uint32_t version;
+
+    /// \brief A SnapshotKind.
+    uint32_t kind;
+
+    /// \brief A known value that tells the byte order of the writer.
+    uint64_t byte_order;
+
+    /// \brief Amount of elements that follow the header.
+    uint64_t count;
+
+    /// \brief Parameters of the structure, like its capacity or arity, that
+    /// are restored along with the elements. Their meaning depends on the
+    /// kind of structure.
+    int64_t fields[4];
+};
+
+/// \ref SnapshotHeader_t
+/// \brief A type for the header of a snapshot.
+typedef struct SnapshotHeader_s SnapshotHeader_t;
+
+/// \ref snp_header_init
+/// \brief Initializes the header of a snapshot about to be written.
+void
+snp_header_init(SnapshotHeader_t *header, SnapshotKind kind, uint64_t count);
+
+/// \ref snp_write_header
+/// \brief Writes the header of a snapshot.
+bool
+snp_write_header(FILE *stream, const SnapshotHeader_t *header);
+
+/// \ref snp_read_header
+/// \brief Reads and checks the header of a snapshot.
+bool
+snp_read_header(FILE *stream, SnapshotKind kind, SnapshotHeader_t *header);
+
+/// \ref snp_write_elements
+/// \brief Writes a buffer of elements to a snapshot.
+bool
+snp_write_elements(FILE *stream, Interface_t *interface, void **elements,
+                   integer_t count);
+
+/// \ref snp_read_elements
+/// \brief Reads a buffer of elements from a snapshot.
+void **
+snp_read_elements(FILE *stream, Interface_t *interface, integer_t count);
+
+/// \ref snp_write_u64
+/// \brief Writes an integer to a snapshot.
+bool
+snp_write_u64(FILE *stream, uint64_t value);
+
+/// \ref snp_read_u64
+/// \brief Reads an integer from a snapshot.
+bool
+snp_read_u64(FILE *stream, uint64_t *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SNAPSHOT_H
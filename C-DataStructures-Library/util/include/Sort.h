@@ -0,0 +1,50 @@
+/**
+ * @file Sort.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SORT_H
+#define C_DATASTRUCTURES_LIBRARY_SORT_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "ThreadPool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \ref srt_sort
+/// \brief Sorts a buffer of pointers using pattern-defeating quicksort.
+void
+srt_sort(void **buffer, integer_t size, compare_f compare);
+
+/// \ref srt_insertion_sort
+/// \brief Sorts a buffer of pointers using insertion sort.
+void
+srt_insertion_sort(void **buffer, integer_t size, compare_f compare);
+
+/// \ref srt_heap_sort
+/// \brief Sorts a buffer of pointers using heap sort.
+void
+srt_heap_sort(void **buffer, integer_t size, compare_f compare);
+
+/// \ref srt_radix_sort
+/// \brief Sorts a buffer of pointers using LSD radix sort.
+bool
+srt_radix_sort(void **buffer, integer_t size, key_f key);
+
+/// \ref srt_sort_parallel
+/// \brief Sorts a buffer of pointers using all threads of a thread pool.
+void
+srt_sort_parallel(void **buffer, integer_t size, compare_f compare,
+                  ThreadPool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SORT_H
@@ -0,0 +1,112 @@
+/**
+ * @file Trace.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TRACE_H
+#define C_DATASTRUCTURES_LIBRARY_TRACE_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Where a traced function is when a trace point fires.
+enum TracePoint
+{
+    /// The function was just called.
+    TraceEntry = 0,
+    /// The function is about to return.
+    TraceReturn = 1
+};
+
+/// \ref TracePoint
+/// \brief A type for the points of a traced function.
+typedef enum TracePoint TracePoint;
+
+/// \brief A function called at every trace point.
+///
+/// \c probe is the name of the traced function, like "dar_grow". \c value is
+/// what the function is working on, usually the size of the container or,
+/// for functions that grow a buffer, its capacity. \c argument is the one
+/// given to trc_set().
+typedef void (*trace_f)(const char *probe, TracePoint point, integer_t value,
+                        void *argument);
+
+/// \ref trc_set
+/// \brief Sets the function called at every trace point.
+bool
+trc_set(trace_f callback, void *argument);
+
+/// \ref trc_enabled
+/// \brief Returns true if the library was compiled with trace points.
+bool
+trc_enabled(void);
+
+// The macros below are only meant to be used by the containers, at the entry
+// of a traced function and before each of its returns. They expand to nothing
+// unless DS_TRACE is defined. When it is, every trace point is a USDT probe
+// (if <sys/sdt.h> is available) named <function>_entry or <function>_return
+// under the provider cdsl, and calls the function given to trc_set().
+
+#ifdef DS_TRACE
+
+#include <stdatomic.h>
+
+// Do not use, call trc_set() instead
+extern _Atomic(trace_f) trc_callback;
+
+void
+trc_fire(const char *probe, TracePoint point, integer_t value);
+
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define DS_TRACE_USDT
+#endif
+#endif
+
+#ifdef DS_TRACE_USDT
+#define DS_TRACE_PROBE_(name, value) DTRACE_PROBE1(cdsl, name, value)
+#else
+#define DS_TRACE_PROBE_(name, value) ((void)0)
+#endif
+
+#define DS_TRACE_POINT_(probe, point, value)                                  \
+    do                                                                        \
+    {                                                                         \
+        if (atomic_load_explicit(&trc_callback, memory_order_relaxed))        \
+            trc_fire(#probe, (point), (integer_t)(value));                    \
+    } while (0)
+
+#define DS_TRACE_ENTRY(probe, value)                                          \
+    do                                                                        \
+    {                                                                         \
+        DS_TRACE_PROBE_(probe##_entry, (integer_t)(value));                   \
+        DS_TRACE_POINT_(probe, TraceEntry, value);                            \
+    } while (0)
+
+#define DS_TRACE_RETURN(probe, value)                                         \
+    do                                                                        \
+    {                                                                         \
+        DS_TRACE_PROBE_(probe##_return, (integer_t)(value));                  \
+        DS_TRACE_POINT_(probe, TraceReturn, value);                           \
+    } while (0)
+
+#else
+
+#define DS_TRACE_ENTRY(probe, value) ((void)0)
+
+#define DS_TRACE_RETURN(probe, value) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TRACE_H
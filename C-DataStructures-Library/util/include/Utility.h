@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_UTILITY_H
 
 #include "Core.h"
+#include "Interface.h"
 
 int compare_int8_t(const void *element1, const void *element2);
 int compare_int16_t(const void *element1, const void *element2);
@@ -45,6 +46,23 @@ void *copy_long_double(const void *element);
 void *copy_char(const void *element);
 void *copy_string(const void *element);
 
+void *copy_alloc_int8_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_int16_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_int32_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_int64_t(const void *element, Allocator_t *allocator);
+
+void *copy_alloc_uint8_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_uint16_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_uint32_t(const void *element, Allocator_t *allocator);
+void *copy_alloc_uint64_t(const void *element, Allocator_t *allocator);
+
+void *copy_alloc_float(const void *element, Allocator_t *allocator);
+void *copy_alloc_double(const void *element, Allocator_t *allocator);
+void *copy_alloc_long_double(const void *element, Allocator_t *allocator);
+
+void *copy_alloc_char(const void *element, Allocator_t *allocator);
+void *copy_alloc_string(const void *element, Allocator_t *allocator);
+
 void display_int8_t(const void *element);
 void display_int16_t(const void *element);
 void display_int32_t(const void *element);
@@ -78,6 +96,68 @@ unsigned_t hash_long_double(const void *element);
 
 unsigned_t hash_char(const void *element);
 unsigned_t hash_string(const void *element);
+unsigned_t hash_string_keyed(const void *element);
+
+uint64_t hash_bytes(const void *data, size_t length);
+uint64_t hash_bytes_seeded(const void *data, size_t length, uint64_t seed);
+uint64_t hash_siphash(const void *data, size_t length, uint64_t k0,
+                      uint64_t k1);
+void hash_keyed_seed(uint64_t k0, uint64_t k1);
+
+uint64_t key_int8_t(const void *element);
+uint64_t key_int16_t(const void *element);
+uint64_t key_int32_t(const void *element);
+uint64_t key_int64_t(const void *element);
+
+uint64_t key_uint8_t(const void *element);
+uint64_t key_uint16_t(const void *element);
+uint64_t key_uint32_t(const void *element);
+uint64_t key_uint64_t(const void *element);
+
+uint64_t key_float(const void *element);
+uint64_t key_double(const void *element);
+
+void reduce_sum_int64_t(void *accumulator, const void *element);
+void reduce_min_int64_t(void *accumulator, const void *element);
+void reduce_max_int64_t(void *accumulator, const void *element);
+
+void apply_add_int64_t(void *aggregate, const void *update, integer_t count);
+void apply_add_sum_int64_t(void *aggregate, const void *update,
+                           integer_t count);
+
+bool serialize_int8_t(const void *element, FILE *stream);
+bool serialize_int16_t(const void *element, FILE *stream);
+bool serialize_int32_t(const void *element, FILE *stream);
+bool serialize_int64_t(const void *element, FILE *stream);
+
+bool serialize_uint8_t(const void *element, FILE *stream);
+bool serialize_uint16_t(const void *element, FILE *stream);
+bool serialize_uint32_t(const void *element, FILE *stream);
+bool serialize_uint64_t(const void *element, FILE *stream);
+
+bool serialize_float(const void *element, FILE *stream);
+bool serialize_double(const void *element, FILE *stream);
+bool serialize_long_double(const void *element, FILE *stream);
+
+bool serialize_char(const void *element, FILE *stream);
+bool serialize_string(const void *element, FILE *stream);
+
+void *deserialize_int8_t(FILE *stream);
+void *deserialize_int16_t(FILE *stream);
+void *deserialize_int32_t(FILE *stream);
+void *deserialize_int64_t(FILE *stream);
+
+void *deserialize_uint8_t(FILE *stream);
+void *deserialize_uint16_t(FILE *stream);
+void *deserialize_uint32_t(FILE *stream);
+void *deserialize_uint64_t(FILE *stream);
+
+void *deserialize_float(FILE *stream);
+void *deserialize_double(FILE *stream);
+void *deserialize_long_double(FILE *stream);
+
+void *deserialize_char(FILE *stream);
+void *deserialize_string(FILE *stream);
 
 void *new_int8_t(int8_t element);
 void *new_int16_t(int16_t element);
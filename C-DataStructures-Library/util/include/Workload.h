@@ -0,0 +1,104 @@
+/**
+ * @file Workload.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_WORKLOAD_H
+#define C_DATASTRUCTURES_LIBRARY_WORKLOAD_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief The operations of a workload.
+enum WorkloadOperation
+{
+    WorkloadInsert = 0, ///< Inserts a key if it is not there yet.
+    WorkloadSearch = 1, ///< Searches for a key.
+    WorkloadRemove = 2  ///< Removes a key if it is there.
+};
+
+/// \ref WorkloadOperation
+/// \brief A type for the operations of a workload.
+typedef enum WorkloadOperation WorkloadOperation;
+
+/// \struct Workload_s
+/// \brief A recorded sequence of operations over a set of keys.
+struct Workload_s;
+
+/// \ref Workload_t
+/// \brief A type for a workload.
+///
+/// A type for a <code> struct Workload_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Workload_s Workload_t;
+
+/// \ref Workload
+/// \brief A pointer type for a workload.
+///
+/// Defines a pointer type to <code> struct Workload_s </code>. This typedef
+/// is used to avoid having to declare every workload as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct Workload_s *Workload;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref wkl_new
+/// \brief Creates an empty workload to record operations into.
+Workload_t *
+wkl_new(void);
+
+/// \ref wkl_free
+/// \brief Frees from memory a workload.
+void
+wkl_free(Workload_t *workload);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref wkl_size
+/// \brief Returns the amount of recorded operations.
+integer_t
+wkl_size(Workload_t *workload);
+
+/// \ref wkl_count
+/// \brief Returns the amount of recorded operations of a given kind.
+integer_t
+wkl_count(Workload_t *workload, WorkloadOperation operation);
+
+/// \ref wkl_operation
+/// \brief Returns the operation at a given position.
+WorkloadOperation
+wkl_operation(Workload_t *workload, integer_t index);
+
+/// \ref wkl_keys
+/// \brief Returns the key of every operation, in order.
+int64_t *
+wkl_keys(Workload_t *workload);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref wkl_record
+/// \brief Appends an operation to a workload.
+bool
+wkl_record(Workload_t *workload, WorkloadOperation operation, int64_t key);
+
+/// \ref wkl_save
+/// \brief Writes a workload to a text file.
+bool
+wkl_save(Workload_t *workload, const char *path);
+
+/// \ref wkl_load
+/// \brief Reads a workload from a text file.
+Workload_t *
+wkl_load(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_WORKLOAD_H
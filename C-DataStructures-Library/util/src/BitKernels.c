@@ -0,0 +1,571 @@
+/**
+ * @file BitKernels.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "BitKernels.h"
+
+// Vector kernels need GCC or Clang to compile functions for instruction sets
+// that are not enabled for the whole library and to query the CPU at runtime
+#if defined(__GNUC__) && defined(__x86_64__)
+#define BKN_X86
+#include <immintrin.h>
+#endif
+
+// The fastest kernel allowed by bkn_use(). The kernel that is actually used
+// is the fastest one that is both allowed and supported by the CPU.
+static BitKernel bkn_limit = BitKernelAVX512;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static BitKernel
+bkn_supported(void);
+
+static unsigned_t
+bkn_popcount_word(unsigned_t word);
+
+static unsigned_t
+bkn_popcount_scalar(const unsigned_t *words, unsigned_t size);
+
+#ifdef BKN_X86
+
+static unsigned_t
+bkn_popcount_avx2(const unsigned_t *words, unsigned_t size);
+
+static unsigned_t
+bkn_popcount_avx512(const unsigned_t *words, unsigned_t size);
+
+static bool
+bkn_intersects_avx2(const unsigned_t *words1, const unsigned_t *words2,
+                    unsigned_t size);
+
+static bool
+bkn_intersects_avx512(const unsigned_t *words1, const unsigned_t *words2,
+                      unsigned_t size);
+
+static unsigned_t
+bkn_next_word_avx2(const unsigned_t *words, unsigned_t from, unsigned_t size,
+                   unsigned_t pattern);
+
+static unsigned_t
+bkn_next_word_avx512(const unsigned_t *words, unsigned_t from,
+                     unsigned_t size, unsigned_t pattern);
+
+#endif
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Returns the fastest kernel that is allowed by bkn_use() and supported by
+/// the CPU. This is the kernel used by every other function in this module.
+///
+/// \return The kernel currently in use.
+BitKernel
+bkn_kernel(void)
+{
+    BitKernel supported = bkn_supported();
+
+    return supported < bkn_limit ? supported : bkn_limit;
+}
+
+/// Limits the kernels to the given instruction set. Mostly useful to test and
+/// benchmark slower kernels on a machine that supports faster ones. This is
+/// not thread-safe and should be called before any other thread uses the
+/// kernels.
+///
+/// \param[in] kernel The fastest kernel that may be used.
+///
+/// \return True if the CPU supports the kernel, false otherwise, in which
+/// case nothing changes.
+bool
+bkn_use(BitKernel kernel)
+{
+    if (kernel > bkn_supported())
+        return false;
+
+    bkn_limit = kernel;
+
+    return true;
+}
+
+/// Allocates a buffer of words aligned to \ref BKN_ALIGNMENT and with every
+/// bit set to 0. The buffer must be freed with free().
+///
+/// \param[in] words The amount of words, greater than 0.
+///
+/// \return A new buffer or NULL if the allocation failed.
+unsigned_t *
+bkn_alloc(unsigned_t words)
+{
+    if (words == 0)
+        return NULL;
+
+    // aligned_alloc() requires the size to be a multiple of the alignment
+    size_t bytes = sizeof(unsigned_t) * (size_t)words;
+
+    bytes = (bytes + BKN_ALIGNMENT - 1) / BKN_ALIGNMENT * BKN_ALIGNMENT;
+
+    unsigned_t *buffer = aligned_alloc(BKN_ALIGNMENT, bytes);
+
+    if (!buffer)
+        return NULL;
+
+    memset(buffer, 0, bytes);
+
+    return buffer;
+}
+
+/// Counts how many bits are set in a buffer of words. The AVX2 kernel uses
+/// the Harley-Seal carry-save adder tree over blocks of sixteen vectors and
+/// the AVX-512 kernel uses the VPOPCNTQ instruction.
+///
+/// \param[in] words The buffer of words.
+/// \param[in] size The amount of words.
+///
+/// \return The amount of set bits.
+unsigned_t
+bkn_popcount(const unsigned_t *words, unsigned_t size)
+{
+#ifdef BKN_X86
+    switch (bkn_kernel())
+    {
+        case BitKernelAVX512:
+            return bkn_popcount_avx512(words, size);
+        case BitKernelAVX2:
+            return bkn_popcount_avx2(words, size);
+        default:
+            break;
+    }
+#endif
+
+    return bkn_popcount_scalar(words, size);
+}
+
+// Generates one of the bitwise operations applied to every word of target.
+// Scalar, AVX2 and AVX-512 expressions are given as function-like macros.
+#ifdef BKN_X86
+#define BKN_DEFINE_OPERATION(name, SCALAR, AVX2, AVX512)                       \
+                                                                               \
+__attribute__((target("avx2")))                                                \
+static void                                                                    \
+name##_avx2(unsigned_t *target, const unsigned_t *source, unsigned_t size)     \
+{                                                                              \
+    unsigned_t i = 0;                                                          \
+                                                                               \
+    for (; i + 4 <= size; i += 4)                                              \
+    {                                                                          \
+        __m256i a = _mm256_loadu_si256((const __m256i*)(target + i));          \
+        __m256i b = _mm256_loadu_si256((const __m256i*)(source + i));          \
+                                                                               \
+        _mm256_storeu_si256((__m256i*)(target + i), AVX2(a, b));               \
+    }                                                                          \
+                                                                               \
+    for (; i < size; i++)                                                      \
+        target[i] = SCALAR(target[i], source[i]);                              \
+}                                                                              \
+                                                                               \
+__attribute__((target("avx512f")))                                             \
+static void                                                                    \
+name##_avx512(unsigned_t *target, const unsigned_t *source, unsigned_t size)   \
+{                                                                              \
+    unsigned_t i = 0;                                                          \
+                                                                               \
+    for (; i + 8 <= size; i += 8)                                              \
+    {                                                                          \
+        __m512i a = _mm512_loadu_si512(target + i);                            \
+        __m512i b = _mm512_loadu_si512(source + i);                            \
+                                                                               \
+        _mm512_storeu_si512(target + i, AVX512(a, b));                         \
+    }                                                                          \
+                                                                               \
+    for (; i < size; i++)                                                      \
+        target[i] = SCALAR(target[i], source[i]);                              \
+}                                                                              \
+                                                                               \
+void                                                                           \
+name(unsigned_t *target, const unsigned_t *source, unsigned_t size)            \
+{                                                                              \
+    switch (bkn_kernel())                                                      \
+    {                                                                          \
+        case BitKernelAVX512:                                                  \
+            name##_avx512(target, source, size);                               \
+            return;                                                            \
+        case BitKernelAVX2:                                                    \
+            name##_avx2(target, source, size);                                 \
+            return;                                                            \
+        default:                                                               \
+            break;                                                             \
+    }                                                                          \
+                                                                               \
+    for (unsigned_t i = 0; i < size; i++)                                      \
+        target[i] = SCALAR(target[i], source[i]);                              \
+}
+#else
+#define BKN_DEFINE_OPERATION(name, SCALAR, AVX2, AVX512)                       \
+                                                                               \
+void                                                                           \
+name(unsigned_t *target, const unsigned_t *source, unsigned_t size)            \
+{                                                                              \
+    for (unsigned_t i = 0; i < size; i++)                                      \
+        target[i] = SCALAR(target[i], source[i]);                              \
+}
+#endif
+
+#define BKN_AND(a, b) ((a) & (b))
+#define BKN_OR(a, b) ((a) | (b))
+#define BKN_XOR(a, b) ((a) ^ (b))
+#define BKN_ANDNOT(a, b) ((a) & ~(b))
+
+// The first operand of the andnot intrinsics is the one negated
+#define BKN_ANDNOT_AVX2(a, b) _mm256_andnot_si256(b, a)
+#define BKN_ANDNOT_AVX512(a, b) _mm512_andnot_si512(b, a)
+
+BKN_DEFINE_OPERATION(bkn_and, BKN_AND, _mm256_and_si256, _mm512_and_si512)
+BKN_DEFINE_OPERATION(bkn_or, BKN_OR, _mm256_or_si256, _mm512_or_si512)
+BKN_DEFINE_OPERATION(bkn_xor, BKN_XOR, _mm256_xor_si256, _mm512_xor_si512)
+BKN_DEFINE_OPERATION(bkn_andnot, BKN_ANDNOT, BKN_ANDNOT_AVX2,
+                     BKN_ANDNOT_AVX512)
+
+/// Checks if both buffers have any bit set at the same position.
+///
+/// \param[in] words1 The first buffer.
+/// \param[in] words2 The second buffer.
+/// \param[in] size The amount of words in both buffers.
+///
+/// \return True if any bit is set in both buffers, false otherwise.
+bool
+bkn_intersects(const unsigned_t *words1, const unsigned_t *words2,
+               unsigned_t size)
+{
+#ifdef BKN_X86
+    switch (bkn_kernel())
+    {
+        case BitKernelAVX512:
+            return bkn_intersects_avx512(words1, words2, size);
+        case BitKernelAVX2:
+            return bkn_intersects_avx2(words1, words2, size);
+        default:
+            break;
+    }
+#endif
+
+    for (unsigned_t i = 0; i < size; i++)
+    {
+        if ((words1[i] & words2[i]) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+/// Finds the first word at or after \c from that is not equal to \c pattern.
+/// Searching for the next set bit uses a pattern of 0 and searching for the
+/// next clear bit uses a pattern with every bit set.
+///
+/// \param[in] words The buffer of words.
+/// \param[in] from Index of the first word to be checked.
+/// \param[in] size The amount of words.
+/// \param[in] pattern The word to be skipped.
+///
+/// \return The index of the word found or \c size if there is none.
+unsigned_t
+bkn_next_word(const unsigned_t *words, unsigned_t from, unsigned_t size,
+              unsigned_t pattern)
+{
+#ifdef BKN_X86
+    switch (bkn_kernel())
+    {
+        case BitKernelAVX512:
+            return bkn_next_word_avx512(words, from, size, pattern);
+        case BitKernelAVX2:
+            return bkn_next_word_avx2(words, from, size, pattern);
+        default:
+            break;
+    }
+#endif
+
+    for (unsigned_t i = from; i < size; i++)
+    {
+        if (words[i] != pattern)
+            return i;
+    }
+
+    return size;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static BitKernel
+bkn_supported(void)
+{
+#ifdef BKN_X86
+    if (__builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512vpopcntdq"))
+        return BitKernelAVX512;
+
+    if (__builtin_cpu_supports("avx2"))
+        return BitKernelAVX2;
+#endif
+
+    return BitKernelScalar;
+}
+
+// Counts the number of set bits in a word
+static unsigned_t
+bkn_popcount_word(unsigned_t word)
+{
+#ifdef __GNUC__
+    return (unsigned_t)__builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555);
+    word = (word & 0x3333333333333333) + ((word >> 2) & 0x3333333333333333);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0f;
+
+    return (word * 0x0101010101010101) >> 56;
+#endif
+}
+
+static unsigned_t
+bkn_popcount_scalar(const unsigned_t *words, unsigned_t size)
+{
+    unsigned_t sum = 0;
+
+    for (unsigned_t i = 0; i < size; i++)
+        sum += bkn_popcount_word(words[i]);
+
+    return sum;
+}
+
+#ifdef BKN_X86
+
+// Counts the bits of each 64-bit lane by looking up each nibble in a table
+__attribute__((target("avx2")))
+static inline __m256i
+bkn_popcount_m256(__m256i v)
+{
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    __m256i low = _mm256_and_si256(v, nibble);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+
+    __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, low),
+                                    _mm256_shuffle_epi8(table, high));
+
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+// Carry-save adder: high gets the carries and low the sums of a, b and c
+#define BKN_CSA(high, low, a, b, c)                                            \
+    do {                                                                       \
+        __m256i u = _mm256_xor_si256(a, b);                                    \
+        high = _mm256_or_si256(_mm256_and_si256(a, b),                         \
+                               _mm256_and_si256(u, c));                        \
+        low = _mm256_xor_si256(u, c);                                          \
+    } while (0)
+
+__attribute__((target("avx2")))
+static unsigned_t
+bkn_popcount_avx2(const unsigned_t *words, unsigned_t size)
+{
+    const __m256i *v = (const __m256i*)words;
+    unsigned_t vectors = size / 4;
+
+    __m256i total = _mm256_setzero_si256();
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    __m256i sixteens, twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+
+    unsigned_t i = 0;
+
+    for (; i + 16 <= vectors; i += 16)
+    {
+        BKN_CSA(twos_a, ones, ones, _mm256_loadu_si256(v + i),
+                _mm256_loadu_si256(v + i + 1));
+        BKN_CSA(twos_b, ones, ones, _mm256_loadu_si256(v + i + 2),
+                _mm256_loadu_si256(v + i + 3));
+        BKN_CSA(fours_a, twos, twos, twos_a, twos_b);
+        BKN_CSA(twos_a, ones, ones, _mm256_loadu_si256(v + i + 4),
+                _mm256_loadu_si256(v + i + 5));
+        BKN_CSA(twos_b, ones, ones, _mm256_loadu_si256(v + i + 6),
+                _mm256_loadu_si256(v + i + 7));
+        BKN_CSA(fours_b, twos, twos, twos_a, twos_b);
+        BKN_CSA(eights_a, fours, fours, fours_a, fours_b);
+        BKN_CSA(twos_a, ones, ones, _mm256_loadu_si256(v + i + 8),
+                _mm256_loadu_si256(v + i + 9));
+        BKN_CSA(twos_b, ones, ones, _mm256_loadu_si256(v + i + 10),
+                _mm256_loadu_si256(v + i + 11));
+        BKN_CSA(fours_a, twos, twos, twos_a, twos_b);
+        BKN_CSA(twos_a, ones, ones, _mm256_loadu_si256(v + i + 12),
+                _mm256_loadu_si256(v + i + 13));
+        BKN_CSA(twos_b, ones, ones, _mm256_loadu_si256(v + i + 14),
+                _mm256_loadu_si256(v + i + 15));
+        BKN_CSA(fours_b, twos, twos, twos_a, twos_b);
+        BKN_CSA(eights_b, fours, fours, fours_a, fours_b);
+        BKN_CSA(sixteens, eights, eights, eights_a, eights_b);
+
+        total = _mm256_add_epi64(total, bkn_popcount_m256(sixteens));
+    }
+
+    // Each bit in total is worth 16, eights 8 and so on
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total,
+            _mm256_slli_epi64(bkn_popcount_m256(eights), 3));
+    total = _mm256_add_epi64(total,
+            _mm256_slli_epi64(bkn_popcount_m256(fours), 2));
+    total = _mm256_add_epi64(total,
+            _mm256_slli_epi64(bkn_popcount_m256(twos), 1));
+    total = _mm256_add_epi64(total, bkn_popcount_m256(ones));
+
+    for (; i < vectors; i++)
+        total = _mm256_add_epi64(total,
+                bkn_popcount_m256(_mm256_loadu_si256(v + i)));
+
+    unsigned_t sum = (unsigned_t)_mm256_extract_epi64(total, 0)
+                   + (unsigned_t)_mm256_extract_epi64(total, 1)
+                   + (unsigned_t)_mm256_extract_epi64(total, 2)
+                   + (unsigned_t)_mm256_extract_epi64(total, 3);
+
+    return sum + bkn_popcount_scalar(words + vectors * 4, size - vectors * 4);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static unsigned_t
+bkn_popcount_avx512(const unsigned_t *words, unsigned_t size)
+{
+    __m512i total = _mm512_setzero_si512();
+
+    unsigned_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+        total = _mm512_add_epi64(total,
+                _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+
+    // The remaining words are loaded with a mask
+    if (i < size)
+    {
+        __mmask8 mask = (__mmask8)((1u << (size - i)) - 1);
+
+        total = _mm512_add_epi64(total,
+                _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(mask,
+                                                             words + i)));
+    }
+
+    return (unsigned_t)_mm512_reduce_add_epi64(total);
+}
+
+__attribute__((target("avx2")))
+static bool
+bkn_intersects_avx2(const unsigned_t *words1, const unsigned_t *words2,
+                    unsigned_t size)
+{
+    unsigned_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(words1 + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(words2 + i));
+
+        if (!_mm256_testz_si256(a, b))
+            return true;
+    }
+
+    for (; i < size; i++)
+    {
+        if ((words1[i] & words2[i]) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+__attribute__((target("avx512f")))
+static bool
+bkn_intersects_avx512(const unsigned_t *words1, const unsigned_t *words2,
+                      unsigned_t size)
+{
+    unsigned_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+    {
+        __m512i a = _mm512_loadu_si512(words1 + i);
+        __m512i b = _mm512_loadu_si512(words2 + i);
+
+        if (_mm512_test_epi64_mask(a, b))
+            return true;
+    }
+
+    for (; i < size; i++)
+    {
+        if ((words1[i] & words2[i]) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+__attribute__((target("avx2")))
+static unsigned_t
+bkn_next_word_avx2(const unsigned_t *words, unsigned_t from, unsigned_t size,
+                   unsigned_t pattern)
+{
+    const __m256i p = _mm256_set1_epi64x((long long)pattern);
+
+    unsigned_t i = from;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i x = _mm256_xor_si256(
+                _mm256_loadu_si256((const __m256i*)(words + i)), p);
+
+        if (!_mm256_testz_si256(x, x))
+            break;
+    }
+
+    for (; i < size; i++)
+    {
+        if (words[i] != pattern)
+            return i;
+    }
+
+    return size;
+}
+
+__attribute__((target("avx512f")))
+static unsigned_t
+bkn_next_word_avx512(const unsigned_t *words, unsigned_t from,
+                     unsigned_t size, unsigned_t pattern)
+{
+    const __m512i p = _mm512_set1_epi64((long long)pattern);
+
+    for (unsigned_t i = from; i + 8 <= size; i += 8)
+    {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512(words + i), p);
+
+        __mmask8 mask = _mm512_test_epi64_mask(x, x);
+
+        if (mask)
+            return i + (unsigned_t)__builtin_ctz(mask);
+
+        from = i + 8;
+    }
+
+    for (unsigned_t i = from; i < size; i++)
+    {
+        if (words[i] != pattern)
+            return i;
+    }
+
+    return size;
+}
+
+#endif
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
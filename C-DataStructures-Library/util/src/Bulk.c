@@ -0,0 +1,396 @@
+/**
+ * @file Bulk.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Bulk.h"
+
+/// Buffers smaller than this are not worth splitting between threads.
+#define BLK_PARALLEL_THRESHOLD 2048
+
+/// \brief A bulk operation over a chunk of a buffer.
+///
+/// Implementation detail. Runs one of the operations over
+/// \c source[begin, begin + size). Only the fields of that operation are set.
+struct BulkTask_s
+{
+    /// \brief Buffer read by the task.
+    void **source;
+
+    /// \brief Buffer written by a map task.
+    void **target;
+
+    /// \brief The chunk.
+    integer_t begin, size;
+
+    /// \brief The function of the operation.
+    visit_f visit;
+    map_f map;
+    predicate_f keep;
+    reduce_f reduce;
+
+    /// \brief User defined argument passed to the function.
+    void *argument;
+
+    /// \brief Where a reduce task folds its chunk.
+    void *accumulator;
+
+    /// \brief Releases the elements removed by a filter task.
+    Interface_t *interface;
+
+    /// \brief If a filter task moves the elements it keeps to the start of
+    /// its chunk instead of leaving holes.
+    bool compact;
+
+    /// \brief Amount of elements a filter task removed, or if a map task
+    /// failed.
+    integer_t result;
+};
+
+typedef struct BulkTask_s BulkTask_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+blk_chunks(ThreadPool_t *pool, integer_t size);
+
+static BulkTask_t *
+blk_split(BulkTask_t model, integer_t chunks);
+
+static void
+blk_run(ThreadPool_t *pool, task_f function, BulkTask_t *tasks,
+        integer_t chunks);
+
+static void
+blk_for_each_task(void *task);
+
+static void
+blk_map_task(void *task);
+
+static void
+blk_filter_task(void *task);
+
+static void
+blk_reduce_task(void *task);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Calls \c visit with every element of a buffer and \c argument. NULL slots
+/// are skipped. With a \c pool the buffer is split in one chunk per thread
+/// and the elements are visited in no particular order, so \c visit must be
+/// safe to call from several threads at once.
+///
+/// Without a pool, with a single thread or with a small buffer everything
+/// runs in the calling thread, in order.
+///
+/// \param[in] buffer The buffer of elements.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] visit The function called with each element.
+/// \param[in] argument An argument passed to \c visit.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+blk_for_each(void **buffer, integer_t size, visit_f visit, void *argument,
+             ThreadPool_t *pool)
+{
+    BulkTask_t model = { .source = buffer, .size = size, .visit = visit,
+                         .argument = argument };
+
+    integer_t chunks = blk_chunks(pool, size);
+
+    BulkTask_t *tasks = chunks > 1 ? blk_split(model, chunks) : NULL;
+
+    if (!tasks)
+    {
+        blk_for_each_task(&model);
+        return;
+    }
+
+    blk_run(pool, blk_for_each_task, tasks, chunks);
+
+    free(tasks);
+}
+
+/// Stores in \c target[i] the element made by \c map out of \c source[i], for
+/// every element of \c source. NULL slots stay NULL. The source is left
+/// untouched and may be the same buffer as the target if the mapped
+/// elements replace the old ones. With a \c pool the buffer is split in one
+/// chunk per thread.
+///
+/// \param[in] source The buffer of elements.
+/// \param[out] target Where the new elements are stored.
+/// \param[in] size The amount of elements in both buffers.
+/// \param[in] map The function that makes each new element.
+/// \param[in] argument An argument passed to \c map.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return True if every element was mapped. False if \c map returned NULL
+/// for any of them, in which case \c target holds NULL where \c map failed
+/// and the other new elements, which the caller must release.
+bool
+blk_map(void **source, void **target, integer_t size, map_f map,
+        void *argument, ThreadPool_t *pool)
+{
+    BulkTask_t model = { .source = source, .target = target, .size = size,
+                         .map = map, .argument = argument };
+
+    integer_t chunks = blk_chunks(pool, size);
+
+    BulkTask_t *tasks = chunks > 1 ? blk_split(model, chunks) : NULL;
+
+    if (!tasks)
+    {
+        blk_map_task(&model);
+        return model.result == 0;
+    }
+
+    blk_run(pool, blk_map_task, tasks, chunks);
+
+    bool mapped = true;
+
+    for (integer_t c = 0; c < chunks; c++)
+        mapped = mapped && tasks[c].result == 0;
+
+    free(tasks);
+
+    return mapped;
+}
+
+/// Releases with \c interface every element of a buffer for which \c keep
+/// returns false. NULL slots are left alone. If \c compact is set, the
+/// elements that are kept are moved to the start of the buffer in the same
+/// order. Otherwise every removed element leaves a NULL slot behind.
+///
+/// With a \c pool the buffer is split in one chunk per thread that is
+/// filtered and compacted on its own; the chunks are then moved together.
+///
+/// \param[in] buffer The buffer of elements.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] keep Returns true for the elements that are kept.
+/// \param[in] argument An argument passed to \c keep.
+/// \param[in] interface Releases the removed elements.
+/// \param[in] compact If the kept elements are moved together.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+///
+/// \return The amount of elements removed.
+integer_t
+blk_filter(void **buffer, integer_t size, predicate_f keep, void *argument,
+           Interface_t *interface, bool compact, ThreadPool_t *pool)
+{
+    BulkTask_t model = { .source = buffer, .size = size, .keep = keep,
+                         .argument = argument, .interface = interface,
+                         .compact = compact };
+
+    integer_t chunks = blk_chunks(pool, size);
+
+    BulkTask_t *tasks = chunks > 1 ? blk_split(model, chunks) : NULL;
+
+    if (!tasks)
+    {
+        blk_filter_task(&model);
+        return model.result;
+    }
+
+    blk_run(pool, blk_filter_task, tasks, chunks);
+
+    integer_t removed = 0, end = 0;
+
+    for (integer_t c = 0; c < chunks; c++)
+    {
+        integer_t kept = tasks[c].size - tasks[c].result;
+
+        if (compact && end != tasks[c].begin)
+            memmove(buffer + end, buffer + tasks[c].begin,
+                    sizeof(void*) * (size_t)kept);
+
+        end += kept;
+        removed += tasks[c].result;
+    }
+
+    free(tasks);
+
+    return removed;
+}
+
+/// Folds every element of a buffer into \c accumulator with \c reduce. NULL
+/// slots are skipped.
+///
+/// With a \c pool the buffer is split in one chunk per thread. The first
+/// chunk is folded into \c accumulator and every other chunk into a copy of
+/// \c identity, an accumulator that doesn't change a result it is combined
+/// with, like zero for a sum. These partial results are then folded into
+/// \c accumulator in order with \c combine, so \c reduce and \c combine only
+/// need to be associative. Without \c identity or \c combine, or if the
+/// partial results could not be allocated, everything runs in the calling
+/// thread.
+///
+/// \param[in] buffer The buffer of elements.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in,out] accumulator The initial value and the result.
+/// \param[in] identity The initial value of each partial result.
+/// \param[in] accumulator_size Size in bytes of the accumulator.
+/// \param[in] reduce Folds an element into an accumulator.
+/// \param[in] combine Folds a partial result into an accumulator.
+/// \param[in] pool A thread pool or NULL to run in the calling thread.
+void
+blk_reduce(void **buffer, integer_t size, void *accumulator,
+           const void *identity, size_t accumulator_size, reduce_f reduce,
+           reduce_f combine, ThreadPool_t *pool)
+{
+    BulkTask_t model = { .source = buffer, .size = size, .reduce = reduce,
+                         .accumulator = accumulator };
+
+    integer_t chunks = identity && combine ? blk_chunks(pool, size) : 1;
+
+    BulkTask_t *tasks = chunks > 1 ? blk_split(model, chunks) : NULL;
+
+    unsigned char *partials = tasks ? malloc(accumulator_size
+                                             * (size_t)(chunks - 1)) : NULL;
+
+    if (!partials)
+    {
+        free(tasks);
+        blk_reduce_task(&model);
+        return;
+    }
+
+    for (integer_t c = 1; c < chunks; c++)
+    {
+        tasks[c].accumulator = partials + accumulator_size * (size_t)(c - 1);
+
+        memcpy(tasks[c].accumulator, identity, accumulator_size);
+    }
+
+    blk_run(pool, blk_reduce_task, tasks, chunks);
+
+    for (integer_t c = 1; c < chunks; c++)
+        combine(accumulator, tasks[c].accumulator);
+
+    free(partials);
+    free(tasks);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// One chunk per thread, or a single one if it is not worth splitting
+static integer_t
+blk_chunks(ThreadPool_t *pool, integer_t size)
+{
+    if (!pool || size < BLK_PARALLEL_THRESHOLD)
+        return 1;
+
+    return tpl_threads(pool);
+}
+
+// Copies the model into one task per chunk of about the same size, or
+// returns NULL if allocation failed
+static BulkTask_t *
+blk_split(BulkTask_t model, integer_t chunks)
+{
+    BulkTask_t *tasks = malloc(sizeof(BulkTask_t) * (size_t)chunks);
+
+    if (!tasks)
+        return NULL;
+
+    for (integer_t c = 0; c < chunks; c++)
+    {
+        tasks[c] = model;
+        tasks[c].begin = model.size * c / chunks;
+        tasks[c].size = model.size * (c + 1) / chunks - tasks[c].begin;
+    }
+
+    return tasks;
+}
+
+// Runs every task in the pool and waits for them. Tasks that can't be
+// submitted run in the calling thread.
+static void
+blk_run(ThreadPool_t *pool, task_f function, BulkTask_t *tasks,
+        integer_t chunks)
+{
+    for (integer_t c = 0; c < chunks; c++)
+    {
+        if (!tpl_submit(pool, function, &tasks[c]))
+            function(&tasks[c]);
+    }
+
+    tpl_wait(pool);
+}
+
+static void
+blk_for_each_task(void *task)
+{
+    BulkTask_t *t = task;
+
+    void **chunk = t->source + t->begin;
+
+    for (integer_t i = 0; i < t->size; i++)
+    {
+        if (chunk[i])
+            t->visit(chunk[i], t->argument);
+    }
+}
+
+static void
+blk_map_task(void *task)
+{
+    BulkTask_t *t = task;
+
+    void **chunk = t->source + t->begin;
+    void **target = t->target + t->begin;
+
+    for (integer_t i = 0; i < t->size; i++)
+    {
+        void *element = chunk[i];
+
+        target[i] = element ? t->map(element, t->argument) : NULL;
+
+        if (element && !target[i])
+            t->result = 1;
+    }
+}
+
+// Compacts the chunk to its start and counts the removed elements
+static void
+blk_filter_task(void *task)
+{
+    BulkTask_t *t = task;
+
+    void **chunk = t->source + t->begin;
+
+    integer_t end = 0;
+
+    for (integer_t i = 0; i < t->size; i++)
+    {
+        void *element = chunk[i];
+
+        if (element && !t->keep(element, t->argument))
+        {
+            interface_release(t->interface, element);
+            t->result++;
+
+            if (!t->compact)
+                chunk[i] = NULL;
+        }
+        else if (t->compact)
+            chunk[end++] = element;
+    }
+}
+
+static void
+blk_reduce_task(void *task)
+{
+    BulkTask_t *t = task;
+
+    void **chunk = t->source + t->begin;
+
+    for (integer_t i = 0; i < t->size; i++)
+    {
+        if (chunk[i])
+            t->reduce(t->accumulator, chunk[i]);
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -8,16 +8,40 @@
 
 #include "CString.h"
 
+// The vector filter needs GCC or Clang to compile a function for AVX2 when it
+// is not enabled for the whole library and to query the CPU at runtime
+#if defined(__GNUC__) && defined(__x86_64__)
+#define STR_X86
+#include <immintrin.h>
+#endif
+
+/// Capacity of the buffer kept inside a String_s. Strings that fit in it need
+/// a single allocation.
+#define STR_INLINE 24
+
+/// Keys up to this length are searched with a filter on their first and last
+/// characters. Longer keys use Boyer-Moore-Horspool.
+#define STR_SHORT_KEY 32
+
 /// \brief A wrapper for an array of characters.
 ///
 /// A \c String_s is an abstraction on top of an array of characters. Many high
 /// level languages provide an implementation of a string and this is one
 /// simple implementation because C lacks a string abstraction.
+///
+/// The buffer is a gap buffer: the unused capacity is kept at the position of
+/// the last edit, with the characters before it at the start of the buffer and
+/// the characters after it at the end. Inserting or removing characters moves
+/// the gap to the edit, which only costs the distance from the previous one,
+/// so a sequence of edits around the same position doesn't shift the whole
+/// buffer every time. Every other function moves the gap back to the end,
+/// leaving the usual null-terminated sequence of characters.
 struct String_s
 {
     /// \brief Character buffer.
     ///
-    /// Null-terminated sequence of characters.
+    /// Null-terminated sequence of characters when the gap is at the end.
+    /// Points to \c small until the string outgrows it.
     char *buffer;
     
     /// \brief String current length.
@@ -37,15 +61,78 @@ struct String_s
     ///
     /// <code> capacity *= (growth_rate / 100.0) </code>
     integer_t growth_rate;
+
+    /// \brief Start of the gap.
+    ///
+    /// Position of the gap in the string. The characters after it are stored
+    /// right before the last position of the buffer. When it equals the
+    /// length the gap is at the end and the buffer is a regular string.
+    integer_t gap;
+
+    /// \brief Buffer used while the capacity is at most STR_INLINE.
+    char small[STR_INLINE];
 };
 
-///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+/// \brief A key prepared for substring searches.
+///
+/// Keeps everything that depends only on the key, so a key that is searched
+/// many times is only analysed once. Keys up to STR_SHORT_KEY characters are
+/// found by looking for positions where both their first and last characters
+/// match, 32 positions at a time with AVX2 when the CPU has it, and only then
+/// comparing the rest. Longer keys use Boyer-Moore-Horspool, which skips
+/// ahead by up to the length of the key after each mismatch.
+struct StringSearcher_s
+{
+    /// \brief The key, not necessarily null-terminated.
+    char *key;
+
+    /// \brief Length of the key.
+    integer_t length;
 
-static Status str_realloc(String string);
+    /// \brief Horspool shift for each character that ends a window.
+    ///
+    /// Only used by keys longer than STR_SHORT_KEY.
+    integer_t skip[256];
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static Status str_accommodate(String string, integer_t size);
 
-static bool str_buffer_full(String string);
+static void str_move_gap(String string, integer_t index);
+
+static void str_flatten(String string);
+
+static Status str_insert(String string, char *ch, integer_t length,
+                         integer_t index);
+
+static Status str_insert_string(String string1, String string2,
+                                integer_t index);
+
+static void str_cut(String string, integer_t index, integer_t length);
+
+static void str_searcher_prepare(StringSearcher searcher, char *key,
+                                 integer_t length);
+
+static integer_t str_search(StringSearcher searcher, const char *text,
+                            integer_t size, integer_t from);
+
+static Status str_search_all(StringSearcher searcher, String string,
+                             integer_t **result, integer_t *count);
+
+static integer_t str_filter(const char *text, integer_t size, integer_t from,
+                            const char *key, integer_t length);
+
+#ifdef STR_X86
+
+static integer_t str_filter_avx2(const char *text, integer_t size,
+                                 integer_t from, const char *key,
+                                 integer_t length);
+
+#endif
+
+static integer_t str_horspool(StringSearcher searcher, const char *text,
+                              integer_t size, integer_t from);
 
 static bool str_buffer_empty(String string);
 
@@ -57,8 +144,8 @@ static integer_t str_len(char *ch);
 
 /// \brief Initializes an empty string.
 ///
-/// Initializes an empty string with initial capacity of 8 and growth rate of
-/// 200, that is, twice the size after each growth.
+/// Initializes an empty string with initial capacity of STR_INLINE and growth
+/// rate of 200, that is, twice the size after each growth.
 ///
 /// \param string String_s to be initialized.
 ///
@@ -66,30 +153,7 @@ static integer_t str_len(char *ch);
 /// \return DS_OK if all operations are successful.
 Status str_init(String *string)
 {
-    (*string) = malloc(sizeof(String_t));
-
-    if (!(*string))
-        return DS_ERR_ALLOC;
-
-    (*string)->buffer = malloc(sizeof(char) * 8);
-
-    if (!((*string)->buffer))
-    {
-        free(*string);
-
-        *string = NULL;
-
-        return DS_ERR_ALLOC;
-    }
-
-    (*string)->buffer[0] = '\0';
-
-    (*string)->capacity = 8;
-    (*string)->growth_rate = 200;
-
-    (*string)->length = 0;
-
-    return DS_OK;
+    return str_create(string, STR_INLINE, 200);
 }
 
 /// \brief Creates a String_s with custom parameters.
@@ -104,6 +168,8 @@ Status str_init(String *string)
 /// \param[in] initial_capacity User-defined initial capacity.
 /// \param[in] growth_rate User-defined growth rate.
 ///
+/// Capacities up to STR_INLINE use the buffer inside the struct.
+///
 /// \return DS_ERR_ALLOC if string or buffer allocation failed.
 /// \return DS_ERR_INVALID_ARGUMENT if initial_capacity is less than 8 or
 /// growth_rate is less than or equal to 100.
@@ -118,15 +184,25 @@ Status str_create(String *string, integer_t initial_capacity, integer_t growth_r
     if (!(*string))
         return DS_ERR_ALLOC;
 
-    (*string)->buffer = malloc(sizeof(char) * initial_capacity);
+    // Small strings live inside the struct, with a single allocation
+    if (initial_capacity <= STR_INLINE)
+    {
+        (*string)->buffer = (*string)->small;
 
-    if (!((*string)->buffer))
+        initial_capacity = STR_INLINE;
+    }
+    else
     {
-        free(*string);
+        (*string)->buffer = malloc(sizeof(char) * initial_capacity);
 
-        *string = NULL;
+        if (!((*string)->buffer))
+        {
+            free(*string);
 
-        return DS_ERR_ALLOC;
+            *string = NULL;
+
+            return DS_ERR_ALLOC;
+        }
     }
 
     (*string)->buffer[0] = '\0';
@@ -135,6 +211,7 @@ Status str_create(String *string, integer_t initial_capacity, integer_t growth_r
     (*string)->growth_rate = growth_rate;
 
     (*string)->length = 0;
+    (*string)->gap = 0;
 
     return DS_OK;
 }
@@ -146,12 +223,13 @@ Status str_make(String *string, char *char_array)
     if (length == 0)
         return DS_ERR_INVALID_ARGUMENT;
 
-    Status st = str_create(string, (length < 8) ? 8 : length, 200);
+    Status st = str_create(string, (length < 8) ? 8 : length + 1, 200);
 
     if (st != DS_OK)
         return st;
 
     (*string)->length = length;
+    (*string)->gap = length;
 
     for (integer_t i = 0; i < length; i++)
     {
@@ -168,7 +246,8 @@ Status str_delete(String *string)
     if ((*string) == NULL)
         return DS_ERR_NULL_POINTER;
 
-    free((*string)->buffer);
+    if ((*string)->buffer != (*string)->small)
+        free((*string)->buffer);
 
     free(*string);
 
@@ -201,6 +280,7 @@ Status str_clear(String string)
         return DS_ERR_NULL_POINTER;
 
     string->length = 0;
+    string->gap = 0;
 
     string->buffer[0] = '\0';
 
@@ -222,8 +302,12 @@ Status str_get_string(String string, char **result)
     if (!char_array)
         return DS_ERR_ALLOC;
 
-    for (integer_t i = 0; i < string->length; i++)
-        char_array[i] = string->buffer[i];
+    // Both sides of the gap are copied without moving it
+    integer_t after = string->length - string->gap;
+
+    memcpy(char_array, string->buffer, (size_t)string->gap);
+    memcpy(char_array + string->gap,
+           string->buffer + string->capacity - 1 - after, (size_t)after);
 
     char_array[string->length] = '\0';
 
@@ -232,6 +316,22 @@ Status str_get_string(String string, char **result)
     return DS_OK;
 }
 
+// Gives the buffer itself instead of a copy. It stays valid until the string
+// is changed.
+Status str_view(String string, const char **result)
+{
+    (*result) = NULL;
+
+    if (string == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    str_flatten(string);
+
+    *result = string->buffer;
+
+    return DS_OK;
+}
+
 integer_t str_length(String string)
 {
     if (string == NULL)
@@ -245,28 +345,7 @@ Status str_push_char_front(String string, char ch)
     if (string == NULL)
         return DS_ERR_NULL_POINTER;
 
-    Status st;
-
-    if (str_buffer_full(string))
-    {
-        st = str_realloc(string);
-
-        if (st != DS_OK)
-            return st;
-    }
-
-    for (integer_t i = string->length; i > 0; i--)
-    {
-        string->buffer[i] = string->buffer[i - 1];
-    }
-
-    string->buffer[0] = ch;
-
-    string->length++;
-
-    string->buffer[string->length] = '\0';
-
-    return DS_OK;
+    return str_insert(string, &ch, 1, 0);
 }
 
 Status str_push_char_at(String string, char ch, integer_t index)
@@ -280,45 +359,7 @@ Status str_push_char_at(String string, char ch, integer_t index)
     if (index > string->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    Status st;
-
-    if (index == 0)
-    {
-        st = str_push_char_front(string, ch);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else if (index == string->length)
-    {
-        st = str_push_char_front(string, ch);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else
-    {
-        if (str_buffer_full(string))
-        {
-            st = str_realloc(string);
-
-            if (st != DS_OK)
-                return st;
-        }
-
-        for (integer_t i = string->length; i > index; i--)
-        {
-            string->buffer[i] = string->buffer[i - 1];
-        }
-
-        string->buffer[index] = ch;
-
-        string->length++;
-
-        string->buffer[string->length] = '\0';
-    }
-
-    return DS_OK;
+    return str_insert(string, &ch, 1, index);
 }
 
 Status str_push_char_back(String string, char ch)
@@ -326,23 +367,7 @@ Status str_push_char_back(String string, char ch)
     if (string == NULL)
         return DS_ERR_NULL_POINTER;
 
-    Status st;
-
-    if (str_buffer_full(string))
-    {
-        st = str_realloc(string);
-
-        if (st != DS_OK)
-            return st;
-    }
-
-    string->buffer[string->length] = ch;
-
-    string->length++;
-
-    string->buffer[string->length] = '\0';
-
-    return DS_OK;
+    return str_insert(string, &ch, 1, string->length);
 }
 
 Status str_push_front(String string, char *ch)
@@ -355,26 +380,7 @@ Status str_push_front(String string, char *ch)
     if (length == 0)
         return DS_ERR_INVALID_ARGUMENT;
 
-    Status st = str_accommodate(string, length);
-
-    if (st != DS_OK)
-        return st;
-
-    for (integer_t i = string->length; i > 0; i--)
-    {
-        string->buffer[i + length - 1] = string->buffer[i - 1];
-    }
-
-    for (integer_t i = 0; i < length; i++)
-    {
-        string->buffer[i] = ch[i];
-    }
-
-    string->length += length;
-
-    string->buffer[string->length] = '\0';
-
-    return DS_OK;
+    return str_insert(string, ch, length, 0);
 }
 
 Status str_push_at(String string, char *ch, integer_t index)
@@ -388,50 +394,12 @@ Status str_push_at(String string, char *ch, integer_t index)
     if (index > string->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    Status st;
-
-    if (index == 0)
-    {
-        st = str_push_front(string, ch);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else if (index == string->length)
-    {
-        st = str_push_back(string, ch);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else
-    {
-        integer_t length = str_len(ch);
-
-        if (length == 0)
-            return DS_ERR_INVALID_ARGUMENT;
-
-        st = str_accommodate(string, length);
-
-        if (st != DS_OK)
-            return st;
-
-        for (integer_t i = string->length; i >= index; i--)
-        {
-            string->buffer[i + length] = string->buffer[i];
-        }
-
-        for (integer_t i = index, j = 0; i < index + length; i++, j++)
-        {
-            string->buffer[i] = ch[j];
-        }
-
-        string->length += length;
+    integer_t length = str_len(ch);
 
-        string->buffer[string->length] = '\0';
-    }
+    if (length == 0)
+        return DS_ERR_INVALID_ARGUMENT;
 
-    return DS_OK;
+    return str_insert(string, ch, length, index);
 }
 
 Status str_push_back(String string, char *ch)
@@ -444,21 +412,7 @@ Status str_push_back(String string, char *ch)
     if (length == 0)
         return DS_ERR_INVALID_ARGUMENT;
 
-    Status st = str_accommodate(string, length);
-
-    if (st != DS_OK)
-        return st;
-
-    for (integer_t i = string->length, j = 0; i < length + string->length; i++, j++)
-    {
-        string->buffer[i] = ch[j];
-    }
-
-    string->length += length;
-
-    string->buffer[string->length] = '\0';
-
-    return DS_OK;
+    return str_insert(string, ch, length, string->length);
 }
 
 Status str_prepend(String string1, String string2)
@@ -469,25 +423,11 @@ Status str_prepend(String string1, String string2)
     if (str_buffer_empty(string2))
         return DS_OK;
 
-    Status st = str_accommodate(string1, string2->length);
+    Status st = str_insert_string(string1, string2, 0);
 
     if (st != DS_OK)
         return st;
 
-    for (integer_t i = string1->length; i > 0; i--)
-    {
-        string1->buffer[i + string2->length - 1] = string1->buffer[i - 1];
-    }
-
-    for (integer_t i = 0; i < string2->length; i++)
-    {
-        string1->buffer[i] = string2->buffer[i];
-    }
-
-    string1->length += string2->length;
-
-    string1->buffer[string1->length] = '\0';
-
     st = str_clear(string2);
 
     if (st != DS_OK)
@@ -501,45 +441,13 @@ Status str_add(String string1, String string2, integer_t index)
     if (string1 == NULL || string2 == NULL)
         return DS_ERR_NULL_POINTER;
 
-    Status st;
-
-    if (index == 0)
-    {
-        st = str_prepend(string1, string2);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else if (index == string1->length)
-    {
-        st = str_append(string1, string2);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else
-    {
-        st = str_accommodate(string1, string2->length);
-
-        if (st != DS_OK)
-            return st;
-
-        for (integer_t i = string1->length; i >= index; i--)
-        {
-            string1->buffer[i + string2->length] = string1->buffer[i];
-        }
-
-        for (integer_t i = index, j = 0; i < index + string2->length; i++, j++)
-        {
-            string1->buffer[i] = string2->buffer[j];
-        }
-
-        string1->length += string2->length;
+    if (index < 0)
+        return DS_ERR_NEGATIVE_VALUE;
 
-        string1->buffer[string1->length] = '\0';
-    }
+    if (index > string1->length)
+        return DS_ERR_OUT_OF_RANGE;
 
-    return DS_OK;
+    return str_insert_string(string1, string2, index);
 }
 
 Status str_append(String string1, String string2)
@@ -547,25 +455,7 @@ Status str_append(String string1, String string2)
     if (string1 == NULL || string2 == NULL)
         return DS_ERR_NULL_POINTER;
 
-    if (str_buffer_empty(string2))
-        return DS_OK;
-
-    Status st = str_accommodate(string1, string2->length);
-
-    if (st != DS_OK)
-        return st;
-
-    for (integer_t i = string1->length, j = 0;
-                   i < string1->length + string2->length; i++, j++)
-    {
-        string1->buffer[i] = string2->buffer[j];
-    }
-
-    string1->length += string2->length;
-
-    string1->buffer[string1->length] = '\0';
-
-    return DS_OK;
+    return str_insert_string(string1, string2, string1->length);
 }
 
 Status str_pop_char_front(String string)
@@ -576,14 +466,7 @@ Status str_pop_char_front(String string)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
-    for (integer_t i = 0; i < string->length; i++)
-    {
-        string->buffer[i] = string->buffer[i + 1];
-    }
-
-    string->length--;
-
-    string->buffer[string->length] = '\0';
+    str_cut(string, 0, 1);
 
     return DS_OK;
 }
@@ -596,36 +479,13 @@ Status str_pop_char_at(String string, integer_t index)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
+    if (index < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
     if (index >= string->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    Status st;
-
-    if (index == 0)
-    {
-        st = str_pop_char_front(string);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else if (index == string->length - 1)
-    {
-        st = str_pop_char_back(string);
-
-        if (st != DS_OK)
-            return st;
-    }
-    else
-    {
-        for (integer_t i = index; i < string->length; i++)
-        {
-            string->buffer[i] = string->buffer[i + 1];
-        }
-
-        string->length--;
-
-        string->buffer[string->length] = '\0';
-    }
+    str_cut(string, index, 1);
 
     return DS_OK;
 }
@@ -638,23 +498,65 @@ Status str_pop_char_back(String string)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
-    string->length--;
-
-    string->buffer[string->length] = '\0';
+    str_cut(string, string->length - 1, 1);
 
     return DS_OK;
 }
 
+// Removes the characters from 'from' to 'to', both inclusive
 Status str_remove(String string, integer_t from, integer_t to)
 {
-    // TODO
-    return DS_ERR_INVALID_OPERATION;
+    if (string == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (from < 0 || to < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (to >= string->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    str_cut(string, from, to - from + 1);
+
+    return DS_OK;
 }
 
+// Copies the characters from 'from' to 'to', both inclusive, to a new string
 Status str_slice(String string, String *result, integer_t from, integer_t to)
 {
-    // TODO
-    return DS_ERR_INVALID_OPERATION;
+    *result = NULL;
+
+    if (string == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (from < 0 || to < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (to >= string->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    integer_t length = to - from + 1;
+
+    Status st = str_create(result, (length < 8) ? 8 : length + 1,
+                           string->growth_rate);
+
+    if (st != DS_OK)
+        return st;
+
+    str_flatten(string);
+
+    memcpy((*result)->buffer, string->buffer + from, (size_t)length);
+
+    (*result)->length = length;
+    (*result)->gap = length;
+    (*result)->buffer[length] = '\0';
+
+    return DS_OK;
 }
 
 bool str_emtpy(String string)
@@ -670,6 +572,8 @@ Status str_front(String string, char *result)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
+    str_flatten(string);
+
     *result = string->buffer[0];
 
     return DS_OK;
@@ -683,6 +587,8 @@ Status str_back(String string, char *result)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
+    str_flatten(string);
+
     *result = string->buffer[string->length - 1];
 
     return DS_OK;
@@ -700,6 +606,9 @@ int str_compare(String string1, String string2)
 
 bool str_greater(String string1, String string2)
 {
+    str_flatten(string1);
+    str_flatten(string2);
+
     integer_t length = (string1->length > string2->length) ?
             string2->length : string1->length;
 
@@ -722,6 +631,9 @@ bool str_equals(String string1, String string2)
     if (string1->length != string2->length)
         return false;
 
+    str_flatten(string1);
+    str_flatten(string2);
+
     for (integer_t i = 0; i < string1->length; i++)
         if (string1->buffer[i] != string2->buffer[i])
             return false;
@@ -731,6 +643,9 @@ bool str_equals(String string1, String string2)
 
 bool str_lesser(String string1, String string2)
 {
+    str_flatten(string1);
+    str_flatten(string2);
+
     integer_t length = (string1->length > string2->length) ?
             string2->length : string1->length;
 
@@ -758,6 +673,8 @@ bool str_equals_str(String string, char *char_array)
     if (string->length != length)
         return false;
 
+    str_flatten(string);
+
     for (integer_t i = 0; i < length; i++)
         if (string->buffer[i] != char_array[i])
             return false;
@@ -765,32 +682,79 @@ bool str_equals_str(String string, char *char_array)
     return true;
 }
 
+// Returns true if string1 has substring string2
 // Returns true if string1 has substring string2
 bool str_substring(String string1, String string2)
 {
-    // TODO
-    return false;
+    integer_t pos;
+
+    return str_find_substring(string1, string2, &pos) == DS_OK;
 }
 
+// Returns true if string has substring ch
 // Returns true if string has substring ch
 bool str_substr(String string, char *ch)
 {
-    // TODO
-    return false;
+    integer_t pos;
+
+    return str_find_substr(string, ch, &pos) == DS_OK;
 }
 
+// Finds the position of a string inside a string
 // Finds the position of a string inside a string
 Status str_find_substring(String string, String key, integer_t *pos)
 {
-    // TODO
-    return DS_ERR_INVALID_OPERATION;
+    *pos = -1;
+
+    if (string == NULL || key == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    str_flatten(key);
+
+    return str_find_substr(string, key->buffer, pos);
 }
 
+// Finds the position of an array of char inside a string
 // Finds the position of an array of char inside a string
 Status str_find_substr(String string, char *key, integer_t *pos)
 {
-    // TODO
-    return DS_ERR_INVALID_OPERATION;
+    *pos = -1;
+
+    if (string == NULL || key == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    struct StringSearcher_s searcher;
+
+    str_searcher_prepare(&searcher, key, str_len(key));
+
+    str_flatten(string);
+
+    *pos = str_search(&searcher, string->buffer, string->length, 0);
+
+    return *pos < 0 ? DS_ERR_NOT_FOUND : DS_OK;
+}
+
+// Finds every position where an array of char starts inside a string,
+// including overlapping ones
+Status str_find_all(String string, char *key, integer_t **result,
+                    integer_t *count)
+{
+    *result = NULL;
+    *count = 0;
+
+    if (string == NULL || key == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    integer_t length = str_len(key);
+
+    if (length == 0)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    struct StringSearcher_s searcher;
+
+    str_searcher_prepare(&searcher, key, length);
+
+    return str_search_all(&searcher, string, result, count);
 }
 
 Status str_reverse(String string)
@@ -811,15 +775,45 @@ Status str_copy(String string, String *result)
     if (st != DS_OK)
         return st;
 
+    str_flatten(string);
+
     char *s1 = string->buffer, *s2 = (*result)->buffer;
 
     while ((*s2++ = *s1++));
 
     (*result)->length = string->length;
+    (*result)->gap = string->length;
 
     return DS_OK;
 }
 
+/// \brief Returns the canonical copy of the string's contents.
+///
+/// Interns the characters of the string in an InternTable_s. Two strings
+/// with the same contents get the same pointer, which can be compared with
+/// == and hashed with itn_hash() without going through the characters.
+///
+/// \param[in] string The string to be interned.
+/// \param[in] table The intern table.
+/// \param[out] result The canonical copy.
+///
+/// \return DS_ERR_ALLOC if the copy could not be allocated.
+/// \return DS_ERR_NULL_POINTER if string or table reference to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status str_intern(String string, InternTable_t *table, const char **result)
+{
+    *result = NULL;
+
+    if (string == NULL || table == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    str_flatten(string);
+
+    *result = itn_intern(table, string->buffer);
+
+    return *result ? DS_OK : DS_ERR_ALLOC;
+}
+
 Status str_swap(String *string1, String *string2)
 {
     String temp = (*string1);
@@ -838,6 +832,8 @@ Status str_case_upper(String string)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
+    str_flatten(string);
+
     char ch;
 
     for (integer_t i = 0; i < string->length; i++)
@@ -859,6 +855,8 @@ Status str_case_lower(String string)
     if (str_buffer_empty(string))
         return DS_ERR_INVALID_OPERATION;
 
+    str_flatten(string);
+
     char ch;
 
     for (integer_t i = 0; i < string->length; i++)
@@ -886,6 +884,120 @@ Status str_title(String string)
     return DS_ERR_INVALID_OPERATION;
 }
 
+/// \brief Compiles a key for repeated searches.
+///
+/// Analyses a key once so it can be searched in any number of strings with
+/// str_searcher_find() and str_searcher_find_all(). The key is copied.
+///
+/// \param[out] searcher The new searcher.
+/// \param[in] key Null-terminated array of characters to be searched.
+///
+/// \return DS_ERR_ALLOC if the searcher could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if the key is empty.
+/// \return DS_ERR_NULL_POINTER if key references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status str_searcher_init(StringSearcher *searcher, char *key)
+{
+    *searcher = NULL;
+
+    if (key == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    integer_t length = str_len(key);
+
+    if (length == 0)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    (*searcher) = malloc(sizeof(StringSearcher_t));
+
+    if (!(*searcher))
+        return DS_ERR_ALLOC;
+
+    char *copy = malloc(sizeof(char) * (length + 1));
+
+    if (!copy)
+    {
+        free(*searcher);
+
+        *searcher = NULL;
+
+        return DS_ERR_ALLOC;
+    }
+
+    memcpy(copy, key, (size_t)(length + 1));
+
+    str_searcher_prepare(*searcher, copy, length);
+
+    return DS_OK;
+}
+
+Status str_searcher_delete(StringSearcher *searcher)
+{
+    if ((*searcher) == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    free((*searcher)->key);
+    free(*searcher);
+
+    *searcher = NULL;
+
+    return DS_OK;
+}
+
+/// \brief Finds the first occurrence of a compiled key from a position on.
+///
+/// \param[in] searcher The compiled key.
+/// \param[in] string The string to be searched.
+/// \param[in] from Position where the search starts.
+/// \param[out] pos Position of the occurrence or -1 if none was found.
+///
+/// \return DS_ERR_NEGATIVE_VALUE if from is negative.
+/// \return DS_ERR_NOT_FOUND if there is no occurrence from that position on.
+/// \return DS_ERR_NULL_POINTER if searcher or string reference to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status str_searcher_find(StringSearcher searcher, String string,
+                         integer_t from, integer_t *pos)
+{
+    *pos = -1;
+
+    if (searcher == NULL || string == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (from < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    str_flatten(string);
+
+    *pos = str_search(searcher, string->buffer, string->length, from);
+
+    return *pos < 0 ? DS_ERR_NOT_FOUND : DS_OK;
+}
+
+/// \brief Finds every occurrence of a compiled key in a single pass.
+///
+/// Occurrences may overlap. The positions are returned in increasing order in
+/// a new array that must be freed by the user, or \c NULL if there are none.
+///
+/// \param[in] searcher The compiled key.
+/// \param[in] string The string to be searched.
+/// \param[out] result Array with the position of each occurrence.
+/// \param[out] count Amount of occurrences found.
+///
+/// \return DS_ERR_ALLOC if the array could not be allocated.
+/// \return DS_ERR_NULL_POINTER if searcher or string reference to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status str_searcher_find_all(StringSearcher searcher, String string,
+                             integer_t **result, integer_t *count)
+{
+    *result = NULL;
+    *count = 0;
+
+    if (searcher == NULL || string == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    return str_search_all(searcher, string, result, count);
+}
+
 Status str_display(String string)
 {
     if (string == NULL)
@@ -897,6 +1009,8 @@ Status str_display(String string)
         return DS_OK;
     }
 
+    str_flatten(string);
+
     printf("\nString\n%s\n", string->buffer);
 
     return DS_OK;
@@ -912,6 +1026,8 @@ Status str_display_raw(String string)
     if (str_buffer_empty(string))
         return DS_OK;
 
+    str_flatten(string);
+
     printf("%s", string->buffer);
 
     return DS_OK;
@@ -919,62 +1035,156 @@ Status str_display_raw(String string)
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
-static Status str_realloc(String string)
+static Status str_accommodate(String string, integer_t size)
 {
     if (string == NULL)
         return DS_ERR_NULL_POINTER;
 
-    integer_t old_capacity = string->capacity;
+    // There is enough capacity already (+1 for '\0')
+    if (string->capacity > string->length + size)
+        return DS_OK;
 
     // capacity = capacity * (growth_rate / 100)
-    string->capacity = (integer_t) ((double) (string->capacity) *
+    integer_t capacity = (integer_t) ((double) (string->capacity) *
             ((double) (string->growth_rate) / 100.0));
 
-    char *new_buffer = realloc(string->buffer,
-            sizeof(char) * string->capacity);
+    if (capacity <= string->length + size)
+        capacity = string->length + size + 1;
 
-    if (!new_buffer)
+    char *new_buffer;
+
+    // Leaving the buffer inside the struct for one in the heap
+    if (string->buffer == string->small)
     {
-        string->capacity = old_capacity;
+        new_buffer = malloc(sizeof(char) * capacity);
 
-        return DS_ERR_ALLOC;
+        if (new_buffer)
+            memcpy(new_buffer, string->small, (size_t)string->capacity);
+    }
+    else
+    {
+        new_buffer = realloc(string->buffer, sizeof(char) * capacity);
     }
 
+    if (!new_buffer)
+        return DS_ERR_ALLOC;
+
+    // The characters after the gap go to the end of the new buffer
+    integer_t after = string->length - string->gap;
+
+    memmove(new_buffer + capacity - 1 - after,
+            new_buffer + string->capacity - 1 - after, (size_t)after);
+
+    string->capacity = capacity;
+
     string->buffer = new_buffer;
 
-    string->buffer[string->length] = '\0';
+    if (after == 0)
+        string->buffer[string->length] = '\0';
 
     return DS_OK;
 }
 
-static Status str_accommodate(String string, integer_t size)
+// Moves the gap so that it starts at the given position
+static void str_move_gap(String string, integer_t index)
 {
-    if (string == NULL)
-        return DS_ERR_NULL_POINTER;
+    if (index == string->gap)
+        return;
 
-    // There is enough capacity already (+1 for '\0')
-    if (string->capacity > string->length + size + 1)
-        return DS_OK;
+    // Where the characters after the gap start
+    integer_t tail = string->capacity - 1 - (string->length - string->gap);
 
-    char *new_buffer = realloc(string->buffer,
-            sizeof(char) * (string->capacity + size));
+    if (index < string->gap)
+    {
+        integer_t count = string->gap - index;
 
-    if (!new_buffer)
-        return DS_ERR_ALLOC;
+        memmove(string->buffer + tail - count, string->buffer + index,
+                (size_t)count);
+    }
+    else
+    {
+        integer_t count = index - string->gap;
 
-    string->capacity += size;
+        memmove(string->buffer + string->gap, string->buffer + tail,
+                (size_t)count);
+    }
 
-    string->buffer = new_buffer;
+    string->gap = index;
 
-    string->buffer[string->length] = '\0';
+    if (string->gap == string->length)
+        string->buffer[string->length] = '\0';
+}
+
+// Moves the gap to the end, leaving a null-terminated buffer
+static void str_flatten(String string)
+{
+    str_move_gap(string, string->length);
+}
+
+static Status str_insert(String string, char *ch, integer_t length,
+                         integer_t index)
+{
+    Status st = str_accommodate(string, length);
+
+    if (st != DS_OK)
+        return st;
+
+    str_move_gap(string, index);
+
+    memcpy(string->buffer + string->gap, ch, (size_t)length);
+
+    string->gap += length;
+    string->length += length;
+
+    if (string->gap == string->length)
+        string->buffer[string->length] = '\0';
 
     return DS_OK;
 }
 
-static bool str_buffer_full(String string)
+static Status str_insert_string(String string1, String string2,
+                                integer_t index)
+{
+    if (str_buffer_empty(string2))
+        return DS_OK;
+
+    // A string added to itself is copied before the gap moves
+    if (string1 == string2)
+    {
+        char *copy;
+
+        Status st = str_get_string(string2, &copy);
+
+        if (st != DS_OK)
+            return st;
+
+        st = str_insert(string1, copy, string2->length, index);
+
+        free(copy);
+
+        return st;
+    }
+
+    // Growing first so the buffer of string2 stays where it is
+    Status st = str_accommodate(string1, string2->length);
+
+    if (st != DS_OK)
+        return st;
+
+    str_flatten(string2);
+
+    return str_insert(string1, string2->buffer, string2->length, index);
+}
+
+// Removes the characters right after the gap once it is moved to 'index'
+static void str_cut(String string, integer_t index, integer_t length)
 {
-    // +1 So we are able to write '\0' at the end
-    return (string->length + 1) >= string->capacity;
+    str_move_gap(string, index);
+
+    string->length -= length;
+
+    if (string->gap == string->length)
+        string->buffer[string->length] = '\0';
 }
 
 static bool str_buffer_empty(String string)
@@ -997,4 +1207,172 @@ static integer_t str_len(char *ch)
     return ch - h;
 }
 
+static void str_searcher_prepare(StringSearcher searcher, char *key,
+                                 integer_t length)
+{
+    searcher->key = key;
+    searcher->length = length;
+
+    if (length <= STR_SHORT_KEY)
+        return;
+
+    for (integer_t i = 0; i < 256; i++)
+        searcher->skip[i] = length;
+
+    for (integer_t i = 0; i < length - 1; i++)
+        searcher->skip[(unsigned char)key[i]] = length - 1 - i;
+}
+
+// Returns the first position from 'from' on where the key starts, or -1
+static integer_t str_search(StringSearcher searcher, const char *text,
+                            integer_t size, integer_t from)
+{
+    integer_t length = searcher->length;
+
+    if (from + length > size)
+        return length == 0 && from <= size ? from : -1;
+
+    if (length == 0)
+        return from;
+
+    if (length == 1)
+    {
+        const char *found = memchr(text + from, searcher->key[0],
+                                   (size_t)(size - from));
+
+        return found ? found - text : -1;
+    }
+
+    if (length <= STR_SHORT_KEY)
+    {
+#ifdef STR_X86
+        if (__builtin_cpu_supports("avx2"))
+            return str_filter_avx2(text, size, from, searcher->key, length);
+#endif
+
+        return str_filter(text, size, from, searcher->key, length);
+    }
+
+    return str_horspool(searcher, text, size, from);
+}
+
+static Status str_search_all(StringSearcher searcher, String string,
+                             integer_t **result, integer_t *count)
+{
+    str_flatten(string);
+
+    integer_t capacity = 0;
+    integer_t pos = str_search(searcher, string->buffer, string->length, 0);
+
+    while (pos >= 0)
+    {
+        if (*count == capacity)
+        {
+            capacity = capacity == 0 ? 8 : capacity * 2;
+
+            integer_t *new_result = realloc(*result,
+                    sizeof(integer_t) * capacity);
+
+            if (!new_result)
+            {
+                free(*result);
+
+                *result = NULL;
+                *count = 0;
+
+                return DS_ERR_ALLOC;
+            }
+
+            *result = new_result;
+        }
+
+        (*result)[(*count)++] = pos;
+
+        pos = str_search(searcher, string->buffer, string->length, pos + 1);
+    }
+
+    return DS_OK;
+}
+
+// Looks for the first character with memchr() and checks the last one before
+// comparing the rest. The key has at least two characters.
+static integer_t str_filter(const char *text, integer_t size, integer_t from,
+                            const char *key, integer_t length)
+{
+    // Last position where the key still fits
+    integer_t last = size - length;
+
+    for (integer_t i = from; i <= last; i++)
+    {
+        const char *found = memchr(text + i, key[0], (size_t)(last - i + 1));
+
+        if (!found)
+            return -1;
+
+        i = found - text;
+
+        if (text[i + length - 1] == key[length - 1]
+            && memcmp(text + i + 1, key + 1, (size_t)(length - 2)) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+#ifdef STR_X86
+
+// Compares the first and last characters of the key against 32 windows at a
+// time. Only windows where both match are compared in full.
+__attribute__((target("avx2")))
+static integer_t str_filter_avx2(const char *text, integer_t size,
+                                 integer_t from, const char *key,
+                                 integer_t length)
+{
+    __m256i first = _mm256_set1_epi8(key[0]);
+    __m256i last = _mm256_set1_epi8(key[length - 1]);
+
+    integer_t i = from;
+
+    for (; i + length - 1 + 32 <= size; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(text + i));
+        __m256i b = _mm256_loadu_si256(
+                (const __m256i *)(text + i + length - 1));
+
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(
+                _mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+
+        while (mask != 0)
+        {
+            integer_t pos = i + __builtin_ctz(mask);
+
+            if (memcmp(text + pos + 1, key + 1, (size_t)(length - 2)) == 0)
+                return pos;
+
+            mask &= mask - 1;
+        }
+    }
+
+    return str_filter(text, size, i, key, length);
+}
+
+#endif
+
+static integer_t str_horspool(StringSearcher searcher, const char *text,
+                              integer_t size, integer_t from)
+{
+    integer_t length = searcher->length;
+    char *key = searcher->key;
+
+    for (integer_t i = from; i + length <= size;
+         i += searcher->skip[(unsigned char)text[i + length - 1]])
+    {
+        if (text[i + length - 1] == key[length - 1]
+            && memcmp(text + i, key, (size_t)(length - 1)) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
\ No newline at end of file
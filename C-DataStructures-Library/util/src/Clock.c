@@ -6,17 +6,52 @@
  * @date 20/12/2018
  */
 
+// clock_gettime is not part of strict C11
+#define _POSIX_C_SOURCE 200809L
+
 #include "Clock.h"
+#include <pthread.h>
+
+// Reading the time stamp counter needs GCC or Clang on x86-64
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CLK_X86
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+// Nanoseconds per cycle of the time stamp counter, or 0.0 if it can't be used
+static double clk_cycle = 0.0;
+
+static pthread_once_t clk_calibrated = PTHREAD_ONCE_INIT;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+clk_calibrate(void);
+
+static uint64_t
+clk_ticks(ClockSource source);
+
+static uint64_t
+clk_nanoseconds(Clock_t *clk, uint64_t ticks);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 Clock_t *
 clk_new(unsigned_t storage_size)
+{
+    return clk_create(storage_size, ClockMonotonic);
+}
+
+Clock_t *
+clk_create(unsigned_t storage_size, ClockSource source)
 {
     Clock_t *clk = malloc(sizeof(Clock_t));
 
     if (!clk)
         return NULL;
 
-    clk->buffer = malloc(sizeof(double) * storage_size);
+    clk->buffer = malloc(sizeof(uint64_t) * storage_size);
 
     if (!clk->buffer)
     {
@@ -24,10 +59,24 @@ clk_new(unsigned_t storage_size)
         return NULL;
     }
 
+    clk->tick = 1.0;
+
+    if (source == ClockCycles)
+    {
+        pthread_once(&clk_calibrated, clk_calibrate);
+
+        if (clk_cycle > 0.0)
+            clk->tick = clk_cycle;
+        else
+            source = ClockMonotonic;
+    }
+
     clk->running = false;
     clk->time = 0.0;
+    clk->elapsed = 0;
     clk->size = storage_size;
     clk->count = 0;
+    clk->source = source;
     clk->timer = 0;
     clk->lap_timer = 0;
 
@@ -47,9 +96,9 @@ clk_start(Clock_t *clk)
 {
     if (clk_running(clk))
         return false;
-    
-    clk->timer = clock();
-    clk->lap_timer = clock();
+
+    clk->timer = clk_ticks(clk->source);
+    clk->lap_timer = clk->timer;
 
     clk->running = true;
 
@@ -62,9 +111,10 @@ clk_stop(Clock_t *clk)
     if (clk_stopped(clk))
         return false;
 
-    clock_t T = clock();
+    uint64_t T = clk_ticks(clk->source);
 
-    clk->time += (double)(T - clk->timer) / (double)CLOCKS_PER_SEC;
+    clk->elapsed += clk_nanoseconds(clk, T - clk->timer);
+    clk->time = (double)clk->elapsed / 1e9;
 
     clk->running = false;
 
@@ -81,9 +131,9 @@ clk_lap(Clock_t *clk)
     if (clk->count == clk->size)
         return false;
 
-    clock_t T = clock();
+    uint64_t T = clk_ticks(clk->source);
 
-    clk->buffer[clk->count] = (double)(T - clk->lap_timer) / (double)CLOCKS_PER_SEC;
+    clk->buffer[clk->count] = clk_nanoseconds(clk, T - clk->lap_timer);
 
     clk->count++;
 
@@ -99,6 +149,7 @@ clk_reset(Clock_t *clk)
         return false;
 
     clk->time = 0.0;
+    clk->elapsed = 0;
     clk->count = 0;
 
     return true;
@@ -115,3 +166,114 @@ clk_stopped(Clock_t *clk)
 {
     return !clk->running;
 }
+
+ClockSource
+clk_source(Clock_t *clk)
+{
+    return clk->source;
+}
+
+uint64_t
+clk_elapsed(Clock_t *clk)
+{
+    if (clk_stopped(clk))
+        return clk->elapsed;
+
+    uint64_t T = clk_ticks(clk->source);
+
+    return clk->elapsed + clk_nanoseconds(clk, T - clk->timer);
+}
+
+uint64_t
+clk_lap_time(Clock_t *clk, size_t index)
+{
+    if (index >= clk->count)
+        return 0;
+
+    return clk->buffer[index];
+}
+
+// Milliseconds of a monotonic clock, unaffected by changes to the system time.
+// Only differences between two calls are meaningful.
+uint64_t
+clk_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Measures how many counter cycles fit in 20 milliseconds of CLOCK_MONOTONIC.
+// Counters that change their rate with the CPU frequency are not used.
+static void
+clk_calibrate(void)
+{
+#ifdef CLK_X86
+    unsigned eax, ebx, ecx, edx;
+
+    // Invariant TSC flag
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8)))
+        return;
+
+    uint64_t start = clk_ticks(ClockMonotonic);
+    uint64_t cycles = clk_ticks(ClockCycles);
+    uint64_t now;
+
+    do
+        now = clk_ticks(ClockMonotonic);
+    while (now - start < 20000000);
+
+    cycles = clk_ticks(ClockCycles) - cycles;
+
+    if (cycles > 0)
+        clk_cycle = (double)(now - start) / (double)cycles;
+#endif
+}
+
+// Nanoseconds for every source except ClockCycles, which returns cycles
+static uint64_t
+clk_ticks(ClockSource source)
+{
+    struct timespec now;
+
+    switch (source)
+    {
+#ifdef CLK_X86
+        case ClockCycles:
+        {
+            unsigned aux;
+
+            // RDTSCP waits for the previous instructions to finish and the
+            // fence keeps the following ones from starting before it
+            uint64_t cycles = __rdtscp(&aux);
+
+            _mm_lfence();
+
+            return cycles;
+        }
+#endif
+        case ClockThread:
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+            break;
+        default:
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            break;
+    }
+
+    return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t
+clk_nanoseconds(Clock_t *clk, uint64_t ticks)
+{
+    if (clk->source != ClockCycles)
+        return ticks;
+
+    return (uint64_t)((double)ticks * clk->tick + 0.5);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,260 @@
+/**
+ * @file MappedFile.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+// mremap() is a Linux extension
+#define _GNU_SOURCE
+
+#include "MappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// A MappedFile_s is a file mapped with mmap() and shared with the page cache,
+/// so writes to its memory end up in the file and opening it again is only a
+/// matter of mapping it. The file starts with a MappedHeader_s that tells
+/// which container it belongs to; the container's buffer follows it.
+///
+/// Growing and shrinking change the size of the file with ftruncate() and of
+/// the mapping with mremap(), which might move it in memory. Where mremap()
+/// is not available the file is mapped again.
+///
+/// \par Functions
+/// Located in the file MappedFile.c
+struct MappedFile_s
+{
+    /// \brief The file descriptor of the file.
+    int fd;
+
+    /// \brief Start of the mapping, where the header is.
+    unsigned char *base;
+
+    /// \brief Size in bytes of the mapping and of the file.
+    size_t length;
+};
+
+static const char mpf_magic[8] = { 'C', 'D', 'S', 'L', 'M', 'A', 'P', '1' };
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+mpf_map(MappedFile_t *file, size_t length);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Maps the file at \c path in memory. If it doesn't exist or is empty it is
+/// created with a header for \c kind and \c min_bytes of zeroed data. If it
+/// exists, its header must be of the same \c kind and \c element_size, and
+/// its data is grown with zeroes to at least \c min_bytes.
+///
+/// \param[in] path The path of the file.
+/// \param[in] kind The container the file belongs to.
+/// \param[in] element_size Size in bytes of each element of the container.
+/// \param[in] min_bytes Minimum size in bytes of the data.
+///
+/// \return A new MappedFile_s or NULL if the file could not be opened or
+/// mapped, or if it belongs to another kind of container.
+MappedFile_t *
+mpf_open(const char *path, MappedKind kind, size_t element_size,
+         size_t min_bytes)
+{
+    MappedFile_t *file = malloc(sizeof(MappedFile_t));
+
+    if (!file)
+        return NULL;
+
+    file->fd = open(path, O_RDWR | O_CREAT, 0644);
+    file->base = NULL;
+    file->length = 0;
+
+    if (file->fd < 0)
+    {
+        free(file);
+        return NULL;
+    }
+
+    struct stat info;
+
+    if (fstat(file->fd, &info) != 0)
+        goto error;
+
+    bool created = info.st_size == 0;
+
+    if (!created && (size_t)info.st_size < MPF_HEADER_SIZE)
+        goto error;
+
+    size_t length = created ? 0 : (size_t)info.st_size;
+
+    if (length < MPF_HEADER_SIZE + min_bytes)
+    {
+        length = MPF_HEADER_SIZE + min_bytes;
+
+        // The new bytes read as zero
+        if (ftruncate(file->fd, (off_t)length) != 0)
+            goto error;
+    }
+
+    if (!mpf_map(file, length))
+        goto error;
+
+    MappedHeader_t *header = mpf_header(file);
+
+    if (created)
+    {
+        memcpy(header->magic, mpf_magic, sizeof(mpf_magic));
+        header->kind = (uint64_t)kind;
+        header->element_size = (uint64_t)element_size;
+        header->count = 0;
+    }
+    else if (memcmp(header->magic, mpf_magic, sizeof(mpf_magic)) != 0
+             || header->kind != (uint64_t)kind
+             || header->element_size != (uint64_t)element_size)
+    {
+        goto error;
+    }
+
+    return file;
+
+    error:
+    if (file->base)
+        munmap(file->base, file->length);
+    close(file->fd);
+    free(file);
+    return NULL;
+}
+
+/// Unmaps and closes the file. Modified pages are written to the file by the
+/// operating system later on; call mpf_sync() first to wait for them.
+///
+/// \param[in] file The mapped file.
+void
+mpf_close(MappedFile_t *file)
+{
+    munmap(file->base, file->length);
+    close(file->fd);
+    free(file);
+}
+
+/// \param[in] file The mapped file.
+///
+/// \return The header at the start of the file.
+MappedHeader_t *
+mpf_header(MappedFile_t *file)
+{
+    return (MappedHeader_t *)file->base;
+}
+
+/// Returns the data of the file, which is aligned to MPF_HEADER_SIZE bytes.
+/// The pointer is invalidated by mpf_resize().
+///
+/// \param[in] file The mapped file.
+///
+/// \return The data that follows the header.
+void *
+mpf_data(MappedFile_t *file)
+{
+    return file->base + MPF_HEADER_SIZE;
+}
+
+/// \param[in] file The mapped file.
+///
+/// \return The size in bytes of the data that follows the header.
+size_t
+mpf_bytes(MappedFile_t *file)
+{
+    return file->length - MPF_HEADER_SIZE;
+}
+
+/// Changes the size of the data of the file. New bytes read as zero and bytes
+/// past the new size are lost. The data might move in memory, so pointers
+/// returned by mpf_data() and mpf_header() are invalidated.
+///
+/// \param[in] file The mapped file.
+/// \param[in] bytes The new size in bytes of the data.
+///
+/// \return True if the file was resized, otherwise false and the file is left
+/// as it was.
+bool
+mpf_resize(MappedFile_t *file, size_t bytes)
+{
+    size_t length = MPF_HEADER_SIZE + bytes;
+    size_t old_length = file->length;
+
+    if (length == old_length)
+        return true;
+
+    // The file grows before the mapping so the new pages are backed by it
+    if (length > old_length && ftruncate(file->fd, (off_t)length) != 0)
+        return false;
+
+#ifdef MREMAP_MAYMOVE
+    void *base = mremap(file->base, old_length, length, MREMAP_MAYMOVE);
+
+    bool remapped = base != MAP_FAILED;
+
+    if (remapped)
+    {
+        file->base = base;
+        file->length = length;
+    }
+#else
+    // The old mapping is kept until the new one is in place
+    unsigned char *old_base = file->base;
+
+    bool remapped = mpf_map(file, length);
+
+    if (remapped)
+        munmap(old_base, old_length);
+#endif
+
+    if (!remapped)
+    {
+        if (length > old_length)
+            (void)ftruncate(file->fd, (off_t)old_length);
+
+        return false;
+    }
+
+    // The file shrinks after the mapping so no mapped page is past its end
+    if (length < old_length)
+        (void)ftruncate(file->fd, (off_t)length);
+
+    return true;
+}
+
+/// Writes every modified page of the file and waits until they are stored,
+/// so the data survives a crash of the process or of the system.
+///
+/// \param[in] file The mapped file.
+///
+/// \return True if the pages were written, otherwise false.
+bool
+mpf_sync(MappedFile_t *file)
+{
+    return msync(file->base, file->length, MS_SYNC) == 0;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Maps length bytes of the file, shared with the page cache
+static bool
+mpf_map(MappedFile_t *file, size_t length)
+{
+    void *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      file->fd, 0);
+
+    if (base == MAP_FAILED)
+        return false;
+
+    file->base = base;
+    file->length = length;
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
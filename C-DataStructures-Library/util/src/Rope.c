@@ -0,0 +1,975 @@
+/**
+ * @file Rope.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Rope.h"
+
+/// Maximum amount of characters kept in a single chunk.
+#define ROP_CHUNK 512
+
+/// \brief A chunk of characters of a Rope_s.
+///
+/// Chunks are the nodes of a treap ordered by their position in the text:
+/// a binary tree that is also a heap by a random priority, which keeps it
+/// balanced with high probability. Each node also keeps the amount of
+/// characters of its subtree, so a position is found by going down from the
+/// root.
+struct RopeNode_s
+{
+    /// \brief Chunks before this one.
+    struct RopeNode_s *left;
+
+    /// \brief Chunks after this one.
+    struct RopeNode_s *right;
+
+    /// \brief Amount of characters in this subtree.
+    integer_t weight;
+
+    /// \brief Amount of characters in this chunk.
+    integer_t length;
+
+    /// \brief Amount of characters the buffer of this chunk can hold.
+    integer_t capacity;
+
+    /// \brief Heap priority. Parents have greater priorities than children.
+    uint32_t priority;
+
+    /// \brief Characters of this chunk, not null-terminated.
+    char *data;
+};
+
+/// \brief A type for a rope node.
+///
+/// Defines a type to a <code> struct RopeNode_s </code>.
+typedef struct RopeNode_s RopeNode_t;
+
+/// \brief A pointer type for a rope node.
+///
+/// Defines a pointer type to a <code> struct RopeNode_s </code>.
+typedef struct RopeNode_s *RopeNode;
+
+/// \brief A string for very large texts.
+///
+/// A Rope_s keeps its text in chunks of up to ROP_CHUNK characters that are
+/// the nodes of a balanced tree. Inserting or removing text anywhere, finding
+/// a position, splitting a rope in two and concatenating two ropes take
+/// O(log n) expected time, no matter how large the text is, since only the
+/// chunks at the edges of an edit are touched. The text is only copied to a
+/// contiguous array when asked for with rop_get_string().
+///
+/// \par Functions
+/// Located in the file Rope.c
+struct Rope_s
+{
+    /// \brief Root of the tree of chunks.
+    RopeNode root;
+
+    /// \brief State of the generator of priorities.
+    uint32_t seed;
+};
+
+/// \brief State of a search that goes through the chunks in order.
+///
+/// Implementation detail. Used by rop_find_substr() to run a
+/// Knuth-Morris-Pratt search without flattening the rope.
+struct RopeSearch_s
+{
+    /// \brief Characters being searched.
+    char *key;
+
+    /// \brief Length of the longest proper prefix of the key that is also a
+    /// suffix of key[0..i], for each i.
+    integer_t *table;
+
+    /// \brief Length of the key.
+    integer_t length;
+
+    /// \brief Characters of the key matched so far.
+    integer_t matched;
+
+    /// \brief Position of the current character.
+    integer_t position;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static RopeNode rop_new_node(Rope rope, char *ch, integer_t length,
+                             integer_t capacity);
+
+static void rop_free_node(RopeNode node);
+
+static uint32_t rop_priority(Rope rope);
+
+static integer_t rop_weight(RopeNode node);
+
+static void rop_update(RopeNode node);
+
+static RopeNode rop_merge(RopeNode left, RopeNode right);
+
+static void rop_split_node(RopeNode node, integer_t index, RopeNode *left,
+                           RopeNode *right, RopeNode *spare);
+
+static Status rop_spare(Rope rope, RopeNode node, integer_t index,
+                        RopeNode *spare);
+
+static Status rop_insert(Rope rope, char *ch, integer_t length,
+                         integer_t index);
+
+static bool rop_extend(RopeNode node, char *ch, integer_t length, bool front);
+
+static char *rop_copy_to(RopeNode node, char *buffer);
+
+static bool rop_search(RopeNode node, struct RopeSearch_s *search);
+
+static void rop_display_node(RopeNode node);
+
+static integer_t rop_len(char *ch);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes an empty rope.
+///
+/// \param[out] rope The rope to be initialized.
+///
+/// \return DS_ERR_ALLOC if the rope could not be allocated.
+/// \return DS_OK if all operations are successful.
+Status rop_init(Rope *rope)
+{
+    (*rope) = malloc(sizeof(Rope_t));
+
+    if (!(*rope))
+        return DS_ERR_ALLOC;
+
+    (*rope)->root = NULL;
+    (*rope)->seed = (uint32_t)(((uintptr_t)(*rope) ^ (uintptr_t)time(NULL))
+                               * 2654435761u) | 1;
+
+    return DS_OK;
+}
+
+/// Initializes a rope with a copy of an array of characters.
+///
+/// \param[out] rope The rope to be initialized.
+/// \param[in] content A null-terminated array of characters.
+///
+/// \return DS_ERR_ALLOC if the rope or its chunks could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if the array of characters is empty.
+/// \return DS_OK if all operations are successful.
+Status rop_make(Rope *rope, char *content)
+{
+    integer_t length = rop_len(content);
+
+    if (length == 0)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    Status st = rop_init(rope);
+
+    if (st != DS_OK)
+        return st;
+
+    st = rop_insert(*rope, content, length, 0);
+
+    if (st != DS_OK)
+    {
+        rop_delete(rope);
+
+        return st;
+    }
+
+    return DS_OK;
+}
+
+/// Frees the rope and all of its chunks.
+///
+/// \param[in,out] rope The rope to be freed.
+///
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_delete(Rope *rope)
+{
+    if ((*rope) == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    rop_free_node((*rope)->root);
+
+    free(*rope);
+
+    *rope = NULL;
+
+    return DS_OK;
+}
+
+/// Frees every chunk of the rope, leaving it empty.
+///
+/// \param[in] rope The rope to be cleared.
+///
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_clear(Rope rope)
+{
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    rop_free_node(rope->root);
+
+    rope->root = NULL;
+
+    return DS_OK;
+}
+
+/// Copies every chunk, in order, to a new null-terminated array of
+/// characters. The rope itself is not changed.
+///
+/// \param[in] rope The rope to be flattened.
+/// \param[out] result The new array of characters, to be freed by the user.
+///
+/// \return DS_ERR_ALLOC if the array could not be allocated.
+/// \return DS_ERR_INVALID_OPERATION if the rope is empty.
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_get_string(Rope rope, char **result)
+{
+    *result = NULL;
+
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (rop_empty(rope))
+        return DS_ERR_INVALID_OPERATION;
+
+    char *char_array = malloc(sizeof(char) * (rop_length(rope) + 1));
+
+    if (!char_array)
+        return DS_ERR_ALLOC;
+
+    *rop_copy_to(rope->root, char_array) = '\0';
+
+    *result = char_array;
+
+    return DS_OK;
+}
+
+/// \param[in] rope The rope.
+///
+/// \return The amount of characters in the rope or -1 if it references to
+/// \c NULL.
+integer_t rop_length(Rope rope)
+{
+    if (rope == NULL)
+        return -1;
+
+    return rop_weight(rope->root);
+}
+
+/// Finds the character at a given position in O(log n) expected time.
+///
+/// \param[in] rope The rope.
+/// \param[in] index Position of the character.
+/// \param[out] result The character found.
+///
+/// \return DS_ERR_NEGATIVE_VALUE if index is negative.
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if index is not a position of the rope.
+/// \return DS_OK if all operations are successful.
+Status rop_char_at(Rope rope, integer_t index, char *result)
+{
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (index < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (index >= rop_length(rope))
+        return DS_ERR_OUT_OF_RANGE;
+
+    RopeNode node = rope->root;
+
+    while (true)
+    {
+        integer_t before = rop_weight(node->left);
+
+        if (index < before)
+        {
+            node = node->left;
+        }
+        else if (index < before + node->length)
+        {
+            *result = node->data[index - before];
+
+            return DS_OK;
+        }
+        else
+        {
+            index -= before + node->length;
+            node = node->right;
+        }
+    }
+}
+
+/// Inserts a copy of an array of characters at the start of the rope.
+///
+/// \param[in] rope The rope.
+/// \param[in] ch A null-terminated array of characters.
+///
+/// \return DS_ERR_ALLOC if a chunk could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if the array of characters is empty.
+/// \return DS_ERR_NULL_POINTER if the rope or the array reference to
+/// \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_push_front(Rope rope, char *ch)
+{
+    return rop_push_at(rope, ch, 0);
+}
+
+/// Inserts a copy of an array of characters at a given position in
+/// O(m + log n) expected time, where m is the length of the array.
+///
+/// \param[in] rope The rope.
+/// \param[in] ch A null-terminated array of characters.
+/// \param[in] index Position where the first character is inserted.
+///
+/// \return DS_ERR_ALLOC if a chunk could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if the array of characters is empty.
+/// \return DS_ERR_NEGATIVE_VALUE if index is negative.
+/// \return DS_ERR_NULL_POINTER if the rope or the array reference to
+/// \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if index is greater than the length.
+/// \return DS_OK if all operations are successful.
+Status rop_push_at(Rope rope, char *ch, integer_t index)
+{
+    if (rope == NULL || ch == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (index < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (index > rop_length(rope))
+        return DS_ERR_OUT_OF_RANGE;
+
+    integer_t length = rop_len(ch);
+
+    if (length == 0)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    return rop_insert(rope, ch, length, index);
+}
+
+/// Inserts a copy of an array of characters at the end of the rope.
+///
+/// \param[in] rope The rope.
+/// \param[in] ch A null-terminated array of characters.
+///
+/// \return DS_ERR_ALLOC if a chunk could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if the array of characters is empty.
+/// \return DS_ERR_NULL_POINTER if the rope or the array reference to
+/// \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_push_back(Rope rope, char *ch)
+{
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    return rop_push_at(rope, ch, rop_length(rope));
+}
+
+/// Moves every chunk of rope2 to the start of rope1 in O(log n) expected
+/// time, leaving rope2 empty. No characters are copied.
+///
+/// \param[in] rope1 The rope that receives the characters.
+/// \param[in] rope2 The rope whose characters are moved.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if both are the same rope.
+/// \return DS_ERR_NULL_POINTER if either rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_prepend(Rope rope1, Rope rope2)
+{
+    if (rope1 == NULL || rope2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (rope1 == rope2)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    rope1->root = rop_merge(rope2->root, rope1->root);
+    rope2->root = NULL;
+
+    return DS_OK;
+}
+
+/// Moves every chunk of rope2 to the end of rope1 in O(log n) expected time,
+/// leaving rope2 empty. No characters are copied.
+///
+/// \param[in] rope1 The rope that receives the characters.
+/// \param[in] rope2 The rope whose characters are moved.
+///
+/// \return DS_ERR_INVALID_ARGUMENT if both are the same rope.
+/// \return DS_ERR_NULL_POINTER if either rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_append(Rope rope1, Rope rope2)
+{
+    if (rope1 == NULL || rope2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (rope1 == rope2)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    rope1->root = rop_merge(rope1->root, rope2->root);
+    rope2->root = NULL;
+
+    return DS_OK;
+}
+
+/// Moves every character from a given position on to a new rope in
+/// O(log n) expected time. At most one chunk is copied, the one the position
+/// falls inside of.
+///
+/// \param[in] rope The rope to be split.
+/// \param[out] result A new rope with the characters from index on.
+/// \param[in] index Position of the first character that is moved.
+///
+/// \return DS_ERR_ALLOC if the new rope or a chunk could not be allocated.
+/// \return DS_ERR_NEGATIVE_VALUE if index is negative.
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if index is greater than the length.
+/// \return DS_OK if all operations are successful.
+Status rop_split(Rope rope, Rope *result, integer_t index)
+{
+    *result = NULL;
+
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (index < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (index > rop_length(rope))
+        return DS_ERR_OUT_OF_RANGE;
+
+    RopeNode spare;
+
+    Status st = rop_spare(rope, rope->root, index, &spare);
+
+    if (st != DS_OK)
+        return st;
+
+    st = rop_init(result);
+
+    if (st != DS_OK)
+    {
+        rop_free_node(spare);
+
+        return st;
+    }
+
+    rop_split_node(rope->root, index, &rope->root, &(*result)->root, &spare);
+
+    return DS_OK;
+}
+
+/// Removes the characters from one position to another, both inclusive, in
+/// O(log n) expected time plus the time to free the removed chunks.
+///
+/// \param[in] rope The rope.
+/// \param[in] from Position of the first character removed.
+/// \param[in] to Position of the last character removed.
+///
+/// \return DS_ERR_ALLOC if a chunk could not be allocated.
+/// \return DS_ERR_INVALID_ARGUMENT if from is greater than to.
+/// \return DS_ERR_NEGATIVE_VALUE if from or to are negative.
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if to is not a position of the rope.
+/// \return DS_OK if all operations are successful.
+Status rop_remove(Rope rope, integer_t from, integer_t to)
+{
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (from < 0 || to < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (to >= rop_length(rope))
+        return DS_ERR_OUT_OF_RANGE;
+
+    // Both chunks are allocated before anything changes
+    RopeNode spare_to, spare_from;
+
+    Status st = rop_spare(rope, rope->root, to + 1, &spare_to);
+
+    if (st != DS_OK)
+        return st;
+
+    st = rop_spare(rope, rope->root, from, &spare_from);
+
+    if (st != DS_OK)
+    {
+        rop_free_node(spare_to);
+
+        return st;
+    }
+
+    RopeNode left, middle, right;
+
+    rop_split_node(rope->root, to + 1, &middle, &right, &spare_to);
+    rop_split_node(middle, from, &left, &middle, &spare_from);
+
+    rop_free_node(middle);
+
+    rope->root = rop_merge(left, right);
+
+    return DS_OK;
+}
+
+/// \param[in] rope The rope.
+///
+/// \return True if the rope has no characters, otherwise false.
+bool rop_empty(Rope rope)
+{
+    return rope->root == NULL;
+}
+
+/// \param[in] rope The rope.
+/// \param[in] key A null-terminated array of characters.
+///
+/// \return True if the key is found in the rope, otherwise false.
+bool rop_substr(Rope rope, char *key)
+{
+    integer_t pos;
+
+    return rop_find_substr(rope, key, &pos) == DS_OK;
+}
+
+/// Finds the first occurrence of an array of characters in the rope. The
+/// chunks are searched in order with the Knuth-Morris-Pratt algorithm, in
+/// O(n + m) time and without flattening the rope, so occurrences that span
+/// several chunks are also found.
+///
+/// \param[in] rope The rope.
+/// \param[in] key A null-terminated array of characters.
+/// \param[out] pos Position of the first character of the occurrence, or -1
+/// if it was not found.
+///
+/// \return DS_ERR_ALLOC if the search table could not be allocated.
+/// \return DS_ERR_NOT_FOUND if the key is not in the rope.
+/// \return DS_ERR_NULL_POINTER if the rope or the key reference to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_find_substr(Rope rope, char *key, integer_t *pos)
+{
+    *pos = -1;
+
+    if (rope == NULL || key == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    integer_t length = rop_len(key);
+
+    if (length == 0)
+    {
+        *pos = 0;
+
+        return DS_OK;
+    }
+
+    integer_t *table = malloc(sizeof(integer_t) * length);
+
+    if (!table)
+        return DS_ERR_ALLOC;
+
+    table[0] = 0;
+
+    for (integer_t i = 1, k = 0; i < length; i++)
+    {
+        while (k > 0 && key[i] != key[k])
+            k = table[k - 1];
+
+        if (key[i] == key[k])
+            k++;
+
+        table[i] = k;
+    }
+
+    struct RopeSearch_s search = { key, table, length, 0, 0 };
+
+    bool found = rop_search(rope->root, &search);
+
+    free(table);
+
+    if (!found)
+        return DS_ERR_NOT_FOUND;
+
+    *pos = search.position - length + 1;
+
+    return DS_OK;
+}
+
+/// Displays the rope in the console.
+///
+/// \param[in] rope The rope to be displayed.
+///
+/// \return DS_ERR_NULL_POINTER if the rope references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status rop_display(Rope rope)
+{
+    if (rope == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (rop_empty(rope))
+    {
+        printf("\nRope\n[ empty ]\n");
+        return DS_OK;
+    }
+
+    printf("\nRope\n");
+
+    rop_display_node(rope->root);
+
+    printf("\n");
+
+    return DS_OK;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static RopeNode rop_new_node(Rope rope, char *ch, integer_t length,
+                             integer_t capacity)
+{
+    RopeNode node = malloc(sizeof(RopeNode_t));
+
+    if (!node)
+        return NULL;
+
+    node->data = malloc(sizeof(char) * capacity);
+
+    if (!node->data)
+    {
+        free(node);
+
+        return NULL;
+    }
+
+    if (length > 0)
+        memcpy(node->data, ch, (size_t)length);
+
+    node->left = NULL;
+    node->right = NULL;
+    node->weight = length;
+    node->length = length;
+    node->capacity = capacity;
+    node->priority = rop_priority(rope);
+
+    return node;
+}
+
+static void rop_free_node(RopeNode node)
+{
+    if (node == NULL)
+        return;
+
+    rop_free_node(node->left);
+    rop_free_node(node->right);
+
+    free(node->data);
+    free(node);
+}
+
+// xorshift32
+static uint32_t rop_priority(Rope rope)
+{
+    rope->seed ^= rope->seed << 13;
+    rope->seed ^= rope->seed >> 17;
+    rope->seed ^= rope->seed << 5;
+
+    return rope->seed;
+}
+
+static integer_t rop_weight(RopeNode node)
+{
+    return node ? node->weight : 0;
+}
+
+static void rop_update(RopeNode node)
+{
+    node->weight = rop_weight(node->left) + node->length
+                   + rop_weight(node->right);
+}
+
+// Concatenates two trees, every chunk of left coming before the ones of right
+static RopeNode rop_merge(RopeNode left, RopeNode right)
+{
+    if (left == NULL)
+        return right;
+
+    if (right == NULL)
+        return left;
+
+    if (left->priority > right->priority)
+    {
+        left->right = rop_merge(left->right, right);
+
+        rop_update(left);
+
+        return left;
+    }
+
+    right->left = rop_merge(left, right->left);
+
+    rop_update(right);
+
+    return right;
+}
+
+// Splits a tree in the characters before index and the ones from index on.
+// When index falls inside a chunk, its end is moved to the spare chunk, which
+// must have been allocated with rop_spare().
+static void rop_split_node(RopeNode node, integer_t index, RopeNode *left,
+                           RopeNode *right, RopeNode *spare)
+{
+    if (node == NULL)
+    {
+        *left = NULL;
+        *right = NULL;
+
+        return;
+    }
+
+    integer_t before = rop_weight(node->left);
+
+    if (index <= before)
+    {
+        rop_split_node(node->left, index, left, &node->left, spare);
+
+        rop_update(node);
+
+        *right = node;
+    }
+    else if (index >= before + node->length)
+    {
+        rop_split_node(node->right, index - before - node->length,
+                       &node->right, right, spare);
+
+        rop_update(node);
+
+        *left = node;
+    }
+    else
+    {
+        integer_t offset = index - before;
+
+        RopeNode tail = *spare;
+
+        *spare = NULL;
+
+        tail->length = node->length - offset;
+        tail->weight = tail->length;
+
+        memcpy(tail->data, node->data + offset, (size_t)tail->length);
+
+        RopeNode before_node = node->left, after_node = node->right;
+
+        node->left = NULL;
+        node->right = NULL;
+        node->length = offset;
+
+        rop_update(node);
+
+        *left = rop_merge(before_node, node);
+        *right = rop_merge(tail, after_node);
+    }
+}
+
+// Allocates the chunk needed to split a tree at index, or sets it to NULL if
+// index is at the edge of a chunk
+static Status rop_spare(Rope rope, RopeNode node, integer_t index,
+                        RopeNode *spare)
+{
+    *spare = NULL;
+
+    while (node != NULL)
+    {
+        integer_t before = rop_weight(node->left);
+
+        if (index <= before)
+        {
+            node = node->left;
+        }
+        else if (index >= before + node->length)
+        {
+            index -= before + node->length;
+            node = node->right;
+        }
+        else
+        {
+            *spare = rop_new_node(rope, NULL, 0, node->length);
+
+            return *spare ? DS_OK : DS_ERR_ALLOC;
+        }
+    }
+
+    return DS_OK;
+}
+
+static Status rop_insert(Rope rope, char *ch, integer_t length,
+                         integer_t index)
+{
+    RopeNode spare;
+
+    Status st = rop_spare(rope, rope->root, index, &spare);
+
+    if (st != DS_OK)
+        return st;
+
+    RopeNode left, right;
+
+    rop_split_node(rope->root, index, &left, &right, &spare);
+
+    // Small insertions go to one of the chunks around them
+    if (!rop_extend(left, ch, length, false) &&
+        !rop_extend(right, ch, length, true))
+    {
+        RopeNode middle = NULL;
+
+        for (integer_t i = 0; i < length; i += ROP_CHUNK)
+        {
+            integer_t size = length - i < ROP_CHUNK ? length - i : ROP_CHUNK;
+
+            RopeNode node = rop_new_node(rope, ch + i, size, size);
+
+            if (!node)
+            {
+                rop_free_node(middle);
+
+                rope->root = rop_merge(left, right);
+
+                return DS_ERR_ALLOC;
+            }
+
+            middle = rop_merge(middle, node);
+        }
+
+        left = rop_merge(left, middle);
+    }
+
+    rope->root = rop_merge(left, right);
+
+    return DS_OK;
+}
+
+// Adds characters to the first or the last chunk of a tree if they fit in it
+static bool rop_extend(RopeNode node, char *ch, integer_t length, bool front)
+{
+    if (node == NULL)
+        return false;
+
+    RopeNode last = node;
+
+    while ((front ? last->left : last->right) != NULL)
+        last = front ? last->left : last->right;
+
+    if (last->length + length > ROP_CHUNK)
+        return false;
+
+    if (last->length + length > last->capacity)
+    {
+        integer_t capacity = last->capacity * 2;
+
+        if (capacity < last->length + length)
+            capacity = last->length + length;
+
+        if (capacity > ROP_CHUNK)
+            capacity = ROP_CHUNK;
+
+        char *data = realloc(last->data, sizeof(char) * capacity);
+
+        if (!data)
+            return false;
+
+        last->data = data;
+        last->capacity = capacity;
+    }
+
+    if (front)
+    {
+        memmove(last->data + length, last->data, (size_t)last->length);
+        memcpy(last->data, ch, (size_t)length);
+    }
+    else
+    {
+        memcpy(last->data + last->length, ch, (size_t)length);
+    }
+
+    last->length += length;
+
+    // Every chunk on the way gained the new characters
+    for (; node != NULL; node = front ? node->left : node->right)
+        node->weight += length;
+
+    return true;
+}
+
+static char *rop_copy_to(RopeNode node, char *buffer)
+{
+    if (node == NULL)
+        return buffer;
+
+    buffer = rop_copy_to(node->left, buffer);
+
+    memcpy(buffer, node->data, (size_t)node->length);
+
+    return rop_copy_to(node->right, buffer + node->length);
+}
+
+// Feeds every character to the search, in order, until the key is matched
+static bool rop_search(RopeNode node, struct RopeSearch_s *search)
+{
+    if (node == NULL)
+        return false;
+
+    if (rop_search(node->left, search))
+        return true;
+
+    for (integer_t i = 0; i < node->length; i++)
+    {
+        char ch = node->data[i];
+
+        while (search->matched > 0 && search->key[search->matched] != ch)
+            search->matched = search->table[search->matched - 1];
+
+        if (search->key[search->matched] == ch)
+            search->matched++;
+
+        if (search->matched == search->length)
+            return true;
+
+        search->position++;
+    }
+
+    return rop_search(node->right, search);
+}
+
+static void rop_display_node(RopeNode node)
+{
+    if (node == NULL)
+        return;
+
+    rop_display_node(node->left);
+
+    printf("%.*s", (int)node->length, node->data);
+
+    rop_display_node(node->right);
+}
+
+static integer_t rop_len(char *ch)
+{
+    char *h = ch;
+
+    while (*ch)
+        ++ch;
+
+    return ch - h;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,708 @@
+/**
+ * @file SearchKernels.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "SearchKernels.h"
+
+// On x86-64 the vector kernels need GCC or Clang to compile functions for
+// instruction sets that are not enabled for the whole library and to query
+// the CPU at runtime. NEON is always available on AArch64.
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SKN_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define SKN_NEON
+#include <arm_neon.h>
+#endif
+
+// The fastest kernel allowed by skn_use(). The kernel that is actually used
+// is the fastest one that is both allowed and supported by the CPU.
+static SearchKernel skn_limit = SearchKernel256;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static SearchKernel
+skn_supported(void);
+
+static integer_t
+skn_find_int32_t_scalar(const int32_t *buffer, integer_t from,
+                        integer_t size, int32_t key);
+
+static integer_t
+skn_find_int64_t_scalar(const int64_t *buffer, integer_t from,
+                        integer_t size, int64_t key);
+
+static int32_t
+skn_min_int32_t_scalar(const int32_t *buffer, integer_t from,
+                       integer_t size, int32_t min);
+
+static int32_t
+skn_max_int32_t_scalar(const int32_t *buffer, integer_t from,
+                       integer_t size, int32_t max);
+
+static int64_t
+skn_min_int64_t_scalar(const int64_t *buffer, integer_t from,
+                       integer_t size, int64_t min);
+
+static int64_t
+skn_max_int64_t_scalar(const int64_t *buffer, integer_t from,
+                       integer_t size, int64_t max);
+
+#if defined(SKN_X86)
+
+static integer_t
+skn_find_int32_t_sse41(const int32_t *buffer, integer_t size, int32_t key);
+
+static integer_t
+skn_find_int32_t_avx2(const int32_t *buffer, integer_t size, int32_t key);
+
+static integer_t
+skn_find_int64_t_sse41(const int64_t *buffer, integer_t size, int64_t key);
+
+static integer_t
+skn_find_int64_t_avx2(const int64_t *buffer, integer_t size, int64_t key);
+
+static int32_t
+skn_min_int32_t_sse41(const int32_t *buffer, integer_t size);
+
+static int32_t
+skn_max_int32_t_sse41(const int32_t *buffer, integer_t size);
+
+static int32_t
+skn_min_int32_t_avx2(const int32_t *buffer, integer_t size);
+
+static int32_t
+skn_max_int32_t_avx2(const int32_t *buffer, integer_t size);
+
+static int64_t
+skn_min_int64_t_avx2(const int64_t *buffer, integer_t size);
+
+static int64_t
+skn_max_int64_t_avx2(const int64_t *buffer, integer_t size);
+
+#elif defined(SKN_NEON)
+
+static integer_t
+skn_find_int32_t_neon(const int32_t *buffer, integer_t size, int32_t key);
+
+static integer_t
+skn_find_int64_t_neon(const int64_t *buffer, integer_t size, int64_t key);
+
+static int32_t
+skn_min_int32_t_neon(const int32_t *buffer, integer_t size);
+
+static int32_t
+skn_max_int32_t_neon(const int32_t *buffer, integer_t size);
+
+#endif
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Returns the fastest kernel that is allowed by skn_use() and supported by
+/// the CPU. This is the kernel used by every other function in this module.
+///
+/// \return The kernel currently in use.
+SearchKernel
+skn_kernel(void)
+{
+    SearchKernel supported = skn_supported();
+
+    return supported < skn_limit ? supported : skn_limit;
+}
+
+/// Limits the kernels to the given instruction set. Mostly useful to test and
+/// benchmark slower kernels on a machine that supports faster ones. This is
+/// not thread-safe and should be called before any other thread uses the
+/// kernels.
+///
+/// \param[in] kernel The fastest kernel that may be used.
+///
+/// \return True if the CPU supports the kernel, false otherwise, in which
+/// case nothing changes.
+bool
+skn_use(SearchKernel kernel)
+{
+    if (kernel > skn_supported())
+        return false;
+
+    skn_limit = kernel;
+
+    return true;
+}
+
+/// Finds the first element of a buffer of 32-bit integers that is equal to
+/// \c key. Equality doesn't depend on the sign so this also works for buffers
+/// of \c uint32_t.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+/// \param[in] key The value to be searched.
+///
+/// \return The index of the first matching integer or -1 if there is none.
+integer_t
+skn_find_int32_t(const int32_t *buffer, integer_t size, int32_t key)
+{
+#if defined(SKN_X86)
+    switch (skn_kernel())
+    {
+        case SearchKernel256:
+            return skn_find_int32_t_avx2(buffer, size, key);
+        case SearchKernel128:
+            return skn_find_int32_t_sse41(buffer, size, key);
+        default:
+            break;
+    }
+#elif defined(SKN_NEON)
+    if (skn_kernel() == SearchKernel128)
+        return skn_find_int32_t_neon(buffer, size, key);
+#endif
+
+    return skn_find_int32_t_scalar(buffer, 0, size, key);
+}
+
+/// Finds the first element of a buffer of 64-bit integers that is equal to
+/// \c key. Equality doesn't depend on the sign so this also works for buffers
+/// of \c uint64_t.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+/// \param[in] key The value to be searched.
+///
+/// \return The index of the first matching integer or -1 if there is none.
+integer_t
+skn_find_int64_t(const int64_t *buffer, integer_t size, int64_t key)
+{
+#if defined(SKN_X86)
+    switch (skn_kernel())
+    {
+        case SearchKernel256:
+            return skn_find_int64_t_avx2(buffer, size, key);
+        case SearchKernel128:
+            return skn_find_int64_t_sse41(buffer, size, key);
+        default:
+            break;
+    }
+#elif defined(SKN_NEON)
+    if (skn_kernel() == SearchKernel128)
+        return skn_find_int64_t_neon(buffer, size, key);
+#endif
+
+    return skn_find_int64_t_scalar(buffer, 0, size, key);
+}
+
+/// Finds the smallest element of a buffer of signed 32-bit integers. The
+/// smallest value is computed with vector minimums and then searched with
+/// skn_find_int32_t() to get its first position.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+///
+/// \return The index of the first smallest integer or -1 if the buffer is
+/// empty.
+integer_t
+skn_min_int32_t(const int32_t *buffer, integer_t size)
+{
+    if (size <= 0)
+        return -1;
+
+    int32_t min;
+
+    switch (skn_kernel())
+    {
+#if defined(SKN_X86)
+        case SearchKernel256:
+            min = skn_min_int32_t_avx2(buffer, size);
+            break;
+        case SearchKernel128:
+            min = skn_min_int32_t_sse41(buffer, size);
+            break;
+#elif defined(SKN_NEON)
+        case SearchKernel128:
+            min = skn_min_int32_t_neon(buffer, size);
+            break;
+#endif
+        default:
+            min = skn_min_int32_t_scalar(buffer, 1, size, buffer[0]);
+            break;
+    }
+
+    return skn_find_int32_t(buffer, size, min);
+}
+
+/// Finds the greatest element of a buffer of signed 32-bit integers. The
+/// greatest value is computed with vector maximums and then searched with
+/// skn_find_int32_t() to get its first position.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+///
+/// \return The index of the first greatest integer or -1 if the buffer is
+/// empty.
+integer_t
+skn_max_int32_t(const int32_t *buffer, integer_t size)
+{
+    if (size <= 0)
+        return -1;
+
+    int32_t max;
+
+    switch (skn_kernel())
+    {
+#if defined(SKN_X86)
+        case SearchKernel256:
+            max = skn_max_int32_t_avx2(buffer, size);
+            break;
+        case SearchKernel128:
+            max = skn_max_int32_t_sse41(buffer, size);
+            break;
+#elif defined(SKN_NEON)
+        case SearchKernel128:
+            max = skn_max_int32_t_neon(buffer, size);
+            break;
+#endif
+        default:
+            max = skn_max_int32_t_scalar(buffer, 1, size, buffer[0]);
+            break;
+    }
+
+    return skn_find_int32_t(buffer, size, max);
+}
+
+/// Finds the smallest element of a buffer of signed 64-bit integers. Only
+/// AVX2 has the 64-bit comparison needed to compute the smallest value with
+/// vectors; the search for its first position is vectorised everywhere.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+///
+/// \return The index of the first smallest integer or -1 if the buffer is
+/// empty.
+integer_t
+skn_min_int64_t(const int64_t *buffer, integer_t size)
+{
+    if (size <= 0)
+        return -1;
+
+    int64_t min;
+
+#if defined(SKN_X86)
+    if (skn_kernel() == SearchKernel256)
+        min = skn_min_int64_t_avx2(buffer, size);
+    else
+#endif
+        min = skn_min_int64_t_scalar(buffer, 1, size, buffer[0]);
+
+    return skn_find_int64_t(buffer, size, min);
+}
+
+/// Finds the greatest element of a buffer of signed 64-bit integers. Only
+/// AVX2 has the 64-bit comparison needed to compute the greatest value with
+/// vectors; the search for its first position is vectorised everywhere.
+///
+/// \param[in] buffer The buffer of integers.
+/// \param[in] size The amount of integers.
+///
+/// \return The index of the first greatest integer or -1 if the buffer is
+/// empty.
+integer_t
+skn_max_int64_t(const int64_t *buffer, integer_t size)
+{
+    if (size <= 0)
+        return -1;
+
+    int64_t max;
+
+#if defined(SKN_X86)
+    if (skn_kernel() == SearchKernel256)
+        max = skn_max_int64_t_avx2(buffer, size);
+    else
+#endif
+        max = skn_max_int64_t_scalar(buffer, 1, size, buffer[0]);
+
+    return skn_find_int64_t(buffer, size, max);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static SearchKernel
+skn_supported(void)
+{
+#if defined(SKN_X86)
+    if (__builtin_cpu_supports("avx2"))
+        return SearchKernel256;
+
+    if (__builtin_cpu_supports("sse4.1"))
+        return SearchKernel128;
+#elif defined(SKN_NEON)
+    return SearchKernel128;
+#endif
+
+    return SearchKernelScalar;
+}
+
+// The scalar kernels also finish the elements left over by the vector
+// kernels, starting at from
+
+static integer_t
+skn_find_int32_t_scalar(const int32_t *buffer, integer_t from,
+                        integer_t size, int32_t key)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] == key)
+            return i;
+    }
+
+    return -1;
+}
+
+static integer_t
+skn_find_int64_t_scalar(const int64_t *buffer, integer_t from,
+                        integer_t size, int64_t key)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] == key)
+            return i;
+    }
+
+    return -1;
+}
+
+static int32_t
+skn_min_int32_t_scalar(const int32_t *buffer, integer_t from,
+                       integer_t size, int32_t min)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] < min)
+            min = buffer[i];
+    }
+
+    return min;
+}
+
+static int32_t
+skn_max_int32_t_scalar(const int32_t *buffer, integer_t from,
+                       integer_t size, int32_t max)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] > max)
+            max = buffer[i];
+    }
+
+    return max;
+}
+
+static int64_t
+skn_min_int64_t_scalar(const int64_t *buffer, integer_t from,
+                       integer_t size, int64_t min)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] < min)
+            min = buffer[i];
+    }
+
+    return min;
+}
+
+static int64_t
+skn_max_int64_t_scalar(const int64_t *buffer, integer_t from,
+                       integer_t size, int64_t max)
+{
+    for (integer_t i = from; i < size; i++)
+    {
+        if (buffer[i] > max)
+            max = buffer[i];
+    }
+
+    return max;
+}
+
+#if defined(SKN_X86)
+
+// The find kernels stop at the first vector with a match and let the scalar
+// kernel pick the exact position inside it
+
+__attribute__((target("sse4.1")))
+static integer_t
+skn_find_int32_t_sse41(const int32_t *buffer, integer_t size, int32_t key)
+{
+    const __m128i k = _mm_set1_epi32(key);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(buffer + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(v, k)))
+            break;
+    }
+
+    return skn_find_int32_t_scalar(buffer, i, size, key);
+}
+
+__attribute__((target("avx2")))
+static integer_t
+skn_find_int32_t_avx2(const int32_t *buffer, integer_t size, int32_t key)
+{
+    const __m256i k = _mm256_set1_epi32(key);
+
+    integer_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(buffer + i));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(v, k)))
+            break;
+    }
+
+    return skn_find_int32_t_scalar(buffer, i, size, key);
+}
+
+__attribute__((target("sse4.1")))
+static integer_t
+skn_find_int64_t_sse41(const int64_t *buffer, integer_t size, int64_t key)
+{
+    const __m128i k = _mm_set1_epi64x((long long)key);
+
+    integer_t i = 0;
+
+    for (; i + 2 <= size; i += 2)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(buffer + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi64(v, k)))
+            break;
+    }
+
+    return skn_find_int64_t_scalar(buffer, i, size, key);
+}
+
+__attribute__((target("avx2")))
+static integer_t
+skn_find_int64_t_avx2(const int64_t *buffer, integer_t size, int64_t key)
+{
+    const __m256i k = _mm256_set1_epi64x((long long)key);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(buffer + i));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(v, k)))
+            break;
+    }
+
+    return skn_find_int64_t_scalar(buffer, i, size, key);
+}
+
+// The extremum kernels keep one candidate per lane, reduce the lanes and
+// then finish the elements left over. The buffer is never empty.
+
+__attribute__((target("sse4.1")))
+static int32_t
+skn_min_int32_t_sse41(const int32_t *buffer, integer_t size)
+{
+    __m128i m = _mm_set1_epi32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+        m = _mm_min_epi32(m, _mm_loadu_si128((const __m128i*)(buffer + i)));
+
+    int32_t lanes[4];
+
+    _mm_storeu_si128((__m128i*)lanes, m);
+
+    return skn_min_int32_t_scalar(buffer, i, size,
+                                  skn_min_int32_t_scalar(lanes, 1, 4,
+                                                         lanes[0]));
+}
+
+__attribute__((target("sse4.1")))
+static int32_t
+skn_max_int32_t_sse41(const int32_t *buffer, integer_t size)
+{
+    __m128i m = _mm_set1_epi32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+        m = _mm_max_epi32(m, _mm_loadu_si128((const __m128i*)(buffer + i)));
+
+    int32_t lanes[4];
+
+    _mm_storeu_si128((__m128i*)lanes, m);
+
+    return skn_max_int32_t_scalar(buffer, i, size,
+                                  skn_max_int32_t_scalar(lanes, 1, 4,
+                                                         lanes[0]));
+}
+
+__attribute__((target("avx2")))
+static int32_t
+skn_min_int32_t_avx2(const int32_t *buffer, integer_t size)
+{
+    __m256i m = _mm256_set1_epi32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+        m = _mm256_min_epi32(m, _mm256_loadu_si256((const __m256i*)
+                                                   (buffer + i)));
+
+    int32_t lanes[8];
+
+    _mm256_storeu_si256((__m256i*)lanes, m);
+
+    return skn_min_int32_t_scalar(buffer, i, size,
+                                  skn_min_int32_t_scalar(lanes, 1, 8,
+                                                         lanes[0]));
+}
+
+__attribute__((target("avx2")))
+static int32_t
+skn_max_int32_t_avx2(const int32_t *buffer, integer_t size)
+{
+    __m256i m = _mm256_set1_epi32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+        m = _mm256_max_epi32(m, _mm256_loadu_si256((const __m256i*)
+                                                   (buffer + i)));
+
+    int32_t lanes[8];
+
+    _mm256_storeu_si256((__m256i*)lanes, m);
+
+    return skn_max_int32_t_scalar(buffer, i, size,
+                                  skn_max_int32_t_scalar(lanes, 1, 8,
+                                                         lanes[0]));
+}
+
+// There is no 64-bit minimum or maximum before AVX-512 so the lanes are
+// compared and blended
+__attribute__((target("avx2")))
+static int64_t
+skn_min_int64_t_avx2(const int64_t *buffer, integer_t size)
+{
+    __m256i m = _mm256_set1_epi64x((long long)buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(buffer + i));
+
+        m = _mm256_blendv_epi8(m, v, _mm256_cmpgt_epi64(m, v));
+    }
+
+    int64_t lanes[4];
+
+    _mm256_storeu_si256((__m256i*)lanes, m);
+
+    return skn_min_int64_t_scalar(buffer, i, size,
+                                  skn_min_int64_t_scalar(lanes, 1, 4,
+                                                         lanes[0]));
+}
+
+__attribute__((target("avx2")))
+static int64_t
+skn_max_int64_t_avx2(const int64_t *buffer, integer_t size)
+{
+    __m256i m = _mm256_set1_epi64x((long long)buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(buffer + i));
+
+        m = _mm256_blendv_epi8(m, v, _mm256_cmpgt_epi64(v, m));
+    }
+
+    int64_t lanes[4];
+
+    _mm256_storeu_si256((__m256i*)lanes, m);
+
+    return skn_max_int64_t_scalar(buffer, i, size,
+                                  skn_max_int64_t_scalar(lanes, 1, 4,
+                                                         lanes[0]));
+}
+
+#elif defined(SKN_NEON)
+
+static integer_t
+skn_find_int32_t_neon(const int32_t *buffer, integer_t size, int32_t key)
+{
+    const int32x4_t k = vdupq_n_s32(key);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        if (vmaxvq_u32(vceqq_s32(vld1q_s32(buffer + i), k)))
+            break;
+    }
+
+    return skn_find_int32_t_scalar(buffer, i, size, key);
+}
+
+static integer_t
+skn_find_int64_t_neon(const int64_t *buffer, integer_t size, int64_t key)
+{
+    const int64x2_t k = vdupq_n_s64(key);
+
+    integer_t i = 0;
+
+    for (; i + 2 <= size; i += 2)
+    {
+        uint64x2_t equal = vceqq_s64(vld1q_s64(buffer + i), k);
+
+        if (vgetq_lane_u64(equal, 0) | vgetq_lane_u64(equal, 1))
+            break;
+    }
+
+    return skn_find_int64_t_scalar(buffer, i, size, key);
+}
+
+static int32_t
+skn_min_int32_t_neon(const int32_t *buffer, integer_t size)
+{
+    int32x4_t m = vdupq_n_s32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+        m = vminq_s32(m, vld1q_s32(buffer + i));
+
+    return skn_min_int32_t_scalar(buffer, i, size, vminvq_s32(m));
+}
+
+static int32_t
+skn_max_int32_t_neon(const int32_t *buffer, integer_t size)
+{
+    int32x4_t m = vdupq_n_s32(buffer[0]);
+
+    integer_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+        m = vmaxq_s32(m, vld1q_s32(buffer + i));
+
+    return skn_max_int32_t_scalar(buffer, i, size, vmaxvq_s32(m));
+}
+
+#endif
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
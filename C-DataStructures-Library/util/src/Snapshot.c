@@ -0,0 +1,140 @@
+/**
+ * @file Snapshot.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Snapshot.h"
+
+static const char snp_magic[8] = { 'C', 'D', 'S', 'L', 'S', 'N', 'A', 'P' };
+
+// Reads back differently on a machine with another byte order
+static const uint64_t snp_byte_order = UINT64_C(0x0102030405060708);
+
+/// Initializes the header of a snapshot of \c count elements of a \c kind of
+/// structure. Every field starts as zero.
+///
+/// \param[out] header The header to be initialized.
+/// \param[in] kind The structure being saved.
+/// \param[in] count The amount of elements that follow the header.
+void
+snp_header_init(SnapshotHeader_t *header, SnapshotKind kind, uint64_t count)
+{
+    memset(header, 0, sizeof(SnapshotHeader_t));
+    memcpy(header->magic, snp_magic, sizeof(snp_magic));
+
+    header->version = SNP_VERSION;
+    header->kind = (uint32_t)kind;
+    header->byte_order = snp_byte_order;
+    header->count = count;
+}
+
+/// \param[in] stream Where the header is written to.
+/// \param[in] header The header, initialized by snp_header_init().
+///
+/// \return True if the header was written, otherwise false.
+bool
+snp_write_header(FILE *stream, const SnapshotHeader_t *header)
+{
+    return fwrite(header, sizeof(SnapshotHeader_t), 1, stream) == 1;
+}
+
+/// Reads the header of a snapshot and checks that it was written by this
+/// version of the library, on a machine with the same byte order, for the
+/// same \c kind of structure.
+///
+/// \param[in] stream Where the header is read from.
+/// \param[in] kind The structure being restored.
+/// \param[out] header The header that was read.
+///
+/// \return True if a valid header was read, otherwise false.
+bool
+snp_read_header(FILE *stream, SnapshotKind kind, SnapshotHeader_t *header)
+{
+    if (fread(header, sizeof(SnapshotHeader_t), 1, stream) != 1)
+        return false;
+
+    return memcmp(header->magic, snp_magic, sizeof(snp_magic)) == 0
+           && header->version == SNP_VERSION
+           && header->kind == (uint32_t)kind
+           && header->byte_order == snp_byte_order
+           && header->count <= (uint64_t)DS_INTEGER_MAX;
+}
+
+/// Writes \c count elements with the serialize function of \c interface.
+///
+/// \param[in] stream Where the elements are written to.
+/// \param[in] interface The interface of the elements.
+/// \param[in] elements The elements.
+/// \param[in] count The amount of elements.
+///
+/// \return True if every element was written, otherwise false.
+bool
+snp_write_elements(FILE *stream, Interface_t *interface, void **elements,
+                   integer_t count)
+{
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (!interface->serialize(elements[i], stream))
+            return false;
+    }
+
+    return true;
+}
+
+/// Reads \c count elements with the deserialize function of \c interface
+/// into a new buffer, which the caller frees with free().
+///
+/// \param[in] stream Where the elements are read from.
+/// \param[in] interface The interface of the elements.
+/// \param[in] count The amount of elements.
+///
+/// \return A buffer with the elements or NULL if any of them could not be
+/// read, in which case the ones already read are released.
+void **
+snp_read_elements(FILE *stream, Interface_t *interface, integer_t count)
+{
+    void **elements = malloc(sizeof(void *) * (size_t)(count > 0 ? count : 1));
+
+    if (!elements)
+        return NULL;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        elements[i] = interface->deserialize(stream);
+
+        if (!elements[i])
+        {
+            while (i > 0)
+                interface_release(interface, elements[--i]);
+
+            free(elements);
+
+            return NULL;
+        }
+    }
+
+    return elements;
+}
+
+/// \param[in] stream Where the integer is written to.
+/// \param[in] value The integer.
+///
+/// \return True if the integer was written, otherwise false.
+bool
+snp_write_u64(FILE *stream, uint64_t value)
+{
+    return fwrite(&value, sizeof(uint64_t), 1, stream) == 1;
+}
+
+/// \param[in] stream Where the integer is read from.
+/// \param[out] value The integer.
+///
+/// \return True if the integer was read, otherwise false.
+bool
+snp_read_u64(FILE *stream, uint64_t *value)
+{
+    return fread(value, sizeof(uint64_t), 1, stream) == 1;
+}
@@ -0,0 +1,728 @@
+/**
+ * @file Sort.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 14/10/2026
+ */
+
+#include "Sort.h"
+
+/// Partitions smaller than this are sorted with insertion sort.
+#define SRT_INSERTION_THRESHOLD 24
+
+/// Partitions bigger than this use the ninther as their pivot.
+#define SRT_NINTHER_THRESHOLD 128
+
+/// How many elements partial insertion sort may move before giving up.
+#define SRT_PARTIAL_LIMIT 8
+
+/// Buffers smaller than this are not worth sorting in parallel.
+#define SRT_PARALLEL_THRESHOLD 8192
+
+/// \brief A parallel sort task.
+///
+/// Implementation detail. Either sorts \c source[a, a + a_size) in place or
+/// merges \c source[a, a + a_size) and \c source[b, b + b_size) into
+/// \c target starting at \c out.
+struct SortTask_s
+{
+    /// \brief Buffer read by the task.
+    void **source;
+
+    /// \brief Buffer written by a merge task.
+    void **target;
+
+    /// \brief The comparator.
+    compare_f compare;
+
+    /// \brief First run.
+    integer_t a, a_size;
+
+    /// \brief Second run.
+    integer_t b, b_size;
+
+    /// \brief Where the merged runs start in \c target.
+    integer_t out;
+};
+
+typedef struct SortTask_s SortTask_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+srt_pdqsort(void **begin, integer_t size, compare_f compare,
+            integer_t bad_allowed, bool leftmost);
+
+static void
+srt_unguarded_insertion_sort(void **begin, integer_t size, compare_f compare);
+
+static bool
+srt_partial_insertion_sort(void **begin, integer_t size, compare_f compare);
+
+static integer_t
+srt_partition_right(void **begin, integer_t size, compare_f compare,
+                    bool *already_partitioned);
+
+static integer_t
+srt_partition_left(void **begin, integer_t size, compare_f compare);
+
+static void
+srt_sort3(void **a, void **b, void **c, compare_f compare);
+
+static void
+srt_swap(void **a, void **b);
+
+static void
+srt_sift_down(void **buffer, integer_t index, integer_t size,
+              compare_f compare);
+
+static void
+srt_sort_task(void *task);
+
+static void
+srt_merge_task(void *task);
+
+static integer_t
+srt_co_rank(integer_t k, void **A, integer_t m, void **B, integer_t n,
+            compare_f compare);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Sorts a buffer of pointers in ascending order according to \c compare. It
+/// uses pattern-defeating quicksort, an introsort variant:
+/// - Small partitions are sorted with insertion sort;
+/// - The pivot is the median of three elements or, for big partitions, the
+/// median of three medians (ninther);
+/// - Runs of elements equal to the pivot are put aside in a single pass, so
+/// many duplicates make it faster, not slower;
+/// - Partitions that were already sorted are detected and finished with a
+/// cheap insertion sort;
+/// - Bad partitions shuffle a few elements to break patterns and, after too
+/// many of them, the partition is sorted with heap sort.
+///
+/// This makes it \c O(n log n) in the worst case and \c O(n) for sorted,
+/// reverse-sorted or all-equal inputs. The sort is not stable.
+///
+/// \param[in] buffer The buffer to be sorted.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] compare The comparator.
+void
+srt_sort(void **buffer, integer_t size, compare_f compare)
+{
+    if (size < 2)
+        return;
+
+    // log2(size) bad partitions are allowed before falling back to heap sort
+    integer_t bad_allowed = 0;
+
+    for (integer_t n = size; n > 1; n >>= 1)
+        bad_allowed++;
+
+    srt_pdqsort(buffer, size, compare, bad_allowed, true);
+}
+
+/// Sorts a buffer of pointers in ascending order according to \c compare
+/// using insertion sort. It is stable and fast for small or nearly sorted
+/// buffers but \c O(n^2) in general.
+///
+/// \param[in] buffer The buffer to be sorted.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] compare The comparator.
+void
+srt_insertion_sort(void **buffer, integer_t size, compare_f compare)
+{
+    for (integer_t i = 1; i < size; i++)
+    {
+        void *element = buffer[i];
+
+        integer_t j = i;
+
+        while (j > 0 && compare(element, buffer[j - 1]) < 0)
+        {
+            buffer[j] = buffer[j - 1];
+            j--;
+        }
+
+        buffer[j] = element;
+    }
+}
+
+/// Sorts a buffer of pointers in ascending order according to \c compare
+/// using heap sort. It is \c O(n log n) in every case but slower than
+/// \ref srt_sort on average. The sort is not stable.
+///
+/// \param[in] buffer The buffer to be sorted.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] compare The comparator.
+void
+srt_heap_sort(void **buffer, integer_t size, compare_f compare)
+{
+    for (integer_t i = size / 2 - 1; i >= 0; i--)
+        srt_sift_down(buffer, i, size, compare);
+
+    for (integer_t i = size - 1; i > 0; i--)
+    {
+        srt_swap(&buffer[0], &buffer[i]);
+        srt_sift_down(buffer, 0, i, compare);
+    }
+}
+
+/// Sorts a buffer of pointers in ascending order of their keys using a least
+/// significant digit radix sort with 8-bit digits. Every key is extracted
+/// only once and the histograms of all digits are built in the same pass, so
+/// the buffer is read once plus once per digit that is not the same for all
+/// keys; keys that fit in 32 bits take at most four passes. The sort is
+/// stable and takes linear time regardless of the input.
+///
+/// Signed and floating point keys must be mapped so that unsigned order is
+/// the right one. See the \c key_ functions in Utility.h.
+///
+/// \param[in] buffer The buffer to be sorted.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] key The key extractor.
+///
+/// \return True if the buffer was sorted or false if the temporary buffers
+/// could not be allocated, in which case the buffer is left untouched.
+bool
+srt_radix_sort(void **buffer, integer_t size, key_f key)
+{
+    if (size < 2)
+        return true;
+
+    uint64_t *keys = malloc(sizeof(uint64_t) * (size_t)size * 2);
+    void **temp = malloc(sizeof(void*) * (size_t)size);
+
+    if (!keys || !temp)
+    {
+        free(keys);
+        free(temp);
+
+        return false;
+    }
+
+    size_t counts[8][256] = { { 0 } };
+
+    for (integer_t i = 0; i < size; i++)
+    {
+        uint64_t k = key(buffer[i]);
+
+        keys[i] = k;
+
+        for (int d = 0; d < 8; d++)
+            counts[d][(k >> (d * 8)) & 0xFF]++;
+    }
+
+    uint64_t *source_keys = keys, *target_keys = keys + size;
+    void **source = buffer, **target = temp;
+
+    for (int d = 0; d < 8; d++)
+    {
+        size_t *count = counts[d];
+        int shift = d * 8;
+
+        // Every key has the same digit so this pass would change nothing
+        if (count[(source_keys[0] >> shift) & 0xFF] == (size_t)size)
+            continue;
+
+        size_t offset = 0;
+
+        for (int b = 0; b < 256; b++)
+        {
+            size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+
+        for (integer_t i = 0; i < size; i++)
+        {
+            size_t p = count[(source_keys[i] >> shift) & 0xFF]++;
+
+            target_keys[p] = source_keys[i];
+            target[p] = source[i];
+        }
+
+        uint64_t *swap_keys = source_keys;
+        source_keys = target_keys;
+        target_keys = swap_keys;
+
+        void **swap = source;
+        source = target;
+        target = swap;
+    }
+
+    if (source != buffer)
+        memcpy(buffer, source, sizeof(void*) * (size_t)size);
+
+    free(keys);
+    free(temp);
+
+    return true;
+}
+
+/// Sorts a buffer of pointers in ascending order according to \c compare
+/// using every thread of \c pool. The buffer is split in one run per thread
+/// (rounded up to a power of two) and each run is sorted with \ref srt_sort.
+/// Runs are then merged in pairs, back and forth between the buffer and a
+/// temporary one, until a single run is left. Each merge is itself split in
+/// pieces of the same size, so all threads keep working until the last merge.
+///
+/// Small buffers, pools with a single thread or a failed allocation of the
+/// temporary buffer fall back to \ref srt_sort. The sort is not stable.
+///
+/// \param[in] buffer The buffer to be sorted.
+/// \param[in] size The amount of elements in the buffer.
+/// \param[in] compare The comparator.
+/// \param[in] pool The thread pool that will run the sort.
+void
+srt_sort_parallel(void **buffer, integer_t size, compare_f compare,
+                  ThreadPool_t *pool)
+{
+    integer_t runs = 1;
+
+    while (runs < tpl_threads(pool))
+        runs *= 2;
+
+    if (runs == 1 || size < SRT_PARALLEL_THRESHOLD)
+    {
+        srt_sort(buffer, size, compare);
+        return;
+    }
+
+    void **temp = malloc(sizeof(void*) * (size_t)size);
+    integer_t *bounds = malloc(sizeof(integer_t) * (size_t)(runs + 1));
+    SortTask_t *tasks = malloc(sizeof(SortTask_t) * (size_t)runs);
+
+    if (!temp || !bounds || !tasks)
+    {
+        free(temp);
+        free(bounds);
+        free(tasks);
+
+        srt_sort(buffer, size, compare);
+        return;
+    }
+
+    for (integer_t r = 0; r <= runs; r++)
+        bounds[r] = size * r / runs;
+
+    for (integer_t r = 0; r < runs; r++)
+    {
+        tasks[r] = (SortTask_t) { buffer, NULL, compare, bounds[r],
+                                  bounds[r + 1] - bounds[r], 0, 0, 0 };
+
+        if (!tpl_submit(pool, srt_sort_task, &tasks[r]))
+        {
+            srt_sort_task(&tasks[r]);
+        }
+    }
+
+    tpl_wait(pool);
+
+    void **source = buffer, **target = temp;
+
+    // Every round halves the amount of runs and splits each merge in as many
+    // pieces as needed to have one task per thread
+    for (integer_t width = 1; width < runs; width *= 2)
+    {
+        integer_t count = 0;
+        integer_t pieces = width * 2;
+
+        for (integer_t r = 0; r < runs; r += width * 2)
+        {
+            integer_t lo = bounds[r];
+            integer_t mid = bounds[r + width];
+            integer_t hi = bounds[r + width * 2];
+
+            integer_t m = mid - lo, n = hi - mid;
+
+            for (integer_t p = 0; p < pieces; p++)
+            {
+                integer_t k0 = (hi - lo) * p / pieces;
+                integer_t k1 = (hi - lo) * (p + 1) / pieces;
+
+                integer_t i0 = srt_co_rank(k0, source + lo, m, source + mid,
+                                           n, compare);
+                integer_t i1 = srt_co_rank(k1, source + lo, m, source + mid,
+                                           n, compare);
+
+                tasks[count] = (SortTask_t) { source, target, compare,
+                                              lo + i0, i1 - i0,
+                                              mid + k0 - i0,
+                                              (k1 - i1) - (k0 - i0),
+                                              lo + k0 };
+
+                if (!tpl_submit(pool, srt_merge_task, &tasks[count]))
+                {
+                    srt_merge_task(&tasks[count]);
+                }
+
+                count++;
+            }
+        }
+
+        tpl_wait(pool);
+
+        void **swap = source;
+        source = target;
+        target = swap;
+    }
+
+    if (source != buffer)
+        memcpy(buffer, source, sizeof(void*) * (size_t)size);
+
+    free(temp);
+    free(bounds);
+    free(tasks);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Sorts [begin, begin + size). If leftmost is false, begin[-1] is known to be
+// lesser than or equal to every element of the partition.
+static void
+srt_pdqsort(void **begin, integer_t size, compare_f compare,
+            integer_t bad_allowed, bool leftmost)
+{
+    while (true)
+    {
+        if (size < SRT_INSERTION_THRESHOLD)
+        {
+            if (leftmost)
+                srt_insertion_sort(begin, size, compare);
+            else
+                srt_unguarded_insertion_sort(begin, size, compare);
+
+            return;
+        }
+
+        // Choose a pivot and move it to begin[0]
+        integer_t half = size / 2;
+
+        if (size > SRT_NINTHER_THRESHOLD)
+        {
+            srt_sort3(begin, begin + half, begin + size - 1, compare);
+            srt_sort3(begin + 1, begin + half - 1, begin + size - 2, compare);
+            srt_sort3(begin + 2, begin + half + 1, begin + size - 3, compare);
+            srt_sort3(begin + half - 1, begin + half, begin + half + 1,
+                      compare);
+            srt_swap(begin, begin + half);
+        }
+        else
+            srt_sort3(begin + half, begin, begin + size - 1, compare);
+
+        // If the pivot is equal to the element before the partition, all
+        // elements equal to it can be put to the left and skipped
+        if (!leftmost && compare(begin[-1], begin[0]) >= 0)
+        {
+            integer_t pivot = srt_partition_left(begin, size, compare);
+
+            begin += pivot + 1;
+            size -= pivot + 1;
+
+            continue;
+        }
+
+        bool already_partitioned;
+
+        integer_t pivot = srt_partition_right(begin, size, compare,
+                                              &already_partitioned);
+
+        integer_t left_size = pivot;
+        integer_t right_size = size - pivot - 1;
+
+        bool unbalanced = left_size < size / 8 || right_size < size / 8;
+
+        if (unbalanced)
+        {
+            // Too many bad partitions, switch to heap sort
+            if (--bad_allowed == 0)
+            {
+                srt_heap_sort(begin, size, compare);
+                return;
+            }
+
+            // Shuffle a few elements to break patterns
+            if (left_size >= SRT_INSERTION_THRESHOLD)
+            {
+                void **p = begin + pivot;
+                integer_t q = left_size / 4;
+
+                srt_swap(begin, begin + q);
+                srt_swap(p - 1, p - q);
+
+                if (left_size > SRT_NINTHER_THRESHOLD)
+                {
+                    srt_swap(begin + 1, begin + q + 1);
+                    srt_swap(begin + 2, begin + q + 2);
+                    srt_swap(p - 2, p - q - 1);
+                    srt_swap(p - 3, p - q - 2);
+                }
+            }
+
+            if (right_size >= SRT_INSERTION_THRESHOLD)
+            {
+                void **p = begin + pivot;
+                void **end = begin + size;
+                integer_t q = right_size / 4;
+
+                srt_swap(p + 1, p + q + 1);
+                srt_swap(end - 1, end - q);
+
+                if (right_size > SRT_NINTHER_THRESHOLD)
+                {
+                    srt_swap(p + 2, p + q + 2);
+                    srt_swap(p + 3, p + q + 3);
+                    srt_swap(end - 2, end - q - 1);
+                    srt_swap(end - 3, end - q - 2);
+                }
+            }
+        }
+        else if (already_partitioned &&
+                 srt_partial_insertion_sort(begin, left_size, compare) &&
+                 srt_partial_insertion_sort(begin + pivot + 1, right_size,
+                                            compare))
+        {
+            // Both sides were already sorted or nearly sorted
+            return;
+        }
+
+        // Recurse into the left side and loop on the right side
+        srt_pdqsort(begin, left_size, compare, bad_allowed, leftmost);
+
+        begin += pivot + 1;
+        size = right_size;
+        leftmost = false;
+    }
+}
+
+// Insertion sort that relies on begin[-1] being lesser than or equal to every
+// element so no bounds check is needed
+static void
+srt_unguarded_insertion_sort(void **begin, integer_t size, compare_f compare)
+{
+    for (integer_t i = 1; i < size; i++)
+    {
+        void *element = begin[i];
+
+        integer_t j = i;
+
+        while (compare(element, begin[j - 1]) < 0)
+        {
+            begin[j] = begin[j - 1];
+            j--;
+        }
+
+        begin[j] = element;
+    }
+}
+
+// Insertion sort that gives up and returns false after moving more than
+// SRT_PARTIAL_LIMIT elements
+static bool
+srt_partial_insertion_sort(void **begin, integer_t size, compare_f compare)
+{
+    integer_t moves = 0;
+
+    for (integer_t i = 1; i < size; i++)
+    {
+        void *element = begin[i];
+
+        integer_t j = i;
+
+        while (j > 0 && compare(element, begin[j - 1]) < 0)
+        {
+            begin[j] = begin[j - 1];
+            j--;
+        }
+
+        begin[j] = element;
+
+        moves += i - j;
+
+        if (moves > SRT_PARTIAL_LIMIT)
+            return false;
+    }
+
+    return true;
+}
+
+// Partitions around begin[0], putting elements equal to the pivot to the
+// right. Returns the final position of the pivot. The median of three
+// guarantees that there is an element greater than or equal to the pivot at
+// the end of the partition.
+static integer_t
+srt_partition_right(void **begin, integer_t size, compare_f compare,
+                    bool *already_partitioned)
+{
+    void *pivot = begin[0];
+
+    integer_t first = 0;
+    integer_t last = size;
+
+    // First element greater than or equal to the pivot
+    while (compare(begin[++first], pivot) < 0);
+
+    // Last element lesser than the pivot. If there was none before first the
+    // search must be bounded
+    if (first == 1)
+        while (first < last && compare(begin[--last], pivot) >= 0);
+    else
+        while (compare(begin[--last], pivot) >= 0);
+
+    *already_partitioned = first >= last;
+
+    while (first < last)
+    {
+        srt_swap(&begin[first], &begin[last]);
+
+        while (compare(begin[++first], pivot) < 0);
+        while (compare(begin[--last], pivot) >= 0);
+    }
+
+    integer_t position = first - 1;
+
+    begin[0] = begin[position];
+    begin[position] = pivot;
+
+    return position;
+}
+
+// Partitions around begin[0], putting elements equal to the pivot to the
+// left. Returns the final position of the pivot.
+static integer_t
+srt_partition_left(void **begin, integer_t size, compare_f compare)
+{
+    void *pivot = begin[0];
+
+    integer_t first = 0;
+    integer_t last = size;
+
+    while (compare(pivot, begin[--last]) < 0);
+
+    if (last + 1 == size)
+        while (first < last && compare(pivot, begin[++first]) >= 0);
+    else
+        while (compare(pivot, begin[++first]) >= 0);
+
+    while (first < last)
+    {
+        srt_swap(&begin[first], &begin[last]);
+
+        while (compare(pivot, begin[--last]) < 0);
+        while (compare(pivot, begin[++first]) >= 0);
+    }
+
+    begin[0] = begin[last];
+    begin[last] = pivot;
+
+    return last;
+}
+
+// Sorts three elements so that *a <= *b <= *c
+static void
+srt_sort3(void **a, void **b, void **c, compare_f compare)
+{
+    if (compare(*b, *a) < 0)
+        srt_swap(a, b);
+
+    if (compare(*c, *b) < 0)
+    {
+        srt_swap(b, c);
+
+        if (compare(*b, *a) < 0)
+            srt_swap(a, b);
+    }
+}
+
+static void
+srt_swap(void **a, void **b)
+{
+    void *temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void
+srt_sift_down(void **buffer, integer_t index, integer_t size,
+              compare_f compare)
+{
+    void *element = buffer[index];
+
+    while (true)
+    {
+        integer_t child = 2 * index + 1;
+
+        if (child >= size)
+            break;
+
+        if (child + 1 < size && compare(buffer[child + 1], buffer[child]) > 0)
+            child++;
+
+        if (compare(buffer[child], element) <= 0)
+            break;
+
+        buffer[index] = buffer[child];
+        index = child;
+    }
+
+    buffer[index] = element;
+}
+
+static void
+srt_sort_task(void *task)
+{
+    SortTask_t *T = task;
+
+    srt_sort(T->source + T->a, T->a_size, T->compare);
+}
+
+static void
+srt_merge_task(void *task)
+{
+    SortTask_t *T = task;
+
+    void **A = T->source + T->a, **A_end = A + T->a_size;
+    void **B = T->source + T->b, **B_end = B + T->b_size;
+    void **out = T->target + T->out;
+
+    while (A < A_end && B < B_end)
+    {
+        if (T->compare(*B, *A) < 0)
+            *out++ = *B++;
+        else
+            *out++ = *A++;
+    }
+
+    while (A < A_end)
+        *out++ = *A++;
+
+    while (B < B_end)
+        *out++ = *B++;
+}
+
+// Returns how many elements of A are among the first k elements of the merge
+// of A (of size m) and B (of size n), taking elements of A first on ties
+static integer_t
+srt_co_rank(integer_t k, void **A, integer_t m, void **B, integer_t n,
+            compare_f compare)
+{
+    integer_t lo = k > n ? k - n : 0;
+    integer_t hi = k < m ? k : m;
+
+    while (lo < hi)
+    {
+        integer_t i = lo + (hi - lo) / 2;
+        integer_t j = k - i;
+
+        // A[i] comes before B[j - 1] so more elements of A are needed
+        if (j > 0 && compare(A[i], B[j - 1]) <= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
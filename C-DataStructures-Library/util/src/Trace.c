@@ -0,0 +1,75 @@
+/**
+ * @file Trace.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Trace.h"
+
+#ifdef DS_TRACE
+
+_Atomic(trace_f) trc_callback = NULL;
+
+static _Atomic(void *) trc_argument = NULL;
+
+#endif
+
+/// Sets the function called at every trace point of the containers, or
+/// removes it if \c callback is NULL. The callback may be called from many
+/// threads at once, and for the argument to match the callback it should be
+/// changed while no traced function runs. Trace points only exist if the
+/// library was compiled with \c DS_TRACE defined.
+///
+/// \param[in] callback The function called at every trace point, or NULL.
+/// \param[in] argument Passed to every call of \c callback.
+///
+/// \return True if the callback was set or false if the library was compiled
+/// without trace points.
+bool
+trc_set(trace_f callback, void *argument)
+{
+#ifdef DS_TRACE
+    atomic_store_explicit(&trc_argument, argument, memory_order_relaxed);
+    atomic_store_explicit(&trc_callback, callback, memory_order_release);
+
+    return true;
+#else
+    (void)callback;
+    (void)argument;
+
+    return false;
+#endif
+}
+
+/// Returns true if the library was compiled with \c DS_TRACE defined, in
+/// which case trace points call the function given to trc_set() and, where
+/// <sys/sdt.h> is available, can be attached to as USDT probes.
+///
+/// \return True if the library has trace points.
+bool
+trc_enabled(void)
+{
+#ifdef DS_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef DS_TRACE
+
+// Calls the callback of a trace point, if there still is one
+void
+trc_fire(const char *probe, TracePoint point, integer_t value)
+{
+    trace_f callback = atomic_load_explicit(&trc_callback,
+                                            memory_order_acquire);
+
+    if (callback)
+        callback(probe, point, value,
+                 atomic_load_explicit(&trc_argument, memory_order_relaxed));
+}
+
+#endif
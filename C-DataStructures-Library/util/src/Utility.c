@@ -7,6 +7,7 @@
  */
 
 #include "Utility.h"
+#include <float.h>
 #include <inttypes.h>
 
 int compare_int8_t(const void *element1, const void *element2)
@@ -264,6 +265,139 @@ void *copy_string(const void *element)
     return strdup(e);
 }
 
+void *copy_alloc_int8_t(const void *element, Allocator_t *allocator)
+{
+    int8_t *result = allocator->alloc(allocator->context, sizeof(int8_t));
+
+    if (result)
+        *result = *(const int8_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_int16_t(const void *element, Allocator_t *allocator)
+{
+    int16_t *result = allocator->alloc(allocator->context, sizeof(int16_t));
+
+    if (result)
+        *result = *(const int16_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_int32_t(const void *element, Allocator_t *allocator)
+{
+    int32_t *result = allocator->alloc(allocator->context, sizeof(int32_t));
+
+    if (result)
+        *result = *(const int32_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_int64_t(const void *element, Allocator_t *allocator)
+{
+    int64_t *result = allocator->alloc(allocator->context, sizeof(int64_t));
+
+    if (result)
+        *result = *(const int64_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_uint8_t(const void *element, Allocator_t *allocator)
+{
+    uint8_t *result = allocator->alloc(allocator->context, sizeof(uint8_t));
+
+    if (result)
+        *result = *(const uint8_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_uint16_t(const void *element, Allocator_t *allocator)
+{
+    uint16_t *result = allocator->alloc(allocator->context, sizeof(uint16_t));
+
+    if (result)
+        *result = *(const uint16_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_uint32_t(const void *element, Allocator_t *allocator)
+{
+    uint32_t *result = allocator->alloc(allocator->context, sizeof(uint32_t));
+
+    if (result)
+        *result = *(const uint32_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_uint64_t(const void *element, Allocator_t *allocator)
+{
+    uint64_t *result = allocator->alloc(allocator->context, sizeof(uint64_t));
+
+    if (result)
+        *result = *(const uint64_t*)element;
+
+    return result;
+}
+
+void *copy_alloc_float(const void *element, Allocator_t *allocator)
+{
+    float *result = allocator->alloc(allocator->context, sizeof(float));
+
+    if (result)
+        *result = *(const float*)element;
+
+    return result;
+}
+
+void *copy_alloc_double(const void *element, Allocator_t *allocator)
+{
+    double *result = allocator->alloc(allocator->context, sizeof(double));
+
+    if (result)
+        *result = *(const double*)element;
+
+    return result;
+}
+
+void *copy_alloc_long_double(const void *element, Allocator_t *allocator)
+{
+    long double *result = allocator->alloc(allocator->context,
+                                           sizeof(long double));
+
+    if (result)
+        *result = *(const long double*)element;
+
+    return result;
+}
+
+void *copy_alloc_char(const void *element, Allocator_t *allocator)
+{
+    char *result = allocator->alloc(allocator->context, sizeof(char));
+
+    if (result)
+        *result = *(const char*)element;
+
+    return result;
+}
+
+void *copy_alloc_string(const void *element, Allocator_t *allocator)
+{
+    size_t length = strlen((const char*)element) + 1;
+
+    char *result = allocator->alloc(allocator->context, length);
+
+    if (result)
+        memcpy(result, element, length);
+
+    return result;
+}
+
 void display_int8_t(const void *element)
 {
     const int8_t *e = (const int8_t*)element;
@@ -355,6 +489,111 @@ void display_string(const void *element)
     printf("%s", e);
 }
 
+static const uint64_t hash_secret[4] = {
+    UINT64_C(0x2d358dccaa6c78a5), UINT64_C(0x8bb84b93962eacc9),
+    UINT64_C(0x4b33a62ed433d4a3), UINT64_C(0x4d5a2da51de1aa47)
+};
+
+static uint64_t hash_key[2];
+
+static bool hash_key_set = false;
+
+// 64x64 to 128 bit multiplication, leaving the low half in a and the high
+// half in b
+static void hash_multiply(uint64_t *a, uint64_t *b)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t)*a * *b;
+
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32;
+    uint64_t la = (uint32_t)*a, lb = (uint32_t)*b;
+
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+
+    c += lo < t;
+
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static uint64_t hash_mix(uint64_t a, uint64_t b)
+{
+    hash_multiply(&a, &b);
+
+    return a ^ b;
+}
+
+static uint64_t hash_read8(const uint8_t *p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(uint64_t));
+
+    return v;
+}
+
+static uint64_t hash_read4(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(uint32_t));
+
+    return v;
+}
+
+// SipHash is defined over little-endian words, whatever the platform
+static uint64_t hash_read8_le(const uint8_t *p)
+{
+    uint64_t v = 0;
+
+    for (int i = 7; i >= 0; i--)
+        v = (v << 8) | p[i];
+
+    return v;
+}
+
+static uint64_t hash_rotate(uint64_t x, int bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+static void hash_sip_round(uint64_t v[4])
+{
+    v[0] += v[1]; v[1] = hash_rotate(v[1], 13); v[1] ^= v[0];
+    v[0] = hash_rotate(v[0], 32);
+    v[2] += v[3]; v[3] = hash_rotate(v[3], 16); v[3] ^= v[2];
+    v[0] += v[3]; v[3] = hash_rotate(v[3], 21); v[3] ^= v[0];
+    v[2] += v[1]; v[1] = hash_rotate(v[1], 17); v[1] ^= v[2];
+    v[2] = hash_rotate(v[2], 32);
+}
+
+// A key that is different for each run of the program
+static void hash_key_random(void)
+{
+    uint64_t x = (uint64_t)time(NULL) ^ (uint64_t)(uintptr_t)&hash_key
+                 ^ ((uint64_t)clock() << 32);
+
+    for (int i = 0; i < 2; i++)
+    {
+        x += UINT64_C(0x9e3779b97f4a7c15);
+
+        uint64_t z = x;
+
+        z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+        z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+        hash_key[i] = z ^ (z >> 31);
+    }
+
+    hash_key_set = true;
+}
+
 unsigned_t hash_int8_t(const void *element)
 {
     const int8_t *e = (const int8_t*)element;
@@ -483,27 +722,341 @@ unsigned_t hash_double(const void *element)
 
 unsigned_t hash_long_double(const void *element)
 {
-    /// \todo hash_long_dougle
-    return 0;
+    // Only the bytes of the value, not the padding that follows it
+#if LDBL_MANT_DIG == 64
+    return hash_bytes(element, 10);
+#else
+    return hash_bytes(element, sizeof(long double));
+#endif
 }
 
 unsigned_t hash_char(const void *element)
 {
-    /// \todo hash_char
-    return 0;
+    const unsigned char *e = (const unsigned char*)element;
+
+    uint64_t x = (uint64_t)*e;
+
+    x = (x ^ (x >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94d049bb133111eb);
+    x = x ^ (x >> 31);
+
+    return x;
 }
 
 unsigned_t hash_string(const void *element)
 {
-    const char *str = (const char*)element;
+    return hash_bytes(element, strlen((const char*)element));
+}
 
-    uint64_t x = 5381;
-    int c;
+// Keyed with the process-wide SipHash key, for tables whose keys come from
+// untrusted input
+unsigned_t hash_string_keyed(const void *element)
+{
+    if (!hash_key_set)
+        hash_key_random();
 
-    while ((c = *str++))
-        x = ((x << 5) + x) + c;
+    return hash_siphash(element, strlen((const char*)element),
+                        hash_key[0], hash_key[1]);
+}
 
-    return x;
+// Hashes with wyhash's default secret and seed
+uint64_t hash_bytes(const void *data, size_t length)
+{
+    return hash_bytes_seeded(data, length, 0);
+}
+
+// wyhash (final version 4). Inputs of up to 16 bytes are read with two
+// overlapping loads and longer ones 48 bytes at a time in three independent
+// lanes.
+uint64_t hash_bytes_seeded(const void *data, size_t length, uint64_t seed)
+{
+    const uint8_t *p = (const uint8_t*)data;
+
+    uint64_t a, b;
+
+    seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+
+    if (length <= 16)
+    {
+        if (length >= 4)
+        {
+            size_t middle = (length >> 3) << 2;
+
+            a = (hash_read4(p) << 32) | hash_read4(p + middle);
+            b = (hash_read4(p + length - 4) << 32)
+                | hash_read4(p + length - 4 - middle);
+        }
+        else if (length > 0)
+        {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8)
+                | p[length - 1];
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        size_t i = length;
+
+        if (i >= 48)
+        {
+            uint64_t seed1 = seed, seed2 = seed;
+
+            do
+            {
+                seed = hash_mix(hash_read8(p) ^ hash_secret[1],
+                                hash_read8(p + 8) ^ seed);
+                seed1 = hash_mix(hash_read8(p + 16) ^ hash_secret[2],
+                                 hash_read8(p + 24) ^ seed1);
+                seed2 = hash_mix(hash_read8(p + 32) ^ hash_secret[3],
+                                 hash_read8(p + 40) ^ seed2);
+
+                p += 48;
+                i -= 48;
+            }
+            while (i >= 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (i > 16)
+        {
+            seed = hash_mix(hash_read8(p) ^ hash_secret[1],
+                            hash_read8(p + 8) ^ seed);
+
+            p += 16;
+            i -= 16;
+        }
+
+        a = hash_read8(p + i - 16);
+        b = hash_read8(p + i - 8);
+    }
+
+    a ^= hash_secret[1];
+    b ^= seed;
+
+    hash_multiply(&a, &b);
+
+    return hash_mix(a ^ hash_secret[0] ^ length, b ^ hash_secret[1]);
+}
+
+// SipHash-2-4 with a 128-bit key given as two little-endian words
+uint64_t hash_siphash(const void *data, size_t length, uint64_t k0,
+                      uint64_t k1)
+{
+    const uint8_t *p = (const uint8_t*)data;
+
+    uint64_t v[4] = {
+        k0 ^ UINT64_C(0x736f6d6570736575),
+        k1 ^ UINT64_C(0x646f72616e646f6d),
+        k0 ^ UINT64_C(0x6c7967656e657261),
+        k1 ^ UINT64_C(0x7465646279746573)
+    };
+
+    size_t blocks = length / 8;
+
+    for (size_t i = 0; i < blocks; i++, p += 8)
+    {
+        uint64_t m = hash_read8_le(p);
+
+        v[3] ^= m;
+        hash_sip_round(v);
+        hash_sip_round(v);
+        v[0] ^= m;
+    }
+
+    // The remaining bytes and the length in the top byte
+    uint64_t m = (uint64_t)length << 56;
+
+    for (size_t i = 0; i < length % 8; i++)
+        m |= (uint64_t)p[i] << (8 * i);
+
+    v[3] ^= m;
+    hash_sip_round(v);
+    hash_sip_round(v);
+    v[0] ^= m;
+
+    v[2] ^= 0xff;
+
+    for (int i = 0; i < 4; i++)
+        hash_sip_round(v);
+
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+// Sets the key used by hash_string_keyed(). If never called, a random key is
+// chosen on first use.
+void hash_keyed_seed(uint64_t k0, uint64_t k1)
+{
+    hash_key[0] = k0;
+    hash_key[1] = k1;
+
+    hash_key_set = true;
+}
+
+// Signed keys have their sign bit flipped so negative numbers come first.
+// Keys only use as many bytes as the type so radix sorts can skip the rest.
+uint64_t key_int8_t(const void *element)
+{
+    return (uint8_t)*(const int8_t*)element ^ UINT8_C(0x80);
+}
+
+uint64_t key_int16_t(const void *element)
+{
+    return (uint16_t)*(const int16_t*)element ^ UINT16_C(0x8000);
+}
+
+uint64_t key_int32_t(const void *element)
+{
+    return (uint32_t)*(const int32_t*)element ^ UINT32_C(0x80000000);
+}
+
+uint64_t key_int64_t(const void *element)
+{
+    return (uint64_t)*(const int64_t*)element ^ UINT64_C(0x8000000000000000);
+}
+
+uint64_t key_uint8_t(const void *element)
+{
+    return *(const uint8_t*)element;
+}
+
+uint64_t key_uint16_t(const void *element)
+{
+    return *(const uint16_t*)element;
+}
+
+uint64_t key_uint32_t(const void *element)
+{
+    return *(const uint32_t*)element;
+}
+
+uint64_t key_uint64_t(const void *element)
+{
+    return *(const uint64_t*)element;
+}
+
+// IEEE-754 keys flip every bit of negative numbers and only the sign bit of
+// positive ones. NaNs go after positive infinity or before negative infinity
+// depending on their sign.
+uint64_t key_float(const void *element)
+{
+    uint32_t x;
+
+    memcpy(&x, element, sizeof(float));
+
+    return (x & UINT32_C(0x80000000)) ? ~x : x ^ UINT32_C(0x80000000);
+}
+
+uint64_t key_double(const void *element)
+{
+    uint64_t x;
+
+    memcpy(&x, element, sizeof(double));
+
+    return (x & UINT64_C(0x8000000000000000))
+           ? ~x : x ^ UINT64_C(0x8000000000000000);
+}
+
+void reduce_sum_int64_t(void *accumulator, const void *element)
+{
+    *(int64_t*)accumulator += *(const int64_t*)element;
+}
+
+void reduce_min_int64_t(void *accumulator, const void *element)
+{
+    if (*(const int64_t*)element < *(int64_t*)accumulator)
+        *(int64_t*)accumulator = *(const int64_t*)element;
+}
+
+void reduce_max_int64_t(void *accumulator, const void *element)
+{
+    if (*(const int64_t*)element > *(int64_t*)accumulator)
+        *(int64_t*)accumulator = *(const int64_t*)element;
+}
+
+// Adding to every element of a range moves its minimum and maximum by the
+// same amount and its sum by the amount times the size of the range
+void apply_add_int64_t(void *aggregate, const void *update, integer_t count)
+{
+    (void)count;
+
+    *(int64_t*)aggregate += *(const int64_t*)update;
+}
+
+void apply_add_sum_int64_t(void *aggregate, const void *update,
+                           integer_t count)
+{
+    *(int64_t*)aggregate += *(const int64_t*)update * count;
+}
+
+// Elements of fixed size are written as their bytes in memory, so they can
+// only be read back on machines with the same byte order
+#define UTIL_SERIALIZER(name, type)                                           \
+    bool serialize_##name(const void *element, FILE *stream)                  \
+    {                                                                         \
+        return fwrite(element, sizeof(type), 1, stream) == 1;                 \
+    }                                                                         \
+                                                                              \
+    void *deserialize_##name(FILE *stream)                                    \
+    {                                                                         \
+        type *e = malloc(sizeof(type));                                       \
+                                                                              \
+        if (e && fread(e, sizeof(type), 1, stream) != 1)                      \
+        {                                                                     \
+            free(e);                                                          \
+            return NULL;                                                      \
+        }                                                                     \
+                                                                              \
+        return e;                                                             \
+    }
+
+UTIL_SERIALIZER(int8_t, int8_t)
+UTIL_SERIALIZER(int16_t, int16_t)
+UTIL_SERIALIZER(int32_t, int32_t)
+UTIL_SERIALIZER(int64_t, int64_t)
+UTIL_SERIALIZER(uint8_t, uint8_t)
+UTIL_SERIALIZER(uint16_t, uint16_t)
+UTIL_SERIALIZER(uint32_t, uint32_t)
+UTIL_SERIALIZER(uint64_t, uint64_t)
+UTIL_SERIALIZER(float, float)
+UTIL_SERIALIZER(double, double)
+UTIL_SERIALIZER(long_double, long double)
+UTIL_SERIALIZER(char, char)
+
+// Strings are written as their length followed by their characters
+bool serialize_string(const void *element, FILE *stream)
+{
+    uint64_t length = strlen((const char *)element);
+
+    return fwrite(&length, sizeof(uint64_t), 1, stream) == 1
+           && fwrite(element, 1, (size_t)length, stream) == (size_t)length;
+}
+
+void *deserialize_string(FILE *stream)
+{
+    uint64_t length;
+
+    if (fread(&length, sizeof(uint64_t), 1, stream) != 1 || length >= SIZE_MAX)
+        return NULL;
+
+    char *e = malloc((size_t)length + 1);
+
+    if (!e)
+        return NULL;
+
+    if (fread(e, 1, (size_t)length, stream) != (size_t)length)
+    {
+        free(e);
+        return NULL;
+    }
+
+    e[length] = '\0';
+
+    return e;
 }
 
 void *new_int8_t(int8_t element)
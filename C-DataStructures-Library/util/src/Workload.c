@@ -0,0 +1,302 @@
+/**
+ * @file Workload.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 15/10/2026
+ */
+
+#include "Workload.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+
+/// \brief A recorded sequence of operations over a set of keys.
+///
+/// Operations are recorded by the application, usually next to the calls it
+/// makes to a container, and saved to a file that the replay benchmark reads
+/// back to drive every set and map of the library with the same sequence.
+/// Recording can be done from many threads at once.
+struct Workload_s
+{
+    /// \brief The operation of each entry.
+    unsigned char *operations;
+
+    /// \brief The key of each entry.
+    int64_t *keys;
+
+    /// \brief Amount of recorded operations.
+    integer_t size;
+
+    /// \brief Amount of operations the buffers can hold.
+    integer_t capacity;
+
+    /// \brief Amount of recorded operations of each kind.
+    integer_t counts[3];
+
+    /// \brief Serializes wkl_record().
+    pthread_mutex_t lock;
+};
+
+// The first line of a saved workload
+static const char wkl_header[] = "# cdsl workload";
+
+// The letter of each operation in a saved workload
+static const char wkl_letters[3] = { 'i', 's', 'r' };
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+wkl_grow(Workload_t *workload);
+
+static bool
+wkl_append(Workload_t *workload, WorkloadOperation operation, int64_t key);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates an empty workload. Operations are added to it with wkl_record()
+/// and it can be written to a file with wkl_save().
+///
+/// \return A new workload or NULL if allocation failed.
+Workload_t *
+wkl_new(void)
+{
+    Workload_t *workload = malloc(sizeof(Workload_t));
+
+    if (!workload)
+        return NULL;
+
+    workload->capacity = 64;
+    workload->operations = malloc(sizeof(unsigned char) * 64);
+    workload->keys = malloc(sizeof(int64_t) * 64);
+
+    if (!workload->operations || !workload->keys)
+    {
+        free(workload->operations);
+        free(workload->keys);
+        free(workload);
+
+        return NULL;
+    }
+
+    workload->size = 0;
+    workload->counts[0] = workload->counts[1] = workload->counts[2] = 0;
+
+    pthread_mutex_init(&workload->lock, NULL);
+
+    return workload;
+}
+
+/// Frees from memory a workload and its recorded operations.
+///
+/// \param[in] workload The workload to be freed.
+void
+wkl_free(Workload_t *workload)
+{
+    pthread_mutex_destroy(&workload->lock);
+
+    free(workload->operations);
+    free(workload->keys);
+    free(workload);
+}
+
+/// \param[in] workload The workload.
+///
+/// \return The amount of recorded operations.
+integer_t
+wkl_size(Workload_t *workload)
+{
+    return workload->size;
+}
+
+/// \param[in] workload The workload.
+/// \param[in] operation The kind of operation to count.
+///
+/// \return The amount of recorded operations of the given kind.
+integer_t
+wkl_count(Workload_t *workload, WorkloadOperation operation)
+{
+    return workload->counts[operation];
+}
+
+/// \param[in] workload The workload.
+/// \param[in] index Position of the operation, less than wkl_size().
+///
+/// \return The operation at the given position.
+WorkloadOperation
+wkl_operation(Workload_t *workload, integer_t index)
+{
+    return (WorkloadOperation)workload->operations[index];
+}
+
+/// Returns the key of every recorded operation, in the order they were
+/// recorded. The pointer is valid until the next call to wkl_record() and
+/// lets a replay give the containers keys that live as long as the workload.
+///
+/// \param[in] workload The workload.
+///
+/// \return The keys of the workload.
+int64_t *
+wkl_keys(Workload_t *workload)
+{
+    return workload->keys;
+}
+
+/// Appends an operation to a workload. Only the key and the kind of
+/// operation are recorded, and a replay checks for itself whether a key is
+/// already in the container, so the application can record every call it
+/// makes regardless of its result. Can be called from many threads at once.
+///
+/// \param[in] workload The workload.
+/// \param[in] operation The kind of operation.
+/// \param[in] key The key given to the operation.
+///
+/// \return True if the operation was recorded or false if allocation failed
+/// or the operation is invalid.
+bool
+wkl_record(Workload_t *workload, WorkloadOperation operation, int64_t key)
+{
+    if (operation < WorkloadInsert || operation > WorkloadRemove)
+        return false;
+
+    pthread_mutex_lock(&workload->lock);
+
+    bool result = wkl_append(workload, operation, key);
+
+    pthread_mutex_unlock(&workload->lock);
+
+    return result;
+}
+
+/// Writes a workload to a text file, one operation per line: a letter, i
+/// for insert, s for search or r for remove, followed by the key. The file
+/// starts with a comment and lines starting with a '#' are ignored when it
+/// is loaded, so a workload can also be written by hand or converted from
+/// the logs of another program.
+///
+/// \param[in] workload The workload.
+/// \param[in] path The file to write to, which is replaced.
+///
+/// \return True if the whole workload was written, otherwise false.
+bool
+wkl_save(Workload_t *workload, const char *path)
+{
+    FILE *file = fopen(path, "w");
+
+    if (!file)
+        return false;
+
+    bool written = fprintf(file, "%s\n", wkl_header) > 0;
+
+    for (integer_t i = 0; written && i < workload->size; i++)
+    {
+        written = fprintf(file, "%c %" PRId64 "\n",
+                          wkl_letters[workload->operations[i]],
+                          workload->keys[i]) > 0;
+    }
+
+    if (fclose(file) != 0)
+        written = false;
+
+    return written;
+}
+
+/// Reads a workload written by wkl_save() or in the same format.
+///
+/// \param[in] path The file to read from.
+///
+/// \return A new workload or NULL if the file could not be read or has an
+/// invalid line.
+Workload_t *
+wkl_load(const char *path)
+{
+    FILE *file = fopen(path, "r");
+
+    if (!file)
+        return NULL;
+
+    Workload_t *workload = wkl_new();
+
+    if (!workload)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    char line[128];
+
+    while (fgets(line, sizeof(line), file))
+    {
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+
+        const char *letter = memchr(wkl_letters, line[0], 3);
+        char *end = NULL;
+
+        if (!letter || line[1] != ' ')
+            goto error;
+
+        int64_t key = (int64_t)strtoll(line + 2, &end, 10);
+
+        if (end == line + 2 || (*end != '\n' && *end != '\0'))
+            goto error;
+
+        WorkloadOperation operation =
+                (WorkloadOperation)(letter - wkl_letters);
+
+        if (!wkl_append(workload, operation, key))
+            goto error;
+    }
+
+    if (ferror(file))
+        goto error;
+
+    fclose(file);
+
+    return workload;
+
+    error:
+    fclose(file);
+    wkl_free(workload);
+    return NULL;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+wkl_grow(Workload_t *workload)
+{
+    integer_t capacity = workload->capacity * 2;
+
+    unsigned char *operations = realloc(workload->operations,
+                                        sizeof(unsigned char) * capacity);
+
+    if (!operations)
+        return false;
+
+    workload->operations = operations;
+
+    int64_t *keys = realloc(workload->keys, sizeof(int64_t) * capacity);
+
+    if (!keys)
+        return false;
+
+    workload->keys = keys;
+    workload->capacity = capacity;
+
+    return true;
+}
+
+static bool
+wkl_append(Workload_t *workload, WorkloadOperation operation, int64_t key)
+{
+    if (workload->size == workload->capacity && !wkl_grow(workload))
+        return false;
+
+    workload->operations[workload->size] = (unsigned char)operation;
+    workload->keys[workload->size] = key;
+    workload->size++;
+    workload->counts[operation]++;
+
+    return true;
+}